@@ -75,6 +75,8 @@ static struct argp_option cmdline_options[] =
     ARGP_COMMON_TIME_OPTIONS,
     ARGP_COMMON_HOSTRANGED_OPTIONS,
     ARGP_COMMON_OPTIONS_DEBUG,
+    ARGP_COMMON_OPTIONS_STATS,
+    ARGP_COMMON_OPTIONS_PACKET_TRACE,
     { "cold-reset", COLD_RESET_KEY, NULL, 0,
       "Perform a cold reset.", 40},
     { "warm-reset", WARM_RESET_KEY, NULL, 0,
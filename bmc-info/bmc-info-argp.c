@@ -65,6 +65,8 @@ static struct argp_option cmdline_options[] =
     ARGP_COMMON_OPTIONS_WORKAROUND_FLAGS,
     ARGP_COMMON_HOSTRANGED_OPTIONS,
     ARGP_COMMON_OPTIONS_DEBUG,
+    ARGP_COMMON_OPTIONS_STATS,
+    ARGP_COMMON_OPTIONS_PACKET_TRACE,
     { "get-device-id", GET_DEVICE_ID_KEY, NULL, 0,
       "Display only device ID information.", 40},
     { "get-device-guid", GET_DEVICE_GUID_KEY, NULL, 0,
@@ -99,7 +99,10 @@ _init_bmc_watchdog (void)
   unsigned int workaround_flags = 0;
   unsigned int flags = 0;
 
-  if (!ipmi_is_root ())
+  /* the mock and broker drivers need no device access */
+  if (cmd_args.common_args.driver_type != IPMI_DEVICE_MOCK
+      && cmd_args.common_args.driver_type != IPMI_DEVICE_BROKER
+      && !ipmi_is_root ())
     err_exit ("Permission denied, must be root.");
 
   parse_get_freeipmi_inband_flags (cmd_args.common_args.workaround_flags_inband,
@@ -385,6 +385,20 @@ hash_key_string (const char *str)
 }
 
 
+unsigned int
+hash_key_bytes (const void *buf, unsigned int len, unsigned int hval)
+{
+    const unsigned char *p = buf;
+    const unsigned int prime = 16777619U;
+    unsigned int i;
+
+    for (i = 0; i < len; i++) {
+        hval = (hval ^ p[i]) * prime;
+    }
+    return (hval);
+}
+
+
 /*****************************************************************************
  *  Internal Functions
  *****************************************************************************/
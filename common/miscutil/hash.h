@@ -173,5 +173,15 @@ unsigned int hash_key_string (const char *str);
  *  A hash_key_f function that hashes the string [str].
  */
 
+#define HASH_KEY_BYTES_INIT 2166136261U
+
+unsigned int hash_key_bytes (const void *buf, unsigned int len,
+    unsigned int hval);
+/*
+ *  Folds [len] bytes at [buf] into the FNV-1a hash value [hval] and
+ *    returns the result.  Start a new hash with HASH_KEY_BYTES_INIT;
+ *    multi-part keys may be hashed by passing the previous result.
+ */
+
 
 #endif /* !LSD_HASH_H */
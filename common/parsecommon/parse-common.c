@@ -62,6 +62,10 @@ parse_inband_driver_type (const char *str)
     return (IPMI_DEVICE_SUNBMC);
   else if (strcasecmp (str, IPMI_PARSE_DEVICE_INTELDCMI_STR) == 0)
     return (IPMI_DEVICE_INTELDCMI);
+  else if (strcasecmp (str, IPMI_PARSE_DEVICE_MOCK_STR) == 0)
+    return (IPMI_DEVICE_MOCK);
+  else if (strcasecmp (str, IPMI_PARSE_DEVICE_BROKER_STR) == 0)
+    return (IPMI_DEVICE_BROKER);
 
   return (-1);
 }
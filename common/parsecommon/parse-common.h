@@ -38,6 +38,8 @@
 #define IPMI_PARSE_DEVICE_SUNBMC_STR    "sunbmc"
 #define IPMI_PARSE_DEVICE_SUNBMC_STR2   "bmc"
 #define IPMI_PARSE_DEVICE_INTELDCMI_STR "inteldcmi"
+#define IPMI_PARSE_DEVICE_MOCK_STR      "mock"
+#define IPMI_PARSE_DEVICE_BROKER_STR    "broker"
 
 #define IPMI_PARSE_WORKAROUND_FLAGS_DEFAULT                                       0x00000000
 
@@ -327,6 +327,9 @@ common_parse_opt (int key,
         }
       common_args->retransmission_timeout = tmp;
       break;
+    case ARGP_SESSION_CACHE_KEY:
+      common_args->session_cache = 1;
+      break;
     case ARGP_AUTHENTICATION_TYPE_KEY:
       if ((tmp = parse_authentication_type (arg)) < 0)
         {
@@ -389,6 +392,17 @@ common_parse_opt (int key,
     case ARGP_DEBUG_KEY:
       common_args->debug++;
       break;
+    case ARGP_STATS_KEY:
+      common_args->stats = 1;
+      break;
+    case ARGP_PACKET_TRACE_KEY:
+      free (common_args->packet_trace_file);
+      if (!(common_args->packet_trace_file = strdup (arg)))
+        {
+          perror ("strdup");
+          exit (EXIT_FAILURE);
+        }
+      break;
 
       /*
        * sdr options
@@ -404,6 +418,24 @@ common_parse_opt (int key,
     case ARGP_SDR_CACHE_RECREATE_KEY:
       common_args->sdr_cache_recreate = 1;
       break;
+    case ARGP_SDR_CACHE_PIPELINE_KEY:
+      common_args->sdr_cache_pipeline = 1;
+      break;
+    case ARGP_SDR_CACHE_SHARED_KEY:
+      common_args->sdr_cache_shared = 1;
+      break;
+    case ARGP_SDR_CACHE_VALIDATE_INTERVAL_KEY:
+      errno = 0;
+      tmp = strtol (arg, &endptr, 0);
+      if (errno
+          || endptr[0] != '\0'
+          || tmp < 0)
+        {
+          fprintf (stderr, "invalid sdr cache validate interval\n");
+          exit (EXIT_FAILURE);
+        }
+      common_args->sdr_cache_validate_interval = tmp;
+      break;
     case ARGP_SDR_CACHE_FILE_KEY:
       free (common_args->sdr_cache_file);
       if (!(common_args->sdr_cache_file = strdup (arg)))
@@ -505,6 +537,7 @@ _init_common_cmd_args (struct common_cmd_args *common_args)
   common_args->k_g_len = 0;
   common_args->session_timeout = 0;
   common_args->retransmission_timeout = 0;
+  common_args->session_cache = 0;
   common_args->authentication_type = IPMI_AUTHENTICATION_TYPE_MD5;
   common_args->cipher_suite_id = 3;
   /* privilege_level set by parent function */
@@ -515,10 +548,15 @@ _init_common_cmd_args (struct common_cmd_args *common_args)
   common_args->workaround_flags_inband = 0;
   common_args->section_specific_workaround_flags = 0;
   common_args->debug = 0;
+  common_args->stats = 0;
+  common_args->packet_trace_file = NULL;
 
   common_args->flush_cache = 0;
   common_args->quiet_cache = 0;
   common_args->sdr_cache_recreate = 0;
+  common_args->sdr_cache_pipeline = 0;
+  common_args->sdr_cache_shared = 0;
+  common_args->sdr_cache_validate_interval = 0;
   common_args->sdr_cache_file = NULL;
   common_args->sdr_cache_directory = NULL;
   common_args->ignore_sdr_cache = 0;
@@ -566,7 +604,13 @@ verify_common_cmd_args_inband (struct common_cmd_args *common_args)
 
   if (common_args->driver_device)
     {
-      if (access (common_args->driver_device, R_OK|W_OK) < 0)
+      int mode = R_OK|W_OK;
+
+      /* mock driver recordings are only read */
+      if (common_args->driver_type == IPMI_DEVICE_MOCK)
+        mode = R_OK;
+
+      if (access (common_args->driver_device, mode) < 0)
         {
           fprintf (stderr, "insufficient permission on driver device '%s'\n",
                    common_args->driver_device);
@@ -41,6 +41,7 @@ enum argp_common_option_keys
     ARGP_DRIVER_DEVICE_KEY = 132,
     ARGP_SESSION_TIMEOUT_KEY = 133,
     ARGP_RETRANSMISSION_TIMEOUT_KEY = 134,
+    ARGP_SESSION_CACHE_KEY = 150,
     ARGP_REGISTER_SPACING_KEY = 135,
     ARGP_TARGET_CHANNEL_NUMBER_KEY = 136,
     ARGP_TARGET_SLAVE_ADDRESS_KEY = 137,
@@ -56,6 +57,8 @@ enum argp_common_option_keys
     ARGP_CONFIG_FILE_KEY = 138,
     ARGP_WORKAROUND_FLAGS_KEY = 'W',
     ARGP_DEBUG_KEY = 139,
+    ARGP_STATS_KEY = 151,
+    ARGP_PACKET_TRACE_KEY = 152,
     /* sdr options */
     ARGP_FLUSH_CACHE_KEY = 140,
     ARGP_FLUSH_CACHE_LEGACY_KEY = 'f',
@@ -65,6 +68,9 @@ enum argp_common_option_keys
     ARGP_SDR_CACHE_FILE_KEY = 143,
     ARGP_SDR_CACHE_DIRECTORY_KEY = 144,
     ARGP_IGNORE_SDR_CACHE_KEY = 145,
+    ARGP_SDR_CACHE_PIPELINE_KEY = 153,
+    ARGP_SDR_CACHE_SHARED_KEY = 154,
+    ARGP_SDR_CACHE_VALIDATE_INTERVAL_KEY = 155,
     /* time options */
     ARGP_UTC_TO_LOCALTIME_KEY = 146,
     ARGP_LOCALTIME_TO_UTC_KEY = 147,
@@ -127,7 +133,9 @@ enum argp_common_option_keys
   { "session-timeout", ARGP_SESSION_TIMEOUT_KEY, "MILLISECONDS", 0,                                             \
       "Specify the session timeout in milliseconds.", 13},                                                      \
   { "retransmission-timeout", ARGP_RETRANSMISSION_TIMEOUT_KEY, "MILLISECONDS", 0,                               \
-      "Specify the packet retransmission timeout in milliseconds.", 14}
+      "Specify the packet retransmission timeout in milliseconds.", 14},                                        \
+  { "session-cache", ARGP_SESSION_CACHE_KEY, 0, 0,                                                              \
+      "Cache session negotiation results to speed up later connections.", 14}
 
 #define ARGP_COMMON_OPTIONS_AUTHENTICATION_TYPE                                                                 \
   { "authentication-type", ARGP_AUTHENTICATION_TYPE_KEY, "AUTHENTICATION-TYPE", 0,                              \
@@ -155,7 +163,13 @@ enum argp_common_option_keys
   { "quiet-cache", ARGP_QUIET_CACHE_KEY,  0, 0,                                                                 \
       "Do not output information about cache creation/deletion.", 21},                                          \
   { "sdr-cache-recreate", ARGP_SDR_CACHE_RECREATE_KEY,  0, 0,                                                   \
-      "Recreate sensor data repository (SDR) cache if cache is out of date or invalid.", 22}
+      "Recreate sensor data repository (SDR) cache if cache is out of date or invalid.", 22},                   \
+  { "sdr-cache-pipeline", ARGP_SDR_CACHE_PIPELINE_KEY,  0, 0,                                                   \
+      "Keep several requests in flight when creating the sensor data repository (SDR) cache.", 22},             \
+  { "sdr-cache-shared", ARGP_SDR_CACHE_SHARED_KEY,  0, 0,                                                       \
+      "Share identical sensor data repository (SDR) caches between hosts.", 22},                                \
+  { "sdr-cache-validate-interval", ARGP_SDR_CACHE_VALIDATE_INTERVAL_KEY, "SECONDS", 0,                         \
+      "Specify how often the sensor data repository (SDR) cache is checked for being out of date.", 22}
 
 /* older -f option maintained for backwards compatability */
 #define ARGP_COMMON_SDR_CACHE_OPTIONS_LEGACY                                                                    \
@@ -198,6 +212,14 @@ enum argp_common_option_keys
   { "debug",     ARGP_DEBUG_KEY, 0, 0,                                                                          \
       "Turn on debugging.", 34}
 
+#define ARGP_COMMON_OPTIONS_STATS                                                                               \
+  { "stats",     ARGP_STATS_KEY, 0, 0,                                                                          \
+      "Output IPMI command statistics.", 35}
+
+#define ARGP_COMMON_OPTIONS_PACKET_TRACE                                                                        \
+  { "packet-trace", ARGP_PACKET_TRACE_KEY, "FILE", 0,                                                           \
+      "Write the most recent IPMI packets to FILE in pcap format.", 36}
+
 struct common_cmd_args
 {
   /* inband options */
@@ -220,6 +242,7 @@ struct common_cmd_args
   unsigned int k_g_len;
   unsigned int session_timeout;
   unsigned int retransmission_timeout;
+  int session_cache;
   int authentication_type;
   int cipher_suite_id;
   int privilege_level;
@@ -234,11 +257,16 @@ struct common_cmd_args
   unsigned int workaround_flags_sdr;
   unsigned int section_specific_workaround_flags;
   int debug;
+  int stats;
+  char *packet_trace_file;
 
   /* sdr options */
   int flush_cache;
   int quiet_cache;
   int sdr_cache_recreate;
+  int sdr_cache_pipeline;
+  int sdr_cache_shared;
+  unsigned int sdr_cache_validate_interval;
   char *sdr_cache_file;
   char *sdr_cache_directory;
   int ignore_sdr_cache;
@@ -29,13 +29,16 @@
 #include <unistd.h>
 #endif /* HAVE_UNISTD_H */
 #include <sys/types.h>
+#include <sys/param.h>
 #include <sys/resource.h>
+#include <fcntl.h>
 #include <errno.h>
 #include <assert.h>
 
 #include <freeipmi/freeipmi.h>
 
 #include "tool-common.h"
+#include "tool-sdr-cache-common.h"
 #include "tool-util-common.h"
 
 #include "parse-common.h"
@@ -43,6 +46,10 @@
 #include "freeipmi-portability.h"
 #include "network.h"
 
+#ifndef MAXPATHLEN
+#define MAXPATHLEN 4096
+#endif /* MAXPATHLEN */
+
 ipmi_ctx_t
 ipmi_open (const char *progname,
            const char *hostname,
@@ -65,8 +72,41 @@ ipmi_open (const char *progname,
       goto cleanup;
     }
 
+  if (common_args->packet_trace_file)
+    {
+      if (ipmi_ctx_set_pkt_trace (ipmi_ctx, IPMI_PKT_TRACE_SIZE_DEFAULT) < 0)
+        {
+          PSTDOUT_FPRINTF (pstate,
+                           stderr,
+                           "ipmi_ctx_set_pkt_trace: %s\n",
+                           ipmi_ctx_errormsg (ipmi_ctx));
+          goto cleanup;
+        }
+    }
+
   if (hostname && !host_is_localhost (hostname))
     {
+      if (common_args->session_cache)
+        {
+          char cachedirbuf[MAXPATHLEN+1];
+
+          memset (cachedirbuf, '\0', MAXPATHLEN+1);
+          if (sdr_cache_get_session_cache_directory (pstate,
+                                                     common_args,
+                                                     cachedirbuf,
+                                                     MAXPATHLEN) < 0)
+            goto cleanup;
+
+          if (ipmi_ctx_set_session_cache (ipmi_ctx, cachedirbuf) < 0)
+            {
+              PSTDOUT_FPRINTF (pstate,
+                               stderr,
+                               "ipmi_ctx_set_session_cache: %s\n",
+                               ipmi_ctx_errormsg (ipmi_ctx));
+              goto cleanup;
+            }
+        }
+
       if (common_args->driver_type == IPMI_DEVICE_LAN_2_0)
         {
           parse_get_freeipmi_outofband_2_0_flags (common_args->workaround_flags_outofband_2_0,
@@ -149,7 +189,10 @@ ipmi_open (const char *progname,
     }
   else
     {
-      if (!ipmi_is_root ())
+      /* the mock and broker drivers need no device access */
+      if (common_args->driver_type != IPMI_DEVICE_MOCK
+          && common_args->driver_type != IPMI_DEVICE_BROKER
+          && !ipmi_is_root ())
         {
           PSTDOUT_FPRINTF (pstate,
                            stderr,
@@ -235,7 +278,211 @@ ipmi_open (const char *progname,
   return (ipmi_ctx);
 
  cleanup:
+  /* a trace of a failed session establishment is the most useful one */
+  ipmi_write_pkt_trace (pstate, hostname, ipmi_ctx, common_args);
   ipmi_ctx_close (ipmi_ctx);
   ipmi_ctx_destroy (ipmi_ctx);
   return (NULL);
 }
+
+#define IPMI_STATS_LINE_BUFLEN 1024
+
+static void
+_ipmi_print_stats_counters (pstdout_state_t pstate,
+                            const char *name,
+                            struct ipmi_stats_counters *counters)
+{
+  char buf[IPMI_STATS_LINE_BUFLEN];
+  unsigned int len = 0;
+  unsigned int responses = 0;
+  unsigned int i;
+
+  assert (name);
+  assert (counters);
+
+  if (!counters->requests)
+    return;
+
+  for (i = 0; i < IPMI_STATS_LATENCY_BUCKETS; i++)
+    responses += counters->latency[i];
+
+  PSTDOUT_FPRINTF (pstate,
+                   stderr,
+                   "%-48.48s %8u %8u %8u %8u %10.3f %10.3f\n",
+                   name,
+                   counters->requests,
+                   counters->retransmissions,
+                   counters->timeouts,
+                   counters->errors,
+                   responses ? (double)counters->latency_total / responses / 1000.0 : 0.0,
+                   (double)counters->latency_max / 1000.0);
+
+  if (!responses)
+    return;
+
+  /* latency histogram, without empty buckets */
+  buf[0] = '\0';
+  for (i = 0; i < IPMI_STATS_LATENCY_BUCKETS; i++)
+    {
+      int ret;
+
+      if (!counters->latency[i])
+        continue;
+
+      if (!i)
+        ret = snprintf (buf + len,
+                        IPMI_STATS_LINE_BUFLEN - len,
+                        " <1ms:%u",
+                        counters->latency[i]);
+      else if (i == IPMI_STATS_LATENCY_BUCKETS - 1)
+        ret = snprintf (buf + len,
+                        IPMI_STATS_LINE_BUFLEN - len,
+                        " >=%ums:%u",
+                        1U << (i - 1),
+                        counters->latency[i]);
+      else
+        ret = snprintf (buf + len,
+                        IPMI_STATS_LINE_BUFLEN - len,
+                        " %u-%ums:%u",
+                        1U << (i - 1),
+                        1U << i,
+                        counters->latency[i]);
+
+      if (ret < 0 || ret >= (IPMI_STATS_LINE_BUFLEN - len))
+        break;
+
+      len += ret;
+    }
+
+  PSTDOUT_FPRINTF (pstate,
+                   stderr,
+                   "%-48s%s\n",
+                   "",
+                   buf);
+}
+
+void
+ipmi_print_stats (pstdout_state_t pstate,
+                  ipmi_ctx_t ipmi_ctx,
+                  struct common_cmd_args *common_args)
+{
+  static const char *session_setup_str[IPMI_STATS_SESSION_SETUP_PHASES] =
+    {
+      "Get Channel Authentication Capabilities",
+      "Get Session Challenge",
+      "Activate Session",
+      "Open Session Request",
+      "RAKP Message 1",
+      "RAKP Message 3",
+      "Set Session Privilege Level",
+    };
+  struct ipmi_stats stats;
+  char name[IPMI_STATS_LINE_BUFLEN];
+  unsigned int i;
+
+  assert (common_args);
+
+  if (!common_args->stats || !ipmi_ctx)
+    return;
+
+  if (ipmi_ctx_get_stats (ipmi_ctx, &stats) < 0)
+    {
+      PSTDOUT_FPRINTF (pstate,
+                       stderr,
+                       "ipmi_ctx_get_stats: %s\n",
+                       ipmi_ctx_errormsg (ipmi_ctx));
+      return;
+    }
+
+  PSTDOUT_FPRINTF (pstate,
+                   stderr,
+                   "%-48s %8s %8s %8s %8s %10s %10s\n",
+                   "Command",
+                   "Requests",
+                   "Retrans",
+                   "Timeouts",
+                   "Errors",
+                   "Avg ms",
+                   "Max ms");
+
+  for (i = 0; i < IPMI_STATS_SESSION_SETUP_PHASES; i++)
+    {
+      snprintf (name,
+                IPMI_STATS_LINE_BUFLEN,
+                "Session: %s",
+                session_setup_str[i]);
+      _ipmi_print_stats_counters (pstate, name, &(stats.session_setup[i]));
+    }
+
+  for (i = 0; i < stats.cmds_count; i++)
+    {
+      const char *str;
+
+      str = ipmi_cmd_str (stats.cmds[i].net_fn, stats.cmds[i].cmd);
+      if (str && strcmp (str, "Unknown"))
+        snprintf (name, IPMI_STATS_LINE_BUFLEN, "%s", str);
+      else
+        snprintf (name,
+                  IPMI_STATS_LINE_BUFLEN,
+                  "NetFn 0x%02X Cmd 0x%02X",
+                  stats.cmds[i].net_fn,
+                  stats.cmds[i].cmd);
+      _ipmi_print_stats_counters (pstate, name, &(stats.cmds[i].counters));
+    }
+
+  _ipmi_print_stats_counters (pstate, "Other", &(stats.other));
+}
+
+void
+ipmi_write_pkt_trace (pstdout_state_t pstate,
+                      const char *hostname,
+                      ipmi_ctx_t ipmi_ctx,
+                      struct common_cmd_args *common_args)
+{
+  char filename[MAXPATHLEN+1];
+  int fd = -1;
+
+  assert (common_args);
+
+  if (!common_args->packet_trace_file || !ipmi_ctx)
+    return;
+
+  /* hostname differs from the command line when a hostrange is used */
+  if (hostname
+      && common_args->hostname
+      && strcmp (hostname, common_args->hostname))
+    snprintf (filename,
+              MAXPATHLEN,
+              "%s.%s",
+              common_args->packet_trace_file,
+              hostname);
+  else
+    snprintf (filename,
+              MAXPATHLEN,
+              "%s",
+              common_args->packet_trace_file);
+
+  if ((fd = open (filename, O_WRONLY | O_CREAT | O_TRUNC, 0600)) < 0)
+    {
+      PSTDOUT_FPRINTF (pstate,
+                       stderr,
+                       "open: %s: %s\n",
+                       filename,
+                       strerror (errno));
+      return;
+    }
+
+  if (ipmi_ctx_write_pkt_trace (ipmi_ctx, fd) < 0)
+    PSTDOUT_FPRINTF (pstate,
+                     stderr,
+                     "ipmi_ctx_write_pkt_trace: %s\n",
+                     ipmi_ctx_errormsg (ipmi_ctx));
+
+  /* close() also reports write errors some file systems defer */
+  if (close (fd) < 0)
+    PSTDOUT_FPRINTF (pstate,
+                     stderr,
+                     "close: %s: %s\n",
+                     filename,
+                     strerror (errno));
+}
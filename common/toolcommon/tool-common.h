@@ -31,4 +31,20 @@ ipmi_ctx_t ipmi_open (const char *progname,
                       pstdout_state_t pstate,
                       unsigned int flags);
 
+/* output command statistics of the context if requested through
+ * common_args
+ */
+void ipmi_print_stats (pstdout_state_t pstate,
+                       ipmi_ctx_t ipmi_ctx,
+                       struct common_cmd_args *common_args);
+
+/* write the packet trace of the context to the file requested through
+ * common_args, suffixed with the hostname if multiple hosts were
+ * specified
+ */
+void ipmi_write_pkt_trace (pstdout_state_t pstate,
+                           const char *hostname,
+                           ipmi_ctx_t ipmi_ctx,
+                           struct common_cmd_args *common_args);
+
 #endif /* TOOL_COMMON_H */
@@ -1315,10 +1315,13 @@ config_file_parse (const char *filename,
 
   int username_count = 0, password_count = 0, k_g_count = 0,
     session_timeout_count = 0, retransmission_timeout_count = 0,
+    session_cache_count = 0,
     authentication_type_count = 0, cipher_suite_id_count = 0,
     privilege_level_count = 0;
 
-  int quiet_cache_count = 0, sdr_cache_directory_count = 0;
+  int quiet_cache_count = 0, sdr_cache_directory_count = 0,
+    sdr_cache_recreate_count = 0, sdr_cache_pipeline_count = 0,
+    sdr_cache_shared_count = 0, sdr_cache_validate_interval_count = 0;
 
   int utc_to_localtime_count = 0, localtime_to_utc_count = 0,
     utc_offset_count = 0;
@@ -1584,6 +1587,17 @@ config_file_parse (const char *filename,
         &(common_args->retransmission_timeout),
         0
       },
+      {
+        "session-cache",
+        CONFFILE_OPTION_BOOL,
+        -1,
+        _config_file_bool,
+        1,
+        0,
+        &session_cache_count,
+        &(common_args->session_cache),
+        0
+      },
       {
         "authentication-type",
         CONFFILE_OPTION_STRING,
@@ -1643,6 +1657,50 @@ config_file_parse (const char *filename,
         &(common_args->sdr_cache_directory),
         0
       },
+      {
+        "sdr-cache-recreate",
+        CONFFILE_OPTION_BOOL,
+        -1,
+        _config_file_bool,
+        1,
+        0,
+        &sdr_cache_recreate_count,
+        &(common_args->sdr_cache_recreate),
+        0
+      },
+      {
+        "sdr-cache-pipeline",
+        CONFFILE_OPTION_BOOL,
+        -1,
+        _config_file_bool,
+        1,
+        0,
+        &sdr_cache_pipeline_count,
+        &(common_args->sdr_cache_pipeline),
+        0
+      },
+      {
+        "sdr-cache-shared",
+        CONFFILE_OPTION_BOOL,
+        -1,
+        _config_file_bool,
+        1,
+        0,
+        &sdr_cache_shared_count,
+        &(common_args->sdr_cache_shared),
+        0
+      },
+      {
+        "sdr-cache-validate-interval",
+        CONFFILE_OPTION_INT,
+        -1,
+        _config_file_unsigned_int,
+        1,
+        0,
+        &sdr_cache_validate_interval_count,
+        &(common_args->sdr_cache_validate_interval),
+        0
+      },
     };
 
   struct conffile_option time_options[] =
@@ -4510,6 +4568,8 @@ config_file_parse (const char *filename,
                  sdr_options,
                  options_len);
 
+  config_file_options_len += options_len;
+
   options_len = sizeof (time_options)/sizeof (struct conffile_option);
   if (!(support & CONFIG_FILE_TIME))
     _ignore_options (time_options, options_len);
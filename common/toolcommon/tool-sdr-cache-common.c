@@ -30,6 +30,17 @@
 #include <sys/param.h>
 #include <sys/types.h>
 #include <sys/stat.h>
+#include <fcntl.h>
+#if TIME_WITH_SYS_TIME
+#include <sys/time.h>
+#include <time.h>
+#else /* !TIME_WITH_SYS_TIME */
+#if HAVE_SYS_TIME_H
+#include <sys/time.h>
+#else /* !HAVE_SYS_TIME_H */
+#include <time.h>
+#endif /* !HAVE_SYS_TIME_H */
+#endif /* !TIME_WITH_SYS_TIME */
 #if HAVE_UNISTD_H
 #include <unistd.h>
 #endif  /* HAVE_UNISTD_H */
@@ -43,6 +54,11 @@
 
 #define SDR_CACHE_DIR                     "sdr-cache"
 #define SDR_CACHE_FILENAME_PREFIX         "sdr-cache"
+#define SDR_CACHE_SHARED_DIR              "shared"
+#define SDR_CACHE_SHARED_CACHE_PREFIX     "sdr-"
+#define SDR_CACHE_SHARED_INDEX_PREFIX     "fingerprint-"
+#define SDR_CACHE_FINGERPRINT_LEN         256
+#define SDR_CACHE_VALIDATED_SUFFIX        ".validated"
 #define FREEIPMI_CONFIG_DIRECTORY_MODE    0700
 
 #ifndef MAXHOSTNAMELEN
@@ -56,6 +72,7 @@
 #include "tool-sdr-cache-common.h"
 
 #include "freeipmi-portability.h"
+#include "fd.h"
 #include "pstdout.h"
 #include "tool-cmdline-common.h"
 
@@ -518,6 +535,542 @@ _sdr_cache_create_directory (pstdout_state_t pstate,
   return (0);
 }
 
+/* FNV-1a */
+static uint64_t
+_sdr_cache_shared_hash (const void *buf, unsigned int buflen)
+{
+  const uint8_t *p = buf;
+  uint64_t hash = 0xCBF29CE484222325ULL;
+  unsigned int i;
+
+  for (i = 0; i < buflen; i++)
+    {
+      hash ^= p[i];
+      hash *= 0x100000001B3ULL;
+    }
+
+  return (hash);
+}
+
+static int
+_sdr_cache_shared_path (pstdout_state_t pstate,
+                        const struct common_cmd_args *common_args,
+                        const char *filename,
+                        char *buf,
+                        unsigned int buflen)
+{
+  char cachedirectorybuf[MAXPATHLEN+1];
+  int ret;
+
+  assert (common_args);
+  assert (buf);
+  assert (buflen);
+
+  memset (cachedirectorybuf, '\0', MAXPATHLEN+1);
+  if (_sdr_cache_get_cache_directory (pstate,
+                                      common_args->sdr_cache_directory,
+                                      cachedirectorybuf,
+                                      MAXPATHLEN) < 0)
+    return (-1);
+
+  if ((ret = snprintf (buf,
+                       buflen,
+                       "%s/%s%s%s",
+                       cachedirectorybuf,
+                       SDR_CACHE_SHARED_DIR,
+                       filename ? "/" : "",
+                       filename ? filename : "")) < 0)
+    {
+      PSTDOUT_PERROR (pstate, "snprintf");
+      return (-1);
+    }
+
+  if (ret >= buflen)
+    {
+      PSTDOUT_FPRINTF (pstate,
+                       stderr,
+                       "snprintf invalid bytes written\n");
+      return (-1);
+    }
+
+  return (0);
+}
+
+static int
+_sdr_cache_shared_fingerprint_fields (fiid_obj_t obj,
+                                      const char **fields,
+                                      char *buf,
+                                      unsigned int buflen,
+                                      unsigned int *len)
+{
+  unsigned int i;
+
+  assert (fiid_obj_valid (obj));
+  assert (fields);
+  assert (buf);
+  assert (buflen);
+  assert (len);
+
+  for (i = 0; fields[i]; i++)
+    {
+      uint64_t val;
+      int ret;
+
+      /* optional fields not returned by the BMC are listed as '-' */
+      if ((ret = fiid_obj_get (obj, fields[i], &val)) < 0)
+        return (-1);
+
+      if (ret)
+        ret = snprintf (buf + *len, buflen - *len, "%s%llX", *len ? "." : "", (unsigned long long)val);
+      else
+        ret = snprintf (buf + *len, buflen - *len, "%s-", *len ? "." : "");
+
+      if (ret < 0 || ret >= (buflen - *len))
+        return (-1);
+
+      (*len) += ret;
+    }
+
+  return (0);
+}
+
+/* Describes the SDR a host is expected to have.  Hosts with the same
+ * device identity and firmware whose SDR repositories report the
+ * same version, record count, and timestamps are assumed to have
+ * identical SDRs.
+ */
+static int
+_sdr_cache_shared_fingerprint (ipmi_ctx_t ipmi_ctx,
+                               char *buf,
+                               unsigned int buflen)
+{
+  const char *device_id_fields[] =
+    {
+      "manufacturer_id.id",
+      "product_id",
+      "device_id",
+      "device_revision.revision",
+      "firmware_revision1.major_revision",
+      "firmware_revision2.minor_revision",
+      "ipmi_version_major",
+      "ipmi_version_minor",
+      "auxiliary_firmware_revision_information",
+      NULL
+    };
+  const char *sdr_repository_info_fields[] =
+    {
+      "sdr_version_major",
+      "sdr_version_minor",
+      "record_count",
+      "most_recent_addition_timestamp",
+      "most_recent_erase_timestamp",
+      NULL
+    };
+  fiid_obj_t obj_device_id_rs = NULL;
+  fiid_obj_t obj_sdr_repository_info_rs = NULL;
+  unsigned int len = 0;
+  int rv = -1;
+
+  assert (ipmi_ctx);
+  assert (buf);
+  assert (buflen);
+
+  if (!(obj_device_id_rs = fiid_obj_create (tmpl_cmd_get_device_id_rs)))
+    goto cleanup;
+
+  if (!(obj_sdr_repository_info_rs = fiid_obj_create (tmpl_cmd_get_sdr_repository_info_rs)))
+    goto cleanup;
+
+  if (ipmi_cmd_get_device_id (ipmi_ctx, obj_device_id_rs) < 0)
+    goto cleanup;
+
+  if (ipmi_cmd_get_sdr_repository_info (ipmi_ctx, obj_sdr_repository_info_rs) < 0)
+    goto cleanup;
+
+  if (_sdr_cache_shared_fingerprint_fields (obj_device_id_rs,
+                                            device_id_fields,
+                                            buf,
+                                            buflen,
+                                            &len) < 0)
+    goto cleanup;
+
+  if (_sdr_cache_shared_fingerprint_fields (obj_sdr_repository_info_rs,
+                                            sdr_repository_info_fields,
+                                            buf,
+                                            buflen,
+                                            &len) < 0)
+    goto cleanup;
+
+  rv = 0;
+ cleanup:
+  fiid_obj_destroy (obj_device_id_rs);
+  fiid_obj_destroy (obj_sdr_repository_info_rs);
+  return (rv);
+}
+
+static int
+_sdr_cache_shared_index_path (pstdout_state_t pstate,
+                              const struct common_cmd_args *common_args,
+                              const char *fingerprint,
+                              char *buf,
+                              unsigned int buflen)
+{
+  char filenamebuf[MAXPATHLEN+1];
+
+  assert (common_args);
+  assert (fingerprint);
+  assert (buf);
+  assert (buflen);
+
+  snprintf (filenamebuf,
+            MAXPATHLEN,
+            "%s%016llx",
+            SDR_CACHE_SHARED_INDEX_PREFIX,
+            (unsigned long long)_sdr_cache_shared_hash (fingerprint, strlen (fingerprint)));
+
+  return (_sdr_cache_shared_path (pstate,
+                                  common_args,
+                                  filenamebuf,
+                                  buf,
+                                  buflen));
+}
+
+/* Replace 'filename' with a hard link to 'target'.  The link is made
+ * under a temporary name and renamed, so 'filename' is never seen
+ * partially created.
+ */
+static int
+_sdr_cache_shared_link (const char *target, const char *filename)
+{
+  char tmpfilenamebuf[MAXPATHLEN+1];
+  int ret;
+
+  assert (target);
+  assert (filename);
+
+  if ((ret = snprintf (tmpfilenamebuf,
+                       MAXPATHLEN,
+                       "%s.%u",
+                       filename,
+                       (unsigned int)getpid ())) < 0
+      || ret >= MAXPATHLEN)
+    return (-1);
+
+  /* ignore potential error, may not exist */
+  unlink (tmpfilenamebuf);
+
+  if (link (target, tmpfilenamebuf) < 0)
+    return (-1);
+
+  if (rename (tmpfilenamebuf, filename) < 0)
+    {
+      /* ignore potential error, cleanup path */
+      unlink (tmpfilenamebuf);
+      return (-1);
+    }
+
+  return (0);
+}
+
+static int
+_sdr_cache_shared_read_file (const char *filename,
+                             uint8_t **buf,
+                             unsigned int *buflen)
+{
+  struct stat statbuf;
+  uint8_t *tbuf = NULL;
+  ssize_t len;
+  int fd = -1;
+  int rv = -1;
+
+  assert (filename);
+  assert (buf);
+  assert (buflen);
+
+  if ((fd = open (filename, O_RDONLY)) < 0)
+    goto cleanup;
+
+  if (fstat (fd, &statbuf) < 0)
+    goto cleanup;
+
+  if (!statbuf.st_size || statbuf.st_size > INT_MAX)
+    goto cleanup;
+
+  if (!(tbuf = malloc (statbuf.st_size)))
+    goto cleanup;
+
+  if ((len = fd_read_n (fd, tbuf, statbuf.st_size)) != statbuf.st_size)
+    goto cleanup;
+
+  (*buf) = tbuf;
+  (*buflen) = len;
+  tbuf = NULL;
+  rv = 0;
+ cleanup:
+  free (tbuf);
+  if (fd >= 0)
+    /* ignore potential error, cleanup path */
+    close (fd);
+  return (rv);
+}
+
+/* Look up 'fingerprint' in the shared store and, if a cache was
+ * stored for it, make 'cachefilename' a link to that cache.
+ *
+ * Returns 1 if adopted, 0 if not.
+ */
+static int
+_sdr_cache_shared_adopt (pstdout_state_t pstate,
+                         const struct common_cmd_args *common_args,
+                         const char *fingerprint,
+                         const char *cachefilename)
+{
+  char indexfilenamebuf[MAXPATHLEN+1];
+  char sharedfilenamebuf[MAXPATHLEN+1];
+  char fingerprintbuf[SDR_CACHE_FINGERPRINT_LEN + 2];
+  char namebuf[SDR_CACHE_FINGERPRINT_LEN + 2];
+  char *ptr;
+  FILE *fp = NULL;
+  int rv = 0;
+
+  assert (common_args);
+  assert (fingerprint);
+  assert (cachefilename);
+
+  memset (indexfilenamebuf, '\0', MAXPATHLEN+1);
+  if (_sdr_cache_shared_index_path (pstate,
+                                    common_args,
+                                    fingerprint,
+                                    indexfilenamebuf,
+                                    MAXPATHLEN) < 0)
+    goto cleanup;
+
+  if (!(fp = fopen (indexfilenamebuf, "r")))
+    goto cleanup;
+
+  memset (fingerprintbuf, '\0', SDR_CACHE_FINGERPRINT_LEN + 2);
+  memset (namebuf, '\0', SDR_CACHE_FINGERPRINT_LEN + 2);
+  if (!fgets (fingerprintbuf, SDR_CACHE_FINGERPRINT_LEN + 2, fp)
+      || !fgets (namebuf, SDR_CACHE_FINGERPRINT_LEN + 2, fp))
+    goto cleanup;
+
+  if ((ptr = strchr (fingerprintbuf, '\n')))
+    *ptr = '\0';
+  if ((ptr = strchr (namebuf, '\n')))
+    *ptr = '\0';
+
+  /* index files are named by hash, so check for the unlikely collision */
+  if (strcmp (fingerprintbuf, fingerprint))
+    goto cleanup;
+
+  if (strncmp (namebuf,
+               SDR_CACHE_SHARED_CACHE_PREFIX,
+               strlen (SDR_CACHE_SHARED_CACHE_PREFIX))
+      || strchr (namebuf, '/'))
+    goto cleanup;
+
+  memset (sharedfilenamebuf, '\0', MAXPATHLEN+1);
+  if (_sdr_cache_shared_path (pstate,
+                              common_args,
+                              namebuf,
+                              sharedfilenamebuf,
+                              MAXPATHLEN) < 0)
+    goto cleanup;
+
+  if (_sdr_cache_shared_link (sharedfilenamebuf, cachefilename) < 0)
+    goto cleanup;
+
+  rv = 1;
+ cleanup:
+  if (fp)
+    fclose (fp);
+  return (rv);
+}
+
+/* Move a newly created cache into the shared store, or link to an
+ * identical cache already there, and record it under 'fingerprint'.
+ * Failures only lose the sharing, the host's cache is unaffected.
+ */
+static void
+_sdr_cache_shared_store (pstdout_state_t pstate,
+                         const struct common_cmd_args *common_args,
+                         const char *fingerprint,
+                         const char *cachefilename)
+{
+  char shareddirectorybuf[MAXPATHLEN+1];
+  char sharedfilenamebuf[MAXPATHLEN+1];
+  char indexfilenamebuf[MAXPATHLEN+1];
+  char tmpfilenamebuf[MAXPATHLEN+1];
+  char namebuf[MAXPATHLEN+1];
+  uint8_t *cachebuf = NULL;
+  unsigned int cachebuflen = 0;
+  uint8_t *sharedbuf = NULL;
+  unsigned int sharedbuflen = 0;
+  FILE *fp;
+  int ret;
+
+  assert (common_args);
+  assert (fingerprint);
+  assert (cachefilename);
+
+  memset (shareddirectorybuf, '\0', MAXPATHLEN+1);
+  if (_sdr_cache_shared_path (pstate,
+                              common_args,
+                              NULL,
+                              shareddirectorybuf,
+                              MAXPATHLEN) < 0)
+    goto cleanup;
+
+  if (mkdir (shareddirectorybuf, FREEIPMI_CONFIG_DIRECTORY_MODE) < 0
+      && errno != EEXIST)
+    goto cleanup;
+
+  if (_sdr_cache_shared_read_file (cachefilename, &cachebuf, &cachebuflen) < 0)
+    goto cleanup;
+
+  snprintf (namebuf,
+            MAXPATHLEN,
+            "%s%016llx",
+            SDR_CACHE_SHARED_CACHE_PREFIX,
+            (unsigned long long)_sdr_cache_shared_hash (cachebuf, cachebuflen));
+
+  memset (sharedfilenamebuf, '\0', MAXPATHLEN+1);
+  if (_sdr_cache_shared_path (pstate,
+                              common_args,
+                              namebuf,
+                              sharedfilenamebuf,
+                              MAXPATHLEN) < 0)
+    goto cleanup;
+
+  if (link (cachefilename, sharedfilenamebuf) < 0)
+    {
+      if (errno != EEXIST)
+        goto cleanup;
+
+      /* An identical cache was stored by another host, share it.
+       * Caches are named by hash, so compare the contents.
+       */
+      if (_sdr_cache_shared_read_file (sharedfilenamebuf, &sharedbuf, &sharedbuflen) < 0)
+        goto cleanup;
+
+      if (sharedbuflen != cachebuflen
+          || memcmp (sharedbuf, cachebuf, cachebuflen))
+        goto cleanup;
+
+      if (_sdr_cache_shared_link (sharedfilenamebuf, cachefilename) < 0)
+        goto cleanup;
+    }
+
+  memset (indexfilenamebuf, '\0', MAXPATHLEN+1);
+  if (_sdr_cache_shared_index_path (pstate,
+                                    common_args,
+                                    fingerprint,
+                                    indexfilenamebuf,
+                                    MAXPATHLEN) < 0)
+    goto cleanup;
+
+  if ((ret = snprintf (tmpfilenamebuf,
+                       MAXPATHLEN,
+                       "%s.%u",
+                       indexfilenamebuf,
+                       (unsigned int)getpid ())) < 0
+      || ret >= MAXPATHLEN)
+    goto cleanup;
+
+  if (!(fp = fopen (tmpfilenamebuf, "w")))
+    goto cleanup;
+
+  ret = fprintf (fp, "%s\n%s\n", fingerprint, namebuf);
+  if (fclose (fp) || ret < 0
+      || rename (tmpfilenamebuf, indexfilenamebuf) < 0)
+    {
+      /* ignore potential error, cleanup path */
+      unlink (tmpfilenamebuf);
+      goto cleanup;
+    }
+
+ cleanup:
+  free (cachebuf);
+  free (sharedbuf);
+}
+
+static int
+_sdr_cache_get_validated_filename (const char *cachefilename,
+                                   char *buf,
+                                   unsigned int buflen)
+{
+  int ret;
+
+  assert (cachefilename);
+  assert (buf);
+  assert (buflen);
+
+  if ((ret = snprintf (buf,
+                       buflen,
+                       "%s%s",
+                       cachefilename,
+                       SDR_CACHE_VALIDATED_SUFFIX)) < 0
+      || ret >= buflen)
+    return (-1);
+
+  return (0);
+}
+
+/* The modification time of the validated file records when the cache
+ * was last checked against the BMC.  It is kept separate from the
+ * cache, which may be shared with other hosts.
+ */
+static int
+_sdr_cache_validated_recently (const char *cachefilename,
+                               unsigned int validate_interval)
+{
+  char validatedfilenamebuf[MAXPATHLEN+1];
+  struct stat statbuf;
+  time_t now;
+
+  assert (cachefilename);
+  assert (validate_interval);
+
+  memset (validatedfilenamebuf, '\0', MAXPATHLEN+1);
+  if (_sdr_cache_get_validated_filename (cachefilename,
+                                         validatedfilenamebuf,
+                                         MAXPATHLEN) < 0)
+    return (0);
+
+  if (stat (validatedfilenamebuf, &statbuf) < 0)
+    return (0);
+
+  now = time (NULL);
+
+  /* a modification time in the future means the clock was changed */
+  if (statbuf.st_mtime > now
+      || (now - statbuf.st_mtime) >= validate_interval)
+    return (0);
+
+  return (1);
+}
+
+static void
+_sdr_cache_validated (const char *cachefilename)
+{
+  char validatedfilenamebuf[MAXPATHLEN+1];
+  int fd;
+
+  assert (cachefilename);
+
+  memset (validatedfilenamebuf, '\0', MAXPATHLEN+1);
+  if (_sdr_cache_get_validated_filename (cachefilename,
+                                         validatedfilenamebuf,
+                                         MAXPATHLEN) < 0)
+    return;
+
+  /* ignore potential errors, the cache is validated again next time */
+  if ((fd = open (validatedfilenamebuf, O_CREAT | O_WRONLY, 0644)) < 0)
+    return;
+  close (fd);
+  utimes (validatedfilenamebuf, NULL);
+}
+
 int
 _sdr_cache_create (ipmi_sdr_ctx_t ctx,
                    pstdout_state_t pstate,
@@ -526,14 +1079,19 @@ _sdr_cache_create (ipmi_sdr_ctx_t ctx,
                    const struct common_cmd_args *common_args)
 {
   char cachefilenamebuf[MAXPATHLEN+1];
+  char tmpfilenamebuf[MAXPATHLEN+1];
+  int tmpfile_created = 0;
   int count = 0;
   int cache_create_flags = 0;
+  int ret;
   int rv = -1;
 
   assert (ctx);
   assert (ipmi_ctx);
   assert (common_args);
 
+  memset (tmpfilenamebuf, '\0', MAXPATHLEN+1);
+
   if (_sdr_cache_create_directory (pstate, common_args->sdr_cache_directory) < 0)
     goto cleanup;
 
@@ -545,6 +1103,29 @@ _sdr_cache_create (ipmi_sdr_ctx_t ctx,
                                      MAXPATHLEN) < 0)
     goto cleanup;
 
+  /* The cache is created under a temporary name and renamed over
+   * any old cache once complete.  Processes reading the old cache
+   * keep reading it undisturbed, and an old cache shared with other
+   * hosts is never overwritten in place.
+   */
+  if ((ret = snprintf (tmpfilenamebuf,
+                       MAXPATHLEN,
+                       "%s.%u",
+                       cachefilenamebuf,
+                       (unsigned int)getpid ())) < 0)
+    {
+      PSTDOUT_PERROR (pstate, "snprintf");
+      goto cleanup;
+    }
+
+  if (ret >= MAXPATHLEN)
+    {
+      PSTDOUT_FPRINTF (pstate,
+                       stderr,
+                       "snprintf invalid bytes written\n");
+      goto cleanup;
+    }
+
   /* pstdout library can't handle \r, its the responsibility of
    * tool code to set quiet_cache if there are multiple
    * hosts are generating the cache at the same time.
@@ -554,17 +1135,18 @@ _sdr_cache_create (ipmi_sdr_ctx_t ctx,
              "Caching SDR repository information: %s\n",
              cachefilenamebuf);
 
-  if (common_args->sdr_cache_recreate)
-    cache_create_flags = IPMI_SDR_CACHE_CREATE_FLAGS_OVERWRITE;
-  else
-    cache_create_flags = IPMI_SDR_CACHE_CREATE_FLAGS_DEFAULT;
+  /* a leftover temporary file can only be from a dead process */
+  cache_create_flags = IPMI_SDR_CACHE_CREATE_FLAGS_OVERWRITE;
 
   if (common_args->workaround_flags_sdr & IPMI_PARSE_WORKAROUND_FLAGS_SDR_ASSUME_MAX_SDR_RECORD_COUNT)
     cache_create_flags |= IPMI_SDR_CACHE_CREATE_FLAGS_ASSUME_MAX_SDR_RECORD_COUNT;
 
+  if (common_args->sdr_cache_pipeline)
+    cache_create_flags |= IPMI_SDR_CACHE_CREATE_FLAGS_PIPELINE;
+
   if (ipmi_sdr_cache_create (ctx,
                              ipmi_ctx,
-                             cachefilenamebuf,
+                             tmpfilenamebuf,
                              cache_create_flags,
                              common_args->quiet_cache ? NULL : _sdr_cache_create_callback,
                              common_args->quiet_cache ? NULL : (void *)&count) < 0)
@@ -580,13 +1162,26 @@ _sdr_cache_create (ipmi_sdr_ctx_t ctx,
       goto cleanup;
     }
 
+  /* ipmi_sdr_cache_create() removes the file itself on failure */
+  tmpfile_created = 1;
+
   if (!common_args->quiet_cache)
     fprintf (stderr, "\n");
 
+  if (rename (tmpfilenamebuf, cachefilenamebuf) < 0)
+    {
+      PSTDOUT_FPRINTF (pstate,
+                       stderr,
+                       "Cannot rename cache file: %s: %s\n",
+                       tmpfilenamebuf,
+                       strerror (errno));
+      goto cleanup;
+    }
+
   rv = 0;
  cleanup:
-  if (rv < 0)
-    ipmi_sdr_cache_delete (ctx, cachefilenamebuf);
+  if (rv < 0 && tmpfile_created)
+    ipmi_sdr_cache_delete (ctx, tmpfilenamebuf);
   return (rv);
 }
 
@@ -598,6 +1193,7 @@ sdr_cache_create_and_load (ipmi_sdr_ctx_t sdr_ctx,
                            const struct common_cmd_args *common_args)
 {
   char cachefilenamebuf[MAXPATHLEN+1];
+  ipmi_ctx_t validate_ipmi_ctx;
   int rv = -1;
 
   assert (sdr_ctx);
@@ -612,9 +1208,17 @@ sdr_cache_create_and_load (ipmi_sdr_ctx_t sdr_ctx,
     goto cleanup;
 
   /* If user specifies cache file, don't check timestamps, just load it */
+  validate_ipmi_ctx = common_args->sdr_cache_file ? NULL : ipmi_ctx;
+
+  /* Don't check timestamps if checked within the validate interval */
+  if (validate_ipmi_ctx
+      && common_args->sdr_cache_validate_interval
+      && _sdr_cache_validated_recently (cachefilenamebuf,
+                                        common_args->sdr_cache_validate_interval))
+    validate_ipmi_ctx = NULL;
 
   if (ipmi_sdr_cache_open (sdr_ctx,
-                           common_args->sdr_cache_file ? NULL : ipmi_ctx,
+                           validate_ipmi_ctx,
                            cachefilenamebuf) < 0)
     {
       if (ipmi_sdr_ctx_errnum (sdr_ctx) != IPMI_SDR_ERR_CACHE_READ_CACHE_DOES_NOT_EXIST
@@ -656,26 +1260,78 @@ sdr_cache_create_and_load (ipmi_sdr_ctx_t sdr_ctx,
            || ipmi_sdr_ctx_errnum (sdr_ctx) == IPMI_SDR_ERR_CACHE_OUT_OF_DATE)
           && common_args->sdr_cache_recreate))
     {
-      if (_sdr_cache_create (sdr_ctx,
-                             pstate,
-                             ipmi_ctx,
-                             hostname,
-                             common_args) < 0)
-        goto cleanup;
+      char fingerprintbuf[SDR_CACHE_FINGERPRINT_LEN + 1];
+      int shared = 0;
+      int adopted = 0;
+
+      /* Look for an identical host's cache before reading the SDR */
+      if (common_args->sdr_cache_shared
+          && !common_args->sdr_cache_file
+          && ipmi_ctx)
+        {
+          memset (fingerprintbuf, '\0', SDR_CACHE_FINGERPRINT_LEN + 1);
+          if (!_sdr_cache_shared_fingerprint (ipmi_ctx,
+                                              fingerprintbuf,
+                                              SDR_CACHE_FINGERPRINT_LEN))
+            shared = 1;
+        }
 
-      if (ipmi_sdr_cache_open (sdr_ctx,
-                               common_args->sdr_cache_file ? NULL : ipmi_ctx,
-                               cachefilenamebuf) < 0)
+      if (shared
+          && _sdr_cache_shared_adopt (pstate,
+                                      common_args,
+                                      fingerprintbuf,
+                                      cachefilenamebuf) > 0)
         {
-          PSTDOUT_FPRINTF (pstate,
-                           stderr,
-                           "ipmi_sdr_cache_open: %s: %s\n",
-                           cachefilenamebuf,
-                           ipmi_sdr_ctx_errormsg (sdr_ctx));
-          goto cleanup;
+          if (!ipmi_sdr_cache_open (sdr_ctx,
+                                    ipmi_ctx,
+                                    cachefilenamebuf))
+            {
+              if (!common_args->quiet_cache)
+                fprintf (stderr,
+                         "Using shared SDR repository information: %s\n",
+                         cachefilenamebuf);
+              adopted = 1;
+            }
+          else
+            /* ignore potential error, cache will be recreated */
+            unlink (cachefilenamebuf);
+        }
+
+      if (!adopted)
+        {
+          if (_sdr_cache_create (sdr_ctx,
+                                 pstate,
+                                 ipmi_ctx,
+                                 hostname,
+                                 common_args) < 0)
+            goto cleanup;
+
+          if (shared)
+            _sdr_cache_shared_store (pstate,
+                                     common_args,
+                                     fingerprintbuf,
+                                     cachefilenamebuf);
+
+          if (ipmi_sdr_cache_open (sdr_ctx,
+                                   common_args->sdr_cache_file ? NULL : ipmi_ctx,
+                                   cachefilenamebuf) < 0)
+            {
+              PSTDOUT_FPRINTF (pstate,
+                               stderr,
+                               "ipmi_sdr_cache_open: %s: %s\n",
+                               cachefilenamebuf,
+                               ipmi_sdr_ctx_errormsg (sdr_ctx));
+              goto cleanup;
+            }
         }
+
+      validate_ipmi_ctx = common_args->sdr_cache_file ? NULL : ipmi_ctx;
     }
 
+  if (validate_ipmi_ctx
+      && common_args->sdr_cache_validate_interval)
+    _sdr_cache_validated (cachefilenamebuf);
+
   if (common_args->debug)
     {
       /* Don't error out, if this fails we can still continue */
@@ -737,12 +1393,43 @@ sdr_cache_flush_cache (pstdout_state_t pstate,
       goto cleanup;
     }
 
+  if (!common_args->sdr_cache_file)
+    {
+      char validatedfilenamebuf[MAXPATHLEN+1];
+
+      memset (validatedfilenamebuf, '\0', MAXPATHLEN+1);
+      if (!_sdr_cache_get_validated_filename (cachefilenamebuf,
+                                              validatedfilenamebuf,
+                                              MAXPATHLEN))
+        /* ignore potential error, may not exist */
+        unlink (validatedfilenamebuf);
+    }
+
   rv = 0;
  cleanup:
   ipmi_sdr_ctx_destroy (ctx);
   return (rv);
 }
 
+int
+sdr_cache_get_session_cache_directory (pstdout_state_t pstate,
+                                       const struct common_cmd_args *common_args,
+                                       char *buf,
+                                       unsigned int buflen)
+{
+  assert (common_args);
+  assert (buf);
+  assert (buflen);
+
+  if (_sdr_cache_create_directory (pstate, common_args->sdr_cache_directory) < 0)
+    return (-1);
+
+  return (_sdr_cache_get_cache_directory (pstate,
+                                          common_args->sdr_cache_directory,
+                                          buf,
+                                          buflen));
+}
+
 int
 ipmi_sdr_cache_search_sensor_wrapper (ipmi_sdr_ctx_t sdr_ctx,
                                       uint8_t sensor_number,
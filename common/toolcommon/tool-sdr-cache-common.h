@@ -37,6 +37,14 @@ int sdr_cache_flush_cache (pstdout_state_t pstate,
                            const char *hostname,
                            const struct common_cmd_args *common_args);
 
+/* session negotiation cache records are kept with the SDR caches,
+ * creates the directory if necessary
+ */
+int sdr_cache_get_session_cache_directory (pstdout_state_t pstate,
+                                           const struct common_cmd_args *common_args,
+                                           char *buf,
+                                           unsigned int buflen);
+
 /* wrapper for ipmi_sdr_cache_search_sensor, handles some additional special workarounds */
 int ipmi_sdr_cache_search_sensor_wrapper (ipmi_sdr_ctx_t sdr_ctx,
                                           uint8_t sensor_number,
@@ -68,6 +68,8 @@ static struct argp_option cmdline_options[] =
     ARGP_COMMON_OPTIONS_WORKAROUND_FLAGS,
     ARGP_COMMON_HOSTRANGED_OPTIONS,
     ARGP_COMMON_OPTIONS_DEBUG,
+    ARGP_COMMON_OPTIONS_STATS,
+    ARGP_COMMON_OPTIONS_PACKET_TRACE,
     { "get-chassis-capabilities", GET_CHASSIS_CAPABILITIES_KEY, NULL, 0,
       "Get chassis capabilities.", 40},
     { "get-chassis-status", GET_CHASSIS_STATUS_KEY, NULL, 0,
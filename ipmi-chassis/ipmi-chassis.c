@@ -946,6 +946,13 @@ _ipmi_chassis (pstdout_state_t pstate,
 
   exit_code = EXIT_SUCCESS;
  cleanup:
+  ipmi_print_stats (state_data.pstate,
+                    state_data.ipmi_ctx,
+                    &(prog_data->args->common_args));
+  ipmi_write_pkt_trace (state_data.pstate,
+                        hostname,
+                        state_data.ipmi_ctx,
+                        &(prog_data->args->common_args));
   ipmi_ctx_close (state_data.ipmi_ctx);
   ipmi_ctx_destroy (state_data.ipmi_ctx);
   return (exit_code);
@@ -509,6 +509,13 @@ _ipmi_config (pstdout_state_t pstate,
  cleanup:
   if (state_data.sdr_ctx)
     ipmi_sdr_ctx_destroy (state_data.sdr_ctx);
+  ipmi_print_stats (state_data.pstate,
+                    state_data.ipmi_ctx,
+                    &(prog_data->args->common_args));
+  ipmi_write_pkt_trace (state_data.pstate,
+                        hostname,
+                        state_data.ipmi_ctx,
+                        &(prog_data->args->common_args));
   ipmi_ctx_close (state_data.ipmi_ctx);
   ipmi_ctx_destroy (state_data.ipmi_ctx);
   ipmi_config_sections_destroy (state_data.sections);
@@ -75,6 +75,8 @@ static struct argp_option cmdline_options[] =
     ARGP_COMMON_TIME_OPTIONS,
     ARGP_COMMON_HOSTRANGED_OPTIONS,
     ARGP_COMMON_OPTIONS_DEBUG,
+    ARGP_COMMON_OPTIONS_STATS,
+    ARGP_COMMON_OPTIONS_PACKET_TRACE,
     { "get-dcmi-capability-info", GET_DCMI_CAPABILITY_INFO, NULL, 0,
       "Get DCMI capability information.", 40},
     { "get-asset-tag", GET_ASSET_TAG, NULL, 0,
@@ -87,6 +87,8 @@ static struct argp_option cmdline_options[] =
     ARGP_COMMON_TIME_OPTIONS,
     ARGP_COMMON_HOSTRANGED_OPTIONS,
     ARGP_COMMON_OPTIONS_DEBUG,
+    ARGP_COMMON_OPTIONS_STATS,
+    ARGP_COMMON_OPTIONS_PACKET_TRACE,
     { "device-id", DEVICE_ID_KEY, "DEVICE_ID", 0,
       "Specify a specific FRU device ID.", 40},
     { "verbose", VERBOSE_KEY, 0, 0,
@@ -1255,6 +1255,13 @@ _ipmi_fru (pstdout_state_t pstate,
  cleanup:
   ipmi_fru_ctx_destroy (state_data.fru_ctx);
   ipmi_sdr_ctx_destroy (state_data.sdr_ctx);
+  ipmi_print_stats (state_data.pstate,
+                    state_data.ipmi_ctx,
+                    &(prog_data->args->common_args));
+  ipmi_write_pkt_trace (state_data.pstate,
+                        hostname,
+                        state_data.ipmi_ctx,
+                        &(prog_data->args->common_args));
   ipmi_ctx_close (state_data.ipmi_ctx);
   ipmi_ctx_destroy (state_data.ipmi_ctx);
   return (exit_code);
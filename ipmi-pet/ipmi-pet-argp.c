@@ -69,6 +69,8 @@ static struct argp_option cmdline_options[] =
     ARGP_COMMON_SDR_CACHE_OPTIONS_FILE_DIRECTORY,
     ARGP_COMMON_SDR_CACHE_OPTIONS_LEGACY,
     ARGP_COMMON_OPTIONS_DEBUG,
+    ARGP_COMMON_OPTIONS_STATS,
+    ARGP_COMMON_OPTIONS_PACKET_TRACE,
     { "verbose",    VERBOSE_KEY,    0, 0,
       "Increase verbosity in output.", 40},
     { "pet-acknowledge", PET_ACKNOWLEDGE_KEY, 0, 0,
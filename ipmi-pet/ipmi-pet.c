@@ -2223,6 +2223,13 @@ _ipmi_pet (ipmi_pet_prog_data_t *prog_data)
   ipmi_interpret_ctx_destroy (state_data.interpret_ctx);
   ipmi_sel_ctx_destroy (state_data.sel_ctx);
   ipmi_sdr_ctx_destroy (state_data.sdr_ctx);
+  ipmi_print_stats (NULL,
+                    state_data.ipmi_ctx,
+                    &(prog_data->args->common_args));
+  ipmi_write_pkt_trace (NULL,
+                        prog_data->args->common_args.hostname,
+                        state_data.ipmi_ctx,
+                        &(prog_data->args->common_args));
   ipmi_ctx_close (state_data.ipmi_ctx);
   ipmi_ctx_destroy (state_data.ipmi_ctx);
   return (exit_code);
@@ -67,6 +67,8 @@ static struct argp_option cmdline_options[] =
     ARGP_COMMON_OPTIONS_WORKAROUND_FLAGS,
     ARGP_COMMON_HOSTRANGED_OPTIONS,
     ARGP_COMMON_OPTIONS_DEBUG,
+    ARGP_COMMON_OPTIONS_STATS,
+    ARGP_COMMON_OPTIONS_PACKET_TRACE,
     { "file", CMD_FILE_KEY, "CMD-FILE", 0,
       "Specify a file to read command requests from.", 40},
     { "no-session", NO_SESSION_KEY, NULL, 0,
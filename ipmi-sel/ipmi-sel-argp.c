@@ -84,6 +84,8 @@ static struct argp_option cmdline_options[] =
     ARGP_COMMON_TIME_OPTIONS,
     ARGP_COMMON_HOSTRANGED_OPTIONS,
     ARGP_COMMON_OPTIONS_DEBUG,
+    ARGP_COMMON_OPTIONS_STATS,
+    ARGP_COMMON_OPTIONS_PACKET_TRACE,
     { "verbose",    VERBOSE_KEY,    0, 0,
       "Increase verbosity in output.", 40},
     { "info",       INFO_KEY,       0, 0,
@@ -2142,6 +2142,13 @@ _ipmi_sel (pstdout_state_t pstate,
  cleanup:
   ipmi_sdr_ctx_destroy (state_data.sdr_ctx);
   ipmi_sel_ctx_destroy (state_data.sel_ctx);
+  ipmi_print_stats (state_data.pstate,
+                    state_data.ipmi_ctx,
+                    &(prog_data->args->common_args));
+  ipmi_write_pkt_trace (state_data.pstate,
+                        hostname,
+                        state_data.ipmi_ctx,
+                        &(prog_data->args->common_args));
   ipmi_ctx_close (state_data.ipmi_ctx);
   ipmi_ctx_destroy (state_data.ipmi_ctx);
   return (exit_code);
@@ -0,0 +1,271 @@
+/*
+ * Copyright (C) 2005-2015 FreeIPMI Core Team
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif /* HAVE_CONFIG_H */
+
+#include <stdio.h>
+#include <stdlib.h>
+#if STDC_HEADERS
+#include <string.h>
+#endif /* STDC_HEADERS */
+#if HAVE_ARGP_H
+#include <argp.h>
+#else /* !HAVE_ARGP_H */
+#include "freeipmi-argp.h"
+#endif /* !HAVE_ARGP_H */
+#include <limits.h>
+#include <assert.h>
+#include <errno.h>
+
+#include "ipmi-sim.h"
+#include "ipmi-sim-argp.h"
+
+#include "freeipmi-portability.h"
+#include "error.h"
+
+const char *argp_program_version =
+  "ipmi-sim - " PACKAGE_VERSION "\n"
+  "Copyright (C) 2005-2015 FreeIPMI Core Team\n"
+  "This program is free software; you may redistribute it under the terms of\n"
+  "the GNU General Public License.  This program has absolutely no warranty.";
+
+const char *argp_program_bug_address =
+  "<" PACKAGE_BUGREPORT ">";
+
+static char cmdline_doc[] =
+  "ipmi-sim - simulate IPMI LAN and LAN+ BMCs for load and latency testing";
+
+static char cmdline_args_doc[] = "";
+
+static struct argp_option cmdline_options[] =
+  {
+    { "address", IPMI_SIM_ADDRESS_KEY, "IPADDRESS", 0,
+      "Specify the address to listen on, defaults to 127.0.0.1.", 1},
+    { "port", IPMI_SIM_PORT_KEY, "PORT", 0,
+      "Specify the port of the first BMC, defaults to 623.", 2},
+    { "count", IPMI_SIM_COUNT_KEY, "COUNT", 0,
+      "Specify the number of BMCs to simulate, on consecutive ports.", 3},
+    { "increment-address", IPMI_SIM_INCREMENT_ADDRESS_KEY, 0, 0,
+      "Simulate BMCs on consecutive addresses instead of consecutive ports.", 4},
+    { "username", IPMI_SIM_USERNAME_KEY, "USERNAME", 0,
+      "Specify the username accepted by every BMC.", 5},
+    { "password", IPMI_SIM_PASSWORD_KEY, "PASSWORD", 0,
+      "Specify the password accepted by every BMC.", 6},
+    { "sessions", IPMI_SIM_SESSIONS_KEY, "COUNT", 0,
+      "Specify the number of sessions each BMC supports.", 7},
+    { "session-timeout", IPMI_SIM_SESSION_TIMEOUT_KEY, "SECONDS", 0,
+      "Specify the idle timeout of sessions.", 8},
+    { "sdr-cache-file", IPMI_SIM_SDR_CACHE_FILE_KEY, "FILE", 0,
+      "Serve the SDR of an SDR cache file instead of generated sensors.", 9},
+    { "sensors", IPMI_SIM_SENSORS_KEY, "COUNT", 0,
+      "Specify the number of generated temperature sensors.", 10},
+    { "sensor-readings-file", IPMI_SIM_SENSOR_READINGS_FILE_KEY, "FILE", 0,
+      "Specify the sensor readings to serve.", 11},
+    { "sel-file", IPMI_SIM_SEL_FILE_KEY, "FILE", 0,
+      "Serve the 16 byte SEL records of a file instead of generated events.", 12},
+    { "sel-entries", IPMI_SIM_SEL_ENTRIES_KEY, "COUNT", 0,
+      "Specify the number of generated SEL events.", 13},
+    { "fru-file", IPMI_SIM_FRU_FILE_KEY, "FILE", 0,
+      "Serve the FRU inventory area of a file instead of a generated one.", 14},
+    { "sdr-read-max", IPMI_SIM_SDR_READ_MAX_KEY, "BYTES", 0,
+      "Fail partial Get SDR reads of more than the given bytes.", 14},
+    { "delay", IPMI_SIM_DELAY_KEY, "MILLISECONDS", 0,
+      "Delay every response.", 15},
+    { "jitter", IPMI_SIM_JITTER_KEY, "MILLISECONDS", 0,
+      "Add a random delay of up to the given milliseconds to every response.", 16},
+    { "loss", IPMI_SIM_LOSS_KEY, "PERCENT", 0,
+      "Drop the given percentage of requests and responses.", 17},
+    { "duplicate", IPMI_SIM_DUPLICATE_KEY, "PERCENT", 0,
+      "Send the given percentage of responses twice.", 18},
+    { "seed", IPMI_SIM_SEED_KEY, "SEED", 0,
+      "Specify the random seed of delay, loss and duplication.", 19},
+    { "verbose", IPMI_SIM_VERBOSE_KEY, 0, 0,
+      "Output every request and response.", 20},
+    { "inband-socket", IPMI_SIM_INBAND_SOCKET_KEY, "PATH", 0,
+      "Serve the in-band requests of the mock driver on a Unix socket.", 21},
+    { NULL, 0, NULL, 0, NULL, 0}
+  };
+
+static error_t cmdline_parse (int key, char *arg, struct argp_state *state);
+
+static struct argp cmdline_argp = { cmdline_options,
+                                    cmdline_parse,
+                                    cmdline_args_doc,
+                                    cmdline_doc };
+
+static unsigned int
+_parse_uint (const char *arg, const char *option, unsigned int min, unsigned int max)
+{
+  unsigned long val;
+  char *endptr;
+
+  assert (arg);
+  assert (option);
+
+  errno = 0;
+  val = strtoul (arg, &endptr, 0);
+  if (errno
+      || endptr[0] != '\0'
+      || val < min
+      || val > max)
+    err_exit ("invalid %s: %s", option, arg);
+
+  return (val);
+}
+
+static error_t
+cmdline_parse (int key, char *arg, struct argp_state *state)
+{
+  struct ipmi_sim_arguments *cmd_args;
+
+  assert (state);
+
+  cmd_args = state->input;
+
+  switch (key)
+    {
+    case IPMI_SIM_ADDRESS_KEY:
+      if (!(cmd_args->address = strdup (arg)))
+        err_exit ("strdup: %s", strerror (errno));
+      break;
+    case IPMI_SIM_PORT_KEY:
+      cmd_args->port = _parse_uint (arg, "port", 1, 65535);
+      break;
+    case IPMI_SIM_COUNT_KEY:
+      cmd_args->count = _parse_uint (arg, "count", 1, 65535);
+      break;
+    case IPMI_SIM_INCREMENT_ADDRESS_KEY:
+      cmd_args->increment_address = 1;
+      break;
+    case IPMI_SIM_USERNAME_KEY:
+      if (strlen (arg) > IPMI_MAX_USER_NAME_LENGTH)
+        err_exit ("username too long");
+      if (!(cmd_args->username = strdup (arg)))
+        err_exit ("strdup: %s", strerror (errno));
+      break;
+    case IPMI_SIM_PASSWORD_KEY:
+      if (strlen (arg) > IPMI_2_0_MAX_PASSWORD_LENGTH)
+        err_exit ("password too long");
+      if (!(cmd_args->password = strdup (arg)))
+        err_exit ("strdup: %s", strerror (errno));
+      break;
+    case IPMI_SIM_SESSIONS_KEY:
+      cmd_args->sessions = _parse_uint (arg, "sessions", 1, 255);
+      break;
+    case IPMI_SIM_SESSION_TIMEOUT_KEY:
+      cmd_args->session_timeout = _parse_uint (arg, "session timeout", 1, 86400);
+      break;
+    case IPMI_SIM_SDR_CACHE_FILE_KEY:
+      if (!(cmd_args->sdr_cache_file = strdup (arg)))
+        err_exit ("strdup: %s", strerror (errno));
+      break;
+    case IPMI_SIM_SENSORS_KEY:
+      cmd_args->sensors = _parse_uint (arg, "sensors", 0, IPMI_SIM_SENSORS_MAX);
+      break;
+    case IPMI_SIM_SENSOR_READINGS_FILE_KEY:
+      if (!(cmd_args->sensor_readings_file = strdup (arg)))
+        err_exit ("strdup: %s", strerror (errno));
+      break;
+    case IPMI_SIM_SEL_FILE_KEY:
+      if (!(cmd_args->sel_file = strdup (arg)))
+        err_exit ("strdup: %s", strerror (errno));
+      break;
+    case IPMI_SIM_SEL_ENTRIES_KEY:
+      cmd_args->sel_entries = _parse_uint (arg, "sel entries", 0, IPMI_SIM_SEL_ENTRIES_MAX);
+      break;
+    case IPMI_SIM_FRU_FILE_KEY:
+      if (!(cmd_args->fru_file = strdup (arg)))
+        err_exit ("strdup: %s", strerror (errno));
+      break;
+    case IPMI_SIM_SDR_READ_MAX_KEY:
+      cmd_args->sdr_read_max = _parse_uint (arg, "sdr read max", 1, 254);
+      break;
+    case IPMI_SIM_DELAY_KEY:
+      cmd_args->delay = _parse_uint (arg, "delay", 0, 60000);
+      break;
+    case IPMI_SIM_JITTER_KEY:
+      cmd_args->jitter = _parse_uint (arg, "jitter", 0, 60000);
+      break;
+    case IPMI_SIM_LOSS_KEY:
+      cmd_args->loss = _parse_uint (arg, "loss", 0, 100);
+      break;
+    case IPMI_SIM_DUPLICATE_KEY:
+      cmd_args->duplicate = _parse_uint (arg, "duplicate", 0, 100);
+      break;
+    case IPMI_SIM_SEED_KEY:
+      cmd_args->seed = _parse_uint (arg, "seed", 0, UINT_MAX);
+      cmd_args->seed_set = 1;
+      break;
+    case IPMI_SIM_VERBOSE_KEY:
+      cmd_args->verbose++;
+      break;
+    case IPMI_SIM_INBAND_SOCKET_KEY:
+      if (!(cmd_args->inband_socket = strdup (arg)))
+        err_exit ("strdup: %s", strerror (errno));
+      break;
+    case ARGP_KEY_ARG:
+      /* Too many arguments. */
+      argp_usage (state);
+      break;
+    case ARGP_KEY_END:
+      break;
+    default:
+      return (ARGP_ERR_UNKNOWN);
+    }
+
+  return (0);
+}
+
+void
+ipmi_sim_argp_parse (int argc, char **argv, struct ipmi_sim_arguments *cmd_args)
+{
+  assert (argc >= 0);
+  assert (argv);
+  assert (cmd_args);
+
+  memset (cmd_args, '\0', sizeof (struct ipmi_sim_arguments));
+  cmd_args->address = IPMI_SIM_ADDRESS_DEFAULT;
+  cmd_args->port = IPMI_SIM_PORT_DEFAULT;
+  cmd_args->count = IPMI_SIM_COUNT_DEFAULT;
+  cmd_args->username = IPMI_SIM_USERNAME_DEFAULT;
+  cmd_args->password = IPMI_SIM_PASSWORD_DEFAULT;
+  cmd_args->sessions = IPMI_SIM_SESSIONS_DEFAULT;
+  cmd_args->session_timeout = IPMI_SIM_SESSION_TIMEOUT_DEFAULT;
+  cmd_args->sensors = IPMI_SIM_SENSORS_DEFAULT;
+  cmd_args->sel_entries = IPMI_SIM_SEL_ENTRIES_DEFAULT;
+
+  argp_parse (&cmdline_argp,
+              argc,
+              argv,
+              ARGP_IN_ORDER,
+              NULL,
+              cmd_args);
+
+  if (cmd_args->increment_address)
+    {
+      if (cmd_args->count > 256)
+        err_exit ("count too large for incrementing addresses");
+    }
+  else
+    {
+      if (cmd_args->port + cmd_args->count - 1 > 65535)
+        err_exit ("count too large for port %u", cmd_args->port);
+    }
+}
@@ -0,0 +1,1276 @@
+/*
+ * Copyright (C) 2005-2015 FreeIPMI Core Team
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif /* HAVE_CONFIG_H */
+
+#include <stdio.h>
+#include <stdlib.h>
+#if STDC_HEADERS
+#include <string.h>
+#endif /* STDC_HEADERS */
+#include <assert.h>
+#include <errno.h>
+
+#include <freeipmi/freeipmi.h>
+
+#include "ipmi-sim.h"
+#include "ipmi-sim-cmds.h"
+#include "ipmi-sim-data.h"
+
+#include "freeipmi-portability.h"
+#include "error.h"
+
+#define IPMI_SIM_LAN_CHANNEL_NUMBER      0x01
+
+/* SOL payload header plus 128 characters */
+#define IPMI_SIM_SOL_PAYLOAD_SIZE        (4 + 128)
+
+#define IPMI_SIM_SDR_VERSION_MAJOR       0x1
+#define IPMI_SIM_SDR_VERSION_MINOR       0x5
+#define IPMI_SIM_SEL_VERSION_MAJOR       0x1
+#define IPMI_SIM_SEL_VERSION_MINOR       0x5
+
+#define IPMI_SIM_CHASSIS_IDENTIFY_STATE_OFF        0x0
+#define IPMI_SIM_CHASSIS_IDENTIFY_STATE_TEMPORARY  0x1
+#define IPMI_SIM_CHASSIS_IDENTIFY_STATE_INDEFINITE 0x2
+
+/* record id returned as the next record id of the last record */
+#define IPMI_SIM_RECORD_ID_LAST          0xFFFF
+
+/* returns completion code */
+typedef uint8_t (*ipmi_sim_cmd_handler_t) (ipmi_sim_state_data_t *state_data,
+                                           struct ipmi_sim_bmc *bmc,
+                                           struct ipmi_sim_session *session,
+                                           fiid_obj_t obj_cmd_rq,
+                                           fiid_obj_t obj_cmd_rs);
+
+struct ipmi_sim_cmd_def
+{
+  uint8_t net_fn;
+  uint8_t cmd;
+  fiid_field_t *tmpl_cmd_rq;
+  fiid_field_t *tmpl_cmd_rs;
+  uint8_t privilege_level;
+  ipmi_sim_cmd_handler_t handler;
+};
+
+static int
+_get (fiid_obj_t obj, const char *field, uint64_t *val)
+{
+  assert (obj);
+  assert (field);
+  assert (val);
+
+  if (FIID_OBJ_GET (obj, field, val) < 0)
+    {
+      err_debug ("fiid_obj_get: '%s': %s", field, fiid_obj_errormsg (obj));
+      return (-1);
+    }
+  return (0);
+}
+
+static int
+_set (fiid_obj_t obj, const char *field, uint64_t val)
+{
+  assert (obj);
+  assert (field);
+
+  if (fiid_obj_set (obj, field, val) < 0)
+    {
+      err_debug ("fiid_obj_set: '%s': %s", field, fiid_obj_errormsg (obj));
+      return (-1);
+    }
+  return (0);
+}
+
+static int
+_set_data (fiid_obj_t obj, const char *field, const void *data, unsigned int data_len)
+{
+  assert (obj);
+  assert (field);
+  assert (data || !data_len);
+
+  if (fiid_obj_set_data (obj, field, data, data_len) < 0)
+    {
+      err_debug ("fiid_obj_set_data: '%s': %s", field, fiid_obj_errormsg (obj));
+      return (-1);
+    }
+  return (0);
+}
+
+static uint8_t
+_get_device_id (ipmi_sim_state_data_t *state_data,
+                struct ipmi_sim_bmc *bmc,
+                struct ipmi_sim_session *session,
+                fiid_obj_t obj_cmd_rq,
+                fiid_obj_t obj_cmd_rs)
+{
+  assert (state_data);
+  assert (bmc);
+  assert (obj_cmd_rq);
+  assert (obj_cmd_rs);
+
+  if (_set (obj_cmd_rs, "device_id", IPMI_SLAVE_ADDRESS_BMC) < 0
+      || _set (obj_cmd_rs, "device_revision.revision", 1) < 0
+      || _set (obj_cmd_rs, "device_revision.sdr_support", 1) < 0
+      || _set (obj_cmd_rs, "firmware_revision1.major_revision", 1) < 0
+      || _set (obj_cmd_rs, "firmware_revision2.minor_revision", 0) < 0
+      || _set (obj_cmd_rs, "ipmi_version_major", 2) < 0
+      || _set (obj_cmd_rs, "ipmi_version_minor", 0) < 0
+      || _set (obj_cmd_rs, "additional_device_support.sensor_device", 1) < 0
+      || _set (obj_cmd_rs, "additional_device_support.sdr_repository_device", 1) < 0
+      || _set (obj_cmd_rs, "additional_device_support.sel_device", 1) < 0
+      || _set (obj_cmd_rs, "additional_device_support.fru_inventory_device", 1) < 0
+      || _set (obj_cmd_rs, "additional_device_support.chassis_device", 1) < 0)
+    return (IPMI_COMP_CODE_UNSPECIFIED_ERROR);
+
+  return (IPMI_COMP_CODE_COMMAND_SUCCESS);
+}
+
+static uint8_t
+_get_guid (ipmi_sim_state_data_t *state_data,
+           struct ipmi_sim_bmc *bmc,
+           struct ipmi_sim_session *session,
+           fiid_obj_t obj_cmd_rq,
+           fiid_obj_t obj_cmd_rs)
+{
+  assert (state_data);
+  assert (bmc);
+  assert (obj_cmd_rq);
+  assert (obj_cmd_rs);
+
+  /* device and system GUID are the same on a simulated BMC */
+  if (_set_data (obj_cmd_rs, "guid", bmc->guid, IPMI_SYSTEM_GUID_LENGTH) < 0)
+    return (IPMI_COMP_CODE_UNSPECIFIED_ERROR);
+
+  return (IPMI_COMP_CODE_COMMAND_SUCCESS);
+}
+
+static uint8_t
+_get_channel_authentication_capabilities (ipmi_sim_state_data_t *state_data,
+                                          struct ipmi_sim_bmc *bmc,
+                                          struct ipmi_sim_session *session,
+                                          fiid_obj_t obj_cmd_rq,
+                                          fiid_obj_t obj_cmd_rs)
+{
+  uint64_t channel_number, get_ipmi_v20_extended_data;
+
+  assert (state_data);
+  assert (bmc);
+  assert (obj_cmd_rq);
+  assert (obj_cmd_rs);
+
+  if (_get (obj_cmd_rq, "channel_number", &channel_number) < 0
+      || _get (obj_cmd_rq, "get_ipmi_v2.0_extended_data", &get_ipmi_v20_extended_data) < 0)
+    return (IPMI_COMP_CODE_UNSPECIFIED_ERROR);
+
+  if (channel_number != IPMI_CHANNEL_NUMBER_CURRENT_CHANNEL
+      && channel_number != IPMI_SIM_LAN_CHANNEL_NUMBER)
+    return (IPMI_COMP_CODE_INVALID_DATA_FIELD_IN_REQUEST);
+
+  /* all IPMI 1.5 authentication types, user level and per message
+   * authentication enabled (bits are 0 when enabled)
+   */
+  if (_set (obj_cmd_rs, "channel_number", IPMI_SIM_LAN_CHANNEL_NUMBER) < 0
+      || _set (obj_cmd_rs, "authentication_type.none", 1) < 0
+      || _set (obj_cmd_rs, "authentication_type.md2", 1) < 0
+      || _set (obj_cmd_rs, "authentication_type.md5", 1) < 0
+      || _set (obj_cmd_rs, "authentication_type.straight_password_key", 1) < 0
+      || _set (obj_cmd_rs, "authentication_status.non_null_username", 1) < 0)
+    return (IPMI_COMP_CODE_UNSPECIFIED_ERROR);
+
+  if (get_ipmi_v20_extended_data)
+    {
+      if (_set (obj_cmd_rs, "authentication_type.ipmi_v2.0_extended_capabilities_available", 1) < 0
+          || _set (obj_cmd_rs, "channel_supports_ipmi_v1.5_connections", 1) < 0
+#ifdef WITH_ENCRYPTION
+          || _set (obj_cmd_rs, "channel_supports_ipmi_v2.0_connections", 1) < 0
+#endif /* WITH_ENCRYPTION */
+          )
+        return (IPMI_COMP_CODE_UNSPECIFIED_ERROR);
+    }
+
+  return (IPMI_COMP_CODE_COMMAND_SUCCESS);
+}
+
+static uint8_t
+_set_session_privilege_level (ipmi_sim_state_data_t *state_data,
+                              struct ipmi_sim_bmc *bmc,
+                              struct ipmi_sim_session *session,
+                              fiid_obj_t obj_cmd_rq,
+                              fiid_obj_t obj_cmd_rs)
+{
+  uint64_t privilege_level;
+
+  assert (state_data);
+  assert (bmc);
+  assert (session);
+  assert (obj_cmd_rq);
+  assert (obj_cmd_rs);
+
+  if (_get (obj_cmd_rq, "privilege_level", &privilege_level) < 0)
+    return (IPMI_COMP_CODE_UNSPECIFIED_ERROR);
+
+  /* 0h, return present level */
+  if (privilege_level != IPMI_PRIVILEGE_LEVEL_RESERVED)
+    {
+      if (privilege_level < IPMI_PRIVILEGE_LEVEL_USER
+          || privilege_level > IPMI_PRIVILEGE_LEVEL_ADMIN)
+        return (IPMI_COMP_CODE_SET_SESSION_PRIVILEGE_LEVEL_REQUESTED_LEVEL_NOT_AVAILABLE_FOR_USER);
+
+      if (privilege_level > session->maximum_privilege_level)
+        return (IPMI_COMP_CODE_SET_SESSION_PRIVILEGE_LEVEL_REQUESTED_LEVEL_EXCEEDS_USER_PRIVILEGE_LIMIT);
+
+      session->privilege_level = privilege_level;
+    }
+
+  if (_set (obj_cmd_rs, "privilege_level", session->privilege_level) < 0)
+    return (IPMI_COMP_CODE_UNSPECIFIED_ERROR);
+
+  return (IPMI_COMP_CODE_COMMAND_SUCCESS);
+}
+
+static uint8_t
+_close_session (ipmi_sim_state_data_t *state_data,
+                struct ipmi_sim_bmc *bmc,
+                struct ipmi_sim_session *session,
+                fiid_obj_t obj_cmd_rq,
+                fiid_obj_t obj_cmd_rs)
+{
+  struct ipmi_sim_session *s;
+  uint64_t session_id;
+
+  assert (state_data);
+  assert (bmc);
+  assert (session);
+  assert (obj_cmd_rq);
+  assert (obj_cmd_rs);
+
+  if (_get (obj_cmd_rq, "session_id", &session_id) < 0)
+    return (IPMI_COMP_CODE_UNSPECIFIED_ERROR);
+
+  if (!(s = ipmi_sim_session_find (state_data, bmc, session_id)))
+    return (IPMI_COMP_CODE_CLOSE_SESSION_INVALID_SESSION_ID_IN_REQUEST);
+
+  /* closing another session requires administrator privilege */
+  if (s != session
+      && session->privilege_level < IPMI_PRIVILEGE_LEVEL_ADMIN)
+    return (IPMI_COMP_CODE_INSUFFICIENT_PRIVILEGE_LEVEL);
+
+  ipmi_sim_session_close (state_data, bmc, s);
+  return (IPMI_COMP_CODE_COMMAND_SUCCESS);
+}
+
+static uint8_t
+_get_channel_payload_support (ipmi_sim_state_data_t *state_data,
+                              struct ipmi_sim_bmc *bmc,
+                              struct ipmi_sim_session *session,
+                              fiid_obj_t obj_cmd_rq,
+                              fiid_obj_t obj_cmd_rs)
+{
+  assert (state_data);
+  assert (bmc);
+  assert (obj_cmd_rq);
+  assert (obj_cmd_rs);
+
+  if (_set (obj_cmd_rs, "standard_payload_type_0_supported", 1) < 0
+      || _set (obj_cmd_rs, "standard_payload_type_1_supported", 1) < 0
+      || _set (obj_cmd_rs, "session_setup_payload_0_supported", 1) < 0
+      || _set (obj_cmd_rs, "session_setup_payload_1_supported", 1) < 0
+      || _set (obj_cmd_rs, "session_setup_payload_2_supported", 1) < 0
+      || _set (obj_cmd_rs, "session_setup_payload_3_supported", 1) < 0
+      || _set (obj_cmd_rs, "session_setup_payload_4_supported", 1) < 0
+      || _set (obj_cmd_rs, "session_setup_payload_5_supported", 1) < 0)
+    return (IPMI_COMP_CODE_UNSPECIFIED_ERROR);
+
+  return (IPMI_COMP_CODE_COMMAND_SUCCESS);
+}
+
+static uint8_t
+_get_channel_payload_version (ipmi_sim_state_data_t *state_data,
+                              struct ipmi_sim_bmc *bmc,
+                              struct ipmi_sim_session *session,
+                              fiid_obj_t obj_cmd_rq,
+                              fiid_obj_t obj_cmd_rs)
+{
+  uint64_t payload_type;
+
+  assert (state_data);
+  assert (bmc);
+  assert (obj_cmd_rq);
+  assert (obj_cmd_rs);
+
+  if (_get (obj_cmd_rq, "payload_type", &payload_type) < 0)
+    return (IPMI_COMP_CODE_UNSPECIFIED_ERROR);
+
+  if (payload_type != IPMI_PAYLOAD_TYPE_IPMI
+      && payload_type != IPMI_PAYLOAD_TYPE_SOL)
+    return (IPMI_COMP_CODE_GET_CHANNEL_PAYLOAD_VERSION_PAYLOAD_TYPE_NOT_AVAILABLE_ON_GIVEN_CHANNEL);
+
+  /* version 1.0 */
+  if (_set (obj_cmd_rs, "major_format_version", 1) < 0
+      || _set (obj_cmd_rs, "minor_format_version", 0) < 0)
+    return (IPMI_COMP_CODE_UNSPECIFIED_ERROR);
+
+  return (IPMI_COMP_CODE_COMMAND_SUCCESS);
+}
+
+static uint8_t
+_get_payload_activation_status (ipmi_sim_state_data_t *state_data,
+                                struct ipmi_sim_bmc *bmc,
+                                struct ipmi_sim_session *session,
+                                fiid_obj_t obj_cmd_rq,
+                                fiid_obj_t obj_cmd_rs)
+{
+  uint64_t payload_type;
+
+  assert (state_data);
+  assert (bmc);
+  assert (obj_cmd_rq);
+  assert (obj_cmd_rs);
+
+  if (_get (obj_cmd_rq, "payload_type", &payload_type) < 0)
+    return (IPMI_COMP_CODE_UNSPECIFIED_ERROR);
+
+  if (payload_type != IPMI_PAYLOAD_TYPE_SOL)
+    return (IPMI_COMP_CODE_INVALID_DATA_FIELD_IN_REQUEST);
+
+  /* a single SOL instance */
+  if (_set (obj_cmd_rs, "instance_capacity", 1) < 0
+      || _set (obj_cmd_rs, "instance_1", bmc->sol_session ? 1 : 0) < 0)
+    return (IPMI_COMP_CODE_UNSPECIFIED_ERROR);
+
+  return (IPMI_COMP_CODE_COMMAND_SUCCESS);
+}
+
+static uint8_t
+_activate_payload (ipmi_sim_state_data_t *state_data,
+                   struct ipmi_sim_bmc *bmc,
+                   struct ipmi_sim_session *session,
+                   fiid_obj_t obj_cmd_rq,
+                   fiid_obj_t obj_cmd_rs)
+{
+  uint64_t payload_type, payload_instance;
+
+  assert (state_data);
+  assert (bmc);
+  assert (session);
+  assert (obj_cmd_rq);
+  assert (obj_cmd_rs);
+
+  if (_get (obj_cmd_rq, "payload_type", &payload_type) < 0
+      || _get (obj_cmd_rq, "payload_instance", &payload_instance) < 0)
+    return (IPMI_COMP_CODE_UNSPECIFIED_ERROR);
+
+  if (payload_type != IPMI_PAYLOAD_TYPE_SOL
+      || payload_instance != 1)
+    return (IPMI_COMP_CODE_INVALID_DATA_FIELD_IN_REQUEST);
+
+  if (session->ipmi_version != IPMI_SIM_IPMI_VERSION_2_0)
+    return (IPMI_COMP_CODE_ACTIVATE_PAYLOAD_PAYLOAD_TYPE_IS_DISABLED);
+
+  if (bmc->sol_session)
+    return (IPMI_COMP_CODE_ACTIVATE_PAYLOAD_PAYLOAD_ALREADY_ACTIVE_ON_ANOTHER_SESSION);
+
+  if (_set (obj_cmd_rs, "inbound_payload_size", IPMI_SIM_SOL_PAYLOAD_SIZE) < 0
+      || _set (obj_cmd_rs, "outbound_payload_size", IPMI_SIM_SOL_PAYLOAD_SIZE) < 0
+      || _set (obj_cmd_rs, "payload_udp_port_number", ntohs (bmc->addr.sin_port)) < 0
+      || _set (obj_cmd_rs, "payload_vlan_number", 0xFFFF) < 0)
+    return (IPMI_COMP_CODE_UNSPECIFIED_ERROR);
+
+  bmc->sol_session = session;
+  session->sol_activated = 1;
+  session->sol_packet_sequence_number = 0;
+  session->sol_last_packet_sequence_number = 0;
+  return (IPMI_COMP_CODE_COMMAND_SUCCESS);
+}
+
+static uint8_t
+_deactivate_payload (ipmi_sim_state_data_t *state_data,
+                     struct ipmi_sim_bmc *bmc,
+                     struct ipmi_sim_session *session,
+                     fiid_obj_t obj_cmd_rq,
+                     fiid_obj_t obj_cmd_rs)
+{
+  uint64_t payload_type, payload_instance;
+
+  assert (state_data);
+  assert (bmc);
+  assert (session);
+  assert (obj_cmd_rq);
+  assert (obj_cmd_rs);
+
+  if (_get (obj_cmd_rq, "payload_type", &payload_type) < 0
+      || _get (obj_cmd_rq, "payload_instance", &payload_instance) < 0)
+    return (IPMI_COMP_CODE_UNSPECIFIED_ERROR);
+
+  if (payload_type != IPMI_PAYLOAD_TYPE_SOL
+      || payload_instance != 1)
+    return (IPMI_COMP_CODE_INVALID_DATA_FIELD_IN_REQUEST);
+
+  if (!bmc->sol_session)
+    return (IPMI_COMP_CODE_DEACTIVATE_PAYLOAD_PAYLOAD_ALREADY_DEACTIVATED);
+
+  /* any session may deactivate, as ipmiconsole's --deactivate does */
+  bmc->sol_session->sol_activated = 0;
+  bmc->sol_session = NULL;
+  return (IPMI_COMP_CODE_COMMAND_SUCCESS);
+}
+
+static uint8_t
+_get_chassis_status (ipmi_sim_state_data_t *state_data,
+                     struct ipmi_sim_bmc *bmc,
+                     struct ipmi_sim_session *session,
+                     fiid_obj_t obj_cmd_rq,
+                     fiid_obj_t obj_cmd_rs)
+{
+  assert (state_data);
+  assert (bmc);
+  assert (obj_cmd_rq);
+  assert (obj_cmd_rs);
+
+  if (_set (obj_cmd_rs, "current_power_state.power_is_on", bmc->power_on) < 0
+      || _set (obj_cmd_rs,
+               "misc_chassis_state.chassis_identify_state",
+               bmc->identify_on) < 0
+      || _set (obj_cmd_rs,
+               "misc_chassis_state.chassis_identify_command_and_state_info_supported",
+               1) < 0)
+    return (IPMI_COMP_CODE_UNSPECIFIED_ERROR);
+
+  return (IPMI_COMP_CODE_COMMAND_SUCCESS);
+}
+
+static uint8_t
+_chassis_control (ipmi_sim_state_data_t *state_data,
+                  struct ipmi_sim_bmc *bmc,
+                  struct ipmi_sim_session *session,
+                  fiid_obj_t obj_cmd_rq,
+                  fiid_obj_t obj_cmd_rs)
+{
+  uint64_t chassis_control;
+
+  assert (state_data);
+  assert (bmc);
+  assert (obj_cmd_rq);
+  assert (obj_cmd_rs);
+
+  if (_get (obj_cmd_rq, "chassis_control", &chassis_control) < 0)
+    return (IPMI_COMP_CODE_UNSPECIFIED_ERROR);
+
+  switch (chassis_control)
+    {
+    case IPMI_CHASSIS_CONTROL_POWER_DOWN:
+    case IPMI_CHASSIS_CONTROL_INITIATE_SOFT_SHUTDOWN:
+      bmc->power_on = 0;
+      break;
+    case IPMI_CHASSIS_CONTROL_POWER_UP:
+    case IPMI_CHASSIS_CONTROL_POWER_CYCLE:
+    case IPMI_CHASSIS_CONTROL_HARD_RESET:
+      bmc->power_on = 1;
+      break;
+    case IPMI_CHASSIS_CONTROL_PULSE_DIAGNOSTIC_INTERRUPT:
+      break;
+    default:
+      return (IPMI_COMP_CODE_INVALID_DATA_FIELD_IN_REQUEST);
+    }
+
+  return (IPMI_COMP_CODE_COMMAND_SUCCESS);
+}
+
+static uint8_t
+_chassis_identify (ipmi_sim_state_data_t *state_data,
+                   struct ipmi_sim_bmc *bmc,
+                   struct ipmi_sim_session *session,
+                   fiid_obj_t obj_cmd_rq,
+                   fiid_obj_t obj_cmd_rs)
+{
+  uint64_t identify_interval = 15;
+  uint64_t force_identify = 0;
+  int ret;
+
+  assert (state_data);
+  assert (bmc);
+  assert (obj_cmd_rq);
+  assert (obj_cmd_rs);
+
+  /* both fields are optional */
+  if ((ret = fiid_obj_get (obj_cmd_rq, "identify_interval", &identify_interval)) < 0)
+    return (IPMI_COMP_CODE_UNSPECIFIED_ERROR);
+  if (!ret)
+    identify_interval = 15;
+
+  if ((ret = fiid_obj_get (obj_cmd_rq, "force_identify", &force_identify)) < 0)
+    return (IPMI_COMP_CODE_UNSPECIFIED_ERROR);
+  if (!ret)
+    force_identify = 0;
+
+  /* the interval is not timed, a temporary identify stays on */
+  if (force_identify)
+    bmc->identify_on = IPMI_SIM_CHASSIS_IDENTIFY_STATE_INDEFINITE;
+  else if (identify_interval)
+    bmc->identify_on = IPMI_SIM_CHASSIS_IDENTIFY_STATE_TEMPORARY;
+  else
+    bmc->identify_on = IPMI_SIM_CHASSIS_IDENTIFY_STATE_OFF;
+
+  return (IPMI_COMP_CODE_COMMAND_SUCCESS);
+}
+
+static uint8_t
+_get_sensor_reading (ipmi_sim_state_data_t *state_data,
+                     struct ipmi_sim_bmc *bmc,
+                     struct ipmi_sim_session *session,
+                     fiid_obj_t obj_cmd_rq,
+                     fiid_obj_t obj_cmd_rs)
+{
+  struct ipmi_sim_sensor_reading *reading;
+  uint64_t sensor_number;
+
+  assert (state_data);
+  assert (bmc);
+  assert (obj_cmd_rq);
+  assert (obj_cmd_rs);
+
+  if (_get (obj_cmd_rq, "sensor_number", &sensor_number) < 0)
+    return (IPMI_COMP_CODE_UNSPECIFIED_ERROR);
+
+  reading = &(state_data->data.readings[sensor_number]);
+
+  if (_set (obj_cmd_rs, "sensor_reading", reading->reading) < 0
+      || _set (obj_cmd_rs, "sensor_scanning", 1) < 0
+      || _set (obj_cmd_rs, "all_event_messages", 1) < 0
+      || _set (obj_cmd_rs, "sensor_event_bitmask1", reading->event_bitmask & 0xFF) < 0
+      || _set (obj_cmd_rs, "sensor_event_bitmask2", (reading->event_bitmask >> 8) & 0x7F) < 0
+      || _set (obj_cmd_rs, "reserved2", 0) < 0)
+    return (IPMI_COMP_CODE_UNSPECIFIED_ERROR);
+
+  return (IPMI_COMP_CODE_COMMAND_SUCCESS);
+}
+
+static uint8_t
+_get_sensor_thresholds (ipmi_sim_state_data_t *state_data,
+                        struct ipmi_sim_bmc *bmc,
+                        struct ipmi_sim_session *session,
+                        fiid_obj_t obj_cmd_rq,
+                        fiid_obj_t obj_cmd_rs)
+{
+  assert (state_data);
+  assert (bmc);
+  assert (obj_cmd_rq);
+  assert (obj_cmd_rs);
+
+  /* thresholds are only served through the SDR, clients fall back
+   * to them
+   */
+  return (IPMI_COMP_CODE_REQUESTED_SENSOR_DATA_OR_RECORD_NOT_PRESENT);
+}
+
+static uint8_t
+_get_fru_inventory_area_info (ipmi_sim_state_data_t *state_data,
+                              struct ipmi_sim_bmc *bmc,
+                              struct ipmi_sim_session *session,
+                              fiid_obj_t obj_cmd_rq,
+                              fiid_obj_t obj_cmd_rs)
+{
+  uint64_t fru_device_id;
+
+  assert (state_data);
+  assert (bmc);
+  assert (obj_cmd_rq);
+  assert (obj_cmd_rs);
+
+  if (_get (obj_cmd_rq, "fru_device_id", &fru_device_id) < 0)
+    return (IPMI_COMP_CODE_UNSPECIFIED_ERROR);
+
+  if (fru_device_id != IPMI_FRU_DEVICE_ID_DEFAULT)
+    return (IPMI_COMP_CODE_REQUESTED_SENSOR_DATA_OR_RECORD_NOT_PRESENT);
+
+  if (_set (obj_cmd_rs, "fru_inventory_area_size", state_data->data.fru_len) < 0)
+    return (IPMI_COMP_CODE_UNSPECIFIED_ERROR);
+
+  return (IPMI_COMP_CODE_COMMAND_SUCCESS);
+}
+
+static uint8_t
+_read_fru_data (ipmi_sim_state_data_t *state_data,
+                struct ipmi_sim_bmc *bmc,
+                struct ipmi_sim_session *session,
+                fiid_obj_t obj_cmd_rq,
+                fiid_obj_t obj_cmd_rs)
+{
+  uint64_t fru_device_id, offset, count;
+
+  assert (state_data);
+  assert (bmc);
+  assert (obj_cmd_rq);
+  assert (obj_cmd_rs);
+
+  if (_get (obj_cmd_rq, "fru_device_id", &fru_device_id) < 0
+      || _get (obj_cmd_rq, "fru_inventory_offset_to_read", &offset) < 0
+      || _get (obj_cmd_rq, "count_to_read", &count) < 0)
+    return (IPMI_COMP_CODE_UNSPECIFIED_ERROR);
+
+  if (fru_device_id != IPMI_FRU_DEVICE_ID_DEFAULT)
+    return (IPMI_COMP_CODE_REQUESTED_SENSOR_DATA_OR_RECORD_NOT_PRESENT);
+
+  if (offset >= state_data->data.fru_len)
+    return (IPMI_COMP_CODE_PARAMETER_OUT_OF_RANGE);
+
+  if (count > state_data->data.fru_len - offset)
+    count = state_data->data.fru_len - offset;
+
+  if (_set (obj_cmd_rs, "count_returned", count) < 0
+      || _set_data (obj_cmd_rs,
+                    "requested_data",
+                    state_data->data.fru + offset,
+                    count) < 0)
+    return (IPMI_COMP_CODE_UNSPECIFIED_ERROR);
+
+  return (IPMI_COMP_CODE_COMMAND_SUCCESS);
+}
+
+static uint8_t
+_get_sdr_repository_info (ipmi_sim_state_data_t *state_data,
+                          struct ipmi_sim_bmc *bmc,
+                          struct ipmi_sim_session *session,
+                          fiid_obj_t obj_cmd_rq,
+                          fiid_obj_t obj_cmd_rs)
+{
+  assert (state_data);
+  assert (bmc);
+  assert (obj_cmd_rq);
+  assert (obj_cmd_rs);
+
+  /* a read-only repository, the erase timestamp equals the addition
+   * timestamp so SDR caches see an unchanged repository
+   */
+  if (_set (obj_cmd_rs, "sdr_version_major", IPMI_SIM_SDR_VERSION_MAJOR) < 0
+      || _set (obj_cmd_rs, "sdr_version_minor", IPMI_SIM_SDR_VERSION_MINOR) < 0
+      || _set (obj_cmd_rs, "record_count", state_data->data.sdr_count) < 0
+      || _set (obj_cmd_rs, "most_recent_addition_timestamp", state_data->data.sdr_timestamp) < 0
+      || _set (obj_cmd_rs, "most_recent_erase_timestamp", state_data->data.sdr_timestamp) < 0
+      || _set (obj_cmd_rs, "reserve_sdr_repository_command_supported", 1) < 0)
+    return (IPMI_COMP_CODE_UNSPECIFIED_ERROR);
+
+  return (IPMI_COMP_CODE_COMMAND_SUCCESS);
+}
+
+static uint8_t
+_reserve_sdr_repository (ipmi_sim_state_data_t *state_data,
+                         struct ipmi_sim_bmc *bmc,
+                         struct ipmi_sim_session *session,
+                         fiid_obj_t obj_cmd_rq,
+                         fiid_obj_t obj_cmd_rs)
+{
+  assert (state_data);
+  assert (bmc);
+  assert (obj_cmd_rq);
+  assert (obj_cmd_rs);
+
+  /* 0000h is reserved */
+  if (!++bmc->sdr_reservation_id)
+    bmc->sdr_reservation_id++;
+
+  if (_set (obj_cmd_rs, "reservation_id", bmc->sdr_reservation_id) < 0)
+    return (IPMI_COMP_CODE_UNSPECIFIED_ERROR);
+
+  return (IPMI_COMP_CODE_COMMAND_SUCCESS);
+}
+
+static uint8_t
+_get_sdr (ipmi_sim_state_data_t *state_data,
+          struct ipmi_sim_bmc *bmc,
+          struct ipmi_sim_session *session,
+          fiid_obj_t obj_cmd_rq,
+          fiid_obj_t obj_cmd_rs)
+{
+  struct ipmi_sim_sdr_record *record;
+  uint64_t reservation_id, record_id, offset, count;
+  uint16_t next_record_id;
+  int index;
+
+  assert (state_data);
+  assert (bmc);
+  assert (obj_cmd_rq);
+  assert (obj_cmd_rs);
+
+  if (_get (obj_cmd_rq, "reservation_id", &reservation_id) < 0
+      || _get (obj_cmd_rq, "record_id", &record_id) < 0
+      || _get (obj_cmd_rq, "offset_into_record", &offset) < 0
+      || _get (obj_cmd_rq, "bytes_to_read", &count) < 0)
+    return (IPMI_COMP_CODE_UNSPECIFIED_ERROR);
+
+  /* partial reads require a reservation */
+  if (offset && reservation_id != bmc->sdr_reservation_id)
+    return (IPMI_COMP_CODE_RESERVATION_CANCELLED);
+
+  if ((index = ipmi_sim_data_sdr_find (state_data, record_id)) < 0)
+    return (IPMI_COMP_CODE_REQUESTED_SENSOR_DATA_OR_RECORD_NOT_PRESENT);
+
+  record = &(state_data->data.sdr[index]);
+
+  if (offset >= record->len)
+    return (IPMI_COMP_CODE_PARAMETER_OUT_OF_RANGE);
+
+  /* like BMCs with small message buffers, entire record reads too */
+  if (state_data->prog_data->args->sdr_read_max
+      && count > state_data->prog_data->args->sdr_read_max)
+    return (IPMI_COMP_CODE_CANNOT_RETURN_REQUESTED_NUMBER_OF_BYTES);
+
+  /* FFh, entire record */
+  if (count > record->len - offset)
+    count = record->len - offset;
+
+  if (index + 1 < state_data->data.sdr_count)
+    next_record_id = state_data->data.sdr[index + 1].record_id;
+  else
+    next_record_id = IPMI_SIM_RECORD_ID_LAST;
+
+  if (_set (obj_cmd_rs, "next_record_id", next_record_id) < 0
+      || _set_data (obj_cmd_rs, "record_data", record->data + offset, count) < 0)
+    return (IPMI_COMP_CODE_UNSPECIFIED_ERROR);
+
+  return (IPMI_COMP_CODE_COMMAND_SUCCESS);
+}
+
+static unsigned int
+_sel_count (ipmi_sim_state_data_t *state_data, struct ipmi_sim_bmc *bmc)
+{
+  assert (state_data);
+  assert (bmc);
+
+  return (bmc->sel_cleared ? 0 : state_data->data.sel_count);
+}
+
+static uint8_t
+_get_sel_info (ipmi_sim_state_data_t *state_data,
+               struct ipmi_sim_bmc *bmc,
+               struct ipmi_sim_session *session,
+               fiid_obj_t obj_cmd_rq,
+               fiid_obj_t obj_cmd_rs)
+{
+  unsigned int entries;
+
+  assert (state_data);
+  assert (bmc);
+  assert (obj_cmd_rq);
+  assert (obj_cmd_rs);
+
+  entries = _sel_count (state_data, bmc);
+
+  if (_set (obj_cmd_rs, "sel_version_major", IPMI_SIM_SEL_VERSION_MAJOR) < 0
+      || _set (obj_cmd_rs, "sel_version_minor", IPMI_SIM_SEL_VERSION_MINOR) < 0
+      || _set (obj_cmd_rs, "entries", entries) < 0
+      || _set (obj_cmd_rs,
+               "free_space",
+               (IPMI_SIM_SEL_ENTRIES_MAX - entries) * IPMI_SIM_SEL_RECORD_LENGTH > 0xFFFF
+               ? 0xFFFF
+               : (IPMI_SIM_SEL_ENTRIES_MAX - entries) * IPMI_SIM_SEL_RECORD_LENGTH) < 0
+      || _set (obj_cmd_rs, "most_recent_addition_timestamp", state_data->data.sel_timestamp) < 0
+      || _set (obj_cmd_rs, "most_recent_erase_timestamp", bmc->sel_erase_timestamp) < 0
+      || _set (obj_cmd_rs, "get_sel_allocation_info_command_supported", 1) < 0
+      || _set (obj_cmd_rs, "reserve_sel_command_supported", 1) < 0)
+    return (IPMI_COMP_CODE_UNSPECIFIED_ERROR);
+
+  return (IPMI_COMP_CODE_COMMAND_SUCCESS);
+}
+
+static uint8_t
+_get_sel_allocation_info (ipmi_sim_state_data_t *state_data,
+                          struct ipmi_sim_bmc *bmc,
+                          struct ipmi_sim_session *session,
+                          fiid_obj_t obj_cmd_rq,
+                          fiid_obj_t obj_cmd_rs)
+{
+  unsigned int entries;
+
+  assert (state_data);
+  assert (bmc);
+  assert (obj_cmd_rq);
+  assert (obj_cmd_rs);
+
+  entries = _sel_count (state_data, bmc);
+
+  /* one allocation unit per record */
+  if (_set (obj_cmd_rs, "number_of_possible_allocation_units", IPMI_SIM_SEL_ENTRIES_MAX) < 0
+      || _set (obj_cmd_rs, "allocation_unit_size", IPMI_SIM_SEL_RECORD_LENGTH) < 0
+      || _set (obj_cmd_rs, "number_of_free_allocation_units", IPMI_SIM_SEL_ENTRIES_MAX - entries) < 0
+      || _set (obj_cmd_rs, "largest_free_block", IPMI_SIM_SEL_ENTRIES_MAX - entries) < 0
+      || _set (obj_cmd_rs, "maximum_record_size", 1) < 0)
+    return (IPMI_COMP_CODE_UNSPECIFIED_ERROR);
+
+  return (IPMI_COMP_CODE_COMMAND_SUCCESS);
+}
+
+static uint8_t
+_reserve_sel (ipmi_sim_state_data_t *state_data,
+              struct ipmi_sim_bmc *bmc,
+              struct ipmi_sim_session *session,
+              fiid_obj_t obj_cmd_rq,
+              fiid_obj_t obj_cmd_rs)
+{
+  assert (state_data);
+  assert (bmc);
+  assert (obj_cmd_rq);
+  assert (obj_cmd_rs);
+
+  /* 0000h is reserved */
+  if (!++bmc->sel_reservation_id)
+    bmc->sel_reservation_id++;
+
+  if (_set (obj_cmd_rs, "reservation_id", bmc->sel_reservation_id) < 0)
+    return (IPMI_COMP_CODE_UNSPECIFIED_ERROR);
+
+  return (IPMI_COMP_CODE_COMMAND_SUCCESS);
+}
+
+static uint8_t
+_get_sel_entry (ipmi_sim_state_data_t *state_data,
+                struct ipmi_sim_bmc *bmc,
+                struct ipmi_sim_session *session,
+                fiid_obj_t obj_cmd_rq,
+                fiid_obj_t obj_cmd_rs)
+{
+  uint64_t reservation_id, record_id, offset, count;
+  uint16_t next_record_id;
+  uint8_t *record;
+  int index;
+
+  assert (state_data);
+  assert (bmc);
+  assert (obj_cmd_rq);
+  assert (obj_cmd_rs);
+
+  if (_get (obj_cmd_rq, "reservation_id", &reservation_id) < 0
+      || _get (obj_cmd_rq, "record_id", &record_id) < 0
+      || _get (obj_cmd_rq, "offset_into_record", &offset) < 0
+      || _get (obj_cmd_rq, "bytes_to_read", &count) < 0)
+    return (IPMI_COMP_CODE_UNSPECIFIED_ERROR);
+
+  if (offset && reservation_id != bmc->sel_reservation_id)
+    return (IPMI_COMP_CODE_RESERVATION_CANCELLED);
+
+  if (bmc->sel_cleared
+      || (index = ipmi_sim_data_sel_find (state_data, record_id)) < 0)
+    return (IPMI_COMP_CODE_REQUESTED_SENSOR_DATA_OR_RECORD_NOT_PRESENT);
+
+  if (offset >= IPMI_SIM_SEL_RECORD_LENGTH)
+    return (IPMI_COMP_CODE_PARAMETER_OUT_OF_RANGE);
+
+  /* FFh, entire record */
+  if (count > IPMI_SIM_SEL_RECORD_LENGTH - offset)
+    count = IPMI_SIM_SEL_RECORD_LENGTH - offset;
+
+  if (index + 1 < state_data->data.sel_count)
+    {
+      uint8_t *next = state_data->data.sel + (index + 1) * IPMI_SIM_SEL_RECORD_LENGTH;
+      next_record_id = next[0] | (next[1] << 8);
+    }
+  else
+    next_record_id = IPMI_SIM_RECORD_ID_LAST;
+
+  record = state_data->data.sel + index * IPMI_SIM_SEL_RECORD_LENGTH;
+
+  if (_set (obj_cmd_rs, "next_record_id", next_record_id) < 0
+      || _set_data (obj_cmd_rs, "record_data", record + offset, count) < 0)
+    return (IPMI_COMP_CODE_UNSPECIFIED_ERROR);
+
+  return (IPMI_COMP_CODE_COMMAND_SUCCESS);
+}
+
+static uint8_t
+_clear_sel (ipmi_sim_state_data_t *state_data,
+            struct ipmi_sim_bmc *bmc,
+            struct ipmi_sim_session *session,
+            fiid_obj_t obj_cmd_rq,
+            fiid_obj_t obj_cmd_rs)
+{
+  uint64_t reservation_id, c, l, r, operation;
+
+  assert (state_data);
+  assert (bmc);
+  assert (obj_cmd_rq);
+  assert (obj_cmd_rs);
+
+  if (_get (obj_cmd_rq, "reservation_id", &reservation_id) < 0
+      || _get (obj_cmd_rq, "C", &c) < 0
+      || _get (obj_cmd_rq, "L", &l) < 0
+      || _get (obj_cmd_rq, "R", &r) < 0
+      || _get (obj_cmd_rq, "operation", &operation) < 0)
+    return (IPMI_COMP_CODE_UNSPECIFIED_ERROR);
+
+  if (reservation_id != bmc->sel_reservation_id)
+    return (IPMI_COMP_CODE_RESERVATION_CANCELLED);
+
+  if (c != 'C' || l != 'L' || r != 'R')
+    return (IPMI_COMP_CODE_INVALID_DATA_FIELD_IN_REQUEST);
+
+  if (operation == IPMI_SEL_CLEAR_OPERATION_INITIATE_ERASE)
+    {
+      /* the shared SEL is untouched, only this BMC's view is emptied */
+      bmc->sel_cleared = 1;
+      bmc->sel_erase_timestamp = time (NULL);
+    }
+  else if (operation != IPMI_SEL_CLEAR_OPERATION_GET_ERASURE_STATUS)
+    return (IPMI_COMP_CODE_INVALID_DATA_FIELD_IN_REQUEST);
+
+  if (_set (obj_cmd_rs, "erasure_progress", IPMI_SEL_CLEAR_ERASE_COMPLETED) < 0)
+    return (IPMI_COMP_CODE_UNSPECIFIED_ERROR);
+
+  return (IPMI_COMP_CODE_COMMAND_SUCCESS);
+}
+
+static uint8_t
+_get_sel_time (ipmi_sim_state_data_t *state_data,
+               struct ipmi_sim_bmc *bmc,
+               struct ipmi_sim_session *session,
+               fiid_obj_t obj_cmd_rq,
+               fiid_obj_t obj_cmd_rs)
+{
+  assert (state_data);
+  assert (bmc);
+  assert (obj_cmd_rq);
+  assert (obj_cmd_rs);
+
+  if (_set (obj_cmd_rs, "time", time (NULL)) < 0)
+    return (IPMI_COMP_CODE_UNSPECIFIED_ERROR);
+
+  return (IPMI_COMP_CODE_COMMAND_SUCCESS);
+}
+
+static struct ipmi_sim_cmd_def ipmi_sim_cmds[] =
+  {
+    {
+      IPMI_NET_FN_APP_RQ,
+      IPMI_CMD_GET_DEVICE_ID,
+      tmpl_cmd_get_device_id_rq,
+      tmpl_cmd_get_device_id_rs,
+      IPMI_PRIVILEGE_LEVEL_USER,
+      _get_device_id,
+    },
+    {
+      IPMI_NET_FN_APP_RQ,
+      IPMI_CMD_GET_DEVICE_GUID,
+      tmpl_cmd_get_device_guid_rq,
+      tmpl_cmd_get_device_guid_rs,
+      IPMI_PRIVILEGE_LEVEL_USER,
+      _get_guid,
+    },
+    {
+      IPMI_NET_FN_APP_RQ,
+      IPMI_CMD_GET_SYSTEM_GUID,
+      tmpl_cmd_get_system_guid_rq,
+      tmpl_cmd_get_system_guid_rs,
+      IPMI_PRIVILEGE_LEVEL_USER,
+      _get_guid,
+    },
+    {
+      IPMI_NET_FN_APP_RQ,
+      IPMI_CMD_GET_CHANNEL_AUTHENTICATION_CAPABILITIES,
+      tmpl_cmd_get_channel_authentication_capabilities_rq,
+      tmpl_cmd_get_channel_authentication_capabilities_rs,
+      IPMI_PRIVILEGE_LEVEL_RESERVED,
+      _get_channel_authentication_capabilities,
+    },
+    {
+      IPMI_NET_FN_APP_RQ,
+      IPMI_CMD_SET_SESSION_PRIVILEGE_LEVEL,
+      tmpl_cmd_set_session_privilege_level_rq,
+      tmpl_cmd_set_session_privilege_level_rs,
+      IPMI_PRIVILEGE_LEVEL_CALLBACK,
+      _set_session_privilege_level,
+    },
+    {
+      IPMI_NET_FN_APP_RQ,
+      IPMI_CMD_CLOSE_SESSION,
+      tmpl_cmd_close_session_rq,
+      tmpl_cmd_close_session_rs,
+      IPMI_PRIVILEGE_LEVEL_CALLBACK,
+      _close_session,
+    },
+    {
+      IPMI_NET_FN_APP_RQ,
+      IPMI_CMD_GET_CHANNEL_PAYLOAD_SUPPORT,
+      tmpl_cmd_get_channel_payload_support_rq,
+      tmpl_cmd_get_channel_payload_support_rs,
+      IPMI_PRIVILEGE_LEVEL_USER,
+      _get_channel_payload_support,
+    },
+    {
+      IPMI_NET_FN_APP_RQ,
+      IPMI_CMD_GET_CHANNEL_PAYLOAD_VERSION,
+      tmpl_cmd_get_channel_payload_version_rq,
+      tmpl_cmd_get_channel_payload_version_rs,
+      IPMI_PRIVILEGE_LEVEL_USER,
+      _get_channel_payload_version,
+    },
+    {
+      IPMI_NET_FN_APP_RQ,
+      IPMI_CMD_GET_PAYLOAD_ACTIVATION_STATUS,
+      tmpl_cmd_get_payload_activation_status_rq,
+      tmpl_cmd_get_payload_activation_status_rs,
+      IPMI_PRIVILEGE_LEVEL_USER,
+      _get_payload_activation_status,
+    },
+    {
+      IPMI_NET_FN_APP_RQ,
+      IPMI_CMD_ACTIVATE_PAYLOAD,
+      tmpl_cmd_activate_payload_rq,
+      tmpl_cmd_activate_payload_sol_rs,
+      IPMI_PRIVILEGE_LEVEL_USER,
+      _activate_payload,
+    },
+    {
+      IPMI_NET_FN_APP_RQ,
+      IPMI_CMD_DEACTIVATE_PAYLOAD,
+      tmpl_cmd_deactivate_payload_rq,
+      tmpl_cmd_deactivate_payload_rs,
+      IPMI_PRIVILEGE_LEVEL_USER,
+      _deactivate_payload,
+    },
+    {
+      IPMI_NET_FN_CHASSIS_RQ,
+      IPMI_CMD_GET_CHASSIS_STATUS,
+      tmpl_cmd_get_chassis_status_rq,
+      tmpl_cmd_get_chassis_status_rs,
+      IPMI_PRIVILEGE_LEVEL_USER,
+      _get_chassis_status,
+    },
+    {
+      IPMI_NET_FN_CHASSIS_RQ,
+      IPMI_CMD_CHASSIS_CONTROL,
+      tmpl_cmd_chassis_control_rq,
+      tmpl_cmd_chassis_control_rs,
+      IPMI_PRIVILEGE_LEVEL_OPERATOR,
+      _chassis_control,
+    },
+    {
+      IPMI_NET_FN_CHASSIS_RQ,
+      IPMI_CMD_CHASSIS_IDENTIFY,
+      tmpl_cmd_chassis_identify_rq,
+      tmpl_cmd_chassis_identify_rs,
+      IPMI_PRIVILEGE_LEVEL_OPERATOR,
+      _chassis_identify,
+    },
+    {
+      IPMI_NET_FN_SENSOR_EVENT_RQ,
+      IPMI_CMD_GET_SENSOR_READING,
+      tmpl_cmd_get_sensor_reading_rq,
+      tmpl_cmd_get_sensor_reading_rs,
+      IPMI_PRIVILEGE_LEVEL_USER,
+      _get_sensor_reading,
+    },
+    {
+      IPMI_NET_FN_SENSOR_EVENT_RQ,
+      IPMI_CMD_GET_SENSOR_THRESHOLDS,
+      tmpl_cmd_get_sensor_thresholds_rq,
+      tmpl_cmd_get_sensor_thresholds_rs,
+      IPMI_PRIVILEGE_LEVEL_USER,
+      _get_sensor_thresholds,
+    },
+    {
+      IPMI_NET_FN_STORAGE_RQ,
+      IPMI_CMD_GET_FRU_INVENTORY_AREA_INFO,
+      tmpl_cmd_get_fru_inventory_area_info_rq,
+      tmpl_cmd_get_fru_inventory_area_info_rs,
+      IPMI_PRIVILEGE_LEVEL_USER,
+      _get_fru_inventory_area_info,
+    },
+    {
+      IPMI_NET_FN_STORAGE_RQ,
+      IPMI_CMD_READ_FRU_DATA,
+      tmpl_cmd_read_fru_data_rq,
+      tmpl_cmd_read_fru_data_rs,
+      IPMI_PRIVILEGE_LEVEL_USER,
+      _read_fru_data,
+    },
+    {
+      IPMI_NET_FN_STORAGE_RQ,
+      IPMI_CMD_GET_SDR_REPOSITORY_INFO,
+      tmpl_cmd_get_sdr_repository_info_rq,
+      tmpl_cmd_get_sdr_repository_info_rs,
+      IPMI_PRIVILEGE_LEVEL_USER,
+      _get_sdr_repository_info,
+    },
+    {
+      IPMI_NET_FN_STORAGE_RQ,
+      IPMI_CMD_RESERVE_SDR_REPOSITORY,
+      tmpl_cmd_reserve_sdr_repository_rq,
+      tmpl_cmd_reserve_sdr_repository_rs,
+      IPMI_PRIVILEGE_LEVEL_USER,
+      _reserve_sdr_repository,
+    },
+    {
+      IPMI_NET_FN_STORAGE_RQ,
+      IPMI_CMD_GET_SDR,
+      tmpl_cmd_get_sdr_rq,
+      tmpl_cmd_get_sdr_rs,
+      IPMI_PRIVILEGE_LEVEL_USER,
+      _get_sdr,
+    },
+    {
+      IPMI_NET_FN_STORAGE_RQ,
+      IPMI_CMD_GET_SEL_INFO,
+      tmpl_cmd_get_sel_info_rq,
+      tmpl_cmd_get_sel_info_rs,
+      IPMI_PRIVILEGE_LEVEL_USER,
+      _get_sel_info,
+    },
+    {
+      IPMI_NET_FN_STORAGE_RQ,
+      IPMI_CMD_GET_SEL_ALLOCATION_INFO,
+      tmpl_cmd_get_sel_allocation_info_rq,
+      tmpl_cmd_get_sel_allocation_info_rs,
+      IPMI_PRIVILEGE_LEVEL_USER,
+      _get_sel_allocation_info,
+    },
+    {
+      IPMI_NET_FN_STORAGE_RQ,
+      IPMI_CMD_RESERVE_SEL,
+      tmpl_cmd_reserve_sel_rq,
+      tmpl_cmd_reserve_sel_rs,
+      IPMI_PRIVILEGE_LEVEL_USER,
+      _reserve_sel,
+    },
+    {
+      IPMI_NET_FN_STORAGE_RQ,
+      IPMI_CMD_GET_SEL_ENTRY,
+      tmpl_cmd_get_sel_entry_rq,
+      tmpl_cmd_get_sel_entry_rs,
+      IPMI_PRIVILEGE_LEVEL_USER,
+      _get_sel_entry,
+    },
+    {
+      IPMI_NET_FN_STORAGE_RQ,
+      IPMI_CMD_CLEAR_SEL,
+      tmpl_cmd_clear_sel_rq,
+      tmpl_cmd_clear_sel_rs,
+      IPMI_PRIVILEGE_LEVEL_OPERATOR,
+      _clear_sel,
+    },
+    {
+      IPMI_NET_FN_STORAGE_RQ,
+      IPMI_CMD_GET_SEL_TIME,
+      tmpl_cmd_get_sel_time_rq,
+      tmpl_cmd_get_sel_time_rs,
+      IPMI_PRIVILEGE_LEVEL_USER,
+      _get_sel_time,
+    },
+    {
+      0,
+      0,
+      NULL,
+      NULL,
+      0,
+      NULL,
+    },
+  };
+
+/* command and completion code only */
+static unsigned int
+_cmd_error (uint8_t cmd, uint8_t comp_code, uint8_t *rs, unsigned int rs_len)
+{
+  assert (rs);
+  assert (rs_len >= 2);
+
+  rs[0] = cmd;
+  rs[1] = comp_code;
+  return (2);
+}
+
+unsigned int
+ipmi_sim_cmd (ipmi_sim_state_data_t *state_data,
+              struct ipmi_sim_bmc *bmc,
+              struct ipmi_sim_session *session,
+              uint8_t net_fn,
+              const void *rq,
+              unsigned int rq_len,
+              void *rs,
+              unsigned int rs_len)
+{
+  struct ipmi_sim_cmd_def *def;
+  fiid_obj_t obj_cmd_rq = NULL;
+  fiid_obj_t obj_cmd_rs = NULL;
+  uint8_t cmd;
+  uint8_t comp_code;
+  int len;
+  unsigned int rv = 0;
+
+  assert (state_data);
+  assert (bmc);
+  assert (rq);
+  assert (rq_len);
+  assert (rs);
+  assert (rs_len >= 2);
+
+  cmd = ((const uint8_t *)rq)[0];
+
+  for (def = ipmi_sim_cmds; def->handler; def++)
+    {
+      if (def->net_fn == net_fn && def->cmd == cmd)
+        break;
+    }
+
+  if (!def->handler)
+    return (_cmd_error (cmd, IPMI_COMP_CODE_INVALID_COMMAND, rs, rs_len));
+
+  if (def->privilege_level != IPMI_PRIVILEGE_LEVEL_RESERVED
+      && (!session
+          || session->privilege_level < def->privilege_level))
+    return (_cmd_error (cmd, IPMI_COMP_CODE_INSUFFICIENT_PRIVILEGE_LEVEL, rs, rs_len));
+
+  if (!(obj_cmd_rq = fiid_obj_create (def->tmpl_cmd_rq)))
+    err_exit ("fiid_obj_create: %s", strerror (errno));
+
+  if (!(obj_cmd_rs = ipmi_sim_obj_create (def->tmpl_cmd_rs)))
+    err_exit ("fiid_obj_create: %s", strerror (errno));
+
+  if (fiid_obj_set_all (obj_cmd_rq, rq, rq_len) < 0
+      || fiid_obj_packet_valid (obj_cmd_rq) != 1)
+    {
+      rv = _cmd_error (cmd, IPMI_COMP_CODE_REQUEST_DATA_LENGTH_INVALID, rs, rs_len);
+      goto cleanup;
+    }
+
+  if ((comp_code = def->handler (state_data,
+                                 bmc,
+                                 session,
+                                 obj_cmd_rq,
+                                 obj_cmd_rs)) != IPMI_COMP_CODE_COMMAND_SUCCESS)
+    {
+      rv = _cmd_error (cmd, comp_code, rs, rs_len);
+      goto cleanup;
+    }
+
+  if (_set (obj_cmd_rs, "cmd", cmd) < 0
+      || _set (obj_cmd_rs, "comp_code", IPMI_COMP_CODE_COMMAND_SUCCESS) < 0
+      || (len = fiid_obj_get_all (obj_cmd_rs, rs, rs_len)) < 0)
+    {
+      err_debug ("fiid_obj_get_all: %s", fiid_obj_errormsg (obj_cmd_rs));
+      rv = _cmd_error (cmd, IPMI_COMP_CODE_UNSPECIFIED_ERROR, rs, rs_len);
+      goto cleanup;
+    }
+
+  rv = len;
+ cleanup:
+  fiid_obj_destroy (obj_cmd_rq);
+  fiid_obj_destroy (obj_cmd_rs);
+  return (rv);
+}
@@ -0,0 +1,43 @@
+/*
+ * Copyright (C) 2005-2015 FreeIPMI Core Team
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef IPMI_SIM_CMDS_H
+#define IPMI_SIM_CMDS_H
+
+#include "ipmi-sim.h"
+
+/* Executes the command in the IPMI message body rq, command byte
+ * first, and writes the response body to rs.  session is NULL for
+ * messages outside of a session, only Get Channel Authentication
+ * Capabilities is served then.
+ *
+ * Close Session releases the session, its contents remain valid
+ * until the response is sent.
+ *
+ * Returns the response length.
+ */
+unsigned int ipmi_sim_cmd (ipmi_sim_state_data_t *state_data,
+                           struct ipmi_sim_bmc *bmc,
+                           struct ipmi_sim_session *session,
+                           uint8_t net_fn,
+                           const void *rq,
+                           unsigned int rq_len,
+                           void *rs,
+                           unsigned int rs_len);
+
+#endif /* IPMI_SIM_CMDS_H */
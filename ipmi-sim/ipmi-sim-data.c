@@ -0,0 +1,597 @@
+/*
+ * Copyright (C) 2005-2015 FreeIPMI Core Team
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif /* HAVE_CONFIG_H */
+
+#include <stdio.h>
+#include <stdlib.h>
+#if STDC_HEADERS
+#include <string.h>
+#endif /* STDC_HEADERS */
+#if HAVE_UNISTD_H
+#include <unistd.h>
+#endif /* HAVE_UNISTD_H */
+#if HAVE_FCNTL_H
+#include <fcntl.h>
+#endif /* HAVE_FCNTL_H */
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <ctype.h>
+#include <assert.h>
+#include <errno.h>
+
+#include <freeipmi/freeipmi.h>
+
+#include "ipmi-sim.h"
+#include "ipmi-sim-data.h"
+
+#include "freeipmi-portability.h"
+#include "error.h"
+#include "fd.h"
+
+#define IPMI_SIM_DATA_BUFLEN      1024
+
+#define IPMI_SIM_SDR_RECORD_HEADER_LENGTH                 5
+#define IPMI_SIM_SDR_FULL_SENSOR_RECORD_ID_STRING_OFFSET  48
+#define IPMI_SIM_SDR_ID_STRING_MAX                        16
+/* 51h, IPMI v1.5 and v2.0 */
+#define IPMI_SIM_SDR_VERSION_MAJOR                        0x1
+#define IPMI_SIM_SDR_VERSION_MINOR                        0x5
+#define IPMI_SIM_SDR_ID_STRING_TYPE_8BIT_ASCII            0xC0
+
+/* arbitrary, fixed so SDR caches survive restarts of ipmi-sim */
+#define IPMI_SIM_SDR_TIMESTAMP                            0x50000000
+
+#define IPMI_SIM_FRU_COMMON_HEADER_LENGTH                 8
+#define IPMI_SIM_FRU_AREA_LENGTH_MULTIPLIER               8
+
+#define IPMI_SIM_FRU_MANUFACTURER "FreeIPMI"
+#define IPMI_SIM_FRU_PRODUCT_NAME "ipmi-sim"
+#define IPMI_SIM_FRU_SERIAL       "0000000000"
+#define IPMI_SIM_FRU_PART_NUMBER  "IPMI-SIM"
+
+/* generated sensors, readings are 1 degree C per raw unit */
+#define IPMI_SIM_SENSOR_READING_BASE                 25
+#define IPMI_SIM_SENSOR_UPPER_NON_RECOVERABLE        100
+#define IPMI_SIM_SENSOR_UPPER_CRITICAL               90
+#define IPMI_SIM_SENSOR_UPPER_NON_CRITICAL           80
+#define IPMI_SIM_SENSOR_UPPER_THRESHOLDS_MASK        0x0038
+
+static void
+_read_file (const char *filename, uint8_t **buf, unsigned int *buflen)
+{
+  struct stat st;
+  ssize_t len;
+  int fd;
+
+  assert (filename);
+  assert (buf);
+  assert (buflen);
+
+  if ((fd = open (filename, O_RDONLY)) < 0)
+    err_exit ("open: %s: %s", filename, strerror (errno));
+
+  if (fstat (fd, &st) < 0)
+    err_exit ("fstat: %s: %s", filename, strerror (errno));
+
+  if (!st.st_size)
+    err_exit ("%s: empty file", filename);
+
+  if (!((*buf) = malloc (st.st_size)))
+    err_exit ("malloc: %s", strerror (errno));
+
+  if ((len = fd_read_n (fd, *buf, st.st_size)) < 0)
+    err_exit ("read: %s: %s", filename, strerror (errno));
+
+  if (len != st.st_size)
+    err_exit ("%s: short read", filename);
+
+  (*buflen) = len;
+
+  /* ignore potential error, read only */
+  close (fd);
+}
+
+static void
+_sdr_add (ipmi_sim_state_data_t *state_data, const void *record, unsigned int record_len)
+{
+  struct ipmi_sim_sdr_record *r;
+
+  assert (state_data);
+  assert (record);
+  assert (record_len >= IPMI_SIM_SDR_RECORD_HEADER_LENGTH);
+
+  r = &(state_data->data.sdr[state_data->data.sdr_count]);
+
+  if (!(r->data = malloc (record_len)))
+    err_exit ("malloc: %s", strerror (errno));
+  memcpy (r->data, record, record_len);
+  r->len = record_len;
+  r->record_id = r->data[0] | (r->data[1] << 8);
+
+  state_data->data.sdr_count++;
+}
+
+static void
+_sdr_load (ipmi_sim_state_data_t *state_data)
+{
+  struct ipmi_sim_arguments *args;
+  ipmi_sdr_ctx_t sdr_ctx;
+  uint8_t record[IPMI_SDR_MAX_RECORD_LENGTH];
+  uint16_t record_count;
+  uint32_t timestamp;
+  unsigned int i;
+  int len;
+
+  assert (state_data);
+
+  args = state_data->prog_data->args;
+
+  if (!(sdr_ctx = ipmi_sdr_ctx_create ()))
+    err_exit ("ipmi_sdr_ctx_create: %s", strerror (errno));
+
+  if (ipmi_sdr_cache_open (sdr_ctx, NULL, args->sdr_cache_file) < 0)
+    err_exit ("ipmi_sdr_cache_open: %s: %s",
+              args->sdr_cache_file,
+              ipmi_sdr_ctx_errormsg (sdr_ctx));
+
+  if (ipmi_sdr_cache_record_count (sdr_ctx, &record_count) < 0)
+    err_exit ("ipmi_sdr_cache_record_count: %s", ipmi_sdr_ctx_errormsg (sdr_ctx));
+
+  /* serve the cache's timestamps, so a client's cache of the same
+   * repository remains valid
+   */
+  if (ipmi_sdr_cache_most_recent_addition_timestamp (sdr_ctx, &timestamp) < 0)
+    err_exit ("ipmi_sdr_cache_most_recent_addition_timestamp: %s",
+              ipmi_sdr_ctx_errormsg (sdr_ctx));
+  state_data->data.sdr_timestamp = timestamp;
+
+  if (!(state_data->data.sdr = calloc (record_count ? record_count : 1,
+                                       sizeof (struct ipmi_sim_sdr_record))))
+    err_exit ("calloc: %s", strerror (errno));
+
+  for (i = 0; i < record_count; i++, ipmi_sdr_cache_next (sdr_ctx))
+    {
+      if ((len = ipmi_sdr_cache_record_read (sdr_ctx,
+                                             record,
+                                             IPMI_SDR_MAX_RECORD_LENGTH)) < 0)
+        err_exit ("ipmi_sdr_cache_record_read: %s", ipmi_sdr_ctx_errormsg (sdr_ctx));
+
+      if (len < IPMI_SIM_SDR_RECORD_HEADER_LENGTH)
+        continue;
+
+      _sdr_add (state_data, record, len);
+    }
+
+  ipmi_sdr_ctx_destroy (sdr_ctx);
+}
+
+static void
+_sdr_generate (ipmi_sim_state_data_t *state_data)
+{
+  struct ipmi_sim_arguments *args;
+  uint8_t record[IPMI_SDR_MAX_RECORD_LENGTH];
+  fiid_obj_t obj_sdr_record = NULL;
+  char id_string[IPMI_SIM_SDR_ID_STRING_MAX + 1];
+  unsigned int i;
+  int id_string_len;
+  int len;
+
+  assert (state_data);
+
+  args = state_data->prog_data->args;
+
+  if (!(state_data->data.sdr = calloc (args->sensors ? args->sensors : 1,
+                                       sizeof (struct ipmi_sim_sdr_record))))
+    err_exit ("calloc: %s", strerror (errno));
+
+  /* a different number of sensors is a different repository */
+  state_data->data.sdr_timestamp = IPMI_SIM_SDR_TIMESTAMP + args->sensors;
+
+  /* temperature sensors on the system board, sensor number N is
+   * record id N + 1
+   */
+  for (i = 0; i < args->sensors; i++)
+    {
+      if (!(obj_sdr_record = ipmi_sim_obj_create (tmpl_sdr_full_sensor_record)))
+        err_exit ("fiid_obj_create: %s", strerror (errno));
+
+      id_string_len = snprintf (id_string, IPMI_SIM_SDR_ID_STRING_MAX + 1, "Temp %u", i);
+
+      if (fiid_obj_set (obj_sdr_record, "record_id", i + 1) < 0
+          || fiid_obj_set (obj_sdr_record, "sdr_version_major", IPMI_SIM_SDR_VERSION_MAJOR) < 0
+          || fiid_obj_set (obj_sdr_record, "sdr_version_minor", IPMI_SIM_SDR_VERSION_MINOR) < 0
+          || fiid_obj_set (obj_sdr_record, "record_type", IPMI_SDR_FORMAT_FULL_SENSOR_RECORD) < 0
+          || fiid_obj_set (obj_sdr_record,
+                           "record_length",
+                           IPMI_SIM_SDR_FULL_SENSOR_RECORD_ID_STRING_OFFSET
+                           - IPMI_SIM_SDR_RECORD_HEADER_LENGTH
+                           + id_string_len) < 0
+          || fiid_obj_set (obj_sdr_record, "sensor_owner_id", IPMI_SLAVE_ADDRESS_BMC >> 1) < 0
+          || fiid_obj_set (obj_sdr_record, "sensor_number", i) < 0
+          || fiid_obj_set (obj_sdr_record, "entity_id", IPMI_ENTITY_ID_SYSTEM_BOARD) < 0
+          || fiid_obj_set (obj_sdr_record, "entity_instance", 1) < 0
+          || fiid_obj_set (obj_sdr_record, "sensor_initialization.sensor_scanning", 1) < 0
+          || fiid_obj_set (obj_sdr_record, "sensor_initialization.event_generation", 1) < 0
+          || fiid_obj_set (obj_sdr_record,
+                           "sensor_capabilities.threshold_access_support",
+                           IPMI_SDR_FIXED_UNREADABLE_THRESHOLDS_SUPPORT) < 0
+          || fiid_obj_set (obj_sdr_record, "sensor_type", IPMI_SENSOR_TYPE_TEMPERATURE) < 0
+          || fiid_obj_set (obj_sdr_record,
+                           "event_reading_type_code",
+                           IPMI_EVENT_READING_TYPE_CODE_THRESHOLD) < 0
+          || fiid_obj_set (obj_sdr_record,
+                           "discrete_reading_settable_threshold_readable_threshold_mask",
+                           IPMI_SIM_SENSOR_UPPER_THRESHOLDS_MASK) < 0
+          || fiid_obj_set (obj_sdr_record, "sensor_unit2.base_unit", IPMI_SENSOR_UNIT_DEGREES_C) < 0
+          || fiid_obj_set (obj_sdr_record, "m_ls", 1) < 0
+          || fiid_obj_set (obj_sdr_record, "sensor_maximum_reading", 0xFF) < 0
+          || fiid_obj_set (obj_sdr_record,
+                           "upper_non_recoverable_threshold",
+                           IPMI_SIM_SENSOR_UPPER_NON_RECOVERABLE) < 0
+          || fiid_obj_set (obj_sdr_record,
+                           "upper_critical_threshold",
+                           IPMI_SIM_SENSOR_UPPER_CRITICAL) < 0
+          || fiid_obj_set (obj_sdr_record,
+                           "upper_non_critical_threshold",
+                           IPMI_SIM_SENSOR_UPPER_NON_CRITICAL) < 0
+          || fiid_obj_set (obj_sdr_record,
+                           "id_string_type_length_code",
+                           IPMI_SIM_SDR_ID_STRING_TYPE_8BIT_ASCII | id_string_len) < 0)
+        err_exit ("fiid_obj_set: %s", fiid_obj_errormsg (obj_sdr_record));
+
+      if (fiid_obj_set_data (obj_sdr_record,
+                             "id_string",
+                             id_string,
+                             id_string_len) < 0)
+        err_exit ("fiid_obj_set_data: %s", fiid_obj_errormsg (obj_sdr_record));
+
+      if ((len = fiid_obj_get_all (obj_sdr_record,
+                                   record,
+                                   IPMI_SDR_MAX_RECORD_LENGTH)) < 0)
+        err_exit ("fiid_obj_get_all: %s", fiid_obj_errormsg (obj_sdr_record));
+
+      _sdr_add (state_data, record, len);
+
+      fiid_obj_destroy (obj_sdr_record);
+    }
+}
+
+static void
+_sensor_readings_load (ipmi_sim_state_data_t *state_data)
+{
+  struct ipmi_sim_arguments *args;
+  char buf[IPMI_SIM_DATA_BUFLEN];
+  unsigned int line = 0;
+  FILE *fp;
+
+  assert (state_data);
+
+  args = state_data->prog_data->args;
+
+  if (!(fp = fopen (args->sensor_readings_file, "r")))
+    err_exit ("fopen: %s: %s", args->sensor_readings_file, strerror (errno));
+
+  /* SENSOR-NUMBER READING [EVENT-BITMASK], '#' starts a comment */
+  while (fgets (buf, IPMI_SIM_DATA_BUFLEN, fp))
+    {
+      long sensor_number, reading, event_bitmask = 0;
+      char *ptr, *endptr;
+
+      line++;
+
+      if ((ptr = strchr (buf, '#')))
+        *ptr = '\0';
+
+      ptr = buf;
+      while (isspace (*ptr))
+        ptr++;
+      if (*ptr == '\0')
+        continue;
+
+      errno = 0;
+      sensor_number = strtol (ptr, &endptr, 0);
+      if (errno
+          || endptr == ptr
+          || sensor_number < 0
+          || sensor_number > 0xFF)
+        err_exit ("%s:%u: invalid sensor number", args->sensor_readings_file, line);
+
+      ptr = endptr;
+      errno = 0;
+      reading = strtol (ptr, &endptr, 0);
+      if (errno
+          || endptr == ptr
+          || reading < 0
+          || reading > 0xFF)
+        err_exit ("%s:%u: invalid reading", args->sensor_readings_file, line);
+
+      ptr = endptr;
+      while (isspace (*ptr))
+        ptr++;
+      if (*ptr != '\0')
+        {
+          errno = 0;
+          event_bitmask = strtol (ptr, &endptr, 0);
+          if (errno
+              || endptr == ptr
+              || event_bitmask < 0
+              || event_bitmask > 0x7FFF)
+            err_exit ("%s:%u: invalid event bitmask", args->sensor_readings_file, line);
+        }
+
+      state_data->data.readings[sensor_number].configured = 1;
+      state_data->data.readings[sensor_number].reading = reading;
+      state_data->data.readings[sensor_number].event_bitmask = event_bitmask;
+    }
+
+  fclose (fp);
+}
+
+static void
+_sel_generate (ipmi_sim_state_data_t *state_data)
+{
+  struct ipmi_sim_arguments *args;
+  fiid_obj_t obj_sel_record = NULL;
+  unsigned int sensors;
+  unsigned int i;
+
+  assert (state_data);
+
+  args = state_data->prog_data->args;
+
+  if (!(state_data->data.sel = malloc (args->sel_entries * IPMI_SIM_SEL_RECORD_LENGTH)))
+    err_exit ("malloc: %s", strerror (errno));
+
+  sensors = args->sensors ? args->sensors : 1;
+
+  /* upper critical going high events of the generated sensors, one
+   * minute apart
+   */
+  for (i = 0; i < args->sel_entries; i++)
+    {
+      if (!(obj_sel_record = ipmi_sim_obj_create (tmpl_sel_system_event_record)))
+        err_exit ("fiid_obj_create: %s", strerror (errno));
+
+      if (fiid_obj_set (obj_sel_record, "record_id", i + 1) < 0
+          || fiid_obj_set (obj_sel_record, "record_type", IPMI_SEL_RECORD_TYPE_SYSTEM_EVENT_RECORD) < 0
+          || fiid_obj_set (obj_sel_record,
+                           "timestamp",
+                           state_data->data.sel_timestamp - (args->sel_entries - i) * 60) < 0
+          || fiid_obj_set (obj_sel_record, "generator_id.id", IPMI_SLAVE_ADDRESS_BMC >> 1) < 0
+          || fiid_obj_set (obj_sel_record,
+                           "event_message_format_version",
+                           IPMI_V1_5_EVENT_MESSAGE_FORMAT) < 0
+          || fiid_obj_set (obj_sel_record, "sensor_type", IPMI_SENSOR_TYPE_TEMPERATURE) < 0
+          || fiid_obj_set (obj_sel_record, "sensor_number", i % sensors) < 0
+          || fiid_obj_set (obj_sel_record,
+                           "event_type_code",
+                           IPMI_EVENT_READING_TYPE_CODE_THRESHOLD) < 0
+          || fiid_obj_set (obj_sel_record, "event_dir", IPMI_SEL_RECORD_ASSERTION_EVENT) < 0
+          || fiid_obj_set (obj_sel_record,
+                           "event_data1",
+                           IPMI_SEL_EVENT_DATA_TRIGGER_READING
+                           | IPMI_SEL_EVENT_DATA_TRIGGER_THRESHOLD_VALUE
+                           | IPMI_GENERIC_EVENT_READING_TYPE_CODE_THRESHOLD_UPPER_CRITICAL_GOING_HIGH) < 0
+          || fiid_obj_set (obj_sel_record, "event_data2", IPMI_SIM_SENSOR_UPPER_CRITICAL + 1) < 0
+          || fiid_obj_set (obj_sel_record, "event_data3", IPMI_SIM_SENSOR_UPPER_CRITICAL) < 0)
+        err_exit ("fiid_obj_set: %s", fiid_obj_errormsg (obj_sel_record));
+
+      if (fiid_obj_get_all (obj_sel_record,
+                            state_data->data.sel + i * IPMI_SIM_SEL_RECORD_LENGTH,
+                            IPMI_SIM_SEL_RECORD_LENGTH) != IPMI_SIM_SEL_RECORD_LENGTH)
+        err_exit ("fiid_obj_get_all: %s", fiid_obj_errormsg (obj_sel_record));
+
+      fiid_obj_destroy (obj_sel_record);
+    }
+
+  state_data->data.sel_count = args->sel_entries;
+}
+
+static unsigned int
+_fru_field (uint8_t *buf, const char *str)
+{
+  unsigned int len;
+
+  assert (buf);
+  assert (str);
+
+  len = strlen (str);
+  buf[0] = IPMI_FRU_TYPE_LENGTH_TYPE_CODE_LANGUAGE_CODE << 6 | len;
+  memcpy (buf + 1, str, len);
+  return (len + 1);
+}
+
+static uint8_t
+_fru_checksum (const uint8_t *buf, unsigned int len)
+{
+  uint8_t checksum = 0;
+  unsigned int i;
+
+  assert (buf);
+
+  for (i = 0; i < len; i++)
+    checksum += buf[i];
+
+  return (-checksum);
+}
+
+static void
+_fru_generate (ipmi_sim_state_data_t *state_data)
+{
+  uint8_t fru[IPMI_SIM_DATA_BUFLEN];
+  unsigned int board_len = 0;
+  uint8_t *board;
+
+  assert (state_data);
+
+  /* common header followed by a board info area */
+  memset (fru, '\0', IPMI_SIM_DATA_BUFLEN);
+  fru[0] = IPMI_FRU_COMMON_HEADER_FORMAT_VERSION;
+  fru[3] = IPMI_SIM_FRU_COMMON_HEADER_LENGTH / IPMI_SIM_FRU_AREA_LENGTH_MULTIPLIER;
+  fru[7] = _fru_checksum (fru, IPMI_SIM_FRU_COMMON_HEADER_LENGTH - 1);
+
+  board = fru + IPMI_SIM_FRU_COMMON_HEADER_LENGTH;
+  board[board_len++] = IPMI_FRU_COMMON_HEADER_FORMAT_VERSION;
+  board_len++;                  /* area length, filled in below */
+  board[board_len++] = IPMI_FRU_LANGUAGE_CODE_ENGLISH;
+  board_len += 3;               /* manufacturing date, unspecified */
+  board_len += _fru_field (board + board_len, IPMI_SIM_FRU_MANUFACTURER);
+  board_len += _fru_field (board + board_len, IPMI_SIM_FRU_PRODUCT_NAME);
+  board_len += _fru_field (board + board_len, IPMI_SIM_FRU_SERIAL);
+  board_len += _fru_field (board + board_len, IPMI_SIM_FRU_PART_NUMBER);
+  board_len += _fru_field (board + board_len, "");
+  board[board_len++] = IPMI_FRU_SENTINEL_VALUE;
+
+  /* pad to a multiple of 8 including the checksum */
+  board_len = ((board_len / IPMI_SIM_FRU_AREA_LENGTH_MULTIPLIER) + 1) * IPMI_SIM_FRU_AREA_LENGTH_MULTIPLIER;
+  board[1] = board_len / IPMI_SIM_FRU_AREA_LENGTH_MULTIPLIER;
+  board[board_len - 1] = _fru_checksum (board, board_len - 1);
+
+  state_data->data.fru_len = IPMI_SIM_FRU_COMMON_HEADER_LENGTH + board_len;
+  if (!(state_data->data.fru = malloc (state_data->data.fru_len)))
+    err_exit ("malloc: %s", strerror (errno));
+  memcpy (state_data->data.fru, fru, state_data->data.fru_len);
+}
+
+void
+ipmi_sim_data_load (ipmi_sim_state_data_t *state_data)
+{
+  struct ipmi_sim_arguments *args;
+  unsigned int i;
+
+  assert (state_data);
+
+  args = state_data->prog_data->args;
+
+  if (args->sdr_cache_file)
+    _sdr_load (state_data);
+  else
+    _sdr_generate (state_data);
+
+  if (args->sensor_readings_file)
+    _sensor_readings_load (state_data);
+
+  /* unconfigured sensors read a plausible temperature, with no
+   * thresholds crossed and no discrete states asserted
+   */
+  for (i = 0; i < 256; i++)
+    {
+      if (state_data->data.readings[i].configured)
+        continue;
+      state_data->data.readings[i].reading = IPMI_SIM_SENSOR_READING_BASE + (i % 10);
+      state_data->data.readings[i].event_bitmask = 0;
+    }
+
+  state_data->data.sel_timestamp = time (NULL);
+
+  if (args->sel_file)
+    {
+      unsigned int sel_len;
+
+      _read_file (args->sel_file, &(state_data->data.sel), &sel_len);
+
+      if (sel_len % IPMI_SIM_SEL_RECORD_LENGTH)
+        err_exit ("%s: not a multiple of %u byte SEL records",
+                  args->sel_file,
+                  IPMI_SIM_SEL_RECORD_LENGTH);
+
+      state_data->data.sel_count = sel_len / IPMI_SIM_SEL_RECORD_LENGTH;
+    }
+  else
+    _sel_generate (state_data);
+
+  if (args->fru_file)
+    {
+      _read_file (args->fru_file, &(state_data->data.fru), &(state_data->data.fru_len));
+
+      if (state_data->data.fru_len > 0xFFFF)
+        err_exit ("%s: FRU inventory area too large", args->fru_file);
+    }
+  else
+    _fru_generate (state_data);
+}
+
+void
+ipmi_sim_data_cleanup (ipmi_sim_state_data_t *state_data)
+{
+  unsigned int i;
+
+  assert (state_data);
+
+  for (i = 0; i < state_data->data.sdr_count; i++)
+    free (state_data->data.sdr[i].data);
+  free (state_data->data.sdr);
+  free (state_data->data.sel);
+  free (state_data->data.fru);
+  memset (&(state_data->data), '\0', sizeof (struct ipmi_sim_data));
+}
+
+int
+ipmi_sim_data_sdr_find (ipmi_sim_state_data_t *state_data, uint16_t record_id)
+{
+  unsigned int i;
+
+  assert (state_data);
+
+  if (!state_data->data.sdr_count)
+    return (-1);
+
+  if (record_id == IPMI_SDR_RECORD_ID_FIRST)
+    return (0);
+
+  if (record_id == IPMI_SDR_RECORD_ID_LAST)
+    return (state_data->data.sdr_count - 1);
+
+  for (i = 0; i < state_data->data.sdr_count; i++)
+    {
+      if (state_data->data.sdr[i].record_id == record_id)
+        return (i);
+    }
+
+  return (-1);
+}
+
+int
+ipmi_sim_data_sel_find (ipmi_sim_state_data_t *state_data, uint16_t record_id)
+{
+  unsigned int i;
+
+  assert (state_data);
+
+  if (!state_data->data.sel_count)
+    return (-1);
+
+  if (record_id == IPMI_SEL_GET_RECORD_ID_FIRST_ENTRY)
+    return (0);
+
+  if (record_id == IPMI_SEL_GET_RECORD_ID_LAST_ENTRY)
+    return (state_data->data.sel_count - 1);
+
+  for (i = 0; i < state_data->data.sel_count; i++)
+    {
+      uint8_t *record = state_data->data.sel + i * IPMI_SIM_SEL_RECORD_LENGTH;
+
+      if ((record[0] | (record[1] << 8)) == record_id)
+        return (i);
+    }
+
+  return (-1);
+}
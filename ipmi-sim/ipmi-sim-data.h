@@ -0,0 +1,38 @@
+/*
+ * Copyright (C) 2005-2015 FreeIPMI Core Team
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef IPMI_SIM_DATA_H
+#define IPMI_SIM_DATA_H
+
+#include "ipmi-sim.h"
+
+/* load or generate the SDR, SEL, FRU and sensor readings, exits on
+ * error
+ */
+void ipmi_sim_data_load (ipmi_sim_state_data_t *state_data);
+
+void ipmi_sim_data_cleanup (ipmi_sim_state_data_t *state_data);
+
+/* record id 0x0000 is the first record, 0xFFFF the last.  Returns
+ * the index of the record, -1 if not found.
+ */
+int ipmi_sim_data_sdr_find (ipmi_sim_state_data_t *state_data, uint16_t record_id);
+
+int ipmi_sim_data_sel_find (ipmi_sim_state_data_t *state_data, uint16_t record_id);
+
+#endif /* IPMI_SIM_DATA_H */
@@ -0,0 +1,249 @@
+/*
+ * Copyright (C) 2005-2015 FreeIPMI Core Team
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif /* HAVE_CONFIG_H */
+
+#include <stdio.h>
+#include <stdlib.h>
+#if STDC_HEADERS
+#include <string.h>
+#endif /* STDC_HEADERS */
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#if HAVE_UNISTD_H
+#include <unistd.h>
+#endif /* HAVE_UNISTD_H */
+#include <assert.h>
+#include <errno.h>
+
+#include <freeipmi/freeipmi.h>
+
+#include "ipmi-sim.h"
+#include "ipmi-sim-cmds.h"
+#include "ipmi-sim-inband.h"
+
+#include "freeipmi-portability.h"
+#include "error.h"
+#include "fd.h"
+
+/* KCS format header, net_fn in the upper six bits */
+#define IPMI_SIM_INBAND_NET_FN_SHIFT 2
+#define IPMI_SIM_INBAND_LUN_MASK     0x03
+
+#define IPMI_SIM_INBAND_BACKLOG      16
+
+void
+ipmi_sim_inband_setup (ipmi_sim_state_data_t *state_data)
+{
+  struct ipmi_sim_arguments *args;
+  struct sockaddr_un addr;
+  struct stat st;
+  unsigned int i;
+
+  assert (state_data);
+
+  args = state_data->prog_data->args;
+
+  state_data->inband_fd = -1;
+  for (i = 0; i < IPMI_SIM_INBAND_CONNS_MAX; i++)
+    state_data->inband_conns[i].fd = -1;
+
+  if (!args->inband_socket)
+    return;
+
+  if (strlen (args->inband_socket) >= sizeof (addr.sun_path))
+    err_exit ("inband socket path too long: %s", args->inband_socket);
+
+  /* a socket left behind by an earlier run */
+  if (!lstat (args->inband_socket, &st)
+      && S_ISSOCK (st.st_mode))
+    unlink (args->inband_socket);
+
+  memset (&addr, '\0', sizeof (struct sockaddr_un));
+  addr.sun_family = AF_UNIX;
+  strcpy (addr.sun_path, args->inband_socket);
+
+  if ((state_data->inband_fd = socket (AF_UNIX, SOCK_SEQPACKET, 0)) < 0)
+    err_exit ("socket: %s", strerror (errno));
+
+  if (bind (state_data->inband_fd, (struct sockaddr *)&addr, sizeof (struct sockaddr_un)) < 0)
+    err_exit ("bind %s: %s", args->inband_socket, strerror (errno));
+
+  if (listen (state_data->inband_fd, IPMI_SIM_INBAND_BACKLOG) < 0)
+    err_exit ("listen: %s", strerror (errno));
+
+  if (fd_set_nonblocking (state_data->inband_fd) < 0)
+    err_exit ("fd_set_nonblocking: %s", strerror (errno));
+
+  memset (&state_data->inband_session, '\0', sizeof (struct ipmi_sim_session));
+  state_data->inband_session.in_use = 1;
+  state_data->inband_session.ipmi_version = IPMI_SIM_IPMI_VERSION_1_5;
+  state_data->inband_session.activated = 1;
+  state_data->inband_session.privilege_level = IPMI_PRIVILEGE_LEVEL_ADMIN;
+  state_data->inband_session.maximum_privilege_level = IPMI_PRIVILEGE_LEVEL_ADMIN;
+
+  if (args->verbose)
+    err_output ("serving in-band requests on %s", args->inband_socket);
+}
+
+static void
+_inband_close (ipmi_sim_state_data_t *state_data, unsigned int conn)
+{
+  assert (state_data);
+  assert (conn < IPMI_SIM_INBAND_CONNS_MAX);
+  assert (state_data->inband_conns[conn].fd >= 0);
+
+  close (state_data->inband_conns[conn].fd);
+  state_data->inband_conns[conn].fd = -1;
+}
+
+void
+ipmi_sim_inband_cleanup (ipmi_sim_state_data_t *state_data)
+{
+  unsigned int i;
+
+  assert (state_data);
+
+  if (state_data->inband_fd < 0)
+    return;
+
+  for (i = 0; i < IPMI_SIM_INBAND_CONNS_MAX; i++)
+    {
+      if (state_data->inband_conns[i].fd >= 0)
+        _inband_close (state_data, i);
+    }
+
+  close (state_data->inband_fd);
+  state_data->inband_fd = -1;
+  unlink (state_data->prog_data->args->inband_socket);
+}
+
+void
+ipmi_sim_inband_accept (ipmi_sim_state_data_t *state_data)
+{
+  unsigned int i;
+  int fd;
+
+  assert (state_data);
+  assert (state_data->inband_fd >= 0);
+
+  while ((fd = accept (state_data->inband_fd, NULL, NULL)) >= 0)
+    {
+      for (i = 0; i < IPMI_SIM_INBAND_CONNS_MAX; i++)
+        {
+          if (state_data->inband_conns[i].fd < 0)
+            break;
+        }
+
+      if (i == IPMI_SIM_INBAND_CONNS_MAX)
+        {
+          if (state_data->prog_data->args->verbose)
+            err_output ("inband: too many clients");
+          close (fd);
+          continue;
+        }
+
+      if (fd_set_nonblocking (fd) < 0)
+        err_exit ("fd_set_nonblocking: %s", strerror (errno));
+
+      state_data->inband_conns[i].fd = fd;
+      state_data->inband_conns[i].id = ++state_data->inband_conn_id;
+    }
+
+  if (errno != EAGAIN
+      && errno != EWOULDBLOCK
+      && errno != EINTR
+      && state_data->prog_data->args->verbose)
+    err_output ("inband: accept: %s", strerror (errno));
+}
+
+void
+ipmi_sim_inband_process (ipmi_sim_state_data_t *state_data,
+                         unsigned int conn)
+{
+  struct ipmi_sim_arguments *args;
+  uint8_t rq[IPMI_SIM_PKT_LEN];
+  uint8_t rs[IPMI_SIM_PKT_LEN];
+  ssize_t len;
+
+  assert (state_data);
+  assert (conn < IPMI_SIM_INBAND_CONNS_MAX);
+  assert (state_data->inband_conns[conn].fd >= 0);
+
+  args = state_data->prog_data->args;
+
+  while (1)
+    {
+      unsigned int rs_len;
+      uint8_t net_fn, lun;
+
+      if ((len = recv (state_data->inband_conns[conn].fd, rq, IPMI_SIM_PKT_LEN, 0)) < 0)
+        {
+          if (errno == EAGAIN
+              || errno == EWOULDBLOCK
+              || errno == EINTR)
+            return;
+          if (args->verbose)
+            err_output ("inband: recv: %s", strerror (errno));
+          _inband_close (state_data, conn);
+          return;
+        }
+
+      if (!len)
+        {
+          _inband_close (state_data, conn);
+          return;
+        }
+
+      state_data->stats.received++;
+
+      if (args->verbose > 1)
+        err_output ("inband: %d bytes from client %u", (int)len, conn);
+
+      /* net_fn/lun, command */
+      if (len < 2)
+        continue;
+
+      net_fn = rq[0] >> IPMI_SIM_INBAND_NET_FN_SHIFT;
+      lun = rq[0] & IPMI_SIM_INBAND_LUN_MASK;
+
+      if (!IPMI_NET_FN_RQ_VALID (net_fn))
+        continue;
+
+      rs[0] = ((net_fn + 1) << IPMI_SIM_INBAND_NET_FN_SHIFT) | lun;
+      rs_len = ipmi_sim_cmd (state_data,
+                             &state_data->bmcs[0],
+                             &state_data->inband_session,
+                             net_fn,
+                             rq + 1,
+                             len - 1,
+                             rs + 1,
+                             IPMI_SIM_PKT_LEN - 1);
+
+      /* Close Session may have released the session, in-band
+       * requests are always at administrator privilege
+       */
+      state_data->inband_session.in_use = 1;
+
+      ipmi_sim_inband_send (state_data, conn, rs, rs_len + 1);
+    }
+}
@@ -0,0 +1,43 @@
+/*
+ * Copyright (C) 2005-2015 FreeIPMI Core Team
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef IPMI_SIM_INBAND_H
+#define IPMI_SIM_INBAND_H
+
+#include "ipmi-sim.h"
+
+/* Serves the mock in-band driver of libfreeipmi on --inband-socket,
+ * a SOCK_SEQPACKET Unix socket.  Every message is one KCS format
+ * request (net_fn/lun byte, command, data) answered with one KCS
+ * format response.  Sets state_data->inband_fd to -1 if the option
+ * is not given.
+ */
+void ipmi_sim_inband_setup (ipmi_sim_state_data_t *state_data);
+
+void ipmi_sim_inband_cleanup (ipmi_sim_state_data_t *state_data);
+
+/* accepts a client, refused once IPMI_SIM_INBAND_CONNS_MAX are
+ * connected
+ */
+void ipmi_sim_inband_accept (ipmi_sim_state_data_t *state_data);
+
+/* answers the pending requests of a client, closes it on hangup */
+void ipmi_sim_inband_process (ipmi_sim_state_data_t *state_data,
+                              unsigned int conn);
+
+#endif /* IPMI_SIM_INBAND_H */
@@ -0,0 +1,573 @@
+/*
+ * Copyright (C) 2005-2015 FreeIPMI Core Team
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif /* HAVE_CONFIG_H */
+
+#include <stdio.h>
+#include <stdlib.h>
+#if STDC_HEADERS
+#include <string.h>
+#endif /* STDC_HEADERS */
+#include <assert.h>
+#include <errno.h>
+#include <arpa/inet.h>
+
+#include <freeipmi/freeipmi.h>
+
+#include "ipmi-sim.h"
+#include "ipmi-sim-cmds.h"
+#include "ipmi-sim-lan.h"
+
+#include "freeipmi-portability.h"
+#include "error.h"
+
+/* ASF version 1.0 */
+#define IPMI_SIM_ASF_SUPPORTED_ENTITIES_VERSION 0x1
+#define IPMI_SIM_ASF_PONG_DATA_LENGTH           0x10
+
+void
+ipmi_sim_lan_ping (ipmi_sim_state_data_t *state_data,
+                   struct ipmi_sim_bmc *bmc,
+                   const struct sockaddr_in *from,
+                   const void *pkt,
+                   unsigned int pkt_len)
+{
+  fiid_obj_t obj_rmcp_hdr = NULL;
+  fiid_obj_t obj_ping = NULL;
+  fiid_obj_t obj_pong = NULL;
+  uint8_t buf[IPMI_SIM_PKT_LEN];
+  uint64_t message_type, message_tag;
+  int len;
+
+  assert (state_data);
+  assert (bmc);
+  assert (from);
+  assert (pkt);
+
+  if (!(obj_rmcp_hdr = fiid_obj_create (tmpl_rmcp_hdr)))
+    err_exit ("fiid_obj_create: %s", strerror (errno));
+  if (!(obj_ping = fiid_obj_create (tmpl_cmd_asf_presence_ping)))
+    err_exit ("fiid_obj_create: %s", strerror (errno));
+  if (!(obj_pong = ipmi_sim_obj_create (tmpl_cmd_asf_presence_pong)))
+    err_exit ("fiid_obj_create: %s", strerror (errno));
+
+  if (unassemble_rmcp_pkt (pkt,
+                           pkt_len,
+                           obj_rmcp_hdr,
+                           obj_ping,
+                           IPMI_INTERFACE_FLAGS_DEFAULT) != 1)
+    goto cleanup;
+
+  if (FIID_OBJ_GET (obj_ping, "message_type", &message_type) < 0
+      || FIID_OBJ_GET (obj_ping, "message_tag", &message_tag) < 0)
+    {
+      err_debug ("fiid_obj_get: %s", fiid_obj_errormsg (obj_ping));
+      goto cleanup;
+    }
+
+  if (message_type != RMCP_ASF_MESSAGE_TYPE_PRESENCE_PING)
+    goto cleanup;
+
+  if (fill_rmcp_hdr_asf (obj_rmcp_hdr) < 0)
+    {
+      err_debug ("fill_rmcp_hdr_asf: %s", strerror (errno));
+      goto cleanup;
+    }
+
+  /* the IANA number is sent MS byte first */
+  if (fiid_obj_set (obj_pong, "iana_enterprise_number", htonl (RMCP_ASF_IANA_ENTERPRISE_NUM)) < 0
+      || fiid_obj_set (obj_pong, "message_type", RMCP_ASF_MESSAGE_TYPE_PRESENCE_PONG) < 0
+      || fiid_obj_set (obj_pong, "message_tag", message_tag) < 0
+      || fiid_obj_set (obj_pong, "data_length", IPMI_SIM_ASF_PONG_DATA_LENGTH) < 0
+      || fiid_obj_set (obj_pong, "supported_entities.version", IPMI_SIM_ASF_SUPPORTED_ENTITIES_VERSION) < 0
+      || fiid_obj_set (obj_pong, "supported_entities.ipmi_supported", 1) < 0)
+    {
+      err_debug ("fiid_obj_set: %s", fiid_obj_errormsg (obj_pong));
+      goto cleanup;
+    }
+
+  if ((len = assemble_rmcp_pkt (obj_rmcp_hdr,
+                                obj_pong,
+                                buf,
+                                IPMI_SIM_PKT_LEN,
+                                IPMI_INTERFACE_FLAGS_DEFAULT)) < 0)
+    {
+      err_debug ("assemble_rmcp_pkt: %s", strerror (errno));
+      goto cleanup;
+    }
+
+  ipmi_sim_send (state_data, bmc, from, buf, len);
+
+ cleanup:
+  fiid_obj_destroy (obj_rmcp_hdr);
+  fiid_obj_destroy (obj_ping);
+  fiid_obj_destroy (obj_pong);
+}
+
+int
+ipmi_sim_lan_msg_hdr_rs (fiid_obj_t obj_lan_msg_hdr_rq,
+                         fiid_obj_t obj_lan_msg_hdr_rs)
+{
+  uint64_t rs_addr, rs_lun, rq_addr, rq_lun, rq_seq, net_fn;
+  uint8_t checksum;
+
+  assert (fiid_obj_valid (obj_lan_msg_hdr_rq));
+  assert (fiid_obj_valid (obj_lan_msg_hdr_rs));
+
+  if (FIID_OBJ_GET (obj_lan_msg_hdr_rq, "rs_addr", &rs_addr) < 0
+      || FIID_OBJ_GET (obj_lan_msg_hdr_rq, "rs_lun", &rs_lun) < 0
+      || FIID_OBJ_GET (obj_lan_msg_hdr_rq, "rq_addr", &rq_addr) < 0
+      || FIID_OBJ_GET (obj_lan_msg_hdr_rq, "rq_lun", &rq_lun) < 0
+      || FIID_OBJ_GET (obj_lan_msg_hdr_rq, "rq_seq", &rq_seq) < 0
+      || FIID_OBJ_GET (obj_lan_msg_hdr_rq, "net_fn", &net_fn) < 0)
+    {
+      err_debug ("fiid_obj_get: %s", fiid_obj_errormsg (obj_lan_msg_hdr_rq));
+      return (-1);
+    }
+
+  /* response net_fn is the request net_fn + 1 */
+  net_fn |= 0x1;
+  checksum = -(rs_addr + ((net_fn << 2) | rs_lun));
+
+  if (fiid_obj_set (obj_lan_msg_hdr_rs, "rs_addr", rs_addr) < 0
+      || fiid_obj_set (obj_lan_msg_hdr_rs, "net_fn", net_fn) < 0
+      || fiid_obj_set (obj_lan_msg_hdr_rs, "rs_lun", rs_lun) < 0
+      || fiid_obj_set (obj_lan_msg_hdr_rs, "checksum1", checksum) < 0
+      || fiid_obj_set (obj_lan_msg_hdr_rs, "rq_addr", rq_addr) < 0
+      || fiid_obj_set (obj_lan_msg_hdr_rs, "rq_seq", rq_seq) < 0
+      || fiid_obj_set (obj_lan_msg_hdr_rs, "rq_lun", rq_lun) < 0)
+    {
+      err_debug ("fiid_obj_set: %s", fiid_obj_errormsg (obj_lan_msg_hdr_rs));
+      return (-1);
+    }
+
+  return (0);
+}
+
+/* Get Session Challenge is served outside of a session, the
+ * temporary session id it returns identifies the new session until
+ * Activate Session.
+ */
+static unsigned int
+_get_session_challenge (ipmi_sim_state_data_t *state_data,
+                        struct ipmi_sim_bmc *bmc,
+                        const void *rq,
+                        unsigned int rq_len,
+                        void *rs,
+                        unsigned int rs_len)
+{
+  fiid_obj_t obj_cmd_rq = NULL;
+  fiid_obj_t obj_cmd_rs = NULL;
+  struct ipmi_sim_session *session;
+  char username[IPMI_MAX_USER_NAME_LENGTH+1];
+  char user_name[IPMI_MAX_USER_NAME_LENGTH];
+  uint64_t authentication_type;
+  uint8_t comp_code = IPMI_COMP_CODE_COMMAND_SUCCESS;
+  int len;
+  unsigned int rv = 0;
+
+  assert (state_data);
+  assert (bmc);
+  assert (rq);
+  assert (rs);
+  assert (rs_len >= 2);
+
+  if (!(obj_cmd_rq = fiid_obj_create (tmpl_cmd_get_session_challenge_rq)))
+    err_exit ("fiid_obj_create: %s", strerror (errno));
+  if (!(obj_cmd_rs = ipmi_sim_obj_create (tmpl_cmd_get_session_challenge_rs)))
+    err_exit ("fiid_obj_create: %s", strerror (errno));
+
+  if (fiid_obj_set_all (obj_cmd_rq, rq, rq_len) < 0
+      || fiid_obj_packet_valid (obj_cmd_rq) != 1)
+    {
+      comp_code = IPMI_COMP_CODE_REQUEST_DATA_LENGTH_INVALID;
+      goto out;
+    }
+
+  if (FIID_OBJ_GET (obj_cmd_rq, "authentication_type", &authentication_type) < 0)
+    {
+      err_debug ("fiid_obj_get: 'authentication_type': %s", fiid_obj_errormsg (obj_cmd_rq));
+      comp_code = IPMI_COMP_CODE_UNSPECIFIED_ERROR;
+      goto out;
+    }
+
+  if (authentication_type != IPMI_AUTHENTICATION_TYPE_NONE
+      && authentication_type != IPMI_AUTHENTICATION_TYPE_MD2
+      && authentication_type != IPMI_AUTHENTICATION_TYPE_MD5
+      && authentication_type != IPMI_AUTHENTICATION_TYPE_STRAIGHT_PASSWORD_KEY)
+    {
+      comp_code = IPMI_COMP_CODE_INVALID_DATA_FIELD_IN_REQUEST;
+      goto out;
+    }
+
+  /* user names are zero extended */
+  memset (user_name, '\0', IPMI_MAX_USER_NAME_LENGTH);
+  if (fiid_obj_get_data (obj_cmd_rq,
+                         "user_name",
+                         user_name,
+                         IPMI_MAX_USER_NAME_LENGTH) < 0)
+    {
+      err_debug ("fiid_obj_get_data: 'user_name': %s", fiid_obj_errormsg (obj_cmd_rq));
+      comp_code = IPMI_COMP_CODE_UNSPECIFIED_ERROR;
+      goto out;
+    }
+
+  memset (username, '\0', IPMI_MAX_USER_NAME_LENGTH+1);
+  strncpy (username, state_data->prog_data->args->username, sizeof (username) - 1);
+  username[sizeof (username) - 1] = '\0';
+
+  if (memcmp (username, user_name, IPMI_MAX_USER_NAME_LENGTH))
+    {
+      comp_code = IPMI_COMP_CODE_GET_SESSION_CHALLENGE_INVALID_USERNAME;
+      goto out;
+    }
+
+  if (!(session = ipmi_sim_session_new (state_data, bmc, IPMI_SIM_IPMI_VERSION_1_5)))
+    {
+      comp_code = IPMI_COMP_CODE_NODE_BUSY;
+      goto out;
+    }
+
+  session->authentication_type = authentication_type;
+  session->temp_session_id = session->session_id;
+
+  if (ipmi_get_random (session->challenge_string, IPMI_CHALLENGE_STRING_LENGTH) < 0)
+    err_exit ("ipmi_get_random: %s", strerror (errno));
+
+  if (fiid_obj_set (obj_cmd_rs, "cmd", IPMI_CMD_GET_SESSION_CHALLENGE) < 0
+      || fiid_obj_set (obj_cmd_rs, "comp_code", IPMI_COMP_CODE_COMMAND_SUCCESS) < 0
+      || fiid_obj_set (obj_cmd_rs, "temp_session_id", session->temp_session_id) < 0
+      || fiid_obj_set_data (obj_cmd_rs,
+                            "challenge_string",
+                            session->challenge_string,
+                            IPMI_CHALLENGE_STRING_LENGTH) < 0
+      || (len = fiid_obj_get_all (obj_cmd_rs, rs, rs_len)) < 0)
+    {
+      err_debug ("get session challenge: %s", fiid_obj_errormsg (obj_cmd_rs));
+      ipmi_sim_session_close (state_data, bmc, session);
+      comp_code = IPMI_COMP_CODE_UNSPECIFIED_ERROR;
+      goto out;
+    }
+
+  rv = len;
+ out:
+  if (comp_code != IPMI_COMP_CODE_COMMAND_SUCCESS)
+    {
+      ((uint8_t *)rs)[0] = IPMI_CMD_GET_SESSION_CHALLENGE;
+      ((uint8_t *)rs)[1] = comp_code;
+      rv = 2;
+    }
+  fiid_obj_destroy (obj_cmd_rq);
+  fiid_obj_destroy (obj_cmd_rs);
+  return (rv);
+}
+
+/* The request was sent under the temporary session id with a valid
+ * authentication code.  A retransmitted request is answered with the
+ * session id already assigned.
+ */
+static unsigned int
+_activate_session (ipmi_sim_state_data_t *state_data,
+                   struct ipmi_sim_bmc *bmc,
+                   struct ipmi_sim_session *session,
+                   const void *rq,
+                   unsigned int rq_len,
+                   void *rs,
+                   unsigned int rs_len)
+{
+  fiid_obj_t obj_cmd_rq = NULL;
+  fiid_obj_t obj_cmd_rs = NULL;
+  uint8_t challenge_string[IPMI_CHALLENGE_STRING_LENGTH];
+  uint64_t authentication_type, maximum_privilege_level, initial_outbound_sequence_number;
+  uint32_t initial_inbound_sequence_number;
+  uint8_t comp_code = IPMI_COMP_CODE_COMMAND_SUCCESS;
+  int len;
+  unsigned int rv = 0;
+
+  assert (state_data);
+  assert (bmc);
+  assert (session);
+  assert (rq);
+  assert (rs);
+  assert (rs_len >= 2);
+
+  if (!(obj_cmd_rq = fiid_obj_create (tmpl_cmd_activate_session_rq)))
+    err_exit ("fiid_obj_create: %s", strerror (errno));
+  if (!(obj_cmd_rs = ipmi_sim_obj_create (tmpl_cmd_activate_session_rs)))
+    err_exit ("fiid_obj_create: %s", strerror (errno));
+
+  if (fiid_obj_set_all (obj_cmd_rq, rq, rq_len) < 0
+      || fiid_obj_packet_valid (obj_cmd_rq) != 1)
+    {
+      comp_code = IPMI_COMP_CODE_REQUEST_DATA_LENGTH_INVALID;
+      goto out;
+    }
+
+  if (FIID_OBJ_GET (obj_cmd_rq, "authentication_type", &authentication_type) < 0
+      || FIID_OBJ_GET (obj_cmd_rq, "maximum_privilege_level", &maximum_privilege_level) < 0
+      || FIID_OBJ_GET (obj_cmd_rq,
+                       "initial_outbound_sequence_number",
+                       &initial_outbound_sequence_number) < 0
+      || fiid_obj_get_data (obj_cmd_rq,
+                            "challenge_string",
+                            challenge_string,
+                            IPMI_CHALLENGE_STRING_LENGTH) != IPMI_CHALLENGE_STRING_LENGTH)
+    {
+      err_debug ("activate session: %s", fiid_obj_errormsg (obj_cmd_rq));
+      comp_code = IPMI_COMP_CODE_UNSPECIFIED_ERROR;
+      goto out;
+    }
+
+  if (authentication_type != session->authentication_type
+      || memcmp (challenge_string, session->challenge_string, IPMI_CHALLENGE_STRING_LENGTH))
+    {
+      comp_code = IPMI_COMP_CODE_ACTIVATE_SESSION_INVALID_SESSION_ID;
+      goto out;
+    }
+
+  if (maximum_privilege_level < IPMI_PRIVILEGE_LEVEL_CALLBACK
+      || maximum_privilege_level > IPMI_PRIVILEGE_LEVEL_ADMIN)
+    {
+      comp_code = IPMI_COMP_CODE_ACTIVATE_SESSION_EXCEEDS_PRIVILEGE_LEVEL;
+      goto out;
+    }
+
+  if (!session->activated)
+    {
+      session->session_id = ipmi_sim_session_id_new (state_data, bmc);
+      session->outbound_sequence_number = initial_outbound_sequence_number;
+      session->maximum_privilege_level = maximum_privilege_level;
+      /* sessions start at user level, or below if so limited */
+      if (maximum_privilege_level < IPMI_PRIVILEGE_LEVEL_USER)
+        session->privilege_level = maximum_privilege_level;
+      else
+        session->privilege_level = IPMI_PRIVILEGE_LEVEL_USER;
+      session->activated = 1;
+    }
+
+  /* the remote console checks inbound sequence numbers, we don't */
+  initial_inbound_sequence_number = 1;
+
+  if (fiid_obj_set (obj_cmd_rs, "cmd", IPMI_CMD_ACTIVATE_SESSION) < 0
+      || fiid_obj_set (obj_cmd_rs, "comp_code", IPMI_COMP_CODE_COMMAND_SUCCESS) < 0
+      || fiid_obj_set (obj_cmd_rs, "authentication_type", session->authentication_type) < 0
+      || fiid_obj_set (obj_cmd_rs, "session_id", session->session_id) < 0
+      || fiid_obj_set (obj_cmd_rs,
+                       "initial_inbound_sequence_number",
+                       initial_inbound_sequence_number) < 0
+      || fiid_obj_set (obj_cmd_rs,
+                       "maximum_privilege_level",
+                       session->maximum_privilege_level) < 0
+      || (len = fiid_obj_get_all (obj_cmd_rs, rs, rs_len)) < 0)
+    {
+      err_debug ("activate session: %s", fiid_obj_errormsg (obj_cmd_rs));
+      comp_code = IPMI_COMP_CODE_UNSPECIFIED_ERROR;
+      goto out;
+    }
+
+  rv = len;
+ out:
+  if (comp_code != IPMI_COMP_CODE_COMMAND_SUCCESS)
+    {
+      ((uint8_t *)rs)[0] = IPMI_CMD_ACTIVATE_SESSION;
+      ((uint8_t *)rs)[1] = comp_code;
+      rv = 2;
+    }
+  fiid_obj_destroy (obj_cmd_rq);
+  fiid_obj_destroy (obj_cmd_rs);
+  return (rv);
+}
+
+void
+ipmi_sim_lan_process (ipmi_sim_state_data_t *state_data,
+                      struct ipmi_sim_bmc *bmc,
+                      const struct sockaddr_in *from,
+                      const void *pkt,
+                      unsigned int pkt_len)
+{
+  fiid_obj_t obj_rmcp_hdr = NULL;
+  fiid_obj_t obj_lan_session_hdr = NULL;
+  fiid_obj_t obj_lan_msg_hdr_rq = NULL;
+  fiid_obj_t obj_cmd_rq = NULL;
+  fiid_obj_t obj_lan_msg_trlr = NULL;
+  fiid_obj_t obj_lan_msg_hdr_rs = NULL;
+  fiid_obj_t obj_cmd_rs = NULL;
+  struct ipmi_sim_session *session = NULL;
+  uint8_t rq[IPMI_SIM_PKT_LEN];
+  uint8_t rs[IPMI_SIM_PKT_LEN];
+  uint8_t buf[IPMI_SIM_PKT_LEN];
+  uint64_t authentication_type, session_id, net_fn;
+  uint32_t session_sequence_number = 0;
+  int rq_len, len;
+  unsigned int rs_len;
+
+  assert (state_data);
+  assert (bmc);
+  assert (from);
+  assert (pkt);
+
+  if (!(obj_rmcp_hdr = fiid_obj_create (tmpl_rmcp_hdr)))
+    err_exit ("fiid_obj_create: %s", strerror (errno));
+  if (!(obj_lan_session_hdr = fiid_obj_create (tmpl_lan_session_hdr)))
+    err_exit ("fiid_obj_create: %s", strerror (errno));
+  if (!(obj_lan_msg_hdr_rq = fiid_obj_create (tmpl_lan_msg_hdr_rs)))
+    err_exit ("fiid_obj_create: %s", strerror (errno));
+  if (!(obj_cmd_rq = fiid_obj_create (tmpl_ipmi_sim_cmd)))
+    err_exit ("fiid_obj_create: %s", strerror (errno));
+  if (!(obj_lan_msg_trlr = fiid_obj_create (tmpl_lan_msg_trlr)))
+    err_exit ("fiid_obj_create: %s", strerror (errno));
+  if (!(obj_lan_msg_hdr_rs = fiid_obj_create (tmpl_lan_msg_hdr_rq)))
+    err_exit ("fiid_obj_create: %s", strerror (errno));
+  if (!(obj_cmd_rs = fiid_obj_create (tmpl_ipmi_sim_cmd)))
+    err_exit ("fiid_obj_create: %s", strerror (errno));
+
+  if (unassemble_ipmi_lan_pkt (pkt,
+                               pkt_len,
+                               obj_rmcp_hdr,
+                               obj_lan_session_hdr,
+                               obj_lan_msg_hdr_rq,
+                               obj_cmd_rq,
+                               obj_lan_msg_trlr,
+                               IPMI_INTERFACE_FLAGS_NO_LEGAL_CHECK) != 1)
+    goto cleanup;
+
+  if (ipmi_lan_check_packet_checksum (pkt, pkt_len) != 1)
+    goto cleanup;
+
+  if (FIID_OBJ_GET (obj_lan_session_hdr, "authentication_type", &authentication_type) < 0
+      || FIID_OBJ_GET (obj_lan_session_hdr, "session_id", &session_id) < 0
+      || FIID_OBJ_GET (obj_lan_msg_hdr_rq, "net_fn", &net_fn) < 0)
+    {
+      err_debug ("fiid_obj_get: %s", strerror (errno));
+      goto cleanup;
+    }
+
+  if ((rq_len = fiid_obj_get_data (obj_cmd_rq, "data", rq, IPMI_SIM_PKT_LEN)) <= 0)
+    goto cleanup;
+
+  if (!session_id)
+    {
+      if (authentication_type != IPMI_AUTHENTICATION_TYPE_NONE)
+        goto cleanup;
+
+      if (net_fn == IPMI_NET_FN_APP_RQ
+          && rq[0] == IPMI_CMD_GET_SESSION_CHALLENGE)
+        rs_len = _get_session_challenge (state_data,
+                                         bmc,
+                                         rq,
+                                         rq_len,
+                                         rs,
+                                         IPMI_SIM_PKT_LEN);
+      else
+        rs_len = ipmi_sim_cmd (state_data,
+                               bmc,
+                               NULL,
+                               net_fn,
+                               rq,
+                               rq_len,
+                               rs,
+                               IPMI_SIM_PKT_LEN);
+    }
+  else
+    {
+      if (!(session = ipmi_sim_session_find (state_data, bmc, session_id))
+          || session->ipmi_version != IPMI_SIM_IPMI_VERSION_1_5)
+        goto cleanup;
+
+      /* per message authentication is enabled, every message is
+       * authenticated like Activate Session
+       */
+      if (ipmi_lan_check_packet_session_authentication_code (pkt,
+                                                             pkt_len,
+                                                             session->authentication_type,
+                                                             state_data->password,
+                                                             IPMI_1_5_MAX_PASSWORD_LENGTH) != 1)
+        goto cleanup;
+
+      session->last_received = time (NULL);
+
+      if (net_fn == IPMI_NET_FN_APP_RQ
+          && rq[0] == IPMI_CMD_ACTIVATE_SESSION)
+        rs_len = _activate_session (state_data,
+                                    bmc,
+                                    session,
+                                    rq,
+                                    rq_len,
+                                    rs,
+                                    IPMI_SIM_PKT_LEN);
+      else if (session->activated)
+        rs_len = ipmi_sim_cmd (state_data,
+                               bmc,
+                               session,
+                               net_fn,
+                               rq,
+                               rq_len,
+                               rs,
+                               IPMI_SIM_PKT_LEN);
+      else
+        goto cleanup;
+
+      session_sequence_number = session->outbound_sequence_number++;
+    }
+
+  if (fill_rmcp_hdr_ipmi (obj_rmcp_hdr) < 0
+      || fill_lan_session_hdr (authentication_type,
+                               session_sequence_number,
+                               session_id,
+                               obj_lan_session_hdr) < 0)
+    {
+      err_debug ("fill: %s", strerror (errno));
+      goto cleanup;
+    }
+
+  if (ipmi_sim_lan_msg_hdr_rs (obj_lan_msg_hdr_rq, obj_lan_msg_hdr_rs) < 0)
+    goto cleanup;
+
+  if (fiid_obj_set_data (obj_cmd_rs, "data", rs, rs_len) < 0)
+    {
+      err_debug ("fiid_obj_set_data: 'data': %s", fiid_obj_errormsg (obj_cmd_rs));
+      goto cleanup;
+    }
+
+  if ((len = assemble_ipmi_lan_pkt (obj_rmcp_hdr,
+                                    obj_lan_session_hdr,
+                                    obj_lan_msg_hdr_rs,
+                                    obj_cmd_rs,
+                                    state_data->password,
+                                    IPMI_1_5_MAX_PASSWORD_LENGTH,
+                                    buf,
+                                    IPMI_SIM_PKT_LEN,
+                                    IPMI_INTERFACE_FLAGS_DEFAULT)) < 0)
+    {
+      err_debug ("assemble_ipmi_lan_pkt: %s", strerror (errno));
+      goto cleanup;
+    }
+
+  ipmi_sim_send (state_data, bmc, from, buf, len);
+
+ cleanup:
+  fiid_obj_destroy (obj_rmcp_hdr);
+  fiid_obj_destroy (obj_lan_session_hdr);
+  fiid_obj_destroy (obj_lan_msg_hdr_rq);
+  fiid_obj_destroy (obj_cmd_rq);
+  fiid_obj_destroy (obj_lan_msg_trlr);
+  fiid_obj_destroy (obj_lan_msg_hdr_rs);
+  fiid_obj_destroy (obj_cmd_rs);
+}
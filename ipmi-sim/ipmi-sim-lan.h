@@ -0,0 +1,49 @@
+/*
+ * Copyright (C) 2005-2015 FreeIPMI Core Team
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef IPMI_SIM_LAN_H
+#define IPMI_SIM_LAN_H
+
+#include "ipmi-sim.h"
+
+/* answers an RMCP ASF presence ping */
+void ipmi_sim_lan_ping (ipmi_sim_state_data_t *state_data,
+                        struct ipmi_sim_bmc *bmc,
+                        const struct sockaddr_in *from,
+                        const void *pkt,
+                        unsigned int pkt_len);
+
+/* answers an IPMI 1.5 LAN packet */
+void ipmi_sim_lan_process (ipmi_sim_state_data_t *state_data,
+                           struct ipmi_sim_bmc *bmc,
+                           const struct sockaddr_in *from,
+                           const void *pkt,
+                           unsigned int pkt_len);
+
+/* Fills the response message header obj_lan_msg_hdr_rs, a
+ * tmpl_lan_msg_hdr_rq object, from the request message header
+ * obj_lan_msg_hdr_rq as unassembled with tmpl_lan_msg_hdr_rs.  The
+ * templates are named from the remote console's perspective, so the
+ * fields carry over by name.
+ *
+ * Returns 0 on success, -1 on error.
+ */
+int ipmi_sim_lan_msg_hdr_rs (fiid_obj_t obj_lan_msg_hdr_rq,
+                             fiid_obj_t obj_lan_msg_hdr_rs);
+
+#endif /* IPMI_SIM_LAN_H */
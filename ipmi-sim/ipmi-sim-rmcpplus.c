@@ -0,0 +1,1154 @@
+/*
+ * Copyright (C) 2005-2015 FreeIPMI Core Team
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif /* HAVE_CONFIG_H */
+
+#include <stdio.h>
+#include <stdlib.h>
+#if STDC_HEADERS
+#include <string.h>
+#endif /* STDC_HEADERS */
+#include <assert.h>
+#include <errno.h>
+
+#ifdef WITH_ENCRYPTION
+#include <gcrypt.h>
+#endif /* WITH_ENCRYPTION */
+
+#include <freeipmi/freeipmi.h>
+
+#include "ipmi-sim.h"
+#include "ipmi-sim-cmds.h"
+#include "ipmi-sim-lan.h"
+#include "ipmi-sim-rmcpplus.h"
+
+#include "freeipmi-portability.h"
+#include "error.h"
+
+#ifdef WITH_ENCRYPTION
+
+#define IPMI_SIM_HMAC_LENGTH_MAX 64
+
+#define IPMI_SIM_RAKP_2_HMAC_DATA_LENGTH_MAX \
+  (4 + 4                                     \
+   + IPMI_REMOTE_CONSOLE_RANDOM_NUMBER_LENGTH \
+   + IPMI_MANAGED_SYSTEM_RANDOM_NUMBER_LENGTH \
+   + IPMI_MANAGED_SYSTEM_GUID_LENGTH          \
+   + 1 + 1                                   \
+   + IPMI_MAX_USER_NAME_LENGTH)
+
+#define IPMI_SIM_RAKP_4_HMAC_DATA_LENGTH \
+  (IPMI_REMOTE_CONSOLE_RANDOM_NUMBER_LENGTH  \
+   + 4                                       \
+   + IPMI_MANAGED_SYSTEM_GUID_LENGTH)
+
+/* The RAKP 2 key exchange authentication code and RAKP 4 integrity
+ * check value are only checked, not calculated, by libfreeipmi.
+ *
+ * Returns digest length, 0 for authentication algorithm none.
+ */
+static unsigned int
+_hmac (uint8_t authentication_algorithm,
+       const void *key,
+       unsigned int key_len,
+       const void *data,
+       unsigned int data_len,
+       uint8_t *digest,
+       unsigned int digest_len)
+{
+  gcry_md_hd_t h;
+  unsigned int len;
+  int algo;
+
+  assert (data);
+  assert (digest);
+
+  if (authentication_algorithm == IPMI_AUTHENTICATION_ALGORITHM_RAKP_HMAC_SHA1)
+    algo = GCRY_MD_SHA1;
+  else if (authentication_algorithm == IPMI_AUTHENTICATION_ALGORITHM_RAKP_HMAC_MD5)
+    algo = GCRY_MD_MD5;
+  else if (authentication_algorithm == IPMI_AUTHENTICATION_ALGORITHM_RAKP_HMAC_SHA256)
+    algo = GCRY_MD_SHA256;
+  else
+    return (0);
+
+  len = gcry_md_get_algo_dlen (algo);
+  assert (len <= digest_len);
+
+  if (gcry_md_open (&h, algo, GCRY_MD_FLAG_HMAC) != GPG_ERR_NO_ERROR)
+    err_exit ("gcry_md_open: failed");
+
+  /* an empty key is a valid (null) password */
+  if (key_len
+      && gcry_md_setkey (h, key, key_len) != GPG_ERR_NO_ERROR)
+    err_exit ("gcry_md_setkey: failed");
+
+  gcry_md_write (h, data, data_len);
+  memcpy (digest, gcry_md_read (h, algo), len);
+  gcry_md_close (h);
+  return (len);
+}
+
+/* Parses the session header of an inbound packet other than an OEM
+ * explicit one.  Returns the offset of the payload, -1 if malformed.
+ */
+static int
+_session_hdr_parse (const void *pkt,
+                    unsigned int pkt_len,
+                    fiid_obj_t obj_rmcpplus_session_hdr)
+{
+  int rmcp_hdr_len;
+  int payload_type_len = 0;
+  int session_hdr_len = 0;
+  unsigned int indx;
+
+  assert (pkt);
+  assert (fiid_obj_valid (obj_rmcpplus_session_hdr));
+
+  if ((rmcp_hdr_len = fiid_template_len_bytes (tmpl_rmcp_hdr)) < 0
+      || (payload_type_len = fiid_template_block_len_bytes (tmpl_rmcpplus_session_hdr,
+                                                            "authentication_type",
+                                                            "payload_type.encrypted")) < 0
+      || (session_hdr_len = fiid_template_block_len_bytes (tmpl_rmcpplus_session_hdr,
+                                                           "session_id",
+                                                           "ipmi_payload_len")) < 0)
+    err_exit ("fiid_template_len_bytes: %s", strerror (errno));
+
+  indx = rmcp_hdr_len;
+  if (pkt_len < indx + payload_type_len + session_hdr_len)
+    return (-1);
+
+  if (fiid_obj_set_block (obj_rmcpplus_session_hdr,
+                          "authentication_type",
+                          "payload_type.encrypted",
+                          (const uint8_t *)pkt + indx,
+                          payload_type_len) < 0)
+    {
+      err_debug ("fiid_obj_set_block: %s", fiid_obj_errormsg (obj_rmcpplus_session_hdr));
+      return (-1);
+    }
+  indx += payload_type_len;
+
+  if (fiid_obj_set_block (obj_rmcpplus_session_hdr,
+                          "session_id",
+                          "ipmi_payload_len",
+                          (const uint8_t *)pkt + indx,
+                          session_hdr_len) < 0)
+    {
+      err_debug ("fiid_obj_set_block: %s", fiid_obj_errormsg (obj_rmcpplus_session_hdr));
+      return (-1);
+    }
+  indx += session_hdr_len;
+
+  return (indx);
+}
+
+/* Session setup payloads are not assembled and unassembled by
+ * libfreeipmi on the managed system side.  Returns the payload of an
+ * inbound packet, -1 if malformed.
+ */
+static int
+_session_setup_payload (const void *pkt,
+                        unsigned int pkt_len,
+                        const void **payload,
+                        unsigned int *payload_len)
+{
+  fiid_obj_t obj_rmcpplus_session_hdr = NULL;
+  uint64_t ipmi_payload_len;
+  int indx;
+  int rv = -1;
+
+  assert (pkt);
+  assert (payload);
+  assert (payload_len);
+
+  if (!(obj_rmcpplus_session_hdr = fiid_obj_create (tmpl_rmcpplus_session_hdr)))
+    err_exit ("fiid_obj_create: %s", strerror (errno));
+
+  if ((indx = _session_hdr_parse (pkt, pkt_len, obj_rmcpplus_session_hdr)) < 0)
+    goto cleanup;
+
+  if (FIID_OBJ_GET (obj_rmcpplus_session_hdr, "ipmi_payload_len", &ipmi_payload_len) < 0)
+    {
+      err_debug ("fiid_obj_get: 'ipmi_payload_len': %s", fiid_obj_errormsg (obj_rmcpplus_session_hdr));
+      goto cleanup;
+    }
+
+  if (pkt_len - indx < ipmi_payload_len)
+    goto cleanup;
+
+  *payload = (const uint8_t *)pkt + indx;
+  *payload_len = ipmi_payload_len;
+  rv = 0;
+ cleanup:
+  fiid_obj_destroy (obj_rmcpplus_session_hdr);
+  return (rv);
+}
+
+static void
+_session_setup_send (ipmi_sim_state_data_t *state_data,
+                     struct ipmi_sim_bmc *bmc,
+                     const struct sockaddr_in *to,
+                     uint8_t payload_type,
+                     fiid_obj_t obj_payload)
+{
+  fiid_obj_t obj_rmcp_hdr = NULL;
+  fiid_obj_t obj_rmcpplus_session_hdr = NULL;
+  uint8_t payload[IPMI_SIM_PKT_LEN];
+  uint8_t buf[IPMI_SIM_PKT_LEN];
+  int payload_len, len;
+  unsigned int indx = 0;
+
+  assert (state_data);
+  assert (bmc);
+  assert (to);
+  assert (fiid_obj_valid (obj_payload));
+
+  if (!(obj_rmcp_hdr = fiid_obj_create (tmpl_rmcp_hdr)))
+    err_exit ("fiid_obj_create: %s", strerror (errno));
+  if (!(obj_rmcpplus_session_hdr = fiid_obj_create (tmpl_rmcpplus_session_hdr)))
+    err_exit ("fiid_obj_create: %s", strerror (errno));
+
+  if ((payload_len = fiid_obj_get_all (obj_payload, payload, IPMI_SIM_PKT_LEN)) < 0)
+    {
+      err_debug ("fiid_obj_get_all: %s", fiid_obj_errormsg (obj_payload));
+      goto cleanup;
+    }
+
+  if (fill_rmcp_hdr_ipmi (obj_rmcp_hdr) < 0
+      || fill_rmcpplus_session_hdr (payload_type,
+                                    IPMI_PAYLOAD_FLAG_UNAUTHENTICATED,
+                                    IPMI_PAYLOAD_FLAG_UNENCRYPTED,
+                                    0,
+                                    0,
+                                    0,
+                                    0,
+                                    obj_rmcpplus_session_hdr) < 0)
+    {
+      err_debug ("fill: %s", strerror (errno));
+      goto cleanup;
+    }
+
+  if (fiid_obj_set (obj_rmcpplus_session_hdr, "ipmi_payload_len", payload_len) < 0)
+    {
+      err_debug ("fiid_obj_set: 'ipmi_payload_len': %s", fiid_obj_errormsg (obj_rmcpplus_session_hdr));
+      goto cleanup;
+    }
+
+  if ((len = fiid_obj_get_all (obj_rmcp_hdr, buf, IPMI_SIM_PKT_LEN)) < 0)
+    {
+      err_debug ("fiid_obj_get_all: %s", fiid_obj_errormsg (obj_rmcp_hdr));
+      goto cleanup;
+    }
+  indx += len;
+
+  if ((len = fiid_obj_get_all (obj_rmcpplus_session_hdr,
+                               buf + indx,
+                               IPMI_SIM_PKT_LEN - indx)) < 0)
+    {
+      err_debug ("fiid_obj_get_all: %s", fiid_obj_errormsg (obj_rmcpplus_session_hdr));
+      goto cleanup;
+    }
+  indx += len;
+
+  if (IPMI_SIM_PKT_LEN - indx < payload_len)
+    goto cleanup;
+
+  memcpy (buf + indx, payload, payload_len);
+  indx += payload_len;
+
+  ipmi_sim_send (state_data, bmc, to, buf, indx);
+
+ cleanup:
+  fiid_obj_destroy (obj_rmcp_hdr);
+  fiid_obj_destroy (obj_rmcpplus_session_hdr);
+}
+
+static void
+_open_session (ipmi_sim_state_data_t *state_data,
+               struct ipmi_sim_bmc *bmc,
+               const struct sockaddr_in *from,
+               const void *payload,
+               unsigned int payload_len)
+{
+  fiid_obj_t obj_cmd_rq = NULL;
+  fiid_obj_t obj_cmd_rs = NULL;
+  struct ipmi_sim_session *session = NULL;
+  uint64_t message_tag, requested_maximum_privilege_level, remote_console_session_id;
+  uint64_t authentication_algorithm, integrity_algorithm, confidentiality_algorithm;
+  uint8_t rmcpplus_status_code = RMCPPLUS_STATUS_NO_ERRORS;
+
+  assert (state_data);
+  assert (bmc);
+  assert (from);
+  assert (payload);
+
+  if (!(obj_cmd_rq = fiid_obj_create (tmpl_rmcpplus_open_session_request)))
+    err_exit ("fiid_obj_create: %s", strerror (errno));
+  if (!(obj_cmd_rs = ipmi_sim_obj_create (tmpl_rmcpplus_open_session_response)))
+    err_exit ("fiid_obj_create: %s", strerror (errno));
+
+  if (fiid_obj_set_all (obj_cmd_rq, payload, payload_len) < 0
+      || fiid_obj_packet_valid (obj_cmd_rq) != 1)
+    goto cleanup;
+
+  if (FIID_OBJ_GET (obj_cmd_rq, "message_tag", &message_tag) < 0
+      || FIID_OBJ_GET (obj_cmd_rq,
+                       "requested_maximum_privilege_level",
+                       &requested_maximum_privilege_level) < 0
+      || FIID_OBJ_GET (obj_cmd_rq, "remote_console_session_id", &remote_console_session_id) < 0
+      || FIID_OBJ_GET (obj_cmd_rq,
+                       "authentication_payload.authentication_algorithm",
+                       &authentication_algorithm) < 0
+      || FIID_OBJ_GET (obj_cmd_rq,
+                       "integrity_payload.integrity_algorithm",
+                       &integrity_algorithm) < 0
+      || FIID_OBJ_GET (obj_cmd_rq,
+                       "confidentiality_payload.confidentiality_algorithm",
+                       &confidentiality_algorithm) < 0)
+    {
+      err_debug ("fiid_obj_get: %s", fiid_obj_errormsg (obj_cmd_rq));
+      goto cleanup;
+    }
+
+  /* 0h, highest level matching proposed algorithms */
+  if (requested_maximum_privilege_level == IPMI_PRIVILEGE_LEVEL_HIGHEST_LEVEL)
+    requested_maximum_privilege_level = IPMI_PRIVILEGE_LEVEL_ADMIN;
+
+  if (requested_maximum_privilege_level > IPMI_PRIVILEGE_LEVEL_ADMIN)
+    rmcpplus_status_code = RMCPPLUS_STATUS_UNAUTHORIZED_ROLE_OR_PRIVILEGE_LEVEL_REQUESTED;
+  else if (!IPMI_AUTHENTICATION_ALGORITHM_SUPPORTED (authentication_algorithm))
+    rmcpplus_status_code = RMCPPLUS_STATUS_INVALID_AUTHENTICATION_ALGORITHM;
+  else if (!IPMI_INTEGRITY_ALGORITHM_SUPPORTED (integrity_algorithm))
+    rmcpplus_status_code = RMCPPLUS_STATUS_INVALID_INTEGRITY_ALGORITHM;
+  else if (!IPMI_CONFIDENTIALITY_ALGORITHM_SUPPORTED (confidentiality_algorithm))
+    rmcpplus_status_code = RMCPPLUS_STATUS_NO_CIPHER_SUITE_MATCH_WITH_PROPOSED_SECURITY_ALGORITHMS;
+  else if (!(session = ipmi_sim_session_new (state_data, bmc, IPMI_SIM_IPMI_VERSION_2_0)))
+    rmcpplus_status_code = RMCPPLUS_STATUS_INSUFFICIENT_RESOURCES_TO_CREATE_A_SESSION;
+
+  if (fiid_obj_set (obj_cmd_rs, "message_tag", message_tag) < 0
+      || fiid_obj_set (obj_cmd_rs, "rmcpplus_status_code", rmcpplus_status_code) < 0
+      || fiid_obj_set (obj_cmd_rs, "remote_console_session_id", remote_console_session_id) < 0)
+    {
+      err_debug ("fiid_obj_set: %s", fiid_obj_errormsg (obj_cmd_rs));
+      goto cleanup;
+    }
+
+  if (session)
+    {
+      session->remote_console_session_id = remote_console_session_id;
+      session->maximum_privilege_level = requested_maximum_privilege_level;
+      session->authentication_algorithm = authentication_algorithm;
+      session->integrity_algorithm = integrity_algorithm;
+      session->confidentiality_algorithm = confidentiality_algorithm;
+
+      if (fiid_obj_set (obj_cmd_rs, "maximum_privilege_level", session->maximum_privilege_level) < 0
+          || fiid_obj_set (obj_cmd_rs, "managed_system_session_id", session->session_id) < 0
+          || fiid_obj_set (obj_cmd_rs,
+                           "authentication_payload.payload_type",
+                           IPMI_AUTHENTICATION_PAYLOAD_TYPE) < 0
+          || fiid_obj_set (obj_cmd_rs,
+                           "authentication_payload.payload_length",
+                           IPMI_AUTHENTICATION_PAYLOAD_LENGTH) < 0
+          || fiid_obj_set (obj_cmd_rs,
+                           "authentication_payload.authentication_algorithm",
+                           authentication_algorithm) < 0
+          || fiid_obj_set (obj_cmd_rs,
+                           "integrity_payload.payload_type",
+                           IPMI_INTEGRITY_PAYLOAD_TYPE) < 0
+          || fiid_obj_set (obj_cmd_rs,
+                           "integrity_payload.payload_length",
+                           IPMI_INTEGRITY_PAYLOAD_LENGTH) < 0
+          || fiid_obj_set (obj_cmd_rs,
+                           "integrity_payload.integrity_algorithm",
+                           integrity_algorithm) < 0
+          || fiid_obj_set (obj_cmd_rs,
+                           "confidentiality_payload.payload_type",
+                           IPMI_CONFIDENTIALITY_PAYLOAD_TYPE) < 0
+          || fiid_obj_set (obj_cmd_rs,
+                           "confidentiality_payload.payload_length",
+                           IPMI_CONFIDENTIALITY_PAYLOAD_LENGTH) < 0
+          || fiid_obj_set (obj_cmd_rs,
+                           "confidentiality_payload.confidentiality_algorithm",
+                           confidentiality_algorithm) < 0)
+        {
+          err_debug ("fiid_obj_set: %s", fiid_obj_errormsg (obj_cmd_rs));
+          ipmi_sim_session_close (state_data, bmc, session);
+          goto cleanup;
+        }
+    }
+
+  _session_setup_send (state_data,
+                       bmc,
+                       from,
+                       IPMI_PAYLOAD_TYPE_RMCPPLUS_OPEN_SESSION_RESPONSE,
+                       obj_cmd_rs);
+
+ cleanup:
+  fiid_obj_destroy (obj_cmd_rq);
+  fiid_obj_destroy (obj_cmd_rs);
+}
+
+static void
+_rakp_message_1 (ipmi_sim_state_data_t *state_data,
+                 struct ipmi_sim_bmc *bmc,
+                 const struct sockaddr_in *from,
+                 const void *payload,
+                 unsigned int payload_len)
+{
+  fiid_obj_t obj_cmd_rq = NULL;
+  fiid_obj_t obj_cmd_rs = NULL;
+  struct ipmi_sim_session *session;
+  uint64_t message_tag, managed_system_session_id;
+  uint64_t requested_maximum_privilege_level, name_only_lookup, user_name_length;
+  uint8_t rmcpplus_status_code = RMCPPLUS_STATUS_NO_ERRORS;
+  uint8_t hmac_data[IPMI_SIM_RAKP_2_HMAC_DATA_LENGTH_MAX];
+  uint8_t digest[IPMI_SIM_HMAC_LENGTH_MAX];
+  unsigned int hmac_data_len = 0;
+  unsigned int digest_len;
+  char *password;
+
+  assert (state_data);
+  assert (bmc);
+  assert (from);
+  assert (payload);
+
+  if (!(obj_cmd_rq = fiid_obj_create (tmpl_rmcpplus_rakp_message_1)))
+    err_exit ("fiid_obj_create: %s", strerror (errno));
+  if (!(obj_cmd_rs = ipmi_sim_obj_create (tmpl_rmcpplus_rakp_message_2)))
+    err_exit ("fiid_obj_create: %s", strerror (errno));
+
+  if (fiid_obj_set_all (obj_cmd_rq, payload, payload_len) < 0
+      || fiid_obj_packet_valid (obj_cmd_rq) != 1)
+    goto cleanup;
+
+  if (FIID_OBJ_GET (obj_cmd_rq, "message_tag", &message_tag) < 0
+      || FIID_OBJ_GET (obj_cmd_rq, "managed_system_session_id", &managed_system_session_id) < 0
+      || FIID_OBJ_GET (obj_cmd_rq,
+                       "requested_maximum_privilege_level",
+                       &requested_maximum_privilege_level) < 0
+      || FIID_OBJ_GET (obj_cmd_rq, "name_only_lookup", &name_only_lookup) < 0
+      || FIID_OBJ_GET (obj_cmd_rq, "user_name_length", &user_name_length) < 0)
+    {
+      err_debug ("fiid_obj_get: %s", fiid_obj_errormsg (obj_cmd_rq));
+      goto cleanup;
+    }
+
+  if (!(session = ipmi_sim_session_find (state_data, bmc, managed_system_session_id))
+      || session->ipmi_version != IPMI_SIM_IPMI_VERSION_2_0
+      || session->activated)
+    goto cleanup;
+
+  session->last_received = time (NULL);
+
+  if (fiid_obj_get_data (obj_cmd_rq,
+                         "remote_console_random_number",
+                         session->remote_console_random_number,
+                         IPMI_REMOTE_CONSOLE_RANDOM_NUMBER_LENGTH) != IPMI_REMOTE_CONSOLE_RANDOM_NUMBER_LENGTH)
+    {
+      err_debug ("fiid_obj_get_data: %s", fiid_obj_errormsg (obj_cmd_rq));
+      goto cleanup;
+    }
+
+  memset (session->username, '\0', IPMI_MAX_USER_NAME_LENGTH + 1);
+  session->username_len = 0;
+  if (user_name_length > IPMI_MAX_USER_NAME_LENGTH)
+    rmcpplus_status_code = RMCPPLUS_STATUS_INVALID_NAME_LENGTH;
+  else if (user_name_length
+           && fiid_obj_get_data (obj_cmd_rq,
+                                 "user_name",
+                                 session->username,
+                                 IPMI_MAX_USER_NAME_LENGTH) != user_name_length)
+    rmcpplus_status_code = RMCPPLUS_STATUS_INVALID_NAME_LENGTH;
+  else
+    {
+      session->username_len = user_name_length;
+      if (strcmp (session->username, state_data->prog_data->args->username))
+        rmcpplus_status_code = RMCPPLUS_STATUS_UNAUTHORIZED_NAME;
+      else if (requested_maximum_privilege_level < IPMI_PRIVILEGE_LEVEL_CALLBACK
+               || requested_maximum_privilege_level > session->maximum_privilege_level)
+        rmcpplus_status_code = RMCPPLUS_STATUS_UNAUTHORIZED_ROLE_OR_PRIVILEGE_LEVEL_REQUESTED;
+    }
+
+  if (fiid_obj_set (obj_cmd_rs, "message_tag", message_tag) < 0
+      || fiid_obj_set (obj_cmd_rs, "rmcpplus_status_code", rmcpplus_status_code) < 0
+      || fiid_obj_set (obj_cmd_rs,
+                       "remote_console_session_id",
+                       session->remote_console_session_id) < 0)
+    {
+      err_debug ("fiid_obj_set: %s", fiid_obj_errormsg (obj_cmd_rs));
+      goto cleanup;
+    }
+
+  if (rmcpplus_status_code != RMCPPLUS_STATUS_NO_ERRORS)
+    {
+      _session_setup_send (state_data,
+                           bmc,
+                           from,
+                           IPMI_PAYLOAD_TYPE_RAKP_MESSAGE_2,
+                           obj_cmd_rs);
+      ipmi_sim_session_close (state_data, bmc, session);
+      goto cleanup;
+    }
+
+  session->name_only_lookup = name_only_lookup;
+  session->maximum_privilege_level = requested_maximum_privilege_level;
+
+  if (ipmi_get_random (session->managed_system_random_number,
+                       IPMI_MANAGED_SYSTEM_RANDOM_NUMBER_LENGTH) < 0)
+    err_exit ("ipmi_get_random: %s", strerror (errno));
+
+  /* SIDm, SIDc, Rm, Rc, GUIDc, ROLEm, ULENGTHm, UNAMEm; SIDm is the
+   * remote console's and Rm its random number
+   */
+  memcpy (hmac_data + hmac_data_len, &session->remote_console_session_id, 4);
+  hmac_data_len += 4;
+  memcpy (hmac_data + hmac_data_len, &session->session_id, 4);
+  hmac_data_len += 4;
+  memcpy (hmac_data + hmac_data_len,
+          session->remote_console_random_number,
+          IPMI_REMOTE_CONSOLE_RANDOM_NUMBER_LENGTH);
+  hmac_data_len += IPMI_REMOTE_CONSOLE_RANDOM_NUMBER_LENGTH;
+  memcpy (hmac_data + hmac_data_len,
+          session->managed_system_random_number,
+          IPMI_MANAGED_SYSTEM_RANDOM_NUMBER_LENGTH);
+  hmac_data_len += IPMI_MANAGED_SYSTEM_RANDOM_NUMBER_LENGTH;
+  memcpy (hmac_data + hmac_data_len, bmc->guid, IPMI_MANAGED_SYSTEM_GUID_LENGTH);
+  hmac_data_len += IPMI_MANAGED_SYSTEM_GUID_LENGTH;
+  hmac_data[hmac_data_len++] = (name_only_lookup << 4) | requested_maximum_privilege_level;
+  hmac_data[hmac_data_len++] = session->username_len;
+  memcpy (hmac_data + hmac_data_len, session->username, session->username_len);
+  hmac_data_len += session->username_len;
+
+  password = state_data->prog_data->args->password;
+  digest_len = _hmac (session->authentication_algorithm,
+                      password,
+                      strlen (password),
+                      hmac_data,
+                      hmac_data_len,
+                      digest,
+                      IPMI_SIM_HMAC_LENGTH_MAX);
+
+  if (fiid_obj_set_data (obj_cmd_rs,
+                         "managed_system_random_number",
+                         session->managed_system_random_number,
+                         IPMI_MANAGED_SYSTEM_RANDOM_NUMBER_LENGTH) < 0
+      || fiid_obj_set_data (obj_cmd_rs,
+                            "managed_system_guid",
+                            bmc->guid,
+                            IPMI_MANAGED_SYSTEM_GUID_LENGTH) < 0
+      || (digest_len
+          && fiid_obj_set_data (obj_cmd_rs,
+                                "key_exchange_authentication_code",
+                                digest,
+                                digest_len) < 0))
+    {
+      err_debug ("fiid_obj_set_data: %s", fiid_obj_errormsg (obj_cmd_rs));
+      goto cleanup;
+    }
+
+  _session_setup_send (state_data,
+                       bmc,
+                       from,
+                       IPMI_PAYLOAD_TYPE_RAKP_MESSAGE_2,
+                       obj_cmd_rs);
+
+ cleanup:
+  fiid_obj_destroy (obj_cmd_rq);
+  fiid_obj_destroy (obj_cmd_rs);
+}
+
+static void
+_rakp_message_3 (ipmi_sim_state_data_t *state_data,
+                 struct ipmi_sim_bmc *bmc,
+                 const struct sockaddr_in *from,
+                 const void *payload,
+                 unsigned int payload_len)
+{
+  fiid_obj_t obj_cmd_rq = NULL;
+  fiid_obj_t obj_cmd_rs = NULL;
+  struct ipmi_sim_session *session;
+  uint64_t message_tag, rmcpplus_status_code, managed_system_session_id;
+  uint8_t key_exchange_authentication_code[IPMI_SIM_HMAC_LENGTH_MAX];
+  uint8_t expected[IPMI_SIM_HMAC_LENGTH_MAX];
+  uint8_t hmac_data[IPMI_SIM_RAKP_4_HMAC_DATA_LENGTH];
+  uint8_t digest[IPMI_SIM_HMAC_LENGTH_MAX];
+  unsigned int digest_len, hmac_data_len = 0;
+  int key_exchange_authentication_code_len, expected_len;
+  char *password;
+
+  assert (state_data);
+  assert (bmc);
+  assert (from);
+  assert (payload);
+
+  if (!(obj_cmd_rq = fiid_obj_create (tmpl_rmcpplus_rakp_message_3)))
+    err_exit ("fiid_obj_create: %s", strerror (errno));
+  if (!(obj_cmd_rs = ipmi_sim_obj_create (tmpl_rmcpplus_rakp_message_4)))
+    err_exit ("fiid_obj_create: %s", strerror (errno));
+
+  if (fiid_obj_set_all (obj_cmd_rq, payload, payload_len) < 0
+      || fiid_obj_packet_valid (obj_cmd_rq) != 1)
+    goto cleanup;
+
+  if (FIID_OBJ_GET (obj_cmd_rq, "message_tag", &message_tag) < 0
+      || FIID_OBJ_GET (obj_cmd_rq, "rmcpplus_status_code", &rmcpplus_status_code) < 0
+      || FIID_OBJ_GET (obj_cmd_rq, "managed_system_session_id", &managed_system_session_id) < 0
+      || (key_exchange_authentication_code_len = fiid_obj_get_data (obj_cmd_rq,
+                                                                    "key_exchange_authentication_code",
+                                                                    key_exchange_authentication_code,
+                                                                    IPMI_SIM_HMAC_LENGTH_MAX)) < 0)
+    {
+      err_debug ("fiid_obj_get: %s", fiid_obj_errormsg (obj_cmd_rq));
+      goto cleanup;
+    }
+
+  if (!(session = ipmi_sim_session_find (state_data, bmc, managed_system_session_id))
+      || session->ipmi_version != IPMI_SIM_IPMI_VERSION_2_0
+      || session->activated)
+    goto cleanup;
+
+  /* remote console gave up on the session */
+  if (rmcpplus_status_code != RMCPPLUS_STATUS_NO_ERRORS)
+    {
+      ipmi_sim_session_close (state_data, bmc, session);
+      goto cleanup;
+    }
+
+  password = state_data->prog_data->args->password;
+
+  if ((expected_len = ipmi_calculate_rakp_3_key_exchange_authentication_code (session->authentication_algorithm,
+                                                                              password,
+                                                                              strlen (password),
+                                                                              session->managed_system_random_number,
+                                                                              IPMI_MANAGED_SYSTEM_RANDOM_NUMBER_LENGTH,
+                                                                              session->remote_console_session_id,
+                                                                              session->name_only_lookup,
+                                                                              session->maximum_privilege_level,
+                                                                              session->username,
+                                                                              session->username_len,
+                                                                              expected,
+                                                                              IPMI_SIM_HMAC_LENGTH_MAX)) < 0)
+    {
+      err_debug ("ipmi_calculate_rakp_3_key_exchange_authentication_code: %s", strerror (errno));
+      goto cleanup;
+    }
+
+  if (fiid_obj_set (obj_cmd_rs, "message_tag", message_tag) < 0
+      || fiid_obj_set (obj_cmd_rs,
+                       "remote_console_session_id",
+                       session->remote_console_session_id) < 0)
+    {
+      err_debug ("fiid_obj_set: %s", fiid_obj_errormsg (obj_cmd_rs));
+      goto cleanup;
+    }
+
+  if (key_exchange_authentication_code_len != expected_len
+      || memcmp (key_exchange_authentication_code, expected, expected_len))
+    {
+      if (fiid_obj_set (obj_cmd_rs,
+                        "rmcpplus_status_code",
+                        RMCPPLUS_STATUS_INVALID_INTEGRITY_CHECK_VALUE) < 0)
+        {
+          err_debug ("fiid_obj_set: %s", fiid_obj_errormsg (obj_cmd_rs));
+          goto cleanup;
+        }
+      _session_setup_send (state_data,
+                           bmc,
+                           from,
+                           IPMI_PAYLOAD_TYPE_RAKP_MESSAGE_4,
+                           obj_cmd_rs);
+      ipmi_sim_session_close (state_data, bmc, session);
+      goto cleanup;
+    }
+
+  session->sik_ptr = session->sik;
+  session->sik_len = IPMI_MAX_SIK_KEY_LENGTH;
+  session->k1_ptr = session->k1;
+  session->k1_len = IPMI_MAX_INTEGRITY_KEY_LENGTH;
+  session->k2_ptr = session->k2;
+  session->k2_len = IPMI_MAX_CONFIDENTIALITY_KEY_LENGTH;
+
+  if (ipmi_calculate_rmcpplus_session_keys (session->authentication_algorithm,
+                                            session->integrity_algorithm,
+                                            session->confidentiality_algorithm,
+                                            password,
+                                            strlen (password),
+                                            NULL,
+                                            0,
+                                            session->remote_console_random_number,
+                                            IPMI_REMOTE_CONSOLE_RANDOM_NUMBER_LENGTH,
+                                            session->managed_system_random_number,
+                                            IPMI_MANAGED_SYSTEM_RANDOM_NUMBER_LENGTH,
+                                            session->name_only_lookup,
+                                            session->maximum_privilege_level,
+                                            session->username,
+                                            session->username_len,
+                                            &session->sik_ptr,
+                                            &session->sik_len,
+                                            &session->k1_ptr,
+                                            &session->k1_len,
+                                            &session->k2_ptr,
+                                            &session->k2_len) < 0)
+    {
+      err_debug ("ipmi_calculate_rmcpplus_session_keys: %s", strerror (errno));
+      ipmi_sim_session_close (state_data, bmc, session);
+      goto cleanup;
+    }
+
+  /* Rm, SIDc, GUIDc */
+  memcpy (hmac_data + hmac_data_len,
+          session->remote_console_random_number,
+          IPMI_REMOTE_CONSOLE_RANDOM_NUMBER_LENGTH);
+  hmac_data_len += IPMI_REMOTE_CONSOLE_RANDOM_NUMBER_LENGTH;
+  memcpy (hmac_data + hmac_data_len, &session->session_id, 4);
+  hmac_data_len += 4;
+  memcpy (hmac_data + hmac_data_len, bmc->guid, IPMI_MANAGED_SYSTEM_GUID_LENGTH);
+  hmac_data_len += IPMI_MANAGED_SYSTEM_GUID_LENGTH;
+
+  digest_len = _hmac (session->authentication_algorithm,
+                      session->sik_ptr,
+                      session->sik_len,
+                      hmac_data,
+                      hmac_data_len,
+                      digest,
+                      IPMI_SIM_HMAC_LENGTH_MAX);
+
+  /* integrity check values are truncated */
+  if (session->authentication_algorithm == IPMI_AUTHENTICATION_ALGORITHM_RAKP_HMAC_SHA1)
+    digest_len = IPMI_HMAC_SHA1_96_DIGEST_LENGTH;
+  else if (session->authentication_algorithm == IPMI_AUTHENTICATION_ALGORITHM_RAKP_HMAC_SHA256)
+    digest_len = IPMI_HMAC_SHA256_128_AUTHENTICATION_CODE_LENGTH;
+
+  if (fiid_obj_set (obj_cmd_rs, "rmcpplus_status_code", RMCPPLUS_STATUS_NO_ERRORS) < 0
+      || (digest_len
+          && fiid_obj_set_data (obj_cmd_rs, "integrity_check_value", digest, digest_len) < 0))
+    {
+      err_debug ("fiid_obj_set: %s", fiid_obj_errormsg (obj_cmd_rs));
+      ipmi_sim_session_close (state_data, bmc, session);
+      goto cleanup;
+    }
+
+  /* sessions start at user level, or below if so limited */
+  if (session->maximum_privilege_level < IPMI_PRIVILEGE_LEVEL_USER)
+    session->privilege_level = session->maximum_privilege_level;
+  else
+    session->privilege_level = IPMI_PRIVILEGE_LEVEL_USER;
+  session->outbound_sequence_number = 1;
+  session->activated = 1;
+  session->last_received = time (NULL);
+
+  _session_setup_send (state_data,
+                       bmc,
+                       from,
+                       IPMI_PAYLOAD_TYPE_RAKP_MESSAGE_4,
+                       obj_cmd_rs);
+
+ cleanup:
+  fiid_obj_destroy (obj_cmd_rq);
+  fiid_obj_destroy (obj_cmd_rs);
+}
+
+static void
+_session_send (ipmi_sim_state_data_t *state_data,
+               struct ipmi_sim_bmc *bmc,
+               struct ipmi_sim_session *session,
+               const struct sockaddr_in *to,
+               uint8_t payload_type,
+               fiid_obj_t obj_lan_msg_hdr,
+               fiid_obj_t obj_cmd)
+{
+  fiid_obj_t obj_rmcp_hdr = NULL;
+  fiid_obj_t obj_rmcpplus_session_hdr = NULL;
+  fiid_obj_t obj_rmcpplus_session_trlr = NULL;
+  uint8_t buf[IPMI_SIM_PKT_LEN];
+  char *password;
+  int len;
+
+  assert (state_data);
+  assert (bmc);
+  assert (session);
+  assert (to);
+  assert (fiid_obj_valid (obj_cmd));
+
+  if (!(obj_rmcp_hdr = fiid_obj_create (tmpl_rmcp_hdr)))
+    err_exit ("fiid_obj_create: %s", strerror (errno));
+  if (!(obj_rmcpplus_session_hdr = fiid_obj_create (tmpl_rmcpplus_session_hdr)))
+    err_exit ("fiid_obj_create: %s", strerror (errno));
+  if (!(obj_rmcpplus_session_trlr = fiid_obj_create (tmpl_rmcpplus_session_trlr)))
+    err_exit ("fiid_obj_create: %s", strerror (errno));
+
+  if (fill_rmcp_hdr_ipmi (obj_rmcp_hdr) < 0
+      || fill_rmcpplus_session_hdr (payload_type,
+                                    session->integrity_algorithm != IPMI_INTEGRITY_ALGORITHM_NONE
+                                    ? IPMI_PAYLOAD_FLAG_AUTHENTICATED : IPMI_PAYLOAD_FLAG_UNAUTHENTICATED,
+                                    session->confidentiality_algorithm != IPMI_CONFIDENTIALITY_ALGORITHM_NONE
+                                    ? IPMI_PAYLOAD_FLAG_ENCRYPTED : IPMI_PAYLOAD_FLAG_UNENCRYPTED,
+                                    0,
+                                    0,
+                                    session->remote_console_session_id,
+                                    session->outbound_sequence_number,
+                                    obj_rmcpplus_session_hdr) < 0
+      || fill_rmcpplus_session_trlr (obj_rmcpplus_session_trlr) < 0)
+    {
+      err_debug ("fill: %s", strerror (errno));
+      goto cleanup;
+    }
+
+  password = state_data->prog_data->args->password;
+
+  if ((len = assemble_ipmi_rmcpplus_pkt (session->authentication_algorithm,
+                                         session->integrity_algorithm,
+                                         session->confidentiality_algorithm,
+                                         session->k1_ptr,
+                                         session->k1_len,
+                                         session->k2_ptr,
+                                         session->k2_len,
+                                         password,
+                                         strlen (password),
+                                         obj_rmcp_hdr,
+                                         obj_rmcpplus_session_hdr,
+                                         obj_lan_msg_hdr,
+                                         obj_cmd,
+                                         obj_rmcpplus_session_trlr,
+                                         buf,
+                                         IPMI_SIM_PKT_LEN,
+                                         IPMI_INTERFACE_FLAGS_DEFAULT)) < 0)
+    {
+      err_debug ("assemble_ipmi_rmcpplus_pkt: %s", strerror (errno));
+      goto cleanup;
+    }
+
+  session->outbound_sequence_number++;
+  ipmi_sim_send (state_data, bmc, to, buf, len);
+
+ cleanup:
+  fiid_obj_destroy (obj_rmcp_hdr);
+  fiid_obj_destroy (obj_rmcpplus_session_hdr);
+  fiid_obj_destroy (obj_rmcpplus_session_trlr);
+}
+
+static void
+_ipmi_payload (ipmi_sim_state_data_t *state_data,
+               struct ipmi_sim_bmc *bmc,
+               struct ipmi_sim_session *session,
+               const struct sockaddr_in *from,
+               fiid_obj_t obj_lan_msg_hdr_rq,
+               fiid_obj_t obj_cmd_rq)
+{
+  fiid_obj_t obj_lan_msg_hdr_rs = NULL;
+  fiid_obj_t obj_cmd_rs = NULL;
+  uint8_t rq[IPMI_SIM_PKT_LEN];
+  uint8_t rs[IPMI_SIM_PKT_LEN];
+  uint64_t net_fn;
+  unsigned int rs_len;
+  int rq_len;
+
+  assert (state_data);
+  assert (bmc);
+  assert (session);
+  assert (from);
+  assert (fiid_obj_valid (obj_lan_msg_hdr_rq));
+  assert (fiid_obj_valid (obj_cmd_rq));
+
+  if (!(obj_lan_msg_hdr_rs = fiid_obj_create (tmpl_lan_msg_hdr_rq)))
+    err_exit ("fiid_obj_create: %s", strerror (errno));
+  if (!(obj_cmd_rs = fiid_obj_create (tmpl_ipmi_sim_cmd)))
+    err_exit ("fiid_obj_create: %s", strerror (errno));
+
+  if (FIID_OBJ_GET (obj_lan_msg_hdr_rq, "net_fn", &net_fn) < 0)
+    {
+      err_debug ("fiid_obj_get: 'net_fn': %s", fiid_obj_errormsg (obj_lan_msg_hdr_rq));
+      goto cleanup;
+    }
+
+  if ((rq_len = fiid_obj_get_data (obj_cmd_rq, "data", rq, IPMI_SIM_PKT_LEN)) <= 0)
+    goto cleanup;
+
+  rs_len = ipmi_sim_cmd (state_data,
+                         bmc,
+                         session,
+                         net_fn,
+                         rq,
+                         rq_len,
+                         rs,
+                         IPMI_SIM_PKT_LEN);
+
+  if (ipmi_sim_lan_msg_hdr_rs (obj_lan_msg_hdr_rq, obj_lan_msg_hdr_rs) < 0)
+    goto cleanup;
+
+  if (fiid_obj_set_data (obj_cmd_rs, "data", rs, rs_len) < 0)
+    {
+      err_debug ("fiid_obj_set_data: 'data': %s", fiid_obj_errormsg (obj_cmd_rs));
+      goto cleanup;
+    }
+
+  _session_send (state_data,
+                 bmc,
+                 session,
+                 from,
+                 IPMI_PAYLOAD_TYPE_IPMI,
+                 obj_lan_msg_hdr_rs,
+                 obj_cmd_rs);
+
+ cleanup:
+  fiid_obj_destroy (obj_lan_msg_hdr_rs);
+  fiid_obj_destroy (obj_cmd_rs);
+}
+
+/* Characters are echoed back in the packet acking them.  A
+ * retransmitted packet is acked again but not echoed twice.  Packets
+ * of ours the remote console does not ack are not retransmitted.
+ */
+static void
+_sol_payload (ipmi_sim_state_data_t *state_data,
+              struct ipmi_sim_bmc *bmc,
+              struct ipmi_sim_session *session,
+              const struct sockaddr_in *from,
+              fiid_obj_t obj_sol_payload_rq)
+{
+  fiid_obj_t obj_sol_payload_rs = NULL;
+  uint8_t character_data[IPMI_SIM_PKT_LEN];
+  uint64_t packet_sequence_number;
+  uint8_t sol_packet_sequence_number = 0;
+  int character_data_len;
+  const void *echo_data = NULL;
+  unsigned int echo_data_len = 0;
+
+  assert (state_data);
+  assert (bmc);
+  assert (session);
+  assert (from);
+  assert (fiid_obj_valid (obj_sol_payload_rq));
+
+  if (!session->sol_activated)
+    return;
+
+  if (!(obj_sol_payload_rs = fiid_obj_create (tmpl_sol_payload_data)))
+    err_exit ("fiid_obj_create: %s", strerror (errno));
+
+  if (FIID_OBJ_GET (obj_sol_payload_rq, "packet_sequence_number", &packet_sequence_number) < 0
+      || (character_data_len = fiid_obj_get_data (obj_sol_payload_rq,
+                                                  "character_data",
+                                                  character_data,
+                                                  IPMI_SIM_PKT_LEN)) < 0)
+    {
+      err_debug ("fiid_obj_get: %s", fiid_obj_errormsg (obj_sol_payload_rq));
+      goto cleanup;
+    }
+
+  /* 0h, an ack only packet needs no answer */
+  if (!packet_sequence_number)
+    goto cleanup;
+
+  if (packet_sequence_number != session->sol_last_packet_sequence_number
+      && character_data_len)
+    {
+      session->sol_packet_sequence_number++;
+      if (session->sol_packet_sequence_number > IPMI_SOL_PACKET_SEQUENCE_NUMBER_MAX)
+        session->sol_packet_sequence_number = 1;
+      sol_packet_sequence_number = session->sol_packet_sequence_number;
+      echo_data = character_data;
+      echo_data_len = character_data_len;
+    }
+  session->sol_last_packet_sequence_number = packet_sequence_number;
+
+  if (fill_sol_payload_data (sol_packet_sequence_number,
+                             packet_sequence_number,
+                             character_data_len,
+                             0,
+                             echo_data,
+                             echo_data_len,
+                             obj_sol_payload_rs) < 0)
+    {
+      err_debug ("fill_sol_payload_data: %s", strerror (errno));
+      goto cleanup;
+    }
+
+  _session_send (state_data,
+                 bmc,
+                 session,
+                 from,
+                 IPMI_PAYLOAD_TYPE_SOL,
+                 NULL,
+                 obj_sol_payload_rs);
+
+ cleanup:
+  fiid_obj_destroy (obj_sol_payload_rs);
+}
+
+static void
+_session_payload (ipmi_sim_state_data_t *state_data,
+                  struct ipmi_sim_bmc *bmc,
+                  const struct sockaddr_in *from,
+                  uint8_t payload_type,
+                  const void *pkt,
+                  unsigned int pkt_len)
+{
+  fiid_obj_t obj_rmcp_hdr = NULL;
+  fiid_obj_t obj_rmcpplus_session_hdr = NULL;
+  fiid_obj_t obj_rmcpplus_payload = NULL;
+  fiid_obj_t obj_lan_msg_hdr_rq = NULL;
+  fiid_obj_t obj_cmd_rq = NULL;
+  fiid_obj_t obj_lan_msg_trlr = NULL;
+  fiid_obj_t obj_rmcpplus_session_trlr = NULL;
+  struct ipmi_sim_session *session;
+  uint64_t session_id;
+  char *password;
+
+  assert (state_data);
+  assert (bmc);
+  assert (from);
+  assert (pkt);
+
+  if (!(obj_rmcp_hdr = fiid_obj_create (tmpl_rmcp_hdr)))
+    err_exit ("fiid_obj_create: %s", strerror (errno));
+  if (!(obj_rmcpplus_session_hdr = fiid_obj_create (tmpl_rmcpplus_session_hdr)))
+    err_exit ("fiid_obj_create: %s", strerror (errno));
+  if (!(obj_rmcpplus_payload = fiid_obj_create (tmpl_rmcpplus_payload)))
+    err_exit ("fiid_obj_create: %s", strerror (errno));
+  if (!(obj_lan_msg_hdr_rq = fiid_obj_create (tmpl_lan_msg_hdr_rs)))
+    err_exit ("fiid_obj_create: %s", strerror (errno));
+  if (!(obj_cmd_rq = fiid_obj_create (payload_type == IPMI_PAYLOAD_TYPE_IPMI
+                                      ? tmpl_ipmi_sim_cmd : tmpl_sol_payload_data)))
+    err_exit ("fiid_obj_create: %s", strerror (errno));
+  if (!(obj_lan_msg_trlr = fiid_obj_create (tmpl_lan_msg_trlr)))
+    err_exit ("fiid_obj_create: %s", strerror (errno));
+  if (!(obj_rmcpplus_session_trlr = fiid_obj_create (tmpl_rmcpplus_session_trlr)))
+    err_exit ("fiid_obj_create: %s", strerror (errno));
+
+  /* the session id is in the clear, it selects the keys */
+  if (_session_hdr_parse (pkt, pkt_len, obj_rmcpplus_session_hdr) < 0)
+    goto cleanup;
+
+  if (FIID_OBJ_GET (obj_rmcpplus_session_hdr, "session_id", &session_id) < 0)
+    {
+      err_debug ("fiid_obj_get: 'session_id': %s", fiid_obj_errormsg (obj_rmcpplus_session_hdr));
+      goto cleanup;
+    }
+
+  if (!(session = ipmi_sim_session_find (state_data, bmc, session_id))
+      || session->ipmi_version != IPMI_SIM_IPMI_VERSION_2_0
+      || !session->activated)
+    goto cleanup;
+
+  if (unassemble_ipmi_rmcpplus_pkt (session->authentication_algorithm,
+                                    session->integrity_algorithm,
+                                    session->confidentiality_algorithm,
+                                    session->k1_ptr,
+                                    session->k1_len,
+                                    session->k2_ptr,
+                                    session->k2_len,
+                                    pkt,
+                                    pkt_len,
+                                    obj_rmcp_hdr,
+                                    obj_rmcpplus_session_hdr,
+                                    obj_rmcpplus_payload,
+                                    obj_lan_msg_hdr_rq,
+                                    obj_cmd_rq,
+                                    obj_lan_msg_trlr,
+                                    obj_rmcpplus_session_trlr,
+                                    IPMI_INTERFACE_FLAGS_NO_LEGAL_CHECK) != 1)
+    goto cleanup;
+
+  password = state_data->prog_data->args->password;
+
+  if (session->integrity_algorithm != IPMI_INTEGRITY_ALGORITHM_NONE
+      && ipmi_rmcpplus_check_packet_session_authentication_code (session->integrity_algorithm,
+                                                                 pkt,
+                                                                 pkt_len,
+                                                                 session->k1_ptr,
+                                                                 session->k1_len,
+                                                                 password,
+                                                                 strlen (password),
+                                                                 obj_rmcpplus_session_trlr) != 1)
+    goto cleanup;
+
+  session->last_received = time (NULL);
+
+  if (payload_type == IPMI_PAYLOAD_TYPE_IPMI)
+    _ipmi_payload (state_data,
+                   bmc,
+                   session,
+                   from,
+                   obj_lan_msg_hdr_rq,
+                   obj_cmd_rq);
+  else
+    _sol_payload (state_data,
+                  bmc,
+                  session,
+                  from,
+                  obj_cmd_rq);
+
+ cleanup:
+  fiid_obj_destroy (obj_rmcp_hdr);
+  fiid_obj_destroy (obj_rmcpplus_session_hdr);
+  fiid_obj_destroy (obj_rmcpplus_payload);
+  fiid_obj_destroy (obj_lan_msg_hdr_rq);
+  fiid_obj_destroy (obj_cmd_rq);
+  fiid_obj_destroy (obj_lan_msg_trlr);
+  fiid_obj_destroy (obj_rmcpplus_session_trlr);
+}
+
+#endif /* WITH_ENCRYPTION */
+
+void
+ipmi_sim_rmcpplus_process (ipmi_sim_state_data_t *state_data,
+                           struct ipmi_sim_bmc *bmc,
+                           const struct sockaddr_in *from,
+                           const void *pkt,
+                           unsigned int pkt_len)
+{
+#ifdef WITH_ENCRYPTION
+  const void *payload;
+  unsigned int payload_len;
+  uint8_t payload_type;
+
+  assert (state_data);
+  assert (bmc);
+  assert (from);
+  assert (pkt);
+
+  if (ipmi_rmcpplus_calculate_payload_type (pkt, pkt_len, &payload_type) < 0)
+    return;
+
+  switch (payload_type)
+    {
+    case IPMI_PAYLOAD_TYPE_RMCPPLUS_OPEN_SESSION_REQUEST:
+    case IPMI_PAYLOAD_TYPE_RAKP_MESSAGE_1:
+    case IPMI_PAYLOAD_TYPE_RAKP_MESSAGE_3:
+      if (_session_setup_payload (pkt, pkt_len, &payload, &payload_len) < 0)
+        return;
+      if (payload_type == IPMI_PAYLOAD_TYPE_RMCPPLUS_OPEN_SESSION_REQUEST)
+        _open_session (state_data, bmc, from, payload, payload_len);
+      else if (payload_type == IPMI_PAYLOAD_TYPE_RAKP_MESSAGE_1)
+        _rakp_message_1 (state_data, bmc, from, payload, payload_len);
+      else
+        _rakp_message_3 (state_data, bmc, from, payload, payload_len);
+      break;
+    case IPMI_PAYLOAD_TYPE_IPMI:
+    case IPMI_PAYLOAD_TYPE_SOL:
+      _session_payload (state_data, bmc, from, payload_type, pkt, pkt_len);
+      break;
+    default:
+      break;
+    }
+#endif /* WITH_ENCRYPTION */
+}
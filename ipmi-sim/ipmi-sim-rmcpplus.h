@@ -0,0 +1,33 @@
+/*
+ * Copyright (C) 2005-2015 FreeIPMI Core Team
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef IPMI_SIM_RMCPPLUS_H
+#define IPMI_SIM_RMCPPLUS_H
+
+#include "ipmi-sim.h"
+
+/* answers an IPMI 2.0 LAN+ packet, session setup, IPMI or SOL
+ * payload.  Packets are dropped if built without encryption.
+ */
+void ipmi_sim_rmcpplus_process (ipmi_sim_state_data_t *state_data,
+                                struct ipmi_sim_bmc *bmc,
+                                const struct sockaddr_in *from,
+                                const void *pkt,
+                                unsigned int pkt_len);
+
+#endif /* IPMI_SIM_RMCPPLUS_H */
@@ -0,0 +1,853 @@
+/*
+ * Copyright (C) 2005-2015 FreeIPMI Core Team
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif /* HAVE_CONFIG_H */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#if STDC_HEADERS
+#include <string.h>
+#endif /* STDC_HEADERS */
+#if TIME_WITH_SYS_TIME
+#include <sys/time.h>
+#include <time.h>
+#else /* !TIME_WITH_SYS_TIME */
+#if HAVE_SYS_TIME_H
+#include <sys/time.h>
+#else /* !HAVE_SYS_TIME_H */
+#include <time.h>
+#endif /* !HAVE_SYS_TIME_H */
+#endif  /* !TIME_WITH_SYS_TIME */
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <sys/resource.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <sys/poll.h>
+#if HAVE_UNISTD_H
+#include <unistd.h>
+#endif /* HAVE_UNISTD_H */
+#include <signal.h>
+#include <assert.h>
+#include <errno.h>
+
+#include <freeipmi/freeipmi.h>
+
+#include "ipmi-sim.h"
+#include "ipmi-sim-argp.h"
+#include "ipmi-sim-data.h"
+#include "ipmi-sim-inband.h"
+#include "ipmi-sim-lan.h"
+#include "ipmi-sim-rmcpplus.h"
+
+#include "freeipmi-portability.h"
+#include "error.h"
+#include "fd.h"
+#include "heap.h"
+#include "timeval.h"
+
+/* responses held back by --delay or --jitter */
+#define IPMI_SIM_QUEUE_LEN               65536
+
+/* session timeouts are checked at least this often */
+#define IPMI_SIM_POLL_TIMEOUT_MS         1000
+
+/* descriptors needed besides the BMC sockets */
+#define IPMI_SIM_FDS_RESERVED            16
+
+fiid_template_t tmpl_ipmi_sim_cmd =
+  {
+    { IPMI_SIM_PKT_LEN * 8, "data", FIID_FIELD_OPTIONAL | FIID_FIELD_LENGTH_VARIABLE},
+    { 0, "", 0}
+  };
+
+/* bmc is NULL for responses to in-band clients */
+struct ipmi_sim_queued_pkt
+{
+  struct timeval send_time;
+  struct ipmi_sim_bmc *bmc;
+  struct sockaddr_in to;
+  unsigned int conn;
+  unsigned long conn_id;
+  unsigned int pkt_len;
+  uint8_t pkt[IPMI_SIM_PKT_LEN];
+};
+
+static Heap ipmi_sim_queue = NULL;
+
+static volatile sig_atomic_t ipmi_sim_exit_flag = 0;
+static volatile sig_atomic_t ipmi_sim_stats_flag = 0;
+
+static void
+_signal_handler (int sig)
+{
+  if (sig == SIGUSR1)
+    ipmi_sim_stats_flag = 1;
+  else
+    ipmi_sim_exit_flag = 1;
+}
+
+/* the heap returns its largest element first, the earliest send time
+ * must compare largest
+ */
+static int
+_queued_pkt_cmp (void *x, void *y)
+{
+  struct ipmi_sim_queued_pkt *a = x;
+  struct ipmi_sim_queued_pkt *b = y;
+
+  assert (a);
+  assert (b);
+
+  if (timeval_lt (&a->send_time, &b->send_time))
+    return (1);
+  if (timeval_gt (&a->send_time, &b->send_time))
+    return (-1);
+  return (0);
+}
+
+static void
+_sendto (ipmi_sim_state_data_t *state_data,
+         struct ipmi_sim_bmc *bmc,
+         const struct sockaddr_in *to,
+         const void *pkt,
+         unsigned int pkt_len)
+{
+  assert (state_data);
+  assert (bmc);
+  assert (to);
+  assert (pkt);
+
+  if (sendto (bmc->fd,
+              pkt,
+              pkt_len,
+              0,
+              (struct sockaddr *)to,
+              sizeof (struct sockaddr_in)) < 0)
+    {
+      if (state_data->prog_data->args->verbose)
+        err_output ("%s: sendto: %s", bmc->name, strerror (errno));
+      return;
+    }
+
+  state_data->stats.sent++;
+}
+
+static void
+_inband_send (ipmi_sim_state_data_t *state_data,
+              unsigned int conn,
+              unsigned long conn_id,
+              const void *pkt,
+              unsigned int pkt_len)
+{
+  struct ipmi_sim_inband_conn *c;
+
+  assert (state_data);
+  assert (conn < IPMI_SIM_INBAND_CONNS_MAX);
+  assert (pkt);
+
+  c = &state_data->inband_conns[conn];
+
+  /* the client went away while the response was delayed */
+  if (c->fd < 0 || c->id != conn_id)
+    return;
+
+  if (send (c->fd, pkt, pkt_len, 0) < 0)
+    {
+      if (state_data->prog_data->args->verbose)
+        err_output ("inband: send: %s", strerror (errno));
+      return;
+    }
+
+  state_data->stats.sent++;
+}
+
+/* returns milliseconds to delay a response by */
+static unsigned int
+_delay (ipmi_sim_state_data_t *state_data)
+{
+  struct ipmi_sim_arguments *args;
+  unsigned int ms;
+
+  assert (state_data);
+
+  args = state_data->prog_data->args;
+
+  ms = args->delay;
+  if (args->jitter)
+    ms += random () % (args->jitter + 1);
+
+  return (ms);
+}
+
+static void
+_queue_insert (ipmi_sim_state_data_t *state_data,
+               struct ipmi_sim_bmc *bmc,
+               const struct sockaddr_in *to,
+               unsigned int conn,
+               const void *pkt,
+               unsigned int pkt_len,
+               unsigned int ms)
+{
+  struct ipmi_sim_queued_pkt *qp;
+  struct timeval now;
+
+  assert (state_data);
+  assert ((bmc && to) || (!bmc && conn < IPMI_SIM_INBAND_CONNS_MAX));
+  assert (pkt);
+  assert (pkt_len <= IPMI_SIM_PKT_LEN);
+
+  if (heap_is_full (ipmi_sim_queue))
+    {
+      state_data->stats.queue_overflows++;
+      return;
+    }
+
+  if (!(qp = (struct ipmi_sim_queued_pkt *)malloc (sizeof (struct ipmi_sim_queued_pkt))))
+    err_exit ("malloc: %s", strerror (errno));
+
+  if (gettimeofday (&now, NULL) < 0)
+    err_exit ("gettimeofday: %s", strerror (errno));
+
+  timeval_add_ms (&now, ms, &qp->send_time);
+  qp->bmc = bmc;
+  if (bmc)
+    memcpy (&qp->to, to, sizeof (struct sockaddr_in));
+  else
+    {
+      qp->conn = conn;
+      qp->conn_id = state_data->inband_conns[conn].id;
+    }
+  memcpy (qp->pkt, pkt, pkt_len);
+  qp->pkt_len = pkt_len;
+
+  if (!heap_insert (ipmi_sim_queue, qp))
+    err_exit ("heap_insert: %s", strerror (errno));
+}
+
+void
+ipmi_sim_send (ipmi_sim_state_data_t *state_data,
+               struct ipmi_sim_bmc *bmc,
+               const struct sockaddr_in *to,
+               const void *pkt,
+               unsigned int pkt_len)
+{
+  struct ipmi_sim_arguments *args;
+  unsigned int copies = 1;
+  unsigned int i;
+
+  assert (state_data);
+  assert (bmc);
+  assert (to);
+  assert (pkt);
+  assert (pkt_len <= IPMI_SIM_PKT_LEN);
+
+  args = state_data->prog_data->args;
+
+  if (args->loss
+      && (unsigned int)(random () % 100) < args->loss)
+    {
+      state_data->stats.dropped++;
+      return;
+    }
+
+  if (args->duplicate
+      && (unsigned int)(random () % 100) < args->duplicate)
+    {
+      state_data->stats.duplicated++;
+      copies++;
+    }
+
+  for (i = 0; i < copies; i++)
+    {
+      unsigned int ms;
+
+      if (!(ms = _delay (state_data)))
+        _sendto (state_data, bmc, to, pkt, pkt_len);
+      else
+        _queue_insert (state_data, bmc, to, 0, pkt, pkt_len, ms);
+    }
+}
+
+/* in-band clients wait for every response, they are neither lost nor
+ * duplicated
+ */
+void
+ipmi_sim_inband_send (ipmi_sim_state_data_t *state_data,
+                      unsigned int conn,
+                      const void *pkt,
+                      unsigned int pkt_len)
+{
+  unsigned int ms;
+
+  assert (state_data);
+  assert (conn < IPMI_SIM_INBAND_CONNS_MAX);
+  assert (pkt);
+  assert (pkt_len <= IPMI_SIM_PKT_LEN);
+
+  if (!(ms = _delay (state_data)))
+    _inband_send (state_data, conn, state_data->inband_conns[conn].id, pkt, pkt_len);
+  else
+    _queue_insert (state_data, NULL, NULL, conn, pkt, pkt_len, ms);
+}
+
+/* sends the queued packets that are due, returns milliseconds until
+ * the next one is
+ */
+static unsigned int
+_queue_flush (ipmi_sim_state_data_t *state_data)
+{
+  struct ipmi_sim_queued_pkt *qp;
+  struct timeval now, delta;
+  unsigned int ms;
+
+  assert (state_data);
+
+  if (gettimeofday (&now, NULL) < 0)
+    err_exit ("gettimeofday: %s", strerror (errno));
+
+  while ((qp = heap_peek (ipmi_sim_queue)))
+    {
+      if (timeval_gt (&qp->send_time, &now))
+        {
+          timeval_sub (&qp->send_time, &now, &delta);
+          timeval_millisecond_calc (&delta, &ms);
+          /* round up, so the packet is due once polling returns */
+          ms++;
+          return (ms < IPMI_SIM_POLL_TIMEOUT_MS ? ms : IPMI_SIM_POLL_TIMEOUT_MS);
+        }
+
+      qp = heap_pop (ipmi_sim_queue);
+      if (qp->bmc)
+        _sendto (state_data, qp->bmc, &qp->to, qp->pkt, qp->pkt_len);
+      else
+        _inband_send (state_data, qp->conn, qp->conn_id, qp->pkt, qp->pkt_len);
+      free (qp);
+    }
+
+  return (IPMI_SIM_POLL_TIMEOUT_MS);
+}
+
+uint32_t
+ipmi_sim_session_id_new (ipmi_sim_state_data_t *state_data,
+                         struct ipmi_sim_bmc *bmc)
+{
+  uint32_t session_id;
+
+  assert (state_data);
+  assert (bmc);
+
+  do
+    {
+      if (ipmi_get_random (&session_id, sizeof (session_id)) < 0)
+        err_exit ("ipmi_get_random: %s", strerror (errno));
+    } while (!session_id
+             || ipmi_sim_session_find (state_data, bmc, session_id));
+
+  return (session_id);
+}
+
+struct ipmi_sim_session *
+ipmi_sim_session_new (ipmi_sim_state_data_t *state_data,
+                      struct ipmi_sim_bmc *bmc,
+                      int ipmi_version)
+{
+  struct ipmi_sim_session *session = NULL;
+  unsigned int i;
+
+  assert (state_data);
+  assert (bmc);
+  assert (ipmi_version == IPMI_SIM_IPMI_VERSION_1_5
+          || ipmi_version == IPMI_SIM_IPMI_VERSION_2_0);
+
+  for (i = 0; i < state_data->prog_data->args->sessions; i++)
+    {
+      if (!bmc->sessions[i].in_use)
+        {
+          session = &bmc->sessions[i];
+          break;
+        }
+    }
+
+  if (!session)
+    {
+      state_data->stats.sessions_rejected++;
+      return (NULL);
+    }
+
+  /* the id is chosen before the slot is in use, it may not match
+   * itself
+   */
+  memset (session, '\0', sizeof (struct ipmi_sim_session));
+  session->session_id = ipmi_sim_session_id_new (state_data, bmc);
+  session->in_use = 1;
+  session->ipmi_version = ipmi_version;
+  session->last_received = time (NULL);
+
+  state_data->stats.sessions++;
+  return (session);
+}
+
+struct ipmi_sim_session *
+ipmi_sim_session_find (ipmi_sim_state_data_t *state_data,
+                       struct ipmi_sim_bmc *bmc,
+                       uint32_t session_id)
+{
+  unsigned int i;
+
+  assert (state_data);
+  assert (bmc);
+
+  if (!session_id)
+    return (NULL);
+
+  for (i = 0; i < state_data->prog_data->args->sessions; i++)
+    {
+      struct ipmi_sim_session *session = &bmc->sessions[i];
+
+      if (!session->in_use)
+        continue;
+
+      if (session->session_id == session_id
+          || (session->ipmi_version == IPMI_SIM_IPMI_VERSION_1_5
+              && session->temp_session_id == session_id))
+        return (session);
+    }
+
+  return (NULL);
+}
+
+void
+ipmi_sim_session_close (ipmi_sim_state_data_t *state_data,
+                        struct ipmi_sim_bmc *bmc,
+                        struct ipmi_sim_session *session)
+{
+  assert (state_data);
+  assert (bmc);
+  assert (session);
+
+  if (bmc->sol_session == session)
+    bmc->sol_session = NULL;
+  session->sol_activated = 0;
+  session->in_use = 0;
+}
+
+static void
+_session_timeout (ipmi_sim_state_data_t *state_data)
+{
+  time_t now;
+  unsigned int i, j;
+
+  assert (state_data);
+
+  now = time (NULL);
+
+  for (i = 0; i < state_data->bmcs_count; i++)
+    {
+      struct ipmi_sim_bmc *bmc = &state_data->bmcs[i];
+
+      for (j = 0; j < state_data->prog_data->args->sessions; j++)
+        {
+          struct ipmi_sim_session *session = &bmc->sessions[j];
+
+          if (session->in_use
+              && (now - session->last_received) > state_data->prog_data->args->session_timeout)
+            ipmi_sim_session_close (state_data, bmc, session);
+        }
+    }
+}
+
+fiid_obj_t
+ipmi_sim_obj_create (fiid_template_t tmpl)
+{
+  uint8_t zeroes[IPMI_SIM_PKT_LEN];
+  fiid_obj_t obj;
+  unsigned int i;
+
+  assert (tmpl);
+
+  if (!(obj = fiid_obj_create (tmpl)))
+    return (NULL);
+
+  memset (zeroes, '\0', IPMI_SIM_PKT_LEN);
+
+  for (i = 0; tmpl[i].max_field_len; i++)
+    {
+      int rv;
+
+      if (FIID_FIELD_REQUIRED_FLAG (tmpl[i].flags) != FIID_FIELD_REQUIRED
+          || FIID_FIELD_LENGTH_FLAG (tmpl[i].flags) != FIID_FIELD_LENGTH_FIXED)
+        continue;
+
+      if (tmpl[i].max_field_len <= 64)
+        rv = fiid_obj_set (obj, tmpl[i].key, 0);
+      else
+        rv = fiid_obj_set_data (obj, tmpl[i].key, zeroes, tmpl[i].max_field_len / 8);
+
+      if (rv < 0)
+        {
+          err_debug ("fiid_obj_set: '%s': %s", tmpl[i].key, fiid_obj_errormsg (obj));
+          fiid_obj_destroy (obj);
+          errno = EINVAL;
+          return (NULL);
+        }
+    }
+
+  return (obj);
+}
+
+static void
+_stats_output (ipmi_sim_state_data_t *state_data)
+{
+  assert (state_data);
+
+  err_output ("received %lu, sent %lu, dropped %lu, duplicated %lu, "
+              "queue overflows %lu, sessions %lu, sessions rejected %lu",
+              state_data->stats.received,
+              state_data->stats.sent,
+              state_data->stats.dropped,
+              state_data->stats.duplicated,
+              state_data->stats.queue_overflows,
+              state_data->stats.sessions,
+              state_data->stats.sessions_rejected);
+}
+
+static void
+_rlimit_setup (ipmi_sim_state_data_t *state_data)
+{
+  struct rlimit rlim;
+  rlim_t needed;
+
+  assert (state_data);
+
+  needed = state_data->prog_data->args->count + IPMI_SIM_FDS_RESERVED;
+  if (state_data->prog_data->args->inband_socket)
+    needed += IPMI_SIM_INBAND_CONNS_MAX + 1;
+
+  if (getrlimit (RLIMIT_NOFILE, &rlim) < 0)
+    err_exit ("getrlimit: %s", strerror (errno));
+
+  if (rlim.rlim_cur != RLIM_INFINITY
+      && rlim.rlim_cur < needed)
+    {
+      if (rlim.rlim_max != RLIM_INFINITY
+          && rlim.rlim_max < needed)
+        err_exit ("%u BMCs exceed the open file limit of %lu",
+                  state_data->prog_data->args->count,
+                  (unsigned long)rlim.rlim_max);
+
+      rlim.rlim_cur = needed;
+      if (setrlimit (RLIMIT_NOFILE, &rlim) < 0)
+        err_exit ("setrlimit: %s", strerror (errno));
+    }
+}
+
+static void
+_bmcs_setup (ipmi_sim_state_data_t *state_data)
+{
+  struct ipmi_sim_arguments *args;
+  struct in_addr addr;
+  unsigned int i;
+
+  assert (state_data);
+
+  args = state_data->prog_data->args;
+
+  if (inet_pton (AF_INET, args->address, &addr) != 1)
+    err_exit ("invalid address: %s", args->address);
+
+  if (args->increment_address
+      && (ntohl (addr.s_addr) & 0xFF) + args->count - 1 > 0xFF)
+    err_exit ("count too large for address %s", args->address);
+
+  if (!(state_data->bmcs = (struct ipmi_sim_bmc *)calloc (args->count, sizeof (struct ipmi_sim_bmc))))
+    err_exit ("calloc: %s", strerror (errno));
+  state_data->bmcs_count = args->count;
+
+  for (i = 0; i < args->count; i++)
+    {
+      struct ipmi_sim_bmc *bmc = &state_data->bmcs[i];
+      char addrstr[INET_ADDRSTRLEN];
+
+      bmc->index = i;
+      bmc->addr.sin_family = AF_INET;
+      if (args->increment_address)
+        {
+          bmc->addr.sin_addr.s_addr = htonl (ntohl (addr.s_addr) + i);
+          bmc->addr.sin_port = htons (args->port);
+        }
+      else
+        {
+          bmc->addr.sin_addr.s_addr = addr.s_addr;
+          bmc->addr.sin_port = htons (args->port + i);
+        }
+
+      if (!inet_ntop (AF_INET, &bmc->addr.sin_addr, addrstr, INET_ADDRSTRLEN))
+        err_exit ("inet_ntop: %s", strerror (errno));
+      snprintf (bmc->name, sizeof (bmc->name), "%s:%u", addrstr, ntohs (bmc->addr.sin_port));
+
+      /* distinct and stable across runs */
+      memcpy (bmc->guid, "ipmi-sim", 8);
+      bmc->guid[12] = (i & 0x000000FF);
+      bmc->guid[13] = (i & 0x0000FF00) >> 8;
+      bmc->guid[14] = (i & 0x00FF0000) >> 16;
+      bmc->guid[15] = (i & 0xFF000000) >> 24;
+
+      bmc->power_on = 1;
+
+      if (!(bmc->sessions = (struct ipmi_sim_session *)calloc (args->sessions,
+                                                               sizeof (struct ipmi_sim_session))))
+        err_exit ("calloc: %s", strerror (errno));
+
+      if ((bmc->fd = socket (AF_INET, SOCK_DGRAM, 0)) < 0)
+        err_exit ("socket: %s", strerror (errno));
+
+      if (bind (bmc->fd, (struct sockaddr *)&bmc->addr, sizeof (struct sockaddr_in)) < 0)
+        err_exit ("bind %s: %s", bmc->name, strerror (errno));
+
+      if (fd_set_nonblocking (bmc->fd) < 0)
+        err_exit ("fd_set_nonblocking: %s", strerror (errno));
+    }
+}
+
+static void
+_bmcs_cleanup (ipmi_sim_state_data_t *state_data)
+{
+  unsigned int i;
+
+  assert (state_data);
+
+  for (i = 0; i < state_data->bmcs_count; i++)
+    {
+      close (state_data->bmcs[i].fd);
+      free (state_data->bmcs[i].sessions);
+    }
+  free (state_data->bmcs);
+}
+
+static void
+_recv (ipmi_sim_state_data_t *state_data, struct ipmi_sim_bmc *bmc)
+{
+  struct ipmi_sim_arguments *args;
+  uint8_t pkt[IPMI_SIM_PKT_LEN];
+  struct sockaddr_in from;
+  socklen_t fromlen;
+  ssize_t len;
+
+  assert (state_data);
+  assert (bmc);
+
+  args = state_data->prog_data->args;
+
+  while (1)
+    {
+      fromlen = sizeof (struct sockaddr_in);
+      if ((len = recvfrom (bmc->fd,
+                           pkt,
+                           IPMI_SIM_PKT_LEN,
+                           0,
+                           (struct sockaddr *)&from,
+                           &fromlen)) < 0)
+        {
+          if (errno != EAGAIN
+              && errno != EWOULDBLOCK
+              && errno != EINTR
+              && args->verbose)
+            err_output ("%s: recvfrom: %s", bmc->name, strerror (errno));
+          return;
+        }
+
+      state_data->stats.received++;
+
+      if (args->loss
+          && (unsigned int)(random () % 100) < args->loss)
+        {
+          state_data->stats.dropped++;
+          continue;
+        }
+
+      if (args->verbose > 1)
+        err_output ("%s: %d bytes from %s:%u",
+                    bmc->name,
+                    (int)len,
+                    inet_ntoa (from.sin_addr),
+                    ntohs (from.sin_port));
+
+      /* RMCP header message class, the fourth byte */
+      if (len < 4)
+        continue;
+
+      if ((pkt[3] & 0x1F) == RMCP_HDR_MESSAGE_CLASS_ASF)
+        ipmi_sim_lan_ping (state_data, bmc, &from, pkt, len);
+      else if ((pkt[3] & 0x1F) != RMCP_HDR_MESSAGE_CLASS_IPMI)
+        continue;
+      else if (ipmi_is_ipmi_2_0_packet (pkt, len) == 1)
+        ipmi_sim_rmcpplus_process (state_data, bmc, &from, pkt, len);
+      else if (ipmi_is_ipmi_1_5_packet (pkt, len) == 1)
+        ipmi_sim_lan_process (state_data, bmc, &from, pkt, len);
+    }
+}
+
+/* the BMC sockets are followed by the in-band socket and its
+ * clients, negative descriptors are ignored by poll()
+ */
+static void
+_ipmi_sim_loop (ipmi_sim_state_data_t *state_data)
+{
+  struct pollfd *pfds;
+  unsigned int nfds;
+  time_t last_timeout_check;
+  unsigned int i;
+
+  assert (state_data);
+
+  nfds = state_data->bmcs_count + 1 + IPMI_SIM_INBAND_CONNS_MAX;
+
+  if (!(pfds = (struct pollfd *)calloc (nfds, sizeof (struct pollfd))))
+    err_exit ("calloc: %s", strerror (errno));
+
+  for (i = 0; i < state_data->bmcs_count; i++)
+    {
+      pfds[i].fd = state_data->bmcs[i].fd;
+      pfds[i].events = POLLIN;
+    }
+  pfds[state_data->bmcs_count].fd = state_data->inband_fd;
+  pfds[state_data->bmcs_count].events = POLLIN;
+
+  last_timeout_check = time (NULL);
+
+  while (!ipmi_sim_exit_flag)
+    {
+      unsigned int timeout;
+      int n;
+
+      if (ipmi_sim_stats_flag)
+        {
+          _stats_output (state_data);
+          ipmi_sim_stats_flag = 0;
+        }
+
+      timeout = _queue_flush (state_data);
+
+      if (time (NULL) != last_timeout_check)
+        {
+          _session_timeout (state_data);
+          last_timeout_check = time (NULL);
+        }
+
+      for (i = 0; i < IPMI_SIM_INBAND_CONNS_MAX; i++)
+        {
+          pfds[state_data->bmcs_count + 1 + i].fd = state_data->inband_conns[i].fd;
+          pfds[state_data->bmcs_count + 1 + i].events = POLLIN;
+        }
+
+      if ((n = poll (pfds, nfds, timeout)) < 0)
+        {
+          if (errno == EINTR)
+            continue;
+          err_exit ("poll: %s", strerror (errno));
+        }
+
+      for (i = 0; i < state_data->bmcs_count && n; i++)
+        {
+          if (!pfds[i].revents)
+            continue;
+          n--;
+          if (pfds[i].revents & POLLIN)
+            _recv (state_data, &state_data->bmcs[i]);
+        }
+
+      for (i = 0; i < IPMI_SIM_INBAND_CONNS_MAX && n; i++)
+        {
+          if (!pfds[state_data->bmcs_count + 1 + i].revents)
+            continue;
+          n--;
+          ipmi_sim_inband_process (state_data, i);
+        }
+
+      if (n && pfds[state_data->bmcs_count].revents)
+        ipmi_sim_inband_accept (state_data);
+    }
+
+  free (pfds);
+}
+
+int
+main (int argc, char **argv)
+{
+  ipmi_sim_prog_data_t prog_data;
+  ipmi_sim_state_data_t state_data;
+  struct ipmi_sim_arguments cmd_args;
+
+  err_init (argv[0]);
+  err_set_flags (ERROR_STDERR);
+
+  ipmi_sim_argp_parse (argc, argv, &cmd_args);
+
+  memset (&prog_data, '\0', sizeof (ipmi_sim_prog_data_t));
+  prog_data.progname = argv[0];
+  prog_data.args = &cmd_args;
+
+  memset (&state_data, '\0', sizeof (ipmi_sim_state_data_t));
+  state_data.prog_data = &prog_data;
+
+  /* IPMI 1.5 passwords are zero extended */
+  strncpy (state_data.password, cmd_args.password, sizeof (state_data.password) - 1);
+  state_data.password[sizeof (state_data.password) - 1] = '\0';
+
+  if (cmd_args.seed_set)
+    srandom (cmd_args.seed);
+  else
+    srandom (time (NULL) ^ getpid ());
+
+  if (ipmi_rmcpplus_init () < 0)
+    err_exit ("ipmi_rmcpplus_init: %s", strerror (errno));
+
+  if (signal (SIGPIPE, SIG_IGN) == SIG_ERR
+      || signal (SIGUSR1, _signal_handler) == SIG_ERR
+      || signal (SIGINT, _signal_handler) == SIG_ERR
+      || signal (SIGTERM, _signal_handler) == SIG_ERR)
+    err_exit ("signal: %s", strerror (errno));
+
+  if (!(ipmi_sim_queue = heap_create (IPMI_SIM_QUEUE_LEN, _queued_pkt_cmp, free)))
+    err_exit ("heap_create: %s", strerror (errno));
+
+  ipmi_sim_data_load (&state_data);
+
+  _rlimit_setup (&state_data);
+
+  _bmcs_setup (&state_data);
+
+  ipmi_sim_inband_setup (&state_data);
+
+  if (cmd_args.verbose)
+    err_output ("simulating %u BMCs from %s", state_data.bmcs_count, state_data.bmcs[0].name);
+
+  _ipmi_sim_loop (&state_data);
+
+  _stats_output (&state_data);
+
+  heap_destroy (ipmi_sim_queue);
+  ipmi_sim_inband_cleanup (&state_data);
+  _bmcs_cleanup (&state_data);
+  ipmi_sim_data_cleanup (&state_data);
+  return (0);
+}
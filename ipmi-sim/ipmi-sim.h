@@ -0,0 +1,301 @@
+/*
+ * Copyright (C) 2005-2015 FreeIPMI Core Team
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef IPMI_SIM_H
+#define IPMI_SIM_H
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif /* HAVE_CONFIG_H */
+
+#include <stdint.h>
+#include <time.h>
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+
+#include <freeipmi/freeipmi.h>
+
+#define IPMI_SIM_ADDRESS_DEFAULT          "127.0.0.1"
+#define IPMI_SIM_PORT_DEFAULT             623
+#define IPMI_SIM_COUNT_DEFAULT            1
+#define IPMI_SIM_USERNAME_DEFAULT         "admin"
+#define IPMI_SIM_PASSWORD_DEFAULT         "password"
+#define IPMI_SIM_SESSIONS_DEFAULT         16
+#define IPMI_SIM_SESSION_TIMEOUT_DEFAULT  60
+#define IPMI_SIM_SENSORS_DEFAULT          64
+#define IPMI_SIM_SEL_ENTRIES_DEFAULT      32
+
+#define IPMI_SIM_PKT_LEN                  1024
+
+#define IPMI_SIM_IPMI_VERSION_1_5         0x15
+#define IPMI_SIM_IPMI_VERSION_2_0         0x20
+
+#define IPMI_MAX_SIK_KEY_LENGTH             64
+#define IPMI_MAX_INTEGRITY_KEY_LENGTH       64
+#define IPMI_MAX_CONFIDENTIALITY_KEY_LENGTH 64
+
+/* generated SDR, sensor numbers are 8 bits */
+#define IPMI_SIM_SENSORS_MAX              255
+
+/* SEL record ids 0x0000 and 0xFFFF are reserved */
+#define IPMI_SIM_SEL_ENTRIES_MAX          0xFFFE
+
+#define IPMI_SIM_SEL_RECORD_LENGTH        16
+
+/* concurrent clients of the in-band socket */
+#define IPMI_SIM_INBAND_CONNS_MAX         64
+
+enum ipmi_sim_argp_option_keys
+  {
+    IPMI_SIM_ADDRESS_KEY = 'a',
+    IPMI_SIM_PORT_KEY = 'p',
+    IPMI_SIM_COUNT_KEY = 'n',
+    IPMI_SIM_INCREMENT_ADDRESS_KEY = 160,
+    IPMI_SIM_USERNAME_KEY = 'u',
+    IPMI_SIM_PASSWORD_KEY = 'P',
+    IPMI_SIM_SESSIONS_KEY = 161,
+    IPMI_SIM_SESSION_TIMEOUT_KEY = 162,
+    IPMI_SIM_SDR_CACHE_FILE_KEY = 163,
+    IPMI_SIM_SENSORS_KEY = 164,
+    IPMI_SIM_SENSOR_READINGS_FILE_KEY = 165,
+    IPMI_SIM_SEL_FILE_KEY = 166,
+    IPMI_SIM_SEL_ENTRIES_KEY = 167,
+    IPMI_SIM_FRU_FILE_KEY = 168,
+    IPMI_SIM_DELAY_KEY = 'd',
+    IPMI_SIM_JITTER_KEY = 'j',
+    IPMI_SIM_LOSS_KEY = 'l',
+    IPMI_SIM_DUPLICATE_KEY = 'D',
+    IPMI_SIM_SEED_KEY = 169,
+    IPMI_SIM_VERBOSE_KEY = 'v',
+    IPMI_SIM_INBAND_SOCKET_KEY = 170,
+    IPMI_SIM_SDR_READ_MAX_KEY = 171,
+  };
+
+struct ipmi_sim_arguments
+{
+  char *address;
+  unsigned int port;
+  unsigned int count;
+  int increment_address;
+  char *username;
+  char *password;
+  unsigned int sessions;
+  unsigned int session_timeout;
+  char *sdr_cache_file;
+  unsigned int sensors;
+  char *sensor_readings_file;
+  char *sel_file;
+  unsigned int sel_entries;
+  char *fru_file;
+  unsigned int sdr_read_max;
+  unsigned int delay;
+  unsigned int jitter;
+  unsigned int loss;
+  unsigned int duplicate;
+  unsigned int seed;
+  int seed_set;
+  int verbose;
+  char *inband_socket;
+};
+
+/* Data served by every simulated BMC.  Loaded or generated once,
+ * read-only afterwards.
+ */
+struct ipmi_sim_sdr_record
+{
+  uint16_t record_id;
+  uint8_t *data;
+  unsigned int len;
+};
+
+struct ipmi_sim_sensor_reading
+{
+  int configured;
+  uint8_t reading;
+  uint16_t event_bitmask;
+};
+
+struct ipmi_sim_data
+{
+  struct ipmi_sim_sdr_record *sdr;
+  unsigned int sdr_count;
+  uint32_t sdr_timestamp;
+  struct ipmi_sim_sensor_reading readings[256];
+  uint8_t *sel;
+  unsigned int sel_count;
+  uint32_t sel_timestamp;
+  uint8_t *fru;
+  unsigned int fru_len;
+};
+
+struct ipmi_sim_session
+{
+  int in_use;
+  int ipmi_version;
+  int activated;
+  /* session id the remote console sends to us, the temporary id of
+   * an IPMI 1.5 session before activation
+   */
+  uint32_t session_id;
+  uint32_t temp_session_id;
+  /* IPMI 2.0, session id we send to the remote console */
+  uint32_t remote_console_session_id;
+  uint32_t outbound_sequence_number;
+  uint8_t privilege_level;
+  uint8_t maximum_privilege_level;
+  time_t last_received;
+  /* IPMI 1.5 */
+  uint8_t authentication_type;
+  uint8_t challenge_string[IPMI_CHALLENGE_STRING_LENGTH];
+  /* IPMI 2.0 */
+  uint8_t authentication_algorithm;
+  uint8_t integrity_algorithm;
+  uint8_t confidentiality_algorithm;
+  uint8_t remote_console_random_number[IPMI_REMOTE_CONSOLE_RANDOM_NUMBER_LENGTH];
+  uint8_t managed_system_random_number[IPMI_MANAGED_SYSTEM_RANDOM_NUMBER_LENGTH];
+  uint8_t name_only_lookup;
+  char username[IPMI_MAX_USER_NAME_LENGTH + 1];
+  unsigned int username_len;
+  uint8_t sik[IPMI_MAX_SIK_KEY_LENGTH];
+  void *sik_ptr;
+  unsigned int sik_len;
+  uint8_t k1[IPMI_MAX_INTEGRITY_KEY_LENGTH];
+  void *k1_ptr;
+  unsigned int k1_len;
+  uint8_t k2[IPMI_MAX_CONFIDENTIALITY_KEY_LENGTH];
+  void *k2_ptr;
+  unsigned int k2_len;
+  /* SOL payload */
+  int sol_activated;
+  /* our sequence number and the last remote console sequence
+   * number echoed, retransmissions are acked but not echoed again
+   */
+  uint8_t sol_packet_sequence_number;
+  uint8_t sol_last_packet_sequence_number;
+};
+
+struct ipmi_sim_bmc
+{
+  unsigned int index;
+  int fd;
+  struct sockaddr_in addr;
+  char name[INET_ADDRSTRLEN + 8];
+  uint8_t guid[IPMI_SYSTEM_GUID_LENGTH];
+  struct ipmi_sim_session *sessions;
+  uint16_t sdr_reservation_id;
+  uint16_t sel_reservation_id;
+  int sel_cleared;
+  uint32_t sel_erase_timestamp;
+  /* session the SOL payload is activated on, only one at a time */
+  struct ipmi_sim_session *sol_session;
+  int power_on;
+  int identify_on;
+};
+
+struct ipmi_sim_stats
+{
+  unsigned long received;
+  unsigned long sent;
+  unsigned long dropped;
+  unsigned long duplicated;
+  unsigned long queue_overflows;
+  unsigned long sessions;
+  unsigned long sessions_rejected;
+};
+
+/* a client of the in-band socket, the id tells a reused slot from
+ * the connection a delayed response was meant for
+ */
+struct ipmi_sim_inband_conn
+{
+  int fd;
+  unsigned long id;
+};
+
+typedef struct ipmi_sim_prog_data
+{
+  char *progname;
+  struct ipmi_sim_arguments *args;
+} ipmi_sim_prog_data_t;
+
+typedef struct ipmi_sim_state_data
+{
+  ipmi_sim_prog_data_t *prog_data;
+  struct ipmi_sim_data data;
+  struct ipmi_sim_bmc *bmcs;
+  unsigned int bmcs_count;
+  struct ipmi_sim_stats stats;
+  /* IPMI 1.5 password, zero padded */
+  char password[IPMI_1_5_MAX_PASSWORD_LENGTH+1];
+  /* in-band requests are served by the first BMC, as if from a
+   * session at administrator privilege
+   */
+  int inband_fd;
+  struct ipmi_sim_inband_conn inband_conns[IPMI_SIM_INBAND_CONNS_MAX];
+  unsigned long inband_conn_id;
+  struct ipmi_sim_session inband_session;
+} ipmi_sim_state_data_t;
+
+/* IPMI message body of any command, command byte first */
+extern fiid_template_t tmpl_ipmi_sim_cmd;
+
+/* send a packet to the remote console, subject to the configured
+ * delay, jitter, loss and duplication
+ */
+void ipmi_sim_send (ipmi_sim_state_data_t *state_data,
+                    struct ipmi_sim_bmc *bmc,
+                    const struct sockaddr_in *to,
+                    const void *pkt,
+                    unsigned int pkt_len);
+
+/* send a response to an in-band client, subject to the configured
+ * delay and jitter
+ */
+void ipmi_sim_inband_send (ipmi_sim_state_data_t *state_data,
+                           unsigned int conn,
+                           const void *pkt,
+                           unsigned int pkt_len);
+
+/* returns a free session slot, NULL if the BMC is out of sessions */
+struct ipmi_sim_session *ipmi_sim_session_new (ipmi_sim_state_data_t *state_data,
+                                               struct ipmi_sim_bmc *bmc,
+                                               int ipmi_version);
+
+/* returns a random session id, non-zero and unused on the BMC */
+uint32_t ipmi_sim_session_id_new (ipmi_sim_state_data_t *state_data,
+                                  struct ipmi_sim_bmc *bmc);
+
+/* matches the session id or, for IPMI 1.5, the temporary session id */
+struct ipmi_sim_session *ipmi_sim_session_find (ipmi_sim_state_data_t *state_data,
+                                                struct ipmi_sim_bmc *bmc,
+                                                uint32_t session_id);
+
+/* releases the session and its SOL payload, the contents remain
+ * valid until the slot is reused
+ */
+void ipmi_sim_session_close (ipmi_sim_state_data_t *state_data,
+                             struct ipmi_sim_bmc *bmc,
+                             struct ipmi_sim_session *session);
+
+/* fiid_obj_create() with every field zeroed, so fiid_obj_get_all()
+ * of a response only needs the fields of interest set
+ */
+fiid_obj_t ipmi_sim_obj_create (fiid_template_t tmpl);
+
+#endif /* IPMI_SIM_H */
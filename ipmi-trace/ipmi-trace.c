@@ -0,0 +1,777 @@
+/*
+ * Copyright (C) 2003-2015 FreeIPMI Core Team
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif /* HAVE_CONFIG_H */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#if STDC_HEADERS
+#include <string.h>
+#endif /* STDC_HEADERS */
+#if HAVE_ARGP_H
+#include <argp.h>
+#else /* !HAVE_ARGP_H */
+#include "freeipmi-argp.h"
+#endif /* !HAVE_ARGP_H */
+#if TIME_WITH_SYS_TIME
+#include <sys/time.h>
+#include <time.h>
+#else /* !TIME_WITH_SYS_TIME */
+#if HAVE_SYS_TIME_H
+#include <sys/time.h>
+#else /* !HAVE_SYS_TIME_H */
+#include <time.h>
+#endif /* !HAVE_SYS_TIME_H */
+#endif /* !TIME_WITH_SYS_TIME */
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#if HAVE_UNISTD_H
+#include <unistd.h>
+#endif /* HAVE_UNISTD_H */
+#include <assert.h>
+#include <errno.h>
+
+#include <freeipmi/freeipmi.h>
+
+#include "freeipmi-portability.h"
+#include "error.h"
+
+/* Formats a packet trace written by ipmi_ctx_write_pkt_trace() with
+ * the ipmi-debug dump functions, the same output IPMI_FLAGS_DEBUG_DUMP
+ * produces live.
+ */
+
+#define IPMI_TRACE_PCAP_MAGIC         0xA1B2C3D4
+#define IPMI_TRACE_PCAP_MAGIC_SWAPPED 0xD4C3B2A1
+
+#define IPMI_TRACE_PCAP_LINKTYPE_RAW   101
+#define IPMI_TRACE_PCAP_LINKTYPE_USER0 147
+
+#define IPMI_TRACE_PCAP_HDR_LEN        24
+#define IPMI_TRACE_PCAP_RECORD_HDR_LEN 16
+
+#define IPMI_TRACE_PKT_LEN_MAX 65535
+
+#define IPMI_TRACE_IPPROTO_UDP 17
+#define IPMI_TRACE_UDP_HDR_LEN 8
+
+/* direction byte prefixing inband packets */
+#define IPMI_TRACE_REQUEST  0
+#define IPMI_TRACE_RESPONSE 1
+#define IPMI_TRACE_UNKNOWN  2
+
+#define IPMI_TRACE_ENDPOINT_LEN (INET6_ADDRSTRLEN + 8)
+#define IPMI_TRACE_HDR_LEN      1024
+
+/* RMCP+ session header, without the OEM explicit fields */
+#define IPMI_TRACE_RMCPPLUS_PAYLOAD_OFFSET 16
+#define IPMI_TRACE_RMCPPLUS_PAYLOAD_TYPE_MASK      0x3F
+#define IPMI_TRACE_RMCPPLUS_PAYLOAD_ENCRYPTED_MASK 0x80
+
+#define IPMI_TRACE_RMCP_CLASS_MASK 0x1F
+#define IPMI_TRACE_RMCP_CLASS_ASF  0x06
+#define IPMI_TRACE_RMCP_CLASS_IPMI 0x07
+
+#define IPMI_TRACE_ASF_MESSAGE_TYPE_OFFSET 8
+
+#define IPMI_TRACE_LAN_AUTHENTICATION_CODE_LEN 16
+
+/* commands are not known to the trace, so every command is dumped
+ * as its command byte and opaque data
+ */
+fiid_template_t tmpl_trace_cmd_rq =
+  {
+    { 8, "cmd", FIID_FIELD_REQUIRED | FIID_FIELD_LENGTH_FIXED},
+    { 8192, "data", FIID_FIELD_OPTIONAL | FIID_FIELD_LENGTH_VARIABLE},
+    { 0, "", 0}
+  };
+
+fiid_template_t tmpl_trace_cmd_rs =
+  {
+    { 8, "cmd", FIID_FIELD_REQUIRED | FIID_FIELD_LENGTH_FIXED},
+    { 8, "comp_code", FIID_FIELD_OPTIONAL | FIID_FIELD_LENGTH_FIXED},
+    { 8192, "data", FIID_FIELD_OPTIONAL | FIID_FIELD_LENGTH_VARIABLE},
+    { 0, "", 0}
+  };
+
+struct ipmi_trace_arguments
+{
+  char *filename;
+};
+
+struct ipmi_trace_state
+{
+  int swapped;
+  /* learned from the last RMCP+ Open Session Response */
+  uint8_t authentication_algorithm;
+  uint8_t integrity_algorithm;
+  /* learned from the last packet of known direction */
+  char bmc[IPMI_TRACE_ENDPOINT_LEN];
+};
+
+const char *argp_program_version =
+  "ipmi-trace - " PACKAGE_VERSION "\n"
+  "Copyright (C) 2003-2015 FreeIPMI Core Team\n"
+  "This program is free software; you may redistribute it under the terms of\n"
+  "the GNU General Public License.  This program has absolutely no warranty.";
+
+const char *argp_program_bug_address =
+  "<" PACKAGE_BUGREPORT ">";
+
+static char cmdline_doc[] =
+  "ipmi-trace - format an IPMI packet trace";
+
+static char cmdline_args_doc[] = "FILE";
+
+static struct argp_option cmdline_options[] =
+  {
+    { NULL, 0, NULL, 0, NULL, 0}
+  };
+
+static error_t
+cmdline_parse (int key, char *arg, struct argp_state *state)
+{
+  struct ipmi_trace_arguments *cmd_args;
+
+  assert (state);
+
+  cmd_args = state->input;
+
+  switch (key)
+    {
+    case ARGP_KEY_ARG:
+      if (cmd_args->filename)
+        argp_usage (state);
+      cmd_args->filename = arg;
+      break;
+    case ARGP_KEY_END:
+      if (!cmd_args->filename)
+        argp_usage (state);
+      break;
+    default:
+      return (ARGP_ERR_UNKNOWN);
+    }
+
+  return (0);
+}
+
+static struct argp cmdline_argp = { cmdline_options,
+                                    cmdline_parse,
+                                    cmdline_args_doc,
+                                    cmdline_doc };
+
+static uint32_t
+_get32 (struct ipmi_trace_state *state, const uint8_t *buf)
+{
+  uint32_t val;
+
+  memcpy (&val, buf, sizeof (uint32_t));
+  if (state->swapped)
+    val = ((val & 0x000000FF) << 24)
+      | ((val & 0x0000FF00) << 8)
+      | ((val & 0x00FF0000) >> 8)
+      | ((val & 0xFF000000) >> 24);
+
+  return (val);
+}
+
+static void
+_hdr (char *hdr,
+      const struct timeval *tv,
+      const char *src,
+      const char *dst,
+      const char *protocol,
+      uint8_t net_fn,
+      int have_cmd,
+      uint8_t cmd,
+      int direction)
+{
+  char timebuf[64];
+  char cmdbuf[128];
+  const char *direction_str;
+  struct tm tm;
+  time_t t;
+
+  assert (hdr && tv && protocol);
+
+  t = tv->tv_sec;
+  localtime_r (&t, &tm);
+  strftime (timebuf, sizeof (timebuf), "%Y-%m-%d %H:%M:%S", &tm);
+
+  if (have_cmd)
+    {
+      const char *str;
+
+      /* responses carry the request network function plus one */
+      if ((str = ipmi_cmd_str (net_fn & ~0x1, cmd)) && strcmp (str, "Unknown"))
+        snprintf (cmdbuf, sizeof (cmdbuf), " %s", str);
+      else
+        snprintf (cmdbuf,
+                  sizeof (cmdbuf),
+                  " NetFn 0x%02X Cmd 0x%02X",
+                  net_fn & ~0x1,
+                  cmd);
+    }
+  else
+    cmdbuf[0] = '\0';
+
+  if (direction == IPMI_TRACE_REQUEST)
+    direction_str = " Request";
+  else if (direction == IPMI_TRACE_RESPONSE)
+    direction_str = " Response";
+  else
+    direction_str = "";
+
+  snprintf (hdr,
+            IPMI_TRACE_HDR_LEN,
+            "=====================================================\n"
+            "%s.%06u%s%s%s%s\n"
+            "%s%s%s\n"
+            "=====================================================",
+            timebuf,
+            (unsigned int)tv->tv_usec,
+            src ? " " : "",
+            src ? src : "",
+            dst ? " -> " : "",
+            dst ? dst : "",
+            protocol,
+            cmdbuf,
+            direction_str);
+}
+
+static void
+_dump_hex (const char *hdr, const uint8_t *pkt, unsigned int pkt_len)
+{
+  if (ipmi_dump_hex (STDOUT_FILENO, NULL, hdr, NULL, pkt, pkt_len) < 0)
+    err_output ("ipmi_dump_hex: %s", strerror (errno));
+}
+
+/* direction of a packet of unknown content, from the side of the BMC
+ * learned so far
+ */
+static int
+_endpoint_direction (struct ipmi_trace_state *state, const char *src)
+{
+  if (!strlen (state->bmc))
+    return (IPMI_TRACE_UNKNOWN);
+
+  return (!strcmp (src, state->bmc) ? IPMI_TRACE_RESPONSE : IPMI_TRACE_REQUEST);
+}
+
+static void
+_learn_endpoint (struct ipmi_trace_state *state,
+                 const char *src,
+                 const char *dst,
+                 int direction)
+{
+  if (direction == IPMI_TRACE_REQUEST)
+    snprintf (state->bmc, IPMI_TRACE_ENDPOINT_LEN, "%s", dst);
+  else
+    snprintf (state->bmc, IPMI_TRACE_ENDPOINT_LEN, "%s", src);
+}
+
+static void
+_dump_asf (struct ipmi_trace_state *state,
+           const struct timeval *tv,
+           const char *src,
+           const char *dst,
+           const uint8_t *pkt,
+           unsigned int pkt_len)
+{
+  char hdr[IPMI_TRACE_HDR_LEN];
+  fiid_field_t *tmpl_cmd;
+  int direction;
+
+  if (pkt_len <= IPMI_TRACE_ASF_MESSAGE_TYPE_OFFSET)
+    {
+      _hdr (hdr, tv, src, dst, "RMCP", 0, 0, 0, IPMI_TRACE_UNKNOWN);
+      _dump_hex (hdr, pkt, pkt_len);
+      return;
+    }
+
+  if (pkt[IPMI_TRACE_ASF_MESSAGE_TYPE_OFFSET] == RMCP_ASF_MESSAGE_TYPE_PRESENCE_PING)
+    {
+      tmpl_cmd = tmpl_cmd_asf_presence_ping;
+      direction = IPMI_TRACE_REQUEST;
+    }
+  else
+    {
+      tmpl_cmd = tmpl_cmd_asf_presence_pong;
+      direction = IPMI_TRACE_RESPONSE;
+    }
+
+  _learn_endpoint (state, src, dst, direction);
+
+  _hdr (hdr, tv, src, dst, "RMCP Presence", 0, 0, 0, direction);
+
+  if (ipmi_dump_rmcp_packet (STDOUT_FILENO,
+                             NULL,
+                             hdr,
+                             NULL,
+                             pkt,
+                             pkt_len,
+                             tmpl_cmd) < 0)
+    err_output ("ipmi_dump_rmcp_packet: %s", strerror (errno));
+}
+
+static void
+_dump_lan (struct ipmi_trace_state *state,
+           const struct timeval *tv,
+           const char *src,
+           const char *dst,
+           const uint8_t *pkt,
+           unsigned int pkt_len)
+{
+  char hdr[IPMI_TRACE_HDR_LEN];
+  unsigned int msg_offset;
+  uint8_t net_fn;
+  int direction;
+
+  /* RMCP header, authentication type, sequence number, session id,
+   * optional authentication code and message length
+   */
+  msg_offset = 4 + 1 + 4 + 4 + 1;
+  if (pkt[4] != IPMI_AUTHENTICATION_TYPE_NONE)
+    msg_offset += IPMI_TRACE_LAN_AUTHENTICATION_CODE_LEN;
+
+  if (pkt_len < msg_offset + 6)
+    {
+      _hdr (hdr, tv, src, dst, "IPMI 1.5", 0, 0, 0, IPMI_TRACE_UNKNOWN);
+      _dump_hex (hdr, pkt, pkt_len);
+      return;
+    }
+
+  net_fn = pkt[msg_offset + 1] >> 2;
+  direction = (net_fn & 0x1) ? IPMI_TRACE_RESPONSE : IPMI_TRACE_REQUEST;
+
+  _learn_endpoint (state, src, dst, direction);
+
+  _hdr (hdr,
+        tv,
+        src,
+        dst,
+        "IPMI 1.5",
+        net_fn,
+        1,
+        pkt[msg_offset + 5],
+        direction);
+
+  if (ipmi_dump_lan_packet (STDOUT_FILENO,
+                            NULL,
+                            hdr,
+                            NULL,
+                            pkt,
+                            pkt_len,
+                            direction == IPMI_TRACE_REQUEST ? tmpl_lan_msg_hdr_rq : tmpl_lan_msg_hdr_rs,
+                            direction == IPMI_TRACE_REQUEST ? tmpl_trace_cmd_rq : tmpl_trace_cmd_rs) < 0)
+    err_output ("ipmi_dump_lan_packet: %s", strerror (errno));
+}
+
+static void
+_learn_algorithms (struct ipmi_trace_state *state,
+                   const uint8_t *payload,
+                   unsigned int payload_len)
+{
+  fiid_obj_t obj = NULL;
+  uint64_t val;
+
+  if (!(obj = fiid_obj_create (tmpl_rmcpplus_open_session_response)))
+    err_exit ("fiid_obj_create: %s", strerror (errno));
+
+  if (fiid_obj_set_all (obj, payload, payload_len) < 0)
+    goto cleanup;
+
+  if (FIID_OBJ_GET (obj,
+                    "authentication_payload.authentication_algorithm",
+                    &val) > 0
+      && IPMI_AUTHENTICATION_ALGORITHM_SUPPORTED (val))
+    state->authentication_algorithm = val;
+
+  if (FIID_OBJ_GET (obj,
+                    "integrity_payload.integrity_algorithm",
+                    &val) > 0
+      && IPMI_INTEGRITY_ALGORITHM_SUPPORTED (val))
+    state->integrity_algorithm = val;
+
+ cleanup:
+  fiid_obj_destroy (obj);
+}
+
+static void
+_dump_rmcpplus (struct ipmi_trace_state *state,
+                const struct timeval *tv,
+                const char *src,
+                const char *dst,
+                const uint8_t *pkt,
+                unsigned int pkt_len)
+{
+  char hdr[IPMI_TRACE_HDR_LEN];
+  fiid_field_t *tmpl_lan_msg_hdr = NULL;
+  fiid_field_t *tmpl_cmd = NULL;
+  const uint8_t *payload;
+  unsigned int payload_len;
+  uint8_t payload_type;
+  const char *protocol = "IPMI 2.0";
+  uint8_t net_fn = 0;
+  uint8_t cmd = 0;
+  int have_cmd = 0;
+  int direction = IPMI_TRACE_UNKNOWN;
+
+  payload_type = pkt[5] & IPMI_TRACE_RMCPPLUS_PAYLOAD_TYPE_MASK;
+
+  /* without the session keys encrypted payloads cannot be decoded,
+   * nor can OEM payloads of unknown layout
+   */
+  if ((pkt[5] & IPMI_TRACE_RMCPPLUS_PAYLOAD_ENCRYPTED_MASK)
+      || payload_type == IPMI_PAYLOAD_TYPE_OEM_EXPLICIT
+      || pkt_len <= IPMI_TRACE_RMCPPLUS_PAYLOAD_OFFSET)
+    {
+      _hdr (hdr,
+            tv,
+            src,
+            dst,
+            (pkt[5] & IPMI_TRACE_RMCPPLUS_PAYLOAD_ENCRYPTED_MASK) ? "IPMI 2.0 Encrypted" : "IPMI 2.0",
+            0,
+            0,
+            0,
+            _endpoint_direction (state, src));
+      _dump_hex (hdr, pkt, pkt_len);
+      return;
+    }
+
+  payload = pkt + IPMI_TRACE_RMCPPLUS_PAYLOAD_OFFSET;
+  payload_len = pkt_len - IPMI_TRACE_RMCPPLUS_PAYLOAD_OFFSET;
+
+  switch (payload_type)
+    {
+    case IPMI_PAYLOAD_TYPE_IPMI:
+      if (payload_len < 6)
+        break;
+      net_fn = payload[1] >> 2;
+      cmd = payload[5];
+      have_cmd = 1;
+      direction = (net_fn & 0x1) ? IPMI_TRACE_RESPONSE : IPMI_TRACE_REQUEST;
+      tmpl_lan_msg_hdr = direction == IPMI_TRACE_REQUEST ? tmpl_lan_msg_hdr_rq : tmpl_lan_msg_hdr_rs;
+      tmpl_cmd = direction == IPMI_TRACE_REQUEST ? tmpl_trace_cmd_rq : tmpl_trace_cmd_rs;
+      break;
+    case IPMI_PAYLOAD_TYPE_SOL:
+      protocol = "IPMI 2.0 SOL";
+      direction = _endpoint_direction (state, src);
+      tmpl_cmd = tmpl_sol_payload_data;
+      break;
+    case IPMI_PAYLOAD_TYPE_RMCPPLUS_OPEN_SESSION_REQUEST:
+      protocol = "IPMI 2.0 Open Session";
+      direction = IPMI_TRACE_REQUEST;
+      tmpl_cmd = tmpl_rmcpplus_open_session_request;
+      break;
+    case IPMI_PAYLOAD_TYPE_RMCPPLUS_OPEN_SESSION_RESPONSE:
+      protocol = "IPMI 2.0 Open Session";
+      direction = IPMI_TRACE_RESPONSE;
+      tmpl_cmd = tmpl_rmcpplus_open_session_response;
+      _learn_algorithms (state, payload, payload_len);
+      break;
+    case IPMI_PAYLOAD_TYPE_RAKP_MESSAGE_1:
+      protocol = "IPMI 2.0 RAKP Message 1";
+      direction = IPMI_TRACE_REQUEST;
+      tmpl_cmd = tmpl_rmcpplus_rakp_message_1;
+      break;
+    case IPMI_PAYLOAD_TYPE_RAKP_MESSAGE_2:
+      protocol = "IPMI 2.0 RAKP Message 2";
+      direction = IPMI_TRACE_RESPONSE;
+      tmpl_cmd = tmpl_rmcpplus_rakp_message_2;
+      break;
+    case IPMI_PAYLOAD_TYPE_RAKP_MESSAGE_3:
+      protocol = "IPMI 2.0 RAKP Message 3";
+      direction = IPMI_TRACE_REQUEST;
+      tmpl_cmd = tmpl_rmcpplus_rakp_message_3;
+      break;
+    case IPMI_PAYLOAD_TYPE_RAKP_MESSAGE_4:
+      protocol = "IPMI 2.0 RAKP Message 4";
+      direction = IPMI_TRACE_RESPONSE;
+      tmpl_cmd = tmpl_rmcpplus_rakp_message_4;
+      break;
+    default:
+      break;
+    }
+
+  if (!tmpl_cmd)
+    {
+      _hdr (hdr, tv, src, dst, "IPMI 2.0", 0, 0, 0, _endpoint_direction (state, src));
+      _dump_hex (hdr, pkt, pkt_len);
+      return;
+    }
+
+  if (direction != IPMI_TRACE_UNKNOWN)
+    _learn_endpoint (state, src, dst, direction);
+
+  _hdr (hdr,
+        tv,
+        src,
+        dst,
+        protocol,
+        net_fn,
+        have_cmd,
+        cmd,
+        direction);
+
+  /* unencrypted payloads need no confidentiality key */
+  if (ipmi_dump_rmcpplus_packet (STDOUT_FILENO,
+                                 NULL,
+                                 hdr,
+                                 NULL,
+                                 state->authentication_algorithm,
+                                 state->integrity_algorithm,
+                                 IPMI_CONFIDENTIALITY_ALGORITHM_NONE,
+                                 NULL,
+                                 0,
+                                 NULL,
+                                 0,
+                                 pkt,
+                                 pkt_len,
+                                 tmpl_lan_msg_hdr,
+                                 tmpl_cmd) < 0)
+    err_output ("ipmi_dump_rmcpplus_packet: %s", strerror (errno));
+}
+
+static void
+_dump_outofband (struct ipmi_trace_state *state,
+                 const struct timeval *tv,
+                 const uint8_t *data,
+                 unsigned int data_len)
+{
+  char hdr[IPMI_TRACE_HDR_LEN];
+  char src[IPMI_TRACE_ENDPOINT_LEN];
+  char dst[IPMI_TRACE_ENDPOINT_LEN];
+  char addrbuf[INET6_ADDRSTRLEN];
+  unsigned int ip_hdr_len;
+  const uint8_t *udp;
+  const uint8_t *pkt;
+  unsigned int pkt_len;
+  int family;
+
+  if (data_len && (data[0] >> 4) == 4)
+    {
+      ip_hdr_len = (data[0] & 0x0F) * 4;
+      if (data_len < ip_hdr_len + IPMI_TRACE_UDP_HDR_LEN
+          || data[9] != IPMI_TRACE_IPPROTO_UDP)
+        goto unknown;
+      family = AF_INET;
+      inet_ntop (family, data + 12, addrbuf, INET6_ADDRSTRLEN);
+      udp = data + ip_hdr_len;
+      snprintf (src, IPMI_TRACE_ENDPOINT_LEN, "%s:%u", addrbuf, (udp[0] << 8) | udp[1]);
+      inet_ntop (family, data + 16, addrbuf, INET6_ADDRSTRLEN);
+      snprintf (dst, IPMI_TRACE_ENDPOINT_LEN, "%s:%u", addrbuf, (udp[2] << 8) | udp[3]);
+    }
+  else if (data_len && (data[0] >> 4) == 6)
+    {
+      ip_hdr_len = 40;
+      if (data_len < ip_hdr_len + IPMI_TRACE_UDP_HDR_LEN
+          || data[6] != IPMI_TRACE_IPPROTO_UDP)
+        goto unknown;
+      family = AF_INET6;
+      inet_ntop (family, data + 8, addrbuf, INET6_ADDRSTRLEN);
+      udp = data + ip_hdr_len;
+      snprintf (src, IPMI_TRACE_ENDPOINT_LEN, "[%s]:%u", addrbuf, (udp[0] << 8) | udp[1]);
+      inet_ntop (family, data + 24, addrbuf, INET6_ADDRSTRLEN);
+      snprintf (dst, IPMI_TRACE_ENDPOINT_LEN, "[%s]:%u", addrbuf, (udp[2] << 8) | udp[3]);
+    }
+  else
+    goto unknown;
+
+  pkt = udp + IPMI_TRACE_UDP_HDR_LEN;
+  pkt_len = data_len - ip_hdr_len - IPMI_TRACE_UDP_HDR_LEN;
+
+  if (pkt_len < 6)
+    {
+      _hdr (hdr, tv, src, dst, "RMCP", 0, 0, 0, _endpoint_direction (state, src));
+      _dump_hex (hdr, pkt, pkt_len);
+      return;
+    }
+
+  /* dispatch on the RMCP message class, the authentication type byte
+   * of an ASF message means nothing
+   */
+  if ((pkt[3] & IPMI_TRACE_RMCP_CLASS_MASK) == IPMI_TRACE_RMCP_CLASS_ASF)
+    _dump_asf (state, tv, src, dst, pkt, pkt_len);
+  else if ((pkt[3] & IPMI_TRACE_RMCP_CLASS_MASK) != IPMI_TRACE_RMCP_CLASS_IPMI)
+    {
+      _hdr (hdr, tv, src, dst, "RMCP", 0, 0, 0, _endpoint_direction (state, src));
+      _dump_hex (hdr, pkt, pkt_len);
+    }
+  else if ((pkt[4] & 0x0F) == IPMI_AUTHENTICATION_TYPE_RMCPPLUS)
+    _dump_rmcpplus (state, tv, src, dst, pkt, pkt_len);
+  else
+    _dump_lan (state, tv, src, dst, pkt, pkt_len);
+  return;
+
+ unknown:
+  _hdr (hdr, tv, NULL, NULL, "Unknown", 0, 0, 0, IPMI_TRACE_UNKNOWN);
+  _dump_hex (hdr, data, data_len);
+}
+
+static void
+_dump_inband (const struct timeval *tv,
+              const uint8_t *data,
+              unsigned int data_len)
+{
+  char hdr[IPMI_TRACE_HDR_LEN];
+  int direction;
+
+  if (data_len < 3
+      || (data[0] != IPMI_TRACE_REQUEST
+          && data[0] != IPMI_TRACE_RESPONSE))
+    {
+      _hdr (hdr, tv, NULL, NULL, "Unknown", 0, 0, 0, IPMI_TRACE_UNKNOWN);
+      _dump_hex (hdr, data, data_len);
+      return;
+    }
+
+  direction = data[0];
+
+  _hdr (hdr,
+        tv,
+        NULL,
+        NULL,
+        "Inband",
+        data[1] >> 2,
+        1,
+        data[2],
+        direction);
+
+  if (ipmi_dump_kcs_packet (STDOUT_FILENO,
+                            NULL,
+                            hdr,
+                            NULL,
+                            data + 1,
+                            data_len - 1,
+                            direction == IPMI_TRACE_REQUEST ? tmpl_trace_cmd_rq : tmpl_trace_cmd_rs) < 0)
+    err_output ("ipmi_dump_kcs_packet: %s", strerror (errno));
+}
+
+static int
+_ipmi_trace (const char *filename)
+{
+  struct ipmi_trace_state state;
+  uint8_t pcap_hdr[IPMI_TRACE_PCAP_HDR_LEN];
+  uint8_t *data = NULL;
+  uint32_t magic, network;
+  FILE *fp = NULL;
+  int rv = -1;
+
+  assert (filename);
+
+  memset (&state, '\0', sizeof (struct ipmi_trace_state));
+  state.authentication_algorithm = IPMI_AUTHENTICATION_ALGORITHM_RAKP_NONE;
+  state.integrity_algorithm = IPMI_INTEGRITY_ALGORITHM_NONE;
+
+  if (!strcmp (filename, "-"))
+    fp = stdin;
+  else if (!(fp = fopen (filename, "r")))
+    {
+      err_output ("fopen: %s: %s", filename, strerror (errno));
+      goto cleanup;
+    }
+
+  if (fread (pcap_hdr, IPMI_TRACE_PCAP_HDR_LEN, 1, fp) != 1)
+    {
+      err_output ("%s: not a pcap file", filename);
+      goto cleanup;
+    }
+
+  memcpy (&magic, pcap_hdr, sizeof (uint32_t));
+  if (magic == IPMI_TRACE_PCAP_MAGIC_SWAPPED)
+    state.swapped = 1;
+  else if (magic != IPMI_TRACE_PCAP_MAGIC)
+    {
+      err_output ("%s: not a pcap file", filename);
+      goto cleanup;
+    }
+
+  network = _get32 (&state, pcap_hdr + 20);
+  if (network != IPMI_TRACE_PCAP_LINKTYPE_RAW
+      && network != IPMI_TRACE_PCAP_LINKTYPE_USER0)
+    {
+      err_output ("%s: unsupported link type %u", filename, network);
+      goto cleanup;
+    }
+
+  if (!(data = malloc (IPMI_TRACE_PKT_LEN_MAX)))
+    err_exit ("malloc: %s", strerror (errno));
+
+  while (1)
+    {
+      uint8_t rec_hdr[IPMI_TRACE_PCAP_RECORD_HDR_LEN];
+      struct timeval tv;
+      uint32_t incl_len;
+
+      if (fread (rec_hdr, IPMI_TRACE_PCAP_RECORD_HDR_LEN, 1, fp) != 1)
+        break;
+
+      tv.tv_sec = _get32 (&state, rec_hdr);
+      tv.tv_usec = _get32 (&state, rec_hdr + 4);
+      incl_len = _get32 (&state, rec_hdr + 8);
+
+      if (incl_len > IPMI_TRACE_PKT_LEN_MAX
+          || fread (data, 1, incl_len, fp) != incl_len)
+        {
+          err_output ("%s: truncated record", filename);
+          goto cleanup;
+        }
+
+      if (network == IPMI_TRACE_PCAP_LINKTYPE_RAW)
+        _dump_outofband (&state, &tv, data, incl_len);
+      else
+        _dump_inband (&tv, data, incl_len);
+    }
+
+  if (ferror (fp))
+    {
+      err_output ("fread: %s: %s", filename, strerror (errno));
+      goto cleanup;
+    }
+
+  rv = 0;
+ cleanup:
+  free (data);
+  if (fp && fp != stdin)
+    fclose (fp);
+  return (rv);
+}
+
+int
+main (int argc, char **argv)
+{
+  struct ipmi_trace_arguments cmd_args;
+
+  err_init (argv[0]);
+  err_set_flags (ERROR_STDERR);
+
+  memset (&cmd_args, '\0', sizeof (struct ipmi_trace_arguments));
+
+  argp_parse (&cmdline_argp, argc, argv, ARGP_IN_ORDER, NULL, &cmd_args);
+
+  if (_ipmi_trace (cmd_args.filename) < 0)
+    exit (EXIT_FAILURE);
+
+  exit (EXIT_SUCCESS);
+}
@@ -0,0 +1,203 @@
+/*
+ * Copyright (C) 2003-2015 FreeIPMI Core Team
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif /* HAVE_CONFIG_H */
+
+#include <stdio.h>
+#include <stdlib.h>
+#if STDC_HEADERS
+#include <string.h>
+#endif /* STDC_HEADERS */
+#if HAVE_ARGP_H
+#include <argp.h>
+#else /* !HAVE_ARGP_H */
+#include "freeipmi-argp.h"
+#endif /* !HAVE_ARGP_H */
+#include <assert.h>
+#include <errno.h>
+
+#include "ipmibrokerd.h"
+#include "ipmibrokerd-argp.h"
+
+#include "freeipmi-portability.h"
+#include "tool-cmdline-common.h"
+#include "error.h"
+
+const char *argp_program_version =
+  "ipmibrokerd - " PACKAGE_VERSION "\n"
+  "Copyright (C) 2003-2015 FreeIPMI Core Team\n"
+  "This program is free software; you may redistribute it under the terms of\n"
+  "the GNU General Public License.  This program has absolutely no warranty.";
+
+const char *argp_program_bug_address =
+  "<" PACKAGE_BUGREPORT ">";
+
+static char cmdline_doc[] =
+  "ipmibrokerd - IPMI in-band request broker daemon";
+
+static char cmdline_args_doc[] = "";
+
+static struct argp_option cmdline_options[] =
+  {
+    ARGP_COMMON_OPTIONS_DRIVER,
+    ARGP_COMMON_OPTIONS_INBAND,
+    ARGP_COMMON_OPTIONS_WORKAROUND_FLAGS,
+    ARGP_COMMON_OPTIONS_DEBUG,
+    { "socket", IPMIBROKERD_SOCKET_KEY, "PATH", 0,
+      "Specify the Unix domain socket to accept clients on.", 40},
+    { "socket-mode", IPMIBROKERD_SOCKET_MODE_KEY, "MODE", 0,
+      "Specify the octal permissions of the socket, defaults to 0600.", 41},
+    { "cache-timeout", IPMIBROKERD_CACHE_TIMEOUT_KEY, "SECONDS", 0,
+      "Specify how long responses of static data are cached, 0 disables caching.", 42},
+    { "queue-length", IPMIBROKERD_QUEUE_LENGTH_KEY, "NUM", 0,
+      "Specify the number of requests queued for each client.", 43},
+    { "foreground", IPMIBROKERD_FOREGROUND_KEY, 0, 0,
+      "Run daemon in foreground.", 44},
+    { NULL, 0, NULL, 0, NULL, 0}
+  };
+
+static error_t cmdline_parse (int key, char *arg, struct argp_state *state);
+
+static struct argp cmdline_argp = { cmdline_options,
+                                    cmdline_parse,
+                                    cmdline_args_doc,
+                                    cmdline_doc };
+
+static error_t
+cmdline_parse (int key, char *arg, struct argp_state *state)
+{
+  struct ipmibrokerd_arguments *cmd_args;
+  char *endptr;
+  long tmp;
+
+  assert (state);
+
+  cmd_args = state->input;
+
+  switch (key)
+    {
+    case IPMIBROKERD_SOCKET_KEY:
+      free (cmd_args->socket);
+      if (!(cmd_args->socket = strdup (arg)))
+        {
+          perror ("strdup");
+          exit (EXIT_FAILURE);
+        }
+      break;
+    case IPMIBROKERD_SOCKET_MODE_KEY:
+      errno = 0;
+      tmp = strtol (arg, &endptr, 8);
+      if (errno
+          || endptr[0] != '\0'
+          || tmp < 0
+          || tmp > 0777)
+        {
+          fprintf (stderr, "invalid socket mode\n");
+          exit (EXIT_FAILURE);
+        }
+      cmd_args->socket_mode = tmp;
+      break;
+    case IPMIBROKERD_CACHE_TIMEOUT_KEY:
+      errno = 0;
+      tmp = strtol (arg, &endptr, 0);
+      if (errno
+          || endptr[0] != '\0'
+          || tmp < 0)
+        {
+          fprintf (stderr, "invalid cache timeout\n");
+          exit (EXIT_FAILURE);
+        }
+      cmd_args->cache_timeout = tmp;
+      break;
+    case IPMIBROKERD_QUEUE_LENGTH_KEY:
+      errno = 0;
+      tmp = strtol (arg, &endptr, 0);
+      if (errno
+          || endptr[0] != '\0'
+          || tmp <= 0
+          || tmp > IPMIBROKERD_QUEUE_LENGTH_MAX)
+        {
+          fprintf (stderr, "invalid queue length\n");
+          exit (EXIT_FAILURE);
+        }
+      cmd_args->queue_length = tmp;
+      break;
+    case IPMIBROKERD_FOREGROUND_KEY:
+      cmd_args->foreground = 1;
+      break;
+    case ARGP_KEY_ARG:
+      /* Too many arguments. */
+      argp_usage (state);
+      break;
+    case ARGP_KEY_END:
+      break;
+    default:
+      return (common_parse_opt (key, arg, &(cmd_args->common_args)));
+    }
+
+  return (0);
+}
+
+static void
+_ipmibrokerd_args_validate (struct ipmibrokerd_arguments *cmd_args)
+{
+  assert (cmd_args);
+
+  if (cmd_args->common_args.driver_type == IPMI_DEVICE_BROKER)
+    err_exit ("cannot broker requests to another broker");
+
+  if (cmd_args->common_args.driver_type == IPMI_DEVICE_LAN
+      || cmd_args->common_args.driver_type == IPMI_DEVICE_LAN_2_0)
+    err_exit ("only in-band drivers can be brokered");
+}
+
+void
+ipmibrokerd_argp_parse (int argc, char **argv, struct ipmibrokerd_arguments *cmd_args)
+{
+  assert (argc >= 0);
+  assert (argv);
+  assert (cmd_args);
+
+  init_common_cmd_args_admin (&(cmd_args->common_args));
+
+  if (!(cmd_args->socket = strdup (IPMI_BROKER_DRIVER_DEVICE_DEFAULT)))
+    {
+      perror ("strdup");
+      exit (EXIT_FAILURE);
+    }
+  cmd_args->socket_mode = IPMIBROKERD_SOCKET_MODE_DEFAULT;
+  cmd_args->cache_timeout = IPMIBROKERD_CACHE_TIMEOUT_DEFAULT;
+  cmd_args->queue_length = IPMIBROKERD_QUEUE_LENGTH_DEFAULT;
+  cmd_args->foreground = 0;
+
+  /* The driver settings of freeipmi.conf are meant for the clients,
+   * which may well be configured to use this broker, so the
+   * configuration file is not read.
+   */
+  argp_parse (&cmdline_argp,
+              argc,
+              argv,
+              ARGP_IN_ORDER,
+              NULL,
+              cmd_args);
+
+  verify_common_cmd_args_inband (&(cmd_args->common_args));
+  _ipmibrokerd_args_validate (cmd_args);
+}
@@ -0,0 +1,406 @@
+/*
+ * Copyright (C) 2003-2015 FreeIPMI Core Team
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif /* HAVE_CONFIG_H */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#if STDC_HEADERS
+#include <string.h>
+#endif /* STDC_HEADERS */
+#if TIME_WITH_SYS_TIME
+#include <sys/time.h>
+#include <time.h>
+#else  /* !TIME_WITH_SYS_TIME */
+#if HAVE_SYS_TIME_H
+#include <sys/time.h>
+#else /* !HAVE_SYS_TIME_H */
+#include <time.h>
+#endif  /* !HAVE_SYS_TIME_H */
+#endif /* !TIME_WITH_SYS_TIME */
+#include <assert.h>
+#include <errno.h>
+
+#include <freeipmi/freeipmi.h>
+
+#include "ipmibrokerd-cache.h"
+
+#include "freeipmi-portability.h"
+#include "error.h"
+#include "hash.h"
+
+#define IPMIBROKERD_CACHE_HASH_SIZE     1024
+#define IPMIBROKERD_CACHE_ENTRIES_MAX   16384
+
+#define IPMIBROKERD_CACHE_CLASS_NONE    0x00
+#define IPMIBROKERD_CACHE_CLASS_DEVICE  0x01
+#define IPMIBROKERD_CACHE_CLASS_SDR     0x02
+#define IPMIBROKERD_CACHE_CLASS_FRU     0x04
+#define IPMIBROKERD_CACHE_CLASS_ALL     0x07
+
+/* cmd, comp code */
+#define IPMIBROKERD_CACHE_RS_LEN_MIN    3
+
+/* offsets from the start of the request data */
+#define IPMIBROKERD_GET_SDR_RESERVATION_ID_OFFSET 0
+#define IPMIBROKERD_GET_SDR_RESERVATION_ID_LEN    2
+
+struct ipmibrokerd_cache_key
+{
+  const uint8_t *data;
+  unsigned int len;
+};
+
+struct ipmibrokerd_cache_entry
+{
+  struct ipmibrokerd_cache_key key;
+  unsigned int class;
+  time_t expiration;
+  uint8_t *rs;
+  unsigned int rs_len;
+};
+
+static hash_t cache = NULL;
+
+static unsigned int cache_timeout = 0;
+
+static unsigned int
+_cache_key_hash (const void *key)
+{
+  const struct ipmibrokerd_cache_key *k = key;
+
+  assert (k);
+
+  return (hash_key_bytes (k->data, k->len, HASH_KEY_BYTES_INIT));
+}
+
+static int
+_cache_key_cmp (const void *key1, const void *key2)
+{
+  const struct ipmibrokerd_cache_key *k1 = key1;
+  const struct ipmibrokerd_cache_key *k2 = key2;
+
+  assert (k1);
+  assert (k2);
+
+  if (k1->len != k2->len)
+    return (1);
+
+  return (memcmp (k1->data, k2->data, k1->len));
+}
+
+static void
+_cache_entry_del (void *data)
+{
+  free (data);
+}
+
+void
+ipmibrokerd_cache_setup (unsigned int timeout)
+{
+  if (!timeout)
+    return;
+
+  cache_timeout = timeout;
+
+  if (!(cache = hash_create (IPMIBROKERD_CACHE_HASH_SIZE,
+                             _cache_key_hash,
+                             _cache_key_cmp,
+                             _cache_entry_del)))
+    err_exit ("hash_create: %s", strerror (errno));
+}
+
+void
+ipmibrokerd_cache_cleanup (void)
+{
+  if (cache)
+    hash_destroy (cache);
+  cache = NULL;
+}
+
+/* class of data a request reads, IPMIBROKERD_CACHE_CLASS_NONE if the
+ * response must not be cached
+ */
+static unsigned int
+_cache_class (uint8_t net_fn, uint8_t cmd)
+{
+  if (net_fn == IPMI_NET_FN_APP_RQ)
+    {
+      if (cmd == IPMI_CMD_GET_DEVICE_ID)
+        return (IPMIBROKERD_CACHE_CLASS_DEVICE);
+    }
+  else if (net_fn == IPMI_NET_FN_STORAGE_RQ)
+    {
+      if (cmd == IPMI_CMD_GET_SDR_REPOSITORY_INFO
+          || cmd == IPMI_CMD_GET_SDR)
+        return (IPMIBROKERD_CACHE_CLASS_SDR);
+
+      if (cmd == IPMI_CMD_GET_FRU_INVENTORY_AREA_INFO
+          || cmd == IPMI_CMD_READ_FRU_DATA)
+        return (IPMIBROKERD_CACHE_CLASS_FRU);
+    }
+
+  return (IPMIBROKERD_CACHE_CLASS_NONE);
+}
+
+/* classes of data a request may change */
+static unsigned int
+_cache_flush_class (uint8_t net_fn, uint8_t cmd)
+{
+  if (net_fn == IPMI_NET_FN_APP_RQ)
+    {
+      if (cmd == IPMI_CMD_COLD_RESET
+          || cmd == IPMI_CMD_WARM_RESET)
+        return (IPMIBROKERD_CACHE_CLASS_ALL);
+    }
+  else if (net_fn == IPMI_NET_FN_STORAGE_RQ)
+    {
+      if (cmd == IPMI_CMD_ADD_SDR
+          || cmd == IPMI_CMD_PARTIAL_ADD_SDR
+          || cmd == IPMI_CMD_DELETE_SDR
+          || cmd == IPMI_CMD_CLEAR_SDR_REPOSITORY
+          || cmd == IPMI_CMD_ENTER_SDR_REPOSITORY_UPDATE_MODE
+          || cmd == IPMI_CMD_EXIT_SDR_REPOSITORY_UPDATE_MODE
+          || cmd == IPMI_CMD_RUN_INITIALIZATION_AGENT)
+        return (IPMIBROKERD_CACHE_CLASS_SDR);
+
+      if (cmd == IPMI_CMD_WRITE_FRU_DATA)
+        return (IPMIBROKERD_CACHE_CLASS_FRU);
+    }
+
+  return (IPMIBROKERD_CACHE_CLASS_NONE);
+}
+
+static int
+_cache_flush_class_callback (void *data, const void *key, void *arg)
+{
+  struct ipmibrokerd_cache_entry *entry = data;
+  unsigned int *class = arg;
+
+  assert (entry);
+  assert (class);
+
+  return ((entry->class & *class) ? 1 : 0);
+}
+
+static void
+_cache_flush (unsigned int class)
+{
+  assert (cache);
+
+  hash_delete_if (cache, _cache_flush_class_callback, &class);
+}
+
+static int
+_cache_expired_callback (void *data, const void *key, void *arg)
+{
+  struct ipmibrokerd_cache_entry *entry = data;
+  time_t *now = arg;
+
+  assert (entry);
+  assert (now);
+
+  return ((entry->expiration <= *now) ? 1 : 0);
+}
+
+/* Build the lookup key of a request in keybuf.  Returns the cache
+ * class of the request, IPMIBROKERD_CACHE_CLASS_NONE if it is not
+ * cacheable.
+ */
+static unsigned int
+_cache_key (const uint8_t *rq,
+            unsigned int rq_len,
+            uint8_t *keybuf,
+            struct ipmibrokerd_cache_key *key)
+{
+  uint8_t net_fn;
+  uint8_t cmd;
+  unsigned int class;
+
+  assert (rq);
+  assert (rq_len > IPMI_BROKER_HDR_LEN);
+  assert (rq_len <= IPMI_BROKER_PKT_LEN_MAX);
+  assert (keybuf);
+  assert (key);
+
+  net_fn = rq[IPMI_BROKER_HDR_NET_FN_LUN_INDEX] >> IPMI_BROKER_NET_FN_SHIFT;
+  cmd = rq[IPMI_BROKER_HDR_LEN];
+
+  if ((class = _cache_class (net_fn, cmd)) == IPMIBROKERD_CACHE_CLASS_NONE)
+    return (IPMIBROKERD_CACHE_CLASS_NONE);
+
+  memcpy (keybuf, rq, rq_len);
+
+  /* channel and slave address are meaningless to the BMC itself */
+  if (keybuf[IPMI_BROKER_HDR_TARGET_INDEX] == IPMI_BROKER_TARGET_BMC)
+    {
+      keybuf[IPMI_BROKER_HDR_CHANNEL_INDEX] = 0;
+      keybuf[IPMI_BROKER_HDR_RS_ADDR_INDEX] = 0;
+    }
+
+  /* Every client walks the SDR under its own reservation, the
+   * records read are the same.
+   */
+  if (net_fn == IPMI_NET_FN_STORAGE_RQ
+      && cmd == IPMI_CMD_GET_SDR
+      && rq_len >= (IPMI_BROKER_HDR_LEN
+                    + 1
+                    + IPMIBROKERD_GET_SDR_RESERVATION_ID_OFFSET
+                    + IPMIBROKERD_GET_SDR_RESERVATION_ID_LEN))
+    memset (keybuf
+            + IPMI_BROKER_HDR_LEN
+            + 1
+            + IPMIBROKERD_GET_SDR_RESERVATION_ID_OFFSET,
+            '\0',
+            IPMIBROKERD_GET_SDR_RESERVATION_ID_LEN);
+
+  key->data = keybuf;
+  key->len = rq_len;
+  return (class);
+}
+
+unsigned int
+ipmibrokerd_cache_find (const uint8_t *rq,
+                        unsigned int rq_len,
+                        uint8_t *rs,
+                        unsigned int rs_len)
+{
+  uint8_t keybuf[IPMI_BROKER_PKT_LEN_MAX];
+  struct ipmibrokerd_cache_key key;
+  struct ipmibrokerd_cache_entry *entry;
+
+  assert (rq);
+  assert (rq_len > IPMI_BROKER_HDR_LEN);
+  assert (rs);
+  assert (rs_len);
+
+  if (!cache)
+    return (0);
+
+  if (_cache_key (rq, rq_len, keybuf, &key) == IPMIBROKERD_CACHE_CLASS_NONE)
+    return (0);
+
+  if (!(entry = hash_find (cache, &key)))
+    return (0);
+
+  if (entry->expiration <= time (NULL))
+    {
+      hash_remove (cache, &key);
+      _cache_entry_del (entry);
+      return (0);
+    }
+
+  if (entry->rs_len > rs_len)
+    return (0);
+
+  memcpy (rs, entry->rs, entry->rs_len);
+  return (entry->rs_len);
+}
+
+void
+ipmibrokerd_cache_update (const uint8_t *rq,
+                          unsigned int rq_len,
+                          const uint8_t *rs,
+                          unsigned int rs_len)
+{
+  uint8_t keybuf[IPMI_BROKER_PKT_LEN_MAX];
+  struct ipmibrokerd_cache_key key;
+  struct ipmibrokerd_cache_entry *entry;
+  unsigned int class;
+  uint8_t net_fn;
+  uint8_t cmd;
+  time_t now;
+
+  assert (rq);
+  assert (rq_len > IPMI_BROKER_HDR_LEN);
+  assert (rs);
+
+  if (!cache)
+    return;
+
+  net_fn = rq[IPMI_BROKER_HDR_NET_FN_LUN_INDEX] >> IPMI_BROKER_NET_FN_SHIFT;
+  cmd = rq[IPMI_BROKER_HDR_LEN];
+
+  /* flush regardless of the completion code, a failed write may
+   * still have changed something
+   */
+  if ((class = _cache_flush_class (net_fn, cmd)) != IPMIBROKERD_CACHE_CLASS_NONE)
+    {
+      _cache_flush (class);
+      return;
+    }
+
+  if ((class = _cache_key (rq, rq_len, keybuf, &key)) == IPMIBROKERD_CACHE_CLASS_NONE)
+    return;
+
+  /* net_fn/lun, cmd, comp code */
+  if (rs_len < IPMIBROKERD_CACHE_RS_LEN_MIN
+      || rs[2] != IPMI_COMP_CODE_COMMAND_SUCCESS)
+    return;
+
+  if ((entry = hash_find (cache, &key)))
+    {
+      /* The repository info holds the time of the last addition and
+       * erase, any change means the SDR cached may be stale, e.g. it
+       * was changed by the BMC itself or another system interface.
+       */
+      if (net_fn == IPMI_NET_FN_STORAGE_RQ
+          && cmd == IPMI_CMD_GET_SDR_REPOSITORY_INFO
+          && (entry->rs_len != rs_len
+              || memcmp (entry->rs, rs, rs_len)))
+        _cache_flush (IPMIBROKERD_CACHE_CLASS_SDR);
+      else
+        {
+          hash_remove (cache, &key);
+          _cache_entry_del (entry);
+        }
+    }
+
+  now = time (NULL);
+
+  if (hash_count (cache) >= IPMIBROKERD_CACHE_ENTRIES_MAX)
+    {
+      hash_delete_if (cache, _cache_expired_callback, &now);
+      if (hash_count (cache) >= IPMIBROKERD_CACHE_ENTRIES_MAX)
+        return;
+    }
+
+  if (!(entry = malloc (sizeof (struct ipmibrokerd_cache_entry) + key.len + rs_len)))
+    {
+      err_output ("malloc: %s", strerror (errno));
+      return;
+    }
+
+  memcpy ((uint8_t *)(entry + 1), key.data, key.len);
+  entry->key.data = (uint8_t *)(entry + 1);
+  entry->key.len = key.len;
+  entry->class = class;
+  entry->expiration = now + cache_timeout;
+  entry->rs = (uint8_t *)(entry + 1) + key.len;
+  memcpy (entry->rs, rs, rs_len);
+  entry->rs_len = rs_len;
+
+  if (!hash_insert (cache, &(entry->key), entry))
+    {
+      err_output ("hash_insert: %s", strerror (errno));
+      _cache_entry_del (entry);
+    }
+}
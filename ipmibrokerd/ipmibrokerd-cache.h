@@ -0,0 +1,52 @@
+/*
+ * Copyright (C) 2003-2015 FreeIPMI Core Team
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef IPMIBROKERD_CACHE_H
+#define IPMIBROKERD_CACHE_H
+
+#include <stdint.h>
+
+/* Responses to requests for data the BMC rarely changes (device id,
+ * SDR and FRU reads) are cached, so that tools started one after
+ * another do not each walk the SDR again over the system interface.
+ * Requests that change the data flush the affected entries.
+ *
+ * Requests are passed with their broker header, responses starting
+ * with the net_fn/lun byte, see ipmi-broker-driver.h.
+ */
+
+/* timeout of 0 disables the cache */
+void ipmibrokerd_cache_setup (unsigned int timeout);
+
+void ipmibrokerd_cache_cleanup (void);
+
+/* returns length of response copied to rs, 0 if not cached */
+unsigned int ipmibrokerd_cache_find (const uint8_t *rq,
+                                     unsigned int rq_len,
+                                     uint8_t *rs,
+                                     unsigned int rs_len);
+
+/* note a response received from the BMC, caching it if appropriate
+ * and flushing entries the request may have made stale
+ */
+void ipmibrokerd_cache_update (const uint8_t *rq,
+                               unsigned int rq_len,
+                               const uint8_t *rs,
+                               unsigned int rs_len);
+
+#endif /* IPMIBROKERD_CACHE_H */
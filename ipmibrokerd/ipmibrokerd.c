@@ -0,0 +1,610 @@
+/*
+ * Copyright (C) 2003-2015 FreeIPMI Core Team
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif /* HAVE_CONFIG_H */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#if STDC_HEADERS
+#include <string.h>
+#endif /* STDC_HEADERS */
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <sys/poll.h>
+#if HAVE_UNISTD_H
+#include <unistd.h>
+#endif /* HAVE_UNISTD_H */
+#if HAVE_FCNTL_H
+#include <fcntl.h>
+#endif /* HAVE_FCNTL_H */
+#include <syslog.h>
+#include <signal.h>
+#include <assert.h>
+#include <errno.h>
+
+#include <freeipmi/freeipmi.h>
+
+#include "ipmibrokerd.h"
+#include "ipmibrokerd-argp.h"
+#include "ipmibrokerd-cache.h"
+
+#include "freeipmi-portability.h"
+#include "error.h"
+#include "parse-common.h"
+#include "tool-util-common.h"
+#include "tool-daemon-common.h"
+
+#define IPMIBROKERD_PIDFILE IPMIBROKERD_LOCALSTATEDIR "/run/ipmibrokerd.pid"
+
+#define IPMIBROKERD_CLIENTS_MAX      256
+#define IPMIBROKERD_LISTEN_BACKLOG   16
+
+/* net_fn/lun, cmd, comp code */
+#define IPMIBROKERD_RS_ERROR_LEN     3
+
+struct ipmibrokerd_rq
+{
+  uint8_t buf[IPMI_BROKER_PKT_LEN_MAX];
+  unsigned int len;
+};
+
+/* Requests of a client are answered in the order they were sent, so
+ * each client has its own queue and the BMC is shared among clients
+ * round robin, one request at a time.
+ */
+struct ipmibrokerd_client
+{
+  int fd;
+  struct ipmibrokerd_rq *queue;
+  unsigned int queue_head;
+  unsigned int queue_count;
+};
+
+struct ipmibrokerd_arguments cmd_args;
+
+static ipmi_ctx_t ipmi_ctx = NULL;
+
+static int listen_fd = -1;
+
+static struct ipmibrokerd_client clients[IPMIBROKERD_CLIENTS_MAX];
+
+/* next client to serve */
+static unsigned int clients_next = 0;
+
+static int exit_flag = 1;
+
+static void
+_ipmibrokerd_ipmi_setup (void)
+{
+  unsigned int workaround_flags = 0;
+  unsigned int flags = IPMI_FLAGS_DEFAULT;
+
+  /* the mock driver needs no device access */
+  if (cmd_args.common_args.driver_type != IPMI_DEVICE_MOCK
+      && !ipmi_is_root ())
+    err_exit ("Permission denied, must be root.");
+
+  parse_get_freeipmi_inband_flags (cmd_args.common_args.workaround_flags_inband,
+                                   &workaround_flags);
+
+  if (cmd_args.foreground
+      && cmd_args.common_args.debug)
+    flags |= IPMI_FLAGS_DEBUG_DUMP;
+
+  if (!(ipmi_ctx = ipmi_ctx_create ()))
+    err_exit ("ipmi_ctx_create: %s", strerror (errno));
+
+  if (cmd_args.common_args.driver_type == IPMI_DEVICE_UNKNOWN)
+    {
+      int ret;
+
+      if ((ret = ipmi_ctx_find_inband (ipmi_ctx,
+                                       NULL,
+                                       cmd_args.common_args.disable_auto_probe,
+                                       cmd_args.common_args.driver_address,
+                                       cmd_args.common_args.register_spacing,
+                                       cmd_args.common_args.driver_device,
+                                       workaround_flags,
+                                       flags)) < 0)
+        err_exit ("ipmi_ctx_find_inband: %s", ipmi_ctx_errormsg (ipmi_ctx));
+
+      if (!ret)
+        err_exit ("could not find inband device");
+    }
+  else
+    {
+      if (ipmi_ctx_open_inband (ipmi_ctx,
+                                cmd_args.common_args.driver_type,
+                                cmd_args.common_args.disable_auto_probe,
+                                cmd_args.common_args.driver_address,
+                                cmd_args.common_args.register_spacing,
+                                cmd_args.common_args.driver_device,
+                                workaround_flags,
+                                flags) < 0)
+        err_exit ("ipmi_ctx_open_inband: %s", ipmi_ctx_errormsg (ipmi_ctx));
+    }
+}
+
+static void
+_ipmibrokerd_socket_setup (void)
+{
+  struct sockaddr_un addr;
+  struct stat buf;
+
+  assert (cmd_args.socket);
+
+  memset (&addr, '\0', sizeof (struct sockaddr_un));
+  addr.sun_family = AF_UNIX;
+
+  if (strlen (cmd_args.socket) >= sizeof (addr.sun_path))
+    err_exit ("socket path '%s' too long", cmd_args.socket);
+
+  strcpy (addr.sun_path, cmd_args.socket);
+
+  if ((listen_fd = socket (AF_UNIX, SOCK_SEQPACKET, 0)) < 0)
+    err_exit ("socket: %s", strerror (errno));
+
+  /* Remove a socket left behind by an earlier instance, but do not
+   * steal the socket of a running one.
+   */
+  if (!lstat (cmd_args.socket, &buf))
+    {
+      if (!S_ISSOCK (buf.st_mode))
+        err_exit ("'%s' exists and is not a socket", cmd_args.socket);
+
+      if (!connect (listen_fd, (struct sockaddr *)&addr, sizeof (struct sockaddr_un)))
+        err_exit ("another broker is listening on '%s'", cmd_args.socket);
+
+      if (unlink (cmd_args.socket) < 0)
+        err_exit ("unlink: %s", strerror (errno));
+    }
+
+  if (bind (listen_fd, (struct sockaddr *)&addr, sizeof (struct sockaddr_un)) < 0)
+    err_exit ("bind: %s", strerror (errno));
+
+  /* daemonization clears the umask, set permissions explicitly */
+  if (chmod (cmd_args.socket, cmd_args.socket_mode) < 0)
+    err_exit ("chmod: %s", strerror (errno));
+
+  if (listen (listen_fd, IPMIBROKERD_LISTEN_BACKLOG) < 0)
+    err_exit ("listen: %s", strerror (errno));
+
+  if (fcntl (listen_fd, F_SETFL, O_NONBLOCK) < 0)
+    err_exit ("fcntl: %s", strerror (errno));
+}
+
+static void
+_client_close (struct ipmibrokerd_client *c)
+{
+  assert (c);
+  assert (c->fd >= 0);
+
+  /* ignore potential error, done w/ client */
+  close (c->fd);
+  free (c->queue);
+  c->fd = -1;
+  c->queue = NULL;
+  c->queue_head = 0;
+  c->queue_count = 0;
+}
+
+static void
+_client_accept (void)
+{
+  unsigned int i;
+  int fd;
+
+  if ((fd = accept (listen_fd, NULL, NULL)) < 0)
+    {
+      if (errno != EAGAIN
+          && errno != EWOULDBLOCK
+          && errno != EINTR
+          && errno != ECONNABORTED)
+        err_output ("accept: %s", strerror (errno));
+      return;
+    }
+
+  if (fcntl (fd, F_SETFL, O_NONBLOCK) < 0
+      || fcntl (fd, F_SETFD, FD_CLOEXEC) < 0)
+    {
+      err_output ("fcntl: %s", strerror (errno));
+      close (fd);
+      return;
+    }
+
+  for (i = 0; i < IPMIBROKERD_CLIENTS_MAX; i++)
+    {
+      if (clients[i].fd < 0)
+        break;
+    }
+
+  if (i == IPMIBROKERD_CLIENTS_MAX)
+    {
+      err_output ("too many clients, connection refused");
+      close (fd);
+      return;
+    }
+
+  if (!(clients[i].queue = calloc (cmd_args.queue_length, sizeof (struct ipmibrokerd_rq))))
+    {
+      err_output ("calloc: %s", strerror (errno));
+      close (fd);
+      return;
+    }
+
+  clients[i].fd = fd;
+  clients[i].queue_head = 0;
+  clients[i].queue_count = 0;
+}
+
+/* returns 0 on success, -1 if the client was closed */
+static int
+_client_send (struct ipmibrokerd_client *c, const uint8_t *rs, unsigned int rs_len)
+{
+  assert (c);
+  assert (c->fd >= 0);
+  assert (rs);
+  assert (rs_len);
+
+  /* a client not reading its responses is dropped rather than
+   * holding up everyone else
+   */
+  if (send (c->fd, rs, rs_len, MSG_DONTWAIT | MSG_NOSIGNAL) < 0)
+    {
+      if (errno != EPIPE
+          && errno != ECONNRESET)
+        err_output ("send: %s", strerror (errno));
+      _client_close (c);
+      return (-1);
+    }
+
+  return (0);
+}
+
+static void
+_client_recv (struct ipmibrokerd_client *c, short revents)
+{
+  uint8_t rs[IPMI_BROKER_PKT_LEN_MAX];
+  unsigned int rs_len;
+
+  assert (c);
+  assert (c->fd >= 0);
+
+  /* hung up with requests still queued, no one to answer to */
+  if (c->queue_count == cmd_args.queue_length)
+    {
+      if (revents & (POLLHUP | POLLERR))
+        _client_close (c);
+      return;
+    }
+
+  while (c->queue_count < cmd_args.queue_length)
+    {
+      struct ipmibrokerd_rq *rq;
+      ssize_t n;
+
+      rq = &c->queue[(c->queue_head + c->queue_count) % cmd_args.queue_length];
+
+      if ((n = recv (c->fd, rq->buf, IPMI_BROKER_PKT_LEN_MAX, MSG_DONTWAIT)) < 0)
+        {
+          if (errno == EAGAIN
+              || errno == EWOULDBLOCK
+              || errno == EINTR)
+            return;
+          if (errno != ECONNRESET)
+            err_output ("recv: %s", strerror (errno));
+          _client_close (c);
+          return;
+        }
+
+      if (!n)
+        {
+          _client_close (c);
+          return;
+        }
+
+      /* header and command at minimum */
+      if (n <= IPMI_BROKER_HDR_LEN)
+        {
+          err_output ("malformed request of length %d", (int)n);
+          _client_close (c);
+          return;
+        }
+
+      rq->len = n;
+
+      /* answer from the cache right away, unless it would overtake
+       * an earlier request of the client
+       */
+      if (!c->queue_count
+          && (rs_len = ipmibrokerd_cache_find (rq->buf, rq->len, rs, IPMI_BROKER_PKT_LEN_MAX)))
+        {
+          if (_client_send (c, rs, rs_len) < 0)
+            return;
+          continue;
+        }
+
+      c->queue_count++;
+    }
+}
+
+static uint8_t
+_ipmibrokerd_comp_code (void)
+{
+  switch (ipmi_ctx_errnum (ipmi_ctx))
+    {
+    case IPMI_ERR_DRIVER_TIMEOUT:
+    case IPMI_ERR_MESSAGE_TIMEOUT:
+      return (IPMI_COMP_CODE_COMMAND_TIMEOUT);
+    case IPMI_ERR_DRIVER_BUSY:
+    case IPMI_ERR_BMC_BUSY:
+      return (IPMI_COMP_CODE_NODE_BUSY);
+    default:
+      return (IPMI_COMP_CODE_UNSPECIFIED_ERROR);
+    }
+}
+
+/* returns length of response */
+static unsigned int
+_ipmibrokerd_cmd (const uint8_t *rq,
+                  unsigned int rq_len,
+                  uint8_t *rs,
+                  unsigned int rs_len)
+{
+  uint8_t target;
+  uint8_t channel_number;
+  uint8_t rs_addr;
+  uint8_t net_fn;
+  uint8_t lun;
+  int len;
+
+  assert (rq);
+  assert (rq_len > IPMI_BROKER_HDR_LEN);
+  assert (rs);
+  assert (rs_len > IPMIBROKERD_RS_ERROR_LEN);
+
+  target = rq[IPMI_BROKER_HDR_TARGET_INDEX];
+  channel_number = rq[IPMI_BROKER_HDR_CHANNEL_INDEX];
+  rs_addr = rq[IPMI_BROKER_HDR_RS_ADDR_INDEX];
+  net_fn = rq[IPMI_BROKER_HDR_NET_FN_LUN_INDEX] >> IPMI_BROKER_NET_FN_SHIFT;
+  lun = rq[IPMI_BROKER_HDR_NET_FN_LUN_INDEX] & IPMI_BROKER_LUN_MASK;
+
+  rs[0] = ((net_fn | IPMI_NET_FN_RQ_RS_MASK) << IPMI_BROKER_NET_FN_SHIFT) | lun;
+  rs[1] = rq[IPMI_BROKER_HDR_LEN];
+
+  if (!IPMI_NET_FN_RQ_VALID (net_fn)
+      || !IPMI_BMC_LUN_VALID (lun)
+      || (target != IPMI_BROKER_TARGET_BMC
+          && target != IPMI_BROKER_TARGET_IPMB)
+      || (target == IPMI_BROKER_TARGET_IPMB
+          && !IPMI_CHANNEL_NUMBER_VALID (channel_number)))
+    {
+      rs[2] = IPMI_COMP_CODE_INVALID_DATA_FIELD_IN_REQUEST;
+      return (IPMIBROKERD_RS_ERROR_LEN);
+    }
+
+  if (target == IPMI_BROKER_TARGET_BMC)
+    len = ipmi_cmd_raw (ipmi_ctx,
+                        lun,
+                        net_fn,
+                        rq + IPMI_BROKER_HDR_LEN,
+                        rq_len - IPMI_BROKER_HDR_LEN,
+                        rs + 1,
+                        rs_len - 1);
+  else
+    len = ipmi_cmd_raw_ipmb (ipmi_ctx,
+                             channel_number,
+                             rs_addr,
+                             lun,
+                             net_fn,
+                             rq + IPMI_BROKER_HDR_LEN,
+                             rq_len - IPMI_BROKER_HDR_LEN,
+                             rs + 1,
+                             rs_len - 1);
+
+  /* cmd and comp code at minimum */
+  if (len < 2)
+    {
+      if (len < 0)
+        err_output ("ipmi_cmd_raw: netfn=0x%02X cmd=0x%02X: %s",
+                    net_fn,
+                    rq[IPMI_BROKER_HDR_LEN],
+                    ipmi_ctx_errormsg (ipmi_ctx));
+      rs[2] = len < 0 ? _ipmibrokerd_comp_code () : IPMI_COMP_CODE_UNSPECIFIED_ERROR;
+      return (IPMIBROKERD_RS_ERROR_LEN);
+    }
+
+  return (len + 1);
+}
+
+/* serve the oldest request of the next client with requests queued */
+static void
+_ipmibrokerd_serve (void)
+{
+  uint8_t rs[IPMI_BROKER_PKT_LEN_MAX];
+  unsigned int rs_len;
+  unsigned int i;
+
+  for (i = 0; i < IPMIBROKERD_CLIENTS_MAX; i++)
+    {
+      struct ipmibrokerd_client *c;
+      struct ipmibrokerd_rq *rq;
+      unsigned int index;
+
+      index = (clients_next + i) % IPMIBROKERD_CLIENTS_MAX;
+      c = &clients[index];
+
+      if (c->fd < 0 || !c->queue_count)
+        continue;
+
+      rq = &c->queue[c->queue_head];
+      c->queue_head = (c->queue_head + 1) % cmd_args.queue_length;
+      c->queue_count--;
+
+      /* may have been cached while queued */
+      if (!(rs_len = ipmibrokerd_cache_find (rq->buf, rq->len, rs, IPMI_BROKER_PKT_LEN_MAX)))
+        {
+          rs_len = _ipmibrokerd_cmd (rq->buf, rq->len, rs, IPMI_BROKER_PKT_LEN_MAX);
+          ipmibrokerd_cache_update (rq->buf, rq->len, rs, rs_len);
+        }
+
+      _client_send (c, rs, rs_len);
+
+      clients_next = (index + 1) % IPMIBROKERD_CLIENTS_MAX;
+      return;
+    }
+}
+
+static int
+_ipmibrokerd_queued (void)
+{
+  unsigned int i;
+
+  for (i = 0; i < IPMIBROKERD_CLIENTS_MAX; i++)
+    {
+      if (clients[i].fd >= 0 && clients[i].queue_count)
+        return (1);
+    }
+
+  return (0);
+}
+
+static void
+_signal_handler_callback (int sig)
+{
+  exit_flag = 0;
+}
+
+static void
+_ipmibrokerd_loop (void)
+{
+  /* +1 fd for the listening socket */
+  struct pollfd pfds[IPMIBROKERD_CLIENTS_MAX + 1];
+  unsigned int pfds_index[IPMIBROKERD_CLIENTS_MAX + 1];
+  unsigned int i;
+
+  for (i = 0; i < IPMIBROKERD_CLIENTS_MAX; i++)
+    clients[i].fd = -1;
+
+  while (exit_flag)
+    {
+      unsigned int nfds = 0;
+
+      pfds[nfds].fd = listen_fd;
+      pfds[nfds].events = POLLIN;
+      pfds[nfds].revents = 0;
+      nfds++;
+
+      for (i = 0; i < IPMIBROKERD_CLIENTS_MAX; i++)
+        {
+          if (clients[i].fd < 0)
+            continue;
+
+          pfds[nfds].fd = clients[i].fd;
+          /* stop reading a client whose queue is full */
+          pfds[nfds].events = clients[i].queue_count < cmd_args.queue_length ? POLLIN : 0;
+          pfds[nfds].revents = 0;
+          pfds_index[nfds] = i;
+          nfds++;
+        }
+
+      if (poll (pfds, nfds, _ipmibrokerd_queued () ? 0 : -1) < 0)
+        {
+          if (errno == EINTR)
+            continue;
+          err_exit ("poll: %s", strerror (errno));
+        }
+
+      for (i = 1; i < nfds; i++)
+        {
+          if (pfds[i].revents)
+            _client_recv (&clients[pfds_index[i]], pfds[i].revents);
+        }
+
+      if (pfds[0].revents & POLLIN)
+        _client_accept ();
+
+      _ipmibrokerd_serve ();
+    }
+}
+
+static void
+_ipmibrokerd_cleanup (void)
+{
+  unsigned int i;
+
+  for (i = 0; i < IPMIBROKERD_CLIENTS_MAX; i++)
+    {
+      if (clients[i].fd >= 0)
+        _client_close (&clients[i]);
+    }
+
+  /* ignore potential errors, exiting */
+  close (listen_fd);
+  unlink (cmd_args.socket);
+
+  ipmibrokerd_cache_cleanup ();
+
+  ipmi_ctx_close (ipmi_ctx);
+  ipmi_ctx_destroy (ipmi_ctx);
+}
+
+int
+main (int argc, char **argv)
+{
+  err_init (argv[0]);
+  err_set_flags (ERROR_STDERR);
+
+  ipmi_disable_coredump ();
+
+  ipmibrokerd_argp_parse (argc, argv, &cmd_args);
+
+  if (!cmd_args.foreground)
+    {
+      daemonize_common (IPMIBROKERD_PIDFILE);
+      err_set_flags (ERROR_SYSLOG);
+    }
+  else
+    err_set_flags (ERROR_STDERR);
+
+  daemon_signal_handler_setup (_signal_handler_callback);
+
+  /* Call after daemonization, since daemonization closes currently
+   * open fds
+   */
+  if (argv[0][0] == '/')
+    argv[0] = strrchr (argv[0], '/') + 1;
+  openlog (argv[0], LOG_ODELAY | LOG_PID, LOG_DAEMON);
+
+  _ipmibrokerd_ipmi_setup ();
+
+  ipmibrokerd_cache_setup (cmd_args.cache_timeout);
+
+  _ipmibrokerd_socket_setup ();
+
+  _ipmibrokerd_loop ();
+
+  _ipmibrokerd_cleanup ();
+
+  return (0);
+}
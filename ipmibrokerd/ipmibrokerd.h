@@ -0,0 +1,59 @@
+/*
+ * Copyright (C) 2003-2015 FreeIPMI Core Team
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef IPMIBROKERD_H
+#define IPMIBROKERD_H
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif /* HAVE_CONFIG_H */
+
+#include <sys/types.h>
+
+#include <freeipmi/freeipmi.h>
+
+#include "tool-cmdline-common.h"
+
+#define IPMIBROKERD_SOCKET_MODE_DEFAULT   0600
+
+#define IPMIBROKERD_CACHE_TIMEOUT_DEFAULT 60
+
+#define IPMIBROKERD_QUEUE_LENGTH_DEFAULT  16
+
+#define IPMIBROKERD_QUEUE_LENGTH_MAX      1024
+
+enum ipmibrokerd_argp_option_keys
+  {
+    IPMIBROKERD_SOCKET_KEY = 160,
+    IPMIBROKERD_SOCKET_MODE_KEY = 161,
+    IPMIBROKERD_CACHE_TIMEOUT_KEY = 162,
+    IPMIBROKERD_QUEUE_LENGTH_KEY = 163,
+    IPMIBROKERD_FOREGROUND_KEY = 164,
+  };
+
+struct ipmibrokerd_arguments
+{
+  struct common_cmd_args common_args;
+  char *socket;
+  mode_t socket_mode;
+  unsigned int cache_timeout;
+  unsigned int queue_length;
+  int foreground;
+};
+
+#endif /* IPMIBROKERD_H */
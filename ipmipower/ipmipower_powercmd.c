@@ -153,6 +153,18 @@ _destroy_ipmipower_powercmd (void *x)
   fiid_obj_destroy (ip->obj_close_session_rq);
   fiid_obj_destroy (ip->obj_close_session_rs);
 
+  /* Release crypt state cached against this session's keys */
+  if (cmd_args.common_args.driver_type == IPMI_DEVICE_LAN_2_0)
+    {
+      ipmi_flush_rmcpplus_session_keys (ip->integrity_key_ptr,
+                                        ip->integrity_key_len,
+                                        ip->confidentiality_key_ptr,
+                                        ip->confidentiality_key_len);
+      secure_memset (ip->sik_key, '\0', IPMI_MAX_SIK_KEY_LENGTH);
+      secure_memset (ip->integrity_key, '\0', IPMI_MAX_INTEGRITY_KEY_LENGTH);
+      secure_memset (ip->confidentiality_key, '\0', IPMI_MAX_CONFIDENTIALITY_KEY_LENGTH);
+    }
+
   /* Close all sockets that were saved during the Get Session
    * Challenge phase of the IPMI protocol.
    */
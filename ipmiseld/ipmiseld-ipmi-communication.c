@@ -177,7 +177,10 @@ ipmiseld_ipmi_setup (ipmiseld_host_data_t *host_data)
     }
   else
     {
-      if (!ipmi_is_root ())
+      /* the mock and broker drivers need no device access */
+      if (common_args->driver_type != IPMI_DEVICE_MOCK
+          && common_args->driver_type != IPMI_DEVICE_BROKER
+          && !ipmi_is_root ())
         {
           ipmiseld_err_output (host_data, "%s", ipmi_ctx_strerror (IPMI_ERR_PERMISSION));
           goto cleanup;
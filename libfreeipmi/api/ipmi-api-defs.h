@@ -24,6 +24,8 @@
 #endif /* HAVE_CONFIG_H */
 
 #include <stdint.h>
+#include <sys/types.h>
+#include <sys/socket.h>
 #include <netinet/in.h>
 #include <sys/param.h>
 #if TIME_WITH_SYS_TIME
@@ -43,8 +45,11 @@
 
 #include "freeipmi/cmds/ipmi-messaging-support-cmds.h"
 #include "freeipmi/fiid/fiid.h"
+#include "freeipmi/interface/ipmi-rmcpplus-interface.h"
+#include "freeipmi/driver/ipmi-broker-driver.h"
 #include "freeipmi/driver/ipmi-inteldcmi-driver.h"
 #include "freeipmi/driver/ipmi-kcs-driver.h"
+#include "freeipmi/driver/ipmi-mock-driver.h"
 #include "freeipmi/driver/ipmi-openipmi-driver.h"
 #include "freeipmi/driver/ipmi-ssif-driver.h"
 #include "freeipmi/driver/ipmi-sunbmc-driver.h"
@@ -67,6 +72,8 @@
 
 #define MAXPORTBUFLEN 16
 
+#define IPMI_CTX_OBJ_POOL_LEN                             16
+
 struct ipmi_ctx_target
 {
   uint8_t channel_number;       /* for ipmb */
@@ -77,6 +84,166 @@ struct ipmi_ctx_target
   uint8_t net_fn;
 };
 
+/* pooled command objects, cleared rather than destroyed between
+ * commands
+ */
+struct ipmi_ctx_obj_pool_entry
+{
+  fiid_field_t *tmpl;
+  fiid_obj_t obj;
+  int in_use;
+};
+
+struct socket_to_close;
+struct ipmi_mux_peer;
+
+/* Traced packets are records of a ring buffer, addressed by byte
+ * offsets that only ever increase and are taken modulo the buffer
+ * size.  Records never wrap around the end of the buffer.  head and
+ * tail are volatile because the buffer may be written out from a
+ * signal handler interrupting a packet being recorded.
+ */
+struct ipmi_ctx_pkt_trace
+{
+  uint8_t *buf;                 /* NULL if tracing is disabled */
+  unsigned int size;
+  volatile unsigned long head;  /* end of the newest record */
+  volatile unsigned long tail;  /* start of the oldest record */
+
+  /* local address of the outofband socket, looked up when the
+   * socket changes
+   */
+  int sockfd;
+  struct sockaddr_storage local;
+};
+
+/* one request/response exchange with a LAN or LAN_2_0 BMC, shared
+ * by the blocking command wrappers and the asynchronous interface
+ */
+struct ipmi_ctx_exchange
+{
+  int rmcpplus;
+  unsigned int internal_workaround_flags;
+  uint8_t lun;
+  uint8_t net_fn;
+
+  /* IPMI 1.5 */
+  uint8_t authentication_type;
+  int check_authentication_code;
+
+  /* IPMI 2.0 */
+  uint8_t payload_type;
+  uint8_t payload_authenticated;
+  uint8_t payload_encrypted;
+  uint8_t *message_tag;
+  uint8_t authentication_algorithm;
+  uint8_t integrity_algorithm;
+  uint8_t confidentiality_algorithm;
+  const void *integrity_key;
+  unsigned int integrity_key_len;
+  const void *confidentiality_key;
+  unsigned int confidentiality_key_len;
+
+  uint32_t *session_sequence_number;
+  uint32_t session_id;
+  uint8_t *rq_seq;
+  const char *password;
+  unsigned int password_len;
+  fiid_obj_t obj_cmd_rq;
+  fiid_obj_t obj_cmd_rs;
+
+  unsigned int retransmission_count;
+  struct timeval last_send;
+  struct timeval first_send;
+  /* counters of the command, NULL if not counted */
+  struct ipmi_stats_counters *stats;
+  uint8_t cmd;                  /* for debug dumping */
+  uint8_t group_extension;      /* for debug dumping */
+  struct socket_to_close *sockets;
+};
+
+/* steps match the IPMI_STATS_SESSION_SETUP_* phases */
+#define IPMI_SESSION_SETUP_GET_CHANNEL_AUTHENTICATION_CAPABILITIES 0
+#define IPMI_SESSION_SETUP_GET_SESSION_CHALLENGE                   1
+#define IPMI_SESSION_SETUP_ACTIVATE_SESSION                        2
+#define IPMI_SESSION_SETUP_OPEN_SESSION                            3
+#define IPMI_SESSION_SETUP_RAKP_MESSAGE_1                          4
+#define IPMI_SESSION_SETUP_RAKP_MESSAGE_3                          5
+#define IPMI_SESSION_SETUP_SET_SESSION_PRIVILEGE_LEVEL             6
+#define IPMI_SESSION_SETUP_DONE                                    7
+
+/* progress of IPMI 1.5 or IPMI 2.0 session establishment, one step
+ * per request/response exchange
+ */
+struct ipmi_ctx_session_setup
+{
+  int step;
+  fiid_obj_t obj_cmd_rq;
+  fiid_obj_t obj_cmd_rs;
+
+  /* IPMI 1.5 */
+  uint32_t temp_session_id;
+  uint8_t challenge_string[IPMI_CHALLENGE_STRING_LENGTH];
+  unsigned int challenge_string_len;
+
+  /* IPMI 2.0 */
+  uint8_t message_tag;
+  uint8_t requested_maximum_privilege;
+  uint8_t remote_console_random_number[IPMI_REMOTE_CONSOLE_RANDOM_NUMBER_LENGTH];
+  uint8_t managed_system_random_number[IPMI_MANAGED_SYSTEM_RANDOM_NUMBER_LENGTH];
+  unsigned int managed_system_random_number_len;
+  uint8_t managed_system_guid[IPMI_MANAGED_SYSTEM_GUID_LENGTH];
+  unsigned int managed_system_guid_len;
+  uint8_t key_exchange_authentication_code[IPMI_MAX_KEY_EXCHANGE_AUTHENTICATION_CODE_LENGTH];
+  unsigned int key_exchange_authentication_code_len;
+
+  /* session negotiation cache, set if authentication capabilities
+   * were taken from the cache instead of asked for
+   */
+  int cached;
+  uint8_t per_msg_auth_disabled;
+};
+
+#define IPMI_CTX_ASYNC_OP_NONE                            0
+#define IPMI_CTX_ASYNC_OP_OPEN_SESSION                    1
+#define IPMI_CTX_ASYNC_OP_CMD                             2
+
+#define IPMI_CTX_ASYNC_RQ_FREE                            0
+#define IPMI_CTX_ASYNC_RQ_PENDING                         1
+#define IPMI_CTX_ASYNC_RQ_DONE                            2
+
+/* one asynchronous command of the window, in flight or completed
+ * but not yet reported to its callback
+ */
+struct ipmi_ctx_async_rq
+{
+  int state;
+  struct ipmi_ctx_exchange exchange;
+  /* sequence numbers of the last transmission */
+  uint8_t rq_seq;
+  uint32_t session_sequence_number;
+  int rv;
+  ipmi_errnum_type_t errnum;
+  Ipmi_Ctx_Async_Callback callback;
+  void *callback_data;
+};
+
+/* outstanding asynchronous outofband operations, either one session
+ * open or up to a window of commands
+ */
+struct ipmi_ctx_async
+{
+  int op;
+  int in_exchange;
+  struct ipmi_ctx_exchange exchange;
+  struct ipmi_ctx_session_setup setup;
+  Ipmi_Ctx_Async_Callback callback;
+  void *callback_data;
+
+  struct ipmi_ctx_async_rq rq[IPMI_ASYNC_WINDOW_MAX];
+  unsigned int rq_count;
+};
+
 struct ipmi_ctx
 {
   uint32_t magic;
@@ -94,6 +261,39 @@ struct ipmi_ctx
 
   ipmi_errnum_type_t errnum;
 
+  /* maximum outstanding asynchronous commands */
+  unsigned int async_window;
+
+  /* shared sockets for outofband sessions, NULL if not shared */
+  ipmi_mux_t mux;
+
+  /* bounds of adaptive retransmission timeouts in milliseconds, 0
+   * if disabled
+   */
+  unsigned int retransmission_timeout_floor;
+  unsigned int retransmission_timeout_ceiling;
+
+  /* directory of the session negotiation cache, NULL if disabled */
+  char *session_cache_directory;
+
+  struct ipmi_stats stats;
+  /* counters of the blocking command in progress, NULL if none */
+  struct ipmi_stats_counters *stats_cmd;
+
+  /* packet trace ring buffer, see ipmi-pkt-trace.c */
+  struct ipmi_ctx_pkt_trace pkt_trace;
+
+  /* temporary objects of a command round trip, released together */
+  fiid_arena_t arena;
+  unsigned int arena_depth;
+
+  struct ipmi_ctx_obj_pool_entry obj_pool[IPMI_CTX_OBJ_POOL_LEN];
+  unsigned int obj_pool_next;
+
+  /* packet buffer reused by the driver send/receive paths */
+  uint8_t *pkt_buf;
+  unsigned int pkt_buf_len;
+
   union
   {
     struct
@@ -101,8 +301,12 @@ struct ipmi_ctx
       ipmi_kcs_ctx_t kcs_ctx;
       ipmi_ssif_ctx_t ssif_ctx;
       ipmi_openipmi_ctx_t openipmi_ctx;
+      /* set if openipmi_ctx is owned by another context */
+      int openipmi_ctx_shared;
       ipmi_sunbmc_ctx_t sunbmc_ctx;
       ipmi_inteldcmi_ctx_t inteldcmi_ctx;
+      ipmi_mock_ctx_t mock_ctx;
+      ipmi_broker_ctx_t broker_ctx;
 
       uint8_t rq_seq;
 
@@ -120,6 +324,8 @@ struct ipmi_ctx
     struct
     {
       int sockfd;
+      /* set if sockfd is shared through ctx->mux */
+      struct ipmi_mux_peer *mux_peer;
 
       char hostname[MAXHOSTNAMELEN+1];
 
@@ -160,6 +366,15 @@ struct ipmi_ctx
       uint32_t highest_received_sequence_number;
       uint32_t previously_received_list;
 
+      /* round trip time estimate and adaptive retransmission
+       * timeout in microseconds
+       */
+      unsigned int srtt;
+      unsigned int rttvar;
+      unsigned int rtt_samples;
+      unsigned int rto;
+      struct timeval rto_backoff;
+
       /* Used by IPMI 1.5 */
       uint32_t session_id;
 
@@ -183,6 +398,8 @@ struct ipmi_ctx
       void *confidentiality_key_ptr;
       unsigned int confidentiality_key_len;
 
+      struct ipmi_ctx_async async;
+
       struct
       {
         fiid_obj_t obj_rmcp_hdr;
@@ -201,6 +418,14 @@ struct ipmi_ctx
         fiid_obj_t obj_rmcpplus_payload;
         fiid_obj_t obj_lan_msg_trlr;
         fiid_obj_t obj_rmcpplus_session_trlr;
+        /* IPMI payload of an established IPMI 2.0 session, decoded
+         * in place by unassemble_ipmi_rmcpplus_session_pkt()
+         */
+        uint32_t session_id;
+        uint32_t session_sequence_number;
+        const uint8_t *lan_msg;
+        unsigned int lan_msg_len;
+        uint8_t lan_msg_buf[IPMI_MAX_PKT_LEN];
       } rs;
     } outofband;
   } io;
@@ -112,6 +112,18 @@
     TRACE_MSG_OUT (ipmi_inteldcmi_ctx_strerror ((__errnum)), (__errnum));   \
   } while (0)
 
+#define API_MOCK_ERRNUM_TO_API_ERRNUM(__ctx, __errnum)                      \
+  do {                                                                      \
+    api_set_api_errnum_by_mock_errnum ((__ctx), (__errnum));                \
+    TRACE_MSG_OUT (ipmi_mock_ctx_strerror ((__errnum)), (__errnum));        \
+  } while (0)
+
+#define API_BROKER_ERRNUM_TO_API_ERRNUM(__ctx, __errnum)                    \
+  do {                                                                      \
+    api_set_api_errnum_by_broker_errnum ((__ctx), (__errnum));              \
+    TRACE_MSG_OUT (ipmi_broker_ctx_strerror ((__errnum)), (__errnum));      \
+  } while (0)
+
 #define API_LOCATE_ERRNUM_TO_API_ERRNUM(__ctx, __errnum)                    \
   do {                                                                      \
     api_set_api_errnum_by_locate_errnum ((__ctx), (__errnum));              \
@@ -25,14 +25,27 @@
 #ifdef STDC_HEADERS
 #include <string.h>
 #endif /* STDC_HEADERS */
+#if TIME_WITH_SYS_TIME
+#include <sys/time.h>
+#include <time.h>
+#else /* !TIME_WITH_SYS_TIME */
+#if HAVE_SYS_TIME_H
+#include <sys/time.h>
+#else /* !HAVE_SYS_TIME_H */
+#include <time.h>
+#endif /* !HAVE_SYS_TIME_H */
+#endif  /* !TIME_WITH_SYS_TIME */
+#include <limits.h>
 #include <assert.h>
 #include <errno.h>
 
 #include "freeipmi/api/ipmi-api.h"
 #include "freeipmi/locate/ipmi-locate.h"
 #include "freeipmi/spec/ipmi-comp-code-spec.h"
+#include "freeipmi/driver/ipmi-broker-driver.h"
 #include "freeipmi/driver/ipmi-inteldcmi-driver.h"
 #include "freeipmi/driver/ipmi-kcs-driver.h"
+#include "freeipmi/driver/ipmi-mock-driver.h"
 #include "freeipmi/driver/ipmi-openipmi-driver.h"
 #include "freeipmi/driver/ipmi-ssif-driver.h"
 #include "freeipmi/driver/ipmi-sunbmc-driver.h"
@@ -43,6 +56,7 @@
 #include "ipmi-api-trace.h"
 
 #include "freeipmi-portability.h"
+#include "secure.h"
 
 void
 api_set_api_errnum_by_errno (ipmi_ctx_t ctx, int __errno)
@@ -320,8 +334,74 @@ api_set_api_errnum_by_inteldcmi_errnum (ipmi_ctx_t ctx, int inteldcmi_errnum)
     }
 }
 
-static int
-_api_ipmi_cmd_post (ipmi_ctx_t ctx, fiid_obj_t obj_cmd_rs)
+void
+api_set_api_errnum_by_mock_errnum (ipmi_ctx_t ctx, int mock_errnum)
+{
+  assert (ctx && ctx->magic == IPMI_CTX_MAGIC);
+
+  switch (mock_errnum)
+    {
+    case IPMI_MOCK_ERR_SUCCESS:
+      ctx->errnum = IPMI_ERR_SUCCESS;
+      break;
+    case IPMI_MOCK_ERR_OUT_OF_MEMORY:
+      ctx->errnum = IPMI_ERR_OUT_OF_MEMORY;
+      break;
+    case IPMI_MOCK_ERR_PERMISSION:
+      ctx->errnum = IPMI_ERR_PERMISSION;
+      break;
+    case IPMI_MOCK_ERR_DEVICE_NOT_FOUND:
+      ctx->errnum = IPMI_ERR_DEVICE_NOT_FOUND;
+      break;
+    case IPMI_MOCK_ERR_DRIVER_PATH_REQUIRED:
+      ctx->errnum = IPMI_ERR_DRIVER_PATH_REQUIRED;
+      break;
+    case IPMI_MOCK_ERR_RECORDING_INVALID:
+      ctx->errnum = IPMI_ERR_DEVICE_NOT_SUPPORTED;
+      break;
+    case IPMI_MOCK_ERR_DRIVER_TIMEOUT:
+      ctx->errnum = IPMI_ERR_DRIVER_TIMEOUT;
+      break;
+    case IPMI_MOCK_ERR_SYSTEM_ERROR:
+      ctx->errnum = IPMI_ERR_SYSTEM_ERROR;
+      break;
+    default:
+      ctx->errnum = IPMI_ERR_INTERNAL_ERROR;
+    }
+}
+
+void
+api_set_api_errnum_by_broker_errnum (ipmi_ctx_t ctx, int broker_errnum)
+{
+  assert (ctx && ctx->magic == IPMI_CTX_MAGIC);
+
+  switch (broker_errnum)
+    {
+    case IPMI_BROKER_ERR_SUCCESS:
+      ctx->errnum = IPMI_ERR_SUCCESS;
+      break;
+    case IPMI_BROKER_ERR_OUT_OF_MEMORY:
+      ctx->errnum = IPMI_ERR_OUT_OF_MEMORY;
+      break;
+    case IPMI_BROKER_ERR_PERMISSION:
+      ctx->errnum = IPMI_ERR_PERMISSION;
+      break;
+    case IPMI_BROKER_ERR_DEVICE_NOT_FOUND:
+      ctx->errnum = IPMI_ERR_DEVICE_NOT_FOUND;
+      break;
+    case IPMI_BROKER_ERR_DRIVER_TIMEOUT:
+      ctx->errnum = IPMI_ERR_DRIVER_TIMEOUT;
+      break;
+    case IPMI_BROKER_ERR_SYSTEM_ERROR:
+      ctx->errnum = IPMI_ERR_SYSTEM_ERROR;
+      break;
+    default:
+      ctx->errnum = IPMI_ERR_INTERNAL_ERROR;
+    }
+}
+
+int
+api_ipmi_cmd_post (ipmi_ctx_t ctx, fiid_obj_t obj_cmd_rs)
 {
   int ret;
 
@@ -397,7 +477,7 @@ api_ipmi_cmd (ipmi_ctx_t ctx,
                 obj_cmd_rs) < 0)
     return (-1);
 
-  return (_api_ipmi_cmd_post (ctx, obj_cmd_rs));
+  return (api_ipmi_cmd_post (ctx, obj_cmd_rs));
 }
 
 int
@@ -421,5 +501,232 @@ api_ipmi_cmd_ipmb (ipmi_ctx_t ctx,
                      obj_cmd_rs) < 0)
     return (-1);
 
-  return (_api_ipmi_cmd_post (ctx, obj_cmd_rs));
+  return (api_ipmi_cmd_post (ctx, obj_cmd_rs));
+}
+
+fiid_obj_t
+api_fiid_obj_get (ipmi_ctx_t ctx, fiid_template_t tmpl)
+{
+  struct ipmi_ctx_obj_pool_entry *entry = NULL;
+  fiid_obj_t obj;
+  unsigned int i;
+
+  assert (ctx && ctx->magic == IPMI_CTX_MAGIC);
+  assert (tmpl);
+
+  for (i = 0; i < IPMI_CTX_OBJ_POOL_LEN; i++)
+    {
+      if (ctx->obj_pool[i].tmpl == tmpl
+          && !ctx->obj_pool[i].in_use)
+        {
+          ctx->obj_pool[i].in_use = 1;
+          return (ctx->obj_pool[i].obj);
+        }
+
+      if (!entry && !ctx->obj_pool[i].obj)
+        entry = &ctx->obj_pool[i];
+    }
+
+  /* pool full, replace an idle object of another template */
+  if (!entry)
+    {
+      for (i = 0; i < IPMI_CTX_OBJ_POOL_LEN; i++)
+        {
+          unsigned int index = (ctx->obj_pool_next + i) % IPMI_CTX_OBJ_POOL_LEN;
+
+          if (!ctx->obj_pool[index].in_use)
+            {
+              entry = &ctx->obj_pool[index];
+              ctx->obj_pool_next = (index + 1) % IPMI_CTX_OBJ_POOL_LEN;
+              fiid_obj_destroy (entry->obj);
+              entry->tmpl = NULL;
+              entry->obj = NULL;
+              break;
+            }
+        }
+    }
+
+  if (!(obj = fiid_obj_create (tmpl)))
+    return (NULL);
+
+  /* every pooled object is in use, hand out an unpooled object */
+  if (!entry)
+    return (obj);
+
+  entry->tmpl = tmpl;
+  entry->obj = obj;
+  entry->in_use = 1;
+  return (obj);
+}
+
+void
+api_fiid_obj_put (ipmi_ctx_t ctx, fiid_obj_t obj)
+{
+  unsigned int i;
+
+  assert (ctx && ctx->magic == IPMI_CTX_MAGIC);
+
+  if (!obj)
+    return;
+
+  for (i = 0; i < IPMI_CTX_OBJ_POOL_LEN; i++)
+    {
+      if (ctx->obj_pool[i].obj == obj)
+        {
+          assert (ctx->obj_pool[i].in_use);
+
+          /* clear now, objects may hold passwords or keys */
+          fiid_obj_clear (obj);
+          ctx->obj_pool[i].in_use = 0;
+          return;
+        }
+    }
+
+  fiid_obj_destroy (obj);
+}
+
+void
+api_fiid_obj_pool_destroy (ipmi_ctx_t ctx)
+{
+  unsigned int i;
+
+  assert (ctx && ctx->magic == IPMI_CTX_MAGIC);
+
+  for (i = 0; i < IPMI_CTX_OBJ_POOL_LEN; i++)
+    {
+      fiid_obj_destroy (ctx->obj_pool[i].obj);
+      ctx->obj_pool[i].tmpl = NULL;
+      ctx->obj_pool[i].obj = NULL;
+      ctx->obj_pool[i].in_use = 0;
+    }
+  ctx->obj_pool_next = 0;
+}
+
+uint8_t *
+api_pkt_buf (ipmi_ctx_t ctx, unsigned int pkt_len)
+{
+  assert (ctx && ctx->magic == IPMI_CTX_MAGIC);
+  assert (pkt_len);
+
+  if (pkt_len > ctx->pkt_buf_len)
+    {
+      uint8_t *pkt_buf;
+
+      if (!(pkt_buf = (uint8_t *)malloc (pkt_len)))
+        return (NULL);
+
+      api_pkt_buf_destroy (ctx);
+      ctx->pkt_buf = pkt_buf;
+      ctx->pkt_buf_len = pkt_len;
+    }
+
+  return (ctx->pkt_buf);
+}
+
+void
+api_pkt_buf_destroy (ipmi_ctx_t ctx)
+{
+  assert (ctx && ctx->magic == IPMI_CTX_MAGIC);
+
+  if (ctx->pkt_buf)
+    {
+      /* packet may contain a password */
+      secure_memset (ctx->pkt_buf, '\0', ctx->pkt_buf_len);
+      free (ctx->pkt_buf);
+    }
+  ctx->pkt_buf = NULL;
+  ctx->pkt_buf_len = 0;
+}
+
+struct ipmi_stats_counters *
+api_stats_cmd (ipmi_ctx_t ctx, uint8_t net_fn, uint8_t cmd)
+{
+  struct ipmi_stats_cmd *c;
+  unsigned int i;
+
+  assert (ctx && ctx->magic == IPMI_CTX_MAGIC);
+
+  /* few distinct commands per context, a linear search will do */
+  for (i = 0; i < ctx->stats.cmds_count; i++)
+    {
+      c = &(ctx->stats.cmds[i]);
+      if (c->net_fn == net_fn && c->cmd == cmd)
+        return (&(c->counters));
+    }
+
+  if (ctx->stats.cmds_count >= IPMI_STATS_CMDS_MAX)
+    return (&(ctx->stats.other));
+
+  c = &(ctx->stats.cmds[ctx->stats.cmds_count++]);
+  c->net_fn = net_fn;
+  c->cmd = cmd;
+  return (&(c->counters));
+}
+
+struct ipmi_stats_counters *
+api_stats_cmd_obj (ipmi_ctx_t ctx, uint8_t net_fn, fiid_obj_t obj_cmd_rq)
+{
+  uint64_t val;
+
+  assert (ctx
+          && ctx->magic == IPMI_CTX_MAGIC
+          && fiid_obj_valid (obj_cmd_rq));
+
+  /* ignore error, count requests without a command as other */
+  if (FIID_OBJ_GET (obj_cmd_rq, "cmd", &val) < 0)
+    return (&(ctx->stats.other));
+
+  return (api_stats_cmd (ctx, net_fn, val));
+}
+
+void
+api_stats_latency (struct ipmi_stats_counters *counters,
+                   const struct timeval *start,
+                   const struct timeval *end)
+{
+  struct timeval delta;
+  unsigned int latency;
+  unsigned int ms;
+  unsigned int bucket = 0;
+
+  assert (counters && start && end);
+
+  /* clock stepped backwards, count as no latency */
+  if (timercmp (end, start, <))
+    timerclear (&delta);
+  else
+    timersub (end, start, &delta);
+
+  if (delta.tv_sec >= (UINT_MAX / 1000000) - 1)
+    latency = UINT_MAX;
+  else
+    latency = delta.tv_sec * 1000000 + delta.tv_usec;
+
+  ms = latency / 1000;
+  while (ms && bucket < IPMI_STATS_LATENCY_BUCKETS - 1)
+    {
+      ms >>= 1;
+      bucket++;
+    }
+
+  counters->latency[bucket]++;
+  counters->latency_total += latency;
+  if (latency > counters->latency_max)
+    counters->latency_max = latency;
+}
+
+void
+api_stats_comp_code (struct ipmi_stats_counters *counters,
+                     fiid_obj_t obj_cmd_rs)
+{
+  uint64_t val;
+
+  assert (counters && fiid_obj_valid (obj_cmd_rs));
+
+  /* ignore error, no completion code is not a bad one */
+  if (FIID_OBJ_GET (obj_cmd_rs, "comp_code", &val) < 0)
+    return;
+
+  if (val != IPMI_COMP_CODE_COMMAND_SUCCESS)
+    counters->errors++;
 }
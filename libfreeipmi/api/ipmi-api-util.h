@@ -55,6 +55,54 @@ void api_set_api_errnum_by_sunbmc_errnum (ipmi_ctx_t ctx, int sunbmc_errnum);
 
 void api_set_api_errnum_by_inteldcmi_errnum (ipmi_ctx_t ctx, int inteldcmi_errnum);
 
+void api_set_api_errnum_by_mock_errnum (ipmi_ctx_t ctx, int mock_errnum);
+
+void api_set_api_errnum_by_broker_errnum (ipmi_ctx_t ctx, int broker_errnum);
+
+/* Returns a cleared object of the template from the ctx object pool,
+ * the object must be released with api_fiid_obj_put().  Returns NULL
+ * w/ errno set on error.
+ */
+fiid_obj_t api_fiid_obj_get (ipmi_ctx_t ctx, fiid_template_t tmpl);
+
+void api_fiid_obj_put (ipmi_ctx_t ctx, fiid_obj_t obj);
+
+void api_fiid_obj_pool_destroy (ipmi_ctx_t ctx);
+
+/* Returns the ctx packet buffer grown to at least pkt_len bytes.  The
+ * buffer is reused by the next call, it is only valid until then.
+ * Returns NULL w/ errno set on error.
+ */
+uint8_t *api_pkt_buf (ipmi_ctx_t ctx, unsigned int pkt_len);
+
+void api_pkt_buf_destroy (ipmi_ctx_t ctx);
+
+/* Returns the counters of the command, or the counters of other
+ * commands if the table of commands is full
+ */
+struct ipmi_stats_counters *api_stats_cmd (ipmi_ctx_t ctx,
+                                           uint8_t net_fn,
+                                           uint8_t cmd);
+
+/* like api_stats_cmd(), with the command taken from the request */
+struct ipmi_stats_counters *api_stats_cmd_obj (ipmi_ctx_t ctx,
+                                               uint8_t net_fn,
+                                               fiid_obj_t obj_cmd_rq);
+
+/* count a response received at 'end' to a request first sent at
+ * 'start'
+ */
+void api_stats_latency (struct ipmi_stats_counters *counters,
+                        const struct timeval *start,
+                        const struct timeval *end);
+
+/* count a response with a completion code other than success */
+void api_stats_comp_code (struct ipmi_stats_counters *counters,
+                          fiid_obj_t obj_cmd_rs);
+
+/* completion code and response validity checks of api_ipmi_cmd() */
+int api_ipmi_cmd_post (ipmi_ctx_t ctx, fiid_obj_t obj_cmd_rs);
+
 int api_ipmi_cmd (ipmi_ctx_t ctx,
                   uint8_t lun,
                   uint8_t net_fn,
@@ -39,6 +39,7 @@
 #endif /* !HAVE_SYS_TIME_H */
 #endif  /* !TIME_WITH_SYS_TIME */
 #include <netdb.h>
+#include <sys/poll.h>
 #include <sys/socket.h>
 #include <netinet/in.h>
 #include <limits.h>
@@ -50,8 +51,10 @@
 #include "freeipmi/cmds/ipmi-event-cmds.h"
 #include "freeipmi/cmds/ipmi-messaging-support-cmds.h"
 #include "freeipmi/debug/ipmi-debug.h"
+#include "freeipmi/driver/ipmi-broker-driver.h"
 #include "freeipmi/driver/ipmi-inteldcmi-driver.h"
 #include "freeipmi/driver/ipmi-kcs-driver.h"
+#include "freeipmi/driver/ipmi-mock-driver.h"
 #include "freeipmi/driver/ipmi-openipmi-driver.h"
 #include "freeipmi/driver/ipmi-ssif-driver.h"
 #include "freeipmi/driver/ipmi-sunbmc-driver.h"
@@ -65,22 +68,28 @@
 #include "freeipmi/spec/ipmi-authentication-type-spec.h"
 #include "freeipmi/spec/ipmi-channel-spec.h"
 #include "freeipmi/spec/ipmi-cmd-spec.h"
+#include "freeipmi/spec/ipmi-comp-code-spec.h"
 #include "freeipmi/spec/ipmi-ipmb-lun-spec.h"
 #include "freeipmi/spec/ipmi-netfn-spec.h"
 #include "freeipmi/spec/ipmi-privilege-level-spec.h"
 #include "freeipmi/spec/ipmi-slave-address-spec.h"
 #include "freeipmi/util/ipmi-cipher-suite-util.h"
 #include "freeipmi/util/ipmi-outofband-util.h"
+#include "freeipmi/util/ipmi-rmcpplus-util.h"
 #include "freeipmi/util/ipmi-util.h"
 
 #include "ipmi-api-defs.h"
 #include "ipmi-api-trace.h"
 #include "ipmi-api-util.h"
+#include "ipmi-broker-driver-api.h"
 #include "ipmi-inteldcmi-driver-api.h"
 #include "ipmi-lan-interface-api.h"
 #include "ipmi-lan-session-common.h"
 #include "ipmi-kcs-driver-api.h"
+#include "ipmi-mock-driver-api.h"
+#include "ipmi-mux.h"
 #include "ipmi-openipmi-driver-api.h"
+#include "ipmi-pkt-trace.h"
 #include "ipmi-sunbmc-driver-api.h"
 #include "ipmi-ssif-driver-api.h"
 
@@ -146,6 +155,7 @@ _ipmi_ctx_init (struct ipmi_ctx *ctx)
   memset (ctx, '\0', sizeof (struct ipmi_ctx));
   ctx->magic = IPMI_CTX_MAGIC;
   ctx->type = IPMI_DEVICE_UNKNOWN;
+  ctx->async_window = IPMI_ASYNC_WINDOW_DEFAULT;
 }
 
 ipmi_ctx_t
@@ -160,6 +170,14 @@ ipmi_ctx_create (void)
     }
 
   _ipmi_ctx_init (ctx);
+
+  if (!(ctx->arena = fiid_arena_create (0)))
+    {
+      ERRNO_TRACE (errno);
+      free (ctx);
+      return (NULL);
+    }
+
   ctx->errnum = IPMI_ERR_SUCCESS;
 
   return (ctx);
@@ -252,6 +270,262 @@ ipmi_ctx_set_flags (ipmi_ctx_t ctx, unsigned int flags)
   return (0);
 }
 
+int
+ipmi_ctx_get_retransmission_bounds (ipmi_ctx_t ctx,
+                                    unsigned int *timeout_floor,
+                                    unsigned int *timeout_ceiling)
+{
+  if (!ctx || ctx->magic != IPMI_CTX_MAGIC)
+    {
+      ERR_TRACE (ipmi_ctx_errormsg (ctx), ipmi_ctx_errnum (ctx));
+      return (-1);
+    }
+
+  if (!timeout_floor || !timeout_ceiling)
+    {
+      API_SET_ERRNUM (ctx, IPMI_ERR_PARAMETERS);
+      return (-1);
+    }
+
+  (*timeout_floor) = ctx->retransmission_timeout_floor;
+  (*timeout_ceiling) = ctx->retransmission_timeout_ceiling;
+  ctx->errnum = IPMI_ERR_SUCCESS;
+  return (0);
+}
+
+int
+ipmi_ctx_set_retransmission_bounds (ipmi_ctx_t ctx,
+                                    unsigned int timeout_floor,
+                                    unsigned int timeout_ceiling)
+{
+  if (!ctx || ctx->magic != IPMI_CTX_MAGIC)
+    {
+      ERR_TRACE (ipmi_ctx_errormsg (ctx), ipmi_ctx_errnum (ctx));
+      return (-1);
+    }
+
+  if ((!timeout_floor && timeout_ceiling)
+      || (timeout_floor && !timeout_ceiling)
+      || timeout_floor > timeout_ceiling)
+    {
+      API_SET_ERRNUM (ctx, IPMI_ERR_PARAMETERS);
+      return (-1);
+    }
+
+  ctx->retransmission_timeout_floor = timeout_floor;
+  ctx->retransmission_timeout_ceiling = timeout_ceiling;
+  ctx->errnum = IPMI_ERR_SUCCESS;
+  return (0);
+}
+
+int
+ipmi_ctx_get_rtt (ipmi_ctx_t ctx,
+                  unsigned int *srtt,
+                  unsigned int *rttvar)
+{
+  if (!ctx || ctx->magic != IPMI_CTX_MAGIC)
+    {
+      ERR_TRACE (ipmi_ctx_errormsg (ctx), ipmi_ctx_errnum (ctx));
+      return (-1);
+    }
+
+  if (!srtt || !rttvar)
+    {
+      API_SET_ERRNUM (ctx, IPMI_ERR_PARAMETERS);
+      return (-1);
+    }
+
+  if (ctx->type == IPMI_DEVICE_UNKNOWN)
+    {
+      API_SET_ERRNUM (ctx, IPMI_ERR_DEVICE_NOT_OPEN);
+      return (-1);
+    }
+
+  if (ctx->type != IPMI_DEVICE_LAN
+      && ctx->type != IPMI_DEVICE_LAN_2_0)
+    {
+      API_SET_ERRNUM (ctx, IPMI_ERR_COMMAND_INVALID_FOR_SELECTED_INTERFACE);
+      return (-1);
+    }
+
+  ctx->errnum = IPMI_ERR_SUCCESS;
+
+  if (!ctx->io.outofband.rtt_samples)
+    return (0);
+
+  (*srtt) = ctx->io.outofband.srtt;
+  (*rttvar) = ctx->io.outofband.rttvar;
+  return (1);
+}
+
+int
+ipmi_ctx_get_stats (ipmi_ctx_t ctx, struct ipmi_stats *stats)
+{
+  if (!ctx || ctx->magic != IPMI_CTX_MAGIC)
+    {
+      ERR_TRACE (ipmi_ctx_errormsg (ctx), ipmi_ctx_errnum (ctx));
+      return (-1);
+    }
+
+  if (!stats)
+    {
+      API_SET_ERRNUM (ctx, IPMI_ERR_PARAMETERS);
+      return (-1);
+    }
+
+  memcpy (stats, &ctx->stats, sizeof (struct ipmi_stats));
+  ctx->errnum = IPMI_ERR_SUCCESS;
+  return (0);
+}
+
+int
+ipmi_ctx_clear_stats (ipmi_ctx_t ctx)
+{
+  if (!ctx || ctx->magic != IPMI_CTX_MAGIC)
+    {
+      ERR_TRACE (ipmi_ctx_errormsg (ctx), ipmi_ctx_errnum (ctx));
+      return (-1);
+    }
+
+  /* commands in flight refer to their counters */
+  if ((ctx->type == IPMI_DEVICE_LAN
+       || ctx->type == IPMI_DEVICE_LAN_2_0)
+      && ctx->io.outofband.async.op != IPMI_CTX_ASYNC_OP_NONE)
+    {
+      API_SET_ERRNUM (ctx, IPMI_ERR_DRIVER_BUSY);
+      return (-1);
+    }
+
+  memset (&ctx->stats, '\0', sizeof (struct ipmi_stats));
+  ctx->errnum = IPMI_ERR_SUCCESS;
+  return (0);
+}
+
+int
+ipmi_ctx_set_pkt_trace (ipmi_ctx_t ctx, unsigned int size)
+{
+  if (!ctx || ctx->magic != IPMI_CTX_MAGIC)
+    {
+      ERR_TRACE (ipmi_ctx_errormsg (ctx), ipmi_ctx_errnum (ctx));
+      return (-1);
+    }
+
+  if (size && size < IPMI_PKT_TRACE_SIZE_MIN)
+    {
+      API_SET_ERRNUM (ctx, IPMI_ERR_PARAMETERS);
+      return (-1);
+    }
+
+  if (size)
+    {
+      if (api_pkt_trace_create (ctx, size) < 0)
+        {
+          API_ERRNO_TO_API_ERRNUM (ctx, errno);
+          return (-1);
+        }
+    }
+  else
+    api_pkt_trace_destroy (ctx);
+
+  ctx->errnum = IPMI_ERR_SUCCESS;
+  return (0);
+}
+
+int
+ipmi_ctx_write_pkt_trace (ipmi_ctx_t ctx, int fd)
+{
+  if (!ctx || ctx->magic != IPMI_CTX_MAGIC)
+    {
+      ERR_TRACE (ipmi_ctx_errormsg (ctx), ipmi_ctx_errnum (ctx));
+      return (-1);
+    }
+
+  if (fd < 0)
+    {
+      API_SET_ERRNUM (ctx, IPMI_ERR_PARAMETERS);
+      return (-1);
+    }
+
+  if (api_pkt_trace_write (ctx, fd) < 0)
+    {
+      API_ERRNO_TO_API_ERRNUM (ctx, errno);
+      return (-1);
+    }
+
+  ctx->errnum = IPMI_ERR_SUCCESS;
+  return (0);
+}
+
+int
+ipmi_ctx_set_mux (ipmi_ctx_t ctx, ipmi_mux_t mux)
+{
+  if (!ctx || ctx->magic != IPMI_CTX_MAGIC)
+    {
+      ERR_TRACE (ipmi_ctx_errormsg (ctx), ipmi_ctx_errnum (ctx));
+      return (-1);
+    }
+
+  if (ctx->type != IPMI_DEVICE_UNKNOWN)
+    {
+      API_SET_ERRNUM (ctx, IPMI_ERR_DEVICE_ALREADY_OPEN);
+      return (-1);
+    }
+
+  if (mux)
+    {
+      if (api_mux_ref (mux) < 0)
+        {
+          API_ERRNO_TO_API_ERRNUM (ctx, errno);
+          return (-1);
+        }
+    }
+
+  if (ctx->mux)
+    api_mux_unref (ctx->mux);
+
+  ctx->mux = mux;
+  ctx->errnum = IPMI_ERR_SUCCESS;
+  return (0);
+}
+
+int
+ipmi_ctx_set_session_cache (ipmi_ctx_t ctx, const char *directory)
+{
+  char *tmp_directory = NULL;
+
+  if (!ctx || ctx->magic != IPMI_CTX_MAGIC)
+    {
+      ERR_TRACE (ipmi_ctx_errormsg (ctx), ipmi_ctx_errnum (ctx));
+      return (-1);
+    }
+
+  if (directory && !strlen (directory))
+    {
+      API_SET_ERRNUM (ctx, IPMI_ERR_PARAMETERS);
+      return (-1);
+    }
+
+  if (ctx->type != IPMI_DEVICE_UNKNOWN)
+    {
+      API_SET_ERRNUM (ctx, IPMI_ERR_DEVICE_ALREADY_OPEN);
+      return (-1);
+    }
+
+  if (directory)
+    {
+      if (!(tmp_directory = strdup (directory)))
+        {
+          API_SET_ERRNUM (ctx, IPMI_ERR_OUT_OF_MEMORY);
+          return (-1);
+        }
+    }
+
+  free (ctx->session_cache_directory);
+  ctx->session_cache_directory = tmp_directory;
+  ctx->errnum = IPMI_ERR_SUCCESS;
+  return (0);
+}
+
 static void
 _ipmi_outofband_free (ipmi_ctx_t ctx)
 {
@@ -305,8 +579,10 @@ _ipmi_inband_free (ipmi_ctx_t ctx)
     }
   if (ctx->type == IPMI_DEVICE_OPENIPMI)
     {
-      ipmi_openipmi_ctx_destroy (ctx->io.inband.openipmi_ctx);
+      if (!ctx->io.inband.openipmi_ctx_shared)
+        ipmi_openipmi_ctx_destroy (ctx->io.inband.openipmi_ctx);
       ctx->io.inband.openipmi_ctx = NULL;
+      ctx->io.inband.openipmi_ctx_shared = 0;
     }
   if (ctx->type == IPMI_DEVICE_SUNBMC)
     {
@@ -318,6 +594,16 @@ _ipmi_inband_free (ipmi_ctx_t ctx)
       ipmi_inteldcmi_ctx_destroy (ctx->io.inband.inteldcmi_ctx);
       ctx->io.inband.inteldcmi_ctx = NULL;
     }
+  if (ctx->type == IPMI_DEVICE_MOCK)
+    {
+      ipmi_mock_ctx_destroy (ctx->io.inband.mock_ctx);
+      ctx->io.inband.mock_ctx = NULL;
+    }
+  if (ctx->type == IPMI_DEVICE_BROKER)
+    {
+      ipmi_broker_ctx_destroy (ctx->io.inband.broker_ctx);
+      ctx->io.inband.broker_ctx = NULL;
+    }
 
   fiid_obj_destroy (ctx->io.inband.rq.obj_hdr);
   ctx->io.inband.rq.obj_hdr = NULL;
@@ -421,22 +707,43 @@ _setup_hostname (ipmi_ctx_t ctx, const char *hostname)
   return (rv);
 }
 
-static int
-_setup_socket (ipmi_ctx_t ctx)
+/* Wipe the session keys, including any crypt handles keyed w/ them */
+static void
+_ipmi_outofband_2_0_keys_flush (ipmi_ctx_t ctx)
 {
+  /* Function Note: No need to set errnum - just return */
   assert (ctx);
   assert (ctx->magic == IPMI_CTX_MAGIC);
 
-  /* Open client (local) UDP socket */
-  /* achu: ephemeral ports are > 1023, so no way we will bind to an IPMI port */
+  ipmi_flush_rmcpplus_session_keys (ctx->io.outofband.integrity_key_ptr,
+                                    ctx->io.outofband.integrity_key_len,
+                                    ctx->io.outofband.confidentiality_key_ptr,
+                                    ctx->io.outofband.confidentiality_key_len);
 
-  if ((ctx->io.outofband.sockfd = socket (ctx->io.outofband.remote_host->sa_family,
-                                          SOCK_DGRAM,
-                                          0)) < 0)
-    {
-      API_ERRNO_TO_API_ERRNUM (ctx, errno);
-      return (-1);
-    }
+  secure_memset (ctx->io.outofband.sik_key, '\0', IPMI_MAX_SIK_KEY_LENGTH);
+  secure_memset (ctx->io.outofband.integrity_key, '\0', IPMI_MAX_INTEGRITY_KEY_LENGTH);
+  secure_memset (ctx->io.outofband.confidentiality_key, '\0', IPMI_MAX_CONFIDENTIALITY_KEY_LENGTH);
+}
+
+static void
+_ipmi_outofband_socket_close (ipmi_ctx_t ctx)
+{
+  /* Function Note: No need to set errnum - just return */
+  assert (ctx);
+  assert (ctx->magic == IPMI_CTX_MAGIC);
+
+  /* ignore potential error, cleanup path */
+  if (ctx->io.outofband.mux_peer)
+    api_mux_detach (ctx);
+  else if (ctx->io.outofband.sockfd)
+    close (ctx->io.outofband.sockfd);
+}
+
+static int
+_setup_socket (ipmi_ctx_t ctx)
+{
+  assert (ctx);
+  assert (ctx->magic == IPMI_CTX_MAGIC);
 
   if (ctx->io.outofband.remote_host->sa_family == AF_INET)
     {
@@ -455,6 +762,21 @@ _setup_socket (ipmi_ctx_t ctx)
       ctx->io.outofband.srcaddr_len = sizeof (struct sockaddr_in6);
     }
 
+  /* errnum set in api_mux_attach */
+  if (ctx->mux)
+    return (api_mux_attach (ctx));
+
+  /* Open client (local) UDP socket */
+  /* achu: ephemeral ports are > 1023, so no way we will bind to an IPMI port */
+
+  if ((ctx->io.outofband.sockfd = socket (ctx->io.outofband.remote_host->sa_family,
+                                          SOCK_DGRAM,
+                                          0)) < 0)
+    {
+      API_ERRNO_TO_API_ERRNUM (ctx, errno);
+      return (-1);
+    }
+
   if (bind (ctx->io.outofband.sockfd,
             ctx->io.outofband.srcaddr,
             ctx->io.outofband.srcaddr_len) < 0)
@@ -467,17 +789,20 @@ _setup_socket (ipmi_ctx_t ctx)
 }
 
 
-int
-ipmi_ctx_open_outofband (ipmi_ctx_t ctx,
-                         const char *hostname,
-                         const char *username,
-                         const char *password,
-                         uint8_t authentication_type,
-                         uint8_t privilege_level,
-                         unsigned int session_timeout,
-                         unsigned int retransmission_timeout,
-                         unsigned int workaround_flags,
-                         unsigned int flags)
+/* callback non-NULL for an asynchronous open */
+static int
+_ipmi_ctx_open_outofband (ipmi_ctx_t ctx,
+                          const char *hostname,
+                          const char *username,
+                          const char *password,
+                          uint8_t authentication_type,
+                          uint8_t privilege_level,
+                          unsigned int session_timeout,
+                          unsigned int retransmission_timeout,
+                          unsigned int workaround_flags,
+                          unsigned int flags,
+                          Ipmi_Ctx_Async_Callback callback,
+                          void *callback_data)
 {
   unsigned int workaround_flags_mask = (IPMI_WORKAROUND_FLAGS_OUTOFBAND_AUTHENTICATION_CAPABILITIES
                                         | IPMI_WORKAROUND_FLAGS_OUTOFBAND_ACCEPT_SESSION_ID_ZERO
@@ -519,6 +844,7 @@ ipmi_ctx_open_outofband (ipmi_ctx_t ctx,
   ctx->type = IPMI_DEVICE_LAN;
   ctx->workaround_flags_outofband = workaround_flags;
   ctx->flags = flags;
+  ctx->io.outofband.mux_peer = NULL;
 
   if (_setup_hostname (ctx, hostname) < 0)
     goto cleanup;
@@ -545,6 +871,11 @@ ipmi_ctx_open_outofband (ipmi_ctx_t ctx,
 
   memset (&ctx->io.outofband.last_send, '\0', sizeof (struct timeval));
   memset (&ctx->io.outofband.last_received, '\0', sizeof (struct timeval));
+  ctx->io.outofband.srtt = 0;
+  ctx->io.outofband.rttvar = 0;
+  ctx->io.outofband.rtt_samples = 0;
+  ctx->io.outofband.rto = 0;
+  timerclear (&(ctx->io.outofband.rto_backoff));
 
   if (ipmi_check_session_sequence_number_1_5_init (&(ctx->io.outofband.highest_received_sequence_number),
                                                    &(ctx->io.outofband.previously_received_list)) < 0)
@@ -594,35 +925,119 @@ ipmi_ctx_open_outofband (ipmi_ctx_t ctx,
   if (_setup_socket (ctx) < 0)
     goto cleanup;
 
-  /* errnum set in api_lan_open_session */
-  if (api_lan_open_session (ctx) < 0)
-    goto cleanup;
+  if (callback)
+    {
+      memset (&ctx->io.outofband.async, '\0', sizeof (struct ipmi_ctx_async));
+
+      /* errnum set in api_lan_async_open_session */
+      if (api_lan_async_open_session (ctx) < 0)
+        {
+          api_lan_async_cleanup (ctx);
+          goto cleanup;
+        }
+
+      ctx->io.outofband.async.callback = callback;
+      ctx->io.outofband.async.callback_data = callback_data;
+    }
+  else
+    {
+      /* errnum set in api_lan_open_session */
+      if (api_lan_open_session (ctx) < 0)
+        goto cleanup;
+    }
 
   ctx->errnum = IPMI_ERR_SUCCESS;
   return (0);
 
  cleanup:
-  /* ignore potential error, cleanup path */
-  if (ctx->io.outofband.sockfd)
-    close (ctx->io.outofband.sockfd);
+  _ipmi_outofband_socket_close (ctx);
   _ipmi_outofband_free (ctx);
   ctx->type = IPMI_DEVICE_UNKNOWN;
   return (-1);
 }
 
 int
-ipmi_ctx_open_outofband_2_0 (ipmi_ctx_t ctx,
-                             const char *hostname,
-                             const char *username,
-                             const char *password,
-                             const unsigned char *k_g,
-                             unsigned int k_g_len,
-                             uint8_t privilege_level,
-                             uint8_t cipher_suite_id,
-                             unsigned int session_timeout,
-                             unsigned int retransmission_timeout,
-                             unsigned int workaround_flags,
-                             unsigned int flags)
+ipmi_ctx_open_outofband (ipmi_ctx_t ctx,
+                         const char *hostname,
+                         const char *username,
+                         const char *password,
+                         uint8_t authentication_type,
+                         uint8_t privilege_level,
+                         unsigned int session_timeout,
+                         unsigned int retransmission_timeout,
+                         unsigned int workaround_flags,
+                         unsigned int flags)
+{
+  return (_ipmi_ctx_open_outofband (ctx,
+                                    hostname,
+                                    username,
+                                    password,
+                                    authentication_type,
+                                    privilege_level,
+                                    session_timeout,
+                                    retransmission_timeout,
+                                    workaround_flags,
+                                    flags,
+                                    NULL,
+                                    NULL));
+}
+
+int
+ipmi_ctx_open_outofband_async (ipmi_ctx_t ctx,
+                               const char *hostname,
+                               const char *username,
+                               const char *password,
+                               uint8_t authentication_type,
+                               uint8_t privilege_level,
+                               unsigned int session_timeout,
+                               unsigned int retransmission_timeout,
+                               unsigned int workaround_flags,
+                               unsigned int flags,
+                               Ipmi_Ctx_Async_Callback callback,
+                               void *callback_data)
+{
+  if (!ctx || ctx->magic != IPMI_CTX_MAGIC)
+    {
+      ERR_TRACE (ipmi_ctx_errormsg (ctx), ipmi_ctx_errnum (ctx));
+      return (-1);
+    }
+
+  if (!callback)
+    {
+      API_SET_ERRNUM (ctx, IPMI_ERR_PARAMETERS);
+      return (-1);
+    }
+
+  return (_ipmi_ctx_open_outofband (ctx,
+                                    hostname,
+                                    username,
+                                    password,
+                                    authentication_type,
+                                    privilege_level,
+                                    session_timeout,
+                                    retransmission_timeout,
+                                    workaround_flags,
+                                    flags,
+                                    callback,
+                                    callback_data));
+}
+
+/* callback non-NULL for an asynchronous open */
+static int
+_ipmi_ctx_open_outofband_2_0 (ipmi_ctx_t ctx,
+                              const char *hostname,
+                              const char *username,
+                              const char *password,
+                              const unsigned char *k_g,
+                              unsigned int k_g_len,
+                              uint8_t privilege_level,
+                              uint8_t cipher_suite_id,
+                              unsigned int session_timeout,
+                              unsigned int retransmission_timeout,
+                              unsigned int workaround_flags,
+                              unsigned int flags,
+                              Ipmi_Ctx_Async_Callback callback,
+                              void *callback_data)
 {
   unsigned int workaround_flags_mask = (IPMI_WORKAROUND_FLAGS_OUTOFBAND_2_0_AUTHENTICATION_CAPABILITIES
                                         | IPMI_WORKAROUND_FLAGS_OUTOFBAND_2_0_INTEL_2_0_SESSION
@@ -673,6 +1088,7 @@ ipmi_ctx_open_outofband_2_0 (ipmi_ctx_t ctx,
   ctx->type = IPMI_DEVICE_LAN_2_0;
   ctx->workaround_flags_outofband_2_0 = workaround_flags;
   ctx->flags = flags;
+  ctx->io.outofband.mux_peer = NULL;
 
   if (_setup_hostname (ctx, hostname) < 0)
     goto cleanup;
@@ -741,6 +1157,11 @@ ipmi_ctx_open_outofband_2_0 (ipmi_ctx_t ctx,
   ctx->io.outofband.confidentiality_key_len = IPMI_MAX_CONFIDENTIALITY_KEY_LENGTH;
   memset (&ctx->io.outofband.last_send, '\0', sizeof (struct timeval));
   memset (&ctx->io.outofband.last_received, '\0', sizeof (struct timeval));
+  ctx->io.outofband.srtt = 0;
+  ctx->io.outofband.rttvar = 0;
+  ctx->io.outofband.rtt_samples = 0;
+  ctx->io.outofband.rto = 0;
+  timerclear (&(ctx->io.outofband.rto_backoff));
 
   if (ipmi_check_session_sequence_number_2_0_init (&(ctx->io.outofband.highest_received_sequence_number),
                                                    &(ctx->io.outofband.previously_received_list)) < 0)
@@ -814,22 +1235,112 @@ ipmi_ctx_open_outofband_2_0 (ipmi_ctx_t ctx,
   if (_setup_socket (ctx) < 0)
     goto cleanup;
 
-  /* errnum set in api_lan_2_0_open_session */
-  if (api_lan_2_0_open_session (ctx) < 0)
-    goto cleanup;
+  if (callback)
+    {
+      memset (&ctx->io.outofband.async, '\0', sizeof (struct ipmi_ctx_async));
+
+      /* errnum set in api_lan_async_open_session */
+      if (api_lan_async_open_session (ctx) < 0)
+        {
+          api_lan_async_cleanup (ctx);
+          goto cleanup;
+        }
+
+      ctx->io.outofband.async.callback = callback;
+      ctx->io.outofband.async.callback_data = callback_data;
+    }
+  else
+    {
+      /* errnum set in api_lan_2_0_open_session */
+      if (api_lan_2_0_open_session (ctx) < 0)
+        goto cleanup;
+    }
 
   ctx->errnum = IPMI_ERR_SUCCESS;
   return (0);
 
  cleanup:
-  /* ignore potential error, cleanup path */
-  if (ctx->io.outofband.sockfd)
-    close (ctx->io.outofband.sockfd);
+  _ipmi_outofband_2_0_keys_flush (ctx);
+  _ipmi_outofband_socket_close (ctx);
   _ipmi_outofband_free (ctx);
   ctx->type = IPMI_DEVICE_UNKNOWN;
   return (-1);
 }
 
+int
+ipmi_ctx_open_outofband_2_0 (ipmi_ctx_t ctx,
+                             const char *hostname,
+                             const char *username,
+                             const char *password,
+                             const unsigned char *k_g,
+                             unsigned int k_g_len,
+                             uint8_t privilege_level,
+                             uint8_t cipher_suite_id,
+                             unsigned int session_timeout,
+                             unsigned int retransmission_timeout,
+                             unsigned int workaround_flags,
+                             unsigned int flags)
+{
+  return (_ipmi_ctx_open_outofband_2_0 (ctx,
+                                        hostname,
+                                        username,
+                                        password,
+                                        k_g,
+                                        k_g_len,
+                                        privilege_level,
+                                        cipher_suite_id,
+                                        session_timeout,
+                                        retransmission_timeout,
+                                        workaround_flags,
+                                        flags,
+                                        NULL,
+                                        NULL));
+}
+
+int
+ipmi_ctx_open_outofband_2_0_async (ipmi_ctx_t ctx,
+                                   const char *hostname,
+                                   const char *username,
+                                   const char *password,
+                                   const unsigned char *k_g,
+                                   unsigned int k_g_len,
+                                   uint8_t privilege_level,
+                                   uint8_t cipher_suite_id,
+                                   unsigned int session_timeout,
+                                   unsigned int retransmission_timeout,
+                                   unsigned int workaround_flags,
+                                   unsigned int flags,
+                                   Ipmi_Ctx_Async_Callback callback,
+                                   void *callback_data)
+{
+  if (!ctx || ctx->magic != IPMI_CTX_MAGIC)
+    {
+      ERR_TRACE (ipmi_ctx_errormsg (ctx), ipmi_ctx_errnum (ctx));
+      return (-1);
+    }
+
+  if (!callback)
+    {
+      API_SET_ERRNUM (ctx, IPMI_ERR_PARAMETERS);
+      return (-1);
+    }
+
+  return (_ipmi_ctx_open_outofband_2_0 (ctx,
+                                        hostname,
+                                        username,
+                                        password,
+                                        k_g,
+                                        k_g_len,
+                                        privilege_level,
+                                        cipher_suite_id,
+                                        session_timeout,
+                                        retransmission_timeout,
+                                        workaround_flags,
+                                        flags,
+                                        callback,
+                                        callback_data));
+}
+
 int
 ipmi_ctx_open_inband (ipmi_ctx_t ctx,
                       ipmi_driver_type_t driver_type,
@@ -864,7 +1375,9 @@ ipmi_ctx_open_inband (ipmi_ctx_t ctx,
        && driver_type != IPMI_DEVICE_SSIF
        && driver_type != IPMI_DEVICE_OPENIPMI
        && driver_type != IPMI_DEVICE_SUNBMC
-       && driver_type != IPMI_DEVICE_INTELDCMI)
+       && driver_type != IPMI_DEVICE_INTELDCMI
+       && driver_type != IPMI_DEVICE_MOCK
+       && driver_type != IPMI_DEVICE_BROKER)
       || (workaround_flags & ~workaround_flags_mask)
       || (flags & ~flags_mask))
     {
@@ -884,7 +1397,10 @@ ipmi_ctx_open_inband (ipmi_ctx_t ctx,
   ctx->io.inband.kcs_ctx = NULL;
   ctx->io.inband.ssif_ctx = NULL;
   ctx->io.inband.openipmi_ctx = NULL;
+  ctx->io.inband.openipmi_ctx_shared = 0;
   ctx->io.inband.sunbmc_ctx = NULL;
+  ctx->io.inband.mock_ctx = NULL;
+  ctx->io.inband.broker_ctx = NULL;
 
   /* Random number generation */
   seedp = (unsigned int) clock () + (unsigned int) time (NULL);
@@ -1188,6 +1704,60 @@ ipmi_ctx_open_inband (ipmi_ctx_t ctx,
 
       break;
 
+    case IPMI_DEVICE_MOCK:
+      ctx->type = driver_type;
+
+      if (!(ctx->io.inband.mock_ctx = ipmi_mock_ctx_create ()))
+        {
+          API_ERRNO_TO_API_ERRNUM (ctx, errno);
+          goto cleanup;
+        }
+
+      if (driver_device)
+        {
+          if (ipmi_mock_ctx_set_driver_device (ctx->io.inband.mock_ctx,
+                                               driver_device) < 0)
+            {
+              API_MOCK_ERRNUM_TO_API_ERRNUM (ctx, ipmi_mock_ctx_errnum (ctx->io.inband.mock_ctx));
+              goto cleanup;
+            }
+        }
+
+      if (ipmi_mock_ctx_io_init (ctx->io.inband.mock_ctx) < 0)
+        {
+          API_MOCK_ERRNUM_TO_API_ERRNUM (ctx, ipmi_mock_ctx_errnum (ctx->io.inband.mock_ctx));
+          goto cleanup;
+        }
+
+      break;
+
+    case IPMI_DEVICE_BROKER:
+      ctx->type = driver_type;
+
+      if (!(ctx->io.inband.broker_ctx = ipmi_broker_ctx_create ()))
+        {
+          API_ERRNO_TO_API_ERRNUM (ctx, errno);
+          goto cleanup;
+        }
+
+      if (driver_device)
+        {
+          if (ipmi_broker_ctx_set_driver_device (ctx->io.inband.broker_ctx,
+                                                 driver_device) < 0)
+            {
+              API_BROKER_ERRNUM_TO_API_ERRNUM (ctx, ipmi_broker_ctx_errnum (ctx->io.inband.broker_ctx));
+              goto cleanup;
+            }
+        }
+
+      if (ipmi_broker_ctx_io_init (ctx->io.inband.broker_ctx) < 0)
+        {
+          API_BROKER_ERRNUM_TO_API_ERRNUM (ctx, ipmi_broker_ctx_errnum (ctx->io.inband.broker_ctx));
+          goto cleanup;
+        }
+
+      break;
+
     default:
       goto cleanup;
     }
@@ -1215,6 +1785,82 @@ ipmi_ctx_open_inband (ipmi_ctx_t ctx,
   return (-1);
 }
 
+int
+ipmi_ctx_open_inband_shared (ipmi_ctx_t ctx, ipmi_ctx_t shared_ctx)
+{
+  unsigned int seedp;
+
+  if (!ctx || ctx->magic != IPMI_CTX_MAGIC)
+    {
+      ERR_TRACE (ipmi_ctx_errormsg (ctx), ipmi_ctx_errnum (ctx));
+      return (-1);
+    }
+
+  if (!shared_ctx
+      || shared_ctx->magic != IPMI_CTX_MAGIC
+      || shared_ctx == ctx)
+    {
+      API_SET_ERRNUM (ctx, IPMI_ERR_PARAMETERS);
+      return (-1);
+    }
+
+  if (ctx->type != IPMI_DEVICE_UNKNOWN)
+    {
+      API_SET_ERRNUM (ctx, IPMI_ERR_DEVICE_ALREADY_OPEN);
+      return (-1);
+    }
+
+  if (shared_ctx->type == IPMI_DEVICE_UNKNOWN)
+    {
+      API_SET_ERRNUM (ctx, IPMI_ERR_DEVICE_NOT_OPEN);
+      return (-1);
+    }
+
+  if (shared_ctx->type != IPMI_DEVICE_OPENIPMI)
+    {
+      API_SET_ERRNUM (ctx, IPMI_ERR_DEVICE_NOT_SUPPORTED);
+      return (-1);
+    }
+
+  ctx->workaround_flags_inband = shared_ctx->workaround_flags_inband;
+  ctx->flags = shared_ctx->flags;
+
+  ctx->io.inband.kcs_ctx = NULL;
+  ctx->io.inband.ssif_ctx = NULL;
+  ctx->io.inband.openipmi_ctx = shared_ctx->io.inband.openipmi_ctx;
+  ctx->io.inband.openipmi_ctx_shared = 1;
+  ctx->io.inband.sunbmc_ctx = NULL;
+  ctx->io.inband.inteldcmi_ctx = NULL;
+  ctx->io.inband.mock_ctx = NULL;
+  ctx->io.inband.broker_ctx = NULL;
+
+  seedp = (unsigned int) clock () + (unsigned int) time (NULL);
+  srand (seedp);
+
+  ctx->io.inband.rq_seq = (double)(IPMI_IPMB_REQUESTER_SEQUENCE_NUMBER_MAX) * (rand ()/(RAND_MAX + 1.0));
+
+  ctx->type = IPMI_DEVICE_OPENIPMI;
+
+  if (!(ctx->io.inband.rq.obj_hdr = fiid_obj_create (tmpl_hdr_kcs)))
+    {
+      API_ERRNO_TO_API_ERRNUM (ctx, errno);
+      goto cleanup;
+    }
+  if (!(ctx->io.inband.rs.obj_hdr = fiid_obj_create (tmpl_hdr_kcs)))
+    {
+      API_ERRNO_TO_API_ERRNUM (ctx, errno);
+      goto cleanup;
+    }
+
+  ctx->errnum = IPMI_ERR_SUCCESS;
+  return (0);
+
+ cleanup:
+  _ipmi_inband_free (ctx);
+  ctx->type = IPMI_DEVICE_UNKNOWN;
+  return (-1);
+}
+
 static int
 _is_ctx_fatal_error (ipmi_ctx_t ctx)
 {
@@ -1579,6 +2225,42 @@ ipmi_ctx_get_target (ipmi_ctx_t ctx,
   return (0);
 }
 
+/* count the completion of a blocking command started at 'start'.
+ * comp_code_error is set if a response with a completion code other
+ * than success was received.
+ */
+static void
+_ipmi_cmd_stats (ipmi_ctx_t ctx,
+                 int rv,
+                 int comp_code_error,
+                 const struct timeval *start)
+{
+  struct timeval end;
+
+  assert (ctx
+          && ctx->magic == IPMI_CTX_MAGIC
+          && ctx->stats_cmd
+          && start);
+
+  if (comp_code_error)
+    ctx->stats_cmd->errors++;
+  else if (rv < 0)
+    {
+      if (ctx->errnum == IPMI_ERR_SESSION_TIMEOUT
+          || ctx->errnum == IPMI_ERR_DRIVER_TIMEOUT
+          || ctx->errnum == IPMI_ERR_MESSAGE_TIMEOUT)
+        ctx->stats_cmd->timeouts++;
+      return;
+    }
+
+  /* ignore error, count the response without its latency */
+  if (!timerisset (start)
+      || gettimeofday (&end, NULL) < 0)
+    return;
+
+  api_stats_latency (ctx->stats_cmd, start, &end);
+}
+
 int
 ipmi_cmd (ipmi_ctx_t ctx,
           uint8_t lun,
@@ -1586,6 +2268,9 @@ ipmi_cmd (ipmi_ctx_t ctx,
           fiid_obj_t obj_cmd_rq,
           fiid_obj_t obj_cmd_rs)
 {
+  struct ipmi_stats_counters *stats_cmd_save;
+  struct timeval start;
+  uint64_t val;
   int rv = 0;
 
   /* achu:
@@ -1619,12 +2304,22 @@ ipmi_cmd (ipmi_ctx_t ctx,
       && ctx->type != IPMI_DEVICE_SSIF
       && ctx->type != IPMI_DEVICE_OPENIPMI
       && ctx->type != IPMI_DEVICE_SUNBMC
-      && ctx->type != IPMI_DEVICE_INTELDCMI)
+      && ctx->type != IPMI_DEVICE_INTELDCMI
+      && ctx->type != IPMI_DEVICE_MOCK
+      && ctx->type != IPMI_DEVICE_BROKER)
     {
       API_SET_ERRNUM (ctx, IPMI_ERR_INTERNAL_ERROR);
       return (-1);
     }
 
+  if ((ctx->type == IPMI_DEVICE_LAN
+       || ctx->type == IPMI_DEVICE_LAN_2_0)
+      && ctx->io.outofband.async.op != IPMI_CTX_ASYNC_OP_NONE)
+    {
+      API_SET_ERRNUM (ctx, IPMI_ERR_DRIVER_BUSY);
+      return (-1);
+    }
+
   if (!fiid_obj_valid (obj_cmd_rq)
       || !fiid_obj_valid (obj_cmd_rs))
     {
@@ -1710,6 +2405,16 @@ ipmi_cmd (ipmi_ctx_t ctx,
         }
     }
 
+  /* ipmi_cmd() may be called recursively for bridged requests */
+  ctx->arena_depth++;
+
+  stats_cmd_save = ctx->stats_cmd;
+  ctx->stats_cmd = api_stats_cmd_obj (ctx, net_fn, obj_cmd_rq);
+  ctx->stats_cmd->requests++;
+  /* ignore error, count the command without its latency */
+  if (gettimeofday (&start, NULL) < 0)
+    timerclear (&start);
+
   if (ctx->type == IPMI_DEVICE_LAN)
     {
       if (ctx->target.channel_number_is_set
@@ -1771,6 +2476,27 @@ ipmi_cmd (ipmi_ctx_t ctx,
       else
         rv = api_sunbmc_cmd (ctx, obj_cmd_rq, obj_cmd_rs);
     }
+  else if (ctx->type == IPMI_DEVICE_MOCK)
+    {
+      if (ctx->target.channel_number_is_set
+          && ctx->target.rs_addr_is_set)
+        {
+          API_SET_ERRNUM (ctx, IPMI_ERR_COMMAND_INVALID_FOR_SELECTED_INTERFACE);
+          rv = -1;
+        }
+      else
+        rv = api_mock_cmd (ctx, obj_cmd_rq, obj_cmd_rs);
+    }
+  else if (ctx->type == IPMI_DEVICE_BROKER)
+    {
+      if (ctx->target.channel_number_is_set
+          && ctx->target.rs_addr_is_set)
+        rv = api_broker_cmd_ipmb (ctx,
+                                  obj_cmd_rq,
+                                  obj_cmd_rs);
+      else
+        rv = api_broker_cmd (ctx, obj_cmd_rq, obj_cmd_rs);
+    }
   else /* ctx->type == IPMI_DEVICE_INTELDCMI */
     {
       if (ctx->target.channel_number_is_set
@@ -1782,6 +2508,17 @@ ipmi_cmd (ipmi_ctx_t ctx,
         rv = api_inteldcmi_cmd (ctx, obj_cmd_rq, obj_cmd_rs);
     }
 
+  /* ignore error, no completion code is not a bad one */
+  _ipmi_cmd_stats (ctx,
+                   rv,
+                   (FIID_OBJ_GET (obj_cmd_rs, "comp_code", &val) == 1
+                    && val != IPMI_COMP_CODE_COMMAND_SUCCESS),
+                   &start);
+  ctx->stats_cmd = stats_cmd_save;
+
+  if (!--ctx->arena_depth)
+    fiid_arena_reset (ctx->arena);
+
   if (ctx->flags & IPMI_FLAGS_DEBUG_DUMP)
     {
       /* lan packets are dumped in ipmi lan code */
@@ -1897,6 +2634,8 @@ ipmi_cmd_raw (ipmi_ctx_t ctx,
               void *buf_rs,
               unsigned int buf_rs_len)
 {
+  struct ipmi_stats_counters *stats_cmd_save;
+  struct timeval start;
   int rv = 0;
 
   if (!ctx || ctx->magic != IPMI_CTX_MAGIC)
@@ -1939,12 +2678,22 @@ ipmi_cmd_raw (ipmi_ctx_t ctx,
       && ctx->type != IPMI_DEVICE_SSIF
       && ctx->type != IPMI_DEVICE_OPENIPMI
       && ctx->type != IPMI_DEVICE_SUNBMC
-      && ctx->type != IPMI_DEVICE_INTELDCMI)
+      && ctx->type != IPMI_DEVICE_INTELDCMI
+      && ctx->type != IPMI_DEVICE_MOCK
+      && ctx->type != IPMI_DEVICE_BROKER)
     {
       API_SET_ERRNUM (ctx, IPMI_ERR_INTERNAL_ERROR);
       return (-1);
     }
 
+  if ((ctx->type == IPMI_DEVICE_LAN
+       || ctx->type == IPMI_DEVICE_LAN_2_0)
+      && ctx->io.outofband.async.op != IPMI_CTX_ASYNC_OP_NONE)
+    {
+      API_SET_ERRNUM (ctx, IPMI_ERR_DRIVER_BUSY);
+      return (-1);
+    }
+
   ctx->target.lun = lun;
   ctx->target.net_fn = net_fn;
 
@@ -1986,6 +2735,15 @@ ipmi_cmd_raw (ipmi_ctx_t ctx,
         }
     }
 
+  ctx->arena_depth++;
+
+  stats_cmd_save = ctx->stats_cmd;
+  ctx->stats_cmd = api_stats_cmd (ctx, net_fn, ((uint8_t *)buf_rq)[0]);
+  ctx->stats_cmd->requests++;
+  /* ignore error, count the command without its latency */
+  if (gettimeofday (&start, NULL) < 0)
+    timerclear (&start);
+
   if (ctx->type == IPMI_DEVICE_LAN)
     {
       if (ctx->target.channel_number_is_set
@@ -2057,6 +2815,29 @@ ipmi_cmd_raw (ipmi_ctx_t ctx,
       else
         rv = api_sunbmc_cmd_raw (ctx, buf_rq, buf_rq_len, buf_rs, buf_rs_len);
     }
+  else if (ctx->type == IPMI_DEVICE_MOCK)
+    {
+      if (ctx->target.channel_number_is_set
+          && ctx->target.rs_addr_is_set)
+        {
+          API_SET_ERRNUM (ctx, IPMI_ERR_COMMAND_INVALID_FOR_SELECTED_INTERFACE);
+          rv = -1;
+        }
+      else
+        rv = api_mock_cmd_raw (ctx, buf_rq, buf_rq_len, buf_rs, buf_rs_len);
+    }
+  else if (ctx->type == IPMI_DEVICE_BROKER)
+    {
+      if (ctx->target.channel_number_is_set
+          && ctx->target.rs_addr_is_set)
+        rv = api_broker_cmd_raw_ipmb (ctx,
+                                      buf_rq,
+                                      buf_rq_len,
+                                      buf_rs,
+                                      buf_rs_len);
+      else
+        rv = api_broker_cmd_raw (ctx, buf_rq, buf_rq_len, buf_rs, buf_rs_len);
+    }
   else /* ctx->type == IPMI_DEVICE_INTELDCMI */
     {
       if (ctx->target.channel_number_is_set
@@ -2070,6 +2851,19 @@ ipmi_cmd_raw (ipmi_ctx_t ctx,
         rv = api_inteldcmi_cmd_raw (ctx, buf_rq, buf_rq_len, buf_rs, buf_rs_len);
     }
 
+  /* raw responses are the command and completion code followed by
+   * data
+   */
+  _ipmi_cmd_stats (ctx,
+                   rv,
+                   (rv >= 2
+                    && ((uint8_t *)buf_rs)[1] != IPMI_COMP_CODE_COMMAND_SUCCESS),
+                   &start);
+  ctx->stats_cmd = stats_cmd_save;
+
+  if (!--ctx->arena_depth)
+    fiid_arena_reset (ctx->arena);
+
   if (ctx->flags & IPMI_FLAGS_DEBUG_DUMP && rv >= 0)
     {
       /* lan packets are dumped in ipmi lan code */
@@ -2160,6 +2954,321 @@ ipmi_cmd_raw_ipmb (ipmi_ctx_t ctx,
   return (rv);
 }
 
+int
+ipmi_ctx_get_async_window (ipmi_ctx_t ctx, unsigned int *window)
+{
+  if (!ctx || ctx->magic != IPMI_CTX_MAGIC)
+    {
+      ERR_TRACE (ipmi_ctx_errormsg (ctx), ipmi_ctx_errnum (ctx));
+      return (-1);
+    }
+
+  if (!window)
+    {
+      API_SET_ERRNUM (ctx, IPMI_ERR_PARAMETERS);
+      return (-1);
+    }
+
+  (*window) = ctx->async_window;
+  ctx->errnum = IPMI_ERR_SUCCESS;
+  return (0);
+}
+
+int
+ipmi_ctx_set_async_window (ipmi_ctx_t ctx, unsigned int window)
+{
+  if (!ctx || ctx->magic != IPMI_CTX_MAGIC)
+    {
+      ERR_TRACE (ipmi_ctx_errormsg (ctx), ipmi_ctx_errnum (ctx));
+      return (-1);
+    }
+
+  if (!window
+      || window > IPMI_ASYNC_WINDOW_MAX)
+    {
+      API_SET_ERRNUM (ctx, IPMI_ERR_PARAMETERS);
+      return (-1);
+    }
+
+  ctx->async_window = window;
+  ctx->errnum = IPMI_ERR_SUCCESS;
+  return (0);
+}
+
+int
+ipmi_cmd_async (ipmi_ctx_t ctx,
+                uint8_t lun,
+                uint8_t net_fn,
+                fiid_obj_t obj_cmd_rq,
+                fiid_obj_t obj_cmd_rs,
+                Ipmi_Ctx_Async_Callback callback,
+                void *callback_data)
+{
+  if (!ctx || ctx->magic != IPMI_CTX_MAGIC)
+    {
+      ERR_TRACE (ipmi_ctx_errormsg (ctx), ipmi_ctx_errnum (ctx));
+      return (-1);
+    }
+
+  if (!fiid_obj_valid (obj_cmd_rq)
+      || !fiid_obj_valid (obj_cmd_rs)
+      || !callback)
+    {
+      API_SET_ERRNUM (ctx, IPMI_ERR_PARAMETERS);
+      return (-1);
+    }
+
+  if (ctx->type == IPMI_DEVICE_UNKNOWN)
+    {
+      API_SET_ERRNUM (ctx, IPMI_ERR_DEVICE_NOT_OPEN);
+      return (-1);
+    }
+
+  if (ctx->type != IPMI_DEVICE_LAN
+      && ctx->type != IPMI_DEVICE_LAN_2_0)
+    {
+      API_SET_ERRNUM (ctx, IPMI_ERR_COMMAND_INVALID_FOR_SELECTED_INTERFACE);
+      return (-1);
+    }
+
+  /* bridging is not supported asynchronously */
+  if (ctx->target.channel_number_is_set
+      && ctx->target.rs_addr_is_set)
+    {
+      API_SET_ERRNUM (ctx, IPMI_ERR_COMMAND_INVALID_FOR_SELECTED_INTERFACE);
+      return (-1);
+    }
+
+  if (ctx->io.outofband.async.op == IPMI_CTX_ASYNC_OP_OPEN_SESSION
+      || ctx->io.outofband.async.rq_count >= ctx->async_window)
+    {
+      API_SET_ERRNUM (ctx, IPMI_ERR_DRIVER_BUSY);
+      return (-1);
+    }
+
+  if (FIID_OBJ_PACKET_VALID (obj_cmd_rq) < 0)
+    {
+      API_FIID_OBJECT_ERROR_TO_API_ERRNUM (ctx, obj_cmd_rq);
+      return (-1);
+    }
+
+  ctx->target.lun = lun;
+  ctx->target.net_fn = net_fn;
+
+  /* errnum set in api_lan_async_cmd */
+  if (api_lan_async_cmd (ctx,
+                         obj_cmd_rq,
+                         obj_cmd_rs,
+                         callback,
+                         callback_data) < 0)
+    return (-1);
+
+  ctx->errnum = IPMI_ERR_SUCCESS;
+  return (0);
+}
+
+int
+ipmi_ctx_get_fd (ipmi_ctx_t ctx)
+{
+  if (!ctx || ctx->magic != IPMI_CTX_MAGIC)
+    {
+      ERR_TRACE (ipmi_ctx_errormsg (ctx), ipmi_ctx_errnum (ctx));
+      return (-1);
+    }
+
+  if (ctx->type == IPMI_DEVICE_UNKNOWN)
+    {
+      API_SET_ERRNUM (ctx, IPMI_ERR_DEVICE_NOT_OPEN);
+      return (-1);
+    }
+
+  if (ctx->type != IPMI_DEVICE_LAN
+      && ctx->type != IPMI_DEVICE_LAN_2_0)
+    {
+      API_SET_ERRNUM (ctx, IPMI_ERR_COMMAND_INVALID_FOR_SELECTED_INTERFACE);
+      return (-1);
+    }
+
+  ctx->errnum = IPMI_ERR_SUCCESS;
+  return (ctx->io.outofband.sockfd);
+}
+
+int
+ipmi_ctx_async_timeout (ipmi_ctx_t ctx, int *timeout)
+{
+  if (!ctx || ctx->magic != IPMI_CTX_MAGIC)
+    {
+      ERR_TRACE (ipmi_ctx_errormsg (ctx), ipmi_ctx_errnum (ctx));
+      return (-1);
+    }
+
+  if (!timeout)
+    {
+      API_SET_ERRNUM (ctx, IPMI_ERR_PARAMETERS);
+      return (-1);
+    }
+
+  if (ctx->type == IPMI_DEVICE_UNKNOWN)
+    {
+      API_SET_ERRNUM (ctx, IPMI_ERR_DEVICE_NOT_OPEN);
+      return (-1);
+    }
+
+  if (ctx->type != IPMI_DEVICE_LAN
+      && ctx->type != IPMI_DEVICE_LAN_2_0)
+    {
+      API_SET_ERRNUM (ctx, IPMI_ERR_COMMAND_INVALID_FOR_SELECTED_INTERFACE);
+      return (-1);
+    }
+
+  if (ctx->io.outofband.async.op == IPMI_CTX_ASYNC_OP_NONE)
+    {
+      (*timeout) = -1;
+      ctx->errnum = IPMI_ERR_SUCCESS;
+      return (0);
+    }
+
+  /* errnum set in api_lan_async_timeout */
+  if (api_lan_async_timeout (ctx, timeout) < 0)
+    return (-1);
+
+  ctx->errnum = IPMI_ERR_SUCCESS;
+  return (0);
+}
+
+int
+ipmi_ctx_async_process (ipmi_ctx_t ctx, short revents)
+{
+  Ipmi_Ctx_Async_Callback callback;
+  void *callback_data;
+  int op;
+  int ret;
+
+  if (!ctx || ctx->magic != IPMI_CTX_MAGIC)
+    {
+      ERR_TRACE (ipmi_ctx_errormsg (ctx), ipmi_ctx_errnum (ctx));
+      return (-1);
+    }
+
+  if (ctx->type == IPMI_DEVICE_UNKNOWN)
+    {
+      API_SET_ERRNUM (ctx, IPMI_ERR_DEVICE_NOT_OPEN);
+      return (-1);
+    }
+
+  if (ctx->type != IPMI_DEVICE_LAN
+      && ctx->type != IPMI_DEVICE_LAN_2_0)
+    {
+      API_SET_ERRNUM (ctx, IPMI_ERR_COMMAND_INVALID_FOR_SELECTED_INTERFACE);
+      return (-1);
+    }
+
+  if (ctx->io.outofband.async.op == IPMI_CTX_ASYNC_OP_NONE)
+    {
+      ctx->errnum = IPMI_ERR_SUCCESS;
+      return (0);
+    }
+
+  /* errnum set in api_lan_async_process */
+  if (!(ret = api_lan_async_process (ctx, revents)))
+    {
+      ctx->errnum = IPMI_ERR_SUCCESS;
+      return (0);
+    }
+
+  if (ctx->io.outofband.async.op == IPMI_CTX_ASYNC_OP_CMD)
+    {
+      /* errnum set in api_lan_async_cmd_complete */
+      ret = api_lan_async_cmd_complete (ctx, &callback, &callback_data);
+
+      /* must be last, callback may close or destroy the context */
+      callback (ctx, ret, callback_data);
+      return (0);
+    }
+
+  op = ctx->io.outofband.async.op;
+  callback = ctx->io.outofband.async.callback;
+  callback_data = ctx->io.outofband.async.callback_data;
+
+  api_lan_async_cleanup (ctx);
+
+  if (ret < 0)
+    {
+      /* failed open leaves the context closed, errnum preserved */
+      if (op == IPMI_CTX_ASYNC_OP_OPEN_SESSION)
+        {
+          _ipmi_outofband_socket_close (ctx);
+          _ipmi_outofband_free (ctx);
+          ctx->type = IPMI_DEVICE_UNKNOWN;
+        }
+      ret = -1;
+    }
+  else
+    {
+      ctx->errnum = IPMI_ERR_SUCCESS;
+      ret = 0;
+    }
+
+  /* must be last, callback may close or destroy the context */
+  callback (ctx, ret, callback_data);
+  return (0);
+}
+
+int
+ipmi_ctx_async_wait (ipmi_ctx_t ctx)
+{
+  struct pollfd pfd;
+  int timeout;
+  int n;
+
+  if (!ctx || ctx->magic != IPMI_CTX_MAGIC)
+    {
+      ERR_TRACE (ipmi_ctx_errormsg (ctx), ipmi_ctx_errnum (ctx));
+      return (-1);
+    }
+
+  if (ctx->type == IPMI_DEVICE_UNKNOWN)
+    {
+      API_SET_ERRNUM (ctx, IPMI_ERR_DEVICE_NOT_OPEN);
+      return (-1);
+    }
+
+  if (ctx->type != IPMI_DEVICE_LAN
+      && ctx->type != IPMI_DEVICE_LAN_2_0)
+    {
+      API_SET_ERRNUM (ctx, IPMI_ERR_COMMAND_INVALID_FOR_SELECTED_INTERFACE);
+      return (-1);
+    }
+
+  /* a callback may close the context */
+  while ((ctx->type == IPMI_DEVICE_LAN
+          || ctx->type == IPMI_DEVICE_LAN_2_0)
+         && ctx->io.outofband.async.op != IPMI_CTX_ASYNC_OP_NONE)
+    {
+      /* errnum set in api_lan_async_timeout */
+      if (api_lan_async_timeout (ctx, &timeout) < 0)
+        return (-1);
+
+      pfd.fd = ctx->io.outofband.sockfd;
+      pfd.events = POLLIN;
+      pfd.revents = 0;
+
+      if ((n = poll (&pfd, 1, timeout)) < 0)
+        {
+          if (errno == EINTR)
+            continue;
+          API_ERRNO_TO_API_ERRNUM (ctx, errno);
+          return (-1);
+        }
+
+      if (ipmi_ctx_async_process (ctx, n ? pfd.revents : 0) < 0)
+        return (-1);
+    }
+
+  ctx->errnum = IPMI_ERR_SUCCESS;
+  return (0);
+}
+
 static void
 _ipmi_outofband_close (ipmi_ctx_t ctx)
 {
@@ -2171,6 +3280,17 @@ _ipmi_outofband_close (ipmi_ctx_t ctx)
   /* No need to set errnum - if the anything in close session
    * fails, session will eventually timeout anyways
    */
+  if (ctx->io.outofband.async.op != IPMI_CTX_ASYNC_OP_NONE)
+    {
+      int op = ctx->io.outofband.async.op;
+
+      api_lan_async_cleanup (ctx);
+
+      /* session not yet established, nothing to close */
+      if (op == IPMI_CTX_ASYNC_OP_OPEN_SESSION)
+        goto cleanup;
+    }
+
   if (!(ctx->flags & IPMI_FLAGS_NOSESSION))
     {
       if (api_lan_close_session (ctx) < 0)
@@ -2178,9 +3298,7 @@ _ipmi_outofband_close (ipmi_ctx_t ctx)
     }
 
  cleanup:
-  /* ignore potential error, destroy path */
-  if (ctx->io.outofband.sockfd)
-    close (ctx->io.outofband.sockfd);
+  _ipmi_outofband_socket_close (ctx);
   _ipmi_outofband_free (ctx);
 }
 
@@ -2195,14 +3313,23 @@ _ipmi_outofband_2_0_close (ipmi_ctx_t ctx)
   /* No need to set errnum - if the anything in close session
    * fails, session will eventually timeout anyways
    */
+  if (ctx->io.outofband.async.op != IPMI_CTX_ASYNC_OP_NONE)
+    {
+      int op = ctx->io.outofband.async.op;
+
+      api_lan_async_cleanup (ctx);
+
+      /* session not yet established, nothing to close */
+      if (op == IPMI_CTX_ASYNC_OP_OPEN_SESSION)
+        goto cleanup;
+    }
 
   if (api_lan_2_0_close_session (ctx) < 0)
     goto cleanup;
 
  cleanup:
-  /* ignore potential error, destroy path */
-  if (ctx->io.outofband.sockfd)
-    close (ctx->io.outofband.sockfd);
+  _ipmi_outofband_2_0_keys_flush (ctx);
+  _ipmi_outofband_socket_close (ctx);
   _ipmi_outofband_free (ctx);
 }
 
@@ -2218,7 +3345,9 @@ _ipmi_inband_close (ipmi_ctx_t ctx)
               || ctx->type == IPMI_DEVICE_SSIF
               || ctx->type == IPMI_DEVICE_OPENIPMI
               || ctx->type == IPMI_DEVICE_SUNBMC
-              || ctx->type == IPMI_DEVICE_INTELDCMI));
+              || ctx->type == IPMI_DEVICE_INTELDCMI
+              || ctx->type == IPMI_DEVICE_MOCK
+              || ctx->type == IPMI_DEVICE_BROKER));
 
   _ipmi_inband_free (ctx);
 }
@@ -2246,7 +3375,9 @@ ipmi_ctx_close (ipmi_ctx_t ctx)
       && ctx->type != IPMI_DEVICE_SSIF
       && ctx->type != IPMI_DEVICE_OPENIPMI
       && ctx->type != IPMI_DEVICE_SUNBMC
-      && ctx->type != IPMI_DEVICE_INTELDCMI)
+      && ctx->type != IPMI_DEVICE_INTELDCMI
+      && ctx->type != IPMI_DEVICE_MOCK
+      && ctx->type != IPMI_DEVICE_BROKER)
     {
       API_SET_ERRNUM (ctx, IPMI_ERR_INTERNAL_ERROR);
       return (-1);
@@ -2263,6 +3394,9 @@ ipmi_ctx_close (ipmi_ctx_t ctx)
   else
     _ipmi_inband_close (ctx);
 
+  /* a socket of the next session may reuse the descriptor */
+  ctx->pkt_trace.sockfd = -1;
+
   ctx->type = IPMI_DEVICE_UNKNOWN;
   ctx->errnum = IPMI_ERR_SUCCESS;
   return (0);
@@ -2280,6 +3414,17 @@ ipmi_ctx_destroy (ipmi_ctx_t ctx)
   if (ctx->type != IPMI_DEVICE_UNKNOWN)
     ipmi_ctx_close (ctx);
 
+  api_fiid_obj_pool_destroy (ctx);
+  api_pkt_buf_destroy (ctx);
+  fiid_arena_destroy (ctx->arena);
+
+  if (ctx->mux)
+    api_mux_unref (ctx->mux);
+
+  free (ctx->session_cache_directory);
+
+  api_pkt_trace_destroy (ctx);
+
   /* secure_memset b/c ctx contains ipmi password */
   secure_memset (ctx, '\0', sizeof (struct ipmi_ctx));
   free (ctx);
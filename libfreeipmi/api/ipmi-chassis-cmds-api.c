@@ -69,7 +69,7 @@ ipmi_cmd_get_chassis_capabilities (ipmi_ctx_t ctx,
       return (-1);
     }
 
-  if (!(obj_cmd_rq = fiid_obj_create (tmpl_cmd_get_chassis_capabilities_rq)))
+  if (!(obj_cmd_rq = api_fiid_obj_get (ctx, tmpl_cmd_get_chassis_capabilities_rq)))
     {
       API_ERRNO_TO_API_ERRNUM (ctx, errno);
       goto cleanup;
@@ -93,7 +93,7 @@ ipmi_cmd_get_chassis_capabilities (ipmi_ctx_t ctx,
 
   rv = 0;
  cleanup:
-  fiid_obj_destroy (obj_cmd_rq);
+  api_fiid_obj_put (ctx, obj_cmd_rq);
   return (rv);
 }
 
@@ -123,7 +123,7 @@ ipmi_cmd_get_chassis_status (ipmi_ctx_t ctx,
       return (-1);
     }
 
-  if (!(obj_cmd_rq = fiid_obj_create (tmpl_cmd_get_chassis_status_rq)))
+  if (!(obj_cmd_rq = api_fiid_obj_get (ctx, tmpl_cmd_get_chassis_status_rq)))
     {
       API_ERRNO_TO_API_ERRNUM (ctx, errno);
       goto cleanup;
@@ -147,7 +147,7 @@ ipmi_cmd_get_chassis_status (ipmi_ctx_t ctx,
 
   rv = 0;
  cleanup:
-  fiid_obj_destroy (obj_cmd_rq);
+  api_fiid_obj_put (ctx, obj_cmd_rq);
   return (rv);
 }
 
@@ -179,7 +179,7 @@ ipmi_cmd_chassis_control (ipmi_ctx_t ctx,
       return (-1);
     }
 
-  if (!(obj_cmd_rq = fiid_obj_create (tmpl_cmd_chassis_control_rq)))
+  if (!(obj_cmd_rq = api_fiid_obj_get (ctx, tmpl_cmd_chassis_control_rq)))
     {
       API_ERRNO_TO_API_ERRNUM (ctx, errno);
       goto cleanup;
@@ -203,7 +203,7 @@ ipmi_cmd_chassis_control (ipmi_ctx_t ctx,
 
   rv = 0;
  cleanup:
-  fiid_obj_destroy (obj_cmd_rq);
+  api_fiid_obj_put (ctx, obj_cmd_rq);
   return (rv);
 }
 
@@ -236,7 +236,7 @@ ipmi_cmd_chassis_identify (ipmi_ctx_t ctx,
       return (-1);
     }
 
-  if (!(obj_cmd_rq = fiid_obj_create (tmpl_cmd_chassis_identify_rq)))
+  if (!(obj_cmd_rq = api_fiid_obj_get (ctx, tmpl_cmd_chassis_identify_rq)))
     {
       API_ERRNO_TO_API_ERRNUM (ctx, errno);
       goto cleanup;
@@ -262,7 +262,7 @@ ipmi_cmd_chassis_identify (ipmi_ctx_t ctx,
 
   rv = 0;
  cleanup:
-  fiid_obj_destroy (obj_cmd_rq);
+  api_fiid_obj_put (ctx, obj_cmd_rq);
   return (rv);
 }
 
@@ -297,7 +297,7 @@ ipmi_cmd_set_front_panel_enables (ipmi_ctx_t ctx,
       return (-1);
     }
 
-  if (!(obj_cmd_rq = fiid_obj_create (tmpl_cmd_set_front_panel_enables_rq)))
+  if (!(obj_cmd_rq = api_fiid_obj_get (ctx, tmpl_cmd_set_front_panel_enables_rq)))
     {
       API_ERRNO_TO_API_ERRNUM (ctx, errno);
       goto cleanup;
@@ -325,7 +325,7 @@ ipmi_cmd_set_front_panel_enables (ipmi_ctx_t ctx,
 
   rv = 0;
  cleanup:
-  fiid_obj_destroy (obj_cmd_rq);
+  api_fiid_obj_put (ctx, obj_cmd_rq);
   return (rv);
 }
 
@@ -357,7 +357,7 @@ ipmi_cmd_set_power_restore_policy (ipmi_ctx_t ctx,
       return (-1);
     }
 
-  if (!(obj_cmd_rq = fiid_obj_create (tmpl_cmd_set_power_restore_policy_rq)))
+  if (!(obj_cmd_rq = api_fiid_obj_get (ctx, tmpl_cmd_set_power_restore_policy_rq)))
     {
       API_ERRNO_TO_API_ERRNUM (ctx, errno);
       goto cleanup;
@@ -382,7 +382,7 @@ ipmi_cmd_set_power_restore_policy (ipmi_ctx_t ctx,
 
   rv = 0;
  cleanup:
-  fiid_obj_destroy (obj_cmd_rq);
+  api_fiid_obj_put (ctx, obj_cmd_rq);
   return (rv);
 }
 
@@ -413,7 +413,7 @@ ipmi_cmd_set_power_cycle_interval (ipmi_ctx_t ctx,
       return (-1);
     }
 
-  if (!(obj_cmd_rq = fiid_obj_create (tmpl_cmd_set_power_cycle_interval_rq)))
+  if (!(obj_cmd_rq = api_fiid_obj_get (ctx, tmpl_cmd_set_power_cycle_interval_rq)))
     {
       API_ERRNO_TO_API_ERRNUM (ctx, errno);
       goto cleanup;
@@ -437,7 +437,7 @@ ipmi_cmd_set_power_cycle_interval (ipmi_ctx_t ctx,
 
   rv = 0;
  cleanup:
-  fiid_obj_destroy (obj_cmd_rq);
+  api_fiid_obj_put (ctx, obj_cmd_rq);
   return (rv);
 }
 
@@ -467,7 +467,7 @@ ipmi_cmd_get_system_restart_cause (ipmi_ctx_t ctx,
       return (-1);
     }
 
-  if (!(obj_cmd_rq = fiid_obj_create (tmpl_cmd_get_system_restart_cause_rq)))
+  if (!(obj_cmd_rq = api_fiid_obj_get (ctx, tmpl_cmd_get_system_restart_cause_rq)))
     {
       API_ERRNO_TO_API_ERRNUM (ctx, errno);
       goto cleanup;
@@ -491,7 +491,7 @@ ipmi_cmd_get_system_restart_cause (ipmi_ctx_t ctx,
 
   rv = 0;
  cleanup:
-  fiid_obj_destroy (obj_cmd_rq);
+  api_fiid_obj_put (ctx, obj_cmd_rq);
   return (rv);
 }
 
@@ -526,7 +526,7 @@ ipmi_cmd_set_system_boot_options (ipmi_ctx_t ctx,
       return (-1);
     }
 
-  if (!(obj_cmd_rq = fiid_obj_create (tmpl_cmd_set_system_boot_options_rq)))
+  if (!(obj_cmd_rq = api_fiid_obj_get (ctx, tmpl_cmd_set_system_boot_options_rq)))
     {
       API_ERRNO_TO_API_ERRNUM (ctx, errno);
       goto cleanup;
@@ -554,7 +554,7 @@ ipmi_cmd_set_system_boot_options (ipmi_ctx_t ctx,
 
   rv = 0;
  cleanup:
-  fiid_obj_destroy (obj_cmd_rq);
+  api_fiid_obj_put (ctx, obj_cmd_rq);
   return (rv);
 }
 
@@ -587,7 +587,7 @@ ipmi_cmd_set_system_boot_options_set_in_progress (ipmi_ctx_t ctx,
       return (-1);
     }
 
-  if (!(obj_cmd_rq = fiid_obj_create (tmpl_cmd_set_system_boot_options_set_in_progress_rq)))
+  if (!(obj_cmd_rq = api_fiid_obj_get (ctx, tmpl_cmd_set_system_boot_options_set_in_progress_rq)))
     {
       API_ERRNO_TO_API_ERRNUM (ctx, errno);
       goto cleanup;
@@ -613,7 +613,7 @@ ipmi_cmd_set_system_boot_options_set_in_progress (ipmi_ctx_t ctx,
 
   rv = 0;
  cleanup:
-  fiid_obj_destroy (obj_cmd_rq);
+  api_fiid_obj_put (ctx, obj_cmd_rq);
   return (rv);
 }
 
@@ -646,7 +646,7 @@ ipmi_cmd_set_system_boot_options_service_partition_selector (ipmi_ctx_t ctx,
       return (-1);
     }
 
-  if (!(obj_cmd_rq = fiid_obj_create (tmpl_cmd_set_system_boot_options_service_partition_selector_rq)))
+  if (!(obj_cmd_rq = api_fiid_obj_get (ctx, tmpl_cmd_set_system_boot_options_service_partition_selector_rq)))
     {
       API_ERRNO_TO_API_ERRNUM (ctx, errno);
       goto cleanup;
@@ -672,7 +672,7 @@ ipmi_cmd_set_system_boot_options_service_partition_selector (ipmi_ctx_t ctx,
 
   rv = 0;
  cleanup:
-  fiid_obj_destroy (obj_cmd_rq);
+  api_fiid_obj_put (ctx, obj_cmd_rq);
   return (rv);
 }
 
@@ -706,7 +706,7 @@ ipmi_cmd_set_system_boot_options_service_partition_scan (ipmi_ctx_t ctx,
       return (-1);
     }
 
-  if (!(obj_cmd_rq = fiid_obj_create (tmpl_cmd_set_system_boot_options_service_partition_scan_rq)))
+  if (!(obj_cmd_rq = api_fiid_obj_get (ctx, tmpl_cmd_set_system_boot_options_service_partition_scan_rq)))
     {
       API_ERRNO_TO_API_ERRNUM (ctx, errno);
       goto cleanup;
@@ -733,7 +733,7 @@ ipmi_cmd_set_system_boot_options_service_partition_scan (ipmi_ctx_t ctx,
 
   rv = 0;
  cleanup:
-  fiid_obj_destroy (obj_cmd_rq);
+  api_fiid_obj_put (ctx, obj_cmd_rq);
   return (rv);
 }
 
@@ -770,7 +770,7 @@ ipmi_cmd_set_system_boot_options_BMC_boot_flag_valid_bit_clearing (ipmi_ctx_t ct
       return (-1);
     }
 
-  if (!(obj_cmd_rq = fiid_obj_create (tmpl_cmd_set_system_boot_options_BMC_boot_flag_valid_bit_clearing_rq)))
+  if (!(obj_cmd_rq = api_fiid_obj_get (ctx, tmpl_cmd_set_system_boot_options_BMC_boot_flag_valid_bit_clearing_rq)))
     {
       API_ERRNO_TO_API_ERRNUM (ctx, errno);
       goto cleanup;
@@ -800,7 +800,7 @@ ipmi_cmd_set_system_boot_options_BMC_boot_flag_valid_bit_clearing (ipmi_ctx_t ct
 
   rv = 0;
  cleanup:
-  fiid_obj_destroy (obj_cmd_rq);
+  api_fiid_obj_put (ctx, obj_cmd_rq);
   return (rv);
 }
 
@@ -837,7 +837,7 @@ ipmi_cmd_set_system_boot_options_boot_info_acknowledge (ipmi_ctx_t ctx,
       return (-1);
     }
 
-  if (!(obj_cmd_rq = fiid_obj_create (tmpl_cmd_set_system_boot_options_boot_info_acknowledge_rq)))
+  if (!(obj_cmd_rq = api_fiid_obj_get (ctx, tmpl_cmd_set_system_boot_options_boot_info_acknowledge_rq)))
     {
       API_ERRNO_TO_API_ERRNUM (ctx, errno);
       goto cleanup;
@@ -867,7 +867,7 @@ ipmi_cmd_set_system_boot_options_boot_info_acknowledge (ipmi_ctx_t ctx,
 
   rv = 0;
  cleanup:
-  fiid_obj_destroy (obj_cmd_rq);
+  api_fiid_obj_put (ctx, obj_cmd_rq);
   return (rv);
 }
 
@@ -916,7 +916,7 @@ ipmi_cmd_set_system_boot_options_boot_flags (ipmi_ctx_t ctx,
       return (-1);
     }
 
-  if (!(obj_cmd_rq = fiid_obj_create (tmpl_cmd_set_system_boot_options_boot_flags_rq)))
+  if (!(obj_cmd_rq = api_fiid_obj_get (ctx, tmpl_cmd_set_system_boot_options_boot_flags_rq)))
     {
       API_ERRNO_TO_API_ERRNUM (ctx, errno);
       goto cleanup;
@@ -958,7 +958,7 @@ ipmi_cmd_set_system_boot_options_boot_flags (ipmi_ctx_t ctx,
 
   rv = 0;
  cleanup:
-  fiid_obj_destroy (obj_cmd_rq);
+  api_fiid_obj_put (ctx, obj_cmd_rq);
   return (rv);
 }
 
@@ -993,7 +993,7 @@ ipmi_cmd_set_system_boot_options_boot_initiator_info (ipmi_ctx_t ctx,
       return (-1);
     }
 
-  if (!(obj_cmd_rq = fiid_obj_create (tmpl_cmd_set_system_boot_options_boot_initiator_info_rq)))
+  if (!(obj_cmd_rq = api_fiid_obj_get (ctx, tmpl_cmd_set_system_boot_options_boot_initiator_info_rq)))
     {
       API_ERRNO_TO_API_ERRNUM (ctx, errno);
       goto cleanup;
@@ -1021,7 +1021,7 @@ ipmi_cmd_set_system_boot_options_boot_initiator_info (ipmi_ctx_t ctx,
 
   rv = 0;
  cleanup:
-  fiid_obj_destroy (obj_cmd_rq);
+  api_fiid_obj_put (ctx, obj_cmd_rq);
   return (rv);
 }
 
@@ -1056,7 +1056,7 @@ ipmi_cmd_set_system_boot_options_boot_initiator_mailbox (ipmi_ctx_t ctx,
       return (-1);
     }
 
-  if (!(obj_cmd_rq = fiid_obj_create (tmpl_cmd_set_system_boot_options_boot_initiator_mailbox_rq)))
+  if (!(obj_cmd_rq = api_fiid_obj_get (ctx, tmpl_cmd_set_system_boot_options_boot_initiator_mailbox_rq)))
     {
       API_ERRNO_TO_API_ERRNUM (ctx, errno);
       goto cleanup;
@@ -1084,7 +1084,7 @@ ipmi_cmd_set_system_boot_options_boot_initiator_mailbox (ipmi_ctx_t ctx,
 
   rv = 0;
  cleanup:
-  fiid_obj_destroy (obj_cmd_rq);
+  api_fiid_obj_put (ctx, obj_cmd_rq);
   return (rv);
 }
 
@@ -1119,7 +1119,7 @@ _ipmi_cmd_get_system_boot_options_common (ipmi_ctx_t ctx,
       return (-1);
     }
 
-  if (!(obj_cmd_rq = fiid_obj_create (tmpl_cmd_get_system_boot_options_rq)))
+  if (!(obj_cmd_rq = api_fiid_obj_get (ctx, tmpl_cmd_get_system_boot_options_rq)))
     {
       API_ERRNO_TO_API_ERRNUM (ctx, errno);
       goto cleanup;
@@ -1146,7 +1146,7 @@ _ipmi_cmd_get_system_boot_options_common (ipmi_ctx_t ctx,
 
   rv = 0;
  cleanup:
-  fiid_obj_destroy (obj_cmd_rq);
+  api_fiid_obj_put (ctx, obj_cmd_rq);
   return (rv);
 }
 
@@ -1357,7 +1357,7 @@ ipmi_cmd_get_power_on_hours_counter (ipmi_ctx_t ctx,
       return (-1);
     }
 
-  if (!(obj_cmd_rq = fiid_obj_create (tmpl_cmd_get_power_on_hours_counter_rq)))
+  if (!(obj_cmd_rq = api_fiid_obj_get (ctx, tmpl_cmd_get_power_on_hours_counter_rq)))
     {
       API_ERRNO_TO_API_ERRNUM (ctx, errno);
       goto cleanup;
@@ -1381,6 +1381,6 @@ ipmi_cmd_get_power_on_hours_counter (ipmi_ctx_t ctx,
 
   rv = 0;
  cleanup:
-  fiid_obj_destroy (obj_cmd_rq);
+  api_fiid_obj_put (ctx, obj_cmd_rq);
   return (rv);
 }
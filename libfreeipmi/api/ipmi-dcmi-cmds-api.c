@@ -94,7 +94,7 @@ _ipmi_cmd_dcmi_get_dcmi_capability_info_common (ipmi_ctx_t ctx,
       return (-1);
     }
 
-  if (!(obj_cmd_rq = fiid_obj_create (tmpl_cmd_dcmi_get_dcmi_capability_info_rq)))
+  if (!(obj_cmd_rq = api_fiid_obj_get (ctx, tmpl_cmd_dcmi_get_dcmi_capability_info_rq)))
     {
       API_ERRNO_TO_API_ERRNUM (ctx, errno);
       goto cleanup;
@@ -118,7 +118,7 @@ _ipmi_cmd_dcmi_get_dcmi_capability_info_common (ipmi_ctx_t ctx,
 
   rv = 0;
  cleanup:
-  fiid_obj_destroy (obj_cmd_rq);
+  api_fiid_obj_put (ctx, obj_cmd_rq);
   return (rv);
 }
 
@@ -250,7 +250,7 @@ ipmi_cmd_dcmi_set_dcmi_configuration_parameters (ipmi_ctx_t ctx,
       return (-1);
     }
 
-  if (!(obj_cmd_rq = fiid_obj_create (tmpl_cmd_dcmi_set_dcmi_configuration_parameters_rq)))
+  if (!(obj_cmd_rq = api_fiid_obj_get (ctx, tmpl_cmd_dcmi_set_dcmi_configuration_parameters_rq)))
     {
       API_ERRNO_TO_API_ERRNUM (ctx, errno);
       goto cleanup;
@@ -278,7 +278,7 @@ ipmi_cmd_dcmi_set_dcmi_configuration_parameters (ipmi_ctx_t ctx,
 
   rv = 0;
  cleanup:
-  fiid_obj_destroy (obj_cmd_rq);
+  api_fiid_obj_put (ctx, obj_cmd_rq);
   return (rv);
 }
 
@@ -311,7 +311,7 @@ ipmi_cmd_dcmi_set_dcmi_configuration_parameters_activate_dhcp (ipmi_ctx_t ctx,
       return (-1);
     }
 
-  if (!(obj_cmd_rq = fiid_obj_create (tmpl_cmd_dcmi_set_dcmi_configuration_parameters_activate_dhcp_rq)))
+  if (!(obj_cmd_rq = api_fiid_obj_get (ctx, tmpl_cmd_dcmi_set_dcmi_configuration_parameters_activate_dhcp_rq)))
     {
       API_ERRNO_TO_API_ERRNUM (ctx, errno);
       goto cleanup;
@@ -337,7 +337,7 @@ ipmi_cmd_dcmi_set_dcmi_configuration_parameters_activate_dhcp (ipmi_ctx_t ctx,
 
   rv = 0;
  cleanup:
-  fiid_obj_destroy (obj_cmd_rq);
+  api_fiid_obj_put (ctx, obj_cmd_rq);
   return (rv);
 }
 
@@ -372,7 +372,7 @@ ipmi_cmd_dcmi_set_dcmi_configuration_parameters_discovery_configuration (ipmi_ct
       return (-1);
     }
 
-  if (!(obj_cmd_rq = fiid_obj_create (tmpl_cmd_dcmi_set_dcmi_configuration_parameters_discovery_configuration_rq)))
+  if (!(obj_cmd_rq = api_fiid_obj_get (ctx, tmpl_cmd_dcmi_set_dcmi_configuration_parameters_discovery_configuration_rq)))
     {
       API_ERRNO_TO_API_ERRNUM (ctx, errno);
       goto cleanup;
@@ -400,7 +400,7 @@ ipmi_cmd_dcmi_set_dcmi_configuration_parameters_discovery_configuration (ipmi_ct
 
   rv = 0;
  cleanup:
-  fiid_obj_destroy (obj_cmd_rq);
+  api_fiid_obj_put (ctx, obj_cmd_rq);
   return (rv);
 }
 
@@ -433,7 +433,7 @@ ipmi_cmd_dcmi_set_dcmi_configuration_parameters_dhcp_timing_1 (ipmi_ctx_t ctx,
       return (-1);
     }
 
-  if (!(obj_cmd_rq = fiid_obj_create (tmpl_cmd_dcmi_set_dcmi_configuration_parameters_dhcp_timing_1_rq)))
+  if (!(obj_cmd_rq = api_fiid_obj_get (ctx, tmpl_cmd_dcmi_set_dcmi_configuration_parameters_dhcp_timing_1_rq)))
     {
       API_ERRNO_TO_API_ERRNUM (ctx, errno);
       goto cleanup;
@@ -459,7 +459,7 @@ ipmi_cmd_dcmi_set_dcmi_configuration_parameters_dhcp_timing_1 (ipmi_ctx_t ctx,
 
   rv = 0;
  cleanup:
-  fiid_obj_destroy (obj_cmd_rq);
+  api_fiid_obj_put (ctx, obj_cmd_rq);
   return (rv);
 }
 
@@ -492,7 +492,7 @@ ipmi_cmd_dcmi_set_dcmi_configuration_parameters_dhcp_timing_2 (ipmi_ctx_t ctx,
       return (-1);
     }
 
-  if (!(obj_cmd_rq = fiid_obj_create (tmpl_cmd_dcmi_set_dcmi_configuration_parameters_dhcp_timing_2_rq)))
+  if (!(obj_cmd_rq = api_fiid_obj_get (ctx, tmpl_cmd_dcmi_set_dcmi_configuration_parameters_dhcp_timing_2_rq)))
     {
       API_ERRNO_TO_API_ERRNUM (ctx, errno);
       goto cleanup;
@@ -518,7 +518,7 @@ ipmi_cmd_dcmi_set_dcmi_configuration_parameters_dhcp_timing_2 (ipmi_ctx_t ctx,
 
   rv = 0;
  cleanup:
-  fiid_obj_destroy (obj_cmd_rq);
+  api_fiid_obj_put (ctx, obj_cmd_rq);
   return (rv);
 }
 
@@ -551,7 +551,7 @@ ipmi_cmd_dcmi_set_dcmi_configuration_parameters_dhcp_timing_3 (ipmi_ctx_t ctx,
       return (-1);
     }
 
-  if (!(obj_cmd_rq = fiid_obj_create (tmpl_cmd_dcmi_set_dcmi_configuration_parameters_dhcp_timing_3_rq)))
+  if (!(obj_cmd_rq = api_fiid_obj_get (ctx, tmpl_cmd_dcmi_set_dcmi_configuration_parameters_dhcp_timing_3_rq)))
     {
       API_ERRNO_TO_API_ERRNUM (ctx, errno);
       goto cleanup;
@@ -577,7 +577,7 @@ ipmi_cmd_dcmi_set_dcmi_configuration_parameters_dhcp_timing_3 (ipmi_ctx_t ctx,
 
   rv = 0;
  cleanup:
-  fiid_obj_destroy (obj_cmd_rq);
+  api_fiid_obj_put (ctx, obj_cmd_rq);
   return (rv);
 }
 
@@ -610,7 +610,7 @@ ipmi_cmd_dcmi_get_dcmi_configuration_parameters (ipmi_ctx_t ctx,
       return (-1);
     }
 
-  if (!(obj_cmd_rq = fiid_obj_create (tmpl_cmd_dcmi_get_dcmi_configuration_parameters_rq)))
+  if (!(obj_cmd_rq = api_fiid_obj_get (ctx, tmpl_cmd_dcmi_get_dcmi_configuration_parameters_rq)))
     {
       API_ERRNO_TO_API_ERRNUM (ctx, errno);
       goto cleanup;
@@ -636,7 +636,7 @@ ipmi_cmd_dcmi_get_dcmi_configuration_parameters (ipmi_ctx_t ctx,
 
   rv = 0;
  cleanup:
-  fiid_obj_destroy (obj_cmd_rq);
+  api_fiid_obj_put (ctx, obj_cmd_rq);
   return (rv);
 }
 
@@ -667,7 +667,7 @@ ipmi_cmd_dcmi_get_dcmi_configuration_parameters_discovery_configuration (ipmi_ct
       return (-1);
     }
 
-  if (!(obj_cmd_rq = fiid_obj_create (tmpl_cmd_dcmi_get_dcmi_configuration_parameters_rq)))
+  if (!(obj_cmd_rq = api_fiid_obj_get (ctx, tmpl_cmd_dcmi_get_dcmi_configuration_parameters_rq)))
     {
       API_ERRNO_TO_API_ERRNUM (ctx, errno);
       goto cleanup;
@@ -693,7 +693,7 @@ ipmi_cmd_dcmi_get_dcmi_configuration_parameters_discovery_configuration (ipmi_ct
 
   rv = 0;
  cleanup:
-  fiid_obj_destroy (obj_cmd_rq);
+  api_fiid_obj_put (ctx, obj_cmd_rq);
   return (rv);
 }
 
@@ -724,7 +724,7 @@ ipmi_cmd_dcmi_get_dcmi_configuration_parameters_dhcp_timing_1 (ipmi_ctx_t ctx,
       return (-1);
     }
 
-  if (!(obj_cmd_rq = fiid_obj_create (tmpl_cmd_dcmi_get_dcmi_configuration_parameters_rq)))
+  if (!(obj_cmd_rq = api_fiid_obj_get (ctx, tmpl_cmd_dcmi_get_dcmi_configuration_parameters_rq)))
     {
       API_ERRNO_TO_API_ERRNUM (ctx, errno);
       goto cleanup;
@@ -750,7 +750,7 @@ ipmi_cmd_dcmi_get_dcmi_configuration_parameters_dhcp_timing_1 (ipmi_ctx_t ctx,
 
   rv = 0;
  cleanup:
-  fiid_obj_destroy (obj_cmd_rq);
+  api_fiid_obj_put (ctx, obj_cmd_rq);
   return (rv);
 }
 
@@ -781,7 +781,7 @@ ipmi_cmd_dcmi_get_dcmi_configuration_parameters_dhcp_timing_2 (ipmi_ctx_t ctx,
       return (-1);
     }
 
-  if (!(obj_cmd_rq = fiid_obj_create (tmpl_cmd_dcmi_get_dcmi_configuration_parameters_rq)))
+  if (!(obj_cmd_rq = api_fiid_obj_get (ctx, tmpl_cmd_dcmi_get_dcmi_configuration_parameters_rq)))
     {
       API_ERRNO_TO_API_ERRNUM (ctx, errno);
       goto cleanup;
@@ -807,7 +807,7 @@ ipmi_cmd_dcmi_get_dcmi_configuration_parameters_dhcp_timing_2 (ipmi_ctx_t ctx,
 
   rv = 0;
  cleanup:
-  fiid_obj_destroy (obj_cmd_rq);
+  api_fiid_obj_put (ctx, obj_cmd_rq);
   return (rv);
 }
 
@@ -838,7 +838,7 @@ ipmi_cmd_dcmi_get_dcmi_configuration_parameters_dhcp_timing_3 (ipmi_ctx_t ctx,
       return (-1);
     }
 
-  if (!(obj_cmd_rq = fiid_obj_create (tmpl_cmd_dcmi_get_dcmi_configuration_parameters_rq)))
+  if (!(obj_cmd_rq = api_fiid_obj_get (ctx, tmpl_cmd_dcmi_get_dcmi_configuration_parameters_rq)))
     {
       API_ERRNO_TO_API_ERRNUM (ctx, errno);
       goto cleanup;
@@ -864,7 +864,7 @@ ipmi_cmd_dcmi_get_dcmi_configuration_parameters_dhcp_timing_3 (ipmi_ctx_t ctx,
 
   rv = 0;
  cleanup:
-  fiid_obj_destroy (obj_cmd_rq);
+  api_fiid_obj_put (ctx, obj_cmd_rq);
   return (rv);
 }
 
@@ -897,7 +897,7 @@ ipmi_cmd_dcmi_get_asset_tag (ipmi_ctx_t ctx,
       return (-1);
     }
 
-  if (!(obj_cmd_rq = fiid_obj_create (tmpl_cmd_dcmi_get_asset_tag_rq)))
+  if (!(obj_cmd_rq = api_fiid_obj_get (ctx, tmpl_cmd_dcmi_get_asset_tag_rq)))
     {
       API_ERRNO_TO_API_ERRNUM (ctx, errno);
       goto cleanup;
@@ -923,7 +923,7 @@ ipmi_cmd_dcmi_get_asset_tag (ipmi_ctx_t ctx,
 
   rv = 0;
  cleanup:
-  fiid_obj_destroy (obj_cmd_rq);
+  api_fiid_obj_put (ctx, obj_cmd_rq);
   return (rv);
 }
 
@@ -958,7 +958,7 @@ ipmi_cmd_dcmi_set_asset_tag (ipmi_ctx_t ctx,
       return (-1);
     }
 
-  if (!(obj_cmd_rq = fiid_obj_create (tmpl_cmd_dcmi_set_asset_tag_rq)))
+  if (!(obj_cmd_rq = api_fiid_obj_get (ctx, tmpl_cmd_dcmi_set_asset_tag_rq)))
     {
       API_ERRNO_TO_API_ERRNUM (ctx, errno);
       goto cleanup;
@@ -986,7 +986,7 @@ ipmi_cmd_dcmi_set_asset_tag (ipmi_ctx_t ctx,
 
   rv = 0;
  cleanup:
-  fiid_obj_destroy (obj_cmd_rq);
+  api_fiid_obj_put (ctx, obj_cmd_rq);
   return (rv);
 }
 
@@ -1019,7 +1019,7 @@ ipmi_cmd_dcmi_get_management_controller_identifier_string (ipmi_ctx_t ctx,
       return (-1);
     }
 
-  if (!(obj_cmd_rq = fiid_obj_create (tmpl_cmd_dcmi_get_management_controller_identifier_string_rq)))
+  if (!(obj_cmd_rq = api_fiid_obj_get (ctx, tmpl_cmd_dcmi_get_management_controller_identifier_string_rq)))
     {
       API_ERRNO_TO_API_ERRNUM (ctx, errno);
       goto cleanup;
@@ -1045,7 +1045,7 @@ ipmi_cmd_dcmi_get_management_controller_identifier_string (ipmi_ctx_t ctx,
 
   rv = 0;
  cleanup:
-  fiid_obj_destroy (obj_cmd_rq);
+  api_fiid_obj_put (ctx, obj_cmd_rq);
   return (rv);
 }
 
@@ -1080,7 +1080,7 @@ ipmi_cmd_dcmi_set_management_controller_identifier_string (ipmi_ctx_t ctx,
       return (-1);
     }
 
-  if (!(obj_cmd_rq = fiid_obj_create (tmpl_cmd_dcmi_set_management_controller_identifier_string_rq)))
+  if (!(obj_cmd_rq = api_fiid_obj_get (ctx, tmpl_cmd_dcmi_set_management_controller_identifier_string_rq)))
     {
       API_ERRNO_TO_API_ERRNUM (ctx, errno);
       goto cleanup;
@@ -1108,7 +1108,7 @@ ipmi_cmd_dcmi_set_management_controller_identifier_string (ipmi_ctx_t ctx,
 
   rv = 0;
  cleanup:
-  fiid_obj_destroy (obj_cmd_rq);
+  api_fiid_obj_put (ctx, obj_cmd_rq);
   return (rv);
 }
 
@@ -1143,7 +1143,7 @@ ipmi_cmd_dcmi_get_dcmi_sensor_info (ipmi_ctx_t ctx,
       return (-1);
     }
 
-  if (!(obj_cmd_rq = fiid_obj_create (tmpl_cmd_dcmi_get_dcmi_sensor_info_rq)))
+  if (!(obj_cmd_rq = api_fiid_obj_get (ctx, tmpl_cmd_dcmi_get_dcmi_sensor_info_rq)))
     {
       API_ERRNO_TO_API_ERRNUM (ctx, errno);
       goto cleanup;
@@ -1171,7 +1171,7 @@ ipmi_cmd_dcmi_get_dcmi_sensor_info (ipmi_ctx_t ctx,
 
   rv = 0;
  cleanup:
-  fiid_obj_destroy (obj_cmd_rq);
+  api_fiid_obj_put (ctx, obj_cmd_rq);
   return (rv);
 }
 
@@ -1204,7 +1204,7 @@ ipmi_cmd_dcmi_get_power_reading (ipmi_ctx_t ctx,
       return (-1);
     }
 
-  if (!(obj_cmd_rq = fiid_obj_create (tmpl_cmd_dcmi_get_power_reading_rq)))
+  if (!(obj_cmd_rq = api_fiid_obj_get (ctx, tmpl_cmd_dcmi_get_power_reading_rq)))
     {
       API_ERRNO_TO_API_ERRNUM (ctx, errno);
       goto cleanup;
@@ -1230,7 +1230,7 @@ ipmi_cmd_dcmi_get_power_reading (ipmi_ctx_t ctx,
 
   rv = 0;
  cleanup:
-  fiid_obj_destroy (obj_cmd_rq);
+  api_fiid_obj_put (ctx, obj_cmd_rq);
   return (rv);
 }
 
@@ -1260,7 +1260,7 @@ ipmi_cmd_dcmi_get_power_limit (ipmi_ctx_t ctx,
       return (-1);
     }
 
-  if (!(obj_cmd_rq = fiid_obj_create (tmpl_cmd_dcmi_get_power_limit_rq)))
+  if (!(obj_cmd_rq = api_fiid_obj_get (ctx, tmpl_cmd_dcmi_get_power_limit_rq)))
     {
       API_ERRNO_TO_API_ERRNUM (ctx, errno);
       goto cleanup;
@@ -1284,7 +1284,7 @@ ipmi_cmd_dcmi_get_power_limit (ipmi_ctx_t ctx,
 
   rv = 0;
  cleanup:
-  fiid_obj_destroy (obj_cmd_rq);
+  api_fiid_obj_put (ctx, obj_cmd_rq);
   return (rv);
 }
 
@@ -1319,7 +1319,7 @@ ipmi_cmd_dcmi_set_power_limit (ipmi_ctx_t ctx,
       return (-1);
     }
 
-  if (!(obj_cmd_rq = fiid_obj_create (tmpl_cmd_dcmi_set_power_limit_rq)))
+  if (!(obj_cmd_rq = api_fiid_obj_get (ctx, tmpl_cmd_dcmi_set_power_limit_rq)))
     {
       API_ERRNO_TO_API_ERRNUM (ctx, errno);
       goto cleanup;
@@ -1347,7 +1347,7 @@ ipmi_cmd_dcmi_set_power_limit (ipmi_ctx_t ctx,
 
   rv = 0;
  cleanup:
-  fiid_obj_destroy (obj_cmd_rq);
+  api_fiid_obj_put (ctx, obj_cmd_rq);
   return (rv);
 }
 
@@ -1379,7 +1379,7 @@ ipmi_cmd_dcmi_activate_deactivate_power_limit (ipmi_ctx_t ctx,
       return (-1);
     }
 
-  if (!(obj_cmd_rq = fiid_obj_create (tmpl_cmd_dcmi_activate_deactivate_power_limit_rq)))
+  if (!(obj_cmd_rq = api_fiid_obj_get (ctx, tmpl_cmd_dcmi_activate_deactivate_power_limit_rq)))
     {
       API_ERRNO_TO_API_ERRNUM (ctx, errno);
       goto cleanup;
@@ -1404,7 +1404,7 @@ ipmi_cmd_dcmi_activate_deactivate_power_limit (ipmi_ctx_t ctx,
 
   rv = 0;
  cleanup:
-  fiid_obj_destroy (obj_cmd_rq);
+  api_fiid_obj_put (ctx, obj_cmd_rq);
   return (rv);
 }
 
@@ -1437,7 +1437,7 @@ ipmi_cmd_dcmi_get_thermal_limit (ipmi_ctx_t ctx,
       return (-1);
     }
 
-  if (!(obj_cmd_rq = fiid_obj_create (tmpl_cmd_dcmi_get_thermal_limit_rq)))
+  if (!(obj_cmd_rq = api_fiid_obj_get (ctx, tmpl_cmd_dcmi_get_thermal_limit_rq)))
     {
       API_ERRNO_TO_API_ERRNUM (ctx, errno);
       goto cleanup;
@@ -1463,7 +1463,7 @@ ipmi_cmd_dcmi_get_thermal_limit (ipmi_ctx_t ctx,
 
   rv = 0;
  cleanup:
-  fiid_obj_destroy (obj_cmd_rq);
+  api_fiid_obj_put (ctx, obj_cmd_rq);
   return (rv);
 }
 
@@ -1500,7 +1500,7 @@ ipmi_cmd_dcmi_set_thermal_limit (ipmi_ctx_t ctx,
       return (-1);
     }
 
-  if (!(obj_cmd_rq = fiid_obj_create (tmpl_cmd_dcmi_set_thermal_limit_rq)))
+  if (!(obj_cmd_rq = api_fiid_obj_get (ctx, tmpl_cmd_dcmi_set_thermal_limit_rq)))
     {
       API_ERRNO_TO_API_ERRNUM (ctx, errno);
       goto cleanup;
@@ -1530,7 +1530,7 @@ ipmi_cmd_dcmi_set_thermal_limit (ipmi_ctx_t ctx,
 
   rv = 0;
  cleanup:
-  fiid_obj_destroy (obj_cmd_rq);
+  api_fiid_obj_put (ctx, obj_cmd_rq);
   return (rv);
 }
 
@@ -1565,7 +1565,7 @@ ipmi_cmd_dcmi_get_temperature_reading (ipmi_ctx_t ctx,
       return (-1);
     }
 
-  if (!(obj_cmd_rq = fiid_obj_create (tmpl_cmd_dcmi_get_temperature_reading_rq)))
+  if (!(obj_cmd_rq = api_fiid_obj_get (ctx, tmpl_cmd_dcmi_get_temperature_reading_rq)))
     {
       API_ERRNO_TO_API_ERRNUM (ctx, errno);
       goto cleanup;
@@ -1593,6 +1593,6 @@ ipmi_cmd_dcmi_get_temperature_reading (ipmi_ctx_t ctx,
 
   rv = 0;
  cleanup:
-  fiid_obj_destroy (obj_cmd_rq);
+  api_fiid_obj_put (ctx, obj_cmd_rq);
   return (rv);
 }
@@ -66,7 +66,7 @@ ipmi_cmd_get_device_id (ipmi_ctx_t ctx, fiid_obj_t obj_cmd_rs)
       return (-1);
     }
 
-  if (!(obj_cmd_rq = fiid_obj_create (tmpl_cmd_get_device_id_rq)))
+  if (!(obj_cmd_rq = api_fiid_obj_get (ctx, tmpl_cmd_get_device_id_rq)))
     {
       API_ERRNO_TO_API_ERRNUM (ctx, errno);
       goto cleanup;
@@ -90,7 +90,7 @@ ipmi_cmd_get_device_id (ipmi_ctx_t ctx, fiid_obj_t obj_cmd_rs)
 
   rv = 0;
  cleanup:
-  fiid_obj_destroy (obj_cmd_rq);
+  api_fiid_obj_put (ctx, obj_cmd_rq);
   return (rv);
 }
 
@@ -119,7 +119,7 @@ ipmi_cmd_cold_reset (ipmi_ctx_t ctx, fiid_obj_t obj_cmd_rs)
       return (-1);
     }
 
-  if (!(obj_cmd_rq = fiid_obj_create (tmpl_cmd_cold_reset_rq)))
+  if (!(obj_cmd_rq = api_fiid_obj_get (ctx, tmpl_cmd_cold_reset_rq)))
     {
       API_ERRNO_TO_API_ERRNUM (ctx, errno);
       goto cleanup;
@@ -143,7 +143,7 @@ ipmi_cmd_cold_reset (ipmi_ctx_t ctx, fiid_obj_t obj_cmd_rs)
 
   rv = 0;
  cleanup:
-  fiid_obj_destroy (obj_cmd_rq);
+  api_fiid_obj_put (ctx, obj_cmd_rq);
   return (rv);
 }
 
@@ -172,7 +172,7 @@ ipmi_cmd_warm_reset (ipmi_ctx_t ctx, fiid_obj_t obj_cmd_rs)
       return (-1);
     }
 
-  if (!(obj_cmd_rq = fiid_obj_create (tmpl_cmd_warm_reset_rq)))
+  if (!(obj_cmd_rq = api_fiid_obj_get (ctx, tmpl_cmd_warm_reset_rq)))
     {
       API_ERRNO_TO_API_ERRNUM (ctx, errno);
       goto cleanup;
@@ -196,7 +196,7 @@ ipmi_cmd_warm_reset (ipmi_ctx_t ctx, fiid_obj_t obj_cmd_rs)
 
   rv = 0;
  cleanup:
-  fiid_obj_destroy (obj_cmd_rq);
+  api_fiid_obj_put (ctx, obj_cmd_rq);
   return (rv);
 }
 
@@ -231,7 +231,7 @@ ipmi_cmd_set_acpi_power_state (ipmi_ctx_t ctx,
       return (-1);
     }
 
-  if (!(obj_cmd_rq = fiid_obj_create (tmpl_cmd_set_acpi_power_state_rq)))
+  if (!(obj_cmd_rq = api_fiid_obj_get (ctx, tmpl_cmd_set_acpi_power_state_rq)))
     {
       API_ERRNO_TO_API_ERRNUM (ctx, errno);
       goto cleanup;
@@ -259,7 +259,7 @@ ipmi_cmd_set_acpi_power_state (ipmi_ctx_t ctx,
 
   rv = 0;
  cleanup:
-  fiid_obj_destroy (obj_cmd_rq);
+  api_fiid_obj_put (ctx, obj_cmd_rq);
   return (rv);
 }
 
@@ -288,7 +288,7 @@ ipmi_cmd_get_acpi_power_state (ipmi_ctx_t ctx, fiid_obj_t obj_cmd_rs)
       return (-1);
     }
 
-  if (!(obj_cmd_rq = fiid_obj_create (tmpl_cmd_get_acpi_power_state_rq)))
+  if (!(obj_cmd_rq = api_fiid_obj_get (ctx, tmpl_cmd_get_acpi_power_state_rq)))
     {
       API_ERRNO_TO_API_ERRNUM (ctx, errno);
       goto cleanup;
@@ -312,7 +312,7 @@ ipmi_cmd_get_acpi_power_state (ipmi_ctx_t ctx, fiid_obj_t obj_cmd_rs)
 
   rv = 0;
  cleanup:
-  fiid_obj_destroy (obj_cmd_rq);
+  api_fiid_obj_put (ctx, obj_cmd_rq);
   return (rv);
 }
 
@@ -341,7 +341,7 @@ ipmi_cmd_get_self_test_results (ipmi_ctx_t ctx, fiid_obj_t obj_cmd_rs)
       return (-1);
     }
 
-  if (!(obj_cmd_rq = fiid_obj_create (tmpl_cmd_get_self_test_results_rq)))
+  if (!(obj_cmd_rq = api_fiid_obj_get (ctx, tmpl_cmd_get_self_test_results_rq)))
     {
       API_ERRNO_TO_API_ERRNUM (ctx, errno);
       goto cleanup;
@@ -365,7 +365,7 @@ ipmi_cmd_get_self_test_results (ipmi_ctx_t ctx, fiid_obj_t obj_cmd_rs)
 
   rv = 0;
  cleanup:
-  fiid_obj_destroy (obj_cmd_rq);
+  api_fiid_obj_put (ctx, obj_cmd_rq);
   return (rv);
 }
 
@@ -396,7 +396,7 @@ ipmi_cmd_get_device_guid (ipmi_ctx_t ctx, fiid_obj_t obj_cmd_rs)
       return (-1);
     }
 
-  if (!(obj_cmd_rq = fiid_obj_create (tmpl_cmd_get_device_guid_rq)))
+  if (!(obj_cmd_rq = api_fiid_obj_get (ctx, tmpl_cmd_get_device_guid_rq)))
     {
       API_ERRNO_TO_API_ERRNUM (ctx, errno);
       goto cleanup;
@@ -420,7 +420,7 @@ ipmi_cmd_get_device_guid (ipmi_ctx_t ctx, fiid_obj_t obj_cmd_rs)
 
   rv = 0;
  cleanup:
-  fiid_obj_destroy (obj_cmd_rq);
+  api_fiid_obj_put (ctx, obj_cmd_rq);
   return (rv);
 }
 
@@ -70,7 +70,7 @@ ipmi_cmd_set_event_receiver (ipmi_ctx_t ctx,
       return (-1);
     }
 
-  if (!(obj_cmd_rq = fiid_obj_create (tmpl_cmd_set_event_receiver_rq)))
+  if (!(obj_cmd_rq = api_fiid_obj_get (ctx, tmpl_cmd_set_event_receiver_rq)))
     {
       API_ERRNO_TO_API_ERRNUM (ctx, errno);
       goto cleanup;
@@ -96,7 +96,7 @@ ipmi_cmd_set_event_receiver (ipmi_ctx_t ctx,
 
   rv = 0;
  cleanup:
-  fiid_obj_destroy (obj_cmd_rq);
+  api_fiid_obj_put (ctx, obj_cmd_rq);
   return (rv);
 }
 
@@ -130,7 +130,7 @@ ipmi_cmd_set_event_receiver_ipmb (ipmi_ctx_t ctx,
       return (-1);
     }
 
-  if (!(obj_cmd_rq = fiid_obj_create (tmpl_cmd_set_event_receiver_rq)))
+  if (!(obj_cmd_rq = api_fiid_obj_get (ctx, tmpl_cmd_set_event_receiver_rq)))
     {
       API_ERRNO_TO_API_ERRNUM (ctx, errno);
       goto cleanup;
@@ -158,7 +158,7 @@ ipmi_cmd_set_event_receiver_ipmb (ipmi_ctx_t ctx,
 
   rv = 0;
  cleanup:
-  fiid_obj_destroy (obj_cmd_rq);
+  api_fiid_obj_put (ctx, obj_cmd_rq);
   return (rv);
 }
 
@@ -187,7 +187,7 @@ ipmi_cmd_get_event_receiver (ipmi_ctx_t ctx, fiid_obj_t obj_cmd_rs)
       return (-1);
     }
 
-  if (!(obj_cmd_rq = fiid_obj_create (tmpl_cmd_get_event_receiver_rq)))
+  if (!(obj_cmd_rq = api_fiid_obj_get (ctx, tmpl_cmd_get_event_receiver_rq)))
     {
       API_ERRNO_TO_API_ERRNUM (ctx, errno);
       goto cleanup;
@@ -211,7 +211,7 @@ ipmi_cmd_get_event_receiver (ipmi_ctx_t ctx, fiid_obj_t obj_cmd_rs)
 
   rv = 0;
  cleanup:
-  fiid_obj_destroy (obj_cmd_rq);
+  api_fiid_obj_put (ctx, obj_cmd_rq);
   return (rv);
 }
 
@@ -251,7 +251,7 @@ ipmi_cmd_platform_event (ipmi_ctx_t ctx,
       return (-1);
     }
 
-  if (!(obj_cmd_rq = fiid_obj_create (tmpl_cmd_platform_event_rq)))
+  if (!(obj_cmd_rq = api_fiid_obj_get (ctx, tmpl_cmd_platform_event_rq)))
     {
       API_ERRNO_TO_API_ERRNUM (ctx, errno);
       goto cleanup;
@@ -284,6 +284,6 @@ ipmi_cmd_platform_event (ipmi_ctx_t ctx,
 
   rv = 0;
  cleanup:
-  fiid_obj_destroy (obj_cmd_rq);
+  api_fiid_obj_put (ctx, obj_cmd_rq);
   return (rv);
 }
@@ -69,7 +69,7 @@ ipmi_cmd_get_netfn_support (ipmi_ctx_t ctx,
       return (-1);
     }
 
-  if (!(obj_cmd_rq = fiid_obj_create (tmpl_cmd_get_netfn_support_rq)))
+  if (!(obj_cmd_rq = api_fiid_obj_get (ctx, tmpl_cmd_get_netfn_support_rq)))
     {
       API_ERRNO_TO_API_ERRNUM (ctx, errno);
       goto cleanup;
@@ -94,7 +94,7 @@ ipmi_cmd_get_netfn_support (ipmi_ctx_t ctx,
 
   rv = 0;
  cleanup:
-  fiid_obj_destroy (obj_cmd_rq);
+  api_fiid_obj_put (ctx, obj_cmd_rq);
   return (rv);
 }
 
@@ -130,7 +130,7 @@ ipmi_cmd_get_command_support (ipmi_ctx_t ctx,
       return (-1);
     }
 
-  if (!(obj_cmd_rq = fiid_obj_create (tmpl_cmd_get_command_support_rq)))
+  if (!(obj_cmd_rq = api_fiid_obj_get (ctx, tmpl_cmd_get_command_support_rq)))
     {
       API_ERRNO_TO_API_ERRNUM (ctx, errno);
       goto cleanup;
@@ -159,7 +159,7 @@ ipmi_cmd_get_command_support (ipmi_ctx_t ctx,
 
   rv = 0;
  cleanup:
-  fiid_obj_destroy (obj_cmd_rq);
+  api_fiid_obj_put (ctx, obj_cmd_rq);
   return (rv);
 }
 
@@ -197,7 +197,7 @@ ipmi_cmd_get_command_sub_function_support (ipmi_ctx_t ctx,
       return (-1);
     }
 
-  if (!(obj_cmd_rq = fiid_obj_create (tmpl_cmd_get_command_sub_function_support_rq)))
+  if (!(obj_cmd_rq = api_fiid_obj_get (ctx, tmpl_cmd_get_command_sub_function_support_rq)))
     {
       API_ERRNO_TO_API_ERRNUM (ctx, errno);
       goto cleanup;
@@ -226,7 +226,7 @@ ipmi_cmd_get_command_sub_function_support (ipmi_ctx_t ctx,
 
   rv = 0;
  cleanup:
-  fiid_obj_destroy (obj_cmd_rq);
+  api_fiid_obj_put (ctx, obj_cmd_rq);
   return (rv);
 }
 
@@ -262,7 +262,7 @@ ipmi_cmd_get_configurable_commands (ipmi_ctx_t ctx,
       return (-1);
     }
 
-  if (!(obj_cmd_rq = fiid_obj_create (tmpl_cmd_get_configurable_commands_rq)))
+  if (!(obj_cmd_rq = api_fiid_obj_get (ctx, tmpl_cmd_get_configurable_commands_rq)))
     {
       API_ERRNO_TO_API_ERRNUM (ctx, errno);
       goto cleanup;
@@ -291,7 +291,7 @@ ipmi_cmd_get_configurable_commands (ipmi_ctx_t ctx,
 
   rv = 0;
  cleanup:
-  fiid_obj_destroy (obj_cmd_rq);
+  api_fiid_obj_put (ctx, obj_cmd_rq);
   return (rv);
 }
 
@@ -327,7 +327,7 @@ ipmi_cmd_get_configurable_command_sub_functions (ipmi_ctx_t ctx,
       return (-1);
     }
 
-  if (!(obj_cmd_rq = fiid_obj_create (tmpl_cmd_get_configurable_command_sub_functions_rq)))
+  if (!(obj_cmd_rq = api_fiid_obj_get (ctx, tmpl_cmd_get_configurable_command_sub_functions_rq)))
     {
       API_ERRNO_TO_API_ERRNUM (ctx, errno);
       goto cleanup;
@@ -356,7 +356,7 @@ ipmi_cmd_get_configurable_command_sub_functions (ipmi_ctx_t ctx,
 
   rv = 0;
  cleanup:
-  fiid_obj_destroy (obj_cmd_rq);
+  api_fiid_obj_put (ctx, obj_cmd_rq);
   return (rv);
 }
 
@@ -394,7 +394,7 @@ ipmi_cmd_set_command_enables (ipmi_ctx_t ctx,
       return (-1);
     }
 
-  if (!(obj_cmd_rq = fiid_obj_create (tmpl_cmd_set_command_enables_rq)))
+  if (!(obj_cmd_rq = api_fiid_obj_get (ctx, tmpl_cmd_set_command_enables_rq)))
     {
       API_ERRNO_TO_API_ERRNUM (ctx, errno);
       goto cleanup;
@@ -425,7 +425,7 @@ ipmi_cmd_set_command_enables (ipmi_ctx_t ctx,
 
   rv = 0;
  cleanup:
-  fiid_obj_destroy (obj_cmd_rq);
+  api_fiid_obj_put (ctx, obj_cmd_rq);
   return (rv);
 }
 
@@ -461,7 +461,7 @@ ipmi_cmd_get_command_enables (ipmi_ctx_t ctx,
       return (-1);
     }
 
-  if (!(obj_cmd_rq = fiid_obj_create (tmpl_cmd_get_command_enables_rq)))
+  if (!(obj_cmd_rq = api_fiid_obj_get (ctx, tmpl_cmd_get_command_enables_rq)))
     {
       API_ERRNO_TO_API_ERRNUM (ctx, errno);
       goto cleanup;
@@ -490,7 +490,7 @@ ipmi_cmd_get_command_enables (ipmi_ctx_t ctx,
 
   rv = 0;
  cleanup:
-  fiid_obj_destroy (obj_cmd_rq);
+  api_fiid_obj_put (ctx, obj_cmd_rq);
   return (rv);
 }
 
@@ -527,7 +527,7 @@ ipmi_cmd_set_command_sub_function_enables (ipmi_ctx_t ctx,
       return (-1);
     }
 
-  if (!(obj_cmd_rq = fiid_obj_create (tmpl_cmd_set_command_sub_function_enables_rq)))
+  if (!(obj_cmd_rq = api_fiid_obj_get (ctx, tmpl_cmd_set_command_sub_function_enables_rq)))
     {
       API_ERRNO_TO_API_ERRNUM (ctx, errno);
       goto cleanup;
@@ -557,7 +557,7 @@ ipmi_cmd_set_command_sub_function_enables (ipmi_ctx_t ctx,
 
   rv = 0;
  cleanup:
-  fiid_obj_destroy (obj_cmd_rq);
+  api_fiid_obj_put (ctx, obj_cmd_rq);
   return (rv);
 }
 
@@ -595,7 +595,7 @@ ipmi_cmd_set_command_sub_function_enables_defining_body_code (ipmi_ctx_t ctx,
       return (-1);
     }
 
-  if (!(obj_cmd_rq = fiid_obj_create (tmpl_cmd_set_command_sub_function_enables_defining_body_code_rq)))
+  if (!(obj_cmd_rq = api_fiid_obj_get (ctx, tmpl_cmd_set_command_sub_function_enables_defining_body_code_rq)))
     {
       API_ERRNO_TO_API_ERRNUM (ctx, errno);
       goto cleanup;
@@ -626,7 +626,7 @@ ipmi_cmd_set_command_sub_function_enables_defining_body_code (ipmi_ctx_t ctx,
 
   rv = 0;
  cleanup:
-  fiid_obj_destroy (obj_cmd_rq);
+  api_fiid_obj_put (ctx, obj_cmd_rq);
   return (rv);
 }
 
@@ -664,7 +664,7 @@ ipmi_cmd_set_command_sub_function_enables_oem_iana (ipmi_ctx_t ctx,
       return (-1);
     }
 
-  if (!(obj_cmd_rq = fiid_obj_create (tmpl_cmd_set_command_sub_function_enables_oem_iana_rq)))
+  if (!(obj_cmd_rq = api_fiid_obj_get (ctx, tmpl_cmd_set_command_sub_function_enables_oem_iana_rq)))
     {
       API_ERRNO_TO_API_ERRNUM (ctx, errno);
       goto cleanup;
@@ -695,7 +695,7 @@ ipmi_cmd_set_command_sub_function_enables_oem_iana (ipmi_ctx_t ctx,
 
   rv = 0;
  cleanup:
-  fiid_obj_destroy (obj_cmd_rq);
+  api_fiid_obj_put (ctx, obj_cmd_rq);
   return (rv);
 }
 
@@ -731,7 +731,7 @@ ipmi_cmd_get_command_sub_function_enables (ipmi_ctx_t ctx,
       return (-1);
     }
 
-  if (!(obj_cmd_rq = fiid_obj_create (tmpl_cmd_get_command_sub_function_enables_rq)))
+  if (!(obj_cmd_rq = api_fiid_obj_get (ctx, tmpl_cmd_get_command_sub_function_enables_rq)))
     {
       API_ERRNO_TO_API_ERRNUM (ctx, errno);
       goto cleanup;
@@ -760,7 +760,7 @@ ipmi_cmd_get_command_sub_function_enables (ipmi_ctx_t ctx,
 
   rv = 0;
  cleanup:
-  fiid_obj_destroy (obj_cmd_rq);
+  api_fiid_obj_put (ctx, obj_cmd_rq);
   return (rv);
 }
 
@@ -794,7 +794,7 @@ ipmi_cmd_get_oem_netfn_iana_support (ipmi_ctx_t ctx,
       return (-1);
     }
 
-  if (!(obj_cmd_rq = fiid_obj_create (tmpl_cmd_get_oem_netfn_iana_support_rq)))
+  if (!(obj_cmd_rq = api_fiid_obj_get (ctx, tmpl_cmd_get_oem_netfn_iana_support_rq)))
     {
       API_ERRNO_TO_API_ERRNUM (ctx, errno);
       goto cleanup;
@@ -821,6 +821,6 @@ ipmi_cmd_get_oem_netfn_iana_support (ipmi_ctx_t ctx,
 
   rv = 0;
  cleanup:
-  fiid_obj_destroy (obj_cmd_rq);
+  api_fiid_obj_put (ctx, obj_cmd_rq);
   return (rv);
 }
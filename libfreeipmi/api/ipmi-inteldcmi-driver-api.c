@@ -35,6 +35,7 @@
 #include "ipmi-api-trace.h"
 #include "ipmi-api-util.h"
 #include "ipmi-inteldcmi-driver-api.h"
+#include "ipmi-pkt-trace.h"
 
 #include "libcommon/ipmi-fiid-util.h"
 
@@ -59,6 +60,8 @@ api_inteldcmi_cmd (ipmi_ctx_t ctx,
           && fiid_obj_packet_valid (obj_cmd_rq) == 1
           && fiid_obj_valid (obj_cmd_rs));
 
+  api_pkt_trace_obj (ctx, API_PKT_TRACE_REQUEST, obj_cmd_rq);
+
   if (ipmi_inteldcmi_cmd (ctx->io.inband.inteldcmi_ctx,
                           ctx->target.lun,
                           ctx->target.net_fn,
@@ -69,6 +72,8 @@ api_inteldcmi_cmd (ipmi_ctx_t ctx,
       return (-1);
     }
 
+  api_pkt_trace_obj (ctx, API_PKT_TRACE_RESPONSE, obj_cmd_rs);
+
   return (0);
 }
 
@@ -84,6 +89,8 @@ api_inteldcmi_cmd_ipmb (ipmi_ctx_t ctx,
           && fiid_obj_packet_valid (obj_cmd_rq) == 1
           && fiid_obj_valid (obj_cmd_rs));
 
+  api_pkt_trace_obj (ctx, API_PKT_TRACE_REQUEST, obj_cmd_rq);
+
   if (ipmi_inteldcmi_cmd_ipmb (ctx->io.inband.inteldcmi_ctx,
                                ctx->target.channel_number,
                                ctx->target.rs_addr,
@@ -96,6 +103,8 @@ api_inteldcmi_cmd_ipmb (ipmi_ctx_t ctx,
       return (-1);
     }
 
+  api_pkt_trace_obj (ctx, API_PKT_TRACE_RESPONSE, obj_cmd_rs);
+
   return (0);
 }
 
@@ -118,25 +127,20 @@ api_inteldcmi_cmd_raw (ipmi_ctx_t ctx,
           && buf_rs
           && buf_rs_len);
 
-  if (!(obj_cmd_rq = fiid_obj_create (tmpl_inteldcmi_raw)))
+  if (!(obj_cmd_rq = fiid_obj_view_create_in (ctx->arena,
+                                              tmpl_inteldcmi_raw,
+                                              buf_rq,
+                                              buf_rq_len)))
     {
       API_ERRNO_TO_API_ERRNUM (ctx, errno);
       goto cleanup;
     }
-  if (!(obj_cmd_rs = fiid_obj_create (tmpl_inteldcmi_raw)))
+  if (!(obj_cmd_rs = fiid_obj_create_in (ctx->arena, tmpl_inteldcmi_raw)))
     {
       API_ERRNO_TO_API_ERRNUM (ctx, errno);
       goto cleanup;
     }
 
-  if (fiid_obj_set_all (obj_cmd_rq,
-                        buf_rq,
-                        buf_rq_len) < 0)
-    {
-      API_FIID_OBJECT_ERROR_TO_API_ERRNUM (ctx, obj_cmd_rq);
-      goto cleanup;
-    }
-
   if (api_inteldcmi_cmd (ctx,
                          obj_cmd_rq,
                          obj_cmd_rs) < 0)
@@ -176,25 +180,20 @@ api_inteldcmi_cmd_raw_ipmb (ipmi_ctx_t ctx,
           && buf_rs
           && buf_rs_len);
 
-  if (!(obj_cmd_rq = fiid_obj_create (tmpl_inteldcmi_raw)))
+  if (!(obj_cmd_rq = fiid_obj_view_create_in (ctx->arena,
+                                              tmpl_inteldcmi_raw,
+                                              buf_rq,
+                                              buf_rq_len)))
     {
       API_ERRNO_TO_API_ERRNUM (ctx, errno);
       goto cleanup;
     }
-  if (!(obj_cmd_rs = fiid_obj_create (tmpl_inteldcmi_raw)))
+  if (!(obj_cmd_rs = fiid_obj_create_in (ctx->arena, tmpl_inteldcmi_raw)))
     {
       API_ERRNO_TO_API_ERRNUM (ctx, errno);
       goto cleanup;
     }
 
-  if (fiid_obj_set_all (obj_cmd_rq,
-                        buf_rq,
-                        buf_rq_len) < 0)
-    {
-      API_FIID_OBJECT_ERROR_TO_API_ERRNUM (ctx, obj_cmd_rq);
-      goto cleanup;
-    }
-
   if (api_inteldcmi_cmd_ipmb (ctx,
                               obj_cmd_rq,
                               obj_cmd_rs) < 0)
@@ -51,6 +51,7 @@
 #include "ipmi-api-trace.h"
 #include "ipmi-api-util.h"
 #include "ipmi-kcs-driver-api.h"
+#include "ipmi-pkt-trace.h"
 
 #include "libcommon/ipmi-fiid-util.h"
 
@@ -218,7 +219,7 @@ _kcs_cmd_write (ipmi_ctx_t ctx,
 
   pkt_len = hdr_len + cmd_len;
 
-  if (!(pkt = malloc (pkt_len)))
+  if (!(pkt = api_pkt_buf (ctx, pkt_len)))
     {
       API_ERRNO_TO_API_ERRNUM (ctx, errno);
       goto cleanup;
@@ -251,6 +252,8 @@ _kcs_cmd_write (ipmi_ctx_t ctx,
                       group_extension,
                       obj_cmd_rq);
 
+  api_pkt_trace (ctx, API_PKT_TRACE_REQUEST, pkt, send_len);
+
   if (ipmi_kcs_write (ctx->io.inband.kcs_ctx, pkt, send_len) < 0)
     {
       API_KCS_ERRNUM_TO_API_ERRNUM (ctx, ipmi_kcs_ctx_errnum (ctx->io.inband.kcs_ctx));
@@ -259,7 +262,6 @@ _kcs_cmd_write (ipmi_ctx_t ctx,
 
   rv = 0;
  cleanup:
-  free (pkt);
   return (rv);
 }
 
@@ -303,7 +305,7 @@ _kcs_cmd_read (ipmi_ctx_t ctx,
 
   pkt_len = hdr_len + cmd_len;
 
-  if (!(pkt = malloc (pkt_len)))
+  if (!(pkt = api_pkt_buf (ctx, pkt_len)))
     {
       API_ERRNO_TO_API_ERRNUM (ctx, errno);
       goto cleanup;
@@ -332,6 +334,8 @@ _kcs_cmd_read (ipmi_ctx_t ctx,
                       group_extension,
                       obj_cmd_rs);
 
+  api_pkt_trace (ctx, API_PKT_TRACE_RESPONSE, pkt, read_len);
+
   if ((ret = unassemble_ipmi_kcs_pkt (pkt,
                                       read_len,
                                       ctx->io.inband.rs.obj_hdr,
@@ -351,7 +355,6 @@ _kcs_cmd_read (ipmi_ctx_t ctx,
 
   rv = 0;
  cleanup:
-  free (pkt);
   fiid_template_free (tmpl);
   return (rv);
 }
@@ -418,17 +421,17 @@ _api_kcs_ipmb_send (ipmi_ctx_t ctx,
           && fiid_obj_valid (obj_cmd_rq)
           && fiid_obj_packet_valid (obj_cmd_rq) == 1);
 
-  if (!(obj_ipmb_msg_hdr_rq = fiid_obj_create (tmpl_ipmb_msg_hdr_rq)))
+  if (!(obj_ipmb_msg_hdr_rq = fiid_obj_create_in (ctx->arena, tmpl_ipmb_msg_hdr_rq)))
     {
       API_ERRNO_TO_API_ERRNUM (ctx, errno);
       goto cleanup;
     }
-  if (!(obj_ipmb_msg_rq = fiid_obj_create (tmpl_ipmb_msg)))
+  if (!(obj_ipmb_msg_rq = fiid_obj_create_in (ctx->arena, tmpl_ipmb_msg)))
     {
       API_ERRNO_TO_API_ERRNUM (ctx, errno);
       goto cleanup;
     }
-  if (!(obj_send_cmd_rs = fiid_obj_create (tmpl_cmd_send_message_rs)))
+  if (!(obj_send_cmd_rs = fiid_obj_create_in (ctx->arena, tmpl_cmd_send_message_rs)))
     {
       API_ERRNO_TO_API_ERRNUM (ctx, errno);
       goto cleanup;
@@ -523,12 +526,12 @@ _api_kcs_ipmb_recv (ipmi_ctx_t ctx,
   if (ctx->flags & IPMI_FLAGS_NO_LEGAL_CHECK)
     intf_flags |= IPMI_INTERFACE_FLAGS_NO_LEGAL_CHECK;
 
-  if (!(obj_ipmb_msg_rs = fiid_obj_create (tmpl_ipmb_msg)))
+  if (!(obj_ipmb_msg_rs = fiid_obj_create_in (ctx->arena, tmpl_ipmb_msg)))
     {
       API_ERRNO_TO_API_ERRNUM (ctx, errno);
       goto cleanup;
     }
-  if (!(obj_get_cmd_rs = fiid_obj_create (tmpl_cmd_get_message_rs)))
+  if (!(obj_get_cmd_rs = fiid_obj_create_in (ctx->arena, tmpl_cmd_get_message_rs)))
     {
       API_ERRNO_TO_API_ERRNUM (ctx, errno);
       goto cleanup;
@@ -605,12 +608,12 @@ api_kcs_cmd_ipmb (ipmi_ctx_t ctx,
           && fiid_obj_packet_valid (obj_cmd_rq) == 1
           && fiid_obj_valid (obj_cmd_rs));
 
-  if (!(obj_ipmb_msg_hdr_rs = fiid_obj_create (tmpl_ipmb_msg_hdr_rs)))
+  if (!(obj_ipmb_msg_hdr_rs = fiid_obj_create_in (ctx->arena, tmpl_ipmb_msg_hdr_rs)))
     {
       API_ERRNO_TO_API_ERRNUM (ctx, errno);
       goto cleanup;
     }
-  if (!(obj_ipmb_msg_trlr = fiid_obj_create (tmpl_ipmb_msg_trlr)))
+  if (!(obj_ipmb_msg_trlr = fiid_obj_create_in (ctx->arena, tmpl_ipmb_msg_trlr)))
     {
       API_ERRNO_TO_API_ERRNUM (ctx, errno);
       goto cleanup;
@@ -724,25 +727,20 @@ api_kcs_cmd_raw (ipmi_ctx_t ctx,
           && buf_rs
           && buf_rs_len);
 
-  if (!(obj_cmd_rq = fiid_obj_create (tmpl_kcs_raw)))
+  if (!(obj_cmd_rq = fiid_obj_view_create_in (ctx->arena,
+                                              tmpl_kcs_raw,
+                                              buf_rq,
+                                              buf_rq_len)))
     {
       API_ERRNO_TO_API_ERRNUM (ctx, errno);
       goto cleanup;
     }
-  if (!(obj_cmd_rs = fiid_obj_create (tmpl_kcs_raw)))
+  if (!(obj_cmd_rs = fiid_obj_create_in (ctx->arena, tmpl_kcs_raw)))
     {
       API_ERRNO_TO_API_ERRNUM (ctx, errno);
       goto cleanup;
     }
 
-  if (fiid_obj_set_all (obj_cmd_rq,
-                        buf_rq,
-                        buf_rq_len) < 0)
-    {
-      API_FIID_OBJECT_ERROR_TO_API_ERRNUM (ctx, obj_cmd_rq);
-      goto cleanup;
-    }
-
   if (api_kcs_cmd (ctx,
                    obj_cmd_rq,
                    obj_cmd_rs) < 0)
@@ -782,25 +780,20 @@ api_kcs_cmd_raw_ipmb (ipmi_ctx_t ctx,
           && buf_rs
           && buf_rs_len);
 
-  if (!(obj_cmd_rq = fiid_obj_create (tmpl_kcs_raw)))
+  if (!(obj_cmd_rq = fiid_obj_view_create_in (ctx->arena,
+                                              tmpl_kcs_raw,
+                                              buf_rq,
+                                              buf_rq_len)))
     {
       API_ERRNO_TO_API_ERRNUM (ctx, errno);
       goto cleanup;
     }
-  if (!(obj_cmd_rs = fiid_obj_create (tmpl_kcs_raw)))
+  if (!(obj_cmd_rs = fiid_obj_create_in (ctx->arena, tmpl_kcs_raw)))
     {
       API_ERRNO_TO_API_ERRNUM (ctx, errno);
       goto cleanup;
     }
 
-  if (fiid_obj_set_all (obj_cmd_rq,
-                        buf_rq,
-                        buf_rq_len) < 0)
-    {
-      API_FIID_OBJECT_ERROR_TO_API_ERRNUM (ctx, obj_cmd_rq);
-      goto cleanup;
-    }
-
   if (api_kcs_cmd_ipmb (ctx,
                         obj_cmd_rq,
                         obj_cmd_rs) < 0)
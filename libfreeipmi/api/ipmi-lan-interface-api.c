@@ -40,6 +40,7 @@
 #include "ipmi-api-defs.h"
 #include "ipmi-api-trace.h"
 #include "ipmi-api-util.h"
+#include "ipmi-lan-interface-api.h"
 #include "ipmi-lan-session-common.h"
 
 #include "libcommon/ipmi-fiid-util.h"
@@ -149,25 +150,20 @@ api_lan_cmd_raw (ipmi_ctx_t ctx,
           && buf_rs
           && buf_rs_len);
 
-  if (!(obj_cmd_rq = fiid_obj_create (tmpl_lan_raw)))
+  if (!(obj_cmd_rq = fiid_obj_view_create_in (ctx->arena,
+                                              tmpl_lan_raw,
+                                              buf_rq,
+                                              buf_rq_len)))
     {
       API_ERRNO_TO_API_ERRNUM (ctx, errno);
       goto cleanup;
     }
-  if (!(obj_cmd_rs = fiid_obj_create (tmpl_lan_raw)))
+  if (!(obj_cmd_rs = fiid_obj_create_in (ctx->arena, tmpl_lan_raw)))
     {
       API_ERRNO_TO_API_ERRNUM (ctx, errno);
       goto cleanup;
     }
 
-  if (fiid_obj_set_all (obj_cmd_rq,
-                        buf_rq,
-                        buf_rq_len) < 0)
-    {
-      API_FIID_OBJECT_ERROR_TO_API_ERRNUM (ctx, obj_cmd_rq);
-      goto cleanup;
-    }
-
   if (api_lan_cmd (ctx,
                    obj_cmd_rq,
                    obj_cmd_rs) < 0)
@@ -208,25 +204,20 @@ api_lan_cmd_raw_ipmb (ipmi_ctx_t ctx,
           && buf_rs
           && buf_rs_len);
 
-  if (!(obj_cmd_rq = fiid_obj_create (tmpl_lan_raw)))
+  if (!(obj_cmd_rq = fiid_obj_view_create_in (ctx->arena,
+                                              tmpl_lan_raw,
+                                              buf_rq,
+                                              buf_rq_len)))
     {
       API_ERRNO_TO_API_ERRNUM (ctx, errno);
       goto cleanup;
     }
-  if (!(obj_cmd_rs = fiid_obj_create (tmpl_lan_raw)))
+  if (!(obj_cmd_rs = fiid_obj_create_in (ctx->arena, tmpl_lan_raw)))
     {
       API_ERRNO_TO_API_ERRNUM (ctx, errno);
       goto cleanup;
     }
 
-  if (fiid_obj_set_all (obj_cmd_rq,
-                        buf_rq,
-                        buf_rq_len) < 0)
-    {
-      API_FIID_OBJECT_ERROR_TO_API_ERRNUM (ctx, obj_cmd_rq);
-      goto cleanup;
-    }
-
   if (api_lan_cmd_ipmb (ctx,
                         obj_cmd_rq,
                         obj_cmd_rs) < 0)
@@ -329,25 +320,20 @@ api_lan_2_0_cmd_raw (ipmi_ctx_t ctx,
           && buf_rs
           && buf_rs_len);
 
-  if (!(obj_cmd_rq = fiid_obj_create (tmpl_lan_raw)))
+  if (!(obj_cmd_rq = fiid_obj_view_create_in (ctx->arena,
+                                              tmpl_lan_raw,
+                                              buf_rq,
+                                              buf_rq_len)))
     {
       API_ERRNO_TO_API_ERRNUM (ctx, errno);
       goto cleanup;
     }
-  if (!(obj_cmd_rs = fiid_obj_create (tmpl_lan_raw)))
+  if (!(obj_cmd_rs = fiid_obj_create_in (ctx->arena, tmpl_lan_raw)))
     {
       API_ERRNO_TO_API_ERRNUM (ctx, errno);
       goto cleanup;
     }
 
-  if (fiid_obj_set_all (obj_cmd_rq,
-                        buf_rq,
-                        buf_rq_len) < 0)
-    {
-      API_FIID_OBJECT_ERROR_TO_API_ERRNUM (ctx, obj_cmd_rq);
-      goto cleanup;
-    }
-
   if (api_lan_2_0_cmd (ctx,
                        obj_cmd_rq,
                        obj_cmd_rs) < 0)
@@ -388,25 +374,20 @@ api_lan_2_0_cmd_raw_ipmb (ipmi_ctx_t ctx,
           && buf_rs
           && buf_rs_len);
 
-  if (!(obj_cmd_rq = fiid_obj_create (tmpl_lan_raw)))
+  if (!(obj_cmd_rq = fiid_obj_view_create_in (ctx->arena,
+                                              tmpl_lan_raw,
+                                              buf_rq,
+                                              buf_rq_len)))
     {
       API_ERRNO_TO_API_ERRNUM (ctx, errno);
       goto cleanup;
     }
-  if (!(obj_cmd_rs = fiid_obj_create (tmpl_lan_raw)))
+  if (!(obj_cmd_rs = fiid_obj_create_in (ctx->arena, tmpl_lan_raw)))
     {
       API_ERRNO_TO_API_ERRNUM (ctx, errno);
       goto cleanup;
     }
 
-  if (fiid_obj_set_all (obj_cmd_rq,
-                        buf_rq,
-                        buf_rq_len) < 0)
-    {
-      API_FIID_OBJECT_ERROR_TO_API_ERRNUM (ctx, obj_cmd_rq);
-      goto cleanup;
-    }
-
   if (api_lan_2_0_cmd_ipmb (ctx,
                             obj_cmd_rq,
                             obj_cmd_rs) < 0)
@@ -23,6 +23,9 @@
 #include <freeipmi/api/ipmi-api.h>
 #include <freeipmi/fiid/fiid.h>
 
+/* raw command data of unknown layout */
+extern fiid_template_t tmpl_lan_raw;
+
 int api_lan_cmd (ipmi_ctx_t ctx,
                  fiid_obj_t obj_cmd_rq,
                  fiid_obj_t obj_cmd_rs);
@@ -0,0 +1,315 @@
+/*
+ * Copyright (C) 2003-2015 FreeIPMI Core Team
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif /* HAVE_CONFIG_H */
+
+#include <stdio.h>
+#include <stdlib.h>
+#ifdef STDC_HEADERS
+#include <string.h>
+#endif /* STDC_HEADERS */
+#if HAVE_UNISTD_H
+#include <unistd.h>
+#endif /* HAVE_UNISTD_H */
+#if HAVE_FCNTL_H
+#include <fcntl.h>
+#endif /* HAVE_FCNTL_H */
+#include <sys/types.h>
+#include <sys/param.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <assert.h>
+#include <errno.h>
+
+#include "freeipmi/api/ipmi-api.h"
+
+#include "ipmi-api-defs.h"
+#include "ipmi-lan-session-cache.h"
+
+#include "freeipmi-portability.h"
+
+#ifndef MAXPATHLEN
+#define MAXPATHLEN 4096
+#endif /* MAXPATHLEN */
+
+#define IPMI_LAN_SESSION_CACHE_FILENAME_PREFIX "session-cache"
+
+#define IPMI_LAN_SESSION_CACHE_MAGIC   0xfafac5c5
+#define IPMI_LAN_SESSION_CACHE_VERSION 0x01
+
+#define IPMI_LAN_SESSION_CACHE_FLAGS_USERNAME              0x01
+#define IPMI_LAN_SESSION_CACHE_FLAGS_PASSWORD              0x02
+#define IPMI_LAN_SESSION_CACHE_FLAGS_K_G                   0x04
+#define IPMI_LAN_SESSION_CACHE_FLAGS_PER_MSG_AUTH_DISABLED 0x08
+
+/* magic, version, driver type, authentication type or cipher suite
+ * id, privilege level, flags, both workaround flags, port, hostname
+ * length and hostname
+ */
+#define IPMI_LAN_SESSION_CACHE_RECORD_MAX (4 + 1 + 1 + 1 + 1 + 1 + 4 + 4 + 2 + 1 + MAXHOSTNAMELEN)
+
+static uint16_t
+_port (ipmi_ctx_t ctx)
+{
+  assert (ctx
+          && ctx->magic == IPMI_CTX_MAGIC
+          && ctx->io.outofband.remote_host);
+
+  if (ctx->io.outofband.remote_host->sa_family == AF_INET6)
+    return (ntohs (ctx->io.outofband.remote_host6.sin6_port));
+  return (ntohs (ctx->io.outofband.remote_host4.sin_port));
+}
+
+static int
+_filename (ipmi_ctx_t ctx, char *buf, unsigned int buflen)
+{
+  char nodename[MAXHOSTNAMELEN+1];
+  char *ptr;
+  int ret;
+
+  assert (ctx
+          && ctx->magic == IPMI_CTX_MAGIC
+          && ctx->session_cache_directory
+          && buf
+          && buflen);
+
+  /* hostname is used as a file name */
+  if (strchr (ctx->io.outofband.hostname, '/'))
+    return (-1);
+
+  memset (nodename, '\0', MAXHOSTNAMELEN+1);
+  if (gethostname (nodename, MAXHOSTNAMELEN) < 0)
+    snprintf (nodename, MAXHOSTNAMELEN, "localhost");
+
+  /* shorten hostname if necessary */
+  if ((ptr = strchr (nodename, '.')))
+    *ptr = '\0';
+
+  /* same naming as the SDR cache, so records of a shared home
+   * directory do not collide between nodes
+   */
+  ret = snprintf (buf,
+                  buflen,
+                  "%s/%s-%s.%s.%u",
+                  ctx->session_cache_directory,
+                  IPMI_LAN_SESSION_CACHE_FILENAME_PREFIX,
+                  nodename,
+                  ctx->io.outofband.hostname,
+                  _port (ctx));
+  if (ret < 0 || ret >= buflen)
+    return (-1);
+
+  return (0);
+}
+
+static void
+_put32 (uint8_t *buf, uint32_t val)
+{
+  assert (buf);
+
+  buf[0] = (val & 0x000000FF);
+  buf[1] = (val & 0x0000FF00) >> 8;
+  buf[2] = (val & 0x00FF0000) >> 16;
+  buf[3] = (val & 0xFF000000) >> 24;
+}
+
+/* The record holds everything the skipped Get Channel Authentication
+ * Capabilities exchange was checked against.  A record only matches
+ * the same session configuration it was written for, so a changed
+ * username, K_g, privilege level, authentication type, cipher suite
+ * or workaround is a cache miss rather than a rejected session.
+ *
+ * returns record length
+ */
+static unsigned int
+_record (ipmi_ctx_t ctx,
+         uint8_t per_msg_auth_disabled,
+         uint8_t *buf)
+{
+  unsigned int hostname_len;
+  unsigned int len = 0;
+  uint16_t port;
+  uint8_t flags = 0;
+
+  assert (ctx
+          && ctx->magic == IPMI_CTX_MAGIC
+          && (ctx->type == IPMI_DEVICE_LAN
+              || ctx->type == IPMI_DEVICE_LAN_2_0)
+          && buf);
+
+  if (strlen (ctx->io.outofband.username))
+    flags |= IPMI_LAN_SESSION_CACHE_FLAGS_USERNAME;
+  if (strlen (ctx->io.outofband.password))
+    flags |= IPMI_LAN_SESSION_CACHE_FLAGS_PASSWORD;
+  if (ctx->type == IPMI_DEVICE_LAN_2_0
+      && ctx->io.outofband.k_g_configured)
+    flags |= IPMI_LAN_SESSION_CACHE_FLAGS_K_G;
+  if (per_msg_auth_disabled)
+    flags |= IPMI_LAN_SESSION_CACHE_FLAGS_PER_MSG_AUTH_DISABLED;
+
+  hostname_len = strlen (ctx->io.outofband.hostname);
+  port = _port (ctx);
+
+  _put32 (buf + len, IPMI_LAN_SESSION_CACHE_MAGIC);
+  len += 4;
+  buf[len++] = IPMI_LAN_SESSION_CACHE_VERSION;
+  buf[len++] = ctx->type;
+  if (ctx->type == IPMI_DEVICE_LAN)
+    buf[len++] = ctx->io.outofband.authentication_type;
+  else
+    buf[len++] = ctx->io.outofband.cipher_suite_id;
+  buf[len++] = ctx->io.outofband.privilege_level;
+  buf[len++] = flags;
+  _put32 (buf + len, ctx->workaround_flags_outofband);
+  len += 4;
+  _put32 (buf + len, ctx->workaround_flags_outofband_2_0);
+  len += 4;
+  buf[len++] = (port & 0x00FF);
+  buf[len++] = (port & 0xFF00) >> 8;
+  buf[len++] = hostname_len;
+  memcpy (buf + len, ctx->io.outofband.hostname, hostname_len);
+  len += hostname_len;
+
+  return (len);
+}
+
+/* offset of the flags in the record */
+#define IPMI_LAN_SESSION_CACHE_FLAGS_OFFSET 8
+
+int
+api_lan_session_cache_load (ipmi_ctx_t ctx, uint8_t *per_msg_auth_disabled)
+{
+  char filename[MAXPATHLEN+1];
+  uint8_t expected[IPMI_LAN_SESSION_CACHE_RECORD_MAX];
+  uint8_t record[IPMI_LAN_SESSION_CACHE_RECORD_MAX + 1];
+  unsigned int expected_len;
+  ssize_t len;
+  int fd = -1;
+  int rv = 0;
+
+  assert (ctx
+          && ctx->magic == IPMI_CTX_MAGIC
+          && (ctx->type == IPMI_DEVICE_LAN
+              || ctx->type == IPMI_DEVICE_LAN_2_0)
+          && per_msg_auth_disabled);
+
+  if (!ctx->session_cache_directory)
+    return (0);
+
+  if (_filename (ctx, filename, MAXPATHLEN + 1) < 0)
+    goto cleanup;
+
+  if ((fd = open (filename, O_RDONLY)) < 0)
+    goto cleanup;
+
+  /* read one byte more than the expected record to catch trailing
+   * garbage
+   */
+  expected_len = _record (ctx, 0, expected);
+  if ((len = read (fd, record, expected_len + 1)) != expected_len)
+    goto cleanup;
+
+  (*per_msg_auth_disabled) = (record[IPMI_LAN_SESSION_CACHE_FLAGS_OFFSET] & IPMI_LAN_SESSION_CACHE_FLAGS_PER_MSG_AUTH_DISABLED) ? 1 : 0;
+  record[IPMI_LAN_SESSION_CACHE_FLAGS_OFFSET] &= ~IPMI_LAN_SESSION_CACHE_FLAGS_PER_MSG_AUTH_DISABLED;
+
+  if (memcmp (record, expected, expected_len))
+    goto cleanup;
+
+  rv = 1;
+ cleanup:
+  /* ignore potential error, cleanup path */
+  if (fd >= 0)
+    close (fd);
+  return (rv);
+}
+
+void
+api_lan_session_cache_store (ipmi_ctx_t ctx, uint8_t per_msg_auth_disabled)
+{
+  char filename[MAXPATHLEN+1];
+  char tmpfilename[MAXPATHLEN+1];
+  uint8_t record[IPMI_LAN_SESSION_CACHE_RECORD_MAX];
+  unsigned int record_len;
+  int fd = -1;
+  int ret;
+
+  assert (ctx
+          && ctx->magic == IPMI_CTX_MAGIC
+          && (ctx->type == IPMI_DEVICE_LAN
+              || ctx->type == IPMI_DEVICE_LAN_2_0));
+
+  if (!ctx->session_cache_directory)
+    return;
+
+  if (_filename (ctx, filename, MAXPATHLEN + 1) < 0)
+    return;
+
+  ret = snprintf (tmpfilename, MAXPATHLEN + 1, "%s.XXXXXX", filename);
+  if (ret < 0 || ret > MAXPATHLEN)
+    return;
+
+  /* written aside and renamed, so concurrent readers never see a
+   * partial record
+   */
+  if ((fd = mkstemp (tmpfilename)) < 0)
+    return;
+
+  record_len = _record (ctx, per_msg_auth_disabled, record);
+  if (write (fd, record, record_len) != record_len)
+    goto cleanup;
+
+  if (close (fd) < 0)
+    {
+      fd = -1;
+      goto cleanup;
+    }
+  fd = -1;
+
+  if (rename (tmpfilename, filename) < 0)
+    goto cleanup;
+
+  return;
+
+ cleanup:
+  /* ignore potential error, cleanup path */
+  if (fd >= 0)
+    close (fd);
+  unlink (tmpfilename);
+}
+
+void
+api_lan_session_cache_invalidate (ipmi_ctx_t ctx)
+{
+  char filename[MAXPATHLEN+1];
+
+  assert (ctx
+          && ctx->magic == IPMI_CTX_MAGIC
+          && (ctx->type == IPMI_DEVICE_LAN
+              || ctx->type == IPMI_DEVICE_LAN_2_0));
+
+  if (!ctx->session_cache_directory)
+    return;
+
+  if (_filename (ctx, filename, MAXPATHLEN + 1) < 0)
+    return;
+
+  /* ignore potential error, no record is no record */
+  unlink (filename);
+}
@@ -0,0 +1,40 @@
+/*
+ * Copyright (C) 2003-2015 FreeIPMI Core Team
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef IPMI_LAN_SESSION_CACHE_H
+#define IPMI_LAN_SESSION_CACHE_H
+
+#include <stdint.h>
+
+#include <freeipmi/api/ipmi-api.h>
+
+/* The session cache is only an optimization, none of these fail.  A
+ * missing, unreadable or mismatched cache record is a cache miss and
+ * a record that cannot be written is not written.
+ */
+
+/* returns 1 if a record for the session configured in ctx was found,
+ * 0 if not
+ */
+int api_lan_session_cache_load (ipmi_ctx_t ctx, uint8_t *per_msg_auth_disabled);
+
+void api_lan_session_cache_store (ipmi_ctx_t ctx, uint8_t per_msg_auth_disabled);
+
+void api_lan_session_cache_invalidate (ipmi_ctx_t ctx);
+
+#endif /* IPMI_LAN_SESSION_CACHE_H */
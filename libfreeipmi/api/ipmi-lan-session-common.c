@@ -70,15 +70,23 @@
 #include "ipmi-api-defs.h"
 #include "ipmi-api-trace.h"
 #include "ipmi-api-util.h"
+#include "ipmi-lan-interface-api.h"
+#include "ipmi-lan-session-cache.h"
 #include "ipmi-lan-session-common.h"
+#include "ipmi-mux.h"
+#include "ipmi-pkt-trace.h"
 
 #include "libcommon/ipmi-fiid-util.h"
 
 #include "freeipmi-portability.h"
 #include "debug-util.h"
+#include "secure.h"
 
 #define IPMI_LAN_BACKOFF_COUNT         2
 
+/* clock granularity of the round trip time estimate, microseconds */
+#define IPMI_LAN_RTT_GRANULARITY       1000
+
 struct socket_to_close {
   int fd;
   struct socket_to_close *next;
@@ -132,21 +140,186 @@ api_lan_2_0_cmd_get_session_parameters (ipmi_ctx_t ctx,
     (*payload_encrypted) = IPMI_PAYLOAD_FLAG_ENCRYPTED;
 }
 
+static void
+_session_timeout (ipmi_ctx_t ctx, struct timeval *session_timeout)
+{
+  struct timeval session_timeout_len;
+
+  assert (ctx
+          && ctx->magic == IPMI_CTX_MAGIC
+          && (ctx->type == IPMI_DEVICE_LAN
+              || ctx->type == IPMI_DEVICE_LAN_2_0)
+          && session_timeout);
+
+  session_timeout_len.tv_sec = ctx->io.outofband.session_timeout / 1000;
+  session_timeout_len.tv_usec = (ctx->io.outofband.session_timeout - (session_timeout_len.tv_sec * 1000)) * 1000;
+  timeradd (&(ctx->io.outofband.last_received), &session_timeout_len, session_timeout);
+}
+
+/* retransmission timeout before backoff, in microseconds
+ *
+ * With adaptive retransmission, the timeout is the smoothed round
+ * trip time plus four times its variance (RFC 6298), kept between
+ * the configured floor and ceiling.  Until the first round trip is
+ * measured, the configured retransmission timeout is used.  See
+ * _rtt_sample() and _rtt_backoff().
+ */
+static uint64_t
+_retransmission_timeout_base (ipmi_ctx_t ctx)
+{
+  uint64_t rto;
+
+  assert (ctx
+          && ctx->magic == IPMI_CTX_MAGIC
+          && (ctx->type == IPMI_DEVICE_LAN
+              || ctx->type == IPMI_DEVICE_LAN_2_0));
+
+  rto = (uint64_t)ctx->io.outofband.retransmission_timeout * 1000;
+
+  if (!ctx->retransmission_timeout_floor)
+    return (rto);
+
+  if (ctx->io.outofband.rto)
+    rto = ctx->io.outofband.rto;
+
+  if (rto < (uint64_t)ctx->retransmission_timeout_floor * 1000)
+    rto = (uint64_t)ctx->retransmission_timeout_floor * 1000;
+  if (rto > (uint64_t)ctx->retransmission_timeout_ceiling * 1000)
+    rto = (uint64_t)ctx->retransmission_timeout_ceiling * 1000;
+
+  return (rto);
+}
+
+/* time of the next retransmission of a request last sent at last_send */
+static void
+_retransmission_timeout (ipmi_ctx_t ctx,
+                         const struct timeval *last_send,
+                         unsigned int retransmission_count,
+                         struct timeval *retransmission_timeout)
+{
+  struct timeval retransmission_timeout_len;
+  unsigned int retransmission_timeout_multiplier;
+  uint64_t retransmission_timeout_us;
+
+  assert (ctx
+          && ctx->magic == IPMI_CTX_MAGIC
+          && (ctx->type == IPMI_DEVICE_LAN
+              || ctx->type == IPMI_DEVICE_LAN_2_0)
+          && last_send
+          && retransmission_timeout);
+
+  retransmission_timeout_multiplier = (retransmission_count / IPMI_LAN_BACKOFF_COUNT) + 1;
+
+  retransmission_timeout_us = retransmission_timeout_multiplier * _retransmission_timeout_base (ctx);
+
+  retransmission_timeout_len.tv_sec = retransmission_timeout_us / 1000000;
+  retransmission_timeout_len.tv_usec = retransmission_timeout_us % 1000000;
+
+  timeradd (last_send, &retransmission_timeout_len, retransmission_timeout);
+}
+
+/* update the round trip time estimate with the response to exchange
+ * x, RFC 6298
+ *
+ * Per Karn's rule, responses to retransmitted requests are not
+ * sampled, they may answer any of the transmissions.
+ */
+static void
+_rtt_sample (ipmi_ctx_t ctx, struct ipmi_ctx_exchange *x)
+{
+  struct timeval rtt_val;
+  unsigned int rtt;
+  unsigned int delta;
+
+  assert (ctx
+          && ctx->magic == IPMI_CTX_MAGIC
+          && (ctx->type == IPMI_DEVICE_LAN
+              || ctx->type == IPMI_DEVICE_LAN_2_0)
+          && x);
+
+  if (x->retransmission_count)
+    return;
+
+  /* clock stepped, or nothing sent yet */
+  if (!timerisset (&(x->last_send))
+      || timercmp (&(ctx->io.outofband.last_received), &(x->last_send), <))
+    return;
+
+  timersub (&(ctx->io.outofband.last_received), &(x->last_send), &rtt_val);
+
+  if (rtt_val.tv_sec > ctx->io.outofband.session_timeout / 1000)
+    return;
+
+  rtt = (rtt_val.tv_sec * 1000000) + rtt_val.tv_usec;
+
+  if (!ctx->io.outofband.rtt_samples)
+    {
+      ctx->io.outofband.srtt = rtt;
+      ctx->io.outofband.rttvar = rtt / 2;
+    }
+  else
+    {
+      delta = (ctx->io.outofband.srtt > rtt) ? (ctx->io.outofband.srtt - rtt) : (rtt - ctx->io.outofband.srtt);
+      ctx->io.outofband.rttvar = ((3 * (uint64_t)ctx->io.outofband.rttvar) + delta) / 4;
+      ctx->io.outofband.srtt = ((7 * (uint64_t)ctx->io.outofband.srtt) + rtt) / 8;
+    }
+
+  ctx->io.outofband.rtt_samples++;
+
+  delta = ctx->io.outofband.rttvar * 4;
+  if (delta < IPMI_LAN_RTT_GRANULARITY)
+    delta = IPMI_LAN_RTT_GRANULARITY;
+  ctx->io.outofband.rto = ctx->io.outofband.srtt + delta;
+}
+
+/* back off the adaptive retransmission timeout before exchange x is
+ * retransmitted
+ *
+ * Karn's rule keeps retransmitted requests from being sampled, so a
+ * BMC slower than the timeout would never be measured.  The doubled
+ * timeout is kept until the next sample.  Requests sent before the
+ * last backoff were timed with the old timeout and do not back it
+ * off again, so a window of requests timing out together doubles it
+ * once.
+ */
+static void
+_rtt_backoff (ipmi_ctx_t ctx, struct ipmi_ctx_exchange *x)
+{
+  uint64_t rto;
+
+  assert (ctx
+          && ctx->magic == IPMI_CTX_MAGIC
+          && (ctx->type == IPMI_DEVICE_LAN
+              || ctx->type == IPMI_DEVICE_LAN_2_0)
+          && x);
+
+  if (!ctx->retransmission_timeout_floor)
+    return;
+
+  if (timercmp (&(x->last_send), &(ctx->io.outofband.rto_backoff), <))
+    return;
+
+  rto = _retransmission_timeout_base (ctx) * 2;
+  if (rto > (uint64_t)ctx->retransmission_timeout_ceiling * 1000)
+    rto = (uint64_t)ctx->retransmission_timeout_ceiling * 1000;
+  ctx->io.outofband.rto = rto;
+
+  /* ignore potential error, the next retransmission backs off again */
+  gettimeofday (&(ctx->io.outofband.rto_backoff), NULL);
+}
+
 static int
 _session_timed_out (ipmi_ctx_t ctx)
 {
   struct timeval current;
   struct timeval session_timeout;
-  struct timeval session_timeout_len;
 
   assert (ctx
           && ctx->magic == IPMI_CTX_MAGIC
           && (ctx->type == IPMI_DEVICE_LAN
               || ctx->type == IPMI_DEVICE_LAN_2_0));
 
-  session_timeout_len.tv_sec = ctx->io.outofband.session_timeout / 1000;
-  session_timeout_len.tv_usec = (ctx->io.outofband.session_timeout - (session_timeout_len.tv_sec * 1000)) * 1000;
-  timeradd (&(ctx->io.outofband.last_received), &session_timeout_len, &session_timeout);
+  _session_timeout (ctx, &session_timeout);
 
   if (gettimeofday (&current, NULL) < 0)
     {
@@ -169,10 +342,8 @@ _calculate_timeout (ipmi_ctx_t ctx,
   struct timeval session_timeout_len;
   struct timeval session_timeout_val;
   struct timeval retransmission_timeout;
-  struct timeval retransmission_timeout_len;
   struct timeval retransmission_timeout_val;
   struct timeval already_timedout_check;
-  unsigned int retransmission_timeout_multiplier;
 
   assert (ctx
           && ctx->magic == IPMI_CTX_MAGIC
@@ -193,12 +364,10 @@ _calculate_timeout (ipmi_ctx_t ctx,
   timeradd (recv_starttime, &session_timeout_len, &session_timeout);
   timersub (&session_timeout, recv_starttime, &session_timeout_val);
 
-  retransmission_timeout_multiplier = (retransmission_count / IPMI_LAN_BACKOFF_COUNT) + 1;
-
-  retransmission_timeout_len.tv_sec = (retransmission_timeout_multiplier * ctx->io.outofband.retransmission_timeout) / 1000;
-  retransmission_timeout_len.tv_usec = ((retransmission_timeout_multiplier * ctx->io.outofband.retransmission_timeout) - (retransmission_timeout_len.tv_sec * 1000)) * 1000;
-
-  timeradd (&ctx->io.outofband.last_send, &retransmission_timeout_len, &retransmission_timeout);
+  _retransmission_timeout (ctx,
+                           &(ctx->io.outofband.last_send),
+                           retransmission_count,
+                           &retransmission_timeout);
   timersub (&retransmission_timeout, recv_starttime, &retransmission_timeout_val);
 
   if (timercmp (&retransmission_timeout_val, &session_timeout_val, <))
@@ -233,6 +402,7 @@ _api_lan_recvfrom (ipmi_ctx_t ctx,
                    struct timeval *recv_starttime)
 {
   int status = 0;
+  int timeoutms;
   int recv_len;
   int ret;
 
@@ -249,7 +419,6 @@ _api_lan_recvfrom (ipmi_ctx_t ctx,
     {
       struct timeval timeout;
       struct pollfd pfd_read;
-      int timeoutms;
 
       if ((ret = _calculate_timeout (ctx,
                                      retransmission_count,
@@ -260,13 +429,19 @@ _api_lan_recvfrom (ipmi_ctx_t ctx,
       if (!ret)
         return (0);
 
+      /* XXX: potential overflow scenarios? */
+      timeoutms = (timeout.tv_sec * 1000) + (timeout.tv_usec / 1000);
+
+      /* packets of a shared socket are waited for and read by the
+       * multiplexer
+       */
+      if (ctx->io.outofband.mux_peer)
+        return (api_mux_recvfrom (ctx, pkt, pkt_len, timeoutms));
+
       pfd_read.fd = ctx->io.outofband.sockfd;
       pfd_read.events = POLLIN;
       pfd_read.revents = 0;
 
-      /* XXX: potential overflow scenarios? */
-      timeoutms = (timeout.tv_sec * 1000) + (timeout.tv_usec / 1000);
-
       if ((status = poll (&pfd_read, 1, timeoutms)) < 0)
         {
           API_ERRNO_TO_API_ERRNUM (ctx, errno);
@@ -276,6 +451,8 @@ _api_lan_recvfrom (ipmi_ctx_t ctx,
       if (!status)
         return (0); /* resend the request */
     }
+  else if (ctx->io.outofband.mux_peer)
+    return (api_mux_recvfrom (ctx, pkt, pkt_len, -1));
 
   do
     {
@@ -512,7 +689,7 @@ _api_lan_cmd_send (ipmi_ctx_t ctx,
   /* variable based on authentication, etc. 1024 extra is enough */
   pkt_len = cmd_len + IPMI_PKT_PAD;
 
-  if (!(pkt = malloc (pkt_len)))
+  if (!(pkt = api_pkt_buf (ctx, pkt_len)))
     {
       API_ERRNO_TO_API_ERRNUM (ctx, errno);
       goto cleanup;
@@ -566,6 +743,8 @@ _api_lan_cmd_send (ipmi_ctx_t ctx,
                       group_extension,
                       obj_cmd_rq);
 
+  api_pkt_trace (ctx, API_PKT_TRACE_REQUEST, pkt, send_len);
+
   do
     {
       ret = ipmi_lan_sendto (ctx->io.outofband.sockfd,
@@ -590,7 +769,6 @@ _api_lan_cmd_send (ipmi_ctx_t ctx,
 
   rv = 0;
  cleanup:
-  free (pkt);
   return (rv);
 }
 
@@ -677,6 +855,7 @@ _api_lan_cmd_recv (ipmi_ctx_t ctx,
       return (-1);
     }
 
+  api_pkt_trace (ctx, API_PKT_TRACE_RESPONSE, pkt, recv_len);
   return (recv_len);
 }
 
@@ -885,374 +1064,117 @@ _api_lan_cmd_wrapper_verify_packet (ipmi_ctx_t ctx,
   return (rv);
 }
 
-int
-api_lan_cmd_wrapper (ipmi_ctx_t ctx,
-                     unsigned int internal_workaround_flags,
-                     uint8_t lun,
-                     uint8_t net_fn,
-                     uint8_t authentication_type,
-                     int check_authentication_code,
-                     uint32_t *session_sequence_number,
-                     uint32_t session_id,
-                     uint8_t *rq_seq,
-                     const char *password,
-                     unsigned int password_len,
+/* see workaround _ipmi_check_ipmb_out_of_order() regarding obj_rs & obj_rs_errnum pointer */
+static int
+_ipmi_cmd_send_ipmb (ipmi_ctx_t ctx,
                      fiid_obj_t obj_cmd_rq,
-                     fiid_obj_t obj_cmd_rs)
+                     fiid_obj_t *obj_rs,
+                     ipmi_errnum_type_t *obj_rs_errnum)
 {
-  int recv_len, ret, rv = -1;
-  unsigned int retransmission_count = 0;
-  uint8_t pkt[IPMI_MAX_PKT_LEN];
-  struct socket_to_close *sockets = NULL;
-  uint8_t cmd = 0;             /* used for debugging */
-  uint8_t group_extension = 0; /* used for debugging */
-  uint64_t val;
-  unsigned int intf_flags = IPMI_INTERFACE_FLAGS_DEFAULT;
+  struct ipmi_ctx_target target_save;
+  uint8_t tbuf[IPMI_MAX_PKT_LEN];
+  fiid_obj_t obj_ipmb_msg_hdr_rq = NULL;
+  fiid_obj_t obj_ipmb_msg_rq = NULL;
+  fiid_obj_t obj_send_cmd_rs = NULL;
+  int len, ret, rv = -1;
 
   assert (ctx
           && ctx->magic == IPMI_CTX_MAGIC
           && (ctx->type == IPMI_DEVICE_LAN
               || ctx->type == IPMI_DEVICE_LAN_2_0)
           && ctx->io.outofband.sockfd
-          && IPMI_BMC_LUN_VALID (lun)
-          && IPMI_NET_FN_VALID (net_fn)
-          && IPMI_1_5_AUTHENTICATION_TYPE_VALID (authentication_type)
-          && !(password && password_len > IPMI_1_5_MAX_PASSWORD_LENGTH)
           && fiid_obj_valid (obj_cmd_rq)
-          && fiid_obj_packet_valid (obj_cmd_rq) == 1
-          && fiid_obj_valid (obj_cmd_rs));
+          && fiid_obj_packet_valid (obj_cmd_rq) == 1);
 
-  if (ctx->flags & IPMI_FLAGS_NO_LEGAL_CHECK)
-    intf_flags |= IPMI_INTERFACE_FLAGS_NO_LEGAL_CHECK;
+  (*obj_rs_errnum) = IPMI_ERR_SUCCESS;
 
-  if (!ctx->io.outofband.last_received.tv_sec
-      && !ctx->io.outofband.last_received.tv_usec)
+  if (!(obj_ipmb_msg_hdr_rq = fiid_obj_create_in (ctx->arena, tmpl_ipmb_msg_hdr_rq)))
     {
-      if (gettimeofday (&ctx->io.outofband.last_received, NULL) < 0)
-        {
-          API_ERRNO_TO_API_ERRNUM (ctx, errno);
-          return (-1);
-        }
+      API_ERRNO_TO_API_ERRNUM (ctx, errno);
+      goto cleanup;
     }
-
-  if (ctx->flags & IPMI_FLAGS_DEBUG_DUMP)
+  if (!(obj_ipmb_msg_rq = fiid_obj_create_in (ctx->arena, tmpl_ipmb_msg)))
     {
-      /* ignore error, continue on */
-      if (FIID_OBJ_GET (obj_cmd_rq,
-                        "cmd",
-                        &val) < 0)
-        API_FIID_OBJECT_ERROR_TO_API_ERRNUM (ctx, obj_cmd_rq);
-      else
-        cmd = val;
+      API_ERRNO_TO_API_ERRNUM (ctx, errno);
+      goto cleanup;
+    }
+  if (!(obj_send_cmd_rs = fiid_obj_create_in (ctx->arena, tmpl_cmd_send_message_rs)))
+    {
+      API_ERRNO_TO_API_ERRNUM (ctx, errno);
+      goto cleanup;
+    }
 
-      if (IPMI_NET_FN_GROUP_EXTENSION (net_fn))
-        {
-          /* ignore error, continue on */
-          if (FIID_OBJ_GET (obj_cmd_rq,
-                            "group_extension_identification",
-                            &val) < 0)
-            API_FIID_OBJECT_ERROR_TO_API_ERRNUM (ctx, obj_cmd_rq);
-          else
-            group_extension = val;
-        }
+  if (fill_ipmb_msg_hdr (ctx->target.rs_addr,
+                         ctx->target.net_fn,
+                         ctx->target.lun,
+                         IPMI_SLAVE_ADDRESS_BMC,
+                         IPMI_BMC_IPMB_LUN_BMC,
+                         ctx->io.outofband.rq_seq,
+                         obj_ipmb_msg_hdr_rq) < 0)
+    {
+      API_ERRNO_TO_API_ERRNUM (ctx, errno);
+      goto cleanup;
     }
 
-  if (_api_lan_cmd_send (ctx,
-                         lun,
-                         net_fn,
-                         authentication_type,
-                         (session_sequence_number) ? *session_sequence_number : 0,
-                         session_id,
-                         (rq_seq) ? *rq_seq : 0,
-                         password,
-                         password_len,
-                         cmd,  /* for debug dumping */
-                         group_extension,  /* for debug dumping */
-                         obj_cmd_rq) < 0)
-    goto cleanup;
+  if (assemble_ipmi_ipmb_msg (obj_ipmb_msg_hdr_rq,
+                              obj_cmd_rq,
+                              obj_ipmb_msg_rq,
+                              IPMI_INTERFACE_FLAGS_DEFAULT) < 0)
+    {
+      API_ERRNO_TO_API_ERRNUM (ctx, errno);
+      goto cleanup;
+    }
 
-  while (1)
+  if ((len = fiid_obj_get_all (obj_ipmb_msg_rq,
+                               tbuf,
+                               IPMI_MAX_PKT_LEN)) < 0)
     {
-      if ((ret = _session_timed_out (ctx)) < 0)
-        break;
+      API_FIID_OBJECT_ERROR_TO_API_ERRNUM (ctx, obj_ipmb_msg_rq);
+      goto cleanup;
+    }
 
-      if (ret)
-        {
-          if (ctx->flags & IPMI_FLAGS_NOSESSION)
-            API_SET_ERRNUM (ctx, IPMI_ERR_MESSAGE_TIMEOUT);
-          else
-            API_SET_ERRNUM (ctx, IPMI_ERR_SESSION_TIMEOUT);
-          break;
-        }
+  /* send_message will send to the BMC, so clear out target information */
+  memcpy (&target_save, &ctx->target, sizeof (target_save));
+  ctx->target.channel_number_is_set = 0;
+  ctx->target.rs_addr_is_set = 0;
 
-      if ((recv_len = _api_lan_cmd_recv (ctx,
-                                         pkt,
-                                         IPMI_MAX_PKT_LEN,
-                                         retransmission_count)) < 0)
-        break;
+  ret = ipmi_cmd_send_message (ctx,
+                               target_save.channel_number,
+                               IPMI_SEND_MESSAGE_AUTHENTICATION_NOT_REQUIRED,
+                               IPMI_SEND_MESSAGE_ENCRYPTION_NOT_REQUIRED,
+                               IPMI_SEND_MESSAGE_TRACKING_OPERATION_TRACKING_REQUEST,
+                               tbuf,
+                               len,
+                               obj_send_cmd_rs);
 
-      if (!recv_len)
+  /* restore target info */
+  memcpy (&ctx->target, &target_save, sizeof (target_save));
+
+  if (ret < 0)
+    {
+      uint64_t cmd;
+
+      /* Check for potential out of order condition.  See
+       * _ipmi_check_ipmb_out_of_order() for more details.
+       *
+       * Basically, we will return success if the completion code is
+       * one in which we would expect another message to arrive.
+       */
+      if (FIID_OBJ_GET (obj_send_cmd_rs, "cmd", &cmd) == 1)
         {
-          /* ignore timeout, just cleanly close session */
-          if (internal_workaround_flags & IPMI_INTERNAL_WORKAROUND_FLAGS_CLOSE_SESSION_SKIP_RETRANSMIT)
+          if (cmd != IPMI_CMD_SEND_MESSAGE
+              && ipmi_check_completion_code (obj_send_cmd_rs,
+                                             IPMI_COMP_CODE_COMMAND_SUCCESS) == 0)
             {
-              rv = 0;
-              break;
+              TRACE_MSG_OUT ("accept out-of-order with bad completion code", 0);
+              (*obj_rs_errnum) = ctx->errnum;
+              ctx->errnum = IPMI_ERR_SUCCESS;
+              goto out_of_order_workaround;
             }
+        }
 
-          if (session_sequence_number)
-            (*session_sequence_number)++;
-          if (rq_seq)
-            *rq_seq = ((*rq_seq) + 1) % (IPMI_LAN_REQUESTER_SEQUENCE_NUMBER_MAX + 1);
-
-          retransmission_count++;
-
-          /* IPMI Workaround (achu)
-           *
-           * Discovered on Intel Tiger4 (SR870BN4)
-           *
-           * If the reply from a previous Get Session Challenge request is
-           * lost on the network, the following retransmission will make
-           * the BMC confused and it will not respond to future packets.
-           *
-           * The problem seems to exist only when the retransmitted packet
-           * is transmitted from the same source port.  Therefore, the fix
-           * is to send the retransmission from a different source port.
-           * So we'll create a new socket, re-bind to an ephemereal port
-           * (guaranteeing us a brand new port), and store this new
-           * socket.
-           *
-           * In the event we need to resend this packet multiple times, we
-           * do not want the chance that old ports will be used again.  We
-           * store the old file descriptrs (which are bound to the old
-           * ports) on a list, and close all of them after we have gotten
-           * past the Get Session Challenge phase of the protocol.
-           */
-          if (internal_workaround_flags & IPMI_INTERNAL_WORKAROUND_FLAGS_GET_SESSION_CHALLENGE)
-            {
-              struct socket_to_close *s;
-
-              if (!(s = (struct socket_to_close *)malloc (sizeof (struct socket_to_close))))
-                {
-                  API_SET_ERRNUM (ctx, IPMI_ERR_OUT_OF_MEMORY);
-                  goto cleanup;
-                }
-              s->fd = ctx->io.outofband.sockfd;
-              s->next = sockets;
-              sockets = s;
-
-              if ((ctx->io.outofband.sockfd = socket (ctx->io.outofband.srcaddr->sa_family,
-                                                      SOCK_DGRAM,
-                                                      0)) < 0)
-                {
-                  API_ERRNO_TO_API_ERRNUM (ctx, errno);
-                  goto cleanup;
-                }
-
-              if (bind (ctx->io.outofband.sockfd,
-                        ctx->io.outofband.srcaddr,
-                        ctx->io.outofband.srcaddr_len) < 0)
-                {
-                  API_ERRNO_TO_API_ERRNUM (ctx, errno);
-                  goto cleanup;
-                }
-            }
-
-          if (_api_lan_cmd_send (ctx,
-                                 lun,
-                                 net_fn,
-                                 authentication_type,
-                                 (session_sequence_number) ? *session_sequence_number : 0,
-                                 session_id,
-                                 (rq_seq) ? *rq_seq : 0,
-                                 password,
-                                 password_len,
-                                 cmd,  /* for debug dumping */
-                                 group_extension,  /* for debug dumping */
-                                 obj_cmd_rq) < 0)
-            goto cleanup;
-
-          continue;
-        }
-
-      /* else received a packet */
-
-      /* its ok to use the "request" net_fn, dump code doesn't care */
-      if (ctx->flags & IPMI_FLAGS_DEBUG_DUMP)
-        _api_lan_dump_rs (ctx,
-                          pkt,
-                          recv_len,
-                          cmd,
-                          net_fn,
-                          group_extension,
-                          obj_cmd_rs);
-
-      if ((ret = unassemble_ipmi_lan_pkt (pkt,
-                                          recv_len,
-                                          ctx->io.outofband.rs.obj_rmcp_hdr,
-                                          ctx->io.outofband.rs.obj_lan_session_hdr,
-                                          ctx->io.outofband.rs.obj_lan_msg_hdr,
-                                          obj_cmd_rs,
-                                          ctx->io.outofband.rs.obj_lan_msg_trlr,
-                                          intf_flags)) < 0)
-        {
-          API_ERRNO_TO_API_ERRNUM (ctx, errno);
-          return (-1);
-        }
-
-      if (!ret)
-        continue;
-
-      if ((ret = _api_lan_cmd_wrapper_verify_packet (ctx,
-                                                     internal_workaround_flags,
-                                                     authentication_type,
-                                                     check_authentication_code,
-                                                     session_sequence_number,
-                                                     session_id,
-                                                     rq_seq,
-                                                     password,
-                                                     password_len,
-                                                     obj_cmd_rs)) < 0)
-        goto cleanup;
-
-      if (!ret)
-        continue;
-
-      if (gettimeofday (&(ctx->io.outofband.last_received), NULL) < 0)
-        {
-          API_ERRNO_TO_API_ERRNUM (ctx, errno);
-          return (-1);
-        }
-
-      rv = 0;
-      break;
-    }
-
- cleanup:
-  if (session_sequence_number)
-    (*session_sequence_number)++;
-  if (rq_seq)
-    *rq_seq = ((*rq_seq) + 1) % (IPMI_LAN_REQUESTER_SEQUENCE_NUMBER_MAX + 1);
-  while (sockets)
-    {
-      /* ignore potential error, cleanup path */
-      close (sockets->fd);
-      sockets = sockets->next;
-    }
-  return (rv);
-}
-
-/* see workaround _ipmi_check_ipmb_out_of_order() regarding obj_rs & obj_rs_errnum pointer */
-static int
-_ipmi_cmd_send_ipmb (ipmi_ctx_t ctx,
-                     fiid_obj_t obj_cmd_rq,
-                     fiid_obj_t *obj_rs,
-                     ipmi_errnum_type_t *obj_rs_errnum)
-{
-  struct ipmi_ctx_target target_save;
-  uint8_t tbuf[IPMI_MAX_PKT_LEN];
-  fiid_obj_t obj_ipmb_msg_hdr_rq = NULL;
-  fiid_obj_t obj_ipmb_msg_rq = NULL;
-  fiid_obj_t obj_send_cmd_rs = NULL;
-  int len, ret, rv = -1;
-
-  assert (ctx
-          && ctx->magic == IPMI_CTX_MAGIC
-          && (ctx->type == IPMI_DEVICE_LAN
-              || ctx->type == IPMI_DEVICE_LAN_2_0)
-          && ctx->io.outofband.sockfd
-          && fiid_obj_valid (obj_cmd_rq)
-          && fiid_obj_packet_valid (obj_cmd_rq) == 1);
-
-  (*obj_rs_errnum) = IPMI_ERR_SUCCESS;
-
-  if (!(obj_ipmb_msg_hdr_rq = fiid_obj_create (tmpl_ipmb_msg_hdr_rq)))
-    {
-      API_ERRNO_TO_API_ERRNUM (ctx, errno);
-      goto cleanup;
-    }
-  if (!(obj_ipmb_msg_rq = fiid_obj_create (tmpl_ipmb_msg)))
-    {
-      API_ERRNO_TO_API_ERRNUM (ctx, errno);
-      goto cleanup;
-    }
-  if (!(obj_send_cmd_rs = fiid_obj_create (tmpl_cmd_send_message_rs)))
-    {
-      API_ERRNO_TO_API_ERRNUM (ctx, errno);
-      goto cleanup;
-    }
-
-  if (fill_ipmb_msg_hdr (ctx->target.rs_addr,
-                         ctx->target.net_fn,
-                         ctx->target.lun,
-                         IPMI_SLAVE_ADDRESS_BMC,
-                         IPMI_BMC_IPMB_LUN_BMC,
-                         ctx->io.outofband.rq_seq,
-                         obj_ipmb_msg_hdr_rq) < 0)
-    {
-      API_ERRNO_TO_API_ERRNUM (ctx, errno);
-      goto cleanup;
-    }
-
-  if (assemble_ipmi_ipmb_msg (obj_ipmb_msg_hdr_rq,
-                              obj_cmd_rq,
-                              obj_ipmb_msg_rq,
-                              IPMI_INTERFACE_FLAGS_DEFAULT) < 0)
-    {
-      API_ERRNO_TO_API_ERRNUM (ctx, errno);
-      goto cleanup;
-    }
-
-  if ((len = fiid_obj_get_all (obj_ipmb_msg_rq,
-                               tbuf,
-                               IPMI_MAX_PKT_LEN)) < 0)
-    {
-      API_FIID_OBJECT_ERROR_TO_API_ERRNUM (ctx, obj_ipmb_msg_rq);
-      goto cleanup;
-    }
-
-  /* send_message will send to the BMC, so clear out target information */
-  memcpy (&target_save, &ctx->target, sizeof (target_save));
-  ctx->target.channel_number_is_set = 0;
-  ctx->target.rs_addr_is_set = 0;
-
-  ret = ipmi_cmd_send_message (ctx,
-                               target_save.channel_number,
-                               IPMI_SEND_MESSAGE_AUTHENTICATION_NOT_REQUIRED,
-                               IPMI_SEND_MESSAGE_ENCRYPTION_NOT_REQUIRED,
-                               IPMI_SEND_MESSAGE_TRACKING_OPERATION_TRACKING_REQUEST,
-                               tbuf,
-                               len,
-                               obj_send_cmd_rs);
-
-  /* restore target info */
-  memcpy (&ctx->target, &target_save, sizeof (target_save));
-
-  if (ret < 0)
-    {
-      uint64_t cmd;
-
-      /* Check for potential out of order condition.  See
-       * _ipmi_check_ipmb_out_of_order() for more details.
-       *
-       * Basically, we will return success if the completion code is
-       * one in which we would expect another message to arrive.
-       */
-      if (FIID_OBJ_GET (obj_send_cmd_rs, "cmd", &cmd) == 1)
-        {
-          if (cmd != IPMI_CMD_SEND_MESSAGE
-              && ipmi_check_completion_code (obj_send_cmd_rs,
-                                             IPMI_COMP_CODE_COMMAND_SUCCESS) == 0)
-            {
-              TRACE_MSG_OUT ("accept out-of-order with bad completion code", 0);
-              (*obj_rs_errnum) = ctx->errnum;
-              ctx->errnum = IPMI_ERR_SUCCESS;
-              goto out_of_order_workaround;
-            }
-        }
-
-      goto cleanup;
-    }
+      goto cleanup;
+    }
 
  out_of_order_workaround:
   /* "pretend" a request was just sent */
@@ -1443,6 +1365,9 @@ api_lan_cmd_wrapper_ipmb (ipmi_ctx_t ctx,
         {
           retransmission_count++;
 
+          if (ctx->stats_cmd)
+            ctx->stats_cmd->retransmissions++;
+
           /* don't increment sequence numbers, will be done in _ipmi_cmd_send_ipmb */
 
           /* ipmb response packet will use the request sequence number from
@@ -1561,1837 +1486,3646 @@ _api_lan_rq_seq_init (ipmi_ctx_t ctx)
 }
 
 int
-api_lan_open_session (ipmi_ctx_t ctx)
+api_lan_close_session (ipmi_ctx_t ctx)
 {
   fiid_obj_t obj_cmd_rq = NULL;
   fiid_obj_t obj_cmd_rs = NULL;
   uint8_t authentication_type;
-  uint32_t temp_session_id = 0;
-  uint8_t challenge_string[IPMI_CHALLENGE_STRING_LENGTH];
-  int challenge_string_len;
-  uint32_t initial_outbound_sequence_number = 0;
-  char *tmp_username_ptr = NULL;
-  char *tmp_password_ptr = NULL;
+  unsigned int internal_workaround_flags = 0;
   int ret, rv = -1;
-  uint64_t val;
+
+  /* Do not use ipmi_cmd_close_session(), we use a close session retransmit workaround */
 
   assert (ctx
           && ctx->magic == IPMI_CTX_MAGIC
-          && ctx->io.outofband.sockfd
           && ctx->type == IPMI_DEVICE_LAN
-          && strlen (ctx->io.outofband.username) <= IPMI_MAX_USER_NAME_LENGTH
-          && strlen (ctx->io.outofband.password) <= IPMI_1_5_MAX_PASSWORD_LENGTH
-          && IPMI_1_5_AUTHENTICATION_TYPE_VALID (ctx->io.outofband.authentication_type)
-          && IPMI_PRIVILEGE_LEVEL_VALID (ctx->io.outofband.privilege_level));
-
-  if (_api_lan_rq_seq_init (ctx) < 0)
-    goto cleanup;
-
-  if (ctx->flags & IPMI_FLAGS_NOSESSION)
-    {
-      ctx->io.outofband.authentication_type = IPMI_AUTHENTICATION_TYPE_NONE;
-      goto out;
-    }
+          && ctx->io.outofband.sockfd);
 
-  if (!(obj_cmd_rq = fiid_obj_create (tmpl_cmd_get_channel_authentication_capabilities_rq)))
+  if (!(obj_cmd_rq = fiid_obj_create (tmpl_cmd_close_session_rq)))
     {
       API_ERRNO_TO_API_ERRNUM (ctx, errno);
-      goto cleanup;
+      return (-1);
     }
-  if (!(obj_cmd_rs = fiid_obj_create (tmpl_cmd_get_channel_authentication_capabilities_rs)))
+
+  if (!(obj_cmd_rs = fiid_obj_create (tmpl_cmd_close_session_rs)))
     {
       API_ERRNO_TO_API_ERRNUM (ctx, errno);
-      goto cleanup;
+      return (-1);
     }
 
-  if (fill_cmd_get_channel_authentication_capabilities (IPMI_CHANNEL_NUMBER_CURRENT_CHANNEL,
-                                                        ctx->io.outofband.privilege_level,
-                                                        IPMI_GET_IPMI_V15_DATA,
-                                                        obj_cmd_rq) < 0)
+  if (fill_cmd_close_session (ctx->io.outofband.session_id,
+                              NULL,
+                              obj_cmd_rq) < 0)
     {
       API_ERRNO_TO_API_ERRNUM (ctx, errno);
       goto cleanup;
     }
 
+  api_lan_cmd_get_session_parameters (ctx,
+                                      &authentication_type,
+                                      &internal_workaround_flags);
+
+  internal_workaround_flags |= IPMI_INTERNAL_WORKAROUND_FLAGS_CLOSE_SESSION_SKIP_RETRANSMIT;
   if (api_lan_cmd_wrapper (ctx,
-                           0,
+                           internal_workaround_flags,
                            IPMI_BMC_IPMB_LUN_BMC,
                            IPMI_NET_FN_APP_RQ,
-                           IPMI_AUTHENTICATION_TYPE_NONE,
-                           0,
-                           NULL,
-                           0,
+                           authentication_type,
+                           1,
+                           &(ctx->io.outofband.session_sequence_number),
+                           ctx->io.outofband.session_id,
                            &(ctx->io.outofband.rq_seq),
-                           NULL,
-                           0,
+                           ctx->io.outofband.password,
+                           IPMI_1_5_MAX_PASSWORD_LENGTH,
                            obj_cmd_rq,
                            obj_cmd_rs) < 0)
+    goto cleanup;
+
+  /* Check completion code just for tracing, but don't return error */
+
+  if ((ret = ipmi_check_completion_code_success (obj_cmd_rs)) < 0)
     {
-      /* at this point in the protocol, we set a connection timeout */
-      if (ctx->errnum == IPMI_ERR_SESSION_TIMEOUT)
-        API_SET_ERRNUM (ctx, IPMI_ERR_CONNECTION_TIMEOUT);
-      goto cleanup;
+      API_ERRNO_TO_API_ERRNUM (ctx, errno);
+      goto out;
     }
 
-  /* IPMI Workaround (achu)
-   *
-   * Discovered on an ASUS P5M2 motherboard.
-   *
-   * Also seen on Intel X38ML motherboard.
-   *
-   * The ASUS motherboard reports incorrect settings of anonymous
-   * vs. null vs non-null username capabilities.  The workaround is to
-   * skip these checks.
-   */
-  if (!(ctx->workaround_flags_outofband & IPMI_WORKAROUND_FLAGS_OUTOFBAND_AUTHENTICATION_CAPABILITIES))
+  if (!ret)
     {
-      if (strlen (ctx->io.outofband.username))
-        tmp_username_ptr = ctx->io.outofband.username;
-
-      if (strlen (ctx->io.outofband.password))
-        tmp_password_ptr = ctx->io.outofband.password;
+      API_BAD_RESPONSE_TO_API_ERRNUM (ctx, obj_cmd_rs);
+      goto out;
+    }
 
-      if ((ret = ipmi_check_authentication_capabilities_username (tmp_username_ptr,
-                                                                  tmp_password_ptr,
-                                                                  obj_cmd_rs)) < 0)
+ out:
+  rv = 0;
+ cleanup:
+  fiid_obj_destroy (obj_cmd_rq);
+  fiid_obj_destroy (obj_cmd_rs);
+  return (rv);
+}
+
+static void
+_api_lan_2_0_dump_rq (ipmi_ctx_t ctx,
+                      uint8_t authentication_algorithm,
+                      uint8_t integrity_algorithm,
+                      uint8_t confidentiality_algorithm,
+                      const void *integrity_key,
+                      unsigned int integrity_key_len,
+                      const void *confidentiality_key,
+                      unsigned int confidentiality_key_len,
+                      const void *pkt,
+                      unsigned int pkt_len,
+                      uint8_t cmd,
+                      uint8_t net_fn,
+                      uint8_t group_extension,
+                      fiid_obj_t obj_cmd_rq)
+{
+  fiid_field_t *tmpl_cmd = NULL;
+
+  assert (ctx
+          && ctx->magic == IPMI_CTX_MAGIC
+          && (ctx->flags & IPMI_FLAGS_DEBUG_DUMP)
+          && IPMI_AUTHENTICATION_ALGORITHM_SUPPORTED (authentication_algorithm)
+          && IPMI_INTEGRITY_ALGORITHM_SUPPORTED (integrity_algorithm)
+          && IPMI_CONFIDENTIALITY_ALGORITHM_SUPPORTED (confidentiality_algorithm)
+          && pkt
+          && pkt_len
+          && fiid_obj_valid (obj_cmd_rq));
+
+  /* Don't cleanup/return an error here.  It's just debug code. */
+
+  if ((tmpl_cmd = fiid_obj_template (obj_cmd_rq)))
+    {
+      char hdrbuf[DEBUG_UTIL_HDR_BUFLEN + 1];
+      const char *cmd_str = NULL;
+
+      /* Handle a few IPMI 2.0 special cases */
+      if (fiid_template_compare (tmpl_cmd, tmpl_rmcpplus_open_session_request) == 1)
+        cmd_str = DEBUG_UTIL_OPEN_SESSION_STR;
+      else if (fiid_template_compare (tmpl_cmd, tmpl_rmcpplus_rakp_message_1) == 1)
+        cmd_str = DEBUG_UTIL_RAKP_1_STR;
+      else if (fiid_template_compare (tmpl_cmd, tmpl_rmcpplus_rakp_message_3) == 1)
+        cmd_str = DEBUG_UTIL_RAKP_3_STR;
+
+      memset (hdrbuf, '\0', DEBUG_UTIL_HDR_BUFLEN + 1);
+
+      if (cmd_str)
+        debug_hdr_str (DEBUG_UTIL_TYPE_IPMI_2_0,
+                       DEBUG_UTIL_DIRECTION_REQUEST,
+                       DEBUG_UTIL_FLAGS_DEFAULT,
+                       cmd_str,
+                       hdrbuf,
+                       DEBUG_UTIL_HDR_BUFLEN);
+      else
+        debug_hdr_cmd (DEBUG_UTIL_TYPE_IPMI_2_0,
+                       DEBUG_UTIL_DIRECTION_REQUEST,
+                       net_fn,
+                       cmd,
+                       group_extension,
+                       hdrbuf,
+                       DEBUG_UTIL_HDR_BUFLEN);
+
+      if (ctx->tmpl_ipmb_cmd_rq)
+        ipmi_dump_rmcpplus_packet_ipmb (STDERR_FILENO,
+                                        ctx->io.outofband.hostname,
+                                        hdrbuf,
+                                        NULL,
+                                        authentication_algorithm,
+                                        integrity_algorithm,
+                                        confidentiality_algorithm,
+                                        integrity_key,
+                                        integrity_key_len,
+                                        confidentiality_key,
+                                        confidentiality_key_len,
+                                        pkt,
+                                        pkt_len,
+                                        tmpl_lan_msg_hdr_rs,
+                                        tmpl_cmd,
+                                        tmpl_ipmb_msg_hdr_rq,
+                                        ctx->tmpl_ipmb_cmd_rq);
+      else
+        ipmi_dump_rmcpplus_packet (STDERR_FILENO,
+                                   ctx->io.outofband.hostname,
+                                   hdrbuf,
+                                   NULL,
+                                   authentication_algorithm,
+                                   integrity_algorithm,
+                                   confidentiality_algorithm,
+                                   integrity_key,
+                                   integrity_key_len,
+                                   confidentiality_key,
+                                   confidentiality_key_len,
+                                   pkt,
+                                   pkt_len,
+                                   tmpl_lan_msg_hdr_rq,
+                                   tmpl_cmd);
+
+      fiid_template_free (tmpl_cmd);
+    }
+}
+
+static void
+_api_lan_2_0_dump_rs (ipmi_ctx_t ctx,
+                      uint8_t authentication_algorithm,
+                      uint8_t integrity_algorithm,
+                      uint8_t confidentiality_algorithm,
+                      const void *integrity_key,
+                      unsigned int integrity_key_len,
+                      const void *confidentiality_key,
+                      unsigned int confidentiality_key_len,
+                      const void *pkt,
+                      unsigned int pkt_len,
+                      uint8_t cmd,
+                      uint8_t net_fn,
+                      uint8_t group_extension,
+                      fiid_obj_t obj_cmd_rs)
+{
+  fiid_field_t *tmpl_cmd = NULL;
+
+  assert (ctx
+          && ctx->magic == IPMI_CTX_MAGIC
+          && (ctx->flags & IPMI_FLAGS_DEBUG_DUMP)
+          && IPMI_AUTHENTICATION_ALGORITHM_SUPPORTED (authentication_algorithm)
+          && IPMI_INTEGRITY_ALGORITHM_SUPPORTED (integrity_algorithm)
+          && IPMI_CONFIDENTIALITY_ALGORITHM_SUPPORTED (confidentiality_algorithm)
+          && pkt
+          && pkt_len
+          && fiid_obj_valid (obj_cmd_rs));
+
+  /* Don't cleanup/return an error here.  It's just debug code. */
+
+  if ((tmpl_cmd = fiid_obj_template (obj_cmd_rs)))
+    {
+      char hdrbuf[DEBUG_UTIL_HDR_BUFLEN + 1];
+      const char *cmd_str = NULL;
+
+      /* Handle a few IPMI 2.0 special cases */
+      if (fiid_template_compare (tmpl_cmd, tmpl_rmcpplus_open_session_response) == 1)
+        cmd_str = DEBUG_UTIL_OPEN_SESSION_STR;
+      else if (fiid_template_compare (tmpl_cmd, tmpl_rmcpplus_rakp_message_2) == 1)
+        cmd_str = DEBUG_UTIL_RAKP_2_STR;
+      else if (fiid_template_compare (tmpl_cmd, tmpl_rmcpplus_rakp_message_4) == 1)
+        cmd_str = DEBUG_UTIL_RAKP_4_STR;
+
+      memset (hdrbuf, '\0', DEBUG_UTIL_HDR_BUFLEN + 1);
+
+      if (cmd_str)
+        debug_hdr_str (DEBUG_UTIL_TYPE_IPMI_2_0,
+                       DEBUG_UTIL_DIRECTION_RESPONSE,
+                       DEBUG_UTIL_FLAGS_DEFAULT,
+                       cmd_str,
+                       hdrbuf,
+                       DEBUG_UTIL_HDR_BUFLEN);
+      else
+        debug_hdr_cmd (DEBUG_UTIL_TYPE_IPMI_2_0,
+                       DEBUG_UTIL_DIRECTION_RESPONSE,
+                       net_fn,
+                       cmd,
+                       group_extension,
+                       hdrbuf,
+                       DEBUG_UTIL_HDR_BUFLEN);
+
+      ipmi_dump_rmcpplus_packet (STDERR_FILENO,
+                                 ctx->io.outofband.hostname,
+                                 hdrbuf,
+                                 NULL,
+                                 authentication_algorithm,
+                                 integrity_algorithm,
+                                 confidentiality_algorithm,
+                                 integrity_key,
+                                 integrity_key_len,
+                                 confidentiality_key,
+                                 confidentiality_key_len,
+                                 pkt,
+                                 pkt_len,
+                                 tmpl_lan_msg_hdr_rs,
+                                 tmpl_cmd);
+
+      fiid_template_free (tmpl_cmd);
+    }
+}
+
+static int
+_api_lan_2_0_cmd_send (ipmi_ctx_t ctx,
+                       uint8_t lun,
+                       uint8_t net_fn,
+                       uint8_t payload_type,
+                       uint8_t payload_authenticated,
+                       uint8_t payload_encrypted,
+                       uint32_t session_sequence_number,
+                       uint32_t session_id,
+                       uint8_t rq_seq,
+                       uint8_t authentication_algorithm,
+                       uint8_t integrity_algorithm,
+                       uint8_t confidentiality_algorithm,
+                       const void *integrity_key,
+                       unsigned int integrity_key_len,
+                       const void *confidentiality_key,
+                       unsigned int confidentiality_key_len,
+                       const char *password,
+                       unsigned int password_len,
+                       uint8_t cmd, /* for debug dumping */
+                       uint8_t group_extension, /* for debug dumping */
+                       fiid_obj_t obj_cmd_rq)
+{
+  uint8_t *pkt = NULL;
+  unsigned int pkt_len = 0;
+  int cmd_len = 0;
+  int send_len = 0;
+  int ret, rv = -1;
+
+  assert (ctx
+          && ctx->magic == IPMI_CTX_MAGIC
+          && ctx->io.outofband.sockfd
+          && IPMI_BMC_LUN_VALID (lun)
+          && IPMI_NET_FN_VALID (net_fn)
+          && (payload_type == IPMI_PAYLOAD_TYPE_IPMI
+              || payload_type == IPMI_PAYLOAD_TYPE_RMCPPLUS_OPEN_SESSION_REQUEST
+              || payload_type == IPMI_PAYLOAD_TYPE_RAKP_MESSAGE_1
+              || payload_type == IPMI_PAYLOAD_TYPE_RAKP_MESSAGE_3)
+          && IPMI_PAYLOAD_AUTHENTICATED_FLAG_VALID (payload_authenticated)
+          && IPMI_PAYLOAD_ENCRYPTED_FLAG_VALID (payload_encrypted)
+          && IPMI_AUTHENTICATION_ALGORITHM_SUPPORTED (authentication_algorithm)
+          && IPMI_INTEGRITY_ALGORITHM_SUPPORTED (integrity_algorithm)
+          && IPMI_CONFIDENTIALITY_ALGORITHM_SUPPORTED (confidentiality_algorithm)
+          && !(password && password_len > IPMI_2_0_MAX_PASSWORD_LENGTH)
+          && fiid_obj_valid (obj_cmd_rq)
+          && fiid_obj_packet_valid (obj_cmd_rq) == 1);
+
+  if ((cmd_len = fiid_obj_len_bytes (obj_cmd_rq)) < 0)
+    {
+      API_FIID_OBJECT_ERROR_TO_API_ERRNUM (ctx, obj_cmd_rq);
+      goto cleanup;
+    }
+
+  /* variable based on authentication, etc. 1024 extra is enough */
+  pkt_len = cmd_len + IPMI_PKT_PAD;
+
+  if (!(pkt = api_pkt_buf (ctx, pkt_len)))
+    {
+      API_ERRNO_TO_API_ERRNUM (ctx, errno);
+      goto cleanup;
+    }
+
+  if (fill_rmcp_hdr_ipmi (ctx->io.outofband.rq.obj_rmcp_hdr) < 0)
+    {
+      API_ERRNO_TO_API_ERRNUM (ctx, errno);
+      goto cleanup;
+    }
+
+  if (fill_rmcpplus_session_hdr (payload_type,
+                                 payload_authenticated,
+                                 payload_encrypted,
+                                 0, /* oem_iana */
+                                 0, /* oem_payload_id */
+                                 session_id,
+                                 session_sequence_number,
+                                 ctx->io.outofband.rq.obj_rmcpplus_session_hdr) < 0)
+    {
+      API_ERRNO_TO_API_ERRNUM (ctx, errno);
+      goto cleanup;
+    }
+
+  if (fill_lan_msg_hdr (IPMI_SLAVE_ADDRESS_BMC,
+                        net_fn,
+                        lun,
+                        rq_seq,
+                        ctx->io.outofband.rq.obj_lan_msg_hdr) < 0)
+    {
+      API_ERRNO_TO_API_ERRNUM (ctx, errno);
+      goto cleanup;
+    }
+
+  if (fill_rmcpplus_session_trlr (ctx->io.outofband.rq.obj_rmcpplus_session_trlr) < 0)
+    {
+      API_ERRNO_TO_API_ERRNUM (ctx, errno);
+      goto cleanup;
+    }
+
+  if ((send_len = assemble_ipmi_rmcpplus_pkt (authentication_algorithm,
+                                              integrity_algorithm,
+                                              confidentiality_algorithm,
+                                              integrity_key,
+                                              integrity_key_len,
+                                              confidentiality_key,
+                                              confidentiality_key_len,
+                                              password,
+                                              password_len,
+                                              ctx->io.outofband.rq.obj_rmcp_hdr,
+                                              ctx->io.outofband.rq.obj_rmcpplus_session_hdr,
+                                              ctx->io.outofband.rq.obj_lan_msg_hdr,
+                                              obj_cmd_rq,
+                                              ctx->io.outofband.rq.obj_rmcpplus_session_trlr,
+                                              pkt,
+                                              pkt_len,
+                                              IPMI_INTERFACE_FLAGS_DEFAULT)) < 0)
+    {
+      API_ERRNO_TO_API_ERRNUM (ctx, errno);
+      goto cleanup;
+    }
+
+  if (ctx->flags & IPMI_FLAGS_DEBUG_DUMP && send_len)
+    _api_lan_2_0_dump_rq (ctx,
+                          authentication_algorithm,
+                          integrity_algorithm,
+                          confidentiality_algorithm,
+                          integrity_key,
+                          integrity_key_len,
+                          confidentiality_key,
+                          confidentiality_key_len,
+                          pkt,
+                          send_len,
+                          cmd,
+                          net_fn,
+                          group_extension,
+                          obj_cmd_rq);
+
+  api_pkt_trace (ctx, API_PKT_TRACE_REQUEST, pkt, send_len);
+
+  do
+    {
+      ret = ipmi_rmcpplus_sendto (ctx->io.outofband.sockfd,
+                                  pkt,
+                                  send_len,
+                                  0,
+                                  ctx->io.outofband.remote_host,
+                                  ctx->io.outofband.remote_host_len);
+    } while (ret < 0 && errno == EINTR);
+
+  if (ret < 0)
+    {
+      API_ERRNO_TO_API_ERRNUM (ctx, errno);
+      goto cleanup;
+    }
+
+  if (gettimeofday (&ctx->io.outofband.last_send, NULL) < 0)
+    {
+      API_ERRNO_TO_API_ERRNUM (ctx, errno);
+      goto cleanup;
+    }
+
+  rv = 0;
+ cleanup:
+  return (rv);
+}
+
+/* return receive length on success, 0 on no packet, -1 on error */
+static int
+_api_lan_2_0_cmd_recv (ipmi_ctx_t ctx,
+                       uint8_t authentication_algorithm,
+                       uint8_t integrity_algorithm,
+                       uint8_t confidentiality_algorithm,
+                       const void *integrity_key,
+                       unsigned int integrity_key_len,
+                       const void *confidentiality_key,
+                       unsigned int confidentiality_key_len,
+                       void *pkt,
+                       unsigned int pkt_len,
+                       unsigned int retransmission_count)
+{
+  struct timeval recv_starttime;
+  int recv_len = 0;
+
+  assert (ctx
+          && ctx->magic == IPMI_CTX_MAGIC
+          && ctx->io.outofband.sockfd
+          && IPMI_AUTHENTICATION_ALGORITHM_SUPPORTED (authentication_algorithm)
+          && IPMI_INTEGRITY_ALGORITHM_SUPPORTED (integrity_algorithm)
+          && IPMI_CONFIDENTIALITY_ALGORITHM_SUPPORTED (confidentiality_algorithm)
+          && pkt
+          && pkt_len);
+
+  if (gettimeofday (&recv_starttime, NULL) < 0)
+    {
+      API_ERRNO_TO_API_ERRNUM (ctx, errno);
+      return (-1);
+    }
+
+  recv_len = _api_lan_recvfrom (ctx,
+                                pkt,
+                                pkt_len,
+                                retransmission_count,
+                                &recv_starttime);
+
+  if (!recv_len)
+    return (0); /* resend the request */
+
+  /* achu & hliebig:
+   *
+   * Premise from ipmitool (http://ipmitool.sourceforge.net/)
+   *
+   * On some OSes (it seems Unixes), the behavior is to not return
+   * errors up to the client for UDP responses (i.e. you need to
+   * timeout).  But on some OSes (it seems Windows), the behavior is
+   * to return port denied errors up to the user for UDP responses.
+   *
+   * In addition (according to Ipmitool), a read may return
+   * ECONNREFUSED or ECONNRESET if both the OS and BMC respond to an
+   * IPMI request.
+   *
+   * If the ECONNREFUSED or ECONNRESET is from the OS, but we will get
+   * an IPMI response later, we just do the recvfrom again to get the
+   * packet we expect.
+   *
+   * If the ECONNREFUSED or ECONNRESET is from the OS but there is no
+   * BMC, just do the recvfrom again to give us the eventually
+   * timeout.
+   */
+
+  if (recv_len < 0
+      && (errno == ECONNRESET
+          || errno == ECONNREFUSED))
+    {
+      recv_len = _api_lan_recvfrom (ctx,
+                                    pkt,
+                                    pkt_len,
+                                    retransmission_count,
+                                    &recv_starttime);
+
+      if (!recv_len)
+        return (0); /* resend the request */
+    }
+
+  if (recv_len < 0)
+    {
+      API_ERRNO_TO_API_ERRNUM (ctx, errno);
+      return (-1);
+    }
+
+  api_pkt_trace (ctx, API_PKT_TRACE_RESPONSE, pkt, recv_len);
+  return (recv_len);
+}
+
+/* decode an IPMI payload of the established session in place, into
+ * the outofband rs state
+ *
+ * return 1 on full parse, 0 if the packet should be ignored, -1 on
+ * error
+ */
+static int
+_api_lan_2_0_session_unassemble (ipmi_ctx_t ctx,
+                                 uint8_t integrity_algorithm,
+                                 uint8_t confidentiality_algorithm,
+                                 const void *integrity_key,
+                                 unsigned int integrity_key_len,
+                                 const char *password,
+                                 unsigned int password_len,
+                                 const void *confidentiality_key,
+                                 unsigned int confidentiality_key_len,
+                                 const void *pkt,
+                                 unsigned int pkt_len)
+{
+  const void *lan_msg;
+  int len;
+
+  assert (ctx
+          && ctx->magic == IPMI_CTX_MAGIC
+          && ctx->type == IPMI_DEVICE_LAN_2_0
+          && IPMI_INTEGRITY_ALGORITHM_SUPPORTED (integrity_algorithm)
+          && IPMI_CONFIDENTIALITY_ALGORITHM_SUPPORTED (confidentiality_algorithm)
+          && !(password && password_len > IPMI_2_0_MAX_PASSWORD_LENGTH)
+          && pkt
+          && pkt_len);
+
+  ctx->io.outofband.rs.lan_msg = NULL;
+  ctx->io.outofband.rs.lan_msg_len = 0;
+
+  if ((len = unassemble_ipmi_rmcpplus_session_pkt (integrity_algorithm,
+                                                   confidentiality_algorithm,
+                                                   integrity_key,
+                                                   integrity_key_len,
+                                                   password,
+                                                   password_len,
+                                                   confidentiality_key,
+                                                   confidentiality_key_len,
+                                                   pkt,
+                                                   pkt_len,
+                                                   &(ctx->io.outofband.rs.session_id),
+                                                   &(ctx->io.outofband.rs.session_sequence_number),
+                                                   ctx->io.outofband.rs.lan_msg_buf,
+                                                   IPMI_MAX_PKT_LEN,
+                                                   &lan_msg)) < 0)
+    {
+      API_ERRNO_TO_API_ERRNUM (ctx, errno);
+      return (-1);
+    }
+
+  if (!len)
+    return (0);
+
+  ctx->io.outofband.rs.lan_msg = lan_msg;
+  ctx->io.outofband.rs.lan_msg_len = len;
+  return (1);
+}
+
+/* set the command data of the decoded lan message into obj_cmd_rs
+ *
+ * return 1 on full parse, 0 if the packet should be ignored, -1 on
+ * error
+ */
+static int
+_api_lan_2_0_session_cmd_rs (ipmi_ctx_t ctx, fiid_obj_t obj_cmd_rs)
+{
+  int lan_msg_hdr_len, lan_msg_trlr_len;
+
+  assert (ctx
+          && ctx->magic == IPMI_CTX_MAGIC
+          && ctx->type == IPMI_DEVICE_LAN_2_0
+          && ctx->io.outofband.rs.lan_msg
+          && fiid_obj_valid (obj_cmd_rs));
+
+  if ((lan_msg_hdr_len = fiid_template_len_bytes (tmpl_lan_msg_hdr_rs)) < 0)
+    {
+      API_ERRNO_TO_API_ERRNUM (ctx, errno);
+      return (-1);
+    }
+
+  if ((lan_msg_trlr_len = fiid_template_len_bytes (tmpl_lan_msg_trlr)) < 0)
+    {
+      API_ERRNO_TO_API_ERRNUM (ctx, errno);
+      return (-1);
+    }
+
+  /* checked by unassemble_ipmi_rmcpplus_session_pkt() */
+  assert (ctx->io.outofband.rs.lan_msg_len > (lan_msg_hdr_len + lan_msg_trlr_len));
+
+  if (fiid_obj_clear (obj_cmd_rs) < 0)
+    {
+      API_FIID_OBJECT_ERROR_TO_API_ERRNUM (ctx, obj_cmd_rs);
+      return (-1);
+    }
+
+  if (fiid_obj_set_all (obj_cmd_rs,
+                        ctx->io.outofband.rs.lan_msg + lan_msg_hdr_len,
+                        ctx->io.outofband.rs.lan_msg_len - lan_msg_hdr_len - lan_msg_trlr_len) < 0)
+    {
+      API_FIID_OBJECT_ERROR_TO_API_ERRNUM (ctx, obj_cmd_rs);
+      return (-1);
+    }
+
+  if (!(ctx->flags & IPMI_FLAGS_NO_LEGAL_CHECK)
+      && FIID_OBJ_PACKET_SUFFICIENT (obj_cmd_rs) != 1)
+    return (0);
+
+  return (1);
+}
+
+/* return the requester sequence number of the decoded lan message,
+ * -1 on error
+ */
+static int
+_api_lan_2_0_session_rq_seq (ipmi_ctx_t ctx)
+{
+  int rq_seq_start, rq_seq_len;
+
+  assert (ctx
+          && ctx->magic == IPMI_CTX_MAGIC
+          && ctx->type == IPMI_DEVICE_LAN_2_0
+          && ctx->io.outofband.rs.lan_msg);
+
+  if ((rq_seq_start = fiid_template_field_start (tmpl_lan_msg_hdr_rs, "rq_seq")) < 0)
+    {
+      API_ERRNO_TO_API_ERRNUM (ctx, errno);
+      return (-1);
+    }
+
+  if ((rq_seq_len = fiid_template_field_len (tmpl_lan_msg_hdr_rs, "rq_seq")) < 0)
+    {
+      API_ERRNO_TO_API_ERRNUM (ctx, errno);
+      return (-1);
+    }
+
+  /* rq_seq is the high bits of the last header byte */
+  assert ((rq_seq_start % 8) + rq_seq_len == 8);
+
+  return (ctx->io.outofband.rs.lan_msg[rq_seq_start / 8] >> (rq_seq_start % 8));
+}
+
+/* < 0 - error
+ * == 1 good packet
+ * == 0 bad packet
+ */
+static int
+_api_lan_2_0_cmd_wrapper_verify_packet (ipmi_ctx_t ctx,
+                                        uint8_t payload_type,
+                                        uint8_t *message_tag,
+                                        uint32_t *session_sequence_number,
+                                        uint8_t *rq_seq,
+                                        fiid_obj_t obj_cmd_rs)
+{
+  uint8_t l_payload_type;
+  uint32_t l_session_id;
+  uint8_t l_message_tag;
+  uint8_t rmcpplus_status_code;
+  uint64_t val;
+  int ret, rv = -1;
+
+  assert (ctx
+          && ctx->magic == IPMI_CTX_MAGIC
+          && ctx->type == IPMI_DEVICE_LAN_2_0
+          && ctx->io.outofband.sockfd
+          && (payload_type == IPMI_PAYLOAD_TYPE_IPMI
+              || payload_type == IPMI_PAYLOAD_TYPE_RMCPPLUS_OPEN_SESSION_REQUEST
+              || payload_type == IPMI_PAYLOAD_TYPE_RAKP_MESSAGE_1
+              || payload_type == IPMI_PAYLOAD_TYPE_RAKP_MESSAGE_3)
+          && fiid_obj_valid (obj_cmd_rs));
+
+  /* IPMI payloads are decoded in place by
+   * _api_lan_2_0_session_unassemble(), which already verified the
+   * authentication code.
+   */
+  if (payload_type == IPMI_PAYLOAD_TYPE_IPMI)
+    {
+      assert (ctx->io.outofband.rs.lan_msg);
+
+      if (ctx->io.outofband.rs.session_id != ctx->io.outofband.remote_console_session_id)
+        {
+          rv = 0;
+          goto cleanup;
+        }
+
+      /* IPMI Workaround (achu)
+       *
+       * Discovered on Supermicro X9SCM-iiF, Supermicro X9DRi-F
+       *
+       * Checksums are computed incorrectly.
+       */
+      if (!(ctx->workaround_flags_outofband_2_0 & IPMI_WORKAROUND_FLAGS_OUTOFBAND_2_0_NO_CHECKSUM_CHECK))
+        {
+          if ((ret = ipmi_lan_check_msg_checksum (ctx->io.outofband.rs.lan_msg,
+                                                  ctx->io.outofband.rs.lan_msg_len)) < 0)
+            {
+              API_ERRNO_TO_API_ERRNUM (ctx, errno);
+              goto cleanup;
+            }
+
+          if (!ret)
+            {
+              rv = 0;
+              goto cleanup;
+            }
+        }
+
+      if (session_sequence_number)
+        {
+          if ((ret = _ipmi_check_session_sequence_number (ctx,
+                                                          ctx->io.outofband.rs.session_sequence_number)) < 0)
+            {
+              API_ERRNO_TO_API_ERRNUM (ctx, errno);
+              goto cleanup;
+            }
+
+          if (!ret)
+            {
+              rv = 0;
+              goto cleanup;
+            }
+        }
+
+      if ((ret = _api_lan_2_0_session_rq_seq (ctx)) < 0)
+        goto cleanup;
+
+      if (ret != ((rq_seq) ? *rq_seq : 0))
+        {
+          rv = 0;
+          goto cleanup;
+        }
+    }
+  else if (payload_type == IPMI_PAYLOAD_TYPE_RMCPPLUS_OPEN_SESSION_REQUEST)
+    {
+      if (FIID_OBJ_GET (ctx->io.outofband.rs.obj_rmcpplus_session_hdr,
+                        "payload_type",
+                        &val) < 0)
+        {
+          API_FIID_OBJECT_ERROR_TO_API_ERRNUM (ctx, ctx->io.outofband.rs.obj_rmcpplus_session_hdr);
+          goto cleanup;
+        }
+      l_payload_type = val;
+
+      if (l_payload_type != IPMI_PAYLOAD_TYPE_RMCPPLUS_OPEN_SESSION_RESPONSE)
+        {
+          rv = 0;
+          goto cleanup;
+        }
+
+      if (message_tag)
+        {
+          if (FIID_OBJ_GET (obj_cmd_rs,
+                            "message_tag",
+                            &val) < 0)
+            {
+              API_FIID_OBJECT_ERROR_TO_API_ERRNUM (ctx, obj_cmd_rs);
+              goto cleanup;
+            }
+          l_message_tag = val;
+
+          if (l_message_tag != *message_tag)
+            {
+              rv = 0;
+              goto cleanup;
+            }
+        }
+
+      /* There is no guarantee that other data (authentication keys,
+       * session id's, etc.) in the RAKP response will be valid if
+       * there is a status code error.  So we check this status code
+       * along with this stuff.
+       */
+
+      if (FIID_OBJ_GET (obj_cmd_rs,
+                        "rmcpplus_status_code",
+                        &val) < 0)
+        {
+          API_FIID_OBJECT_ERROR_TO_API_ERRNUM (ctx, obj_cmd_rs);
+          goto cleanup;
+        }
+      rmcpplus_status_code = val;
+
+      if (FIID_OBJ_GET (obj_cmd_rs,
+                        "remote_console_session_id",
+                        &val) < 0)
+        {
+          API_FIID_OBJECT_ERROR_TO_API_ERRNUM (ctx, obj_cmd_rs);
+          goto cleanup;
+        }
+      l_session_id = val;
+
+      if (rmcpplus_status_code == RMCPPLUS_STATUS_NO_ERRORS
+          && l_session_id != ctx->io.outofband.remote_console_session_id)
+        {
+          rv = 0;
+          goto cleanup;
+        }
+
+    }
+  else if (payload_type == IPMI_PAYLOAD_TYPE_RAKP_MESSAGE_1)
+    {
+      if (FIID_OBJ_GET (ctx->io.outofband.rs.obj_rmcpplus_session_hdr,
+                        "payload_type",
+                        &val) < 0)
+        {
+          API_FIID_OBJECT_ERROR_TO_API_ERRNUM (ctx, ctx->io.outofband.rs.obj_rmcpplus_session_hdr);
+          goto cleanup;
+        }
+      l_payload_type = val;
+
+      if (l_payload_type != IPMI_PAYLOAD_TYPE_RAKP_MESSAGE_2)
+        {
+          rv = 0;
+          goto cleanup;
+        }
+
+      if (message_tag)
+        {
+          if (FIID_OBJ_GET (obj_cmd_rs,
+                            "message_tag",
+                            &val) < 0)
+            {
+              API_FIID_OBJECT_ERROR_TO_API_ERRNUM (ctx, obj_cmd_rs);
+              goto cleanup;
+            }
+          l_message_tag = val;
+
+          if (l_message_tag != *message_tag)
+            {
+              rv = 0;
+              goto cleanup;
+            }
+        }
+
+      /* There is no guarantee that other data (authentication keys,
+       * session id's, etc.) in the RAKP response will be valid if
+       * there is a status code error.  So we check this status code
+       * along with this stuff.
+       */
+
+      if (FIID_OBJ_GET (obj_cmd_rs,
+                        "rmcpplus_status_code",
+                        &val) < 0)
+        {
+          API_FIID_OBJECT_ERROR_TO_API_ERRNUM (ctx, obj_cmd_rs);
+          goto cleanup;
+        }
+      rmcpplus_status_code = val;
+
+      if (FIID_OBJ_GET (obj_cmd_rs,
+                        "remote_console_session_id",
+                        &val) < 0)
+        {
+          API_FIID_OBJECT_ERROR_TO_API_ERRNUM (ctx, obj_cmd_rs);
+          goto cleanup;
+        }
+      l_session_id = val;
+
+      if (rmcpplus_status_code == RMCPPLUS_STATUS_NO_ERRORS
+          && l_session_id != ctx->io.outofband.remote_console_session_id)
+        {
+          rv = 0;
+          goto cleanup;
+        }
+    }
+  else if (payload_type == IPMI_PAYLOAD_TYPE_RAKP_MESSAGE_3)
+    {
+      if (FIID_OBJ_GET (ctx->io.outofband.rs.obj_rmcpplus_session_hdr,
+                        "payload_type",
+                        &val) < 0)
+        {
+          API_FIID_OBJECT_ERROR_TO_API_ERRNUM (ctx, ctx->io.outofband.rs.obj_rmcpplus_session_hdr);
+          goto cleanup;
+        }
+      l_payload_type = val;
+
+      if (l_payload_type != IPMI_PAYLOAD_TYPE_RAKP_MESSAGE_4)
+        {
+          rv = 0;
+          goto cleanup;
+        }
+
+      if (message_tag)
+        {
+          if (FIID_OBJ_GET (obj_cmd_rs,
+                            "message_tag",
+                            &val) < 0)
+            {
+              API_FIID_OBJECT_ERROR_TO_API_ERRNUM (ctx, obj_cmd_rs);
+              goto cleanup;
+            }
+          l_message_tag = val;
+
+          if (l_message_tag != *message_tag)
+            {
+              rv = 0;
+              goto cleanup;
+            }
+        }
+
+      /* There is no guarantee that other data (e.g. authentication
+       * keys, session id's, etc.) in the RAKP response will be valid
+       * if there is a status code error.  So we check this status
+       * code along with this stuff.
+       */
+
+      if (FIID_OBJ_GET (obj_cmd_rs,
+                        "rmcpplus_status_code",
+                        &val) < 0)
+        {
+          API_FIID_OBJECT_ERROR_TO_API_ERRNUM (ctx, obj_cmd_rs);
+          goto cleanup;
+        }
+      rmcpplus_status_code = val;
+
+      if (FIID_OBJ_GET (obj_cmd_rs,
+                        "remote_console_session_id",
+                        &val) < 0)
+        {
+          API_FIID_OBJECT_ERROR_TO_API_ERRNUM (ctx, obj_cmd_rs);
+          goto cleanup;
+        }
+      l_session_id = val;
+
+      if (rmcpplus_status_code == RMCPPLUS_STATUS_NO_ERRORS
+          && l_session_id != ctx->io.outofband.remote_console_session_id)
+        {
+          rv = 0;
+          goto cleanup;
+        }
+    }
+
+  rv = 1;
+ cleanup:
+  return (rv);
+}
+
+static int
+_api_lan_exchange_send (ipmi_ctx_t ctx, struct ipmi_ctx_exchange *x)
+{
+  int ret;
+
+  assert (ctx
+          && ctx->magic == IPMI_CTX_MAGIC
+          && (ctx->type == IPMI_DEVICE_LAN
+              || ctx->type == IPMI_DEVICE_LAN_2_0)
+          && x);
+
+  if (x->rmcpplus)
+    ret = _api_lan_2_0_cmd_send (ctx,
+                                 x->lun,
+                                 x->net_fn,
+                                 x->payload_type,
+                                 x->payload_authenticated,
+                                 x->payload_encrypted,
+                                 (x->session_sequence_number) ? *x->session_sequence_number : 0,
+                                 x->session_id,
+                                 (x->rq_seq) ? *x->rq_seq : 0,
+                                 x->authentication_algorithm,
+                                 x->integrity_algorithm,
+                                 x->confidentiality_algorithm,
+                                 x->integrity_key,
+                                 x->integrity_key_len,
+                                 x->confidentiality_key,
+                                 x->confidentiality_key_len,
+                                 x->password,
+                                 x->password_len,
+                                 x->cmd, /* for debug dumping */
+                                 x->group_extension, /* for debug dumping */
+                                 x->obj_cmd_rq);
+  else
+    ret = _api_lan_cmd_send (ctx,
+                             x->lun,
+                             x->net_fn,
+                             x->authentication_type,
+                             (x->session_sequence_number) ? *x->session_sequence_number : 0,
+                             x->session_id,
+                             (x->rq_seq) ? *x->rq_seq : 0,
+                             x->password,
+                             x->password_len,
+                             x->cmd, /* for debug dumping */
+                             x->group_extension, /* for debug dumping */
+                             x->obj_cmd_rq);
+
+  if (ret < 0)
+    return (-1);
+
+  x->last_send = ctx->io.outofband.last_send;
+  if (!x->retransmission_count)
+    x->first_send = x->last_send;
+  return (0);
+}
+
+static void
+_api_lan_exchange_next_sequence (struct ipmi_ctx_exchange *x)
+{
+  assert (x);
+
+  if (x->message_tag)
+    (*x->message_tag)++;
+  if (x->session_sequence_number)
+    {
+      (*x->session_sequence_number)++;
+      /* In IPMI 2.0, session sequence numbers of 0 are special */
+      if (x->rmcpplus && !(*x->session_sequence_number))
+        (*x->session_sequence_number)++;
+    }
+  if (x->rq_seq)
+    *x->rq_seq = ((*x->rq_seq) + 1) % (IPMI_LAN_REQUESTER_SEQUENCE_NUMBER_MAX + 1);
+}
+
+/* prepare an exchange for its first request */
+static int
+_api_lan_exchange_init (ipmi_ctx_t ctx, struct ipmi_ctx_exchange *x)
+{
+  uint64_t val;
+
+  assert (ctx
+          && ctx->magic == IPMI_CTX_MAGIC
+          && (ctx->type == IPMI_DEVICE_LAN
+              || ctx->type == IPMI_DEVICE_LAN_2_0)
+          && ctx->io.outofband.sockfd
+          && x
+          && fiid_obj_valid (x->obj_cmd_rq)
+          && fiid_obj_packet_valid (x->obj_cmd_rq) == 1
+          && fiid_obj_valid (x->obj_cmd_rs));
+
+  x->retransmission_count = 0;
+  timerclear (&(x->last_send));
+  timerclear (&(x->first_send));
+  x->cmd = 0;
+  x->group_extension = 0;
+  x->sockets = NULL;
+
+  if (!ctx->io.outofband.last_received.tv_sec
+      && !ctx->io.outofband.last_received.tv_usec)
+    {
+      if (gettimeofday (&ctx->io.outofband.last_received, NULL) < 0)
+        {
+          API_ERRNO_TO_API_ERRNUM (ctx, errno);
+          return (-1);
+        }
+    }
+
+  if (ctx->flags & IPMI_FLAGS_DEBUG_DUMP)
+    {
+      /* ignore error, continue on */
+      if (FIID_OBJ_GET (x->obj_cmd_rq,
+                        "cmd",
+                        &val) < 0)
+        API_FIID_OBJECT_ERROR_TO_API_ERRNUM (ctx, x->obj_cmd_rq);
+      else
+        x->cmd = val;
+
+      if (IPMI_NET_FN_GROUP_EXTENSION (x->net_fn))
+        {
+          /* ignore error, continue on */
+          if (FIID_OBJ_GET (x->obj_cmd_rq,
+                            "group_extension_identification",
+                            &val) < 0)
+            API_FIID_OBJECT_ERROR_TO_API_ERRNUM (ctx, x->obj_cmd_rq);
+          else
+            x->group_extension = val;
+        }
+    }
+
+  if (x->stats)
+    x->stats->requests++;
+
+  return (0);
+}
+
+/* send the first request of an exchange */
+static int
+_api_lan_exchange_start (ipmi_ctx_t ctx, struct ipmi_ctx_exchange *x)
+{
+  assert (ctx
+          && ctx->magic == IPMI_CTX_MAGIC
+          && (ctx->type == IPMI_DEVICE_LAN
+              || ctx->type == IPMI_DEVICE_LAN_2_0)
+          && x);
+
+  if (_api_lan_exchange_init (ctx, x) < 0)
+    return (-1);
+
+  return (_api_lan_exchange_send (ctx, x));
+}
+
+/* return 1 if the exchange is complete without a response, 0 if
+ * the request was retransmitted, -1 on error
+ */
+static int
+_api_lan_exchange_retransmit (ipmi_ctx_t ctx, struct ipmi_ctx_exchange *x)
+{
+  assert (ctx
+          && ctx->magic == IPMI_CTX_MAGIC
+          && (ctx->type == IPMI_DEVICE_LAN
+              || ctx->type == IPMI_DEVICE_LAN_2_0)
+          && x);
+
+  /* ignore timeout, just cleanly close session */
+  if (x->internal_workaround_flags & IPMI_INTERNAL_WORKAROUND_FLAGS_CLOSE_SESSION_SKIP_RETRANSMIT)
+    return (1);
+
+  _api_lan_exchange_next_sequence (x);
+
+  _rtt_backoff (ctx, x);
+
+  x->retransmission_count++;
+
+  /* blocking commands are counted by ipmi_cmd(), except for their
+   * retransmissions
+   */
+  if (x->stats)
+    x->stats->retransmissions++;
+  else if (ctx->stats_cmd)
+    ctx->stats_cmd->retransmissions++;
+
+  if (x->rmcpplus
+      && (x->payload_type == IPMI_PAYLOAD_TYPE_RMCPPLUS_OPEN_SESSION_REQUEST
+          || x->payload_type == IPMI_PAYLOAD_TYPE_RAKP_MESSAGE_1
+          || x->payload_type == IPMI_PAYLOAD_TYPE_RAKP_MESSAGE_3))
+    {
+      /* Unlike most packets, the open session request, rakp 1
+       * and rakp 3 messages have the message tags in a
+       * non-header field.  So this is a special case.
+       */
+      if (fiid_obj_set (x->obj_cmd_rq, "message_tag", (*x->message_tag)) < 0)
+        {
+          API_FIID_OBJECT_ERROR_TO_API_ERRNUM (ctx, x->obj_cmd_rq);
+          return (-1);
+        }
+    }
+
+  /* IPMI Workaround (achu)
+   *
+   * Discovered on Intel Tiger4 (SR870BN4)
+   *
+   * If the reply from a previous Get Session Challenge request is
+   * lost on the network, the following retransmission will make
+   * the BMC confused and it will not respond to future packets.
+   *
+   * The problem seems to exist only when the retransmitted packet
+   * is transmitted from the same source port.  Therefore, the fix
+   * is to send the retransmission from a different source port.
+   * So we'll create a new socket, re-bind to an ephemereal port
+   * (guaranteeing us a brand new port), and store this new
+   * socket.
+   *
+   * In the event we need to resend this packet multiple times, we
+   * do not want the chance that old ports will be used again.  We
+   * store the old file descriptrs (which are bound to the old
+   * ports) on a list, and close all of them after we have gotten
+   * past the Get Session Challenge phase of the protocol.
+   */
+  if (x->internal_workaround_flags & IPMI_INTERNAL_WORKAROUND_FLAGS_GET_SESSION_CHALLENGE
+      && ctx->io.outofband.mux_peer)
+    {
+      /* a shared socket cannot be rebound, move to another socket of
+       * the pool instead
+       */
+      if (api_mux_move (ctx) < 0)
+        return (-1);
+    }
+  else if (x->internal_workaround_flags & IPMI_INTERNAL_WORKAROUND_FLAGS_GET_SESSION_CHALLENGE)
+    {
+      struct socket_to_close *s;
+
+      if (!(s = (struct socket_to_close *)malloc (sizeof (struct socket_to_close))))
+        {
+          API_SET_ERRNUM (ctx, IPMI_ERR_OUT_OF_MEMORY);
+          return (-1);
+        }
+      s->fd = ctx->io.outofband.sockfd;
+      s->next = x->sockets;
+      x->sockets = s;
+
+      if ((ctx->io.outofband.sockfd = socket (ctx->io.outofband.srcaddr->sa_family,
+                                              SOCK_DGRAM,
+                                              0)) < 0)
+        {
+          API_ERRNO_TO_API_ERRNUM (ctx, errno);
+          return (-1);
+        }
+
+      if (bind (ctx->io.outofband.sockfd,
+                ctx->io.outofband.srcaddr,
+                ctx->io.outofband.srcaddr_len) < 0)
+        {
+          API_ERRNO_TO_API_ERRNUM (ctx, errno);
+          return (-1);
+        }
+    }
+
+  if (_api_lan_exchange_send (ctx, x) < 0)
+    return (-1);
+
+  return (0);
+}
+
+/* its ok to use the "request" net_fn, dump code doesn't care */
+static void
+_api_lan_exchange_dump_rs (ipmi_ctx_t ctx,
+                           struct ipmi_ctx_exchange *x,
+                           const void *pkt,
+                           unsigned int pkt_len)
+{
+  assert (ctx
+          && ctx->magic == IPMI_CTX_MAGIC
+          && (ctx->type == IPMI_DEVICE_LAN
+              || ctx->type == IPMI_DEVICE_LAN_2_0)
+          && x
+          && pkt
+          && pkt_len);
+
+  if (!(ctx->flags & IPMI_FLAGS_DEBUG_DUMP))
+    return;
+
+  if (x->rmcpplus)
+    _api_lan_2_0_dump_rs (ctx,
+                          x->authentication_algorithm,
+                          x->integrity_algorithm,
+                          x->confidentiality_algorithm,
+                          x->integrity_key,
+                          x->integrity_key_len,
+                          x->confidentiality_key,
+                          x->confidentiality_key_len,
+                          pkt,
+                          pkt_len,
+                          x->cmd,
+                          x->net_fn,
+                          x->group_extension,
+                          x->obj_cmd_rs);
+  else
+    _api_lan_dump_rs (ctx,
+                      pkt,
+                      pkt_len,
+                      x->cmd,
+                      x->net_fn,
+                      x->group_extension,
+                      x->obj_cmd_rs);
+}
+
+/* unassemble a packet with the session parameters of exchange x,
+ * the command data into obj_cmd_rs
+ *
+ * return 1 on full parse, 0 if the packet should be ignored, -1 on
+ * error
+ */
+static int
+_api_lan_exchange_unassemble (ipmi_ctx_t ctx,
+                              struct ipmi_ctx_exchange *x,
+                              const void *pkt,
+                              unsigned int pkt_len,
+                              fiid_obj_t obj_cmd_rs)
+{
+  unsigned int intf_flags = IPMI_INTERFACE_FLAGS_DEFAULT;
+  int ret;
+
+  assert (ctx
+          && ctx->magic == IPMI_CTX_MAGIC
+          && (ctx->type == IPMI_DEVICE_LAN
+              || ctx->type == IPMI_DEVICE_LAN_2_0)
+          && x
+          && pkt
+          && pkt_len
+          && fiid_obj_valid (obj_cmd_rs));
+
+  /* the common case, decoded in place */
+  if (x->rmcpplus
+      && x->payload_type == IPMI_PAYLOAD_TYPE_IPMI)
+    {
+      if ((ret = _api_lan_2_0_session_unassemble (ctx,
+                                                  x->integrity_algorithm,
+                                                  x->confidentiality_algorithm,
+                                                  x->integrity_key,
+                                                  x->integrity_key_len,
+                                                  x->password,
+                                                  x->password_len,
+                                                  x->confidentiality_key,
+                                                  x->confidentiality_key_len,
+                                                  pkt,
+                                                  pkt_len)) <= 0)
+        return (ret);
+
+      return (_api_lan_2_0_session_cmd_rs (ctx, obj_cmd_rs));
+    }
+
+  if (ctx->flags & IPMI_FLAGS_NO_LEGAL_CHECK)
+    intf_flags |= IPMI_INTERFACE_FLAGS_NO_LEGAL_CHECK;
+
+  if (x->rmcpplus)
+    ret = unassemble_ipmi_rmcpplus_pkt (x->authentication_algorithm,
+                                        x->integrity_algorithm,
+                                        x->confidentiality_algorithm,
+                                        x->integrity_key,
+                                        x->integrity_key_len,
+                                        x->confidentiality_key,
+                                        x->confidentiality_key_len,
+                                        pkt,
+                                        pkt_len,
+                                        ctx->io.outofband.rs.obj_rmcp_hdr,
+                                        ctx->io.outofband.rs.obj_rmcpplus_session_hdr,
+                                        ctx->io.outofband.rs.obj_rmcpplus_payload,
+                                        ctx->io.outofband.rs.obj_lan_msg_hdr,
+                                        obj_cmd_rs,
+                                        ctx->io.outofband.rs.obj_lan_msg_trlr,
+                                        ctx->io.outofband.rs.obj_rmcpplus_session_trlr,
+                                        intf_flags);
+  else
+    ret = unassemble_ipmi_lan_pkt (pkt,
+                                   pkt_len,
+                                   ctx->io.outofband.rs.obj_rmcp_hdr,
+                                   ctx->io.outofband.rs.obj_lan_session_hdr,
+                                   ctx->io.outofband.rs.obj_lan_msg_hdr,
+                                   obj_cmd_rs,
+                                   ctx->io.outofband.rs.obj_lan_msg_trlr,
+                                   intf_flags);
+
+  if (ret < 0)
+    {
+      API_ERRNO_TO_API_ERRNUM (ctx, errno);
+      return (-1);
+    }
+
+  return (ret);
+}
+
+/* verify an unassembled packet against exchange x
+ *
+ * return 1 if it is the response of the exchange, 0 if the packet
+ * should be ignored, -1 on error
+ */
+static int
+_api_lan_exchange_verify (ipmi_ctx_t ctx,
+                          struct ipmi_ctx_exchange *x,
+                          const void *pkt,
+                          unsigned int pkt_len)
+{
+  int ret;
+
+  assert (ctx
+          && ctx->magic == IPMI_CTX_MAGIC
+          && (ctx->type == IPMI_DEVICE_LAN
+              || ctx->type == IPMI_DEVICE_LAN_2_0)
+          && x
+          && pkt
+          && pkt_len);
+
+  if (x->rmcpplus)
+    ret = _api_lan_2_0_cmd_wrapper_verify_packet (ctx,
+                                                  x->payload_type,
+                                                  x->message_tag,
+                                                  x->session_sequence_number,
+                                                  x->rq_seq,
+                                                  x->obj_cmd_rs);
+  else
+    ret = _api_lan_cmd_wrapper_verify_packet (ctx,
+                                              x->internal_workaround_flags,
+                                              x->authentication_type,
+                                              x->check_authentication_code,
+                                              x->session_sequence_number,
+                                              x->session_id,
+                                              x->rq_seq,
+                                              x->password,
+                                              x->password_len,
+                                              x->obj_cmd_rs);
+
+  if (ret <= 0)
+    return (ret);
+
+  if (gettimeofday (&(ctx->io.outofband.last_received), NULL) < 0)
+    {
+      API_ERRNO_TO_API_ERRNUM (ctx, errno);
+      return (-1);
+    }
+
+  _rtt_sample (ctx, x);
+
+  if (x->stats)
+    api_stats_latency (x->stats,
+                       &(x->first_send),
+                       &(ctx->io.outofband.last_received));
+
+  return (1);
+}
+
+/* return 1 if the response was received, 0 if the packet should be
+ * ignored, -1 on error
+ */
+static int
+_api_lan_exchange_packet (ipmi_ctx_t ctx,
+                          struct ipmi_ctx_exchange *x,
+                          const void *pkt,
+                          unsigned int pkt_len)
+{
+  int ret;
+
+  assert (ctx
+          && ctx->magic == IPMI_CTX_MAGIC
+          && (ctx->type == IPMI_DEVICE_LAN
+              || ctx->type == IPMI_DEVICE_LAN_2_0)
+          && x
+          && pkt
+          && pkt_len);
+
+  _api_lan_exchange_dump_rs (ctx, x, pkt, pkt_len);
+
+  if ((ret = _api_lan_exchange_unassemble (ctx,
+                                           x,
+                                           pkt,
+                                           pkt_len,
+                                           x->obj_cmd_rs)) <= 0)
+    return (ret);
+
+  return (_api_lan_exchange_verify (ctx, x, pkt, pkt_len));
+}
+
+/* return 1 and set errnum if the session timed out, 0 if not, -1 on error */
+static int
+_api_lan_exchange_timed_out (ipmi_ctx_t ctx, struct ipmi_ctx_exchange *x)
+{
+  int ret;
+
+  assert (ctx
+          && ctx->magic == IPMI_CTX_MAGIC
+          && (ctx->type == IPMI_DEVICE_LAN
+              || ctx->type == IPMI_DEVICE_LAN_2_0)
+          && x);
+
+  if ((ret = _session_timed_out (ctx)) <= 0)
+    return (ret);
+
+  if (!x->rmcpplus
+      && (ctx->flags & IPMI_FLAGS_NOSESSION))
+    API_SET_ERRNUM (ctx, IPMI_ERR_MESSAGE_TIMEOUT);
+  else
+    API_SET_ERRNUM (ctx, IPMI_ERR_SESSION_TIMEOUT);
+  return (1);
+}
+
+static void
+_api_lan_exchange_finish (struct ipmi_ctx_exchange *x)
+{
+  assert (x);
+
+  _api_lan_exchange_next_sequence (x);
+
+  while (x->sockets)
+    {
+      struct socket_to_close *s = x->sockets;
+
+      /* ignore potential error, cleanup path */
+      close (s->fd);
+      x->sockets = s->next;
+      free (s);
+    }
+}
+
+/* send the request and block until its response is received */
+static int
+_api_lan_exchange_run (ipmi_ctx_t ctx, struct ipmi_ctx_exchange *x)
+{
+  uint8_t pkt[IPMI_MAX_PKT_LEN];
+  int recv_len, ret, rv = -1;
+
+  assert (ctx
+          && ctx->magic == IPMI_CTX_MAGIC
+          && (ctx->type == IPMI_DEVICE_LAN
+              || ctx->type == IPMI_DEVICE_LAN_2_0)
+          && x);
+
+  x->sockets = NULL;
+
+  if (_api_lan_exchange_start (ctx, x) < 0)
+    goto cleanup;
+
+  while (1)
+    {
+      if ((ret = _api_lan_exchange_timed_out (ctx, x)) < 0)
+        break;
+
+      if (ret)
+        {
+          if (x->stats)
+            x->stats->timeouts++;
+          break;
+        }
+
+      if ((recv_len = _api_lan_cmd_recv (ctx,
+                                         pkt,
+                                         IPMI_MAX_PKT_LEN,
+                                         x->retransmission_count)) < 0)
+        break;
+
+      if (!recv_len)
+        {
+          if ((ret = _api_lan_exchange_retransmit (ctx, x)) < 0)
+            break;
+
+          if (ret)
+            {
+              rv = 0;
+              break;
+            }
+
+          continue;
+        }
+
+      /* else received a packet */
+
+      if ((ret = _api_lan_exchange_packet (ctx, x, pkt, recv_len)) < 0)
+        break;
+
+      if (ret)
+        {
+          rv = 0;
+          break;
+        }
+    }
+
+ cleanup:
+  _api_lan_exchange_finish (x);
+  return (rv);
+}
+
+int
+api_lan_cmd_wrapper (ipmi_ctx_t ctx,
+                     unsigned int internal_workaround_flags,
+                     uint8_t lun,
+                     uint8_t net_fn,
+                     uint8_t authentication_type,
+                     int check_authentication_code,
+                     uint32_t *session_sequence_number,
+                     uint32_t session_id,
+                     uint8_t *rq_seq,
+                     const char *password,
+                     unsigned int password_len,
+                     fiid_obj_t obj_cmd_rq,
+                     fiid_obj_t obj_cmd_rs)
+{
+  struct ipmi_ctx_exchange x;
+
+  assert (ctx
+          && ctx->magic == IPMI_CTX_MAGIC
+          && (ctx->type == IPMI_DEVICE_LAN
+              || ctx->type == IPMI_DEVICE_LAN_2_0)
+          && ctx->io.outofband.sockfd
+          && IPMI_BMC_LUN_VALID (lun)
+          && IPMI_NET_FN_VALID (net_fn)
+          && IPMI_1_5_AUTHENTICATION_TYPE_VALID (authentication_type)
+          && !(password && password_len > IPMI_1_5_MAX_PASSWORD_LENGTH)
+          && fiid_obj_valid (obj_cmd_rq)
+          && fiid_obj_packet_valid (obj_cmd_rq) == 1
+          && fiid_obj_valid (obj_cmd_rs));
+
+  memset (&x, '\0', sizeof (struct ipmi_ctx_exchange));
+  x.internal_workaround_flags = internal_workaround_flags;
+  x.lun = lun;
+  x.net_fn = net_fn;
+  x.authentication_type = authentication_type;
+  x.check_authentication_code = check_authentication_code;
+  x.session_sequence_number = session_sequence_number;
+  x.session_id = session_id;
+  x.rq_seq = rq_seq;
+  x.password = password;
+  x.password_len = password_len;
+  x.obj_cmd_rq = obj_cmd_rq;
+  x.obj_cmd_rs = obj_cmd_rs;
+
+  return (_api_lan_exchange_run (ctx, &x));
+}
+
+int
+api_lan_2_0_cmd_wrapper (ipmi_ctx_t ctx,
+                         unsigned int internal_workaround_flags,
+                         uint8_t lun,
+                         uint8_t net_fn,
+                         uint8_t payload_type,
+                         uint8_t payload_authenticated,
+                         uint8_t payload_encrypted,
+                         uint8_t *message_tag,
+                         uint32_t *session_sequence_number,
+                         uint32_t session_id,
+                         uint8_t *rq_seq,
+                         uint8_t authentication_algorithm,
+                         uint8_t integrity_algorithm,
+                         uint8_t confidentiality_algorithm,
+                         const void *integrity_key,
+                         unsigned int integrity_key_len,
+                         const void *confidentiality_key,
+                         unsigned int confidentiality_key_len,
+                         const char *password,
+                         unsigned int password_len,
+                         fiid_obj_t obj_cmd_rq,
+                         fiid_obj_t obj_cmd_rs)
+{
+  struct ipmi_ctx_exchange x;
+
+  assert (ctx
+          && ctx->magic == IPMI_CTX_MAGIC
+          && ctx->type == IPMI_DEVICE_LAN_2_0
+          && ctx->io.outofband.sockfd
+          && IPMI_BMC_LUN_VALID (lun)
+          && IPMI_NET_FN_VALID (net_fn)
+          && (payload_type == IPMI_PAYLOAD_TYPE_IPMI
+              || payload_type == IPMI_PAYLOAD_TYPE_RMCPPLUS_OPEN_SESSION_REQUEST
+              || payload_type == IPMI_PAYLOAD_TYPE_RAKP_MESSAGE_1
+              || payload_type == IPMI_PAYLOAD_TYPE_RAKP_MESSAGE_3)
+          && IPMI_PAYLOAD_AUTHENTICATED_FLAG_VALID (payload_authenticated)
+          && IPMI_PAYLOAD_ENCRYPTED_FLAG_VALID (payload_encrypted)
+          && (!message_tag
+              || (payload_type == IPMI_PAYLOAD_TYPE_RMCPPLUS_OPEN_SESSION_REQUEST
+                  || payload_type == IPMI_PAYLOAD_TYPE_RAKP_MESSAGE_1
+                  || payload_type == IPMI_PAYLOAD_TYPE_RAKP_MESSAGE_3))
+          && IPMI_AUTHENTICATION_ALGORITHM_SUPPORTED (authentication_algorithm)
+          && IPMI_INTEGRITY_ALGORITHM_SUPPORTED (integrity_algorithm)
+          && IPMI_CONFIDENTIALITY_ALGORITHM_SUPPORTED (confidentiality_algorithm)
+          && !(password && password_len > IPMI_2_0_MAX_PASSWORD_LENGTH)
+          && fiid_obj_valid (obj_cmd_rq)
+          && fiid_obj_packet_valid (obj_cmd_rq) == 1
+          && fiid_obj_valid (obj_cmd_rs));
+
+  memset (&x, '\0', sizeof (struct ipmi_ctx_exchange));
+  x.rmcpplus = 1;
+  x.internal_workaround_flags = internal_workaround_flags;
+  x.lun = lun;
+  x.net_fn = net_fn;
+  x.payload_type = payload_type;
+  x.payload_authenticated = payload_authenticated;
+  x.payload_encrypted = payload_encrypted;
+  x.message_tag = message_tag;
+  x.session_sequence_number = session_sequence_number;
+  x.session_id = session_id;
+  x.rq_seq = rq_seq;
+  x.authentication_algorithm = authentication_algorithm;
+  x.integrity_algorithm = integrity_algorithm;
+  x.confidentiality_algorithm = confidentiality_algorithm;
+  x.integrity_key = integrity_key;
+  x.integrity_key_len = integrity_key_len;
+  x.confidentiality_key = confidentiality_key;
+  x.confidentiality_key_len = confidentiality_key_len;
+  x.password = password;
+  x.password_len = password_len;
+  x.obj_cmd_rq = obj_cmd_rq;
+  x.obj_cmd_rs = obj_cmd_rs;
+
+  return (_api_lan_exchange_run (ctx, &x));
+}
+
+/* setup an exchange for an IPMI command within the current session,
+ * the same as api_lan_cmd() and api_lan_2_0_cmd() would
+ */
+static void
+_api_lan_session_exchange (ipmi_ctx_t ctx,
+                           struct ipmi_ctx_exchange *x,
+                           uint8_t lun,
+                           uint8_t net_fn,
+                           fiid_obj_t obj_cmd_rq,
+                           fiid_obj_t obj_cmd_rs)
+{
+  assert (ctx
+          && ctx->magic == IPMI_CTX_MAGIC
+          && (ctx->type == IPMI_DEVICE_LAN
+              || ctx->type == IPMI_DEVICE_LAN_2_0)
+          && x
+          && IPMI_BMC_LUN_VALID (lun)
+          && IPMI_NET_FN_VALID (net_fn)
+          && fiid_obj_valid (obj_cmd_rq)
+          && fiid_obj_valid (obj_cmd_rs));
+
+  memset (x, '\0', sizeof (struct ipmi_ctx_exchange));
+  x->lun = lun;
+  x->net_fn = net_fn;
+  x->rq_seq = &(ctx->io.outofband.rq_seq);
+  x->obj_cmd_rq = obj_cmd_rq;
+  x->obj_cmd_rs = obj_cmd_rs;
+
+  if (ctx->type == IPMI_DEVICE_LAN)
+    {
+      api_lan_cmd_get_session_parameters (ctx,
+                                          &(x->authentication_type),
+                                          &(x->internal_workaround_flags));
+
+      if (ctx->flags & IPMI_FLAGS_NOSESSION)
+        x->authentication_type = IPMI_AUTHENTICATION_TYPE_NONE;
+      else
         {
-          API_ERRNO_TO_API_ERRNUM (ctx, errno);
-          goto cleanup;
+          /* if auth type NONE, still pass password.  Needed for
+           * check_unexpected_authcode workaround
+           */
+          x->check_authentication_code = 1;
+          x->session_sequence_number = &(ctx->io.outofband.session_sequence_number);
+          x->session_id = ctx->io.outofband.session_id;
+          x->password = ctx->io.outofband.password;
+          x->password_len = IPMI_1_5_MAX_PASSWORD_LENGTH;
+        }
+    }
+  else
+    {
+      x->rmcpplus = 1;
+      x->payload_type = IPMI_PAYLOAD_TYPE_IPMI;
+      api_lan_2_0_cmd_get_session_parameters (ctx,
+                                              &(x->payload_authenticated),
+                                              &(x->payload_encrypted));
+      x->session_sequence_number = &(ctx->io.outofband.session_sequence_number);
+      x->session_id = ctx->io.outofband.managed_system_session_id;
+      x->authentication_algorithm = ctx->io.outofband.authentication_algorithm;
+      x->integrity_algorithm = ctx->io.outofband.integrity_algorithm;
+      x->confidentiality_algorithm = ctx->io.outofband.confidentiality_algorithm;
+      x->integrity_key = ctx->io.outofband.integrity_key_ptr;
+      x->integrity_key_len = ctx->io.outofband.integrity_key_len;
+      x->confidentiality_key = ctx->io.outofband.confidentiality_key_ptr;
+      x->confidentiality_key_len = ctx->io.outofband.confidentiality_key_len;
+      x->password = strlen (ctx->io.outofband.password) ? ctx->io.outofband.password : NULL;
+      x->password_len = strlen (ctx->io.outofband.password);
+    }
+}
+
+int
+api_lan_2_0_cmd_wrapper_ipmb (ipmi_ctx_t ctx,
+                              fiid_obj_t obj_cmd_rq,
+                              fiid_obj_t obj_cmd_rs)
+{
+  int recv_len, ret, rv = -1;
+  unsigned int retransmission_count = 0;
+  uint8_t pkt[IPMI_MAX_PKT_LEN];
+  uint8_t cmd = 0;             /* used for debugging */
+  uint8_t group_extension = 0; /* used for debugging */
+  uint8_t rq_seq_orig;
+  uint64_t val;
+  fiid_obj_t obj_send_rs = NULL;
+  ipmi_errnum_type_t obj_rs_errnum;
+
+  assert (ctx
+          && ctx->magic == IPMI_CTX_MAGIC
+          && ctx->type == IPMI_DEVICE_LAN_2_0
+          && ctx->io.outofband.sockfd
+          && fiid_obj_valid (obj_cmd_rq)
+          && fiid_obj_packet_valid (obj_cmd_rq) == 1
+          && fiid_obj_valid (obj_cmd_rs));
+
+  if (ctx->flags & IPMI_FLAGS_DEBUG_DUMP)
+    {
+      /* ignore error, continue on */
+      if (FIID_OBJ_GET (obj_cmd_rq,
+                        "cmd",
+                        &val) < 0)
+        API_FIID_OBJECT_ERROR_TO_API_ERRNUM (ctx, obj_cmd_rq);
+      else
+        cmd = val;
+
+      if (IPMI_NET_FN_GROUP_EXTENSION (ctx->target.net_fn))
+        {
+          /* ignore error, continue on */
+          if (FIID_OBJ_GET (obj_cmd_rq,
+                            "group_extension_identification",
+                            &val) < 0)
+            API_FIID_OBJECT_ERROR_TO_API_ERRNUM (ctx, obj_cmd_rq);
+          else
+            group_extension = val;
+        }
+    }
+
+  /* for debugging */
+  ctx->tmpl_ipmb_cmd_rq = fiid_obj_template (obj_cmd_rq);
+  ctx->tmpl_ipmb_cmd_rs = fiid_obj_template (obj_cmd_rs);
+
+  /* ipmb response packet will use the request sequence number from
+   * the earlier packet.  Save it for verification.
+   */
+
+  rq_seq_orig = ctx->io.outofband.rq_seq;
+
+  if (_ipmi_cmd_send_ipmb (ctx,
+                           obj_cmd_rq,
+                           &obj_send_rs,
+                           &obj_rs_errnum) < 0)
+    goto cleanup;
+
+  while (1)
+    {
+      uint8_t payload_authenticated;
+      uint8_t payload_encrypted;
+
+      if ((ret = _session_timed_out (ctx)) < 0)
+        break;
+
+      if (ret)
+        {
+          API_SET_ERRNUM (ctx, IPMI_ERR_SESSION_TIMEOUT);
+          break;
+        }
+
+      /* its ok to use the "request" net_fn, dump code doesn't care */
+      if ((recv_len = _api_lan_2_0_cmd_recv (ctx,
+                                             ctx->io.outofband.authentication_algorithm,
+                                             ctx->io.outofband.integrity_algorithm,
+                                             ctx->io.outofband.confidentiality_algorithm,
+                                             ctx->io.outofband.integrity_key_ptr,
+                                             ctx->io.outofband.integrity_key_len,
+                                             ctx->io.outofband.confidentiality_key_ptr,
+                                             ctx->io.outofband.confidentiality_key_len,
+                                             pkt,
+                                             IPMI_MAX_PKT_LEN,
+                                             retransmission_count)) < 0)
+        {
+          rv = -1;
+          break;
+        }
+
+      if (!recv_len)
+        {
+          retransmission_count++;
+
+          if (ctx->stats_cmd)
+            ctx->stats_cmd->retransmissions++;
+
+          /* don't increment sequence numbers, will be done in _ipmi_cmd_send_ipmb */
+
+          /* ipmb response packet will use the request sequence number from
+           * the earlier packet.  Save it for verification.
+           */
+
+          rq_seq_orig = ctx->io.outofband.rq_seq;
+
+          if (obj_send_rs) {
+            fiid_obj_destroy (obj_send_rs);
+            obj_send_rs = NULL;
+          }
+
+          if (_ipmi_cmd_send_ipmb (ctx,
+                                   obj_cmd_rq,
+                                   &obj_send_rs,
+                                   &obj_rs_errnum) < 0)
+            goto cleanup;
+
+          continue;
         }
 
+      /* else received a packet */
+
+      if (ctx->flags & IPMI_FLAGS_DEBUG_DUMP)
+        _api_lan_2_0_dump_rs (ctx,
+                              ctx->io.outofband.authentication_algorithm,
+                              ctx->io.outofband.integrity_algorithm,
+                              ctx->io.outofband.confidentiality_algorithm,
+                              ctx->io.outofband.integrity_key_ptr,
+                              ctx->io.outofband.integrity_key_len,
+                              ctx->io.outofband.confidentiality_key_ptr,
+                              ctx->io.outofband.confidentiality_key_len,
+                              pkt,
+                              recv_len,
+                              cmd,
+                              ctx->target.net_fn,
+                              group_extension,
+                              obj_cmd_rs);
+
+      if ((ret = _api_lan_2_0_session_unassemble (ctx,
+                                                  ctx->io.outofband.integrity_algorithm,
+                                                  ctx->io.outofband.confidentiality_algorithm,
+                                                  ctx->io.outofband.integrity_key_ptr,
+                                                  ctx->io.outofband.integrity_key_len,
+                                                  strlen (ctx->io.outofband.password) ? ctx->io.outofband.password : NULL,
+                                                  strlen (ctx->io.outofband.password),
+                                                  ctx->io.outofband.confidentiality_key_ptr,
+                                                  ctx->io.outofband.confidentiality_key_len,
+                                                  pkt,
+                                                  recv_len)) < 0)
+        goto cleanup;
+
+      if (!ret)
+        continue;
+
+      if ((ret = _api_lan_2_0_session_cmd_rs (ctx, obj_cmd_rs)) < 0)
+        goto cleanup;
+
+      if (!ret)
+        continue;
+
+      api_lan_2_0_cmd_get_session_parameters (ctx,
+                                              &payload_authenticated,
+                                              &payload_encrypted);
+
+      if ((ret = _api_lan_2_0_cmd_wrapper_verify_packet (ctx,
+                                                         IPMI_PAYLOAD_TYPE_IPMI,
+                                                         NULL,
+                                                         &(ctx->io.outofband.session_sequence_number),
+                                                         &rq_seq_orig,
+                                                         obj_cmd_rs)) < 0)
+        goto cleanup;
       if (!ret)
-        {
-          ctx->errnum = IPMI_ERR_USERNAME_INVALID;
-          goto cleanup;
-        }
-    }
-
-  /* IPMI Workaround (achu)
-   *
-   * Discovered on IBM eServer 325
-   *
-   * The remote BMC ignores if permsg authentiction is enabled
-   * or disabled.  So we need to force it no matter what.
-   */
-  if (!(ctx->workaround_flags_outofband & IPMI_WORKAROUND_FLAGS_OUTOFBAND_FORCE_PERMSG_AUTHENTICATION))
-    {
-      if (FIID_OBJ_GET (obj_cmd_rs,
-                        "authentication_status.per_message_authentication",
-                        &val) < 0)
-        {
-          API_FIID_OBJECT_ERROR_TO_API_ERRNUM (ctx, obj_cmd_rs);
-          goto cleanup;
-        }
-      ctx->io.outofband.per_msg_auth_disabled = val;
-    }
-  else
-    ctx->io.outofband.per_msg_auth_disabled = 0;
+        continue;
 
-  /* IPMI Workaround (achu)
-   *
-   * Not discovered yet, assume some motherboard will have it some
-   * day.
-   *
-   * Authentication capabilities flags are not listed properly in the
-   * response.  The workaround is to skip these checks.
-   */
-  if (!(ctx->workaround_flags_outofband & IPMI_WORKAROUND_FLAGS_OUTOFBAND_AUTHENTICATION_CAPABILITIES))
-    {
-      if ((ret = ipmi_check_authentication_capabilities_authentication_type (ctx->io.outofband.authentication_type,
-                                                                             obj_cmd_rs)) < 0)
+      if (gettimeofday (&(ctx->io.outofband.last_received), NULL) < 0)
         {
           API_ERRNO_TO_API_ERRNUM (ctx, errno);
           goto cleanup;
         }
 
-      if (!ret)
-        {
-          API_SET_ERRNUM (ctx, IPMI_ERR_AUTHENTICATION_TYPE_UNAVAILABLE);
-          goto cleanup;
-        }
+      if (_ipmi_check_ipmb_out_of_order (ctx,
+                                         obj_cmd_rq,
+                                         obj_cmd_rs,
+                                         obj_send_rs,
+                                         obj_rs_errnum) < 0)
+        goto cleanup;
+
+      rv = 0;
+      break;
     }
 
-  fiid_obj_destroy (obj_cmd_rq);
-  obj_cmd_rq = NULL;
-  fiid_obj_destroy (obj_cmd_rs);
-  obj_cmd_rs = NULL;
+ cleanup:
+  ctx->io.outofband.session_sequence_number++;
+  /* rq_seq already incremented via _ipmi_cmd_send_ipmb call */
+  fiid_template_free (ctx->tmpl_ipmb_cmd_rq);
+  ctx->tmpl_ipmb_cmd_rq = NULL;
+  fiid_template_free (ctx->tmpl_ipmb_cmd_rs);
+  ctx->tmpl_ipmb_cmd_rs = NULL;
+  fiid_obj_destroy (obj_send_rs);
 
-  if (!(obj_cmd_rq = fiid_obj_create (tmpl_cmd_get_session_challenge_rq)))
-    {
-      API_ERRNO_TO_API_ERRNUM (ctx, errno);
-      goto cleanup;
-    }
-  if (!(obj_cmd_rs = fiid_obj_create (tmpl_cmd_get_session_challenge_rs)))
-    {
-      API_ERRNO_TO_API_ERRNUM (ctx, errno);
-      goto cleanup;
-    }
+  return (rv);
+}
 
-  if (fill_cmd_get_session_challenge (ctx->io.outofband.authentication_type,
-                                      ctx->io.outofband.username,
-                                      IPMI_MAX_USER_NAME_LENGTH,
-                                      obj_cmd_rq) < 0)
-    {
-      API_ERRNO_TO_API_ERRNUM (ctx, errno);
-      goto cleanup;
-    }
+static int
+_api_lan_session_setup_objs (ipmi_ctx_t ctx,
+                             struct ipmi_ctx_session_setup *setup,
+                             fiid_template_t tmpl_cmd_rq,
+                             fiid_template_t tmpl_cmd_rs)
+{
+  assert (ctx
+          && ctx->magic == IPMI_CTX_MAGIC
+          && setup
+          && tmpl_cmd_rq
+          && tmpl_cmd_rs);
 
-  if (api_lan_cmd_wrapper (ctx,
-                           IPMI_INTERNAL_WORKAROUND_FLAGS_GET_SESSION_CHALLENGE,
-                           IPMI_BMC_IPMB_LUN_BMC,
-                           IPMI_NET_FN_APP_RQ,
-                           IPMI_AUTHENTICATION_TYPE_NONE,
-                           0,
-                           NULL,
-                           0,
-                           &(ctx->io.outofband.rq_seq),
-                           NULL,
-                           0,
-                           obj_cmd_rq,
-                           obj_cmd_rs) < 0)
-    goto cleanup;
+  fiid_obj_destroy (setup->obj_cmd_rq);
+  setup->obj_cmd_rq = NULL;
+  fiid_obj_destroy (setup->obj_cmd_rs);
+  setup->obj_cmd_rs = NULL;
 
-  if ((ret = ipmi_check_completion_code_success (obj_cmd_rs)) < 0)
+  if (!(setup->obj_cmd_rq = fiid_obj_create (tmpl_cmd_rq)))
     {
       API_ERRNO_TO_API_ERRNUM (ctx, errno);
-      goto cleanup;
+      return (-1);
     }
-
-  if (!ret)
+  if (!(setup->obj_cmd_rs = fiid_obj_create (tmpl_cmd_rs)))
     {
-      if (ipmi_check_completion_code (obj_cmd_rs, IPMI_COMP_CODE_GET_SESSION_CHALLENGE_INVALID_USERNAME) == 1
-          || ipmi_check_completion_code (obj_cmd_rs, IPMI_COMP_CODE_GET_SESSION_CHALLENGE_NULL_USERNAME_NOT_ENABLED) == 1)
-        API_SET_ERRNUM (ctx, IPMI_ERR_USERNAME_INVALID);
-      else
-        API_BAD_RESPONSE_TO_API_ERRNUM (ctx, obj_cmd_rs);
-      goto cleanup;
+      API_ERRNO_TO_API_ERRNUM (ctx, errno);
+      return (-1);
     }
 
-  if (FIID_OBJ_GET (obj_cmd_rs,
-                    "temp_session_id",
-                    &val) < 0)
-    {
-      API_FIID_OBJECT_ERROR_TO_API_ERRNUM (ctx, obj_cmd_rs);
-      goto cleanup;
-    }
-  temp_session_id = val;
+  return (0);
+}
 
-  if ((challenge_string_len = fiid_obj_get_data (obj_cmd_rs,
-                                                 "challenge_string",
-                                                 challenge_string,
-                                                 IPMI_CHALLENGE_STRING_LENGTH)) < 0)
-    {
-      API_FIID_OBJECT_ERROR_TO_API_ERRNUM (ctx, obj_cmd_rs);
-      goto cleanup;
-    }
+/* setup an exchange for a session setup request, IPMI payloads are
+ * sent via IPMI 1.5 outside of a session
+ */
+static void
+_api_lan_session_setup_exchange (ipmi_ctx_t ctx,
+                                 struct ipmi_ctx_session_setup *setup,
+                                 struct ipmi_ctx_exchange *x,
+                                 uint8_t payload_type)
+{
+  assert (ctx
+          && ctx->magic == IPMI_CTX_MAGIC
+          && setup
+          && x
+          && (payload_type == IPMI_PAYLOAD_TYPE_IPMI
+              || payload_type == IPMI_PAYLOAD_TYPE_RMCPPLUS_OPEN_SESSION_REQUEST
+              || payload_type == IPMI_PAYLOAD_TYPE_RAKP_MESSAGE_1
+              || payload_type == IPMI_PAYLOAD_TYPE_RAKP_MESSAGE_3));
 
-  fiid_obj_destroy (obj_cmd_rq);
-  obj_cmd_rq = NULL;
-  fiid_obj_destroy (obj_cmd_rs);
-  obj_cmd_rs = NULL;
+  memset (x, '\0', sizeof (struct ipmi_ctx_exchange));
+  x->lun = IPMI_BMC_IPMB_LUN_BMC; /* doesn't actually matter for IPMI 2.0 payloads */
+  x->net_fn = IPMI_NET_FN_APP_RQ; /* doesn't actually matter for IPMI 2.0 payloads */
+  x->obj_cmd_rq = setup->obj_cmd_rq;
+  x->obj_cmd_rs = setup->obj_cmd_rs;
 
-  if (!(obj_cmd_rq = fiid_obj_create (tmpl_cmd_activate_session_rq)))
+  if (payload_type == IPMI_PAYLOAD_TYPE_IPMI)
     {
-      API_ERRNO_TO_API_ERRNUM (ctx, errno);
-      goto cleanup;
+      x->authentication_type = IPMI_AUTHENTICATION_TYPE_NONE;
+      x->rq_seq = &(ctx->io.outofband.rq_seq);
     }
-  if (!(obj_cmd_rs = fiid_obj_create (tmpl_cmd_activate_session_rs)))
+  else
     {
-      API_ERRNO_TO_API_ERRNUM (ctx, errno);
-      goto cleanup;
+      x->rmcpplus = 1;
+      x->payload_type = payload_type;
+      x->payload_authenticated = IPMI_PAYLOAD_FLAG_UNAUTHENTICATED;
+      x->payload_encrypted = IPMI_PAYLOAD_FLAG_UNENCRYPTED;
+      x->message_tag = &(setup->message_tag);
+      x->authentication_algorithm = IPMI_AUTHENTICATION_ALGORITHM_RAKP_NONE;
+      x->integrity_algorithm = IPMI_INTEGRITY_ALGORITHM_NONE;
+      x->confidentiality_algorithm = IPMI_CONFIDENTIALITY_ALGORITHM_NONE;
     }
+}
 
-  initial_outbound_sequence_number = rand ();
-
-  if (fill_cmd_activate_session (ctx->io.outofband.authentication_type,
-                                 ctx->io.outofband.privilege_level,
-                                 challenge_string,
-                                 challenge_string_len,
-                                 initial_outbound_sequence_number,
-                                 obj_cmd_rq) < 0)
-    {
-      API_ERRNO_TO_API_ERRNUM (ctx, errno);
-      goto cleanup;
-    }
+static int
+_api_lan_session_setup_authentication_capabilities_rq (ipmi_ctx_t ctx,
+                                                       struct ipmi_ctx_session_setup *setup,
+                                                       struct ipmi_ctx_exchange *x)
+{
+  assert (ctx
+          && ctx->magic == IPMI_CTX_MAGIC
+          && (ctx->type == IPMI_DEVICE_LAN
+              || ctx->type == IPMI_DEVICE_LAN_2_0)
+          && setup
+          && x);
 
-  if (api_lan_cmd_wrapper (ctx,
-                           0,
-                           IPMI_BMC_IPMB_LUN_BMC,
-                           IPMI_NET_FN_APP_RQ,
-                           ctx->io.outofband.authentication_type,
-                           1,
-                           NULL,
-                           temp_session_id,
-                           &(ctx->io.outofband.rq_seq),
-                           ctx->io.outofband.password,
-                           IPMI_1_5_MAX_PASSWORD_LENGTH,
-                           obj_cmd_rq,
-                           obj_cmd_rs) < 0)
-    {
-      if (ctx->errnum == IPMI_ERR_SESSION_TIMEOUT)
-        API_SET_ERRNUM (ctx, IPMI_ERR_PASSWORD_VERIFICATION_TIMEOUT);
-      goto cleanup;
-    }
+  if (_api_lan_session_setup_objs (ctx,
+                                   setup,
+                                   tmpl_cmd_get_channel_authentication_capabilities_rq,
+                                   tmpl_cmd_get_channel_authentication_capabilities_rs) < 0)
+    return (-1);
 
-  if ((ret = ipmi_check_completion_code_success (obj_cmd_rs)) < 0)
+  if (fill_cmd_get_channel_authentication_capabilities (IPMI_CHANNEL_NUMBER_CURRENT_CHANNEL,
+                                                        ctx->io.outofband.privilege_level,
+                                                        (ctx->type == IPMI_DEVICE_LAN) ? IPMI_GET_IPMI_V15_DATA : IPMI_GET_IPMI_V20_EXTENDED_DATA,
+                                                        setup->obj_cmd_rq) < 0)
     {
       API_ERRNO_TO_API_ERRNUM (ctx, errno);
-      goto cleanup;
+      return (-1);
     }
 
-  if (!ret)
-    {
-      if (ipmi_check_completion_code (obj_cmd_rs, IPMI_COMP_CODE_ACTIVATE_SESSION_NO_SESSION_SLOT_AVAILABLE) == 1
-          || ipmi_check_completion_code (obj_cmd_rs, IPMI_COMP_CODE_ACTIVATE_SESSION_NO_SLOT_AVAILABLE_FOR_GIVEN_USER) == 1
-          || ipmi_check_completion_code (obj_cmd_rs, IPMI_COMP_CODE_ACTIVATE_SESSION_NO_SLOT_AVAILABLE_TO_SUPPORT_USER) == 1)
-        API_SET_ERRNUM (ctx, IPMI_ERR_BMC_BUSY);
-      else if (ipmi_check_completion_code (obj_cmd_rs, IPMI_COMP_CODE_ACTIVATE_SESSION_EXCEEDS_PRIVILEGE_LEVEL) == 1)
-        API_SET_ERRNUM (ctx, IPMI_ERR_PRIVILEGE_LEVEL_CANNOT_BE_OBTAINED);
-#if 0
-      /* achu: noticed this on an Inventec 5441/Dell Xanadu II under
-       * some scenarios.  Password Invalid doesn't seem right, b/c on
-       * other motherboards it may be a legitimate bad input.  I think
-       * it best to comment this out and let the vendor fix their
-       * firmware.
-       */
-       else if (ipmi_check_completion_code (obj_cmd_rs, IPMI_COMP_CODE_INVALID_DATA_FIELD_IN_REQUEST) == 1)
-        API_SET_ERRNUM (ctx, IPMI_ERR_PASSWORD_INVALID);
-#endif
-      /*
-       * IPMI Workaround
-       *
-       * Discovered on Xyratex HB-F8-SRAY
-       *
-       * For some reason on this system, if you do not specify a
-       * privilege level of Admin, this completion code will always be
-       * returned.  Reason unknown.  This isn't the best/right error
-       * to return, but it will atleast point the user to a way to
-       * work around the problem.
-       */
-       else if (ipmi_check_completion_code (obj_cmd_rs, IPMI_COMP_CODE_INSUFFICIENT_PRIVILEGE_LEVEL) == 1)
-         API_SET_ERRNUM (ctx, IPMI_ERR_PRIVILEGE_LEVEL_CANNOT_BE_OBTAINED);
-      else
-        API_BAD_RESPONSE_TO_API_ERRNUM (ctx, obj_cmd_rs);
-      goto cleanup;
-    }
+  /* This portion of the protocol is sent via IPMI 1.5 */
+  _api_lan_session_setup_exchange (ctx, setup, x, IPMI_PAYLOAD_TYPE_IPMI);
+  return (0);
+}
 
-  if (FIID_OBJ_GET (obj_cmd_rs,
-                    "session_id",
-                    &val) < 0)
-    {
-      API_FIID_OBJECT_ERROR_TO_API_ERRNUM (ctx, obj_cmd_rs);
-      goto cleanup;
-    }
-  ctx->io.outofband.session_id = val;
+static int
+_api_lan_session_setup_authentication_capabilities_rs (ipmi_ctx_t ctx,
+                                                       struct ipmi_ctx_session_setup *setup)
+{
+  fiid_obj_t obj_cmd_rs;
+  char *tmp_username_ptr = NULL;
+  char *tmp_password_ptr = NULL;
+  int ret;
+  uint64_t val;
 
-  /* achu: On some buggy BMCs the initial outbound sequence number on
-   * the activate session response is off by one.  So we just accept
-   * whatever sequence number they give us even if it isn't the
-   * initial outbound sequence number.
-   */
-  if (FIID_OBJ_GET (ctx->io.outofband.rs.obj_lan_session_hdr,
-                    "session_sequence_number",
-                    &val) < 0)
-    {
-      API_FIID_OBJECT_ERROR_TO_API_ERRNUM (ctx, ctx->io.outofband.rs.obj_lan_session_hdr);
-      goto cleanup;
-    }
-  ctx->io.outofband.highest_received_sequence_number = val;
+  assert (ctx
+          && ctx->magic == IPMI_CTX_MAGIC
+          && ctx->type == IPMI_DEVICE_LAN
+          && setup);
+
+  obj_cmd_rs = setup->obj_cmd_rs;
 
   /* IPMI Workaround (achu)
    *
-   * Discovered on Sun Fire 4100.
+   * Discovered on an ASUS P5M2 motherboard.
    *
-   * The session sequence numbers for IPMI 1.5 are the wrong endian.
-   * So we have to flip the bits to workaround it.
+   * Also seen on Intel X38ML motherboard.
+   *
+   * The ASUS motherboard reports incorrect settings of anonymous
+   * vs. null vs non-null username capabilities.  The workaround is to
+   * skip these checks.
    */
-  if (ctx->workaround_flags_outofband & IPMI_WORKAROUND_FLAGS_OUTOFBAND_BIG_ENDIAN_SEQUENCE_NUMBER)
+  if (!(ctx->workaround_flags_outofband & IPMI_WORKAROUND_FLAGS_OUTOFBAND_AUTHENTICATION_CAPABILITIES))
     {
-      uint32_t tmp_session_sequence_number = ctx->io.outofband.highest_received_sequence_number;
+      if (strlen (ctx->io.outofband.username))
+        tmp_username_ptr = ctx->io.outofband.username;
 
-      ctx->io.outofband.highest_received_sequence_number =
-        ((tmp_session_sequence_number & 0xFF000000) >> 24)
-        | ((tmp_session_sequence_number & 0x00FF0000) >> 8)
-        | ((tmp_session_sequence_number & 0x0000FF00) << 8)
-        | ((tmp_session_sequence_number & 0x000000FF) << 24);
-    }
+      if (strlen (ctx->io.outofband.password))
+        tmp_password_ptr = ctx->io.outofband.password;
 
-  if (FIID_OBJ_GET (obj_cmd_rs,
-                    "initial_inbound_sequence_number",
-                    &val) < 0)
-    {
-      API_FIID_OBJECT_ERROR_TO_API_ERRNUM (ctx, obj_cmd_rs);
-      goto cleanup;
-    }
-  ctx->io.outofband.session_sequence_number = val;
+      if ((ret = ipmi_check_authentication_capabilities_username (tmp_username_ptr,
+                                                                  tmp_password_ptr,
+                                                                  obj_cmd_rs)) < 0)
+        {
+          API_ERRNO_TO_API_ERRNUM (ctx, errno);
+          return (-1);
+        }
 
-  if (FIID_OBJ_GET (obj_cmd_rs,
-                    "authentication_type",
-                    &val) < 0)
-    {
-      API_FIID_OBJECT_ERROR_TO_API_ERRNUM (ctx, obj_cmd_rs);
-      goto cleanup;
+      if (!ret)
+        {
+          ctx->errnum = IPMI_ERR_USERNAME_INVALID;
+          return (-1);
+        }
     }
-  authentication_type = val;
 
   /* IPMI Workaround (achu)
    *
-   * Discovered on Supermicro H8QME with SIMSO daughter card.
-   *
-   * (Note: This could work for "IBM eServer 325" per msg auth
-   * problem.  But I don't have hardware to test it :-()
+   * Discovered on IBM eServer 325
    *
-   * The remote BMC ignores if permsg authentiction is disabled.
-   * Handle it appropriately by just not doing permsg authentication.
+   * The remote BMC ignores if permsg authentiction is enabled
+   * or disabled.  So we need to force it no matter what.
    */
-  if (ctx->io.outofband.per_msg_auth_disabled
-      && authentication_type != IPMI_AUTHENTICATION_TYPE_NONE)
+  if (!(ctx->workaround_flags_outofband & IPMI_WORKAROUND_FLAGS_OUTOFBAND_FORCE_PERMSG_AUTHENTICATION))
+    {
+      if (FIID_OBJ_GET (obj_cmd_rs,
+                        "authentication_status.per_message_authentication",
+                        &val) < 0)
+        {
+          API_FIID_OBJECT_ERROR_TO_API_ERRNUM (ctx, obj_cmd_rs);
+          return (-1);
+        }
+      ctx->io.outofband.per_msg_auth_disabled = val;
+    }
+  else
     ctx->io.outofband.per_msg_auth_disabled = 0;
 
-  fiid_obj_destroy (obj_cmd_rq);
-  obj_cmd_rq = NULL;
-  fiid_obj_destroy (obj_cmd_rs);
-  obj_cmd_rs = NULL;
-
-  /* if privilege_level == IPMI_PRIVILEGE_LEVEL_USER we shouldn't have
-   * to call this, b/c it should be USER by default.  But I don't
-   * trust IPMI implementations.  Do it anyways.
-   */
-
-  /* achu: At this point in time, the session is actually setup
-   * legitimately, so we can use the actual set session privilege
-   * level API function.
+  /* IPMI Workaround (achu)
+   *
+   * Not discovered yet, assume some motherboard will have it some
+   * day.
+   *
+   * Authentication capabilities flags are not listed properly in the
+   * response.  The workaround is to skip these checks.
    */
-  if (!(obj_cmd_rs = fiid_obj_create (tmpl_cmd_set_session_privilege_level_rs)))
+  if (!(ctx->workaround_flags_outofband & IPMI_WORKAROUND_FLAGS_OUTOFBAND_AUTHENTICATION_CAPABILITIES))
     {
-      API_ERRNO_TO_API_ERRNUM (ctx, errno);
-      goto cleanup;
-    }
+      if ((ret = ipmi_check_authentication_capabilities_authentication_type (ctx->io.outofband.authentication_type,
+                                                                             obj_cmd_rs)) < 0)
+        {
+          API_ERRNO_TO_API_ERRNUM (ctx, errno);
+          return (-1);
+        }
 
-  if (ipmi_cmd_set_session_privilege_level (ctx,
-                                            ctx->io.outofband.privilege_level,
-                                            obj_cmd_rs) < 0)
-    {
-      if (ctx->errnum == IPMI_ERR_BAD_COMPLETION_CODE)
+      if (!ret)
         {
-          if (ipmi_check_completion_code (obj_cmd_rs, IPMI_COMP_CODE_SET_SESSION_PRIVILEGE_LEVEL_REQUESTED_LEVEL_NOT_AVAILABLE_FOR_USER) == 1
-              || ipmi_check_completion_code (obj_cmd_rs, IPMI_COMP_CODE_SET_SESSION_PRIVILEGE_LEVEL_REQUESTED_LEVEL_EXCEEDS_USER_PRIVILEGE_LIMIT) == 1)
-            API_SET_ERRNUM (ctx, IPMI_ERR_PRIVILEGE_LEVEL_CANNOT_BE_OBTAINED);
+          API_SET_ERRNUM (ctx, IPMI_ERR_AUTHENTICATION_TYPE_UNAVAILABLE);
+          return (-1);
         }
-      ERR_TRACE (ipmi_ctx_strerror (ctx->errnum), ctx->errnum);
-      goto cleanup;
     }
 
- out:
-  rv = 0;
- cleanup:
-  fiid_obj_destroy (obj_cmd_rq);
-  fiid_obj_destroy (obj_cmd_rs);
-  return (rv);
+  /* for the session cache */
+  setup->per_msg_auth_disabled = ctx->io.outofband.per_msg_auth_disabled;
+
+  setup->step = IPMI_SESSION_SETUP_GET_SESSION_CHALLENGE;
+  return (0);
 }
 
-int
-api_lan_close_session (ipmi_ctx_t ctx)
+static int
+_api_lan_session_setup_get_session_challenge_rq (ipmi_ctx_t ctx,
+                                                 struct ipmi_ctx_session_setup *setup,
+                                                 struct ipmi_ctx_exchange *x)
 {
-  fiid_obj_t obj_cmd_rq = NULL;
-  fiid_obj_t obj_cmd_rs = NULL;
-  uint8_t authentication_type;
-  unsigned int internal_workaround_flags = 0;
-  int ret, rv = -1;
-
-  /* Do not use ipmi_cmd_close_session(), we use a close session retransmit workaround */
-
   assert (ctx
           && ctx->magic == IPMI_CTX_MAGIC
           && ctx->type == IPMI_DEVICE_LAN
-          && ctx->io.outofband.sockfd);
+          && setup
+          && x);
 
-  if (!(obj_cmd_rq = fiid_obj_create (tmpl_cmd_close_session_rq)))
-    {
-      API_ERRNO_TO_API_ERRNUM (ctx, errno);
-      return (-1);
-    }
+  if (_api_lan_session_setup_objs (ctx,
+                                   setup,
+                                   tmpl_cmd_get_session_challenge_rq,
+                                   tmpl_cmd_get_session_challenge_rs) < 0)
+    return (-1);
 
-  if (!(obj_cmd_rs = fiid_obj_create (tmpl_cmd_close_session_rs)))
+  if (fill_cmd_get_session_challenge (ctx->io.outofband.authentication_type,
+                                      ctx->io.outofband.username,
+                                      IPMI_MAX_USER_NAME_LENGTH,
+                                      setup->obj_cmd_rq) < 0)
     {
       API_ERRNO_TO_API_ERRNUM (ctx, errno);
       return (-1);
     }
 
-  if (fill_cmd_close_session (ctx->io.outofband.session_id,
-                              NULL,
-                              obj_cmd_rq) < 0)
-    {
-      API_ERRNO_TO_API_ERRNUM (ctx, errno);
-      goto cleanup;
-    }
+  _api_lan_session_setup_exchange (ctx, setup, x, IPMI_PAYLOAD_TYPE_IPMI);
+  x->internal_workaround_flags = IPMI_INTERNAL_WORKAROUND_FLAGS_GET_SESSION_CHALLENGE;
+  return (0);
+}
 
-  api_lan_cmd_get_session_parameters (ctx,
-                                      &authentication_type,
-                                      &internal_workaround_flags);
+static int
+_api_lan_session_setup_get_session_challenge_rs (ipmi_ctx_t ctx,
+                                                 struct ipmi_ctx_session_setup *setup)
+{
+  fiid_obj_t obj_cmd_rs;
+  int challenge_string_len;
+  int ret;
+  uint64_t val;
 
-  internal_workaround_flags |= IPMI_INTERNAL_WORKAROUND_FLAGS_CLOSE_SESSION_SKIP_RETRANSMIT;
-  if (api_lan_cmd_wrapper (ctx,
-                           internal_workaround_flags,
-                           IPMI_BMC_IPMB_LUN_BMC,
-                           IPMI_NET_FN_APP_RQ,
-                           authentication_type,
-                           1,
-                           &(ctx->io.outofband.session_sequence_number),
-                           ctx->io.outofband.session_id,
-                           &(ctx->io.outofband.rq_seq),
-                           ctx->io.outofband.password,
-                           IPMI_1_5_MAX_PASSWORD_LENGTH,
-                           obj_cmd_rq,
-                           obj_cmd_rs) < 0)
-    goto cleanup;
+  assert (ctx
+          && ctx->magic == IPMI_CTX_MAGIC
+          && ctx->type == IPMI_DEVICE_LAN
+          && setup);
 
-  /* Check completion code just for tracing, but don't return error */
+  obj_cmd_rs = setup->obj_cmd_rs;
 
   if ((ret = ipmi_check_completion_code_success (obj_cmd_rs)) < 0)
     {
       API_ERRNO_TO_API_ERRNUM (ctx, errno);
-      goto out;
+      return (-1);
     }
 
   if (!ret)
     {
-      API_BAD_RESPONSE_TO_API_ERRNUM (ctx, obj_cmd_rs);
-      goto out;
-    }
-
- out:
-  rv = 0;
- cleanup:
-  fiid_obj_destroy (obj_cmd_rq);
-  fiid_obj_destroy (obj_cmd_rs);
-  return (rv);
-}
-
-static void
-_api_lan_2_0_dump_rq (ipmi_ctx_t ctx,
-                      uint8_t authentication_algorithm,
-                      uint8_t integrity_algorithm,
-                      uint8_t confidentiality_algorithm,
-                      const void *integrity_key,
-                      unsigned int integrity_key_len,
-                      const void *confidentiality_key,
-                      unsigned int confidentiality_key_len,
-                      const void *pkt,
-                      unsigned int pkt_len,
-                      uint8_t cmd,
-                      uint8_t net_fn,
-                      uint8_t group_extension,
-                      fiid_obj_t obj_cmd_rq)
-{
-  fiid_field_t *tmpl_cmd = NULL;
-
-  assert (ctx
-          && ctx->magic == IPMI_CTX_MAGIC
-          && (ctx->flags & IPMI_FLAGS_DEBUG_DUMP)
-          && IPMI_AUTHENTICATION_ALGORITHM_SUPPORTED (authentication_algorithm)
-          && IPMI_INTEGRITY_ALGORITHM_SUPPORTED (integrity_algorithm)
-          && IPMI_CONFIDENTIALITY_ALGORITHM_SUPPORTED (confidentiality_algorithm)
-          && pkt
-          && pkt_len
-          && fiid_obj_valid (obj_cmd_rq));
-
-  /* Don't cleanup/return an error here.  It's just debug code. */
-
-  if ((tmpl_cmd = fiid_obj_template (obj_cmd_rq)))
-    {
-      char hdrbuf[DEBUG_UTIL_HDR_BUFLEN + 1];
-      const char *cmd_str = NULL;
-
-      /* Handle a few IPMI 2.0 special cases */
-      if (fiid_template_compare (tmpl_cmd, tmpl_rmcpplus_open_session_request) == 1)
-        cmd_str = DEBUG_UTIL_OPEN_SESSION_STR;
-      else if (fiid_template_compare (tmpl_cmd, tmpl_rmcpplus_rakp_message_1) == 1)
-        cmd_str = DEBUG_UTIL_RAKP_1_STR;
-      else if (fiid_template_compare (tmpl_cmd, tmpl_rmcpplus_rakp_message_3) == 1)
-        cmd_str = DEBUG_UTIL_RAKP_3_STR;
-
-      memset (hdrbuf, '\0', DEBUG_UTIL_HDR_BUFLEN + 1);
-
-      if (cmd_str)
-        debug_hdr_str (DEBUG_UTIL_TYPE_IPMI_2_0,
-                       DEBUG_UTIL_DIRECTION_REQUEST,
-                       DEBUG_UTIL_FLAGS_DEFAULT,
-                       cmd_str,
-                       hdrbuf,
-                       DEBUG_UTIL_HDR_BUFLEN);
-      else
-        debug_hdr_cmd (DEBUG_UTIL_TYPE_IPMI_2_0,
-                       DEBUG_UTIL_DIRECTION_REQUEST,
-                       net_fn,
-                       cmd,
-                       group_extension,
-                       hdrbuf,
-                       DEBUG_UTIL_HDR_BUFLEN);
-
-      if (ctx->tmpl_ipmb_cmd_rq)
-        ipmi_dump_rmcpplus_packet_ipmb (STDERR_FILENO,
-                                        ctx->io.outofband.hostname,
-                                        hdrbuf,
-                                        NULL,
-                                        authentication_algorithm,
-                                        integrity_algorithm,
-                                        confidentiality_algorithm,
-                                        integrity_key,
-                                        integrity_key_len,
-                                        confidentiality_key,
-                                        confidentiality_key_len,
-                                        pkt,
-                                        pkt_len,
-                                        tmpl_lan_msg_hdr_rs,
-                                        tmpl_cmd,
-                                        tmpl_ipmb_msg_hdr_rq,
-                                        ctx->tmpl_ipmb_cmd_rq);
+      if (ipmi_check_completion_code (obj_cmd_rs, IPMI_COMP_CODE_GET_SESSION_CHALLENGE_INVALID_USERNAME) == 1
+          || ipmi_check_completion_code (obj_cmd_rs, IPMI_COMP_CODE_GET_SESSION_CHALLENGE_NULL_USERNAME_NOT_ENABLED) == 1)
+        API_SET_ERRNUM (ctx, IPMI_ERR_USERNAME_INVALID);
       else
-        ipmi_dump_rmcpplus_packet (STDERR_FILENO,
-                                   ctx->io.outofband.hostname,
-                                   hdrbuf,
-                                   NULL,
-                                   authentication_algorithm,
-                                   integrity_algorithm,
-                                   confidentiality_algorithm,
-                                   integrity_key,
-                                   integrity_key_len,
-                                   confidentiality_key,
-                                   confidentiality_key_len,
-                                   pkt,
-                                   pkt_len,
-                                   tmpl_lan_msg_hdr_rq,
-                                   tmpl_cmd);
+        API_BAD_RESPONSE_TO_API_ERRNUM (ctx, obj_cmd_rs);
+      return (-1);
+    }
 
-      fiid_template_free (tmpl_cmd);
+  if (FIID_OBJ_GET (obj_cmd_rs,
+                    "temp_session_id",
+                    &val) < 0)
+    {
+      API_FIID_OBJECT_ERROR_TO_API_ERRNUM (ctx, obj_cmd_rs);
+      return (-1);
+    }
+  setup->temp_session_id = val;
+
+  if ((challenge_string_len = fiid_obj_get_data (obj_cmd_rs,
+                                                 "challenge_string",
+                                                 setup->challenge_string,
+                                                 IPMI_CHALLENGE_STRING_LENGTH)) < 0)
+    {
+      API_FIID_OBJECT_ERROR_TO_API_ERRNUM (ctx, obj_cmd_rs);
+      return (-1);
     }
+  setup->challenge_string_len = challenge_string_len;
+
+  setup->step = IPMI_SESSION_SETUP_ACTIVATE_SESSION;
+  return (0);
 }
 
-static void
-_api_lan_2_0_dump_rs (ipmi_ctx_t ctx,
-                      uint8_t authentication_algorithm,
-                      uint8_t integrity_algorithm,
-                      uint8_t confidentiality_algorithm,
-                      const void *integrity_key,
-                      unsigned int integrity_key_len,
-                      const void *confidentiality_key,
-                      unsigned int confidentiality_key_len,
-                      const void *pkt,
-                      unsigned int pkt_len,
-                      uint8_t cmd,
-                      uint8_t net_fn,
-                      uint8_t group_extension,
-                      fiid_obj_t obj_cmd_rs)
+static int
+_api_lan_session_setup_activate_session_rq (ipmi_ctx_t ctx,
+                                            struct ipmi_ctx_session_setup *setup,
+                                            struct ipmi_ctx_exchange *x)
 {
-  fiid_field_t *tmpl_cmd = NULL;
+  uint32_t initial_outbound_sequence_number = 0;
 
   assert (ctx
           && ctx->magic == IPMI_CTX_MAGIC
-          && (ctx->flags & IPMI_FLAGS_DEBUG_DUMP)
-          && IPMI_AUTHENTICATION_ALGORITHM_SUPPORTED (authentication_algorithm)
-          && IPMI_INTEGRITY_ALGORITHM_SUPPORTED (integrity_algorithm)
-          && IPMI_CONFIDENTIALITY_ALGORITHM_SUPPORTED (confidentiality_algorithm)
-          && pkt
-          && pkt_len
-          && fiid_obj_valid (obj_cmd_rs));
+          && ctx->type == IPMI_DEVICE_LAN
+          && setup
+          && x);
 
-  /* Don't cleanup/return an error here.  It's just debug code. */
+  if (_api_lan_session_setup_objs (ctx,
+                                   setup,
+                                   tmpl_cmd_activate_session_rq,
+                                   tmpl_cmd_activate_session_rs) < 0)
+    return (-1);
 
-  if ((tmpl_cmd = fiid_obj_template (obj_cmd_rs)))
+  initial_outbound_sequence_number = rand ();
+
+  if (fill_cmd_activate_session (ctx->io.outofband.authentication_type,
+                                 ctx->io.outofband.privilege_level,
+                                 setup->challenge_string,
+                                 setup->challenge_string_len,
+                                 initial_outbound_sequence_number,
+                                 setup->obj_cmd_rq) < 0)
     {
-      char hdrbuf[DEBUG_UTIL_HDR_BUFLEN + 1];
-      const char *cmd_str = NULL;
+      API_ERRNO_TO_API_ERRNUM (ctx, errno);
+      return (-1);
+    }
 
-      /* Handle a few IPMI 2.0 special cases */
-      if (fiid_template_compare (tmpl_cmd, tmpl_rmcpplus_open_session_response) == 1)
-        cmd_str = DEBUG_UTIL_OPEN_SESSION_STR;
-      else if (fiid_template_compare (tmpl_cmd, tmpl_rmcpplus_rakp_message_2) == 1)
-        cmd_str = DEBUG_UTIL_RAKP_2_STR;
-      else if (fiid_template_compare (tmpl_cmd, tmpl_rmcpplus_rakp_message_4) == 1)
-        cmd_str = DEBUG_UTIL_RAKP_4_STR;
+  _api_lan_session_setup_exchange (ctx, setup, x, IPMI_PAYLOAD_TYPE_IPMI);
+  x->authentication_type = ctx->io.outofband.authentication_type;
+  x->check_authentication_code = 1;
+  x->session_id = setup->temp_session_id;
+  x->password = ctx->io.outofband.password;
+  x->password_len = IPMI_1_5_MAX_PASSWORD_LENGTH;
+  return (0);
+}
 
-      memset (hdrbuf, '\0', DEBUG_UTIL_HDR_BUFLEN + 1);
+static int
+_api_lan_session_setup_activate_session_rs (ipmi_ctx_t ctx,
+                                            struct ipmi_ctx_session_setup *setup)
+{
+  fiid_obj_t obj_cmd_rs;
+  uint8_t authentication_type;
+  int ret;
+  uint64_t val;
 
-      if (cmd_str)
-        debug_hdr_str (DEBUG_UTIL_TYPE_IPMI_2_0,
-                       DEBUG_UTIL_DIRECTION_RESPONSE,
-                       DEBUG_UTIL_FLAGS_DEFAULT,
-                       cmd_str,
-                       hdrbuf,
-                       DEBUG_UTIL_HDR_BUFLEN);
+  assert (ctx
+          && ctx->magic == IPMI_CTX_MAGIC
+          && ctx->type == IPMI_DEVICE_LAN
+          && setup);
+
+  obj_cmd_rs = setup->obj_cmd_rs;
+
+  if ((ret = ipmi_check_completion_code_success (obj_cmd_rs)) < 0)
+    {
+      API_ERRNO_TO_API_ERRNUM (ctx, errno);
+      return (-1);
+    }
+
+  if (!ret)
+    {
+      if (ipmi_check_completion_code (obj_cmd_rs, IPMI_COMP_CODE_ACTIVATE_SESSION_NO_SESSION_SLOT_AVAILABLE) == 1
+          || ipmi_check_completion_code (obj_cmd_rs, IPMI_COMP_CODE_ACTIVATE_SESSION_NO_SLOT_AVAILABLE_FOR_GIVEN_USER) == 1
+          || ipmi_check_completion_code (obj_cmd_rs, IPMI_COMP_CODE_ACTIVATE_SESSION_NO_SLOT_AVAILABLE_TO_SUPPORT_USER) == 1)
+        API_SET_ERRNUM (ctx, IPMI_ERR_BMC_BUSY);
+      else if (ipmi_check_completion_code (obj_cmd_rs, IPMI_COMP_CODE_ACTIVATE_SESSION_EXCEEDS_PRIVILEGE_LEVEL) == 1)
+        API_SET_ERRNUM (ctx, IPMI_ERR_PRIVILEGE_LEVEL_CANNOT_BE_OBTAINED);
+#if 0
+      /* achu: noticed this on an Inventec 5441/Dell Xanadu II under
+       * some scenarios.  Password Invalid doesn't seem right, b/c on
+       * other motherboards it may be a legitimate bad input.  I think
+       * it best to comment this out and let the vendor fix their
+       * firmware.
+       */
+       else if (ipmi_check_completion_code (obj_cmd_rs, IPMI_COMP_CODE_INVALID_DATA_FIELD_IN_REQUEST) == 1)
+        API_SET_ERRNUM (ctx, IPMI_ERR_PASSWORD_INVALID);
+#endif
+      /*
+       * IPMI Workaround
+       *
+       * Discovered on Xyratex HB-F8-SRAY
+       *
+       * For some reason on this system, if you do not specify a
+       * privilege level of Admin, this completion code will always be
+       * returned.  Reason unknown.  This isn't the best/right error
+       * to return, but it will atleast point the user to a way to
+       * work around the problem.
+       */
+       else if (ipmi_check_completion_code (obj_cmd_rs, IPMI_COMP_CODE_INSUFFICIENT_PRIVILEGE_LEVEL) == 1)
+         API_SET_ERRNUM (ctx, IPMI_ERR_PRIVILEGE_LEVEL_CANNOT_BE_OBTAINED);
       else
-        debug_hdr_cmd (DEBUG_UTIL_TYPE_IPMI_2_0,
-                       DEBUG_UTIL_DIRECTION_RESPONSE,
-                       net_fn,
-                       cmd,
-                       group_extension,
-                       hdrbuf,
-                       DEBUG_UTIL_HDR_BUFLEN);
+        API_BAD_RESPONSE_TO_API_ERRNUM (ctx, obj_cmd_rs);
+      return (-1);
+    }
 
-      ipmi_dump_rmcpplus_packet (STDERR_FILENO,
-                                 ctx->io.outofband.hostname,
-                                 hdrbuf,
-                                 NULL,
-                                 authentication_algorithm,
-                                 integrity_algorithm,
-                                 confidentiality_algorithm,
-                                 integrity_key,
-                                 integrity_key_len,
-                                 confidentiality_key,
-                                 confidentiality_key_len,
-                                 pkt,
-                                 pkt_len,
-                                 tmpl_lan_msg_hdr_rs,
-                                 tmpl_cmd);
+  if (FIID_OBJ_GET (obj_cmd_rs,
+                    "session_id",
+                    &val) < 0)
+    {
+      API_FIID_OBJECT_ERROR_TO_API_ERRNUM (ctx, obj_cmd_rs);
+      return (-1);
+    }
+  ctx->io.outofband.session_id = val;
 
-      fiid_template_free (tmpl_cmd);
+  /* achu: On some buggy BMCs the initial outbound sequence number on
+   * the activate session response is off by one.  So we just accept
+   * whatever sequence number they give us even if it isn't the
+   * initial outbound sequence number.
+   */
+  if (FIID_OBJ_GET (ctx->io.outofband.rs.obj_lan_session_hdr,
+                    "session_sequence_number",
+                    &val) < 0)
+    {
+      API_FIID_OBJECT_ERROR_TO_API_ERRNUM (ctx, ctx->io.outofband.rs.obj_lan_session_hdr);
+      return (-1);
     }
-}
+  ctx->io.outofband.highest_received_sequence_number = val;
 
-static int
-_api_lan_2_0_cmd_send (ipmi_ctx_t ctx,
-                       uint8_t lun,
-                       uint8_t net_fn,
-                       uint8_t payload_type,
-                       uint8_t payload_authenticated,
-                       uint8_t payload_encrypted,
-                       uint32_t session_sequence_number,
-                       uint32_t session_id,
-                       uint8_t rq_seq,
-                       uint8_t authentication_algorithm,
-                       uint8_t integrity_algorithm,
-                       uint8_t confidentiality_algorithm,
-                       const void *integrity_key,
-                       unsigned int integrity_key_len,
-                       const void *confidentiality_key,
-                       unsigned int confidentiality_key_len,
-                       const char *password,
-                       unsigned int password_len,
-                       uint8_t cmd, /* for debug dumping */
-                       uint8_t group_extension, /* for debug dumping */
-                       fiid_obj_t obj_cmd_rq)
+  /* IPMI Workaround (achu)
+   *
+   * Discovered on Sun Fire 4100.
+   *
+   * The session sequence numbers for IPMI 1.5 are the wrong endian.
+   * So we have to flip the bits to workaround it.
+   */
+  if (ctx->workaround_flags_outofband & IPMI_WORKAROUND_FLAGS_OUTOFBAND_BIG_ENDIAN_SEQUENCE_NUMBER)
+    {
+      uint32_t tmp_session_sequence_number = ctx->io.outofband.highest_received_sequence_number;
+
+      ctx->io.outofband.highest_received_sequence_number =
+        ((tmp_session_sequence_number & 0xFF000000) >> 24)
+        | ((tmp_session_sequence_number & 0x00FF0000) >> 8)
+        | ((tmp_session_sequence_number & 0x0000FF00) << 8)
+        | ((tmp_session_sequence_number & 0x000000FF) << 24);
+    }
+
+  if (FIID_OBJ_GET (obj_cmd_rs,
+                    "initial_inbound_sequence_number",
+                    &val) < 0)
+    {
+      API_FIID_OBJECT_ERROR_TO_API_ERRNUM (ctx, obj_cmd_rs);
+      return (-1);
+    }
+  ctx->io.outofband.session_sequence_number = val;
+
+  if (FIID_OBJ_GET (obj_cmd_rs,
+                    "authentication_type",
+                    &val) < 0)
+    {
+      API_FIID_OBJECT_ERROR_TO_API_ERRNUM (ctx, obj_cmd_rs);
+      return (-1);
+    }
+  authentication_type = val;
+
+  /* IPMI Workaround (achu)
+   *
+   * Discovered on Supermicro H8QME with SIMSO daughter card.
+   *
+   * (Note: This could work for "IBM eServer 325" per msg auth
+   * problem.  But I don't have hardware to test it :-()
+   *
+   * The remote BMC ignores if permsg authentiction is disabled.
+   * Handle it appropriately by just not doing permsg authentication.
+   */
+  if (ctx->io.outofband.per_msg_auth_disabled
+      && authentication_type != IPMI_AUTHENTICATION_TYPE_NONE)
+    ctx->io.outofband.per_msg_auth_disabled = 0;
+
+  setup->step = IPMI_SESSION_SETUP_SET_SESSION_PRIVILEGE_LEVEL;
+  return (0);
+}
+
+static int
+_api_lan_2_0_session_setup_authentication_capabilities_rs (ipmi_ctx_t ctx,
+                                                           struct ipmi_ctx_session_setup *setup)
 {
-  uint8_t *pkt = NULL;
-  unsigned int pkt_len = 0;
-  int cmd_len = 0;
-  int send_len = 0;
-  int ret, rv = -1;
+  fiid_obj_t obj_cmd_rs;
+  char *tmp_username_ptr = NULL;
+  char *tmp_password_ptr = NULL;
+  void *tmp_k_g_ptr = NULL;
+  int ret;
 
   assert (ctx
           && ctx->magic == IPMI_CTX_MAGIC
-          && ctx->io.outofband.sockfd
-          && IPMI_BMC_LUN_VALID (lun)
-          && IPMI_NET_FN_VALID (net_fn)
-          && (payload_type == IPMI_PAYLOAD_TYPE_IPMI
-              || payload_type == IPMI_PAYLOAD_TYPE_RMCPPLUS_OPEN_SESSION_REQUEST
-              || payload_type == IPMI_PAYLOAD_TYPE_RAKP_MESSAGE_1
-              || payload_type == IPMI_PAYLOAD_TYPE_RAKP_MESSAGE_3)
-          && IPMI_PAYLOAD_AUTHENTICATED_FLAG_VALID (payload_authenticated)
-          && IPMI_PAYLOAD_ENCRYPTED_FLAG_VALID (payload_encrypted)
-          && IPMI_AUTHENTICATION_ALGORITHM_SUPPORTED (authentication_algorithm)
-          && IPMI_INTEGRITY_ALGORITHM_SUPPORTED (integrity_algorithm)
-          && IPMI_CONFIDENTIALITY_ALGORITHM_SUPPORTED (confidentiality_algorithm)
-          && !(password && password_len > IPMI_2_0_MAX_PASSWORD_LENGTH)
-          && fiid_obj_valid (obj_cmd_rq)
-          && fiid_obj_packet_valid (obj_cmd_rq) == 1);
-
-  if ((cmd_len = fiid_obj_len_bytes (obj_cmd_rq)) < 0)
-    {
-      API_FIID_OBJECT_ERROR_TO_API_ERRNUM (ctx, obj_cmd_rq);
-      goto cleanup;
-    }
+          && ctx->type == IPMI_DEVICE_LAN_2_0
+          && setup);
 
-  /* variable based on authentication, etc. 1024 extra is enough */
-  pkt_len = cmd_len + IPMI_PKT_PAD;
+  obj_cmd_rs = setup->obj_cmd_rs;
 
-  if (!(pkt = malloc (pkt_len)))
+  if ((ret = ipmi_check_authentication_capabilities_ipmi_2_0 (obj_cmd_rs)) < 0)
     {
       API_ERRNO_TO_API_ERRNUM (ctx, errno);
-      goto cleanup;
+      return (-1);
     }
 
-  if (fill_rmcp_hdr_ipmi (ctx->io.outofband.rq.obj_rmcp_hdr) < 0)
+  if (!ret)
     {
-      API_ERRNO_TO_API_ERRNUM (ctx, errno);
-      goto cleanup;
+      ctx->errnum = IPMI_ERR_IPMI_2_0_UNAVAILABLE;
+      return (-1);
     }
 
-  if (fill_rmcpplus_session_hdr (payload_type,
-                                 payload_authenticated,
-                                 payload_encrypted,
-                                 0, /* oem_iana */
-                                 0, /* oem_payload_id */
-                                 session_id,
-                                 session_sequence_number,
-                                 ctx->io.outofband.rq.obj_rmcpplus_session_hdr) < 0)
+  /* IPMI Workaround
+   *
+   * Discovered on an ASUS P5M2 motherboard.
+   *
+   * The ASUS motherboard reports incorrect settings of anonymous
+   * vs. null vs non-null username capabilities.  The workaround is to
+   * skip all these checks.
+   *
+   * Discovered on an ASUS P5MT-R motherboard
+   *
+   * K_g status is reported incorrectly too.  Again, skip the checks.
+   */
+  if (!(ctx->workaround_flags_outofband_2_0 & IPMI_WORKAROUND_FLAGS_OUTOFBAND_2_0_AUTHENTICATION_CAPABILITIES))
     {
-      API_ERRNO_TO_API_ERRNUM (ctx, errno);
-      goto cleanup;
-    }
+      if (strlen (ctx->io.outofband.username))
+        tmp_username_ptr = ctx->io.outofband.username;
 
-  if (fill_lan_msg_hdr (IPMI_SLAVE_ADDRESS_BMC,
-                        net_fn,
-                        lun,
-                        rq_seq,
-                        ctx->io.outofband.rq.obj_lan_msg_hdr) < 0)
-    {
-      API_ERRNO_TO_API_ERRNUM (ctx, errno);
-      goto cleanup;
-    }
+      if (strlen (ctx->io.outofband.password))
+        tmp_password_ptr = ctx->io.outofband.password;
 
-  if (fill_rmcpplus_session_trlr (ctx->io.outofband.rq.obj_rmcpplus_session_trlr) < 0)
-    {
-      API_ERRNO_TO_API_ERRNUM (ctx, errno);
-      goto cleanup;
-    }
+      if ((ret = ipmi_check_authentication_capabilities_username (tmp_username_ptr,
+                                                                  tmp_password_ptr,
+                                                                  obj_cmd_rs)) < 0)
+        {
+          API_ERRNO_TO_API_ERRNUM (ctx, errno);
+          return (-1);
+        }
 
-  if ((send_len = assemble_ipmi_rmcpplus_pkt (authentication_algorithm,
-                                              integrity_algorithm,
-                                              confidentiality_algorithm,
-                                              integrity_key,
-                                              integrity_key_len,
-                                              confidentiality_key,
-                                              confidentiality_key_len,
-                                              password,
-                                              password_len,
-                                              ctx->io.outofband.rq.obj_rmcp_hdr,
-                                              ctx->io.outofband.rq.obj_rmcpplus_session_hdr,
-                                              ctx->io.outofband.rq.obj_lan_msg_hdr,
-                                              obj_cmd_rq,
-                                              ctx->io.outofband.rq.obj_rmcpplus_session_trlr,
-                                              pkt,
-                                              pkt_len,
-                                              IPMI_INTERFACE_FLAGS_DEFAULT)) < 0)
-    {
-      API_ERRNO_TO_API_ERRNUM (ctx, errno);
-      goto cleanup;
+      if (!ret)
+        {
+          ctx->errnum = IPMI_ERR_USERNAME_INVALID;
+          return (-1);
+        }
+
+      if (ctx->io.outofband.k_g_configured)
+        tmp_k_g_ptr = ctx->io.outofband.k_g;
+
+      if ((ret = ipmi_check_authentication_capabilities_k_g (tmp_k_g_ptr,
+                                                             obj_cmd_rs)) < 0)
+        {
+          API_ERRNO_TO_API_ERRNUM (ctx, errno);
+          return (-1);
+        }
+
+      if (!ret)
+        {
+          API_SET_ERRNUM (ctx, IPMI_ERR_K_G_INVALID);
+          return (-1);
+        }
     }
 
-  if (ctx->flags & IPMI_FLAGS_DEBUG_DUMP && send_len)
-    _api_lan_2_0_dump_rq (ctx,
-                          authentication_algorithm,
-                          integrity_algorithm,
-                          confidentiality_algorithm,
-                          integrity_key,
-                          integrity_key_len,
-                          confidentiality_key,
-                          confidentiality_key_len,
-                          pkt,
-                          send_len,
-                          cmd,
-                          net_fn,
-                          group_extension,
-                          obj_cmd_rq);
+  setup->step = IPMI_SESSION_SETUP_OPEN_SESSION;
+  return (0);
+}
+
+static int
+_api_lan_2_0_session_setup_open_session_rq (ipmi_ctx_t ctx,
+                                            struct ipmi_ctx_session_setup *setup,
+                                            struct ipmi_ctx_exchange *x)
+{
+  assert (ctx
+          && ctx->magic == IPMI_CTX_MAGIC
+          && ctx->type == IPMI_DEVICE_LAN_2_0
+          && setup
+          && x);
+
+  if (_api_lan_session_setup_objs (ctx,
+                                   setup,
+                                   tmpl_rmcpplus_open_session_request,
+                                   tmpl_rmcpplus_open_session_response) < 0)
+    return (-1);
+
+  setup->message_tag = (uint8_t)rand ();
 
+  /* In IPMI 2.0, session_ids of 0 are special */
   do
     {
-      ret = ipmi_rmcpplus_sendto (ctx->io.outofband.sockfd,
-                                  pkt,
-                                  send_len,
-                                  0,
-                                  ctx->io.outofband.remote_host,
-                                  ctx->io.outofband.remote_host_len);
-    } while (ret < 0 && errno == EINTR);
+      if (ipmi_get_random (&(ctx->io.outofband.remote_console_session_id),
+                           sizeof (ctx->io.outofband.remote_console_session_id)) < 0)
+        {
+          API_ERRNO_TO_API_ERRNUM (ctx, errno);
+          return (-1);
+        }
+    } while (!ctx->io.outofband.remote_console_session_id);
 
-  if (ret < 0)
+  if (ipmi_cipher_suite_id_to_algorithms (ctx->io.outofband.cipher_suite_id,
+                                          &(ctx->io.outofband.authentication_algorithm),
+                                          &(ctx->io.outofband.integrity_algorithm),
+                                          &(ctx->io.outofband.confidentiality_algorithm)) < 0)
     {
       API_ERRNO_TO_API_ERRNUM (ctx, errno);
-      goto cleanup;
+      return (-1);
     }
 
-  if (gettimeofday (&ctx->io.outofband.last_send, NULL) < 0)
+  /*
+   * IPMI Workaround (achu)
+   *
+   * Forgotten Motherboard
+   *
+   * Cipher suite IDs are attached to specific privilege levels
+   * rather than a maximum privilege level limit.  So you can only
+   * authenticate at the configured privilege level rather than a
+   * privilege level <= to it.
+   *
+   * To deal with this situation.  We send the "request highest
+   * privilege" flag in the open session request.  This should be
+   * enough to work around this issue but still work with other
+   * motherboards.
+   */
+
+  /* IPMI Workaround (achu)
+   *
+   * Discovered on SE7520AF2 with Intel Server Management Module
+   * (Professional Edition)
+   *
+   * The Intel's return IPMI_PRIVILEGE_LEVEL_HIGHEST_LEVEL instead
+   * of an actual privilege, so have to pass the actual privilege
+   * we want to use.
+   */
+
+  /* IPMI Workaround (achu)
+   *
+   * Discovered on Sun Fire 4100, Inventec 5441/Dell Xanadu II,
+   * Supermicro X8DTH, Supermicro X8DTG, Supermicro X8DTU, Intel
+   * S5500WBV/Penguin Relion 700
+   *
+   * The remote BMC incorrectly calculates keys using the privilege
+   * specified in the open session stage rather than the privilege
+   * used during the RAKP1 stage.  This can be problematic if you
+   * specify IPMI_PRIVILEGE_LEVEL_HIGHEST_LEVEL during that stage
+   * instead of a real privilege level.  So we must pass the actual
+   * privilege we want to use.
+   */
+  if (ctx->workaround_flags_outofband_2_0 & IPMI_WORKAROUND_FLAGS_OUTOFBAND_2_0_INTEL_2_0_SESSION
+      || ctx->workaround_flags_outofband_2_0 & IPMI_WORKAROUND_FLAGS_OUTOFBAND_2_0_SUN_2_0_SESSION
+      || ctx->workaround_flags_outofband_2_0 & IPMI_WORKAROUND_FLAGS_OUTOFBAND_2_0_OPEN_SESSION_PRIVILEGE)
+    setup->requested_maximum_privilege = ctx->io.outofband.privilege_level;
+  else
+    setup->requested_maximum_privilege = IPMI_PRIVILEGE_LEVEL_HIGHEST_LEVEL;
+
+  if (fill_rmcpplus_open_session (setup->message_tag,
+                                  setup->requested_maximum_privilege,
+                                  ctx->io.outofband.remote_console_session_id,
+                                  ctx->io.outofband.authentication_algorithm,
+                                  ctx->io.outofband.integrity_algorithm,
+                                  ctx->io.outofband.confidentiality_algorithm,
+                                  setup->obj_cmd_rq) < 0)
     {
       API_ERRNO_TO_API_ERRNUM (ctx, errno);
-      goto cleanup;
+      return (-1);
     }
 
-  rv = 0;
- cleanup:
-  free (pkt);
-  return (rv);
+  _api_lan_session_setup_exchange (ctx,
+                                   setup,
+                                   x,
+                                   IPMI_PAYLOAD_TYPE_RMCPPLUS_OPEN_SESSION_REQUEST);
+  return (0);
 }
 
-/* return receive length on success, 0 on no packet, -1 on error */
 static int
-_api_lan_2_0_cmd_recv (ipmi_ctx_t ctx,
-                       uint8_t authentication_algorithm,
-                       uint8_t integrity_algorithm,
-                       uint8_t confidentiality_algorithm,
-                       const void *integrity_key,
-                       unsigned int integrity_key_len,
-                       const void *confidentiality_key,
-                       unsigned int confidentiality_key_len,
-                       void *pkt,
-                       unsigned int pkt_len,
-                       unsigned int retransmission_count)
-{
-  struct timeval recv_starttime;
-  int recv_len = 0;
+_api_lan_2_0_session_setup_open_session_rs (ipmi_ctx_t ctx,
+                                            struct ipmi_ctx_session_setup *setup)
+{
+  fiid_obj_t obj_cmd_rs;
+  uint8_t rmcpplus_status_code;
+  int ret;
+  uint64_t val;
 
   assert (ctx
           && ctx->magic == IPMI_CTX_MAGIC
-          && ctx->io.outofband.sockfd
-          && IPMI_AUTHENTICATION_ALGORITHM_SUPPORTED (authentication_algorithm)
-          && IPMI_INTEGRITY_ALGORITHM_SUPPORTED (integrity_algorithm)
-          && IPMI_CONFIDENTIALITY_ALGORITHM_SUPPORTED (confidentiality_algorithm)
-          && pkt
-          && pkt_len);
+          && ctx->type == IPMI_DEVICE_LAN_2_0
+          && setup);
 
-  if (gettimeofday (&recv_starttime, NULL) < 0)
+  obj_cmd_rs = setup->obj_cmd_rs;
+
+  if (FIID_OBJ_GET (obj_cmd_rs,
+                    "rmcpplus_status_code",
+                    &val) < 0)
     {
-      API_ERRNO_TO_API_ERRNUM (ctx, errno);
+      API_FIID_OBJECT_ERROR_TO_API_ERRNUM (ctx, obj_cmd_rs);
       return (-1);
     }
+  rmcpplus_status_code = val;
 
-  recv_len = _api_lan_recvfrom (ctx,
-                                pkt,
-                                pkt_len,
-                                retransmission_count,
-                                &recv_starttime);
-
-  if (!recv_len)
-    return (0); /* resend the request */
+  if (rmcpplus_status_code != RMCPPLUS_STATUS_NO_ERRORS)
+    {
+      if (rmcpplus_status_code == RMCPPLUS_STATUS_NO_CIPHER_SUITE_MATCH_WITH_PROPOSED_SECURITY_ALGORITHMS)
+        API_SET_ERRNUM (ctx, IPMI_ERR_CIPHER_SUITE_ID_UNAVAILABLE);
+      else if (rmcpplus_status_code == RMCPPLUS_STATUS_INVALID_ROLE)
+        API_SET_ERRNUM (ctx, IPMI_ERR_PRIVILEGE_LEVEL_CANNOT_BE_OBTAINED);
+      else if (rmcpplus_status_code == RMCPPLUS_STATUS_INSUFFICIENT_RESOURCES_TO_CREATE_A_SESSION
+               || rmcpplus_status_code == RMCPPLUS_STATUS_INSUFFICIENT_RESOURCES_TO_CREATE_A_SESSION_AT_THE_REQUESTED_TIME)
+        API_SET_ERRNUM (ctx, IPMI_ERR_BMC_BUSY);
+      else
+        API_SET_ERRNUM (ctx, IPMI_ERR_BAD_RMCPPLUS_STATUS_CODE);
+      return (-1);
+    }
 
-  /* achu & hliebig:
-   *
-   * Premise from ipmitool (http://ipmitool.sourceforge.net/)
-   *
-   * On some OSes (it seems Unixes), the behavior is to not return
-   * errors up to the client for UDP responses (i.e. you need to
-   * timeout).  But on some OSes (it seems Windows), the behavior is
-   * to return port denied errors up to the user for UDP responses.
-   *
-   * In addition (according to Ipmitool), a read may return
-   * ECONNREFUSED or ECONNRESET if both the OS and BMC respond to an
-   * IPMI request.
+  /* IPMI Workaround (achu)
    *
-   * If the ECONNREFUSED or ECONNRESET is from the OS, but we will get
-   * an IPMI response later, we just do the recvfrom again to get the
-   * packet we expect.
+   * Discovered on SE7520AF2 with Intel Server Management Module
+   * (Professional Edition)
    *
-   * If the ECONNREFUSED or ECONNRESET is from the OS but there is no
-   * BMC, just do the recvfrom again to give us the eventually
-   * timeout.
+   * The Intel's return IPMI_PRIVILEGE_LEVEL_HIGHEST_LEVEL instead
+   * of an actual privilege, so have to pass the actual privilege
+   * we want to use.
    */
+  if (ctx->workaround_flags_outofband_2_0 & IPMI_WORKAROUND_FLAGS_OUTOFBAND_2_0_INTEL_2_0_SESSION)
+    {
+      uint8_t maximum_privilege_level;
 
-  if (recv_len < 0
-      && (errno == ECONNRESET
-          || errno == ECONNREFUSED))
+      if (FIID_OBJ_GET (obj_cmd_rs,
+                        "maximum_privilege_level",
+                        &val) < 0)
+        {
+          API_FIID_OBJECT_ERROR_TO_API_ERRNUM (ctx, obj_cmd_rs);
+          return (-1);
+        }
+      maximum_privilege_level = val;
+
+      ret = (maximum_privilege_level == setup->requested_maximum_privilege) ? 1 : 0;
+    }
+  else
     {
-      recv_len = _api_lan_recvfrom (ctx,
-                                    pkt,
-                                    pkt_len,
-                                    retransmission_count,
-                                    &recv_starttime);
+      if ((ret = ipmi_check_open_session_maximum_privilege (ctx->io.outofband.privilege_level,
+                                                            obj_cmd_rs)) < 0)
+        {
+          API_ERRNO_TO_API_ERRNUM (ctx, errno);
+          return (-1);
+        }
+    }
 
-      if (!recv_len)
-        return (0); /* resend the request */
+  if (!ret)
+    {
+      API_SET_ERRNUM (ctx, IPMI_ERR_PRIVILEGE_LEVEL_CANNOT_BE_OBTAINED);
+      return (-1);
     }
 
-  if (recv_len < 0)
+  if (FIID_OBJ_GET (obj_cmd_rs,
+                    "managed_system_session_id",
+                    &val) < 0)
     {
-      API_ERRNO_TO_API_ERRNUM (ctx, errno);
+      API_FIID_OBJECT_ERROR_TO_API_ERRNUM (ctx, obj_cmd_rs);
       return (-1);
     }
+  ctx->io.outofband.managed_system_session_id = val;
 
-  return (recv_len);
+  setup->step = IPMI_SESSION_SETUP_RAKP_MESSAGE_1;
+  return (0);
 }
 
-/* < 0 - error
- * == 1 good packet
- * == 0 bad packet
+/* username as used in the RAKP 1 message, RAKP 2 check, and session
+ * key creation
  */
-static int
-_api_lan_2_0_cmd_wrapper_verify_packet (ipmi_ctx_t ctx,
-                                        uint8_t payload_type,
-                                        uint8_t *message_tag,
-                                        uint32_t *session_sequence_number,
-                                        uint32_t session_id,
-                                        uint8_t *rq_seq,
-                                        uint8_t integrity_algorithm,
-                                        const void *integrity_key,
-                                        unsigned int integrity_key_len,
-                                        const char *password,
-                                        unsigned int password_len,
-                                        fiid_obj_t obj_cmd_rs,
-                                        const void *pkt,
-                                        unsigned int pkt_len)
+static void
+_api_lan_2_0_rakp_username (ipmi_ctx_t ctx,
+                            char *username_buf,
+                            char **username,
+                            unsigned int *username_len)
 {
-  uint8_t l_payload_type;
-  uint32_t l_session_id;
-  uint8_t l_message_tag;
-  uint32_t rs_session_sequence_number;
-  uint8_t rmcpplus_status_code;
-  uint64_t val;
-  int ret, rv = -1;
-
   assert (ctx
           && ctx->magic == IPMI_CTX_MAGIC
           && ctx->type == IPMI_DEVICE_LAN_2_0
-          && ctx->io.outofband.sockfd
-          && (payload_type == IPMI_PAYLOAD_TYPE_IPMI
-              || payload_type == IPMI_PAYLOAD_TYPE_RMCPPLUS_OPEN_SESSION_REQUEST
-              || payload_type == IPMI_PAYLOAD_TYPE_RAKP_MESSAGE_1
-              || payload_type == IPMI_PAYLOAD_TYPE_RAKP_MESSAGE_3)
-          && IPMI_INTEGRITY_ALGORITHM_SUPPORTED (integrity_algorithm)
-          && !(password && password_len > IPMI_2_0_MAX_PASSWORD_LENGTH)
-          && fiid_obj_valid (obj_cmd_rs)
-          && pkt
-          && pkt_len);
+          && username_buf
+          && username
+          && username_len);
 
-  if (payload_type == IPMI_PAYLOAD_TYPE_IPMI)
+  /* IPMI Workaround (achu)
+   *
+   * Discovered on SE7520AF2 with Intel Server Management Module
+   * (Professional Edition)
+   *
+   * The username must be padded despite explicitly not being
+   * allowed.  "No Null characters (00h) are allowed in the name".
+   * Table 13-11 in the IPMI 2.0 spec.
+   *
+   * achu: This should only be done for RAKP 1 message, RAKP 2 check,
+   * and session key creation.
+   */
+  if (ctx->workaround_flags_outofband_2_0 & IPMI_WORKAROUND_FLAGS_OUTOFBAND_2_0_INTEL_2_0_SESSION)
     {
-      if (FIID_OBJ_GET (ctx->io.outofband.rs.obj_rmcpplus_session_hdr,
-                        "payload_type",
-                        &val) < 0)
-        {
-          API_FIID_OBJECT_ERROR_TO_API_ERRNUM (ctx, ctx->io.outofband.rs.obj_rmcpplus_session_hdr);
-          goto cleanup;
-        }
-      l_payload_type = val;
-
-      if (l_payload_type != IPMI_PAYLOAD_TYPE_IPMI)
-        {
-          rv = 0;
-          goto cleanup;
-        }
+      memset (username_buf, '\0', IPMI_MAX_USER_NAME_LENGTH+1);
+      if (strlen (ctx->io.outofband.username))
+        strcpy (username_buf, ctx->io.outofband.username);
+      (*username) = username_buf;
+      (*username_len) = IPMI_MAX_USER_NAME_LENGTH;
+    }
+  else
+    {
+      if (strlen (ctx->io.outofband.username))
+        (*username) = ctx->io.outofband.username;
+      else
+        (*username) = NULL;
+      (*username_len) = (*username) ? strlen (*username) : 0;
+    }
+}
 
-      if (FIID_OBJ_GET (ctx->io.outofband.rs.obj_rmcpplus_session_hdr,
-                        "session_id",
-                        &val) < 0)
-        {
-          API_FIID_OBJECT_ERROR_TO_API_ERRNUM (ctx, ctx->io.outofband.rs.obj_rmcpplus_session_hdr);
-          goto cleanup;
-        }
-      l_session_id = val;
+static int
+_api_lan_2_0_session_setup_rakp_message_1_rq (ipmi_ctx_t ctx,
+                                              struct ipmi_ctx_session_setup *setup,
+                                              struct ipmi_ctx_exchange *x)
+{
+  char *username;
+  char username_buf[IPMI_MAX_USER_NAME_LENGTH+1];
+  unsigned int username_len;
 
-      if (l_session_id != ctx->io.outofband.remote_console_session_id)
-        {
-          rv = 0;
-          goto cleanup;
-        }
+  assert (ctx
+          && ctx->magic == IPMI_CTX_MAGIC
+          && ctx->type == IPMI_DEVICE_LAN_2_0
+          && setup
+          && x);
 
-      /* IPMI Workaround (achu)
-       *
-       * Discovered on Supermicro X9SCM-iiF, Supermicro X9DRi-F
-       *
-       * Checksums are computed incorrectly.
-       */
-      if (!(ctx->workaround_flags_outofband_2_0 & IPMI_WORKAROUND_FLAGS_OUTOFBAND_2_0_NO_CHECKSUM_CHECK))
-        {
-          if ((ret = ipmi_lan_check_checksum (ctx->io.outofband.rs.obj_lan_msg_hdr,
-                                              obj_cmd_rs,
-                                              ctx->io.outofband.rs.obj_lan_msg_trlr)) < 0)
-            {
-              API_ERRNO_TO_API_ERRNUM (ctx, errno);
-              goto cleanup;
-            }
+  if (_api_lan_session_setup_objs (ctx,
+                                   setup,
+                                   tmpl_rmcpplus_rakp_message_1,
+                                   tmpl_rmcpplus_rakp_message_2) < 0)
+    return (-1);
 
-          if (!ret)
-            {
-              rv = 0;
-              goto cleanup;
-            }
-        }
+  if (ipmi_get_random (setup->remote_console_random_number,
+                       IPMI_REMOTE_CONSOLE_RANDOM_NUMBER_LENGTH) < 0)
+    {
+      API_ERRNO_TO_API_ERRNUM (ctx, errno);
+      return (-1);
+    }
 
-      if ((ret = ipmi_rmcpplus_check_packet_session_authentication_code (integrity_algorithm,
-                                                                         pkt,
-                                                                         pkt_len,
-                                                                         integrity_key,
-                                                                         integrity_key_len,
-                                                                         password,
-                                                                         password_len,
-                                                                         ctx->io.outofband.rs.obj_rmcpplus_session_trlr)) < 0)
-        {
-          API_ERRNO_TO_API_ERRNUM (ctx, errno);
-          goto cleanup;
-        }
+  _api_lan_2_0_rakp_username (ctx, username_buf, &username, &username_len);
 
-      if (!ret)
-        {
-          rv = 0;
-          goto cleanup;
-        }
+  /* achu: Unlike IPMI 1.5, the length of the username must be actual
+   * length, it can't be the maximum length.
+   */
+  if (fill_rmcpplus_rakp_message_1 (setup->message_tag,
+                                    ctx->io.outofband.managed_system_session_id,
+                                    setup->remote_console_random_number,
+                                    IPMI_REMOTE_CONSOLE_RANDOM_NUMBER_LENGTH,
+                                    ctx->io.outofband.privilege_level,
+                                    IPMI_NAME_ONLY_LOOKUP,
+                                    username,
+                                    username_len,
+                                    setup->obj_cmd_rq) < 0)
+    {
+      API_ERRNO_TO_API_ERRNUM (ctx, errno);
+      return (-1);
+    }
 
-      if (session_sequence_number)
-        {
-          if (FIID_OBJ_GET (ctx->io.outofband.rs.obj_rmcpplus_session_hdr,
-                            "session_sequence_number",
-                            &val) < 0)
-            {
-              API_FIID_OBJECT_ERROR_TO_API_ERRNUM (ctx, ctx->io.outofband.rs.obj_rmcpplus_session_hdr);
-              goto cleanup;
-            }
-          rs_session_sequence_number = val;
+  _api_lan_session_setup_exchange (ctx,
+                                   setup,
+                                   x,
+                                   IPMI_PAYLOAD_TYPE_RAKP_MESSAGE_1);
+  return (0);
+}
 
-          if ((ret = _ipmi_check_session_sequence_number (ctx,
-                                                          rs_session_sequence_number)) < 0)
-            {
-              API_ERRNO_TO_API_ERRNUM (ctx, errno);
-              goto cleanup;
-            }
+static int
+_api_lan_2_0_session_setup_rakp_message_2_rs (ipmi_ctx_t ctx,
+                                              struct ipmi_ctx_session_setup *setup)
+{
+  fiid_obj_t obj_cmd_rs;
+  uint8_t rmcpplus_status_code;
+  int managed_system_random_number_len;
+  int managed_system_guid_len;
+  int key_exchange_authentication_code_len;
+  char *username;
+  char username_buf[IPMI_MAX_USER_NAME_LENGTH+1];
+  unsigned int username_len;
+  char *password;
+  unsigned int password_len;
+  uint8_t name_only_lookup;
+  int ret;
+  uint64_t val;
 
-          if (!ret)
-            {
-              rv = 0;
-              goto cleanup;
-            }
-        }
+  assert (ctx
+          && ctx->magic == IPMI_CTX_MAGIC
+          && ctx->type == IPMI_DEVICE_LAN_2_0
+          && setup);
 
-      if ((ret = ipmi_lan_check_rq_seq (ctx->io.outofband.rs.obj_lan_msg_hdr,
-                                        (rq_seq) ? *rq_seq : 0)) < 0)
-        {
-          API_ERRNO_TO_API_ERRNUM (ctx, errno);
-          goto cleanup;
-        }
+  obj_cmd_rs = setup->obj_cmd_rs;
 
-      if (!ret)
-        {
-          rv = 0;
-          goto cleanup;
-        }
-    }
-  else if (payload_type == IPMI_PAYLOAD_TYPE_RMCPPLUS_OPEN_SESSION_REQUEST)
+  if (FIID_OBJ_GET (obj_cmd_rs,
+                    "rmcpplus_status_code",
+                    &val) < 0)
     {
-      if (FIID_OBJ_GET (ctx->io.outofband.rs.obj_rmcpplus_session_hdr,
-                        "payload_type",
-                        &val) < 0)
-        {
-          API_FIID_OBJECT_ERROR_TO_API_ERRNUM (ctx, ctx->io.outofband.rs.obj_rmcpplus_session_hdr);
-          goto cleanup;
-        }
-      l_payload_type = val;
+      API_FIID_OBJECT_ERROR_TO_API_ERRNUM (ctx, obj_cmd_rs);
+      return (-1);
+    }
+  rmcpplus_status_code = val;
 
-      if (l_payload_type != IPMI_PAYLOAD_TYPE_RMCPPLUS_OPEN_SESSION_RESPONSE)
-        {
-          rv = 0;
-          goto cleanup;
-        }
+  if (rmcpplus_status_code != RMCPPLUS_STATUS_NO_ERRORS)
+    {
+      if (rmcpplus_status_code == RMCPPLUS_STATUS_UNAUTHORIZED_NAME)
+        API_SET_ERRNUM (ctx, IPMI_ERR_USERNAME_INVALID);
+      else if (rmcpplus_status_code == RMCPPLUS_STATUS_UNAUTHORIZED_ROLE_OR_PRIVILEGE_LEVEL_REQUESTED)
+        API_SET_ERRNUM (ctx, IPMI_ERR_PRIVILEGE_LEVEL_CANNOT_BE_OBTAINED);
+      else if (rmcpplus_status_code == RMCPPLUS_STATUS_INSUFFICIENT_RESOURCES_TO_CREATE_A_SESSION
+               || rmcpplus_status_code == RMCPPLUS_STATUS_INSUFFICIENT_RESOURCES_TO_CREATE_A_SESSION_AT_THE_REQUESTED_TIME)
+        API_SET_ERRNUM (ctx, IPMI_ERR_BMC_BUSY);
+      else
+        API_SET_ERRNUM (ctx, IPMI_ERR_BAD_RMCPPLUS_STATUS_CODE);
+      return (-1);
+    }
 
-      if (message_tag)
-        {
-          if (FIID_OBJ_GET (obj_cmd_rs,
-                            "message_tag",
-                            &val) < 0)
-            {
-              API_FIID_OBJECT_ERROR_TO_API_ERRNUM (ctx, obj_cmd_rs);
-              goto cleanup;
-            }
-          l_message_tag = val;
+  if ((managed_system_random_number_len = fiid_obj_get_data (obj_cmd_rs,
+                                                             "managed_system_random_number",
+                                                             setup->managed_system_random_number,
+                                                             IPMI_MANAGED_SYSTEM_RANDOM_NUMBER_LENGTH)) < 0)
+    {
+      API_FIID_OBJECT_ERROR_TO_API_ERRNUM (ctx, obj_cmd_rs);
+      return (-1);
+    }
 
-          if (l_message_tag != *message_tag)
-            {
-              rv = 0;
-              goto cleanup;
-            }
-        }
+  if ((managed_system_guid_len = fiid_obj_get_data (obj_cmd_rs,
+                                                    "managed_system_guid",
+                                                    setup->managed_system_guid,
+                                                    IPMI_MANAGED_SYSTEM_GUID_LENGTH)) < 0)
+    {
+      API_FIID_OBJECT_ERROR_TO_API_ERRNUM (ctx, obj_cmd_rs);
+      return (-1);
+    }
 
-      /* There is no guarantee that other data (authentication keys,
-       * session id's, etc.) in the RAKP response will be valid if
-       * there is a status code error.  So we check this status code
-       * along with this stuff.
-       */
+  if (managed_system_random_number_len != IPMI_MANAGED_SYSTEM_RANDOM_NUMBER_LENGTH
+      || managed_system_guid_len != IPMI_MANAGED_SYSTEM_GUID_LENGTH)
+    {
+      API_SET_ERRNUM (ctx, IPMI_ERR_IPMI_ERROR);
+      return (-1);
+    }
+  setup->managed_system_random_number_len = managed_system_random_number_len;
+  setup->managed_system_guid_len = managed_system_guid_len;
 
-      if (FIID_OBJ_GET (obj_cmd_rs,
-                        "rmcpplus_status_code",
-                        &val) < 0)
-        {
-          API_FIID_OBJECT_ERROR_TO_API_ERRNUM (ctx, obj_cmd_rs);
-          goto cleanup;
-        }
-      rmcpplus_status_code = val;
+  _api_lan_2_0_rakp_username (ctx, username_buf, &username, &username_len);
 
-      if (FIID_OBJ_GET (obj_cmd_rs,
-                        "remote_console_session_id",
-                        &val) < 0)
-        {
-          API_FIID_OBJECT_ERROR_TO_API_ERRNUM (ctx, obj_cmd_rs);
-          goto cleanup;
-        }
-      l_session_id = val;
+  if (strlen (ctx->io.outofband.password))
+    password = ctx->io.outofband.password;
+  else
+    password = NULL;
+  password_len = (password) ? strlen (password) : 0;
 
-      if (rmcpplus_status_code == RMCPPLUS_STATUS_NO_ERRORS
-          && l_session_id != ctx->io.outofband.remote_console_session_id)
-        {
-          rv = 0;
-          goto cleanup;
-        }
+  /* IPMI Workaround (achu)
+   *
+   * Discovered on SE7520AF2 with Intel Server Management Module
+   * (Professional Edition)
+   *
+   * When the authentication algorithm is HMAC-MD5-128 and the
+   * password is greater than 16 bytes, the Intel BMC truncates the
+   * password to 16 bytes when generating keys, hashes, etc.  So we
+   * have to do the same when generating keys, hashes, etc.
+   */
+  if (ctx->workaround_flags_outofband_2_0 & IPMI_WORKAROUND_FLAGS_OUTOFBAND_2_0_INTEL_2_0_SESSION
+      && ctx->io.outofband.authentication_algorithm == IPMI_AUTHENTICATION_ALGORITHM_RAKP_HMAC_MD5
+      && password_len > IPMI_1_5_MAX_PASSWORD_LENGTH)
+    password_len = IPMI_1_5_MAX_PASSWORD_LENGTH;
 
-    }
-  else if (payload_type == IPMI_PAYLOAD_TYPE_RAKP_MESSAGE_1)
+  if (ctx->workaround_flags_outofband_2_0 & IPMI_WORKAROUND_FLAGS_OUTOFBAND_2_0_SUPERMICRO_2_0_SESSION)
     {
-      if (FIID_OBJ_GET (ctx->io.outofband.rs.obj_rmcpplus_session_hdr,
-                        "payload_type",
-                        &val) < 0)
-        {
-          API_FIID_OBJECT_ERROR_TO_API_ERRNUM (ctx, ctx->io.outofband.rs.obj_rmcpplus_session_hdr);
-          goto cleanup;
-        }
-      l_payload_type = val;
+      uint8_t keybuf[IPMI_MAX_PKT_LEN];
+      int keybuf_len;
 
-      if (l_payload_type != IPMI_PAYLOAD_TYPE_RAKP_MESSAGE_2)
+      /* IPMI Workaround (achu)
+       *
+       * Discovered on Supermicro H8QME with SIMSO daughter card.
+       *
+       * The IPMI 2.0 packet responses for RAKP 2 have payload lengths
+       * that are off by 1 (i.e. if the payload length should be X,
+       * the payload length returned in the packet is X + 1)
+       *
+       * We fix/adjust for the situation here.
+       */
+
+      if ((keybuf_len = fiid_obj_get_data (obj_cmd_rs,
+                                           "key_exchange_authentication_code",
+                                           keybuf,
+                                           IPMI_MAX_PKT_LEN)) < 0)
         {
-          rv = 0;
-          goto cleanup;
+          API_FIID_OBJECT_ERROR_TO_API_ERRNUM (ctx, obj_cmd_rs);
+          return (-1);
         }
 
-      if (message_tag)
+      if (ctx->io.outofband.authentication_algorithm == IPMI_AUTHENTICATION_ALGORITHM_RAKP_NONE
+          && keybuf_len == 1)
         {
-          if (FIID_OBJ_GET (obj_cmd_rs,
-                            "message_tag",
-                            &val) < 0)
+          if (fiid_obj_clear_field (obj_cmd_rs,
+                                    "key_exchange_authentication_code") < 0)
             {
               API_FIID_OBJECT_ERROR_TO_API_ERRNUM (ctx, obj_cmd_rs);
-              goto cleanup;
-            }
-          l_message_tag = val;
-
-          if (l_message_tag != *message_tag)
-            {
-              rv = 0;
-              goto cleanup;
+              return (-1);
             }
         }
-
-      /* There is no guarantee that other data (authentication keys,
-       * session id's, etc.) in the RAKP response will be valid if
-       * there is a status code error.  So we check this status code
-       * along with this stuff.
-       */
-
-      if (FIID_OBJ_GET (obj_cmd_rs,
-                        "rmcpplus_status_code",
-                        &val) < 0)
+      else if (ctx->io.outofband.authentication_algorithm == IPMI_AUTHENTICATION_ALGORITHM_RAKP_HMAC_SHA1
+               && keybuf_len == (IPMI_HMAC_SHA1_DIGEST_LENGTH + 1))
         {
-          API_FIID_OBJECT_ERROR_TO_API_ERRNUM (ctx, obj_cmd_rs);
-          goto cleanup;
+          if (fiid_obj_set_data (obj_cmd_rs,
+                                 "key_exchange_authentication_code",
+                                 keybuf,
+                                 IPMI_HMAC_SHA1_DIGEST_LENGTH) < 0)
+            {
+              API_FIID_OBJECT_ERROR_TO_API_ERRNUM (ctx, obj_cmd_rs);
+              return (-1);
+            }
         }
-      rmcpplus_status_code = val;
-
-      if (FIID_OBJ_GET (obj_cmd_rs,
-                        "remote_console_session_id",
-                        &val) < 0)
+      else if (ctx->io.outofband.authentication_algorithm == IPMI_AUTHENTICATION_ALGORITHM_RAKP_HMAC_MD5
+               && keybuf_len == (IPMI_HMAC_MD5_DIGEST_LENGTH + 1))
         {
-          API_FIID_OBJECT_ERROR_TO_API_ERRNUM (ctx, obj_cmd_rs);
-          goto cleanup;
+          if (fiid_obj_set_data (obj_cmd_rs,
+                                 "key_exchange_authentication_code",
+                                 keybuf,
+                                 IPMI_HMAC_MD5_DIGEST_LENGTH) < 0)
+            {
+              API_FIID_OBJECT_ERROR_TO_API_ERRNUM (ctx, obj_cmd_rs);
+              return (-1);
+            }
         }
-      l_session_id = val;
-
-      if (rmcpplus_status_code == RMCPPLUS_STATUS_NO_ERRORS
-          && l_session_id != ctx->io.outofband.remote_console_session_id)
+      else if (ctx->io.outofband.authentication_algorithm == IPMI_AUTHENTICATION_ALGORITHM_RAKP_HMAC_SHA256
+               && keybuf_len == (IPMI_HMAC_SHA256_DIGEST_LENGTH + 1))
         {
-          rv = 0;
-          goto cleanup;
+          if (fiid_obj_set_data (obj_cmd_rs,
+                                 "key_exchange_authentication_code",
+                                 keybuf,
+                                 IPMI_HMAC_SHA256_DIGEST_LENGTH) < 0)
+            {
+              API_FIID_OBJECT_ERROR_TO_API_ERRNUM (ctx, obj_cmd_rs);
+              return (-1);
+            }
         }
     }
-  else if (payload_type == IPMI_PAYLOAD_TYPE_RAKP_MESSAGE_3)
+
+  /* IPMI Workaround (achu)
+   *
+   * Discovered on Sun Fire 4100.
+   *
+   * The key exchange authentication code is the wrong length.  We
+   * need to shorten it.
+   *
+   * Notes: Cipher suite 1,2,3 are the ones that use HMAC-SHA1 and
+   * have the problem.
+   */
+  if (ctx->workaround_flags_outofband_2_0 & IPMI_WORKAROUND_FLAGS_OUTOFBAND_2_0_SUN_2_0_SESSION
+      && (ctx->io.outofband.authentication_algorithm == IPMI_AUTHENTICATION_ALGORITHM_RAKP_HMAC_SHA1))
     {
-      if (FIID_OBJ_GET (ctx->io.outofband.rs.obj_rmcpplus_session_hdr,
-                        "payload_type",
-                        &val) < 0)
-        {
-          API_FIID_OBJECT_ERROR_TO_API_ERRNUM (ctx, ctx->io.outofband.rs.obj_rmcpplus_session_hdr);
-          goto cleanup;
-        }
-      l_payload_type = val;
+      uint8_t buf[IPMI_MAX_KEY_EXCHANGE_AUTHENTICATION_CODE_LENGTH];
+      int buf_len;
 
-      if (l_payload_type != IPMI_PAYLOAD_TYPE_RAKP_MESSAGE_4)
+      if ((buf_len = fiid_obj_get_data (obj_cmd_rs,
+                                        "key_exchange_authentication_code",
+                                        buf,
+                                        IPMI_MAX_KEY_EXCHANGE_AUTHENTICATION_CODE_LENGTH)) < 0)
         {
-          rv = 0;
-          goto cleanup;
+          API_FIID_OBJECT_ERROR_TO_API_ERRNUM (ctx, obj_cmd_rs);
+          return (-1);
         }
 
-      if (message_tag)
+      if (buf_len == (IPMI_HMAC_SHA1_DIGEST_LENGTH + 1))
         {
-          if (FIID_OBJ_GET (obj_cmd_rs,
-                            "message_tag",
-                            &val) < 0)
+          if (fiid_obj_clear_field (obj_cmd_rs,
+                                    "key_exchange_authentication_code") < 0)
             {
               API_FIID_OBJECT_ERROR_TO_API_ERRNUM (ctx, obj_cmd_rs);
-              goto cleanup;
+              return (-1);
             }
-          l_message_tag = val;
 
-          if (l_message_tag != *message_tag)
+          if (fiid_obj_set_data (obj_cmd_rs,
+                                 "key_exchange_authentication_code",
+                                 buf,
+                                 IPMI_HMAC_SHA1_DIGEST_LENGTH) < 0)
             {
-              rv = 0;
-              goto cleanup;
+              API_FIID_OBJECT_ERROR_TO_API_ERRNUM (ctx, obj_cmd_rs);
+              return (-1);
             }
         }
+    }
 
-      /* There is no guarantee that other data (e.g. authentication
-       * keys, session id's, etc.) in the RAKP response will be valid
-       * if there is a status code error.  So we check this status
-       * code along with this stuff.
+  if ((ret = ipmi_rmcpplus_check_rakp_2_key_exchange_authentication_code (ctx->io.outofband.authentication_algorithm,
+                                                                          password,
+                                                                          password_len,
+                                                                          ctx->io.outofband.remote_console_session_id,
+                                                                          ctx->io.outofband.managed_system_session_id,
+                                                                          setup->remote_console_random_number,
+                                                                          IPMI_REMOTE_CONSOLE_RANDOM_NUMBER_LENGTH,
+                                                                          setup->managed_system_random_number,
+                                                                          managed_system_random_number_len,
+                                                                          setup->managed_system_guid,
+                                                                          managed_system_guid_len,
+                                                                          IPMI_NAME_ONLY_LOOKUP,
+                                                                          ctx->io.outofband.privilege_level,
+                                                                          username,
+                                                                          username_len,
+                                                                          obj_cmd_rs)) < 0)
+    {
+      API_ERRNO_TO_API_ERRNUM (ctx, errno);
+      return (-1);
+    }
+
+  if (!ret)
+    {
+      /* IPMI Compliance Issue
+       *
+       * On some systems, password could be correct, but privilege is
+       * too high.  The error is b/c the privilege error is not
+       * handled properly in the open session stage (i.e. they tell me
+       * I can authenticate at a high privilege level, that in reality
+       * is not allowed).  Dunno how to deal with this.
        */
+      API_SET_ERRNUM (ctx, IPMI_ERR_PASSWORD_INVALID);
+      return (-1);
+    }
 
-      if (FIID_OBJ_GET (obj_cmd_rs,
-                        "rmcpplus_status_code",
-                        &val) < 0)
-        {
-          API_FIID_OBJECT_ERROR_TO_API_ERRNUM (ctx, obj_cmd_rs);
-          goto cleanup;
-        }
-      rmcpplus_status_code = val;
+  /* achu: note, for INTEL_2_0 workaround, this must have the username/password adjustments */
+  if (ipmi_calculate_rmcpplus_session_keys (ctx->io.outofband.authentication_algorithm,
+                                            ctx->io.outofband.integrity_algorithm,
+                                            ctx->io.outofband.confidentiality_algorithm,
+                                            password,
+                                            password_len,
+                                            (ctx->io.outofband.k_g_configured) ? ctx->io.outofband.k_g : NULL,
+                                            (ctx->io.outofband.k_g_configured) ? IPMI_MAX_K_G_LENGTH : 0,
+                                            setup->remote_console_random_number,
+                                            IPMI_REMOTE_CONSOLE_RANDOM_NUMBER_LENGTH,
+                                            setup->managed_system_random_number,
+                                            IPMI_MANAGED_SYSTEM_RANDOM_NUMBER_LENGTH,
+                                            IPMI_NAME_ONLY_LOOKUP,
+                                            ctx->io.outofband.privilege_level,
+                                            username,
+                                            username_len,
+                                            &(ctx->io.outofband.sik_key_ptr),
+                                            &(ctx->io.outofband.sik_key_len),
+                                            &(ctx->io.outofband.integrity_key_ptr),
+                                            &(ctx->io.outofband.integrity_key_len),
+                                            &(ctx->io.outofband.confidentiality_key_ptr),
+                                            &(ctx->io.outofband.confidentiality_key_len)) < 0)
+    {
+      API_ERRNO_TO_API_ERRNUM (ctx, errno);
+      return (-1);
+    }
 
-      if (FIID_OBJ_GET (obj_cmd_rs,
-                        "remote_console_session_id",
-                        &val) < 0)
-        {
-          API_FIID_OBJECT_ERROR_TO_API_ERRNUM (ctx, obj_cmd_rs);
-          goto cleanup;
-        }
-      l_session_id = val;
+  /* achu: If INTEL_2_0 workaround is set, get back to original username &
+   * username_len, because that isn't needed for the RAKP3/4 part.
+   */
+  if (ctx->workaround_flags_outofband_2_0 & IPMI_WORKAROUND_FLAGS_OUTOFBAND_2_0_INTEL_2_0_SESSION)
+    {
+      if (strlen (ctx->io.outofband.username))
+        username = ctx->io.outofband.username;
+      else
+        username = NULL;
+      username_len = (username) ? strlen (username) : 0;
+    }
 
-      if (rmcpplus_status_code == RMCPPLUS_STATUS_NO_ERRORS
-          && l_session_id != ctx->io.outofband.remote_console_session_id)
-        {
-          rv = 0;
-          goto cleanup;
-        }
+  /* IPMI Workaround (achu)
+   *
+   * Discovered on SE7520AF2 with Intel Server Management Module
+   * (Professional Edition)
+   *
+   * For some reason we have to create this key with the name only
+   * lookup turned off.  I was skeptical about this actually being
+   * a bug until I saw that the ipmitool folks implemented the
+   * same workaround.
+   */
+  if (ctx->workaround_flags_outofband_2_0 & IPMI_WORKAROUND_FLAGS_OUTOFBAND_2_0_INTEL_2_0_SESSION)
+    name_only_lookup = IPMI_USER_NAME_PRIVILEGE_LOOKUP;
+  else
+    name_only_lookup = IPMI_NAME_ONLY_LOOKUP;
+
+  if ((key_exchange_authentication_code_len = ipmi_calculate_rakp_3_key_exchange_authentication_code (ctx->io.outofband.authentication_algorithm,
+                                                                                                      password,
+                                                                                                      password_len,
+                                                                                                      setup->managed_system_random_number,
+                                                                                                      managed_system_random_number_len,
+                                                                                                      ctx->io.outofband.remote_console_session_id,
+                                                                                                      name_only_lookup,
+                                                                                                      ctx->io.outofband.privilege_level,
+                                                                                                      username,
+                                                                                                      username_len,
+                                                                                                      setup->key_exchange_authentication_code,
+                                                                                                      IPMI_MAX_KEY_EXCHANGE_AUTHENTICATION_CODE_LENGTH)) < 0)
+    {
+      API_ERRNO_TO_API_ERRNUM (ctx, errno);
+      return (-1);
     }
 
-  rv = 1;
- cleanup:
-  return (rv);
+  setup->key_exchange_authentication_code_len = key_exchange_authentication_code_len;
+
+  setup->step = IPMI_SESSION_SETUP_RAKP_MESSAGE_3;
+  return (0);
 }
 
-int
-api_lan_2_0_cmd_wrapper (ipmi_ctx_t ctx,
-                         unsigned int internal_workaround_flags,
-                         uint8_t lun,
-                         uint8_t net_fn,
-                         uint8_t payload_type,
-                         uint8_t payload_authenticated,
-                         uint8_t payload_encrypted,
-                         uint8_t *message_tag,
-                         uint32_t *session_sequence_number,
-                         uint32_t session_id,
-                         uint8_t *rq_seq,
-                         uint8_t authentication_algorithm,
-                         uint8_t integrity_algorithm,
-                         uint8_t confidentiality_algorithm,
-                         const void *integrity_key,
-                         unsigned int integrity_key_len,
-                         const void *confidentiality_key,
-                         unsigned int confidentiality_key_len,
-                         const char *password,
-                         unsigned int password_len,
-                         fiid_obj_t obj_cmd_rq,
-                         fiid_obj_t obj_cmd_rs)
+static int
+_api_lan_2_0_session_setup_rakp_message_3_rq (ipmi_ctx_t ctx,
+                                              struct ipmi_ctx_session_setup *setup,
+                                              struct ipmi_ctx_exchange *x)
 {
-  int recv_len, ret, rv = -1;
-  unsigned int retransmission_count = 0;
-  uint8_t pkt[IPMI_MAX_PKT_LEN];
-  uint8_t cmd = 0;             /* used for debugging */
-  uint8_t group_extension = 0; /* used for debugging */
+  assert (ctx
+          && ctx->magic == IPMI_CTX_MAGIC
+          && ctx->type == IPMI_DEVICE_LAN_2_0
+          && setup
+          && x);
+
+  if (_api_lan_session_setup_objs (ctx,
+                                   setup,
+                                   tmpl_rmcpplus_rakp_message_3,
+                                   tmpl_rmcpplus_rakp_message_4) < 0)
+    return (-1);
+
+  if (fill_rmcpplus_rakp_message_3 (setup->message_tag,
+                                    RMCPPLUS_STATUS_NO_ERRORS,
+                                    ctx->io.outofband.managed_system_session_id,
+                                    setup->key_exchange_authentication_code,
+                                    setup->key_exchange_authentication_code_len,
+                                    setup->obj_cmd_rq) < 0)
+    {
+      API_ERRNO_TO_API_ERRNUM (ctx, errno);
+      return (-1);
+    }
+
+  _api_lan_session_setup_exchange (ctx,
+                                   setup,
+                                   x,
+                                   IPMI_PAYLOAD_TYPE_RAKP_MESSAGE_3);
+  return (0);
+}
+
+static int
+_api_lan_2_0_session_setup_rakp_message_4_rs (ipmi_ctx_t ctx,
+                                              struct ipmi_ctx_session_setup *setup)
+{
+  fiid_obj_t obj_cmd_rs;
+  uint8_t rmcpplus_status_code;
+  uint8_t authentication_algorithm = 0; /* init to 0 to remove gcc warning */
+  int ret;
   uint64_t val;
-  unsigned int intf_flags = IPMI_INTERFACE_FLAGS_DEFAULT;
 
   assert (ctx
           && ctx->magic == IPMI_CTX_MAGIC
           && ctx->type == IPMI_DEVICE_LAN_2_0
-          && ctx->io.outofband.sockfd
-          && IPMI_BMC_LUN_VALID (lun)
-          && IPMI_NET_FN_VALID (net_fn)
-          && (payload_type == IPMI_PAYLOAD_TYPE_IPMI
-              || payload_type == IPMI_PAYLOAD_TYPE_RMCPPLUS_OPEN_SESSION_REQUEST
-              || payload_type == IPMI_PAYLOAD_TYPE_RAKP_MESSAGE_1
-              || payload_type == IPMI_PAYLOAD_TYPE_RAKP_MESSAGE_3)
-          && IPMI_PAYLOAD_AUTHENTICATED_FLAG_VALID (payload_authenticated)
-          && IPMI_PAYLOAD_ENCRYPTED_FLAG_VALID (payload_encrypted)
-          && (!message_tag
-              || (payload_type == IPMI_PAYLOAD_TYPE_RMCPPLUS_OPEN_SESSION_REQUEST
-                  || payload_type == IPMI_PAYLOAD_TYPE_RAKP_MESSAGE_1
-                  || payload_type == IPMI_PAYLOAD_TYPE_RAKP_MESSAGE_3))
-          && IPMI_AUTHENTICATION_ALGORITHM_SUPPORTED (authentication_algorithm)
-          && IPMI_INTEGRITY_ALGORITHM_SUPPORTED (integrity_algorithm)
-          && IPMI_CONFIDENTIALITY_ALGORITHM_SUPPORTED (confidentiality_algorithm)
-          && !(password && password_len > IPMI_2_0_MAX_PASSWORD_LENGTH)
-          && fiid_obj_valid (obj_cmd_rq)
-          && fiid_obj_packet_valid (obj_cmd_rq) == 1
-          && fiid_obj_valid (obj_cmd_rs));
+          && setup);
+
+  obj_cmd_rs = setup->obj_cmd_rs;
+
+  if (FIID_OBJ_GET (obj_cmd_rs,
+                    "rmcpplus_status_code",
+                    &val) < 0)
+    {
+      API_FIID_OBJECT_ERROR_TO_API_ERRNUM (ctx, obj_cmd_rs);
+      return (-1);
+    }
+  rmcpplus_status_code = val;
+
+  if (rmcpplus_status_code != RMCPPLUS_STATUS_NO_ERRORS)
+    {
+      if (rmcpplus_status_code == RMCPPLUS_STATUS_INSUFFICIENT_RESOURCES_TO_CREATE_A_SESSION
+          || rmcpplus_status_code == RMCPPLUS_STATUS_INSUFFICIENT_RESOURCES_TO_CREATE_A_SESSION_AT_THE_REQUESTED_TIME)
+        API_SET_ERRNUM (ctx, IPMI_ERR_BMC_BUSY);
+      else if (rmcpplus_status_code == RMCPPLUS_STATUS_INVALID_INTEGRITY_CHECK_VALUE)
+        /* XXX: achu: some systems, password could be correct, but
+         * privilege used in hashing is incorrect on the BMC side
+         * (OPEN_SESSION_PRIVILEGE workaround).
+         */
+        API_SET_ERRNUM (ctx, IPMI_ERR_PASSWORD_INVALID);
+      else
+        API_SET_ERRNUM (ctx, IPMI_ERR_BAD_RMCPPLUS_STATUS_CODE);
+      return (-1);
+    }
 
-  if (ctx->flags & IPMI_FLAGS_NO_LEGAL_CHECK)
-    intf_flags |= IPMI_INTERFACE_FLAGS_NO_LEGAL_CHECK;
+  /* IPMI Workaround (achu)
+   *
+   * Discovered on SE7520AF2 with Intel Server Management Module
+   * (Professional Edition)
+   *
+   * For some reason, the intel ipmi 2.0 responds with the integrity
+   * check value based on the integrity algorithm instead of the
+   * authentication algorithm.
+   *
+   * Thanks to the ipmitool folks (ipmitool.sourceforge.net) for this
+   * one.  Would have taken me awhile to figure this one out :-)
+   */
 
-  if (!ctx->io.outofband.last_received.tv_sec
-      && !ctx->io.outofband.last_received.tv_usec)
+  if (ctx->workaround_flags_outofband_2_0 & IPMI_WORKAROUND_FLAGS_OUTOFBAND_2_0_INTEL_2_0_SESSION)
     {
-      if (gettimeofday (&ctx->io.outofband.last_received, NULL) < 0)
+      if (ctx->io.outofband.integrity_algorithm == IPMI_INTEGRITY_ALGORITHM_NONE)
+        authentication_algorithm = IPMI_AUTHENTICATION_ALGORITHM_RAKP_NONE;
+      else if (ctx->io.outofband.integrity_algorithm == IPMI_INTEGRITY_ALGORITHM_HMAC_SHA1_96)
+        authentication_algorithm = IPMI_AUTHENTICATION_ALGORITHM_RAKP_HMAC_SHA1;
+      else if (ctx->io.outofband.integrity_algorithm == IPMI_INTEGRITY_ALGORITHM_HMAC_MD5_128)
+        authentication_algorithm = IPMI_AUTHENTICATION_ALGORITHM_RAKP_HMAC_MD5;
+      else if (ctx->io.outofband.integrity_algorithm == IPMI_INTEGRITY_ALGORITHM_MD5_128)
         {
-          API_ERRNO_TO_API_ERRNUM (ctx, errno);
+          /* achu: I have thus far been unable to reverse engineer this
+           * corner case.  Since we cannot provide a reasonable two
+           * part authentication, we're going to error out.
+           */
+          API_SET_ERRNUM (ctx, IPMI_ERR_IPMI_ERROR);
           return (-1);
         }
     }
+  else
+    authentication_algorithm = ctx->io.outofband.authentication_algorithm;
 
-  if (ctx->flags & IPMI_FLAGS_DEBUG_DUMP)
-    {
-      /* ignore error, continue on */
-      if (FIID_OBJ_GET (obj_cmd_rq,
-                        "cmd",
-                        &val) < 0)
-        API_FIID_OBJECT_ERROR_TO_API_ERRNUM (ctx, obj_cmd_rq);
-      else
-        cmd = val;
+  /* IPMI Workaround (achu)
+   *
+   * Discovered on Supermicro X8DTG, Supermicro X8DTU, Intel
+   * S5500WBV/Penguin Relion 700
+   *
+   * For whatever reason, with cipher suite 0, the RAKP 4 response
+   * returns with an Integrity Check Value when it should be empty.
+   */
 
-      if (IPMI_NET_FN_GROUP_EXTENSION (net_fn))
+  if (ctx->workaround_flags_outofband_2_0 & IPMI_WORKAROUND_FLAGS_OUTOFBAND_2_0_NON_EMPTY_INTEGRITY_CHECK_VALUE
+      && !ctx->io.outofband.cipher_suite_id)
+    {
+      if (fiid_obj_clear_field (obj_cmd_rs,
+                                "integrity_check_value") < 0)
         {
-          /* ignore error, continue on */
-          if (FIID_OBJ_GET (obj_cmd_rq,
-                            "group_extension_identification",
-                            &val) < 0)
-            API_FIID_OBJECT_ERROR_TO_API_ERRNUM (ctx, obj_cmd_rq);
-          else
-            group_extension = val;
+          API_FIID_OBJECT_ERROR_TO_API_ERRNUM (ctx, obj_cmd_rs);
+          return (-1);
         }
     }
 
-  if (_api_lan_2_0_cmd_send (ctx,
-                             lun,
-                             net_fn,
-                             payload_type,
-                             payload_authenticated,
-                             payload_encrypted,
-                             (session_sequence_number) ? *session_sequence_number : 0,
-                             session_id,
-                             (rq_seq) ? *rq_seq : 0,
-                             authentication_algorithm,
-                             integrity_algorithm,
-                             confidentiality_algorithm,
-                             integrity_key,
-                             integrity_key_len,
-                             confidentiality_key,
-                             confidentiality_key_len,
-                             password,
-                             password_len,
-                             cmd, /* for debug dumping */
-                             group_extension, /* for debug dumping */
-                             obj_cmd_rq) < 0)
-    goto cleanup;
+  if ((ret = ipmi_rmcpplus_check_rakp_4_integrity_check_value (authentication_algorithm,
+                                                               ctx->io.outofband.sik_key_ptr,
+                                                               ctx->io.outofband.sik_key_len,
+                                                               setup->remote_console_random_number,
+                                                               IPMI_REMOTE_CONSOLE_RANDOM_NUMBER_LENGTH,
+                                                               ctx->io.outofband.managed_system_session_id,
+                                                               setup->managed_system_guid,
+                                                               setup->managed_system_guid_len,
+                                                               obj_cmd_rs)) < 0)
+    {
+      API_ERRNO_TO_API_ERRNUM (ctx, errno);
+      return (-1);
+    }
 
-  while (1)
+  if (!ret)
     {
-      if ((ret = _session_timed_out (ctx)) < 0)
-        break;
+      API_SET_ERRNUM (ctx, IPMI_ERR_K_G_INVALID);
+      return (-1);
+    }
 
-      if (ret)
-        {
-          API_SET_ERRNUM (ctx, IPMI_ERR_SESSION_TIMEOUT);
-          break;
-        }
+  setup->step = IPMI_SESSION_SETUP_SET_SESSION_PRIVILEGE_LEVEL;
+  return (0);
+}
 
-      /* its ok to use the "request" net_fn, dump code doesn't care */
-      if ((recv_len = _api_lan_2_0_cmd_recv (ctx,
-                                             authentication_algorithm,
-                                             integrity_algorithm,
-                                             confidentiality_algorithm,
-                                             integrity_key,
-                                             integrity_key_len,
-                                             confidentiality_key,
-                                             confidentiality_key_len,
-                                             pkt,
-                                             IPMI_MAX_PKT_LEN,
-                                             retransmission_count)) < 0)
-        break;
+/* if privilege_level == IPMI_PRIVILEGE_LEVEL_USER we shouldn't have
+ * to call this, b/c it should be USER by default.  But I don't
+ * trust IPMI implementations.  Do it anyways.
+ */
 
-      if (!recv_len)
-        {
-          /* ignore timeout, just cleanly close session */
-          if (internal_workaround_flags & IPMI_INTERNAL_WORKAROUND_FLAGS_CLOSE_SESSION_SKIP_RETRANSMIT)
-            {
-              rv = 0;
-              break;
-            }
+/* achu: At this point in time, the session is actually setup
+ * legitimately, so the request is sent within the session just as
+ * ipmi_cmd_set_session_privilege_level() would send it.
+ */
+static int
+_api_lan_session_setup_set_session_privilege_level_rq (ipmi_ctx_t ctx,
+                                                       struct ipmi_ctx_session_setup *setup,
+                                                       struct ipmi_ctx_exchange *x)
+{
+  assert (ctx
+          && ctx->magic == IPMI_CTX_MAGIC
+          && (ctx->type == IPMI_DEVICE_LAN
+              || ctx->type == IPMI_DEVICE_LAN_2_0)
+          && setup
+          && x);
 
-          if (message_tag)
-            (*message_tag)++;
-          /* In IPMI 2.0, session sequence numbers of 0 are special */
-          if (session_sequence_number)
-            {
-              (*session_sequence_number)++;
-              if (!(*session_sequence_number))
-                (*session_sequence_number)++;
-            }
-          if (rq_seq)
-            *rq_seq = ((*rq_seq) + 1) % (IPMI_LAN_REQUESTER_SEQUENCE_NUMBER_MAX + 1);
+  if (_api_lan_session_setup_objs (ctx,
+                                   setup,
+                                   tmpl_cmd_set_session_privilege_level_rq,
+                                   tmpl_cmd_set_session_privilege_level_rs) < 0)
+    return (-1);
 
-          retransmission_count++;
+  if (fill_cmd_set_session_privilege_level (ctx->io.outofband.privilege_level,
+                                            setup->obj_cmd_rq) < 0)
+    {
+      API_ERRNO_TO_API_ERRNUM (ctx, errno);
+      return (-1);
+    }
 
-          if (payload_type == IPMI_PAYLOAD_TYPE_RMCPPLUS_OPEN_SESSION_REQUEST
-              || payload_type == IPMI_PAYLOAD_TYPE_RAKP_MESSAGE_1
-              || payload_type == IPMI_PAYLOAD_TYPE_RAKP_MESSAGE_3)
-            {
-              /* Unlike most packets, the open session request, rakp 1
-               * and rakp 3 messages have the message tags in a
-               * non-header field.  So this is a special case.
-               */
-              if (fiid_obj_set (obj_cmd_rq, "message_tag", (*message_tag)) < 0)
-                {
-                  API_FIID_OBJECT_ERROR_TO_API_ERRNUM (ctx, obj_cmd_rq);
-                  goto cleanup;
-                }
-            }
+  _api_lan_session_exchange (ctx,
+                             x,
+                             IPMI_BMC_IPMB_LUN_BMC,
+                             IPMI_NET_FN_APP_RQ,
+                             setup->obj_cmd_rq,
+                             setup->obj_cmd_rs);
+  return (0);
+}
 
-          if (_api_lan_2_0_cmd_send (ctx,
-                                     lun,
-                                     net_fn,
-                                     payload_type,
-                                     payload_authenticated,
-                                     payload_encrypted,
-                                     (session_sequence_number) ? *session_sequence_number : 0,
-                                     session_id,
-                                     (rq_seq) ? *rq_seq : 0,
-                                     authentication_algorithm,
-                                     integrity_algorithm,
-                                     confidentiality_algorithm,
-                                     integrity_key,
-                                     integrity_key_len,
-                                     confidentiality_key,
-                                     confidentiality_key_len,
-                                     password,
-                                     password_len,
-                                     cmd, /* for debug dumping */
-                                     group_extension, /* for debug dumping */
-                                     obj_cmd_rq) < 0)
-            goto cleanup;
+static int
+_api_lan_session_setup_set_session_privilege_level_rs (ipmi_ctx_t ctx,
+                                                       struct ipmi_ctx_session_setup *setup)
+{
+  assert (ctx
+          && ctx->magic == IPMI_CTX_MAGIC
+          && (ctx->type == IPMI_DEVICE_LAN
+              || ctx->type == IPMI_DEVICE_LAN_2_0)
+          && setup);
 
-          continue;
+  if (api_ipmi_cmd_post (ctx, setup->obj_cmd_rs) < 0)
+    {
+      if (ctx->errnum == IPMI_ERR_BAD_COMPLETION_CODE)
+        {
+          if (ipmi_check_completion_code (setup->obj_cmd_rs, IPMI_COMP_CODE_SET_SESSION_PRIVILEGE_LEVEL_REQUESTED_LEVEL_NOT_AVAILABLE_FOR_USER) == 1
+              || ipmi_check_completion_code (setup->obj_cmd_rs, IPMI_COMP_CODE_SET_SESSION_PRIVILEGE_LEVEL_REQUESTED_LEVEL_EXCEEDS_USER_PRIVILEGE_LIMIT) == 1)
+            API_SET_ERRNUM (ctx, IPMI_ERR_PRIVILEGE_LEVEL_CANNOT_BE_OBTAINED);
         }
+      ERR_TRACE (ipmi_ctx_strerror (ctx->errnum), ctx->errnum);
+      return (-1);
+    }
 
-      /* else received a packet */
-
-      if (ctx->flags & IPMI_FLAGS_DEBUG_DUMP)
-        _api_lan_2_0_dump_rs (ctx,
-                              authentication_algorithm,
-                              integrity_algorithm,
-                              confidentiality_algorithm,
-                              integrity_key,
-                              integrity_key_len,
-                              confidentiality_key,
-                              confidentiality_key_len,
-                              pkt,
-                              recv_len,
-                              cmd,
-                              net_fn,
-                              group_extension,
-                              obj_cmd_rs);
+  setup->step = IPMI_SESSION_SETUP_DONE;
+  return (0);
+}
 
-      if ((ret = unassemble_ipmi_rmcpplus_pkt (authentication_algorithm,
-                                               integrity_algorithm,
-                                               confidentiality_algorithm,
-                                               integrity_key,
-                                               integrity_key_len,
-                                               confidentiality_key,
-                                               confidentiality_key_len,
-                                               pkt,
-                                               recv_len,
-                                               ctx->io.outofband.rs.obj_rmcp_hdr,
-                                               ctx->io.outofband.rs.obj_rmcpplus_session_hdr,
-                                               ctx->io.outofband.rs.obj_rmcpplus_payload,
-                                               ctx->io.outofband.rs.obj_lan_msg_hdr,
-                                               obj_cmd_rs,
-                                               ctx->io.outofband.rs.obj_lan_msg_trlr,
-                                               ctx->io.outofband.rs.obj_rmcpplus_session_trlr,
-                                               intf_flags)) < 0)
-        {
-          API_ERRNO_TO_API_ERRNUM (ctx, errno);
-          return (-1);
-        }
+/* With use_cache set, a session cache record of the BMC stands in
+ * for the Get Channel Authentication Capabilities exchange.
+ */
+static int
+_api_lan_session_setup_init (ipmi_ctx_t ctx,
+                             struct ipmi_ctx_session_setup *setup,
+                             int use_cache)
+{
+  uint8_t per_msg_auth_disabled;
 
-      if (!ret)
-        continue;
+  assert (ctx
+          && ctx->magic == IPMI_CTX_MAGIC
+          && ctx->io.outofband.sockfd
+          && (ctx->type == IPMI_DEVICE_LAN
+              || ctx->type == IPMI_DEVICE_LAN_2_0)
+          && setup);
 
-      if ((ret = _api_lan_2_0_cmd_wrapper_verify_packet (ctx,
-                                                         payload_type,
-                                                         message_tag,
-                                                         session_sequence_number,
-                                                         session_id,
-                                                         rq_seq,
-                                                         integrity_algorithm,
-                                                         integrity_key,
-                                                         integrity_key_len,
-                                                         password,
-                                                         password_len,
-                                                         obj_cmd_rs,
-                                                         pkt,
-                                                         recv_len)) < 0)
-        goto cleanup;
+  memset (setup, '\0', sizeof (struct ipmi_ctx_session_setup));
+  setup->step = IPMI_SESSION_SETUP_GET_CHANNEL_AUTHENTICATION_CAPABILITIES;
 
-      if (!ret)
-        continue;
+  if (_api_lan_rq_seq_init (ctx) < 0)
+    return (-1);
 
-      if (gettimeofday (&ctx->io.outofband.last_received, NULL) < 0)
+  if (ctx->type == IPMI_DEVICE_LAN)
+    {
+      if (ctx->flags & IPMI_FLAGS_NOSESSION)
         {
-          API_ERRNO_TO_API_ERRNUM (ctx, errno);
-          goto cleanup;
+          ctx->io.outofband.authentication_type = IPMI_AUTHENTICATION_TYPE_NONE;
+          setup->step = IPMI_SESSION_SETUP_DONE;
         }
-
-      rv = 0;
-      break;
     }
-
- cleanup:
-  if (message_tag)
-    (*message_tag)++;
-  /* In IPMI 2.0, session sequence numbers of 0 are special */
-  if (session_sequence_number)
-    {
-      (*session_sequence_number)++;
-      if (!(*session_sequence_number))
-        (*session_sequence_number)++;
+  else
+    /* Unlike IPMI 1.5, there is no initial sequence number negotiation, so we don't
+     * start at a random sequence number.
+     */
+    ctx->io.outofband.session_sequence_number = 1;
+
+  if (use_cache
+      && setup->step != IPMI_SESSION_SETUP_DONE
+      && api_lan_session_cache_load (ctx, &per_msg_auth_disabled))
+    {
+      setup->cached = 1;
+      setup->per_msg_auth_disabled = per_msg_auth_disabled;
+      if (ctx->type == IPMI_DEVICE_LAN)
+        {
+          ctx->io.outofband.per_msg_auth_disabled = per_msg_auth_disabled;
+          setup->step = IPMI_SESSION_SETUP_GET_SESSION_CHALLENGE;
+        }
+      else
+        setup->step = IPMI_SESSION_SETUP_OPEN_SESSION;
     }
-  if (rq_seq)
-    *rq_seq = ((*rq_seq) + 1) % (IPMI_LAN_REQUESTER_SEQUENCE_NUMBER_MAX + 1);
-  return (rv);
+
+  return (0);
 }
 
-int
-api_lan_2_0_cmd_wrapper_ipmb (ipmi_ctx_t ctx,
-                              fiid_obj_t obj_cmd_rq,
-                              fiid_obj_t obj_cmd_rs)
+static void
+_api_lan_session_setup_cleanup (struct ipmi_ctx_session_setup *setup)
 {
-  int recv_len, ret, rv = -1;
-  unsigned int retransmission_count = 0;
-  uint8_t pkt[IPMI_MAX_PKT_LEN];
-  uint8_t cmd = 0;             /* used for debugging */
-  uint8_t group_extension = 0; /* used for debugging */
-  uint8_t rq_seq_orig;
-  uint64_t val;
-  unsigned int intf_flags = IPMI_INTERFACE_FLAGS_DEFAULT;
-  fiid_obj_t obj_send_rs = NULL;
-  ipmi_errnum_type_t obj_rs_errnum;
+  assert (setup);
+
+  fiid_obj_destroy (setup->obj_cmd_rq);
+  fiid_obj_destroy (setup->obj_cmd_rs);
+  /* secure_memset b/c setup contains key exchange data */
+  secure_memset (setup, '\0', sizeof (struct ipmi_ctx_session_setup));
+}
+
+/* setup the exchange for the current step */
+static int
+_api_lan_session_setup_rq (ipmi_ctx_t ctx,
+                           struct ipmi_ctx_session_setup *setup,
+                           struct ipmi_ctx_exchange *x)
+{
+  int rv = -1;
 
   assert (ctx
           && ctx->magic == IPMI_CTX_MAGIC
-          && ctx->type == IPMI_DEVICE_LAN_2_0
-          && ctx->io.outofband.sockfd
-          && fiid_obj_valid (obj_cmd_rq)
-          && fiid_obj_packet_valid (obj_cmd_rq) == 1
-          && fiid_obj_valid (obj_cmd_rs));
-
-  if (ctx->flags & IPMI_FLAGS_NO_LEGAL_CHECK)
-    intf_flags |= IPMI_INTERFACE_FLAGS_NO_LEGAL_CHECK;
+          && (ctx->type == IPMI_DEVICE_LAN
+              || ctx->type == IPMI_DEVICE_LAN_2_0)
+          && setup
+          && x);
 
-  if (ctx->flags & IPMI_FLAGS_DEBUG_DUMP)
+  switch (setup->step)
     {
-      /* ignore error, continue on */
-      if (FIID_OBJ_GET (obj_cmd_rq,
-                        "cmd",
-                        &val) < 0)
-        API_FIID_OBJECT_ERROR_TO_API_ERRNUM (ctx, obj_cmd_rq);
-      else
-        cmd = val;
-
-      if (IPMI_NET_FN_GROUP_EXTENSION (ctx->target.net_fn))
-        {
-          /* ignore error, continue on */
-          if (FIID_OBJ_GET (obj_cmd_rq,
-                            "group_extension_identification",
-                            &val) < 0)
-            API_FIID_OBJECT_ERROR_TO_API_ERRNUM (ctx, obj_cmd_rq);
-          else
-            group_extension = val;
-        }
+    case IPMI_SESSION_SETUP_GET_CHANNEL_AUTHENTICATION_CAPABILITIES:
+      rv = _api_lan_session_setup_authentication_capabilities_rq (ctx, setup, x);
+      break;
+    case IPMI_SESSION_SETUP_GET_SESSION_CHALLENGE:
+      rv = _api_lan_session_setup_get_session_challenge_rq (ctx, setup, x);
+      break;
+    case IPMI_SESSION_SETUP_ACTIVATE_SESSION:
+      rv = _api_lan_session_setup_activate_session_rq (ctx, setup, x);
+      break;
+    case IPMI_SESSION_SETUP_OPEN_SESSION:
+      rv = _api_lan_2_0_session_setup_open_session_rq (ctx, setup, x);
+      break;
+    case IPMI_SESSION_SETUP_RAKP_MESSAGE_1:
+      rv = _api_lan_2_0_session_setup_rakp_message_1_rq (ctx, setup, x);
+      break;
+    case IPMI_SESSION_SETUP_RAKP_MESSAGE_3:
+      rv = _api_lan_2_0_session_setup_rakp_message_3_rq (ctx, setup, x);
+      break;
+    case IPMI_SESSION_SETUP_SET_SESSION_PRIVILEGE_LEVEL:
+      rv = _api_lan_session_setup_set_session_privilege_level_rq (ctx, setup, x);
+      break;
+    default:
+      API_SET_ERRNUM (ctx, IPMI_ERR_INTERNAL_ERROR);
+      return (-1);
     }
 
-  /* for debugging */
-  ctx->tmpl_ipmb_cmd_rq = fiid_obj_template (obj_cmd_rq);
-  ctx->tmpl_ipmb_cmd_rs = fiid_obj_template (obj_cmd_rs);
+  if (rv < 0)
+    return (-1);
 
-  /* ipmb response packet will use the request sequence number from
-   * the earlier packet.  Save it for verification.
-   */
+  x->stats = &(ctx->stats.session_setup[setup->step]);
+  return (0);
+}
 
-  rq_seq_orig = ctx->io.outofband.rq_seq;
+/* check the response of the current step and move to the next one */
+static int
+_api_lan_session_setup_rs (ipmi_ctx_t ctx, struct ipmi_ctx_session_setup *setup)
+{
+  int step;
+  int rv = -1;
 
-  if (_ipmi_cmd_send_ipmb (ctx,
-                           obj_cmd_rq,
-                           &obj_send_rs,
-                           &obj_rs_errnum) < 0)
-    goto cleanup;
+  assert (ctx
+          && ctx->magic == IPMI_CTX_MAGIC
+          && (ctx->type == IPMI_DEVICE_LAN
+              || ctx->type == IPMI_DEVICE_LAN_2_0)
+          && setup);
 
-  while (1)
+  /* the response advances the step */
+  step = setup->step;
+
+  switch (step)
     {
-      uint8_t payload_authenticated;
-      uint8_t payload_encrypted;
+    case IPMI_SESSION_SETUP_GET_CHANNEL_AUTHENTICATION_CAPABILITIES:
+      if (ctx->type == IPMI_DEVICE_LAN)
+        rv = _api_lan_session_setup_authentication_capabilities_rs (ctx, setup);
+      else
+        rv = _api_lan_2_0_session_setup_authentication_capabilities_rs (ctx, setup);
+      break;
+    case IPMI_SESSION_SETUP_GET_SESSION_CHALLENGE:
+      rv = _api_lan_session_setup_get_session_challenge_rs (ctx, setup);
+      break;
+    case IPMI_SESSION_SETUP_ACTIVATE_SESSION:
+      rv = _api_lan_session_setup_activate_session_rs (ctx, setup);
+      break;
+    case IPMI_SESSION_SETUP_OPEN_SESSION:
+      rv = _api_lan_2_0_session_setup_open_session_rs (ctx, setup);
+      break;
+    case IPMI_SESSION_SETUP_RAKP_MESSAGE_1:
+      rv = _api_lan_2_0_session_setup_rakp_message_2_rs (ctx, setup);
+      break;
+    case IPMI_SESSION_SETUP_RAKP_MESSAGE_3:
+      rv = _api_lan_2_0_session_setup_rakp_message_4_rs (ctx, setup);
+      break;
+    case IPMI_SESSION_SETUP_SET_SESSION_PRIVILEGE_LEVEL:
+      rv = _api_lan_session_setup_set_session_privilege_level_rs (ctx, setup);
+      break;
+    default:
+      API_SET_ERRNUM (ctx, IPMI_ERR_INTERNAL_ERROR);
+      return (-1);
+    }
 
-      if ((ret = _session_timed_out (ctx)) < 0)
-        break;
+  if (rv < 0)
+    ctx->stats.session_setup[step].errors++;
 
-      if (ret)
-        {
-          API_SET_ERRNUM (ctx, IPMI_ERR_SESSION_TIMEOUT);
-          break;
-        }
+  return (rv);
+}
 
-      /* its ok to use the "request" net_fn, dump code doesn't care */
-      if ((recv_len = _api_lan_2_0_cmd_recv (ctx,
-                                             ctx->io.outofband.authentication_algorithm,
-                                             ctx->io.outofband.integrity_algorithm,
-                                             ctx->io.outofband.confidentiality_algorithm,
-                                             ctx->io.outofband.integrity_key_ptr,
-                                             ctx->io.outofband.integrity_key_len,
-                                             ctx->io.outofband.confidentiality_key_ptr,
-                                             ctx->io.outofband.confidentiality_key_len,
-                                             pkt,
-                                             IPMI_MAX_PKT_LEN,
-                                             retransmission_count)) < 0)
-        {
-          rv = -1;
-          break;
-        }
+/* adjust errnum after a failed exchange of the current step */
+static void
+_api_lan_session_setup_exchange_error (ipmi_ctx_t ctx,
+                                       struct ipmi_ctx_session_setup *setup)
+{
+  assert (ctx
+          && ctx->magic == IPMI_CTX_MAGIC
+          && setup);
 
-      if (!recv_len)
-        {
-          retransmission_count++;
+  /* at this point in the protocol, we set a connection timeout.  A
+   * setup started from the session cache has no authentication
+   * capabilities exchange, its first exchange counts instead.
+   */
+  if ((setup->step == IPMI_SESSION_SETUP_GET_CHANNEL_AUTHENTICATION_CAPABILITIES
+       || (setup->cached
+           && (setup->step == IPMI_SESSION_SETUP_GET_SESSION_CHALLENGE
+               || setup->step == IPMI_SESSION_SETUP_OPEN_SESSION)))
+      && ctx->errnum == IPMI_ERR_SESSION_TIMEOUT)
+    API_SET_ERRNUM (ctx, IPMI_ERR_CONNECTION_TIMEOUT);
+  else if (setup->step == IPMI_SESSION_SETUP_ACTIVATE_SESSION
+           && ctx->errnum == IPMI_ERR_SESSION_TIMEOUT)
+    API_SET_ERRNUM (ctx, IPMI_ERR_PASSWORD_VERIFICATION_TIMEOUT);
+  else if (setup->step == IPMI_SESSION_SETUP_SET_SESSION_PRIVILEGE_LEVEL)
+    ERR_TRACE (ipmi_ctx_strerror (ctx->errnum), ctx->errnum);
+}
 
-          /* don't increment sequence numbers, will be done in _ipmi_cmd_send_ipmb */
+/* After a failed setup started from the session cache, forget the
+ * record and negotiate from the start.  A BMC that did not answer
+ * at all is not asked again.  Returns 1 if the setup was restarted,
+ * 0 if the failure stands, -1 on error.
+ */
+static int
+_api_lan_session_setup_fallback (ipmi_ctx_t ctx,
+                                 struct ipmi_ctx_session_setup *setup)
+{
+  assert (ctx
+          && ctx->magic == IPMI_CTX_MAGIC
+          && setup);
 
-          /* ipmb response packet will use the request sequence number from
-           * the earlier packet.  Save it for verification.
-           */
+  if (!setup->cached
+      || ctx->errnum == IPMI_ERR_CONNECTION_TIMEOUT)
+    return (0);
 
-          rq_seq_orig = ctx->io.outofband.rq_seq;
+  api_lan_session_cache_invalidate (ctx);
 
-          if (obj_send_rs) {
-            fiid_obj_destroy (obj_send_rs);
-            obj_send_rs = NULL;
-          }
+  /* the negotiation gets a session timeout of its own */
+  timerclear (&(ctx->io.outofband.last_received));
 
-          if (_ipmi_cmd_send_ipmb (ctx,
-                                   obj_cmd_rq,
-                                   &obj_send_rs,
-                                   &obj_rs_errnum) < 0)
-            goto cleanup;
+  _api_lan_session_setup_cleanup (setup);
+  if (_api_lan_session_setup_init (ctx, setup, 0) < 0)
+    return (-1);
 
-          continue;
-        }
+  return (1);
+}
 
-      /* else received a packet */
+/* record a session negotiated from the start in the session cache */
+static void
+_api_lan_session_setup_done (ipmi_ctx_t ctx,
+                             struct ipmi_ctx_session_setup *setup)
+{
+  assert (ctx
+          && ctx->magic == IPMI_CTX_MAGIC
+          && setup
+          && setup->step == IPMI_SESSION_SETUP_DONE);
 
-      if (ctx->flags & IPMI_FLAGS_DEBUG_DUMP)
-        _api_lan_2_0_dump_rs (ctx,
-                              ctx->io.outofband.authentication_algorithm,
-                              ctx->io.outofband.integrity_algorithm,
-                              ctx->io.outofband.confidentiality_algorithm,
-                              ctx->io.outofband.integrity_key_ptr,
-                              ctx->io.outofband.integrity_key_len,
-                              ctx->io.outofband.confidentiality_key_ptr,
-                              ctx->io.outofband.confidentiality_key_len,
-                              pkt,
-                              recv_len,
-                              cmd,
-                              ctx->target.net_fn,
-                              group_extension,
-                              obj_cmd_rs);
+  if (setup->cached
+      || (ctx->type == IPMI_DEVICE_LAN
+          && (ctx->flags & IPMI_FLAGS_NOSESSION)))
+    return;
 
-      if ((ret = unassemble_ipmi_rmcpplus_pkt (ctx->io.outofband.authentication_algorithm,
-                                               ctx->io.outofband.integrity_algorithm,
-                                               ctx->io.outofband.confidentiality_algorithm,
-                                               ctx->io.outofband.integrity_key_ptr,
-                                               ctx->io.outofband.integrity_key_len,
-                                               ctx->io.outofband.confidentiality_key_ptr,
-                                               ctx->io.outofband.confidentiality_key_len,
-                                               pkt,
-                                               recv_len,
-                                               ctx->io.outofband.rs.obj_rmcp_hdr,
-                                               ctx->io.outofband.rs.obj_rmcpplus_session_hdr,
-                                               ctx->io.outofband.rs.obj_rmcpplus_payload,
-                                               ctx->io.outofband.rs.obj_lan_msg_hdr,
-                                               obj_cmd_rs,
-                                               ctx->io.outofband.rs.obj_lan_msg_trlr,
-                                               ctx->io.outofband.rs.obj_rmcpplus_session_trlr,
-                                               intf_flags)) < 0)
-        {
-          API_ERRNO_TO_API_ERRNUM (ctx, errno);
-          return (-1);
-        }
+  api_lan_session_cache_store (ctx, setup->per_msg_auth_disabled);
+}
 
-      if (!ret)
-        continue;
+static int
+_api_lan_session_setup_run (ipmi_ctx_t ctx)
+{
+  struct ipmi_ctx_session_setup setup;
+  struct ipmi_ctx_exchange x;
+  int rv = -1;
 
-      api_lan_2_0_cmd_get_session_parameters (ctx,
-                                              &payload_authenticated,
-                                              &payload_encrypted);
+  assert (ctx
+          && ctx->magic == IPMI_CTX_MAGIC
+          && ctx->io.outofband.sockfd
+          && (ctx->type == IPMI_DEVICE_LAN
+              || ctx->type == IPMI_DEVICE_LAN_2_0));
 
-      if ((ret = _api_lan_2_0_cmd_wrapper_verify_packet (ctx,
-                                                         IPMI_PAYLOAD_TYPE_IPMI,
-                                                         NULL,
-                                                         &(ctx->io.outofband.session_sequence_number),
-                                                         ctx->io.outofband.managed_system_session_id,
-                                                         &rq_seq_orig,
-                                                         ctx->io.outofband.integrity_algorithm,
-                                                         ctx->io.outofband.integrity_key_ptr,
-                                                         ctx->io.outofband.integrity_key_len,
-                                                         strlen (ctx->io.outofband.password) ? ctx->io.outofband.password : NULL,
-                                                         strlen (ctx->io.outofband.password),
-                                                         obj_cmd_rs,
-                                                         pkt,
-                                                         recv_len)) < 0)
-        goto cleanup;
+  if (_api_lan_session_setup_init (ctx, &setup, 1) < 0)
+    goto cleanup;
 
-      if (!ret)
-        continue;
+  while (setup.step != IPMI_SESSION_SETUP_DONE)
+    {
+      if (_api_lan_session_setup_rq (ctx, &setup, &x) < 0)
+        goto cleanup;
 
-      if (gettimeofday (&(ctx->io.outofband.last_received), NULL) < 0)
+      if (_api_lan_exchange_run (ctx, &x) < 0)
         {
-          API_ERRNO_TO_API_ERRNUM (ctx, errno);
-          goto cleanup;
+          _api_lan_session_setup_exchange_error (ctx, &setup);
+          if (_api_lan_session_setup_fallback (ctx, &setup) <= 0)
+            goto cleanup;
+          continue;
         }
 
-      if (_ipmi_check_ipmb_out_of_order (ctx,
-                                         obj_cmd_rq,
-                                         obj_cmd_rs,
-                                         obj_send_rs,
-                                         obj_rs_errnum) < 0)
-        goto cleanup;
-
-      rv = 0;
-      break;
+      if (_api_lan_session_setup_rs (ctx, &setup) < 0)
+        {
+          if (_api_lan_session_setup_fallback (ctx, &setup) <= 0)
+            goto cleanup;
+        }
     }
 
- cleanup:
-  ctx->io.outofband.session_sequence_number++;
-  /* rq_seq already incremented via _ipmi_cmd_send_ipmb call */
-  fiid_template_free (ctx->tmpl_ipmb_cmd_rq);
-  ctx->tmpl_ipmb_cmd_rq = NULL;
-  fiid_template_free (ctx->tmpl_ipmb_cmd_rs);
-  ctx->tmpl_ipmb_cmd_rs = NULL;
-  fiid_obj_destroy (obj_send_rs);
+  _api_lan_session_setup_done (ctx, &setup);
 
+  rv = 0;
+ cleanup:
+  _api_lan_session_setup_cleanup (&setup);
   return (rv);
 }
 
 int
-api_lan_2_0_open_session (ipmi_ctx_t ctx)
+api_lan_open_session (ipmi_ctx_t ctx)
 {
-  fiid_obj_t obj_cmd_rq = NULL;
-  fiid_obj_t obj_cmd_rs = NULL;
-  uint8_t rmcpplus_status_code;
-  uint8_t remote_console_random_number[IPMI_REMOTE_CONSOLE_RANDOM_NUMBER_LENGTH];
-  uint8_t managed_system_random_number[IPMI_MANAGED_SYSTEM_RANDOM_NUMBER_LENGTH];
-  int managed_system_random_number_len;
-  uint8_t managed_system_guid[IPMI_MANAGED_SYSTEM_GUID_LENGTH];
-  int managed_system_guid_len;
-  uint8_t key_exchange_authentication_code[IPMI_MAX_KEY_EXCHANGE_AUTHENTICATION_CODE_LENGTH];
-  int key_exchange_authentication_code_len;
-  uint8_t message_tag;
-  char *username;
-  char username_buf[IPMI_MAX_USER_NAME_LENGTH+1];
-  unsigned int username_len;
-  char *password;
-  unsigned int password_len;
-  uint8_t authentication_algorithm = 0; /* init to 0 to remove gcc warning */
-  uint8_t requested_maximum_privilege;
-  uint8_t name_only_lookup;
-  char *tmp_username_ptr = NULL;
-  char *tmp_password_ptr = NULL;
-  void *tmp_k_g_ptr = NULL;
-  int ret, rv = -1;
-  uint64_t val;
+  assert (ctx
+          && ctx->magic == IPMI_CTX_MAGIC
+          && ctx->io.outofband.sockfd
+          && ctx->type == IPMI_DEVICE_LAN
+          && strlen (ctx->io.outofband.username) <= IPMI_MAX_USER_NAME_LENGTH
+          && strlen (ctx->io.outofband.password) <= IPMI_1_5_MAX_PASSWORD_LENGTH
+          && IPMI_1_5_AUTHENTICATION_TYPE_VALID (ctx->io.outofband.authentication_type)
+          && IPMI_PRIVILEGE_LEVEL_VALID (ctx->io.outofband.privilege_level));
 
+  return (_api_lan_session_setup_run (ctx));
+}
+
+int
+api_lan_2_0_open_session (ipmi_ctx_t ctx)
+{
   assert (ctx
           && ctx->magic == IPMI_CTX_MAGIC
           && ctx->io.outofband.sockfd
@@ -3407,973 +5141,976 @@ api_lan_2_0_open_session (ipmi_ctx_t ctx)
           && ctx->io.outofband.confidentiality_key_ptr == ctx->io.outofband.confidentiality_key
           && ctx->io.outofband.confidentiality_key_len == IPMI_MAX_CONFIDENTIALITY_KEY_LENGTH);
 
-  if (_api_lan_rq_seq_init (ctx) < 0)
-    goto cleanup;
+  return (_api_lan_session_setup_run (ctx));
+}
 
-  /* Unlike IPMI 1.5, there is no initial sequence number negotiation, so we don't
-   * start at a random sequence number.
-   */
-  ctx->io.outofband.session_sequence_number = 1;
+int
+api_lan_2_0_close_session (ipmi_ctx_t ctx)
+{
+  fiid_obj_t obj_cmd_rq = NULL;
+  fiid_obj_t obj_cmd_rs = NULL;
+  uint8_t payload_authenticated;
+  uint8_t payload_encrypted;
+  unsigned int internal_workaround_flags = 0;
+  int ret, rv = -1;
+
+  /* Do not use ipmi_cmd_close_session(), we use a close session retransmit workaround */
 
-  if (!(obj_cmd_rq = fiid_obj_create (tmpl_cmd_get_channel_authentication_capabilities_rq)))
+  assert (ctx
+          && ctx->magic == IPMI_CTX_MAGIC
+          && ctx->type == IPMI_DEVICE_LAN_2_0
+          && ctx->io.outofband.sockfd);
+
+  if (!(obj_cmd_rq = fiid_obj_create (tmpl_cmd_close_session_rq)))
     {
       API_ERRNO_TO_API_ERRNUM (ctx, errno);
-      goto cleanup;
+      return (-1);
     }
-  if (!(obj_cmd_rs = fiid_obj_create (tmpl_cmd_get_channel_authentication_capabilities_rs)))
+
+  if (!(obj_cmd_rs = fiid_obj_create (tmpl_cmd_close_session_rs)))
     {
       API_ERRNO_TO_API_ERRNUM (ctx, errno);
-      goto cleanup;
+      return (-1);
     }
 
-  if (fill_cmd_get_channel_authentication_capabilities (IPMI_CHANNEL_NUMBER_CURRENT_CHANNEL,
-                                                        ctx->io.outofband.privilege_level,
-                                                        IPMI_GET_IPMI_V20_EXTENDED_DATA,
-                                                        obj_cmd_rq) < 0)
+  if (fill_cmd_close_session (ctx->io.outofband.managed_system_session_id,
+                              NULL,
+                              obj_cmd_rq) < 0)
     {
       API_ERRNO_TO_API_ERRNUM (ctx, errno);
       goto cleanup;
     }
 
-  /* This portion of the protocol is sent via IPMI 1.5 */
-  if (api_lan_cmd_wrapper (ctx,
-                           0,
-                           IPMI_BMC_IPMB_LUN_BMC,
-                           IPMI_NET_FN_APP_RQ,
-                           IPMI_AUTHENTICATION_TYPE_NONE,
-                           0,
-                           NULL,
-                           0,
-                           &(ctx->io.outofband.rq_seq),
-                           NULL,
-                           0,
-                           obj_cmd_rq,
-                           obj_cmd_rs) < 0)
-    {
-      /* at this point in the protocol, we set a connection timeout */
-      if (ctx->errnum == IPMI_ERR_SESSION_TIMEOUT)
-        API_SET_ERRNUM (ctx, IPMI_ERR_CONNECTION_TIMEOUT);
-      goto cleanup;
-    }
+  api_lan_2_0_cmd_get_session_parameters (ctx,
+                                          &payload_authenticated,
+                                          &payload_encrypted);
+
+  internal_workaround_flags |= IPMI_INTERNAL_WORKAROUND_FLAGS_CLOSE_SESSION_SKIP_RETRANSMIT;
+
+  if (api_lan_2_0_cmd_wrapper (ctx,
+                               internal_workaround_flags,
+                               IPMI_BMC_IPMB_LUN_BMC,
+                               IPMI_NET_FN_APP_RQ,
+                               IPMI_PAYLOAD_TYPE_IPMI,
+                               payload_authenticated,
+                               payload_encrypted,
+                               NULL,
+                               &(ctx->io.outofband.session_sequence_number),
+                               ctx->io.outofband.managed_system_session_id,
+                               &(ctx->io.outofband.rq_seq),
+                               ctx->io.outofband.authentication_algorithm,
+                               ctx->io.outofband.integrity_algorithm,
+                               ctx->io.outofband.confidentiality_algorithm,
+                               ctx->io.outofband.integrity_key_ptr,
+                               ctx->io.outofband.integrity_key_len,
+                               ctx->io.outofband.confidentiality_key_ptr,
+                               ctx->io.outofband.confidentiality_key_len,
+                               strlen (ctx->io.outofband.password) ? ctx->io.outofband.password : NULL,
+                               strlen (ctx->io.outofband.password),
+                               obj_cmd_rq,
+                               obj_cmd_rs) < 0)
+    goto cleanup;
+
+  /* Check completion code just for tracing, but don't return error */
 
-  if ((ret = ipmi_check_authentication_capabilities_ipmi_2_0 (obj_cmd_rs)) < 0)
+  if ((ret = ipmi_check_completion_code_success (obj_cmd_rs)) < 0)
     {
       API_ERRNO_TO_API_ERRNUM (ctx, errno);
-      goto cleanup;
+      goto out;
     }
 
   if (!ret)
     {
-      ctx->errnum = IPMI_ERR_IPMI_2_0_UNAVAILABLE;
-      goto cleanup;
+      API_BAD_RESPONSE_TO_API_ERRNUM (ctx, obj_cmd_rs);
+      goto out;
     }
 
-  /* IPMI Workaround
-   *
-   * Discovered on an ASUS P5M2 motherboard.
-   *
-   * The ASUS motherboard reports incorrect settings of anonymous
-   * vs. null vs non-null username capabilities.  The workaround is to
-   * skip all these checks.
-   *
-   * Discovered on an ASUS P5MT-R motherboard
-   *
-   * K_g status is reported incorrectly too.  Again, skip the checks.
-   */
-  if (!(ctx->workaround_flags_outofband_2_0 & IPMI_WORKAROUND_FLAGS_OUTOFBAND_2_0_AUTHENTICATION_CAPABILITIES))
-    {
-      if (strlen (ctx->io.outofband.username))
-        tmp_username_ptr = ctx->io.outofband.username;
+ out:
+  rv = 0;
+ cleanup:
+  fiid_obj_destroy (obj_cmd_rq);
+  fiid_obj_destroy (obj_cmd_rs);
+  return (rv);
+}
 
-      if (strlen (ctx->io.outofband.password))
-        tmp_password_ptr = ctx->io.outofband.password;
+static int
+_api_lan_async_exchange_start (ipmi_ctx_t ctx)
+{
+  struct ipmi_ctx_async *async;
 
-      if ((ret = ipmi_check_authentication_capabilities_username (tmp_username_ptr,
-                                                                  tmp_password_ptr,
-                                                                  obj_cmd_rs)) < 0)
-        {
-          API_ERRNO_TO_API_ERRNUM (ctx, errno);
-          goto cleanup;
-        }
+  assert (ctx
+          && ctx->magic == IPMI_CTX_MAGIC
+          && (ctx->type == IPMI_DEVICE_LAN
+              || ctx->type == IPMI_DEVICE_LAN_2_0)
+          && ctx->io.outofband.async.op == IPMI_CTX_ASYNC_OP_OPEN_SESSION);
 
-      if (!ret)
-        {
-          ctx->errnum = IPMI_ERR_USERNAME_INVALID;
-          goto cleanup;
-        }
+  async = &(ctx->io.outofband.async);
 
-      if (ctx->io.outofband.k_g_configured)
-        tmp_k_g_ptr = ctx->io.outofband.k_g;
+  if (_api_lan_session_setup_rq (ctx, &(async->setup), &(async->exchange)) < 0)
+    return (-1);
 
-      if ((ret = ipmi_check_authentication_capabilities_k_g (tmp_k_g_ptr,
-                                                             obj_cmd_rs)) < 0)
-        {
-          API_ERRNO_TO_API_ERRNUM (ctx, errno);
-          goto cleanup;
-        }
+  /* exchange must be finished even if the first send fails */
+  async->exchange.sockets = NULL;
+  async->in_exchange = 1;
 
-      if (!ret)
-        {
-          API_SET_ERRNUM (ctx, IPMI_ERR_K_G_INVALID);
-          goto cleanup;
-        }
-    }
+  return (_api_lan_exchange_start (ctx, &(async->exchange)));
+}
 
-  fiid_obj_destroy (obj_cmd_rq);
-  obj_cmd_rq = NULL;
-  fiid_obj_destroy (obj_cmd_rs);
-  obj_cmd_rs = NULL;
+int
+api_lan_async_open_session (ipmi_ctx_t ctx)
+{
+  struct ipmi_ctx_async *async;
 
-  if (!(obj_cmd_rq = fiid_obj_create (tmpl_rmcpplus_open_session_request)))
-    {
-      API_ERRNO_TO_API_ERRNUM (ctx, errno);
-      goto cleanup;
-    }
-  if (!(obj_cmd_rs = fiid_obj_create (tmpl_rmcpplus_open_session_response)))
-    {
-      API_ERRNO_TO_API_ERRNUM (ctx, errno);
-      goto cleanup;
-    }
+  assert (ctx
+          && ctx->magic == IPMI_CTX_MAGIC
+          && ctx->io.outofband.sockfd
+          && (ctx->type == IPMI_DEVICE_LAN
+              || ctx->type == IPMI_DEVICE_LAN_2_0)
+          && ctx->io.outofband.async.op == IPMI_CTX_ASYNC_OP_NONE);
 
-  message_tag = (uint8_t)rand ();
+  async = &(ctx->io.outofband.async);
 
-  /* In IPMI 2.0, session_ids of 0 are special */
-  do
-    {
-      if (ipmi_get_random (&(ctx->io.outofband.remote_console_session_id),
-                           sizeof (ctx->io.outofband.remote_console_session_id)) < 0)
-        {
-          API_ERRNO_TO_API_ERRNUM (ctx, errno);
-          goto cleanup;
-        }
-    } while (!ctx->io.outofband.remote_console_session_id);
+  async->op = IPMI_CTX_ASYNC_OP_OPEN_SESSION;
 
-  if (ipmi_cipher_suite_id_to_algorithms (ctx->io.outofband.cipher_suite_id,
-                                          &(ctx->io.outofband.authentication_algorithm),
-                                          &(ctx->io.outofband.integrity_algorithm),
-                                          &(ctx->io.outofband.confidentiality_algorithm)) < 0)
-    {
-      API_ERRNO_TO_API_ERRNUM (ctx, errno);
-      goto cleanup;
-    }
+  if (_api_lan_session_setup_init (ctx, &(async->setup), 1) < 0)
+    return (-1);
 
-  /*
-   * IPMI Workaround (achu)
-   *
-   * Forgotten Motherboard
-   *
-   * Cipher suite IDs are attached to specific privilege levels
-   * rather than a maximum privilege level limit.  So you can only
-   * authenticate at the configured privilege level rather than a
-   * privilege level <= to it.
-   *
-   * To deal with this situation.  We send the "request highest
-   * privilege" flag in the open session request.  This should be
-   * enough to work around this issue but still work with other
-   * motherboards.
+  /* no session to setup, completes on the first call to
+   * api_lan_async_process()
    */
+  if (async->setup.step == IPMI_SESSION_SETUP_DONE)
+    return (0);
 
-  /* IPMI Workaround (achu)
-   *
-   * Discovered on SE7520AF2 with Intel Server Management Module
-   * (Professional Edition)
-   *
-   * The Intel's return IPMI_PRIVILEGE_LEVEL_HIGHEST_LEVEL instead
-   * of an actual privilege, so have to pass the actual privilege
-   * we want to use.
-   */
+  return (_api_lan_async_exchange_start (ctx));
+}
 
-  /* IPMI Workaround (achu)
-   *
-   * Discovered on Sun Fire 4100, Inventec 5441/Dell Xanadu II,
-   * Supermicro X8DTH, Supermicro X8DTG, Supermicro X8DTU, Intel
-   * S5500WBV/Penguin Relion 700
-   *
-   * The remote BMC incorrectly calculates keys using the privilege
-   * specified in the open session stage rather than the privilege
-   * used during the RAKP1 stage.  This can be problematic if you
-   * specify IPMI_PRIVILEGE_LEVEL_HIGHEST_LEVEL during that stage
-   * instead of a real privilege level.  So we must pass the actual
-   * privilege we want to use.
-   */
-  if (ctx->workaround_flags_outofband_2_0 & IPMI_WORKAROUND_FLAGS_OUTOFBAND_2_0_INTEL_2_0_SESSION
-      || ctx->workaround_flags_outofband_2_0 & IPMI_WORKAROUND_FLAGS_OUTOFBAND_2_0_SUN_2_0_SESSION
-      || ctx->workaround_flags_outofband_2_0 & IPMI_WORKAROUND_FLAGS_OUTOFBAND_2_0_OPEN_SESSION_PRIVILEGE)
-    requested_maximum_privilege = ctx->io.outofband.privilege_level;
-  else
-    requested_maximum_privilege = IPMI_PRIVILEGE_LEVEL_HIGHEST_LEVEL;
+static int
+_api_lan_async_rq_seq_in_use (ipmi_ctx_t ctx,
+                              struct ipmi_ctx_async_rq *rq,
+                              uint8_t rq_seq)
+{
+  unsigned int i;
 
-  if (fill_rmcpplus_open_session (message_tag,
-                                  requested_maximum_privilege,
-                                  ctx->io.outofband.remote_console_session_id,
-                                  ctx->io.outofband.authentication_algorithm,
-                                  ctx->io.outofband.integrity_algorithm,
-                                  ctx->io.outofband.confidentiality_algorithm,
-                                  obj_cmd_rq) < 0)
+  assert (ctx
+          && ctx->magic == IPMI_CTX_MAGIC
+          && rq);
+
+  for (i = 0; i < IPMI_ASYNC_WINDOW_MAX; i++)
     {
-      API_ERRNO_TO_API_ERRNUM (ctx, errno);
-      goto cleanup;
+      if (&(ctx->io.outofband.async.rq[i]) != rq
+          && ctx->io.outofband.async.rq[i].state == IPMI_CTX_ASYNC_RQ_PENDING
+          && ctx->io.outofband.async.rq[i].rq_seq == rq_seq)
+        return (1);
     }
 
-  if (api_lan_2_0_cmd_wrapper (ctx,
-                               0,
-                               IPMI_BMC_IPMB_LUN_BMC, /* doesn't actually matter here */
-                               IPMI_NET_FN_APP_RQ, /* doesn't actually matter here */
-                               IPMI_PAYLOAD_TYPE_RMCPPLUS_OPEN_SESSION_REQUEST,
-                               IPMI_PAYLOAD_FLAG_UNAUTHENTICATED,
-                               IPMI_PAYLOAD_FLAG_UNENCRYPTED,
-                               &message_tag,
-                               NULL,
-                               0,
-                               NULL,
-                               IPMI_AUTHENTICATION_ALGORITHM_RAKP_NONE,
-                               IPMI_INTEGRITY_ALGORITHM_NONE,
-                               IPMI_CONFIDENTIALITY_ALGORITHM_NONE,
-                               NULL,
-                               0,
-                               NULL,
-                               0,
-                               NULL,
-                               0,
-                               obj_cmd_rq,
-                               obj_cmd_rs) < 0)
-    goto cleanup;
+  return (0);
+}
 
-  if (FIID_OBJ_GET (obj_cmd_rs,
-                    "rmcpplus_status_code",
-                    &val) < 0)
-    {
-      API_FIID_OBJECT_ERROR_TO_API_ERRNUM (ctx, obj_cmd_rs);
-      goto cleanup;
-    }
-  rmcpplus_status_code = val;
+/* send or resend the request of a command of the window
+ *
+ * Each transmission takes the next requester and session sequence
+ * numbers of the session, so all requests in flight are distinct
+ * and responses to earlier transmissions are ignored.
+ */
+static int
+_api_lan_async_rq_send (ipmi_ctx_t ctx, struct ipmi_ctx_async_rq *rq)
+{
+  struct ipmi_ctx_exchange *x;
 
-  if (rmcpplus_status_code != RMCPPLUS_STATUS_NO_ERRORS)
-    {
-      if (rmcpplus_status_code == RMCPPLUS_STATUS_NO_CIPHER_SUITE_MATCH_WITH_PROPOSED_SECURITY_ALGORITHMS)
-        API_SET_ERRNUM (ctx, IPMI_ERR_CIPHER_SUITE_ID_UNAVAILABLE);
-      else if (rmcpplus_status_code == RMCPPLUS_STATUS_INVALID_ROLE)
-        API_SET_ERRNUM (ctx, IPMI_ERR_PRIVILEGE_LEVEL_CANNOT_BE_OBTAINED);
-      else if (rmcpplus_status_code == RMCPPLUS_STATUS_INSUFFICIENT_RESOURCES_TO_CREATE_A_SESSION
-               || rmcpplus_status_code == RMCPPLUS_STATUS_INSUFFICIENT_RESOURCES_TO_CREATE_A_SESSION_AT_THE_REQUESTED_TIME)
-        API_SET_ERRNUM (ctx, IPMI_ERR_BMC_BUSY);
-      else
-        API_SET_ERRNUM (ctx, IPMI_ERR_BAD_RMCPPLUS_STATUS_CODE);
-      goto cleanup;
-    }
+  assert (ctx
+          && ctx->magic == IPMI_CTX_MAGIC
+          && (ctx->type == IPMI_DEVICE_LAN
+              || ctx->type == IPMI_DEVICE_LAN_2_0)
+          && rq
+          && rq->state == IPMI_CTX_ASYNC_RQ_PENDING);
 
-  /* IPMI Workaround (achu)
-   *
-   * Discovered on SE7520AF2 with Intel Server Management Module
-   * (Professional Edition)
-   *
-   * The Intel's return IPMI_PRIVILEGE_LEVEL_HIGHEST_LEVEL instead
-   * of an actual privilege, so have to pass the actual privilege
-   * we want to use.
+  x = &(rq->exchange);
+
+  /* the requester sequence number wraps quickly, never hand out one
+   * still held by another command in flight
    */
-  if (ctx->workaround_flags_outofband_2_0 & IPMI_WORKAROUND_FLAGS_OUTOFBAND_2_0_INTEL_2_0_SESSION)
-    {
-      uint8_t maximum_privilege_level;
+  while (_api_lan_async_rq_seq_in_use (ctx, rq, ctx->io.outofband.rq_seq))
+    ctx->io.outofband.rq_seq = (ctx->io.outofband.rq_seq + 1) % (IPMI_LAN_REQUESTER_SEQUENCE_NUMBER_MAX + 1);
 
-      if (FIID_OBJ_GET (obj_cmd_rs,
-                        "maximum_privilege_level",
-                        &val) < 0)
-        {
-          API_FIID_OBJECT_ERROR_TO_API_ERRNUM (ctx, obj_cmd_rs);
-          goto cleanup;
-        }
-      maximum_privilege_level = val;
+  rq->rq_seq = ctx->io.outofband.rq_seq;
+  ctx->io.outofband.rq_seq = (ctx->io.outofband.rq_seq + 1) % (IPMI_LAN_REQUESTER_SEQUENCE_NUMBER_MAX + 1);
 
-      ret = (maximum_privilege_level == requested_maximum_privilege) ? 1 : 0;
-    }
-  else
+  if (x->session_sequence_number)
     {
-      if ((ret = ipmi_check_open_session_maximum_privilege (ctx->io.outofband.privilege_level,
-                                                            obj_cmd_rs)) < 0)
-        {
-          API_ERRNO_TO_API_ERRNUM (ctx, errno);
-          goto cleanup;
-        }
+      rq->session_sequence_number = ctx->io.outofband.session_sequence_number;
+      ctx->io.outofband.session_sequence_number++;
+      /* In IPMI 2.0, session sequence numbers of 0 are special */
+      if (x->rmcpplus && !ctx->io.outofband.session_sequence_number)
+        ctx->io.outofband.session_sequence_number++;
     }
 
-  if (!ret)
+  if (_api_lan_exchange_send (ctx, x) < 0)
+    return (-1);
+
+  return (0);
+}
+
+/* record the completion of a command, reported later through
+ * api_lan_async_cmd_complete()
+ */
+static void
+_api_lan_async_rq_done (ipmi_ctx_t ctx, struct ipmi_ctx_async_rq *rq, int rv)
+{
+  assert (ctx
+          && ctx->magic == IPMI_CTX_MAGIC
+          && (ctx->type == IPMI_DEVICE_LAN
+              || ctx->type == IPMI_DEVICE_LAN_2_0)
+          && rq
+          && rq->state == IPMI_CTX_ASYNC_RQ_PENDING);
+
+  _api_lan_exchange_finish (&(rq->exchange));
+  rq->state = IPMI_CTX_ASYNC_RQ_DONE;
+  rq->rv = rv;
+  rq->errnum = (rv < 0) ? ctx->errnum : IPMI_ERR_SUCCESS;
+
+  if (rq->exchange.stats)
     {
-      API_SET_ERRNUM (ctx, IPMI_ERR_PRIVILEGE_LEVEL_CANNOT_BE_OBTAINED);
-      goto cleanup;
+      if (rv < 0)
+        {
+          if (rq->errnum == IPMI_ERR_SESSION_TIMEOUT)
+            rq->exchange.stats->timeouts++;
+        }
+      else
+        api_stats_comp_code (rq->exchange.stats, rq->exchange.obj_cmd_rs);
     }
+}
 
-  if (FIID_OBJ_GET (obj_cmd_rs,
-                    "managed_system_session_id",
-                    &val) < 0)
-    {
-      API_FIID_OBJECT_ERROR_TO_API_ERRNUM (ctx, obj_cmd_rs);
-      goto cleanup;
-    }
-  ctx->io.outofband.managed_system_session_id = val;
+/* fail all commands in flight with the current errnum */
+static void
+_api_lan_async_rq_fail (ipmi_ctx_t ctx)
+{
+  unsigned int i;
 
-  fiid_obj_destroy (obj_cmd_rq);
-  obj_cmd_rq = NULL;
-  fiid_obj_destroy (obj_cmd_rs);
-  obj_cmd_rs = NULL;
+  assert (ctx
+          && ctx->magic == IPMI_CTX_MAGIC
+          && (ctx->type == IPMI_DEVICE_LAN
+              || ctx->type == IPMI_DEVICE_LAN_2_0));
 
-  if (!(obj_cmd_rq = fiid_obj_create (tmpl_rmcpplus_rakp_message_1)))
-    {
-      API_ERRNO_TO_API_ERRNUM (ctx, errno);
-      goto cleanup;
-    }
-  if (!(obj_cmd_rs = fiid_obj_create (tmpl_rmcpplus_rakp_message_2)))
+  for (i = 0; i < IPMI_ASYNC_WINDOW_MAX; i++)
     {
-      API_ERRNO_TO_API_ERRNUM (ctx, errno);
-      goto cleanup;
+      if (ctx->io.outofband.async.rq[i].state == IPMI_CTX_ASYNC_RQ_PENDING)
+        _api_lan_async_rq_done (ctx, &(ctx->io.outofband.async.rq[i]), -1);
     }
+}
 
-  if (ipmi_get_random (remote_console_random_number,
-                       IPMI_REMOTE_CONSOLE_RANDOM_NUMBER_LENGTH) < 0)
-    {
-      API_ERRNO_TO_API_ERRNUM (ctx, errno);
-      goto cleanup;
-    }
+static struct ipmi_ctx_async_rq *
+_api_lan_async_rq_find (ipmi_ctx_t ctx, int state)
+{
+  unsigned int i;
 
-  /* IPMI Workaround (achu)
-   *
-   * Discovered on SE7520AF2 with Intel Server Management Module
-   * (Professional Edition)
-   *
-   * The username must be padded despite explicitly not being
-   * allowed.  "No Null characters (00h) are allowed in the name".
-   * Table 13-11 in the IPMI 2.0 spec.
-   *
-   * achu: This should only be done for RAKP 1 message, RAKP 2 check,
-   * and session key creation.
-   */
-  if (ctx->workaround_flags_outofband_2_0 & IPMI_WORKAROUND_FLAGS_OUTOFBAND_2_0_INTEL_2_0_SESSION)
-    {
-      memset (username_buf, '\0', IPMI_MAX_USER_NAME_LENGTH+1);
-      if (strlen (ctx->io.outofband.username))
-        strcpy (username_buf, ctx->io.outofband.username);
-      username = username_buf;
-      username_len = IPMI_MAX_USER_NAME_LENGTH;
-    }
-  else
-    {
-      if (strlen (ctx->io.outofband.username))
-        username = ctx->io.outofband.username;
-      else
-        username = NULL;
-      username_len = (username) ? strlen (username) : 0;
-    }
+  assert (ctx
+          && ctx->magic == IPMI_CTX_MAGIC
+          && (ctx->type == IPMI_DEVICE_LAN
+              || ctx->type == IPMI_DEVICE_LAN_2_0));
 
-  /* achu: Unlike IPMI 1.5, the length of the username must be actual
-   * length, it can't be the maximum length.
-   */
-  if (fill_rmcpplus_rakp_message_1 (message_tag,
-                                    ctx->io.outofband.managed_system_session_id,
-                                    remote_console_random_number,
-                                    IPMI_REMOTE_CONSOLE_RANDOM_NUMBER_LENGTH,
-                                    ctx->io.outofband.privilege_level,
-                                    IPMI_NAME_ONLY_LOOKUP,
-                                    username,
-                                    username_len,
-                                    obj_cmd_rq) < 0)
+  for (i = 0; i < IPMI_ASYNC_WINDOW_MAX; i++)
     {
-      API_ERRNO_TO_API_ERRNUM (ctx, errno);
-      goto cleanup;
+      if (ctx->io.outofband.async.rq[i].state == state)
+        return (&(ctx->io.outofband.async.rq[i]));
     }
 
-  if (api_lan_2_0_cmd_wrapper (ctx,
-                               0,
-                               IPMI_BMC_IPMB_LUN_BMC, /* doesn't actually matter here */
-                               IPMI_NET_FN_APP_RQ, /* doesn't actually matter here */
-                               IPMI_PAYLOAD_TYPE_RAKP_MESSAGE_1,
-                               IPMI_PAYLOAD_FLAG_UNAUTHENTICATED,
-                               IPMI_PAYLOAD_FLAG_UNENCRYPTED,
-                               &message_tag,
-                               NULL,
-                               0,
-                               NULL,
-                               IPMI_AUTHENTICATION_ALGORITHM_RAKP_NONE,
-                               IPMI_INTEGRITY_ALGORITHM_NONE,
-                               IPMI_CONFIDENTIALITY_ALGORITHM_NONE,
-                               NULL,
-                               0,
-                               NULL,
-                               0,
-                               NULL,
-                               0,
-                               obj_cmd_rq,
-                               obj_cmd_rs) < 0)
+  return (NULL);
+}
+
+int
+api_lan_async_cmd (ipmi_ctx_t ctx,
+                   fiid_obj_t obj_cmd_rq,
+                   fiid_obj_t obj_cmd_rs,
+                   Ipmi_Ctx_Async_Callback callback,
+                   void *callback_data)
+{
+  struct ipmi_ctx_async *async;
+  struct ipmi_ctx_async_rq *rq;
+  struct ipmi_ctx_exchange *x;
+
+  assert (ctx
+          && ctx->magic == IPMI_CTX_MAGIC
+          && ctx->io.outofband.sockfd
+          && (ctx->type == IPMI_DEVICE_LAN
+              || ctx->type == IPMI_DEVICE_LAN_2_0)
+          && (ctx->io.outofband.async.op == IPMI_CTX_ASYNC_OP_NONE
+              || ctx->io.outofband.async.op == IPMI_CTX_ASYNC_OP_CMD)
+          && ctx->io.outofband.async.rq_count < IPMI_ASYNC_WINDOW_MAX
+          && fiid_obj_valid (obj_cmd_rq)
+          && fiid_obj_packet_valid (obj_cmd_rq) == 1
+          && fiid_obj_valid (obj_cmd_rs)
+          && callback);
+
+  async = &(ctx->io.outofband.async);
+
+  rq = _api_lan_async_rq_find (ctx, IPMI_CTX_ASYNC_RQ_FREE);
+  assert (rq);
+
+  x = &(rq->exchange);
+
+  _api_lan_session_exchange (ctx,
+                             x,
+                             ctx->target.lun,
+                             ctx->target.net_fn,
+                             obj_cmd_rq,
+                             obj_cmd_rs);
+
+  /* sequence numbers are assigned per transmission */
+  x->rq_seq = &(rq->rq_seq);
+  if (x->session_sequence_number)
+    x->session_sequence_number = &(rq->session_sequence_number);
+
+  x->stats = api_stats_cmd_obj (ctx, ctx->target.net_fn, obj_cmd_rq);
+
+  if (_api_lan_exchange_init (ctx, x) < 0)
     goto cleanup;
 
-  if (FIID_OBJ_GET (obj_cmd_rs,
-                    "rmcpplus_status_code",
-                    &val) < 0)
-    {
-      API_FIID_OBJECT_ERROR_TO_API_ERRNUM (ctx, obj_cmd_rs);
-      goto cleanup;
-    }
-  rmcpplus_status_code = val;
+  rq->state = IPMI_CTX_ASYNC_RQ_PENDING;
 
-  if (rmcpplus_status_code != RMCPPLUS_STATUS_NO_ERRORS)
-    {
-      if (rmcpplus_status_code == RMCPPLUS_STATUS_UNAUTHORIZED_NAME)
-        API_SET_ERRNUM (ctx, IPMI_ERR_USERNAME_INVALID);
-      else if (rmcpplus_status_code == RMCPPLUS_STATUS_UNAUTHORIZED_ROLE_OR_PRIVILEGE_LEVEL_REQUESTED)
-        API_SET_ERRNUM (ctx, IPMI_ERR_PRIVILEGE_LEVEL_CANNOT_BE_OBTAINED);
-      else if (rmcpplus_status_code == RMCPPLUS_STATUS_INSUFFICIENT_RESOURCES_TO_CREATE_A_SESSION
-               || rmcpplus_status_code == RMCPPLUS_STATUS_INSUFFICIENT_RESOURCES_TO_CREATE_A_SESSION_AT_THE_REQUESTED_TIME)
-        API_SET_ERRNUM (ctx, IPMI_ERR_BMC_BUSY);
-      else
-        API_SET_ERRNUM (ctx, IPMI_ERR_BAD_RMCPPLUS_STATUS_CODE);
-      goto cleanup;
-    }
+  if (_api_lan_async_rq_send (ctx, rq) < 0)
+    goto cleanup;
 
-  if ((managed_system_random_number_len = fiid_obj_get_data (obj_cmd_rs,
-                                                             "managed_system_random_number",
-                                                             managed_system_random_number,
-                                                             IPMI_MANAGED_SYSTEM_RANDOM_NUMBER_LENGTH)) < 0)
-    {
-      API_FIID_OBJECT_ERROR_TO_API_ERRNUM (ctx, obj_cmd_rs);
-      goto cleanup;
-    }
+  rq->callback = callback;
+  rq->callback_data = callback_data;
+  async->op = IPMI_CTX_ASYNC_OP_CMD;
+  async->rq_count++;
+  return (0);
 
-  if ((managed_system_guid_len = fiid_obj_get_data (obj_cmd_rs,
-                                                    "managed_system_guid",
-                                                    managed_system_guid,
-                                                    IPMI_MANAGED_SYSTEM_GUID_LENGTH)) < 0)
-    {
-      API_FIID_OBJECT_ERROR_TO_API_ERRNUM (ctx, obj_cmd_rs);
-      goto cleanup;
-    }
+ cleanup:
+  memset (rq, '\0', sizeof (struct ipmi_ctx_async_rq));
+  return (-1);
+}
 
-  if (managed_system_random_number_len != IPMI_MANAGED_SYSTEM_RANDOM_NUMBER_LENGTH
-      || managed_system_guid_len != IPMI_MANAGED_SYSTEM_GUID_LENGTH)
-    {
-      API_SET_ERRNUM (ctx, IPMI_ERR_IPMI_ERROR);
-      goto cleanup;
-    }
+int
+api_lan_async_cmd_complete (ipmi_ctx_t ctx,
+                            Ipmi_Ctx_Async_Callback *callback,
+                            void **callback_data)
+{
+  struct ipmi_ctx_async *async;
+  struct ipmi_ctx_async_rq *rq;
+  int rv;
 
-  if (strlen (ctx->io.outofband.password))
-    password = ctx->io.outofband.password;
-  else
-    password = NULL;
-  password_len = (password) ? strlen (password) : 0;
+  assert (ctx
+          && ctx->magic == IPMI_CTX_MAGIC
+          && (ctx->type == IPMI_DEVICE_LAN
+              || ctx->type == IPMI_DEVICE_LAN_2_0)
+          && ctx->io.outofband.async.op == IPMI_CTX_ASYNC_OP_CMD
+          && callback
+          && callback_data);
 
-  /* IPMI Workaround (achu)
-   *
-   * Discovered on SE7520AF2 with Intel Server Management Module
-   * (Professional Edition)
-   *
-   * When the authentication algorithm is HMAC-MD5-128 and the
-   * password is greater than 16 bytes, the Intel BMC truncates the
-   * password to 16 bytes when generating keys, hashes, etc.  So we
-   * have to do the same when generating keys, hashes, etc.
-   */
-  if (ctx->workaround_flags_outofband_2_0 & IPMI_WORKAROUND_FLAGS_OUTOFBAND_2_0_INTEL_2_0_SESSION
-      && ctx->io.outofband.authentication_algorithm == IPMI_AUTHENTICATION_ALGORITHM_RAKP_HMAC_MD5
-      && password_len > IPMI_1_5_MAX_PASSWORD_LENGTH)
-    password_len = IPMI_1_5_MAX_PASSWORD_LENGTH;
+  async = &(ctx->io.outofband.async);
 
-  if (ctx->workaround_flags_outofband_2_0 & IPMI_WORKAROUND_FLAGS_OUTOFBAND_2_0_SUPERMICRO_2_0_SESSION)
-    {
-      uint8_t keybuf[IPMI_MAX_PKT_LEN];
-      int keybuf_len;
+  rq = _api_lan_async_rq_find (ctx, IPMI_CTX_ASYNC_RQ_DONE);
+  assert (rq);
 
-      /* IPMI Workaround (achu)
-       *
-       * Discovered on Supermicro H8QME with SIMSO daughter card.
-       *
-       * The IPMI 2.0 packet responses for RAKP 2 have payload lengths
-       * that are off by 1 (i.e. if the payload length should be X,
-       * the payload length returned in the packet is X + 1)
-       *
-       * We fix/adjust for the situation here.
-       */
+  rv = rq->rv;
+  ctx->errnum = rq->errnum;
+  (*callback) = rq->callback;
+  (*callback_data) = rq->callback_data;
 
-      if ((keybuf_len = fiid_obj_get_data (obj_cmd_rs,
-                                           "key_exchange_authentication_code",
-                                           keybuf,
-                                           IPMI_MAX_PKT_LEN)) < 0)
-        {
-          API_FIID_OBJECT_ERROR_TO_API_ERRNUM (ctx, obj_cmd_rs);
-          goto cleanup;
-        }
+  memset (rq, '\0', sizeof (struct ipmi_ctx_async_rq));
+  async->rq_count--;
+  if (!async->rq_count)
+    async->op = IPMI_CTX_ASYNC_OP_NONE;
 
-      if (ctx->io.outofband.authentication_algorithm == IPMI_AUTHENTICATION_ALGORITHM_RAKP_NONE
-          && keybuf_len == 1)
-        {
-          if (fiid_obj_clear_field (obj_cmd_rs,
-                                    "key_exchange_authentication_code") < 0)
-            {
-              API_FIID_OBJECT_ERROR_TO_API_ERRNUM (ctx, obj_cmd_rs);
-              goto cleanup;
-            }
-        }
-      else if (ctx->io.outofband.authentication_algorithm == IPMI_AUTHENTICATION_ALGORITHM_RAKP_HMAC_SHA1
-               && keybuf_len == (IPMI_HMAC_SHA1_DIGEST_LENGTH + 1))
-        {
-          if (fiid_obj_set_data (obj_cmd_rs,
-                                 "key_exchange_authentication_code",
-                                 keybuf,
-                                 IPMI_HMAC_SHA1_DIGEST_LENGTH) < 0)
-            {
-              API_FIID_OBJECT_ERROR_TO_API_ERRNUM (ctx, obj_cmd_rs);
-              goto cleanup;
-            }
-        }
-      else if (ctx->io.outofband.authentication_algorithm == IPMI_AUTHENTICATION_ALGORITHM_RAKP_HMAC_MD5
-               && keybuf_len == (IPMI_HMAC_MD5_DIGEST_LENGTH + 1))
-        {
-          if (fiid_obj_set_data (obj_cmd_rs,
-                                 "key_exchange_authentication_code",
-                                 keybuf,
-                                 IPMI_HMAC_MD5_DIGEST_LENGTH) < 0)
-            {
-              API_FIID_OBJECT_ERROR_TO_API_ERRNUM (ctx, obj_cmd_rs);
-              goto cleanup;
-            }
-        }
-      else if (ctx->io.outofband.authentication_algorithm == IPMI_AUTHENTICATION_ALGORITHM_RAKP_HMAC_SHA256
-               && keybuf_len == (IPMI_HMAC_SHA256_DIGEST_LENGTH + 1))
-        {
-          if (fiid_obj_set_data (obj_cmd_rs,
-                                 "key_exchange_authentication_code",
-                                 keybuf,
-                                 IPMI_HMAC_SHA256_DIGEST_LENGTH) < 0)
-            {
-              API_FIID_OBJECT_ERROR_TO_API_ERRNUM (ctx, obj_cmd_rs);
-              goto cleanup;
-            }
-        }
-    }
+  return (rv);
+}
+
+int
+api_lan_async_timeout (ipmi_ctx_t ctx, int *timeout)
+{
+  struct ipmi_ctx_async *async;
+  struct timeval current;
+  struct timeval deadline;
+  struct timeval retransmission_timeout;
+  struct timeval timeout_val;
+  unsigned int i;
+
+  assert (ctx
+          && ctx->magic == IPMI_CTX_MAGIC
+          && (ctx->type == IPMI_DEVICE_LAN
+              || ctx->type == IPMI_DEVICE_LAN_2_0)
+          && ctx->io.outofband.async.op != IPMI_CTX_ASYNC_OP_NONE
+          && timeout);
 
-  /* IPMI Workaround (achu)
-   *
-   * Discovered on Sun Fire 4100.
-   *
-   * The key exchange authentication code is the wrong length.  We
-   * need to shorten it.
-   *
-   * Notes: Cipher suite 1,2,3 are the ones that use HMAC-SHA1 and
-   * have the problem.
+  async = &(ctx->io.outofband.async);
+
+  /* packets for a shared socket may have been queued by another
+   * context, without the descriptor being readable
    */
-  if (ctx->workaround_flags_outofband_2_0 & IPMI_WORKAROUND_FLAGS_OUTOFBAND_2_0_SUN_2_0_SESSION
-      && (ctx->io.outofband.authentication_algorithm == IPMI_AUTHENTICATION_ALGORITHM_RAKP_HMAC_SHA1))
+  if ((async->op == IPMI_CTX_ASYNC_OP_OPEN_SESSION
+       && !async->in_exchange)
+      || (async->op == IPMI_CTX_ASYNC_OP_CMD
+          && _api_lan_async_rq_find (ctx, IPMI_CTX_ASYNC_RQ_DONE))
+      || (ctx->io.outofband.mux_peer
+          && api_mux_pending (ctx)))
     {
-      uint8_t buf[IPMI_MAX_KEY_EXCHANGE_AUTHENTICATION_CODE_LENGTH];
-      int buf_len;
+      (*timeout) = 0;
+      return (0);
+    }
 
-      if ((buf_len = fiid_obj_get_data (obj_cmd_rs,
-                                        "key_exchange_authentication_code",
-                                        buf,
-                                        IPMI_MAX_KEY_EXCHANGE_AUTHENTICATION_CODE_LENGTH)) < 0)
+  if (gettimeofday (&current, NULL) < 0)
+    {
+      API_ERRNO_TO_API_ERRNUM (ctx, errno);
+      return (-1);
+    }
+
+  _session_timeout (ctx, &deadline);
+
+  if (ctx->io.outofband.retransmission_timeout)
+    {
+      if (async->op == IPMI_CTX_ASYNC_OP_OPEN_SESSION)
         {
-          API_FIID_OBJECT_ERROR_TO_API_ERRNUM (ctx, obj_cmd_rs);
-          goto cleanup;
-        }
+          _retransmission_timeout (ctx,
+                                   &(ctx->io.outofband.last_send),
+                                   async->exchange.retransmission_count,
+                                   &retransmission_timeout);
 
-      if (buf_len == (IPMI_HMAC_SHA1_DIGEST_LENGTH + 1))
+          if (timercmp (&retransmission_timeout, &deadline, <))
+            deadline = retransmission_timeout;
+        }
+      else
         {
-          if (fiid_obj_clear_field (obj_cmd_rs,
-                                    "key_exchange_authentication_code") < 0)
+          for (i = 0; i < IPMI_ASYNC_WINDOW_MAX; i++)
             {
-              API_FIID_OBJECT_ERROR_TO_API_ERRNUM (ctx, obj_cmd_rs);
-              goto cleanup;
-            }
+              if (async->rq[i].state != IPMI_CTX_ASYNC_RQ_PENDING)
+                continue;
 
-          if (fiid_obj_set_data (obj_cmd_rs,
-                                 "key_exchange_authentication_code",
-                                 buf,
-                                 IPMI_HMAC_SHA1_DIGEST_LENGTH) < 0)
-            {
-              API_FIID_OBJECT_ERROR_TO_API_ERRNUM (ctx, obj_cmd_rs);
-              goto cleanup;
+              _retransmission_timeout (ctx,
+                                       &(async->rq[i].exchange.last_send),
+                                       async->rq[i].exchange.retransmission_count,
+                                       &retransmission_timeout);
+
+              if (timercmp (&retransmission_timeout, &deadline, <))
+                deadline = retransmission_timeout;
             }
         }
     }
 
-  if ((ret = ipmi_rmcpplus_check_rakp_2_key_exchange_authentication_code (ctx->io.outofband.authentication_algorithm,
-                                                                          password,
-                                                                          password_len,
-                                                                          ctx->io.outofband.remote_console_session_id,
-                                                                          ctx->io.outofband.managed_system_session_id,
-                                                                          remote_console_random_number,
-                                                                          IPMI_REMOTE_CONSOLE_RANDOM_NUMBER_LENGTH,
-                                                                          managed_system_random_number,
-                                                                          managed_system_random_number_len,
-                                                                          managed_system_guid,
-                                                                          managed_system_guid_len,
-                                                                          IPMI_NAME_ONLY_LOOKUP,
-                                                                          ctx->io.outofband.privilege_level,
-                                                                          username,
-                                                                          username_len,
-                                                                          obj_cmd_rs)) < 0)
+  if (!timercmp (&current, &deadline, <))
     {
-      API_ERRNO_TO_API_ERRNUM (ctx, errno);
-      goto cleanup;
+      (*timeout) = 0;
+      return (0);
     }
 
-  if (!ret)
+  timersub (&deadline, &current, &timeout_val);
+
+  /* round up, so the caller does not wake up just before the deadline */
+  (*timeout) = (timeout_val.tv_sec * 1000) + ((timeout_val.tv_usec + 999) / 1000);
+  return (0);
+}
+
+/* return 1 if the operation completed, 0 if it continues with the
+ * next session setup step, -1 on error
+ */
+static int
+_api_lan_async_exchange_done (ipmi_ctx_t ctx)
+{
+  struct ipmi_ctx_async *async;
+
+  assert (ctx
+          && ctx->magic == IPMI_CTX_MAGIC
+          && (ctx->type == IPMI_DEVICE_LAN
+              || ctx->type == IPMI_DEVICE_LAN_2_0)
+          && ctx->io.outofband.async.op == IPMI_CTX_ASYNC_OP_OPEN_SESSION);
+
+  async = &(ctx->io.outofband.async);
+
+  _api_lan_exchange_finish (&(async->exchange));
+  async->in_exchange = 0;
+
+  if (_api_lan_session_setup_rs (ctx, &(async->setup)) < 0)
+    return (-1);
+
+  if (async->setup.step == IPMI_SESSION_SETUP_DONE)
     {
-      /* IPMI Compliance Issue
-       *
-       * On some systems, password could be correct, but privilege is
-       * too high.  The error is b/c the privilege error is not
-       * handled properly in the open session stage (i.e. they tell me
-       * I can authenticate at a high privilege level, that in reality
-       * is not allowed).  Dunno how to deal with this.
-       */
-      API_SET_ERRNUM (ctx, IPMI_ERR_PASSWORD_INVALID);
-      goto cleanup;
+      _api_lan_session_setup_done (ctx, &(async->setup));
+      return (1);
     }
 
-  /* achu: note, for INTEL_2_0 workaround, this must have the username/password adjustments */
-  if (ipmi_calculate_rmcpplus_session_keys (ctx->io.outofband.authentication_algorithm,
-                                            ctx->io.outofband.integrity_algorithm,
-                                            ctx->io.outofband.confidentiality_algorithm,
-                                            password,
-                                            password_len,
-                                            (ctx->io.outofband.k_g_configured) ? ctx->io.outofband.k_g : NULL,
-                                            (ctx->io.outofband.k_g_configured) ? IPMI_MAX_K_G_LENGTH : 0,
-                                            remote_console_random_number,
-                                            IPMI_REMOTE_CONSOLE_RANDOM_NUMBER_LENGTH,
-                                            managed_system_random_number,
-                                            IPMI_MANAGED_SYSTEM_RANDOM_NUMBER_LENGTH,
-                                            IPMI_NAME_ONLY_LOOKUP,
-                                            ctx->io.outofband.privilege_level,
-                                            username,
-                                            username_len,
-                                            &(ctx->io.outofband.sik_key_ptr),
-                                            &(ctx->io.outofband.sik_key_len),
-                                            &(ctx->io.outofband.integrity_key_ptr),
-                                            &(ctx->io.outofband.integrity_key_len),
-                                            &(ctx->io.outofband.confidentiality_key_ptr),
-                                            &(ctx->io.outofband.confidentiality_key_len)) < 0)
+  if (_api_lan_async_exchange_start (ctx) < 0)
+    return (-1);
+
+  return (0);
+}
+
+/* return packet length, 0 if no packet is waiting, -1 on error */
+static int
+_api_lan_async_recvfrom (ipmi_ctx_t ctx, void *pkt, unsigned int pkt_len)
+{
+  int recv_len;
+
+  assert (ctx
+          && ctx->magic == IPMI_CTX_MAGIC
+          && ctx->io.outofband.sockfd
+          && (ctx->type == IPMI_DEVICE_LAN
+              || ctx->type == IPMI_DEVICE_LAN_2_0)
+          && pkt
+          && pkt_len);
+
+  if (ctx->io.outofband.mux_peer)
     {
-      API_ERRNO_TO_API_ERRNUM (ctx, errno);
-      goto cleanup;
+      if ((recv_len = api_mux_recvfrom (ctx, pkt, pkt_len, 0)) < 0)
+        {
+          API_ERRNO_TO_API_ERRNUM (ctx, errno);
+          return (-1);
+        }
+      api_pkt_trace (ctx, API_PKT_TRACE_RESPONSE, pkt, recv_len);
+      return (recv_len);
     }
 
-  /* achu: If INTEL_2_0 workaround is set, get back to original username &
-   * username_len, because that isn't needed for the RAKP3/4 part.
-   */
-  if (ctx->workaround_flags_outofband_2_0 & IPMI_WORKAROUND_FLAGS_OUTOFBAND_2_0_INTEL_2_0_SESSION)
+  while (1)
     {
-      if (strlen (ctx->io.outofband.username))
-        username = ctx->io.outofband.username;
-      else
-        username = NULL;
-      username_len = (username) ? strlen (username) : 0;
-    }
+      /* For receive side, ipmi_lan_recvfrom and
+       * ipmi_rmcpplus_recvfrom are identical.  So we just use
+       * ipmi_lan_recvfrom for both.
+       */
+      recv_len = ipmi_lan_recvfrom (ctx->io.outofband.sockfd,
+                                    pkt,
+                                    pkt_len,
+                                    MSG_DONTWAIT,
+                                    NULL,
+                                    NULL);
 
-  /* IPMI Workaround (achu)
-   *
-   * Discovered on SE7520AF2 with Intel Server Management Module
-   * (Professional Edition)
-   *
-   * For some reason we have to create this key with the name only
-   * lookup turned off.  I was skeptical about this actually being
-   * a bug until I saw that the ipmitool folks implemented the
-   * same workaround.
-   */
-  if (ctx->workaround_flags_outofband_2_0 & IPMI_WORKAROUND_FLAGS_OUTOFBAND_2_0_INTEL_2_0_SESSION)
-    name_only_lookup = IPMI_USER_NAME_PRIVILEGE_LOOKUP;
-  else
-    name_only_lookup = IPMI_NAME_ONLY_LOOKUP;
+      if (recv_len > 0)
+        {
+          api_pkt_trace (ctx, API_PKT_TRACE_RESPONSE, pkt, recv_len);
+          return (recv_len);
+        }
 
-  if ((key_exchange_authentication_code_len = ipmi_calculate_rakp_3_key_exchange_authentication_code (ctx->io.outofband.authentication_algorithm,
-                                                                                                      password,
-                                                                                                      password_len,
-                                                                                                      managed_system_random_number,
-                                                                                                      managed_system_random_number_len,
-                                                                                                      ctx->io.outofband.remote_console_session_id,
-                                                                                                      name_only_lookup,
-                                                                                                      ctx->io.outofband.privilege_level,
-                                                                                                      username,
-                                                                                                      username_len,
-                                                                                                      key_exchange_authentication_code,
-                                                                                                      IPMI_MAX_KEY_EXCHANGE_AUTHENTICATION_CODE_LENGTH)) < 0)
-    {
-      API_ERRNO_TO_API_ERRNUM (ctx, errno);
-      goto cleanup;
-    }
+      if (!recv_len)
+        continue;
 
-  fiid_obj_destroy (obj_cmd_rq);
-  obj_cmd_rq = NULL;
-  fiid_obj_destroy (obj_cmd_rs);
-  obj_cmd_rs = NULL;
+      if (errno == EINTR)
+        continue;
+
+      /* See _api_lan_cmd_recv() regarding ECONNRESET and
+       * ECONNREFUSED, wait for the real response or the timeout.
+       */
+      if (errno == EAGAIN
+          || errno == EWOULDBLOCK
+          || errno == ECONNRESET
+          || errno == ECONNREFUSED)
+        return (0);
 
-  if (!(obj_cmd_rq = fiid_obj_create (tmpl_rmcpplus_rakp_message_3)))
-    {
       API_ERRNO_TO_API_ERRNUM (ctx, errno);
-      goto cleanup;
+      return (-1);
     }
-  if (!(obj_cmd_rs = fiid_obj_create (tmpl_rmcpplus_rakp_message_4)))
+
+  /* NOT REACHED */
+  return (0);
+}
+
+/* route a packet to the command of the window with the same
+ * requester sequence number
+ *
+ * return 1 if a command completed, 0 if the packet should be
+ * ignored, -1 on error
+ */
+static int
+_api_lan_async_rq_packet (ipmi_ctx_t ctx,
+                          const void *pkt,
+                          unsigned int pkt_len)
+{
+  struct ipmi_ctx_async_rq *rq_any;
+  struct ipmi_ctx_async_rq *rq = NULL;
+  fiid_obj_t obj_raw_rs = NULL;
+  uint8_t buf[IPMI_MAX_PKT_LEN];
+  uint8_t payload_type;
+  uint64_t val;
+  unsigned int i;
+  int len, ret, rv = -1;
+
+  assert (ctx
+          && ctx->magic == IPMI_CTX_MAGIC
+          && (ctx->type == IPMI_DEVICE_LAN
+              || ctx->type == IPMI_DEVICE_LAN_2_0)
+          && pkt
+          && pkt_len);
+
+  /* all commands share the session parameters */
+  rq_any = _api_lan_async_rq_find (ctx, IPMI_CTX_ASYNC_RQ_PENDING);
+  assert (rq_any);
+
+  /* e.g. late duplicate from session setup */
+  if (rq_any->exchange.rmcpplus)
     {
-      API_ERRNO_TO_API_ERRNUM (ctx, errno);
-      goto cleanup;
+      if (ipmi_rmcpplus_calculate_payload_type (pkt, pkt_len, &payload_type) < 0)
+        {
+          API_ERRNO_TO_API_ERRNUM (ctx, errno);
+          goto cleanup;
+        }
+
+      if (payload_type != IPMI_PAYLOAD_TYPE_IPMI)
+        {
+          _api_lan_exchange_dump_rs (ctx, &(rq_any->exchange), pkt, pkt_len);
+          rv = 0;
+          goto cleanup;
+        }
     }
 
-  if (fill_rmcpplus_rakp_message_3 (message_tag,
-                                    RMCPPLUS_STATUS_NO_ERRORS,
-                                    ctx->io.outofband.managed_system_session_id,
-                                    key_exchange_authentication_code,
-                                    key_exchange_authentication_code_len,
-                                    obj_cmd_rq) < 0)
+  if (rq_any->exchange.rmcpplus)
     {
-      API_ERRNO_TO_API_ERRNUM (ctx, errno);
-      goto cleanup;
+      /* decoded in place, the command data is set directly into the
+       * command of the window below
+       */
+      if ((ret = _api_lan_2_0_session_unassemble (ctx,
+                                                  rq_any->exchange.integrity_algorithm,
+                                                  rq_any->exchange.confidentiality_algorithm,
+                                                  rq_any->exchange.integrity_key,
+                                                  rq_any->exchange.integrity_key_len,
+                                                  rq_any->exchange.password,
+                                                  rq_any->exchange.password_len,
+                                                  rq_any->exchange.confidentiality_key,
+                                                  rq_any->exchange.confidentiality_key_len,
+                                                  pkt,
+                                                  pkt_len)) <= 0)
+        {
+          _api_lan_exchange_dump_rs (ctx, &(rq_any->exchange), pkt, pkt_len);
+          rv = ret;
+          goto cleanup;
+        }
+
+      if ((ret = _api_lan_2_0_session_rq_seq (ctx)) < 0)
+        goto cleanup;
+      val = ret;
     }
+  else
+    {
+      if (!(obj_raw_rs = api_fiid_obj_get (ctx, tmpl_lan_raw)))
+        {
+          API_ERRNO_TO_API_ERRNUM (ctx, errno);
+          goto cleanup;
+        }
 
-  if (api_lan_2_0_cmd_wrapper (ctx,
-                               0,
-                               IPMI_BMC_IPMB_LUN_BMC, /* doesn't actually matter here */
-                               IPMI_NET_FN_APP_RQ, /* doesn't actually matter here */
-                               IPMI_PAYLOAD_TYPE_RAKP_MESSAGE_3,
-                               IPMI_PAYLOAD_FLAG_UNAUTHENTICATED,
-                               IPMI_PAYLOAD_FLAG_UNENCRYPTED,
-                               &message_tag,
-                               NULL,
-                               0,
-                               NULL,
-                               IPMI_AUTHENTICATION_ALGORITHM_RAKP_NONE,
-                               IPMI_INTEGRITY_ALGORITHM_NONE,
-                               IPMI_CONFIDENTIALITY_ALGORITHM_NONE,
-                               NULL,
-                               0,
-                               NULL,
-                               0,
-                               NULL,
-                               0,
-                               obj_cmd_rq,
-                               obj_cmd_rs) < 0)
-    goto cleanup;
+      if ((ret = _api_lan_exchange_unassemble (ctx,
+                                               &(rq_any->exchange),
+                                               pkt,
+                                               pkt_len,
+                                               obj_raw_rs)) <= 0)
+        {
+          _api_lan_exchange_dump_rs (ctx, &(rq_any->exchange), pkt, pkt_len);
+          rv = ret;
+          goto cleanup;
+        }
+
+      if (FIID_OBJ_GET (ctx->io.outofband.rs.obj_lan_msg_hdr,
+                        "rq_seq",
+                        &val) < 0)
+        {
+          API_FIID_OBJECT_ERROR_TO_API_ERRNUM (ctx, ctx->io.outofband.rs.obj_lan_msg_hdr);
+          goto cleanup;
+        }
+    }
 
-  if (FIID_OBJ_GET (obj_cmd_rs,
-                    "rmcpplus_status_code",
-                    &val) < 0)
+  for (i = 0; i < IPMI_ASYNC_WINDOW_MAX; i++)
     {
-      API_FIID_OBJECT_ERROR_TO_API_ERRNUM (ctx, obj_cmd_rs);
-      goto cleanup;
+      if (ctx->io.outofband.async.rq[i].state == IPMI_CTX_ASYNC_RQ_PENDING
+          && ctx->io.outofband.async.rq[i].rq_seq == val)
+        {
+          rq = &(ctx->io.outofband.async.rq[i]);
+          break;
+        }
     }
-  rmcpplus_status_code = val;
 
-  if (rmcpplus_status_code != RMCPPLUS_STATUS_NO_ERRORS)
+  if (!rq)
     {
-      if (rmcpplus_status_code == RMCPPLUS_STATUS_INSUFFICIENT_RESOURCES_TO_CREATE_A_SESSION
-          || rmcpplus_status_code == RMCPPLUS_STATUS_INSUFFICIENT_RESOURCES_TO_CREATE_A_SESSION_AT_THE_REQUESTED_TIME)
-        API_SET_ERRNUM (ctx, IPMI_ERR_BMC_BUSY);
-      else if (rmcpplus_status_code == RMCPPLUS_STATUS_INVALID_INTEGRITY_CHECK_VALUE)
-        /* XXX: achu: some systems, password could be correct, but
-         * privilege used in hashing is incorrect on the BMC side
-         * (OPEN_SESSION_PRIVILEGE workaround).
-         */
-        API_SET_ERRNUM (ctx, IPMI_ERR_PASSWORD_INVALID);
-      else
-        API_SET_ERRNUM (ctx, IPMI_ERR_BAD_RMCPPLUS_STATUS_CODE);
+      _api_lan_exchange_dump_rs (ctx, &(rq_any->exchange), pkt, pkt_len);
+      rv = 0;
       goto cleanup;
     }
 
-  /* IPMI Workaround (achu)
-   *
-   * Discovered on SE7520AF2 with Intel Server Management Module
-   * (Professional Edition)
-   *
-   * For some reason, the intel ipmi 2.0 responds with the integrity
-   * check value based on the integrity algorithm instead of the
-   * authentication algorithm.
-   *
-   * Thanks to the ipmitool folks (ipmitool.sourceforge.net) for this
-   * one.  Would have taken me awhile to figure this one out :-)
-   */
+  _api_lan_exchange_dump_rs (ctx, &(rq->exchange), pkt, pkt_len);
 
-  if (ctx->workaround_flags_outofband_2_0 & IPMI_WORKAROUND_FLAGS_OUTOFBAND_2_0_INTEL_2_0_SESSION)
+  if (rq->exchange.rmcpplus)
     {
-      if (ctx->io.outofband.integrity_algorithm == IPMI_INTEGRITY_ALGORITHM_NONE)
-        authentication_algorithm = IPMI_AUTHENTICATION_ALGORITHM_RAKP_NONE;
-      else if (ctx->io.outofband.integrity_algorithm == IPMI_INTEGRITY_ALGORITHM_HMAC_SHA1_96)
-        authentication_algorithm = IPMI_AUTHENTICATION_ALGORITHM_RAKP_HMAC_SHA1;
-      else if (ctx->io.outofband.integrity_algorithm == IPMI_INTEGRITY_ALGORITHM_HMAC_MD5_128)
-        authentication_algorithm = IPMI_AUTHENTICATION_ALGORITHM_RAKP_HMAC_MD5;
-      else if (ctx->io.outofband.integrity_algorithm == IPMI_INTEGRITY_ALGORITHM_MD5_128)
+      if ((ret = _api_lan_2_0_session_cmd_rs (ctx, rq->exchange.obj_cmd_rs)) <= 0)
         {
-          /* achu: I have thus far been unable to reverse engineer this
-           * corner case.  Since we cannot provide a reasonable two
-           * part authentication, we're going to error out.
-           */
-          API_SET_ERRNUM (ctx, IPMI_ERR_IPMI_ERROR);
+          rv = ret;
           goto cleanup;
         }
     }
   else
-    authentication_algorithm = ctx->io.outofband.authentication_algorithm;
+    {
+      if ((len = fiid_obj_get_all (obj_raw_rs, buf, IPMI_MAX_PKT_LEN)) < 0)
+        {
+          API_FIID_OBJECT_ERROR_TO_API_ERRNUM (ctx, obj_raw_rs);
+          goto cleanup;
+        }
 
-  /* IPMI Workaround (achu)
-   *
-   * Discovered on Supermicro X8DTG, Supermicro X8DTU, Intel
-   * S5500WBV/Penguin Relion 700
-   *
-   * For whatever reason, with cipher suite 0, the RAKP 4 response
-   * returns with an Integrity Check Value when it should be empty.
-   */
+      if (fiid_obj_clear (rq->exchange.obj_cmd_rs) < 0)
+        {
+          API_FIID_OBJECT_ERROR_TO_API_ERRNUM (ctx, rq->exchange.obj_cmd_rs);
+          goto cleanup;
+        }
 
-  if (ctx->workaround_flags_outofband_2_0 & IPMI_WORKAROUND_FLAGS_OUTOFBAND_2_0_NON_EMPTY_INTEGRITY_CHECK_VALUE
-      && !ctx->io.outofband.cipher_suite_id)
-    {
-      if (fiid_obj_clear_field (obj_cmd_rs,
-                                "integrity_check_value") < 0)
+      if (fiid_obj_set_all (rq->exchange.obj_cmd_rs, buf, len) < 0)
         {
-          API_FIID_OBJECT_ERROR_TO_API_ERRNUM (ctx, obj_cmd_rs);
+          API_FIID_OBJECT_ERROR_TO_API_ERRNUM (ctx, rq->exchange.obj_cmd_rs);
           goto cleanup;
         }
     }
 
-  if ((ret = ipmi_rmcpplus_check_rakp_4_integrity_check_value (authentication_algorithm,
-                                                               ctx->io.outofband.sik_key_ptr,
-                                                               ctx->io.outofband.sik_key_len,
-                                                               remote_console_random_number,
-                                                               IPMI_REMOTE_CONSOLE_RANDOM_NUMBER_LENGTH,
-                                                               ctx->io.outofband.managed_system_session_id,
-                                                               managed_system_guid,
-                                                               managed_system_guid_len,
-                                                               obj_cmd_rs)) < 0)
+  if ((ret = _api_lan_exchange_verify (ctx,
+                                       &(rq->exchange),
+                                       pkt,
+                                       pkt_len)) <= 0)
     {
-      API_ERRNO_TO_API_ERRNUM (ctx, errno);
+      rv = ret;
       goto cleanup;
     }
 
-  if (!ret)
+  _api_lan_async_rq_done (ctx, rq, 0);
+  rv = 1;
+ cleanup:
+  api_fiid_obj_put (ctx, obj_raw_rs);
+  return (rv);
+}
+
+/* receive, time out and retransmit the commands of the window,
+ * failures are recorded with the commands
+ */
+static void
+_api_lan_async_process_cmd (ipmi_ctx_t ctx, short revents)
+{
+  struct ipmi_ctx_async *async;
+  struct ipmi_ctx_async_rq *rq;
+  uint8_t pkt[IPMI_MAX_PKT_LEN];
+  struct timeval current;
+  struct timeval retransmission_timeout;
+  unsigned int i;
+  int recv_len, ret;
+
+  assert (ctx
+          && ctx->magic == IPMI_CTX_MAGIC
+          && (ctx->type == IPMI_DEVICE_LAN
+              || ctx->type == IPMI_DEVICE_LAN_2_0)
+          && ctx->io.outofband.async.op == IPMI_CTX_ASYNC_OP_CMD);
+
+  async = &(ctx->io.outofband.async);
+
+  if ((revents & (POLLIN | POLLERR))
+      || ctx->io.outofband.mux_peer)
     {
-      API_SET_ERRNUM (ctx, IPMI_ERR_K_G_INVALID);
-      goto cleanup;
+      while ((rq = _api_lan_async_rq_find (ctx, IPMI_CTX_ASYNC_RQ_PENDING)))
+        {
+          if ((recv_len = _api_lan_async_recvfrom (ctx,
+                                                   pkt,
+                                                   IPMI_MAX_PKT_LEN)) < 0)
+            goto fail;
+
+          if (!recv_len)
+            break;
+
+          if (_api_lan_async_rq_packet (ctx, pkt, recv_len) < 0)
+            goto fail;
+        }
     }
 
-  fiid_obj_destroy (obj_cmd_rq);
-  obj_cmd_rq = NULL;
-  fiid_obj_destroy (obj_cmd_rs);
-  obj_cmd_rs = NULL;
+  if (!(rq = _api_lan_async_rq_find (ctx, IPMI_CTX_ASYNC_RQ_PENDING)))
+    return;
 
-  /* if privilege_level == IPMI_PRIVILEGE_LEVEL_USER we shouldn't have
-   * to call this, b/c it should be USER by default.  But I don't
-   * trust IPMI implementations.  Do it anyways.
-   */
+  if ((ret = _api_lan_exchange_timed_out (ctx, &(rq->exchange))) < 0)
+    goto fail;
 
-  /* achu: At this point in time, the session is actually setup
-   * legitimately, so we can use the actual set session privilege
-   * level API function.
-   */
+  if (ret)
+    goto fail;
 
-  if (!(obj_cmd_rs = fiid_obj_create (tmpl_cmd_set_session_privilege_level_rs)))
+  if (!ctx->io.outofband.retransmission_timeout)
+    return;
+
+  if (gettimeofday (&current, NULL) < 0)
     {
       API_ERRNO_TO_API_ERRNUM (ctx, errno);
-      goto cleanup;
+      goto fail;
     }
 
-  if (ipmi_cmd_set_session_privilege_level (ctx,
-                                            ctx->io.outofband.privilege_level,
-                                            obj_cmd_rs) < 0)
+  for (i = 0; i < IPMI_ASYNC_WINDOW_MAX; i++)
     {
-      if (ctx->errnum == IPMI_ERR_BAD_COMPLETION_CODE)
-        {
-          if (ipmi_check_completion_code (obj_cmd_rs, IPMI_COMP_CODE_SET_SESSION_PRIVILEGE_LEVEL_REQUESTED_LEVEL_NOT_AVAILABLE_FOR_USER) == 1
-              || ipmi_check_completion_code (obj_cmd_rs, IPMI_COMP_CODE_SET_SESSION_PRIVILEGE_LEVEL_REQUESTED_LEVEL_EXCEEDS_USER_PRIVILEGE_LIMIT) == 1)
-            API_SET_ERRNUM (ctx, IPMI_ERR_PRIVILEGE_LEVEL_CANNOT_BE_OBTAINED);
-        }
-      ERR_TRACE (ipmi_ctx_strerror (ctx->errnum), ctx->errnum);
-      goto cleanup;
+      rq = &(async->rq[i]);
+
+      if (rq->state != IPMI_CTX_ASYNC_RQ_PENDING)
+        continue;
+
+      _retransmission_timeout (ctx,
+                               &(rq->exchange.last_send),
+                               rq->exchange.retransmission_count,
+                               &retransmission_timeout);
+
+      if (timercmp (&current, &retransmission_timeout, <))
+        continue;
+
+      _rtt_backoff (ctx, &(rq->exchange));
+
+      rq->exchange.retransmission_count++;
+      if (rq->exchange.stats)
+        rq->exchange.stats->retransmissions++;
+
+      if (_api_lan_async_rq_send (ctx, rq) < 0)
+        _api_lan_async_rq_done (ctx, rq, -1);
     }
 
-  rv = 0;
- cleanup:
-  fiid_obj_destroy (obj_cmd_rq);
-  fiid_obj_destroy (obj_cmd_rs);
-  return (rv);
+  return;
+
+ fail:
+  _api_lan_async_rq_fail (ctx);
 }
 
-int
-api_lan_2_0_close_session (ipmi_ctx_t ctx)
+/* returns 1 when the session is established, 0 if not yet, -1 on error */
+static int
+_api_lan_async_process_open (ipmi_ctx_t ctx, short revents)
 {
-  fiid_obj_t obj_cmd_rq = NULL;
-  fiid_obj_t obj_cmd_rs = NULL;
-  uint8_t payload_authenticated;
-  uint8_t payload_encrypted;
-  unsigned int internal_workaround_flags = 0;
-  int ret, rv = -1;
-
-  /* Do not use ipmi_cmd_close_session(), we use a close session retransmit workaround */
+  struct ipmi_ctx_async *async;
+  uint8_t pkt[IPMI_MAX_PKT_LEN];
+  struct timeval current;
+  struct timeval retransmission_timeout;
+  int recv_len, ret;
 
   assert (ctx
           && ctx->magic == IPMI_CTX_MAGIC
-          && ctx->type == IPMI_DEVICE_LAN_2_0
-          && ctx->io.outofband.sockfd);
+          && ctx->io.outofband.sockfd
+          && (ctx->type == IPMI_DEVICE_LAN
+              || ctx->type == IPMI_DEVICE_LAN_2_0)
+          && ctx->io.outofband.async.op == IPMI_CTX_ASYNC_OP_OPEN_SESSION);
 
-  if (!(obj_cmd_rq = fiid_obj_create (tmpl_cmd_close_session_rq)))
+  async = &(ctx->io.outofband.async);
+
+  if (!async->in_exchange)
+    return (1);
+
+  if ((revents & (POLLIN | POLLERR))
+      || ctx->io.outofband.mux_peer)
     {
-      API_ERRNO_TO_API_ERRNUM (ctx, errno);
-      return (-1);
+      while (1)
+        {
+          if ((recv_len = _api_lan_async_recvfrom (ctx,
+                                                   pkt,
+                                                   IPMI_MAX_PKT_LEN)) < 0)
+            goto exchange_error;
+
+          if (!recv_len)
+            break;
+
+          if ((ret = _api_lan_exchange_packet (ctx,
+                                               &(async->exchange),
+                                               pkt,
+                                               recv_len)) < 0)
+            goto exchange_error;
+
+          if (!ret)
+            continue;
+
+          if ((ret = _api_lan_async_exchange_done (ctx)))
+            return (ret);
+        }
     }
 
-  if (!(obj_cmd_rs = fiid_obj_create (tmpl_cmd_close_session_rs)))
+  if ((ret = _api_lan_exchange_timed_out (ctx, &(async->exchange))) < 0)
+    goto exchange_error;
+
+  if (ret)
     {
-      API_ERRNO_TO_API_ERRNUM (ctx, errno);
-      return (-1);
+      if (async->exchange.stats)
+        async->exchange.stats->timeouts++;
+      goto exchange_error;
     }
 
-  if (fill_cmd_close_session (ctx->io.outofband.managed_system_session_id,
-                              NULL,
-                              obj_cmd_rq) < 0)
+  if (!ctx->io.outofband.retransmission_timeout)
+    return (0);
+
+  if (gettimeofday (&current, NULL) < 0)
     {
       API_ERRNO_TO_API_ERRNUM (ctx, errno);
-      goto cleanup;
+      goto exchange_error;
     }
 
-  api_lan_2_0_cmd_get_session_parameters (ctx,
-                                          &payload_authenticated,
-                                          &payload_encrypted);
+  _retransmission_timeout (ctx,
+                           &(ctx->io.outofband.last_send),
+                           async->exchange.retransmission_count,
+                           &retransmission_timeout);
 
-  internal_workaround_flags |= IPMI_INTERNAL_WORKAROUND_FLAGS_CLOSE_SESSION_SKIP_RETRANSMIT;
+  if (timercmp (&current, &retransmission_timeout, <))
+    return (0);
 
-  if (api_lan_2_0_cmd_wrapper (ctx,
-                               internal_workaround_flags,
-                               IPMI_BMC_IPMB_LUN_BMC,
-                               IPMI_NET_FN_APP_RQ,
-                               IPMI_PAYLOAD_TYPE_IPMI,
-                               payload_authenticated,
-                               payload_encrypted,
-                               NULL,
-                               &(ctx->io.outofband.session_sequence_number),
-                               ctx->io.outofband.managed_system_session_id,
-                               &(ctx->io.outofband.rq_seq),
-                               ctx->io.outofband.authentication_algorithm,
-                               ctx->io.outofband.integrity_algorithm,
-                               ctx->io.outofband.confidentiality_algorithm,
-                               ctx->io.outofband.integrity_key_ptr,
-                               ctx->io.outofband.integrity_key_len,
-                               ctx->io.outofband.confidentiality_key_ptr,
-                               ctx->io.outofband.confidentiality_key_len,
-                               strlen (ctx->io.outofband.password) ? ctx->io.outofband.password : NULL,
-                               strlen (ctx->io.outofband.password),
-                               obj_cmd_rq,
-                               obj_cmd_rs) < 0)
-    goto cleanup;
+  if ((ret = _api_lan_exchange_retransmit (ctx, &(async->exchange))) < 0)
+    goto exchange_error;
 
-  /* Check completion code just for tracing, but don't return error */
+  if (ret)
+    return (_api_lan_async_exchange_done (ctx));
 
-  if ((ret = ipmi_check_completion_code_success (obj_cmd_rs)) < 0)
+  return (0);
+
+ exchange_error:
+  _api_lan_session_setup_exchange_error (ctx, &(async->setup));
+  return (-1);
+}
+
+int
+api_lan_async_process (ipmi_ctx_t ctx, short revents)
+{
+  struct ipmi_ctx_async *async;
+  int ret;
+
+  assert (ctx
+          && ctx->magic == IPMI_CTX_MAGIC
+          && ctx->io.outofband.sockfd
+          && (ctx->type == IPMI_DEVICE_LAN
+              || ctx->type == IPMI_DEVICE_LAN_2_0)
+          && ctx->io.outofband.async.op != IPMI_CTX_ASYNC_OP_NONE);
+
+  async = &(ctx->io.outofband.async);
+
+  if (async->op == IPMI_CTX_ASYNC_OP_CMD)
     {
-      API_ERRNO_TO_API_ERRNUM (ctx, errno);
-      goto out;
+      /* report earlier completions first */
+      if (!_api_lan_async_rq_find (ctx, IPMI_CTX_ASYNC_RQ_DONE))
+        _api_lan_async_process_cmd (ctx, revents);
+
+      return (_api_lan_async_rq_find (ctx, IPMI_CTX_ASYNC_RQ_DONE) ? 1 : 0);
     }
 
-  if (!ret)
+  if ((ret = _api_lan_async_process_open (ctx, revents)) >= 0)
+    return (ret);
+
+  if (_api_lan_session_setup_fallback (ctx, &(async->setup)) <= 0)
+    return (-1);
+
+  if (async->in_exchange)
     {
-      API_BAD_RESPONSE_TO_API_ERRNUM (ctx, obj_cmd_rs);
-      goto out;
+      _api_lan_exchange_finish (&(async->exchange));
+      async->in_exchange = 0;
     }
 
- out:
-  rv = 0;
- cleanup:
-  fiid_obj_destroy (obj_cmd_rq);
-  fiid_obj_destroy (obj_cmd_rs);
-  return (rv);
+  if (_api_lan_async_exchange_start (ctx) < 0)
+    return (-1);
+
+  return (0);
+}
+
+void
+api_lan_async_cleanup (ipmi_ctx_t ctx)
+{
+  struct ipmi_ctx_async *async;
+  unsigned int i;
+
+  assert (ctx
+          && ctx->magic == IPMI_CTX_MAGIC
+          && (ctx->type == IPMI_DEVICE_LAN
+              || ctx->type == IPMI_DEVICE_LAN_2_0));
+
+  async = &(ctx->io.outofband.async);
+
+  if (async->in_exchange)
+    _api_lan_exchange_finish (&(async->exchange));
+
+  if (async->op == IPMI_CTX_ASYNC_OP_OPEN_SESSION)
+    _api_lan_session_setup_cleanup (&(async->setup));
+
+  for (i = 0; i < IPMI_ASYNC_WINDOW_MAX; i++)
+    {
+      if (async->rq[i].state == IPMI_CTX_ASYNC_RQ_PENDING)
+        _api_lan_exchange_finish (&(async->rq[i].exchange));
+    }
+
+  memset (async, '\0', sizeof (struct ipmi_ctx_async));
 }
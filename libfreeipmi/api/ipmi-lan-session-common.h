@@ -88,4 +88,36 @@ int api_lan_2_0_open_session (ipmi_ctx_t ctx);
 
 int api_lan_2_0_close_session (ipmi_ctx_t ctx);
 
+/* Asynchronous session setup and commands, for LAN and LAN_2_0.
+ *
+ * api_lan_async_open_session() sends the first request of session
+ * setup, api_lan_async_process() then returns 1 when it completed
+ * successfully, 0 if it is still outstanding, and -1 if it failed.
+ * api_lan_async_cleanup() must be called after completion, failure,
+ * or to abandon it.
+ *
+ * api_lan_async_cmd() sends a command, up to IPMI_ASYNC_WINDOW_MAX
+ * may be outstanding.  api_lan_async_process() returns 1 when a
+ * command completed, which is then removed with
+ * api_lan_async_cmd_complete(), returning its result and setting
+ * errnum.  api_lan_async_cleanup() abandons all commands.
+ */
+int api_lan_async_open_session (ipmi_ctx_t ctx);
+
+int api_lan_async_cmd (ipmi_ctx_t ctx,
+                       fiid_obj_t obj_cmd_rq,
+                       fiid_obj_t obj_cmd_rs,
+                       Ipmi_Ctx_Async_Callback callback,
+                       void *callback_data);
+
+int api_lan_async_cmd_complete (ipmi_ctx_t ctx,
+                                Ipmi_Ctx_Async_Callback *callback,
+                                void **callback_data);
+
+int api_lan_async_timeout (ipmi_ctx_t ctx, int *timeout);
+
+int api_lan_async_process (ipmi_ctx_t ctx, short revents);
+
+void api_lan_async_cleanup (ipmi_ctx_t ctx);
+
 #endif /* IPMI_LAN_SESSION_COMMON_H */
@@ -0,0 +1,765 @@
+/*
+ * Copyright (C) 2003-2015 FreeIPMI Core Team
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif /* HAVE_CONFIG_H */
+
+#include <stdio.h>
+#include <stdlib.h>
+#ifdef STDC_HEADERS
+#include <string.h>
+#endif /* STDC_HEADERS */
+#if HAVE_UNISTD_H
+#include <unistd.h>
+#endif /* HAVE_UNISTD_H */
+#if TIME_WITH_SYS_TIME
+#include <sys/time.h>
+#include <time.h>
+#else /* !TIME_WITH_SYS_TIME */
+#if HAVE_SYS_TIME_H
+#include <sys/time.h>
+#else /* !HAVE_SYS_TIME_H */
+#include <time.h>
+#endif /* !HAVE_SYS_TIME_H */
+#endif  /* !TIME_WITH_SYS_TIME */
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <sys/poll.h>
+#include <netinet/in.h>
+#include <pthread.h>
+#include <assert.h>
+#include <errno.h>
+
+#include "freeipmi/api/ipmi-api.h"
+#include "freeipmi/interface/ipmi-lan-interface.h"
+
+#include "ipmi-api-defs.h"
+#include "ipmi-api-trace.h"
+#include "ipmi-api-util.h"
+#include "ipmi-mux.h"
+
+#include "freeipmi-portability.h"
+#include "hash.h"
+
+#define IPMI_MUX_MAGIC 0xfafab1b1
+
+/* chains stay short with a few thousand sessions */
+#define IPMI_MUX_HASH_LEN 4099
+
+/* packets queued for a context beyond this are dropped, the BMC
+ * will see a retransmission
+ */
+#define IPMI_MUX_QUEUE_MAX 16
+
+/* One UDP socket of the pool.  The socket is read by one thread at
+ * a time, the reader queues every packet it receives to the
+ * context it belongs to and wakes the others up.
+ */
+struct ipmi_mux_socket
+{
+  int fd;
+  int family;
+  unsigned int peers;
+  int reading;
+  pthread_cond_t cond;
+};
+
+struct ipmi_mux_pkt
+{
+  struct ipmi_mux_pkt *next;
+  unsigned int len;
+  uint8_t *data;
+};
+
+/* a context attached to a socket, found by the BMC address packets
+ * arrive from.  A socket carries at most one context per BMC
+ * address.
+ */
+struct ipmi_mux_peer
+{
+  struct ipmi_mux_peer *next;
+  struct ipmi_mux_socket *s;
+  struct sockaddr_in6 addr;
+  unsigned int hash;
+  struct ipmi_mux_pkt *head;
+  struct ipmi_mux_pkt *tail;
+  unsigned int count;
+};
+
+struct ipmi_mux
+{
+  uint32_t magic;
+  pthread_mutex_t mutex;
+  unsigned int refcount;
+  unsigned int sockets_per_family;
+  struct ipmi_mux_socket **sockets;
+  unsigned int sockets_len;
+  struct ipmi_mux_peer *hash[IPMI_MUX_HASH_LEN];
+};
+
+ipmi_mux_t
+ipmi_mux_create (unsigned int sockets)
+{
+  struct ipmi_mux *mux;
+  int perr;
+
+  if (!(mux = (struct ipmi_mux *)malloc (sizeof (struct ipmi_mux))))
+    {
+      ERRNO_TRACE (errno);
+      return (NULL);
+    }
+
+  memset (mux, '\0', sizeof (struct ipmi_mux));
+  mux->magic = IPMI_MUX_MAGIC;
+  mux->refcount = 1;
+  mux->sockets_per_family = sockets ? sockets : IPMI_MUX_SOCKETS_DEFAULT;
+
+  if ((perr = pthread_mutex_init (&mux->mutex, NULL)))
+    {
+      errno = perr;
+      ERRNO_TRACE (errno);
+      free (mux);
+      return (NULL);
+    }
+
+  return (mux);
+}
+
+static void
+_mux_free (struct ipmi_mux *mux)
+{
+  unsigned int i;
+
+  assert (mux
+          && mux->magic == IPMI_MUX_MAGIC
+          && !mux->refcount);
+
+  for (i = 0; i < mux->sockets_len; i++)
+    {
+      /* ignore potential error, cleanup path */
+      close (mux->sockets[i]->fd);
+      pthread_cond_destroy (&mux->sockets[i]->cond);
+      free (mux->sockets[i]);
+    }
+  free (mux->sockets);
+
+  pthread_mutex_destroy (&mux->mutex);
+  mux->magic = ~IPMI_MUX_MAGIC;
+  free (mux);
+}
+
+int
+api_mux_ref (ipmi_mux_t mux)
+{
+  int perr;
+
+  assert (mux && mux->magic == IPMI_MUX_MAGIC);
+
+  if ((perr = pthread_mutex_lock (&mux->mutex)))
+    {
+      errno = perr;
+      return (-1);
+    }
+
+  mux->refcount++;
+
+  pthread_mutex_unlock (&mux->mutex);
+  return (0);
+}
+
+void
+api_mux_unref (ipmi_mux_t mux)
+{
+  unsigned int refcount;
+
+  assert (mux && mux->magic == IPMI_MUX_MAGIC);
+
+  if (pthread_mutex_lock (&mux->mutex))
+    return;
+
+  refcount = --mux->refcount;
+
+  pthread_mutex_unlock (&mux->mutex);
+
+  if (!refcount)
+    _mux_free (mux);
+}
+
+void
+ipmi_mux_destroy (ipmi_mux_t mux)
+{
+  if (!mux || mux->magic != IPMI_MUX_MAGIC)
+    return;
+
+  api_mux_unref (mux);
+}
+
+/* addresses are stored and compared as sockaddr_in6, large enough
+ * for either family
+ */
+static void
+_mux_addr_copy (struct sockaddr_in6 *dest,
+                const struct sockaddr *src)
+{
+  assert (dest
+          && src
+          && (src->sa_family == AF_INET
+              || src->sa_family == AF_INET6));
+
+  memset (dest, '\0', sizeof (struct sockaddr_in6));
+  if (src->sa_family == AF_INET)
+    memcpy (dest, src, sizeof (struct sockaddr_in));
+  else
+    memcpy (dest, src, sizeof (struct sockaddr_in6));
+}
+
+static int
+_mux_addr_equal (const struct sockaddr_in6 *a,
+                 const struct sockaddr_in6 *b)
+{
+  assert (a && b);
+
+  if (a->sin6_family != b->sin6_family)
+    return (0);
+
+  if (a->sin6_family == AF_INET)
+    {
+      const struct sockaddr_in *a4 = (const struct sockaddr_in *)a;
+      const struct sockaddr_in *b4 = (const struct sockaddr_in *)b;
+
+      return (a4->sin_port == b4->sin_port
+              && a4->sin_addr.s_addr == b4->sin_addr.s_addr);
+    }
+
+  return (a->sin6_port == b->sin6_port
+          && !memcmp (&a->sin6_addr, &b->sin6_addr, sizeof (struct in6_addr)));
+}
+
+static unsigned int
+_mux_hash (const struct ipmi_mux_socket *s, const struct sockaddr_in6 *addr)
+{
+  const void *p;
+  unsigned int len;
+  unsigned int h;
+
+  assert (s && addr);
+
+  if (addr->sin6_family == AF_INET)
+    {
+      p = &((const struct sockaddr_in *)addr)->sin_addr;
+      len = sizeof (struct in_addr);
+    }
+  else
+    {
+      p = &addr->sin6_addr;
+      len = sizeof (struct in6_addr);
+    }
+
+  h = hash_key_bytes (p, len, HASH_KEY_BYTES_INIT);
+  h = hash_key_bytes (&addr->sin6_port, sizeof (addr->sin6_port), h);
+  h = hash_key_bytes (&s->fd, sizeof (s->fd), h);
+
+  return (h % IPMI_MUX_HASH_LEN);
+}
+
+static struct ipmi_mux_peer *
+_mux_peer_find (struct ipmi_mux *mux,
+                const struct ipmi_mux_socket *s,
+                const struct sockaddr_in6 *addr)
+{
+  struct ipmi_mux_peer *peer;
+
+  assert (mux && s && addr);
+
+  peer = mux->hash[_mux_hash (s, addr)];
+  while (peer)
+    {
+      if (peer->s == s
+          && _mux_addr_equal (&peer->addr, addr))
+        return (peer);
+      peer = peer->next;
+    }
+
+  return (NULL);
+}
+
+static struct ipmi_mux_socket *
+_mux_socket_open (ipmi_ctx_t ctx, struct ipmi_mux *mux)
+{
+  struct ipmi_mux_socket *s = NULL;
+  struct ipmi_mux_socket **sockets;
+  int perr;
+
+  assert (ctx
+          && ctx->magic == IPMI_CTX_MAGIC
+          && mux);
+
+  if (!(sockets = (struct ipmi_mux_socket **)realloc (mux->sockets,
+                                                      sizeof (struct ipmi_mux_socket *) * (mux->sockets_len + 1))))
+    {
+      API_SET_ERRNUM (ctx, IPMI_ERR_OUT_OF_MEMORY);
+      goto cleanup;
+    }
+  mux->sockets = sockets;
+
+  if (!(s = (struct ipmi_mux_socket *)malloc (sizeof (struct ipmi_mux_socket))))
+    {
+      API_SET_ERRNUM (ctx, IPMI_ERR_OUT_OF_MEMORY);
+      goto cleanup;
+    }
+  memset (s, '\0', sizeof (struct ipmi_mux_socket));
+  s->family = ctx->io.outofband.remote_host->sa_family;
+
+  if ((s->fd = socket (s->family, SOCK_DGRAM, 0)) < 0)
+    {
+      API_ERRNO_TO_API_ERRNUM (ctx, errno);
+      goto cleanup;
+    }
+
+  /* zero everywhere, secure ephemeral port, see _setup_socket() */
+  if (bind (s->fd,
+            ctx->io.outofband.srcaddr,
+            ctx->io.outofband.srcaddr_len) < 0)
+    {
+      API_ERRNO_TO_API_ERRNUM (ctx, errno);
+      goto cleanup;
+    }
+
+  if ((perr = pthread_cond_init (&s->cond, NULL)))
+    {
+      API_ERRNO_TO_API_ERRNUM (ctx, perr);
+      goto cleanup;
+    }
+
+  mux->sockets[mux->sockets_len++] = s;
+  return (s);
+
+ cleanup:
+  if (s)
+    {
+      /* ignore potential error, cleanup path */
+      if (s->fd >= 0)
+        close (s->fd);
+      free (s);
+    }
+  return (NULL);
+}
+
+/* Pick the least used socket of the pool that does not carry the
+ * BMC address yet, opening a new one while the pool is below its
+ * size or when all of them carry it.
+ */
+static int
+_mux_peer_attach (ipmi_ctx_t ctx,
+                  struct ipmi_mux *mux,
+                  struct ipmi_mux_socket *exclude)
+{
+  struct ipmi_mux_peer *peer = NULL;
+  struct ipmi_mux_socket *s = NULL;
+  struct sockaddr_in6 addr;
+  unsigned int family_count = 0;
+  unsigned int i;
+
+  assert (ctx
+          && ctx->magic == IPMI_CTX_MAGIC
+          && (ctx->type == IPMI_DEVICE_LAN
+              || ctx->type == IPMI_DEVICE_LAN_2_0)
+          && mux);
+
+  _mux_addr_copy (&addr, ctx->io.outofband.remote_host);
+
+  for (i = 0; i < mux->sockets_len; i++)
+    {
+      if (mux->sockets[i]->family != addr.sin6_family)
+        continue;
+
+      family_count++;
+
+      if (mux->sockets[i] == exclude
+          || _mux_peer_find (mux, mux->sockets[i], &addr))
+        continue;
+
+      if (!s || mux->sockets[i]->peers < s->peers)
+        s = mux->sockets[i];
+    }
+
+  if (!s
+      || (s->peers && family_count < mux->sockets_per_family))
+    {
+      if (!(s = _mux_socket_open (ctx, mux)))
+        return (-1);
+    }
+
+  if (!(peer = (struct ipmi_mux_peer *)malloc (sizeof (struct ipmi_mux_peer))))
+    {
+      API_SET_ERRNUM (ctx, IPMI_ERR_OUT_OF_MEMORY);
+      return (-1);
+    }
+  memset (peer, '\0', sizeof (struct ipmi_mux_peer));
+  peer->s = s;
+  memcpy (&peer->addr, &addr, sizeof (struct sockaddr_in6));
+  peer->hash = _mux_hash (s, &addr);
+
+  peer->next = mux->hash[peer->hash];
+  mux->hash[peer->hash] = peer;
+  s->peers++;
+
+  ctx->io.outofband.mux_peer = peer;
+  ctx->io.outofband.sockfd = s->fd;
+  return (0);
+}
+
+static void
+_mux_peer_detach (struct ipmi_mux *mux, struct ipmi_mux_peer *peer)
+{
+  struct ipmi_mux_peer **pp;
+  struct ipmi_mux_pkt *p;
+
+  assert (mux && peer);
+
+  pp = &(mux->hash[peer->hash]);
+  while (*pp != peer)
+    {
+      assert (*pp);
+      pp = &((*pp)->next);
+    }
+  *pp = peer->next;
+  peer->s->peers--;
+
+  while (peer->head)
+    {
+      p = peer->head;
+      peer->head = p->next;
+      free (p);
+    }
+
+  free (peer);
+}
+
+int
+api_mux_attach (ipmi_ctx_t ctx)
+{
+  int perr;
+  int rv;
+
+  assert (ctx
+          && ctx->magic == IPMI_CTX_MAGIC
+          && ctx->mux
+          && !ctx->io.outofband.mux_peer);
+
+  if ((perr = pthread_mutex_lock (&ctx->mux->mutex)))
+    {
+      API_ERRNO_TO_API_ERRNUM (ctx, perr);
+      return (-1);
+    }
+
+  rv = _mux_peer_attach (ctx, ctx->mux, NULL);
+
+  pthread_mutex_unlock (&ctx->mux->mutex);
+  return (rv);
+}
+
+int
+api_mux_move (ipmi_ctx_t ctx)
+{
+  struct ipmi_mux_peer *peer;
+  int perr;
+  int rv = -1;
+
+  assert (ctx
+          && ctx->magic == IPMI_CTX_MAGIC
+          && ctx->mux
+          && ctx->io.outofband.mux_peer);
+
+  if ((perr = pthread_mutex_lock (&ctx->mux->mutex)))
+    {
+      API_ERRNO_TO_API_ERRNUM (ctx, perr);
+      return (-1);
+    }
+
+  peer = ctx->io.outofband.mux_peer;
+
+  if (_mux_peer_attach (ctx, ctx->mux, peer->s) < 0)
+    goto cleanup;
+
+  _mux_peer_detach (ctx->mux, peer);
+  rv = 0;
+
+ cleanup:
+  pthread_mutex_unlock (&ctx->mux->mutex);
+  return (rv);
+}
+
+void
+api_mux_detach (ipmi_ctx_t ctx)
+{
+  assert (ctx
+          && ctx->magic == IPMI_CTX_MAGIC
+          && ctx->mux
+          && ctx->io.outofband.mux_peer);
+
+  /* ignore potential error, cleanup path */
+  pthread_mutex_lock (&ctx->mux->mutex);
+  _mux_peer_detach (ctx->mux, ctx->io.outofband.mux_peer);
+  pthread_mutex_unlock (&ctx->mux->mutex);
+
+  ctx->io.outofband.mux_peer = NULL;
+  ctx->io.outofband.sockfd = 0;
+}
+
+/* read everything waiting on the socket and queue it to the contexts
+ * it belongs to, called with the mutex held
+ */
+static void
+_mux_drain (struct ipmi_mux *mux, struct ipmi_mux_socket *s)
+{
+  uint8_t buf[IPMI_MAX_PKT_LEN];
+  struct sockaddr_in6 from;
+  socklen_t fromlen;
+  struct ipmi_mux_peer *peer;
+  struct ipmi_mux_pkt *p;
+  ssize_t len;
+
+  assert (mux && s);
+
+  while (1)
+    {
+      fromlen = sizeof (struct sockaddr_in6);
+      memset (&from, '\0', sizeof (struct sockaddr_in6));
+      if ((len = ipmi_lan_recvfrom (s->fd,
+                                    buf,
+                                    IPMI_MAX_PKT_LEN,
+                                    MSG_DONTWAIT,
+                                    (struct sockaddr *)&from,
+                                    &fromlen)) < 0)
+        {
+          if (errno == EINTR
+              || errno == ECONNRESET
+              || errno == ECONNREFUSED)
+            continue;
+          break;
+        }
+
+      if (!len
+          || (from.sin6_family != AF_INET
+              && from.sin6_family != AF_INET6))
+        continue;
+
+      if (!(peer = _mux_peer_find (mux, s, &from))
+          || peer->count >= IPMI_MUX_QUEUE_MAX)
+        continue;
+
+      if (!(p = (struct ipmi_mux_pkt *)malloc (sizeof (struct ipmi_mux_pkt) + len)))
+        continue;
+      p->next = NULL;
+      p->len = len;
+      p->data = (uint8_t *)(p + 1);
+      memcpy (p->data, buf, len);
+
+      if (peer->tail)
+        peer->tail->next = p;
+      else
+        peer->head = p;
+      peer->tail = p;
+      peer->count++;
+    }
+}
+
+static int
+_mux_pop (struct ipmi_mux_peer *peer, void *pkt, unsigned int pkt_len)
+{
+  struct ipmi_mux_pkt *p;
+  unsigned int len;
+
+  assert (peer
+          && peer->head
+          && pkt
+          && pkt_len);
+
+  p = peer->head;
+  if (!(peer->head = p->next))
+    peer->tail = NULL;
+  peer->count--;
+
+  /* truncate like recvfrom() */
+  len = p->len < pkt_len ? p->len : pkt_len;
+  memcpy (pkt, p->data, len);
+  free (p);
+  return (len);
+}
+
+/* milliseconds until deadline, 0 if passed */
+static int
+_mux_remaining (const struct timeval *deadline)
+{
+  struct timeval current;
+  struct timeval remaining;
+
+  assert (deadline);
+
+  if (gettimeofday (&current, NULL) < 0)
+    return (0);
+
+  if (!timercmp (&current, deadline, <))
+    return (0);
+
+  timersub (deadline, &current, &remaining);
+  return ((remaining.tv_sec * 1000) + (remaining.tv_usec + 999) / 1000);
+}
+
+int
+api_mux_recvfrom (ipmi_ctx_t ctx,
+                  void *pkt,
+                  unsigned int pkt_len,
+                  int timeout)
+{
+  struct ipmi_mux *mux;
+  struct ipmi_mux_peer *peer;
+  struct ipmi_mux_socket *s;
+  struct timeval deadline;
+  int perr;
+  int rv = -1;
+
+  assert (ctx
+          && ctx->magic == IPMI_CTX_MAGIC
+          && ctx->mux
+          && ctx->io.outofband.mux_peer
+          && pkt
+          && pkt_len);
+
+  mux = ctx->mux;
+  peer = ctx->io.outofband.mux_peer;
+  s = peer->s;
+
+  if (timeout > 0)
+    {
+      struct timeval tv;
+
+      if (gettimeofday (&deadline, NULL) < 0)
+        return (-1);
+      tv.tv_sec = timeout / 1000;
+      tv.tv_usec = (timeout % 1000) * 1000;
+      timeradd (&deadline, &tv, &deadline);
+    }
+
+  if ((perr = pthread_mutex_lock (&mux->mutex)))
+    {
+      errno = perr;
+      return (-1);
+    }
+
+  while (1)
+    {
+      if (peer->head)
+        {
+          rv = _mux_pop (peer, pkt, pkt_len);
+          break;
+        }
+
+      if (!s->reading)
+        {
+          struct pollfd pfd;
+          int n = 1;
+
+          if (timeout)
+            {
+              s->reading = 1;
+              pthread_mutex_unlock (&mux->mutex);
+
+              pfd.fd = s->fd;
+              pfd.events = POLLIN;
+              pfd.revents = 0;
+
+              n = poll (&pfd, 1, timeout > 0 ? _mux_remaining (&deadline) : -1);
+              perr = errno;
+
+              pthread_mutex_lock (&mux->mutex);
+              s->reading = 0;
+              pthread_cond_broadcast (&s->cond);
+
+              if (n < 0 && perr != EINTR)
+                {
+                  errno = perr;
+                  break;
+                }
+            }
+
+          if (n)
+            _mux_drain (mux, s);
+
+          if (peer->head)
+            continue;
+
+          if (!timeout
+              || (timeout > 0 && !_mux_remaining (&deadline)))
+            {
+              rv = 0;
+              break;
+            }
+
+          continue;
+        }
+
+      /* another thread is reading the socket */
+      if (!timeout)
+        {
+          rv = 0;
+          break;
+        }
+
+      if (timeout > 0)
+        {
+          struct timespec ts;
+
+          ts.tv_sec = deadline.tv_sec;
+          ts.tv_nsec = deadline.tv_usec * 1000;
+
+          if ((perr = pthread_cond_timedwait (&s->cond, &mux->mutex, &ts)) == ETIMEDOUT
+              && !peer->head)
+            {
+              rv = 0;
+              break;
+            }
+        }
+      else
+        pthread_cond_wait (&s->cond, &mux->mutex);
+    }
+
+  pthread_mutex_unlock (&mux->mutex);
+  return (rv);
+}
+
+int
+api_mux_pending (ipmi_ctx_t ctx)
+{
+  int rv;
+
+  assert (ctx
+          && ctx->magic == IPMI_CTX_MAGIC
+          && ctx->mux
+          && ctx->io.outofband.mux_peer);
+
+  if (pthread_mutex_lock (&ctx->mux->mutex))
+    return (0);
+
+  rv = ctx->io.outofband.mux_peer->head ? 1 : 0;
+
+  pthread_mutex_unlock (&ctx->mux->mutex);
+  return (rv);
+}
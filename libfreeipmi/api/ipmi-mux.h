@@ -0,0 +1,53 @@
+/*
+ * Copyright (C) 2003-2015 FreeIPMI Core Team
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef IPMI_MUX_H
+#define IPMI_MUX_H
+
+#include <freeipmi/api/ipmi-api.h>
+
+/* returns 0 on success, -1 on error, errno set */
+int api_mux_ref (ipmi_mux_t mux);
+
+void api_mux_unref (ipmi_mux_t mux);
+
+/* attach the outofband context to a socket of ctx->mux, errnum set
+ * on error
+ */
+int api_mux_attach (ipmi_ctx_t ctx);
+
+/* move the context to a different socket, i.e. a different source
+ * port, errnum set on error
+ */
+int api_mux_move (ipmi_ctx_t ctx);
+
+void api_mux_detach (ipmi_ctx_t ctx);
+
+/* like recvfrom(), returns length received, 0 on timeout, -1 on
+ * error with errno set.  timeout in milliseconds, -1 waits forever,
+ * 0 does not wait.
+ */
+int api_mux_recvfrom (ipmi_ctx_t ctx,
+                      void *pkt,
+                      unsigned int pkt_len,
+                      int timeout);
+
+/* returns 1 if packets are queued for the context, 0 if not */
+int api_mux_pending (ipmi_ctx_t ctx);
+
+#endif /* IPMI_MUX_H */
@@ -35,6 +35,7 @@
 #include "ipmi-api-trace.h"
 #include "ipmi-api-util.h"
 #include "ipmi-openipmi-driver-api.h"
+#include "ipmi-pkt-trace.h"
 
 #include "libcommon/ipmi-fiid-util.h"
 
@@ -52,6 +53,8 @@ api_openipmi_cmd (ipmi_ctx_t ctx,
                   fiid_obj_t obj_cmd_rq,
                   fiid_obj_t obj_cmd_rs)
 {
+  int errnum;
+
   assert (ctx
           && ctx->magic == IPMI_CTX_MAGIC
           && ctx->type == IPMI_DEVICE_OPENIPMI
@@ -59,16 +62,24 @@ api_openipmi_cmd (ipmi_ctx_t ctx,
           && fiid_obj_packet_valid (obj_cmd_rq) == 1
           && fiid_obj_valid (obj_cmd_rs));
 
-  if (ipmi_openipmi_cmd (ctx->io.inband.openipmi_ctx,
-                         ctx->target.lun,
-                         ctx->target.net_fn,
-                         obj_cmd_rq,
-                         obj_cmd_rs) < 0)
+  api_pkt_trace_obj (ctx, API_PKT_TRACE_REQUEST, obj_cmd_rq);
+
+  /* the driver context may be shared w/ other threads, take the
+   * errnum of this request rather than the context's
+   */
+  if (ipmi_openipmi_cmd_r (ctx->io.inband.openipmi_ctx,
+                           ctx->target.lun,
+                           ctx->target.net_fn,
+                           obj_cmd_rq,
+                           obj_cmd_rs,
+                           &errnum) < 0)
     {
-      API_OPENIPMI_ERRNUM_TO_API_ERRNUM (ctx, ipmi_openipmi_ctx_errnum (ctx->io.inband.openipmi_ctx));
+      API_OPENIPMI_ERRNUM_TO_API_ERRNUM (ctx, errnum);
       return (-1);
     }
 
+  api_pkt_trace_obj (ctx, API_PKT_TRACE_RESPONSE, obj_cmd_rs);
+
   return (0);
 }
 
@@ -77,6 +88,8 @@ api_openipmi_cmd_ipmb (ipmi_ctx_t ctx,
                        fiid_obj_t obj_cmd_rq,
                        fiid_obj_t obj_cmd_rs)
 {
+  int errnum;
+
   assert (ctx
           && ctx->magic == IPMI_CTX_MAGIC
           && ctx->type == IPMI_DEVICE_OPENIPMI
@@ -84,18 +97,23 @@ api_openipmi_cmd_ipmb (ipmi_ctx_t ctx,
           && fiid_obj_packet_valid (obj_cmd_rq) == 1
           && fiid_obj_valid (obj_cmd_rs));
 
-  if (ipmi_openipmi_cmd_ipmb (ctx->io.inband.openipmi_ctx,
-                              ctx->target.channel_number,
-                              ctx->target.rs_addr,
-                              ctx->target.lun,
-                              ctx->target.net_fn,
-                              obj_cmd_rq,
-                              obj_cmd_rs) < 0)
+  api_pkt_trace_obj (ctx, API_PKT_TRACE_REQUEST, obj_cmd_rq);
+
+  if (ipmi_openipmi_cmd_ipmb_r (ctx->io.inband.openipmi_ctx,
+                                ctx->target.channel_number,
+                                ctx->target.rs_addr,
+                                ctx->target.lun,
+                                ctx->target.net_fn,
+                                obj_cmd_rq,
+                                obj_cmd_rs,
+                                &errnum) < 0)
     {
-      API_OPENIPMI_ERRNUM_TO_API_ERRNUM (ctx, ipmi_openipmi_ctx_errnum (ctx->io.inband.openipmi_ctx));
+      API_OPENIPMI_ERRNUM_TO_API_ERRNUM (ctx, errnum);
       return (-1);
     }
 
+  api_pkt_trace_obj (ctx, API_PKT_TRACE_RESPONSE, obj_cmd_rs);
+
   return (0);
 }
 
@@ -118,25 +136,20 @@ api_openipmi_cmd_raw (ipmi_ctx_t ctx,
           && buf_rs
           && buf_rs_len);
 
-  if (!(obj_cmd_rq = fiid_obj_create (tmpl_openipmi_raw)))
+  if (!(obj_cmd_rq = fiid_obj_view_create_in (ctx->arena,
+                                              tmpl_openipmi_raw,
+                                              buf_rq,
+                                              buf_rq_len)))
     {
       API_ERRNO_TO_API_ERRNUM (ctx, errno);
       goto cleanup;
     }
-  if (!(obj_cmd_rs = fiid_obj_create (tmpl_openipmi_raw)))
+  if (!(obj_cmd_rs = fiid_obj_create_in (ctx->arena, tmpl_openipmi_raw)))
     {
       API_ERRNO_TO_API_ERRNUM (ctx, errno);
       goto cleanup;
     }
 
-  if (fiid_obj_set_all (obj_cmd_rq,
-                        buf_rq,
-                        buf_rq_len) < 0)
-    {
-      API_FIID_OBJECT_ERROR_TO_API_ERRNUM (ctx, obj_cmd_rq);
-      goto cleanup;
-    }
-
   if (api_openipmi_cmd (ctx,
                         obj_cmd_rq,
                         obj_cmd_rs) < 0)
@@ -176,25 +189,20 @@ api_openipmi_cmd_raw_ipmb (ipmi_ctx_t ctx,
           && buf_rs
           && buf_rs_len);
 
-  if (!(obj_cmd_rq = fiid_obj_create (tmpl_openipmi_raw)))
+  if (!(obj_cmd_rq = fiid_obj_view_create_in (ctx->arena,
+                                              tmpl_openipmi_raw,
+                                              buf_rq,
+                                              buf_rq_len)))
     {
       API_ERRNO_TO_API_ERRNUM (ctx, errno);
       goto cleanup;
     }
-  if (!(obj_cmd_rs = fiid_obj_create (tmpl_openipmi_raw)))
+  if (!(obj_cmd_rs = fiid_obj_create_in (ctx->arena, tmpl_openipmi_raw)))
     {
       API_ERRNO_TO_API_ERRNUM (ctx, errno);
       goto cleanup;
     }
 
-  if (fiid_obj_set_all (obj_cmd_rq,
-                        buf_rq,
-                        buf_rq_len) < 0)
-    {
-      API_FIID_OBJECT_ERROR_TO_API_ERRNUM (ctx, obj_cmd_rq);
-      goto cleanup;
-    }
-
   if (api_openipmi_cmd_ipmb (ctx,
                              obj_cmd_rq,
                              obj_cmd_rs) < 0)
@@ -0,0 +1,537 @@
+/*
+ * Copyright (C) 2003-2015 FreeIPMI Core Team
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif /* HAVE_CONFIG_H */
+
+#include <stdio.h>
+#include <stdlib.h>
+#ifdef STDC_HEADERS
+#include <string.h>
+#endif /* STDC_HEADERS */
+#if HAVE_UNISTD_H
+#include <unistd.h>
+#endif /* HAVE_UNISTD_H */
+#if TIME_WITH_SYS_TIME
+#include <sys/time.h>
+#include <time.h>
+#else /* !TIME_WITH_SYS_TIME */
+#if HAVE_SYS_TIME_H
+#include <sys/time.h>
+#else /* !HAVE_SYS_TIME_H */
+#include <time.h>
+#endif /* !HAVE_SYS_TIME_H */
+#endif  /* !TIME_WITH_SYS_TIME */
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <assert.h>
+#include <errno.h>
+
+#include "freeipmi/api/ipmi-api.h"
+
+#include "ipmi-api-defs.h"
+#include "ipmi-api-trace.h"
+#include "ipmi-pkt-trace.h"
+
+#include "freeipmi-portability.h"
+
+/* records start on 8 byte boundaries */
+#define API_PKT_TRACE_ALIGN(__len) (((__len) + 7) & ~7)
+
+/* keeps the compiler from moving writes to the buffer across
+ * updates of head and tail, the only ordering a signal handler
+ * interrupting the update can observe
+ */
+#if defined (__GNUC__)
+#define API_PKT_TRACE_BARRIER() __asm__ __volatile__ ("" : : : "memory")
+#else /* !__GNUC__ */
+#define API_PKT_TRACE_BARRIER()
+#endif /* !__GNUC__ */
+
+#define API_PKT_TRACE_PCAP_MAGIC             0xa1b2c3d4
+#define API_PKT_TRACE_PCAP_VERSION_MAJOR     2
+#define API_PKT_TRACE_PCAP_VERSION_MINOR     4
+#define API_PKT_TRACE_PCAP_SNAPLEN           65535
+#define API_PKT_TRACE_PCAP_LINKTYPE_RAW      101
+#define API_PKT_TRACE_PCAP_LINKTYPE_USER0    147
+
+#define API_PKT_TRACE_IPV4_HDR_LEN           20
+#define API_PKT_TRACE_IPV6_HDR_LEN           40
+#define API_PKT_TRACE_UDP_HDR_LEN            8
+#define API_PKT_TRACE_IP_TTL                 64
+#define API_PKT_TRACE_IPPROTO_UDP            17
+
+/* header of every record, followed by the packet.  A record without
+ * a packet pads the rest of the buffer.
+ */
+struct api_pkt_trace_record
+{
+  uint32_t len;                 /* of the record, padding included */
+  uint32_t pkt_len;
+  uint32_t tv_sec;
+  uint32_t tv_usec;
+  uint8_t direction;
+  uint8_t family;               /* AF_INET, AF_INET6, 0 if inband */
+  uint16_t local_port;          /* network byte order */
+  uint16_t remote_port;
+  uint16_t reserved;
+  uint8_t local_addr[16];
+  uint8_t remote_addr[16];
+};
+
+struct api_pkt_trace_pcap_hdr
+{
+  uint32_t magic;
+  uint16_t version_major;
+  uint16_t version_minor;
+  int32_t thiszone;
+  uint32_t sigfigs;
+  uint32_t snaplen;
+  uint32_t network;
+};
+
+struct api_pkt_trace_pcap_record_hdr
+{
+  uint32_t ts_sec;
+  uint32_t ts_usec;
+  uint32_t incl_len;
+  uint32_t orig_len;
+};
+
+int
+api_pkt_trace_create (ipmi_ctx_t ctx, unsigned int size)
+{
+  unsigned int pow2 = IPMI_PKT_TRACE_SIZE_MIN;
+  uint8_t *buf;
+
+  assert (ctx
+          && ctx->magic == IPMI_CTX_MAGIC
+          && size >= IPMI_PKT_TRACE_SIZE_MIN);
+
+  /* offsets are taken modulo the size, a power of two stays
+   * consistent when they overflow
+   */
+  while (pow2 <= size / 2)
+    pow2 *= 2;
+
+  if (!(buf = (uint8_t *)malloc (pow2)))
+    return (-1);
+
+  api_pkt_trace_destroy (ctx);
+
+  ctx->pkt_trace.buf = buf;
+  ctx->pkt_trace.size = pow2;
+  ctx->pkt_trace.head = 0;
+  ctx->pkt_trace.tail = 0;
+  ctx->pkt_trace.sockfd = -1;
+  return (0);
+}
+
+void
+api_pkt_trace_destroy (ipmi_ctx_t ctx)
+{
+  assert (ctx && ctx->magic == IPMI_CTX_MAGIC);
+
+  free (ctx->pkt_trace.buf);
+  memset (&ctx->pkt_trace, '\0', sizeof (struct ipmi_ctx_pkt_trace));
+}
+
+static void
+_pkt_trace_addresses (ipmi_ctx_t ctx, struct api_pkt_trace_record *rec)
+{
+  struct ipmi_ctx_pkt_trace *t;
+  struct sockaddr *remote;
+
+  assert (ctx
+          && ctx->magic == IPMI_CTX_MAGIC
+          && (ctx->type == IPMI_DEVICE_LAN
+              || ctx->type == IPMI_DEVICE_LAN_2_0)
+          && rec);
+
+  t = &ctx->pkt_trace;
+
+  if (!(remote = ctx->io.outofband.remote_host))
+    return;
+
+  if (t->sockfd != ctx->io.outofband.sockfd)
+    {
+      socklen_t len = sizeof (struct sockaddr_storage);
+
+      /* ignore error, the local address is informational */
+      if (getsockname (ctx->io.outofband.sockfd,
+                       (struct sockaddr *)&t->local,
+                       &len) < 0)
+        memset (&t->local, '\0', sizeof (struct sockaddr_storage));
+      t->sockfd = ctx->io.outofband.sockfd;
+    }
+
+  if (remote->sa_family == AF_INET)
+    {
+      struct sockaddr_in *remote4 = (struct sockaddr_in *)remote;
+
+      rec->family = AF_INET;
+      memcpy (rec->remote_addr, &remote4->sin_addr, sizeof (struct in_addr));
+      rec->remote_port = remote4->sin_port;
+      if (t->local.ss_family == AF_INET)
+        {
+          struct sockaddr_in *local4 = (struct sockaddr_in *)&t->local;
+
+          memcpy (rec->local_addr, &local4->sin_addr, sizeof (struct in_addr));
+          rec->local_port = local4->sin_port;
+        }
+    }
+  else if (remote->sa_family == AF_INET6)
+    {
+      struct sockaddr_in6 *remote6 = (struct sockaddr_in6 *)remote;
+
+      rec->family = AF_INET6;
+      memcpy (rec->remote_addr, &remote6->sin6_addr, sizeof (struct in6_addr));
+      rec->remote_port = remote6->sin6_port;
+      if (t->local.ss_family == AF_INET6)
+        {
+          struct sockaddr_in6 *local6 = (struct sockaddr_in6 *)&t->local;
+
+          memcpy (rec->local_addr, &local6->sin6_addr, sizeof (struct in6_addr));
+          rec->local_port = local6->sin6_port;
+        }
+    }
+}
+
+/* drop the oldest records until the buffer has room up to 'end' */
+static void
+_pkt_trace_reclaim (struct ipmi_ctx_pkt_trace *t, unsigned long end)
+{
+  uint32_t len;
+
+  assert (t);
+
+  while (end - t->tail > t->size)
+    {
+      memcpy (&len, t->buf + (t->tail & (t->size - 1)), sizeof (uint32_t));
+      t->tail += len;
+    }
+
+  API_PKT_TRACE_BARRIER ();
+}
+
+void
+api_pkt_trace (ipmi_ctx_t ctx,
+               int direction,
+               const void *pkt,
+               unsigned int pkt_len)
+{
+  struct ipmi_ctx_pkt_trace *t;
+  struct api_pkt_trace_record rec;
+  struct timeval tv;
+  unsigned int len, offset;
+
+  assert (ctx
+          && ctx->magic == IPMI_CTX_MAGIC
+          && (direction == API_PKT_TRACE_REQUEST
+              || direction == API_PKT_TRACE_RESPONSE)
+          && pkt);
+
+  t = &ctx->pkt_trace;
+
+  if (!t->buf || !pkt_len)
+    return;
+
+  len = API_PKT_TRACE_ALIGN (sizeof (struct api_pkt_trace_record) + pkt_len);
+  if (len > t->size)
+    return;
+
+  memset (&rec, '\0', sizeof (struct api_pkt_trace_record));
+
+  /* ignore error, the packet is still worth having */
+  if (gettimeofday (&tv, NULL) < 0)
+    timerclear (&tv);
+
+  rec.len = len;
+  rec.pkt_len = pkt_len;
+  rec.tv_sec = tv.tv_sec;
+  rec.tv_usec = tv.tv_usec;
+  rec.direction = direction;
+
+  if (ctx->type == IPMI_DEVICE_LAN
+      || ctx->type == IPMI_DEVICE_LAN_2_0)
+    _pkt_trace_addresses (ctx, &rec);
+
+  offset = t->head & (t->size - 1);
+
+  if (offset + len > t->size)
+    {
+      uint32_t pad[2];
+
+      pad[0] = t->size - offset;
+      pad[1] = 0;
+
+      _pkt_trace_reclaim (t, t->head + pad[0]);
+      memcpy (t->buf + offset, pad, sizeof (pad));
+      API_PKT_TRACE_BARRIER ();
+      t->head += pad[0];
+      offset = 0;
+    }
+
+  _pkt_trace_reclaim (t, t->head + len);
+  memcpy (t->buf + offset, &rec, sizeof (struct api_pkt_trace_record));
+  memcpy (t->buf + offset + sizeof (struct api_pkt_trace_record), pkt, pkt_len);
+  API_PKT_TRACE_BARRIER ();
+  t->head += len;
+}
+
+void
+api_pkt_trace_obj (ipmi_ctx_t ctx, int direction, fiid_obj_t obj)
+{
+  uint8_t pkt[IPMI_MAX_PKT_LEN];
+  uint8_t net_fn;
+  int len;
+
+  assert (ctx
+          && ctx->magic == IPMI_CTX_MAGIC
+          && (direction == API_PKT_TRACE_REQUEST
+              || direction == API_PKT_TRACE_RESPONSE)
+          && fiid_obj_valid (obj));
+
+  if (!ctx->pkt_trace.buf)
+    return;
+
+  net_fn = ctx->target.net_fn;
+  if (direction == API_PKT_TRACE_RESPONSE)
+    net_fn++;
+
+  /* KCS header, lun in the low two bits */
+  pkt[0] = (net_fn << 2) | (ctx->target.lun & 0x3);
+
+  /* ignore error, trace what is known */
+  if ((len = fiid_obj_get_all (obj, pkt + 1, IPMI_MAX_PKT_LEN - 1)) < 0)
+    len = 0;
+
+  api_pkt_trace (ctx, direction, pkt, len + 1);
+}
+
+static int
+_write_n (int fd, const void *buf, unsigned int len)
+{
+  const uint8_t *ptr = buf;
+  ssize_t n;
+
+  while (len)
+    {
+      if ((n = write (fd, ptr, len)) < 0)
+        {
+          if (errno == EINTR)
+            continue;
+          return (-1);
+        }
+      ptr += n;
+      len -= n;
+    }
+
+  return (0);
+}
+
+static uint32_t
+_checksum_add (uint32_t sum, const uint8_t *buf, unsigned int len)
+{
+  unsigned int i;
+
+  for (i = 0; i + 1 < len; i += 2)
+    sum += (buf[i] << 8) | buf[i + 1];
+  if (len & 1)
+    sum += buf[len - 1] << 8;
+
+  return (sum);
+}
+
+static uint16_t
+_checksum_fold (uint32_t sum)
+{
+  while (sum >> 16)
+    sum = (sum & 0xFFFF) + (sum >> 16);
+
+  return (~sum & 0xFFFF);
+}
+
+/* IP and UDP headers of an outofband record, returns the length of
+ * the headers
+ */
+static unsigned int
+_pkt_trace_ip_udp_hdr (const struct api_pkt_trace_record *rec,
+                       const uint8_t *pkt,
+                       uint8_t *hdr)
+{
+  const uint8_t *src_addr, *dst_addr;
+  uint16_t src_port, dst_port;
+  unsigned int addr_len, ip_hdr_len, udp_len;
+  uint8_t *udp;
+  uint32_t sum;
+  uint16_t csum;
+
+  assert (rec
+          && (rec->family == AF_INET || rec->family == AF_INET6)
+          && pkt
+          && hdr);
+
+  if (rec->direction == API_PKT_TRACE_REQUEST)
+    {
+      src_addr = rec->local_addr;
+      src_port = rec->local_port;
+      dst_addr = rec->remote_addr;
+      dst_port = rec->remote_port;
+    }
+  else
+    {
+      src_addr = rec->remote_addr;
+      src_port = rec->remote_port;
+      dst_addr = rec->local_addr;
+      dst_port = rec->local_port;
+    }
+
+  udp_len = API_PKT_TRACE_UDP_HDR_LEN + rec->pkt_len;
+
+  if (rec->family == AF_INET)
+    {
+      addr_len = sizeof (struct in_addr);
+      ip_hdr_len = API_PKT_TRACE_IPV4_HDR_LEN;
+
+      memset (hdr, '\0', ip_hdr_len);
+      hdr[0] = 0x45;            /* version 4, 5 words */
+      hdr[2] = (ip_hdr_len + udp_len) >> 8;
+      hdr[3] = (ip_hdr_len + udp_len) & 0xFF;
+      hdr[8] = API_PKT_TRACE_IP_TTL;
+      hdr[9] = API_PKT_TRACE_IPPROTO_UDP;
+      memcpy (hdr + 12, src_addr, addr_len);
+      memcpy (hdr + 16, dst_addr, addr_len);
+      csum = _checksum_fold (_checksum_add (0, hdr, ip_hdr_len));
+      hdr[10] = csum >> 8;
+      hdr[11] = csum & 0xFF;
+    }
+  else
+    {
+      addr_len = sizeof (struct in6_addr);
+      ip_hdr_len = API_PKT_TRACE_IPV6_HDR_LEN;
+
+      memset (hdr, '\0', ip_hdr_len);
+      hdr[0] = 0x60;            /* version 6 */
+      hdr[4] = udp_len >> 8;
+      hdr[5] = udp_len & 0xFF;
+      hdr[6] = API_PKT_TRACE_IPPROTO_UDP;
+      hdr[7] = API_PKT_TRACE_IP_TTL;
+      memcpy (hdr + 8, src_addr, addr_len);
+      memcpy (hdr + 24, dst_addr, addr_len);
+    }
+
+  udp = hdr + ip_hdr_len;
+  memcpy (udp, &src_port, sizeof (uint16_t));
+  memcpy (udp + 2, &dst_port, sizeof (uint16_t));
+  udp[4] = udp_len >> 8;
+  udp[5] = udp_len & 0xFF;
+  udp[6] = 0;
+  udp[7] = 0;
+
+  /* pseudo header, UDP header and payload */
+  sum = _checksum_add (0, src_addr, addr_len);
+  sum = _checksum_add (sum, dst_addr, addr_len);
+  sum += API_PKT_TRACE_IPPROTO_UDP;
+  sum += udp_len;
+  sum = _checksum_add (sum, udp, API_PKT_TRACE_UDP_HDR_LEN);
+  sum = _checksum_add (sum, pkt, rec->pkt_len);
+  if (!(csum = _checksum_fold (sum)))
+    csum = 0xFFFF;
+  udp[6] = csum >> 8;
+  udp[7] = csum & 0xFF;
+
+  return (ip_hdr_len + API_PKT_TRACE_UDP_HDR_LEN);
+}
+
+int
+api_pkt_trace_write (ipmi_ctx_t ctx, int fd)
+{
+  struct ipmi_ctx_pkt_trace *t;
+  struct api_pkt_trace_pcap_hdr pcap_hdr;
+  struct api_pkt_trace_record rec;
+  unsigned long head, tail, pos;
+  int outofband = 0;
+
+  assert (ctx && ctx->magic == IPMI_CTX_MAGIC);
+
+  t = &ctx->pkt_trace;
+
+  head = t->head;
+  tail = t->tail;
+
+  /* the kind of packet traced last decides the link type */
+  for (pos = tail; pos != head; pos += rec.len)
+    {
+      memcpy (&rec, t->buf + (pos & (t->size - 1)), sizeof (uint32_t) * 2);
+      if (!rec.pkt_len)
+        continue;
+      memcpy (&rec, t->buf + (pos & (t->size - 1)), sizeof (struct api_pkt_trace_record));
+      outofband = rec.family ? 1 : 0;
+    }
+
+  memset (&pcap_hdr, '\0', sizeof (struct api_pkt_trace_pcap_hdr));
+  pcap_hdr.magic = API_PKT_TRACE_PCAP_MAGIC;
+  pcap_hdr.version_major = API_PKT_TRACE_PCAP_VERSION_MAJOR;
+  pcap_hdr.version_minor = API_PKT_TRACE_PCAP_VERSION_MINOR;
+  pcap_hdr.snaplen = API_PKT_TRACE_PCAP_SNAPLEN;
+  pcap_hdr.network = outofband ? API_PKT_TRACE_PCAP_LINKTYPE_RAW : API_PKT_TRACE_PCAP_LINKTYPE_USER0;
+
+  if (_write_n (fd, &pcap_hdr, sizeof (struct api_pkt_trace_pcap_hdr)) < 0)
+    return (-1);
+
+  for (pos = tail; pos != head; pos += rec.len)
+    {
+      struct api_pkt_trace_pcap_record_hdr pcap_rec_hdr;
+      uint8_t hdr[API_PKT_TRACE_IPV6_HDR_LEN + API_PKT_TRACE_UDP_HDR_LEN];
+      unsigned int hdr_len;
+      const uint8_t *pkt;
+
+      memcpy (&rec, t->buf + (pos & (t->size - 1)), sizeof (uint32_t) * 2);
+      if (!rec.pkt_len)
+        continue;
+      memcpy (&rec, t->buf + (pos & (t->size - 1)), sizeof (struct api_pkt_trace_record));
+
+      if ((rec.family ? 1 : 0) != outofband)
+        continue;
+
+      pkt = t->buf + (pos & (t->size - 1)) + sizeof (struct api_pkt_trace_record);
+
+      if (outofband)
+        hdr_len = _pkt_trace_ip_udp_hdr (&rec, pkt, hdr);
+      else
+        {
+          hdr[0] = rec.direction;
+          hdr_len = 1;
+        }
+
+      pcap_rec_hdr.ts_sec = rec.tv_sec;
+      pcap_rec_hdr.ts_usec = rec.tv_usec;
+      pcap_rec_hdr.incl_len = hdr_len + rec.pkt_len;
+      pcap_rec_hdr.orig_len = hdr_len + rec.pkt_len;
+
+      if (_write_n (fd, &pcap_rec_hdr, sizeof (struct api_pkt_trace_pcap_record_hdr)) < 0
+          || _write_n (fd, hdr, hdr_len) < 0
+          || _write_n (fd, pkt, rec.pkt_len) < 0)
+        return (-1);
+    }
+
+  return (0);
+}
@@ -0,0 +1,51 @@
+/*
+ * Copyright (C) 2003-2015 FreeIPMI Core Team
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef IPMI_PKT_TRACE_H
+#define IPMI_PKT_TRACE_H
+
+#include <freeipmi/api/ipmi-api.h>
+#include <freeipmi/fiid/fiid.h>
+
+#define API_PKT_TRACE_REQUEST  0
+#define API_PKT_TRACE_RESPONSE 1
+
+/* returns 0 on success, -1 on error, errno set */
+int api_pkt_trace_create (ipmi_ctx_t ctx, unsigned int size);
+
+void api_pkt_trace_destroy (ipmi_ctx_t ctx);
+
+/* trace a packet sent to or received from the BMC, does nothing if
+ * tracing is disabled
+ */
+void api_pkt_trace (ipmi_ctx_t ctx,
+                    int direction,
+                    const void *pkt,
+                    unsigned int pkt_len);
+
+/* trace an inband request or response of a driver that does not
+ * assemble packets, as the KCS packet it would be
+ */
+void api_pkt_trace_obj (ipmi_ctx_t ctx, int direction, fiid_obj_t obj);
+
+/* write the trace in pcap format, async signal safe.  returns 0 on
+ * success, -1 on error, errno set
+ */
+int api_pkt_trace_write (ipmi_ctx_t ctx, int fd);
+
+#endif /* IPMI_PKT_TRACE_H */
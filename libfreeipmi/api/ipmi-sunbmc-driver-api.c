@@ -34,6 +34,7 @@
 #include "ipmi-api-defs.h"
 #include "ipmi-api-trace.h"
 #include "ipmi-api-util.h"
+#include "ipmi-pkt-trace.h"
 #include "ipmi-sunbmc-driver-api.h"
 
 #include "libcommon/ipmi-fiid-util.h"
@@ -59,6 +60,8 @@ api_sunbmc_cmd (ipmi_ctx_t ctx,
           && fiid_obj_packet_valid (obj_cmd_rq) == 1
           && fiid_obj_valid (obj_cmd_rs));
 
+  api_pkt_trace_obj (ctx, API_PKT_TRACE_REQUEST, obj_cmd_rq);
+
   if (ipmi_sunbmc_cmd (ctx->io.inband.sunbmc_ctx,
                        ctx->target.lun,
                        ctx->target.net_fn,
@@ -69,6 +72,8 @@ api_sunbmc_cmd (ipmi_ctx_t ctx,
       return (-1);
     }
 
+  api_pkt_trace_obj (ctx, API_PKT_TRACE_RESPONSE, obj_cmd_rs);
+
   return (0);
 }
 
@@ -91,24 +96,21 @@ api_sunbmc_cmd_raw (ipmi_ctx_t ctx,
           && buf_rs
           && buf_rs_len);
 
-  if (!(obj_cmd_rq = fiid_obj_create (tmpl_sunbmc_raw)))
+  if (!(obj_cmd_rq = fiid_obj_view_create_in (ctx->arena,
+                                              tmpl_sunbmc_raw,
+                                              buf_rq,
+                                              buf_rq_len)))
     {
       API_ERRNO_TO_API_ERRNUM (ctx, errno);
       goto cleanup;
     }
-  if (!(obj_cmd_rs = fiid_obj_create (tmpl_sunbmc_raw)))
+  if (!(obj_cmd_rs = fiid_obj_create_in (ctx->arena, tmpl_sunbmc_raw)))
     {
       API_ERRNO_TO_API_ERRNUM (ctx, errno);
       goto cleanup;
     }
 
-  if (fiid_obj_set_all (obj_cmd_rq,
-                        buf_rq,
-                        buf_rq_len) < 0)
-    {
-      API_FIID_OBJECT_ERROR_TO_API_ERRNUM (ctx, obj_cmd_rq);
-      goto cleanup;
-    }
+  api_pkt_trace_obj (ctx, API_PKT_TRACE_REQUEST, obj_cmd_rq);
 
   if (ipmi_sunbmc_cmd (ctx->io.inband.sunbmc_ctx,
                        ctx->target.lun,
@@ -120,6 +122,8 @@ api_sunbmc_cmd_raw (ipmi_ctx_t ctx,
       goto cleanup;
     }
 
+  api_pkt_trace_obj (ctx, API_PKT_TRACE_RESPONSE, obj_cmd_rs);
+
   if ((len = fiid_obj_get_all (obj_cmd_rs,
                                buf_rs,
                                buf_rs_len)) < 0)
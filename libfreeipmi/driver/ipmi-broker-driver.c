@@ -0,0 +1,549 @@
+/*
+ * Copyright (C) 2003-2015 FreeIPMI Core Team
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif /* HAVE_CONFIG_H */
+
+#include <stdio.h>
+#include <stdlib.h>
+#ifdef STDC_HEADERS
+#include <string.h>
+#endif /* STDC_HEADERS */
+#if HAVE_UNISTD_H
+#include <unistd.h>
+#endif /* HAVE_UNISTD_H */
+#include <sys/types.h>
+#if HAVE_FCNTL_H
+#include <fcntl.h>
+#endif /* HAVE_FCNTL_H */
+#if TIME_WITH_SYS_TIME
+#include <sys/time.h>
+#include <time.h>
+#else /* !TIME_WITH_SYS_TIME */
+#if HAVE_SYS_TIME_H
+#include <sys/time.h>
+#else /* !HAVE_SYS_TIME_H */
+#include <time.h>
+#endif /* !HAVE_SYS_TIME_H */
+#endif  /* !TIME_WITH_SYS_TIME */
+#include <sys/poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <assert.h>
+#include <errno.h>
+
+#include "freeipmi/driver/ipmi-broker-driver.h"
+#include "freeipmi/spec/ipmi-channel-spec.h"
+#include "freeipmi/spec/ipmi-ipmb-lun-spec.h"
+#include "freeipmi/spec/ipmi-netfn-spec.h"
+
+#include "ipmi-driver-trace.h"
+
+#include "libcommon/ipmi-fiid-util.h"
+
+#include "freeipmi-portability.h"
+
+/* the broker itself times out requests to the BMC, this only
+ * catches a broker that hangs
+ */
+#define IPMI_BROKER_TIMEOUT     120
+
+static char * ipmi_broker_ctx_errmsg[] =
+  {
+    "success",
+    "broker context null",
+    "broker context invalid",
+    "invalid parameter",
+    "permission denied",
+    "device not found",
+    "io not initialized",
+    "out of memory",
+    "driver timeout",
+    "internal system error",
+    "internal error",
+    "errnum out of range",
+    NULL,
+  };
+
+#define IPMI_BROKER_CTX_MAGIC 0xb0cab0ca
+
+#define IPMI_BROKER_FLAGS_MASK IPMI_BROKER_FLAGS_DEFAULT
+
+struct ipmi_broker_ctx {
+  uint32_t magic;
+  int errnum;
+  unsigned int flags;
+  char *driver_device;
+  int device_fd;
+  int io_init;
+};
+
+static void
+_set_broker_ctx_errnum_by_errno (ipmi_broker_ctx_t ctx, int _errno)
+{
+  if (!ctx || ctx->magic != IPMI_BROKER_CTX_MAGIC)
+    return;
+
+  if (_errno == 0)
+    ctx->errnum = IPMI_BROKER_ERR_SUCCESS;
+  else if (_errno == EPERM)
+    ctx->errnum = IPMI_BROKER_ERR_PERMISSION;
+  else if (_errno == EACCES)
+    ctx->errnum = IPMI_BROKER_ERR_PERMISSION;
+  else if (_errno == ENOENT)
+    ctx->errnum = IPMI_BROKER_ERR_DEVICE_NOT_FOUND;
+  else if (_errno == ENOTDIR)
+    ctx->errnum = IPMI_BROKER_ERR_DEVICE_NOT_FOUND;
+  else if (_errno == ENAMETOOLONG)
+    ctx->errnum = IPMI_BROKER_ERR_DEVICE_NOT_FOUND;
+  else if (_errno == ECONNREFUSED)
+    ctx->errnum = IPMI_BROKER_ERR_DEVICE_NOT_FOUND;
+  else if (_errno == ENOMEM)
+    ctx->errnum = IPMI_BROKER_ERR_OUT_OF_MEMORY;
+  else if (_errno == ETIMEDOUT)
+    ctx->errnum = IPMI_BROKER_ERR_DRIVER_TIMEOUT;
+  else
+    ctx->errnum = IPMI_BROKER_ERR_SYSTEM_ERROR;
+}
+
+ipmi_broker_ctx_t
+ipmi_broker_ctx_create (void)
+{
+  ipmi_broker_ctx_t ctx = NULL;
+
+  if (!(ctx = (ipmi_broker_ctx_t)malloc (sizeof (struct ipmi_broker_ctx))))
+    {
+      ERRNO_TRACE (errno);
+      return (NULL);
+    }
+
+  ctx->magic = IPMI_BROKER_CTX_MAGIC;
+  ctx->flags = IPMI_BROKER_FLAGS_DEFAULT;
+  ctx->driver_device = NULL;
+  ctx->device_fd = -1;
+  ctx->io_init = 0;
+
+  ctx->errnum = IPMI_BROKER_ERR_SUCCESS;
+  return (ctx);
+}
+
+void
+ipmi_broker_ctx_destroy (ipmi_broker_ctx_t ctx)
+{
+  if (!ctx || ctx->magic != IPMI_BROKER_CTX_MAGIC)
+    return;
+
+  ctx->magic = ~IPMI_BROKER_CTX_MAGIC;
+  ctx->errnum = IPMI_BROKER_ERR_SUCCESS;
+  free (ctx->driver_device);
+  /* ignore potential error, destroy path */
+  if (ctx->device_fd >= 0)
+    close (ctx->device_fd);
+  free (ctx);
+}
+
+int
+ipmi_broker_ctx_errnum (ipmi_broker_ctx_t ctx)
+{
+  if (!ctx)
+    return (IPMI_BROKER_ERR_NULL);
+  else if (ctx->magic != IPMI_BROKER_CTX_MAGIC)
+    return (IPMI_BROKER_ERR_INVALID);
+  else
+    return (ctx->errnum);
+}
+
+char *
+ipmi_broker_ctx_strerror (int errnum)
+{
+  if (errnum >= IPMI_BROKER_ERR_SUCCESS && errnum <= IPMI_BROKER_ERR_ERRNUMRANGE)
+    return (ipmi_broker_ctx_errmsg[errnum]);
+  else
+    return (ipmi_broker_ctx_errmsg[IPMI_BROKER_ERR_ERRNUMRANGE]);
+}
+
+char *
+ipmi_broker_ctx_errormsg (ipmi_broker_ctx_t ctx)
+{
+  return (ipmi_broker_ctx_strerror (ipmi_broker_ctx_errnum (ctx)));
+}
+
+int
+ipmi_broker_ctx_get_driver_device (ipmi_broker_ctx_t ctx, char **driver_device)
+{
+  if (!ctx || ctx->magic != IPMI_BROKER_CTX_MAGIC)
+    {
+      ERR_TRACE (ipmi_broker_ctx_errormsg (ctx), ipmi_broker_ctx_errnum (ctx));
+      return (-1);
+    }
+
+  if (!driver_device)
+    {
+      BROKER_SET_ERRNUM (ctx, IPMI_BROKER_ERR_PARAMETERS);
+      return (-1);
+    }
+
+  *driver_device = ctx->driver_device;
+  ctx->errnum = IPMI_BROKER_ERR_SUCCESS;
+  return (0);
+}
+
+int
+ipmi_broker_ctx_get_flags (ipmi_broker_ctx_t ctx, unsigned int *flags)
+{
+  if (!ctx || ctx->magic != IPMI_BROKER_CTX_MAGIC)
+    {
+      ERR_TRACE (ipmi_broker_ctx_errormsg (ctx), ipmi_broker_ctx_errnum (ctx));
+      return (-1);
+    }
+
+  if (!flags)
+    {
+      BROKER_SET_ERRNUM (ctx, IPMI_BROKER_ERR_PARAMETERS);
+      return (-1);
+    }
+
+  *flags = ctx->flags;
+  ctx->errnum = IPMI_BROKER_ERR_SUCCESS;
+  return (0);
+}
+
+int
+ipmi_broker_ctx_set_driver_device (ipmi_broker_ctx_t ctx, const char *driver_device)
+{
+  if (!ctx || ctx->magic != IPMI_BROKER_CTX_MAGIC)
+    {
+      ERR_TRACE (ipmi_broker_ctx_errormsg (ctx), ipmi_broker_ctx_errnum (ctx));
+      return (-1);
+    }
+
+  if (!driver_device)
+    {
+      BROKER_SET_ERRNUM (ctx, IPMI_BROKER_ERR_PARAMETERS);
+      return (-1);
+    }
+
+  free (ctx->driver_device);
+  ctx->driver_device = NULL;
+
+  if (!(ctx->driver_device = strdup (driver_device)))
+    {
+      BROKER_SET_ERRNUM (ctx, IPMI_BROKER_ERR_OUT_OF_MEMORY);
+      return (-1);
+    }
+
+  ctx->errnum = IPMI_BROKER_ERR_SUCCESS;
+  return (0);
+}
+
+int
+ipmi_broker_ctx_set_flags (ipmi_broker_ctx_t ctx, unsigned int flags)
+{
+  if (!ctx || ctx->magic != IPMI_BROKER_CTX_MAGIC)
+    {
+      ERR_TRACE (ipmi_broker_ctx_errormsg (ctx), ipmi_broker_ctx_errnum (ctx));
+      return (-1);
+    }
+
+  if (flags & ~IPMI_BROKER_FLAGS_MASK)
+    {
+      BROKER_SET_ERRNUM (ctx, IPMI_BROKER_ERR_PARAMETERS);
+      return (-1);
+    }
+
+  ctx->flags = flags;
+  ctx->errnum = IPMI_BROKER_ERR_SUCCESS;
+  return (0);
+}
+
+int
+ipmi_broker_ctx_io_init (ipmi_broker_ctx_t ctx)
+{
+  struct sockaddr_un addr;
+  char *driver_device;
+  int flags;
+
+  if (!ctx || ctx->magic != IPMI_BROKER_CTX_MAGIC)
+    {
+      ERR_TRACE (ipmi_broker_ctx_errormsg (ctx), ipmi_broker_ctx_errnum (ctx));
+      return (-1);
+    }
+
+  if (ctx->io_init)
+    goto out;
+
+  if (ctx->driver_device)
+    driver_device = ctx->driver_device;
+  else
+    driver_device = IPMI_BROKER_DRIVER_DEVICE_DEFAULT;
+
+  if (strlen (driver_device) >= sizeof (addr.sun_path))
+    {
+      BROKER_SET_ERRNUM (ctx, IPMI_BROKER_ERR_DEVICE_NOT_FOUND);
+      return (-1);
+    }
+
+  memset (&addr, '\0', sizeof (struct sockaddr_un));
+  addr.sun_family = AF_UNIX;
+  strcpy (addr.sun_path, driver_device);
+
+  if ((ctx->device_fd = socket (AF_UNIX, SOCK_SEQPACKET, 0)) < 0)
+    {
+      BROKER_ERRNO_TO_BROKER_ERRNUM (ctx, errno);
+      goto cleanup;
+    }
+
+  flags = fcntl (ctx->device_fd, F_GETFD);
+  if (flags < 0)
+    {
+      BROKER_ERRNO_TO_BROKER_ERRNUM (ctx, errno);
+      goto cleanup;
+    }
+  flags |= FD_CLOEXEC;
+  if (fcntl (ctx->device_fd, F_SETFD, flags) < 0)
+    {
+      BROKER_ERRNO_TO_BROKER_ERRNUM (ctx, errno);
+      goto cleanup;
+    }
+
+  if (connect (ctx->device_fd, (struct sockaddr *)&addr, sizeof (struct sockaddr_un)) < 0)
+    {
+      BROKER_ERRNO_TO_BROKER_ERRNUM (ctx, errno);
+      goto cleanup;
+    }
+
+  ctx->io_init = 1;
+ out:
+  ctx->errnum = IPMI_BROKER_ERR_SUCCESS;
+  return (0);
+
+ cleanup:
+  /* ignore potential error, error path */
+  if (ctx->device_fd >= 0)
+    close (ctx->device_fd);
+  ctx->device_fd = -1;
+  return (-1);
+}
+
+static int
+_broker_cmd (ipmi_broker_ctx_t ctx,
+             uint8_t target,
+             uint8_t channel_number,
+             uint8_t rs_addr,
+             uint8_t lun,
+             uint8_t net_fn,
+             fiid_obj_t obj_cmd_rq,
+             fiid_obj_t obj_cmd_rs)
+{
+  uint8_t buf[IPMI_BROKER_PKT_LEN_MAX];
+  struct pollfd pfd;
+  struct timeval deadline, now, delta;
+  ssize_t len;
+  int rq_len;
+  uint8_t cmd;
+  int n;
+
+  assert (ctx);
+  assert (ctx->magic == IPMI_BROKER_CTX_MAGIC);
+  assert (target == IPMI_BROKER_TARGET_BMC || target == IPMI_BROKER_TARGET_IPMB);
+  assert (IPMI_BMC_LUN_VALID (lun));
+  assert (IPMI_NET_FN_RQ_VALID (net_fn));
+  assert (fiid_obj_valid (obj_cmd_rq));
+  assert (fiid_obj_packet_valid (obj_cmd_rq) == 1);
+  assert (fiid_obj_valid (obj_cmd_rs));
+
+  buf[IPMI_BROKER_HDR_TARGET_INDEX] = target;
+  buf[IPMI_BROKER_HDR_CHANNEL_INDEX] = channel_number;
+  buf[IPMI_BROKER_HDR_RS_ADDR_INDEX] = rs_addr;
+  buf[IPMI_BROKER_HDR_NET_FN_LUN_INDEX] = (net_fn << IPMI_BROKER_NET_FN_SHIFT) | (lun & IPMI_BROKER_LUN_MASK);
+
+  if ((rq_len = fiid_obj_get_all (obj_cmd_rq,
+                                  buf + IPMI_BROKER_HDR_LEN,
+                                  IPMI_BROKER_PKT_LEN_MAX - IPMI_BROKER_HDR_LEN)) <= 0)
+    {
+      BROKER_SET_ERRNUM (ctx, IPMI_BROKER_ERR_INTERNAL_ERROR);
+      return (-1);
+    }
+  cmd = buf[IPMI_BROKER_HDR_LEN];
+
+#ifdef MSG_NOSIGNAL
+  if (send (ctx->device_fd, buf, IPMI_BROKER_HDR_LEN + rq_len, MSG_NOSIGNAL) < 0)
+#else /* !MSG_NOSIGNAL */
+  if (send (ctx->device_fd, buf, IPMI_BROKER_HDR_LEN + rq_len, 0) < 0)
+#endif /* !MSG_NOSIGNAL */
+    {
+      BROKER_ERRNO_TO_BROKER_ERRNUM (ctx, errno);
+      return (-1);
+    }
+
+  if (gettimeofday (&deadline, NULL) < 0)
+    {
+      BROKER_ERRNO_TO_BROKER_ERRNUM (ctx, errno);
+      return (-1);
+    }
+  deadline.tv_sec += IPMI_BROKER_TIMEOUT;
+
+  do {
+    if (gettimeofday (&now, NULL) < 0)
+      {
+        BROKER_ERRNO_TO_BROKER_ERRNUM (ctx, errno);
+        return (-1);
+      }
+
+    if (timercmp (&now, &deadline, >=))
+      {
+        n = 0;
+        break;
+      }
+
+    /* delta = deadline - now */
+    timersub (&deadline, &now, &delta);
+
+    pfd.fd = ctx->device_fd;
+    pfd.events = POLLIN;
+    pfd.revents = 0;
+
+    if ((n = poll (&pfd, 1, delta.tv_sec * 1000 + (delta.tv_usec + 999) / 1000)) < 0
+        && errno != EINTR)
+      {
+        BROKER_ERRNO_TO_BROKER_ERRNUM (ctx, errno);
+        return (-1);
+      }
+  } while (n < 0);
+
+  if (!n)
+    {
+      BROKER_SET_ERRNUM (ctx, IPMI_BROKER_ERR_DRIVER_TIMEOUT);
+      return (-1);
+    }
+
+  if ((len = recv (ctx->device_fd, buf, IPMI_BROKER_PKT_LEN_MAX, 0)) < 0)
+    {
+      BROKER_ERRNO_TO_BROKER_ERRNUM (ctx, errno);
+      return (-1);
+    }
+
+  /* broker went away or answered another request */
+  if (len < 3
+      || (buf[0] >> IPMI_BROKER_NET_FN_SHIFT) != net_fn + 1
+      || buf[1] != cmd)
+    {
+      BROKER_SET_ERRNUM (ctx, IPMI_BROKER_ERR_SYSTEM_ERROR);
+      return (-1);
+    }
+
+  if (fiid_obj_set_all (obj_cmd_rs,
+                        buf + 1,
+                        len - 1) < 0)
+    {
+      BROKER_SET_ERRNUM (ctx, IPMI_BROKER_ERR_INTERNAL_ERROR);
+      return (-1);
+    }
+
+  return (0);
+}
+
+int
+ipmi_broker_cmd (ipmi_broker_ctx_t ctx,
+                 uint8_t lun,
+                 uint8_t net_fn,
+                 fiid_obj_t obj_cmd_rq,
+                 fiid_obj_t obj_cmd_rs)
+{
+  if (!ctx || ctx->magic != IPMI_BROKER_CTX_MAGIC)
+    {
+      ERR_TRACE (ipmi_broker_ctx_errormsg (ctx), ipmi_broker_ctx_errnum (ctx));
+      return (-1);
+    }
+
+  if (!IPMI_BMC_LUN_VALID (lun)
+      || !IPMI_NET_FN_RQ_VALID (net_fn)
+      || !fiid_obj_valid (obj_cmd_rq)
+      || !fiid_obj_valid (obj_cmd_rs)
+      || fiid_obj_packet_valid (obj_cmd_rq) <= 0)
+    {
+      BROKER_SET_ERRNUM (ctx, IPMI_BROKER_ERR_PARAMETERS);
+      return (-1);
+    }
+
+  if (!ctx->io_init)
+    {
+      BROKER_SET_ERRNUM (ctx, IPMI_BROKER_ERR_IO_NOT_INITIALIZED);
+      return (-1);
+    }
+
+  if (_broker_cmd (ctx,
+                   IPMI_BROKER_TARGET_BMC,
+                   0,
+                   0,
+                   lun,
+                   net_fn,
+                   obj_cmd_rq,
+                   obj_cmd_rs) < 0)
+    return (-1);
+
+  ctx->errnum = IPMI_BROKER_ERR_SUCCESS;
+  return (0);
+}
+
+int
+ipmi_broker_cmd_ipmb (ipmi_broker_ctx_t ctx,
+                      uint8_t channel_number,
+                      uint8_t rs_addr,
+                      uint8_t lun,
+                      uint8_t net_fn,
+                      fiid_obj_t obj_cmd_rq,
+                      fiid_obj_t obj_cmd_rs)
+{
+  if (!ctx || ctx->magic != IPMI_BROKER_CTX_MAGIC)
+    {
+      ERR_TRACE (ipmi_broker_ctx_errormsg (ctx), ipmi_broker_ctx_errnum (ctx));
+      return (-1);
+    }
+
+  if (!IPMI_CHANNEL_NUMBER_VALID (channel_number)
+      || !IPMI_BMC_LUN_VALID (lun)
+      || !IPMI_NET_FN_RQ_VALID (net_fn)
+      || !fiid_obj_valid (obj_cmd_rq)
+      || !fiid_obj_valid (obj_cmd_rs)
+      || fiid_obj_packet_valid (obj_cmd_rq) <= 0)
+    {
+      BROKER_SET_ERRNUM (ctx, IPMI_BROKER_ERR_PARAMETERS);
+      return (-1);
+    }
+
+  if (!ctx->io_init)
+    {
+      BROKER_SET_ERRNUM (ctx, IPMI_BROKER_ERR_IO_NOT_INITIALIZED);
+      return (-1);
+    }
+
+  if (_broker_cmd (ctx,
+                   IPMI_BROKER_TARGET_IPMB,
+                   channel_number,
+                   rs_addr,
+                   lun,
+                   net_fn,
+                   obj_cmd_rq,
+                   obj_cmd_rs) < 0)
+    return (-1);
+
+  ctx->errnum = IPMI_BROKER_ERR_SUCCESS;
+  return (0);
+}
@@ -109,4 +109,28 @@
     TRACE_ERRNO_OUT (__errno);                                              \
   } while (0)
 
+#define MOCK_SET_ERRNUM(__ctx, __errnum)                                    \
+  do {                                                                      \
+    (__ctx)->errnum = (__errnum);                                           \
+    TRACE_MSG_OUT (ipmi_mock_ctx_errormsg ((__ctx)), (__errnum));           \
+  } while (0)
+
+#define MOCK_ERRNO_TO_MOCK_ERRNUM(__ctx, __errno)                           \
+  do {                                                                      \
+    _set_mock_ctx_errnum_by_errno ((__ctx), (__errno));                     \
+    TRACE_ERRNO_OUT (__errno);                                              \
+  } while (0)
+
+#define BROKER_SET_ERRNUM(__ctx, __errnum)                                  \
+  do {                                                                      \
+    (__ctx)->errnum = (__errnum);                                           \
+    TRACE_MSG_OUT (ipmi_broker_ctx_errormsg ((__ctx)), (__errnum));         \
+  } while (0)
+
+#define BROKER_ERRNO_TO_BROKER_ERRNUM(__ctx, __errno)                       \
+  do {                                                                      \
+    _set_broker_ctx_errnum_by_errno ((__ctx), (__errno));                   \
+    TRACE_ERRNO_OUT (__errno);                                              \
+  } while (0)
+
 #endif /* IPMI_DRIVER_TRACE_H */
@@ -0,0 +1,1294 @@
+/*
+ * Copyright (C) 2003-2015 FreeIPMI Core Team
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif /* HAVE_CONFIG_H */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <limits.h>
+#ifdef STDC_HEADERS
+#include <string.h>
+#endif /* STDC_HEADERS */
+#if HAVE_UNISTD_H
+#include <unistd.h>
+#endif /* HAVE_UNISTD_H */
+#include <sys/types.h>
+#include <sys/stat.h>
+#if HAVE_FCNTL_H
+#include <fcntl.h>
+#endif /* HAVE_FCNTL_H */
+#if TIME_WITH_SYS_TIME
+#include <sys/time.h>
+#include <time.h>
+#else /* !TIME_WITH_SYS_TIME */
+#if HAVE_SYS_TIME_H
+#include <sys/time.h>
+#else /* !HAVE_SYS_TIME_H */
+#include <time.h>
+#endif /* !HAVE_SYS_TIME_H */
+#endif  /* !TIME_WITH_SYS_TIME */
+#include <sys/select.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <assert.h>
+#include <errno.h>
+
+#include "freeipmi/driver/ipmi-mock-driver.h"
+#include "freeipmi/spec/ipmi-comp-code-spec.h"
+#include "freeipmi/spec/ipmi-ipmb-lun-spec.h"
+#include "freeipmi/spec/ipmi-netfn-spec.h"
+
+#include "ipmi-driver-trace.h"
+
+#include "libcommon/ipmi-fiid-util.h"
+
+#include "freeipmi-portability.h"
+
+#define IPMI_MOCK_BUFLEN                  1024
+
+#define IPMI_MOCK_TIMEOUT                 60
+
+#define IPMI_MOCK_ENTRIES_LEN_INIT        256
+
+#define IPMI_MOCK_SERVICE_TIMES_LEN_INIT  16
+
+/* KCS format header, net_fn in the upper six bits */
+#define IPMI_MOCK_NET_FN_SHIFT            2
+#define IPMI_MOCK_LUN_MASK                0x03
+
+/* packet trace, see ipmi_ctx_write_pkt_trace() */
+#define IPMI_MOCK_PCAP_MAGIC              0xa1b2c3d4
+#define IPMI_MOCK_PCAP_MAGIC_SWAPPED      0xd4c3b2a1
+#define IPMI_MOCK_PCAP_HDR_LEN            24
+#define IPMI_MOCK_PCAP_NETWORK_OFFSET     20
+#define IPMI_MOCK_PCAP_RECORD_HDR_LEN     16
+#define IPMI_MOCK_PCAP_LINKTYPE_USER0     147
+#define IPMI_MOCK_PCAP_REQUEST            0
+#define IPMI_MOCK_PCAP_RESPONSE           1
+
+#define IPMI_MOCK_SERVICE_TIME_STR        "service-time"
+
+static char * ipmi_mock_ctx_errmsg[] =
+  {
+    "success",
+    "mock context null",
+    "mock context invalid",
+    "invalid parameter",
+    "permission denied",
+    "device not found",
+    "driver path required",
+    "invalid recording",
+    "io not initialized",
+    "out of memory",
+    "driver timeout",
+    "internal system error",
+    "internal error",
+    "errnum out of range",
+    NULL,
+  };
+
+#define IPMI_MOCK_CTX_MAGIC 0xd0cc0d0c
+
+#define IPMI_MOCK_FLAGS_MASK IPMI_MOCK_FLAGS_NO_SERVICE_TIME
+
+/* A recorded request and its response.  Entries are sorted by
+ * net_fn and request, identical requests in recorded order.
+ */
+struct ipmi_mock_entry
+{
+  uint8_t net_fn;
+  uint8_t *rq;                  /* command, data */
+  unsigned int rq_len;
+  uint8_t *rs;                  /* command, completion code, data */
+  unsigned int rs_len;
+  int service_time;             /* usecs, < 0 if not recorded */
+  unsigned int order;
+  /* in the first entry of a run of identical requests or of
+   * requests of one command, the next of the run to answer with
+   */
+  unsigned int next;
+  unsigned int cmd_next;
+};
+
+struct ipmi_mock_service_time
+{
+  uint8_t net_fn;
+  uint8_t cmd;
+  unsigned int usec;
+};
+
+struct ipmi_mock_ctx {
+  uint32_t magic;
+  int errnum;
+  unsigned int flags;
+  char *driver_device;
+  int device_fd;
+  int io_init;
+  unsigned int default_service_time;
+  struct ipmi_mock_service_time *service_times;
+  unsigned int service_times_count;
+  unsigned int service_times_len;
+  struct ipmi_mock_entry *entries;
+  unsigned int entries_count;
+  unsigned int entries_len;
+};
+
+static void
+_set_mock_ctx_errnum_by_errno (ipmi_mock_ctx_t ctx, int _errno)
+{
+  if (!ctx || ctx->magic != IPMI_MOCK_CTX_MAGIC)
+    return;
+
+  if (_errno == 0)
+    ctx->errnum = IPMI_MOCK_ERR_SUCCESS;
+  else if (_errno == EPERM)
+    ctx->errnum = IPMI_MOCK_ERR_PERMISSION;
+  else if (_errno == EACCES)
+    ctx->errnum = IPMI_MOCK_ERR_PERMISSION;
+  else if (_errno == ENOENT)
+    ctx->errnum = IPMI_MOCK_ERR_DEVICE_NOT_FOUND;
+  else if (_errno == ENOTDIR)
+    ctx->errnum = IPMI_MOCK_ERR_DEVICE_NOT_FOUND;
+  else if (_errno == ENAMETOOLONG)
+    ctx->errnum = IPMI_MOCK_ERR_DEVICE_NOT_FOUND;
+  else if (_errno == ECONNREFUSED)
+    ctx->errnum = IPMI_MOCK_ERR_DEVICE_NOT_FOUND;
+  else if (_errno == ENOMEM)
+    ctx->errnum = IPMI_MOCK_ERR_OUT_OF_MEMORY;
+  else if (_errno == ETIMEDOUT)
+    ctx->errnum = IPMI_MOCK_ERR_DRIVER_TIMEOUT;
+  else
+    ctx->errnum = IPMI_MOCK_ERR_SYSTEM_ERROR;
+}
+
+static void
+_mock_entries_free (ipmi_mock_ctx_t ctx)
+{
+  unsigned int i;
+
+  assert (ctx);
+  assert (ctx->magic == IPMI_MOCK_CTX_MAGIC);
+
+  for (i = 0; i < ctx->entries_count; i++)
+    free (ctx->entries[i].rq);
+  free (ctx->entries);
+  ctx->entries = NULL;
+  ctx->entries_count = 0;
+  ctx->entries_len = 0;
+}
+
+ipmi_mock_ctx_t
+ipmi_mock_ctx_create (void)
+{
+  ipmi_mock_ctx_t ctx = NULL;
+
+  if (!(ctx = (ipmi_mock_ctx_t)malloc (sizeof (struct ipmi_mock_ctx))))
+    {
+      ERRNO_TRACE (errno);
+      return (NULL);
+    }
+
+  ctx->magic = IPMI_MOCK_CTX_MAGIC;
+  ctx->flags = IPMI_MOCK_FLAGS_DEFAULT;
+  ctx->driver_device = NULL;
+  ctx->device_fd = -1;
+  ctx->io_init = 0;
+  ctx->default_service_time = 0;
+  ctx->service_times = NULL;
+  ctx->service_times_count = 0;
+  ctx->service_times_len = 0;
+  ctx->entries = NULL;
+  ctx->entries_count = 0;
+  ctx->entries_len = 0;
+
+  ctx->errnum = IPMI_MOCK_ERR_SUCCESS;
+  return (ctx);
+}
+
+void
+ipmi_mock_ctx_destroy (ipmi_mock_ctx_t ctx)
+{
+  if (!ctx || ctx->magic != IPMI_MOCK_CTX_MAGIC)
+    return;
+
+  _mock_entries_free (ctx);
+  ctx->magic = ~IPMI_MOCK_CTX_MAGIC;
+  ctx->errnum = IPMI_MOCK_ERR_SUCCESS;
+  free (ctx->driver_device);
+  free (ctx->service_times);
+  /* ignore potential error, destroy path */
+  if (ctx->device_fd >= 0)
+    close (ctx->device_fd);
+  free (ctx);
+}
+
+int
+ipmi_mock_ctx_errnum (ipmi_mock_ctx_t ctx)
+{
+  if (!ctx)
+    return (IPMI_MOCK_ERR_NULL);
+  else if (ctx->magic != IPMI_MOCK_CTX_MAGIC)
+    return (IPMI_MOCK_ERR_INVALID);
+  else
+    return (ctx->errnum);
+}
+
+char *
+ipmi_mock_ctx_strerror (int errnum)
+{
+  if (errnum >= IPMI_MOCK_ERR_SUCCESS && errnum <= IPMI_MOCK_ERR_ERRNUMRANGE)
+    return (ipmi_mock_ctx_errmsg[errnum]);
+  else
+    return (ipmi_mock_ctx_errmsg[IPMI_MOCK_ERR_ERRNUMRANGE]);
+}
+
+char *
+ipmi_mock_ctx_errormsg (ipmi_mock_ctx_t ctx)
+{
+  return (ipmi_mock_ctx_strerror (ipmi_mock_ctx_errnum (ctx)));
+}
+
+int
+ipmi_mock_ctx_get_driver_device (ipmi_mock_ctx_t ctx, char **driver_device)
+{
+  if (!ctx || ctx->magic != IPMI_MOCK_CTX_MAGIC)
+    {
+      ERR_TRACE (ipmi_mock_ctx_errormsg (ctx), ipmi_mock_ctx_errnum (ctx));
+      return (-1);
+    }
+
+  if (!driver_device)
+    {
+      MOCK_SET_ERRNUM (ctx, IPMI_MOCK_ERR_PARAMETERS);
+      return (-1);
+    }
+
+  *driver_device = ctx->driver_device;
+  ctx->errnum = IPMI_MOCK_ERR_SUCCESS;
+  return (0);
+}
+
+int
+ipmi_mock_ctx_get_flags (ipmi_mock_ctx_t ctx, unsigned int *flags)
+{
+  if (!ctx || ctx->magic != IPMI_MOCK_CTX_MAGIC)
+    {
+      ERR_TRACE (ipmi_mock_ctx_errormsg (ctx), ipmi_mock_ctx_errnum (ctx));
+      return (-1);
+    }
+
+  if (!flags)
+    {
+      MOCK_SET_ERRNUM (ctx, IPMI_MOCK_ERR_PARAMETERS);
+      return (-1);
+    }
+
+  *flags = ctx->flags;
+  ctx->errnum = IPMI_MOCK_ERR_SUCCESS;
+  return (0);
+}
+
+int
+ipmi_mock_ctx_get_default_service_time (ipmi_mock_ctx_t ctx, unsigned int *usec)
+{
+  if (!ctx || ctx->magic != IPMI_MOCK_CTX_MAGIC)
+    {
+      ERR_TRACE (ipmi_mock_ctx_errormsg (ctx), ipmi_mock_ctx_errnum (ctx));
+      return (-1);
+    }
+
+  if (!usec)
+    {
+      MOCK_SET_ERRNUM (ctx, IPMI_MOCK_ERR_PARAMETERS);
+      return (-1);
+    }
+
+  *usec = ctx->default_service_time;
+  ctx->errnum = IPMI_MOCK_ERR_SUCCESS;
+  return (0);
+}
+
+int
+ipmi_mock_ctx_set_driver_device (ipmi_mock_ctx_t ctx, const char *driver_device)
+{
+  if (!ctx || ctx->magic != IPMI_MOCK_CTX_MAGIC)
+    {
+      ERR_TRACE (ipmi_mock_ctx_errormsg (ctx), ipmi_mock_ctx_errnum (ctx));
+      return (-1);
+    }
+
+  if (!driver_device)
+    {
+      MOCK_SET_ERRNUM (ctx, IPMI_MOCK_ERR_PARAMETERS);
+      return (-1);
+    }
+
+  free (ctx->driver_device);
+  ctx->driver_device = NULL;
+
+  if (!(ctx->driver_device = strdup (driver_device)))
+    {
+      MOCK_SET_ERRNUM (ctx, IPMI_MOCK_ERR_OUT_OF_MEMORY);
+      return (-1);
+    }
+
+  ctx->errnum = IPMI_MOCK_ERR_SUCCESS;
+  return (0);
+}
+
+int
+ipmi_mock_ctx_set_flags (ipmi_mock_ctx_t ctx, unsigned int flags)
+{
+  if (!ctx || ctx->magic != IPMI_MOCK_CTX_MAGIC)
+    {
+      ERR_TRACE (ipmi_mock_ctx_errormsg (ctx), ipmi_mock_ctx_errnum (ctx));
+      return (-1);
+    }
+
+  if (flags & ~IPMI_MOCK_FLAGS_MASK)
+    {
+      MOCK_SET_ERRNUM (ctx, IPMI_MOCK_ERR_PARAMETERS);
+      return (-1);
+    }
+
+  ctx->flags = flags;
+  ctx->errnum = IPMI_MOCK_ERR_SUCCESS;
+  return (0);
+}
+
+int
+ipmi_mock_ctx_set_default_service_time (ipmi_mock_ctx_t ctx, unsigned int usec)
+{
+  if (!ctx || ctx->magic != IPMI_MOCK_CTX_MAGIC)
+    {
+      ERR_TRACE (ipmi_mock_ctx_errormsg (ctx), ipmi_mock_ctx_errnum (ctx));
+      return (-1);
+    }
+
+  ctx->default_service_time = usec;
+  ctx->errnum = IPMI_MOCK_ERR_SUCCESS;
+  return (0);
+}
+
+static int
+_mock_service_time_add (ipmi_mock_ctx_t ctx,
+                        uint8_t net_fn,
+                        uint8_t cmd,
+                        unsigned int usec)
+{
+  unsigned int i;
+
+  assert (ctx);
+  assert (ctx->magic == IPMI_MOCK_CTX_MAGIC);
+
+  for (i = 0; i < ctx->service_times_count; i++)
+    {
+      if (ctx->service_times[i].net_fn == net_fn
+          && ctx->service_times[i].cmd == cmd)
+        {
+          ctx->service_times[i].usec = usec;
+          return (0);
+        }
+    }
+
+  if (ctx->service_times_count == ctx->service_times_len)
+    {
+      struct ipmi_mock_service_time *tmp;
+      unsigned int len;
+
+      len = ctx->service_times_len ? ctx->service_times_len * 2 : IPMI_MOCK_SERVICE_TIMES_LEN_INIT;
+
+      if (!(tmp = (struct ipmi_mock_service_time *)realloc (ctx->service_times,
+                                                            len * sizeof (struct ipmi_mock_service_time))))
+        {
+          MOCK_SET_ERRNUM (ctx, IPMI_MOCK_ERR_OUT_OF_MEMORY);
+          return (-1);
+        }
+
+      ctx->service_times = tmp;
+      ctx->service_times_len = len;
+    }
+
+  ctx->service_times[ctx->service_times_count].net_fn = net_fn;
+  ctx->service_times[ctx->service_times_count].cmd = cmd;
+  ctx->service_times[ctx->service_times_count].usec = usec;
+  ctx->service_times_count++;
+  return (0);
+}
+
+int
+ipmi_mock_ctx_set_service_time (ipmi_mock_ctx_t ctx,
+                                uint8_t net_fn,
+                                uint8_t cmd,
+                                unsigned int usec)
+{
+  if (!ctx || ctx->magic != IPMI_MOCK_CTX_MAGIC)
+    {
+      ERR_TRACE (ipmi_mock_ctx_errormsg (ctx), ipmi_mock_ctx_errnum (ctx));
+      return (-1);
+    }
+
+  if (!IPMI_NET_FN_RQ_VALID (net_fn))
+    {
+      MOCK_SET_ERRNUM (ctx, IPMI_MOCK_ERR_PARAMETERS);
+      return (-1);
+    }
+
+  if (_mock_service_time_add (ctx, net_fn, cmd, usec) < 0)
+    return (-1);
+
+  ctx->errnum = IPMI_MOCK_ERR_SUCCESS;
+  return (0);
+}
+
+static int
+_mock_entry_add (ipmi_mock_ctx_t ctx,
+                 uint8_t net_fn,
+                 const uint8_t *rq,
+                 unsigned int rq_len,
+                 const uint8_t *rs,
+                 unsigned int rs_len,
+                 int service_time)
+{
+  struct ipmi_mock_entry *e;
+
+  assert (ctx);
+  assert (ctx->magic == IPMI_MOCK_CTX_MAGIC);
+  assert (rq);
+  assert (rq_len);
+  assert (rs);
+  assert (rs_len >= 2);
+
+  if (rq_len > IPMI_MOCK_BUFLEN
+      || rs_len > IPMI_MOCK_BUFLEN)
+    {
+      MOCK_SET_ERRNUM (ctx, IPMI_MOCK_ERR_RECORDING_INVALID);
+      return (-1);
+    }
+
+  if (ctx->entries_count == ctx->entries_len)
+    {
+      struct ipmi_mock_entry *tmp;
+      unsigned int len;
+
+      len = ctx->entries_len ? ctx->entries_len * 2 : IPMI_MOCK_ENTRIES_LEN_INIT;
+
+      if (!(tmp = (struct ipmi_mock_entry *)realloc (ctx->entries,
+                                                     len * sizeof (struct ipmi_mock_entry))))
+        {
+          MOCK_SET_ERRNUM (ctx, IPMI_MOCK_ERR_OUT_OF_MEMORY);
+          return (-1);
+        }
+
+      ctx->entries = tmp;
+      ctx->entries_len = len;
+    }
+
+  e = &ctx->entries[ctx->entries_count];
+
+  /* request and response share one allocation */
+  if (!(e->rq = (uint8_t *)malloc (rq_len + rs_len)))
+    {
+      MOCK_SET_ERRNUM (ctx, IPMI_MOCK_ERR_OUT_OF_MEMORY);
+      return (-1);
+    }
+  e->rs = e->rq + rq_len;
+
+  e->net_fn = net_fn;
+  memcpy (e->rq, rq, rq_len);
+  e->rq_len = rq_len;
+  memcpy (e->rs, rs, rs_len);
+  e->rs_len = rs_len;
+  e->service_time = service_time;
+  e->order = ctx->entries_count;
+  e->next = 0;
+  e->cmd_next = 0;
+
+  ctx->entries_count++;
+  return (0);
+}
+
+static uint32_t
+_mock_pcap_u32 (const uint8_t *p, int swapped)
+{
+  uint32_t val;
+
+  assert (p);
+
+  memcpy (&val, p, sizeof (uint32_t));
+  if (swapped)
+    val = ((val & 0x000000FF) << 24)
+      | ((val & 0x0000FF00) << 8)
+      | ((val & 0x00FF0000) >> 8)
+      | ((val & 0xFF000000) >> 24);
+  return (val);
+}
+
+/* requests are paired with the response following them, requests
+ * never answered are skipped
+ */
+static int
+_mock_load_pcap (ipmi_mock_ctx_t ctx, const uint8_t *buf, unsigned int buf_len)
+{
+  const uint8_t *rq = NULL;
+  unsigned int rq_len = 0;
+  uint8_t rq_net_fn = 0;
+  uint32_t rq_sec = 0, rq_usec = 0;
+  unsigned int offset;
+  uint32_t magic;
+  int swapped;
+
+  assert (ctx);
+  assert (ctx->magic == IPMI_MOCK_CTX_MAGIC);
+  assert (buf);
+  assert (buf_len >= IPMI_MOCK_PCAP_HDR_LEN);
+
+  memcpy (&magic, buf, sizeof (uint32_t));
+  swapped = (magic == IPMI_MOCK_PCAP_MAGIC_SWAPPED) ? 1 : 0;
+
+  /* an out-of-band trace cannot be replayed in-band */
+  if (_mock_pcap_u32 (buf + IPMI_MOCK_PCAP_NETWORK_OFFSET, swapped) != IPMI_MOCK_PCAP_LINKTYPE_USER0)
+    {
+      MOCK_SET_ERRNUM (ctx, IPMI_MOCK_ERR_RECORDING_INVALID);
+      return (-1);
+    }
+
+  offset = IPMI_MOCK_PCAP_HDR_LEN;
+  while (offset < buf_len)
+    {
+      const uint8_t *pkt;
+      uint32_t sec, usec, len;
+
+      if (buf_len - offset < IPMI_MOCK_PCAP_RECORD_HDR_LEN)
+        {
+          MOCK_SET_ERRNUM (ctx, IPMI_MOCK_ERR_RECORDING_INVALID);
+          return (-1);
+        }
+
+      sec = _mock_pcap_u32 (buf + offset, swapped);
+      usec = _mock_pcap_u32 (buf + offset + 4, swapped);
+      len = _mock_pcap_u32 (buf + offset + 8, swapped);
+      offset += IPMI_MOCK_PCAP_RECORD_HDR_LEN;
+
+      if (len > buf_len - offset)
+        {
+          MOCK_SET_ERRNUM (ctx, IPMI_MOCK_ERR_RECORDING_INVALID);
+          return (-1);
+        }
+
+      pkt = buf + offset;
+      offset += len;
+
+      /* direction, net_fn/lun, command, completion code of responses */
+      if (pkt[0] == IPMI_MOCK_PCAP_REQUEST && len >= 3)
+        {
+          rq_net_fn = pkt[1] >> IPMI_MOCK_NET_FN_SHIFT;
+          rq = pkt + 2;
+          rq_len = len - 2;
+          rq_sec = sec;
+          rq_usec = usec;
+        }
+      else if (pkt[0] == IPMI_MOCK_PCAP_RESPONSE && len >= 4 && rq)
+        {
+          long service_time;
+
+          if ((pkt[1] >> IPMI_MOCK_NET_FN_SHIFT) == rq_net_fn + 1
+              && pkt[2] == rq[0])
+            {
+              service_time = ((long)sec - (long)rq_sec) * 1000000 + ((long)usec - (long)rq_usec);
+              if (service_time < 0)
+                service_time = 0;
+
+              if (_mock_entry_add (ctx,
+                                   rq_net_fn,
+                                   rq,
+                                   rq_len,
+                                   pkt + 2,
+                                   len - 2,
+                                   service_time) < 0)
+                return (-1);
+            }
+
+          rq = NULL;
+        }
+    }
+
+  return (0);
+}
+
+static int
+_mock_parse_bytes (char *str, uint8_t *buf, unsigned int *len)
+{
+  char *tok, *ptr;
+
+  assert (str);
+  assert (buf);
+  assert (len);
+
+  *len = 0;
+  for (tok = strtok_r (str, " \t\r", &ptr); tok; tok = strtok_r (NULL, " \t\r", &ptr))
+    {
+      unsigned long val;
+      char *endptr;
+
+      errno = 0;
+      val = strtoul (tok, &endptr, 16);
+      if (errno
+          || endptr[0] != '\0'
+          || val > 0xFF
+          || *len == IPMI_MOCK_BUFLEN)
+        return (-1);
+
+      buf[(*len)++] = val;
+    }
+
+  return (0);
+}
+
+/* "USECONDS" or "NETFN CMD USECONDS" */
+static int
+_mock_parse_service_time (ipmi_mock_ctx_t ctx, char *str)
+{
+  char *tok, *ptr;
+  char *args[3];
+  unsigned long net_fn, cmd, usec;
+  unsigned int count = 0;
+  char *endptr;
+
+  assert (ctx);
+  assert (ctx->magic == IPMI_MOCK_CTX_MAGIC);
+  assert (str);
+
+  for (tok = strtok_r (str, " \t\r", &ptr); tok; tok = strtok_r (NULL, " \t\r", &ptr))
+    {
+      if (count == 3)
+        return (-1);
+      args[count++] = tok;
+    }
+
+  if (count != 1 && count != 3)
+    return (-1);
+
+  errno = 0;
+  usec = strtoul (args[count - 1], &endptr, 10);
+  if (errno
+      || endptr[0] != '\0'
+      || usec > UINT_MAX)
+    return (-1);
+
+  if (count == 1)
+    {
+      ctx->default_service_time = usec;
+      return (0);
+    }
+
+  errno = 0;
+  net_fn = strtoul (args[0], &endptr, 16);
+  if (errno
+      || endptr[0] != '\0'
+      || !IPMI_NET_FN_RQ_VALID (net_fn))
+    return (-1);
+
+  errno = 0;
+  cmd = strtoul (args[1], &endptr, 16);
+  if (errno
+      || endptr[0] != '\0'
+      || cmd > 0xFF)
+    return (-1);
+
+  return (_mock_service_time_add (ctx, net_fn, cmd, usec));
+}
+
+static int
+_mock_load_text (ipmi_mock_ctx_t ctx, char *buf)
+{
+  char *line, *next;
+
+  assert (ctx);
+  assert (ctx->magic == IPMI_MOCK_CTX_MAGIC);
+  assert (buf);
+
+  for (line = buf; line; line = next)
+    {
+      uint8_t rq[IPMI_MOCK_BUFLEN];
+      uint8_t rs[IPMI_MOCK_BUFLEN + 1];
+      unsigned int rq_len, rs_len;
+      char *p;
+
+      if ((next = strchr (line, '\n')))
+        *next++ = '\0';
+
+      if ((p = strchr (line, '#')))
+        *p = '\0';
+
+      line += strspn (line, " \t\r");
+      if (!line[0])
+        continue;
+
+      if (!strncmp (line, IPMI_MOCK_SERVICE_TIME_STR, strlen (IPMI_MOCK_SERVICE_TIME_STR))
+          && strchr (" \t\r", line[strlen (IPMI_MOCK_SERVICE_TIME_STR)]))
+        {
+          if (_mock_parse_service_time (ctx, line + strlen (IPMI_MOCK_SERVICE_TIME_STR)) < 0)
+            goto invalid;
+          continue;
+        }
+
+      if (!(p = strchr (line, ':')))
+        goto invalid;
+      *p++ = '\0';
+
+      /* net_fn, command, data : completion code, data */
+      if (_mock_parse_bytes (line, rq, &rq_len) < 0
+          || rq_len < 2
+          || !IPMI_NET_FN_RQ_VALID (rq[0])
+          || _mock_parse_bytes (p, rs + 1, &rs_len) < 0
+          || rs_len < 1)
+        goto invalid;
+
+      rs[0] = rq[1];
+      rs_len++;
+
+      if (_mock_entry_add (ctx, rq[0], rq + 1, rq_len - 1, rs, rs_len, -1) < 0)
+        return (-1);
+    }
+
+  return (0);
+
+ invalid:
+  MOCK_SET_ERRNUM (ctx, IPMI_MOCK_ERR_RECORDING_INVALID);
+  return (-1);
+}
+
+static int
+_mock_entry_key_cmp (const struct ipmi_mock_entry *e,
+                     uint8_t net_fn,
+                     const uint8_t *rq,
+                     unsigned int rq_len,
+                     int cmd_only)
+{
+  unsigned int len;
+  int rv;
+
+  assert (e);
+  assert (rq);
+  assert (rq_len);
+
+  if (e->net_fn != net_fn)
+    return (e->net_fn < net_fn ? -1 : 1);
+
+  if (cmd_only)
+    return (e->rq[0] == rq[0] ? 0 : (e->rq[0] < rq[0] ? -1 : 1));
+
+  len = e->rq_len < rq_len ? e->rq_len : rq_len;
+  if ((rv = memcmp (e->rq, rq, len)))
+    return (rv);
+
+  if (e->rq_len != rq_len)
+    return (e->rq_len < rq_len ? -1 : 1);
+
+  return (0);
+}
+
+static int
+_mock_entry_cmp (const void *a, const void *b)
+{
+  const struct ipmi_mock_entry *ea = a;
+  const struct ipmi_mock_entry *eb = b;
+  int rv;
+
+  if ((rv = _mock_entry_key_cmp (ea, eb->net_fn, eb->rq, eb->rq_len, 0)))
+    return (rv);
+
+  return (ea->order < eb->order ? -1 : (ea->order > eb->order));
+}
+
+/* index of the first entry not less than, or with upper set greater
+ * than, the request
+ */
+static unsigned int
+_mock_entry_bound (ipmi_mock_ctx_t ctx,
+                   uint8_t net_fn,
+                   const uint8_t *rq,
+                   unsigned int rq_len,
+                   int cmd_only,
+                   int upper)
+{
+  unsigned int lo = 0, hi;
+
+  assert (ctx);
+  assert (ctx->magic == IPMI_MOCK_CTX_MAGIC);
+
+  hi = ctx->entries_count;
+  while (lo < hi)
+    {
+      unsigned int mid = lo + (hi - lo) / 2;
+      int rv;
+
+      rv = _mock_entry_key_cmp (&ctx->entries[mid], net_fn, rq, rq_len, cmd_only);
+      if (rv < 0 || (upper && !rv))
+        lo = mid + 1;
+      else
+        hi = mid;
+    }
+
+  return (lo);
+}
+
+static int
+_mock_load (ipmi_mock_ctx_t ctx)
+{
+  uint8_t *buf = NULL;
+  struct stat st;
+  size_t len = 0;
+  uint32_t magic;
+  int fd = -1;
+  int rv = -1;
+
+  assert (ctx);
+  assert (ctx->magic == IPMI_MOCK_CTX_MAGIC);
+  assert (ctx->driver_device);
+
+  if ((fd = open (ctx->driver_device, O_RDONLY)) < 0)
+    {
+      MOCK_ERRNO_TO_MOCK_ERRNUM (ctx, errno);
+      goto cleanup;
+    }
+
+  if (fstat (fd, &st) < 0)
+    {
+      MOCK_ERRNO_TO_MOCK_ERRNUM (ctx, errno);
+      goto cleanup;
+    }
+
+  /* nul terminated for parsing text */
+  if (!(buf = (uint8_t *)malloc (st.st_size + 1)))
+    {
+      MOCK_SET_ERRNUM (ctx, IPMI_MOCK_ERR_OUT_OF_MEMORY);
+      goto cleanup;
+    }
+
+  while (len < (size_t)st.st_size)
+    {
+      ssize_t n;
+
+      if ((n = read (fd, buf + len, st.st_size - len)) < 0)
+        {
+          if (errno == EINTR)
+            continue;
+          MOCK_ERRNO_TO_MOCK_ERRNUM (ctx, errno);
+          goto cleanup;
+        }
+      if (!n)
+        break;
+      len += n;
+    }
+  buf[len] = '\0';
+
+  if (len >= IPMI_MOCK_PCAP_HDR_LEN)
+    memcpy (&magic, buf, sizeof (uint32_t));
+  else
+    magic = 0;
+
+  if (magic == IPMI_MOCK_PCAP_MAGIC
+      || magic == IPMI_MOCK_PCAP_MAGIC_SWAPPED)
+    {
+      if (_mock_load_pcap (ctx, buf, len) < 0)
+        goto cleanup;
+    }
+  else
+    {
+      if (_mock_load_text (ctx, (char *)buf) < 0)
+        goto cleanup;
+    }
+
+  if (ctx->entries_count)
+    qsort (ctx->entries,
+           ctx->entries_count,
+           sizeof (struct ipmi_mock_entry),
+           _mock_entry_cmp);
+
+  rv = 0;
+ cleanup:
+  if (rv < 0)
+    _mock_entries_free (ctx);
+  /* ignore potential error, cleanup path */
+  if (fd >= 0)
+    close (fd);
+  free (buf);
+  return (rv);
+}
+
+static int
+_mock_connect (ipmi_mock_ctx_t ctx)
+{
+  struct sockaddr_un addr;
+  int flags;
+
+  assert (ctx);
+  assert (ctx->magic == IPMI_MOCK_CTX_MAGIC);
+  assert (ctx->driver_device);
+
+  if (strlen (ctx->driver_device) >= sizeof (addr.sun_path))
+    {
+      MOCK_SET_ERRNUM (ctx, IPMI_MOCK_ERR_DEVICE_NOT_FOUND);
+      return (-1);
+    }
+
+  memset (&addr, '\0', sizeof (struct sockaddr_un));
+  addr.sun_family = AF_UNIX;
+  strcpy (addr.sun_path, ctx->driver_device);
+
+  if ((ctx->device_fd = socket (AF_UNIX, SOCK_SEQPACKET, 0)) < 0)
+    {
+      MOCK_ERRNO_TO_MOCK_ERRNUM (ctx, errno);
+      goto cleanup;
+    }
+
+  flags = fcntl (ctx->device_fd, F_GETFD);
+  if (flags < 0)
+    {
+      MOCK_ERRNO_TO_MOCK_ERRNUM (ctx, errno);
+      goto cleanup;
+    }
+  flags |= FD_CLOEXEC;
+  if (fcntl (ctx->device_fd, F_SETFD, flags) < 0)
+    {
+      MOCK_ERRNO_TO_MOCK_ERRNUM (ctx, errno);
+      goto cleanup;
+    }
+
+  if (connect (ctx->device_fd, (struct sockaddr *)&addr, sizeof (struct sockaddr_un)) < 0)
+    {
+      MOCK_ERRNO_TO_MOCK_ERRNUM (ctx, errno);
+      goto cleanup;
+    }
+
+  return (0);
+
+ cleanup:
+  /* ignore potential error, error path */
+  if (ctx->device_fd >= 0)
+    close (ctx->device_fd);
+  ctx->device_fd = -1;
+  return (-1);
+}
+
+int
+ipmi_mock_ctx_io_init (ipmi_mock_ctx_t ctx)
+{
+  struct stat st;
+
+  if (!ctx || ctx->magic != IPMI_MOCK_CTX_MAGIC)
+    {
+      ERR_TRACE (ipmi_mock_ctx_errormsg (ctx), ipmi_mock_ctx_errnum (ctx));
+      return (-1);
+    }
+
+  if (ctx->io_init)
+    goto out;
+
+  /* there is nothing to probe for */
+  if (!ctx->driver_device)
+    {
+      MOCK_SET_ERRNUM (ctx, IPMI_MOCK_ERR_DRIVER_PATH_REQUIRED);
+      return (-1);
+    }
+
+  if (stat (ctx->driver_device, &st) < 0)
+    {
+      MOCK_ERRNO_TO_MOCK_ERRNUM (ctx, errno);
+      return (-1);
+    }
+
+  if (S_ISSOCK (st.st_mode))
+    {
+      if (_mock_connect (ctx) < 0)
+        return (-1);
+    }
+  else
+    {
+      if (_mock_load (ctx) < 0)
+        return (-1);
+    }
+
+  ctx->io_init = 1;
+ out:
+  ctx->errnum = IPMI_MOCK_ERR_SUCCESS;
+  return (0);
+}
+
+static int
+_mock_socket_cmd (ipmi_mock_ctx_t ctx,
+                  uint8_t lun,
+                  uint8_t net_fn,
+                  const uint8_t *rq,
+                  unsigned int rq_len,
+                  uint8_t *rs,
+                  unsigned int *rs_len)
+{
+  uint8_t buf[IPMI_MOCK_BUFLEN + 1];
+  fd_set read_fds;
+  struct timeval tv, tv_orig, start, end, delta;
+  ssize_t len;
+  int n;
+
+  assert (ctx);
+  assert (ctx->magic == IPMI_MOCK_CTX_MAGIC);
+  assert (ctx->device_fd >= 0);
+  assert (rq);
+  assert (rq_len && rq_len <= IPMI_MOCK_BUFLEN);
+  assert (rs);
+  assert (rs_len);
+
+  buf[0] = (net_fn << IPMI_MOCK_NET_FN_SHIFT) | (lun & IPMI_MOCK_LUN_MASK);
+  memcpy (buf + 1, rq, rq_len);
+
+#ifdef MSG_NOSIGNAL
+  if (send (ctx->device_fd, buf, rq_len + 1, MSG_NOSIGNAL) < 0)
+#else /* !MSG_NOSIGNAL */
+  if (send (ctx->device_fd, buf, rq_len + 1, 0) < 0)
+#endif /* !MSG_NOSIGNAL */
+    {
+      MOCK_ERRNO_TO_MOCK_ERRNUM (ctx, errno);
+      return (-1);
+    }
+
+  tv.tv_sec = IPMI_MOCK_TIMEOUT;
+  tv.tv_usec = 0;
+
+  tv_orig.tv_sec = tv.tv_sec;
+  tv_orig.tv_usec = tv.tv_usec;
+
+  if (gettimeofday (&start, NULL) < 0)
+    {
+      MOCK_ERRNO_TO_MOCK_ERRNUM (ctx, errno);
+      return (-1);
+    }
+
+  do {
+    FD_ZERO (&read_fds);
+    FD_SET (ctx->device_fd, &read_fds);
+
+    if ((n = select (ctx->device_fd + 1,
+                     &read_fds,
+                     NULL,
+                     NULL,
+                     &tv)) < 0)
+      {
+        if (errno != EINTR)
+          {
+            MOCK_ERRNO_TO_MOCK_ERRNUM (ctx, errno);
+            return (-1);
+          }
+
+        if (gettimeofday (&end, NULL) < 0)
+          {
+            MOCK_ERRNO_TO_MOCK_ERRNUM (ctx, errno);
+            return (-1);
+          }
+
+        /* delta = end - start */
+        timersub (&end, &start, &delta);
+        /* tv = tv_orig - delta */
+        timersub (&tv_orig, &delta, &tv);
+      }
+  } while (n < 0);
+
+  if (!n)
+    {
+      MOCK_SET_ERRNUM (ctx, IPMI_MOCK_ERR_DRIVER_TIMEOUT);
+      return (-1);
+    }
+
+  if ((len = recv (ctx->device_fd, buf, IPMI_MOCK_BUFLEN + 1, 0)) < 0)
+    {
+      MOCK_ERRNO_TO_MOCK_ERRNUM (ctx, errno);
+      return (-1);
+    }
+
+  /* responder went away or answered another request */
+  if (len < 3
+      || (buf[0] >> IPMI_MOCK_NET_FN_SHIFT) != net_fn + 1
+      || buf[1] != rq[0])
+    {
+      MOCK_SET_ERRNUM (ctx, IPMI_MOCK_ERR_SYSTEM_ERROR);
+      return (-1);
+    }
+
+  memcpy (rs, buf + 1, len - 1);
+  *rs_len = len - 1;
+  return (0);
+}
+
+/* returns the service time in usecs */
+static unsigned int
+_mock_replay_cmd (ipmi_mock_ctx_t ctx,
+                  uint8_t net_fn,
+                  const uint8_t *rq,
+                  unsigned int rq_len,
+                  uint8_t *rs,
+                  unsigned int *rs_len)
+{
+  int cmd_only;
+
+  assert (ctx);
+  assert (ctx->magic == IPMI_MOCK_CTX_MAGIC);
+  assert (rq);
+  assert (rq_len);
+  assert (rs);
+  assert (rs_len);
+
+  for (cmd_only = 0; cmd_only <= 1; cmd_only++)
+    {
+      struct ipmi_mock_entry *e;
+      unsigned int lo, hi, *next;
+
+      lo = _mock_entry_bound (ctx, net_fn, rq, rq_len, cmd_only, 0);
+      hi = _mock_entry_bound (ctx, net_fn, rq, rq_len, cmd_only, 1);
+      if (lo == hi)
+        continue;
+
+      next = cmd_only ? &ctx->entries[lo].cmd_next : &ctx->entries[lo].next;
+      e = &ctx->entries[lo + *next];
+      *next = (*next + 1) % (hi - lo);
+
+      memcpy (rs, e->rs, e->rs_len);
+      *rs_len = e->rs_len;
+      return (e->service_time >= 0 ? e->service_time : ctx->default_service_time);
+    }
+
+  rs[0] = rq[0];
+  rs[1] = IPMI_COMP_CODE_INVALID_COMMAND;
+  *rs_len = 2;
+  return (ctx->default_service_time);
+}
+
+static void
+_mock_service_time_wait (const struct timeval *start, unsigned int usec)
+{
+  struct timeval now, elapsed;
+  struct timespec request, remain;
+  unsigned long long elapsed_usec;
+
+  assert (start);
+
+  if (!usec)
+    return;
+
+  if (gettimeofday (&now, NULL) < 0)
+    return;
+
+  timersub (&now, start, &elapsed);
+  elapsed_usec = (unsigned long long)elapsed.tv_sec * 1000000 + elapsed.tv_usec;
+  if (elapsed.tv_sec < 0 || elapsed_usec >= usec)
+    return;
+
+  request.tv_sec = (usec - elapsed_usec) / 1000000;
+  request.tv_nsec = ((usec - elapsed_usec) % 1000000) * 1000;
+
+  while (nanosleep (&request, &remain) < 0 && errno == EINTR)
+    request = remain;
+}
+
+int
+ipmi_mock_cmd (ipmi_mock_ctx_t ctx,
+               uint8_t lun,
+               uint8_t net_fn,
+               fiid_obj_t obj_cmd_rq,
+               fiid_obj_t obj_cmd_rs)
+{
+  uint8_t rq[IPMI_MOCK_BUFLEN];
+  uint8_t rs[IPMI_MOCK_BUFLEN];
+  unsigned int rs_len = 0;
+  unsigned int service_time = 0;
+  struct timeval start;
+  unsigned int i;
+  int len;
+
+  if (!ctx || ctx->magic != IPMI_MOCK_CTX_MAGIC)
+    {
+      ERR_TRACE (ipmi_mock_ctx_errormsg (ctx), ipmi_mock_ctx_errnum (ctx));
+      return (-1);
+    }
+
+  if (!IPMI_BMC_LUN_VALID (lun)
+      || !IPMI_NET_FN_RQ_VALID (net_fn)
+      || !fiid_obj_valid (obj_cmd_rq)
+      || !fiid_obj_valid (obj_cmd_rs)
+      || fiid_obj_packet_valid (obj_cmd_rq) <= 0)
+    {
+      MOCK_SET_ERRNUM (ctx, IPMI_MOCK_ERR_PARAMETERS);
+      return (-1);
+    }
+
+  if (!ctx->io_init)
+    {
+      MOCK_SET_ERRNUM (ctx, IPMI_MOCK_ERR_IO_NOT_INITIALIZED);
+      return (-1);
+    }
+
+  if (gettimeofday (&start, NULL) < 0)
+    {
+      MOCK_ERRNO_TO_MOCK_ERRNUM (ctx, errno);
+      return (-1);
+    }
+
+  if ((len = fiid_obj_get_all (obj_cmd_rq,
+                               rq,
+                               IPMI_MOCK_BUFLEN)) <= 0)
+    {
+      MOCK_SET_ERRNUM (ctx, IPMI_MOCK_ERR_INTERNAL_ERROR);
+      return (-1);
+    }
+
+  if (ctx->device_fd >= 0)
+    {
+      if (_mock_socket_cmd (ctx, lun, net_fn, rq, len, rs, &rs_len) < 0)
+        return (-1);
+      service_time = ctx->default_service_time;
+    }
+  else
+    service_time = _mock_replay_cmd (ctx, net_fn, rq, len, rs, &rs_len);
+
+  for (i = 0; i < ctx->service_times_count; i++)
+    {
+      if (ctx->service_times[i].net_fn == net_fn
+          && ctx->service_times[i].cmd == rq[0])
+        {
+          service_time = ctx->service_times[i].usec;
+          break;
+        }
+    }
+
+  if (fiid_obj_set_all (obj_cmd_rs,
+                        rs,
+                        rs_len) < 0)
+    {
+      MOCK_SET_ERRNUM (ctx, IPMI_MOCK_ERR_INTERNAL_ERROR);
+      return (-1);
+    }
+
+  if (!(ctx->flags & IPMI_MOCK_FLAGS_NO_SERVICE_TIME))
+    _mock_service_time_wait (&start, service_time);
+
+  ctx->errnum = IPMI_MOCK_ERR_SUCCESS;
+  return (0);
+}
@@ -46,11 +46,13 @@
 #if HAVE_SYS_IOCCOM_H
 #include <sys/ioccom.h>         /* solaris _IOR, etc. */
 #endif /* !HAVE_SYS_IOCCOM_H */
-#include <sys/select.h>
+#include <sys/poll.h>
 #ifdef __CYGWIN__
 #define __USE_LINUX_IOCTL_DEFS
 #endif /* !__CYGWIN__ */
 #include <sys/ioctl.h>
+#include <limits.h>
+#include <pthread.h>
 #include <assert.h>
 #include <errno.h>
 
@@ -160,6 +162,18 @@ static char * ipmi_openipmi_ctx_errmsg[] =
 
 #define IPMI_OPENIPMI_FLAGS_MASK IPMI_OPENIPMI_FLAGS_DEFAULT
 
+/* A request waiting for its response.  Responses are handed to
+ * requests by msgid, whichever thread happens to receive them.
+ */
+struct ipmi_openipmi_rq
+{
+  struct ipmi_openipmi_rq *next;
+  long msgid;
+  uint8_t rs_buf[IPMI_OPENIPMI_BUFLEN];
+  unsigned int rs_buf_len;
+  int done;
+};
+
 struct ipmi_openipmi_ctx {
   uint32_t magic;
   int errnum;
@@ -167,40 +181,51 @@ struct ipmi_openipmi_ctx {
   char *driver_device;
   int device_fd;
   int io_init;
+  pthread_mutex_t mutex;
+  pthread_cond_t cond;
+  long msgid;
+  int reading;
+  struct ipmi_openipmi_rq *rqs;
 };
 
-static void
-_set_openipmi_ctx_errnum_by_errno (ipmi_openipmi_ctx_t ctx, int _errno)
+static int
+_openipmi_errnum_by_errno (int _errno)
 {
-  if (!ctx || ctx->magic != IPMI_OPENIPMI_CTX_MAGIC)
-    return;
-
   if (_errno == 0)
-    ctx->errnum = IPMI_OPENIPMI_ERR_SUCCESS;
+    return (IPMI_OPENIPMI_ERR_SUCCESS);
   else if (_errno == EPERM)
-    ctx->errnum = IPMI_OPENIPMI_ERR_PERMISSION;
+    return (IPMI_OPENIPMI_ERR_PERMISSION);
   else if (_errno == EACCES)
-    ctx->errnum = IPMI_OPENIPMI_ERR_PERMISSION;
+    return (IPMI_OPENIPMI_ERR_PERMISSION);
   else if (_errno == ENOENT)
-    ctx->errnum = IPMI_OPENIPMI_ERR_DEVICE_NOT_FOUND;
+    return (IPMI_OPENIPMI_ERR_DEVICE_NOT_FOUND);
   else if (_errno == ENOTDIR)
-    ctx->errnum = IPMI_OPENIPMI_ERR_DEVICE_NOT_FOUND;
+    return (IPMI_OPENIPMI_ERR_DEVICE_NOT_FOUND);
   else if (_errno == ENAMETOOLONG)
-    ctx->errnum = IPMI_OPENIPMI_ERR_DEVICE_NOT_FOUND;
+    return (IPMI_OPENIPMI_ERR_DEVICE_NOT_FOUND);
   else if (_errno == ENOMEM)
-    ctx->errnum = IPMI_OPENIPMI_ERR_OUT_OF_MEMORY;
+    return (IPMI_OPENIPMI_ERR_OUT_OF_MEMORY);
   else if (_errno == EINVAL)
-    ctx->errnum = IPMI_OPENIPMI_ERR_INTERNAL_ERROR;
+    return (IPMI_OPENIPMI_ERR_INTERNAL_ERROR);
   else if (_errno == ETIMEDOUT)
-    ctx->errnum = IPMI_OPENIPMI_ERR_DRIVER_TIMEOUT;
-  else
-    ctx->errnum = IPMI_OPENIPMI_ERR_SYSTEM_ERROR;
+    return (IPMI_OPENIPMI_ERR_DRIVER_TIMEOUT);
+  return (IPMI_OPENIPMI_ERR_SYSTEM_ERROR);
+}
+
+static void
+_set_openipmi_ctx_errnum_by_errno (ipmi_openipmi_ctx_t ctx, int _errno)
+{
+  if (!ctx || ctx->magic != IPMI_OPENIPMI_CTX_MAGIC)
+    return;
+
+  ctx->errnum = _openipmi_errnum_by_errno (_errno);
 }
 
 ipmi_openipmi_ctx_t
 ipmi_openipmi_ctx_create (void)
 {
   ipmi_openipmi_ctx_t ctx = NULL;
+  int perr;
 
   if (!(ctx = (ipmi_openipmi_ctx_t)malloc (sizeof (struct ipmi_openipmi_ctx))))
     {
@@ -208,11 +233,31 @@ ipmi_openipmi_ctx_create (void)
       return (NULL);
     }
 
+  if ((perr = pthread_mutex_init (&ctx->mutex, NULL)))
+    {
+      free (ctx);
+      errno = perr;
+      ERRNO_TRACE (errno);
+      return (NULL);
+    }
+
+  if ((perr = pthread_cond_init (&ctx->cond, NULL)))
+    {
+      pthread_mutex_destroy (&ctx->mutex);
+      free (ctx);
+      errno = perr;
+      ERRNO_TRACE (errno);
+      return (NULL);
+    }
+
   ctx->magic = IPMI_OPENIPMI_CTX_MAGIC;
   ctx->flags = IPMI_OPENIPMI_FLAGS_DEFAULT;
   ctx->driver_device = NULL;
   ctx->device_fd = -1;
   ctx->io_init = 0;
+  ctx->msgid = 0;
+  ctx->reading = 0;
+  ctx->rqs = NULL;
 
   ctx->errnum = IPMI_OPENIPMI_ERR_SUCCESS;
   return (ctx);
@@ -229,6 +274,8 @@ ipmi_openipmi_ctx_destroy (ipmi_openipmi_ctx_t ctx)
   free (ctx->driver_device);
   /* ignore potential error, destroy path */
   close (ctx->device_fd);
+  pthread_cond_destroy (&ctx->cond);
+  pthread_mutex_destroy (&ctx->mutex);
   free (ctx);
 }
 
@@ -240,7 +287,14 @@ ipmi_openipmi_ctx_errnum (ipmi_openipmi_ctx_t ctx)
   else if (ctx->magic != IPMI_OPENIPMI_CTX_MAGIC)
     return (IPMI_OPENIPMI_ERR_INVALID);
   else
-    return (ctx->errnum);
+    {
+      int errnum;
+
+      pthread_mutex_lock (&ctx->mutex);
+      errnum = ctx->errnum;
+      pthread_mutex_unlock (&ctx->mutex);
+      return (errnum);
+    }
 }
 
 char *
@@ -414,7 +468,8 @@ _openipmi_write (ipmi_openipmi_ctx_t ctx,
                  uint8_t lun,
                  uint8_t net_fn,
                  fiid_obj_t obj_cmd_rq,
-                 unsigned int is_ipmb)
+                 unsigned int is_ipmb,
+                 long msgid)
 {
   uint8_t rq_buf_temp[IPMI_OPENIPMI_BUFLEN];
   uint8_t rq_buf[IPMI_OPENIPMI_BUFLEN];
@@ -441,8 +496,8 @@ _openipmi_write (ipmi_openipmi_ctx_t ctx,
                                rq_buf_temp,
                                IPMI_OPENIPMI_BUFLEN)) <= 0)
     {
-      OPENIPMI_SET_ERRNUM (ctx, IPMI_OPENIPMI_ERR_INTERNAL_ERROR);
-      return (-1);
+      TRACE_MSG_OUT (fiid_obj_errormsg (obj_cmd_rq), fiid_obj_errnum (obj_cmd_rq));
+      return (IPMI_OPENIPMI_ERR_INTERNAL_ERROR);
     }
 
   rq_cmd = rq_buf_temp[0];
@@ -475,7 +530,7 @@ _openipmi_write (ipmi_openipmi_ctx_t ctx,
       rq_packet.addr_len = sizeof (struct ipmi_ipmb_addr);
     }
 
-  rq_packet.msgid = 0;
+  rq_packet.msgid = msgid;
   rq_packet.msg.netfn = net_fn;
   rq_packet.msg.cmd = rq_cmd;
   rq_packet.msg.data_len = rq_buf_len;
@@ -485,124 +540,318 @@ _openipmi_write (ipmi_openipmi_ctx_t ctx,
              IPMICTL_SEND_COMMAND,
              &rq_packet) < 0)
     {
-      OPENIPMI_ERRNO_TO_OPENIPMI_ERRNUM (ctx, errno);
-      return (-1);
+      TRACE_ERRNO_OUT (errno);
+      return (_openipmi_errnum_by_errno (errno));
     }
 
-  return (0);
+  return (IPMI_OPENIPMI_ERR_SUCCESS);
 }
 
+/* called with the mutex held */
+static void
+_openipmi_rq_unlink (ipmi_openipmi_ctx_t ctx,
+                     struct ipmi_openipmi_rq *rq)
+{
+  struct ipmi_openipmi_rq **rqp;
+
+  assert (ctx);
+  assert (ctx->magic == IPMI_OPENIPMI_CTX_MAGIC);
+  assert (rq);
+
+  for (rqp = &ctx->rqs; *rqp; rqp = &(*rqp)->next)
+    {
+      if (*rqp == rq)
+        {
+          *rqp = rq->next;
+          break;
+        }
+    }
+}
+
+/* Receive every message queued on the device and hand responses to
+ * the requests waiting for them, called with the mutex held.
+ * Messages no request waits for, such as late responses to requests
+ * that timed out, are dropped.  Returns an openipmi errnum.
+ */
 static int
-_openipmi_read (ipmi_openipmi_ctx_t ctx,
-                fiid_obj_t obj_cmd_rs)
+_openipmi_drain (ipmi_openipmi_ctx_t ctx)
 {
   uint8_t rs_buf_temp[IPMI_OPENIPMI_BUFLEN];
-  uint8_t rs_buf[IPMI_OPENIPMI_BUFLEN];
   struct ipmi_system_interface_addr rs_addr;
   struct ipmi_recv rs_packet;
-  fd_set read_fds;
-  struct timeval tv, tv_orig, start, end, delta;
-  int n;
+  struct ipmi_openipmi_rq *rq;
 
   assert (ctx);
   assert (ctx->magic == IPMI_OPENIPMI_CTX_MAGIC);
-  assert (fiid_obj_valid (obj_cmd_rs));
 
-  rs_packet.addr = (unsigned char *)&rs_addr;
-  rs_packet.addr_len = sizeof (struct ipmi_system_interface_addr);
-  rs_packet.msg.data = rs_buf_temp;
-  rs_packet.msg.data_len = IPMI_OPENIPMI_BUFLEN;
+  while (1)
+    {
+      rs_packet.addr = (unsigned char *)&rs_addr;
+      rs_packet.addr_len = sizeof (struct ipmi_system_interface_addr);
+      rs_packet.msg.data = rs_buf_temp;
+      rs_packet.msg.data_len = IPMI_OPENIPMI_BUFLEN;
+
+      if (ioctl (ctx->device_fd,
+                 IPMICTL_RECEIVE_MSG_TRUNC,
+                 &rs_packet) < 0)
+        {
+          if (errno == EAGAIN || errno == EWOULDBLOCK)
+            return (IPMI_OPENIPMI_ERR_SUCCESS);
+          if (errno == EINTR)
+            continue;
+          TRACE_ERRNO_OUT (errno);
+          return (_openipmi_errnum_by_errno (errno));
+        }
+
+      for (rq = ctx->rqs; rq; rq = rq->next)
+        {
+          if (!rq->done && rq->msgid == rs_packet.msgid)
+            break;
+        }
+
+      if (!rq)
+        continue;
+
+      /* achu: atleast the completion code should be returned,
+       * checked by the requester
+       */
+      if (rs_packet.msg.data_len)
+        {
+          rq->rs_buf[0] = rs_packet.msg.cmd;
+          /* -1 b/c of cmd */
+          if (rs_packet.msg.data_len >= (IPMI_OPENIPMI_BUFLEN - 1))
+            rs_packet.msg.data_len = IPMI_OPENIPMI_BUFLEN - 1;
+          memcpy (rq->rs_buf + 1, rs_buf_temp, rs_packet.msg.data_len);
+          rq->rs_buf_len = rs_packet.msg.data_len + 1;
+        }
+      else
+        rq->rs_buf_len = 0;
+
+      rq->done = 1;
+    }
+
+  /* NOT REACHED */
+  return (IPMI_OPENIPMI_ERR_SUCCESS);
+}
 
-  FD_ZERO (&read_fds);
-  FD_SET (ctx->device_fd, &read_fds);
+/* returns milliseconds left until deadline */
+static int
+_openipmi_remaining (struct timeval *deadline)
+{
+  struct timeval now, delta;
 
-  tv.tv_sec = IPMI_OPENIPMI_TIMEOUT;
-  tv.tv_usec = 0;
+  assert (deadline);
 
-  tv_orig.tv_sec = tv.tv_sec;
-  tv_orig.tv_usec = tv.tv_usec;
+  if (gettimeofday (&now, NULL) < 0)
+    return (0);
 
-  if (gettimeofday (&start, NULL) < 0)
-    {
-      OPENIPMI_ERRNO_TO_OPENIPMI_ERRNUM (ctx, errno);
-      return (-1);
-    }
+  if (timercmp (&now, deadline, >=))
+    return (0);
+
+  timersub (deadline, &now, &delta);
+  return (delta.tv_sec * 1000 + (delta.tv_usec + 999) / 1000);
+}
+
+/* Wait for the response to rq.  One thread at a time polls the
+ * device and receives all queued messages, the others wait on the
+ * condition variable until their response has been received or the
+ * reader role is free again.  rq is unlinked on return.  Returns an
+ * openipmi errnum, errors are kept per request so concurrent callers
+ * do not see each other's.
+ */
+static int
+_openipmi_read (ipmi_openipmi_ctx_t ctx,
+                struct ipmi_openipmi_rq *rq,
+                struct timeval *deadline,
+                fiid_obj_t obj_cmd_rs)
+{
+  int errnum = IPMI_OPENIPMI_ERR_SUCCESS;
+  int timeout;
+  int perr;
+
+  assert (ctx);
+  assert (ctx->magic == IPMI_OPENIPMI_CTX_MAGIC);
+  assert (rq);
+  assert (deadline);
+  assert (fiid_obj_valid (obj_cmd_rs));
 
-  do {
-    if ((n = select (ctx->device_fd + 1,
-                     &read_fds,
-                     NULL,
-                     NULL,
-                     &tv)) < 0)
+  pthread_mutex_lock (&ctx->mutex);
+
+  while (!rq->done)
+    {
+      if (!(timeout = _openipmi_remaining (deadline)))
+        {
+          /* Could be due to a different error, but we assume a timeout */
+          errnum = IPMI_OPENIPMI_ERR_DRIVER_TIMEOUT;
+          break;
+        }
+
+      if (!ctx->reading)
+        {
+          struct pollfd pfd;
+          int n;
+
+          ctx->reading = 1;
+          pthread_mutex_unlock (&ctx->mutex);
+
+          pfd.fd = ctx->device_fd;
+          pfd.events = POLLIN;
+          pfd.revents = 0;
+
+          n = poll (&pfd, 1, timeout);
+          perr = errno;
+
+          pthread_mutex_lock (&ctx->mutex);
+          ctx->reading = 0;
+
+          if (n < 0 && perr != EINTR)
+            {
+              TRACE_ERRNO_OUT (perr);
+              errnum = _openipmi_errnum_by_errno (perr);
+              pthread_cond_broadcast (&ctx->cond);
+              break;
+            }
+
+          if (n > 0
+              && (errnum = _openipmi_drain (ctx)) != IPMI_OPENIPMI_ERR_SUCCESS)
+            {
+              pthread_cond_broadcast (&ctx->cond);
+              break;
+            }
+
+          pthread_cond_broadcast (&ctx->cond);
+          continue;
+        }
+
+      /* another thread is reading the device */
       {
-        if (errno != EINTR)
-          {
-            OPENIPMI_ERRNO_TO_OPENIPMI_ERRNUM (ctx, errno);
-            return (-1);
-          }
+        struct timespec ts;
+
+        ts.tv_sec = deadline->tv_sec;
+        ts.tv_nsec = deadline->tv_usec * 1000;
 
-        if (gettimeofday (&end, NULL) < 0)
+        if ((perr = pthread_cond_timedwait (&ctx->cond, &ctx->mutex, &ts))
+            && perr != ETIMEDOUT)
           {
-            OPENIPMI_ERRNO_TO_OPENIPMI_ERRNUM (ctx, errno);
-            return (-1);
+            TRACE_ERRNO_OUT (perr);
+            errnum = _openipmi_errnum_by_errno (perr);
+            break;
           }
-
-        /* delta = end - start */
-        timersub (&end, &start, &delta);
-        /* tv = tv_orig - delta */
-        timersub (&tv_orig, &delta, &tv);
       }
-  } while (n < 0);
-
-  if (!n)
-    {
-      /* Could be due to a different error, but we assume a timeout */
-      OPENIPMI_SET_ERRNUM (ctx, IPMI_OPENIPMI_ERR_DRIVER_TIMEOUT);
-      return (-1);
     }
 
-  if (ioctl (ctx->device_fd,
-             IPMICTL_RECEIVE_MSG_TRUNC,
-             &rs_packet) < 0)
+  _openipmi_rq_unlink (ctx, rq);
+  pthread_mutex_unlock (&ctx->mutex);
+
+  if (!rq->done)
+    return (errnum);
+
+  if (!rq->rs_buf_len)
+    return (IPMI_OPENIPMI_ERR_SYSTEM_ERROR);
+
+  if (fiid_obj_set_all (obj_cmd_rs,
+                        rq->rs_buf,
+                        rq->rs_buf_len) < 0)
     {
-      OPENIPMI_ERRNO_TO_OPENIPMI_ERRNUM (ctx, errno);
-      return (-1);
+      TRACE_MSG_OUT (fiid_obj_errormsg (obj_cmd_rs), fiid_obj_errnum (obj_cmd_rs));
+      return (IPMI_OPENIPMI_ERR_INTERNAL_ERROR);
     }
 
-  /* achu: atleast the completion code should be returned */
-  if (!rs_packet.msg.data_len)
+  return (IPMI_OPENIPMI_ERR_SUCCESS);
+}
+
+/* Returns an openipmi errnum */
+static int
+_openipmi_cmd (ipmi_openipmi_ctx_t ctx,
+               uint8_t channel_number,
+               uint8_t rs_addr,
+               uint8_t lun,
+               uint8_t net_fn,
+               fiid_obj_t obj_cmd_rq,
+               fiid_obj_t obj_cmd_rs,
+               unsigned int is_ipmb)
+{
+  struct ipmi_openipmi_rq rq;
+  struct timeval deadline;
+  int errnum;
+
+  assert (ctx);
+  assert (ctx->magic == IPMI_OPENIPMI_CTX_MAGIC);
+
+  if (gettimeofday (&deadline, NULL) < 0)
     {
-      OPENIPMI_SET_ERRNUM (ctx, IPMI_OPENIPMI_ERR_SYSTEM_ERROR);
-      return (-1);
+      TRACE_ERRNO_OUT (errno);
+      return (_openipmi_errnum_by_errno (errno));
     }
+  deadline.tv_sec += IPMI_OPENIPMI_TIMEOUT;
 
-  rs_buf[0] = rs_packet.msg.cmd;
-  /* -1 b/c of cmd */
-  if (rs_packet.msg.data_len >= (IPMI_OPENIPMI_BUFLEN - 1))
-    rs_packet.msg.data_len = IPMI_OPENIPMI_BUFLEN - 1;
-  memcpy (rs_buf + 1, rs_buf_temp, rs_packet.msg.data_len);
+  rq.done = 0;
+  rq.rs_buf_len = 0;
 
-  if (fiid_obj_set_all (obj_cmd_rs,
-                        rs_buf,
-                        rs_packet.msg.data_len + 1) < 0)
+  /* register the request before it is sent, its response may be
+   * received by another thread
+   */
+  pthread_mutex_lock (&ctx->mutex);
+  if (ctx->msgid == LONG_MAX)
+    ctx->msgid = 0;
+  rq.msgid = ++ctx->msgid;
+  rq.next = ctx->rqs;
+  ctx->rqs = &rq;
+  pthread_mutex_unlock (&ctx->mutex);
+
+  if ((errnum = _openipmi_write (ctx,
+                                 channel_number,
+                                 rs_addr,
+                                 lun,
+                                 net_fn,
+                                 obj_cmd_rq,
+                                 is_ipmb,
+                                 rq.msgid)) != IPMI_OPENIPMI_ERR_SUCCESS)
     {
-      OPENIPMI_SET_ERRNUM (ctx, IPMI_OPENIPMI_ERR_INTERNAL_ERROR);
-      return (-1);
+      pthread_mutex_lock (&ctx->mutex);
+      _openipmi_rq_unlink (ctx, &rq);
+      pthread_mutex_unlock (&ctx->mutex);
+      return (errnum);
     }
 
-  return (0);
+  return (_openipmi_read (ctx, &rq, &deadline, obj_cmd_rs));
+}
+
+/* ctx->errnum is shared by all threads using the context, so it is
+ * only written under the mutex.
+ */
+static void
+_openipmi_cmd_set_errnum (ipmi_openipmi_ctx_t ctx, int errnum, int *errnum_r)
+{
+  assert (ctx);
+  assert (ctx->magic == IPMI_OPENIPMI_CTX_MAGIC);
+
+  if (errnum != IPMI_OPENIPMI_ERR_SUCCESS)
+    TRACE_MSG_OUT (ipmi_openipmi_ctx_strerror (errnum), errnum);
+
+  pthread_mutex_lock (&ctx->mutex);
+  ctx->errnum = errnum;
+  pthread_mutex_unlock (&ctx->mutex);
+
+  if (errnum_r)
+    *errnum_r = errnum;
 }
 
 int
-ipmi_openipmi_cmd (ipmi_openipmi_ctx_t ctx,
-                   uint8_t lun,
-                   uint8_t net_fn,
-                   fiid_obj_t obj_cmd_rq,
-                   fiid_obj_t obj_cmd_rs)
+ipmi_openipmi_cmd_r (ipmi_openipmi_ctx_t ctx,
+                     uint8_t lun,
+                     uint8_t net_fn,
+                     fiid_obj_t obj_cmd_rq,
+                     fiid_obj_t obj_cmd_rs,
+                     int *errnum)
 {
+  int ret;
+
   if (!ctx || ctx->magic != IPMI_OPENIPMI_CTX_MAGIC)
     {
       ERR_TRACE (ipmi_openipmi_ctx_errormsg (ctx), ipmi_openipmi_ctx_errnum (ctx));
+      if (errnum)
+        *errnum = ipmi_openipmi_ctx_errnum (ctx);
       return (-1);
     }
 
@@ -612,44 +861,61 @@ ipmi_openipmi_cmd (ipmi_openipmi_ctx_t ctx,
       || !fiid_obj_valid (obj_cmd_rs)
       || fiid_obj_packet_valid (obj_cmd_rq) <= 0)
     {
-      OPENIPMI_SET_ERRNUM (ctx, IPMI_OPENIPMI_ERR_PARAMETERS);
+      _openipmi_cmd_set_errnum (ctx, IPMI_OPENIPMI_ERR_PARAMETERS, errnum);
       return (-1);
     }
 
   if (!ctx->io_init)
     {
-      OPENIPMI_SET_ERRNUM (ctx, IPMI_OPENIPMI_ERR_IO_NOT_INITIALIZED);
+      _openipmi_cmd_set_errnum (ctx, IPMI_OPENIPMI_ERR_IO_NOT_INITIALIZED, errnum);
       return (-1);
     }
 
-  if (_openipmi_write (ctx,
+  ret = _openipmi_cmd (ctx,
                        0,
                        0,
                        lun,
                        net_fn,
                        obj_cmd_rq,
-                       0) < 0)
-    return (-1);
+                       obj_cmd_rs,
+                       0);
 
-  if (_openipmi_read (ctx,
-                      obj_cmd_rs) < 0)
-    return (-1);
+  _openipmi_cmd_set_errnum (ctx, ret, errnum);
+  return (ret == IPMI_OPENIPMI_ERR_SUCCESS ? 0 : -1);
+}
 
-  return (0);
+int
+ipmi_openipmi_cmd (ipmi_openipmi_ctx_t ctx,
+                   uint8_t lun,
+                   uint8_t net_fn,
+                   fiid_obj_t obj_cmd_rq,
+                   fiid_obj_t obj_cmd_rs)
+{
+  return (ipmi_openipmi_cmd_r (ctx,
+                               lun,
+                               net_fn,
+                               obj_cmd_rq,
+                               obj_cmd_rs,
+                               NULL));
 }
 
 int
-ipmi_openipmi_cmd_ipmb (ipmi_openipmi_ctx_t ctx,
-                        uint8_t channel_number,
-                        uint8_t rs_addr,
-                        uint8_t lun,
-                        uint8_t net_fn,
-                        fiid_obj_t obj_cmd_rq,
-                        fiid_obj_t obj_cmd_rs)
+ipmi_openipmi_cmd_ipmb_r (ipmi_openipmi_ctx_t ctx,
+                          uint8_t channel_number,
+                          uint8_t rs_addr,
+                          uint8_t lun,
+                          uint8_t net_fn,
+                          fiid_obj_t obj_cmd_rq,
+                          fiid_obj_t obj_cmd_rs,
+                          int *errnum)
 {
+  int ret;
+
   if (!ctx || ctx->magic != IPMI_OPENIPMI_CTX_MAGIC)
     {
       ERR_TRACE (ipmi_openipmi_ctx_errormsg (ctx), ipmi_openipmi_ctx_errnum (ctx));
+      if (errnum)
+        *errnum = ipmi_openipmi_ctx_errnum (ctx);
       return (-1);
     }
 
@@ -660,28 +926,44 @@ ipmi_openipmi_cmd_ipmb (ipmi_openipmi_ctx_t ctx,
       || !fiid_obj_valid (obj_cmd_rs)
       || fiid_obj_packet_valid (obj_cmd_rq) <= 0)
     {
-      OPENIPMI_SET_ERRNUM (ctx, IPMI_OPENIPMI_ERR_PARAMETERS);
+      _openipmi_cmd_set_errnum (ctx, IPMI_OPENIPMI_ERR_PARAMETERS, errnum);
       return (-1);
     }
 
   if (!ctx->io_init)
     {
-      OPENIPMI_SET_ERRNUM (ctx, IPMI_OPENIPMI_ERR_IO_NOT_INITIALIZED);
+      _openipmi_cmd_set_errnum (ctx, IPMI_OPENIPMI_ERR_IO_NOT_INITIALIZED, errnum);
       return (-1);
     }
 
-  if (_openipmi_write (ctx,
+  ret = _openipmi_cmd (ctx,
                        channel_number,
                        rs_addr,
                        lun,
                        net_fn,
                        obj_cmd_rq,
-                       1) < 0)
-    return (-1);
+                       obj_cmd_rs,
+                       1);
 
-  if (_openipmi_read (ctx,
-                      obj_cmd_rs) < 0)
-    return (-1);
+  _openipmi_cmd_set_errnum (ctx, ret, errnum);
+  return (ret == IPMI_OPENIPMI_ERR_SUCCESS ? 0 : -1);
+}
 
-  return (0);
+int
+ipmi_openipmi_cmd_ipmb (ipmi_openipmi_ctx_t ctx,
+                        uint8_t channel_number,
+                        uint8_t rs_addr,
+                        uint8_t lun,
+                        uint8_t net_fn,
+                        fiid_obj_t obj_cmd_rq,
+                        fiid_obj_t obj_cmd_rs)
+{
+  return (ipmi_openipmi_cmd_ipmb_r (ctx,
+                                    channel_number,
+                                    rs_addr,
+                                    lun,
+                                    net_fn,
+                                    obj_cmd_rq,
+                                    obj_cmd_rs,
+                                    NULL));
 }
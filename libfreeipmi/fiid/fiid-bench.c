@@ -0,0 +1,431 @@
+/*
+ * Copyright (C) 2003-2015 FreeIPMI Core Team
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/* fiid-bench - microbenchmark of the fiid layer
+ *
+ * Measures the common fiid object operations against templates
+ * every packet or record passes through and reports nanoseconds and
+ * heap allocations per operation.  It is not installed, build it
+ * w/ 'make check' and run it from the build tree:
+ *
+ * ./fiid/fiid-bench [-n iterations]
+ */
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif /* HAVE_CONFIG_H */
+
+#include <stdio.h>
+#include <stdlib.h>
+#ifdef STDC_HEADERS
+#include <string.h>
+#endif /* STDC_HEADERS */
+#include <stdint.h>
+#if HAVE_UNISTD_H
+#include <unistd.h>
+#endif /* HAVE_UNISTD_H */
+#if TIME_WITH_SYS_TIME
+#include <sys/time.h>
+#include <time.h>
+#else /* !TIME_WITH_SYS_TIME */
+#if HAVE_SYS_TIME_H
+#include <sys/time.h>
+#else /* !HAVE_SYS_TIME_H */
+#include <time.h>
+#endif /* !HAVE_SYS_TIME_H */
+#endif /* !TIME_WITH_SYS_TIME */
+
+#include "freeipmi/fiid/fiid.h"
+#include "freeipmi/fiid/fiid-field-index.h"
+#include "freeipmi/cmds/ipmi-sdr-repository-cmds.h"
+#include "freeipmi/cmds/ipmi-sensor-cmds.h"
+#include "freeipmi/interface/ipmi-rmcpplus-interface.h"
+#include "freeipmi/record-format/ipmi-sdr-record-format.h"
+#include "freeipmi/record-format/ipmi-sel-record-format.h"
+
+#define FIID_BENCH_ITERATIONS_DEFAULT 1000000
+
+#define FIID_BENCH_BUFLEN             1024
+
+/* Allocations are counted by interposing the allocator through the
+ * glibc private __libc_* entry points.  Other C libraries (including
+ * uClibc, which also defines __GLIBC__) do not provide them, so
+ * allocations are reported as unknown there.
+ */
+#if defined (__GLIBC__) && !defined (__UCLIBC__)
+#define FIID_BENCH_COUNT_ALLOCATIONS 1
+
+extern void *__libc_malloc (size_t size);
+extern void *__libc_calloc (size_t nmemb, size_t size);
+extern void *__libc_realloc (void *ptr, size_t size);
+extern void __libc_free (void *ptr);
+
+static unsigned long fiid_bench_allocations = 0;
+
+void *
+malloc (size_t size)
+{
+  fiid_bench_allocations++;
+  return (__libc_malloc (size));
+}
+
+void *
+calloc (size_t nmemb, size_t size)
+{
+  fiid_bench_allocations++;
+  return (__libc_calloc (nmemb, size));
+}
+
+void *
+realloc (void *ptr, size_t size)
+{
+  fiid_bench_allocations++;
+  return (__libc_realloc (ptr, size));
+}
+
+void
+free (void *ptr)
+{
+  __libc_free (ptr);
+}
+#endif /* defined (__GLIBC__) && !defined (__UCLIBC__) */
+
+struct fiid_bench_template
+{
+  const char *name;
+  fiid_field_t *tmpl;
+  /* field for set/get */
+  const char *field;
+  unsigned int field_index;
+  /* byte aligned block for set_block/get_block */
+  const char *block_start;
+  const char *block_end;
+  /* bytes passed to set_all, typical length of a received packet */
+  unsigned int data_len;
+};
+
+struct fiid_bench_state
+{
+  struct fiid_bench_template *t;
+  fiid_obj_t obj;
+  uint8_t data[FIID_BENCH_BUFLEN];
+  unsigned int block_len;
+};
+
+typedef int (*Fiid_bench_op) (struct fiid_bench_state *state, unsigned int i);
+
+static struct fiid_bench_template fiid_bench_templates[] =
+  {
+    {
+      "get_sensor_reading_rs",
+      tmpl_cmd_get_sensor_reading_rs,
+      "sensor_reading",
+      TMPL_CMD_GET_SENSOR_READING_RS_SENSOR_READING,
+      "sensor_reading",
+      "sensor_event_bitmask1",
+      6,
+    },
+    {
+      "get_sdr_rs",
+      tmpl_cmd_get_sdr_rs,
+      "next_record_id",
+      TMPL_CMD_GET_SDR_RS_NEXT_RECORD_ID,
+      "cmd",
+      "next_record_id",
+      /* header + 64 byte full sensor record */
+      4 + 64,
+    },
+    {
+      "rmcpplus_session_hdr",
+      tmpl_rmcpplus_session_hdr,
+      "session_sequence_number",
+      TMPL_RMCPPLUS_SESSION_HDR_SESSION_SEQUENCE_NUMBER,
+      "session_id",
+      "session_sequence_number",
+      0,
+    },
+    {
+      "sdr_full_sensor_record",
+      tmpl_sdr_full_sensor_record,
+      "sensor_number",
+      TMPL_SDR_FULL_SENSOR_RECORD_SENSOR_NUMBER,
+      "record_id",
+      "record_length",
+      0,
+    },
+    {
+      "sel_system_event_record",
+      tmpl_sel_system_event_record,
+      "timestamp",
+      TMPL_SEL_SYSTEM_EVENT_RECORD_TIMESTAMP,
+      "record_id",
+      "timestamp",
+      0,
+    },
+    { NULL, NULL, NULL, 0, NULL, NULL, 0 },
+  };
+
+static int
+_create_destroy (struct fiid_bench_state *state, unsigned int i)
+{
+  fiid_obj_t obj;
+
+  if (!(obj = fiid_obj_create (state->t->tmpl)))
+    return (-1);
+  fiid_obj_destroy (obj);
+  return (0);
+}
+
+static int
+_view_create_destroy (struct fiid_bench_state *state, unsigned int i)
+{
+  fiid_obj_t obj;
+
+  if (!(obj = fiid_obj_view_create (state->t->tmpl,
+                                    state->data,
+                                    state->t->data_len)))
+    return (-1);
+  fiid_obj_destroy (obj);
+  return (0);
+}
+
+static int
+_set (struct fiid_bench_state *state, unsigned int i)
+{
+  return (fiid_obj_set (state->obj, state->t->field, i & 0xFF));
+}
+
+static int
+_get (struct fiid_bench_state *state, unsigned int i)
+{
+  uint64_t val;
+
+  return (fiid_obj_get (state->obj, state->t->field, &val) < 0 ? -1 : 0);
+}
+
+static int
+_set_idx (struct fiid_bench_state *state, unsigned int i)
+{
+  return (fiid_obj_set_idx (state->obj, state->t->field_index, i & 0xFF));
+}
+
+static int
+_get_idx (struct fiid_bench_state *state, unsigned int i)
+{
+  uint64_t val;
+
+  return (fiid_obj_get_idx (state->obj, state->t->field_index, &val) < 0 ? -1 : 0);
+}
+
+static int
+_set_all (struct fiid_bench_state *state, unsigned int i)
+{
+  return (fiid_obj_set_all (state->obj,
+                            state->data,
+                            state->t->data_len) < 0 ? -1 : 0);
+}
+
+static int
+_get_all (struct fiid_bench_state *state, unsigned int i)
+{
+  uint8_t buf[FIID_BENCH_BUFLEN];
+
+  return (fiid_obj_get_all (state->obj, buf, FIID_BENCH_BUFLEN) < 0 ? -1 : 0);
+}
+
+static int
+_set_block (struct fiid_bench_state *state, unsigned int i)
+{
+  return (fiid_obj_set_block (state->obj,
+                              state->t->block_start,
+                              state->t->block_end,
+                              state->data,
+                              state->block_len) < 0 ? -1 : 0);
+}
+
+static int
+_get_block (struct fiid_bench_state *state, unsigned int i)
+{
+  uint8_t buf[FIID_BENCH_BUFLEN];
+
+  return (fiid_obj_get_block (state->obj,
+                              state->t->block_start,
+                              state->t->block_end,
+                              buf,
+                              FIID_BENCH_BUFLEN) < 0 ? -1 : 0);
+}
+
+static int
+_clear (struct fiid_bench_state *state, unsigned int i)
+{
+  return (fiid_obj_clear (state->obj));
+}
+
+struct fiid_bench_op
+{
+  const char *name;
+  Fiid_bench_op op;
+};
+
+static struct fiid_bench_op fiid_bench_ops[] =
+  {
+    { "create/destroy", _create_destroy },
+    { "view_create/destroy", _view_create_destroy },
+    { "set", _set },
+    { "get", _get },
+    { "set_idx", _set_idx },
+    { "get_idx", _get_idx },
+    { "set_all", _set_all },
+    { "get_all", _get_all },
+    { "set_block", _set_block },
+    { "get_block", _get_block },
+    { "clear", _clear },
+    { NULL, NULL },
+  };
+
+static double
+_now_ns (void)
+{
+  struct timeval tv;
+
+  gettimeofday (&tv, NULL);
+  return ((double)tv.tv_sec * 1000000000.0 + (double)tv.tv_usec * 1000.0);
+}
+
+static void
+_usage (const char *progname)
+{
+  fprintf (stderr, "Usage: %s [-n iterations]\n", progname);
+  exit (EXIT_FAILURE);
+}
+
+int
+main (int argc, char **argv)
+{
+  struct fiid_bench_template *t;
+  struct fiid_bench_op *o;
+  unsigned int iterations = FIID_BENCH_ITERATIONS_DEFAULT;
+  unsigned int i;
+  char *ptr;
+  int c;
+
+  while ((c = getopt (argc, argv, "n:")) != -1)
+    {
+      switch (c)
+        {
+        case 'n':
+          iterations = strtoul (optarg, &ptr, 10);
+          if (*ptr != '\0' || !iterations)
+            _usage (argv[0]);
+          break;
+        default:
+          _usage (argv[0]);
+        }
+    }
+
+  printf ("%-24s %-20s %12s %12s\n", "template", "operation", "ns/op", "allocs/op");
+
+  for (t = fiid_bench_templates; t->name; t++)
+    {
+      struct fiid_bench_state state;
+      int len;
+
+      memset (&state, '\0', sizeof (struct fiid_bench_state));
+      state.t = t;
+
+      if ((len = fiid_template_len_bytes (t->tmpl)) < 0)
+        {
+          perror ("fiid_template_len_bytes");
+          exit (EXIT_FAILURE);
+        }
+      if (!t->data_len || t->data_len > len)
+        t->data_len = len;
+
+      if ((len = fiid_template_block_len_bytes (t->tmpl,
+                                                t->block_start,
+                                                t->block_end)) < 0)
+        {
+          perror ("fiid_template_block_len_bytes");
+          exit (EXIT_FAILURE);
+        }
+      state.block_len = len;
+
+      for (i = 0; i < FIID_BENCH_BUFLEN; i++)
+        state.data[i] = i * 37 + 11;
+
+      for (o = fiid_bench_ops; o->name; o++)
+        {
+          unsigned long allocations_start = 0;
+          unsigned long allocations = 0;
+          double start, end;
+
+          if (!(state.obj = fiid_obj_create (t->tmpl)))
+            {
+              perror ("fiid_obj_create");
+              exit (EXIT_FAILURE);
+            }
+
+          /* all ops run against a fully set object */
+          if (fiid_obj_set_all (state.obj, state.data, t->data_len) < 0)
+            {
+              fprintf (stderr,
+                       "fiid_obj_set_all: %s\n",
+                       fiid_obj_errormsg (state.obj));
+              exit (EXIT_FAILURE);
+            }
+
+#ifdef FIID_BENCH_COUNT_ALLOCATIONS
+          allocations_start = fiid_bench_allocations;
+#endif /* FIID_BENCH_COUNT_ALLOCATIONS */
+          start = _now_ns ();
+
+          for (i = 0; i < iterations; i++)
+            {
+              if (o->op (&state, i) < 0)
+                {
+                  fprintf (stderr,
+                           "%s %s: %s\n",
+                           t->name,
+                           o->name,
+                           fiid_obj_errormsg (state.obj));
+                  exit (EXIT_FAILURE);
+                }
+            }
+
+          end = _now_ns ();
+#ifdef FIID_BENCH_COUNT_ALLOCATIONS
+          allocations = fiid_bench_allocations - allocations_start;
+          printf ("%-24s %-20s %12.1f %12.2f\n",
+                  t->name,
+                  o->name,
+                  (end - start) / iterations,
+                  (double)allocations / iterations);
+#else /* !FIID_BENCH_COUNT_ALLOCATIONS */
+          printf ("%-24s %-20s %12.1f %12s\n",
+                  t->name,
+                  o->name,
+                  (end - start) / iterations,
+                  "-");
+#endif /* !FIID_BENCH_COUNT_ALLOCATIONS */
+
+          fiid_obj_destroy (state.obj);
+        }
+    }
+
+  exit (EXIT_SUCCESS);
+}
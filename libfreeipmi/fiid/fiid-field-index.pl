@@ -0,0 +1,151 @@
+#!/usr/bin/perl
+
+# This script generates fiid-field-index.h, the integer field indexes
+# of the fiid templates, for use with fiid_obj_get_idx(),
+# fiid_obj_set_idx() and FIID_OBJ_GET_IDX().
+#
+# Usage from this directory:
+#
+# ./fiid-field-index.pl ../cmds/*.c ../interface/*.c ../record-format/*.c \
+#     > ../include/freeipmi/fiid/fiid-field-index.h
+#
+# Re-run it whenever a template in those files is added or changed.
+# The index of a field is its position within its template, so the
+# macro for field "field.name" of template tmpl_foo is
+# TMPL_FOO_FIELD_NAME.  It is *very* simple, it only understands
+# templates defined at file scope in the style used in FreeIPMI.
+
+use strict;
+
+use Getopt::Std;
+
+my %defines = ();
+my @output = ();
+my $file;
+
+sub usage
+{
+    my $prog = `basename $0`;
+
+    chomp($prog);
+    print "Usage: $prog <filename> ...\n";
+    exit 2;
+}
+
+if (!defined($ARGV[0]))
+{
+    usage();
+}
+
+foreach $file (@ARGV)
+{
+    my $line;
+    my $tmpl;
+    my $index;
+    my %fields;
+
+    if (!open(FH, "< $file")) {
+        print STDERR ("Couldn't open $file: $!\n");
+        exit 1;
+    }
+
+    while (($line = <FH>))
+    {
+        if ($line =~ /^fiid_template_t\s+([A-Za-z0-9_]+)\s*=/) {
+            $tmpl = $1;
+            $index = 0;
+            %fields = ();
+            push(@output, "\n/* $tmpl */\n");
+            next;
+        }
+
+        if (!defined($tmpl)) {
+            next;
+        }
+
+        if ($line =~ /^\s*\};/) {
+            undef($tmpl);
+            next;
+        }
+
+        if ($line =~ /^\s*\{\s*[^,]+,\s*"([A-Za-z0-9_.]*)"/) {
+            my $field = $1;
+            my $name;
+
+            # template terminator
+            if ($field eq "") {
+                next;
+            }
+
+            $name = uc("${tmpl}_${field}");
+            $name =~ s/\./_/g;
+
+            # a repeated field name is only reachable through its
+            # first occurrence
+            if (defined($fields{$field})) {
+                $index++;
+                next;
+            }
+            $fields{$field} = 1;
+
+            if (defined($defines{$name})) {
+                if ($defines{$name} != $index) {
+                    print STDERR ("$file: $name defined with index $defines{$name} and $index\n");
+                    exit 1;
+                }
+            }
+            else {
+                $defines{$name} = $index;
+                push(@output, "#define $name $index\n");
+            }
+            $index++;
+        }
+    }
+
+    close(FH);
+}
+
+print <<EOF;
+/*
+ * Copyright (C) 2003-2015 FreeIPMI Core Team
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/* Generated by libfreeipmi/fiid/fiid-field-index.pl, do not edit. */
+
+#ifndef FIID_FIELD_INDEX_H
+#define FIID_FIELD_INDEX_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Field indexes for fiid_obj_get_idx(), fiid_obj_set_idx() and
+ * FIID_OBJ_GET_IDX().  The index of a field is its position within
+ * its template.
+ */
+EOF
+
+print @output;
+
+print <<EOF;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* FIID_FIELD_INDEX_H */
+EOF
@@ -29,6 +29,9 @@
 #include <limits.h>
 #include <assert.h>
 #include <errno.h>
+#if HAVE_PTHREAD_H
+#include <pthread.h>
+#endif /* HAVE_PTHREAD_H */
 
 #include "freeipmi/fiid/fiid.h"
 
@@ -40,29 +43,101 @@
 
 #define FIID_OBJ_MAGIC 0xf00fd00d
 #define FIID_ITERATOR_MAGIC 0xd00df00f
+#define FIID_LAYOUT_MAGIC 0xfeedd00d
+#define FIID_ARENA_MAGIC 0xd00dfeed
+
+#define FIID_ARENA_BLOCK_LEN_DEFAULT 4096
+
+/* all objects are carved w/ this alignment */
+#define FIID_OBJ_ALIGN(__len) \
+  (((__len) + (2 * sizeof (void *)) - 1) & ~((2 * sizeof (void *)) - 1))
+
+/* mask of the low __len bits, __len may be 0 through 64 */
+#define FIID_BITS_MASK(__len) \
+  ((__len) >= 64 ? 0xFFFFFFFFFFFFFFFFULL : ((1ULL << (__len)) - 1))
+
+/* achu: Layouts are compiled once per template and cached.  The
+ * cache is keyed on template address.  Since templates may live on
+ * the stack or be dynamically allocated (see fiid_obj_template()), a
+ * hit is verified against a cheap marker, the first and last fields
+ * and the terminator of the template, not the full contents.  A
+ * cached layout whose marker no longer matches is stale and is
+ * dropped when its address is re-used.  fiid_template_free() drops
+ * the layout of a dynamic template right away.  Layouts are reference
+ * counted, the cache holding one reference, so that the cache may be
+ * bounded.  Once full, an older entry of the bucket (or a following
+ * bucket) is evicted to make room.
+ *
+ * Lookups take the cache lock shared, only inserts and evictions
+ * take it exclusive.  Reference counts are atomic where possible, so
+ * object destruction does not lock at all.
+ */
+#define FIID_LAYOUT_CACHE_BUCKETS 1021
+#define FIID_LAYOUT_CACHE_MAX     8192
 
 struct fiid_field_data
 {
   unsigned int max_field_len;
-  char key[FIID_FIELD_MAX_KEY_LEN + 1];
-  unsigned int set_field_len;
+  char *key;
   unsigned int flags;
   unsigned int index;           /* for lookup */
   unsigned int start;           /* for lookup */
   unsigned int end;             /* for lookup */
 };
 
+/* Immutable once compiled, shared by all objects of a template */
+struct fiid_layout
+{
+  uint32_t magic;
+  const fiid_field_t *tmpl;     /* cache key only, never dereferenced after compile */
+  unsigned int data_len;
+  struct fiid_field_data *field_data;
+  unsigned int field_data_len;
+  unsigned int *lookup;         /* open addressed, stores field index + 1 */
+  unsigned int lookup_mask;
+  int makes_packet_sufficient;
+  int secure_memset_on_clear;
+  unsigned int refcount;        /* atomic, see FIID_LAYOUT_REF_INC() */
+  struct fiid_layout *next;
+};
+
+/* Objects are allocated in a single block: the object struct,
+ * followed by the set field lengths, and finally the data buffer.
+ * Views have no data buffer of their own, data points to the
+ * caller's buffer of buf_len bytes.
+ */
 struct fiid_obj
 {
   uint32_t magic;
   fiid_err_t errnum;
+  struct fiid_layout *layout;
   uint8_t *data;
   unsigned int data_len;
-  struct fiid_field_data *field_data;
+  unsigned int buf_len;         /* bytes readable at data */
+  int view;                     /* read-only, data is not owned */
+  const struct fiid_field_data *field_data;
+  unsigned int *set_field_len;
   unsigned int field_data_len;
-  hash_t lookup;
   int makes_packet_sufficient;  /* flag for internal use */
   int secure_memset_on_clear;   /* flag for internal use */
+  struct fiid_arena *arena;     /* NULL if heap allocated */
+  struct fiid_obj *arena_next;
+};
+
+struct fiid_arena_block
+{
+  struct fiid_arena_block *next;
+  size_t len;
+  size_t used;
+};
+
+struct fiid_arena
+{
+  uint32_t magic;
+  struct fiid_arena_block *blocks;
+  size_t block_len;
+  struct fiid_obj *objs;
+  int secure_memset_on_reset;
 };
 
 struct fiid_iterator
@@ -101,9 +176,29 @@ static char * fiid_errmsg[] =
     "not identical",
     "out of memory",
     "internal error",
+    "fiid object read only",
     "errnum out of range",
   };
 
+static struct fiid_layout *fiid_layout_cache[FIID_LAYOUT_CACHE_BUCKETS];
+static unsigned int fiid_layout_cache_count = 0;
+#if HAVE_PTHREAD_H
+static pthread_rwlock_t fiid_layout_cache_lock = PTHREAD_RWLOCK_INITIALIZER;
+#endif /* HAVE_PTHREAD_H */
+
+#if HAVE_ATOMIC_BUILTINS
+#define FIID_LAYOUT_REF_INC(__layout) \
+  __atomic_add_fetch (&(__layout)->refcount, 1, __ATOMIC_RELAXED)
+#define FIID_LAYOUT_REF_DEC(__layout) \
+  __atomic_sub_fetch (&(__layout)->refcount, 1, __ATOMIC_ACQ_REL)
+#else /* !HAVE_ATOMIC_BUILTINS */
+#if HAVE_PTHREAD_H
+static pthread_mutex_t fiid_layout_ref_mutex = PTHREAD_MUTEX_INITIALIZER;
+#endif /* HAVE_PTHREAD_H */
+#define FIID_LAYOUT_REF_INC(__layout) _fiid_layout_ref_add ((__layout), 1)
+#define FIID_LAYOUT_REF_DEC(__layout) _fiid_layout_ref_add ((__layout), -1)
+#endif /* !HAVE_ATOMIC_BUILTINS */
+
 #ifndef NDEBUG
 static int
 _fiid_template_check_valid_keys (fiid_template_t tmpl)
@@ -773,146 +868,120 @@ FIID_TEMPLATE_COMPARE (fiid_template_t tmpl1,
   return (ret);
 }
 
+static void _fiid_layout_cache_forget (fiid_template_t tmpl);
+
 void
 fiid_template_free (fiid_field_t *tmpl_dynamic)
 {
+  /* the address may be re-used by another template */
+  if (tmpl_dynamic)
+    _fiid_layout_cache_forget (tmpl_dynamic);
   free (tmpl_dynamic);
 }
 
+static unsigned int
+_fiid_key_len (const char *key)
+{
+  const char *p;
+
+  assert (key);
+
+  if ((p = memchr (key, '\0', FIID_FIELD_MAX_KEY_LEN)))
+    return (p - key);
+  return (FIID_FIELD_MAX_KEY_LEN);
+}
+
 static int
-_fiid_obj_field_start_end (fiid_obj_t obj,
-                           const char *field,
-                           unsigned int *start,
-                           unsigned int *end)
+_fiid_layout_lookup (const struct fiid_layout *layout, const char *field)
 {
-  struct fiid_field_data *ffdptr;
-  unsigned int i;
+  unsigned int slot;
 
-  assert (obj);
-  assert (obj->magic == FIID_OBJ_MAGIC);
+  assert (layout);
+  assert (layout->magic == FIID_LAYOUT_MAGIC);
   assert (field);
-  assert (start);
-  assert (end);
 
-  if ((ffdptr = hash_find (obj->lookup, field)))
+  slot = hash_key_string (field) & layout->lookup_mask;
+  while (layout->lookup[slot])
     {
-      *start = ffdptr->start;
-      *end = ffdptr->end;
-      return (ffdptr->max_field_len);
-    }
+      unsigned int index = layout->lookup[slot] - 1;
 
-  /* integer overflow conditions checked during object creation */
-  for (i = 0; obj->field_data[i].max_field_len; i++)
-    {
-      if (!strcmp (obj->field_data[i].key, field))
-        {
-          if (!hash_insert (obj->lookup,
-                            obj->field_data[i].key,
-                            &(obj->field_data[i])))
-            {
-              obj->errnum = FIID_ERR_INTERNAL_ERROR;
-              return (-1);
-            }
+      if (!strcmp (layout->field_data[index].key, field))
+        return (index);
 
-          *start = obj->field_data[i].start;
-          *end = obj->field_data[i].end;
-          return (obj->field_data[i].max_field_len);
-        }
+      slot = (slot + 1) & layout->lookup_mask;
     }
 
-  obj->errnum = FIID_ERR_FIELD_NOT_FOUND;
   return (-1);
 }
 
+/* Returns 1 if layout was compiled from a template with identical
+ * contents, 0 if not.
+ */
+/* Cheap check that a cached layout is still the layout of the
+ * template at its address.  Only the first field, the last field and
+ * the terminator are compared, the fields are not walked.
+ */
 static int
-_fiid_obj_field_start (fiid_obj_t obj, const char *field)
+_fiid_layout_template_match (const struct fiid_layout *layout, fiid_template_t tmpl)
 {
-  unsigned int start = 0;
-  unsigned int end = 0; /* excluded always */
+  unsigned int last;
 
-  assert (obj);
-  assert (obj->magic == FIID_OBJ_MAGIC);
-  assert (field);
+  assert (layout);
+  assert (layout->magic == FIID_LAYOUT_MAGIC);
+  assert (layout->field_data_len);
+  assert (tmpl);
 
-  if (_fiid_obj_field_start_end (obj, field, &start, &end) < 0)
-    return (-1);
+  /* field_data_len includes the terminator */
+  if (layout->field_data_len == 1)
+    return (!tmpl[0].max_field_len);
 
-  return (start);
-}
+  last = layout->field_data_len - 2;
 
-static int
-_fiid_obj_field_end (fiid_obj_t obj, const char *field)
-{
-  unsigned int start = 0;
-  unsigned int end = 0; /* excluded always */
+  if (layout->field_data[0].max_field_len != tmpl[0].max_field_len
+      || layout->field_data[0].flags != tmpl[0].flags
+      || strncmp (layout->field_data[0].key, tmpl[0].key, FIID_FIELD_MAX_KEY_LEN))
+    return (0);
 
-  assert (obj);
-  assert (obj->magic == FIID_OBJ_MAGIC);
-  assert (field);
+  if (last
+      && (layout->field_data[last].max_field_len != tmpl[last].max_field_len
+          || layout->field_data[last].flags != tmpl[last].flags
+          || strncmp (layout->field_data[last].key, tmpl[last].key, FIID_FIELD_MAX_KEY_LEN)))
+    return (0);
 
-  if (_fiid_obj_field_start_end (obj, field, &start, &end) < 0)
-    return (-1);
+  if (tmpl[last + 1].max_field_len)
+    return (0);
 
-  return (end);
+  return (1);
 }
 
-static int
-_fiid_obj_field_len (fiid_obj_t obj, const char *field)
+static void
+_fiid_layout_destroy (struct fiid_layout *layout)
 {
-  struct fiid_field_data *ffdptr;
-  unsigned int i;
-
-  assert (obj);
-  assert (obj->magic == FIID_OBJ_MAGIC);
-  assert (field);
+  assert (layout);
+  assert (layout->magic == FIID_LAYOUT_MAGIC);
 
-  if ((ffdptr = hash_find (obj->lookup, field)))
-    return (ffdptr->max_field_len);
-
-  for (i = 0; obj->field_data[i].max_field_len; i++)
-    {
-      if (!strcmp (obj->field_data[i].key, field))
-        {
-          if (!hash_insert (obj->lookup,
-                            obj->field_data[i].key,
-                            &(obj->field_data[i])))
-            {
-              obj->errnum = FIID_ERR_INTERNAL_ERROR;
-              return (-1);
-            }
-
-          return (obj->field_data[i].max_field_len);
-        }
-    }
-
-  obj->errnum = FIID_ERR_FIELD_NOT_FOUND;
-  return (-1);
-}
-
-char *
-fiid_strerror (fiid_err_t errnum)
-{
-  if (errnum >= FIID_ERR_SUCCESS && errnum <= FIID_ERR_ERRNUMRANGE)
-    return (fiid_errmsg[errnum]);
-  else
-    return (fiid_errmsg[FIID_ERR_ERRNUMRANGE]);
+  layout->magic = ~FIID_LAYOUT_MAGIC;
+  free (layout);
 }
 
-fiid_obj_t
-fiid_obj_create (fiid_template_t tmpl)
+/* Layouts are allocated in a single block: the layout struct,
+ * followed by the field data array, the lookup table, and finally
+ * the key strings.
+ */
+static struct fiid_layout *
+_fiid_layout_compile (fiid_template_t tmpl)
 {
-  fiid_obj_t obj = NULL;
-  unsigned int max_pkt_len = 0;
-  unsigned int i;
+  struct fiid_layout *layout = NULL;
+  unsigned int field_data_len = 0;
+  unsigned int lookup_len = 1;
+  unsigned int keys_len = 0;
   unsigned int start = 0;
+  unsigned int i;
+  size_t alloc_len;
+  char *keyptr;
   int data_len;
 
-  if (!tmpl)
-    {
-      /* FIID_ERR_PARAMETERS */
-      errno = EINVAL;
-      goto cleanup;
-    }
+  assert (tmpl);
 
 #ifndef NDEBUG
   if (_fiid_template_check_valid_keys (tmpl) < 0)
@@ -930,231 +999,948 @@ fiid_obj_create (fiid_template_t tmpl)
       goto cleanup;
     }
 
-  if (!(obj = (fiid_obj_t)malloc (sizeof (struct fiid_obj))))
-    {
-      /* FIID_ERR_OUT_OF_MEMORY */
-      errno = ENOMEM;
-      goto cleanup;
-    }
-  memset (obj, '\0', sizeof (struct fiid_obj));
-  obj->magic = FIID_OBJ_MAGIC;
-
   /* after call to _fiid_template_len_bytes, we know each field length
    * and total field length won't overflow an int.
    */
-  if ((data_len = _fiid_template_len_bytes (tmpl,
-                                            &obj->field_data_len)) < 0)
+  if ((data_len = _fiid_template_len_bytes (tmpl, &field_data_len)) < 0)
     goto cleanup;
-  obj->data_len = data_len;
 
-  if (!obj->field_data_len)
+  if (!field_data_len)
     {
       /* FIID_ERR_TEMPLATE_INVALID */
       errno = EINVAL;
       goto cleanup;
     }
 
-  if (!(obj->data = malloc (obj->data_len)))
-    {
-      /* FIID_ERR_OUT_OF_MEMORY */
-      errno = ENOMEM;
-      goto cleanup;
-    }
-  memset (obj->data, '\0', obj->data_len);
+  /* keep lookup table at most half full */
+  while (lookup_len < (field_data_len * 2))
+    lookup_len <<= 1;
 
-  if (!(obj->field_data = malloc (obj->field_data_len * sizeof (struct fiid_field_data))))
+  for (i = 0; i < field_data_len; i++)
+    keys_len += _fiid_key_len (tmpl[i].key) + 1;
+
+  alloc_len = sizeof (struct fiid_layout)
+    + (field_data_len * sizeof (struct fiid_field_data))
+    + (lookup_len * sizeof (unsigned int))
+    + keys_len;
+
+  if (!(layout = (struct fiid_layout *)malloc (alloc_len)))
     {
       /* FIID_ERR_OUT_OF_MEMORY */
       errno = ENOMEM;
       goto cleanup;
     }
-  memset (obj->field_data, '\0', obj->field_data_len * sizeof (struct fiid_field_data));
+  memset (layout, '\0', alloc_len);
+  layout->magic = FIID_LAYOUT_MAGIC;
+  layout->tmpl = tmpl;
+  layout->data_len = data_len;
+  layout->field_data = (struct fiid_field_data *)(layout + 1);
+  layout->field_data_len = field_data_len;
+  layout->lookup = (unsigned int *)(layout->field_data + field_data_len);
+  layout->lookup_mask = lookup_len - 1;
+  keyptr = (char *)(layout->lookup + lookup_len);
 
-  if (!(obj->lookup = hash_create (obj->field_data_len,
-                                   (hash_key_f)hash_key_string,
-                                   (hash_cmp_f)strcmp,
-                                   NULL)))
+  for (i = 0; i < field_data_len; i++)
     {
-      errno = ENOMEM;
-      goto cleanup;
-    }
+      unsigned int key_len = _fiid_key_len (tmpl[i].key);
 
-  for (i = 0; i < obj->field_data_len; i++)
-    {
-#ifndef NDEBUG
+      layout->field_data[i].max_field_len = tmpl[i].max_field_len;
+      layout->field_data[i].key = keyptr;
+      memcpy (keyptr, tmpl[i].key, key_len);
+      keyptr += key_len + 1;
+      layout->field_data[i].flags = tmpl[i].flags;
+      layout->field_data[i].index = i;
+      layout->field_data[i].start = start;
+      layout->field_data[i].end = start + tmpl[i].max_field_len;
+
+      if (tmpl[i].flags & FIID_FIELD_MAKES_PACKET_SUFFICIENT)
+        layout->makes_packet_sufficient = 1;
+
+      if (tmpl[i].flags & FIID_FIELD_SECURE_MEMSET_ON_CLEAR)
+        layout->secure_memset_on_clear = 1;
+
+      start += tmpl[i].max_field_len;
+
+      /* terminating field is not looked up */
       if (tmpl[i].max_field_len)
         {
-          unsigned int j;
+          unsigned int slot;
 
-          for (j = 0; j < i; j++)
+#ifndef NDEBUG
+          if (_fiid_layout_lookup (layout, layout->field_data[i].key) >= 0)
             {
-              if (!strncmp (obj->field_data[j].key, tmpl[i].key, FIID_FIELD_MAX_KEY_LEN))
-                {
-                  /* FIID_ERR_TEMPLATE_INVALID */
-                  errno = EINVAL;
-                  goto cleanup;
-                }
+              /* FIID_ERR_TEMPLATE_INVALID */
+              errno = EINVAL;
+              goto cleanup;
             }
-        }
 #endif /* !NDEBUG */
-      obj->field_data[i].max_field_len = tmpl[i].max_field_len;
-      memset (obj->field_data[i].key, '\0', FIID_FIELD_MAX_KEY_LEN + 1);
-      strncpy (obj->field_data[i].key, tmpl[i].key, FIID_FIELD_MAX_KEY_LEN);
-      obj->field_data[i].set_field_len = 0;
-      obj->field_data[i].flags = tmpl[i].flags;
-      obj->field_data[i].index = i;
-      obj->field_data[i].start = start;
-      obj->field_data[i].end = start + obj->field_data[i].max_field_len;
-      max_pkt_len += tmpl[i].max_field_len;
-
-      if (obj->field_data[i].flags & FIID_FIELD_MAKES_PACKET_SUFFICIENT)
-        obj->makes_packet_sufficient = 1;
 
-      if (obj->field_data[i].flags & FIID_FIELD_SECURE_MEMSET_ON_CLEAR)
-        obj->secure_memset_on_clear = 1;
-
-      start += obj->field_data[i].max_field_len;
-    }
-
-  if (max_pkt_len % 8)
-    {
-      /* FIID_ERR_TEMPLATE_NOT_BYTE_ALIGNED */
-      errno = EINVAL;
-      goto cleanup;
+          slot = hash_key_string (layout->field_data[i].key) & layout->lookup_mask;
+          while (layout->lookup[slot])
+            slot = (slot + 1) & layout->lookup_mask;
+          layout->lookup[slot] = i + 1;
+        }
     }
 
-  obj->errnum = FIID_ERR_SUCCESS;
-  return (obj);
+  return (layout);
 
  cleanup:
-  if (obj)
-    {
-      free (obj->data);
-      free (obj->field_data);
-      hash_destroy (obj->lookup);
-      free (obj);
-    }
-
+  if (layout)
+    _fiid_layout_destroy (layout);
   return (NULL);
 }
 
-void
-fiid_obj_destroy (fiid_obj_t obj)
+static int
+_fiid_layout_cache_rdlock (void)
 {
-  if (!(obj && obj->magic == FIID_OBJ_MAGIC))
-    return;
+#if HAVE_PTHREAD_H
+  return (pthread_rwlock_rdlock (&fiid_layout_cache_lock));
+#else /* !HAVE_PTHREAD_H */
+  return (0);
+#endif /* !HAVE_PTHREAD_H */
+}
 
-  obj->magic = ~FIID_OBJ_MAGIC;
-  obj->errnum = FIID_ERR_SUCCESS;
-  free (obj->data);
-  free (obj->field_data);
-  hash_destroy (obj->lookup);
-  free (obj);
+static int
+_fiid_layout_cache_wrlock (void)
+{
+#if HAVE_PTHREAD_H
+  return (pthread_rwlock_wrlock (&fiid_layout_cache_lock));
+#else /* !HAVE_PTHREAD_H */
+  return (0);
+#endif /* !HAVE_PTHREAD_H */
 }
 
-fiid_obj_t
-fiid_obj_dup (fiid_obj_t src_obj)
+static void
+_fiid_layout_cache_unlock (void)
 {
-  fiid_obj_t dest_obj = NULL;
+#if HAVE_PTHREAD_H
+  pthread_rwlock_unlock (&fiid_layout_cache_lock);
+#endif /* HAVE_PTHREAD_H */
+}
 
-  if (!src_obj || src_obj->magic != FIID_OBJ_MAGIC)
-    goto cleanup;
+#if !HAVE_ATOMIC_BUILTINS
+static unsigned int
+_fiid_layout_ref_add (struct fiid_layout *layout, int n)
+{
+  unsigned int refcount;
 
-  if (!(dest_obj = malloc (sizeof (struct fiid_obj))))
-    {
-      src_obj->errnum = FIID_ERR_OUT_OF_MEMORY;
-      goto cleanup;
-    }
-  memset (dest_obj, '\0', sizeof (struct fiid_obj));
-  dest_obj->magic = src_obj->magic;
-  dest_obj->data_len = src_obj->data_len;
-  dest_obj->field_data_len = src_obj->field_data_len;
+#if HAVE_PTHREAD_H
+  pthread_mutex_lock (&fiid_layout_ref_mutex);
+#endif /* HAVE_PTHREAD_H */
+  refcount = (layout->refcount += n);
+#if HAVE_PTHREAD_H
+  pthread_mutex_unlock (&fiid_layout_ref_mutex);
+#endif /* HAVE_PTHREAD_H */
+  return (refcount);
+}
+#endif /* !HAVE_ATOMIC_BUILTINS */
 
-  if (!(dest_obj->data = malloc (src_obj->data_len)))
-    {
-      src_obj->errnum = FIID_ERR_OUT_OF_MEMORY;
-      goto cleanup;
-    }
-  memcpy (dest_obj->data, src_obj->data, src_obj->data_len);
+static struct fiid_layout *
+_fiid_layout_cache_find (fiid_template_t tmpl, unsigned int bucket)
+{
+  struct fiid_layout *layout;
+
+  assert (tmpl);
+  assert (bucket < FIID_LAYOUT_CACHE_BUCKETS);
 
-  if (!(dest_obj->field_data = malloc (dest_obj->field_data_len * sizeof (struct fiid_field_data))))
+  for (layout = fiid_layout_cache[bucket]; layout; layout = layout->next)
     {
-      src_obj->errnum = FIID_ERR_OUT_OF_MEMORY;
-      goto cleanup;
+      if (layout->tmpl == tmpl
+          && _fiid_layout_template_match (layout, tmpl))
+        return (layout);
     }
 
-  memcpy (dest_obj->field_data,
-          src_obj->field_data,
-          src_obj->field_data_len * sizeof (struct fiid_field_data));
+  return (NULL);
+}
 
-  if (!(dest_obj->lookup = hash_create (dest_obj->field_data_len,
-                                        (hash_key_f)hash_key_string,
-                                        (hash_cmp_f)strcmp,
-                                        NULL)))
-    {
-      src_obj->errnum = FIID_ERR_OUT_OF_MEMORY;
-      goto cleanup;
-    }
+/* Unlink and return one entry to make room in the cache.  Called
+ * w/ the cache lock held.
+ */
+static struct fiid_layout *
+_fiid_layout_cache_evict (unsigned int bucket)
+{
+  unsigned int i;
 
-  src_obj->errnum = FIID_ERR_SUCCESS;
-  dest_obj->errnum = FIID_ERR_SUCCESS;
-  return (dest_obj);
+  assert (bucket < FIID_LAYOUT_CACHE_BUCKETS);
+  assert (fiid_layout_cache_count);
 
- cleanup:
-  if (dest_obj)
+  for (i = 0; i < FIID_LAYOUT_CACHE_BUCKETS; i++)
     {
-      free (dest_obj->data);
-      free (dest_obj->field_data);
-      hash_destroy (dest_obj->lookup);
-      free (dest_obj);
+      struct fiid_layout **pp;
+      struct fiid_layout *layout;
+
+      pp = &fiid_layout_cache[(bucket + i) % FIID_LAYOUT_CACHE_BUCKETS];
+      if (!*pp)
+        continue;
+
+      /* newest entries are at the head, evict the oldest */
+      while ((*pp)->next)
+        pp = &(*pp)->next;
+
+      layout = *pp;
+      *pp = NULL;
+      fiid_layout_cache_count--;
+      return (layout);
     }
+
   return (NULL);
 }
 
-fiid_obj_t
-fiid_obj_copy (fiid_obj_t src_obj, fiid_template_t alt_tmpl)
+/* Drop the cached layout of a template about to be freed, objects
+ * of the template keep their own reference.
+ */
+static void
+_fiid_layout_cache_forget (fiid_template_t tmpl)
 {
-  fiid_obj_t dest_obj = NULL;
-  int data_len;
-  unsigned int field_data_len = 0;
-  uint8_t *databuf = NULL;
+  struct fiid_layout *layout = NULL;
+  struct fiid_layout **pp;
+  unsigned int bucket;
 
-  if (!src_obj || src_obj->magic != FIID_OBJ_MAGIC)
-    goto cleanup;
+  assert (tmpl);
 
-  if ((data_len = _fiid_template_len_bytes (alt_tmpl, &field_data_len)) < 0)
-    goto cleanup;
+  bucket = ((uintptr_t)tmpl >> 4) % FIID_LAYOUT_CACHE_BUCKETS;
 
-  if (src_obj->data_len != data_len)
+  if (_fiid_layout_cache_wrlock ())
+    return;
+
+  for (pp = &fiid_layout_cache[bucket]; *pp; pp = &(*pp)->next)
     {
-      src_obj->errnum = FIID_ERR_PARAMETERS;
-      goto cleanup;
+      if ((*pp)->tmpl == tmpl)
+        {
+          layout = *pp;
+          *pp = layout->next;
+          fiid_layout_cache_count--;
+          if (FIID_LAYOUT_REF_DEC (layout))
+            layout = NULL;
+          break;
+        }
     }
 
-  if (!(dest_obj = fiid_obj_create (alt_tmpl)))
-    goto cleanup;
+  _fiid_layout_cache_unlock ();
 
-  if (!(databuf = (uint8_t *)malloc (src_obj->data_len)))
-    {
-      src_obj->errnum = FIID_ERR_OUT_OF_MEMORY;
-      goto cleanup;
-    }
+  if (layout)
+    _fiid_layout_destroy (layout);
+}
 
-  if ((data_len = fiid_obj_get_all (src_obj, databuf, src_obj->data_len)) < 0)
-    goto cleanup;
+/* Returns a referenced layout for a template, compiling and caching
+ * it if necessary.  Returns NULL on error w/ errno set.
+ */
+static struct fiid_layout *
+_fiid_layout_get (fiid_template_t tmpl)
+{
+  struct fiid_layout *layout = NULL;
+  struct fiid_layout *found;
+  struct fiid_layout *stale = NULL;
+  struct fiid_layout *evicted = NULL;
+  struct fiid_layout **pp;
+  unsigned int bucket;
+  int perr;
 
-  if (fiid_obj_set_all (dest_obj, databuf, data_len) < 0)
+  assert (tmpl);
+
+  bucket = ((uintptr_t)tmpl >> 4) % FIID_LAYOUT_CACHE_BUCKETS;
+
+  /* a layout found is referenced by the cache, evictions are
+   * excluded by the shared lock until our reference is taken
+   */
+  if ((perr = _fiid_layout_cache_rdlock ()))
     {
-      src_obj->errnum = dest_obj->errnum;
-      goto cleanup;
+      errno = perr;
+      return (NULL);
     }
 
-  free (databuf);
-  return (dest_obj);
+  if ((found = _fiid_layout_cache_find (tmpl, bucket)))
+    FIID_LAYOUT_REF_INC (found);
+
+  _fiid_layout_cache_unlock ();
+
+  if (found)
+    return (found);
+
+  /* compile outside of the lock, templates can be large */
+  if (!(layout = _fiid_layout_compile (tmpl)))
+    return (NULL);
+
+  /* one reference for the cache, one for the caller */
+  layout->refcount = 2;
+
+  if ((perr = _fiid_layout_cache_wrlock ()))
+    {
+      _fiid_layout_destroy (layout);
+      errno = perr;
+      return (NULL);
+    }
+
+  /* another thread may have beaten us to it */
+  if ((found = _fiid_layout_cache_find (tmpl, bucket)))
+    {
+      FIID_LAYOUT_REF_INC (found);
+      _fiid_layout_cache_unlock ();
+      _fiid_layout_destroy (layout);
+      return (found);
+    }
+
+  /* an entry at this address that did not match is stale */
+  for (pp = &fiid_layout_cache[bucket]; *pp; pp = &(*pp)->next)
+    {
+      if ((*pp)->tmpl == tmpl)
+        {
+          stale = *pp;
+          *pp = stale->next;
+          fiid_layout_cache_count--;
+          if (FIID_LAYOUT_REF_DEC (stale))
+            stale = NULL;
+          break;
+        }
+    }
+
+  if (fiid_layout_cache_count >= FIID_LAYOUT_CACHE_MAX)
+    {
+      if ((evicted = _fiid_layout_cache_evict (bucket))
+          && FIID_LAYOUT_REF_DEC (evicted))
+        evicted = NULL;
+    }
+
+  layout->next = fiid_layout_cache[bucket];
+  fiid_layout_cache[bucket] = layout;
+  fiid_layout_cache_count++;
+
+  _fiid_layout_cache_unlock ();
+
+  /* layouts no longer referenced by any object */
+  if (stale)
+    _fiid_layout_destroy (stale);
+  if (evicted)
+    _fiid_layout_destroy (evicted);
+
+  return (layout);
+}
+
+/* The caller must already hold a reference */
+static void
+_fiid_layout_ref (struct fiid_layout *layout)
+{
+  assert (layout);
+  assert (layout->magic == FIID_LAYOUT_MAGIC);
+
+  FIID_LAYOUT_REF_INC (layout);
+}
+
+/* The last reference can only be an object's, the layout is no
+ * longer cached and cannot be found by other threads.
+ */
+static void
+_fiid_layout_unref (struct fiid_layout *layout)
+{
+  assert (layout);
+  assert (layout->magic == FIID_LAYOUT_MAGIC);
+
+  if (!FIID_LAYOUT_REF_DEC (layout))
+    _fiid_layout_destroy (layout);
+}
+
+static int
+_fiid_obj_field_start_end (fiid_obj_t obj,
+                           const char *field,
+                           unsigned int *start,
+                           unsigned int *end)
+{
+  int index;
+
+  assert (obj);
+  assert (obj->magic == FIID_OBJ_MAGIC);
+  assert (field);
+  assert (start);
+  assert (end);
+
+  if ((index = _fiid_layout_lookup (obj->layout, field)) < 0)
+    {
+      obj->errnum = FIID_ERR_FIELD_NOT_FOUND;
+      return (-1);
+    }
+
+  /* integer overflow conditions checked during layout compile */
+  *start = obj->field_data[index].start;
+  *end = obj->field_data[index].end;
+  return (obj->field_data[index].max_field_len);
+}
+
+static int
+_fiid_obj_field_start (fiid_obj_t obj, const char *field)
+{
+  unsigned int start = 0;
+  unsigned int end = 0; /* excluded always */
+
+  assert (obj);
+  assert (obj->magic == FIID_OBJ_MAGIC);
+  assert (field);
+
+  if (_fiid_obj_field_start_end (obj, field, &start, &end) < 0)
+    return (-1);
+
+  return (start);
+}
+
+static int
+_fiid_obj_field_end (fiid_obj_t obj, const char *field)
+{
+  unsigned int start = 0;
+  unsigned int end = 0; /* excluded always */
+
+  assert (obj);
+  assert (obj->magic == FIID_OBJ_MAGIC);
+  assert (field);
+
+  if (_fiid_obj_field_start_end (obj, field, &start, &end) < 0)
+    return (-1);
+
+  return (end);
+}
+
+static int
+_fiid_obj_field_len (fiid_obj_t obj, const char *field)
+{
+  int index;
+
+  assert (obj);
+  assert (obj->magic == FIID_OBJ_MAGIC);
+  assert (field);
+
+  if ((index = _fiid_layout_lookup (obj->layout, field)) < 0)
+    {
+      obj->errnum = FIID_ERR_FIELD_NOT_FOUND;
+      return (-1);
+    }
+
+  return (obj->field_data[index].max_field_len);
+}
+
+char *
+fiid_strerror (fiid_err_t errnum)
+{
+  if (errnum >= FIID_ERR_SUCCESS && errnum <= FIID_ERR_ERRNUMRANGE)
+    return (fiid_errmsg[errnum]);
+  else
+    return (fiid_errmsg[FIID_ERR_ERRNUMRANGE]);
+}
+
+static size_t
+_fiid_obj_alloc_len (const struct fiid_layout *layout, int view)
+{
+  assert (layout);
+  assert (layout->magic == FIID_LAYOUT_MAGIC);
+
+  return (sizeof (struct fiid_obj)
+          + (layout->field_data_len * sizeof (unsigned int))
+          + (view ? 0 : layout->data_len));
+}
+
+/* buf must be at least _fiid_obj_alloc_len() bytes and zeroed.  The
+ * object takes over the caller's reference to the layout.
+ */
+static fiid_obj_t
+_fiid_obj_init (void *buf, struct fiid_layout *layout)
+{
+  fiid_obj_t obj;
+
+  assert (buf);
+  assert (layout);
+  assert (layout->magic == FIID_LAYOUT_MAGIC);
+
+  obj = (fiid_obj_t)buf;
+  obj->magic = FIID_OBJ_MAGIC;
+  obj->data_len = layout->data_len;
+  obj->buf_len = layout->data_len;
+  obj->field_data = layout->field_data;
+  obj->field_data_len = layout->field_data_len;
+  obj->makes_packet_sufficient = layout->makes_packet_sufficient;
+  obj->secure_memset_on_clear = layout->secure_memset_on_clear;
+  obj->set_field_len = (unsigned int *)(obj + 1);
+  obj->data = (uint8_t *)(obj->set_field_len + obj->field_data_len);
+
+  obj->layout = layout;
+  obj->errnum = FIID_ERR_SUCCESS;
+  return (obj);
+}
+
+/* On success the object takes over the caller's reference to the
+ * layout, on error the caller keeps it.
+ */
+static fiid_obj_t
+_fiid_obj_create_from_layout (struct fiid_layout *layout)
+{
+  size_t alloc_len;
+  void *buf;
+
+  assert (layout);
+  assert (layout->magic == FIID_LAYOUT_MAGIC);
+
+  alloc_len = _fiid_obj_alloc_len (layout, 0);
+
+  if (!(buf = malloc (alloc_len)))
+    {
+      /* FIID_ERR_OUT_OF_MEMORY */
+      errno = ENOMEM;
+      return (NULL);
+    }
+  memset (buf, '\0', alloc_len);
+
+  return (_fiid_obj_init (buf, layout));
+}
+
+static void *
+_fiid_arena_alloc (struct fiid_arena *arena, size_t len)
+{
+  struct fiid_arena_block *block;
+  size_t block_len;
+  void *rv;
+
+  assert (arena);
+  assert (arena->magic == FIID_ARENA_MAGIC);
+
+  len = FIID_OBJ_ALIGN (len);
+
+  if (!arena->blocks
+      || (arena->blocks->len - arena->blocks->used) < len)
+    {
+      block_len = arena->block_len > len ? arena->block_len : len;
+
+      if (!(block = (struct fiid_arena_block *)malloc (FIID_OBJ_ALIGN (sizeof (struct fiid_arena_block)) + block_len)))
+        {
+          /* FIID_ERR_OUT_OF_MEMORY */
+          errno = ENOMEM;
+          return (NULL);
+        }
+      block->len = block_len;
+      block->used = 0;
+      block->next = arena->blocks;
+      arena->blocks = block;
+    }
+
+  block = arena->blocks;
+  rv = (uint8_t *)block + FIID_OBJ_ALIGN (sizeof (struct fiid_arena_block)) + block->used;
+  block->used += len;
+  memset (rv, '\0', len);
+  return (rv);
+}
+
+fiid_obj_t
+fiid_obj_create (fiid_template_t tmpl)
+{
+  struct fiid_layout *layout;
+  fiid_obj_t obj;
+
+  if (!tmpl)
+    {
+      /* FIID_ERR_PARAMETERS */
+      errno = EINVAL;
+      return (NULL);
+    }
+
+  if (!(layout = _fiid_layout_get (tmpl)))
+    return (NULL);
+
+  /* the reference from _fiid_layout_get() is the object's */
+  if (!(obj = _fiid_obj_create_from_layout (layout)))
+    _fiid_layout_unref (layout);
+
+  return (obj);
+}
+
+fiid_obj_t
+fiid_obj_create_in (fiid_arena_t arena, fiid_template_t tmpl)
+{
+  struct fiid_layout *layout;
+  fiid_obj_t obj = NULL;
+  void *buf;
+
+  if (!arena || arena->magic != FIID_ARENA_MAGIC || !tmpl)
+    {
+      /* FIID_ERR_PARAMETERS */
+      errno = EINVAL;
+      return (NULL);
+    }
+
+  if (!(layout = _fiid_layout_get (tmpl)))
+    return (NULL);
+
+  if (!(buf = _fiid_arena_alloc (arena, _fiid_obj_alloc_len (layout, 0))))
+    {
+      _fiid_layout_unref (layout);
+      return (NULL);
+    }
+
+  /* the reference from _fiid_layout_get() is the object's */
+  obj = _fiid_obj_init (buf, layout);
+  obj->arena = arena;
+  obj->arena_next = arena->objs;
+  arena->objs = obj;
+
+  if (obj->secure_memset_on_clear)
+    arena->secure_memset_on_reset = 1;
+
+  return (obj);
+}
+
+/* Set the field lengths as if data_len bytes were copied to the
+ * start of the object.  data_len must be <= obj->data_len.
+ */
+static int
+_fiid_obj_set_all_field_len (fiid_obj_t obj, unsigned int data_len)
+{
+  unsigned int bits_counter, data_bits_len;
+  unsigned int key_index_end;
+  unsigned int i;
+
+  assert (obj);
+  assert (obj->magic == FIID_OBJ_MAGIC);
+  assert (data_len <= obj->data_len);
+
+  /* achu: Find index of last field */
+  data_bits_len = data_len * 8;
+  if (data_len < obj->data_len)
+    {
+      /* integer overflow conditions checked during object creation */
+      bits_counter = 0;
+      for (i = 0; obj->field_data[i].max_field_len; i++)
+        {
+          bits_counter += obj->field_data[i].max_field_len;
+          if (bits_counter >= data_bits_len)
+            {
+              /* achu: We assume the data must end on a byte boundary. */
+              if (bits_counter % 8)
+                {
+                  obj->errnum = FIID_ERR_DATA_NOT_BYTE_ALIGNED;
+                  return (-1);
+                }
+              else
+                break;
+            }
+
+        }
+      key_index_end = i;
+    }
+  else
+    key_index_end = (obj->field_data_len - 1);
+
+  /* integer overflow conditions checked during object creation */
+  bits_counter = 0;
+  for (i = 0; i < key_index_end; i++)
+    {
+      obj->set_field_len[i] = obj->field_data[i].max_field_len;
+      bits_counter += obj->set_field_len[i];
+    }
+  if (data_bits_len < bits_counter + obj->field_data[key_index_end].max_field_len)
+    {
+      int data_bits_left = data_bits_len - bits_counter;
+      obj->set_field_len[i] = data_bits_left;
+    }
+  else
+    obj->set_field_len[i] = obj->field_data[i].max_field_len;
+
+  return (0);
+}
+
+static fiid_obj_t
+_fiid_obj_view_init (void *buf,
+                     struct fiid_layout *layout,
+                     const void *data,
+                     unsigned int data_len)
+{
+  fiid_obj_t obj;
+
+  assert (buf);
+  assert (layout);
+  assert (layout->magic == FIID_LAYOUT_MAGIC);
+  assert (data);
+
+  obj = _fiid_obj_init (buf, layout);
+  obj->view = 1;
+  obj->data = (uint8_t *)data;
+  obj->buf_len = data_len < obj->data_len ? data_len : obj->data_len;
+
+  if (_fiid_obj_set_all_field_len (obj, obj->buf_len) < 0)
+    {
+      /* FIID_ERR_DATA_NOT_BYTE_ALIGNED */
+      /* the caller keeps its reference on error */
+      obj->magic = ~FIID_OBJ_MAGIC;
+      errno = EINVAL;
+      return (NULL);
+    }
+
+  return (obj);
+}
+
+fiid_obj_t
+fiid_obj_view_create (fiid_template_t tmpl,
+                      const void *data,
+                      unsigned int data_len)
+{
+  struct fiid_layout *layout;
+  fiid_obj_t obj = NULL;
+  size_t alloc_len;
+  void *buf;
+
+  if (!tmpl || !data)
+    {
+      /* FIID_ERR_PARAMETERS */
+      errno = EINVAL;
+      return (NULL);
+    }
+
+  if (!(layout = _fiid_layout_get (tmpl)))
+    return (NULL);
+
+  alloc_len = _fiid_obj_alloc_len (layout, 1);
+
+  if (!(buf = malloc (alloc_len)))
+    {
+      /* FIID_ERR_OUT_OF_MEMORY */
+      errno = ENOMEM;
+      goto cleanup;
+    }
+  memset (buf, '\0', alloc_len);
+
+  /* the reference from _fiid_layout_get() is the object's */
+  if (!(obj = _fiid_obj_view_init (buf, layout, data, data_len)))
+    {
+      free (buf);
+      goto cleanup;
+    }
+
+  return (obj);
+
+ cleanup:
+  _fiid_layout_unref (layout);
+  return (NULL);
+}
+
+fiid_obj_t
+fiid_obj_view_create_in (fiid_arena_t arena,
+                         fiid_template_t tmpl,
+                         const void *data,
+                         unsigned int data_len)
+{
+  struct fiid_layout *layout;
+  fiid_obj_t obj = NULL;
+  void *buf;
+
+  if (!arena || arena->magic != FIID_ARENA_MAGIC || !tmpl || !data)
+    {
+      /* FIID_ERR_PARAMETERS */
+      errno = EINVAL;
+      return (NULL);
+    }
+
+  if (!(layout = _fiid_layout_get (tmpl)))
+    return (NULL);
+
+  if (!(buf = _fiid_arena_alloc (arena, _fiid_obj_alloc_len (layout, 1))))
+    goto cleanup;
+
+  /* the reference from _fiid_layout_get() is the object's, on
+   * error the arena space is released on fiid_arena_reset()
+   */
+  if (!(obj = _fiid_obj_view_init (buf, layout, data, data_len)))
+    goto cleanup;
+
+  obj->arena = arena;
+  obj->arena_next = arena->objs;
+  arena->objs = obj;
+
+  return (obj);
+
+ cleanup:
+  _fiid_layout_unref (layout);
+  return (NULL);
+}
+
+static void
+_fiid_obj_invalidate (fiid_obj_t obj)
+{
+  assert (obj);
+  assert (obj->magic == FIID_OBJ_MAGIC);
+
+  obj->magic = ~FIID_OBJ_MAGIC;
+  obj->errnum = FIID_ERR_SUCCESS;
+  if (obj->secure_memset_on_clear && !obj->view)
+    secure_memset (obj->data, '\0', obj->data_len);
+  _fiid_layout_unref (obj->layout);
+}
+
+void
+fiid_obj_destroy (fiid_obj_t obj)
+{
+  if (!(obj && obj->magic == FIID_OBJ_MAGIC))
+    return;
+
+  _fiid_obj_invalidate (obj);
+
+  /* arena objects are released on fiid_arena_reset() */
+  if (!obj->arena)
+    free (obj);
+}
+
+fiid_obj_t
+fiid_obj_dup (fiid_obj_t src_obj)
+{
+  fiid_obj_t dest_obj = NULL;
+
+  if (!src_obj || src_obj->magic != FIID_OBJ_MAGIC)
+    return (NULL);
+
+  _fiid_layout_ref (src_obj->layout);
+
+  if (!(dest_obj = _fiid_obj_create_from_layout (src_obj->layout)))
+    {
+      _fiid_layout_unref (src_obj->layout);
+      src_obj->errnum = FIID_ERR_OUT_OF_MEMORY;
+      return (NULL);
+    }
+
+  memcpy (dest_obj->data, src_obj->data, src_obj->buf_len);
+  memcpy (dest_obj->set_field_len,
+          src_obj->set_field_len,
+          src_obj->field_data_len * sizeof (unsigned int));
+
+  src_obj->errnum = FIID_ERR_SUCCESS;
+  dest_obj->errnum = FIID_ERR_SUCCESS;
+  return (dest_obj);
+}
+
+fiid_arena_t
+fiid_arena_create (unsigned int size_hint)
+{
+  struct fiid_arena *arena;
+
+  if (!(arena = (struct fiid_arena *)malloc (sizeof (struct fiid_arena))))
+    {
+      /* FIID_ERR_OUT_OF_MEMORY */
+      errno = ENOMEM;
+      return (NULL);
+    }
+  memset (arena, '\0', sizeof (struct fiid_arena));
+  arena->magic = FIID_ARENA_MAGIC;
+  arena->block_len = size_hint ? FIID_OBJ_ALIGN (size_hint) : FIID_ARENA_BLOCK_LEN_DEFAULT;
+
+  return (arena);
+}
+
+int
+fiid_arena_reset (fiid_arena_t arena)
+{
+  struct fiid_arena_block *block;
+  size_t total_len = 0;
+  fiid_obj_t obj;
+
+  if (!arena || arena->magic != FIID_ARENA_MAGIC)
+    {
+      /* FIID_ERR_PARAMETERS */
+      errno = EINVAL;
+      return (-1);
+    }
+
+  for (obj = arena->objs; obj; obj = obj->arena_next)
+    {
+      if (obj->magic == FIID_OBJ_MAGIC)
+        _fiid_obj_invalidate (obj);
+    }
+  arena->objs = NULL;
+
+  for (block = arena->blocks; block; block = block->next)
+    {
+      if (arena->secure_memset_on_reset)
+        secure_memset ((uint8_t *)block + FIID_OBJ_ALIGN (sizeof (struct fiid_arena_block)),
+                       '\0',
+                       block->used);
+      block->used = 0;
+      total_len += block->len;
+    }
+  arena->secure_memset_on_reset = 0;
+
+  /* achu: If the arena overflowed into multiple blocks, fold them
+   * into one block large enough for the next round so steady state
+   * use requires no allocations.
+   */
+  if (arena->blocks && arena->blocks->next)
+    {
+      while (arena->blocks)
+        {
+          block = arena->blocks;
+          arena->blocks = block->next;
+          free (block);
+        }
+      arena->block_len = total_len;
+    }
+
+  return (0);
+}
+
+void
+fiid_arena_destroy (fiid_arena_t arena)
+{
+  struct fiid_arena_block *block;
+
+  if (!arena || arena->magic != FIID_ARENA_MAGIC)
+    return;
+
+  fiid_arena_reset (arena);
+
+  while (arena->blocks)
+    {
+      block = arena->blocks;
+      arena->blocks = block->next;
+      free (block);
+    }
+
+  arena->magic = ~FIID_ARENA_MAGIC;
+  free (arena);
+}
+
+fiid_obj_t
+fiid_obj_copy (fiid_obj_t src_obj, fiid_template_t alt_tmpl)
+{
+  fiid_obj_t dest_obj = NULL;
+  int data_len;
+  unsigned int field_data_len = 0;
+  uint8_t *databuf = NULL;
+
+  if (!src_obj || src_obj->magic != FIID_OBJ_MAGIC)
+    goto cleanup;
+
+  if ((data_len = _fiid_template_len_bytes (alt_tmpl, &field_data_len)) < 0)
+    goto cleanup;
+
+  if (src_obj->data_len != data_len)
+    {
+      src_obj->errnum = FIID_ERR_PARAMETERS;
+      goto cleanup;
+    }
+
+  if (!(dest_obj = fiid_obj_create (alt_tmpl)))
+    goto cleanup;
+
+  if (!(databuf = (uint8_t *)malloc (src_obj->data_len)))
+    {
+      src_obj->errnum = FIID_ERR_OUT_OF_MEMORY;
+      goto cleanup;
+    }
+
+  if ((data_len = fiid_obj_get_all (src_obj, databuf, src_obj->data_len)) < 0)
+    goto cleanup;
+
+  if (fiid_obj_set_all (dest_obj, databuf, data_len) < 0)
+    {
+      src_obj->errnum = dest_obj->errnum;
+      goto cleanup;
+    }
 
- cleanup:
-  if (dest_obj)
-    fiid_obj_destroy (dest_obj);
+  free (databuf);
+  return (dest_obj);
+
+ cleanup:
+  if (dest_obj)
+    fiid_obj_destroy (dest_obj);
   free (databuf);
   return (NULL);
 }
@@ -1183,7 +1969,7 @@ _fiid_obj_packet_valid (fiid_obj_t obj, int makes_packet_sufficient_checks)
       unsigned int required_flag = FIID_FIELD_REQUIRED_FLAG (obj->field_data[i].flags);
       unsigned int length_flag = FIID_FIELD_LENGTH_FLAG (obj->field_data[i].flags);
       unsigned int max_field_len = obj->field_data[i].max_field_len;
-      unsigned int set_field_len = obj->field_data[i].set_field_len;
+      unsigned int set_field_len = obj->set_field_len[i];
       unsigned int makes_packet_sufficient_flag = obj->field_data[i].flags & FIID_FIELD_MAKES_PACKET_SUFFICIENT;
 
       if (makes_packet_sufficient_checks)
@@ -1376,7 +2162,7 @@ fiid_obj_template (fiid_obj_t obj)
     {
       tmpl[i].max_field_len = obj->field_data[i].max_field_len;
       /* not FIID_FIELD_MAX_KEY_LEN + 1, template does not have + 1 */
-      memcpy (tmpl[i].key, obj->field_data[i].key, FIID_FIELD_MAX_KEY_LEN);
+      strncpy (tmpl[i].key, obj->field_data[i].key, FIID_FIELD_MAX_KEY_LEN);
       tmpl[i].flags = obj->field_data[i].flags;
     }
 
@@ -1474,39 +2260,21 @@ fiid_obj_errormsg (fiid_obj_t obj)
 static int
 _fiid_obj_lookup_field_index (fiid_obj_t obj, const char *field, unsigned int *index)
 {
-  struct fiid_field_data *ffdptr;
-  unsigned int i;
+  int rv;
 
   assert (obj);
   assert (obj->magic == FIID_OBJ_MAGIC);
-  assert (field);
-  assert (index);
-
-  if ((ffdptr = hash_find (obj->lookup, field)))
-    {
-      (*index) = ffdptr->index;
-      return (0);
-    }
+  assert (field);
+  assert (index);
 
-  for (i = 0; obj->field_data[i].max_field_len; i++)
+  if ((rv = _fiid_layout_lookup (obj->layout, field)) < 0)
     {
-      if (!strcmp (obj->field_data[i].key, field))
-        {
-          if (!hash_insert (obj->lookup,
-                            obj->field_data[i].key,
-                            &(obj->field_data[i])))
-            {
-              obj->errnum = FIID_ERR_INTERNAL_ERROR;
-              return (-1);
-            }
-
-          (*index) = obj->field_data[i].index;
-          return (0);
-        }
+      obj->errnum = FIID_ERR_FIELD_NOT_FOUND;
+      return (-1);
     }
 
-  obj->errnum = FIID_ERR_FIELD_NOT_FOUND;
-  return (-1);
+  (*index) = rv;
+  return (0);
 }
 
 int
@@ -1520,7 +2288,7 @@ fiid_obj_len (fiid_obj_t obj)
 
   /* integer overflow conditions checked during object creation */
   for (i = 0; obj->field_data[i].max_field_len; i++)
-    counter += obj->field_data[i].set_field_len;
+    counter += obj->set_field_len[i];
 
   obj->errnum = FIID_ERR_SUCCESS;
   return (counter);
@@ -1565,7 +2333,7 @@ fiid_obj_field_len (fiid_obj_t obj, const char *field)
     return (-1);
 
   obj->errnum = FIID_ERR_SUCCESS;
-  return (obj->field_data[key_index].set_field_len);
+  return (obj->set_field_len[key_index]);
 }
 
 int
@@ -1625,7 +2393,7 @@ fiid_obj_block_len (fiid_obj_t obj, const char *field_start, const char *field_e
 
   /* integer overflow conditions checked during object creation */
   for (i = key_index_start; i <= key_index_end; i++)
-    counter += obj->field_data[i].set_field_len;
+    counter += obj->set_field_len[i];
 
   obj->errnum = FIID_ERR_SUCCESS;
   return (counter);
@@ -1666,13 +2434,19 @@ fiid_obj_clear (fiid_obj_t obj)
   if (!obj || obj->magic != FIID_OBJ_MAGIC)
     return (-1);
 
+  if (obj->view)
+    {
+      obj->errnum = FIID_ERR_OBJ_READ_ONLY;
+      return (-1);
+    }
+
   if (obj->secure_memset_on_clear)
     secure_memset (obj->data, '\0', obj->data_len);
   else
     memset (obj->data, '\0', obj->data_len);
 
   for (i =0; i < obj->field_data_len; i++)
-    obj->field_data[i].set_field_len = 0;
+    obj->set_field_len[i] = 0;
 
   obj->errnum = FIID_ERR_SUCCESS;
   return (0);
@@ -1687,6 +2461,12 @@ fiid_obj_clear_field (fiid_obj_t obj, const char *field)
   if (!obj || obj->magic != FIID_OBJ_MAGIC)
     return (-1);
 
+  if (obj->view)
+    {
+      obj->errnum = FIID_ERR_OBJ_READ_ONLY;
+      return (-1);
+    }
+
   if (!field)
     {
       obj->errnum = FIID_ERR_PARAMETERS;
@@ -1696,7 +2476,7 @@ fiid_obj_clear_field (fiid_obj_t obj, const char *field)
   if (_fiid_obj_lookup_field_index (obj, field, &key_index) < 0)
     return (-1);
 
-  if (!obj->field_data[key_index].set_field_len)
+  if (!obj->set_field_len[key_index])
     return (0);
 
   if ((bits_len = _fiid_obj_field_len (obj, field)) < 0)
@@ -1742,7 +2522,7 @@ fiid_obj_clear_field (fiid_obj_t obj, const char *field)
         memset (obj->data + field_offset, '\0', bytes_len);
     }
 
-  obj->field_data[key_index].set_field_len = 0;
+  obj->set_field_len[key_index] = 0;
   obj->errnum = FIID_ERR_SUCCESS;
   return (0);
 }
@@ -1789,176 +2569,143 @@ FIID_OBJ_FIELD_LOOKUP (fiid_obj_t obj, const char *field)
   return (ret);
 }
 
-int
-fiid_obj_set (fiid_obj_t obj,
-              const char *field,
-              uint64_t val)
+/* Fields are packed least significant bit first, so a field's bits
+ * are a little endian integer starting at the field's first byte.
+ */
+static uint64_t
+_fiid_load_le (const uint8_t *buf, unsigned int len)
 {
-  unsigned int start_bit_pos = 0;
-  unsigned int end_bit_pos = 0; /* excluded always */
-  int byte_pos = 0;
-  int start_bit_in_byte_pos = 0;
-  int end_bit_in_byte_pos = 0;
-  int field_len = 0;
-  int bytes_used = 0;
-  unsigned int key_index;
-  uint64_t merged_val = 0;
-  uint8_t *temp_data = NULL;
+  uint64_t val = 0;
 
-  if (!obj || obj->magic != FIID_OBJ_MAGIC)
-    goto cleanup;
+  assert (buf);
+  assert (len <= 8);
 
-  if (!field)
+#ifndef WORDS_BIGENDIAN
+  if (len == 8)
     {
-      obj->errnum = FIID_ERR_PARAMETERS;
-      goto cleanup;
+      memcpy (&val, buf, 8);
+      return (val);
     }
+#endif /* !WORDS_BIGENDIAN */
 
-  if (_fiid_obj_lookup_field_index (obj, field, &key_index) < 0)
-    return (-1);
-
-  if ((field_len = _fiid_obj_field_start_end (obj,
-                                              field,
-                                              &start_bit_pos,
-                                              &end_bit_pos)) < 0)
-    return (-1);
+  while (len--)
+    val = (val << 8) | buf[len];
 
-  if (field_len > 64)
-    field_len = 64;
+  return (val);
+}
 
-  byte_pos = start_bit_pos / 8;
+static void
+_fiid_store_le (uint8_t *buf, uint64_t val, unsigned int len)
+{
+  unsigned int i;
 
-  /* in byte_pos, start_bit_pos is  */
-  start_bit_in_byte_pos = start_bit_pos - (byte_pos * 8);
+  assert (buf);
+  assert (len <= 8);
 
-  /* and it spans into... */
-  if (start_bit_in_byte_pos + field_len > 8)
+#ifndef WORDS_BIGENDIAN
+  if (len == 8)
     {
-      int field_len_temp = field_len;
-
-      if (start_bit_in_byte_pos)
-        bytes_used++;
-
-      field_len_temp -= start_bit_in_byte_pos;
-
-      bytes_used += (field_len_temp / 8);
-
-      field_len_temp -= (bytes_used * 8);
-
-      if (field_len_temp)
-        bytes_used++;
+      memcpy (buf, &val, 8);
+      return;
     }
-  else
+#endif /* !WORDS_BIGENDIAN */
+
+  for (i = 0; i < len; i++)
     {
-      end_bit_in_byte_pos = start_bit_in_byte_pos + field_len;
-      bytes_used++;
+      buf[i] = val & 0xFF;
+      val >>= 8;
     }
+}
 
-  if (bytes_used > 1)
-    {
-      int start_val_pos = 0;
-      int end_val_pos = 0;
-      uint64_t extracted_val = 0;
-      int field_len_left = field_len;
-      unsigned int i;
+static int
+_fiid_obj_set (fiid_obj_t obj,
+               unsigned int key_index,
+               uint64_t val)
+{
+  unsigned int start_bit_pos;
+  unsigned int byte_pos;
+  unsigned int bit_offset;
+  unsigned int field_len;
+  uint64_t mask;
 
-      if (!(temp_data = malloc (obj->data_len)))
-        {
-          obj->errnum = FIID_ERR_OUT_OF_MEMORY;
-          goto cleanup;
-        }
-      memcpy (temp_data, obj->data, obj->data_len);
+  assert (obj);
+  assert (obj->magic == FIID_OBJ_MAGIC);
+  assert (key_index < (obj->field_data_len - 1));
 
-      for (i = 0; i < bytes_used; i++)
-        {
-          if (i == 0)
-            {
-              end_val_pos = 8 - start_bit_in_byte_pos;
-              field_len_left -= end_val_pos;
-            }
-          else if (i != (bytes_used - 1))
-            {
-              end_val_pos += 8;
-              field_len_left -= 8;
-            }
-          else
-            end_val_pos += field_len_left;
+  /* integer overflow conditions checked during layout compile */
+  start_bit_pos = obj->field_data[key_index].start;
+  field_len = obj->field_data[key_index].max_field_len;
 
-          if (i != (bytes_used - 1))
-            end_bit_in_byte_pos = 8;
-          else
-            end_bit_in_byte_pos = field_len_left;
+  if (field_len > 64)
+    field_len = 64;
 
-          if (bits_extract (val,
-                            start_val_pos,
-                            end_val_pos,
-                            &extracted_val) < 0)
-            {
-              obj->errnum = FIID_ERR_INTERNAL_ERROR;
-              goto cleanup;
-            }
+  byte_pos = start_bit_pos / 8;
+  bit_offset = start_bit_pos % 8;
+  mask = FIID_BITS_MASK (field_len);
 
-          if (bits_merge (temp_data[byte_pos + i],
-                          start_bit_in_byte_pos,
-                          end_bit_in_byte_pos,
-                          extracted_val,
-                          &merged_val) < 0)
-            {
-              obj->errnum = FIID_ERR_INTERNAL_ERROR;
-              goto cleanup;
-            }
+  if (bit_offset + field_len <= 8)
+    {
+      uint8_t byte_mask = (uint8_t)(mask << bit_offset);
 
-          temp_data[byte_pos + i] = merged_val;
-          start_bit_in_byte_pos = 0;
-          start_val_pos = end_val_pos;
-        }
+      obj->data[byte_pos] = (obj->data[byte_pos] & ~byte_mask)
+        | ((uint8_t)(val << bit_offset) & byte_mask);
+    }
+  else if (!bit_offset && !(field_len % 8))
+    _fiid_store_le (obj->data + byte_pos, val, field_len / 8);
+  else if (bit_offset + field_len <= 64
+           && byte_pos + 8 <= obj->data_len)
+    {
+      uint64_t word;
 
-      memcpy (obj->data, temp_data, obj->data_len);
-      obj->field_data[key_index].set_field_len = field_len;
+      word = _fiid_load_le (obj->data + byte_pos, 8);
+      word = (word & ~(mask << bit_offset)) | ((val & mask) << bit_offset);
+      _fiid_store_le (obj->data + byte_pos, word, 8);
     }
   else
     {
-      if (bits_merge (obj->data[byte_pos],
-                      start_bit_in_byte_pos,
-                      end_bit_in_byte_pos,
-                      val,
-                      &merged_val) < 0)
+      uint8_t *data = obj->data + byte_pos;
+      unsigned int len_left = field_len;
+
+      /* field runs to the end of the object or spans 9 bytes */
+      while (len_left)
         {
-          obj->errnum = FIID_ERR_INTERNAL_ERROR;
-          goto cleanup;
+          unsigned int len = 8 - bit_offset;
+          uint8_t byte_mask;
+
+          if (len > len_left)
+            len = len_left;
+
+          byte_mask = (uint8_t)(FIID_BITS_MASK (len) << bit_offset);
+          *data = (*data & ~byte_mask) | ((uint8_t)(val << bit_offset) & byte_mask);
+          val >>= len;
+          len_left -= len;
+          bit_offset = 0;
+          data++;
         }
-      obj->data[byte_pos] = merged_val;
-      obj->field_data[key_index].set_field_len = field_len;
     }
 
-  free (temp_data);
+  obj->set_field_len[key_index] = field_len;
   obj->errnum = FIID_ERR_SUCCESS;
   return (0);
-
- cleanup:
-  free (temp_data);
-  return (-1);
 }
 
 int
-fiid_obj_get (fiid_obj_t obj,
+fiid_obj_set (fiid_obj_t obj,
               const char *field,
-              uint64_t *val)
+              uint64_t val)
 {
-  unsigned int start_bit_pos = 0;
-  unsigned int end_bit_pos = 0; /* excluded always */
-  int byte_pos = 0;
-  int start_bit_in_byte_pos = 0;
-  int end_bit_in_byte_pos = 0;
-  int field_len = 0;
-  int bytes_used = 0;
   unsigned int key_index;
-  uint64_t merged_val = 0;
 
   if (!obj || obj->magic != FIID_OBJ_MAGIC)
     return (-1);
 
-  if (!field || !val)
+  if (obj->view)
+    {
+      obj->errnum = FIID_ERR_OBJ_READ_ONLY;
+      return (-1);
+    }
+
+  if (!field)
     {
       obj->errnum = FIID_ERR_PARAMETERS;
       return (-1);
@@ -1967,125 +2714,147 @@ fiid_obj_get (fiid_obj_t obj,
   if (_fiid_obj_lookup_field_index (obj, field, &key_index) < 0)
     return (-1);
 
-  if (!obj->field_data[key_index].set_field_len)
+  return (_fiid_obj_set (obj, key_index, val));
+}
+
+int
+fiid_obj_set_idx (fiid_obj_t obj,
+                  unsigned int index,
+                  uint64_t val)
+{
+  if (!obj || obj->magic != FIID_OBJ_MAGIC)
+    return (-1);
+
+  if (obj->view)
+    {
+      obj->errnum = FIID_ERR_OBJ_READ_ONLY;
+      return (-1);
+    }
+
+  if (index >= (obj->field_data_len - 1))
+    {
+      obj->errnum = FIID_ERR_FIELD_NOT_FOUND;
+      return (-1);
+    }
+
+  return (_fiid_obj_set (obj, index, val));
+}
+
+static int
+_fiid_obj_get (fiid_obj_t obj,
+               unsigned int key_index,
+               uint64_t *val)
+{
+  unsigned int start_bit_pos;
+  unsigned int byte_pos;
+  unsigned int bit_offset;
+  unsigned int field_len;
+  uint64_t mask;
+
+  assert (obj);
+  assert (obj->magic == FIID_OBJ_MAGIC);
+  assert (key_index < (obj->field_data_len - 1));
+  assert (val);
+
+  if (!obj->set_field_len[key_index])
     {
       obj->errnum = FIID_ERR_SUCCESS;
       return (0);
     }
 
-  if ((field_len = _fiid_obj_field_start_end (obj,
-                                              field,
-                                              &start_bit_pos,
-                                              &end_bit_pos)) < 0)
-    return (-1);
+  /* integer overflow conditions checked during layout compile */
+  start_bit_pos = obj->field_data[key_index].start;
+  field_len = obj->field_data[key_index].max_field_len;
 
   if (field_len > 64)
     field_len = 64;
 
-  if (field_len > obj->field_data[key_index].set_field_len)
-    field_len = obj->field_data[key_index].set_field_len;
+  if (field_len > obj->set_field_len[key_index])
+    field_len = obj->set_field_len[key_index];
 
   byte_pos = start_bit_pos / 8;
-
-  /* in byte_pos, start_bit_pos is  */
-  start_bit_in_byte_pos = start_bit_pos - (byte_pos * 8);
-
-  /* and it spans into... */
-  if (start_bit_in_byte_pos + field_len > 8)
+  bit_offset = start_bit_pos % 8;
+  mask = FIID_BITS_MASK (field_len);
+
+  if (bit_offset + field_len <= 8)
+    *val = (obj->data[byte_pos] >> bit_offset) & mask;
+  else if (!bit_offset && !(field_len % 8))
+    *val = _fiid_load_le (obj->data + byte_pos, field_len / 8);
+  else if (bit_offset + field_len <= 64
+           && byte_pos + 8 <= obj->buf_len)
+    *val = (_fiid_load_le (obj->data + byte_pos, 8) >> bit_offset) & mask;
+  else
     {
-      int field_len_temp = field_len;
+      const uint8_t *data = obj->data + byte_pos;
+      unsigned int len_left = field_len;
+      unsigned int val_pos = 0;
+      uint64_t final_val = 0;
 
-      if (start_bit_in_byte_pos)
-        bytes_used++;
-
-      field_len_temp -= start_bit_in_byte_pos;
+      /* field runs to the end of the object or spans 9 bytes */
+      while (len_left)
+        {
+          unsigned int len = 8 - bit_offset;
 
-      bytes_used += (field_len_temp / 8);
+          if (len > len_left)
+            len = len_left;
 
-      field_len_temp -= (bytes_used * 8);
+          final_val |= ((uint64_t)((*data >> bit_offset) & FIID_BITS_MASK (len))) << val_pos;
+          val_pos += len;
+          len_left -= len;
+          bit_offset = 0;
+          data++;
+        }
 
-      if (field_len_temp)
-        bytes_used++;
-    }
-  else
-    {
-      end_bit_in_byte_pos = start_bit_in_byte_pos + field_len;
-      bytes_used++;
+      *val = final_val;
     }
 
-  if (bytes_used > 1)
-    {
-      int start_val_pos = 0;
-      int end_val_pos = 0;
-      uint64_t extracted_val = 0;
-      uint64_t final_val = 0x0;
-      int field_len_left = field_len;
-      unsigned int i;
+  obj->errnum = FIID_ERR_SUCCESS;
+  return (1);
+}
 
-      for (i = 0; i < bytes_used; i++)
-        {
-          if (i == 0)
-            {
-              end_val_pos = 8 - start_bit_in_byte_pos;
-              field_len_left -= end_val_pos;
-            }
-          else if (i != (bytes_used - 1))
-            {
-              end_val_pos += 8;
-              field_len_left -= 8;
-            }
-          else
-            end_val_pos += field_len_left;
+int
+fiid_obj_get (fiid_obj_t obj,
+              const char *field,
+              uint64_t *val)
+{
+  unsigned int key_index;
 
-          if (i != (bytes_used - 1))
-            end_bit_in_byte_pos = 8;
-          else
-            end_bit_in_byte_pos = field_len_left;
+  if (!obj || obj->magic != FIID_OBJ_MAGIC)
+    return (-1);
 
-          if (bits_extract (obj->data[byte_pos + i],
-                            start_bit_in_byte_pos,
-                            end_bit_in_byte_pos,
-                            &extracted_val) < 0)
-            {
-              obj->errnum = FIID_ERR_INTERNAL_ERROR;
-              return (-1);
-            }
+  if (!field || !val)
+    {
+      obj->errnum = FIID_ERR_PARAMETERS;
+      return (-1);
+    }
 
-          if (bits_merge (final_val,
-                          start_val_pos,
-                          end_val_pos,
-                          extracted_val,
-                          &merged_val) < 0)
-            {
-              obj->errnum = FIID_ERR_INTERNAL_ERROR;
-              return (-1);
-            }
+  if (_fiid_obj_lookup_field_index (obj, field, &key_index) < 0)
+    return (-1);
 
-          final_val = merged_val;
-          start_bit_in_byte_pos = 0;
-          start_val_pos = end_val_pos;
-        }
+  return (_fiid_obj_get (obj, key_index, val));
+}
 
-      *val = 0;
-      *val = final_val;
-    }
-  else
+int
+fiid_obj_get_idx (fiid_obj_t obj,
+                  unsigned int index,
+                  uint64_t *val)
+{
+  if (!obj || obj->magic != FIID_OBJ_MAGIC)
+    return (-1);
+
+  if (!val)
     {
-      if (bits_extract (obj->data[byte_pos],
-                        start_bit_in_byte_pos,
-                        end_bit_in_byte_pos,
-                        &merged_val) < 0)
-        {
-          obj->errnum = FIID_ERR_INTERNAL_ERROR;
-          return (-1);
-        }
+      obj->errnum = FIID_ERR_PARAMETERS;
+      return (-1);
+    }
 
-      *val = 0;
-      *val = merged_val;
+  if (index >= (obj->field_data_len - 1))
+    {
+      obj->errnum = FIID_ERR_FIELD_NOT_FOUND;
+      return (-1);
     }
 
-  obj->errnum = FIID_ERR_SUCCESS;
-  return (1);
+  return (_fiid_obj_get (obj, index, val));
 }
 
 int
@@ -2109,6 +2878,27 @@ FIID_OBJ_GET (fiid_obj_t obj,
   return (ret);
 }
 
+int
+FIID_OBJ_GET_IDX (fiid_obj_t obj,
+                  unsigned int index,
+                  uint64_t *val)
+{
+  uint64_t lval;
+  int ret;
+
+  if ((ret = fiid_obj_get_idx (obj, index, &lval)) < 0)
+    return (ret);
+
+  if (!ret)
+    {
+      obj->errnum = FIID_ERR_DATA_NOT_AVAILABLE;
+      return (-1);
+    }
+
+  *val = lval;
+  return (ret);
+}
+
 int
 fiid_obj_set_data (fiid_obj_t obj,
                    const char *field,
@@ -2121,6 +2911,12 @@ fiid_obj_set_data (fiid_obj_t obj,
   if (!obj || obj->magic != FIID_OBJ_MAGIC)
     return (-1);
 
+  if (obj->view)
+    {
+      obj->errnum = FIID_ERR_OBJ_READ_ONLY;
+      return (-1);
+    }
+
   if (!field || !data)
     {
       obj->errnum = FIID_ERR_PARAMETERS;
@@ -2158,7 +2954,7 @@ fiid_obj_set_data (fiid_obj_t obj,
 
   field_offset = BITS_ROUND_BYTES (field_start);
   memcpy ((obj->data + field_offset), data, data_len);
-  obj->field_data[key_index].set_field_len = (data_len * 8);
+  obj->set_field_len[key_index] = (data_len * 8);
 
   obj->errnum = FIID_ERR_SUCCESS;
   return (data_len);
@@ -2185,7 +2981,7 @@ fiid_obj_get_data (fiid_obj_t obj,
   if (_fiid_obj_lookup_field_index (obj, field, &key_index) < 0)
     return (-1);
 
-  if (!obj->field_data[key_index].set_field_len)
+  if (!obj->set_field_len[key_index])
     return (0);
 
   /* achu: We assume the field must start on a byte boundary and end
@@ -2204,8 +3000,8 @@ fiid_obj_get_data (fiid_obj_t obj,
   if ((bits_len = _fiid_obj_field_len (obj, field)) < 0)
     return (-1);
 
-  if (obj->field_data[key_index].set_field_len < bits_len)
-    bits_len = obj->field_data[key_index].set_field_len;
+  if (obj->set_field_len[key_index] < bits_len)
+    bits_len = obj->set_field_len[key_index];
 
   if (bits_len % 8)
     {
@@ -2234,13 +3030,15 @@ fiid_obj_set_all (fiid_obj_t obj,
                   const void *data,
                   unsigned int data_len)
 {
-  unsigned int bits_counter, data_bits_len;
-  unsigned int key_index_end;
-  unsigned int i;
-
   if (!obj || obj->magic != FIID_OBJ_MAGIC)
     return (-1);
 
+  if (obj->view)
+    {
+      obj->errnum = FIID_ERR_OBJ_READ_ONLY;
+      return (-1);
+    }
+
   if (!data)
     {
       obj->errnum = FIID_ERR_PARAMETERS;
@@ -2250,50 +3048,11 @@ fiid_obj_set_all (fiid_obj_t obj,
   if (data_len > obj->data_len)
     data_len = obj->data_len;
 
-  /* achu: Find index of last field */
-  data_bits_len = data_len * 8;
-  if (data_len < obj->data_len)
-    {
-      /* integer overflow conditions checked during object creation */
-      bits_counter = 0;
-      for (i = 0; obj->field_data[i].max_field_len; i++)
-        {
-          bits_counter += obj->field_data[i].max_field_len;
-          if (bits_counter >= data_bits_len)
-            {
-              /* achu: We assume the data must end on a byte boundary. */
-              if (bits_counter % 8)
-                {
-                  obj->errnum = FIID_ERR_DATA_NOT_BYTE_ALIGNED;
-                  return (-1);
-                }
-              else
-                break;
-            }
-
-        }
-      key_index_end = i;
-    }
-  else
-    key_index_end = (obj->field_data_len - 1);
+  if (_fiid_obj_set_all_field_len (obj, data_len) < 0)
+    return (-1);
 
   memcpy (obj->data, data, data_len);
 
-  /* integer overflow conditions checked during object creation */
-  bits_counter = 0;
-  for (i = 0; i < key_index_end; i++)
-    {
-      obj->field_data[i].set_field_len = obj->field_data[i].max_field_len;
-      bits_counter += obj->field_data[i].set_field_len;
-    }
-  if (data_bits_len < bits_counter + obj->field_data[key_index_end].max_field_len)
-    {
-      int data_bits_left = data_bits_len - bits_counter;
-      obj->field_data[i].set_field_len = data_bits_left;
-    }
-  else
-    obj->field_data[i].set_field_len = obj->field_data[i].max_field_len;
-
   obj->errnum = FIID_ERR_SUCCESS;
   return (data_len);
 }
@@ -2341,7 +3100,7 @@ fiid_obj_get_all (fiid_obj_t obj,
       for (i = 0; i < obj->field_data_len; i++)
         {
           unsigned int max_field_len = obj->field_data[i].max_field_len;
-          unsigned int set_field_len = obj->field_data[i].set_field_len;
+          unsigned int set_field_len = obj->set_field_len[i];
 
           max_bits_counter += max_field_len;
 
@@ -2477,6 +3236,12 @@ fiid_obj_set_block (fiid_obj_t obj,
   if (!obj || obj->magic != FIID_OBJ_MAGIC)
     return (-1);
 
+  if (obj->view)
+    {
+      obj->errnum = FIID_ERR_OBJ_READ_ONLY;
+      return (-1);
+    }
+
   if (!field_start || !field_end || !data)
     {
       obj->errnum = FIID_ERR_PARAMETERS;
@@ -2557,16 +3322,16 @@ fiid_obj_set_block (fiid_obj_t obj,
   bits_counter = 0;
   for (i = key_index_start; i < key_index_end; i++)
     {
-      obj->field_data[i].set_field_len = obj->field_data[i].max_field_len;
-      bits_counter += obj->field_data[i].set_field_len;
+      obj->set_field_len[i] = obj->field_data[i].max_field_len;
+      bits_counter += obj->set_field_len[i];
     }
   if (data_bits_len < bits_counter + obj->field_data[key_index_end].max_field_len)
     {
       int data_bits_left = data_bits_len - bits_counter;
-      obj->field_data[i].set_field_len = data_bits_left;
+      obj->set_field_len[i] = data_bits_left;
     }
   else
-    obj->field_data[i].set_field_len = obj->field_data[i].max_field_len;
+    obj->set_field_len[i] = obj->field_data[i].max_field_len;
 
   obj->errnum = FIID_ERR_SUCCESS;
   return (data_len);
@@ -2660,7 +3425,7 @@ fiid_obj_get_block (fiid_obj_t obj,
       for (i = key_index_start; i <= key_index_end; i++)
         {
           unsigned int max_field_len = obj->field_data[i].max_field_len;
-          unsigned int set_field_len = obj->field_data[i].set_field_len;
+          unsigned int set_field_len = obj->set_field_len[i];
 
           max_bits_counter += max_field_len;
 
@@ -2866,7 +3631,7 @@ fiid_iterator_field_len (fiid_iterator_t iter)
 
   iter->errnum = FIID_ERR_SUCCESS;
   /* integer overflow conditions checked during object creation */
-  return (iter->obj->field_data[iter->current_index].set_field_len);
+  return (iter->obj->set_field_len[iter->current_index]);
 }
 
 char *
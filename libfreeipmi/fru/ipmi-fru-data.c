@@ -741,20 +741,14 @@ ipmi_fru_multirecord_power_supply_information (ipmi_fru_ctx_t ctx,
       goto cleanup;
     }
 
-  if (!(obj_record = fiid_obj_create (tmpl_fru_power_supply_information)))
+  if (!(obj_record = fiid_obj_view_create (tmpl_fru_power_supply_information,
+                                           areabuf,
+                                           areabuflen)))
     {
       FRU_ERRNO_TO_FRU_ERRNUM (ctx, errno);
       goto cleanup;
     }
 
-  if (fiid_obj_set_all (obj_record,
-                        areabuf,
-                        areabuflen) < 0)
-    {
-      FRU_FIID_OBJECT_ERROR_TO_FRU_ERRNUM (ctx, obj_record);
-      goto cleanup;
-    }
-
   if (fru_dump_obj (ctx,
                     obj_record,
                     "FRU Power Supply Information") < 0)
@@ -1051,20 +1045,14 @@ ipmi_fru_multirecord_dc_output (ipmi_fru_ctx_t ctx,
       goto cleanup;
     }
 
-  if (!(obj_record = fiid_obj_create (tmpl_fru_dc_output)))
+  if (!(obj_record = fiid_obj_view_create (tmpl_fru_dc_output,
+                                           areabuf,
+                                           areabuflen)))
     {
       FRU_ERRNO_TO_FRU_ERRNUM (ctx, errno);
       goto cleanup;
     }
 
-  if (fiid_obj_set_all (obj_record,
-                        areabuf,
-                        areabuflen) < 0)
-    {
-      FRU_FIID_OBJECT_ERROR_TO_FRU_ERRNUM (ctx, obj_record);
-      goto cleanup;
-    }
-
   if (fru_dump_obj (ctx,
                     obj_record,
                     "FRU DC Output") < 0)
@@ -1206,20 +1194,14 @@ ipmi_fru_multirecord_dc_load (ipmi_fru_ctx_t ctx,
       goto cleanup;
     }
 
-  if (!(obj_record = fiid_obj_create (tmpl_fru_dc_load)))
+  if (!(obj_record = fiid_obj_view_create (tmpl_fru_dc_load,
+                                           areabuf,
+                                           areabuflen)))
     {
       FRU_ERRNO_TO_FRU_ERRNUM (ctx, errno);
       goto cleanup;
     }
 
-  if (fiid_obj_set_all (obj_record,
-                        areabuf,
-                        areabuflen) < 0)
-    {
-      FRU_FIID_OBJECT_ERROR_TO_FRU_ERRNUM (ctx, obj_record);
-      goto cleanup;
-    }
-
   if (fru_dump_obj (ctx,
                     obj_record,
                     "FRU DC Load") < 0)
@@ -1346,20 +1328,14 @@ ipmi_fru_multirecord_management_access_record (ipmi_fru_ctx_t ctx,
       goto cleanup;
     }
 
-  if (!(obj_record = fiid_obj_create (tmpl_fru_management_access_record)))
+  if (!(obj_record = fiid_obj_view_create (tmpl_fru_management_access_record,
+                                           areabuf,
+                                           areabuflen)))
     {
       FRU_ERRNO_TO_FRU_ERRNUM (ctx, errno);
       goto cleanup;
     }
 
-  if (fiid_obj_set_all (obj_record,
-                        areabuf,
-                        areabuflen) < 0)
-    {
-      FRU_FIID_OBJECT_ERROR_TO_FRU_ERRNUM (ctx, obj_record);
-      goto cleanup;
-    }
-
   if (fru_dump_obj (ctx,
                     obj_record,
                     "FRU Management Access Record") < 0)
@@ -1439,20 +1415,14 @@ ipmi_fru_multirecord_base_compatibility_record (ipmi_fru_ctx_t ctx,
       goto cleanup;
     }
 
-  if (!(obj_record = fiid_obj_create (tmpl_fru_base_compatibility_record)))
+  if (!(obj_record = fiid_obj_view_create (tmpl_fru_base_compatibility_record,
+                                           areabuf,
+                                           areabuflen)))
     {
       FRU_ERRNO_TO_FRU_ERRNUM (ctx, errno);
       goto cleanup;
     }
 
-  if (fiid_obj_set_all (obj_record,
-                        areabuf,
-                        areabuflen) < 0)
-    {
-      FRU_FIID_OBJECT_ERROR_TO_FRU_ERRNUM (ctx, obj_record);
-      goto cleanup;
-    }
-
   if (fru_dump_obj (ctx,
                     obj_record,
                     "FRU Base Compatibility Record") < 0)
@@ -1568,20 +1538,14 @@ ipmi_fru_multirecord_extended_compatibility_record (ipmi_fru_ctx_t ctx,
       goto cleanup;
     }
 
-  if (!(obj_record = fiid_obj_create (tmpl_fru_extended_compatibility_record)))
+  if (!(obj_record = fiid_obj_view_create (tmpl_fru_extended_compatibility_record,
+                                           areabuf,
+                                           areabuflen)))
     {
       FRU_ERRNO_TO_FRU_ERRNUM (ctx, errno);
       goto cleanup;
     }
 
-  if (fiid_obj_set_all (obj_record,
-                        areabuf,
-                        areabuflen) < 0)
-    {
-      FRU_FIID_OBJECT_ERROR_TO_FRU_ERRNUM (ctx, obj_record);
-      goto cleanup;
-    }
-
   if (fru_dump_obj (ctx,
                     obj_record,
                     "FRU Extended Compatibility Record") < 0)
@@ -1701,20 +1665,14 @@ ipmi_fru_multirecord_extended_dc_output (ipmi_fru_ctx_t ctx,
       goto cleanup;
     }
 
-  if (!(obj_record = fiid_obj_create (tmpl_fru_extended_dc_output)))
+  if (!(obj_record = fiid_obj_view_create (tmpl_fru_extended_dc_output,
+                                           areabuf,
+                                           areabuflen)))
     {
       FRU_ERRNO_TO_FRU_ERRNUM (ctx, errno);
       goto cleanup;
     }
 
-  if (fiid_obj_set_all (obj_record,
-                        areabuf,
-                        areabuflen) < 0)
-    {
-      FRU_FIID_OBJECT_ERROR_TO_FRU_ERRNUM (ctx, obj_record);
-      goto cleanup;
-    }
-
   if (fru_dump_obj (ctx,
                     obj_record,
                     "FRU Extended DC Output") < 0)
@@ -1877,20 +1835,14 @@ ipmi_fru_multirecord_extended_dc_load (ipmi_fru_ctx_t ctx,
       goto cleanup;
     }
 
-  if (!(obj_record = fiid_obj_create (tmpl_fru_extended_dc_load)))
+  if (!(obj_record = fiid_obj_view_create (tmpl_fru_extended_dc_load,
+                                           areabuf,
+                                           areabuflen)))
     {
       FRU_ERRNO_TO_FRU_ERRNUM (ctx, errno);
       goto cleanup;
     }
 
-  if (fiid_obj_set_all (obj_record,
-                        areabuf,
-                        areabuflen) < 0)
-    {
-      FRU_FIID_OBJECT_ERROR_TO_FRU_ERRNUM (ctx, obj_record);
-      goto cleanup;
-    }
-
   if (fru_dump_obj (ctx,
                     obj_record,
                     "FRU Extended DC Load") < 0)
@@ -2035,20 +1987,14 @@ ipmi_fru_multirecord_oem_record (ipmi_fru_ctx_t ctx,
       goto cleanup;
     }
 
-  if (!(obj_record = fiid_obj_create (tmpl_fru_oem_record)))
+  if (!(obj_record = fiid_obj_view_create (tmpl_fru_oem_record,
+                                           areabuf,
+                                           areabuflen)))
     {
       FRU_ERRNO_TO_FRU_ERRNUM (ctx, errno);
       goto cleanup;
     }
 
-  if (fiid_obj_set_all (obj_record,
-                        areabuf,
-                        areabuflen) < 0)
-    {
-      FRU_FIID_OBJECT_ERROR_TO_FRU_ERRNUM (ctx, obj_record);
-      goto cleanup;
-    }
-
   if (fru_dump_obj (ctx,
                     obj_record,
                     "FRU OEM Record") < 0)
@@ -654,20 +654,14 @@ _ipmi_fru_open_device_id_common (ipmi_fru_ctx_t ctx,
           goto cleanup;
         }
 
-      if (!(fru_common_header = fiid_obj_create (tmpl_fru_common_header)))
+      if (!(fru_common_header = fiid_obj_view_create (tmpl_fru_common_header,
+                                                      frubuf,
+                                                      common_header_len)))
         {
           FRU_ERRNO_TO_FRU_ERRNUM (ctx, errno);
           goto cleanup;
         }
 
-      if (fiid_obj_set_all (fru_common_header,
-                            frubuf,
-                            common_header_len) < 0)
-        {
-          FRU_FIID_OBJECT_ERROR_TO_FRU_ERRNUM (ctx, fru_common_header);
-          goto cleanup;
-        }
-
       if (fru_dump_obj (ctx,
                         fru_common_header,
                         "Common Header") < 0)
@@ -890,20 +884,14 @@ _parse_multirecord_header (ipmi_fru_ctx_t ctx,
       goto cleanup;
     }
 
-  if (!(fru_multirecord_header = fiid_obj_create (tmpl_fru_multirecord_area_header)))
+  if (!(fru_multirecord_header = fiid_obj_view_create (tmpl_fru_multirecord_area_header,
+                                                       frubuf,
+                                                       multirecord_header_length)))
     {
       FRU_ERRNO_TO_FRU_ERRNUM (ctx, errno);
       goto cleanup;
     }
 
-  if (fiid_obj_set_all (fru_multirecord_header,
-                        frubuf,
-                        multirecord_header_length) < 0)
-    {
-      FRU_FIID_OBJECT_ERROR_TO_FRU_ERRNUM (ctx, fru_multirecord_header);
-      goto cleanup;
-    }
-
   if (fru_dump_obj (ctx,
                     fru_multirecord_header,
                     "MultiRecord Header") < 0)
@@ -1133,20 +1121,14 @@ _read_info_area_data (ipmi_fru_ctx_t ctx,
                       info_area_header_length) < 0)
     goto cleanup;
 
-  if (!(fru_info_area_header = fiid_obj_create (tmpl_fru_info_area_header)))
+  if (!(fru_info_area_header = fiid_obj_view_create (tmpl_fru_info_area_header,
+                                                     frubuf,
+                                                     info_area_header_length)))
     {
       FRU_ERRNO_TO_FRU_ERRNUM (ctx, errno);
       goto cleanup;
     }
 
-  if (fiid_obj_set_all (fru_info_area_header,
-                        frubuf,
-                        info_area_header_length) < 0)
-    {
-      FRU_FIID_OBJECT_ERROR_TO_FRU_ERRNUM (ctx, fru_info_area_header);
-      goto cleanup;
-    }
-
   if (fru_dump_obj (ctx,
                     fru_info_area_header,
                     headerhdrstr) < 0)
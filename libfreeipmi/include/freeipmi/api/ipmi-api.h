@@ -158,6 +158,8 @@ enum ipmi_driver_type
   IPMI_DEVICE_OPENIPMI = 7,
   IPMI_DEVICE_SUNBMC = 8,
   IPMI_DEVICE_INTELDCMI = 9,
+  IPMI_DEVICE_MOCK = 10,
+  IPMI_DEVICE_BROKER = 11,
 };
 typedef enum ipmi_driver_type ipmi_driver_type_t;
 
@@ -251,6 +253,186 @@ int ipmi_ctx_get_flags (ipmi_ctx_t ctx, unsigned int *flags);
 /* for changing flags mid-operation for corner cases */
 int ipmi_ctx_set_flags (ipmi_ctx_t ctx, unsigned int flags);
 
+/* Adaptive retransmission
+ *
+ * The round trip time of outofband sessions is estimated from the
+ * responses to requests that were not retransmitted.  With bounds
+ * set through ipmi_ctx_set_retransmission_bounds(), the
+ * retransmission timeout follows the estimate instead of staying at
+ * the retransmission timeout passed to ipmi_ctx_open_outofband(),
+ * which is only used until the first response.  The timeout is kept
+ * between timeout_floor and timeout_ceiling, in milliseconds, and
+ * still backs off on retransmissions.  Specify 0 for both to disable adaptive
+ * retransmission, the default.  Bounds may be changed at any time.
+ */
+int ipmi_ctx_get_retransmission_bounds (ipmi_ctx_t ctx,
+                                        unsigned int *timeout_floor,
+                                        unsigned int *timeout_ceiling);
+
+int ipmi_ctx_set_retransmission_bounds (ipmi_ctx_t ctx,
+                                        unsigned int timeout_floor,
+                                        unsigned int timeout_ceiling);
+
+/* smoothed round trip time and its variance of the outofband
+ * session, in microseconds.  Returns 1 if measured, 0 if no response
+ * was measured yet, -1 on error.
+ */
+int ipmi_ctx_get_rtt (ipmi_ctx_t ctx,
+                      unsigned int *srtt,
+                      unsigned int *rttvar);
+
+/* Command statistics
+ *
+ * Every context counts the requests it sends per IPMI network
+ * function and command, along with retransmissions, timeouts,
+ * responses with a completion code other than success, and the
+ * latency from sending a request until its response is received,
+ * retransmissions included.  The exchanges of outofband session setup are
+ * counted separately per phase; their errors are responses the
+ * session setup rejected.
+ *
+ * Latencies are counted in IPMI_STATS_LATENCY_BUCKETS logarithmic
+ * buckets.  Bucket 0 counts latencies below 1 millisecond, bucket i
+ * latencies from 2^(i-1) up to 2^i milliseconds, and the last bucket
+ * all longer ones.
+ *
+ * Commands beyond IPMI_STATS_CMDS_MAX distinct network function and
+ * command pairs are counted together in 'other'.  Statistics
+ * accumulate over the life of the context, including across
+ * sessions, until cleared with ipmi_ctx_clear_stats().  Statistics
+ * cannot be cleared while asynchronous operations are outstanding.
+ */
+#define IPMI_STATS_LATENCY_BUCKETS                             16
+
+#define IPMI_STATS_SESSION_SETUP_AUTHENTICATION_CAPABILITIES   0
+#define IPMI_STATS_SESSION_SETUP_GET_SESSION_CHALLENGE         1
+#define IPMI_STATS_SESSION_SETUP_ACTIVATE_SESSION              2
+#define IPMI_STATS_SESSION_SETUP_OPEN_SESSION                  3
+#define IPMI_STATS_SESSION_SETUP_RAKP_MESSAGE_1                4
+#define IPMI_STATS_SESSION_SETUP_RAKP_MESSAGE_3                5
+#define IPMI_STATS_SESSION_SETUP_SET_SESSION_PRIVILEGE_LEVEL   6
+#define IPMI_STATS_SESSION_SETUP_PHASES                        7
+
+#define IPMI_STATS_CMDS_MAX                                    64
+
+struct ipmi_stats_counters
+{
+  unsigned int requests;
+  unsigned int retransmissions;
+  unsigned int timeouts;
+  unsigned int errors;
+  /* latencies in microseconds */
+  uint64_t latency_total;
+  unsigned int latency_max;
+  unsigned int latency[IPMI_STATS_LATENCY_BUCKETS];
+};
+
+struct ipmi_stats_cmd
+{
+  uint8_t net_fn;
+  uint8_t cmd;
+  struct ipmi_stats_counters counters;
+};
+
+struct ipmi_stats
+{
+  struct ipmi_stats_counters session_setup[IPMI_STATS_SESSION_SETUP_PHASES];
+  struct ipmi_stats_cmd cmds[IPMI_STATS_CMDS_MAX];
+  unsigned int cmds_count;
+  struct ipmi_stats_counters other;
+};
+
+int ipmi_ctx_get_stats (ipmi_ctx_t ctx, struct ipmi_stats *stats);
+
+int ipmi_ctx_clear_stats (ipmi_ctx_t ctx);
+
+/* Packet trace
+ *
+ * With a trace buffer size set through ipmi_ctx_set_pkt_trace(),
+ * every packet the context sends to or receives from the BMC is
+ * copied, raw and with a timestamp, into a ring buffer of that many
+ * bytes, overwriting the oldest packets once it is full.  Unlike
+ * IPMI_FLAGS_DEBUG_DUMP nothing is formatted while packets are
+ * traced, so tracing may be left on in production.  Inband packets
+ * are traced in KCS format, network function/lun byte first.
+ *
+ * ipmi_ctx_write_pkt_trace() writes the traced packets, oldest
+ * first, to a file descriptor in pcap format.  Outofband packets are
+ * prefixed with IP and UDP headers (link type 101, raw IP), so
+ * packet analyzers decode them as RMCP.  Inband packets are prefixed
+ * with one byte, 0 for requests and 1 for responses (link type 147,
+ * user 0).  If the buffer holds packets of both kinds, only those of
+ * the kind traced last are written.
+ *
+ * ipmi_ctx_write_pkt_trace() only calls write(2) and may be called
+ * from a signal handler, e.g. to write out the packets preceding a
+ * timeout on demand.  A packet being traced at the moment the signal
+ * arrives is not written.
+ *
+ * Specify a size of 0 to disable tracing, the default.  Sizes below
+ * IPMI_PKT_TRACE_SIZE_MIN are invalid, other sizes are rounded down
+ * to a power of two.  Changing the size discards the packets traced
+ * so far.  The ipmi-trace program of the FreeIPMI source tree
+ * formats written traces with the ipmi-debug dump functions.
+ */
+#define IPMI_PKT_TRACE_SIZE_MIN                                4096
+#define IPMI_PKT_TRACE_SIZE_DEFAULT                            1048576
+
+int ipmi_ctx_set_pkt_trace (ipmi_ctx_t ctx, unsigned int size);
+
+int ipmi_ctx_write_pkt_trace (ipmi_ctx_t ctx, int fd);
+
+/* Outofband session multiplexer
+ *
+ * By default every outofband session opens its own UDP socket.
+ * Contexts attached to a multiplexer with ipmi_ctx_set_mux() before
+ * they are opened instead share a small pool of sockets, and inbound
+ * packets are handed to the right context by the BMC address they
+ * come from.  A socket of the pool carries at most one session per
+ * BMC address, so sessions to the same BMC are spread over
+ * different sockets.
+ *
+ * 'sockets' is the number of sockets per address family sessions are
+ * spread over, specify 0 for the default.  Further sockets are only
+ * opened when several sessions talk to the same BMC.
+ *
+ * Contexts attached to the same multiplexer may be used concurrently
+ * from different threads.  ipmi_mux_destroy() may be called while
+ * contexts are still attached, the sockets are closed once the last
+ * of them is detached or destroyed.
+ */
+#define IPMI_MUX_SOCKETS_DEFAULT 1
+
+typedef struct ipmi_mux *ipmi_mux_t;
+
+/* returns NULL on error, errno set */
+ipmi_mux_t ipmi_mux_create (unsigned int sockets);
+
+void ipmi_mux_destroy (ipmi_mux_t mux);
+
+/* context must not be open, NULL detaches the context */
+int ipmi_ctx_set_mux (ipmi_ctx_t ctx, ipmi_mux_t mux);
+
+/* Outofband session negotiation cache
+ *
+ * With a cache directory set through ipmi_ctx_set_session_cache(),
+ * the authentication capabilities a BMC reported when a session was
+ * last established are recorded in a small per-host file of the
+ * directory.  Later opens of a session with the same configuration
+ * (username, password and K_g presence, authentication type or
+ * cipher suite id, privilege level and workaround flags) skip the
+ * Get Channel Authentication Capabilities round trip.  If the BMC
+ * rejects a session started from the cache, the record is removed
+ * and the session is negotiated from the start, so a stale record
+ * costs a round trip but never fails an open.  A BMC that does not
+ * respond at all is not retried.
+ *
+ * The directory must exist and be writable, it is not created.
+ * Specify NULL to disable the cache, the default.  The context must
+ * not be open.
+ */
+int ipmi_ctx_set_session_cache (ipmi_ctx_t ctx, const char *directory);
+
 /* For IPMI 1.5 sessions */
 /* For session_timeout and retransmission_timeout, specify 0 for default */
 int ipmi_ctx_open_outofband (ipmi_ctx_t ctx,
@@ -289,6 +471,16 @@ int ipmi_ctx_open_inband (ipmi_ctx_t ctx,
                           unsigned int workaround_flags,
                           unsigned int flags);
 
+/* Open ctx on the inband driver already opened by 'shared_ctx'
+ * rather than opening the device again.  Only supported for
+ * IPMI_DEVICE_OPENIPMI, whose driver matches responses to requests.
+ * Contexts sharing a driver may be used concurrently from different
+ * threads, one thread per context, with a request of each
+ * outstanding at once.  'shared_ctx' must not be closed before the
+ * contexts opened on it.
+ */
+int ipmi_ctx_open_inband_shared (ipmi_ctx_t ctx, ipmi_ctx_t shared_ctx);
+
 /* like ipmi_ctx_open_inband, but finds probes/discovers an inband device */
 /* returns 1 on driver found, 0 on not found, -1 on error */
 /* if specified, driver type returned in 'driver_type' */
@@ -364,6 +556,104 @@ int ipmi_cmd_raw_ipmb (ipmi_ctx_t ctx,
                        void *buf_rs,
                        unsigned int buf_rs_len);
 
+/* Asynchronous interface for outofband (IPMI 1.5 and IPMI 2.0)
+ * sessions.
+ *
+ * Instead of blocking in ipmi_ctx_open_outofband() or ipmi_cmd(),
+ * the asynchronous variants below send the first packet and return
+ * immediately.  The caller then waits for the descriptor returned by
+ * ipmi_ctx_get_fd() to become readable (POLLIN) for at most the time
+ * returned by ipmi_ctx_async_timeout(), and calls
+ * ipmi_ctx_async_process() with the returned events (0 on timeout).
+ * Retransmissions and session timeouts are handled within
+ * ipmi_ctx_async_process().
+ *
+ * When the operation completes, the callback is called with 0 on
+ * success or -1 on error, in which case ipmi_ctx_errnum() returns
+ * the reason.  A failed asynchronous open leaves the context closed.
+ * The callback may start another asynchronous operation, or close
+ * or destroy the context.
+ *
+ * While a session is being opened, or while commands are outstanding,
+ * no blocking command may be issued.  By default one asynchronous
+ * command may be outstanding per context.  ipmi_ctx_set_async_window()
+ * allows up to IPMI_ASYNC_WINDOW_MAX commands in flight at once on
+ * the session, responses are matched to their requests by requester
+ * sequence number and may arrive in any order.  Each callback is
+ * called from a separate ipmi_ctx_async_process() call.  The
+ * descriptor may change during IPMI 1.5 session establishment, so it
+ * should be read again after every call to ipmi_ctx_async_process().
+ * Bridged (ipmb) commands are not supported.  ipmi_ctx_close() is
+ * blocking; it discards outstanding asynchronous operations without
+ * calling their callbacks.
+ */
+typedef void (*Ipmi_Ctx_Async_Callback)(ipmi_ctx_t ctx,
+                                        int rv,
+                                        void *callback_data);
+
+#define IPMI_ASYNC_WINDOW_DEFAULT 1
+#define IPMI_ASYNC_WINDOW_MAX     8
+
+int ipmi_ctx_get_async_window (ipmi_ctx_t ctx, unsigned int *window);
+
+/* lowering the window only limits new submissions */
+int ipmi_ctx_set_async_window (ipmi_ctx_t ctx, unsigned int window);
+
+int ipmi_ctx_open_outofband_async (ipmi_ctx_t ctx,
+                                   const char *hostname,
+                                   const char *username,
+                                   const char *password,
+                                   uint8_t authentication_type,
+                                   uint8_t privilege_level,
+                                   unsigned int session_timeout,
+                                   unsigned int retransmission_timeout,
+                                   unsigned int workaround_flags,
+                                   unsigned int flags,
+                                   Ipmi_Ctx_Async_Callback callback,
+                                   void *callback_data);
+
+int ipmi_ctx_open_outofband_2_0_async (ipmi_ctx_t ctx,
+                                       const char *hostname,
+                                       const char *username,
+                                       const char *password,
+                                       const unsigned char *k_g,
+                                       unsigned int k_g_len,
+                                       uint8_t privilege_level,
+                                       uint8_t cipher_suite_id,
+                                       unsigned int session_timeout,
+                                       unsigned int retransmission_timeout,
+                                       unsigned int workaround_flags,
+                                       unsigned int flags,
+                                       Ipmi_Ctx_Async_Callback callback,
+                                       void *callback_data);
+
+/* obj_cmd_rq and obj_cmd_rs must remain valid until the callback */
+int ipmi_cmd_async (ipmi_ctx_t ctx,
+                    uint8_t lun,
+                    uint8_t net_fn,
+                    fiid_obj_t obj_cmd_rq,
+                    fiid_obj_t obj_cmd_rs,
+                    Ipmi_Ctx_Async_Callback callback,
+                    void *callback_data);
+
+/* returns descriptor of outofband session, -1 on error */
+int ipmi_ctx_get_fd (ipmi_ctx_t ctx);
+
+/* timeout returned in milliseconds, -1 if no operation outstanding */
+int ipmi_ctx_async_timeout (ipmi_ctx_t ctx, int *timeout);
+
+/* returns 0 on success, -1 on error.  Errors of the outstanding
+ * operation are reported through its callback, not here.
+ */
+int ipmi_ctx_async_process (ipmi_ctx_t ctx, short revents);
+
+/* blocks until no asynchronous operation is outstanding, callbacks
+ * are called as in ipmi_ctx_async_process().  Returns 0 on success,
+ * -1 on error.  Must not be called from within a callback, and
+ * callbacks called from it must not destroy the context.
+ */
+int ipmi_ctx_async_wait (ipmi_ctx_t ctx);
+
 int ipmi_ctx_close (ipmi_ctx_t ctx);
 
 void ipmi_ctx_destroy (ipmi_ctx_t ctx);
@@ -0,0 +1,109 @@
+/*
+ * Copyright (C) 2003-2015 FreeIPMI Core Team
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef IPMI_BROKER_DRIVER_H
+#define IPMI_BROKER_DRIVER_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <freeipmi/fiid/fiid.h>
+
+/* The broker driver sends in-band requests to a local broker, such
+ * as ipmibrokerd, which owns the system interface and serializes
+ * the requests of all its clients.  The driver device is the Unix
+ * domain socket (SOCK_SEQPACKET) the broker listens on.
+ *
+ * Every request is sent as one message of an IPMI_BROKER_HDR_LEN
+ * byte header followed by the command and its data.  The header
+ * holds the target (IPMI_BROKER_TARGET_BMC or
+ * IPMI_BROKER_TARGET_IPMB), the channel number and slave address of
+ * IPMB targets, and the KCS format net_fn/lun byte.  The broker
+ * answers with one message holding the net_fn/lun byte, command,
+ * completion code and data of the response.  Errors of the broker
+ * talking to the BMC are reported through the completion code.
+ */
+
+#define IPMI_BROKER_DRIVER_DEVICE_DEFAULT    "/var/run/ipmibrokerd.sock"
+
+#define IPMI_BROKER_HDR_LEN                  4
+#define IPMI_BROKER_HDR_TARGET_INDEX         0
+#define IPMI_BROKER_HDR_CHANNEL_INDEX        1
+#define IPMI_BROKER_HDR_RS_ADDR_INDEX        2
+#define IPMI_BROKER_HDR_NET_FN_LUN_INDEX     3
+
+#define IPMI_BROKER_TARGET_BMC               0x00
+#define IPMI_BROKER_TARGET_IPMB              0x01
+
+#define IPMI_BROKER_NET_FN_SHIFT             2
+#define IPMI_BROKER_LUN_MASK                 0x03
+
+#define IPMI_BROKER_PKT_LEN_MAX              1024
+
+#define IPMI_BROKER_ERR_SUCCESS               0
+#define IPMI_BROKER_ERR_NULL                  1
+#define IPMI_BROKER_ERR_INVALID               2
+#define IPMI_BROKER_ERR_PARAMETERS            3
+#define IPMI_BROKER_ERR_PERMISSION            4
+#define IPMI_BROKER_ERR_DEVICE_NOT_FOUND      5
+#define IPMI_BROKER_ERR_IO_NOT_INITIALIZED    6
+#define IPMI_BROKER_ERR_OUT_OF_MEMORY         7
+#define IPMI_BROKER_ERR_DRIVER_TIMEOUT        8
+#define IPMI_BROKER_ERR_SYSTEM_ERROR          9
+#define IPMI_BROKER_ERR_INTERNAL_ERROR       10
+#define IPMI_BROKER_ERR_ERRNUMRANGE          11
+
+#define IPMI_BROKER_FLAGS_DEFAULT            0x00000000
+
+typedef struct ipmi_broker_ctx *ipmi_broker_ctx_t;
+
+ipmi_broker_ctx_t ipmi_broker_ctx_create (void);
+void ipmi_broker_ctx_destroy (ipmi_broker_ctx_t ctx);
+int ipmi_broker_ctx_errnum (ipmi_broker_ctx_t ctx);
+char *ipmi_broker_ctx_strerror (int errnum);
+char *ipmi_broker_ctx_errormsg (ipmi_broker_ctx_t ctx);
+
+int ipmi_broker_ctx_get_driver_device (ipmi_broker_ctx_t ctx, char **driver_device);
+int ipmi_broker_ctx_get_flags (ipmi_broker_ctx_t ctx, unsigned int *flags);
+
+int ipmi_broker_ctx_set_driver_device (ipmi_broker_ctx_t ctx, const char *driver_device);
+int ipmi_broker_ctx_set_flags (ipmi_broker_ctx_t ctx, unsigned int flags);
+
+int ipmi_broker_ctx_io_init (ipmi_broker_ctx_t ctx);
+
+int ipmi_broker_cmd (ipmi_broker_ctx_t ctx,
+                     uint8_t lun,
+                     uint8_t net_fn,
+                     fiid_obj_t obj_cmd_rq,
+                     fiid_obj_t obj_cmd_rs);
+
+int ipmi_broker_cmd_ipmb (ipmi_broker_ctx_t ctx,
+                          uint8_t channel_number,
+                          uint8_t rs_addr,
+                          uint8_t lun,
+                          uint8_t net_fn,
+                          fiid_obj_t obj_cmd_rq,
+                          fiid_obj_t obj_cmd_rs);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* IPMI_BROKER_DRIVER_H */
@@ -0,0 +1,116 @@
+/*
+ * Copyright (C) 2003-2015 FreeIPMI Core Team
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef IPMI_MOCK_DRIVER_H
+#define IPMI_MOCK_DRIVER_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <freeipmi/fiid/fiid.h>
+
+/* The mock driver serves in-band requests without a BMC, so the
+ * in-band code paths can be exercised and benchmarked on any
+ * machine.  The driver device is required and is either
+ *
+ * - a Unix domain socket (SOCK_SEQPACKET), every request is sent as
+ *   one message holding the KCS format packet (net_fn/lun byte,
+ *   command, data) and the responder answers with one message
+ *   holding the KCS format response (net_fn/lun byte, command,
+ *   completion code, data).  ipmi-sim --inband-socket is such a
+ *   responder.
+ *
+ * - a recorded session, either a packet trace of an in-band session
+ *   as written by ipmi_ctx_write_pkt_trace(), or a text file of
+ *   lines
+ *
+ *     NETFN CMD [DATA ...] : COMP-CODE [DATA ...]
+ *     service-time USECONDS
+ *     service-time NETFN CMD USECONDS
+ *
+ *   with every number in hex, except the service times, and '#'
+ *   starting a comment.
+ *
+ * Requests are answered with the recorded response of an identical
+ * request, otherwise with one of a request of the same net_fn and
+ * command, otherwise with the completion code invalid command.
+ * Identical requests recorded more than once are answered in
+ * recorded order, starting over after the last.
+ *
+ * The service time is the minimum time a command takes.  A time set
+ * for the command with ipmi_mock_ctx_set_service_time() or in the
+ * text file is used first, then the time recorded in a packet trace,
+ * then the default service time.
+ */
+
+#define IPMI_MOCK_ERR_SUCCESS                 0
+#define IPMI_MOCK_ERR_NULL                    1
+#define IPMI_MOCK_ERR_INVALID                 2
+#define IPMI_MOCK_ERR_PARAMETERS              3
+#define IPMI_MOCK_ERR_PERMISSION              4
+#define IPMI_MOCK_ERR_DEVICE_NOT_FOUND        5
+#define IPMI_MOCK_ERR_DRIVER_PATH_REQUIRED    6
+#define IPMI_MOCK_ERR_RECORDING_INVALID       7
+#define IPMI_MOCK_ERR_IO_NOT_INITIALIZED      8
+#define IPMI_MOCK_ERR_OUT_OF_MEMORY           9
+#define IPMI_MOCK_ERR_DRIVER_TIMEOUT         10
+#define IPMI_MOCK_ERR_SYSTEM_ERROR           11
+#define IPMI_MOCK_ERR_INTERNAL_ERROR         12
+#define IPMI_MOCK_ERR_ERRNUMRANGE            13
+
+#define IPMI_MOCK_FLAGS_DEFAULT              0x00000000
+/* respond as fast as possible, ignoring every service time */
+#define IPMI_MOCK_FLAGS_NO_SERVICE_TIME      0x00000001
+
+typedef struct ipmi_mock_ctx *ipmi_mock_ctx_t;
+
+ipmi_mock_ctx_t ipmi_mock_ctx_create (void);
+void ipmi_mock_ctx_destroy (ipmi_mock_ctx_t ctx);
+int ipmi_mock_ctx_errnum (ipmi_mock_ctx_t ctx);
+char *ipmi_mock_ctx_strerror (int errnum);
+char *ipmi_mock_ctx_errormsg (ipmi_mock_ctx_t ctx);
+
+int ipmi_mock_ctx_get_driver_device (ipmi_mock_ctx_t ctx, char **driver_device);
+int ipmi_mock_ctx_get_flags (ipmi_mock_ctx_t ctx, unsigned int *flags);
+int ipmi_mock_ctx_get_default_service_time (ipmi_mock_ctx_t ctx, unsigned int *usec);
+
+int ipmi_mock_ctx_set_driver_device (ipmi_mock_ctx_t ctx, const char *driver_device);
+int ipmi_mock_ctx_set_flags (ipmi_mock_ctx_t ctx, unsigned int flags);
+int ipmi_mock_ctx_set_default_service_time (ipmi_mock_ctx_t ctx, unsigned int usec);
+
+/* service time of one command, overrides the recorded one */
+int ipmi_mock_ctx_set_service_time (ipmi_mock_ctx_t ctx,
+                                    uint8_t net_fn,
+                                    uint8_t cmd,
+                                    unsigned int usec);
+
+int ipmi_mock_ctx_io_init (ipmi_mock_ctx_t ctx);
+
+int ipmi_mock_cmd (ipmi_mock_ctx_t ctx,
+                   uint8_t lun,
+                   uint8_t net_fn,
+                   fiid_obj_t obj_cmd_rq,
+                   fiid_obj_t obj_cmd_rs);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* IPMI_MOCK_DRIVER_H */
@@ -60,6 +60,17 @@ int ipmi_openipmi_ctx_set_flags (ipmi_openipmi_ctx_t ctx, unsigned int flags);
 
 int ipmi_openipmi_ctx_io_init (ipmi_openipmi_ctx_t ctx);
 
+/* After ipmi_openipmi_ctx_io_init(), ipmi_openipmi_cmd() and
+ * ipmi_openipmi_cmd_ipmb() may be called concurrently from multiple
+ * threads on the same context.  Every request is tagged with its own
+ * msgid, so several requests may be outstanding in the kernel at
+ * once and responses are matched to them in whatever order they
+ * complete.  The context settings must not be changed, and the
+ * context not destroyed, while commands are in progress.  With
+ * concurrent callers, ipmi_openipmi_ctx_errnum() reports the result
+ * of the most recent call of any thread.  The _r variants also
+ * return the result of the call itself in errnum.
+ */
 int ipmi_openipmi_cmd (ipmi_openipmi_ctx_t ctx,
                        uint8_t lun,
                        uint8_t net_fn,
@@ -74,6 +85,22 @@ int ipmi_openipmi_cmd_ipmb (ipmi_openipmi_ctx_t ctx,
                             fiid_obj_t obj_cmd_rq,
                             fiid_obj_t obj_cmd_rs);
 
+int ipmi_openipmi_cmd_r (ipmi_openipmi_ctx_t ctx,
+                         uint8_t lun,
+                         uint8_t net_fn,
+                         fiid_obj_t obj_cmd_rq,
+                         fiid_obj_t obj_cmd_rs,
+                         int *errnum);
+
+int ipmi_openipmi_cmd_ipmb_r (ipmi_openipmi_ctx_t ctx,
+                              uint8_t channel_number,
+                              uint8_t rs_addr,
+                              uint8_t lun,
+                              uint8_t net_fn,
+                              fiid_obj_t obj_cmd_rq,
+                              fiid_obj_t obj_cmd_rs,
+                              int *errnum);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,6690 @@
+/*
+ * Copyright (C) 2003-2015 FreeIPMI Core Team
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/* Generated by libfreeipmi/fiid/fiid-field-index.pl, do not edit. */
+
+#ifndef FIID_FIELD_INDEX_H
+#define FIID_FIELD_INDEX_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Field indexes for fiid_obj_get_idx(), fiid_obj_set_idx() and
+ * FIID_OBJ_GET_IDX().  The index of a field is its position within
+ * its template.
+ */
+
+/* tmpl_cmd_reset_watchdog_timer_rq */
+#define TMPL_CMD_RESET_WATCHDOG_TIMER_RQ_CMD 0
+
+/* tmpl_cmd_reset_watchdog_timer_rs */
+#define TMPL_CMD_RESET_WATCHDOG_TIMER_RS_CMD 0
+#define TMPL_CMD_RESET_WATCHDOG_TIMER_RS_COMP_CODE 1
+
+/* tmpl_cmd_set_watchdog_timer_rq */
+#define TMPL_CMD_SET_WATCHDOG_TIMER_RQ_CMD 0
+#define TMPL_CMD_SET_WATCHDOG_TIMER_RQ_TIMER_USE 1
+#define TMPL_CMD_SET_WATCHDOG_TIMER_RQ_RESERVED1 2
+#define TMPL_CMD_SET_WATCHDOG_TIMER_RQ_STOP_TIMER 3
+#define TMPL_CMD_SET_WATCHDOG_TIMER_RQ_LOG 4
+#define TMPL_CMD_SET_WATCHDOG_TIMER_RQ_TIMEOUT_ACTION 5
+#define TMPL_CMD_SET_WATCHDOG_TIMER_RQ_RESERVED2 6
+#define TMPL_CMD_SET_WATCHDOG_TIMER_RQ_PRE_TIMEOUT_INTERRUPT 7
+#define TMPL_CMD_SET_WATCHDOG_TIMER_RQ_RESERVED3 8
+#define TMPL_CMD_SET_WATCHDOG_TIMER_RQ_PRE_TIMEOUT_INTERVAL 9
+#define TMPL_CMD_SET_WATCHDOG_TIMER_RQ_RESERVED4 10
+#define TMPL_CMD_SET_WATCHDOG_TIMER_RQ_TIMER_USE_EXPIRATION_FLAG_BIOS_FRB2 11
+#define TMPL_CMD_SET_WATCHDOG_TIMER_RQ_TIMER_USE_EXPIRATION_FLAG_BIOS_POST 12
+#define TMPL_CMD_SET_WATCHDOG_TIMER_RQ_TIMER_USE_EXPIRATION_FLAG_OS_LOAD 13
+#define TMPL_CMD_SET_WATCHDOG_TIMER_RQ_TIMER_USE_EXPIRATION_FLAG_SMS_OS 14
+#define TMPL_CMD_SET_WATCHDOG_TIMER_RQ_TIMER_USE_EXPIRATION_FLAG_OEM 15
+#define TMPL_CMD_SET_WATCHDOG_TIMER_RQ_RESERVED5 16
+#define TMPL_CMD_SET_WATCHDOG_TIMER_RQ_RESERVED6 17
+#define TMPL_CMD_SET_WATCHDOG_TIMER_RQ_INITIAL_COUNTDOWN_VALUE 18
+
+/* tmpl_cmd_set_watchdog_timer_rs */
+#define TMPL_CMD_SET_WATCHDOG_TIMER_RS_CMD 0
+#define TMPL_CMD_SET_WATCHDOG_TIMER_RS_COMP_CODE 1
+
+/* tmpl_cmd_get_watchdog_timer_rq */
+#define TMPL_CMD_GET_WATCHDOG_TIMER_RQ_CMD 0
+
+/* tmpl_cmd_get_watchdog_timer_rs */
+#define TMPL_CMD_GET_WATCHDOG_TIMER_RS_CMD 0
+#define TMPL_CMD_GET_WATCHDOG_TIMER_RS_COMP_CODE 1
+#define TMPL_CMD_GET_WATCHDOG_TIMER_RS_TIMER_USE 2
+#define TMPL_CMD_GET_WATCHDOG_TIMER_RS_RESERVED1 3
+#define TMPL_CMD_GET_WATCHDOG_TIMER_RS_TIMER_STATE 4
+#define TMPL_CMD_GET_WATCHDOG_TIMER_RS_LOG 5
+#define TMPL_CMD_GET_WATCHDOG_TIMER_RS_TIMEOUT_ACTION 6
+#define TMPL_CMD_GET_WATCHDOG_TIMER_RS_RESERVED2 7
+#define TMPL_CMD_GET_WATCHDOG_TIMER_RS_PRE_TIMEOUT_INTERRUPT 8
+#define TMPL_CMD_GET_WATCHDOG_TIMER_RS_RESERVED3 9
+#define TMPL_CMD_GET_WATCHDOG_TIMER_RS_PRE_TIMEOUT_INTERVAL 10
+#define TMPL_CMD_GET_WATCHDOG_TIMER_RS_RESERVED4 11
+#define TMPL_CMD_GET_WATCHDOG_TIMER_RS_TIMER_USE_EXPIRATION_FLAG_BIOS_FRB2 12
+#define TMPL_CMD_GET_WATCHDOG_TIMER_RS_TIMER_USE_EXPIRATION_FLAG_BIOS_POST 13
+#define TMPL_CMD_GET_WATCHDOG_TIMER_RS_TIMER_USE_EXPIRATION_FLAG_OS_LOAD 14
+#define TMPL_CMD_GET_WATCHDOG_TIMER_RS_TIMER_USE_EXPIRATION_FLAG_SMS_OS 15
+#define TMPL_CMD_GET_WATCHDOG_TIMER_RS_TIMER_USE_EXPIRATION_FLAG_OEM 16
+#define TMPL_CMD_GET_WATCHDOG_TIMER_RS_RESERVED5 17
+#define TMPL_CMD_GET_WATCHDOG_TIMER_RS_RESERVED6 18
+#define TMPL_CMD_GET_WATCHDOG_TIMER_RS_INITIAL_COUNTDOWN_VALUE 19
+#define TMPL_CMD_GET_WATCHDOG_TIMER_RS_PRESENT_COUNTDOWN_VALUE 20
+
+/* tmpl_cmd_get_chassis_capabilities_rq */
+#define TMPL_CMD_GET_CHASSIS_CAPABILITIES_RQ_CMD 0
+
+/* tmpl_cmd_get_chassis_capabilities_rs */
+#define TMPL_CMD_GET_CHASSIS_CAPABILITIES_RS_CMD 0
+#define TMPL_CMD_GET_CHASSIS_CAPABILITIES_RS_COMP_CODE 1
+#define TMPL_CMD_GET_CHASSIS_CAPABILITIES_RS_CAPABILITIES_FLAGS_PROVIDES_INTRUSION_SENSOR 2
+#define TMPL_CMD_GET_CHASSIS_CAPABILITIES_RS_CAPABILITIES_FLAGS_PROVIDES_FRONT_PANEL_LOCKOUT 3
+#define TMPL_CMD_GET_CHASSIS_CAPABILITIES_RS_CAPABILITIES_FLAGS_PROVIDES_DIAGNOSTIC_INTERRUPT 4
+#define TMPL_CMD_GET_CHASSIS_CAPABILITIES_RS_CAPABILITIES_FLAGS_PROVIDES_POWER_INTERLOCK 5
+#define TMPL_CMD_GET_CHASSIS_CAPABILITIES_RS_CAPABILITIES_FLAGS_RESERVED 6
+#define TMPL_CMD_GET_CHASSIS_CAPABILITIES_RS_FRU_INFO_DEVICE_ADDRESS 7
+#define TMPL_CMD_GET_CHASSIS_CAPABILITIES_RS_SDR_DEVICE_ADDRESS 8
+#define TMPL_CMD_GET_CHASSIS_CAPABILITIES_RS_SEL_DEVICE_ADDRESS 9
+#define TMPL_CMD_GET_CHASSIS_CAPABILITIES_RS_SYSTEM_MANAGEMENT_DEVICE_ADDRESS 10
+#define TMPL_CMD_GET_CHASSIS_CAPABILITIES_RS_BRIDGE_DEVICE_ADDRESS 11
+
+/* tmpl_cmd_get_chassis_status_rq */
+#define TMPL_CMD_GET_CHASSIS_STATUS_RQ_CMD 0
+
+/* tmpl_cmd_get_chassis_status_rs */
+#define TMPL_CMD_GET_CHASSIS_STATUS_RS_CMD 0
+#define TMPL_CMD_GET_CHASSIS_STATUS_RS_COMP_CODE 1
+#define TMPL_CMD_GET_CHASSIS_STATUS_RS_CURRENT_POWER_STATE_POWER_IS_ON 2
+#define TMPL_CMD_GET_CHASSIS_STATUS_RS_CURRENT_POWER_STATE_POWER_OVERLOAD 3
+#define TMPL_CMD_GET_CHASSIS_STATUS_RS_CURRENT_POWER_STATE_INTERLOCK 4
+#define TMPL_CMD_GET_CHASSIS_STATUS_RS_CURRENT_POWER_STATE_POWER_FAULT 5
+#define TMPL_CMD_GET_CHASSIS_STATUS_RS_CURRENT_POWER_STATE_POWER_CONTROL_FAULT 6
+#define TMPL_CMD_GET_CHASSIS_STATUS_RS_CURRENT_POWER_STATE_POWER_RESTORE_POLICY 7
+#define TMPL_CMD_GET_CHASSIS_STATUS_RS_CURRENT_POWER_STATE_RESERVED 8
+#define TMPL_CMD_GET_CHASSIS_STATUS_RS_LAST_POWER_EVENT_AC_FAILED 9
+#define TMPL_CMD_GET_CHASSIS_STATUS_RS_LAST_POWER_EVENT_POWER_DOWN_CAUSED_BY_POWER_OVERLOAD 10
+#define TMPL_CMD_GET_CHASSIS_STATUS_RS_LAST_POWER_EVENT_POWER_DOWN_CAUSED_BY_POWER_INTERLOCK_BEING_ACTIVATED 11
+#define TMPL_CMD_GET_CHASSIS_STATUS_RS_LAST_POWER_EVENT_POWER_DOWN_CAUSED_BY_POWER_FAULT 12
+#define TMPL_CMD_GET_CHASSIS_STATUS_RS_LAST_POWER_EVENT_POWER_ON_ENTERED_VIA_IPMI 13
+#define TMPL_CMD_GET_CHASSIS_STATUS_RS_LAST_POWER_EVENT_RESERVED 14
+#define TMPL_CMD_GET_CHASSIS_STATUS_RS_MISC_CHASSIS_STATE_CHASSIS_INTRUSION_ACTIVE 15
+#define TMPL_CMD_GET_CHASSIS_STATUS_RS_MISC_CHASSIS_STATE_FRONT_PANEL_LOCKOUT_ACTIVE 16
+#define TMPL_CMD_GET_CHASSIS_STATUS_RS_MISC_CHASSIS_STATE_DRIVE_FAULT 17
+#define TMPL_CMD_GET_CHASSIS_STATUS_RS_MISC_CHASSIS_STATE_COOLING_FAN_FAULT_DETECTED 18
+#define TMPL_CMD_GET_CHASSIS_STATUS_RS_MISC_CHASSIS_STATE_CHASSIS_IDENTIFY_STATE 19
+#define TMPL_CMD_GET_CHASSIS_STATUS_RS_MISC_CHASSIS_STATE_CHASSIS_IDENTIFY_COMMAND_AND_STATE_INFO_SUPPORTED 20
+#define TMPL_CMD_GET_CHASSIS_STATUS_RS_MISC_CHASSIS_STATE_RESERVED 21
+#define TMPL_CMD_GET_CHASSIS_STATUS_RS_FRONT_PANEL_POWER_OFF_BUTTON_DISABLED 22
+#define TMPL_CMD_GET_CHASSIS_STATUS_RS_FRONT_PANEL_RESET_BUTTON_DISABLED 23
+#define TMPL_CMD_GET_CHASSIS_STATUS_RS_FRONT_PANEL_DIAGNOSTIC_INTERRUPT_BUTTON_DISABLED 24
+#define TMPL_CMD_GET_CHASSIS_STATUS_RS_FRONT_PANEL_STANDBY_BUTTON_DISABLED 25
+#define TMPL_CMD_GET_CHASSIS_STATUS_RS_FRONT_PANEL_POWER_OFF_BUTTON_DISABLE_ALLOWED 26
+#define TMPL_CMD_GET_CHASSIS_STATUS_RS_FRONT_PANEL_RESET_BUTTON_DISABLE_ALLOWED 27
+#define TMPL_CMD_GET_CHASSIS_STATUS_RS_FRONT_PANEL_DIAGNOSTIC_INTERRUPT_BUTTON_DISABLE_ALLOWED 28
+#define TMPL_CMD_GET_CHASSIS_STATUS_RS_FRONT_PANEL_STANDBY_BUTTON_DISABLE_ALLOWED 29
+
+/* tmpl_cmd_chassis_control_rq */
+#define TMPL_CMD_CHASSIS_CONTROL_RQ_CMD 0
+#define TMPL_CMD_CHASSIS_CONTROL_RQ_CHASSIS_CONTROL 1
+#define TMPL_CMD_CHASSIS_CONTROL_RQ_RESERVED 2
+
+/* tmpl_cmd_chassis_control_rs */
+#define TMPL_CMD_CHASSIS_CONTROL_RS_CMD 0
+#define TMPL_CMD_CHASSIS_CONTROL_RS_COMP_CODE 1
+
+/* tmpl_cmd_chassis_identify_rq */
+#define TMPL_CMD_CHASSIS_IDENTIFY_RQ_CMD 0
+#define TMPL_CMD_CHASSIS_IDENTIFY_RQ_IDENTIFY_INTERVAL 1
+#define TMPL_CMD_CHASSIS_IDENTIFY_RQ_FORCE_IDENTIFY 2
+#define TMPL_CMD_CHASSIS_IDENTIFY_RQ_RESERVED 3
+
+/* tmpl_cmd_chassis_identify_rs */
+#define TMPL_CMD_CHASSIS_IDENTIFY_RS_CMD 0
+#define TMPL_CMD_CHASSIS_IDENTIFY_RS_COMP_CODE 1
+
+/* tmpl_cmd_set_front_panel_enables_rq */
+#define TMPL_CMD_SET_FRONT_PANEL_ENABLES_RQ_CMD 0
+#define TMPL_CMD_SET_FRONT_PANEL_ENABLES_RQ_DISABLE_POWER_OFF_BUTTON_FOR_POWER_OFF_ONLY 1
+#define TMPL_CMD_SET_FRONT_PANEL_ENABLES_RQ_DISABLE_RESET_BUTTON 2
+#define TMPL_CMD_SET_FRONT_PANEL_ENABLES_RQ_DISABLE_DIAGNOSTIC_INTERRUPT_BUTTON 3
+#define TMPL_CMD_SET_FRONT_PANEL_ENABLES_RQ_DISABLE_STANDBY_BUTTON_FOR_ENTERING_STANDBY 4
+#define TMPL_CMD_SET_FRONT_PANEL_ENABLES_RQ_RESERVED 5
+
+/* tmpl_cmd_set_front_panel_enables_rs */
+#define TMPL_CMD_SET_FRONT_PANEL_ENABLES_RS_CMD 0
+#define TMPL_CMD_SET_FRONT_PANEL_ENABLES_RS_COMP_CODE 1
+
+/* tmpl_cmd_set_power_restore_policy_rq */
+#define TMPL_CMD_SET_POWER_RESTORE_POLICY_RQ_CMD 0
+#define TMPL_CMD_SET_POWER_RESTORE_POLICY_RQ_POWER_RESTORE_POLICY 1
+#define TMPL_CMD_SET_POWER_RESTORE_POLICY_RQ_RESERVED 2
+
+/* tmpl_cmd_set_power_restore_policy_rs */
+#define TMPL_CMD_SET_POWER_RESTORE_POLICY_RS_CMD 0
+#define TMPL_CMD_SET_POWER_RESTORE_POLICY_RS_COMP_CODE 1
+#define TMPL_CMD_SET_POWER_RESTORE_POLICY_RS_POWERED_OFF_AFTER_AC_MAINS_RETURNS 2
+#define TMPL_CMD_SET_POWER_RESTORE_POLICY_RS_RESTORING_POWER_TO_STATE_WHEN_AC_MAINS_WAS_LOST 3
+#define TMPL_CMD_SET_POWER_RESTORE_POLICY_RS_ALWAYS_POWERING_UP_AFTER_AC_MAINS_RETURNS 4
+#define TMPL_CMD_SET_POWER_RESTORE_POLICY_RS_RESERVED 5
+
+/* tmpl_cmd_set_power_cycle_interval_rq */
+#define TMPL_CMD_SET_POWER_CYCLE_INTERVAL_RQ_CMD 0
+#define TMPL_CMD_SET_POWER_CYCLE_INTERVAL_RQ_INTERVAL 1
+
+/* tmpl_cmd_set_power_cycle_interval_rs */
+#define TMPL_CMD_SET_POWER_CYCLE_INTERVAL_RS_CMD 0
+#define TMPL_CMD_SET_POWER_CYCLE_INTERVAL_RS_COMP_CODE 1
+
+/* tmpl_cmd_get_system_restart_cause_rq */
+#define TMPL_CMD_GET_SYSTEM_RESTART_CAUSE_RQ_CMD 0
+
+/* tmpl_cmd_get_system_restart_cause_rs */
+#define TMPL_CMD_GET_SYSTEM_RESTART_CAUSE_RS_CMD 0
+#define TMPL_CMD_GET_SYSTEM_RESTART_CAUSE_RS_COMP_CODE 1
+#define TMPL_CMD_GET_SYSTEM_RESTART_CAUSE_RS_RESTART_CAUSE 2
+#define TMPL_CMD_GET_SYSTEM_RESTART_CAUSE_RS_RESERVED 3
+#define TMPL_CMD_GET_SYSTEM_RESTART_CAUSE_RS_CHANNEL 4
+
+/* tmpl_cmd_set_system_boot_options_rq */
+#define TMPL_CMD_SET_SYSTEM_BOOT_OPTIONS_RQ_CMD 0
+#define TMPL_CMD_SET_SYSTEM_BOOT_OPTIONS_RQ_PARAMETER_SELECTOR 1
+#define TMPL_CMD_SET_SYSTEM_BOOT_OPTIONS_RQ_PARAMETER_VALID 2
+#define TMPL_CMD_SET_SYSTEM_BOOT_OPTIONS_RQ_CONFIGURATION_PARAMETER_DATA 3
+
+/* tmpl_cmd_set_system_boot_options_rs */
+#define TMPL_CMD_SET_SYSTEM_BOOT_OPTIONS_RS_CMD 0
+#define TMPL_CMD_SET_SYSTEM_BOOT_OPTIONS_RS_COMP_CODE 1
+
+/* tmpl_cmd_set_system_boot_options_set_in_progress_rq */
+#define TMPL_CMD_SET_SYSTEM_BOOT_OPTIONS_SET_IN_PROGRESS_RQ_CMD 0
+#define TMPL_CMD_SET_SYSTEM_BOOT_OPTIONS_SET_IN_PROGRESS_RQ_PARAMETER_SELECTOR 1
+#define TMPL_CMD_SET_SYSTEM_BOOT_OPTIONS_SET_IN_PROGRESS_RQ_PARAMETER_VALID 2
+#define TMPL_CMD_SET_SYSTEM_BOOT_OPTIONS_SET_IN_PROGRESS_RQ_STATE 3
+#define TMPL_CMD_SET_SYSTEM_BOOT_OPTIONS_SET_IN_PROGRESS_RQ_RESERVED 4
+
+/* tmpl_cmd_set_system_boot_options_service_partition_selector_rq */
+#define TMPL_CMD_SET_SYSTEM_BOOT_OPTIONS_SERVICE_PARTITION_SELECTOR_RQ_CMD 0
+#define TMPL_CMD_SET_SYSTEM_BOOT_OPTIONS_SERVICE_PARTITION_SELECTOR_RQ_PARAMETER_SELECTOR 1
+#define TMPL_CMD_SET_SYSTEM_BOOT_OPTIONS_SERVICE_PARTITION_SELECTOR_RQ_PARAMETER_VALID 2
+#define TMPL_CMD_SET_SYSTEM_BOOT_OPTIONS_SERVICE_PARTITION_SELECTOR_RQ_SERVICE_PARTITION_SELECTOR 3
+
+/* tmpl_cmd_set_system_boot_options_service_partition_scan_rq */
+#define TMPL_CMD_SET_SYSTEM_BOOT_OPTIONS_SERVICE_PARTITION_SCAN_RQ_CMD 0
+#define TMPL_CMD_SET_SYSTEM_BOOT_OPTIONS_SERVICE_PARTITION_SCAN_RQ_PARAMETER_SELECTOR 1
+#define TMPL_CMD_SET_SYSTEM_BOOT_OPTIONS_SERVICE_PARTITION_SCAN_RQ_PARAMETER_VALID 2
+#define TMPL_CMD_SET_SYSTEM_BOOT_OPTIONS_SERVICE_PARTITION_SCAN_RQ_SERVICE_PARTITION_DISCOVERED 3
+#define TMPL_CMD_SET_SYSTEM_BOOT_OPTIONS_SERVICE_PARTITION_SCAN_RQ_SERVICE_PARTITION_SCAN 4
+#define TMPL_CMD_SET_SYSTEM_BOOT_OPTIONS_SERVICE_PARTITION_SCAN_RQ_RESERVED 5
+
+/* tmpl_cmd_set_system_boot_options_BMC_boot_flag_valid_bit_clearing_rq */
+#define TMPL_CMD_SET_SYSTEM_BOOT_OPTIONS_BMC_BOOT_FLAG_VALID_BIT_CLEARING_RQ_CMD 0
+#define TMPL_CMD_SET_SYSTEM_BOOT_OPTIONS_BMC_BOOT_FLAG_VALID_BIT_CLEARING_RQ_PARAMETER_SELECTOR 1
+#define TMPL_CMD_SET_SYSTEM_BOOT_OPTIONS_BMC_BOOT_FLAG_VALID_BIT_CLEARING_RQ_PARAMETER_VALID 2
+#define TMPL_CMD_SET_SYSTEM_BOOT_OPTIONS_BMC_BOOT_FLAG_VALID_BIT_CLEARING_RQ_DONT_CLEAR_VALID_BIT_ON_POWER_UP_VIA_POWER_PUSHBUTTON_OR_WAKE_EVENT 3
+#define TMPL_CMD_SET_SYSTEM_BOOT_OPTIONS_BMC_BOOT_FLAG_VALID_BIT_CLEARING_RQ_DONT_CLEAR_VALID_BIT_ON_PUSHBUTTON_RESET_SOFT_RESET 4
+#define TMPL_CMD_SET_SYSTEM_BOOT_OPTIONS_BMC_BOOT_FLAG_VALID_BIT_CLEARING_RQ_DONT_CLEAR_VALID_BIT_ON_RESET_POWER_CYCLE_CAUSED_BY_WATCHDOG_TIMEOUT 5
+#define TMPL_CMD_SET_SYSTEM_BOOT_OPTIONS_BMC_BOOT_FLAG_VALID_BIT_CLEARING_RQ_DONT_AUTOMATICALLY_CLEAR_BOOT_FLAG_VALID_BIT_IF_CHASSIS_CONTROL_COMMAND_NOT_RECEIVED_WITHIN_60_SECOND_TIMEOUT 6
+#define TMPL_CMD_SET_SYSTEM_BOOT_OPTIONS_BMC_BOOT_FLAG_VALID_BIT_CLEARING_RQ_DONT_CLEAR_VALID_BIT_ON_RESET_POWER_CYCLE_CAUSED_BY_PEF 7
+#define TMPL_CMD_SET_SYSTEM_BOOT_OPTIONS_BMC_BOOT_FLAG_VALID_BIT_CLEARING_RQ_RESERVED 8
+
+/* tmpl_cmd_set_system_boot_options_boot_info_acknowledge_rq */
+#define TMPL_CMD_SET_SYSTEM_BOOT_OPTIONS_BOOT_INFO_ACKNOWLEDGE_RQ_CMD 0
+#define TMPL_CMD_SET_SYSTEM_BOOT_OPTIONS_BOOT_INFO_ACKNOWLEDGE_RQ_PARAMETER_SELECTOR 1
+#define TMPL_CMD_SET_SYSTEM_BOOT_OPTIONS_BOOT_INFO_ACKNOWLEDGE_RQ_PARAMETER_VALID 2
+#define TMPL_CMD_SET_SYSTEM_BOOT_OPTIONS_BOOT_INFO_ACKNOWLEDGE_RQ_ENABLE_WRITE_BIT_0 3
+#define TMPL_CMD_SET_SYSTEM_BOOT_OPTIONS_BOOT_INFO_ACKNOWLEDGE_RQ_ENABLE_WRITE_BIT_1 4
+#define TMPL_CMD_SET_SYSTEM_BOOT_OPTIONS_BOOT_INFO_ACKNOWLEDGE_RQ_ENABLE_WRITE_BIT_2 5
+#define TMPL_CMD_SET_SYSTEM_BOOT_OPTIONS_BOOT_INFO_ACKNOWLEDGE_RQ_ENABLE_WRITE_BIT_3 6
+#define TMPL_CMD_SET_SYSTEM_BOOT_OPTIONS_BOOT_INFO_ACKNOWLEDGE_RQ_ENABLE_WRITE_BIT_4 7
+#define TMPL_CMD_SET_SYSTEM_BOOT_OPTIONS_BOOT_INFO_ACKNOWLEDGE_RQ_ENABLE_WRITE_BIT_5 8
+#define TMPL_CMD_SET_SYSTEM_BOOT_OPTIONS_BOOT_INFO_ACKNOWLEDGE_RQ_ENABLE_WRITE_BIT_6 9
+#define TMPL_CMD_SET_SYSTEM_BOOT_OPTIONS_BOOT_INFO_ACKNOWLEDGE_RQ_ENABLE_WRITE_BIT_7 10
+#define TMPL_CMD_SET_SYSTEM_BOOT_OPTIONS_BOOT_INFO_ACKNOWLEDGE_RQ_BIOS_OR_POST_HANDLED_BOOT_INFO 11
+#define TMPL_CMD_SET_SYSTEM_BOOT_OPTIONS_BOOT_INFO_ACKNOWLEDGE_RQ_OS_LOADER_HANDLED_BOOT_INFO 12
+#define TMPL_CMD_SET_SYSTEM_BOOT_OPTIONS_BOOT_INFO_ACKNOWLEDGE_RQ_OS_OR_SERVICE_PARTITION_HANDLED_BOOT_INFO 13
+#define TMPL_CMD_SET_SYSTEM_BOOT_OPTIONS_BOOT_INFO_ACKNOWLEDGE_RQ_SMS_HANDLED_BOOT_INFO 14
+#define TMPL_CMD_SET_SYSTEM_BOOT_OPTIONS_BOOT_INFO_ACKNOWLEDGE_RQ_OEM_HANDLED_BOOT_INFO 15
+#define TMPL_CMD_SET_SYSTEM_BOOT_OPTIONS_BOOT_INFO_ACKNOWLEDGE_RQ_RESERVED 16
+
+/* tmpl_cmd_set_system_boot_options_boot_flags_rq */
+#define TMPL_CMD_SET_SYSTEM_BOOT_OPTIONS_BOOT_FLAGS_RQ_CMD 0
+#define TMPL_CMD_SET_SYSTEM_BOOT_OPTIONS_BOOT_FLAGS_RQ_PARAMETER_SELECTOR 1
+#define TMPL_CMD_SET_SYSTEM_BOOT_OPTIONS_BOOT_FLAGS_RQ_PARAMETER_VALID 2
+#define TMPL_CMD_SET_SYSTEM_BOOT_OPTIONS_BOOT_FLAGS_RQ_RESERVED1 3
+#define TMPL_CMD_SET_SYSTEM_BOOT_OPTIONS_BOOT_FLAGS_RQ_BIOS_BOOT_TYPE 4
+#define TMPL_CMD_SET_SYSTEM_BOOT_OPTIONS_BOOT_FLAGS_RQ_BOOT_FLAGS_PERSISTENT 5
+#define TMPL_CMD_SET_SYSTEM_BOOT_OPTIONS_BOOT_FLAGS_RQ_BOOT_FLAGS_VALID 6
+#define TMPL_CMD_SET_SYSTEM_BOOT_OPTIONS_BOOT_FLAGS_RQ_LOCK_OUT_RESET_BUTTON 7
+#define TMPL_CMD_SET_SYSTEM_BOOT_OPTIONS_BOOT_FLAGS_RQ_SCREEN_BLANK 8
+#define TMPL_CMD_SET_SYSTEM_BOOT_OPTIONS_BOOT_FLAGS_RQ_BOOT_DEVICE 9
+#define TMPL_CMD_SET_SYSTEM_BOOT_OPTIONS_BOOT_FLAGS_RQ_LOCK_KEYBOARD 10
+#define TMPL_CMD_SET_SYSTEM_BOOT_OPTIONS_BOOT_FLAGS_RQ_CMOS_CLEAR 11
+#define TMPL_CMD_SET_SYSTEM_BOOT_OPTIONS_BOOT_FLAGS_RQ_CONSOLE_REDIRECTION 12
+#define TMPL_CMD_SET_SYSTEM_BOOT_OPTIONS_BOOT_FLAGS_RQ_LOCK_OUT_SLEEP_BUTTON 13
+#define TMPL_CMD_SET_SYSTEM_BOOT_OPTIONS_BOOT_FLAGS_RQ_USER_PASSWORD_BYPASS 14
+#define TMPL_CMD_SET_SYSTEM_BOOT_OPTIONS_BOOT_FLAGS_RQ_FORCE_PROGRESS_EVENT_TRAPS 15
+#define TMPL_CMD_SET_SYSTEM_BOOT_OPTIONS_BOOT_FLAGS_RQ_FIRMWARE_BIOS_VERBOSITY 16
+#define TMPL_CMD_SET_SYSTEM_BOOT_OPTIONS_BOOT_FLAGS_RQ_LOCK_OUT_VIA_POWER_BUTTON 17
+#define TMPL_CMD_SET_SYSTEM_BOOT_OPTIONS_BOOT_FLAGS_RQ_BIOS_MUX_CONTROL_OVERRIDE 18
+#define TMPL_CMD_SET_SYSTEM_BOOT_OPTIONS_BOOT_FLAGS_RQ_BIOS_SHARED_MODE_OVERRIDE 19
+#define TMPL_CMD_SET_SYSTEM_BOOT_OPTIONS_BOOT_FLAGS_RQ_RESERVED2 20
+#define TMPL_CMD_SET_SYSTEM_BOOT_OPTIONS_BOOT_FLAGS_RQ_DEVICE_INSTANCE_SELECTOR 21
+#define TMPL_CMD_SET_SYSTEM_BOOT_OPTIONS_BOOT_FLAGS_RQ_RESERVED3 22
+
+/* tmpl_cmd_set_system_boot_options_boot_initiator_info_rq */
+#define TMPL_CMD_SET_SYSTEM_BOOT_OPTIONS_BOOT_INITIATOR_INFO_RQ_CMD 0
+#define TMPL_CMD_SET_SYSTEM_BOOT_OPTIONS_BOOT_INITIATOR_INFO_RQ_PARAMETER_SELECTOR 1
+#define TMPL_CMD_SET_SYSTEM_BOOT_OPTIONS_BOOT_INITIATOR_INFO_RQ_PARAMETER_VALID 2
+#define TMPL_CMD_SET_SYSTEM_BOOT_OPTIONS_BOOT_INITIATOR_INFO_RQ_BOOT_SOURCE_CHANNEL_NUMBER 3
+#define TMPL_CMD_SET_SYSTEM_BOOT_OPTIONS_BOOT_INITIATOR_INFO_RQ_BOOT_SOURCE_RESERVED 4
+#define TMPL_CMD_SET_SYSTEM_BOOT_OPTIONS_BOOT_INITIATOR_INFO_RQ_SESSION_ID 5
+#define TMPL_CMD_SET_SYSTEM_BOOT_OPTIONS_BOOT_INITIATOR_INFO_RQ_BOOT_INFO_TIMESTAMP 6
+
+/* tmpl_cmd_set_system_boot_options_boot_initiator_mailbox_rq */
+#define TMPL_CMD_SET_SYSTEM_BOOT_OPTIONS_BOOT_INITIATOR_MAILBOX_RQ_CMD 0
+#define TMPL_CMD_SET_SYSTEM_BOOT_OPTIONS_BOOT_INITIATOR_MAILBOX_RQ_PARAMETER_SELECTOR 1
+#define TMPL_CMD_SET_SYSTEM_BOOT_OPTIONS_BOOT_INITIATOR_MAILBOX_RQ_PARAMETER_VALID 2
+#define TMPL_CMD_SET_SYSTEM_BOOT_OPTIONS_BOOT_INITIATOR_MAILBOX_RQ_SET_SELECTOR 3
+#define TMPL_CMD_SET_SYSTEM_BOOT_OPTIONS_BOOT_INITIATOR_MAILBOX_RQ_BLOCK_DATA 4
+
+/* tmpl_cmd_get_system_boot_options_rq */
+#define TMPL_CMD_GET_SYSTEM_BOOT_OPTIONS_RQ_CMD 0
+#define TMPL_CMD_GET_SYSTEM_BOOT_OPTIONS_RQ_PARAMETER_SELECTOR 1
+#define TMPL_CMD_GET_SYSTEM_BOOT_OPTIONS_RQ_RESERVED 2
+#define TMPL_CMD_GET_SYSTEM_BOOT_OPTIONS_RQ_SET_SELECTOR 3
+#define TMPL_CMD_GET_SYSTEM_BOOT_OPTIONS_RQ_BLOCK_SELECTOR 4
+
+/* tmpl_cmd_get_system_boot_options_rs */
+#define TMPL_CMD_GET_SYSTEM_BOOT_OPTIONS_RS_CMD 0
+#define TMPL_CMD_GET_SYSTEM_BOOT_OPTIONS_RS_COMP_CODE 1
+#define TMPL_CMD_GET_SYSTEM_BOOT_OPTIONS_RS_PARAMETER_VERSION 2
+#define TMPL_CMD_GET_SYSTEM_BOOT_OPTIONS_RS_RESERVED 3
+#define TMPL_CMD_GET_SYSTEM_BOOT_OPTIONS_RS_PARAMETER_SELECTOR 4
+#define TMPL_CMD_GET_SYSTEM_BOOT_OPTIONS_RS_PARAMETER_VALID 5
+#define TMPL_CMD_GET_SYSTEM_BOOT_OPTIONS_RS_CONFIGURATION_PARAMETER_DATA 6
+
+/* tmpl_cmd_get_system_boot_options_set_in_progress_rs */
+#define TMPL_CMD_GET_SYSTEM_BOOT_OPTIONS_SET_IN_PROGRESS_RS_CMD 0
+#define TMPL_CMD_GET_SYSTEM_BOOT_OPTIONS_SET_IN_PROGRESS_RS_COMP_CODE 1
+#define TMPL_CMD_GET_SYSTEM_BOOT_OPTIONS_SET_IN_PROGRESS_RS_PARAMETER_VERSION 2
+#define TMPL_CMD_GET_SYSTEM_BOOT_OPTIONS_SET_IN_PROGRESS_RS_RESERVED1 3
+#define TMPL_CMD_GET_SYSTEM_BOOT_OPTIONS_SET_IN_PROGRESS_RS_PARAMETER_SELECTOR 4
+#define TMPL_CMD_GET_SYSTEM_BOOT_OPTIONS_SET_IN_PROGRESS_RS_PARAMETER_VALID 5
+#define TMPL_CMD_GET_SYSTEM_BOOT_OPTIONS_SET_IN_PROGRESS_RS_STATE 6
+#define TMPL_CMD_GET_SYSTEM_BOOT_OPTIONS_SET_IN_PROGRESS_RS_RESERVED2 7
+
+/* tmpl_cmd_get_system_boot_options_service_partition_selector_rs */
+#define TMPL_CMD_GET_SYSTEM_BOOT_OPTIONS_SERVICE_PARTITION_SELECTOR_RS_CMD 0
+#define TMPL_CMD_GET_SYSTEM_BOOT_OPTIONS_SERVICE_PARTITION_SELECTOR_RS_COMP_CODE 1
+#define TMPL_CMD_GET_SYSTEM_BOOT_OPTIONS_SERVICE_PARTITION_SELECTOR_RS_PARAMETER_VERSION 2
+#define TMPL_CMD_GET_SYSTEM_BOOT_OPTIONS_SERVICE_PARTITION_SELECTOR_RS_RESERVED 3
+#define TMPL_CMD_GET_SYSTEM_BOOT_OPTIONS_SERVICE_PARTITION_SELECTOR_RS_PARAMETER_SELECTOR 4
+#define TMPL_CMD_GET_SYSTEM_BOOT_OPTIONS_SERVICE_PARTITION_SELECTOR_RS_PARAMETER_VALID 5
+#define TMPL_CMD_GET_SYSTEM_BOOT_OPTIONS_SERVICE_PARTITION_SELECTOR_RS_SERVICE_PARTITION_SELECTOR 6
+
+/* tmpl_cmd_get_system_boot_options_service_partition_scan_rs */
+#define TMPL_CMD_GET_SYSTEM_BOOT_OPTIONS_SERVICE_PARTITION_SCAN_RS_CMD 0
+#define TMPL_CMD_GET_SYSTEM_BOOT_OPTIONS_SERVICE_PARTITION_SCAN_RS_COMP_CODE 1
+#define TMPL_CMD_GET_SYSTEM_BOOT_OPTIONS_SERVICE_PARTITION_SCAN_RS_PARAMETER_VERSION 2
+#define TMPL_CMD_GET_SYSTEM_BOOT_OPTIONS_SERVICE_PARTITION_SCAN_RS_RESERVED1 3
+#define TMPL_CMD_GET_SYSTEM_BOOT_OPTIONS_SERVICE_PARTITION_SCAN_RS_PARAMETER_SELECTOR 4
+#define TMPL_CMD_GET_SYSTEM_BOOT_OPTIONS_SERVICE_PARTITION_SCAN_RS_PARAMETER_VALID 5
+#define TMPL_CMD_GET_SYSTEM_BOOT_OPTIONS_SERVICE_PARTITION_SCAN_RS_SERVICE_PARTITION_DISCOVERED 6
+#define TMPL_CMD_GET_SYSTEM_BOOT_OPTIONS_SERVICE_PARTITION_SCAN_RS_SERVICE_PARTITION_SCAN 7
+#define TMPL_CMD_GET_SYSTEM_BOOT_OPTIONS_SERVICE_PARTITION_SCAN_RS_RESERVED2 8
+
+/* tmpl_cmd_get_system_boot_options_BMC_boot_flag_valid_bit_clearing_rs */
+#define TMPL_CMD_GET_SYSTEM_BOOT_OPTIONS_BMC_BOOT_FLAG_VALID_BIT_CLEARING_RS_CMD 0
+#define TMPL_CMD_GET_SYSTEM_BOOT_OPTIONS_BMC_BOOT_FLAG_VALID_BIT_CLEARING_RS_COMP_CODE 1
+#define TMPL_CMD_GET_SYSTEM_BOOT_OPTIONS_BMC_BOOT_FLAG_VALID_BIT_CLEARING_RS_PARAMETER_VERSION 2
+#define TMPL_CMD_GET_SYSTEM_BOOT_OPTIONS_BMC_BOOT_FLAG_VALID_BIT_CLEARING_RS_RESERVED 3
+#define TMPL_CMD_GET_SYSTEM_BOOT_OPTIONS_BMC_BOOT_FLAG_VALID_BIT_CLEARING_RS_PARAMETER_SELECTOR 4
+#define TMPL_CMD_GET_SYSTEM_BOOT_OPTIONS_BMC_BOOT_FLAG_VALID_BIT_CLEARING_RS_PARAMETER_VALID 5
+#define TMPL_CMD_GET_SYSTEM_BOOT_OPTIONS_BMC_BOOT_FLAG_VALID_BIT_CLEARING_RS_DONT_CLEAR_VALID_BIT_ON_POWER_UP_VIA_POWER_PUSHBUTTON_OR_WAKE_EVENT 6
+#define TMPL_CMD_GET_SYSTEM_BOOT_OPTIONS_BMC_BOOT_FLAG_VALID_BIT_CLEARING_RS_DONT_CLEAR_VALID_BIT_ON_PUSHBUTTON_RESET_SOFT_RESET 7
+#define TMPL_CMD_GET_SYSTEM_BOOT_OPTIONS_BMC_BOOT_FLAG_VALID_BIT_CLEARING_RS_DONT_CLEAR_VALID_BIT_ON_RESET_POWER_CYCLE_CAUSED_BY_WATCHDOG_TIMEOUT 8
+#define TMPL_CMD_GET_SYSTEM_BOOT_OPTIONS_BMC_BOOT_FLAG_VALID_BIT_CLEARING_RS_DONT_AUTOMATICALLY_CLEAR_BOOT_FLAG_VALID_BIT_IF_CHASSIS_CONTROL_COMMAND_NOT_RECEIVED_WITHIN_60_SECOND_TIMEOUT 9
+#define TMPL_CMD_GET_SYSTEM_BOOT_OPTIONS_BMC_BOOT_FLAG_VALID_BIT_CLEARING_RS_DONT_CLEAR_VALID_BIT_ON_RESET_POWER_CYCLE_CAUSED_BY_PEF 10
+#define TMPL_CMD_GET_SYSTEM_BOOT_OPTIONS_BMC_BOOT_FLAG_VALID_BIT_CLEARING_RS_RESERVED2 11
+
+/* tmpl_cmd_get_system_boot_options_boot_info_acknowledge_rs */
+#define TMPL_CMD_GET_SYSTEM_BOOT_OPTIONS_BOOT_INFO_ACKNOWLEDGE_RS_CMD 0
+#define TMPL_CMD_GET_SYSTEM_BOOT_OPTIONS_BOOT_INFO_ACKNOWLEDGE_RS_COMP_CODE 1
+#define TMPL_CMD_GET_SYSTEM_BOOT_OPTIONS_BOOT_INFO_ACKNOWLEDGE_RS_PARAMETER_VERSION 2
+#define TMPL_CMD_GET_SYSTEM_BOOT_OPTIONS_BOOT_INFO_ACKNOWLEDGE_RS_RESERVED1 3
+#define TMPL_CMD_GET_SYSTEM_BOOT_OPTIONS_BOOT_INFO_ACKNOWLEDGE_RS_PARAMETER_SELECTOR 4
+#define TMPL_CMD_GET_SYSTEM_BOOT_OPTIONS_BOOT_INFO_ACKNOWLEDGE_RS_PARAMETER_VALID 5
+#define TMPL_CMD_GET_SYSTEM_BOOT_OPTIONS_BOOT_INFO_ACKNOWLEDGE_RS_ENABLE_WRITE_BIT_0 6
+#define TMPL_CMD_GET_SYSTEM_BOOT_OPTIONS_BOOT_INFO_ACKNOWLEDGE_RS_ENABLE_WRITE_BIT_1 7
+#define TMPL_CMD_GET_SYSTEM_BOOT_OPTIONS_BOOT_INFO_ACKNOWLEDGE_RS_ENABLE_WRITE_BIT_2 8
+#define TMPL_CMD_GET_SYSTEM_BOOT_OPTIONS_BOOT_INFO_ACKNOWLEDGE_RS_ENABLE_WRITE_BIT_3 9
+#define TMPL_CMD_GET_SYSTEM_BOOT_OPTIONS_BOOT_INFO_ACKNOWLEDGE_RS_ENABLE_WRITE_BIT_4 10
+#define TMPL_CMD_GET_SYSTEM_BOOT_OPTIONS_BOOT_INFO_ACKNOWLEDGE_RS_ENABLE_WRITE_BIT_5 11
+#define TMPL_CMD_GET_SYSTEM_BOOT_OPTIONS_BOOT_INFO_ACKNOWLEDGE_RS_ENABLE_WRITE_BIT_6 12
+#define TMPL_CMD_GET_SYSTEM_BOOT_OPTIONS_BOOT_INFO_ACKNOWLEDGE_RS_ENABLE_WRITE_BIT_7 13
+#define TMPL_CMD_GET_SYSTEM_BOOT_OPTIONS_BOOT_INFO_ACKNOWLEDGE_RS_BIOS_OR_POST_HANDLED_BOOT_INFO 14
+#define TMPL_CMD_GET_SYSTEM_BOOT_OPTIONS_BOOT_INFO_ACKNOWLEDGE_RS_OS_LOADER_HANDLED_BOOT_INFO 15
+#define TMPL_CMD_GET_SYSTEM_BOOT_OPTIONS_BOOT_INFO_ACKNOWLEDGE_RS_OS_OR_SERVICE_PARTITION_HANDLED_BOOT_INFO 16
+#define TMPL_CMD_GET_SYSTEM_BOOT_OPTIONS_BOOT_INFO_ACKNOWLEDGE_RS_SMS_HANDLED_BOOT_INFO 17
+#define TMPL_CMD_GET_SYSTEM_BOOT_OPTIONS_BOOT_INFO_ACKNOWLEDGE_RS_OEM_HANDLED_BOOT_INFO 18
+#define TMPL_CMD_GET_SYSTEM_BOOT_OPTIONS_BOOT_INFO_ACKNOWLEDGE_RS_RESERVED2 19
+
+/* tmpl_cmd_get_system_boot_options_boot_flags_rs */
+#define TMPL_CMD_GET_SYSTEM_BOOT_OPTIONS_BOOT_FLAGS_RS_CMD 0
+#define TMPL_CMD_GET_SYSTEM_BOOT_OPTIONS_BOOT_FLAGS_RS_COMP_CODE 1
+#define TMPL_CMD_GET_SYSTEM_BOOT_OPTIONS_BOOT_FLAGS_RS_PARAMETER_VERSION 2
+#define TMPL_CMD_GET_SYSTEM_BOOT_OPTIONS_BOOT_FLAGS_RS_RESERVED 3
+#define TMPL_CMD_GET_SYSTEM_BOOT_OPTIONS_BOOT_FLAGS_RS_PARAMETER_SELECTOR 4
+#define TMPL_CMD_GET_SYSTEM_BOOT_OPTIONS_BOOT_FLAGS_RS_PARAMETER_VALID 5
+#define TMPL_CMD_GET_SYSTEM_BOOT_OPTIONS_BOOT_FLAGS_RS_RESERVED1 6
+#define TMPL_CMD_GET_SYSTEM_BOOT_OPTIONS_BOOT_FLAGS_RS_BIOS_BOOT_TYPE 7
+#define TMPL_CMD_GET_SYSTEM_BOOT_OPTIONS_BOOT_FLAGS_RS_BOOT_FLAGS_PERSISTENT 8
+#define TMPL_CMD_GET_SYSTEM_BOOT_OPTIONS_BOOT_FLAGS_RS_BOOT_FLAGS_VALID 9
+#define TMPL_CMD_GET_SYSTEM_BOOT_OPTIONS_BOOT_FLAGS_RS_LOCK_OUT_RESET_BUTTON 10
+#define TMPL_CMD_GET_SYSTEM_BOOT_OPTIONS_BOOT_FLAGS_RS_SCREEN_BLANK 11
+#define TMPL_CMD_GET_SYSTEM_BOOT_OPTIONS_BOOT_FLAGS_RS_BOOT_DEVICE 12
+#define TMPL_CMD_GET_SYSTEM_BOOT_OPTIONS_BOOT_FLAGS_RS_LOCK_KEYBOARD 13
+#define TMPL_CMD_GET_SYSTEM_BOOT_OPTIONS_BOOT_FLAGS_RS_CMOS_CLEAR 14
+#define TMPL_CMD_GET_SYSTEM_BOOT_OPTIONS_BOOT_FLAGS_RS_CONSOLE_REDIRECTION 15
+#define TMPL_CMD_GET_SYSTEM_BOOT_OPTIONS_BOOT_FLAGS_RS_LOCK_OUT_SLEEP_BUTTON 16
+#define TMPL_CMD_GET_SYSTEM_BOOT_OPTIONS_BOOT_FLAGS_RS_USER_PASSWORD_BYPASS 17
+#define TMPL_CMD_GET_SYSTEM_BOOT_OPTIONS_BOOT_FLAGS_RS_FORCE_PROGRESS_EVENT_TRAPS 18
+#define TMPL_CMD_GET_SYSTEM_BOOT_OPTIONS_BOOT_FLAGS_RS_FIRMWARE_BIOS_VERBOSITY 19
+#define TMPL_CMD_GET_SYSTEM_BOOT_OPTIONS_BOOT_FLAGS_RS_LOCK_OUT_VIA_POWER_BUTTON 20
+#define TMPL_CMD_GET_SYSTEM_BOOT_OPTIONS_BOOT_FLAGS_RS_BIOS_MUX_CONTROL_OVERRIDE 21
+#define TMPL_CMD_GET_SYSTEM_BOOT_OPTIONS_BOOT_FLAGS_RS_BIOS_SHARED_MODE_OVERRIDE 22
+#define TMPL_CMD_GET_SYSTEM_BOOT_OPTIONS_BOOT_FLAGS_RS_RESERVED2 23
+#define TMPL_CMD_GET_SYSTEM_BOOT_OPTIONS_BOOT_FLAGS_RS_DEVICE_INSTANCE_SELECTOR 24
+#define TMPL_CMD_GET_SYSTEM_BOOT_OPTIONS_BOOT_FLAGS_RS_RESERVED3 25
+
+/* tmpl_cmd_get_system_boot_options_boot_initiator_info_rs */
+#define TMPL_CMD_GET_SYSTEM_BOOT_OPTIONS_BOOT_INITIATOR_INFO_RS_CMD 0
+#define TMPL_CMD_GET_SYSTEM_BOOT_OPTIONS_BOOT_INITIATOR_INFO_RS_COMP_CODE 1
+#define TMPL_CMD_GET_SYSTEM_BOOT_OPTIONS_BOOT_INITIATOR_INFO_RS_PARAMETER_VERSION 2
+#define TMPL_CMD_GET_SYSTEM_BOOT_OPTIONS_BOOT_INITIATOR_INFO_RS_RESERVED 3
+#define TMPL_CMD_GET_SYSTEM_BOOT_OPTIONS_BOOT_INITIATOR_INFO_RS_PARAMETER_SELECTOR 4
+#define TMPL_CMD_GET_SYSTEM_BOOT_OPTIONS_BOOT_INITIATOR_INFO_RS_PARAMETER_VALID 5
+#define TMPL_CMD_GET_SYSTEM_BOOT_OPTIONS_BOOT_INITIATOR_INFO_RS_BOOT_SOURCE_CHANNEL_NUMBER 6
+#define TMPL_CMD_GET_SYSTEM_BOOT_OPTIONS_BOOT_INITIATOR_INFO_RS_BOOT_SOURCE_RESERVED 7
+#define TMPL_CMD_GET_SYSTEM_BOOT_OPTIONS_BOOT_INITIATOR_INFO_RS_SESSION_ID 8
+#define TMPL_CMD_GET_SYSTEM_BOOT_OPTIONS_BOOT_INITIATOR_INFO_RS_BOOT_INFO_TIMESTAMP 9
+
+/* tmpl_cmd_get_system_boot_options_boot_initiator_mailbox_rs */
+#define TMPL_CMD_GET_SYSTEM_BOOT_OPTIONS_BOOT_INITIATOR_MAILBOX_RS_CMD 0
+#define TMPL_CMD_GET_SYSTEM_BOOT_OPTIONS_BOOT_INITIATOR_MAILBOX_RS_COMP_CODE 1
+#define TMPL_CMD_GET_SYSTEM_BOOT_OPTIONS_BOOT_INITIATOR_MAILBOX_RS_PARAMETER_VERSION 2
+#define TMPL_CMD_GET_SYSTEM_BOOT_OPTIONS_BOOT_INITIATOR_MAILBOX_RS_RESERVED 3
+#define TMPL_CMD_GET_SYSTEM_BOOT_OPTIONS_BOOT_INITIATOR_MAILBOX_RS_PARAMETER_SELECTOR 4
+#define TMPL_CMD_GET_SYSTEM_BOOT_OPTIONS_BOOT_INITIATOR_MAILBOX_RS_PARAMETER_VALID 5
+#define TMPL_CMD_GET_SYSTEM_BOOT_OPTIONS_BOOT_INITIATOR_MAILBOX_RS_SET_SELECTOR 6
+#define TMPL_CMD_GET_SYSTEM_BOOT_OPTIONS_BOOT_INITIATOR_MAILBOX_RS_BLOCK_DATA 7
+
+/* tmpl_cmd_get_power_on_hours_counter_rq */
+#define TMPL_CMD_GET_POWER_ON_HOURS_COUNTER_RQ_CMD 0
+
+/* tmpl_cmd_get_power_on_hours_counter_rs */
+#define TMPL_CMD_GET_POWER_ON_HOURS_COUNTER_RS_CMD 0
+#define TMPL_CMD_GET_POWER_ON_HOURS_COUNTER_RS_COMP_CODE 1
+#define TMPL_CMD_GET_POWER_ON_HOURS_COUNTER_RS_MINUTES_PER_COUNTER 2
+#define TMPL_CMD_GET_POWER_ON_HOURS_COUNTER_RS_COUNTER_READING 3
+
+/* tmpl_dcmi_rolling_average_time_period */
+#define TMPL_DCMI_ROLLING_AVERAGE_TIME_PERIOD_TIME_DURATION 0
+#define TMPL_DCMI_ROLLING_AVERAGE_TIME_PERIOD_TIME_DURATION_UNITS 1
+
+/* tmpl_cmd_dcmi_get_dcmi_capability_info_rq */
+#define TMPL_CMD_DCMI_GET_DCMI_CAPABILITY_INFO_RQ_CMD 0
+#define TMPL_CMD_DCMI_GET_DCMI_CAPABILITY_INFO_RQ_GROUP_EXTENSION_IDENTIFICATION 1
+#define TMPL_CMD_DCMI_GET_DCMI_CAPABILITY_INFO_RQ_PARAMETER_SELECTOR 2
+
+/* tmpl_cmd_dcmi_get_dcmi_capability_info_rs */
+#define TMPL_CMD_DCMI_GET_DCMI_CAPABILITY_INFO_RS_CMD 0
+#define TMPL_CMD_DCMI_GET_DCMI_CAPABILITY_INFO_RS_COMP_CODE 1
+#define TMPL_CMD_DCMI_GET_DCMI_CAPABILITY_INFO_RS_GROUP_EXTENSION_IDENTIFICATION 2
+#define TMPL_CMD_DCMI_GET_DCMI_CAPABILITY_INFO_RS_DCMI_SPECIFICATION_CONFORMANCE_MAJOR_VERSION 3
+#define TMPL_CMD_DCMI_GET_DCMI_CAPABILITY_INFO_RS_DCMI_SPECIFICATION_CONFORMANCE_MINOR_VERSION 4
+#define TMPL_CMD_DCMI_GET_DCMI_CAPABILITY_INFO_RS_PARAMETER_REVISION 5
+#define TMPL_CMD_DCMI_GET_DCMI_CAPABILITY_INFO_RS_PARAMETER_DATA 6
+
+/* tmpl_cmd_dcmi_get_dcmi_capability_info_supported_dcmi_capabilities_rs */
+#define TMPL_CMD_DCMI_GET_DCMI_CAPABILITY_INFO_SUPPORTED_DCMI_CAPABILITIES_RS_CMD 0
+#define TMPL_CMD_DCMI_GET_DCMI_CAPABILITY_INFO_SUPPORTED_DCMI_CAPABILITIES_RS_COMP_CODE 1
+#define TMPL_CMD_DCMI_GET_DCMI_CAPABILITY_INFO_SUPPORTED_DCMI_CAPABILITIES_RS_GROUP_EXTENSION_IDENTIFICATION 2
+#define TMPL_CMD_DCMI_GET_DCMI_CAPABILITY_INFO_SUPPORTED_DCMI_CAPABILITIES_RS_DCMI_SPECIFICATION_CONFORMANCE_MAJOR_VERSION 3
+#define TMPL_CMD_DCMI_GET_DCMI_CAPABILITY_INFO_SUPPORTED_DCMI_CAPABILITIES_RS_DCMI_SPECIFICATION_CONFORMANCE_MINOR_VERSION 4
+#define TMPL_CMD_DCMI_GET_DCMI_CAPABILITY_INFO_SUPPORTED_DCMI_CAPABILITIES_RS_PARAMETER_REVISION 5
+#define TMPL_CMD_DCMI_GET_DCMI_CAPABILITY_INFO_SUPPORTED_DCMI_CAPABILITIES_RS_MANDATORY_PLATFORM_CAPABILITIES_IDENTIFICATION_SUPPORT 6
+#define TMPL_CMD_DCMI_GET_DCMI_CAPABILITY_INFO_SUPPORTED_DCMI_CAPABILITIES_RS_MANDATORY_PLATFORM_CAPABILITIES_SEL_LOGGING 7
+#define TMPL_CMD_DCMI_GET_DCMI_CAPABILITY_INFO_SUPPORTED_DCMI_CAPABILITIES_RS_MANDATORY_PLATFORM_CAPABILITIES_CHASSIS_POWER 8
+#define TMPL_CMD_DCMI_GET_DCMI_CAPABILITY_INFO_SUPPORTED_DCMI_CAPABILITIES_RS_MANDATORY_PLATFORM_CAPABILITIES_TEMPERATURE_MONITOR 9
+#define TMPL_CMD_DCMI_GET_DCMI_CAPABILITY_INFO_SUPPORTED_DCMI_CAPABILITIES_RS_MANDATORY_PLATFORM_CAPABILITIES_RESERVED 10
+#define TMPL_CMD_DCMI_GET_DCMI_CAPABILITY_INFO_SUPPORTED_DCMI_CAPABILITIES_RS_OPTIONAL_PLATFORM_CAPABILITIES_POWER_MANAGEMENT_MONITORING_SUPPORT 11
+#define TMPL_CMD_DCMI_GET_DCMI_CAPABILITY_INFO_SUPPORTED_DCMI_CAPABILITIES_RS_OPTIONAL_PLATFORM_CAPABILITIES_RESERVED 12
+#define TMPL_CMD_DCMI_GET_DCMI_CAPABILITY_INFO_SUPPORTED_DCMI_CAPABILITIES_RS_MANAGEABILITY_ACCESS_CAPABILITIES_IN_BAND_SYSTEM_INTERFACE_CHANNEL_AVAILABLE 13
+#define TMPL_CMD_DCMI_GET_DCMI_CAPABILITY_INFO_SUPPORTED_DCMI_CAPABILITIES_RS_MANAGEABILITY_ACCESS_CAPABILITIES_SERIAL_TMODE_AVAILABLE 14
+#define TMPL_CMD_DCMI_GET_DCMI_CAPABILITY_INFO_SUPPORTED_DCMI_CAPABILITIES_RS_MANAGEABILITY_ACCESS_CAPABILITIES_OUT_OF_BAND_SECONDARY_LAN_CHANNEL_AVAILABLE 15
+#define TMPL_CMD_DCMI_GET_DCMI_CAPABILITY_INFO_SUPPORTED_DCMI_CAPABILITIES_RS_MANAGEABILITY_ACCESS_CAPABILITIES_OUT_OF_BAND_PRIMARY_LAN_CHANNEL_AVAILABLE 16
+#define TMPL_CMD_DCMI_GET_DCMI_CAPABILITY_INFO_SUPPORTED_DCMI_CAPABILITIES_RS_MANAGEABILITY_ACCESS_CAPABILITIES_SOL_SUPPORTED 17
+#define TMPL_CMD_DCMI_GET_DCMI_CAPABILITY_INFO_SUPPORTED_DCMI_CAPABILITIES_RS_MANAGEABILITY_ACCESS_CAPABILITIES_VLAN_CAPABLE 18
+#define TMPL_CMD_DCMI_GET_DCMI_CAPABILITY_INFO_SUPPORTED_DCMI_CAPABILITIES_RS_MANAGEABILITY_ACCESS_CAPABILITIES_RESERVED 19
+
+/* tmpl_cmd_dcmi_get_dcmi_capability_info_mandatory_platform_attributes_rs */
+#define TMPL_CMD_DCMI_GET_DCMI_CAPABILITY_INFO_MANDATORY_PLATFORM_ATTRIBUTES_RS_CMD 0
+#define TMPL_CMD_DCMI_GET_DCMI_CAPABILITY_INFO_MANDATORY_PLATFORM_ATTRIBUTES_RS_COMP_CODE 1
+#define TMPL_CMD_DCMI_GET_DCMI_CAPABILITY_INFO_MANDATORY_PLATFORM_ATTRIBUTES_RS_GROUP_EXTENSION_IDENTIFICATION 2
+#define TMPL_CMD_DCMI_GET_DCMI_CAPABILITY_INFO_MANDATORY_PLATFORM_ATTRIBUTES_RS_DCMI_SPECIFICATION_CONFORMANCE_MAJOR_VERSION 3
+#define TMPL_CMD_DCMI_GET_DCMI_CAPABILITY_INFO_MANDATORY_PLATFORM_ATTRIBUTES_RS_DCMI_SPECIFICATION_CONFORMANCE_MINOR_VERSION 4
+#define TMPL_CMD_DCMI_GET_DCMI_CAPABILITY_INFO_MANDATORY_PLATFORM_ATTRIBUTES_RS_PARAMETER_REVISION 5
+#define TMPL_CMD_DCMI_GET_DCMI_CAPABILITY_INFO_MANDATORY_PLATFORM_ATTRIBUTES_RS_SEL_ATTRIBUTES_NUMBER_OF_SEL_ENTRIES 6
+#define TMPL_CMD_DCMI_GET_DCMI_CAPABILITY_INFO_MANDATORY_PLATFORM_ATTRIBUTES_RS_SEL_ATTRIBUTES_RECORD_LEVEL_SEL_FLUSH_UPON_ROLLOVER 7
+#define TMPL_CMD_DCMI_GET_DCMI_CAPABILITY_INFO_MANDATORY_PLATFORM_ATTRIBUTES_RS_SEL_ATTRIBUTES_ENTIRE_SEL_FLUSH_UPON_ROLLOVER 8
+#define TMPL_CMD_DCMI_GET_DCMI_CAPABILITY_INFO_MANDATORY_PLATFORM_ATTRIBUTES_RS_SEL_ATTRIBUTES_RESERVED 9
+#define TMPL_CMD_DCMI_GET_DCMI_CAPABILITY_INFO_MANDATORY_PLATFORM_ATTRIBUTES_RS_SEL_ATTRIBUTES_SEL_AUTOMATIC_ROLLOVER_ENABLED 10
+#define TMPL_CMD_DCMI_GET_DCMI_CAPABILITY_INFO_MANDATORY_PLATFORM_ATTRIBUTES_RS_IDENTIFICATION_ATTRIBUTES_GUID_SUPPORT 11
+#define TMPL_CMD_DCMI_GET_DCMI_CAPABILITY_INFO_MANDATORY_PLATFORM_ATTRIBUTES_RS_IDENTIFICATION_ATTRIBUTES_DHCP_HOST_NAME_SUPPORT 12
+#define TMPL_CMD_DCMI_GET_DCMI_CAPABILITY_INFO_MANDATORY_PLATFORM_ATTRIBUTES_RS_IDENTIFICATION_ATTRIBUTES_ASSET_TAG_SUPPORT 13
+#define TMPL_CMD_DCMI_GET_DCMI_CAPABILITY_INFO_MANDATORY_PLATFORM_ATTRIBUTES_RS_IDENTIFICATION_ATTRIBUTES_RESERVED 14
+#define TMPL_CMD_DCMI_GET_DCMI_CAPABILITY_INFO_MANDATORY_PLATFORM_ATTRIBUTES_RS_TEMPERATURE_MONITORING_INLET_TEMPERATURE 15
+#define TMPL_CMD_DCMI_GET_DCMI_CAPABILITY_INFO_MANDATORY_PLATFORM_ATTRIBUTES_RS_TEMPERATURE_MONITORING_PROCESSORS_TEMPERATURE 16
+#define TMPL_CMD_DCMI_GET_DCMI_CAPABILITY_INFO_MANDATORY_PLATFORM_ATTRIBUTES_RS_TEMPERATURE_MONITORING_BASEBOARD_TEMPERATURE 17
+#define TMPL_CMD_DCMI_GET_DCMI_CAPABILITY_INFO_MANDATORY_PLATFORM_ATTRIBUTES_RS_TEMPERATURE_MONITORING_RESERVED 18
+#define TMPL_CMD_DCMI_GET_DCMI_CAPABILITY_INFO_MANDATORY_PLATFORM_ATTRIBUTES_RS_TEMPERATURE_MONITORING_SAMPLING_PERIOD 19
+
+/* tmpl_cmd_dcmi_get_dcmi_capability_info_optional_platform_attributes_rs */
+#define TMPL_CMD_DCMI_GET_DCMI_CAPABILITY_INFO_OPTIONAL_PLATFORM_ATTRIBUTES_RS_CMD 0
+#define TMPL_CMD_DCMI_GET_DCMI_CAPABILITY_INFO_OPTIONAL_PLATFORM_ATTRIBUTES_RS_COMP_CODE 1
+#define TMPL_CMD_DCMI_GET_DCMI_CAPABILITY_INFO_OPTIONAL_PLATFORM_ATTRIBUTES_RS_GROUP_EXTENSION_IDENTIFICATION 2
+#define TMPL_CMD_DCMI_GET_DCMI_CAPABILITY_INFO_OPTIONAL_PLATFORM_ATTRIBUTES_RS_DCMI_SPECIFICATION_CONFORMANCE_MAJOR_VERSION 3
+#define TMPL_CMD_DCMI_GET_DCMI_CAPABILITY_INFO_OPTIONAL_PLATFORM_ATTRIBUTES_RS_DCMI_SPECIFICATION_CONFORMANCE_MINOR_VERSION 4
+#define TMPL_CMD_DCMI_GET_DCMI_CAPABILITY_INFO_OPTIONAL_PLATFORM_ATTRIBUTES_RS_PARAMETER_REVISION 5
+#define TMPL_CMD_DCMI_GET_DCMI_CAPABILITY_INFO_OPTIONAL_PLATFORM_ATTRIBUTES_RS_POWER_MANAGEMENT_DEVICE_SLAVE_ADDRESS_RESERVED 6
+#define TMPL_CMD_DCMI_GET_DCMI_CAPABILITY_INFO_OPTIONAL_PLATFORM_ATTRIBUTES_RS_POWER_MANAGEMENT_DEVICE_SLAVE_ADDRESS_SLAVE_ADDRESS 7
+#define TMPL_CMD_DCMI_GET_DCMI_CAPABILITY_INFO_OPTIONAL_PLATFORM_ATTRIBUTES_RS_POWER_MANAGEMENT_CONTROLLER_CHANNEL_NUMBER_DEVICE_REVISION 8
+#define TMPL_CMD_DCMI_GET_DCMI_CAPABILITY_INFO_OPTIONAL_PLATFORM_ATTRIBUTES_RS_POWER_MANAGEMENT_CONTROLLER_CHANNEL_NUMBER_CHANNEL_NUMBER 9
+
+/* tmpl_cmd_dcmi_get_dcmi_capability_info_manageability_access_attributes_rs */
+#define TMPL_CMD_DCMI_GET_DCMI_CAPABILITY_INFO_MANAGEABILITY_ACCESS_ATTRIBUTES_RS_CMD 0
+#define TMPL_CMD_DCMI_GET_DCMI_CAPABILITY_INFO_MANAGEABILITY_ACCESS_ATTRIBUTES_RS_COMP_CODE 1
+#define TMPL_CMD_DCMI_GET_DCMI_CAPABILITY_INFO_MANAGEABILITY_ACCESS_ATTRIBUTES_RS_GROUP_EXTENSION_IDENTIFICATION 2
+#define TMPL_CMD_DCMI_GET_DCMI_CAPABILITY_INFO_MANAGEABILITY_ACCESS_ATTRIBUTES_RS_DCMI_SPECIFICATION_CONFORMANCE_MAJOR_VERSION 3
+#define TMPL_CMD_DCMI_GET_DCMI_CAPABILITY_INFO_MANAGEABILITY_ACCESS_ATTRIBUTES_RS_DCMI_SPECIFICATION_CONFORMANCE_MINOR_VERSION 4
+#define TMPL_CMD_DCMI_GET_DCMI_CAPABILITY_INFO_MANAGEABILITY_ACCESS_ATTRIBUTES_RS_PARAMETER_REVISION 5
+#define TMPL_CMD_DCMI_GET_DCMI_CAPABILITY_INFO_MANAGEABILITY_ACCESS_ATTRIBUTES_RS_MANDATORY_PRIMARY_LAN_OUT_OF_BAND_SUPPORT_CHANNEL_NUMBER 6
+#define TMPL_CMD_DCMI_GET_DCMI_CAPABILITY_INFO_MANAGEABILITY_ACCESS_ATTRIBUTES_RS_OPTIONAL_SECONDARY_LAN_OUT_OF_BAND_SUPPORT_CHANNEL_NUMBER 7
+#define TMPL_CMD_DCMI_GET_DCMI_CAPABILITY_INFO_MANAGEABILITY_ACCESS_ATTRIBUTES_RS_OPTIONAL_SERIAL_OUT_OF_BAND_TMODE_CAPABILITY_CHANNEL_NUMBER 8
+
+/* tmpl_cmd_dcmi_get_dcmi_capability_info_enhanced_system_power_statistics_attributes_rs */
+#define TMPL_CMD_DCMI_GET_DCMI_CAPABILITY_INFO_ENHANCED_SYSTEM_POWER_STATISTICS_ATTRIBUTES_RS_CMD 0
+#define TMPL_CMD_DCMI_GET_DCMI_CAPABILITY_INFO_ENHANCED_SYSTEM_POWER_STATISTICS_ATTRIBUTES_RS_COMP_CODE 1
+#define TMPL_CMD_DCMI_GET_DCMI_CAPABILITY_INFO_ENHANCED_SYSTEM_POWER_STATISTICS_ATTRIBUTES_RS_GROUP_EXTENSION_IDENTIFICATION 2
+#define TMPL_CMD_DCMI_GET_DCMI_CAPABILITY_INFO_ENHANCED_SYSTEM_POWER_STATISTICS_ATTRIBUTES_RS_DCMI_SPECIFICATION_CONFORMANCE_MAJOR_VERSION 3
+#define TMPL_CMD_DCMI_GET_DCMI_CAPABILITY_INFO_ENHANCED_SYSTEM_POWER_STATISTICS_ATTRIBUTES_RS_DCMI_SPECIFICATION_CONFORMANCE_MINOR_VERSION 4
+#define TMPL_CMD_DCMI_GET_DCMI_CAPABILITY_INFO_ENHANCED_SYSTEM_POWER_STATISTICS_ATTRIBUTES_RS_PARAMETER_REVISION 5
+#define TMPL_CMD_DCMI_GET_DCMI_CAPABILITY_INFO_ENHANCED_SYSTEM_POWER_STATISTICS_ATTRIBUTES_RS_NUMBER_OF_SUPPORTED_ROLLING_AVERAGE_TIME_PERIODS 6
+#define TMPL_CMD_DCMI_GET_DCMI_CAPABILITY_INFO_ENHANCED_SYSTEM_POWER_STATISTICS_ATTRIBUTES_RS_ROLLING_AVERAGE_TIME_PERIODS 7
+
+/* tmpl_cmd_dcmi_set_dcmi_configuration_parameters_rq */
+#define TMPL_CMD_DCMI_SET_DCMI_CONFIGURATION_PARAMETERS_RQ_CMD 0
+#define TMPL_CMD_DCMI_SET_DCMI_CONFIGURATION_PARAMETERS_RQ_GROUP_EXTENSION_IDENTIFICATION 1
+#define TMPL_CMD_DCMI_SET_DCMI_CONFIGURATION_PARAMETERS_RQ_PARAMETER_SELECTOR 2
+#define TMPL_CMD_DCMI_SET_DCMI_CONFIGURATION_PARAMETERS_RQ_SET_SELECTOR 3
+#define TMPL_CMD_DCMI_SET_DCMI_CONFIGURATION_PARAMETERS_RQ_CONFIGURATION_PARAMETER_DATA 4
+
+/* tmpl_cmd_dcmi_set_dcmi_configuration_parameters_rs */
+#define TMPL_CMD_DCMI_SET_DCMI_CONFIGURATION_PARAMETERS_RS_CMD 0
+#define TMPL_CMD_DCMI_SET_DCMI_CONFIGURATION_PARAMETERS_RS_COMP_CODE 1
+#define TMPL_CMD_DCMI_SET_DCMI_CONFIGURATION_PARAMETERS_RS_GROUP_EXTENSION_IDENTIFICATION 2
+
+/* tmpl_cmd_dcmi_set_dcmi_configuration_parameters_activate_dhcp_rq */
+#define TMPL_CMD_DCMI_SET_DCMI_CONFIGURATION_PARAMETERS_ACTIVATE_DHCP_RQ_CMD 0
+#define TMPL_CMD_DCMI_SET_DCMI_CONFIGURATION_PARAMETERS_ACTIVATE_DHCP_RQ_GROUP_EXTENSION_IDENTIFICATION 1
+#define TMPL_CMD_DCMI_SET_DCMI_CONFIGURATION_PARAMETERS_ACTIVATE_DHCP_RQ_PARAMETER_SELECTOR 2
+#define TMPL_CMD_DCMI_SET_DCMI_CONFIGURATION_PARAMETERS_ACTIVATE_DHCP_RQ_SET_SELECTOR 3
+#define TMPL_CMD_DCMI_SET_DCMI_CONFIGURATION_PARAMETERS_ACTIVATE_DHCP_RQ_ACTIVATE 4
+
+/* tmpl_cmd_dcmi_set_dcmi_configuration_parameters_discovery_configuration_rq */
+#define TMPL_CMD_DCMI_SET_DCMI_CONFIGURATION_PARAMETERS_DISCOVERY_CONFIGURATION_RQ_CMD 0
+#define TMPL_CMD_DCMI_SET_DCMI_CONFIGURATION_PARAMETERS_DISCOVERY_CONFIGURATION_RQ_GROUP_EXTENSION_IDENTIFICATION 1
+#define TMPL_CMD_DCMI_SET_DCMI_CONFIGURATION_PARAMETERS_DISCOVERY_CONFIGURATION_RQ_PARAMETER_SELECTOR 2
+#define TMPL_CMD_DCMI_SET_DCMI_CONFIGURATION_PARAMETERS_DISCOVERY_CONFIGURATION_RQ_SET_SELECTOR 3
+#define TMPL_CMD_DCMI_SET_DCMI_CONFIGURATION_PARAMETERS_DISCOVERY_CONFIGURATION_RQ_OPTION_12 4
+#define TMPL_CMD_DCMI_SET_DCMI_CONFIGURATION_PARAMETERS_DISCOVERY_CONFIGURATION_RQ_OPTION_60_WITH_OPTION_43 5
+#define TMPL_CMD_DCMI_SET_DCMI_CONFIGURATION_PARAMETERS_DISCOVERY_CONFIGURATION_RQ_RESERVED 6
+#define TMPL_CMD_DCMI_SET_DCMI_CONFIGURATION_PARAMETERS_DISCOVERY_CONFIGURATION_RQ_RANDOM_BACK_OFF 7
+
+/* tmpl_cmd_dcmi_set_dcmi_configuration_parameters_dhcp_timing_1_rq */
+#define TMPL_CMD_DCMI_SET_DCMI_CONFIGURATION_PARAMETERS_DHCP_TIMING_1_RQ_CMD 0
+#define TMPL_CMD_DCMI_SET_DCMI_CONFIGURATION_PARAMETERS_DHCP_TIMING_1_RQ_GROUP_EXTENSION_IDENTIFICATION 1
+#define TMPL_CMD_DCMI_SET_DCMI_CONFIGURATION_PARAMETERS_DHCP_TIMING_1_RQ_PARAMETER_SELECTOR 2
+#define TMPL_CMD_DCMI_SET_DCMI_CONFIGURATION_PARAMETERS_DHCP_TIMING_1_RQ_SET_SELECTOR 3
+#define TMPL_CMD_DCMI_SET_DCMI_CONFIGURATION_PARAMETERS_DHCP_TIMING_1_RQ_INITIAL_TIMEOUT_INTERVAL 4
+
+/* tmpl_cmd_dcmi_set_dcmi_configuration_parameters_dhcp_timing_2_rq */
+#define TMPL_CMD_DCMI_SET_DCMI_CONFIGURATION_PARAMETERS_DHCP_TIMING_2_RQ_CMD 0
+#define TMPL_CMD_DCMI_SET_DCMI_CONFIGURATION_PARAMETERS_DHCP_TIMING_2_RQ_GROUP_EXTENSION_IDENTIFICATION 1
+#define TMPL_CMD_DCMI_SET_DCMI_CONFIGURATION_PARAMETERS_DHCP_TIMING_2_RQ_PARAMETER_SELECTOR 2
+#define TMPL_CMD_DCMI_SET_DCMI_CONFIGURATION_PARAMETERS_DHCP_TIMING_2_RQ_SET_SELECTOR 3
+#define TMPL_CMD_DCMI_SET_DCMI_CONFIGURATION_PARAMETERS_DHCP_TIMING_2_RQ_SERVER_CONTACT_TIMEOUT_INTERVAL 4
+
+/* tmpl_cmd_dcmi_set_dcmi_configuration_parameters_dhcp_timing_3_rq */
+#define TMPL_CMD_DCMI_SET_DCMI_CONFIGURATION_PARAMETERS_DHCP_TIMING_3_RQ_CMD 0
+#define TMPL_CMD_DCMI_SET_DCMI_CONFIGURATION_PARAMETERS_DHCP_TIMING_3_RQ_GROUP_EXTENSION_IDENTIFICATION 1
+#define TMPL_CMD_DCMI_SET_DCMI_CONFIGURATION_PARAMETERS_DHCP_TIMING_3_RQ_PARAMETER_SELECTOR 2
+#define TMPL_CMD_DCMI_SET_DCMI_CONFIGURATION_PARAMETERS_DHCP_TIMING_3_RQ_SET_SELECTOR 3
+#define TMPL_CMD_DCMI_SET_DCMI_CONFIGURATION_PARAMETERS_DHCP_TIMING_3_RQ_SERVER_CONTACT_RETRY_INTERVAL 4
+
+/* tmpl_cmd_dcmi_get_dcmi_configuration_parameters_rq */
+#define TMPL_CMD_DCMI_GET_DCMI_CONFIGURATION_PARAMETERS_RQ_CMD 0
+#define TMPL_CMD_DCMI_GET_DCMI_CONFIGURATION_PARAMETERS_RQ_GROUP_EXTENSION_IDENTIFICATION 1
+#define TMPL_CMD_DCMI_GET_DCMI_CONFIGURATION_PARAMETERS_RQ_PARAMETER_SELECTOR 2
+#define TMPL_CMD_DCMI_GET_DCMI_CONFIGURATION_PARAMETERS_RQ_SET_SELECTOR 3
+
+/* tmpl_cmd_dcmi_get_dcmi_configuration_parameters_rs */
+#define TMPL_CMD_DCMI_GET_DCMI_CONFIGURATION_PARAMETERS_RS_CMD 0
+#define TMPL_CMD_DCMI_GET_DCMI_CONFIGURATION_PARAMETERS_RS_COMP_CODE 1
+#define TMPL_CMD_DCMI_GET_DCMI_CONFIGURATION_PARAMETERS_RS_GROUP_EXTENSION_IDENTIFICATION 2
+#define TMPL_CMD_DCMI_GET_DCMI_CONFIGURATION_PARAMETERS_RS_DCMI_SPECIFICATION_CONFORMANCE_MAJOR_VERSION 3
+#define TMPL_CMD_DCMI_GET_DCMI_CONFIGURATION_PARAMETERS_RS_DCMI_SPECIFICATION_CONFORMANCE_MINOR_VERSION 4
+#define TMPL_CMD_DCMI_GET_DCMI_CONFIGURATION_PARAMETERS_RS_PARAMETER_REVISION 5
+#define TMPL_CMD_DCMI_GET_DCMI_CONFIGURATION_PARAMETERS_RS_PARAMETER_DATA 6
+
+/* tmpl_cmd_dcmi_get_dcmi_configuration_parameters_discovery_configuration_rs */
+#define TMPL_CMD_DCMI_GET_DCMI_CONFIGURATION_PARAMETERS_DISCOVERY_CONFIGURATION_RS_CMD 0
+#define TMPL_CMD_DCMI_GET_DCMI_CONFIGURATION_PARAMETERS_DISCOVERY_CONFIGURATION_RS_COMP_CODE 1
+#define TMPL_CMD_DCMI_GET_DCMI_CONFIGURATION_PARAMETERS_DISCOVERY_CONFIGURATION_RS_GROUP_EXTENSION_IDENTIFICATION 2
+#define TMPL_CMD_DCMI_GET_DCMI_CONFIGURATION_PARAMETERS_DISCOVERY_CONFIGURATION_RS_DCMI_SPECIFICATION_CONFORMANCE_MAJOR_VERSION 3
+#define TMPL_CMD_DCMI_GET_DCMI_CONFIGURATION_PARAMETERS_DISCOVERY_CONFIGURATION_RS_DCMI_SPECIFICATION_CONFORMANCE_MINOR_VERSION 4
+#define TMPL_CMD_DCMI_GET_DCMI_CONFIGURATION_PARAMETERS_DISCOVERY_CONFIGURATION_RS_PARAMETER_REVISION 5
+#define TMPL_CMD_DCMI_GET_DCMI_CONFIGURATION_PARAMETERS_DISCOVERY_CONFIGURATION_RS_OPTION_12 6
+#define TMPL_CMD_DCMI_GET_DCMI_CONFIGURATION_PARAMETERS_DISCOVERY_CONFIGURATION_RS_OPTION_60_WITH_OPTION_43 7
+#define TMPL_CMD_DCMI_GET_DCMI_CONFIGURATION_PARAMETERS_DISCOVERY_CONFIGURATION_RS_RESERVED 8
+#define TMPL_CMD_DCMI_GET_DCMI_CONFIGURATION_PARAMETERS_DISCOVERY_CONFIGURATION_RS_RANDOM_BACK_OFF 9
+
+/* tmpl_cmd_dcmi_get_dcmi_configuration_parameters_dhcp_timing_1_rs */
+#define TMPL_CMD_DCMI_GET_DCMI_CONFIGURATION_PARAMETERS_DHCP_TIMING_1_RS_CMD 0
+#define TMPL_CMD_DCMI_GET_DCMI_CONFIGURATION_PARAMETERS_DHCP_TIMING_1_RS_COMP_CODE 1
+#define TMPL_CMD_DCMI_GET_DCMI_CONFIGURATION_PARAMETERS_DHCP_TIMING_1_RS_GROUP_EXTENSION_IDENTIFICATION 2
+#define TMPL_CMD_DCMI_GET_DCMI_CONFIGURATION_PARAMETERS_DHCP_TIMING_1_RS_DCMI_SPECIFICATION_CONFORMANCE_MAJOR_VERSION 3
+#define TMPL_CMD_DCMI_GET_DCMI_CONFIGURATION_PARAMETERS_DHCP_TIMING_1_RS_DCMI_SPECIFICATION_CONFORMANCE_MINOR_VERSION 4
+#define TMPL_CMD_DCMI_GET_DCMI_CONFIGURATION_PARAMETERS_DHCP_TIMING_1_RS_PARAMETER_REVISION 5
+#define TMPL_CMD_DCMI_GET_DCMI_CONFIGURATION_PARAMETERS_DHCP_TIMING_1_RS_INITIAL_TIMEOUT_INTERVAL 6
+
+/* tmpl_cmd_dcmi_get_dcmi_configuration_parameters_dhcp_timing_2_rs */
+#define TMPL_CMD_DCMI_GET_DCMI_CONFIGURATION_PARAMETERS_DHCP_TIMING_2_RS_CMD 0
+#define TMPL_CMD_DCMI_GET_DCMI_CONFIGURATION_PARAMETERS_DHCP_TIMING_2_RS_COMP_CODE 1
+#define TMPL_CMD_DCMI_GET_DCMI_CONFIGURATION_PARAMETERS_DHCP_TIMING_2_RS_GROUP_EXTENSION_IDENTIFICATION 2
+#define TMPL_CMD_DCMI_GET_DCMI_CONFIGURATION_PARAMETERS_DHCP_TIMING_2_RS_DCMI_SPECIFICATION_CONFORMANCE_MAJOR_VERSION 3
+#define TMPL_CMD_DCMI_GET_DCMI_CONFIGURATION_PARAMETERS_DHCP_TIMING_2_RS_DCMI_SPECIFICATION_CONFORMANCE_MINOR_VERSION 4
+#define TMPL_CMD_DCMI_GET_DCMI_CONFIGURATION_PARAMETERS_DHCP_TIMING_2_RS_PARAMETER_REVISION 5
+#define TMPL_CMD_DCMI_GET_DCMI_CONFIGURATION_PARAMETERS_DHCP_TIMING_2_RS_SERVER_CONTACT_TIMEOUT_INTERVAL 6
+
+/* tmpl_cmd_dcmi_get_dcmi_configuration_parameters_dhcp_timing_3_rs */
+#define TMPL_CMD_DCMI_GET_DCMI_CONFIGURATION_PARAMETERS_DHCP_TIMING_3_RS_CMD 0
+#define TMPL_CMD_DCMI_GET_DCMI_CONFIGURATION_PARAMETERS_DHCP_TIMING_3_RS_COMP_CODE 1
+#define TMPL_CMD_DCMI_GET_DCMI_CONFIGURATION_PARAMETERS_DHCP_TIMING_3_RS_GROUP_EXTENSION_IDENTIFICATION 2
+#define TMPL_CMD_DCMI_GET_DCMI_CONFIGURATION_PARAMETERS_DHCP_TIMING_3_RS_DCMI_SPECIFICATION_CONFORMANCE_MAJOR_VERSION 3
+#define TMPL_CMD_DCMI_GET_DCMI_CONFIGURATION_PARAMETERS_DHCP_TIMING_3_RS_DCMI_SPECIFICATION_CONFORMANCE_MINOR_VERSION 4
+#define TMPL_CMD_DCMI_GET_DCMI_CONFIGURATION_PARAMETERS_DHCP_TIMING_3_RS_PARAMETER_REVISION 5
+#define TMPL_CMD_DCMI_GET_DCMI_CONFIGURATION_PARAMETERS_DHCP_TIMING_3_RS_SERVER_CONTACT_RETRY_INTERVAL 6
+
+/* tmpl_cmd_dcmi_get_asset_tag_rq */
+#define TMPL_CMD_DCMI_GET_ASSET_TAG_RQ_CMD 0
+#define TMPL_CMD_DCMI_GET_ASSET_TAG_RQ_GROUP_EXTENSION_IDENTIFICATION 1
+#define TMPL_CMD_DCMI_GET_ASSET_TAG_RQ_OFFSET_TO_READ 2
+#define TMPL_CMD_DCMI_GET_ASSET_TAG_RQ_NUMBER_OF_BYTES_TO_READ 3
+
+/* tmpl_cmd_dcmi_get_asset_tag_rs */
+#define TMPL_CMD_DCMI_GET_ASSET_TAG_RS_CMD 0
+#define TMPL_CMD_DCMI_GET_ASSET_TAG_RS_COMP_CODE 1
+#define TMPL_CMD_DCMI_GET_ASSET_TAG_RS_GROUP_EXTENSION_IDENTIFICATION 2
+#define TMPL_CMD_DCMI_GET_ASSET_TAG_RS_TOTAL_ASSET_TAG_LENGTH 3
+#define TMPL_CMD_DCMI_GET_ASSET_TAG_RS_DATA 4
+
+/* tmpl_cmd_dcmi_set_asset_tag_rq */
+#define TMPL_CMD_DCMI_SET_ASSET_TAG_RQ_CMD 0
+#define TMPL_CMD_DCMI_SET_ASSET_TAG_RQ_GROUP_EXTENSION_IDENTIFICATION 1
+#define TMPL_CMD_DCMI_SET_ASSET_TAG_RQ_OFFSET_TO_WRITE 2
+#define TMPL_CMD_DCMI_SET_ASSET_TAG_RQ_NUMBER_OF_BYTES_TO_WRITE 3
+#define TMPL_CMD_DCMI_SET_ASSET_TAG_RQ_DATA 4
+
+/* tmpl_cmd_dcmi_set_asset_tag_rs */
+#define TMPL_CMD_DCMI_SET_ASSET_TAG_RS_CMD 0
+#define TMPL_CMD_DCMI_SET_ASSET_TAG_RS_COMP_CODE 1
+#define TMPL_CMD_DCMI_SET_ASSET_TAG_RS_GROUP_EXTENSION_IDENTIFICATION 2
+#define TMPL_CMD_DCMI_SET_ASSET_TAG_RS_TOTAL_ASSET_TAG_LENGTH_WRITTEN 3
+
+/* tmpl_cmd_dcmi_get_management_controller_identifier_string_rq */
+#define TMPL_CMD_DCMI_GET_MANAGEMENT_CONTROLLER_IDENTIFIER_STRING_RQ_CMD 0
+#define TMPL_CMD_DCMI_GET_MANAGEMENT_CONTROLLER_IDENTIFIER_STRING_RQ_GROUP_EXTENSION_IDENTIFICATION 1
+#define TMPL_CMD_DCMI_GET_MANAGEMENT_CONTROLLER_IDENTIFIER_STRING_RQ_OFFSET_TO_READ 2
+#define TMPL_CMD_DCMI_GET_MANAGEMENT_CONTROLLER_IDENTIFIER_STRING_RQ_NUMBER_OF_BYTES_TO_READ 3
+
+/* tmpl_cmd_dcmi_get_management_controller_identifier_string_rs */
+#define TMPL_CMD_DCMI_GET_MANAGEMENT_CONTROLLER_IDENTIFIER_STRING_RS_CMD 0
+#define TMPL_CMD_DCMI_GET_MANAGEMENT_CONTROLLER_IDENTIFIER_STRING_RS_COMP_CODE 1
+#define TMPL_CMD_DCMI_GET_MANAGEMENT_CONTROLLER_IDENTIFIER_STRING_RS_GROUP_EXTENSION_IDENTIFICATION 2
+#define TMPL_CMD_DCMI_GET_MANAGEMENT_CONTROLLER_IDENTIFIER_STRING_RS_TOTAL_LENGTH 3
+#define TMPL_CMD_DCMI_GET_MANAGEMENT_CONTROLLER_IDENTIFIER_STRING_RS_DATA 4
+
+/* tmpl_cmd_dcmi_set_management_controller_identifier_string_rq */
+#define TMPL_CMD_DCMI_SET_MANAGEMENT_CONTROLLER_IDENTIFIER_STRING_RQ_CMD 0
+#define TMPL_CMD_DCMI_SET_MANAGEMENT_CONTROLLER_IDENTIFIER_STRING_RQ_GROUP_EXTENSION_IDENTIFICATION 1
+#define TMPL_CMD_DCMI_SET_MANAGEMENT_CONTROLLER_IDENTIFIER_STRING_RQ_OFFSET_TO_WRITE 2
+#define TMPL_CMD_DCMI_SET_MANAGEMENT_CONTROLLER_IDENTIFIER_STRING_RQ_NUMBER_OF_BYTES_TO_WRITE 3
+#define TMPL_CMD_DCMI_SET_MANAGEMENT_CONTROLLER_IDENTIFIER_STRING_RQ_DATA 4
+
+/* tmpl_cmd_dcmi_set_management_controller_identifier_string_rs */
+#define TMPL_CMD_DCMI_SET_MANAGEMENT_CONTROLLER_IDENTIFIER_STRING_RS_CMD 0
+#define TMPL_CMD_DCMI_SET_MANAGEMENT_CONTROLLER_IDENTIFIER_STRING_RS_COMP_CODE 1
+#define TMPL_CMD_DCMI_SET_MANAGEMENT_CONTROLLER_IDENTIFIER_STRING_RS_GROUP_EXTENSION_IDENTIFICATION 2
+#define TMPL_CMD_DCMI_SET_MANAGEMENT_CONTROLLER_IDENTIFIER_STRING_RS_TOTAL_LENGTH_WRITTEN 3
+
+/* tmpl_cmd_dcmi_get_dcmi_sensor_info_rq */
+#define TMPL_CMD_DCMI_GET_DCMI_SENSOR_INFO_RQ_CMD 0
+#define TMPL_CMD_DCMI_GET_DCMI_SENSOR_INFO_RQ_GROUP_EXTENSION_IDENTIFICATION 1
+#define TMPL_CMD_DCMI_GET_DCMI_SENSOR_INFO_RQ_SENSOR_TYPE 2
+#define TMPL_CMD_DCMI_GET_DCMI_SENSOR_INFO_RQ_ENTITY_ID 3
+#define TMPL_CMD_DCMI_GET_DCMI_SENSOR_INFO_RQ_ENTITY_INSTANCE 4
+#define TMPL_CMD_DCMI_GET_DCMI_SENSOR_INFO_RQ_ENTITY_INSTANCE_START 5
+
+/* tmpl_cmd_dcmi_get_dcmi_sensor_info_rs */
+#define TMPL_CMD_DCMI_GET_DCMI_SENSOR_INFO_RS_CMD 0
+#define TMPL_CMD_DCMI_GET_DCMI_SENSOR_INFO_RS_COMP_CODE 1
+#define TMPL_CMD_DCMI_GET_DCMI_SENSOR_INFO_RS_GROUP_EXTENSION_IDENTIFICATION 2
+#define TMPL_CMD_DCMI_GET_DCMI_SENSOR_INFO_RS_TOTAL_NUMBER_OF_AVAILABLE_INSTANCES 3
+#define TMPL_CMD_DCMI_GET_DCMI_SENSOR_INFO_RS_NUMBER_OF_RECORD_IDS_IN_THIS_RESPONSE 4
+#define TMPL_CMD_DCMI_GET_DCMI_SENSOR_INFO_RS_SDR_RECORD_IDS 5
+
+/* tmpl_cmd_dcmi_get_power_reading_rq */
+#define TMPL_CMD_DCMI_GET_POWER_READING_RQ_CMD 0
+#define TMPL_CMD_DCMI_GET_POWER_READING_RQ_GROUP_EXTENSION_IDENTIFICATION 1
+#define TMPL_CMD_DCMI_GET_POWER_READING_RQ_MODE 2
+#define TMPL_CMD_DCMI_GET_POWER_READING_RQ_MODE_ATTRIBUTES 3
+#define TMPL_CMD_DCMI_GET_POWER_READING_RQ_RESERVED 4
+
+/* tmpl_cmd_dcmi_get_power_reading_rs */
+#define TMPL_CMD_DCMI_GET_POWER_READING_RS_CMD 0
+#define TMPL_CMD_DCMI_GET_POWER_READING_RS_COMP_CODE 1
+#define TMPL_CMD_DCMI_GET_POWER_READING_RS_GROUP_EXTENSION_IDENTIFICATION 2
+#define TMPL_CMD_DCMI_GET_POWER_READING_RS_CURRENT_POWER 3
+#define TMPL_CMD_DCMI_GET_POWER_READING_RS_MINIMUM_POWER_OVER_SAMPLING_DURATION 4
+#define TMPL_CMD_DCMI_GET_POWER_READING_RS_MAXIMUM_POWER_OVER_SAMPLING_DURATION 5
+#define TMPL_CMD_DCMI_GET_POWER_READING_RS_AVERAGE_POWER_OVER_SAMPLING_DURATION 6
+#define TMPL_CMD_DCMI_GET_POWER_READING_RS_TIME_STAMP 7
+#define TMPL_CMD_DCMI_GET_POWER_READING_RS_STATISTICS_REPORTING_TIME_PERIOD 8
+#define TMPL_CMD_DCMI_GET_POWER_READING_RS_POWER_READING_STATE_RESERVED1 9
+#define TMPL_CMD_DCMI_GET_POWER_READING_RS_POWER_READING_STATE_POWER_MEASUREMENT 10
+#define TMPL_CMD_DCMI_GET_POWER_READING_RS_POWER_READING_STATE_RESERVED2 11
+
+/* tmpl_cmd_dcmi_get_power_limit_rq */
+#define TMPL_CMD_DCMI_GET_POWER_LIMIT_RQ_CMD 0
+#define TMPL_CMD_DCMI_GET_POWER_LIMIT_RQ_GROUP_EXTENSION_IDENTIFICATION 1
+#define TMPL_CMD_DCMI_GET_POWER_LIMIT_RQ_RESERVED 2
+
+/* tmpl_cmd_dcmi_get_power_limit_rs */
+#define TMPL_CMD_DCMI_GET_POWER_LIMIT_RS_CMD 0
+#define TMPL_CMD_DCMI_GET_POWER_LIMIT_RS_COMP_CODE 1
+#define TMPL_CMD_DCMI_GET_POWER_LIMIT_RS_GROUP_EXTENSION_IDENTIFICATION 2
+#define TMPL_CMD_DCMI_GET_POWER_LIMIT_RS_RESERVED1 3
+#define TMPL_CMD_DCMI_GET_POWER_LIMIT_RS_EXCEPTION_ACTIONS 4
+#define TMPL_CMD_DCMI_GET_POWER_LIMIT_RS_POWER_LIMIT_REQUESTED 5
+#define TMPL_CMD_DCMI_GET_POWER_LIMIT_RS_CORRECTION_TIME_LIMIT 6
+#define TMPL_CMD_DCMI_GET_POWER_LIMIT_RS_RESERVED2 7
+#define TMPL_CMD_DCMI_GET_POWER_LIMIT_RS_MANAGEMENT_APPLICATION_STATISTICS_SAMPLING_PERIOD 8
+
+/* tmpl_cmd_dcmi_set_power_limit_rq */
+#define TMPL_CMD_DCMI_SET_POWER_LIMIT_RQ_CMD 0
+#define TMPL_CMD_DCMI_SET_POWER_LIMIT_RQ_GROUP_EXTENSION_IDENTIFICATION 1
+#define TMPL_CMD_DCMI_SET_POWER_LIMIT_RQ_RESERVED1 2
+#define TMPL_CMD_DCMI_SET_POWER_LIMIT_RQ_EXCEPTION_ACTIONS 3
+#define TMPL_CMD_DCMI_SET_POWER_LIMIT_RQ_POWER_LIMIT_REQUESTED 4
+#define TMPL_CMD_DCMI_SET_POWER_LIMIT_RQ_CORRECTION_TIME_LIMIT 5
+#define TMPL_CMD_DCMI_SET_POWER_LIMIT_RQ_RESERVED2 6
+#define TMPL_CMD_DCMI_SET_POWER_LIMIT_RQ_MANAGEMENT_APPLICATION_STATISTICS_SAMPLING_PERIOD 7
+
+/* tmpl_cmd_dcmi_set_power_limit_rs */
+#define TMPL_CMD_DCMI_SET_POWER_LIMIT_RS_CMD 0
+#define TMPL_CMD_DCMI_SET_POWER_LIMIT_RS_COMP_CODE 1
+#define TMPL_CMD_DCMI_SET_POWER_LIMIT_RS_GROUP_EXTENSION_IDENTIFICATION 2
+
+/* tmpl_cmd_dcmi_activate_deactivate_power_limit_rq */
+#define TMPL_CMD_DCMI_ACTIVATE_DEACTIVATE_POWER_LIMIT_RQ_CMD 0
+#define TMPL_CMD_DCMI_ACTIVATE_DEACTIVATE_POWER_LIMIT_RQ_GROUP_EXTENSION_IDENTIFICATION 1
+#define TMPL_CMD_DCMI_ACTIVATE_DEACTIVATE_POWER_LIMIT_RQ_POWER_LIMIT_ACTIVATION 2
+#define TMPL_CMD_DCMI_ACTIVATE_DEACTIVATE_POWER_LIMIT_RQ_RESERVED 3
+
+/* tmpl_cmd_dcmi_activate_deactivate_power_limit_rs */
+#define TMPL_CMD_DCMI_ACTIVATE_DEACTIVATE_POWER_LIMIT_RS_CMD 0
+#define TMPL_CMD_DCMI_ACTIVATE_DEACTIVATE_POWER_LIMIT_RS_COMP_CODE 1
+#define TMPL_CMD_DCMI_ACTIVATE_DEACTIVATE_POWER_LIMIT_RS_GROUP_EXTENSION_IDENTIFICATION 2
+
+/* tmpl_cmd_dcmi_get_thermal_limit_rq */
+#define TMPL_CMD_DCMI_GET_THERMAL_LIMIT_RQ_CMD 0
+#define TMPL_CMD_DCMI_GET_THERMAL_LIMIT_RQ_GROUP_EXTENSION_IDENTIFICATION 1
+#define TMPL_CMD_DCMI_GET_THERMAL_LIMIT_RQ_ENTITY_ID 2
+#define TMPL_CMD_DCMI_GET_THERMAL_LIMIT_RQ_ENTITY_INSTANCE 3
+
+/* tmpl_cmd_dcmi_get_thermal_limit_rs */
+#define TMPL_CMD_DCMI_GET_THERMAL_LIMIT_RS_CMD 0
+#define TMPL_CMD_DCMI_GET_THERMAL_LIMIT_RS_COMP_CODE 1
+#define TMPL_CMD_DCMI_GET_THERMAL_LIMIT_RS_GROUP_EXTENSION_IDENTIFICATION 2
+#define TMPL_CMD_DCMI_GET_THERMAL_LIMIT_RS_TEMPERATURE_LIMIT 3
+#define TMPL_CMD_DCMI_GET_THERMAL_LIMIT_RS_EXCEPTION_ACTIONS_RESERVED1 4
+#define TMPL_CMD_DCMI_GET_THERMAL_LIMIT_RS_EXCEPTION_ACTIONS_LOG_EVENT_TO_SEL_ONLY 5
+#define TMPL_CMD_DCMI_GET_THERMAL_LIMIT_RS_EXCEPTION_ACTIONS_HARD_POWER_OFF_SYSTEM_AND_LOG_EVENT 6
+#define TMPL_CMD_DCMI_GET_THERMAL_LIMIT_RS_EXCEPTION_ACTIONS_RESERVED2 7
+#define TMPL_CMD_DCMI_GET_THERMAL_LIMIT_RS_EXCEPTION_TIME 8
+
+/* tmpl_cmd_dcmi_set_thermal_limit_rq */
+#define TMPL_CMD_DCMI_SET_THERMAL_LIMIT_RQ_CMD 0
+#define TMPL_CMD_DCMI_SET_THERMAL_LIMIT_RQ_GROUP_EXTENSION_IDENTIFICATION 1
+#define TMPL_CMD_DCMI_SET_THERMAL_LIMIT_RQ_ENTITY_ID 2
+#define TMPL_CMD_DCMI_SET_THERMAL_LIMIT_RQ_ENTITY_INSTANCE 3
+#define TMPL_CMD_DCMI_SET_THERMAL_LIMIT_RQ_TEMPERATURE_LIMIT 4
+#define TMPL_CMD_DCMI_SET_THERMAL_LIMIT_RQ_EXCEPTION_ACTIONS_RESERVED1 5
+#define TMPL_CMD_DCMI_SET_THERMAL_LIMIT_RQ_EXCEPTION_ACTIONS_LOG_EVENT_TO_SEL_ONLY 6
+#define TMPL_CMD_DCMI_SET_THERMAL_LIMIT_RQ_EXCEPTION_ACTIONS_HARD_POWER_OFF_SYSTEM_AND_LOG_EVENT 7
+#define TMPL_CMD_DCMI_SET_THERMAL_LIMIT_RQ_EXCEPTION_ACTIONS_RESERVED2 8
+#define TMPL_CMD_DCMI_SET_THERMAL_LIMIT_RQ_EXCEPTION_TIME 9
+
+/* tmpl_cmd_dcmi_set_thermal_limit_rs */
+#define TMPL_CMD_DCMI_SET_THERMAL_LIMIT_RS_CMD 0
+#define TMPL_CMD_DCMI_SET_THERMAL_LIMIT_RS_COMP_CODE 1
+#define TMPL_CMD_DCMI_SET_THERMAL_LIMIT_RS_GROUP_EXTENSION_IDENTIFICATION 2
+
+/* tmpl_cmd_dcmi_get_temperature_reading_rq */
+#define TMPL_CMD_DCMI_GET_TEMPERATURE_READING_RQ_CMD 0
+#define TMPL_CMD_DCMI_GET_TEMPERATURE_READING_RQ_GROUP_EXTENSION_IDENTIFICATION 1
+#define TMPL_CMD_DCMI_GET_TEMPERATURE_READING_RQ_SENSOR_TYPE 2
+#define TMPL_CMD_DCMI_GET_TEMPERATURE_READING_RQ_ENTITY_ID 3
+#define TMPL_CMD_DCMI_GET_TEMPERATURE_READING_RQ_ENTITY_INSTANCE 4
+#define TMPL_CMD_DCMI_GET_TEMPERATURE_READING_RQ_ENTITY_INSTANCE_START 5
+
+/* tmpl_cmd_dcmi_get_temperature_reading_rs */
+#define TMPL_CMD_DCMI_GET_TEMPERATURE_READING_RS_CMD 0
+#define TMPL_CMD_DCMI_GET_TEMPERATURE_READING_RS_COMP_CODE 1
+#define TMPL_CMD_DCMI_GET_TEMPERATURE_READING_RS_GROUP_EXTENSION_IDENTIFICATION 2
+#define TMPL_CMD_DCMI_GET_TEMPERATURE_READING_RS_TOTAL_NUMBER_OF_AVAILABLE_INSTANCES 3
+#define TMPL_CMD_DCMI_GET_TEMPERATURE_READING_RS_NUMBER_OF_SETS_OF_TEMPERATURE_DATA 4
+#define TMPL_CMD_DCMI_GET_TEMPERATURE_READING_RS_TEMPERATURE1 5
+#define TMPL_CMD_DCMI_GET_TEMPERATURE_READING_RS_TEMPERATURE2 6
+#define TMPL_CMD_DCMI_GET_TEMPERATURE_READING_RS_TEMPERATURE3 7
+#define TMPL_CMD_DCMI_GET_TEMPERATURE_READING_RS_TEMPERATURE4 8
+#define TMPL_CMD_DCMI_GET_TEMPERATURE_READING_RS_TEMPERATURE5 9
+#define TMPL_CMD_DCMI_GET_TEMPERATURE_READING_RS_TEMPERATURE6 10
+#define TMPL_CMD_DCMI_GET_TEMPERATURE_READING_RS_TEMPERATURE7 11
+#define TMPL_CMD_DCMI_GET_TEMPERATURE_READING_RS_TEMPERATURE8 12
+
+/* tmpl_cmd_get_device_id_rq */
+#define TMPL_CMD_GET_DEVICE_ID_RQ_CMD 0
+
+/* tmpl_cmd_get_device_id_rs */
+#define TMPL_CMD_GET_DEVICE_ID_RS_CMD 0
+#define TMPL_CMD_GET_DEVICE_ID_RS_COMP_CODE 1
+#define TMPL_CMD_GET_DEVICE_ID_RS_DEVICE_ID 2
+#define TMPL_CMD_GET_DEVICE_ID_RS_DEVICE_REVISION_REVISION 3
+#define TMPL_CMD_GET_DEVICE_ID_RS_DEVICE_REVISION_RESERVED1 4
+#define TMPL_CMD_GET_DEVICE_ID_RS_DEVICE_REVISION_SDR_SUPPORT 5
+#define TMPL_CMD_GET_DEVICE_ID_RS_FIRMWARE_REVISION1_MAJOR_REVISION 6
+#define TMPL_CMD_GET_DEVICE_ID_RS_FIRMWARE_REVISION1_DEVICE_AVAILABLE 7
+#define TMPL_CMD_GET_DEVICE_ID_RS_FIRMWARE_REVISION2_MINOR_REVISION 8
+#define TMPL_CMD_GET_DEVICE_ID_RS_IPMI_VERSION_MAJOR 9
+#define TMPL_CMD_GET_DEVICE_ID_RS_IPMI_VERSION_MINOR 10
+#define TMPL_CMD_GET_DEVICE_ID_RS_ADDITIONAL_DEVICE_SUPPORT_SENSOR_DEVICE 11
+#define TMPL_CMD_GET_DEVICE_ID_RS_ADDITIONAL_DEVICE_SUPPORT_SDR_REPOSITORY_DEVICE 12
+#define TMPL_CMD_GET_DEVICE_ID_RS_ADDITIONAL_DEVICE_SUPPORT_SEL_DEVICE 13
+#define TMPL_CMD_GET_DEVICE_ID_RS_ADDITIONAL_DEVICE_SUPPORT_FRU_INVENTORY_DEVICE 14
+#define TMPL_CMD_GET_DEVICE_ID_RS_ADDITIONAL_DEVICE_SUPPORT_IPMB_EVENT_RECEIVER 15
+#define TMPL_CMD_GET_DEVICE_ID_RS_ADDITIONAL_DEVICE_SUPPORT_IPMB_EVENT_GENERATOR 16
+#define TMPL_CMD_GET_DEVICE_ID_RS_ADDITIONAL_DEVICE_SUPPORT_BRIDGE 17
+#define TMPL_CMD_GET_DEVICE_ID_RS_ADDITIONAL_DEVICE_SUPPORT_CHASSIS_DEVICE 18
+#define TMPL_CMD_GET_DEVICE_ID_RS_MANUFACTURER_ID_ID 19
+#define TMPL_CMD_GET_DEVICE_ID_RS_MANUFACTURER_ID_RESERVED1 20
+#define TMPL_CMD_GET_DEVICE_ID_RS_PRODUCT_ID 21
+#define TMPL_CMD_GET_DEVICE_ID_RS_AUXILIARY_FIRMWARE_REVISION_INFORMATION 22
+
+/* tmpl_cmd_cold_reset_rq */
+#define TMPL_CMD_COLD_RESET_RQ_CMD 0
+
+/* tmpl_cmd_cold_reset_rs */
+#define TMPL_CMD_COLD_RESET_RS_CMD 0
+#define TMPL_CMD_COLD_RESET_RS_COMP_CODE 1
+
+/* tmpl_cmd_warm_reset_rq */
+#define TMPL_CMD_WARM_RESET_RQ_CMD 0
+
+/* tmpl_cmd_warm_reset_rs */
+#define TMPL_CMD_WARM_RESET_RS_CMD 0
+#define TMPL_CMD_WARM_RESET_RS_COMP_CODE 1
+
+/* tmpl_cmd_set_acpi_power_state_rq */
+#define TMPL_CMD_SET_ACPI_POWER_STATE_RQ_CMD 0
+#define TMPL_CMD_SET_ACPI_POWER_STATE_RQ_SYSTEM_POWER_STATE_ENUMERATION 1
+#define TMPL_CMD_SET_ACPI_POWER_STATE_RQ_SET_SYSTEM_POWER_STATE 2
+#define TMPL_CMD_SET_ACPI_POWER_STATE_RQ_DEVICE_POWER_STATE_ENUMERATION 3
+#define TMPL_CMD_SET_ACPI_POWER_STATE_RQ_SET_DEVICE_POWER_STATE 4
+
+/* tmpl_cmd_set_acpi_power_state_rs */
+#define TMPL_CMD_SET_ACPI_POWER_STATE_RS_CMD 0
+#define TMPL_CMD_SET_ACPI_POWER_STATE_RS_COMP_CODE 1
+
+/* tmpl_cmd_get_acpi_power_state_rq */
+#define TMPL_CMD_GET_ACPI_POWER_STATE_RQ_CMD 0
+
+/* tmpl_cmd_get_acpi_power_state_rs */
+#define TMPL_CMD_GET_ACPI_POWER_STATE_RS_CMD 0
+#define TMPL_CMD_GET_ACPI_POWER_STATE_RS_COMP_CODE 1
+#define TMPL_CMD_GET_ACPI_POWER_STATE_RS_SYSTEM_POWER_STATE_ENUMERATION 2
+#define TMPL_CMD_GET_ACPI_POWER_STATE_RS_RESERVED1 3
+#define TMPL_CMD_GET_ACPI_POWER_STATE_RS_DEVICE_POWER_STATE_ENUMERATION 4
+#define TMPL_CMD_GET_ACPI_POWER_STATE_RS_RESERVED2 5
+
+/* tmpl_cmd_get_self_test_results_rq */
+#define TMPL_CMD_GET_SELF_TEST_RESULTS_RQ_CMD 0
+
+/* tmpl_cmd_get_self_test_results_rs */
+#define TMPL_CMD_GET_SELF_TEST_RESULTS_RS_CMD 0
+#define TMPL_CMD_GET_SELF_TEST_RESULTS_RS_COMP_CODE 1
+#define TMPL_CMD_GET_SELF_TEST_RESULTS_RS_SELF_TEST_RESULT 2
+#define TMPL_CMD_GET_SELF_TEST_RESULTS_RS_CONTROLLER_OPERATION_FIRMWARE_CORRUPTED 3
+#define TMPL_CMD_GET_SELF_TEST_RESULTS_RS_CONTROLLER_UPDATE_BOOT_BLOCK_FIRMWARE_CORRUPTED 4
+#define TMPL_CMD_GET_SELF_TEST_RESULTS_RS_INTERNAL_USE_AREA_OF_BMC_FRU_CORRUPTED 5
+#define TMPL_CMD_GET_SELF_TEST_RESULTS_RS_SDR_REPOSITORY_EMPTY 6
+#define TMPL_CMD_GET_SELF_TEST_RESULTS_RS_IPMB_SIGNAL_LINES_DO_NOT_RESPOND 7
+#define TMPL_CMD_GET_SELF_TEST_RESULTS_RS_CANNOT_ACCESS_BMC_FRU_DEVICE 8
+#define TMPL_CMD_GET_SELF_TEST_RESULTS_RS_CANNOT_ACCESS_SDR_REPOSITORY 9
+#define TMPL_CMD_GET_SELF_TEST_RESULTS_RS_CANNOT_ACCESS_SEL_DEVICE 10
+
+/* tmpl_cmd_get_device_guid_rq */
+#define TMPL_CMD_GET_DEVICE_GUID_RQ_CMD 0
+
+/* tmpl_cmd_get_device_guid_rs */
+#define TMPL_CMD_GET_DEVICE_GUID_RS_CMD 0
+#define TMPL_CMD_GET_DEVICE_GUID_RS_COMP_CODE 1
+#define TMPL_CMD_GET_DEVICE_GUID_RS_GUID 2
+
+/* tmpl_cmd_get_device_guid_format_rs */
+#define TMPL_CMD_GET_DEVICE_GUID_FORMAT_RS_CMD 0
+#define TMPL_CMD_GET_DEVICE_GUID_FORMAT_RS_COMP_CODE 1
+#define TMPL_CMD_GET_DEVICE_GUID_FORMAT_RS_NODE 2
+#define TMPL_CMD_GET_DEVICE_GUID_FORMAT_RS_CLOCK_SEQ_LOW 3
+#define TMPL_CMD_GET_DEVICE_GUID_FORMAT_RS_CLOCK_SEQ_HI_AND_RESERVED 4
+#define TMPL_CMD_GET_DEVICE_GUID_FORMAT_RS_TIME_HIGH_AND_VERSION 5
+#define TMPL_CMD_GET_DEVICE_GUID_FORMAT_RS_TIME_MID 6
+#define TMPL_CMD_GET_DEVICE_GUID_FORMAT_RS_TIME_LOW 7
+
+/* tmpl_cmd_set_event_receiver_rq */
+#define TMPL_CMD_SET_EVENT_RECEIVER_RQ_CMD 0
+#define TMPL_CMD_SET_EVENT_RECEIVER_RQ_EVENT_RECEIVER_SLAVE_ADDRESS 1
+#define TMPL_CMD_SET_EVENT_RECEIVER_RQ_EVENT_RECEIVER_LUN 2
+#define TMPL_CMD_SET_EVENT_RECEIVER_RQ_RESERVED 3
+
+/* tmpl_cmd_set_event_receiver_rs */
+#define TMPL_CMD_SET_EVENT_RECEIVER_RS_CMD 0
+#define TMPL_CMD_SET_EVENT_RECEIVER_RS_COMP_CODE 1
+
+/* tmpl_cmd_get_event_receiver_rq */
+#define TMPL_CMD_GET_EVENT_RECEIVER_RQ_CMD 0
+
+/* tmpl_cmd_get_event_receiver_rs */
+#define TMPL_CMD_GET_EVENT_RECEIVER_RS_CMD 0
+#define TMPL_CMD_GET_EVENT_RECEIVER_RS_COMP_CODE 1
+#define TMPL_CMD_GET_EVENT_RECEIVER_RS_EVENT_RECEIVER_SLAVE_ADDRESS 2
+#define TMPL_CMD_GET_EVENT_RECEIVER_RS_EVENT_RECEIVER_LUN 3
+#define TMPL_CMD_GET_EVENT_RECEIVER_RS_RESERVED 4
+
+/* tmpl_cmd_platform_event_rq */
+#define TMPL_CMD_PLATFORM_EVENT_RQ_CMD 0
+#define TMPL_CMD_PLATFORM_EVENT_RQ_GENERATOR_ID 1
+#define TMPL_CMD_PLATFORM_EVENT_RQ_EVENT_MESSAGE_FORMAT_VERSION 2
+#define TMPL_CMD_PLATFORM_EVENT_RQ_SENSOR_TYPE 3
+#define TMPL_CMD_PLATFORM_EVENT_RQ_SENSOR_NUMBER 4
+#define TMPL_CMD_PLATFORM_EVENT_RQ_EVENT_TYPE_CODE 5
+#define TMPL_CMD_PLATFORM_EVENT_RQ_EVENT_DIR 6
+#define TMPL_CMD_PLATFORM_EVENT_RQ_EVENT_DATA1 7
+#define TMPL_CMD_PLATFORM_EVENT_RQ_EVENT_DATA2 8
+#define TMPL_CMD_PLATFORM_EVENT_RQ_EVENT_DATA3 9
+
+/* tmpl_cmd_platform_event_rs */
+#define TMPL_CMD_PLATFORM_EVENT_RS_CMD 0
+#define TMPL_CMD_PLATFORM_EVENT_RS_COMP_CODE 1
+
+/* tmpl_cmd_get_netfn_support_rq */
+#define TMPL_CMD_GET_NETFN_SUPPORT_RQ_CMD 0
+#define TMPL_CMD_GET_NETFN_SUPPORT_RQ_CHANNEL_NUMBER 1
+#define TMPL_CMD_GET_NETFN_SUPPORT_RQ_RESERVED 2
+
+/* tmpl_cmd_get_netfn_support_rs */
+#define TMPL_CMD_GET_NETFN_SUPPORT_RS_CMD 0
+#define TMPL_CMD_GET_NETFN_SUPPORT_RS_COMP_CODE 1
+#define TMPL_CMD_GET_NETFN_SUPPORT_RS_LUN0 2
+#define TMPL_CMD_GET_NETFN_SUPPORT_RS_LUN1 3
+#define TMPL_CMD_GET_NETFN_SUPPORT_RS_LUN2 4
+#define TMPL_CMD_GET_NETFN_SUPPORT_RS_LUN3 5
+#define TMPL_CMD_GET_NETFN_SUPPORT_RS_LUN0_NETFN_SUPPORT_BITMASK 6
+#define TMPL_CMD_GET_NETFN_SUPPORT_RS_LUN1_NETFN_SUPPORT_BITMASK 7
+#define TMPL_CMD_GET_NETFN_SUPPORT_RS_LUN2_NETFN_SUPPORT_BITMASK 8
+#define TMPL_CMD_GET_NETFN_SUPPORT_RS_LUN3_NETFN_SUPPORT_BITMASK 9
+
+/* tmpl_cmd_get_command_support_rq */
+#define TMPL_CMD_GET_COMMAND_SUPPORT_RQ_CMD 0
+#define TMPL_CMD_GET_COMMAND_SUPPORT_RQ_CHANNEL_NUMBER 1
+#define TMPL_CMD_GET_COMMAND_SUPPORT_RQ_RESERVED1 2
+#define TMPL_CMD_GET_COMMAND_SUPPORT_RQ_NET_FN 3
+#define TMPL_CMD_GET_COMMAND_SUPPORT_RQ_OPERATION 4
+#define TMPL_CMD_GET_COMMAND_SUPPORT_RQ_LUN 5
+#define TMPL_CMD_GET_COMMAND_SUPPORT_RQ_RESERVED2 6
+#define TMPL_CMD_GET_COMMAND_SUPPORT_RQ_NET_FN_DATA 7
+
+/* tmpl_cmd_get_command_support_rs */
+#define TMPL_CMD_GET_COMMAND_SUPPORT_RS_CMD 0
+#define TMPL_CMD_GET_COMMAND_SUPPORT_RS_COMP_CODE 1
+#define TMPL_CMD_GET_COMMAND_SUPPORT_RS_COMMAND_SUPPORT_MASK 2
+
+/* tmpl_cmd_get_command_sub_function_support_rq */
+#define TMPL_CMD_GET_COMMAND_SUB_FUNCTION_SUPPORT_RQ_CMD 0
+#define TMPL_CMD_GET_COMMAND_SUB_FUNCTION_SUPPORT_RQ_CHANNEL_NUMBER 1
+#define TMPL_CMD_GET_COMMAND_SUB_FUNCTION_SUPPORT_RQ_RESERVED1 2
+#define TMPL_CMD_GET_COMMAND_SUB_FUNCTION_SUPPORT_RQ_NET_FN 3
+#define TMPL_CMD_GET_COMMAND_SUB_FUNCTION_SUPPORT_RQ_RESERVED2 4
+#define TMPL_CMD_GET_COMMAND_SUB_FUNCTION_SUPPORT_RQ_LUN 5
+#define TMPL_CMD_GET_COMMAND_SUB_FUNCTION_SUPPORT_RQ_RESERVED3 6
+#define TMPL_CMD_GET_COMMAND_SUB_FUNCTION_SUPPORT_RQ_COMMAND 7
+#define TMPL_CMD_GET_COMMAND_SUB_FUNCTION_SUPPORT_RQ_NET_FN_DATA 8
+
+/* tmpl_cmd_get_command_sub_function_support_specification_errata_rs */
+#define TMPL_CMD_GET_COMMAND_SUB_FUNCTION_SUPPORT_SPECIFICATION_ERRATA_RS_CMD 0
+#define TMPL_CMD_GET_COMMAND_SUB_FUNCTION_SUPPORT_SPECIFICATION_ERRATA_RS_COMP_CODE 1
+#define TMPL_CMD_GET_COMMAND_SUB_FUNCTION_SUPPORT_SPECIFICATION_ERRATA_RS_ERRATA_VERSION 2
+#define TMPL_CMD_GET_COMMAND_SUB_FUNCTION_SUPPORT_SPECIFICATION_ERRATA_RS_SPECIFICATION_TYPE 3
+#define TMPL_CMD_GET_COMMAND_SUB_FUNCTION_SUPPORT_SPECIFICATION_ERRATA_RS_SPECIFICATION_VERSION 4
+#define TMPL_CMD_GET_COMMAND_SUB_FUNCTION_SUPPORT_SPECIFICATION_ERRATA_RS_SPECIFICATION_REVISION 5
+#define TMPL_CMD_GET_COMMAND_SUB_FUNCTION_SUPPORT_SPECIFICATION_ERRATA_RS_SUB_FUNCTION_SUPPORT_MASK 6
+
+/* tmpl_cmd_get_command_sub_function_support_extension_errata_rs */
+#define TMPL_CMD_GET_COMMAND_SUB_FUNCTION_SUPPORT_EXTENSION_ERRATA_RS_CMD 0
+#define TMPL_CMD_GET_COMMAND_SUB_FUNCTION_SUPPORT_EXTENSION_ERRATA_RS_COMP_CODE 1
+#define TMPL_CMD_GET_COMMAND_SUB_FUNCTION_SUPPORT_EXTENSION_ERRATA_RS_OEM_GROUP_DEFINING_BODY_ERRATA 2
+#define TMPL_CMD_GET_COMMAND_SUB_FUNCTION_SUPPORT_EXTENSION_ERRATA_RS_SPECIFICATION_VERSION 3
+#define TMPL_CMD_GET_COMMAND_SUB_FUNCTION_SUPPORT_EXTENSION_ERRATA_RS_SPECIFICATION_REVISION 4
+#define TMPL_CMD_GET_COMMAND_SUB_FUNCTION_SUPPORT_EXTENSION_ERRATA_RS_SUB_FUNCTION_SUPPORT_MASK 5
+
+/* tmpl_cmd_get_configurable_commands_rq */
+#define TMPL_CMD_GET_CONFIGURABLE_COMMANDS_RQ_CMD 0
+#define TMPL_CMD_GET_CONFIGURABLE_COMMANDS_RQ_CHANNEL_NUMBER 1
+#define TMPL_CMD_GET_CONFIGURABLE_COMMANDS_RQ_RESERVED1 2
+#define TMPL_CMD_GET_CONFIGURABLE_COMMANDS_RQ_NET_FN 3
+#define TMPL_CMD_GET_CONFIGURABLE_COMMANDS_RQ_OPERATION 4
+#define TMPL_CMD_GET_CONFIGURABLE_COMMANDS_RQ_LUN 5
+#define TMPL_CMD_GET_CONFIGURABLE_COMMANDS_RQ_RESERVED2 6
+#define TMPL_CMD_GET_CONFIGURABLE_COMMANDS_RQ_NET_FN_DATA 7
+
+/* tmpl_cmd_get_configurable_commands_rs */
+#define TMPL_CMD_GET_CONFIGURABLE_COMMANDS_RS_CMD 0
+#define TMPL_CMD_GET_CONFIGURABLE_COMMANDS_RS_COMP_CODE 1
+#define TMPL_CMD_GET_CONFIGURABLE_COMMANDS_RS_COMMAND_SUPPORT_MASK 2
+
+/* tmpl_cmd_get_configurable_command_sub_functions_rq */
+#define TMPL_CMD_GET_CONFIGURABLE_COMMAND_SUB_FUNCTIONS_RQ_CMD 0
+#define TMPL_CMD_GET_CONFIGURABLE_COMMAND_SUB_FUNCTIONS_RQ_CHANNEL_NUMBER 1
+#define TMPL_CMD_GET_CONFIGURABLE_COMMAND_SUB_FUNCTIONS_RQ_RESERVED1 2
+#define TMPL_CMD_GET_CONFIGURABLE_COMMAND_SUB_FUNCTIONS_RQ_NET_FN 3
+#define TMPL_CMD_GET_CONFIGURABLE_COMMAND_SUB_FUNCTIONS_RQ_RESERVED2 4
+#define TMPL_CMD_GET_CONFIGURABLE_COMMAND_SUB_FUNCTIONS_RQ_LUN 5
+#define TMPL_CMD_GET_CONFIGURABLE_COMMAND_SUB_FUNCTIONS_RQ_RESERVED3 6
+#define TMPL_CMD_GET_CONFIGURABLE_COMMAND_SUB_FUNCTIONS_RQ_COMMAND 7
+#define TMPL_CMD_GET_CONFIGURABLE_COMMAND_SUB_FUNCTIONS_RQ_NET_FN_DATA 8
+
+/* tmpl_cmd_get_configurable_command_sub_functions_rs */
+#define TMPL_CMD_GET_CONFIGURABLE_COMMAND_SUB_FUNCTIONS_RS_CMD 0
+#define TMPL_CMD_GET_CONFIGURABLE_COMMAND_SUB_FUNCTIONS_RS_COMP_CODE 1
+#define TMPL_CMD_GET_CONFIGURABLE_COMMAND_SUB_FUNCTIONS_RS_SUB_FUNCTION_ENABLES1 2
+#define TMPL_CMD_GET_CONFIGURABLE_COMMAND_SUB_FUNCTIONS_RS_SUB_FUNCTION_ENABLES2 3
+
+/* tmpl_cmd_set_command_enables_rq */
+#define TMPL_CMD_SET_COMMAND_ENABLES_RQ_CMD 0
+#define TMPL_CMD_SET_COMMAND_ENABLES_RQ_CHANNEL_NUMBER 1
+#define TMPL_CMD_SET_COMMAND_ENABLES_RQ_RESERVED1 2
+#define TMPL_CMD_SET_COMMAND_ENABLES_RQ_NET_FN 3
+#define TMPL_CMD_SET_COMMAND_ENABLES_RQ_OPERATION 4
+#define TMPL_CMD_SET_COMMAND_ENABLES_RQ_LUN 5
+#define TMPL_CMD_SET_COMMAND_ENABLES_RQ_RESERVED2 6
+#define TMPL_CMD_SET_COMMAND_ENABLES_RQ_ENABLE_DISABLE_MASK 7
+#define TMPL_CMD_SET_COMMAND_ENABLES_RQ_NET_FN_DATA 8
+
+/* tmpl_cmd_set_command_enables_rs */
+#define TMPL_CMD_SET_COMMAND_ENABLES_RS_CMD 0
+#define TMPL_CMD_SET_COMMAND_ENABLES_RS_COMP_CODE 1
+
+/* tmpl_cmd_get_command_enables_rq */
+#define TMPL_CMD_GET_COMMAND_ENABLES_RQ_CMD 0
+#define TMPL_CMD_GET_COMMAND_ENABLES_RQ_CHANNEL_NUMBER 1
+#define TMPL_CMD_GET_COMMAND_ENABLES_RQ_RESERVED1 2
+#define TMPL_CMD_GET_COMMAND_ENABLES_RQ_NET_FN 3
+#define TMPL_CMD_GET_COMMAND_ENABLES_RQ_OPERATION 4
+#define TMPL_CMD_GET_COMMAND_ENABLES_RQ_LUN 5
+#define TMPL_CMD_GET_COMMAND_ENABLES_RQ_RESERVED2 6
+#define TMPL_CMD_GET_COMMAND_ENABLES_RQ_NET_FN_DATA 7
+
+/* tmpl_cmd_get_command_enables_rs */
+#define TMPL_CMD_GET_COMMAND_ENABLES_RS_CMD 0
+#define TMPL_CMD_GET_COMMAND_ENABLES_RS_COMP_CODE 1
+#define TMPL_CMD_GET_COMMAND_ENABLES_RS_ENABLE_DISABLE_MASK 2
+
+/* tmpl_cmd_set_command_sub_function_enables_rq */
+#define TMPL_CMD_SET_COMMAND_SUB_FUNCTION_ENABLES_RQ_CMD 0
+#define TMPL_CMD_SET_COMMAND_SUB_FUNCTION_ENABLES_RQ_CHANNEL_NUMBER 1
+#define TMPL_CMD_SET_COMMAND_SUB_FUNCTION_ENABLES_RQ_RESERVED1 2
+#define TMPL_CMD_SET_COMMAND_SUB_FUNCTION_ENABLES_RQ_NET_FN 3
+#define TMPL_CMD_SET_COMMAND_SUB_FUNCTION_ENABLES_RQ_RESERVED2 4
+#define TMPL_CMD_SET_COMMAND_SUB_FUNCTION_ENABLES_RQ_LUN 5
+#define TMPL_CMD_SET_COMMAND_SUB_FUNCTION_ENABLES_RQ_RESERVED3 6
+#define TMPL_CMD_SET_COMMAND_SUB_FUNCTION_ENABLES_RQ_COMMAND 7
+#define TMPL_CMD_SET_COMMAND_SUB_FUNCTION_ENABLES_RQ_SUB_FUNCTION_ENABLES1 8
+#define TMPL_CMD_SET_COMMAND_SUB_FUNCTION_ENABLES_RQ_SUB_FUNCTION_ENABLES2 9
+
+/* tmpl_cmd_set_command_sub_function_enables_defining_body_code_rq */
+#define TMPL_CMD_SET_COMMAND_SUB_FUNCTION_ENABLES_DEFINING_BODY_CODE_RQ_CMD 0
+#define TMPL_CMD_SET_COMMAND_SUB_FUNCTION_ENABLES_DEFINING_BODY_CODE_RQ_CHANNEL_NUMBER 1
+#define TMPL_CMD_SET_COMMAND_SUB_FUNCTION_ENABLES_DEFINING_BODY_CODE_RQ_RESERVED1 2
+#define TMPL_CMD_SET_COMMAND_SUB_FUNCTION_ENABLES_DEFINING_BODY_CODE_RQ_NET_FN 3
+#define TMPL_CMD_SET_COMMAND_SUB_FUNCTION_ENABLES_DEFINING_BODY_CODE_RQ_RESERVED2 4
+#define TMPL_CMD_SET_COMMAND_SUB_FUNCTION_ENABLES_DEFINING_BODY_CODE_RQ_LUN 5
+#define TMPL_CMD_SET_COMMAND_SUB_FUNCTION_ENABLES_DEFINING_BODY_CODE_RQ_RESERVED3 6
+#define TMPL_CMD_SET_COMMAND_SUB_FUNCTION_ENABLES_DEFINING_BODY_CODE_RQ_COMMAND 7
+#define TMPL_CMD_SET_COMMAND_SUB_FUNCTION_ENABLES_DEFINING_BODY_CODE_RQ_DEFINING_BODY_CODE 8
+#define TMPL_CMD_SET_COMMAND_SUB_FUNCTION_ENABLES_DEFINING_BODY_CODE_RQ_SUB_FUNCTION_ENABLES1 9
+#define TMPL_CMD_SET_COMMAND_SUB_FUNCTION_ENABLES_DEFINING_BODY_CODE_RQ_SUB_FUNCTION_ENABLES2 10
+
+/* tmpl_cmd_set_command_sub_function_enables_oem_iana_rq */
+#define TMPL_CMD_SET_COMMAND_SUB_FUNCTION_ENABLES_OEM_IANA_RQ_CMD 0
+#define TMPL_CMD_SET_COMMAND_SUB_FUNCTION_ENABLES_OEM_IANA_RQ_CHANNEL_NUMBER 1
+#define TMPL_CMD_SET_COMMAND_SUB_FUNCTION_ENABLES_OEM_IANA_RQ_RESERVED1 2
+#define TMPL_CMD_SET_COMMAND_SUB_FUNCTION_ENABLES_OEM_IANA_RQ_NET_FN 3
+#define TMPL_CMD_SET_COMMAND_SUB_FUNCTION_ENABLES_OEM_IANA_RQ_RESERVED2 4
+#define TMPL_CMD_SET_COMMAND_SUB_FUNCTION_ENABLES_OEM_IANA_RQ_LUN 5
+#define TMPL_CMD_SET_COMMAND_SUB_FUNCTION_ENABLES_OEM_IANA_RQ_RESERVED3 6
+#define TMPL_CMD_SET_COMMAND_SUB_FUNCTION_ENABLES_OEM_IANA_RQ_COMMAND 7
+#define TMPL_CMD_SET_COMMAND_SUB_FUNCTION_ENABLES_OEM_IANA_RQ_OEM_IANA 8
+#define TMPL_CMD_SET_COMMAND_SUB_FUNCTION_ENABLES_OEM_IANA_RQ_SUB_FUNCTION_ENABLES1 9
+#define TMPL_CMD_SET_COMMAND_SUB_FUNCTION_ENABLES_OEM_IANA_RQ_SUB_FUNCTION_ENABLES2 10
+
+/* tmpl_cmd_set_command_sub_function_enables_rs */
+#define TMPL_CMD_SET_COMMAND_SUB_FUNCTION_ENABLES_RS_CMD 0
+#define TMPL_CMD_SET_COMMAND_SUB_FUNCTION_ENABLES_RS_COMP_CODE 1
+
+/* tmpl_cmd_get_command_sub_function_enables_rq */
+#define TMPL_CMD_GET_COMMAND_SUB_FUNCTION_ENABLES_RQ_CMD 0
+#define TMPL_CMD_GET_COMMAND_SUB_FUNCTION_ENABLES_RQ_CHANNEL_NUMBER 1
+#define TMPL_CMD_GET_COMMAND_SUB_FUNCTION_ENABLES_RQ_RESERVED1 2
+#define TMPL_CMD_GET_COMMAND_SUB_FUNCTION_ENABLES_RQ_NET_FN 3
+#define TMPL_CMD_GET_COMMAND_SUB_FUNCTION_ENABLES_RQ_RESERVED2 4
+#define TMPL_CMD_GET_COMMAND_SUB_FUNCTION_ENABLES_RQ_LUN 5
+#define TMPL_CMD_GET_COMMAND_SUB_FUNCTION_ENABLES_RQ_RESERVED3 6
+#define TMPL_CMD_GET_COMMAND_SUB_FUNCTION_ENABLES_RQ_COMMAND 7
+#define TMPL_CMD_GET_COMMAND_SUB_FUNCTION_ENABLES_RQ_NET_FN_DATA 8
+
+/* tmpl_cmd_get_command_sub_function_enables_rs */
+#define TMPL_CMD_GET_COMMAND_SUB_FUNCTION_ENABLES_RS_CMD 0
+#define TMPL_CMD_GET_COMMAND_SUB_FUNCTION_ENABLES_RS_COMP_CODE 1
+#define TMPL_CMD_GET_COMMAND_SUB_FUNCTION_ENABLES_RS_SUB_FUNCTION_ENABLES1 2
+#define TMPL_CMD_GET_COMMAND_SUB_FUNCTION_ENABLES_RS_SUB_FUNCTION_ENABLES2 3
+
+/* tmpl_cmd_get_oem_netfn_iana_support_rq */
+#define TMPL_CMD_GET_OEM_NETFN_IANA_SUPPORT_RQ_CMD 0
+#define TMPL_CMD_GET_OEM_NETFN_IANA_SUPPORT_RQ_CHANNEL_NUMBER 1
+#define TMPL_CMD_GET_OEM_NETFN_IANA_SUPPORT_RQ_RESERVED1 2
+#define TMPL_CMD_GET_OEM_NETFN_IANA_SUPPORT_RQ_NET_FN 3
+#define TMPL_CMD_GET_OEM_NETFN_IANA_SUPPORT_RQ_RESERVED2 4
+#define TMPL_CMD_GET_OEM_NETFN_IANA_SUPPORT_RQ_LIST_INDEX 5
+#define TMPL_CMD_GET_OEM_NETFN_IANA_SUPPORT_RQ_RESERVED3 6
+
+/* tmpl_cmd_get_oem_netfn_iana_support_rs */
+#define TMPL_CMD_GET_OEM_NETFN_IANA_SUPPORT_RS_CMD 0
+#define TMPL_CMD_GET_OEM_NETFN_IANA_SUPPORT_RS_COMP_CODE 1
+#define TMPL_CMD_GET_OEM_NETFN_IANA_SUPPORT_RS_LAST_IANA 2
+#define TMPL_CMD_GET_OEM_NETFN_IANA_SUPPORT_RS_RESERVED 3
+#define TMPL_CMD_GET_OEM_NETFN_IANA_SUPPORT_RS_LUN0 4
+#define TMPL_CMD_GET_OEM_NETFN_IANA_SUPPORT_RS_LUN1 5
+#define TMPL_CMD_GET_OEM_NETFN_IANA_SUPPORT_RS_LUN2 6
+#define TMPL_CMD_GET_OEM_NETFN_IANA_SUPPORT_RS_LUN3 7
+#define TMPL_CMD_GET_OEM_NETFN_IANA_SUPPORT_RS_NET_FN_DATA 8
+
+/* tmpl_cmd_get_fru_inventory_area_info_rq */
+#define TMPL_CMD_GET_FRU_INVENTORY_AREA_INFO_RQ_CMD 0
+#define TMPL_CMD_GET_FRU_INVENTORY_AREA_INFO_RQ_FRU_DEVICE_ID 1
+
+/* tmpl_cmd_get_fru_inventory_area_info_rs */
+#define TMPL_CMD_GET_FRU_INVENTORY_AREA_INFO_RS_CMD 0
+#define TMPL_CMD_GET_FRU_INVENTORY_AREA_INFO_RS_COMP_CODE 1
+#define TMPL_CMD_GET_FRU_INVENTORY_AREA_INFO_RS_FRU_INVENTORY_AREA_SIZE 2
+#define TMPL_CMD_GET_FRU_INVENTORY_AREA_INFO_RS_DEVICE_IS_ACCESSED 3
+#define TMPL_CMD_GET_FRU_INVENTORY_AREA_INFO_RS_RESERVED 4
+
+/* tmpl_cmd_read_fru_data_rq */
+#define TMPL_CMD_READ_FRU_DATA_RQ_CMD 0
+#define TMPL_CMD_READ_FRU_DATA_RQ_FRU_DEVICE_ID 1
+#define TMPL_CMD_READ_FRU_DATA_RQ_FRU_INVENTORY_OFFSET_TO_READ 2
+#define TMPL_CMD_READ_FRU_DATA_RQ_COUNT_TO_READ 3
+
+/* tmpl_cmd_read_fru_data_rs */
+#define TMPL_CMD_READ_FRU_DATA_RS_CMD 0
+#define TMPL_CMD_READ_FRU_DATA_RS_COMP_CODE 1
+#define TMPL_CMD_READ_FRU_DATA_RS_COUNT_RETURNED 2
+#define TMPL_CMD_READ_FRU_DATA_RS_REQUESTED_DATA 3
+
+/* tmpl_cmd_write_fru_data_rq */
+#define TMPL_CMD_WRITE_FRU_DATA_RQ_CMD 0
+#define TMPL_CMD_WRITE_FRU_DATA_RQ_FRU_DEVICE_ID 1
+#define TMPL_CMD_WRITE_FRU_DATA_RQ_FRU_INVENTORY_OFFSET_TO_WRITE 2
+#define TMPL_CMD_WRITE_FRU_DATA_RQ_DATA_TO_WRITE 3
+
+/* tmpl_cmd_write_fru_data_rs */
+#define TMPL_CMD_WRITE_FRU_DATA_RS_CMD 0
+#define TMPL_CMD_WRITE_FRU_DATA_RS_COMP_CODE 1
+#define TMPL_CMD_WRITE_FRU_DATA_RS_COUNT_WRITTEN 2
+
+/* tmpl_cmd_set_lan_configuration_parameters_rq */
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_RQ_CMD 0
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_RQ_CHANNEL_NUMBER 1
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_RQ_RESERVED 2
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_RQ_PARAMETER_SELECTOR 3
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_RQ_CONFIGURATION_PARAMETER_DATA 4
+
+/* tmpl_cmd_set_lan_configuration_parameters_rs */
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_RS_CMD 0
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_RS_COMP_CODE 1
+
+/* tmpl_cmd_set_lan_configuration_parameters_set_in_progress_rq */
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_SET_IN_PROGRESS_RQ_CMD 0
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_SET_IN_PROGRESS_RQ_CHANNEL_NUMBER 1
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_SET_IN_PROGRESS_RQ_RESERVED1 2
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_SET_IN_PROGRESS_RQ_PARAMETER_SELECTOR 3
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_SET_IN_PROGRESS_RQ_STATE 4
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_SET_IN_PROGRESS_RQ_RESERVED2 5
+
+/* tmpl_cmd_set_lan_configuration_parameters_authentication_type_enables_rq */
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_AUTHENTICATION_TYPE_ENABLES_RQ_CMD 0
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_AUTHENTICATION_TYPE_ENABLES_RQ_CHANNEL_NUMBER 1
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_AUTHENTICATION_TYPE_ENABLES_RQ_RESERVED 2
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_AUTHENTICATION_TYPE_ENABLES_RQ_PARAMETER_SELECTOR 3
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_AUTHENTICATION_TYPE_ENABLES_RQ_CALLBACK_LEVEL_NONE 4
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_AUTHENTICATION_TYPE_ENABLES_RQ_CALLBACK_LEVEL_MD2 5
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_AUTHENTICATION_TYPE_ENABLES_RQ_CALLBACK_LEVEL_MD5 6
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_AUTHENTICATION_TYPE_ENABLES_RQ_CALLBACK_LEVEL_RESERVED1 7
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_AUTHENTICATION_TYPE_ENABLES_RQ_CALLBACK_LEVEL_STRAIGHT_PASSWORD 8
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_AUTHENTICATION_TYPE_ENABLES_RQ_CALLBACK_LEVEL_OEM_PROPRIETARY 9
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_AUTHENTICATION_TYPE_ENABLES_RQ_CALLBACK_LEVEL_RESERVED2 10
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_AUTHENTICATION_TYPE_ENABLES_RQ_USER_LEVEL_NONE 11
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_AUTHENTICATION_TYPE_ENABLES_RQ_USER_LEVEL_MD2 12
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_AUTHENTICATION_TYPE_ENABLES_RQ_USER_LEVEL_MD5 13
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_AUTHENTICATION_TYPE_ENABLES_RQ_USER_LEVEL_RESERVED1 14
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_AUTHENTICATION_TYPE_ENABLES_RQ_USER_LEVEL_STRAIGHT_PASSWORD 15
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_AUTHENTICATION_TYPE_ENABLES_RQ_USER_LEVEL_OEM_PROPRIETARY 16
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_AUTHENTICATION_TYPE_ENABLES_RQ_USER_LEVEL_RESERVED2 17
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_AUTHENTICATION_TYPE_ENABLES_RQ_OPERATOR_LEVEL_NONE 18
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_AUTHENTICATION_TYPE_ENABLES_RQ_OPERATOR_LEVEL_MD2 19
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_AUTHENTICATION_TYPE_ENABLES_RQ_OPERATOR_LEVEL_MD5 20
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_AUTHENTICATION_TYPE_ENABLES_RQ_OPERATOR_LEVEL_RESERVED1 21
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_AUTHENTICATION_TYPE_ENABLES_RQ_OPERATOR_LEVEL_STRAIGHT_PASSWORD 22
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_AUTHENTICATION_TYPE_ENABLES_RQ_OPERATOR_LEVEL_OEM_PROPRIETARY 23
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_AUTHENTICATION_TYPE_ENABLES_RQ_OPERATOR_LEVEL_RESERVED2 24
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_AUTHENTICATION_TYPE_ENABLES_RQ_ADMIN_LEVEL_NONE 25
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_AUTHENTICATION_TYPE_ENABLES_RQ_ADMIN_LEVEL_MD2 26
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_AUTHENTICATION_TYPE_ENABLES_RQ_ADMIN_LEVEL_MD5 27
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_AUTHENTICATION_TYPE_ENABLES_RQ_ADMIN_LEVEL_RESERVED1 28
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_AUTHENTICATION_TYPE_ENABLES_RQ_ADMIN_LEVEL_STRAIGHT_PASSWORD 29
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_AUTHENTICATION_TYPE_ENABLES_RQ_ADMIN_LEVEL_OEM_PROPRIETARY 30
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_AUTHENTICATION_TYPE_ENABLES_RQ_ADMIN_LEVEL_RESERVED2 31
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_AUTHENTICATION_TYPE_ENABLES_RQ_OEM_LEVEL_NONE 32
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_AUTHENTICATION_TYPE_ENABLES_RQ_OEM_LEVEL_MD2 33
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_AUTHENTICATION_TYPE_ENABLES_RQ_OEM_LEVEL_MD5 34
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_AUTHENTICATION_TYPE_ENABLES_RQ_OEM_LEVEL_RESERVED1 35
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_AUTHENTICATION_TYPE_ENABLES_RQ_OEM_LEVEL_STRAIGHT_PASSWORD 36
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_AUTHENTICATION_TYPE_ENABLES_RQ_OEM_LEVEL_OEM_PROPRIETARY 37
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_AUTHENTICATION_TYPE_ENABLES_RQ_OEM_LEVEL_RESERVED2 38
+
+/* tmpl_cmd_set_lan_configuration_parameters_ip_address_rq */
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_IP_ADDRESS_RQ_CMD 0
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_IP_ADDRESS_RQ_CHANNEL_NUMBER 1
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_IP_ADDRESS_RQ_RESERVED 2
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_IP_ADDRESS_RQ_PARAMETER_SELECTOR 3
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_IP_ADDRESS_RQ_IP_ADDRESS 4
+
+/* tmpl_cmd_set_lan_configuration_parameters_ip_address_source_rq */
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_IP_ADDRESS_SOURCE_RQ_CMD 0
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_IP_ADDRESS_SOURCE_RQ_CHANNEL_NUMBER 1
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_IP_ADDRESS_SOURCE_RQ_RESERVED1 2
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_IP_ADDRESS_SOURCE_RQ_PARAMETER_SELECTOR 3
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_IP_ADDRESS_SOURCE_RQ_IP_ADDRESS_SOURCE 4
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_IP_ADDRESS_SOURCE_RQ_RESERVED2 5
+
+/* tmpl_cmd_set_lan_configuration_parameters_mac_address_rq */
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_MAC_ADDRESS_RQ_CMD 0
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_MAC_ADDRESS_RQ_CHANNEL_NUMBER 1
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_MAC_ADDRESS_RQ_RESERVED 2
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_MAC_ADDRESS_RQ_PARAMETER_SELECTOR 3
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_MAC_ADDRESS_RQ_MAC_ADDRESS 4
+
+/* tmpl_cmd_set_lan_configuration_parameters_subnet_mask_rq */
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_SUBNET_MASK_RQ_CMD 0
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_SUBNET_MASK_RQ_CHANNEL_NUMBER 1
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_SUBNET_MASK_RQ_RESERVED 2
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_SUBNET_MASK_RQ_PARAMETER_SELECTOR 3
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_SUBNET_MASK_RQ_SUBNET_MASK 4
+
+/* tmpl_cmd_set_lan_configuration_parameters_ipv4_header_parameters_rq */
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_IPV4_HEADER_PARAMETERS_RQ_CMD 0
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_IPV4_HEADER_PARAMETERS_RQ_CHANNEL_NUMBER 1
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_IPV4_HEADER_PARAMETERS_RQ_RESERVED1 2
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_IPV4_HEADER_PARAMETERS_RQ_PARAMETER_SELECTOR 3
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_IPV4_HEADER_PARAMETERS_RQ_TIME_TO_LIVE 4
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_IPV4_HEADER_PARAMETERS_RQ_RESERVED2 5
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_IPV4_HEADER_PARAMETERS_RQ_FLAGS 6
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_IPV4_HEADER_PARAMETERS_RQ_RESERVED3 7
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_IPV4_HEADER_PARAMETERS_RQ_TYPE_OF_SERVICE 8
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_IPV4_HEADER_PARAMETERS_RQ_PRECEDENCE 9
+
+/* tmpl_cmd_set_lan_configuration_parameters_primary_rmcp_port_number_rq */
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_PRIMARY_RMCP_PORT_NUMBER_RQ_CMD 0
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_PRIMARY_RMCP_PORT_NUMBER_RQ_CHANNEL_NUMBER 1
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_PRIMARY_RMCP_PORT_NUMBER_RQ_RESERVED 2
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_PRIMARY_RMCP_PORT_NUMBER_RQ_PARAMETER_SELECTOR 3
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_PRIMARY_RMCP_PORT_NUMBER_RQ_PRIMARY_RMCP_PORT_NUMBER 4
+
+/* tmpl_cmd_set_lan_configuration_parameters_secondary_rmcp_port_number_rq */
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_SECONDARY_RMCP_PORT_NUMBER_RQ_CMD 0
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_SECONDARY_RMCP_PORT_NUMBER_RQ_CHANNEL_NUMBER 1
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_SECONDARY_RMCP_PORT_NUMBER_RQ_RESERVED 2
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_SECONDARY_RMCP_PORT_NUMBER_RQ_PARAMETER_SELECTOR 3
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_SECONDARY_RMCP_PORT_NUMBER_RQ_SECONDARY_RMCP_PORT_NUMBER 4
+
+/* tmpl_cmd_set_lan_configuration_parameters_bmc_generated_arp_control_rq */
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_BMC_GENERATED_ARP_CONTROL_RQ_CMD 0
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_BMC_GENERATED_ARP_CONTROL_RQ_CHANNEL_NUMBER 1
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_BMC_GENERATED_ARP_CONTROL_RQ_RESERVED1 2
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_BMC_GENERATED_ARP_CONTROL_RQ_PARAMETER_SELECTOR 3
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_BMC_GENERATED_ARP_CONTROL_RQ_BMC_GENERATED_GRATUITOUS_ARPS 4
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_BMC_GENERATED_ARP_CONTROL_RQ_BMC_GENERATED_ARP_RESPONSES 5
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_BMC_GENERATED_ARP_CONTROL_RQ_RESERVED2 6
+
+/* tmpl_cmd_set_lan_configuration_parameters_gratuitous_arp_interval_rq */
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_GRATUITOUS_ARP_INTERVAL_RQ_CMD 0
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_GRATUITOUS_ARP_INTERVAL_RQ_CHANNEL_NUMBER 1
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_GRATUITOUS_ARP_INTERVAL_RQ_RESERVED1 2
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_GRATUITOUS_ARP_INTERVAL_RQ_PARAMETER_SELECTOR 3
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_GRATUITOUS_ARP_INTERVAL_RQ_GRATUITOUS_ARP_INTERVAL 4
+
+/* tmpl_cmd_set_lan_configuration_parameters_default_gateway_address_rq */
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_DEFAULT_GATEWAY_ADDRESS_RQ_CMD 0
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_DEFAULT_GATEWAY_ADDRESS_RQ_CHANNEL_NUMBER 1
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_DEFAULT_GATEWAY_ADDRESS_RQ_RESERVED 2
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_DEFAULT_GATEWAY_ADDRESS_RQ_PARAMETER_SELECTOR 3
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_DEFAULT_GATEWAY_ADDRESS_RQ_IP_ADDRESS 4
+
+/* tmpl_cmd_set_lan_configuration_parameters_default_gateway_mac_address_rq */
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_DEFAULT_GATEWAY_MAC_ADDRESS_RQ_CMD 0
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_DEFAULT_GATEWAY_MAC_ADDRESS_RQ_CHANNEL_NUMBER 1
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_DEFAULT_GATEWAY_MAC_ADDRESS_RQ_RESERVED 2
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_DEFAULT_GATEWAY_MAC_ADDRESS_RQ_PARAMETER_SELECTOR 3
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_DEFAULT_GATEWAY_MAC_ADDRESS_RQ_MAC_ADDRESS 4
+
+/* tmpl_cmd_set_lan_configuration_parameters_backup_gateway_address_rq */
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_BACKUP_GATEWAY_ADDRESS_RQ_CMD 0
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_BACKUP_GATEWAY_ADDRESS_RQ_CHANNEL_NUMBER 1
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_BACKUP_GATEWAY_ADDRESS_RQ_RESERVED 2
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_BACKUP_GATEWAY_ADDRESS_RQ_PARAMETER_SELECTOR 3
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_BACKUP_GATEWAY_ADDRESS_RQ_IP_ADDRESS 4
+
+/* tmpl_cmd_set_lan_configuration_parameters_backup_gateway_mac_address_rq */
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_BACKUP_GATEWAY_MAC_ADDRESS_RQ_CMD 0
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_BACKUP_GATEWAY_MAC_ADDRESS_RQ_CHANNEL_NUMBER 1
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_BACKUP_GATEWAY_MAC_ADDRESS_RQ_RESERVED 2
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_BACKUP_GATEWAY_MAC_ADDRESS_RQ_PARAMETER_SELECTOR 3
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_BACKUP_GATEWAY_MAC_ADDRESS_RQ_MAC_ADDRESS 4
+
+/* tmpl_cmd_set_lan_configuration_parameters_community_string_rq */
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_COMMUNITY_STRING_RQ_CMD 0
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_COMMUNITY_STRING_RQ_CHANNEL_NUMBER 1
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_COMMUNITY_STRING_RQ_RESERVED 2
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_COMMUNITY_STRING_RQ_PARAMETER_SELECTOR 3
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_COMMUNITY_STRING_RQ_COMMUNITY_STRING 4
+
+/* tmpl_cmd_set_lan_configuration_parameters_destination_type_rq */
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_DESTINATION_TYPE_RQ_CMD 0
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_DESTINATION_TYPE_RQ_CHANNEL_NUMBER 1
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_DESTINATION_TYPE_RQ_RESERVED1 2
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_DESTINATION_TYPE_RQ_PARAMETER_SELECTOR 3
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_DESTINATION_TYPE_RQ_DESTINATION_SELECTOR 4
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_DESTINATION_TYPE_RQ_RESERVED2 5
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_DESTINATION_TYPE_RQ_DESTINATION_TYPE 6
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_DESTINATION_TYPE_RQ_RESERVED3 7
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_DESTINATION_TYPE_RQ_ALERT_ACKNOWLEDGE 8
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_DESTINATION_TYPE_RQ_ALERT_ACKNOWLEDGE_TIMEOUT 9
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_DESTINATION_TYPE_RQ_RETRIES 10
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_DESTINATION_TYPE_RQ_RESERVED4 11
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_DESTINATION_TYPE_RQ_RESERVED5 12
+
+/* tmpl_cmd_set_lan_configuration_parameters_destination_addresses_rq */
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_DESTINATION_ADDRESSES_RQ_CMD 0
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_DESTINATION_ADDRESSES_RQ_CHANNEL_NUMBER 1
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_DESTINATION_ADDRESSES_RQ_RESERVED1 2
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_DESTINATION_ADDRESSES_RQ_PARAMETER_SELECTOR 3
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_DESTINATION_ADDRESSES_RQ_DESTINATION_SELECTOR 4
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_DESTINATION_ADDRESSES_RQ_RESERVED2 5
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_DESTINATION_ADDRESSES_RQ_RESERVED3 6
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_DESTINATION_ADDRESSES_RQ_ADDRESS_FORMAT 7
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_DESTINATION_ADDRESSES_RQ_GATEWAY_SELECTOR 8
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_DESTINATION_ADDRESSES_RQ_RESERVED4 9
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_DESTINATION_ADDRESSES_RQ_ALERTING_IP_ADDRESS 10
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_DESTINATION_ADDRESSES_RQ_ALERTING_MAC_ADDRESS 11
+
+/* tmpl_cmd_set_lan_configuration_parameters_vlan_id_rq */
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_VLAN_ID_RQ_CMD 0
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_VLAN_ID_RQ_CHANNEL_NUMBER 1
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_VLAN_ID_RQ_RESERVED1 2
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_VLAN_ID_RQ_PARAMETER_SELECTOR 3
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_VLAN_ID_RQ_VLAN_ID 4
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_VLAN_ID_RQ_RESERVED2 5
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_VLAN_ID_RQ_VLAN_ID_ENABLE 6
+
+/* tmpl_cmd_set_lan_configuration_parameters_vlan_priority_rq */
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_VLAN_PRIORITY_RQ_CMD 0
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_VLAN_PRIORITY_RQ_CHANNEL_NUMBER 1
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_VLAN_PRIORITY_RQ_RESERVED1 2
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_VLAN_PRIORITY_RQ_PARAMETER_SELECTOR 3
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_VLAN_PRIORITY_RQ_VLAN_PRIORITY 4
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_VLAN_PRIORITY_RQ_UNSPECIFIED 5
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_VLAN_PRIORITY_RQ_RESERVED2 6
+
+/* tmpl_cmd_set_lan_configuration_parameters_rmcpplus_messaging_cipher_suite_privilege_levels_rq */
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_RMCPPLUS_MESSAGING_CIPHER_SUITE_PRIVILEGE_LEVELS_RQ_CMD 0
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_RMCPPLUS_MESSAGING_CIPHER_SUITE_PRIVILEGE_LEVELS_RQ_CHANNEL_NUMBER 1
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_RMCPPLUS_MESSAGING_CIPHER_SUITE_PRIVILEGE_LEVELS_RQ_RESERVED1 2
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_RMCPPLUS_MESSAGING_CIPHER_SUITE_PRIVILEGE_LEVELS_RQ_PARAMETER_SELECTOR 3
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_RMCPPLUS_MESSAGING_CIPHER_SUITE_PRIVILEGE_LEVELS_RQ_RESERVED2 4
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_RMCPPLUS_MESSAGING_CIPHER_SUITE_PRIVILEGE_LEVELS_RQ_MAXIMUM_PRIVILEGE_FOR_CIPHER_SUITE_1 5
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_RMCPPLUS_MESSAGING_CIPHER_SUITE_PRIVILEGE_LEVELS_RQ_MAXIMUM_PRIVILEGE_FOR_CIPHER_SUITE_2 6
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_RMCPPLUS_MESSAGING_CIPHER_SUITE_PRIVILEGE_LEVELS_RQ_MAXIMUM_PRIVILEGE_FOR_CIPHER_SUITE_3 7
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_RMCPPLUS_MESSAGING_CIPHER_SUITE_PRIVILEGE_LEVELS_RQ_MAXIMUM_PRIVILEGE_FOR_CIPHER_SUITE_4 8
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_RMCPPLUS_MESSAGING_CIPHER_SUITE_PRIVILEGE_LEVELS_RQ_MAXIMUM_PRIVILEGE_FOR_CIPHER_SUITE_5 9
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_RMCPPLUS_MESSAGING_CIPHER_SUITE_PRIVILEGE_LEVELS_RQ_MAXIMUM_PRIVILEGE_FOR_CIPHER_SUITE_6 10
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_RMCPPLUS_MESSAGING_CIPHER_SUITE_PRIVILEGE_LEVELS_RQ_MAXIMUM_PRIVILEGE_FOR_CIPHER_SUITE_7 11
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_RMCPPLUS_MESSAGING_CIPHER_SUITE_PRIVILEGE_LEVELS_RQ_MAXIMUM_PRIVILEGE_FOR_CIPHER_SUITE_8 12
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_RMCPPLUS_MESSAGING_CIPHER_SUITE_PRIVILEGE_LEVELS_RQ_MAXIMUM_PRIVILEGE_FOR_CIPHER_SUITE_9 13
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_RMCPPLUS_MESSAGING_CIPHER_SUITE_PRIVILEGE_LEVELS_RQ_MAXIMUM_PRIVILEGE_FOR_CIPHER_SUITE_10 14
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_RMCPPLUS_MESSAGING_CIPHER_SUITE_PRIVILEGE_LEVELS_RQ_MAXIMUM_PRIVILEGE_FOR_CIPHER_SUITE_11 15
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_RMCPPLUS_MESSAGING_CIPHER_SUITE_PRIVILEGE_LEVELS_RQ_MAXIMUM_PRIVILEGE_FOR_CIPHER_SUITE_12 16
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_RMCPPLUS_MESSAGING_CIPHER_SUITE_PRIVILEGE_LEVELS_RQ_MAXIMUM_PRIVILEGE_FOR_CIPHER_SUITE_13 17
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_RMCPPLUS_MESSAGING_CIPHER_SUITE_PRIVILEGE_LEVELS_RQ_MAXIMUM_PRIVILEGE_FOR_CIPHER_SUITE_14 18
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_RMCPPLUS_MESSAGING_CIPHER_SUITE_PRIVILEGE_LEVELS_RQ_MAXIMUM_PRIVILEGE_FOR_CIPHER_SUITE_15 19
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_RMCPPLUS_MESSAGING_CIPHER_SUITE_PRIVILEGE_LEVELS_RQ_MAXIMUM_PRIVILEGE_FOR_CIPHER_SUITE_16 20
+
+/* tmpl_cmd_set_lan_configuration_parameters_bad_password_threshold_rq */
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_BAD_PASSWORD_THRESHOLD_RQ_CMD 0
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_BAD_PASSWORD_THRESHOLD_RQ_CHANNEL_NUMBER 1
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_BAD_PASSWORD_THRESHOLD_RQ_RESERVED1 2
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_BAD_PASSWORD_THRESHOLD_RQ_PARAMETER_SELECTOR 3
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_BAD_PASSWORD_THRESHOLD_RQ_USER_DISABLED_EVENT_MESSAGE 4
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_BAD_PASSWORD_THRESHOLD_RQ_RESERVED2 5
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_BAD_PASSWORD_THRESHOLD_RQ_BAD_PASSWORD_THRESHOLD_NUMBER 6
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_BAD_PASSWORD_THRESHOLD_RQ_ATTEMPT_COUNT_RESET_INTERVAL 7
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_BAD_PASSWORD_THRESHOLD_RQ_USER_LOCKOUT_INTERVAL 8
+
+/* tmpl_cmd_set_lan_configuration_parameters_ipv6_ipv4_addressing_enables_rq */
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_IPV6_IPV4_ADDRESSING_ENABLES_RQ_CMD 0
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_IPV6_IPV4_ADDRESSING_ENABLES_RQ_CHANNEL_NUMBER 1
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_IPV6_IPV4_ADDRESSING_ENABLES_RQ_RESERVED 2
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_IPV6_IPV4_ADDRESSING_ENABLES_RQ_PARAMETER_SELECTOR 3
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_IPV6_IPV4_ADDRESSING_ENABLES_RQ_ENABLES 4
+
+/* tmpl_cmd_set_lan_configuration_parameters_ipv6_header_static_traffic_class_rq */
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_IPV6_HEADER_STATIC_TRAFFIC_CLASS_RQ_CMD 0
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_IPV6_HEADER_STATIC_TRAFFIC_CLASS_RQ_CHANNEL_NUMBER 1
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_IPV6_HEADER_STATIC_TRAFFIC_CLASS_RQ_RESERVED 2
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_IPV6_HEADER_STATIC_TRAFFIC_CLASS_RQ_PARAMETER_SELECTOR 3
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_IPV6_HEADER_STATIC_TRAFFIC_CLASS_RQ_TRAFFIC_CLASS 4
+
+/* tmpl_cmd_set_lan_configuration_parameters_ipv6_header_static_hop_limit_rq */
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_IPV6_HEADER_STATIC_HOP_LIMIT_RQ_CMD 0
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_IPV6_HEADER_STATIC_HOP_LIMIT_RQ_CHANNEL_NUMBER 1
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_IPV6_HEADER_STATIC_HOP_LIMIT_RQ_RESERVED 2
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_IPV6_HEADER_STATIC_HOP_LIMIT_RQ_PARAMETER_SELECTOR 3
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_IPV6_HEADER_STATIC_HOP_LIMIT_RQ_STATIC_HOP_LIMIT 4
+
+/* tmpl_cmd_set_lan_configuration_parameters_ipv6_header_flow_label_rq */
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_IPV6_HEADER_FLOW_LABEL_RQ_CMD 0
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_IPV6_HEADER_FLOW_LABEL_RQ_CHANNEL_NUMBER 1
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_IPV6_HEADER_FLOW_LABEL_RQ_RESERVED1 2
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_IPV6_HEADER_FLOW_LABEL_RQ_PARAMETER_SELECTOR 3
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_IPV6_HEADER_FLOW_LABEL_RQ_FLOW_LABEL 4
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_IPV6_HEADER_FLOW_LABEL_RQ_RESERVED2 5
+
+/* tmpl_cmd_set_lan_configuration_parameters_ipv6_static_addresses_rq */
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_IPV6_STATIC_ADDRESSES_RQ_CMD 0
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_IPV6_STATIC_ADDRESSES_RQ_CHANNEL_NUMBER 1
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_IPV6_STATIC_ADDRESSES_RQ_RESERVED1 2
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_IPV6_STATIC_ADDRESSES_RQ_PARAMETER_SELECTOR 3
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_IPV6_STATIC_ADDRESSES_RQ_SET_SELECTOR 4
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_IPV6_STATIC_ADDRESSES_RQ_SOURCE 5
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_IPV6_STATIC_ADDRESSES_RQ_RESERVED2 6
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_IPV6_STATIC_ADDRESSES_RQ_ENABLE 7
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_IPV6_STATIC_ADDRESSES_RQ_ADDRESS 8
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_IPV6_STATIC_ADDRESSES_RQ_ADDRESS_PREFIX_LENGTH 9
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_IPV6_STATIC_ADDRESSES_RQ_ADDRESS_STATUS 10
+
+/* tmpl_cmd_set_lan_configuration_parameters_ipv6_router_address_configuration_control_rq */
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_IPV6_ROUTER_ADDRESS_CONFIGURATION_CONTROL_RQ_CMD 0
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_IPV6_ROUTER_ADDRESS_CONFIGURATION_CONTROL_RQ_CHANNEL_NUMBER 1
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_IPV6_ROUTER_ADDRESS_CONFIGURATION_CONTROL_RQ_RESERVED1 2
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_IPV6_ROUTER_ADDRESS_CONFIGURATION_CONTROL_RQ_PARAMETER_SELECTOR 3
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_IPV6_ROUTER_ADDRESS_CONFIGURATION_CONTROL_RQ_ENABLE_STATIC_ROUTER_ADDRESS 4
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_IPV6_ROUTER_ADDRESS_CONFIGURATION_CONTROL_RQ_ENABLE_DYNAMIC_ROUTER_ADDRESS 5
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_IPV6_ROUTER_ADDRESS_CONFIGURATION_CONTROL_RQ_RESERVED2 6
+
+/* tmpl_cmd_set_lan_configuration_parameters_ipv6_static_router_1_ip_address_rq */
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_IPV6_STATIC_ROUTER_1_IP_ADDRESS_RQ_CMD 0
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_IPV6_STATIC_ROUTER_1_IP_ADDRESS_RQ_CHANNEL_NUMBER 1
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_IPV6_STATIC_ROUTER_1_IP_ADDRESS_RQ_RESERVED 2
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_IPV6_STATIC_ROUTER_1_IP_ADDRESS_RQ_PARAMETER_SELECTOR 3
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_IPV6_STATIC_ROUTER_1_IP_ADDRESS_RQ_IPV6_ROUTER_IP_ADDRESS 4
+
+/* tmpl_cmd_set_lan_configuration_parameters_ipv6_static_router_1_mac_address_rq */
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_IPV6_STATIC_ROUTER_1_MAC_ADDRESS_RQ_CMD 0
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_IPV6_STATIC_ROUTER_1_MAC_ADDRESS_RQ_CHANNEL_NUMBER 1
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_IPV6_STATIC_ROUTER_1_MAC_ADDRESS_RQ_RESERVED 2
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_IPV6_STATIC_ROUTER_1_MAC_ADDRESS_RQ_PARAMETER_SELECTOR 3
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_IPV6_STATIC_ROUTER_1_MAC_ADDRESS_RQ_ROUTER_MAC_ADDRESS 4
+
+/* tmpl_cmd_set_lan_configuration_parameters_ipv6_static_router_1_prefix_length_rq */
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_IPV6_STATIC_ROUTER_1_PREFIX_LENGTH_RQ_CMD 0
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_IPV6_STATIC_ROUTER_1_PREFIX_LENGTH_RQ_CHANNEL_NUMBER 1
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_IPV6_STATIC_ROUTER_1_PREFIX_LENGTH_RQ_RESERVED 2
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_IPV6_STATIC_ROUTER_1_PREFIX_LENGTH_RQ_PARAMETER_SELECTOR 3
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_IPV6_STATIC_ROUTER_1_PREFIX_LENGTH_RQ_PREFIX_LENGTH 4
+
+/* tmpl_cmd_set_lan_configuration_parameters_ipv6_static_router_1_prefix_value_rq */
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_IPV6_STATIC_ROUTER_1_PREFIX_VALUE_RQ_CMD 0
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_IPV6_STATIC_ROUTER_1_PREFIX_VALUE_RQ_CHANNEL_NUMBER 1
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_IPV6_STATIC_ROUTER_1_PREFIX_VALUE_RQ_RESERVED 2
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_IPV6_STATIC_ROUTER_1_PREFIX_VALUE_RQ_PARAMETER_SELECTOR 3
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_IPV6_STATIC_ROUTER_1_PREFIX_VALUE_RQ_PREFIX_VALUE 4
+
+/* tmpl_cmd_set_lan_configuration_parameters_ipv6_static_router_2_ip_address_rq */
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_IPV6_STATIC_ROUTER_2_IP_ADDRESS_RQ_CMD 0
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_IPV6_STATIC_ROUTER_2_IP_ADDRESS_RQ_CHANNEL_NUMBER 1
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_IPV6_STATIC_ROUTER_2_IP_ADDRESS_RQ_RESERVED 2
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_IPV6_STATIC_ROUTER_2_IP_ADDRESS_RQ_PARAMETER_SELECTOR 3
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_IPV6_STATIC_ROUTER_2_IP_ADDRESS_RQ_IPV6_ROUTER_IP_ADDRESS 4
+
+/* tmpl_cmd_set_lan_configuration_parameters_ipv6_static_router_2_mac_address_rq */
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_IPV6_STATIC_ROUTER_2_MAC_ADDRESS_RQ_CMD 0
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_IPV6_STATIC_ROUTER_2_MAC_ADDRESS_RQ_CHANNEL_NUMBER 1
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_IPV6_STATIC_ROUTER_2_MAC_ADDRESS_RQ_RESERVED 2
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_IPV6_STATIC_ROUTER_2_MAC_ADDRESS_RQ_PARAMETER_SELECTOR 3
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_IPV6_STATIC_ROUTER_2_MAC_ADDRESS_RQ_ROUTER_MAC_ADDRESS 4
+
+/* tmpl_cmd_set_lan_configuration_parameters_ipv6_static_router_2_prefix_length_rq */
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_IPV6_STATIC_ROUTER_2_PREFIX_LENGTH_RQ_CMD 0
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_IPV6_STATIC_ROUTER_2_PREFIX_LENGTH_RQ_CHANNEL_NUMBER 1
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_IPV6_STATIC_ROUTER_2_PREFIX_LENGTH_RQ_RESERVED 2
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_IPV6_STATIC_ROUTER_2_PREFIX_LENGTH_RQ_PARAMETER_SELECTOR 3
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_IPV6_STATIC_ROUTER_2_PREFIX_LENGTH_RQ_PREFIX_LENGTH 4
+
+/* tmpl_cmd_set_lan_configuration_parameters_ipv6_static_router_2_prefix_value_rq */
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_IPV6_STATIC_ROUTER_2_PREFIX_VALUE_RQ_CMD 0
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_IPV6_STATIC_ROUTER_2_PREFIX_VALUE_RQ_CHANNEL_NUMBER 1
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_IPV6_STATIC_ROUTER_2_PREFIX_VALUE_RQ_RESERVED 2
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_IPV6_STATIC_ROUTER_2_PREFIX_VALUE_RQ_PARAMETER_SELECTOR 3
+#define TMPL_CMD_SET_LAN_CONFIGURATION_PARAMETERS_IPV6_STATIC_ROUTER_2_PREFIX_VALUE_RQ_PREFIX_VALUE 4
+
+/* tmpl_cmd_get_lan_configuration_parameters_rq */
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_RQ_CMD 0
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_RQ_CHANNEL_NUMBER 1
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_RQ_RESERVED1 2
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_RQ_GET_PARAMETER 3
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_RQ_PARAMETER_SELECTOR 4
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_RQ_SET_SELECTOR 5
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_RQ_BLOCK_SELECTOR 6
+
+/* tmpl_cmd_get_lan_configuration_parameters_rs */
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_RS_CMD 0
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_RS_COMP_CODE 1
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_RS_PRESENT_REVISION 2
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_RS_OLDEST_REVISION_PARAMETER 3
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_RS_CONFIGURATION_PARAMETER_DATA 4
+
+/* tmpl_cmd_get_lan_configuration_parameters_set_in_progress_rs */
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_SET_IN_PROGRESS_RS_CMD 0
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_SET_IN_PROGRESS_RS_COMP_CODE 1
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_SET_IN_PROGRESS_RS_PRESENT_REVISION 2
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_SET_IN_PROGRESS_RS_OLDEST_REVISION_PARAMETER 3
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_SET_IN_PROGRESS_RS_STATE 4
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_SET_IN_PROGRESS_RS_RESERVED 5
+
+/* tmpl_cmd_get_lan_configuration_parameters_authentication_type_support_rs */
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_AUTHENTICATION_TYPE_SUPPORT_RS_CMD 0
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_AUTHENTICATION_TYPE_SUPPORT_RS_COMP_CODE 1
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_AUTHENTICATION_TYPE_SUPPORT_RS_PRESENT_REVISION 2
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_AUTHENTICATION_TYPE_SUPPORT_RS_OLDEST_REVISION_PARAMETER 3
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_AUTHENTICATION_TYPE_SUPPORT_RS_NONE 4
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_AUTHENTICATION_TYPE_SUPPORT_RS_MD2 5
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_AUTHENTICATION_TYPE_SUPPORT_RS_MD5 6
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_AUTHENTICATION_TYPE_SUPPORT_RS_RESERVED1 7
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_AUTHENTICATION_TYPE_SUPPORT_RS_STRAIGHT_PASSWORD 8
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_AUTHENTICATION_TYPE_SUPPORT_RS_OEM_PROPRIETARY 9
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_AUTHENTICATION_TYPE_SUPPORT_RS_RESERVED2 10
+
+/* tmpl_cmd_get_lan_configuration_parameters_authentication_type_enables_rs */
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_AUTHENTICATION_TYPE_ENABLES_RS_CMD 0
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_AUTHENTICATION_TYPE_ENABLES_RS_COMP_CODE 1
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_AUTHENTICATION_TYPE_ENABLES_RS_PRESENT_REVISION 2
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_AUTHENTICATION_TYPE_ENABLES_RS_OLDEST_REVISION_PARAMETER 3
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_AUTHENTICATION_TYPE_ENABLES_RS_CALLBACK_LEVEL_NONE 4
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_AUTHENTICATION_TYPE_ENABLES_RS_CALLBACK_LEVEL_MD2 5
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_AUTHENTICATION_TYPE_ENABLES_RS_CALLBACK_LEVEL_MD5 6
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_AUTHENTICATION_TYPE_ENABLES_RS_CALLBACK_LEVEL_RESERVED1 7
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_AUTHENTICATION_TYPE_ENABLES_RS_CALLBACK_LEVEL_STRAIGHT_PASSWORD 8
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_AUTHENTICATION_TYPE_ENABLES_RS_CALLBACK_LEVEL_OEM_PROPRIETARY 9
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_AUTHENTICATION_TYPE_ENABLES_RS_CALLBACK_LEVEL_RESERVED2 10
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_AUTHENTICATION_TYPE_ENABLES_RS_USER_LEVEL_NONE 11
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_AUTHENTICATION_TYPE_ENABLES_RS_USER_LEVEL_MD2 12
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_AUTHENTICATION_TYPE_ENABLES_RS_USER_LEVEL_MD5 13
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_AUTHENTICATION_TYPE_ENABLES_RS_USER_LEVEL_RESERVED1 14
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_AUTHENTICATION_TYPE_ENABLES_RS_USER_LEVEL_STRAIGHT_PASSWORD 15
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_AUTHENTICATION_TYPE_ENABLES_RS_USER_LEVEL_OEM_PROPRIETARY 16
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_AUTHENTICATION_TYPE_ENABLES_RS_USER_LEVEL_RESERVED2 17
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_AUTHENTICATION_TYPE_ENABLES_RS_OPERATOR_LEVEL_NONE 18
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_AUTHENTICATION_TYPE_ENABLES_RS_OPERATOR_LEVEL_MD2 19
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_AUTHENTICATION_TYPE_ENABLES_RS_OPERATOR_LEVEL_MD5 20
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_AUTHENTICATION_TYPE_ENABLES_RS_OPERATOR_LEVEL_RESERVED1 21
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_AUTHENTICATION_TYPE_ENABLES_RS_OPERATOR_LEVEL_STRAIGHT_PASSWORD 22
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_AUTHENTICATION_TYPE_ENABLES_RS_OPERATOR_LEVEL_OEM_PROPRIETARY 23
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_AUTHENTICATION_TYPE_ENABLES_RS_OPERATOR_LEVEL_RESERVED2 24
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_AUTHENTICATION_TYPE_ENABLES_RS_ADMIN_LEVEL_NONE 25
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_AUTHENTICATION_TYPE_ENABLES_RS_ADMIN_LEVEL_MD2 26
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_AUTHENTICATION_TYPE_ENABLES_RS_ADMIN_LEVEL_MD5 27
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_AUTHENTICATION_TYPE_ENABLES_RS_ADMIN_LEVEL_RESERVED1 28
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_AUTHENTICATION_TYPE_ENABLES_RS_ADMIN_LEVEL_STRAIGHT_PASSWORD 29
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_AUTHENTICATION_TYPE_ENABLES_RS_ADMIN_LEVEL_OEM_PROPRIETARY 30
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_AUTHENTICATION_TYPE_ENABLES_RS_ADMIN_LEVEL_RESERVED2 31
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_AUTHENTICATION_TYPE_ENABLES_RS_OEM_LEVEL_NONE 32
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_AUTHENTICATION_TYPE_ENABLES_RS_OEM_LEVEL_MD2 33
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_AUTHENTICATION_TYPE_ENABLES_RS_OEM_LEVEL_MD5 34
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_AUTHENTICATION_TYPE_ENABLES_RS_OEM_LEVEL_RESERVED1 35
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_AUTHENTICATION_TYPE_ENABLES_RS_OEM_LEVEL_STRAIGHT_PASSWORD 36
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_AUTHENTICATION_TYPE_ENABLES_RS_OEM_LEVEL_OEM_PROPRIETARY 37
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_AUTHENTICATION_TYPE_ENABLES_RS_OEM_LEVEL_RESERVED2 38
+
+/* tmpl_cmd_get_lan_configuration_parameters_ip_address_rs */
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IP_ADDRESS_RS_CMD 0
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IP_ADDRESS_RS_COMP_CODE 1
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IP_ADDRESS_RS_PRESENT_REVISION 2
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IP_ADDRESS_RS_OLDEST_REVISION_PARAMETER 3
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IP_ADDRESS_RS_IP_ADDRESS 4
+
+/* tmpl_cmd_get_lan_configuration_parameters_ip_address_source_rs */
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IP_ADDRESS_SOURCE_RS_CMD 0
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IP_ADDRESS_SOURCE_RS_COMP_CODE 1
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IP_ADDRESS_SOURCE_RS_PRESENT_REVISION 2
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IP_ADDRESS_SOURCE_RS_OLDEST_REVISION_PARAMETER 3
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IP_ADDRESS_SOURCE_RS_IP_ADDRESS_SOURCE 4
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IP_ADDRESS_SOURCE_RS_RESERVED 5
+
+/* tmpl_cmd_get_lan_configuration_parameters_mac_address_rs */
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_MAC_ADDRESS_RS_CMD 0
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_MAC_ADDRESS_RS_COMP_CODE 1
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_MAC_ADDRESS_RS_PRESENT_REVISION 2
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_MAC_ADDRESS_RS_OLDEST_REVISION_PARAMETER 3
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_MAC_ADDRESS_RS_MAC_ADDRESS 4
+
+/* tmpl_cmd_get_lan_configuration_parameters_subnet_mask_rs */
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_SUBNET_MASK_RS_CMD 0
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_SUBNET_MASK_RS_COMP_CODE 1
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_SUBNET_MASK_RS_PRESENT_REVISION 2
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_SUBNET_MASK_RS_OLDEST_REVISION_PARAMETER 3
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_SUBNET_MASK_RS_SUBNET_MASK 4
+
+/* tmpl_cmd_get_lan_configuration_parameters_ipv4_header_parameters_rs */
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV4_HEADER_PARAMETERS_RS_CMD 0
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV4_HEADER_PARAMETERS_RS_COMP_CODE 1
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV4_HEADER_PARAMETERS_RS_PRESENT_REVISION 2
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV4_HEADER_PARAMETERS_RS_OLDEST_REVISION_PARAMETER 3
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV4_HEADER_PARAMETERS_RS_TIME_TO_LIVE 4
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV4_HEADER_PARAMETERS_RS_RESERVED2 5
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV4_HEADER_PARAMETERS_RS_FLAGS 6
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV4_HEADER_PARAMETERS_RS_RESERVED3 7
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV4_HEADER_PARAMETERS_RS_TYPE_OF_SERVICE 8
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV4_HEADER_PARAMETERS_RS_PRECEDENCE 9
+
+/* tmpl_cmd_get_lan_configuration_parameters_primary_rmcp_port_number_rs */
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_PRIMARY_RMCP_PORT_NUMBER_RS_CMD 0
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_PRIMARY_RMCP_PORT_NUMBER_RS_COMP_CODE 1
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_PRIMARY_RMCP_PORT_NUMBER_RS_PRESENT_REVISION 2
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_PRIMARY_RMCP_PORT_NUMBER_RS_OLDEST_REVISION_PARAMETER 3
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_PRIMARY_RMCP_PORT_NUMBER_RS_PRIMARY_RMCP_PORT_NUMBER 4
+
+/* tmpl_cmd_get_lan_configuration_parameters_secondary_rmcp_port_number_rs */
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_SECONDARY_RMCP_PORT_NUMBER_RS_CMD 0
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_SECONDARY_RMCP_PORT_NUMBER_RS_COMP_CODE 1
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_SECONDARY_RMCP_PORT_NUMBER_RS_PRESENT_REVISION 2
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_SECONDARY_RMCP_PORT_NUMBER_RS_OLDEST_REVISION_PARAMETER 3
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_SECONDARY_RMCP_PORT_NUMBER_RS_SECONDARY_RMCP_PORT_NUMBER 4
+
+/* tmpl_cmd_get_lan_configuration_parameters_bmc_generated_arp_control_rs */
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_BMC_GENERATED_ARP_CONTROL_RS_CMD 0
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_BMC_GENERATED_ARP_CONTROL_RS_COMP_CODE 1
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_BMC_GENERATED_ARP_CONTROL_RS_PRESENT_REVISION 2
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_BMC_GENERATED_ARP_CONTROL_RS_OLDEST_REVISION_PARAMETER 3
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_BMC_GENERATED_ARP_CONTROL_RS_BMC_GENERATED_GRATUITOUS_ARPS 4
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_BMC_GENERATED_ARP_CONTROL_RS_BMC_GENERATED_ARP_RESPONSES 5
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_BMC_GENERATED_ARP_CONTROL_RS_RESERVED2 6
+
+/* tmpl_cmd_get_lan_configuration_parameters_gratuitous_arp_interval_rs */
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_GRATUITOUS_ARP_INTERVAL_RS_CMD 0
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_GRATUITOUS_ARP_INTERVAL_RS_COMP_CODE 1
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_GRATUITOUS_ARP_INTERVAL_RS_PRESENT_REVISION 2
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_GRATUITOUS_ARP_INTERVAL_RS_OLDEST_REVISION_PARAMETER 3
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_GRATUITOUS_ARP_INTERVAL_RS_GRATUITOUS_ARP_INTERVAL 4
+
+/* tmpl_cmd_get_lan_configuration_parameters_default_gateway_address_rs */
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_DEFAULT_GATEWAY_ADDRESS_RS_CMD 0
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_DEFAULT_GATEWAY_ADDRESS_RS_COMP_CODE 1
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_DEFAULT_GATEWAY_ADDRESS_RS_PRESENT_REVISION 2
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_DEFAULT_GATEWAY_ADDRESS_RS_OLDEST_REVISION_PARAMETER 3
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_DEFAULT_GATEWAY_ADDRESS_RS_IP_ADDRESS 4
+
+/* tmpl_cmd_get_lan_configuration_parameters_default_gateway_mac_address_rs */
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_DEFAULT_GATEWAY_MAC_ADDRESS_RS_CMD 0
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_DEFAULT_GATEWAY_MAC_ADDRESS_RS_COMP_CODE 1
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_DEFAULT_GATEWAY_MAC_ADDRESS_RS_PRESENT_REVISION 2
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_DEFAULT_GATEWAY_MAC_ADDRESS_RS_OLDEST_REVISION_PARAMETER 3
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_DEFAULT_GATEWAY_MAC_ADDRESS_RS_MAC_ADDRESS 4
+
+/* tmpl_cmd_get_lan_configuration_parameters_backup_gateway_address_rs */
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_BACKUP_GATEWAY_ADDRESS_RS_CMD 0
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_BACKUP_GATEWAY_ADDRESS_RS_COMP_CODE 1
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_BACKUP_GATEWAY_ADDRESS_RS_PRESENT_REVISION 2
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_BACKUP_GATEWAY_ADDRESS_RS_OLDEST_REVISION_PARAMETER 3
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_BACKUP_GATEWAY_ADDRESS_RS_IP_ADDRESS 4
+
+/* tmpl_cmd_get_lan_configuration_parameters_backup_gateway_mac_address_rs */
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_BACKUP_GATEWAY_MAC_ADDRESS_RS_CMD 0
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_BACKUP_GATEWAY_MAC_ADDRESS_RS_COMP_CODE 1
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_BACKUP_GATEWAY_MAC_ADDRESS_RS_PRESENT_REVISION 2
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_BACKUP_GATEWAY_MAC_ADDRESS_RS_OLDEST_REVISION_PARAMETER 3
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_BACKUP_GATEWAY_MAC_ADDRESS_RS_MAC_ADDRESS 4
+
+/* tmpl_cmd_get_lan_configuration_parameters_community_string_rs */
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_COMMUNITY_STRING_RS_CMD 0
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_COMMUNITY_STRING_RS_COMP_CODE 1
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_COMMUNITY_STRING_RS_PRESENT_REVISION 2
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_COMMUNITY_STRING_RS_OLDEST_REVISION_PARAMETER 3
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_COMMUNITY_STRING_RS_COMMUNITY_STRING 4
+
+/* tmpl_cmd_get_lan_configuration_parameters_number_of_destinations_rs */
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_NUMBER_OF_DESTINATIONS_RS_CMD 0
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_NUMBER_OF_DESTINATIONS_RS_COMP_CODE 1
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_NUMBER_OF_DESTINATIONS_RS_PRESENT_REVISION 2
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_NUMBER_OF_DESTINATIONS_RS_OLDEST_REVISION_PARAMETER 3
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_NUMBER_OF_DESTINATIONS_RS_NUMBER_OF_LAN_DESTINATIONS 4
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_NUMBER_OF_DESTINATIONS_RS_RESERVED 5
+
+/* tmpl_cmd_get_lan_configuration_parameters_destination_type_rs */
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_DESTINATION_TYPE_RS_CMD 0
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_DESTINATION_TYPE_RS_COMP_CODE 1
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_DESTINATION_TYPE_RS_PRESENT_REVISION 2
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_DESTINATION_TYPE_RS_OLDEST_REVISION_PARAMETER 3
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_DESTINATION_TYPE_RS_DESTINATION_SELECTOR 4
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_DESTINATION_TYPE_RS_RESERVED1 5
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_DESTINATION_TYPE_RS_DESTINATION_TYPE 6
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_DESTINATION_TYPE_RS_RESERVED2 7
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_DESTINATION_TYPE_RS_ALERT_ACKNOWLEDGE 8
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_DESTINATION_TYPE_RS_ALERT_ACKNOWLEDGE_TIMEOUT 9
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_DESTINATION_TYPE_RS_RETRIES 10
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_DESTINATION_TYPE_RS_RESERVED3 11
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_DESTINATION_TYPE_RS_RESERVED4 12
+
+/* tmpl_cmd_get_lan_configuration_parameters_destination_addresses_rs */
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_DESTINATION_ADDRESSES_RS_CMD 0
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_DESTINATION_ADDRESSES_RS_COMP_CODE 1
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_DESTINATION_ADDRESSES_RS_PRESENT_REVISION 2
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_DESTINATION_ADDRESSES_RS_OLDEST_REVISION_PARAMETER 3
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_DESTINATION_ADDRESSES_RS_DESTINATION_SELECTOR 4
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_DESTINATION_ADDRESSES_RS_RESERVED1 5
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_DESTINATION_ADDRESSES_RS_RESERVED2 6
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_DESTINATION_ADDRESSES_RS_ADDRESS_FORMAT 7
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_DESTINATION_ADDRESSES_RS_RESERVED3 8
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_DESTINATION_ADDRESSES_RS_GATEWAY_SELECTOR 9
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_DESTINATION_ADDRESSES_RS_ALERTING_IP_ADDRESS 10
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_DESTINATION_ADDRESSES_RS_ALERTING_MAC_ADDRESS 11
+
+/* tmpl_cmd_get_lan_configuration_parameters_vlan_id_rs */
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_VLAN_ID_RS_CMD 0
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_VLAN_ID_RS_COMP_CODE 1
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_VLAN_ID_RS_PRESENT_REVISION 2
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_VLAN_ID_RS_OLDEST_REVISION_PARAMETER 3
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_VLAN_ID_RS_VLAN_ID 4
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_VLAN_ID_RS_RESERVED 5
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_VLAN_ID_RS_VLAN_ID_ENABLE 6
+
+/* tmpl_cmd_get_lan_configuration_parameters_vlan_priority_rs */
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_VLAN_PRIORITY_RS_CMD 0
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_VLAN_PRIORITY_RS_COMP_CODE 1
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_VLAN_PRIORITY_RS_PRESENT_REVISION 2
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_VLAN_PRIORITY_RS_OLDEST_REVISION_PARAMETER 3
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_VLAN_PRIORITY_RS_VLAN_PRIORITY 4
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_VLAN_PRIORITY_RS_UNSPECIFIED 5
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_VLAN_PRIORITY_RS_RESERVED 6
+
+/* tmpl_cmd_get_lan_configuration_parameters_rmcpplus_messaging_cipher_suite_entry_support_rs */
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_RMCPPLUS_MESSAGING_CIPHER_SUITE_ENTRY_SUPPORT_RS_CMD 0
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_RMCPPLUS_MESSAGING_CIPHER_SUITE_ENTRY_SUPPORT_RS_COMP_CODE 1
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_RMCPPLUS_MESSAGING_CIPHER_SUITE_ENTRY_SUPPORT_RS_PRESENT_REVISION 2
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_RMCPPLUS_MESSAGING_CIPHER_SUITE_ENTRY_SUPPORT_RS_OLDEST_REVISION_PARAMETER 3
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_RMCPPLUS_MESSAGING_CIPHER_SUITE_ENTRY_SUPPORT_RS_CIPHER_SUITE_ENTRY_COUNT 4
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_RMCPPLUS_MESSAGING_CIPHER_SUITE_ENTRY_SUPPORT_RS_RESERVED 5
+
+/* tmpl_cmd_get_lan_configuration_parameters_rmcpplus_messaging_cipher_suite_entries_rs */
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_RMCPPLUS_MESSAGING_CIPHER_SUITE_ENTRIES_RS_CMD 0
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_RMCPPLUS_MESSAGING_CIPHER_SUITE_ENTRIES_RS_COMP_CODE 1
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_RMCPPLUS_MESSAGING_CIPHER_SUITE_ENTRIES_RS_PRESENT_REVISION 2
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_RMCPPLUS_MESSAGING_CIPHER_SUITE_ENTRIES_RS_OLDEST_REVISION_PARAMETER 3
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_RMCPPLUS_MESSAGING_CIPHER_SUITE_ENTRIES_RS_RESERVED 4
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_RMCPPLUS_MESSAGING_CIPHER_SUITE_ENTRIES_RS_CIPHER_SUITE_ID_ENTRY_A 5
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_RMCPPLUS_MESSAGING_CIPHER_SUITE_ENTRIES_RS_CIPHER_SUITE_ID_ENTRY_B 6
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_RMCPPLUS_MESSAGING_CIPHER_SUITE_ENTRIES_RS_CIPHER_SUITE_ID_ENTRY_C 7
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_RMCPPLUS_MESSAGING_CIPHER_SUITE_ENTRIES_RS_CIPHER_SUITE_ID_ENTRY_D 8
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_RMCPPLUS_MESSAGING_CIPHER_SUITE_ENTRIES_RS_CIPHER_SUITE_ID_ENTRY_E 9
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_RMCPPLUS_MESSAGING_CIPHER_SUITE_ENTRIES_RS_CIPHER_SUITE_ID_ENTRY_F 10
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_RMCPPLUS_MESSAGING_CIPHER_SUITE_ENTRIES_RS_CIPHER_SUITE_ID_ENTRY_G 11
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_RMCPPLUS_MESSAGING_CIPHER_SUITE_ENTRIES_RS_CIPHER_SUITE_ID_ENTRY_H 12
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_RMCPPLUS_MESSAGING_CIPHER_SUITE_ENTRIES_RS_CIPHER_SUITE_ID_ENTRY_I 13
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_RMCPPLUS_MESSAGING_CIPHER_SUITE_ENTRIES_RS_CIPHER_SUITE_ID_ENTRY_J 14
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_RMCPPLUS_MESSAGING_CIPHER_SUITE_ENTRIES_RS_CIPHER_SUITE_ID_ENTRY_K 15
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_RMCPPLUS_MESSAGING_CIPHER_SUITE_ENTRIES_RS_CIPHER_SUITE_ID_ENTRY_L 16
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_RMCPPLUS_MESSAGING_CIPHER_SUITE_ENTRIES_RS_CIPHER_SUITE_ID_ENTRY_M 17
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_RMCPPLUS_MESSAGING_CIPHER_SUITE_ENTRIES_RS_CIPHER_SUITE_ID_ENTRY_N 18
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_RMCPPLUS_MESSAGING_CIPHER_SUITE_ENTRIES_RS_CIPHER_SUITE_ID_ENTRY_O 19
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_RMCPPLUS_MESSAGING_CIPHER_SUITE_ENTRIES_RS_CIPHER_SUITE_ID_ENTRY_P 20
+
+/* tmpl_cmd_get_lan_configuration_parameters_rmcpplus_messaging_cipher_suite_privilege_levels_rs */
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_RMCPPLUS_MESSAGING_CIPHER_SUITE_PRIVILEGE_LEVELS_RS_CMD 0
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_RMCPPLUS_MESSAGING_CIPHER_SUITE_PRIVILEGE_LEVELS_RS_COMP_CODE 1
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_RMCPPLUS_MESSAGING_CIPHER_SUITE_PRIVILEGE_LEVELS_RS_PRESENT_REVISION 2
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_RMCPPLUS_MESSAGING_CIPHER_SUITE_PRIVILEGE_LEVELS_RS_OLDEST_REVISION_PARAMETER 3
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_RMCPPLUS_MESSAGING_CIPHER_SUITE_PRIVILEGE_LEVELS_RS_RESERVED 4
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_RMCPPLUS_MESSAGING_CIPHER_SUITE_PRIVILEGE_LEVELS_RS_MAXIMUM_PRIVILEGE_FOR_CIPHER_SUITE_1 5
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_RMCPPLUS_MESSAGING_CIPHER_SUITE_PRIVILEGE_LEVELS_RS_MAXIMUM_PRIVILEGE_FOR_CIPHER_SUITE_2 6
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_RMCPPLUS_MESSAGING_CIPHER_SUITE_PRIVILEGE_LEVELS_RS_MAXIMUM_PRIVILEGE_FOR_CIPHER_SUITE_3 7
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_RMCPPLUS_MESSAGING_CIPHER_SUITE_PRIVILEGE_LEVELS_RS_MAXIMUM_PRIVILEGE_FOR_CIPHER_SUITE_4 8
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_RMCPPLUS_MESSAGING_CIPHER_SUITE_PRIVILEGE_LEVELS_RS_MAXIMUM_PRIVILEGE_FOR_CIPHER_SUITE_5 9
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_RMCPPLUS_MESSAGING_CIPHER_SUITE_PRIVILEGE_LEVELS_RS_MAXIMUM_PRIVILEGE_FOR_CIPHER_SUITE_6 10
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_RMCPPLUS_MESSAGING_CIPHER_SUITE_PRIVILEGE_LEVELS_RS_MAXIMUM_PRIVILEGE_FOR_CIPHER_SUITE_7 11
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_RMCPPLUS_MESSAGING_CIPHER_SUITE_PRIVILEGE_LEVELS_RS_MAXIMUM_PRIVILEGE_FOR_CIPHER_SUITE_8 12
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_RMCPPLUS_MESSAGING_CIPHER_SUITE_PRIVILEGE_LEVELS_RS_MAXIMUM_PRIVILEGE_FOR_CIPHER_SUITE_9 13
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_RMCPPLUS_MESSAGING_CIPHER_SUITE_PRIVILEGE_LEVELS_RS_MAXIMUM_PRIVILEGE_FOR_CIPHER_SUITE_10 14
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_RMCPPLUS_MESSAGING_CIPHER_SUITE_PRIVILEGE_LEVELS_RS_MAXIMUM_PRIVILEGE_FOR_CIPHER_SUITE_11 15
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_RMCPPLUS_MESSAGING_CIPHER_SUITE_PRIVILEGE_LEVELS_RS_MAXIMUM_PRIVILEGE_FOR_CIPHER_SUITE_12 16
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_RMCPPLUS_MESSAGING_CIPHER_SUITE_PRIVILEGE_LEVELS_RS_MAXIMUM_PRIVILEGE_FOR_CIPHER_SUITE_13 17
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_RMCPPLUS_MESSAGING_CIPHER_SUITE_PRIVILEGE_LEVELS_RS_MAXIMUM_PRIVILEGE_FOR_CIPHER_SUITE_14 18
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_RMCPPLUS_MESSAGING_CIPHER_SUITE_PRIVILEGE_LEVELS_RS_MAXIMUM_PRIVILEGE_FOR_CIPHER_SUITE_15 19
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_RMCPPLUS_MESSAGING_CIPHER_SUITE_PRIVILEGE_LEVELS_RS_MAXIMUM_PRIVILEGE_FOR_CIPHER_SUITE_16 20
+
+/* tmpl_cmd_get_lan_configuration_parameters_bad_password_threshold_rs */
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_BAD_PASSWORD_THRESHOLD_RS_CMD 0
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_BAD_PASSWORD_THRESHOLD_RS_COMP_CODE 1
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_BAD_PASSWORD_THRESHOLD_RS_PRESENT_REVISION 2
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_BAD_PASSWORD_THRESHOLD_RS_OLDEST_REVISION_PARAMETER 3
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_BAD_PASSWORD_THRESHOLD_RS_USER_DISABLED_EVENT_MESSAGE 4
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_BAD_PASSWORD_THRESHOLD_RS_RESERVED2 5
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_BAD_PASSWORD_THRESHOLD_RS_BAD_PASSWORD_THRESHOLD_NUMBER 6
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_BAD_PASSWORD_THRESHOLD_RS_ATTEMPT_COUNT_RESET_INTERVAL 7
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_BAD_PASSWORD_THRESHOLD_RS_USER_LOCKOUT_INTERVAL 8
+
+/* tmpl_cmd_get_lan_configuration_parameters_ipv6_ipv4_support_rs */
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_IPV4_SUPPORT_RS_CMD 0
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_IPV4_SUPPORT_RS_COMP_CODE 1
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_IPV4_SUPPORT_RS_PRESENT_REVISION 2
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_IPV4_SUPPORT_RS_OLDEST_REVISION_PARAMETER 3
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_IPV4_SUPPORT_RS_SUPPORTS_IPV6_ONLY 4
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_IPV4_SUPPORT_RS_SUPPORTS_IPV6_AND_IPV4_SIMULTANEOUSLY 5
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_IPV4_SUPPORT_RS_SUPPORTS_IPV6_DESTINATION_ADDRESS_FOR_LAN_ALERT 6
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_IPV4_SUPPORT_RS_RESERVED2 7
+
+/* tmpl_cmd_get_lan_configuration_parameters_ipv6_ipv4_addressing_enables_rs */
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_IPV4_ADDRESSING_ENABLES_RS_CMD 0
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_IPV4_ADDRESSING_ENABLES_RS_COMP_CODE 1
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_IPV4_ADDRESSING_ENABLES_RS_PRESENT_REVISION 2
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_IPV4_ADDRESSING_ENABLES_RS_OLDEST_REVISION_PARAMETER 3
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_IPV4_ADDRESSING_ENABLES_RS_ENABLES 4
+
+/* tmpl_cmd_get_lan_configuration_parameters_ipv6_header_static_traffic_class_rs */
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_HEADER_STATIC_TRAFFIC_CLASS_RS_CMD 0
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_HEADER_STATIC_TRAFFIC_CLASS_RS_COMP_CODE 1
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_HEADER_STATIC_TRAFFIC_CLASS_RS_PRESENT_REVISION 2
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_HEADER_STATIC_TRAFFIC_CLASS_RS_OLDEST_REVISION_PARAMETER 3
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_HEADER_STATIC_TRAFFIC_CLASS_RS_TRAFFIC_CLASS 4
+
+/* tmpl_cmd_get_lan_configuration_parameters_ipv6_header_static_hop_limit_rs */
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_HEADER_STATIC_HOP_LIMIT_RS_CMD 0
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_HEADER_STATIC_HOP_LIMIT_RS_COMP_CODE 1
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_HEADER_STATIC_HOP_LIMIT_RS_PRESENT_REVISION 2
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_HEADER_STATIC_HOP_LIMIT_RS_OLDEST_REVISION_PARAMETER 3
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_HEADER_STATIC_HOP_LIMIT_RS_STATIC_HOP_LIMIT 4
+
+/* tmpl_cmd_get_lan_configuration_parameters_ipv6_header_flow_label_rs */
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_HEADER_FLOW_LABEL_RS_CMD 0
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_HEADER_FLOW_LABEL_RS_COMP_CODE 1
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_HEADER_FLOW_LABEL_RS_PRESENT_REVISION 2
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_HEADER_FLOW_LABEL_RS_OLDEST_REVISION_PARAMETER 3
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_HEADER_FLOW_LABEL_RS_FLOW_LABEL 4
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_HEADER_FLOW_LABEL_RS_RESERVED2 5
+
+/* tmpl_cmd_get_lan_configuration_parameters_ipv6_status_rs */
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_STATUS_RS_CMD 0
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_STATUS_RS_COMP_CODE 1
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_STATUS_RS_PRESENT_REVISION 2
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_STATUS_RS_OLDEST_REVISION_PARAMETER 3
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_STATUS_RS_STATIC_ADDRESS_MAX 4
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_STATUS_RS_DYNAMIC_ADDRESS_MAX 5
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_STATUS_RS_DHCPV6_ADDRESSING_SUPPORTED 6
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_STATUS_RS_SLAAC_ADDRESSING_SUPPORTED 7
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_STATUS_RS_RESERVED2 8
+
+/* tmpl_cmd_get_lan_configuration_parameters_ipv6_static_addresses_rs */
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_STATIC_ADDRESSES_RS_CMD 0
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_STATIC_ADDRESSES_RS_COMP_CODE 1
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_STATIC_ADDRESSES_RS_PRESENT_REVISION 2
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_STATIC_ADDRESSES_RS_OLDEST_REVISION_PARAMETER 3
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_STATIC_ADDRESSES_RS_SET_SELECTOR 4
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_STATIC_ADDRESSES_RS_SOURCE 5
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_STATIC_ADDRESSES_RS_RESERVED2 6
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_STATIC_ADDRESSES_RS_ENABLE 7
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_STATIC_ADDRESSES_RS_ADDRESS 8
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_STATIC_ADDRESSES_RS_ADDRESS_PREFIX_LENGTH 9
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_STATIC_ADDRESSES_RS_ADDRESS_STATUS 10
+
+/* tmpl_cmd_get_lan_configuration_parameters_ipv6_dhcpv6_static_duid_storage_length_rs */
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_DHCPV6_STATIC_DUID_STORAGE_LENGTH_RS_CMD 0
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_DHCPV6_STATIC_DUID_STORAGE_LENGTH_RS_COMP_CODE 1
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_DHCPV6_STATIC_DUID_STORAGE_LENGTH_RS_PRESENT_REVISION 2
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_DHCPV6_STATIC_DUID_STORAGE_LENGTH_RS_OLDEST_REVISION_PARAMETER 3
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_DHCPV6_STATIC_DUID_STORAGE_LENGTH_RS_MAXIMUM_BLOCKS 4
+
+/* tmpl_cmd_get_lan_configuration_parameters_ipv6_dhcpv6_static_duids_rs */
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_DHCPV6_STATIC_DUIDS_RS_CMD 0
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_DHCPV6_STATIC_DUIDS_RS_COMP_CODE 1
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_DHCPV6_STATIC_DUIDS_RS_PRESENT_REVISION 2
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_DHCPV6_STATIC_DUIDS_RS_OLDEST_REVISION_PARAMETER 3
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_DHCPV6_STATIC_DUIDS_RS_SET_SELECTOR 4
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_DHCPV6_STATIC_DUIDS_RS_BLOCK_SELECTOR 5
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_DHCPV6_STATIC_DUIDS_RS_DUID 6
+
+/* tmpl_cmd_get_lan_configuration_parameters_ipv6_dynamic_address_rs */
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_DYNAMIC_ADDRESS_RS_CMD 0
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_DYNAMIC_ADDRESS_RS_COMP_CODE 1
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_DYNAMIC_ADDRESS_RS_PRESENT_REVISION 2
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_DYNAMIC_ADDRESS_RS_OLDEST_REVISION_PARAMETER 3
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_DYNAMIC_ADDRESS_RS_SET_SELECTOR 4
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_DYNAMIC_ADDRESS_RS_SOURCE_TYPE 5
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_DYNAMIC_ADDRESS_RS_RESERVED2 6
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_DYNAMIC_ADDRESS_RS_ADDRESS 7
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_DYNAMIC_ADDRESS_RS_ADDRESS_PREFIX_LENGTH 8
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_DYNAMIC_ADDRESS_RS_ADDRESS_STATUS 9
+
+/* tmpl_cmd_get_lan_configuration_parameters_ipv6_dhcpv6_dynamic_duid_storage_length_rs */
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_DHCPV6_DYNAMIC_DUID_STORAGE_LENGTH_RS_CMD 0
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_DHCPV6_DYNAMIC_DUID_STORAGE_LENGTH_RS_COMP_CODE 1
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_DHCPV6_DYNAMIC_DUID_STORAGE_LENGTH_RS_PRESENT_REVISION 2
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_DHCPV6_DYNAMIC_DUID_STORAGE_LENGTH_RS_OLDEST_REVISION_PARAMETER 3
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_DHCPV6_DYNAMIC_DUID_STORAGE_LENGTH_RS_MAXIMUM_BLOCKS 4
+
+/* tmpl_cmd_get_lan_configuration_parameters_ipv6_dhcpv6_dynamic_duids_rs */
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_DHCPV6_DYNAMIC_DUIDS_RS_CMD 0
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_DHCPV6_DYNAMIC_DUIDS_RS_COMP_CODE 1
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_DHCPV6_DYNAMIC_DUIDS_RS_PRESENT_REVISION 2
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_DHCPV6_DYNAMIC_DUIDS_RS_OLDEST_REVISION_PARAMETER 3
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_DHCPV6_DYNAMIC_DUIDS_RS_SET_SELECTOR 4
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_DHCPV6_DYNAMIC_DUIDS_RS_BLOCK_SELECTOR 5
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_DHCPV6_DYNAMIC_DUIDS_RS_DUID 6
+
+/* tmpl_cmd_get_lan_configuration_parameters_ipv6_dhcpv6_timing_configuration_support_rs */
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_DHCPV6_TIMING_CONFIGURATION_SUPPORT_RS_CMD 0
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_DHCPV6_TIMING_CONFIGURATION_SUPPORT_RS_COMP_CODE 1
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_DHCPV6_TIMING_CONFIGURATION_SUPPORT_RS_PRESENT_REVISION 2
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_DHCPV6_TIMING_CONFIGURATION_SUPPORT_RS_OLDEST_REVISION_PARAMETER 3
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_DHCPV6_TIMING_CONFIGURATION_SUPPORT_RS_TIMING_CONFIGURATION 4
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_DHCPV6_TIMING_CONFIGURATION_SUPPORT_RS_RESERVED2 5
+
+/* tmpl_cmd_get_lan_configuration_parameters_ipv6_dhcpv6_timing_and_configuration_rs */
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_DHCPV6_TIMING_AND_CONFIGURATION_RS_CMD 0
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_DHCPV6_TIMING_AND_CONFIGURATION_RS_COMP_CODE 1
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_DHCPV6_TIMING_AND_CONFIGURATION_RS_PRESENT_REVISION 2
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_DHCPV6_TIMING_AND_CONFIGURATION_RS_OLDEST_REVISION_PARAMETER 3
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_DHCPV6_TIMING_AND_CONFIGURATION_RS_SET_SELECTOR 4
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_DHCPV6_TIMING_AND_CONFIGURATION_RS_BLOCK_SELECTOR 5
+
+/* tmpl_cmd_get_lan_configuration_parameters_ipv6_router_address_configuration_control_rs */
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_ROUTER_ADDRESS_CONFIGURATION_CONTROL_RS_CMD 0
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_ROUTER_ADDRESS_CONFIGURATION_CONTROL_RS_COMP_CODE 1
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_ROUTER_ADDRESS_CONFIGURATION_CONTROL_RS_PRESENT_REVISION 2
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_ROUTER_ADDRESS_CONFIGURATION_CONTROL_RS_OLDEST_REVISION_PARAMETER 3
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_ROUTER_ADDRESS_CONFIGURATION_CONTROL_RS_ENABLE_STATIC_ROUTER_ADDRESS 4
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_ROUTER_ADDRESS_CONFIGURATION_CONTROL_RS_ENABLE_DYNAMIC_ROUTER_ADDRESS 5
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_ROUTER_ADDRESS_CONFIGURATION_CONTROL_RS_RESERVED2 6
+
+/* tmpl_cmd_get_lan_configuration_parameters_ipv6_static_router_1_ip_address_rs */
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_STATIC_ROUTER_1_IP_ADDRESS_RS_CMD 0
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_STATIC_ROUTER_1_IP_ADDRESS_RS_COMP_CODE 1
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_STATIC_ROUTER_1_IP_ADDRESS_RS_PRESENT_REVISION 2
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_STATIC_ROUTER_1_IP_ADDRESS_RS_OLDEST_REVISION_PARAMETER 3
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_STATIC_ROUTER_1_IP_ADDRESS_RS_IPV6_ROUTER_IP_ADDRESS 4
+
+/* tmpl_cmd_get_lan_configuration_parameters_ipv6_static_router_1_mac_address_rs */
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_STATIC_ROUTER_1_MAC_ADDRESS_RS_CMD 0
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_STATIC_ROUTER_1_MAC_ADDRESS_RS_COMP_CODE 1
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_STATIC_ROUTER_1_MAC_ADDRESS_RS_PRESENT_REVISION 2
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_STATIC_ROUTER_1_MAC_ADDRESS_RS_OLDEST_REVISION_PARAMETER 3
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_STATIC_ROUTER_1_MAC_ADDRESS_RS_ROUTER_MAC_ADDRESS 4
+
+/* tmpl_cmd_get_lan_configuration_parameters_ipv6_static_router_1_prefix_length_rs */
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_STATIC_ROUTER_1_PREFIX_LENGTH_RS_CMD 0
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_STATIC_ROUTER_1_PREFIX_LENGTH_RS_COMP_CODE 1
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_STATIC_ROUTER_1_PREFIX_LENGTH_RS_PRESENT_REVISION 2
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_STATIC_ROUTER_1_PREFIX_LENGTH_RS_OLDEST_REVISION_PARAMETER 3
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_STATIC_ROUTER_1_PREFIX_LENGTH_RS_PREFIX_LENGTH 4
+
+/* tmpl_cmd_get_lan_configuration_parameters_ipv6_static_router_1_prefix_value_rs */
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_STATIC_ROUTER_1_PREFIX_VALUE_RS_CMD 0
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_STATIC_ROUTER_1_PREFIX_VALUE_RS_COMP_CODE 1
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_STATIC_ROUTER_1_PREFIX_VALUE_RS_PRESENT_REVISION 2
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_STATIC_ROUTER_1_PREFIX_VALUE_RS_OLDEST_REVISION_PARAMETER 3
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_STATIC_ROUTER_1_PREFIX_VALUE_RS_PREFIX_VALUE 4
+
+/* tmpl_cmd_get_lan_configuration_parameters_ipv6_static_router_2_ip_address_rs */
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_STATIC_ROUTER_2_IP_ADDRESS_RS_CMD 0
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_STATIC_ROUTER_2_IP_ADDRESS_RS_COMP_CODE 1
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_STATIC_ROUTER_2_IP_ADDRESS_RS_PRESENT_REVISION 2
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_STATIC_ROUTER_2_IP_ADDRESS_RS_OLDEST_REVISION_PARAMETER 3
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_STATIC_ROUTER_2_IP_ADDRESS_RS_IPV6_ROUTER_IP_ADDRESS 4
+
+/* tmpl_cmd_get_lan_configuration_parameters_ipv6_static_router_2_mac_address_rs */
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_STATIC_ROUTER_2_MAC_ADDRESS_RS_CMD 0
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_STATIC_ROUTER_2_MAC_ADDRESS_RS_COMP_CODE 1
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_STATIC_ROUTER_2_MAC_ADDRESS_RS_PRESENT_REVISION 2
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_STATIC_ROUTER_2_MAC_ADDRESS_RS_OLDEST_REVISION_PARAMETER 3
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_STATIC_ROUTER_2_MAC_ADDRESS_RS_ROUTER_MAC_ADDRESS 4
+
+/* tmpl_cmd_get_lan_configuration_parameters_ipv6_static_router_2_prefix_length_rs */
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_STATIC_ROUTER_2_PREFIX_LENGTH_RS_CMD 0
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_STATIC_ROUTER_2_PREFIX_LENGTH_RS_COMP_CODE 1
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_STATIC_ROUTER_2_PREFIX_LENGTH_RS_PRESENT_REVISION 2
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_STATIC_ROUTER_2_PREFIX_LENGTH_RS_OLDEST_REVISION_PARAMETER 3
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_STATIC_ROUTER_2_PREFIX_LENGTH_RS_PREFIX_LENGTH 4
+
+/* tmpl_cmd_get_lan_configuration_parameters_ipv6_static_router_2_prefix_value_rs */
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_STATIC_ROUTER_2_PREFIX_VALUE_RS_CMD 0
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_STATIC_ROUTER_2_PREFIX_VALUE_RS_COMP_CODE 1
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_STATIC_ROUTER_2_PREFIX_VALUE_RS_PRESENT_REVISION 2
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_STATIC_ROUTER_2_PREFIX_VALUE_RS_OLDEST_REVISION_PARAMETER 3
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_STATIC_ROUTER_2_PREFIX_VALUE_RS_PREFIX_VALUE 4
+
+/* tmpl_cmd_get_lan_configuration_parameters_number_of_dynamic_router_info_sets_rs */
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_NUMBER_OF_DYNAMIC_ROUTER_INFO_SETS_RS_CMD 0
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_NUMBER_OF_DYNAMIC_ROUTER_INFO_SETS_RS_COMP_CODE 1
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_NUMBER_OF_DYNAMIC_ROUTER_INFO_SETS_RS_PRESENT_REVISION 2
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_NUMBER_OF_DYNAMIC_ROUTER_INFO_SETS_RS_OLDEST_REVISION_PARAMETER 3
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_NUMBER_OF_DYNAMIC_ROUTER_INFO_SETS_RS_NUMBER_OF_DYNAMIC_ROUTER_ADDRESS_INFORMATION_ENTRIES 4
+
+/* tmpl_cmd_get_lan_configuration_parameters_ipv6_dynamic_router_info_ip_address_rs */
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_DYNAMIC_ROUTER_INFO_IP_ADDRESS_RS_CMD 0
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_DYNAMIC_ROUTER_INFO_IP_ADDRESS_RS_COMP_CODE 1
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_DYNAMIC_ROUTER_INFO_IP_ADDRESS_RS_PRESENT_REVISION 2
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_DYNAMIC_ROUTER_INFO_IP_ADDRESS_RS_OLDEST_REVISION_PARAMETER 3
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_DYNAMIC_ROUTER_INFO_IP_ADDRESS_RS_SET_SELECTOR 4
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_DYNAMIC_ROUTER_INFO_IP_ADDRESS_RS_ROUTER_IP_ADDRESS 5
+
+/* tmpl_cmd_get_lan_configuration_parameters_ipv6_dynamic_router_info_mac_address_rs */
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_DYNAMIC_ROUTER_INFO_MAC_ADDRESS_RS_CMD 0
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_DYNAMIC_ROUTER_INFO_MAC_ADDRESS_RS_COMP_CODE 1
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_DYNAMIC_ROUTER_INFO_MAC_ADDRESS_RS_PRESENT_REVISION 2
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_DYNAMIC_ROUTER_INFO_MAC_ADDRESS_RS_OLDEST_REVISION_PARAMETER 3
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_DYNAMIC_ROUTER_INFO_MAC_ADDRESS_RS_SET_SELECTOR 4
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_DYNAMIC_ROUTER_INFO_MAC_ADDRESS_RS_ROUTER_MAC_ADDRESS 5
+
+/* tmpl_cmd_get_lan_configuration_parameters_ipv6_dynamic_router_info_prefix_length_rs */
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_DYNAMIC_ROUTER_INFO_PREFIX_LENGTH_RS_CMD 0
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_DYNAMIC_ROUTER_INFO_PREFIX_LENGTH_RS_COMP_CODE 1
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_DYNAMIC_ROUTER_INFO_PREFIX_LENGTH_RS_PRESENT_REVISION 2
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_DYNAMIC_ROUTER_INFO_PREFIX_LENGTH_RS_OLDEST_REVISION_PARAMETER 3
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_DYNAMIC_ROUTER_INFO_PREFIX_LENGTH_RS_SET_SELECTOR 4
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_DYNAMIC_ROUTER_INFO_PREFIX_LENGTH_RS_PREFIX_LENGTH 5
+
+/* tmpl_cmd_get_lan_configuration_parameters_ipv6_dynamic_router_info_prefix_value_rs */
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_DYNAMIC_ROUTER_INFO_PREFIX_VALUE_RS_CMD 0
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_DYNAMIC_ROUTER_INFO_PREFIX_VALUE_RS_COMP_CODE 1
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_DYNAMIC_ROUTER_INFO_PREFIX_VALUE_RS_PRESENT_REVISION 2
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_DYNAMIC_ROUTER_INFO_PREFIX_VALUE_RS_OLDEST_REVISION_PARAMETER 3
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_DYNAMIC_ROUTER_INFO_PREFIX_VALUE_RS_SET_SELECTOR 4
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_DYNAMIC_ROUTER_INFO_PREFIX_VALUE_RS_PREFIX_VALUE 5
+
+/* tmpl_cmd_get_lan_configuration_parameters_ipv6_dynamic_router_received_hop_limit_rs */
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_DYNAMIC_ROUTER_RECEIVED_HOP_LIMIT_RS_CMD 0
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_DYNAMIC_ROUTER_RECEIVED_HOP_LIMIT_RS_COMP_CODE 1
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_DYNAMIC_ROUTER_RECEIVED_HOP_LIMIT_RS_PRESENT_REVISION 2
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_DYNAMIC_ROUTER_RECEIVED_HOP_LIMIT_RS_OLDEST_REVISION_PARAMETER 3
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_DYNAMIC_ROUTER_RECEIVED_HOP_LIMIT_RS_HOP_LIMIT 4
+
+/* tmpl_cmd_get_lan_configuration_parameters_ipv6_neighbor_discovery_slaac_timing_configuration_support_rs */
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_NEIGHBOR_DISCOVERY_SLAAC_TIMING_CONFIGURATION_SUPPORT_RS_CMD 0
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_NEIGHBOR_DISCOVERY_SLAAC_TIMING_CONFIGURATION_SUPPORT_RS_COMP_CODE 1
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_NEIGHBOR_DISCOVERY_SLAAC_TIMING_CONFIGURATION_SUPPORT_RS_PRESENT_REVISION 2
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_NEIGHBOR_DISCOVERY_SLAAC_TIMING_CONFIGURATION_SUPPORT_RS_OLDEST_REVISION_PARAMETER 3
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_NEIGHBOR_DISCOVERY_SLAAC_TIMING_CONFIGURATION_SUPPORT_RS_TIMING_CONFIGURATION 4
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_NEIGHBOR_DISCOVERY_SLAAC_TIMING_CONFIGURATION_SUPPORT_RS_RESERVED2 5
+
+/* tmpl_cmd_get_lan_configuration_parameters_ipv6_neighbor_discovery_slaac_timing_configuration_rs */
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_NEIGHBOR_DISCOVERY_SLAAC_TIMING_CONFIGURATION_RS_CMD 0
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_NEIGHBOR_DISCOVERY_SLAAC_TIMING_CONFIGURATION_RS_COMP_CODE 1
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_NEIGHBOR_DISCOVERY_SLAAC_TIMING_CONFIGURATION_RS_PRESENT_REVISION 2
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_NEIGHBOR_DISCOVERY_SLAAC_TIMING_CONFIGURATION_RS_OLDEST_REVISION_PARAMETER 3
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_NEIGHBOR_DISCOVERY_SLAAC_TIMING_CONFIGURATION_RS_SET_SELECTOR 4
+#define TMPL_CMD_GET_LAN_CONFIGURATION_PARAMETERS_IPV6_NEIGHBOR_DISCOVERY_SLAAC_TIMING_CONFIGURATION_RS_BLOCK_SELECTOR 5
+
+/* tmpl_cmd_suspend_bmc_arps_rq */
+#define TMPL_CMD_SUSPEND_BMC_ARPS_RQ_CMD 0
+#define TMPL_CMD_SUSPEND_BMC_ARPS_RQ_CHANNEL_NUMBER 1
+#define TMPL_CMD_SUSPEND_BMC_ARPS_RQ_RESERVED1 2
+#define TMPL_CMD_SUSPEND_BMC_ARPS_RQ_GRATUITOUS_ARP_SUSPEND 3
+#define TMPL_CMD_SUSPEND_BMC_ARPS_RQ_ARP_RESPONSE_SUSPEND 4
+#define TMPL_CMD_SUSPEND_BMC_ARPS_RQ_RESERVED2 5
+
+/* tmpl_cmd_suspend_bmc_arps_rs */
+#define TMPL_CMD_SUSPEND_BMC_ARPS_RS_CMD 0
+#define TMPL_CMD_SUSPEND_BMC_ARPS_RS_COMP_CODE 1
+#define TMPL_CMD_SUSPEND_BMC_ARPS_RS_GRATUITOUS_ARP_RESPONSE_STATUS 2
+#define TMPL_CMD_SUSPEND_BMC_ARPS_RS_ARP_RESPONSE_STATUS 3
+#define TMPL_CMD_SUSPEND_BMC_ARPS_RS_RESERVED 4
+
+/* tmpl_cmd_get_ip_udp_rmcp_statistics_rq */
+#define TMPL_CMD_GET_IP_UDP_RMCP_STATISTICS_RQ_CMD 0
+#define TMPL_CMD_GET_IP_UDP_RMCP_STATISTICS_RQ_CHANNEL_NUMBER 1
+#define TMPL_CMD_GET_IP_UDP_RMCP_STATISTICS_RQ_RESERVED1 2
+#define TMPL_CMD_GET_IP_UDP_RMCP_STATISTICS_RQ_CLEAR_ALL_STATISTICS 3
+#define TMPL_CMD_GET_IP_UDP_RMCP_STATISTICS_RQ_RESERVED2 4
+
+/* tmpl_cmd_get_ip_udp_rmcp_statistics_rs */
+#define TMPL_CMD_GET_IP_UDP_RMCP_STATISTICS_RS_CMD 0
+#define TMPL_CMD_GET_IP_UDP_RMCP_STATISTICS_RS_COMP_CODE 1
+#define TMPL_CMD_GET_IP_UDP_RMCP_STATISTICS_RS_IP_PACKETS_RECEIVED 2
+#define TMPL_CMD_GET_IP_UDP_RMCP_STATISTICS_RS_RECEIVED_IP_HEADER_ERRORS 3
+#define TMPL_CMD_GET_IP_UDP_RMCP_STATISTICS_RS_RECEIVED_IP_ADDRESS_ERRORS 4
+#define TMPL_CMD_GET_IP_UDP_RMCP_STATISTICS_RS_FRAGMENTED_IP_PACKETS_RECEIVED 5
+#define TMPL_CMD_GET_IP_UDP_RMCP_STATISTICS_RS_IP_PACKETS_TRANSMITTED 6
+#define TMPL_CMD_GET_IP_UDP_RMCP_STATISTICS_RS_UDP_PACKETS_RECEIVED 7
+#define TMPL_CMD_GET_IP_UDP_RMCP_STATISTICS_RS_VALID_RMCP_PACKETS_RECEIVED 8
+#define TMPL_CMD_GET_IP_UDP_RMCP_STATISTICS_RS_UDP_PROXY_PACKETS_RECEIVED 9
+#define TMPL_CMD_GET_IP_UDP_RMCP_STATISTICS_RS_UDP_PROXY_PACKETS_DROPPED 10
+
+/* tmpl_cmd_set_bmc_global_enables_rq */
+#define TMPL_CMD_SET_BMC_GLOBAL_ENABLES_RQ_CMD 0
+#define TMPL_CMD_SET_BMC_GLOBAL_ENABLES_RQ_RECEIVE_MESSAGE_QUEUE_INTERRUPT 1
+#define TMPL_CMD_SET_BMC_GLOBAL_ENABLES_RQ_EVENT_MESSAGE_BUFFER_FULL_INTERRUPT 2
+#define TMPL_CMD_SET_BMC_GLOBAL_ENABLES_RQ_EVENT_MESSAGE_BUFFER 3
+#define TMPL_CMD_SET_BMC_GLOBAL_ENABLES_RQ_SYSTEM_EVENT_LOGGING 4
+#define TMPL_CMD_SET_BMC_GLOBAL_ENABLES_RQ_RESERVED 5
+#define TMPL_CMD_SET_BMC_GLOBAL_ENABLES_RQ_OEM_0 6
+#define TMPL_CMD_SET_BMC_GLOBAL_ENABLES_RQ_OEM_1 7
+#define TMPL_CMD_SET_BMC_GLOBAL_ENABLES_RQ_OEM_2 8
+
+/* tmpl_cmd_set_bmc_global_enables_rs */
+#define TMPL_CMD_SET_BMC_GLOBAL_ENABLES_RS_CMD 0
+#define TMPL_CMD_SET_BMC_GLOBAL_ENABLES_RS_COMP_CODE 1
+
+/* tmpl_cmd_get_bmc_global_enables_rq */
+#define TMPL_CMD_GET_BMC_GLOBAL_ENABLES_RQ_CMD 0
+
+/* tmpl_cmd_get_bmc_global_enables_rs */
+#define TMPL_CMD_GET_BMC_GLOBAL_ENABLES_RS_CMD 0
+#define TMPL_CMD_GET_BMC_GLOBAL_ENABLES_RS_COMP_CODE 1
+#define TMPL_CMD_GET_BMC_GLOBAL_ENABLES_RS_RECEIVE_MESSAGE_QUEUE_INTERRUPT 2
+#define TMPL_CMD_GET_BMC_GLOBAL_ENABLES_RS_EVENT_MESSAGE_BUFFER_FULL_INTERRUPT 3
+#define TMPL_CMD_GET_BMC_GLOBAL_ENABLES_RS_EVENT_MESSAGE_BUFFER 4
+#define TMPL_CMD_GET_BMC_GLOBAL_ENABLES_RS_SYSTEM_EVENT_LOGGING 5
+#define TMPL_CMD_GET_BMC_GLOBAL_ENABLES_RS_RESERVED 6
+#define TMPL_CMD_GET_BMC_GLOBAL_ENABLES_RS_OEM_0 7
+#define TMPL_CMD_GET_BMC_GLOBAL_ENABLES_RS_OEM_1 8
+#define TMPL_CMD_GET_BMC_GLOBAL_ENABLES_RS_OEM_2 9
+
+/* tmpl_cmd_clear_message_flags_rq */
+#define TMPL_CMD_CLEAR_MESSAGE_FLAGS_RQ_CMD 0
+#define TMPL_CMD_CLEAR_MESSAGE_FLAGS_RQ_CLEAR_RECEIVE_MESSAGE_QUEUE 1
+#define TMPL_CMD_CLEAR_MESSAGE_FLAGS_RQ_CLEAR_EVENT_MESSAGE_BUFFER 2
+#define TMPL_CMD_CLEAR_MESSAGE_FLAGS_RQ_RESERVED1 3
+#define TMPL_CMD_CLEAR_MESSAGE_FLAGS_RQ_CLEAR_WATCHDOG_PRE_TIMEOUT_INTERRUPT_FLAG 4
+#define TMPL_CMD_CLEAR_MESSAGE_FLAGS_RQ_RESERVED2 5
+#define TMPL_CMD_CLEAR_MESSAGE_FLAGS_RQ_CLEAR_OEM_0 6
+#define TMPL_CMD_CLEAR_MESSAGE_FLAGS_RQ_CLEAR_OEM_1 7
+#define TMPL_CMD_CLEAR_MESSAGE_FLAGS_RQ_CLEAR_OEM_2 8
+
+/* tmpl_cmd_clear_message_flags_rs */
+#define TMPL_CMD_CLEAR_MESSAGE_FLAGS_RS_CMD 0
+#define TMPL_CMD_CLEAR_MESSAGE_FLAGS_RS_COMP_CODE 1
+
+/* tmpl_cmd_get_message_flags_rq */
+#define TMPL_CMD_GET_MESSAGE_FLAGS_RQ_CMD 0
+
+/* tmpl_cmd_get_message_flags_rs */
+#define TMPL_CMD_GET_MESSAGE_FLAGS_RS_CMD 0
+#define TMPL_CMD_GET_MESSAGE_FLAGS_RS_COMP_CODE 1
+#define TMPL_CMD_GET_MESSAGE_FLAGS_RS_RECEIVE_MESSAGE_AVAILABLE 2
+#define TMPL_CMD_GET_MESSAGE_FLAGS_RS_EVENT_MESSAGE_BUFFER_FULL 3
+#define TMPL_CMD_GET_MESSAGE_FLAGS_RS_RESERVED1 4
+#define TMPL_CMD_GET_MESSAGE_FLAGS_RS_WATCHDOG_PRE_TIMEOUT_INTERRUPT_OCCURRED 5
+#define TMPL_CMD_GET_MESSAGE_FLAGS_RS_RESERVED2 6
+#define TMPL_CMD_GET_MESSAGE_FLAGS_RS_OEM_0_DATA_AVAILABLE 7
+#define TMPL_CMD_GET_MESSAGE_FLAGS_RS_OEM_1_DATA_AVAILABLE 8
+#define TMPL_CMD_GET_MESSAGE_FLAGS_RS_OEM_2_DATA_AVAILABLE 9
+
+/* tmpl_cmd_enable_message_channel_receive_rq */
+#define TMPL_CMD_ENABLE_MESSAGE_CHANNEL_RECEIVE_RQ_CMD 0
+#define TMPL_CMD_ENABLE_MESSAGE_CHANNEL_RECEIVE_RQ_CHANNEL_NUMBER 1
+#define TMPL_CMD_ENABLE_MESSAGE_CHANNEL_RECEIVE_RQ_RESERVED1 2
+#define TMPL_CMD_ENABLE_MESSAGE_CHANNEL_RECEIVE_RQ_CHANNEL_OPERATION 3
+#define TMPL_CMD_ENABLE_MESSAGE_CHANNEL_RECEIVE_RQ_RESERVED2 4
+
+/* tmpl_cmd_enable_message_channel_receive_rs */
+#define TMPL_CMD_ENABLE_MESSAGE_CHANNEL_RECEIVE_RS_CMD 0
+#define TMPL_CMD_ENABLE_MESSAGE_CHANNEL_RECEIVE_RS_COMP_CODE 1
+#define TMPL_CMD_ENABLE_MESSAGE_CHANNEL_RECEIVE_RS_CHANNEL_NUMBER 2
+#define TMPL_CMD_ENABLE_MESSAGE_CHANNEL_RECEIVE_RS_RESERVED1 3
+#define TMPL_CMD_ENABLE_MESSAGE_CHANNEL_RECEIVE_RS_CHANNEL_STATE 4
+#define TMPL_CMD_ENABLE_MESSAGE_CHANNEL_RECEIVE_RS_RESERVED2 5
+
+/* tmpl_cmd_get_message_rq */
+#define TMPL_CMD_GET_MESSAGE_RQ_CMD 0
+
+/* tmpl_cmd_get_message_rs */
+#define TMPL_CMD_GET_MESSAGE_RS_CMD 0
+#define TMPL_CMD_GET_MESSAGE_RS_COMP_CODE 1
+#define TMPL_CMD_GET_MESSAGE_RS_CHANNEL_NUMBER 2
+#define TMPL_CMD_GET_MESSAGE_RS_INFERRED_PRIVILEGE_LEVEL 3
+#define TMPL_CMD_GET_MESSAGE_RS_MESSAGE_DATA 4
+
+/* tmpl_cmd_send_message_rq */
+#define TMPL_CMD_SEND_MESSAGE_RQ_CMD 0
+#define TMPL_CMD_SEND_MESSAGE_RQ_CHANNEL_NUMBER 1
+#define TMPL_CMD_SEND_MESSAGE_RQ_SEND_MESSAGE_WITH_AUTHENTICATION 2
+#define TMPL_CMD_SEND_MESSAGE_RQ_SEND_MESSAGE_WITH_ENCRYPTION 3
+#define TMPL_CMD_SEND_MESSAGE_RQ_TRACKING_OPERATION 4
+#define TMPL_CMD_SEND_MESSAGE_RQ_MESSAGE_DATA 5
+
+/* tmpl_cmd_send_message_rs */
+#define TMPL_CMD_SEND_MESSAGE_RS_CMD 0
+#define TMPL_CMD_SEND_MESSAGE_RS_COMP_CODE 1
+#define TMPL_CMD_SEND_MESSAGE_RS_RESPONSE_DATA 2
+
+/* tmpl_cmd_read_event_message_buffer_rq */
+#define TMPL_CMD_READ_EVENT_MESSAGE_BUFFER_RQ_CMD 0
+
+/* tmpl_cmd_read_event_message_buffer_rs */
+#define TMPL_CMD_READ_EVENT_MESSAGE_BUFFER_RS_CMD 0
+#define TMPL_CMD_READ_EVENT_MESSAGE_BUFFER_RS_COMP_CODE 1
+#define TMPL_CMD_READ_EVENT_MESSAGE_BUFFER_RS_MESSAGE_DATA 2
+
+/* tmpl_cmd_get_system_interface_capabilities_rq */
+#define TMPL_CMD_GET_SYSTEM_INTERFACE_CAPABILITIES_RQ_CMD 0
+#define TMPL_CMD_GET_SYSTEM_INTERFACE_CAPABILITIES_RQ_SYSTEM_INTERFACE 1
+#define TMPL_CMD_GET_SYSTEM_INTERFACE_CAPABILITIES_RQ_RESERVED 2
+
+/* tmpl_cmd_get_system_interface_capabilities_rs */
+#define TMPL_CMD_GET_SYSTEM_INTERFACE_CAPABILITIES_RS_CMD 0
+#define TMPL_CMD_GET_SYSTEM_INTERFACE_CAPABILITIES_RS_COMP_CODE 1
+#define TMPL_CMD_GET_SYSTEM_INTERFACE_CAPABILITIES_RS_RESERVED1 2
+#define TMPL_CMD_GET_SYSTEM_INTERFACE_CAPABILITIES_RS_DATA 3
+
+/* tmpl_cmd_get_system_interface_capabilities_ssif_rs */
+#define TMPL_CMD_GET_SYSTEM_INTERFACE_CAPABILITIES_SSIF_RS_CMD 0
+#define TMPL_CMD_GET_SYSTEM_INTERFACE_CAPABILITIES_SSIF_RS_COMP_CODE 1
+#define TMPL_CMD_GET_SYSTEM_INTERFACE_CAPABILITIES_SSIF_RS_RESERVED1 2
+#define TMPL_CMD_GET_SYSTEM_INTERFACE_CAPABILITIES_SSIF_RS_SSIF_VERSION 3
+#define TMPL_CMD_GET_SYSTEM_INTERFACE_CAPABILITIES_SSIF_RS_PEC_SUPPORT 4
+#define TMPL_CMD_GET_SYSTEM_INTERFACE_CAPABILITIES_SSIF_RS_RESERVED2 5
+#define TMPL_CMD_GET_SYSTEM_INTERFACE_CAPABILITIES_SSIF_RS_TRANSACTION_SUPPORT 6
+#define TMPL_CMD_GET_SYSTEM_INTERFACE_CAPABILITIES_SSIF_RS_INPUT_MESSAGE_SIZE 7
+#define TMPL_CMD_GET_SYSTEM_INTERFACE_CAPABILITIES_SSIF_RS_OUTPUT_MESSAGE_SIZE 8
+
+/* tmpl_cmd_get_system_interface_capabilities_kcs_rs */
+#define TMPL_CMD_GET_SYSTEM_INTERFACE_CAPABILITIES_KCS_RS_CMD 0
+#define TMPL_CMD_GET_SYSTEM_INTERFACE_CAPABILITIES_KCS_RS_COMP_CODE 1
+#define TMPL_CMD_GET_SYSTEM_INTERFACE_CAPABILITIES_KCS_RS_RESERVED1 2
+#define TMPL_CMD_GET_SYSTEM_INTERFACE_CAPABILITIES_KCS_RS_SYSTEM_INTERFACE_VERSION 3
+#define TMPL_CMD_GET_SYSTEM_INTERFACE_CAPABILITIES_KCS_RS_RESERVED 4
+#define TMPL_CMD_GET_SYSTEM_INTERFACE_CAPABILITIES_KCS_RS_INPUT_MAXIMUM_MESSAGE_SIZE 5
+
+/* tmpl_cmd_get_bt_interface_capabilities_rq */
+#define TMPL_CMD_GET_BT_INTERFACE_CAPABILITIES_RQ_CMD 0
+
+/* tmpl_cmd_get_bt_interface_capabilities_rs */
+#define TMPL_CMD_GET_BT_INTERFACE_CAPABILITIES_RS_CMD 0
+#define TMPL_CMD_GET_BT_INTERFACE_CAPABILITIES_RS_COMP_CODE 1
+#define TMPL_CMD_GET_BT_INTERFACE_CAPABILITIES_RS_NUMBER_OF_OUTSTANDING_REQUESTS_SUPPORTED 2
+#define TMPL_CMD_GET_BT_INTERFACE_CAPABILITIES_RS_INPUT_BUFFER_SIZE 3
+#define TMPL_CMD_GET_BT_INTERFACE_CAPABILITIES_RS_OUTPUT_BUFFER_SIZE 4
+#define TMPL_CMD_GET_BT_INTERFACE_CAPABILITIES_RS_BMC_REQUEST_TO_RESPONSE_TIME 5
+#define TMPL_CMD_GET_BT_INTERFACE_CAPABILITIES_RS_RECOMMENDED_RETRIES 6
+
+/* tmpl_cmd_master_write_read_rq */
+#define TMPL_CMD_MASTER_WRITE_READ_RQ_CMD 0
+#define TMPL_CMD_MASTER_WRITE_READ_RQ_BUS_TYPE 1
+#define TMPL_CMD_MASTER_WRITE_READ_RQ_BUS_ID 2
+#define TMPL_CMD_MASTER_WRITE_READ_RQ_CHANNEL_NUMBER 3
+#define TMPL_CMD_MASTER_WRITE_READ_RQ_RESERVED 4
+#define TMPL_CMD_MASTER_WRITE_READ_RQ_SLAVE_ADDRESS 5
+#define TMPL_CMD_MASTER_WRITE_READ_RQ_READ_COUNT 6
+#define TMPL_CMD_MASTER_WRITE_READ_RQ_DATA 7
+
+/* tmpl_cmd_master_write_read_rs */
+#define TMPL_CMD_MASTER_WRITE_READ_RS_CMD 0
+#define TMPL_CMD_MASTER_WRITE_READ_RS_COMP_CODE 1
+#define TMPL_CMD_MASTER_WRITE_READ_RS_DATA 2
+
+/* tmpl_cmd_get_channel_authentication_capabilities_rq */
+#define TMPL_CMD_GET_CHANNEL_AUTHENTICATION_CAPABILITIES_RQ_CMD 0
+#define TMPL_CMD_GET_CHANNEL_AUTHENTICATION_CAPABILITIES_RQ_CHANNEL_NUMBER 1
+#define TMPL_CMD_GET_CHANNEL_AUTHENTICATION_CAPABILITIES_RQ_RESERVED1 2
+#define TMPL_CMD_GET_CHANNEL_AUTHENTICATION_CAPABILITIES_RQ_GET_IPMI_V2_0_EXTENDED_DATA 3
+#define TMPL_CMD_GET_CHANNEL_AUTHENTICATION_CAPABILITIES_RQ_MAXIMUM_PRIVILEGE_LEVEL 4
+#define TMPL_CMD_GET_CHANNEL_AUTHENTICATION_CAPABILITIES_RQ_RESERVED2 5
+
+/* tmpl_cmd_get_channel_authentication_capabilities_rs */
+#define TMPL_CMD_GET_CHANNEL_AUTHENTICATION_CAPABILITIES_RS_CMD 0
+#define TMPL_CMD_GET_CHANNEL_AUTHENTICATION_CAPABILITIES_RS_COMP_CODE 1
+#define TMPL_CMD_GET_CHANNEL_AUTHENTICATION_CAPABILITIES_RS_CHANNEL_NUMBER 2
+#define TMPL_CMD_GET_CHANNEL_AUTHENTICATION_CAPABILITIES_RS_AUTHENTICATION_TYPE_NONE 3
+#define TMPL_CMD_GET_CHANNEL_AUTHENTICATION_CAPABILITIES_RS_AUTHENTICATION_TYPE_MD2 4
+#define TMPL_CMD_GET_CHANNEL_AUTHENTICATION_CAPABILITIES_RS_AUTHENTICATION_TYPE_MD5 5
+#define TMPL_CMD_GET_CHANNEL_AUTHENTICATION_CAPABILITIES_RS_AUTHENTICATION_TYPE_RESERVED1 6
+#define TMPL_CMD_GET_CHANNEL_AUTHENTICATION_CAPABILITIES_RS_AUTHENTICATION_TYPE_STRAIGHT_PASSWORD_KEY 7
+#define TMPL_CMD_GET_CHANNEL_AUTHENTICATION_CAPABILITIES_RS_AUTHENTICATION_TYPE_OEM_PROP 8
+#define TMPL_CMD_GET_CHANNEL_AUTHENTICATION_CAPABILITIES_RS_AUTHENTICATION_TYPE_RESERVED2 9
+#define TMPL_CMD_GET_CHANNEL_AUTHENTICATION_CAPABILITIES_RS_AUTHENTICATION_TYPE_IPMI_V2_0_EXTENDED_CAPABILITIES_AVAILABLE 10
+#define TMPL_CMD_GET_CHANNEL_AUTHENTICATION_CAPABILITIES_RS_AUTHENTICATION_STATUS_ANONYMOUS_LOGIN 11
+#define TMPL_CMD_GET_CHANNEL_AUTHENTICATION_CAPABILITIES_RS_AUTHENTICATION_STATUS_NULL_USERNAME 12
+#define TMPL_CMD_GET_CHANNEL_AUTHENTICATION_CAPABILITIES_RS_AUTHENTICATION_STATUS_NON_NULL_USERNAME 13
+#define TMPL_CMD_GET_CHANNEL_AUTHENTICATION_CAPABILITIES_RS_AUTHENTICATION_STATUS_USER_LEVEL_AUTHENTICATION 14
+#define TMPL_CMD_GET_CHANNEL_AUTHENTICATION_CAPABILITIES_RS_AUTHENTICATION_STATUS_PER_MESSAGE_AUTHENTICATION 15
+#define TMPL_CMD_GET_CHANNEL_AUTHENTICATION_CAPABILITIES_RS_AUTHENTICATION_STATUS_K_G 16
+#define TMPL_CMD_GET_CHANNEL_AUTHENTICATION_CAPABILITIES_RS_AUTHENTICATION_STATUS_RESERVED 17
+#define TMPL_CMD_GET_CHANNEL_AUTHENTICATION_CAPABILITIES_RS_CHANNEL_SUPPORTS_IPMI_V1_5_CONNECTIONS 18
+#define TMPL_CMD_GET_CHANNEL_AUTHENTICATION_CAPABILITIES_RS_CHANNEL_SUPPORTS_IPMI_V2_0_CONNECTIONS 19
+#define TMPL_CMD_GET_CHANNEL_AUTHENTICATION_CAPABILITIES_RS_RESERVED 20
+#define TMPL_CMD_GET_CHANNEL_AUTHENTICATION_CAPABILITIES_RS_OEM_ID 21
+#define TMPL_CMD_GET_CHANNEL_AUTHENTICATION_CAPABILITIES_RS_OEM_AUXILIARY_DATA 22
+
+/* tmpl_cmd_get_system_guid_rq */
+#define TMPL_CMD_GET_SYSTEM_GUID_RQ_CMD 0
+
+/* tmpl_cmd_get_system_guid_rs */
+#define TMPL_CMD_GET_SYSTEM_GUID_RS_CMD 0
+#define TMPL_CMD_GET_SYSTEM_GUID_RS_COMP_CODE 1
+#define TMPL_CMD_GET_SYSTEM_GUID_RS_GUID 2
+
+/* tmpl_cmd_get_system_guid_format_rs */
+#define TMPL_CMD_GET_SYSTEM_GUID_FORMAT_RS_CMD 0
+#define TMPL_CMD_GET_SYSTEM_GUID_FORMAT_RS_COMP_CODE 1
+#define TMPL_CMD_GET_SYSTEM_GUID_FORMAT_RS_NODE 2
+#define TMPL_CMD_GET_SYSTEM_GUID_FORMAT_RS_CLOCK_SEQ_LOW 3
+#define TMPL_CMD_GET_SYSTEM_GUID_FORMAT_RS_CLOCK_SEQ_HI_AND_RESERVED 4
+#define TMPL_CMD_GET_SYSTEM_GUID_FORMAT_RS_TIME_HIGH_AND_VERSION 5
+#define TMPL_CMD_GET_SYSTEM_GUID_FORMAT_RS_TIME_MID 6
+#define TMPL_CMD_GET_SYSTEM_GUID_FORMAT_RS_TIME_LOW 7
+
+/* tmpl_cmd_set_system_info_parameters_rq */
+#define TMPL_CMD_SET_SYSTEM_INFO_PARAMETERS_RQ_CMD 0
+#define TMPL_CMD_SET_SYSTEM_INFO_PARAMETERS_RQ_PARAMETER_SELECTOR 1
+#define TMPL_CMD_SET_SYSTEM_INFO_PARAMETERS_RQ_CONFIGURATION_PARAMETER_DATA 2
+
+/* tmpl_cmd_set_system_info_parameters_rs */
+#define TMPL_CMD_SET_SYSTEM_INFO_PARAMETERS_RS_CMD 0
+#define TMPL_CMD_SET_SYSTEM_INFO_PARAMETERS_RS_COMP_CODE 1
+
+/* tmpl_cmd_set_system_info_parameters_set_in_progress_rq */
+#define TMPL_CMD_SET_SYSTEM_INFO_PARAMETERS_SET_IN_PROGRESS_RQ_CMD 0
+#define TMPL_CMD_SET_SYSTEM_INFO_PARAMETERS_SET_IN_PROGRESS_RQ_PARAMETER_SELECTOR 1
+#define TMPL_CMD_SET_SYSTEM_INFO_PARAMETERS_SET_IN_PROGRESS_RQ_STATE 2
+#define TMPL_CMD_SET_SYSTEM_INFO_PARAMETERS_SET_IN_PROGRESS_RQ_RESERVED 3
+
+/* tmpl_cmd_set_system_info_parameters_system_firmware_version_first_set_rq */
+#define TMPL_CMD_SET_SYSTEM_INFO_PARAMETERS_SYSTEM_FIRMWARE_VERSION_FIRST_SET_RQ_CMD 0
+#define TMPL_CMD_SET_SYSTEM_INFO_PARAMETERS_SYSTEM_FIRMWARE_VERSION_FIRST_SET_RQ_PARAMETER_SELECTOR 1
+#define TMPL_CMD_SET_SYSTEM_INFO_PARAMETERS_SYSTEM_FIRMWARE_VERSION_FIRST_SET_RQ_SET_SELECTOR 2
+#define TMPL_CMD_SET_SYSTEM_INFO_PARAMETERS_SYSTEM_FIRMWARE_VERSION_FIRST_SET_RQ_ENCODING 3
+#define TMPL_CMD_SET_SYSTEM_INFO_PARAMETERS_SYSTEM_FIRMWARE_VERSION_FIRST_SET_RQ_RESERVED 4
+#define TMPL_CMD_SET_SYSTEM_INFO_PARAMETERS_SYSTEM_FIRMWARE_VERSION_FIRST_SET_RQ_STRING_LENGTH 5
+#define TMPL_CMD_SET_SYSTEM_INFO_PARAMETERS_SYSTEM_FIRMWARE_VERSION_FIRST_SET_RQ_STRING 6
+
+/* tmpl_cmd_set_system_info_parameters_system_firmware_version_rq */
+#define TMPL_CMD_SET_SYSTEM_INFO_PARAMETERS_SYSTEM_FIRMWARE_VERSION_RQ_CMD 0
+#define TMPL_CMD_SET_SYSTEM_INFO_PARAMETERS_SYSTEM_FIRMWARE_VERSION_RQ_PARAMETER_SELECTOR 1
+#define TMPL_CMD_SET_SYSTEM_INFO_PARAMETERS_SYSTEM_FIRMWARE_VERSION_RQ_SET_SELECTOR 2
+#define TMPL_CMD_SET_SYSTEM_INFO_PARAMETERS_SYSTEM_FIRMWARE_VERSION_RQ_STRING 3
+
+/* tmpl_cmd_set_system_info_parameters_system_name_first_set_rq */
+#define TMPL_CMD_SET_SYSTEM_INFO_PARAMETERS_SYSTEM_NAME_FIRST_SET_RQ_CMD 0
+#define TMPL_CMD_SET_SYSTEM_INFO_PARAMETERS_SYSTEM_NAME_FIRST_SET_RQ_PARAMETER_SELECTOR 1
+#define TMPL_CMD_SET_SYSTEM_INFO_PARAMETERS_SYSTEM_NAME_FIRST_SET_RQ_SET_SELECTOR 2
+#define TMPL_CMD_SET_SYSTEM_INFO_PARAMETERS_SYSTEM_NAME_FIRST_SET_RQ_ENCODING 3
+#define TMPL_CMD_SET_SYSTEM_INFO_PARAMETERS_SYSTEM_NAME_FIRST_SET_RQ_RESERVED 4
+#define TMPL_CMD_SET_SYSTEM_INFO_PARAMETERS_SYSTEM_NAME_FIRST_SET_RQ_STRING_LENGTH 5
+#define TMPL_CMD_SET_SYSTEM_INFO_PARAMETERS_SYSTEM_NAME_FIRST_SET_RQ_STRING 6
+
+/* tmpl_cmd_set_system_info_parameters_system_name_rq */
+#define TMPL_CMD_SET_SYSTEM_INFO_PARAMETERS_SYSTEM_NAME_RQ_CMD 0
+#define TMPL_CMD_SET_SYSTEM_INFO_PARAMETERS_SYSTEM_NAME_RQ_PARAMETER_SELECTOR 1
+#define TMPL_CMD_SET_SYSTEM_INFO_PARAMETERS_SYSTEM_NAME_RQ_SET_SELECTOR 2
+#define TMPL_CMD_SET_SYSTEM_INFO_PARAMETERS_SYSTEM_NAME_RQ_STRING 3
+
+/* tmpl_cmd_set_system_info_parameters_primary_operating_system_name_first_set_rq */
+#define TMPL_CMD_SET_SYSTEM_INFO_PARAMETERS_PRIMARY_OPERATING_SYSTEM_NAME_FIRST_SET_RQ_CMD 0
+#define TMPL_CMD_SET_SYSTEM_INFO_PARAMETERS_PRIMARY_OPERATING_SYSTEM_NAME_FIRST_SET_RQ_PARAMETER_SELECTOR 1
+#define TMPL_CMD_SET_SYSTEM_INFO_PARAMETERS_PRIMARY_OPERATING_SYSTEM_NAME_FIRST_SET_RQ_SET_SELECTOR 2
+#define TMPL_CMD_SET_SYSTEM_INFO_PARAMETERS_PRIMARY_OPERATING_SYSTEM_NAME_FIRST_SET_RQ_ENCODING 3
+#define TMPL_CMD_SET_SYSTEM_INFO_PARAMETERS_PRIMARY_OPERATING_SYSTEM_NAME_FIRST_SET_RQ_RESERVED 4
+#define TMPL_CMD_SET_SYSTEM_INFO_PARAMETERS_PRIMARY_OPERATING_SYSTEM_NAME_FIRST_SET_RQ_STRING_LENGTH 5
+#define TMPL_CMD_SET_SYSTEM_INFO_PARAMETERS_PRIMARY_OPERATING_SYSTEM_NAME_FIRST_SET_RQ_STRING 6
+
+/* tmpl_cmd_set_system_info_parameters_primary_operating_system_name_rq */
+#define TMPL_CMD_SET_SYSTEM_INFO_PARAMETERS_PRIMARY_OPERATING_SYSTEM_NAME_RQ_CMD 0
+#define TMPL_CMD_SET_SYSTEM_INFO_PARAMETERS_PRIMARY_OPERATING_SYSTEM_NAME_RQ_PARAMETER_SELECTOR 1
+#define TMPL_CMD_SET_SYSTEM_INFO_PARAMETERS_PRIMARY_OPERATING_SYSTEM_NAME_RQ_SET_SELECTOR 2
+#define TMPL_CMD_SET_SYSTEM_INFO_PARAMETERS_PRIMARY_OPERATING_SYSTEM_NAME_RQ_STRING 3
+
+/* tmpl_cmd_set_system_info_parameters_operating_system_name_first_set_rq */
+#define TMPL_CMD_SET_SYSTEM_INFO_PARAMETERS_OPERATING_SYSTEM_NAME_FIRST_SET_RQ_CMD 0
+#define TMPL_CMD_SET_SYSTEM_INFO_PARAMETERS_OPERATING_SYSTEM_NAME_FIRST_SET_RQ_PARAMETER_SELECTOR 1
+#define TMPL_CMD_SET_SYSTEM_INFO_PARAMETERS_OPERATING_SYSTEM_NAME_FIRST_SET_RQ_SET_SELECTOR 2
+#define TMPL_CMD_SET_SYSTEM_INFO_PARAMETERS_OPERATING_SYSTEM_NAME_FIRST_SET_RQ_ENCODING 3
+#define TMPL_CMD_SET_SYSTEM_INFO_PARAMETERS_OPERATING_SYSTEM_NAME_FIRST_SET_RQ_RESERVED 4
+#define TMPL_CMD_SET_SYSTEM_INFO_PARAMETERS_OPERATING_SYSTEM_NAME_FIRST_SET_RQ_STRING_LENGTH 5
+#define TMPL_CMD_SET_SYSTEM_INFO_PARAMETERS_OPERATING_SYSTEM_NAME_FIRST_SET_RQ_STRING 6
+
+/* tmpl_cmd_set_system_info_parameters_operating_system_name_rq */
+#define TMPL_CMD_SET_SYSTEM_INFO_PARAMETERS_OPERATING_SYSTEM_NAME_RQ_CMD 0
+#define TMPL_CMD_SET_SYSTEM_INFO_PARAMETERS_OPERATING_SYSTEM_NAME_RQ_PARAMETER_SELECTOR 1
+#define TMPL_CMD_SET_SYSTEM_INFO_PARAMETERS_OPERATING_SYSTEM_NAME_RQ_SET_SELECTOR 2
+#define TMPL_CMD_SET_SYSTEM_INFO_PARAMETERS_OPERATING_SYSTEM_NAME_RQ_STRING 3
+
+/* tmpl_cmd_set_system_info_parameters_present_os_version_number_first_set_rq */
+#define TMPL_CMD_SET_SYSTEM_INFO_PARAMETERS_PRESENT_OS_VERSION_NUMBER_FIRST_SET_RQ_CMD 0
+#define TMPL_CMD_SET_SYSTEM_INFO_PARAMETERS_PRESENT_OS_VERSION_NUMBER_FIRST_SET_RQ_PARAMETER_SELECTOR 1
+#define TMPL_CMD_SET_SYSTEM_INFO_PARAMETERS_PRESENT_OS_VERSION_NUMBER_FIRST_SET_RQ_SET_SELECTOR 2
+#define TMPL_CMD_SET_SYSTEM_INFO_PARAMETERS_PRESENT_OS_VERSION_NUMBER_FIRST_SET_RQ_ENCODING 3
+#define TMPL_CMD_SET_SYSTEM_INFO_PARAMETERS_PRESENT_OS_VERSION_NUMBER_FIRST_SET_RQ_RESERVED 4
+#define TMPL_CMD_SET_SYSTEM_INFO_PARAMETERS_PRESENT_OS_VERSION_NUMBER_FIRST_SET_RQ_STRING_LENGTH 5
+#define TMPL_CMD_SET_SYSTEM_INFO_PARAMETERS_PRESENT_OS_VERSION_NUMBER_FIRST_SET_RQ_STRING 6
+
+/* tmpl_cmd_set_system_info_parameters_present_os_version_number_rq */
+#define TMPL_CMD_SET_SYSTEM_INFO_PARAMETERS_PRESENT_OS_VERSION_NUMBER_RQ_CMD 0
+#define TMPL_CMD_SET_SYSTEM_INFO_PARAMETERS_PRESENT_OS_VERSION_NUMBER_RQ_PARAMETER_SELECTOR 1
+#define TMPL_CMD_SET_SYSTEM_INFO_PARAMETERS_PRESENT_OS_VERSION_NUMBER_RQ_SET_SELECTOR 2
+#define TMPL_CMD_SET_SYSTEM_INFO_PARAMETERS_PRESENT_OS_VERSION_NUMBER_RQ_STRING 3
+
+/* tmpl_cmd_set_system_info_parameters_bmc_url_first_set_rq */
+#define TMPL_CMD_SET_SYSTEM_INFO_PARAMETERS_BMC_URL_FIRST_SET_RQ_CMD 0
+#define TMPL_CMD_SET_SYSTEM_INFO_PARAMETERS_BMC_URL_FIRST_SET_RQ_PARAMETER_SELECTOR 1
+#define TMPL_CMD_SET_SYSTEM_INFO_PARAMETERS_BMC_URL_FIRST_SET_RQ_SET_SELECTOR 2
+#define TMPL_CMD_SET_SYSTEM_INFO_PARAMETERS_BMC_URL_FIRST_SET_RQ_ENCODING 3
+#define TMPL_CMD_SET_SYSTEM_INFO_PARAMETERS_BMC_URL_FIRST_SET_RQ_RESERVED 4
+#define TMPL_CMD_SET_SYSTEM_INFO_PARAMETERS_BMC_URL_FIRST_SET_RQ_STRING_LENGTH 5
+#define TMPL_CMD_SET_SYSTEM_INFO_PARAMETERS_BMC_URL_FIRST_SET_RQ_STRING 6
+
+/* tmpl_cmd_set_system_info_parameters_bmc_url_rq */
+#define TMPL_CMD_SET_SYSTEM_INFO_PARAMETERS_BMC_URL_RQ_CMD 0
+#define TMPL_CMD_SET_SYSTEM_INFO_PARAMETERS_BMC_URL_RQ_PARAMETER_SELECTOR 1
+#define TMPL_CMD_SET_SYSTEM_INFO_PARAMETERS_BMC_URL_RQ_SET_SELECTOR 2
+#define TMPL_CMD_SET_SYSTEM_INFO_PARAMETERS_BMC_URL_RQ_STRING 3
+
+/* tmpl_cmd_set_system_info_parameters_base_os_hypervisor_url_first_set_rq */
+#define TMPL_CMD_SET_SYSTEM_INFO_PARAMETERS_BASE_OS_HYPERVISOR_URL_FIRST_SET_RQ_CMD 0
+#define TMPL_CMD_SET_SYSTEM_INFO_PARAMETERS_BASE_OS_HYPERVISOR_URL_FIRST_SET_RQ_PARAMETER_SELECTOR 1
+#define TMPL_CMD_SET_SYSTEM_INFO_PARAMETERS_BASE_OS_HYPERVISOR_URL_FIRST_SET_RQ_SET_SELECTOR 2
+#define TMPL_CMD_SET_SYSTEM_INFO_PARAMETERS_BASE_OS_HYPERVISOR_URL_FIRST_SET_RQ_ENCODING 3
+#define TMPL_CMD_SET_SYSTEM_INFO_PARAMETERS_BASE_OS_HYPERVISOR_URL_FIRST_SET_RQ_RESERVED 4
+#define TMPL_CMD_SET_SYSTEM_INFO_PARAMETERS_BASE_OS_HYPERVISOR_URL_FIRST_SET_RQ_STRING_LENGTH 5
+#define TMPL_CMD_SET_SYSTEM_INFO_PARAMETERS_BASE_OS_HYPERVISOR_URL_FIRST_SET_RQ_STRING 6
+
+/* tmpl_cmd_set_system_info_parameters_base_os_hypervisor_url_rq */
+#define TMPL_CMD_SET_SYSTEM_INFO_PARAMETERS_BASE_OS_HYPERVISOR_URL_RQ_CMD 0
+#define TMPL_CMD_SET_SYSTEM_INFO_PARAMETERS_BASE_OS_HYPERVISOR_URL_RQ_PARAMETER_SELECTOR 1
+#define TMPL_CMD_SET_SYSTEM_INFO_PARAMETERS_BASE_OS_HYPERVISOR_URL_RQ_SET_SELECTOR 2
+#define TMPL_CMD_SET_SYSTEM_INFO_PARAMETERS_BASE_OS_HYPERVISOR_URL_RQ_STRING 3
+
+/* tmpl_cmd_get_system_info_parameters_rq */
+#define TMPL_CMD_GET_SYSTEM_INFO_PARAMETERS_RQ_CMD 0
+#define TMPL_CMD_GET_SYSTEM_INFO_PARAMETERS_RQ_RESERVED 1
+#define TMPL_CMD_GET_SYSTEM_INFO_PARAMETERS_RQ_GET_PARAMETER 2
+#define TMPL_CMD_GET_SYSTEM_INFO_PARAMETERS_RQ_PARAMETER_SELECTOR 3
+#define TMPL_CMD_GET_SYSTEM_INFO_PARAMETERS_RQ_SET_SELECTOR 4
+#define TMPL_CMD_GET_SYSTEM_INFO_PARAMETERS_RQ_BLOCK_SELECTOR 5
+
+/* tmpl_cmd_get_system_info_parameters_rs */
+#define TMPL_CMD_GET_SYSTEM_INFO_PARAMETERS_RS_CMD 0
+#define TMPL_CMD_GET_SYSTEM_INFO_PARAMETERS_RS_COMP_CODE 1
+#define TMPL_CMD_GET_SYSTEM_INFO_PARAMETERS_RS_PARAMETER_REVISION 2
+#define TMPL_CMD_GET_SYSTEM_INFO_PARAMETERS_RS_CONFIGURATION_PARAMETER_DATA 3
+
+/* tmpl_cmd_get_system_info_parameters_set_in_progress_rs */
+#define TMPL_CMD_GET_SYSTEM_INFO_PARAMETERS_SET_IN_PROGRESS_RS_CMD 0
+#define TMPL_CMD_GET_SYSTEM_INFO_PARAMETERS_SET_IN_PROGRESS_RS_COMP_CODE 1
+#define TMPL_CMD_GET_SYSTEM_INFO_PARAMETERS_SET_IN_PROGRESS_RS_PARAMETER_REVISION 2
+#define TMPL_CMD_GET_SYSTEM_INFO_PARAMETERS_SET_IN_PROGRESS_RS_STATE 3
+#define TMPL_CMD_GET_SYSTEM_INFO_PARAMETERS_SET_IN_PROGRESS_RS_RESERVED 4
+
+/* tmpl_cmd_get_system_info_parameters_system_firmware_version_first_set_rs */
+#define TMPL_CMD_GET_SYSTEM_INFO_PARAMETERS_SYSTEM_FIRMWARE_VERSION_FIRST_SET_RS_CMD 0
+#define TMPL_CMD_GET_SYSTEM_INFO_PARAMETERS_SYSTEM_FIRMWARE_VERSION_FIRST_SET_RS_COMP_CODE 1
+#define TMPL_CMD_GET_SYSTEM_INFO_PARAMETERS_SYSTEM_FIRMWARE_VERSION_FIRST_SET_RS_PARAMETER_REVISION 2
+#define TMPL_CMD_GET_SYSTEM_INFO_PARAMETERS_SYSTEM_FIRMWARE_VERSION_FIRST_SET_RS_SET_SELECTOR 3
+#define TMPL_CMD_GET_SYSTEM_INFO_PARAMETERS_SYSTEM_FIRMWARE_VERSION_FIRST_SET_RS_ENCODING 4
+#define TMPL_CMD_GET_SYSTEM_INFO_PARAMETERS_SYSTEM_FIRMWARE_VERSION_FIRST_SET_RS_RESERVED 5
+#define TMPL_CMD_GET_SYSTEM_INFO_PARAMETERS_SYSTEM_FIRMWARE_VERSION_FIRST_SET_RS_STRING_LENGTH 6
+#define TMPL_CMD_GET_SYSTEM_INFO_PARAMETERS_SYSTEM_FIRMWARE_VERSION_FIRST_SET_RS_STRING 7
+
+/* tmpl_cmd_get_system_info_parameters_system_firmware_version_rs */
+#define TMPL_CMD_GET_SYSTEM_INFO_PARAMETERS_SYSTEM_FIRMWARE_VERSION_RS_CMD 0
+#define TMPL_CMD_GET_SYSTEM_INFO_PARAMETERS_SYSTEM_FIRMWARE_VERSION_RS_COMP_CODE 1
+#define TMPL_CMD_GET_SYSTEM_INFO_PARAMETERS_SYSTEM_FIRMWARE_VERSION_RS_PARAMETER_REVISION 2
+#define TMPL_CMD_GET_SYSTEM_INFO_PARAMETERS_SYSTEM_FIRMWARE_VERSION_RS_SET_SELECTOR 3
+#define TMPL_CMD_GET_SYSTEM_INFO_PARAMETERS_SYSTEM_FIRMWARE_VERSION_RS_STRING 4
+
+/* tmpl_cmd_get_system_info_parameters_system_name_first_set_rs */
+#define TMPL_CMD_GET_SYSTEM_INFO_PARAMETERS_SYSTEM_NAME_FIRST_SET_RS_CMD 0
+#define TMPL_CMD_GET_SYSTEM_INFO_PARAMETERS_SYSTEM_NAME_FIRST_SET_RS_COMP_CODE 1
+#define TMPL_CMD_GET_SYSTEM_INFO_PARAMETERS_SYSTEM_NAME_FIRST_SET_RS_PARAMETER_REVISION 2
+#define TMPL_CMD_GET_SYSTEM_INFO_PARAMETERS_SYSTEM_NAME_FIRST_SET_RS_SET_SELECTOR 3
+#define TMPL_CMD_GET_SYSTEM_INFO_PARAMETERS_SYSTEM_NAME_FIRST_SET_RS_ENCODING 4
+#define TMPL_CMD_GET_SYSTEM_INFO_PARAMETERS_SYSTEM_NAME_FIRST_SET_RS_RESERVED 5
+#define TMPL_CMD_GET_SYSTEM_INFO_PARAMETERS_SYSTEM_NAME_FIRST_SET_RS_STRING_LENGTH 6
+#define TMPL_CMD_GET_SYSTEM_INFO_PARAMETERS_SYSTEM_NAME_FIRST_SET_RS_STRING 7
+
+/* tmpl_cmd_get_system_info_parameters_system_name_rs */
+#define TMPL_CMD_GET_SYSTEM_INFO_PARAMETERS_SYSTEM_NAME_RS_CMD 0
+#define TMPL_CMD_GET_SYSTEM_INFO_PARAMETERS_SYSTEM_NAME_RS_COMP_CODE 1
+#define TMPL_CMD_GET_SYSTEM_INFO_PARAMETERS_SYSTEM_NAME_RS_PARAMETER_REVISION 2
+#define TMPL_CMD_GET_SYSTEM_INFO_PARAMETERS_SYSTEM_NAME_RS_SET_SELECTOR 3
+#define TMPL_CMD_GET_SYSTEM_INFO_PARAMETERS_SYSTEM_NAME_RS_STRING 4
+
+/* tmpl_cmd_get_system_info_parameters_primary_operating_system_name_first_set_rs */
+#define TMPL_CMD_GET_SYSTEM_INFO_PARAMETERS_PRIMARY_OPERATING_SYSTEM_NAME_FIRST_SET_RS_CMD 0
+#define TMPL_CMD_GET_SYSTEM_INFO_PARAMETERS_PRIMARY_OPERATING_SYSTEM_NAME_FIRST_SET_RS_COMP_CODE 1
+#define TMPL_CMD_GET_SYSTEM_INFO_PARAMETERS_PRIMARY_OPERATING_SYSTEM_NAME_FIRST_SET_RS_PARAMETER_REVISION 2
+#define TMPL_CMD_GET_SYSTEM_INFO_PARAMETERS_PRIMARY_OPERATING_SYSTEM_NAME_FIRST_SET_RS_SET_SELECTOR 3
+#define TMPL_CMD_GET_SYSTEM_INFO_PARAMETERS_PRIMARY_OPERATING_SYSTEM_NAME_FIRST_SET_RS_ENCODING 4
+#define TMPL_CMD_GET_SYSTEM_INFO_PARAMETERS_PRIMARY_OPERATING_SYSTEM_NAME_FIRST_SET_RS_RESERVED 5
+#define TMPL_CMD_GET_SYSTEM_INFO_PARAMETERS_PRIMARY_OPERATING_SYSTEM_NAME_FIRST_SET_RS_STRING_LENGTH 6
+#define TMPL_CMD_GET_SYSTEM_INFO_PARAMETERS_PRIMARY_OPERATING_SYSTEM_NAME_FIRST_SET_RS_STRING 7
+
+/* tmpl_cmd_get_system_info_parameters_primary_operating_system_name_rs */
+#define TMPL_CMD_GET_SYSTEM_INFO_PARAMETERS_PRIMARY_OPERATING_SYSTEM_NAME_RS_CMD 0
+#define TMPL_CMD_GET_SYSTEM_INFO_PARAMETERS_PRIMARY_OPERATING_SYSTEM_NAME_RS_COMP_CODE 1
+#define TMPL_CMD_GET_SYSTEM_INFO_PARAMETERS_PRIMARY_OPERATING_SYSTEM_NAME_RS_PARAMETER_REVISION 2
+#define TMPL_CMD_GET_SYSTEM_INFO_PARAMETERS_PRIMARY_OPERATING_SYSTEM_NAME_RS_SET_SELECTOR 3
+#define TMPL_CMD_GET_SYSTEM_INFO_PARAMETERS_PRIMARY_OPERATING_SYSTEM_NAME_RS_STRING 4
+
+/* tmpl_cmd_get_system_info_parameters_operating_system_name_first_set_rs */
+#define TMPL_CMD_GET_SYSTEM_INFO_PARAMETERS_OPERATING_SYSTEM_NAME_FIRST_SET_RS_CMD 0
+#define TMPL_CMD_GET_SYSTEM_INFO_PARAMETERS_OPERATING_SYSTEM_NAME_FIRST_SET_RS_COMP_CODE 1
+#define TMPL_CMD_GET_SYSTEM_INFO_PARAMETERS_OPERATING_SYSTEM_NAME_FIRST_SET_RS_PARAMETER_REVISION 2
+#define TMPL_CMD_GET_SYSTEM_INFO_PARAMETERS_OPERATING_SYSTEM_NAME_FIRST_SET_RS_SET_SELECTOR 3
+#define TMPL_CMD_GET_SYSTEM_INFO_PARAMETERS_OPERATING_SYSTEM_NAME_FIRST_SET_RS_ENCODING 4
+#define TMPL_CMD_GET_SYSTEM_INFO_PARAMETERS_OPERATING_SYSTEM_NAME_FIRST_SET_RS_RESERVED 5
+#define TMPL_CMD_GET_SYSTEM_INFO_PARAMETERS_OPERATING_SYSTEM_NAME_FIRST_SET_RS_STRING_LENGTH 6
+#define TMPL_CMD_GET_SYSTEM_INFO_PARAMETERS_OPERATING_SYSTEM_NAME_FIRST_SET_RS_STRING 7
+
+/* tmpl_cmd_get_system_info_parameters_operating_system_name_rs */
+#define TMPL_CMD_GET_SYSTEM_INFO_PARAMETERS_OPERATING_SYSTEM_NAME_RS_CMD 0
+#define TMPL_CMD_GET_SYSTEM_INFO_PARAMETERS_OPERATING_SYSTEM_NAME_RS_COMP_CODE 1
+#define TMPL_CMD_GET_SYSTEM_INFO_PARAMETERS_OPERATING_SYSTEM_NAME_RS_PARAMETER_REVISION 2
+#define TMPL_CMD_GET_SYSTEM_INFO_PARAMETERS_OPERATING_SYSTEM_NAME_RS_SET_SELECTOR 3
+#define TMPL_CMD_GET_SYSTEM_INFO_PARAMETERS_OPERATING_SYSTEM_NAME_RS_STRING 4
+
+/* tmpl_cmd_get_system_info_parameters_present_os_version_number_first_set_rs */
+#define TMPL_CMD_GET_SYSTEM_INFO_PARAMETERS_PRESENT_OS_VERSION_NUMBER_FIRST_SET_RS_CMD 0
+#define TMPL_CMD_GET_SYSTEM_INFO_PARAMETERS_PRESENT_OS_VERSION_NUMBER_FIRST_SET_RS_COMP_CODE 1
+#define TMPL_CMD_GET_SYSTEM_INFO_PARAMETERS_PRESENT_OS_VERSION_NUMBER_FIRST_SET_RS_PARAMETER_REVISION 2
+#define TMPL_CMD_GET_SYSTEM_INFO_PARAMETERS_PRESENT_OS_VERSION_NUMBER_FIRST_SET_RS_SET_SELECTOR 3
+#define TMPL_CMD_GET_SYSTEM_INFO_PARAMETERS_PRESENT_OS_VERSION_NUMBER_FIRST_SET_RS_ENCODING 4
+#define TMPL_CMD_GET_SYSTEM_INFO_PARAMETERS_PRESENT_OS_VERSION_NUMBER_FIRST_SET_RS_RESERVED 5
+#define TMPL_CMD_GET_SYSTEM_INFO_PARAMETERS_PRESENT_OS_VERSION_NUMBER_FIRST_SET_RS_STRING_LENGTH 6
+#define TMPL_CMD_GET_SYSTEM_INFO_PARAMETERS_PRESENT_OS_VERSION_NUMBER_FIRST_SET_RS_STRING 7
+
+/* tmpl_cmd_get_system_info_parameters_present_os_version_number_rs */
+#define TMPL_CMD_GET_SYSTEM_INFO_PARAMETERS_PRESENT_OS_VERSION_NUMBER_RS_CMD 0
+#define TMPL_CMD_GET_SYSTEM_INFO_PARAMETERS_PRESENT_OS_VERSION_NUMBER_RS_COMP_CODE 1
+#define TMPL_CMD_GET_SYSTEM_INFO_PARAMETERS_PRESENT_OS_VERSION_NUMBER_RS_PARAMETER_REVISION 2
+#define TMPL_CMD_GET_SYSTEM_INFO_PARAMETERS_PRESENT_OS_VERSION_NUMBER_RS_SET_SELECTOR 3
+#define TMPL_CMD_GET_SYSTEM_INFO_PARAMETERS_PRESENT_OS_VERSION_NUMBER_RS_STRING 4
+
+/* tmpl_cmd_get_system_info_parameters_bmc_url_first_set_rs */
+#define TMPL_CMD_GET_SYSTEM_INFO_PARAMETERS_BMC_URL_FIRST_SET_RS_CMD 0
+#define TMPL_CMD_GET_SYSTEM_INFO_PARAMETERS_BMC_URL_FIRST_SET_RS_COMP_CODE 1
+#define TMPL_CMD_GET_SYSTEM_INFO_PARAMETERS_BMC_URL_FIRST_SET_RS_PARAMETER_REVISION 2
+#define TMPL_CMD_GET_SYSTEM_INFO_PARAMETERS_BMC_URL_FIRST_SET_RS_SET_SELECTOR 3
+#define TMPL_CMD_GET_SYSTEM_INFO_PARAMETERS_BMC_URL_FIRST_SET_RS_ENCODING 4
+#define TMPL_CMD_GET_SYSTEM_INFO_PARAMETERS_BMC_URL_FIRST_SET_RS_RESERVED 5
+#define TMPL_CMD_GET_SYSTEM_INFO_PARAMETERS_BMC_URL_FIRST_SET_RS_STRING_LENGTH 6
+#define TMPL_CMD_GET_SYSTEM_INFO_PARAMETERS_BMC_URL_FIRST_SET_RS_STRING 7
+
+/* tmpl_cmd_get_system_info_parameters_bmc_url_rs */
+#define TMPL_CMD_GET_SYSTEM_INFO_PARAMETERS_BMC_URL_RS_CMD 0
+#define TMPL_CMD_GET_SYSTEM_INFO_PARAMETERS_BMC_URL_RS_COMP_CODE 1
+#define TMPL_CMD_GET_SYSTEM_INFO_PARAMETERS_BMC_URL_RS_PARAMETER_REVISION 2
+#define TMPL_CMD_GET_SYSTEM_INFO_PARAMETERS_BMC_URL_RS_SET_SELECTOR 3
+#define TMPL_CMD_GET_SYSTEM_INFO_PARAMETERS_BMC_URL_RS_STRING 4
+
+/* tmpl_cmd_get_system_info_parameters_base_os_hypervisor_url_first_set_rs */
+#define TMPL_CMD_GET_SYSTEM_INFO_PARAMETERS_BASE_OS_HYPERVISOR_URL_FIRST_SET_RS_CMD 0
+#define TMPL_CMD_GET_SYSTEM_INFO_PARAMETERS_BASE_OS_HYPERVISOR_URL_FIRST_SET_RS_COMP_CODE 1
+#define TMPL_CMD_GET_SYSTEM_INFO_PARAMETERS_BASE_OS_HYPERVISOR_URL_FIRST_SET_RS_PARAMETER_REVISION 2
+#define TMPL_CMD_GET_SYSTEM_INFO_PARAMETERS_BASE_OS_HYPERVISOR_URL_FIRST_SET_RS_SET_SELECTOR 3
+#define TMPL_CMD_GET_SYSTEM_INFO_PARAMETERS_BASE_OS_HYPERVISOR_URL_FIRST_SET_RS_ENCODING 4
+#define TMPL_CMD_GET_SYSTEM_INFO_PARAMETERS_BASE_OS_HYPERVISOR_URL_FIRST_SET_RS_RESERVED 5
+#define TMPL_CMD_GET_SYSTEM_INFO_PARAMETERS_BASE_OS_HYPERVISOR_URL_FIRST_SET_RS_STRING_LENGTH 6
+#define TMPL_CMD_GET_SYSTEM_INFO_PARAMETERS_BASE_OS_HYPERVISOR_URL_FIRST_SET_RS_STRING 7
+
+/* tmpl_cmd_get_system_info_parameters_base_os_hypervisor_url_rs */
+#define TMPL_CMD_GET_SYSTEM_INFO_PARAMETERS_BASE_OS_HYPERVISOR_URL_RS_CMD 0
+#define TMPL_CMD_GET_SYSTEM_INFO_PARAMETERS_BASE_OS_HYPERVISOR_URL_RS_COMP_CODE 1
+#define TMPL_CMD_GET_SYSTEM_INFO_PARAMETERS_BASE_OS_HYPERVISOR_URL_RS_PARAMETER_REVISION 2
+#define TMPL_CMD_GET_SYSTEM_INFO_PARAMETERS_BASE_OS_HYPERVISOR_URL_RS_SET_SELECTOR 3
+#define TMPL_CMD_GET_SYSTEM_INFO_PARAMETERS_BASE_OS_HYPERVISOR_URL_RS_STRING 4
+
+/* tmpl_cmd_get_channel_cipher_suites_rq */
+#define TMPL_CMD_GET_CHANNEL_CIPHER_SUITES_RQ_CMD 0
+#define TMPL_CMD_GET_CHANNEL_CIPHER_SUITES_RQ_CHANNEL_NUMBER 1
+#define TMPL_CMD_GET_CHANNEL_CIPHER_SUITES_RQ_RESERVED1 2
+#define TMPL_CMD_GET_CHANNEL_CIPHER_SUITES_RQ_PAYLOAD_TYPE 3
+#define TMPL_CMD_GET_CHANNEL_CIPHER_SUITES_RQ_RESERVED2 4
+#define TMPL_CMD_GET_CHANNEL_CIPHER_SUITES_RQ_LIST_INDEX 5
+#define TMPL_CMD_GET_CHANNEL_CIPHER_SUITES_RQ_RESERVED3 6
+#define TMPL_CMD_GET_CHANNEL_CIPHER_SUITES_RQ_LIST_ALGORITHM_TYPE 7
+
+/* tmpl_cmd_get_channel_cipher_suites_rs */
+#define TMPL_CMD_GET_CHANNEL_CIPHER_SUITES_RS_CMD 0
+#define TMPL_CMD_GET_CHANNEL_CIPHER_SUITES_RS_COMP_CODE 1
+#define TMPL_CMD_GET_CHANNEL_CIPHER_SUITES_RS_CHANNEL_NUMBER 2
+#define TMPL_CMD_GET_CHANNEL_CIPHER_SUITES_RS_CIPHER_SUITE_RECORD_DATA 3
+
+/* tmpl_cmd_get_session_challenge_rq */
+#define TMPL_CMD_GET_SESSION_CHALLENGE_RQ_CMD 0
+#define TMPL_CMD_GET_SESSION_CHALLENGE_RQ_AUTHENTICATION_TYPE 1
+#define TMPL_CMD_GET_SESSION_CHALLENGE_RQ_RESERVED 2
+#define TMPL_CMD_GET_SESSION_CHALLENGE_RQ_USER_NAME 3
+
+/* tmpl_cmd_get_session_challenge_rs */
+#define TMPL_CMD_GET_SESSION_CHALLENGE_RS_CMD 0
+#define TMPL_CMD_GET_SESSION_CHALLENGE_RS_COMP_CODE 1
+#define TMPL_CMD_GET_SESSION_CHALLENGE_RS_TEMP_SESSION_ID 2
+#define TMPL_CMD_GET_SESSION_CHALLENGE_RS_CHALLENGE_STRING 3
+
+/* tmpl_cmd_activate_session_rq */
+#define TMPL_CMD_ACTIVATE_SESSION_RQ_CMD 0
+#define TMPL_CMD_ACTIVATE_SESSION_RQ_AUTHENTICATION_TYPE 1
+#define TMPL_CMD_ACTIVATE_SESSION_RQ_RESERVED1 2
+#define TMPL_CMD_ACTIVATE_SESSION_RQ_MAXIMUM_PRIVILEGE_LEVEL 3
+#define TMPL_CMD_ACTIVATE_SESSION_RQ_RESERVED2 4
+#define TMPL_CMD_ACTIVATE_SESSION_RQ_CHALLENGE_STRING 5
+#define TMPL_CMD_ACTIVATE_SESSION_RQ_INITIAL_OUTBOUND_SEQUENCE_NUMBER 6
+
+/* tmpl_cmd_activate_session_rs */
+#define TMPL_CMD_ACTIVATE_SESSION_RS_CMD 0
+#define TMPL_CMD_ACTIVATE_SESSION_RS_COMP_CODE 1
+#define TMPL_CMD_ACTIVATE_SESSION_RS_AUTHENTICATION_TYPE 2
+#define TMPL_CMD_ACTIVATE_SESSION_RS_RESERVED1 3
+#define TMPL_CMD_ACTIVATE_SESSION_RS_SESSION_ID 4
+#define TMPL_CMD_ACTIVATE_SESSION_RS_INITIAL_INBOUND_SEQUENCE_NUMBER 5
+#define TMPL_CMD_ACTIVATE_SESSION_RS_MAXIMUM_PRIVILEGE_LEVEL 6
+#define TMPL_CMD_ACTIVATE_SESSION_RS_RESERVED2 7
+
+/* tmpl_cmd_set_session_privilege_level_rq */
+#define TMPL_CMD_SET_SESSION_PRIVILEGE_LEVEL_RQ_CMD 0
+#define TMPL_CMD_SET_SESSION_PRIVILEGE_LEVEL_RQ_PRIVILEGE_LEVEL 1
+#define TMPL_CMD_SET_SESSION_PRIVILEGE_LEVEL_RQ_RESERVED1 2
+
+/* tmpl_cmd_set_session_privilege_level_rs */
+#define TMPL_CMD_SET_SESSION_PRIVILEGE_LEVEL_RS_CMD 0
+#define TMPL_CMD_SET_SESSION_PRIVILEGE_LEVEL_RS_COMP_CODE 1
+#define TMPL_CMD_SET_SESSION_PRIVILEGE_LEVEL_RS_PRIVILEGE_LEVEL 2
+#define TMPL_CMD_SET_SESSION_PRIVILEGE_LEVEL_RS_RESERVED1 3
+
+/* tmpl_cmd_close_session_rq */
+#define TMPL_CMD_CLOSE_SESSION_RQ_CMD 0
+#define TMPL_CMD_CLOSE_SESSION_RQ_SESSION_ID 1
+#define TMPL_CMD_CLOSE_SESSION_RQ_SESSION_HANDLE 2
+
+/* tmpl_cmd_close_session_rs */
+#define TMPL_CMD_CLOSE_SESSION_RS_CMD 0
+#define TMPL_CMD_CLOSE_SESSION_RS_COMP_CODE 1
+
+/* tmpl_cmd_set_channel_access_rq */
+#define TMPL_CMD_SET_CHANNEL_ACCESS_RQ_CMD 0
+#define TMPL_CMD_SET_CHANNEL_ACCESS_RQ_CHANNEL_NUMBER 1
+#define TMPL_CMD_SET_CHANNEL_ACCESS_RQ_RESERVED1 2
+#define TMPL_CMD_SET_CHANNEL_ACCESS_RQ_IPMI_MESSAGING_ACCESS_MODE 3
+#define TMPL_CMD_SET_CHANNEL_ACCESS_RQ_USER_LEVEL_AUTHENTICATION 4
+#define TMPL_CMD_SET_CHANNEL_ACCESS_RQ_PER_MESSAGE_AUTHENTICATION 5
+#define TMPL_CMD_SET_CHANNEL_ACCESS_RQ_PEF_ALERTING 6
+#define TMPL_CMD_SET_CHANNEL_ACCESS_RQ_CHANNEL_ACCESS_SET 7
+#define TMPL_CMD_SET_CHANNEL_ACCESS_RQ_CHANNEL_PRIVILEGE_LEVEL_LIMIT 8
+#define TMPL_CMD_SET_CHANNEL_ACCESS_RQ_RESERVED2 9
+#define TMPL_CMD_SET_CHANNEL_ACCESS_RQ_CHANNEL_PRIVILEGE_LEVEL_LIMIT_SET 10
+
+/* tmpl_cmd_set_channel_access_rs */
+#define TMPL_CMD_SET_CHANNEL_ACCESS_RS_CMD 0
+#define TMPL_CMD_SET_CHANNEL_ACCESS_RS_COMP_CODE 1
+
+/* tmpl_cmd_get_channel_access_rq */
+#define TMPL_CMD_GET_CHANNEL_ACCESS_RQ_CMD 0
+#define TMPL_CMD_GET_CHANNEL_ACCESS_RQ_CHANNEL_NUMBER 1
+#define TMPL_CMD_GET_CHANNEL_ACCESS_RQ_RESERVED1 2
+#define TMPL_CMD_GET_CHANNEL_ACCESS_RQ_RESERVED2 3
+#define TMPL_CMD_GET_CHANNEL_ACCESS_RQ_CHANNEL_ACCESS_GET 4
+
+/* tmpl_cmd_get_channel_access_rs */
+#define TMPL_CMD_GET_CHANNEL_ACCESS_RS_CMD 0
+#define TMPL_CMD_GET_CHANNEL_ACCESS_RS_COMP_CODE 1
+#define TMPL_CMD_GET_CHANNEL_ACCESS_RS_IPMI_MESSAGING_ACCESS_MODE 2
+#define TMPL_CMD_GET_CHANNEL_ACCESS_RS_USER_LEVEL_AUTHENTICATION 3
+#define TMPL_CMD_GET_CHANNEL_ACCESS_RS_PER_MESSAGE_AUTHENTICATION 4
+#define TMPL_CMD_GET_CHANNEL_ACCESS_RS_PEF_ALERTING 5
+#define TMPL_CMD_GET_CHANNEL_ACCESS_RS_RESERVED1 6
+#define TMPL_CMD_GET_CHANNEL_ACCESS_RS_CHANNEL_PRIVILEGE_LEVEL_LIMIT 7
+#define TMPL_CMD_GET_CHANNEL_ACCESS_RS_RESERVED2 8
+
+/* tmpl_cmd_get_channel_info_rq */
+#define TMPL_CMD_GET_CHANNEL_INFO_RQ_CMD 0
+#define TMPL_CMD_GET_CHANNEL_INFO_RQ_CHANNEL_NUMBER 1
+#define TMPL_CMD_GET_CHANNEL_INFO_RQ_RESERVED 2
+
+/* tmpl_cmd_get_channel_info_rs */
+#define TMPL_CMD_GET_CHANNEL_INFO_RS_CMD 0
+#define TMPL_CMD_GET_CHANNEL_INFO_RS_COMP_CODE 1
+#define TMPL_CMD_GET_CHANNEL_INFO_RS_ACTUAL_CHANNEL_NUMBER 2
+#define TMPL_CMD_GET_CHANNEL_INFO_RS_ACTUAL_CHANNEL_NUMBER_RESERVED 3
+#define TMPL_CMD_GET_CHANNEL_INFO_RS_CHANNEL_MEDIUM_TYPE 4
+#define TMPL_CMD_GET_CHANNEL_INFO_RS_CHANNEL_MEDIUM_TYPE_RESERVED 5
+#define TMPL_CMD_GET_CHANNEL_INFO_RS_CHANNEL_PROTOCOL_TYPE 6
+#define TMPL_CMD_GET_CHANNEL_INFO_RS_CHANNEL_PROTOCOL_TYPE_RESERVED 7
+#define TMPL_CMD_GET_CHANNEL_INFO_RS_ACTIVE_SESSION_COUNT 8
+#define TMPL_CMD_GET_CHANNEL_INFO_RS_SESSION_SUPPORT 9
+#define TMPL_CMD_GET_CHANNEL_INFO_RS_VENDOR_ID 10
+#define TMPL_CMD_GET_CHANNEL_INFO_RS_AUXILIARY_CHANNEL_INFO 11
+
+/* tmpl_cmd_set_channel_security_keys_rq */
+#define TMPL_CMD_SET_CHANNEL_SECURITY_KEYS_RQ_CMD 0
+#define TMPL_CMD_SET_CHANNEL_SECURITY_KEYS_RQ_CHANNEL_NUMBER 1
+#define TMPL_CMD_SET_CHANNEL_SECURITY_KEYS_RQ_RESERVED1 2
+#define TMPL_CMD_SET_CHANNEL_SECURITY_KEYS_RQ_OPERATION 3
+#define TMPL_CMD_SET_CHANNEL_SECURITY_KEYS_RQ_RESERVED2 4
+#define TMPL_CMD_SET_CHANNEL_SECURITY_KEYS_RQ_KEY_ID 5
+#define TMPL_CMD_SET_CHANNEL_SECURITY_KEYS_RQ_KEY_VALUE 6
+
+/* tmpl_cmd_set_channel_security_keys_rs */
+#define TMPL_CMD_SET_CHANNEL_SECURITY_KEYS_RS_CMD 0
+#define TMPL_CMD_SET_CHANNEL_SECURITY_KEYS_RS_COMP_CODE 1
+#define TMPL_CMD_SET_CHANNEL_SECURITY_KEYS_RS_LOCK_STATUS 2
+#define TMPL_CMD_SET_CHANNEL_SECURITY_KEYS_RS_RESERVED 3
+#define TMPL_CMD_SET_CHANNEL_SECURITY_KEYS_RS_KEY_VALUE 4
+
+/* tmpl_cmd_set_user_access_rq */
+#define TMPL_CMD_SET_USER_ACCESS_RQ_CMD 0
+#define TMPL_CMD_SET_USER_ACCESS_RQ_CHANNEL_NUMBER 1
+#define TMPL_CMD_SET_USER_ACCESS_RQ_USER_IPMI_MESSAGING 2
+#define TMPL_CMD_SET_USER_ACCESS_RQ_USER_LINK_AUTHENTICATION 3
+#define TMPL_CMD_SET_USER_ACCESS_RQ_USER_RESTRICTED_TO_CALLBACK 4
+#define TMPL_CMD_SET_USER_ACCESS_RQ_CHANGE_BITS_IN_BYTE 5
+#define TMPL_CMD_SET_USER_ACCESS_RQ_USER_ID 6
+#define TMPL_CMD_SET_USER_ACCESS_RQ_RESERVED1 7
+#define TMPL_CMD_SET_USER_ACCESS_RQ_USER_PRIVILEGE_LEVEL_LIMIT 8
+#define TMPL_CMD_SET_USER_ACCESS_RQ_RESERVED2 9
+#define TMPL_CMD_SET_USER_ACCESS_RQ_USER_SESSION_LIMIT 10
+#define TMPL_CMD_SET_USER_ACCESS_RQ_RESERVED3 11
+
+/* tmpl_cmd_set_user_access_rs */
+#define TMPL_CMD_SET_USER_ACCESS_RS_CMD 0
+#define TMPL_CMD_SET_USER_ACCESS_RS_COMP_CODE 1
+
+/* tmpl_cmd_get_user_access_rq */
+#define TMPL_CMD_GET_USER_ACCESS_RQ_CMD 0
+#define TMPL_CMD_GET_USER_ACCESS_RQ_CHANNEL_NUMBER 1
+#define TMPL_CMD_GET_USER_ACCESS_RQ_RESERVED1 2
+#define TMPL_CMD_GET_USER_ACCESS_RQ_USER_ID 3
+#define TMPL_CMD_GET_USER_ACCESS_RQ_RESERVED2 4
+
+/* tmpl_cmd_get_user_access_rs */
+#define TMPL_CMD_GET_USER_ACCESS_RS_CMD 0
+#define TMPL_CMD_GET_USER_ACCESS_RS_COMP_CODE 1
+#define TMPL_CMD_GET_USER_ACCESS_RS_MAX_CHANNEL_USER_IDS 2
+#define TMPL_CMD_GET_USER_ACCESS_RS_RESERVED1 3
+#define TMPL_CMD_GET_USER_ACCESS_RS_CURRENT_CHANNEL_USER_IDS 4
+#define TMPL_CMD_GET_USER_ACCESS_RS_USER_ID_ENABLE_STATUS 5
+#define TMPL_CMD_GET_USER_ACCESS_RS_CURRENT_CHANNEL_FIXED_NAMES 6
+#define TMPL_CMD_GET_USER_ACCESS_RS_RESERVED2 7
+#define TMPL_CMD_GET_USER_ACCESS_RS_USER_PRIVILEGE_LEVEL_LIMIT 8
+#define TMPL_CMD_GET_USER_ACCESS_RS_USER_IPMI_MESSAGING 9
+#define TMPL_CMD_GET_USER_ACCESS_RS_USER_LINK_AUTHENTICATION 10
+#define TMPL_CMD_GET_USER_ACCESS_RS_USER_RESTRICTED_TO_CALLBACK 11
+#define TMPL_CMD_GET_USER_ACCESS_RS_RESERVED3 12
+
+/* tmpl_cmd_set_user_name_rq */
+#define TMPL_CMD_SET_USER_NAME_RQ_CMD 0
+#define TMPL_CMD_SET_USER_NAME_RQ_USER_ID 1
+#define TMPL_CMD_SET_USER_NAME_RQ_USER_ID_RESERVED 2
+#define TMPL_CMD_SET_USER_NAME_RQ_USER_NAME 3
+
+/* tmpl_cmd_set_user_name_rs */
+#define TMPL_CMD_SET_USER_NAME_RS_CMD 0
+#define TMPL_CMD_SET_USER_NAME_RS_COMP_CODE 1
+
+/* tmpl_cmd_get_user_name_rq */
+#define TMPL_CMD_GET_USER_NAME_RQ_CMD 0
+#define TMPL_CMD_GET_USER_NAME_RQ_USER_ID 1
+#define TMPL_CMD_GET_USER_NAME_RQ_USER_ID_RESERVED 2
+
+/* tmpl_cmd_get_user_name_rs */
+#define TMPL_CMD_GET_USER_NAME_RS_CMD 0
+#define TMPL_CMD_GET_USER_NAME_RS_COMP_CODE 1
+#define TMPL_CMD_GET_USER_NAME_RS_USER_NAME 2
+
+/* tmpl_cmd_set_user_password_rq */
+#define TMPL_CMD_SET_USER_PASSWORD_RQ_CMD 0
+#define TMPL_CMD_SET_USER_PASSWORD_RQ_USER_ID 1
+#define TMPL_CMD_SET_USER_PASSWORD_RQ_USER_ID_RESERVED 2
+#define TMPL_CMD_SET_USER_PASSWORD_RQ_PASSWORD_SIZE 3
+#define TMPL_CMD_SET_USER_PASSWORD_RQ_OPERATION 4
+#define TMPL_CMD_SET_USER_PASSWORD_RQ_OPERATION_RESERVED 5
+#define TMPL_CMD_SET_USER_PASSWORD_RQ_PASSWORD 6
+
+/* tmpl_cmd_set_user_password_rs */
+#define TMPL_CMD_SET_USER_PASSWORD_RS_CMD 0
+#define TMPL_CMD_SET_USER_PASSWORD_RS_COMP_CODE 1
+
+/* tmpl_cmd_oem_intel_node_manager_enable_disable_node_manager_policy_control_rq */
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_ENABLE_DISABLE_NODE_MANAGER_POLICY_CONTROL_RQ_CMD 0
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_ENABLE_DISABLE_NODE_MANAGER_POLICY_CONTROL_RQ_MANUFACTURER_ID 1
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_ENABLE_DISABLE_NODE_MANAGER_POLICY_CONTROL_RQ_POLICY_ENABLE_DISABLE 2
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_ENABLE_DISABLE_NODE_MANAGER_POLICY_CONTROL_RQ_RESERVED1 3
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_ENABLE_DISABLE_NODE_MANAGER_POLICY_CONTROL_RQ_DOMAIN_ID 4
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_ENABLE_DISABLE_NODE_MANAGER_POLICY_CONTROL_RQ_RESERVED2 5
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_ENABLE_DISABLE_NODE_MANAGER_POLICY_CONTROL_RQ_POLICY_ID 6
+
+/* tmpl_cmd_oem_intel_node_manager_enable_disable_node_manager_policy_control_rs */
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_ENABLE_DISABLE_NODE_MANAGER_POLICY_CONTROL_RS_CMD 0
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_ENABLE_DISABLE_NODE_MANAGER_POLICY_CONTROL_RS_COMP_CODE 1
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_ENABLE_DISABLE_NODE_MANAGER_POLICY_CONTROL_RS_MANUFACTURER_ID 2
+
+/* tmpl_cmd_oem_intel_node_manager_set_node_manager_policy_rq */
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_POLICY_RQ_CMD 0
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_POLICY_RQ_MANUFACTURER_ID 1
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_POLICY_RQ_DOMAIN_ID 2
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_POLICY_RQ_POLICY_ENABLED 3
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_POLICY_RQ_RESERVED 4
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_POLICY_RQ_POLICY_ID 5
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_POLICY_RQ_POLICY_TRIGGER_TYPE 6
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_POLICY_RQ_POLICY_CONFIGURATION_ACTION 7
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_POLICY_RQ_AGGRESSIVE_CPU_POWER_CORRECTION 8
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_POLICY_RQ_POLICY_STORAGE_OPTION 9
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_POLICY_RQ_POLICY_EXCEPTION_ACTIONS_SEND_ALERT 10
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_POLICY_RQ_POLICY_EXCEPTION_ACTIONS_SHUTDOWN_SYSTEM 11
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_POLICY_RQ_POLICY_EXCEPTION_ACTIONS_RESERVED 12
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_POLICY_RQ_POLICY_POWER_DOMAIN 13
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_POLICY_RQ_POLICY_TARGET_LIMIT 14
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_POLICY_RQ_CORRECTION_TIME_LIMIT 15
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_POLICY_RQ_POLICY_TRIGGER_LIMIT 16
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_POLICY_RQ_STATISTICS_REPORTING_PERIOD 17
+
+/* tmpl_cmd_oem_intel_node_manager_set_node_manager_policy_boot_time_policy_rq */
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_POLICY_BOOT_TIME_POLICY_RQ_CMD 0
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_POLICY_BOOT_TIME_POLICY_RQ_MANUFACTURER_ID 1
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_POLICY_BOOT_TIME_POLICY_RQ_DOMAIN_ID 2
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_POLICY_BOOT_TIME_POLICY_RQ_POLICY_ENABLED 3
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_POLICY_BOOT_TIME_POLICY_RQ_RESERVED 4
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_POLICY_BOOT_TIME_POLICY_RQ_POLICY_ID 5
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_POLICY_BOOT_TIME_POLICY_RQ_POLICY_TRIGGER_TYPE 6
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_POLICY_BOOT_TIME_POLICY_RQ_POLICY_CONFIGURATION_ACTION 7
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_POLICY_BOOT_TIME_POLICY_RQ_AGGRESSIVE_CPU_POWER_CORRECTION 8
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_POLICY_BOOT_TIME_POLICY_RQ_POLICY_STORAGE_OPTION 9
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_POLICY_BOOT_TIME_POLICY_RQ_POLICY_EXCEPTION_ACTIONS_SEND_ALERT 10
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_POLICY_BOOT_TIME_POLICY_RQ_POLICY_EXCEPTION_ACTIONS_SHUTDOWN_SYSTEM 11
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_POLICY_BOOT_TIME_POLICY_RQ_POLICY_EXCEPTION_ACTIONS_RESERVED 12
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_POLICY_BOOT_TIME_POLICY_RQ_POLICY_POWER_DOMAIN 13
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_POLICY_BOOT_TIME_POLICY_RQ_POLICY_TARGET_LIMIT_PLATFORM_BOOTING_MODE 14
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_POLICY_BOOT_TIME_POLICY_RQ_POLICY_TARGET_LIMIT_CORES_DISABLED 15
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_POLICY_BOOT_TIME_POLICY_RQ_POLICY_TARGET_LIMIT_RESERVED 16
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_POLICY_BOOT_TIME_POLICY_RQ_POLICY_TARGET_LIMIT 17
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_POLICY_BOOT_TIME_POLICY_RQ_CORRECTION_TIME_LIMIT 18
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_POLICY_BOOT_TIME_POLICY_RQ_POLICY_TRIGGER_LIMIT 19
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_POLICY_BOOT_TIME_POLICY_RQ_STATISTICS_REPORTING_PERIOD 20
+
+/* tmpl_cmd_oem_intel_node_manager_set_node_manager_policy_rs */
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_POLICY_RS_CMD 0
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_POLICY_RS_COMP_CODE 1
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_POLICY_RS_MANUFACTURER_ID 2
+
+/* tmpl_cmd_oem_intel_node_manager_get_node_manager_policy_rq */
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_POLICY_RQ_CMD 0
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_POLICY_RQ_MANUFACTURER_ID 1
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_POLICY_RQ_DOMAIN_ID 2
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_POLICY_RQ_RESERVED 3
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_POLICY_RQ_POLICY_ID 4
+
+/* tmpl_cmd_oem_intel_node_manager_get_node_manager_policy_rs */
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_POLICY_RS_CMD 0
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_POLICY_RS_COMP_CODE 1
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_POLICY_RS_MANUFACTURER_ID 2
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_POLICY_RS_DOMAIN_ID 3
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_POLICY_RS_POLICY_ENABLED 4
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_POLICY_RS_PER_DOMAIN_NODE_MANAGER_POLICY_CONTROL_ENABLED 5
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_POLICY_RS_GLOBAL_NODE_MANAGER_POLICY_CONTROL_ENABLED 6
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_POLICY_RS_POLICY_CREATED_AND_MANAGED_BY_OTHER_MANAGEMENT 7
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_POLICY_RS_POLICY_TRIGGER_TYPE 8
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_POLICY_RS_POLICY_TYPE 9
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_POLICY_RS_AGGRESSIVE_CPU_POWER_CORRECTION 10
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_POLICY_RS_POLICY_STORAGE_OPTION 11
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_POLICY_RS_POLICY_EXCEPTION_ACTIONS_SEND_ALERT 12
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_POLICY_RS_POLICY_EXCEPTION_ACTIONS_SHUTDOWN_SYSTEM 13
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_POLICY_RS_POLICY_EXCEPTION_ACTIONS_RESERVED 14
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_POLICY_RS_POLICY_POWER_DOMAIN 15
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_POLICY_RS_POLICY_TARGET_LIMIT 16
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_POLICY_RS_CORRECTION_TIME_LIMIT 17
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_POLICY_RS_POLICY_TRIGGER_LIMIT 18
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_POLICY_RS_STATISTICS_REPORTING_PERIOD 19
+
+/* tmpl_cmd_oem_intel_node_manager_set_node_manager_policy_alert_thresholds_rq */
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_POLICY_ALERT_THRESHOLDS_RQ_CMD 0
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_POLICY_ALERT_THRESHOLDS_RQ_MANUFACTURER_ID 1
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_POLICY_ALERT_THRESHOLDS_RQ_DOMAIN_ID 2
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_POLICY_ALERT_THRESHOLDS_RQ_RESERVED 3
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_POLICY_ALERT_THRESHOLDS_RQ_POLICY_ID 4
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_POLICY_ALERT_THRESHOLDS_RQ_NUMBER_OF_ALERT_THRESHOLDS 5
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_POLICY_ALERT_THRESHOLDS_RQ_ALERT_THRESHOLD1 6
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_POLICY_ALERT_THRESHOLDS_RQ_ALERT_THRESHOLD2 7
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_POLICY_ALERT_THRESHOLDS_RQ_ALERT_THRESHOLD3 8
+
+/* tmpl_cmd_oem_intel_node_manager_set_node_manager_policy_alert_thresholds_rs */
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_POLICY_ALERT_THRESHOLDS_RS_CMD 0
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_POLICY_ALERT_THRESHOLDS_RS_COMP_CODE 1
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_POLICY_ALERT_THRESHOLDS_RS_MANUFACTURER_ID 2
+
+/* tmpl_cmd_oem_intel_node_manager_get_node_manager_policy_alert_thresholds_rq */
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_POLICY_ALERT_THRESHOLDS_RQ_CMD 0
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_POLICY_ALERT_THRESHOLDS_RQ_MANUFACTURER_ID 1
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_POLICY_ALERT_THRESHOLDS_RQ_DOMAIN_ID 2
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_POLICY_ALERT_THRESHOLDS_RQ_RESERVED 3
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_POLICY_ALERT_THRESHOLDS_RQ_POLICY_ID 4
+
+/* tmpl_cmd_oem_intel_node_manager_get_node_manager_policy_alert_thresholds_rs */
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_POLICY_ALERT_THRESHOLDS_RS_CMD 0
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_POLICY_ALERT_THRESHOLDS_RS_COMP_CODE 1
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_POLICY_ALERT_THRESHOLDS_RS_MANUFACTURER_ID 2
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_POLICY_ALERT_THRESHOLDS_RS_NUMBER_OF_ALERT_THRESHOLDS 3
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_POLICY_ALERT_THRESHOLDS_RS_ALERT_THRESHOLD1 4
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_POLICY_ALERT_THRESHOLDS_RS_ALERT_THRESHOLD2 5
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_POLICY_ALERT_THRESHOLDS_RS_ALERT_THRESHOLD3 6
+
+/* tmpl_cmd_oem_intel_node_manager_set_node_manager_policy_suspend_periods_rq */
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_POLICY_SUSPEND_PERIODS_RQ_CMD 0
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_POLICY_SUSPEND_PERIODS_RQ_MANUFACTURER_ID 1
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_POLICY_SUSPEND_PERIODS_RQ_DOMAIN_ID 2
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_POLICY_SUSPEND_PERIODS_RQ_RESERVED 3
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_POLICY_SUSPEND_PERIODS_RQ_POLICY_ID 4
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_POLICY_SUSPEND_PERIODS_RQ_NUMBER_OF_POLICY_SUSPEND_PERIODS 5
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_POLICY_SUSPEND_PERIODS_RQ_POLICY1_SUSPEND_START_TIME 6
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_POLICY_SUSPEND_PERIODS_RQ_POLICY1_SUSPEND_STOP_TIME 7
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_POLICY_SUSPEND_PERIODS_RQ_POLICY1_SUSPEND_PERIOD_RECURRENCE_MONDAY 8
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_POLICY_SUSPEND_PERIODS_RQ_POLICY1_SUSPEND_PERIOD_RECURRENCE_TUESDAY 9
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_POLICY_SUSPEND_PERIODS_RQ_POLICY1_SUSPEND_PERIOD_RECURRENCE_WEDNESDAY 10
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_POLICY_SUSPEND_PERIODS_RQ_POLICY1_SUSPEND_PERIOD_RECURRENCE_THURSDAY 11
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_POLICY_SUSPEND_PERIODS_RQ_POLICY1_SUSPEND_PERIOD_RECURRENCE_FRIDAY 12
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_POLICY_SUSPEND_PERIODS_RQ_POLICY1_SUSPEND_PERIOD_RECURRENCE_SATURDAY 13
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_POLICY_SUSPEND_PERIODS_RQ_POLICY1_SUSPEND_PERIOD_RECURRENCE_SUNDAY 14
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_POLICY_SUSPEND_PERIODS_RQ_POLICY1_SUSPEND_PERIOD_RECURRENCE_RESERVED 15
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_POLICY_SUSPEND_PERIODS_RQ_POLICY2_SUSPEND_START_TIME 16
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_POLICY_SUSPEND_PERIODS_RQ_POLICY2_SUSPEND_STOP_TIME 17
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_POLICY_SUSPEND_PERIODS_RQ_POLICY2_SUSPEND_PERIOD_RECURRENCE_MONDAY 18
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_POLICY_SUSPEND_PERIODS_RQ_POLICY2_SUSPEND_PERIOD_RECURRENCE_TUESDAY 19
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_POLICY_SUSPEND_PERIODS_RQ_POLICY2_SUSPEND_PERIOD_RECURRENCE_WEDNESDAY 20
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_POLICY_SUSPEND_PERIODS_RQ_POLICY2_SUSPEND_PERIOD_RECURRENCE_THURSDAY 21
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_POLICY_SUSPEND_PERIODS_RQ_POLICY2_SUSPEND_PERIOD_RECURRENCE_FRIDAY 22
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_POLICY_SUSPEND_PERIODS_RQ_POLICY2_SUSPEND_PERIOD_RECURRENCE_SATURDAY 23
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_POLICY_SUSPEND_PERIODS_RQ_POLICY2_SUSPEND_PERIOD_RECURRENCE_SUNDAY 24
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_POLICY_SUSPEND_PERIODS_RQ_POLICY2_SUSPEND_PERIOD_RECURRENCE_RESERVED 25
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_POLICY_SUSPEND_PERIODS_RQ_POLICY3_SUSPEND_START_TIME 26
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_POLICY_SUSPEND_PERIODS_RQ_POLICY3_SUSPEND_STOP_TIME 27
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_POLICY_SUSPEND_PERIODS_RQ_POLICY3_SUSPEND_PERIOD_RECURRENCE_MONDAY 28
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_POLICY_SUSPEND_PERIODS_RQ_POLICY3_SUSPEND_PERIOD_RECURRENCE_TUESDAY 29
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_POLICY_SUSPEND_PERIODS_RQ_POLICY3_SUSPEND_PERIOD_RECURRENCE_WEDNESDAY 30
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_POLICY_SUSPEND_PERIODS_RQ_POLICY3_SUSPEND_PERIOD_RECURRENCE_THURSDAY 31
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_POLICY_SUSPEND_PERIODS_RQ_POLICY3_SUSPEND_PERIOD_RECURRENCE_FRIDAY 32
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_POLICY_SUSPEND_PERIODS_RQ_POLICY3_SUSPEND_PERIOD_RECURRENCE_SATURDAY 33
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_POLICY_SUSPEND_PERIODS_RQ_POLICY3_SUSPEND_PERIOD_RECURRENCE_SUNDAY 34
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_POLICY_SUSPEND_PERIODS_RQ_POLICY3_SUSPEND_PERIOD_RECURRENCE_RESERVED 35
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_POLICY_SUSPEND_PERIODS_RQ_POLICY4_SUSPEND_START_TIME 36
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_POLICY_SUSPEND_PERIODS_RQ_POLICY4_SUSPEND_STOP_TIME 37
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_POLICY_SUSPEND_PERIODS_RQ_POLICY4_SUSPEND_PERIOD_RECURRENCE_MONDAY 38
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_POLICY_SUSPEND_PERIODS_RQ_POLICY4_SUSPEND_PERIOD_RECURRENCE_TUESDAY 39
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_POLICY_SUSPEND_PERIODS_RQ_POLICY4_SUSPEND_PERIOD_RECURRENCE_WEDNESDAY 40
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_POLICY_SUSPEND_PERIODS_RQ_POLICY4_SUSPEND_PERIOD_RECURRENCE_THURSDAY 41
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_POLICY_SUSPEND_PERIODS_RQ_POLICY4_SUSPEND_PERIOD_RECURRENCE_FRIDAY 42
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_POLICY_SUSPEND_PERIODS_RQ_POLICY4_SUSPEND_PERIOD_RECURRENCE_SATURDAY 43
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_POLICY_SUSPEND_PERIODS_RQ_POLICY4_SUSPEND_PERIOD_RECURRENCE_SUNDAY 44
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_POLICY_SUSPEND_PERIODS_RQ_POLICY4_SUSPEND_PERIOD_RECURRENCE_RESERVED 45
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_POLICY_SUSPEND_PERIODS_RQ_POLICY5_SUSPEND_START_TIME 46
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_POLICY_SUSPEND_PERIODS_RQ_POLICY5_SUSPEND_STOP_TIME 47
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_POLICY_SUSPEND_PERIODS_RQ_POLICY5_SUSPEND_PERIOD_RECURRENCE_MONDAY 48
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_POLICY_SUSPEND_PERIODS_RQ_POLICY5_SUSPEND_PERIOD_RECURRENCE_TUESDAY 49
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_POLICY_SUSPEND_PERIODS_RQ_POLICY5_SUSPEND_PERIOD_RECURRENCE_WEDNESDAY 50
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_POLICY_SUSPEND_PERIODS_RQ_POLICY5_SUSPEND_PERIOD_RECURRENCE_THURSDAY 51
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_POLICY_SUSPEND_PERIODS_RQ_POLICY5_SUSPEND_PERIOD_RECURRENCE_FRIDAY 52
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_POLICY_SUSPEND_PERIODS_RQ_POLICY5_SUSPEND_PERIOD_RECURRENCE_SATURDAY 53
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_POLICY_SUSPEND_PERIODS_RQ_POLICY5_SUSPEND_PERIOD_RECURRENCE_SUNDAY 54
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_POLICY_SUSPEND_PERIODS_RQ_POLICY5_SUSPEND_PERIOD_RECURRENCE_RESERVED 55
+
+/* tmpl_cmd_oem_intel_node_manager_set_node_manager_policy_suspend_periods_rs */
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_POLICY_SUSPEND_PERIODS_RS_CMD 0
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_POLICY_SUSPEND_PERIODS_RS_COMP_CODE 1
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_POLICY_SUSPEND_PERIODS_RS_MANUFACTURER_ID 2
+
+/* tmpl_cmd_oem_intel_node_manager_get_node_manager_policy_suspend_periods_rq */
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_POLICY_SUSPEND_PERIODS_RQ_CMD 0
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_POLICY_SUSPEND_PERIODS_RQ_MANUFACTURER_ID 1
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_POLICY_SUSPEND_PERIODS_RQ_DOMAIN_ID 2
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_POLICY_SUSPEND_PERIODS_RQ_RESERVED 3
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_POLICY_SUSPEND_PERIODS_RQ_POLICY_ID 4
+
+/* tmpl_cmd_oem_intel_node_manager_get_node_manager_policy_suspend_periods_rs */
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_POLICY_SUSPEND_PERIODS_RS_CMD 0
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_POLICY_SUSPEND_PERIODS_RS_COMP_CODE 1
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_POLICY_SUSPEND_PERIODS_RS_MANUFACTURER_ID 2
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_POLICY_SUSPEND_PERIODS_RS_NUMBER_OF_POLICY_SUSPEND_PERIODS 3
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_POLICY_SUSPEND_PERIODS_RS_POLICY1_SUSPEND_START_TIME 4
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_POLICY_SUSPEND_PERIODS_RS_POLICY1_SUSPEND_STOP_TIME 5
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_POLICY_SUSPEND_PERIODS_RS_POLICY1_SUSPEND_PERIOD_RECURRENCE_MONDAY 6
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_POLICY_SUSPEND_PERIODS_RS_POLICY1_SUSPEND_PERIOD_RECURRENCE_TUESDAY 7
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_POLICY_SUSPEND_PERIODS_RS_POLICY1_SUSPEND_PERIOD_RECURRENCE_WEDNESDAY 8
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_POLICY_SUSPEND_PERIODS_RS_POLICY1_SUSPEND_PERIOD_RECURRENCE_THURSDAY 9
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_POLICY_SUSPEND_PERIODS_RS_POLICY1_SUSPEND_PERIOD_RECURRENCE_FRIDAY 10
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_POLICY_SUSPEND_PERIODS_RS_POLICY1_SUSPEND_PERIOD_RECURRENCE_SATURDAY 11
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_POLICY_SUSPEND_PERIODS_RS_POLICY1_SUSPEND_PERIOD_RECURRENCE_SUNDAY 12
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_POLICY_SUSPEND_PERIODS_RS_POLICY1_SUSPEND_PERIOD_RECURRENCE_RESERVED 13
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_POLICY_SUSPEND_PERIODS_RS_POLICY2_SUSPEND_START_TIME 14
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_POLICY_SUSPEND_PERIODS_RS_POLICY2_SUSPEND_STOP_TIME 15
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_POLICY_SUSPEND_PERIODS_RS_POLICY2_SUSPEND_PERIOD_RECURRENCE_MONDAY 16
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_POLICY_SUSPEND_PERIODS_RS_POLICY2_SUSPEND_PERIOD_RECURRENCE_TUESDAY 17
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_POLICY_SUSPEND_PERIODS_RS_POLICY2_SUSPEND_PERIOD_RECURRENCE_WEDNESDAY 18
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_POLICY_SUSPEND_PERIODS_RS_POLICY2_SUSPEND_PERIOD_RECURRENCE_THURSDAY 19
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_POLICY_SUSPEND_PERIODS_RS_POLICY2_SUSPEND_PERIOD_RECURRENCE_FRIDAY 20
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_POLICY_SUSPEND_PERIODS_RS_POLICY2_SUSPEND_PERIOD_RECURRENCE_SATURDAY 21
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_POLICY_SUSPEND_PERIODS_RS_POLICY2_SUSPEND_PERIOD_RECURRENCE_SUNDAY 22
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_POLICY_SUSPEND_PERIODS_RS_POLICY2_SUSPEND_PERIOD_RECURRENCE_RESERVED 23
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_POLICY_SUSPEND_PERIODS_RS_POLICY3_SUSPEND_START_TIME 24
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_POLICY_SUSPEND_PERIODS_RS_POLICY3_SUSPEND_STOP_TIME 25
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_POLICY_SUSPEND_PERIODS_RS_POLICY3_SUSPEND_PERIOD_RECURRENCE_MONDAY 26
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_POLICY_SUSPEND_PERIODS_RS_POLICY3_SUSPEND_PERIOD_RECURRENCE_TUESDAY 27
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_POLICY_SUSPEND_PERIODS_RS_POLICY3_SUSPEND_PERIOD_RECURRENCE_WEDNESDAY 28
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_POLICY_SUSPEND_PERIODS_RS_POLICY3_SUSPEND_PERIOD_RECURRENCE_THURSDAY 29
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_POLICY_SUSPEND_PERIODS_RS_POLICY3_SUSPEND_PERIOD_RECURRENCE_FRIDAY 30
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_POLICY_SUSPEND_PERIODS_RS_POLICY3_SUSPEND_PERIOD_RECURRENCE_SATURDAY 31
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_POLICY_SUSPEND_PERIODS_RS_POLICY3_SUSPEND_PERIOD_RECURRENCE_SUNDAY 32
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_POLICY_SUSPEND_PERIODS_RS_POLICY3_SUSPEND_PERIOD_RECURRENCE_RESERVED 33
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_POLICY_SUSPEND_PERIODS_RS_POLICY4_SUSPEND_START_TIME 34
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_POLICY_SUSPEND_PERIODS_RS_POLICY4_SUSPEND_STOP_TIME 35
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_POLICY_SUSPEND_PERIODS_RS_POLICY4_SUSPEND_PERIOD_RECURRENCE_MONDAY 36
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_POLICY_SUSPEND_PERIODS_RS_POLICY4_SUSPEND_PERIOD_RECURRENCE_TUESDAY 37
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_POLICY_SUSPEND_PERIODS_RS_POLICY4_SUSPEND_PERIOD_RECURRENCE_WEDNESDAY 38
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_POLICY_SUSPEND_PERIODS_RS_POLICY4_SUSPEND_PERIOD_RECURRENCE_THURSDAY 39
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_POLICY_SUSPEND_PERIODS_RS_POLICY4_SUSPEND_PERIOD_RECURRENCE_FRIDAY 40
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_POLICY_SUSPEND_PERIODS_RS_POLICY4_SUSPEND_PERIOD_RECURRENCE_SATURDAY 41
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_POLICY_SUSPEND_PERIODS_RS_POLICY4_SUSPEND_PERIOD_RECURRENCE_SUNDAY 42
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_POLICY_SUSPEND_PERIODS_RS_POLICY4_SUSPEND_PERIOD_RECURRENCE_RESERVED 43
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_POLICY_SUSPEND_PERIODS_RS_POLICY5_SUSPEND_START_TIME 44
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_POLICY_SUSPEND_PERIODS_RS_POLICY5_SUSPEND_STOP_TIME 45
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_POLICY_SUSPEND_PERIODS_RS_POLICY5_SUSPEND_PERIOD_RECURRENCE_MONDAY 46
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_POLICY_SUSPEND_PERIODS_RS_POLICY5_SUSPEND_PERIOD_RECURRENCE_TUESDAY 47
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_POLICY_SUSPEND_PERIODS_RS_POLICY5_SUSPEND_PERIOD_RECURRENCE_WEDNESDAY 48
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_POLICY_SUSPEND_PERIODS_RS_POLICY5_SUSPEND_PERIOD_RECURRENCE_THURSDAY 49
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_POLICY_SUSPEND_PERIODS_RS_POLICY5_SUSPEND_PERIOD_RECURRENCE_FRIDAY 50
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_POLICY_SUSPEND_PERIODS_RS_POLICY5_SUSPEND_PERIOD_RECURRENCE_SATURDAY 51
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_POLICY_SUSPEND_PERIODS_RS_POLICY5_SUSPEND_PERIOD_RECURRENCE_SUNDAY 52
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_POLICY_SUSPEND_PERIODS_RS_POLICY5_SUSPEND_PERIOD_RECURRENCE_RESERVED 53
+
+/* tmpl_cmd_oem_intel_node_manager_reset_node_manager_statistics_rq */
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_RESET_NODE_MANAGER_STATISTICS_RQ_CMD 0
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_RESET_NODE_MANAGER_STATISTICS_RQ_MANUFACTURER_ID 1
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_RESET_NODE_MANAGER_STATISTICS_RQ_MODE 2
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_RESET_NODE_MANAGER_STATISTICS_RQ_RESERVED1 3
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_RESET_NODE_MANAGER_STATISTICS_RQ_DOMAIN_ID 4
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_RESET_NODE_MANAGER_STATISTICS_RQ_RESERVED2 5
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_RESET_NODE_MANAGER_STATISTICS_RQ_POLICY_ID 6
+
+/* tmpl_cmd_oem_intel_node_manager_reset_node_manager_statistics_rs */
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_RESET_NODE_MANAGER_STATISTICS_RS_CMD 0
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_RESET_NODE_MANAGER_STATISTICS_RS_COMP_CODE 1
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_RESET_NODE_MANAGER_STATISTICS_RS_MANUFACTURER_ID 2
+
+/* tmpl_cmd_oem_intel_node_manager_get_node_manager_statistics_rq */
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_STATISTICS_RQ_CMD 0
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_STATISTICS_RQ_MANUFACTURER_ID 1
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_STATISTICS_RQ_MODE 2
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_STATISTICS_RQ_RESERVED1 3
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_STATISTICS_RQ_DOMAIN_ID 4
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_STATISTICS_RQ_RESERVED2 5
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_STATISTICS_RQ_POLICY_ID 6
+
+/* tmpl_cmd_oem_intel_node_manager_get_node_manager_statistics_rs */
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_STATISTICS_RS_CMD 0
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_STATISTICS_RS_COMP_CODE 1
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_STATISTICS_RS_MANUFACTURER_ID 2
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_STATISTICS_RS_CURRENT 3
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_STATISTICS_RS_MINIMUM 4
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_STATISTICS_RS_MAXIMUM 5
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_STATISTICS_RS_AVERAGE 6
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_STATISTICS_RS_TIMESTAMP 7
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_STATISTICS_RS_STATISTICS_REPORTING_PERIOD 8
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_STATISTICS_RS_DOMAIN_ID 9
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_STATISTICS_RS_POLICY_GLOBAL_ADMINISTRATIVE_STATE 10
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_STATISTICS_RS_POLICY_OPERATIONAL_STATE 11
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_STATISTICS_RS_MEASUREMENTS_STATE 12
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_STATISTICS_RS_POLICY_ACTIVATION_STATE 13
+
+/* tmpl_cmd_oem_intel_node_manager_get_node_manager_capabilities_rq */
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_CAPABILITIES_RQ_CMD 0
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_CAPABILITIES_RQ_MANUFACTURER_ID 1
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_CAPABILITIES_RQ_DOMAIN_ID 2
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_CAPABILITIES_RQ_RESERVED 3
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_CAPABILITIES_RQ_POLICY_TRIGGER_TYPE 4
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_CAPABILITIES_RQ_POLICY_TYPE 5
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_CAPABILITIES_RQ_POLICY_POWER_DOMAIN 6
+
+/* tmpl_cmd_oem_intel_node_manager_get_node_manager_capabilities_rs */
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_CAPABILITIES_RS_CMD 0
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_CAPABILITIES_RS_COMP_CODE 1
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_CAPABILITIES_RS_MANUFACTURER_ID 2
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_CAPABILITIES_RS_MAX_CONCURRENT_SETTINGS 3
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_CAPABILITIES_RS_MAX_POWER_THERMAL_TIME_AFTER_RESET 4
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_CAPABILITIES_RS_MIN_POWER_THERMAL_TIME_AFTER_RESET 5
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_CAPABILITIES_RS_MIN_CORRECTION_TIME 6
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_CAPABILITIES_RS_MAX_CORRECTION_TIME 7
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_CAPABILITIES_RS_MIN_STATISTICS_REPORTING_PERIOD 8
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_CAPABILITIES_RS_MAX_STATISTICS_REPORTING_PERIOD 9
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_CAPABILITIES_RS_DOMAIN_LIMITING_SCOPE_DOMAIN_ID 10
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_CAPABILITIES_RS_DOMAIN_LIMITING_SCOPE_RESERVED 11
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_CAPABILITIES_RS_DOMAIN_LIMITING_SCOPE_LIMITING_BASED_ON 12
+
+/* tmpl_cmd_oem_intel_node_manager_get_node_manager_version_rq */
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_VERSION_RQ_CMD 0
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_VERSION_RQ_MANUFACTURER_ID 1
+
+/* tmpl_cmd_oem_intel_node_manager_get_node_manager_version_rs */
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_VERSION_RS_CMD 0
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_VERSION_RS_COMP_CODE 1
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_VERSION_RS_MANUFACTURER_ID 2
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_VERSION_RS_NODE_MANAGER_VERSION 3
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_VERSION_RS_IPMI_INTERFACE_VERSION 4
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_VERSION_RS_PATCH_VERSION 5
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_VERSION_RS_MAJOR_FIRMWARE_REVISION 6
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_VERSION_RS_MINOR_FIRMWARE_REVISION 7
+
+/* tmpl_cmd_oem_intel_node_manager_set_node_manager_power_draw_range_rq */
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_POWER_DRAW_RANGE_RQ_CMD 0
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_POWER_DRAW_RANGE_RQ_MANUFACTURER_ID 1
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_POWER_DRAW_RANGE_RQ_DOMAIN_ID 2
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_POWER_DRAW_RANGE_RQ_RESERVED 3
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_POWER_DRAW_RANGE_RQ_MINIMUM_POWER_DRAW 4
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_POWER_DRAW_RANGE_RQ_MAXIMUM_POWER_DRAW 5
+
+/* tmpl_cmd_oem_intel_node_manager_set_node_manager_power_draw_range_rs */
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_POWER_DRAW_RANGE_RS_CMD 0
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_POWER_DRAW_RANGE_RS_COMP_CODE 1
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_POWER_DRAW_RANGE_RS_MANUFACTURER_ID 2
+
+/* tmpl_cmd_oem_intel_node_manager_set_node_manager_alert_destination_rq */
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_ALERT_DESTINATION_RQ_CMD 0
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_ALERT_DESTINATION_RQ_MANUFACTURER_ID 1
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_ALERT_DESTINATION_RQ_CHANNEL_NUMBER 2
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_ALERT_DESTINATION_RQ_RESERVED1 3
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_ALERT_DESTINATION_RQ_ALERT_RECEIVER_DEACTIVATION 4
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_ALERT_DESTINATION_RQ_DESTINATION_INFORMATION 5
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_ALERT_DESTINATION_RQ_ALERT_STRING_SELECTOR 6
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_ALERT_DESTINATION_RQ_SEND_ALERT_STRING 7
+
+/* tmpl_cmd_oem_intel_node_manager_set_node_manager_alert_destination_ipmb_rq */
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_ALERT_DESTINATION_IPMB_RQ_CMD 0
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_ALERT_DESTINATION_IPMB_RQ_MANUFACTURER_ID 1
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_ALERT_DESTINATION_IPMB_RQ_CHANNEL_NUMBER 2
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_ALERT_DESTINATION_IPMB_RQ_RESERVED1 3
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_ALERT_DESTINATION_IPMB_RQ_ALERT_RECEIVER_DEACTIVATION 4
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_ALERT_DESTINATION_IPMB_RQ_RESERVED2 5
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_ALERT_DESTINATION_IPMB_RQ_SLAVE_ADDRESS 6
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_ALERT_DESTINATION_IPMB_RQ_ALERT_STRING_SELECTOR 7
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_ALERT_DESTINATION_IPMB_RQ_SEND_ALERT_STRING 8
+
+/* tmpl_cmd_oem_intel_node_manager_set_node_manager_alert_destination_lan_rq */
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_ALERT_DESTINATION_LAN_RQ_CMD 0
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_ALERT_DESTINATION_LAN_RQ_MANUFACTURER_ID 1
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_ALERT_DESTINATION_LAN_RQ_CHANNEL_NUMBER 2
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_ALERT_DESTINATION_LAN_RQ_RESERVED1 3
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_ALERT_DESTINATION_LAN_RQ_ALERT_RECEIVER_DEACTIVATION 4
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_ALERT_DESTINATION_LAN_RQ_DESTINATION_SELECTOR 5
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_ALERT_DESTINATION_LAN_RQ_RESERVED2 6
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_ALERT_DESTINATION_LAN_RQ_ALERT_STRING_SELECTOR 7
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_ALERT_DESTINATION_LAN_RQ_SEND_ALERT_STRING 8
+
+/* tmpl_cmd_oem_intel_node_manager_set_node_manager_alert_destination_rs */
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_ALERT_DESTINATION_RS_CMD 0
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_ALERT_DESTINATION_RS_COMP_CODE 1
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_NODE_MANAGER_ALERT_DESTINATION_RS_MANUFACTURER_ID 2
+
+/* tmpl_cmd_oem_intel_node_manager_get_node_manager_alert_destination_rq */
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_ALERT_DESTINATION_RQ_CMD 0
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_ALERT_DESTINATION_RQ_MANUFACTURER_ID 1
+
+/* tmpl_cmd_oem_intel_node_manager_get_node_manager_alert_destination_rs */
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_ALERT_DESTINATION_RS_CMD 0
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_ALERT_DESTINATION_RS_COMP_CODE 1
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_ALERT_DESTINATION_RS_MANUFACTURER_ID 2
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_ALERT_DESTINATION_RS_CHANNEL_NUMBER 3
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_ALERT_DESTINATION_RS_RESERVED1 4
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_ALERT_DESTINATION_RS_ALERT_RECEIVER_DEACTIVATION 5
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_ALERT_DESTINATION_RS_DESTINATION_SELECTOR 6
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_ALERT_DESTINATION_RS_RESERVED2 7
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_ALERT_DESTINATION_RS_ALERT_STRING_SELECTOR 8
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_NODE_MANAGER_ALERT_DESTINATION_RS_SEND_ALERT_STRING 9
+
+/* tmpl_cmd_oem_intel_node_manager_set_turbo_synchronization_ratio_rq */
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_TURBO_SYNCHRONIZATION_RATIO_RQ_CMD 0
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_TURBO_SYNCHRONIZATION_RATIO_RQ_MANUFACTURER_ID 1
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_TURBO_SYNCHRONIZATION_RATIO_RQ_CPU_SOCKET_NUMBER 2
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_TURBO_SYNCHRONIZATION_RATIO_RQ_ACTIVE_CORES_CONFIGURATION 3
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_TURBO_SYNCHRONIZATION_RATIO_RQ_TURBO_RATIO_LIMIT 4
+
+/* tmpl_cmd_oem_intel_node_manager_set_turbo_synchronization_ratio_rs */
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_TURBO_SYNCHRONIZATION_RATIO_RS_CMD 0
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_TURBO_SYNCHRONIZATION_RATIO_RS_COMP_CODE 1
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_SET_TURBO_SYNCHRONIZATION_RATIO_RS_MANUFACTURER_ID 2
+
+/* tmpl_cmd_oem_intel_node_manager_get_turbo_synchronization_ratio_rq */
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_TURBO_SYNCHRONIZATION_RATIO_RQ_CMD 0
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_TURBO_SYNCHRONIZATION_RATIO_RQ_MANUFACTURER_ID 1
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_TURBO_SYNCHRONIZATION_RATIO_RQ_CPU_SOCKET_NUMBER 2
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_TURBO_SYNCHRONIZATION_RATIO_RQ_ACTIVE_CORES_CONFIGURATION 3
+
+/* tmpl_cmd_oem_intel_node_manager_get_turbo_synchronization_ratio_rs */
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_TURBO_SYNCHRONIZATION_RATIO_RS_CMD 0
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_TURBO_SYNCHRONIZATION_RATIO_RS_COMP_CODE 1
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_TURBO_SYNCHRONIZATION_RATIO_RS_MANUFACTURER_ID 2
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_TURBO_SYNCHRONIZATION_RATIO_RS_CURRENT_TURBO_RATIO_LIMIT 3
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_TURBO_SYNCHRONIZATION_RATIO_RS_DEFAULT_TURBO_RATIO_LIMIT 4
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_TURBO_SYNCHRONIZATION_RATIO_RS_MAXIMUM_TURBO_RATIO_LIMIT 5
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_TURBO_SYNCHRONIZATION_RATIO_RS_MINIMUM_TURBO_RATIO_LIMIT 6
+
+/* tmpl_cmd_oem_intel_node_manager_get_limiting_policy_id_rq */
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_LIMITING_POLICY_ID_RQ_CMD 0
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_LIMITING_POLICY_ID_RQ_MANUFACTURER_ID 1
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_LIMITING_POLICY_ID_RQ_DOMAIN_ID 2
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_LIMITING_POLICY_ID_RQ_RESERVED 3
+
+/* tmpl_cmd_oem_intel_node_manager_get_limiting_policy_id_rs */
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_LIMITING_POLICY_ID_RS_CMD 0
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_LIMITING_POLICY_ID_RS_COMP_CODE 1
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_LIMITING_POLICY_ID_RS_MANUFACTURER_ID 2
+#define TMPL_CMD_OEM_INTEL_NODE_MANAGER_GET_LIMITING_POLICY_ID_RS_POLICY_ID 3
+
+/* tmpl_cmd_get_pef_capabilities_rq */
+#define TMPL_CMD_GET_PEF_CAPABILITIES_RQ_CMD 0
+
+/* tmpl_cmd_get_pef_capabilities_rs */
+#define TMPL_CMD_GET_PEF_CAPABILITIES_RS_CMD 0
+#define TMPL_CMD_GET_PEF_CAPABILITIES_RS_COMP_CODE 1
+#define TMPL_CMD_GET_PEF_CAPABILITIES_RS_PEF_VERSION_MAJOR 2
+#define TMPL_CMD_GET_PEF_CAPABILITIES_RS_PEF_VERSION_MINOR 3
+#define TMPL_CMD_GET_PEF_CAPABILITIES_RS_ACTION_SUPPORT_ALERT 4
+#define TMPL_CMD_GET_PEF_CAPABILITIES_RS_ACTION_SUPPORT_POWER_DOWN 5
+#define TMPL_CMD_GET_PEF_CAPABILITIES_RS_ACTION_SUPPORT_RESET 6
+#define TMPL_CMD_GET_PEF_CAPABILITIES_RS_ACTION_SUPPORT_POWER_CYCLE 7
+#define TMPL_CMD_GET_PEF_CAPABILITIES_RS_ACTION_SUPPORT_OEM_ACTION 8
+#define TMPL_CMD_GET_PEF_CAPABILITIES_RS_ACTION_SUPPORT_DIAGNOSTIC_INTERRUPT 9
+#define TMPL_CMD_GET_PEF_CAPABILITIES_RS_RESERVED 10
+#define TMPL_CMD_GET_PEF_CAPABILITIES_RS_OEM_EVENT_RECORD_FILTERING_SUPPORTED 11
+#define TMPL_CMD_GET_PEF_CAPABILITIES_RS_NUMBER_OF_EVENT_FILTER_TABLE_ENTRIES 12
+
+/* tmpl_cmd_arm_pef_postpone_timer_rq */
+#define TMPL_CMD_ARM_PEF_POSTPONE_TIMER_RQ_CMD 0
+#define TMPL_CMD_ARM_PEF_POSTPONE_TIMER_RQ_PEF_POSTPONE_TIMEOUT 1
+
+/* tmpl_cmd_arm_pef_postpone_timer_rs */
+#define TMPL_CMD_ARM_PEF_POSTPONE_TIMER_RS_CMD 0
+#define TMPL_CMD_ARM_PEF_POSTPONE_TIMER_RS_COMP_CODE 1
+#define TMPL_CMD_ARM_PEF_POSTPONE_TIMER_RS_PRESENT_TIMER_COUNTDOWN_VALUE 2
+
+/* tmpl_cmd_set_pef_configuration_parameters_rq */
+#define TMPL_CMD_SET_PEF_CONFIGURATION_PARAMETERS_RQ_CMD 0
+#define TMPL_CMD_SET_PEF_CONFIGURATION_PARAMETERS_RQ_PARAMETER_SELECTOR 1
+#define TMPL_CMD_SET_PEF_CONFIGURATION_PARAMETERS_RQ_RESERVED 2
+#define TMPL_CMD_SET_PEF_CONFIGURATION_PARAMETERS_RQ_CONFIGURATION_PARAMETER_DATA 3
+
+/* tmpl_cmd_set_pef_configuration_parameters_rs */
+#define TMPL_CMD_SET_PEF_CONFIGURATION_PARAMETERS_RS_CMD 0
+#define TMPL_CMD_SET_PEF_CONFIGURATION_PARAMETERS_RS_COMP_CODE 1
+
+/* tmpl_cmd_set_pef_configuration_parameters_set_in_progress_rq */
+#define TMPL_CMD_SET_PEF_CONFIGURATION_PARAMETERS_SET_IN_PROGRESS_RQ_CMD 0
+#define TMPL_CMD_SET_PEF_CONFIGURATION_PARAMETERS_SET_IN_PROGRESS_RQ_PARAMETER_SELECTOR 1
+#define TMPL_CMD_SET_PEF_CONFIGURATION_PARAMETERS_SET_IN_PROGRESS_RQ_RESERVED1 2
+#define TMPL_CMD_SET_PEF_CONFIGURATION_PARAMETERS_SET_IN_PROGRESS_RQ_STATE 3
+#define TMPL_CMD_SET_PEF_CONFIGURATION_PARAMETERS_SET_IN_PROGRESS_RQ_RESERVED2 4
+
+/* tmpl_cmd_set_pef_configuration_parameters_pef_control_rq */
+#define TMPL_CMD_SET_PEF_CONFIGURATION_PARAMETERS_PEF_CONTROL_RQ_CMD 0
+#define TMPL_CMD_SET_PEF_CONFIGURATION_PARAMETERS_PEF_CONTROL_RQ_PARAMETER_SELECTOR 1
+#define TMPL_CMD_SET_PEF_CONFIGURATION_PARAMETERS_PEF_CONTROL_RQ_RESERVED1 2
+#define TMPL_CMD_SET_PEF_CONFIGURATION_PARAMETERS_PEF_CONTROL_RQ_PEF 3
+#define TMPL_CMD_SET_PEF_CONFIGURATION_PARAMETERS_PEF_CONTROL_RQ_PEF_EVENT_MESSAGES 4
+#define TMPL_CMD_SET_PEF_CONFIGURATION_PARAMETERS_PEF_CONTROL_RQ_PEF_STARTUP_DELAY 5
+#define TMPL_CMD_SET_PEF_CONFIGURATION_PARAMETERS_PEF_CONTROL_RQ_PEF_ALERT_STARTUP_DELAY 6
+#define TMPL_CMD_SET_PEF_CONFIGURATION_PARAMETERS_PEF_CONTROL_RQ_RESERVED2 7
+
+/* tmpl_cmd_set_pef_configuration_parameters_pef_action_global_control_rq */
+#define TMPL_CMD_SET_PEF_CONFIGURATION_PARAMETERS_PEF_ACTION_GLOBAL_CONTROL_RQ_CMD 0
+#define TMPL_CMD_SET_PEF_CONFIGURATION_PARAMETERS_PEF_ACTION_GLOBAL_CONTROL_RQ_PARAMETER_SELECTOR 1
+#define TMPL_CMD_SET_PEF_CONFIGURATION_PARAMETERS_PEF_ACTION_GLOBAL_CONTROL_RQ_RESERVED1 2
+#define TMPL_CMD_SET_PEF_CONFIGURATION_PARAMETERS_PEF_ACTION_GLOBAL_CONTROL_RQ_ALERT_ACTION 3
+#define TMPL_CMD_SET_PEF_CONFIGURATION_PARAMETERS_PEF_ACTION_GLOBAL_CONTROL_RQ_POWER_DOWN_ACTION 4
+#define TMPL_CMD_SET_PEF_CONFIGURATION_PARAMETERS_PEF_ACTION_GLOBAL_CONTROL_RQ_RESET_ACTION 5
+#define TMPL_CMD_SET_PEF_CONFIGURATION_PARAMETERS_PEF_ACTION_GLOBAL_CONTROL_RQ_POWER_CYCLE_ACTION 6
+#define TMPL_CMD_SET_PEF_CONFIGURATION_PARAMETERS_PEF_ACTION_GLOBAL_CONTROL_RQ_OEM_ACTION 7
+#define TMPL_CMD_SET_PEF_CONFIGURATION_PARAMETERS_PEF_ACTION_GLOBAL_CONTROL_RQ_DIAGNOSTIC_INTERRUPT 8
+#define TMPL_CMD_SET_PEF_CONFIGURATION_PARAMETERS_PEF_ACTION_GLOBAL_CONTROL_RQ_RESERVED2 9
+
+/* tmpl_cmd_set_pef_configuration_parameters_pef_startup_delay_rq */
+#define TMPL_CMD_SET_PEF_CONFIGURATION_PARAMETERS_PEF_STARTUP_DELAY_RQ_CMD 0
+#define TMPL_CMD_SET_PEF_CONFIGURATION_PARAMETERS_PEF_STARTUP_DELAY_RQ_PARAMETER_SELECTOR 1
+#define TMPL_CMD_SET_PEF_CONFIGURATION_PARAMETERS_PEF_STARTUP_DELAY_RQ_RESERVED 2
+#define TMPL_CMD_SET_PEF_CONFIGURATION_PARAMETERS_PEF_STARTUP_DELAY_RQ_PEF_STARTUP_DELAY 3
+
+/* tmpl_cmd_set_pef_configuration_parameters_pef_alert_startup_delay_rq */
+#define TMPL_CMD_SET_PEF_CONFIGURATION_PARAMETERS_PEF_ALERT_STARTUP_DELAY_RQ_CMD 0
+#define TMPL_CMD_SET_PEF_CONFIGURATION_PARAMETERS_PEF_ALERT_STARTUP_DELAY_RQ_PARAMETER_SELECTOR 1
+#define TMPL_CMD_SET_PEF_CONFIGURATION_PARAMETERS_PEF_ALERT_STARTUP_DELAY_RQ_RESERVED 2
+#define TMPL_CMD_SET_PEF_CONFIGURATION_PARAMETERS_PEF_ALERT_STARTUP_DELAY_RQ_PEF_ALERT_STARTUP_DELAY 3
+
+/* tmpl_cmd_set_pef_configuration_parameters_event_filter_table_rq */
+#define TMPL_CMD_SET_PEF_CONFIGURATION_PARAMETERS_EVENT_FILTER_TABLE_RQ_CMD 0
+#define TMPL_CMD_SET_PEF_CONFIGURATION_PARAMETERS_EVENT_FILTER_TABLE_RQ_PARAMETER_SELECTOR 1
+#define TMPL_CMD_SET_PEF_CONFIGURATION_PARAMETERS_EVENT_FILTER_TABLE_RQ_RESERVED1 2
+#define TMPL_CMD_SET_PEF_CONFIGURATION_PARAMETERS_EVENT_FILTER_TABLE_RQ_FILTER_NUMBER 3
+#define TMPL_CMD_SET_PEF_CONFIGURATION_PARAMETERS_EVENT_FILTER_TABLE_RQ_FILTER_CONFIGURATION_RESERVED 4
+#define TMPL_CMD_SET_PEF_CONFIGURATION_PARAMETERS_EVENT_FILTER_TABLE_RQ_FILTER_CONFIGURATION_TYPE 5
+#define TMPL_CMD_SET_PEF_CONFIGURATION_PARAMETERS_EVENT_FILTER_TABLE_RQ_FILTER_CONFIGURATION_FILTER 6
+#define TMPL_CMD_SET_PEF_CONFIGURATION_PARAMETERS_EVENT_FILTER_TABLE_RQ_EVENT_FILTER_ACTION_ALERT 7
+#define TMPL_CMD_SET_PEF_CONFIGURATION_PARAMETERS_EVENT_FILTER_TABLE_RQ_EVENT_FILTER_ACTION_POWER_OFF 8
+#define TMPL_CMD_SET_PEF_CONFIGURATION_PARAMETERS_EVENT_FILTER_TABLE_RQ_EVENT_FILTER_ACTION_RESET 9
+#define TMPL_CMD_SET_PEF_CONFIGURATION_PARAMETERS_EVENT_FILTER_TABLE_RQ_EVENT_FILTER_ACTION_POWER_CYCLE 10
+#define TMPL_CMD_SET_PEF_CONFIGURATION_PARAMETERS_EVENT_FILTER_TABLE_RQ_EVENT_FILTER_ACTION_OEM 11
+#define TMPL_CMD_SET_PEF_CONFIGURATION_PARAMETERS_EVENT_FILTER_TABLE_RQ_EVENT_FILTER_ACTION_DIAGNOSTIC_INTERRUPT 12
+#define TMPL_CMD_SET_PEF_CONFIGURATION_PARAMETERS_EVENT_FILTER_TABLE_RQ_EVENT_FILTER_ACTION_GROUP_CONTROL_OPERATION 13
+#define TMPL_CMD_SET_PEF_CONFIGURATION_PARAMETERS_EVENT_FILTER_TABLE_RQ_EVENT_FILTER_ACTION_RESERVED 14
+#define TMPL_CMD_SET_PEF_CONFIGURATION_PARAMETERS_EVENT_FILTER_TABLE_RQ_ALERT_POLICY_NUMBER_POLICY_NUMBER 15
+#define TMPL_CMD_SET_PEF_CONFIGURATION_PARAMETERS_EVENT_FILTER_TABLE_RQ_ALERT_POLICY_NUMBER_GROUP_CONTROL_SELECTOR 16
+#define TMPL_CMD_SET_PEF_CONFIGURATION_PARAMETERS_EVENT_FILTER_TABLE_RQ_ALERT_POLICY_NUMBER_RESERVED 17
+#define TMPL_CMD_SET_PEF_CONFIGURATION_PARAMETERS_EVENT_FILTER_TABLE_RQ_EVENT_SEVERITY 18
+#define TMPL_CMD_SET_PEF_CONFIGURATION_PARAMETERS_EVENT_FILTER_TABLE_RQ_GENERATOR_ID_BYTE1 19
+#define TMPL_CMD_SET_PEF_CONFIGURATION_PARAMETERS_EVENT_FILTER_TABLE_RQ_GENERATOR_ID_BYTE2 20
+#define TMPL_CMD_SET_PEF_CONFIGURATION_PARAMETERS_EVENT_FILTER_TABLE_RQ_SENSOR_TYPE 21
+#define TMPL_CMD_SET_PEF_CONFIGURATION_PARAMETERS_EVENT_FILTER_TABLE_RQ_SENSOR_NUMBER 22
+#define TMPL_CMD_SET_PEF_CONFIGURATION_PARAMETERS_EVENT_FILTER_TABLE_RQ_EVENT_TRIGGER 23
+#define TMPL_CMD_SET_PEF_CONFIGURATION_PARAMETERS_EVENT_FILTER_TABLE_RQ_EVENT_DATA1_OFFSET_MASK 24
+#define TMPL_CMD_SET_PEF_CONFIGURATION_PARAMETERS_EVENT_FILTER_TABLE_RQ_EVENT_DATA1_AND_MASK 25
+#define TMPL_CMD_SET_PEF_CONFIGURATION_PARAMETERS_EVENT_FILTER_TABLE_RQ_EVENT_DATA1_COMPARE1 26
+#define TMPL_CMD_SET_PEF_CONFIGURATION_PARAMETERS_EVENT_FILTER_TABLE_RQ_EVENT_DATA1_COMPARE2 27
+#define TMPL_CMD_SET_PEF_CONFIGURATION_PARAMETERS_EVENT_FILTER_TABLE_RQ_EVENT_DATA2_AND_MASK 28
+#define TMPL_CMD_SET_PEF_CONFIGURATION_PARAMETERS_EVENT_FILTER_TABLE_RQ_EVENT_DATA2_COMPARE1 29
+#define TMPL_CMD_SET_PEF_CONFIGURATION_PARAMETERS_EVENT_FILTER_TABLE_RQ_EVENT_DATA2_COMPARE2 30
+#define TMPL_CMD_SET_PEF_CONFIGURATION_PARAMETERS_EVENT_FILTER_TABLE_RQ_EVENT_DATA3_AND_MASK 31
+#define TMPL_CMD_SET_PEF_CONFIGURATION_PARAMETERS_EVENT_FILTER_TABLE_RQ_EVENT_DATA3_COMPARE1 32
+#define TMPL_CMD_SET_PEF_CONFIGURATION_PARAMETERS_EVENT_FILTER_TABLE_RQ_EVENT_DATA3_COMPARE2 33
+
+/* tmpl_cmd_set_pef_configuration_parameters_event_filter_table_data1_rq */
+#define TMPL_CMD_SET_PEF_CONFIGURATION_PARAMETERS_EVENT_FILTER_TABLE_DATA1_RQ_CMD 0
+#define TMPL_CMD_SET_PEF_CONFIGURATION_PARAMETERS_EVENT_FILTER_TABLE_DATA1_RQ_PARAMETER_SELECTOR 1
+#define TMPL_CMD_SET_PEF_CONFIGURATION_PARAMETERS_EVENT_FILTER_TABLE_DATA1_RQ_RESERVED1 2
+#define TMPL_CMD_SET_PEF_CONFIGURATION_PARAMETERS_EVENT_FILTER_TABLE_DATA1_RQ_FILTER_NUMBER 3
+#define TMPL_CMD_SET_PEF_CONFIGURATION_PARAMETERS_EVENT_FILTER_TABLE_DATA1_RQ_FILTER_CONFIGURATION_RESERVED 4
+#define TMPL_CMD_SET_PEF_CONFIGURATION_PARAMETERS_EVENT_FILTER_TABLE_DATA1_RQ_FILTER_CONFIGURATION_TYPE 5
+#define TMPL_CMD_SET_PEF_CONFIGURATION_PARAMETERS_EVENT_FILTER_TABLE_DATA1_RQ_FILTER_CONFIGURATION_FILTER 6
+
+/* tmpl_cmd_set_pef_configuration_parameters_alert_string_keys_rq */
+#define TMPL_CMD_SET_PEF_CONFIGURATION_PARAMETERS_ALERT_STRING_KEYS_RQ_CMD 0
+#define TMPL_CMD_SET_PEF_CONFIGURATION_PARAMETERS_ALERT_STRING_KEYS_RQ_PARAMETER_SELECTOR 1
+#define TMPL_CMD_SET_PEF_CONFIGURATION_PARAMETERS_ALERT_STRING_KEYS_RQ_RESERVED1 2
+#define TMPL_CMD_SET_PEF_CONFIGURATION_PARAMETERS_ALERT_STRING_KEYS_RQ_STRING_SELECTOR 3
+#define TMPL_CMD_SET_PEF_CONFIGURATION_PARAMETERS_ALERT_STRING_KEYS_RQ_RESERVED2 4
+#define TMPL_CMD_SET_PEF_CONFIGURATION_PARAMETERS_ALERT_STRING_KEYS_RQ_FILTER_NUMBER 5
+#define TMPL_CMD_SET_PEF_CONFIGURATION_PARAMETERS_ALERT_STRING_KEYS_RQ_SET_NUMBER_FOR_STRING 6
+#define TMPL_CMD_SET_PEF_CONFIGURATION_PARAMETERS_ALERT_STRING_KEYS_RQ_RESERVED4 7
+
+/* tmpl_cmd_set_pef_configuration_parameters_alert_strings_rq */
+#define TMPL_CMD_SET_PEF_CONFIGURATION_PARAMETERS_ALERT_STRINGS_RQ_CMD 0
+#define TMPL_CMD_SET_PEF_CONFIGURATION_PARAMETERS_ALERT_STRINGS_RQ_PARAMETER_SELECTOR 1
+#define TMPL_CMD_SET_PEF_CONFIGURATION_PARAMETERS_ALERT_STRINGS_RQ_RESERVED1 2
+#define TMPL_CMD_SET_PEF_CONFIGURATION_PARAMETERS_ALERT_STRINGS_RQ_STRING_SELECTOR 3
+#define TMPL_CMD_SET_PEF_CONFIGURATION_PARAMETERS_ALERT_STRINGS_RQ_RESERVED2 4
+#define TMPL_CMD_SET_PEF_CONFIGURATION_PARAMETERS_ALERT_STRINGS_RQ_BLOCK_SELECTOR 5
+#define TMPL_CMD_SET_PEF_CONFIGURATION_PARAMETERS_ALERT_STRINGS_RQ_STRING_DATA 6
+
+/* tmpl_cmd_set_pef_configuration_parameters_alert_policy_table_rq */
+#define TMPL_CMD_SET_PEF_CONFIGURATION_PARAMETERS_ALERT_POLICY_TABLE_RQ_CMD 0
+#define TMPL_CMD_SET_PEF_CONFIGURATION_PARAMETERS_ALERT_POLICY_TABLE_RQ_PARAMETER_SELECTOR 1
+#define TMPL_CMD_SET_PEF_CONFIGURATION_PARAMETERS_ALERT_POLICY_TABLE_RQ_RESERVED1 2
+#define TMPL_CMD_SET_PEF_CONFIGURATION_PARAMETERS_ALERT_POLICY_TABLE_RQ_ALERT_POLICY_ENTRY_NUMBER 3
+#define TMPL_CMD_SET_PEF_CONFIGURATION_PARAMETERS_ALERT_POLICY_TABLE_RQ_RESERVED2 4
+#define TMPL_CMD_SET_PEF_CONFIGURATION_PARAMETERS_ALERT_POLICY_TABLE_RQ_POLICY_NUMBER_POLICY_TYPE 5
+#define TMPL_CMD_SET_PEF_CONFIGURATION_PARAMETERS_ALERT_POLICY_TABLE_RQ_POLICY_NUMBER_ENABLED 6
+#define TMPL_CMD_SET_PEF_CONFIGURATION_PARAMETERS_ALERT_POLICY_TABLE_RQ_POLICY_NUMBER_POLICY_NUMBER 7
+#define TMPL_CMD_SET_PEF_CONFIGURATION_PARAMETERS_ALERT_POLICY_TABLE_RQ_CHANNEL_DESTINATION_DESTINATION_SELECTOR 8
+#define TMPL_CMD_SET_PEF_CONFIGURATION_PARAMETERS_ALERT_POLICY_TABLE_RQ_CHANNEL_DESTINATION_CHANNEL_NUMBER 9
+#define TMPL_CMD_SET_PEF_CONFIGURATION_PARAMETERS_ALERT_POLICY_TABLE_RQ_ALERT_STRING_KEY_ALERT_STRING_SET_SELECTOR 10
+#define TMPL_CMD_SET_PEF_CONFIGURATION_PARAMETERS_ALERT_POLICY_TABLE_RQ_ALERT_STRING_KEY_EVENT_SPECIFIC_ALERT_STRING 11
+
+/* tmpl_cmd_get_pef_configuration_parameters_rq */
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_RQ_CMD 0
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_RQ_PARAMETER_SELECTOR 1
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_RQ_GET_PARAMETER 2
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_RQ_SET_SELECTOR 3
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_RQ_BLOCK_SELECTOR 4
+
+/* tmpl_cmd_get_pef_configuration_parameters_rs */
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_RS_CMD 0
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_RS_COMP_CODE 1
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_RS_PRESENT_REVISION 2
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_RS_OLDEST_REVISION_PARAMETER 3
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_RS_CONFIGURATION_PARAMETER_DATA 4
+
+/* tmpl_cmd_get_pef_configuration_parameters_set_in_progress_rs */
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_SET_IN_PROGRESS_RS_CMD 0
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_SET_IN_PROGRESS_RS_COMP_CODE 1
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_SET_IN_PROGRESS_RS_PRESENT_REVISION 2
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_SET_IN_PROGRESS_RS_OLDEST_REVISION_PARAMETER 3
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_SET_IN_PROGRESS_RS_STATE 4
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_SET_IN_PROGRESS_RS_RESERVED 5
+
+/* tmpl_cmd_get_pef_configuration_parameters_pef_control_rs */
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_PEF_CONTROL_RS_CMD 0
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_PEF_CONTROL_RS_COMP_CODE 1
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_PEF_CONTROL_RS_PRESENT_REVISION 2
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_PEF_CONTROL_RS_OLDEST_REVISION_PARAMETER 3
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_PEF_CONTROL_RS_PEF 4
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_PEF_CONTROL_RS_PEF_EVENT_MESSAGES 5
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_PEF_CONTROL_RS_PEF_STARTUP_DELAY 6
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_PEF_CONTROL_RS_PEF_ALERT_STARTUP_DELAY 7
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_PEF_CONTROL_RS_RESERVED 8
+
+/* tmpl_cmd_get_pef_configuration_parameters_pef_action_global_control_rs */
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_PEF_ACTION_GLOBAL_CONTROL_RS_CMD 0
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_PEF_ACTION_GLOBAL_CONTROL_RS_COMP_CODE 1
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_PEF_ACTION_GLOBAL_CONTROL_RS_PRESENT_REVISION 2
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_PEF_ACTION_GLOBAL_CONTROL_RS_OLDEST_REVISION_PARAMETER 3
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_PEF_ACTION_GLOBAL_CONTROL_RS_ALERT_ACTION 4
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_PEF_ACTION_GLOBAL_CONTROL_RS_POWER_DOWN_ACTION 5
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_PEF_ACTION_GLOBAL_CONTROL_RS_RESET_ACTION 6
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_PEF_ACTION_GLOBAL_CONTROL_RS_POWER_CYCLE_ACTION 7
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_PEF_ACTION_GLOBAL_CONTROL_RS_OEM_ACTION 8
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_PEF_ACTION_GLOBAL_CONTROL_RS_DIAGNOSTIC_INTERRUPT 9
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_PEF_ACTION_GLOBAL_CONTROL_RS_RESERVED 10
+
+/* tmpl_cmd_get_pef_configuration_parameters_pef_startup_delay_rs */
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_PEF_STARTUP_DELAY_RS_CMD 0
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_PEF_STARTUP_DELAY_RS_COMP_CODE 1
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_PEF_STARTUP_DELAY_RS_PRESENT_REVISION 2
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_PEF_STARTUP_DELAY_RS_OLDEST_REVISION_PARAMETER 3
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_PEF_STARTUP_DELAY_RS_PEF_STARTUP_DELAY 4
+
+/* tmpl_cmd_get_pef_configuration_parameters_pef_alert_startup_delay_rs */
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_PEF_ALERT_STARTUP_DELAY_RS_CMD 0
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_PEF_ALERT_STARTUP_DELAY_RS_COMP_CODE 1
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_PEF_ALERT_STARTUP_DELAY_RS_PRESENT_REVISION 2
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_PEF_ALERT_STARTUP_DELAY_RS_OLDEST_REVISION_PARAMETER 3
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_PEF_ALERT_STARTUP_DELAY_RS_PEF_ALERT_STARTUP_DELAY 4
+
+/* tmpl_cmd_get_pef_configuration_parameters_number_of_event_filters_rs */
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_NUMBER_OF_EVENT_FILTERS_RS_CMD 0
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_NUMBER_OF_EVENT_FILTERS_RS_COMP_CODE 1
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_NUMBER_OF_EVENT_FILTERS_RS_PRESENT_REVISION 2
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_NUMBER_OF_EVENT_FILTERS_RS_OLDEST_REVISION_PARAMETER 3
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_NUMBER_OF_EVENT_FILTERS_RS_NUMBER_OF_EVENT_FILTERS 4
+
+/* tmpl_cmd_get_pef_configuration_parameters_event_filter_table_rs */
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_EVENT_FILTER_TABLE_RS_CMD 0
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_EVENT_FILTER_TABLE_RS_COMP_CODE 1
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_EVENT_FILTER_TABLE_RS_PRESENT_REVISION 2
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_EVENT_FILTER_TABLE_RS_OLDEST_REVISION_PARAMETER 3
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_EVENT_FILTER_TABLE_RS_FILTER_NUMBER 4
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_EVENT_FILTER_TABLE_RS_FILTER_CONFIGURATION_RESERVED 5
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_EVENT_FILTER_TABLE_RS_FILTER_CONFIGURATION_TYPE 6
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_EVENT_FILTER_TABLE_RS_FILTER_CONFIGURATION_FILTER 7
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_EVENT_FILTER_TABLE_RS_EVENT_FILTER_ACTION_ALERT 8
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_EVENT_FILTER_TABLE_RS_EVENT_FILTER_ACTION_POWER_OFF 9
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_EVENT_FILTER_TABLE_RS_EVENT_FILTER_ACTION_RESET 10
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_EVENT_FILTER_TABLE_RS_EVENT_FILTER_ACTION_POWER_CYCLE 11
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_EVENT_FILTER_TABLE_RS_EVENT_FILTER_ACTION_OEM 12
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_EVENT_FILTER_TABLE_RS_EVENT_FILTER_ACTION_DIAGNOSTIC_INTERRUPT 13
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_EVENT_FILTER_TABLE_RS_EVENT_FILTER_ACTION_GROUP_CONTROL_OPERATION 14
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_EVENT_FILTER_TABLE_RS_EVENT_FILTER_ACTION_RESERVED 15
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_EVENT_FILTER_TABLE_RS_ALERT_POLICY_NUMBER_POLICY_NUMBER 16
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_EVENT_FILTER_TABLE_RS_ALERT_POLICY_NUMBER_GROUP_CONTROL_SELECTOR 17
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_EVENT_FILTER_TABLE_RS_ALERT_POLICY_NUMBER_RESERVED 18
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_EVENT_FILTER_TABLE_RS_EVENT_SEVERITY 19
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_EVENT_FILTER_TABLE_RS_GENERATOR_ID_BYTE1 20
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_EVENT_FILTER_TABLE_RS_GENERATOR_ID_BYTE2 21
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_EVENT_FILTER_TABLE_RS_SENSOR_TYPE 22
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_EVENT_FILTER_TABLE_RS_SENSOR_NUMBER 23
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_EVENT_FILTER_TABLE_RS_EVENT_TRIGGER 24
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_EVENT_FILTER_TABLE_RS_EVENT_DATA1_OFFSET_MASK 25
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_EVENT_FILTER_TABLE_RS_EVENT_DATA1_AND_MASK 26
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_EVENT_FILTER_TABLE_RS_EVENT_DATA1_COMPARE1 27
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_EVENT_FILTER_TABLE_RS_EVENT_DATA1_COMPARE2 28
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_EVENT_FILTER_TABLE_RS_EVENT_DATA2_AND_MASK 29
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_EVENT_FILTER_TABLE_RS_EVENT_DATA2_COMPARE1 30
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_EVENT_FILTER_TABLE_RS_EVENT_DATA2_COMPARE2 31
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_EVENT_FILTER_TABLE_RS_EVENT_DATA3_AND_MASK 32
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_EVENT_FILTER_TABLE_RS_EVENT_DATA3_COMPARE1 33
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_EVENT_FILTER_TABLE_RS_EVENT_DATA3_COMPARE2 34
+
+/* tmpl_cmd_get_pef_configuration_parameters_event_filter_table_data1_rs */
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_EVENT_FILTER_TABLE_DATA1_RS_CMD 0
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_EVENT_FILTER_TABLE_DATA1_RS_COMP_CODE 1
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_EVENT_FILTER_TABLE_DATA1_RS_PRESENT_REVISION 2
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_EVENT_FILTER_TABLE_DATA1_RS_OLDEST_REVISION_PARAMETER 3
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_EVENT_FILTER_TABLE_DATA1_RS_FILTER_NUMBER 4
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_EVENT_FILTER_TABLE_DATA1_RS_FILTER_CONFIGURATION_RESERVED 5
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_EVENT_FILTER_TABLE_DATA1_RS_FILTER_CONFIGURATION_TYPE 6
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_EVENT_FILTER_TABLE_DATA1_RS_FILTER_CONFIGURATION_FILTER 7
+
+/* tmpl_cmd_get_pef_configuration_parameters_number_of_alert_policy_entries_rs */
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_NUMBER_OF_ALERT_POLICY_ENTRIES_RS_CMD 0
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_NUMBER_OF_ALERT_POLICY_ENTRIES_RS_COMP_CODE 1
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_NUMBER_OF_ALERT_POLICY_ENTRIES_RS_PRESENT_REVISION 2
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_NUMBER_OF_ALERT_POLICY_ENTRIES_RS_OLDEST_REVISION_PARAMETER 3
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_NUMBER_OF_ALERT_POLICY_ENTRIES_RS_NUMBER_OF_ALERT_POLICY_ENTRIES 4
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_NUMBER_OF_ALERT_POLICY_ENTRIES_RS_RESERVED 5
+
+/* tmpl_cmd_get_pef_configuration_parameters_number_of_alert_strings_rs */
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_NUMBER_OF_ALERT_STRINGS_RS_CMD 0
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_NUMBER_OF_ALERT_STRINGS_RS_COMP_CODE 1
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_NUMBER_OF_ALERT_STRINGS_RS_PRESENT_REVISION 2
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_NUMBER_OF_ALERT_STRINGS_RS_OLDEST_REVISION_PARAMETER 3
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_NUMBER_OF_ALERT_STRINGS_RS_NUMBER_OF_ALERT_STRINGS 4
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_NUMBER_OF_ALERT_STRINGS_RS_RESERVED 5
+
+/* tmpl_cmd_get_pef_configuration_parameters_alert_string_keys_rs */
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_ALERT_STRING_KEYS_RS_CMD 0
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_ALERT_STRING_KEYS_RS_COMP_CODE 1
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_ALERT_STRING_KEYS_RS_PRESENT_REVISION 2
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_ALERT_STRING_KEYS_RS_OLDEST_REVISION_PARAMETER 3
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_ALERT_STRING_KEYS_RS_STRING_SELECTOR 4
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_ALERT_STRING_KEYS_RS_RESERVED2 5
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_ALERT_STRING_KEYS_RS_FILTER_NUMBER 6
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_ALERT_STRING_KEYS_RS_SET_NUMBER_FOR_STRING 7
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_ALERT_STRING_KEYS_RS_RESERVED4 8
+
+/* tmpl_cmd_get_pef_configuration_parameters_alert_strings_rs */
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_ALERT_STRINGS_RS_CMD 0
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_ALERT_STRINGS_RS_COMP_CODE 1
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_ALERT_STRINGS_RS_PRESENT_REVISION 2
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_ALERT_STRINGS_RS_OLDEST_REVISION_PARAMETER 3
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_ALERT_STRINGS_RS_STRING_SELECTOR 4
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_ALERT_STRINGS_RS_RESERVED 5
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_ALERT_STRINGS_RS_BLOCK_SELECTOR 6
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_ALERT_STRINGS_RS_STRING_DATA 7
+
+/* tmpl_cmd_get_pef_configuration_parameters_alert_policy_table_rs */
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_ALERT_POLICY_TABLE_RS_CMD 0
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_ALERT_POLICY_TABLE_RS_COMP_CODE 1
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_ALERT_POLICY_TABLE_RS_PRESENT_REVISION 2
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_ALERT_POLICY_TABLE_RS_OLDEST_REVISION_PARAMETER 3
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_ALERT_POLICY_TABLE_RS_ALERT_POLICY_ENTRY_NUMBER 4
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_ALERT_POLICY_TABLE_RS_ALERT_POLICY_ENTRY_NUMBER_RESERVED 5
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_ALERT_POLICY_TABLE_RS_POLICY_NUMBER_POLICY_TYPE 6
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_ALERT_POLICY_TABLE_RS_POLICY_NUMBER_ENABLED 7
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_ALERT_POLICY_TABLE_RS_POLICY_NUMBER_POLICY_NUMBER 8
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_ALERT_POLICY_TABLE_RS_CHANNEL_DESTINATION_DESTINATION_SELECTOR 9
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_ALERT_POLICY_TABLE_RS_CHANNEL_DESTINATION_CHANNEL_NUMBER 10
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_ALERT_POLICY_TABLE_RS_ALERT_STRING_KEY_ALERT_STRING_SET_SELECTOR 11
+#define TMPL_CMD_GET_PEF_CONFIGURATION_PARAMETERS_ALERT_POLICY_TABLE_RS_ALERT_STRING_KEY_EVENT_SPECIFIC_ALERT_STRING 12
+
+/* tmpl_cmd_set_last_processed_event_id_rq */
+#define TMPL_CMD_SET_LAST_PROCESSED_EVENT_ID_RQ_CMD 0
+#define TMPL_CMD_SET_LAST_PROCESSED_EVENT_ID_RQ_SET_RECORD_ID_FOR_LAST_RECORD 1
+#define TMPL_CMD_SET_LAST_PROCESSED_EVENT_ID_RQ_RESERVED 2
+#define TMPL_CMD_SET_LAST_PROCESSED_EVENT_ID_RQ_RECORD_ID 3
+
+/* tmpl_cmd_set_last_processed_event_id_rs */
+#define TMPL_CMD_SET_LAST_PROCESSED_EVENT_ID_RS_CMD 0
+#define TMPL_CMD_SET_LAST_PROCESSED_EVENT_ID_RS_COMP_CODE 1
+
+/* tmpl_cmd_get_last_processed_event_id_rq */
+#define TMPL_CMD_GET_LAST_PROCESSED_EVENT_ID_RQ_CMD 0
+
+/* tmpl_cmd_get_last_processed_event_id_rs */
+#define TMPL_CMD_GET_LAST_PROCESSED_EVENT_ID_RS_CMD 0
+#define TMPL_CMD_GET_LAST_PROCESSED_EVENT_ID_RS_COMP_CODE 1
+#define TMPL_CMD_GET_LAST_PROCESSED_EVENT_ID_RS_MOST_RECENT_ADDITION_TIMESTAMP 2
+#define TMPL_CMD_GET_LAST_PROCESSED_EVENT_ID_RS_RECORD_ID_FOR_LAST_RECORD_IN_SEL 3
+#define TMPL_CMD_GET_LAST_PROCESSED_EVENT_ID_RS_LAST_SW_PROCESSED_EVENT_RECORD_ID 4
+#define TMPL_CMD_GET_LAST_PROCESSED_EVENT_ID_RS_LAST_BMC_PROCESSED_EVENT_RECORD_ID 5
+
+/* tmpl_cmd_alert_immediate_rq */
+#define TMPL_CMD_ALERT_IMMEDIATE_RQ_CMD 0
+#define TMPL_CMD_ALERT_IMMEDIATE_RQ_CHANNEL_NUMBER 1
+#define TMPL_CMD_ALERT_IMMEDIATE_RQ_RESERVED1 2
+#define TMPL_CMD_ALERT_IMMEDIATE_RQ_DESTINATION_SELECTOR 3
+#define TMPL_CMD_ALERT_IMMEDIATE_RQ_RESERVED2 4
+#define TMPL_CMD_ALERT_IMMEDIATE_RQ_OPERATION 5
+#define TMPL_CMD_ALERT_IMMEDIATE_RQ_STRING_SELECTOR 6
+#define TMPL_CMD_ALERT_IMMEDIATE_RQ_SEND_ALERT_STRING 7
+
+/* tmpl_cmd_alert_immediate_rs */
+#define TMPL_CMD_ALERT_IMMEDIATE_RS_CMD 0
+#define TMPL_CMD_ALERT_IMMEDIATE_RS_COMP_CODE 1
+
+/* tmpl_cmd_pet_acknowledge_rq */
+#define TMPL_CMD_PET_ACKNOWLEDGE_RQ_CMD 0
+#define TMPL_CMD_PET_ACKNOWLEDGE_RQ_SEQUENCE_NUMBER 1
+#define TMPL_CMD_PET_ACKNOWLEDGE_RQ_LOCAL_TIMESTAMP 2
+#define TMPL_CMD_PET_ACKNOWLEDGE_RQ_EVENT_SOURCE_TYPE 3
+#define TMPL_CMD_PET_ACKNOWLEDGE_RQ_SENSOR_DEVICE 4
+#define TMPL_CMD_PET_ACKNOWLEDGE_RQ_SENSOR_NUMBER 5
+#define TMPL_CMD_PET_ACKNOWLEDGE_RQ_EVENT_DATA 6
+
+/* tmpl_cmd_pet_acknowledge_rs */
+#define TMPL_CMD_PET_ACKNOWLEDGE_RS_CMD 0
+#define TMPL_CMD_PET_ACKNOWLEDGE_RS_COMP_CODE 1
+
+/* tmpl_cmd_activate_payload_rq */
+#define TMPL_CMD_ACTIVATE_PAYLOAD_RQ_CMD 0
+#define TMPL_CMD_ACTIVATE_PAYLOAD_RQ_PAYLOAD_TYPE 1
+#define TMPL_CMD_ACTIVATE_PAYLOAD_RQ_RESERVED1 2
+#define TMPL_CMD_ACTIVATE_PAYLOAD_RQ_PAYLOAD_INSTANCE 3
+#define TMPL_CMD_ACTIVATE_PAYLOAD_RQ_RESERVED2 4
+#define TMPL_CMD_ACTIVATE_PAYLOAD_RQ_AUXILIARY_REQUEST_DATA 5
+
+/* tmpl_cmd_activate_payload_sol_rq */
+#define TMPL_CMD_ACTIVATE_PAYLOAD_SOL_RQ_CMD 0
+#define TMPL_CMD_ACTIVATE_PAYLOAD_SOL_RQ_PAYLOAD_TYPE 1
+#define TMPL_CMD_ACTIVATE_PAYLOAD_SOL_RQ_RESERVED1 2
+#define TMPL_CMD_ACTIVATE_PAYLOAD_SOL_RQ_PAYLOAD_INSTANCE 3
+#define TMPL_CMD_ACTIVATE_PAYLOAD_SOL_RQ_RESERVED2 4
+#define TMPL_CMD_ACTIVATE_PAYLOAD_SOL_RQ_RESERVED3 5
+#define TMPL_CMD_ACTIVATE_PAYLOAD_SOL_RQ_SOL_STARTUP_HANDSHAKE 6
+#define TMPL_CMD_ACTIVATE_PAYLOAD_SOL_RQ_SHARED_SERIAL_ALERT_BEHAVIOR 7
+#define TMPL_CMD_ACTIVATE_PAYLOAD_SOL_RQ_RESERVED4 8
+#define TMPL_CMD_ACTIVATE_PAYLOAD_SOL_RQ_TEST_MODE 9
+#define TMPL_CMD_ACTIVATE_PAYLOAD_SOL_RQ_AUTHENTICATION_ACTIVATION 10
+#define TMPL_CMD_ACTIVATE_PAYLOAD_SOL_RQ_ENCRYPTION_ACTIVATION 11
+#define TMPL_CMD_ACTIVATE_PAYLOAD_SOL_RQ_RESERVED5 12
+
+/* tmpl_cmd_activate_payload_rs */
+#define TMPL_CMD_ACTIVATE_PAYLOAD_RS_CMD 0
+#define TMPL_CMD_ACTIVATE_PAYLOAD_RS_COMP_CODE 1
+#define TMPL_CMD_ACTIVATE_PAYLOAD_RS_AUXILIARY_RESPONSE_DATA 2
+#define TMPL_CMD_ACTIVATE_PAYLOAD_RS_INBOUND_PAYLOAD_SIZE 3
+#define TMPL_CMD_ACTIVATE_PAYLOAD_RS_OUTBOUND_PAYLOAD_SIZE 4
+#define TMPL_CMD_ACTIVATE_PAYLOAD_RS_PAYLOAD_UDP_PORT_NUMBER 5
+#define TMPL_CMD_ACTIVATE_PAYLOAD_RS_PAYLOAD_VLAN_NUMBER 6
+
+/* tmpl_cmd_activate_payload_sol_rs */
+#define TMPL_CMD_ACTIVATE_PAYLOAD_SOL_RS_CMD 0
+#define TMPL_CMD_ACTIVATE_PAYLOAD_SOL_RS_COMP_CODE 1
+#define TMPL_CMD_ACTIVATE_PAYLOAD_SOL_RS_TEST_MODE 2
+#define TMPL_CMD_ACTIVATE_PAYLOAD_SOL_RS_RESERVED1 3
+#define TMPL_CMD_ACTIVATE_PAYLOAD_SOL_RS_INBOUND_PAYLOAD_SIZE 4
+#define TMPL_CMD_ACTIVATE_PAYLOAD_SOL_RS_OUTBOUND_PAYLOAD_SIZE 5
+#define TMPL_CMD_ACTIVATE_PAYLOAD_SOL_RS_PAYLOAD_UDP_PORT_NUMBER 6
+#define TMPL_CMD_ACTIVATE_PAYLOAD_SOL_RS_PAYLOAD_VLAN_NUMBER 7
+
+/* tmpl_cmd_deactivate_payload_rq */
+#define TMPL_CMD_DEACTIVATE_PAYLOAD_RQ_CMD 0
+#define TMPL_CMD_DEACTIVATE_PAYLOAD_RQ_PAYLOAD_TYPE 1
+#define TMPL_CMD_DEACTIVATE_PAYLOAD_RQ_RESERVED1 2
+#define TMPL_CMD_DEACTIVATE_PAYLOAD_RQ_PAYLOAD_INSTANCE 3
+#define TMPL_CMD_DEACTIVATE_PAYLOAD_RQ_RESERVED2 4
+#define TMPL_CMD_DEACTIVATE_PAYLOAD_RQ_PAYLOAD_AUXILIARY_DATA 5
+
+/* tmpl_cmd_deactivate_payload_rs */
+#define TMPL_CMD_DEACTIVATE_PAYLOAD_RS_CMD 0
+#define TMPL_CMD_DEACTIVATE_PAYLOAD_RS_COMP_CODE 1
+
+/* tmpl_cmd_suspend_resume_payload_encryption_rq */
+#define TMPL_CMD_SUSPEND_RESUME_PAYLOAD_ENCRYPTION_RQ_CMD 0
+#define TMPL_CMD_SUSPEND_RESUME_PAYLOAD_ENCRYPTION_RQ_PAYLOAD_TYPE 1
+#define TMPL_CMD_SUSPEND_RESUME_PAYLOAD_ENCRYPTION_RQ_RESERVED1 2
+#define TMPL_CMD_SUSPEND_RESUME_PAYLOAD_ENCRYPTION_RQ_PAYLOAD_INSTANCE 3
+#define TMPL_CMD_SUSPEND_RESUME_PAYLOAD_ENCRYPTION_RQ_RESERVED2 4
+#define TMPL_CMD_SUSPEND_RESUME_PAYLOAD_ENCRYPTION_RQ_OPERATION 5
+#define TMPL_CMD_SUSPEND_RESUME_PAYLOAD_ENCRYPTION_RQ_RESERVED3 6
+
+/* tmpl_cmd_suspend_resume_payload_encryption_rs */
+#define TMPL_CMD_SUSPEND_RESUME_PAYLOAD_ENCRYPTION_RS_CMD 0
+#define TMPL_CMD_SUSPEND_RESUME_PAYLOAD_ENCRYPTION_RS_COMP_CODE 1
+
+/* tmpl_cmd_get_payload_activation_status_rq */
+#define TMPL_CMD_GET_PAYLOAD_ACTIVATION_STATUS_RQ_CMD 0
+#define TMPL_CMD_GET_PAYLOAD_ACTIVATION_STATUS_RQ_PAYLOAD_TYPE 1
+
+/* tmpl_cmd_get_payload_activation_status_rs */
+#define TMPL_CMD_GET_PAYLOAD_ACTIVATION_STATUS_RS_CMD 0
+#define TMPL_CMD_GET_PAYLOAD_ACTIVATION_STATUS_RS_COMP_CODE 1
+#define TMPL_CMD_GET_PAYLOAD_ACTIVATION_STATUS_RS_INSTANCE_CAPACITY 2
+#define TMPL_CMD_GET_PAYLOAD_ACTIVATION_STATUS_RS_RESERVED 3
+#define TMPL_CMD_GET_PAYLOAD_ACTIVATION_STATUS_RS_INSTANCE_1 4
+#define TMPL_CMD_GET_PAYLOAD_ACTIVATION_STATUS_RS_INSTANCE_2 5
+#define TMPL_CMD_GET_PAYLOAD_ACTIVATION_STATUS_RS_INSTANCE_3 6
+#define TMPL_CMD_GET_PAYLOAD_ACTIVATION_STATUS_RS_INSTANCE_4 7
+#define TMPL_CMD_GET_PAYLOAD_ACTIVATION_STATUS_RS_INSTANCE_5 8
+#define TMPL_CMD_GET_PAYLOAD_ACTIVATION_STATUS_RS_INSTANCE_6 9
+#define TMPL_CMD_GET_PAYLOAD_ACTIVATION_STATUS_RS_INSTANCE_7 10
+#define TMPL_CMD_GET_PAYLOAD_ACTIVATION_STATUS_RS_INSTANCE_8 11
+#define TMPL_CMD_GET_PAYLOAD_ACTIVATION_STATUS_RS_INSTANCE_9 12
+#define TMPL_CMD_GET_PAYLOAD_ACTIVATION_STATUS_RS_INSTANCE_10 13
+#define TMPL_CMD_GET_PAYLOAD_ACTIVATION_STATUS_RS_INSTANCE_11 14
+#define TMPL_CMD_GET_PAYLOAD_ACTIVATION_STATUS_RS_INSTANCE_12 15
+#define TMPL_CMD_GET_PAYLOAD_ACTIVATION_STATUS_RS_INSTANCE_13 16
+#define TMPL_CMD_GET_PAYLOAD_ACTIVATION_STATUS_RS_INSTANCE_14 17
+#define TMPL_CMD_GET_PAYLOAD_ACTIVATION_STATUS_RS_INSTANCE_15 18
+#define TMPL_CMD_GET_PAYLOAD_ACTIVATION_STATUS_RS_INSTANCE_16 19
+
+/* tmpl_cmd_get_payload_instance_info_rq */
+#define TMPL_CMD_GET_PAYLOAD_INSTANCE_INFO_RQ_CMD 0
+#define TMPL_CMD_GET_PAYLOAD_INSTANCE_INFO_RQ_PAYLOAD_TYPE 1
+#define TMPL_CMD_GET_PAYLOAD_INSTANCE_INFO_RQ_PAYLOAD_INSTANCE 2
+
+/* tmpl_cmd_get_payload_instance_info_rs */
+#define TMPL_CMD_GET_PAYLOAD_INSTANCE_INFO_RS_CMD 0
+#define TMPL_CMD_GET_PAYLOAD_INSTANCE_INFO_RS_COMP_CODE 1
+#define TMPL_CMD_GET_PAYLOAD_INSTANCE_INFO_RS_SESSION_ID 2
+#define TMPL_CMD_GET_PAYLOAD_INSTANCE_INFO_RS_PORT_NUMBER 3
+#define TMPL_CMD_GET_PAYLOAD_INSTANCE_INFO_RS_RESERVED 4
+
+/* tmpl_cmd_set_user_payload_access_rq */
+#define TMPL_CMD_SET_USER_PAYLOAD_ACCESS_RQ_CMD 0
+#define TMPL_CMD_SET_USER_PAYLOAD_ACCESS_RQ_CHANNEL_NUMBER 1
+#define TMPL_CMD_SET_USER_PAYLOAD_ACCESS_RQ_RESERVED1 2
+#define TMPL_CMD_SET_USER_PAYLOAD_ACCESS_RQ_USER_ID 3
+#define TMPL_CMD_SET_USER_PAYLOAD_ACCESS_RQ_OPERATION 4
+#define TMPL_CMD_SET_USER_PAYLOAD_ACCESS_RQ_RESERVED2 5
+#define TMPL_CMD_SET_USER_PAYLOAD_ACCESS_RQ_STANDARD_PAYLOAD_1 6
+#define TMPL_CMD_SET_USER_PAYLOAD_ACCESS_RQ_STANDARD_PAYLOAD_2 7
+#define TMPL_CMD_SET_USER_PAYLOAD_ACCESS_RQ_STANDARD_PAYLOAD_3 8
+#define TMPL_CMD_SET_USER_PAYLOAD_ACCESS_RQ_STANDARD_PAYLOAD_4 9
+#define TMPL_CMD_SET_USER_PAYLOAD_ACCESS_RQ_STANDARD_PAYLOAD_5 10
+#define TMPL_CMD_SET_USER_PAYLOAD_ACCESS_RQ_STANDARD_PAYLOAD_6 11
+#define TMPL_CMD_SET_USER_PAYLOAD_ACCESS_RQ_STANDARD_PAYLOAD_7 12
+#define TMPL_CMD_SET_USER_PAYLOAD_ACCESS_RQ_RESERVED3 13
+#define TMPL_CMD_SET_USER_PAYLOAD_ACCESS_RQ_OEM_PAYLOAD_0 14
+#define TMPL_CMD_SET_USER_PAYLOAD_ACCESS_RQ_OEM_PAYLOAD_1 15
+#define TMPL_CMD_SET_USER_PAYLOAD_ACCESS_RQ_OEM_PAYLOAD_2 16
+#define TMPL_CMD_SET_USER_PAYLOAD_ACCESS_RQ_OEM_PAYLOAD_3 17
+#define TMPL_CMD_SET_USER_PAYLOAD_ACCESS_RQ_OEM_PAYLOAD_4 18
+#define TMPL_CMD_SET_USER_PAYLOAD_ACCESS_RQ_OEM_PAYLOAD_5 19
+#define TMPL_CMD_SET_USER_PAYLOAD_ACCESS_RQ_OEM_PAYLOAD_6 20
+#define TMPL_CMD_SET_USER_PAYLOAD_ACCESS_RQ_OEM_PAYLOAD_7 21
+#define TMPL_CMD_SET_USER_PAYLOAD_ACCESS_RQ_RESERVED4 22
+
+/* tmpl_cmd_set_user_payload_access_rs */
+#define TMPL_CMD_SET_USER_PAYLOAD_ACCESS_RS_CMD 0
+#define TMPL_CMD_SET_USER_PAYLOAD_ACCESS_RS_COMP_CODE 1
+
+/* tmpl_cmd_get_user_payload_access_rq */
+#define TMPL_CMD_GET_USER_PAYLOAD_ACCESS_RQ_CMD 0
+#define TMPL_CMD_GET_USER_PAYLOAD_ACCESS_RQ_CHANNEL_NUMBER 1
+#define TMPL_CMD_GET_USER_PAYLOAD_ACCESS_RQ_RESERVED1 2
+#define TMPL_CMD_GET_USER_PAYLOAD_ACCESS_RQ_USER_ID 3
+#define TMPL_CMD_GET_USER_PAYLOAD_ACCESS_RQ_RESERVED2 4
+
+/* tmpl_cmd_get_user_payload_access_rs */
+#define TMPL_CMD_GET_USER_PAYLOAD_ACCESS_RS_CMD 0
+#define TMPL_CMD_GET_USER_PAYLOAD_ACCESS_RS_COMP_CODE 1
+#define TMPL_CMD_GET_USER_PAYLOAD_ACCESS_RS_RESERVED1 2
+#define TMPL_CMD_GET_USER_PAYLOAD_ACCESS_RS_STANDARD_PAYLOAD_1 3
+#define TMPL_CMD_GET_USER_PAYLOAD_ACCESS_RS_STANDARD_PAYLOAD_2 4
+#define TMPL_CMD_GET_USER_PAYLOAD_ACCESS_RS_STANDARD_PAYLOAD_3 5
+#define TMPL_CMD_GET_USER_PAYLOAD_ACCESS_RS_STANDARD_PAYLOAD_4 6
+#define TMPL_CMD_GET_USER_PAYLOAD_ACCESS_RS_STANDARD_PAYLOAD_5 7
+#define TMPL_CMD_GET_USER_PAYLOAD_ACCESS_RS_STANDARD_PAYLOAD_6 8
+#define TMPL_CMD_GET_USER_PAYLOAD_ACCESS_RS_STANDARD_PAYLOAD_7 9
+#define TMPL_CMD_GET_USER_PAYLOAD_ACCESS_RS_RESERVED2 10
+#define TMPL_CMD_GET_USER_PAYLOAD_ACCESS_RS_OEM_PAYLOAD_0 11
+#define TMPL_CMD_GET_USER_PAYLOAD_ACCESS_RS_OEM_PAYLOAD_1 12
+#define TMPL_CMD_GET_USER_PAYLOAD_ACCESS_RS_OEM_PAYLOAD_2 13
+#define TMPL_CMD_GET_USER_PAYLOAD_ACCESS_RS_OEM_PAYLOAD_3 14
+#define TMPL_CMD_GET_USER_PAYLOAD_ACCESS_RS_OEM_PAYLOAD_4 15
+#define TMPL_CMD_GET_USER_PAYLOAD_ACCESS_RS_OEM_PAYLOAD_5 16
+#define TMPL_CMD_GET_USER_PAYLOAD_ACCESS_RS_OEM_PAYLOAD_6 17
+#define TMPL_CMD_GET_USER_PAYLOAD_ACCESS_RS_OEM_PAYLOAD_7 18
+#define TMPL_CMD_GET_USER_PAYLOAD_ACCESS_RS_RESERVED3 19
+
+/* tmpl_cmd_get_channel_payload_support_rq */
+#define TMPL_CMD_GET_CHANNEL_PAYLOAD_SUPPORT_RQ_CMD 0
+#define TMPL_CMD_GET_CHANNEL_PAYLOAD_SUPPORT_RQ_CHANNEL_NUMBER 1
+#define TMPL_CMD_GET_CHANNEL_PAYLOAD_SUPPORT_RQ_RESERVED 2
+
+/* tmpl_cmd_get_channel_payload_support_rs */
+#define TMPL_CMD_GET_CHANNEL_PAYLOAD_SUPPORT_RS_CMD 0
+#define TMPL_CMD_GET_CHANNEL_PAYLOAD_SUPPORT_RS_COMP_CODE 1
+#define TMPL_CMD_GET_CHANNEL_PAYLOAD_SUPPORT_RS_STANDARD_PAYLOAD_TYPE_0_SUPPORTED 2
+#define TMPL_CMD_GET_CHANNEL_PAYLOAD_SUPPORT_RS_STANDARD_PAYLOAD_TYPE_1_SUPPORTED 3
+#define TMPL_CMD_GET_CHANNEL_PAYLOAD_SUPPORT_RS_STANDARD_PAYLOAD_TYPE_2_SUPPORTED 4
+#define TMPL_CMD_GET_CHANNEL_PAYLOAD_SUPPORT_RS_STANDARD_PAYLOAD_TYPE_3_SUPPORTED 5
+#define TMPL_CMD_GET_CHANNEL_PAYLOAD_SUPPORT_RS_STANDARD_PAYLOAD_TYPE_4_SUPPORTED 6
+#define TMPL_CMD_GET_CHANNEL_PAYLOAD_SUPPORT_RS_STANDARD_PAYLOAD_TYPE_5_SUPPORTED 7
+#define TMPL_CMD_GET_CHANNEL_PAYLOAD_SUPPORT_RS_STANDARD_PAYLOAD_TYPE_6_SUPPORTED 8
+#define TMPL_CMD_GET_CHANNEL_PAYLOAD_SUPPORT_RS_STANDARD_PAYLOAD_TYPE_7_SUPPORTED 9
+#define TMPL_CMD_GET_CHANNEL_PAYLOAD_SUPPORT_RS_STANDARD_PAYLOAD_TYPE_8_SUPPORTED 10
+#define TMPL_CMD_GET_CHANNEL_PAYLOAD_SUPPORT_RS_STANDARD_PAYLOAD_TYPE_9_SUPPORTED 11
+#define TMPL_CMD_GET_CHANNEL_PAYLOAD_SUPPORT_RS_STANDARD_PAYLOAD_TYPE_10_SUPPORTED 12
+#define TMPL_CMD_GET_CHANNEL_PAYLOAD_SUPPORT_RS_STANDARD_PAYLOAD_TYPE_11_SUPPORTED 13
+#define TMPL_CMD_GET_CHANNEL_PAYLOAD_SUPPORT_RS_STANDARD_PAYLOAD_TYPE_12_SUPPORTED 14
+#define TMPL_CMD_GET_CHANNEL_PAYLOAD_SUPPORT_RS_STANDARD_PAYLOAD_TYPE_13_SUPPORTED 15
+#define TMPL_CMD_GET_CHANNEL_PAYLOAD_SUPPORT_RS_STANDARD_PAYLOAD_TYPE_14_SUPPORTED 16
+#define TMPL_CMD_GET_CHANNEL_PAYLOAD_SUPPORT_RS_STANDARD_PAYLOAD_TYPE_15_SUPPORTED 17
+#define TMPL_CMD_GET_CHANNEL_PAYLOAD_SUPPORT_RS_SESSION_SETUP_PAYLOAD_0_SUPPORTED 18
+#define TMPL_CMD_GET_CHANNEL_PAYLOAD_SUPPORT_RS_SESSION_SETUP_PAYLOAD_1_SUPPORTED 19
+#define TMPL_CMD_GET_CHANNEL_PAYLOAD_SUPPORT_RS_SESSION_SETUP_PAYLOAD_2_SUPPORTED 20
+#define TMPL_CMD_GET_CHANNEL_PAYLOAD_SUPPORT_RS_SESSION_SETUP_PAYLOAD_3_SUPPORTED 21
+#define TMPL_CMD_GET_CHANNEL_PAYLOAD_SUPPORT_RS_SESSION_SETUP_PAYLOAD_4_SUPPORTED 22
+#define TMPL_CMD_GET_CHANNEL_PAYLOAD_SUPPORT_RS_SESSION_SETUP_PAYLOAD_5_SUPPORTED 23
+#define TMPL_CMD_GET_CHANNEL_PAYLOAD_SUPPORT_RS_SESSION_SETUP_PAYLOAD_6_SUPPORTED 24
+#define TMPL_CMD_GET_CHANNEL_PAYLOAD_SUPPORT_RS_SESSION_SETUP_PAYLOAD_7_SUPPORTED 25
+#define TMPL_CMD_GET_CHANNEL_PAYLOAD_SUPPORT_RS_SESSION_SETUP_PAYLOAD_8_SUPPORTED 26
+#define TMPL_CMD_GET_CHANNEL_PAYLOAD_SUPPORT_RS_SESSION_SETUP_PAYLOAD_9_SUPPORTED 27
+#define TMPL_CMD_GET_CHANNEL_PAYLOAD_SUPPORT_RS_SESSION_SETUP_PAYLOAD_10_SUPPORTED 28
+#define TMPL_CMD_GET_CHANNEL_PAYLOAD_SUPPORT_RS_SESSION_SETUP_PAYLOAD_11_SUPPORTED 29
+#define TMPL_CMD_GET_CHANNEL_PAYLOAD_SUPPORT_RS_SESSION_SETUP_PAYLOAD_12_SUPPORTED 30
+#define TMPL_CMD_GET_CHANNEL_PAYLOAD_SUPPORT_RS_SESSION_SETUP_PAYLOAD_13_SUPPORTED 31
+#define TMPL_CMD_GET_CHANNEL_PAYLOAD_SUPPORT_RS_SESSION_SETUP_PAYLOAD_14_SUPPORTED 32
+#define TMPL_CMD_GET_CHANNEL_PAYLOAD_SUPPORT_RS_SESSION_SETUP_PAYLOAD_15_SUPPORTED 33
+#define TMPL_CMD_GET_CHANNEL_PAYLOAD_SUPPORT_RS_PAYLOAD_TYPE_20H_SUPPORTED 34
+#define TMPL_CMD_GET_CHANNEL_PAYLOAD_SUPPORT_RS_PAYLOAD_TYPE_21H_SUPPORTED 35
+#define TMPL_CMD_GET_CHANNEL_PAYLOAD_SUPPORT_RS_PAYLOAD_TYPE_22H_SUPPORTED 36
+#define TMPL_CMD_GET_CHANNEL_PAYLOAD_SUPPORT_RS_PAYLOAD_TYPE_23H_SUPPORTED 37
+#define TMPL_CMD_GET_CHANNEL_PAYLOAD_SUPPORT_RS_PAYLOAD_TYPE_24H_SUPPORTED 38
+#define TMPL_CMD_GET_CHANNEL_PAYLOAD_SUPPORT_RS_PAYLOAD_TYPE_25H_SUPPORTED 39
+#define TMPL_CMD_GET_CHANNEL_PAYLOAD_SUPPORT_RS_PAYLOAD_TYPE_26H_SUPPORTED 40
+#define TMPL_CMD_GET_CHANNEL_PAYLOAD_SUPPORT_RS_PAYLOAD_TYPE_27H_SUPPORTED 41
+#define TMPL_CMD_GET_CHANNEL_PAYLOAD_SUPPORT_RS_PAYLOAD_TYPE_28H_SUPPORTED 42
+#define TMPL_CMD_GET_CHANNEL_PAYLOAD_SUPPORT_RS_PAYLOAD_TYPE_29H_SUPPORTED 43
+#define TMPL_CMD_GET_CHANNEL_PAYLOAD_SUPPORT_RS_PAYLOAD_TYPE_2AH_SUPPORTED 44
+#define TMPL_CMD_GET_CHANNEL_PAYLOAD_SUPPORT_RS_PAYLOAD_TYPE_2BH_SUPPORTED 45
+#define TMPL_CMD_GET_CHANNEL_PAYLOAD_SUPPORT_RS_PAYLOAD_TYPE_2CH_SUPPORTED 46
+#define TMPL_CMD_GET_CHANNEL_PAYLOAD_SUPPORT_RS_PAYLOAD_TYPE_2DH_SUPPORTED 47
+#define TMPL_CMD_GET_CHANNEL_PAYLOAD_SUPPORT_RS_PAYLOAD_TYPE_2EH_SUPPORTED 48
+#define TMPL_CMD_GET_CHANNEL_PAYLOAD_SUPPORT_RS_PAYLOAD_TYPE_2FH_SUPPORTED 49
+#define TMPL_CMD_GET_CHANNEL_PAYLOAD_SUPPORT_RS_RESERVED 50
+
+/* tmpl_cmd_get_channel_payload_version_rq */
+#define TMPL_CMD_GET_CHANNEL_PAYLOAD_VERSION_RQ_CMD 0
+#define TMPL_CMD_GET_CHANNEL_PAYLOAD_VERSION_RQ_CHANNEL_NUMBER 1
+#define TMPL_CMD_GET_CHANNEL_PAYLOAD_VERSION_RQ_RESERVED 2
+#define TMPL_CMD_GET_CHANNEL_PAYLOAD_VERSION_RQ_PAYLOAD_TYPE 3
+
+/* tmpl_cmd_get_channel_payload_version_rs */
+#define TMPL_CMD_GET_CHANNEL_PAYLOAD_VERSION_RS_CMD 0
+#define TMPL_CMD_GET_CHANNEL_PAYLOAD_VERSION_RS_COMP_CODE 1
+#define TMPL_CMD_GET_CHANNEL_PAYLOAD_VERSION_RS_MINOR_FORMAT_VERSION 2
+#define TMPL_CMD_GET_CHANNEL_PAYLOAD_VERSION_RS_MAJOR_FORMAT_VERSION 3
+
+/* tmpl_cmd_get_channel_oem_payload_info_rq */
+#define TMPL_CMD_GET_CHANNEL_OEM_PAYLOAD_INFO_RQ_CMD 0
+#define TMPL_CMD_GET_CHANNEL_OEM_PAYLOAD_INFO_RQ_CHANNEL_NUMBER 1
+#define TMPL_CMD_GET_CHANNEL_OEM_PAYLOAD_INFO_RQ_RESERVED 2
+#define TMPL_CMD_GET_CHANNEL_OEM_PAYLOAD_INFO_RQ_PAYLOAD_TYPE 3
+#define TMPL_CMD_GET_CHANNEL_OEM_PAYLOAD_INFO_RQ_OEM_IANA 4
+#define TMPL_CMD_GET_CHANNEL_OEM_PAYLOAD_INFO_RQ_OEM_PAYLOAD_ID 5
+
+/* tmpl_cmd_get_channel_oem_payload_info_rs */
+#define TMPL_CMD_GET_CHANNEL_OEM_PAYLOAD_INFO_RS_CMD 0
+#define TMPL_CMD_GET_CHANNEL_OEM_PAYLOAD_INFO_RS_COMP_CODE 1
+#define TMPL_CMD_GET_CHANNEL_OEM_PAYLOAD_INFO_RS_PAYLOAD_TYPE 2
+#define TMPL_CMD_GET_CHANNEL_OEM_PAYLOAD_INFO_RS_OEM_IANA 3
+#define TMPL_CMD_GET_CHANNEL_OEM_PAYLOAD_INFO_RS_OEM_PAYLOAD_ID 4
+#define TMPL_CMD_GET_CHANNEL_OEM_PAYLOAD_INFO_RS_MINOR_FORMAT_VERSION 5
+#define TMPL_CMD_GET_CHANNEL_OEM_PAYLOAD_INFO_RS_MAJOR_FORMAT_VERSION 6
+
+/* tmpl_cmd_get_sdr_repository_info_rq */
+#define TMPL_CMD_GET_SDR_REPOSITORY_INFO_RQ_CMD 0
+
+/* tmpl_cmd_get_sdr_repository_info_rs */
+#define TMPL_CMD_GET_SDR_REPOSITORY_INFO_RS_CMD 0
+#define TMPL_CMD_GET_SDR_REPOSITORY_INFO_RS_COMP_CODE 1
+#define TMPL_CMD_GET_SDR_REPOSITORY_INFO_RS_SDR_VERSION_MAJOR 2
+#define TMPL_CMD_GET_SDR_REPOSITORY_INFO_RS_SDR_VERSION_MINOR 3
+#define TMPL_CMD_GET_SDR_REPOSITORY_INFO_RS_RECORD_COUNT 4
+#define TMPL_CMD_GET_SDR_REPOSITORY_INFO_RS_FREE_SPACE 5
+#define TMPL_CMD_GET_SDR_REPOSITORY_INFO_RS_MOST_RECENT_ADDITION_TIMESTAMP 6
+#define TMPL_CMD_GET_SDR_REPOSITORY_INFO_RS_MOST_RECENT_ERASE_TIMESTAMP 7
+#define TMPL_CMD_GET_SDR_REPOSITORY_INFO_RS_GET_SDR_REPOSITORY_ALLOCATION_INFO_COMMAND_SUPPORTED 8
+#define TMPL_CMD_GET_SDR_REPOSITORY_INFO_RS_RESERVE_SDR_REPOSITORY_COMMAND_SUPPORTED 9
+#define TMPL_CMD_GET_SDR_REPOSITORY_INFO_RS_PARTIAL_ADD_SDR_COMMAND_SUPPORTED 10
+#define TMPL_CMD_GET_SDR_REPOSITORY_INFO_RS_DELETE_SDR_COMMAND_SUPPORTED 11
+#define TMPL_CMD_GET_SDR_REPOSITORY_INFO_RS_RESERVED 12
+#define TMPL_CMD_GET_SDR_REPOSITORY_INFO_RS_MODAL_NON_MODAL_SDR_REPOSITORY_UPDATE_OPERATION_SUPPORTED 13
+#define TMPL_CMD_GET_SDR_REPOSITORY_INFO_RS_OVERFLOW_FLAG 14
+
+/* tmpl_cmd_get_sdr_repository_allocation_info_rq */
+#define TMPL_CMD_GET_SDR_REPOSITORY_ALLOCATION_INFO_RQ_CMD 0
+
+/* tmpl_cmd_get_sdr_repository_allocation_info_rs */
+#define TMPL_CMD_GET_SDR_REPOSITORY_ALLOCATION_INFO_RS_CMD 0
+#define TMPL_CMD_GET_SDR_REPOSITORY_ALLOCATION_INFO_RS_COMP_CODE 1
+#define TMPL_CMD_GET_SDR_REPOSITORY_ALLOCATION_INFO_RS_NUMBER_OF_POSSIBLE_ALLOCATION_UNITS 2
+#define TMPL_CMD_GET_SDR_REPOSITORY_ALLOCATION_INFO_RS_ALLOCATION_UNIT_SIZE 3
+#define TMPL_CMD_GET_SDR_REPOSITORY_ALLOCATION_INFO_RS_NUMBER_OF_FREE_ALLOCATION_UNITS 4
+#define TMPL_CMD_GET_SDR_REPOSITORY_ALLOCATION_INFO_RS_LARGEST_FREE_BLOCK 5
+#define TMPL_CMD_GET_SDR_REPOSITORY_ALLOCATION_INFO_RS_MAXIMUM_RECORD_SIZE 6
+
+/* tmpl_cmd_reserve_sdr_repository_rq */
+#define TMPL_CMD_RESERVE_SDR_REPOSITORY_RQ_CMD 0
+
+/* tmpl_cmd_reserve_sdr_repository_rs */
+#define TMPL_CMD_RESERVE_SDR_REPOSITORY_RS_CMD 0
+#define TMPL_CMD_RESERVE_SDR_REPOSITORY_RS_COMP_CODE 1
+#define TMPL_CMD_RESERVE_SDR_REPOSITORY_RS_RESERVATION_ID 2
+
+/* tmpl_cmd_get_sdr_rq */
+#define TMPL_CMD_GET_SDR_RQ_CMD 0
+#define TMPL_CMD_GET_SDR_RQ_RESERVATION_ID 1
+#define TMPL_CMD_GET_SDR_RQ_RECORD_ID 2
+#define TMPL_CMD_GET_SDR_RQ_OFFSET_INTO_RECORD 3
+#define TMPL_CMD_GET_SDR_RQ_BYTES_TO_READ 4
+
+/* tmpl_cmd_get_sdr_rs */
+#define TMPL_CMD_GET_SDR_RS_CMD 0
+#define TMPL_CMD_GET_SDR_RS_COMP_CODE 1
+#define TMPL_CMD_GET_SDR_RS_NEXT_RECORD_ID 2
+#define TMPL_CMD_GET_SDR_RS_RECORD_DATA 3
+
+/* tmpl_cmd_get_sdr_repository_time_rq */
+#define TMPL_CMD_GET_SDR_REPOSITORY_TIME_RQ_CMD 0
+
+/* tmpl_cmd_get_sdr_repository_time_rs */
+#define TMPL_CMD_GET_SDR_REPOSITORY_TIME_RS_CMD 0
+#define TMPL_CMD_GET_SDR_REPOSITORY_TIME_RS_COMP_CODE 1
+#define TMPL_CMD_GET_SDR_REPOSITORY_TIME_RS_TIME 2
+
+/* tmpl_cmd_set_sdr_repository_time_rq */
+#define TMPL_CMD_SET_SDR_REPOSITORY_TIME_RQ_CMD 0
+#define TMPL_CMD_SET_SDR_REPOSITORY_TIME_RQ_TIME 1
+
+/* tmpl_cmd_set_sdr_repository_time_rs */
+#define TMPL_CMD_SET_SDR_REPOSITORY_TIME_RS_CMD 0
+#define TMPL_CMD_SET_SDR_REPOSITORY_TIME_RS_COMP_CODE 1
+
+/* tmpl_cmd_get_sel_info_rq */
+#define TMPL_CMD_GET_SEL_INFO_RQ_CMD 0
+
+/* tmpl_cmd_get_sel_info_rs */
+#define TMPL_CMD_GET_SEL_INFO_RS_CMD 0
+#define TMPL_CMD_GET_SEL_INFO_RS_COMP_CODE 1
+#define TMPL_CMD_GET_SEL_INFO_RS_SEL_VERSION_MAJOR 2
+#define TMPL_CMD_GET_SEL_INFO_RS_SEL_VERSION_MINOR 3
+#define TMPL_CMD_GET_SEL_INFO_RS_ENTRIES 4
+#define TMPL_CMD_GET_SEL_INFO_RS_FREE_SPACE 5
+#define TMPL_CMD_GET_SEL_INFO_RS_MOST_RECENT_ADDITION_TIMESTAMP 6
+#define TMPL_CMD_GET_SEL_INFO_RS_MOST_RECENT_ERASE_TIMESTAMP 7
+#define TMPL_CMD_GET_SEL_INFO_RS_GET_SEL_ALLOCATION_INFO_COMMAND_SUPPORTED 8
+#define TMPL_CMD_GET_SEL_INFO_RS_RESERVE_SEL_COMMAND_SUPPORTED 9
+#define TMPL_CMD_GET_SEL_INFO_RS_PARTIAL_ADD_SEL_ENTRY_COMMAND_SUPPORTED 10
+#define TMPL_CMD_GET_SEL_INFO_RS_DELETE_SEL_COMMAND_SUPPORTED 11
+#define TMPL_CMD_GET_SEL_INFO_RS_RESERVED 12
+#define TMPL_CMD_GET_SEL_INFO_RS_OVERFLOW_FLAG 13
+
+/* tmpl_cmd_get_sel_allocation_info_rq */
+#define TMPL_CMD_GET_SEL_ALLOCATION_INFO_RQ_CMD 0
+
+/* tmpl_cmd_get_sel_allocation_info_rs */
+#define TMPL_CMD_GET_SEL_ALLOCATION_INFO_RS_CMD 0
+#define TMPL_CMD_GET_SEL_ALLOCATION_INFO_RS_COMP_CODE 1
+#define TMPL_CMD_GET_SEL_ALLOCATION_INFO_RS_NUMBER_OF_POSSIBLE_ALLOCATION_UNITS 2
+#define TMPL_CMD_GET_SEL_ALLOCATION_INFO_RS_ALLOCATION_UNIT_SIZE 3
+#define TMPL_CMD_GET_SEL_ALLOCATION_INFO_RS_NUMBER_OF_FREE_ALLOCATION_UNITS 4
+#define TMPL_CMD_GET_SEL_ALLOCATION_INFO_RS_LARGEST_FREE_BLOCK 5
+#define TMPL_CMD_GET_SEL_ALLOCATION_INFO_RS_MAXIMUM_RECORD_SIZE 6
+
+/* tmpl_cmd_reserve_sel_rq */
+#define TMPL_CMD_RESERVE_SEL_RQ_CMD 0
+
+/* tmpl_cmd_reserve_sel_rs */
+#define TMPL_CMD_RESERVE_SEL_RS_CMD 0
+#define TMPL_CMD_RESERVE_SEL_RS_COMP_CODE 1
+#define TMPL_CMD_RESERVE_SEL_RS_RESERVATION_ID 2
+
+/* tmpl_cmd_get_sel_entry_rq */
+#define TMPL_CMD_GET_SEL_ENTRY_RQ_CMD 0
+#define TMPL_CMD_GET_SEL_ENTRY_RQ_RESERVATION_ID 1
+#define TMPL_CMD_GET_SEL_ENTRY_RQ_RECORD_ID 2
+#define TMPL_CMD_GET_SEL_ENTRY_RQ_OFFSET_INTO_RECORD 3
+#define TMPL_CMD_GET_SEL_ENTRY_RQ_BYTES_TO_READ 4
+
+/* tmpl_cmd_get_sel_entry_rs */
+#define TMPL_CMD_GET_SEL_ENTRY_RS_CMD 0
+#define TMPL_CMD_GET_SEL_ENTRY_RS_COMP_CODE 1
+#define TMPL_CMD_GET_SEL_ENTRY_RS_NEXT_RECORD_ID 2
+#define TMPL_CMD_GET_SEL_ENTRY_RS_RECORD_DATA 3
+
+/* tmpl_cmd_delete_sel_entry_rq */
+#define TMPL_CMD_DELETE_SEL_ENTRY_RQ_CMD 0
+#define TMPL_CMD_DELETE_SEL_ENTRY_RQ_RESERVATION_ID 1
+#define TMPL_CMD_DELETE_SEL_ENTRY_RQ_RECORD_ID 2
+
+/* tmpl_cmd_delete_sel_entry_rs */
+#define TMPL_CMD_DELETE_SEL_ENTRY_RS_CMD 0
+#define TMPL_CMD_DELETE_SEL_ENTRY_RS_COMP_CODE 1
+#define TMPL_CMD_DELETE_SEL_ENTRY_RS_RECORD_ID 2
+
+/* tmpl_cmd_clear_sel_rq */
+#define TMPL_CMD_CLEAR_SEL_RQ_CMD 0
+#define TMPL_CMD_CLEAR_SEL_RQ_RESERVATION_ID 1
+#define TMPL_CMD_CLEAR_SEL_RQ_C 2
+#define TMPL_CMD_CLEAR_SEL_RQ_L 3
+#define TMPL_CMD_CLEAR_SEL_RQ_R 4
+#define TMPL_CMD_CLEAR_SEL_RQ_OPERATION 5
+
+/* tmpl_cmd_clear_sel_rs */
+#define TMPL_CMD_CLEAR_SEL_RS_CMD 0
+#define TMPL_CMD_CLEAR_SEL_RS_COMP_CODE 1
+#define TMPL_CMD_CLEAR_SEL_RS_ERASURE_PROGRESS 2
+#define TMPL_CMD_CLEAR_SEL_RS_RESERVED 3
+
+/* tmpl_cmd_get_sel_time_rq */
+#define TMPL_CMD_GET_SEL_TIME_RQ_CMD 0
+
+/* tmpl_cmd_get_sel_time_rs */
+#define TMPL_CMD_GET_SEL_TIME_RS_CMD 0
+#define TMPL_CMD_GET_SEL_TIME_RS_COMP_CODE 1
+#define TMPL_CMD_GET_SEL_TIME_RS_TIME 2
+
+/* tmpl_cmd_set_sel_time_rq */
+#define TMPL_CMD_SET_SEL_TIME_RQ_CMD 0
+#define TMPL_CMD_SET_SEL_TIME_RQ_TIME 1
+
+/* tmpl_cmd_set_sel_time_rs */
+#define TMPL_CMD_SET_SEL_TIME_RS_CMD 0
+#define TMPL_CMD_SET_SEL_TIME_RS_COMP_CODE 1
+
+/* tmpl_cmd_get_sel_time_utc_offset_rq */
+#define TMPL_CMD_GET_SEL_TIME_UTC_OFFSET_RQ_CMD 0
+
+/* tmpl_cmd_get_sel_time_utc_offset_rs */
+#define TMPL_CMD_GET_SEL_TIME_UTC_OFFSET_RS_CMD 0
+#define TMPL_CMD_GET_SEL_TIME_UTC_OFFSET_RS_COMP_CODE 1
+#define TMPL_CMD_GET_SEL_TIME_UTC_OFFSET_RS_OFFSET 2
+
+/* tmpl_cmd_set_sel_time_utc_offset_rq */
+#define TMPL_CMD_SET_SEL_TIME_UTC_OFFSET_RQ_CMD 0
+#define TMPL_CMD_SET_SEL_TIME_UTC_OFFSET_RQ_OFFSET 1
+
+/* tmpl_cmd_set_sel_time_utc_offset_rs */
+#define TMPL_CMD_SET_SEL_TIME_UTC_OFFSET_RS_CMD 0
+#define TMPL_CMD_SET_SEL_TIME_UTC_OFFSET_RS_COMP_CODE 1
+
+/* tmpl_cmd_get_auxiliary_log_status_rq */
+#define TMPL_CMD_GET_AUXILIARY_LOG_STATUS_RQ_CMD 0
+#define TMPL_CMD_GET_AUXILIARY_LOG_STATUS_RQ_LOG_TYPE 1
+#define TMPL_CMD_GET_AUXILIARY_LOG_STATUS_RQ_RESERVED 2
+
+/* tmpl_cmd_get_auxiliary_log_status_rs */
+#define TMPL_CMD_GET_AUXILIARY_LOG_STATUS_RS_CMD 0
+#define TMPL_CMD_GET_AUXILIARY_LOG_STATUS_RS_COMP_CODE 1
+#define TMPL_CMD_GET_AUXILIARY_LOG_STATUS_RS_LOG_DATA 2
+
+/* tmpl_cmd_get_auxiliary_log_status_mca_rs */
+#define TMPL_CMD_GET_AUXILIARY_LOG_STATUS_MCA_RS_CMD 0
+#define TMPL_CMD_GET_AUXILIARY_LOG_STATUS_MCA_RS_COMP_CODE 1
+#define TMPL_CMD_GET_AUXILIARY_LOG_STATUS_MCA_RS_TIMESTAMP 2
+#define TMPL_CMD_GET_AUXILIARY_LOG_STATUS_MCA_RS_MCA_LOG_ENTRY_COUNT 3
+#define TMPL_CMD_GET_AUXILIARY_LOG_STATUS_MCA_RS_LOG_DATA 4
+
+/* tmpl_cmd_get_auxiliary_log_status_oem_rs */
+#define TMPL_CMD_GET_AUXILIARY_LOG_STATUS_OEM_RS_CMD 0
+#define TMPL_CMD_GET_AUXILIARY_LOG_STATUS_OEM_RS_COMP_CODE 1
+#define TMPL_CMD_GET_AUXILIARY_LOG_STATUS_OEM_RS_TIMESTAMP 2
+#define TMPL_CMD_GET_AUXILIARY_LOG_STATUS_OEM_RS_OEM_ID 3
+#define TMPL_CMD_GET_AUXILIARY_LOG_STATUS_OEM_RS_LOG_DATA 4
+
+/* tmpl_cmd_set_auxiliary_log_status_rq */
+#define TMPL_CMD_SET_AUXILIARY_LOG_STATUS_RQ_CMD 0
+#define TMPL_CMD_SET_AUXILIARY_LOG_STATUS_RQ_LOG_TYPE 1
+#define TMPL_CMD_SET_AUXILIARY_LOG_STATUS_RQ_RESERVED 2
+#define TMPL_CMD_SET_AUXILIARY_LOG_STATUS_RQ_LOG_DATA 3
+
+/* tmpl_cmd_set_auxiliary_log_status_rs */
+#define TMPL_CMD_SET_AUXILIARY_LOG_STATUS_RS_CMD 0
+#define TMPL_CMD_SET_AUXILIARY_LOG_STATUS_RS_COMP_CODE 1
+
+/* tmpl_cmd_get_device_sdr_info_rq */
+#define TMPL_CMD_GET_DEVICE_SDR_INFO_RQ_CMD 0
+#define TMPL_CMD_GET_DEVICE_SDR_INFO_RQ_OPERATION 1
+#define TMPL_CMD_GET_DEVICE_SDR_INFO_RQ_RESERVED 2
+
+/* tmpl_cmd_get_device_sdr_info_rs */
+#define TMPL_CMD_GET_DEVICE_SDR_INFO_RS_CMD 0
+#define TMPL_CMD_GET_DEVICE_SDR_INFO_RS_COMP_CODE 1
+#define TMPL_CMD_GET_DEVICE_SDR_INFO_RS_NUMBER 2
+#define TMPL_CMD_GET_DEVICE_SDR_INFO_RS_FLAGS_DEVICE_LUN_0_HAS_SENSORS 3
+#define TMPL_CMD_GET_DEVICE_SDR_INFO_RS_FLAGS_DEVICE_LUN_1_HAS_SENSORS 4
+#define TMPL_CMD_GET_DEVICE_SDR_INFO_RS_FLAGS_DEVICE_LUN_2_HAS_SENSORS 5
+#define TMPL_CMD_GET_DEVICE_SDR_INFO_RS_FLAGS_DEVICE_LUN_3_HAS_SENSORS 6
+#define TMPL_CMD_GET_DEVICE_SDR_INFO_RS_FLAGS_RESERVED 7
+#define TMPL_CMD_GET_DEVICE_SDR_INFO_RS_FLAGS_SENSOR_POPULATION 8
+#define TMPL_CMD_GET_DEVICE_SDR_INFO_RS_SENSOR_POPULATION_CHANGE_INDICATOR 9
+
+/* tmpl_cmd_get_device_sdr_rq */
+#define TMPL_CMD_GET_DEVICE_SDR_RQ_CMD 0
+#define TMPL_CMD_GET_DEVICE_SDR_RQ_RESERVATION_ID 1
+#define TMPL_CMD_GET_DEVICE_SDR_RQ_RECORD_ID 2
+#define TMPL_CMD_GET_DEVICE_SDR_RQ_OFFSET_INTO_RECORD 3
+#define TMPL_CMD_GET_DEVICE_SDR_RQ_BYTES_TO_READ 4
+
+/* tmpl_cmd_get_device_sdr_rs */
+#define TMPL_CMD_GET_DEVICE_SDR_RS_CMD 0
+#define TMPL_CMD_GET_DEVICE_SDR_RS_COMP_CODE 1
+#define TMPL_CMD_GET_DEVICE_SDR_RS_NEXT_RECORD_ID 2
+#define TMPL_CMD_GET_DEVICE_SDR_RS_RECORD_DATA 3
+
+/* tmpl_cmd_reserve_device_sdr_repository_rq */
+#define TMPL_CMD_RESERVE_DEVICE_SDR_REPOSITORY_RQ_CMD 0
+
+/* tmpl_cmd_reserve_device_sdr_repository_rs */
+#define TMPL_CMD_RESERVE_DEVICE_SDR_REPOSITORY_RS_CMD 0
+#define TMPL_CMD_RESERVE_DEVICE_SDR_REPOSITORY_RS_COMP_CODE 1
+#define TMPL_CMD_RESERVE_DEVICE_SDR_REPOSITORY_RS_RESERVATION_ID 2
+
+/* tmpl_cmd_get_sensor_reading_factors_rq */
+#define TMPL_CMD_GET_SENSOR_READING_FACTORS_RQ_CMD 0
+#define TMPL_CMD_GET_SENSOR_READING_FACTORS_RQ_SENSOR_NUMBER 1
+#define TMPL_CMD_GET_SENSOR_READING_FACTORS_RQ_READING_BYTE 2
+
+/* tmpl_cmd_get_sensor_reading_factors_rs */
+#define TMPL_CMD_GET_SENSOR_READING_FACTORS_RS_CMD 0
+#define TMPL_CMD_GET_SENSOR_READING_FACTORS_RS_COMP_CODE 1
+#define TMPL_CMD_GET_SENSOR_READING_FACTORS_RS_NEXT_READING 2
+#define TMPL_CMD_GET_SENSOR_READING_FACTORS_RS_M_LS 3
+#define TMPL_CMD_GET_SENSOR_READING_FACTORS_RS_TOLERANCE 4
+#define TMPL_CMD_GET_SENSOR_READING_FACTORS_RS_M_MS 5
+#define TMPL_CMD_GET_SENSOR_READING_FACTORS_RS_B_LS 6
+#define TMPL_CMD_GET_SENSOR_READING_FACTORS_RS_ACCURACY_LS 7
+#define TMPL_CMD_GET_SENSOR_READING_FACTORS_RS_B_MS 8
+#define TMPL_CMD_GET_SENSOR_READING_FACTORS_RS_RESERVED 9
+#define TMPL_CMD_GET_SENSOR_READING_FACTORS_RS_ACCURACY_EXP 10
+#define TMPL_CMD_GET_SENSOR_READING_FACTORS_RS_ACCURACY_MS 11
+#define TMPL_CMD_GET_SENSOR_READING_FACTORS_RS_B_EXPONENT 12
+#define TMPL_CMD_GET_SENSOR_READING_FACTORS_RS_R_EXPONENT 13
+
+/* tmpl_cmd_set_sensor_hysteresis_rq */
+#define TMPL_CMD_SET_SENSOR_HYSTERESIS_RQ_CMD 0
+#define TMPL_CMD_SET_SENSOR_HYSTERESIS_RQ_SENSOR_NUMBER 1
+#define TMPL_CMD_SET_SENSOR_HYSTERESIS_RQ_HYSTERESIS_MASK 2
+#define TMPL_CMD_SET_SENSOR_HYSTERESIS_RQ_POSITIVE_GOING_THRESHOLD_HYSTERESIS_VALUE 3
+#define TMPL_CMD_SET_SENSOR_HYSTERESIS_RQ_NEGATIVE_GOING_THRESHOLD_HYSTERESIS_VALUE 4
+
+/* tmpl_cmd_set_sensor_hysteresis_rs */
+#define TMPL_CMD_SET_SENSOR_HYSTERESIS_RS_CMD 0
+#define TMPL_CMD_SET_SENSOR_HYSTERESIS_RS_COMP_CODE 1
+
+/* tmpl_cmd_get_sensor_hysteresis_rq */
+#define TMPL_CMD_GET_SENSOR_HYSTERESIS_RQ_CMD 0
+#define TMPL_CMD_GET_SENSOR_HYSTERESIS_RQ_SENSOR_NUMBER 1
+#define TMPL_CMD_GET_SENSOR_HYSTERESIS_RQ_HYSTERESIS_MASK 2
+
+/* tmpl_cmd_get_sensor_hysteresis_rs */
+#define TMPL_CMD_GET_SENSOR_HYSTERESIS_RS_CMD 0
+#define TMPL_CMD_GET_SENSOR_HYSTERESIS_RS_COMP_CODE 1
+#define TMPL_CMD_GET_SENSOR_HYSTERESIS_RS_POSITIVE_GOING_THRESHOLD_HYSTERESIS_VALUE 2
+#define TMPL_CMD_GET_SENSOR_HYSTERESIS_RS_NEGATIVE_GOING_THRESHOLD_HYSTERESIS_VALUE 3
+
+/* tmpl_cmd_set_sensor_thresholds_rq */
+#define TMPL_CMD_SET_SENSOR_THRESHOLDS_RQ_CMD 0
+#define TMPL_CMD_SET_SENSOR_THRESHOLDS_RQ_SENSOR_NUMBER 1
+#define TMPL_CMD_SET_SENSOR_THRESHOLDS_RQ_SET_LOWER_NON_CRITICAL_THRESHOLD 2
+#define TMPL_CMD_SET_SENSOR_THRESHOLDS_RQ_SET_LOWER_CRITICAL_THRESHOLD 3
+#define TMPL_CMD_SET_SENSOR_THRESHOLDS_RQ_SET_LOWER_NON_RECOVERABLE_THRESHOLD 4
+#define TMPL_CMD_SET_SENSOR_THRESHOLDS_RQ_SET_UPPER_NON_CRITICAL_THRESHOLD 5
+#define TMPL_CMD_SET_SENSOR_THRESHOLDS_RQ_SET_UPPER_CRITICAL_THRESHOLD 6
+#define TMPL_CMD_SET_SENSOR_THRESHOLDS_RQ_SET_UPPER_NON_RECOVERABLE_THRESHOLD 7
+#define TMPL_CMD_SET_SENSOR_THRESHOLDS_RQ_RESERVED 8
+#define TMPL_CMD_SET_SENSOR_THRESHOLDS_RQ_LOWER_NON_CRITICAL_THRESHOLD 9
+#define TMPL_CMD_SET_SENSOR_THRESHOLDS_RQ_LOWER_CRITICAL_THRESHOLD 10
+#define TMPL_CMD_SET_SENSOR_THRESHOLDS_RQ_LOWER_NON_RECOVERABLE_THRESHOLD 11
+#define TMPL_CMD_SET_SENSOR_THRESHOLDS_RQ_UPPER_NON_CRITICAL_THRESHOLD 12
+#define TMPL_CMD_SET_SENSOR_THRESHOLDS_RQ_UPPER_CRITICAL_THRESHOLD 13
+#define TMPL_CMD_SET_SENSOR_THRESHOLDS_RQ_UPPER_NON_RECOVERABLE_THRESHOLD 14
+
+/* tmpl_cmd_set_sensor_thresholds_rs */
+#define TMPL_CMD_SET_SENSOR_THRESHOLDS_RS_CMD 0
+#define TMPL_CMD_SET_SENSOR_THRESHOLDS_RS_COMP_CODE 1
+
+/* tmpl_cmd_get_sensor_thresholds_rq */
+#define TMPL_CMD_GET_SENSOR_THRESHOLDS_RQ_CMD 0
+#define TMPL_CMD_GET_SENSOR_THRESHOLDS_RQ_SENSOR_NUMBER 1
+
+/* tmpl_cmd_get_sensor_thresholds_rs */
+#define TMPL_CMD_GET_SENSOR_THRESHOLDS_RS_CMD 0
+#define TMPL_CMD_GET_SENSOR_THRESHOLDS_RS_COMP_CODE 1
+#define TMPL_CMD_GET_SENSOR_THRESHOLDS_RS_READABLE_THRESHOLDS_LOWER_NON_CRITICAL_THRESHOLD 2
+#define TMPL_CMD_GET_SENSOR_THRESHOLDS_RS_READABLE_THRESHOLDS_LOWER_CRITICAL_THRESHOLD 3
+#define TMPL_CMD_GET_SENSOR_THRESHOLDS_RS_READABLE_THRESHOLDS_LOWER_NON_RECOVERABLE_THRESHOLD 4
+#define TMPL_CMD_GET_SENSOR_THRESHOLDS_RS_READABLE_THRESHOLDS_UPPER_NON_CRITICAL_THRESHOLD 5
+#define TMPL_CMD_GET_SENSOR_THRESHOLDS_RS_READABLE_THRESHOLDS_UPPER_CRITICAL_THRESHOLD 6
+#define TMPL_CMD_GET_SENSOR_THRESHOLDS_RS_READABLE_THRESHOLDS_UPPER_NON_RECOVERABLE_THRESHOLD 7
+#define TMPL_CMD_GET_SENSOR_THRESHOLDS_RS_RESERVED 8
+#define TMPL_CMD_GET_SENSOR_THRESHOLDS_RS_LOWER_NON_CRITICAL_THRESHOLD 9
+#define TMPL_CMD_GET_SENSOR_THRESHOLDS_RS_LOWER_CRITICAL_THRESHOLD 10
+#define TMPL_CMD_GET_SENSOR_THRESHOLDS_RS_LOWER_NON_RECOVERABLE_THRESHOLD 11
+#define TMPL_CMD_GET_SENSOR_THRESHOLDS_RS_UPPER_NON_CRITICAL_THRESHOLD 12
+#define TMPL_CMD_GET_SENSOR_THRESHOLDS_RS_UPPER_CRITICAL_THRESHOLD 13
+#define TMPL_CMD_GET_SENSOR_THRESHOLDS_RS_UPPER_NON_RECOVERABLE_THRESHOLD 14
+
+/* tmpl_cmd_set_sensor_event_enable_rq */
+#define TMPL_CMD_SET_SENSOR_EVENT_ENABLE_RQ_CMD 0
+#define TMPL_CMD_SET_SENSOR_EVENT_ENABLE_RQ_SENSOR_NUMBER 1
+#define TMPL_CMD_SET_SENSOR_EVENT_ENABLE_RQ_RESERVED 2
+#define TMPL_CMD_SET_SENSOR_EVENT_ENABLE_RQ_EVENT_MESSAGE_ACTION 3
+#define TMPL_CMD_SET_SENSOR_EVENT_ENABLE_RQ_SCANNING_ON_THIS_SENSOR 4
+#define TMPL_CMD_SET_SENSOR_EVENT_ENABLE_RQ_ALL_EVENT_MESSAGES 5
+#define TMPL_CMD_SET_SENSOR_EVENT_ENABLE_RQ_ASSERTION_EVENT_BITMASK 6
+#define TMPL_CMD_SET_SENSOR_EVENT_ENABLE_RQ_DEASSERTION_EVENT_BITMASK 7
+
+/* tmpl_cmd_set_sensor_event_enable_threshold_rq */
+#define TMPL_CMD_SET_SENSOR_EVENT_ENABLE_THRESHOLD_RQ_CMD 0
+#define TMPL_CMD_SET_SENSOR_EVENT_ENABLE_THRESHOLD_RQ_SENSOR_NUMBER 1
+#define TMPL_CMD_SET_SENSOR_EVENT_ENABLE_THRESHOLD_RQ_RESERVED1 2
+#define TMPL_CMD_SET_SENSOR_EVENT_ENABLE_THRESHOLD_RQ_EVENT_MESSAGE_ACTION 3
+#define TMPL_CMD_SET_SENSOR_EVENT_ENABLE_THRESHOLD_RQ_SCANNING_ON_THIS_SENSOR 4
+#define TMPL_CMD_SET_SENSOR_EVENT_ENABLE_THRESHOLD_RQ_ALL_EVENT_MESSAGES 5
+#define TMPL_CMD_SET_SENSOR_EVENT_ENABLE_THRESHOLD_RQ_ASSERTION_EVENT_LOWER_NON_CRITICAL_GOING_LOW 6
+#define TMPL_CMD_SET_SENSOR_EVENT_ENABLE_THRESHOLD_RQ_ASSERTION_EVENT_LOWER_NON_CRITICAL_GOING_HIGH 7
+#define TMPL_CMD_SET_SENSOR_EVENT_ENABLE_THRESHOLD_RQ_ASSERTION_EVENT_LOWER_CRITICAL_GOING_LOW 8
+#define TMPL_CMD_SET_SENSOR_EVENT_ENABLE_THRESHOLD_RQ_ASSERTION_EVENT_LOWER_CRITICAL_GOING_HIGH 9
+#define TMPL_CMD_SET_SENSOR_EVENT_ENABLE_THRESHOLD_RQ_ASSERTION_EVENT_LOWER_NON_RECOVERABLE_GOING_LOW 10
+#define TMPL_CMD_SET_SENSOR_EVENT_ENABLE_THRESHOLD_RQ_ASSERTION_EVENT_LOWER_NON_RECOVERABLE_GOING_HIGH 11
+#define TMPL_CMD_SET_SENSOR_EVENT_ENABLE_THRESHOLD_RQ_ASSERTION_EVENT_UPPER_NON_CRITICAL_GOING_LOW 12
+#define TMPL_CMD_SET_SENSOR_EVENT_ENABLE_THRESHOLD_RQ_ASSERTION_EVENT_UPPER_NON_CRITICAL_GOING_HIGH 13
+#define TMPL_CMD_SET_SENSOR_EVENT_ENABLE_THRESHOLD_RQ_ASSERTION_EVENT_UPPER_CRITICAL_GOING_LOW 14
+#define TMPL_CMD_SET_SENSOR_EVENT_ENABLE_THRESHOLD_RQ_ASSERTION_EVENT_UPPER_CRITICAL_GOING_HIGH 15
+#define TMPL_CMD_SET_SENSOR_EVENT_ENABLE_THRESHOLD_RQ_ASSERTION_EVENT_UPPER_NON_RECOVERABLE_GOING_LOW 16
+#define TMPL_CMD_SET_SENSOR_EVENT_ENABLE_THRESHOLD_RQ_ASSERTION_EVENT_UPPER_NON_RECOVERABLE_GOING_HIGH 17
+#define TMPL_CMD_SET_SENSOR_EVENT_ENABLE_THRESHOLD_RQ_RESERVED2 18
+#define TMPL_CMD_SET_SENSOR_EVENT_ENABLE_THRESHOLD_RQ_DEASSERTION_EVENT_LOWER_NON_CRITICAL_GOING_LOW 19
+#define TMPL_CMD_SET_SENSOR_EVENT_ENABLE_THRESHOLD_RQ_DEASSERTION_EVENT_LOWER_NON_CRITICAL_GOING_HIGH 20
+#define TMPL_CMD_SET_SENSOR_EVENT_ENABLE_THRESHOLD_RQ_DEASSERTION_EVENT_LOWER_CRITICAL_GOING_LOW 21
+#define TMPL_CMD_SET_SENSOR_EVENT_ENABLE_THRESHOLD_RQ_DEASSERTION_EVENT_LOWER_CRITICAL_GOING_HIGH 22
+#define TMPL_CMD_SET_SENSOR_EVENT_ENABLE_THRESHOLD_RQ_DEASSERTION_EVENT_LOWER_NON_RECOVERABLE_GOING_LOW 23
+#define TMPL_CMD_SET_SENSOR_EVENT_ENABLE_THRESHOLD_RQ_DEASSERTION_EVENT_LOWER_NON_RECOVERABLE_GOING_HIGH 24
+#define TMPL_CMD_SET_SENSOR_EVENT_ENABLE_THRESHOLD_RQ_DEASSERTION_EVENT_UPPER_NON_CRITICAL_GOING_LOW 25
+#define TMPL_CMD_SET_SENSOR_EVENT_ENABLE_THRESHOLD_RQ_DEASSERTION_EVENT_UPPER_NON_CRITICAL_GOING_HIGH 26
+#define TMPL_CMD_SET_SENSOR_EVENT_ENABLE_THRESHOLD_RQ_DEASSERTION_EVENT_UPPER_CRITICAL_GOING_LOW 27
+#define TMPL_CMD_SET_SENSOR_EVENT_ENABLE_THRESHOLD_RQ_DEASSERTION_EVENT_UPPER_CRITICAL_GOING_HIGH 28
+#define TMPL_CMD_SET_SENSOR_EVENT_ENABLE_THRESHOLD_RQ_DEASSERTION_EVENT_UPPER_NON_RECOVERABLE_GOING_LOW 29
+#define TMPL_CMD_SET_SENSOR_EVENT_ENABLE_THRESHOLD_RQ_DEASSERTION_EVENT_UPPER_NON_RECOVERABLE_GOING_HIGH 30
+#define TMPL_CMD_SET_SENSOR_EVENT_ENABLE_THRESHOLD_RQ_RESERVED3 31
+
+/* tmpl_cmd_set_sensor_event_enable_discrete_rq */
+#define TMPL_CMD_SET_SENSOR_EVENT_ENABLE_DISCRETE_RQ_CMD 0
+#define TMPL_CMD_SET_SENSOR_EVENT_ENABLE_DISCRETE_RQ_SENSOR_NUMBER 1
+#define TMPL_CMD_SET_SENSOR_EVENT_ENABLE_DISCRETE_RQ_RESERVED1 2
+#define TMPL_CMD_SET_SENSOR_EVENT_ENABLE_DISCRETE_RQ_EVENT_MESSAGE_ACTION 3
+#define TMPL_CMD_SET_SENSOR_EVENT_ENABLE_DISCRETE_RQ_SCANNING_ON_THIS_SENSOR 4
+#define TMPL_CMD_SET_SENSOR_EVENT_ENABLE_DISCRETE_RQ_ALL_EVENT_MESSAGES 5
+#define TMPL_CMD_SET_SENSOR_EVENT_ENABLE_DISCRETE_RQ_ASSERTION_EVENT_STATE_BIT_0 6
+#define TMPL_CMD_SET_SENSOR_EVENT_ENABLE_DISCRETE_RQ_ASSERTION_EVENT_STATE_BIT_1 7
+#define TMPL_CMD_SET_SENSOR_EVENT_ENABLE_DISCRETE_RQ_ASSERTION_EVENT_STATE_BIT_2 8
+#define TMPL_CMD_SET_SENSOR_EVENT_ENABLE_DISCRETE_RQ_ASSERTION_EVENT_STATE_BIT_3 9
+#define TMPL_CMD_SET_SENSOR_EVENT_ENABLE_DISCRETE_RQ_ASSERTION_EVENT_STATE_BIT_4 10
+#define TMPL_CMD_SET_SENSOR_EVENT_ENABLE_DISCRETE_RQ_ASSERTION_EVENT_STATE_BIT_5 11
+#define TMPL_CMD_SET_SENSOR_EVENT_ENABLE_DISCRETE_RQ_ASSERTION_EVENT_STATE_BIT_6 12
+#define TMPL_CMD_SET_SENSOR_EVENT_ENABLE_DISCRETE_RQ_ASSERTION_EVENT_STATE_BIT_7 13
+#define TMPL_CMD_SET_SENSOR_EVENT_ENABLE_DISCRETE_RQ_ASSERTION_EVENT_STATE_BIT_8 14
+#define TMPL_CMD_SET_SENSOR_EVENT_ENABLE_DISCRETE_RQ_ASSERTION_EVENT_STATE_BIT_9 15
+#define TMPL_CMD_SET_SENSOR_EVENT_ENABLE_DISCRETE_RQ_ASSERTION_EVENT_STATE_BIT_10 16
+#define TMPL_CMD_SET_SENSOR_EVENT_ENABLE_DISCRETE_RQ_ASSERTION_EVENT_STATE_BIT_11 17
+#define TMPL_CMD_SET_SENSOR_EVENT_ENABLE_DISCRETE_RQ_ASSERTION_EVENT_STATE_BIT_12 18
+#define TMPL_CMD_SET_SENSOR_EVENT_ENABLE_DISCRETE_RQ_ASSERTION_EVENT_STATE_BIT_13 19
+#define TMPL_CMD_SET_SENSOR_EVENT_ENABLE_DISCRETE_RQ_ASSERTION_EVENT_STATE_BIT_14 20
+#define TMPL_CMD_SET_SENSOR_EVENT_ENABLE_DISCRETE_RQ_RESERVED2 21
+#define TMPL_CMD_SET_SENSOR_EVENT_ENABLE_DISCRETE_RQ_DEASSERTION_EVENT_STATE_BIT_0 22
+#define TMPL_CMD_SET_SENSOR_EVENT_ENABLE_DISCRETE_RQ_DEASSERTION_EVENT_STATE_BIT_1 23
+#define TMPL_CMD_SET_SENSOR_EVENT_ENABLE_DISCRETE_RQ_DEASSERTION_EVENT_STATE_BIT_2 24
+#define TMPL_CMD_SET_SENSOR_EVENT_ENABLE_DISCRETE_RQ_DEASSERTION_EVENT_STATE_BIT_3 25
+#define TMPL_CMD_SET_SENSOR_EVENT_ENABLE_DISCRETE_RQ_DEASSERTION_EVENT_STATE_BIT_4 26
+#define TMPL_CMD_SET_SENSOR_EVENT_ENABLE_DISCRETE_RQ_DEASSERTION_EVENT_STATE_BIT_5 27
+#define TMPL_CMD_SET_SENSOR_EVENT_ENABLE_DISCRETE_RQ_DEASSERTION_EVENT_STATE_BIT_6 28
+#define TMPL_CMD_SET_SENSOR_EVENT_ENABLE_DISCRETE_RQ_DEASSERTION_EVENT_STATE_BIT_7 29
+#define TMPL_CMD_SET_SENSOR_EVENT_ENABLE_DISCRETE_RQ_DEASSERTION_EVENT_STATE_BIT_8 30
+#define TMPL_CMD_SET_SENSOR_EVENT_ENABLE_DISCRETE_RQ_DEASSERTION_EVENT_STATE_BIT_9 31
+#define TMPL_CMD_SET_SENSOR_EVENT_ENABLE_DISCRETE_RQ_DEASSERTION_EVENT_STATE_BIT_10 32
+#define TMPL_CMD_SET_SENSOR_EVENT_ENABLE_DISCRETE_RQ_DEASSERTION_EVENT_STATE_BIT_11 33
+#define TMPL_CMD_SET_SENSOR_EVENT_ENABLE_DISCRETE_RQ_DEASSERTION_EVENT_STATE_BIT_12 34
+#define TMPL_CMD_SET_SENSOR_EVENT_ENABLE_DISCRETE_RQ_DEASSERTION_EVENT_STATE_BIT_13 35
+#define TMPL_CMD_SET_SENSOR_EVENT_ENABLE_DISCRETE_RQ_DEASSERTION_EVENT_STATE_BIT_14 36
+#define TMPL_CMD_SET_SENSOR_EVENT_ENABLE_DISCRETE_RQ_RESERVED3 37
+
+/* tmpl_cmd_set_sensor_event_enable_rs */
+#define TMPL_CMD_SET_SENSOR_EVENT_ENABLE_RS_CMD 0
+#define TMPL_CMD_SET_SENSOR_EVENT_ENABLE_RS_COMP_CODE 1
+
+/* tmpl_cmd_get_sensor_event_enable_rq */
+#define TMPL_CMD_GET_SENSOR_EVENT_ENABLE_RQ_CMD 0
+#define TMPL_CMD_GET_SENSOR_EVENT_ENABLE_RQ_SENSOR_NUMBER 1
+
+/* tmpl_cmd_get_sensor_event_enable_rs */
+#define TMPL_CMD_GET_SENSOR_EVENT_ENABLE_RS_CMD 0
+#define TMPL_CMD_GET_SENSOR_EVENT_ENABLE_RS_COMP_CODE 1
+#define TMPL_CMD_GET_SENSOR_EVENT_ENABLE_RS_RESERVED 2
+#define TMPL_CMD_GET_SENSOR_EVENT_ENABLE_RS_SCANNING_ON_THIS_SENSOR 3
+#define TMPL_CMD_GET_SENSOR_EVENT_ENABLE_RS_ALL_EVENT_MESSAGES 4
+#define TMPL_CMD_GET_SENSOR_EVENT_ENABLE_RS_ASSERTION_EVENT_BITMASK 5
+#define TMPL_CMD_GET_SENSOR_EVENT_ENABLE_RS_DEASSERTION_EVENT_BITMASK 6
+
+/* tmpl_cmd_get_sensor_event_enable_threshold_rs */
+#define TMPL_CMD_GET_SENSOR_EVENT_ENABLE_THRESHOLD_RS_CMD 0
+#define TMPL_CMD_GET_SENSOR_EVENT_ENABLE_THRESHOLD_RS_COMP_CODE 1
+#define TMPL_CMD_GET_SENSOR_EVENT_ENABLE_THRESHOLD_RS_RESERVED1 2
+#define TMPL_CMD_GET_SENSOR_EVENT_ENABLE_THRESHOLD_RS_SCANNING_ON_THIS_SENSOR 3
+#define TMPL_CMD_GET_SENSOR_EVENT_ENABLE_THRESHOLD_RS_ALL_EVENT_MESSAGES 4
+#define TMPL_CMD_GET_SENSOR_EVENT_ENABLE_THRESHOLD_RS_ASSERTION_EVENT_FOR_LOWER_NON_CRITICAL_GOING_LOW 5
+#define TMPL_CMD_GET_SENSOR_EVENT_ENABLE_THRESHOLD_RS_ASSERTION_EVENT_FOR_LOWER_NON_CRITICAL_GOING_HIGH 6
+#define TMPL_CMD_GET_SENSOR_EVENT_ENABLE_THRESHOLD_RS_ASSERTION_EVENT_FOR_LOWER_CRITICAL_GOING_LOW 7
+#define TMPL_CMD_GET_SENSOR_EVENT_ENABLE_THRESHOLD_RS_ASSERTION_EVENT_FOR_LOWER_CRITICAL_GOING_HIGH 8
+#define TMPL_CMD_GET_SENSOR_EVENT_ENABLE_THRESHOLD_RS_ASSERTION_EVENT_FOR_LOWER_NON_RECOVERABLE_GOING_LOW 9
+#define TMPL_CMD_GET_SENSOR_EVENT_ENABLE_THRESHOLD_RS_ASSERTION_EVENT_FOR_LOWER_NON_RECOVERABLE_GOING_HIGH 10
+#define TMPL_CMD_GET_SENSOR_EVENT_ENABLE_THRESHOLD_RS_ASSERTION_EVENT_FOR_UPPER_NON_CRITICAL_GOING_LOW 11
+#define TMPL_CMD_GET_SENSOR_EVENT_ENABLE_THRESHOLD_RS_ASSERTION_EVENT_FOR_UPPER_NON_CRITICAL_GOING_HIGH 12
+#define TMPL_CMD_GET_SENSOR_EVENT_ENABLE_THRESHOLD_RS_ASSERTION_EVENT_FOR_UPPER_CRITICAL_GOING_LOW 13
+#define TMPL_CMD_GET_SENSOR_EVENT_ENABLE_THRESHOLD_RS_ASSERTION_EVENT_FOR_UPPER_CRITICAL_GOING_HIGH 14
+#define TMPL_CMD_GET_SENSOR_EVENT_ENABLE_THRESHOLD_RS_ASSERTION_EVENT_FOR_UPPER_NON_RECOVERABLE_GOING_LOW 15
+#define TMPL_CMD_GET_SENSOR_EVENT_ENABLE_THRESHOLD_RS_ASSERTION_EVENT_FOR_UPPER_NON_RECOVERABLE_GOING_HIGH 16
+#define TMPL_CMD_GET_SENSOR_EVENT_ENABLE_THRESHOLD_RS_RESERVED2 17
+#define TMPL_CMD_GET_SENSOR_EVENT_ENABLE_THRESHOLD_RS_DEASSERTION_EVENT_FOR_LOWER_NON_CRITICAL_GOING_LOW 18
+#define TMPL_CMD_GET_SENSOR_EVENT_ENABLE_THRESHOLD_RS_DEASSERTION_EVENT_FOR_LOWER_NON_CRITICAL_GOING_HIGH 19
+#define TMPL_CMD_GET_SENSOR_EVENT_ENABLE_THRESHOLD_RS_DEASSERTION_EVENT_FOR_LOWER_CRITICAL_GOING_LOW 20
+#define TMPL_CMD_GET_SENSOR_EVENT_ENABLE_THRESHOLD_RS_DEASSERTION_EVENT_FOR_LOWER_CRITICAL_GOING_HIGH 21
+#define TMPL_CMD_GET_SENSOR_EVENT_ENABLE_THRESHOLD_RS_DEASSERTION_EVENT_FOR_LOWER_NON_RECOVERABLE_GOING_LOW 22
+#define TMPL_CMD_GET_SENSOR_EVENT_ENABLE_THRESHOLD_RS_DEASSERTION_EVENT_FOR_LOWER_NON_RECOVERABLE_GOING_HIGH 23
+#define TMPL_CMD_GET_SENSOR_EVENT_ENABLE_THRESHOLD_RS_DEASSERTION_EVENT_FOR_UPPER_NON_CRITICAL_GOING_LOW 24
+#define TMPL_CMD_GET_SENSOR_EVENT_ENABLE_THRESHOLD_RS_DEASSERTION_EVENT_FOR_UPPER_NON_CRITICAL_GOING_HIGH 25
+#define TMPL_CMD_GET_SENSOR_EVENT_ENABLE_THRESHOLD_RS_DEASSERTION_EVENT_FOR_UPPER_CRITICAL_GOING_LOW 26
+#define TMPL_CMD_GET_SENSOR_EVENT_ENABLE_THRESHOLD_RS_DEASSERTION_EVENT_FOR_UPPER_CRITICAL_GOING_HIGH 27
+#define TMPL_CMD_GET_SENSOR_EVENT_ENABLE_THRESHOLD_RS_DEASSERTION_EVENT_FOR_UPPER_NON_RECOVERABLE_GOING_LOW 28
+#define TMPL_CMD_GET_SENSOR_EVENT_ENABLE_THRESHOLD_RS_DEASSERTION_EVENT_FOR_UPPER_NON_RECOVERABLE_GOING_HIGH 29
+#define TMPL_CMD_GET_SENSOR_EVENT_ENABLE_THRESHOLD_RS_RESERVED3 30
+
+/* tmpl_cmd_get_sensor_event_enable_discrete_rs */
+#define TMPL_CMD_GET_SENSOR_EVENT_ENABLE_DISCRETE_RS_CMD 0
+#define TMPL_CMD_GET_SENSOR_EVENT_ENABLE_DISCRETE_RS_COMP_CODE 1
+#define TMPL_CMD_GET_SENSOR_EVENT_ENABLE_DISCRETE_RS_RESERVED1 2
+#define TMPL_CMD_GET_SENSOR_EVENT_ENABLE_DISCRETE_RS_SCANNING_ON_THIS_SENSOR 3
+#define TMPL_CMD_GET_SENSOR_EVENT_ENABLE_DISCRETE_RS_ALL_EVENT_MESSAGES 4
+#define TMPL_CMD_GET_SENSOR_EVENT_ENABLE_DISCRETE_RS_ASSERTION_EVENT_MESSAGE_FOR_STATE_BIT_0 5
+#define TMPL_CMD_GET_SENSOR_EVENT_ENABLE_DISCRETE_RS_ASSERTION_EVENT_MESSAGE_FOR_STATE_BIT_1 6
+#define TMPL_CMD_GET_SENSOR_EVENT_ENABLE_DISCRETE_RS_ASSERTION_EVENT_MESSAGE_FOR_STATE_BIT_2 7
+#define TMPL_CMD_GET_SENSOR_EVENT_ENABLE_DISCRETE_RS_ASSERTION_EVENT_MESSAGE_FOR_STATE_BIT_3 8
+#define TMPL_CMD_GET_SENSOR_EVENT_ENABLE_DISCRETE_RS_ASSERTION_EVENT_MESSAGE_FOR_STATE_BIT_4 9
+#define TMPL_CMD_GET_SENSOR_EVENT_ENABLE_DISCRETE_RS_ASSERTION_EVENT_MESSAGE_FOR_STATE_BIT_5 10
+#define TMPL_CMD_GET_SENSOR_EVENT_ENABLE_DISCRETE_RS_ASSERTION_EVENT_MESSAGE_FOR_STATE_BIT_6 11
+#define TMPL_CMD_GET_SENSOR_EVENT_ENABLE_DISCRETE_RS_ASSERTION_EVENT_MESSAGE_FOR_STATE_BIT_7 12
+#define TMPL_CMD_GET_SENSOR_EVENT_ENABLE_DISCRETE_RS_ASSERTION_EVENT_MESSAGE_FOR_STATE_BIT_8 13
+#define TMPL_CMD_GET_SENSOR_EVENT_ENABLE_DISCRETE_RS_ASSERTION_EVENT_MESSAGE_FOR_STATE_BIT_9 14
+#define TMPL_CMD_GET_SENSOR_EVENT_ENABLE_DISCRETE_RS_ASSERTION_EVENT_MESSAGE_FOR_STATE_BIT_10 15
+#define TMPL_CMD_GET_SENSOR_EVENT_ENABLE_DISCRETE_RS_ASSERTION_EVENT_MESSAGE_FOR_STATE_BIT_11 16
+#define TMPL_CMD_GET_SENSOR_EVENT_ENABLE_DISCRETE_RS_ASSERTION_EVENT_MESSAGE_FOR_STATE_BIT_12 17
+#define TMPL_CMD_GET_SENSOR_EVENT_ENABLE_DISCRETE_RS_ASSERTION_EVENT_MESSAGE_FOR_STATE_BIT_13 18
+#define TMPL_CMD_GET_SENSOR_EVENT_ENABLE_DISCRETE_RS_ASSERTION_EVENT_MESSAGE_FOR_STATE_BIT_14 19
+#define TMPL_CMD_GET_SENSOR_EVENT_ENABLE_DISCRETE_RS_RESERVED2 20
+#define TMPL_CMD_GET_SENSOR_EVENT_ENABLE_DISCRETE_RS_DEASSERTION_EVENT_MESSAGE_FOR_STATE_BIT_0 21
+#define TMPL_CMD_GET_SENSOR_EVENT_ENABLE_DISCRETE_RS_DEASSERTION_EVENT_MESSAGE_FOR_STATE_BIT_1 22
+#define TMPL_CMD_GET_SENSOR_EVENT_ENABLE_DISCRETE_RS_DEASSERTION_EVENT_MESSAGE_FOR_STATE_BIT_2 23
+#define TMPL_CMD_GET_SENSOR_EVENT_ENABLE_DISCRETE_RS_DEASSERTION_EVENT_MESSAGE_FOR_STATE_BIT_3 24
+#define TMPL_CMD_GET_SENSOR_EVENT_ENABLE_DISCRETE_RS_DEASSERTION_EVENT_MESSAGE_FOR_STATE_BIT_4 25
+#define TMPL_CMD_GET_SENSOR_EVENT_ENABLE_DISCRETE_RS_DEASSERTION_EVENT_MESSAGE_FOR_STATE_BIT_5 26
+#define TMPL_CMD_GET_SENSOR_EVENT_ENABLE_DISCRETE_RS_DEASSERTION_EVENT_MESSAGE_FOR_STATE_BIT_6 27
+#define TMPL_CMD_GET_SENSOR_EVENT_ENABLE_DISCRETE_RS_DEASSERTION_EVENT_MESSAGE_FOR_STATE_BIT_7 28
+#define TMPL_CMD_GET_SENSOR_EVENT_ENABLE_DISCRETE_RS_DEASSERTION_EVENT_MESSAGE_FOR_STATE_BIT_8 29
+#define TMPL_CMD_GET_SENSOR_EVENT_ENABLE_DISCRETE_RS_DEASSERTION_EVENT_MESSAGE_FOR_STATE_BIT_9 30
+#define TMPL_CMD_GET_SENSOR_EVENT_ENABLE_DISCRETE_RS_DEASSERTION_EVENT_MESSAGE_FOR_STATE_BIT_10 31
+#define TMPL_CMD_GET_SENSOR_EVENT_ENABLE_DISCRETE_RS_DEASSERTION_EVENT_MESSAGE_FOR_STATE_BIT_11 32
+#define TMPL_CMD_GET_SENSOR_EVENT_ENABLE_DISCRETE_RS_DEASSERTION_EVENT_MESSAGE_FOR_STATE_BIT_12 33
+#define TMPL_CMD_GET_SENSOR_EVENT_ENABLE_DISCRETE_RS_DEASSERTION_EVENT_MESSAGE_FOR_STATE_BIT_13 34
+#define TMPL_CMD_GET_SENSOR_EVENT_ENABLE_DISCRETE_RS_DEASSERTION_EVENT_MESSAGE_FOR_STATE_BIT_14 35
+#define TMPL_CMD_GET_SENSOR_EVENT_ENABLE_DISCRETE_RS_RESERVED3 36
+
+/* tmpl_cmd_re_arm_sensor_events_rq */
+#define TMPL_CMD_RE_ARM_SENSOR_EVENTS_RQ_CMD 0
+#define TMPL_CMD_RE_ARM_SENSOR_EVENTS_RQ_SENSOR_NUMBER 1
+#define TMPL_CMD_RE_ARM_SENSOR_EVENTS_RQ_RESERVED 2
+#define TMPL_CMD_RE_ARM_SENSOR_EVENTS_RQ_RE_ARM_ALL_EVENT_STATUS_FROM_THIS_SENSOR 3
+#define TMPL_CMD_RE_ARM_SENSOR_EVENTS_RQ_RE_ARM_ASSERTION_EVENT 4
+#define TMPL_CMD_RE_ARM_SENSOR_EVENTS_RQ_RE_ARM_DEASSERTION_EVENT 5
+
+/* tmpl_cmd_re_arm_sensor_events_threshold_rq */
+#define TMPL_CMD_RE_ARM_SENSOR_EVENTS_THRESHOLD_RQ_CMD 0
+#define TMPL_CMD_RE_ARM_SENSOR_EVENTS_THRESHOLD_RQ_SENSOR_NUMBER 1
+#define TMPL_CMD_RE_ARM_SENSOR_EVENTS_THRESHOLD_RQ_RESERVED1 2
+#define TMPL_CMD_RE_ARM_SENSOR_EVENTS_THRESHOLD_RQ_RE_ARM_ALL_EVENT_STATUS_FROM_THIS_SENSOR 3
+#define TMPL_CMD_RE_ARM_SENSOR_EVENTS_THRESHOLD_RQ_RE_ARM_ASSERTION_EVENT_FOR_LOWER_NON_CRITICAL_GOING_LOW 4
+#define TMPL_CMD_RE_ARM_SENSOR_EVENTS_THRESHOLD_RQ_RE_ARM_ASSERTION_EVENT_FOR_LOWER_NON_CRITICAL_GOING_HIGH 5
+#define TMPL_CMD_RE_ARM_SENSOR_EVENTS_THRESHOLD_RQ_RE_ARM_ASSERTION_EVENT_FOR_LOWER_CRITICAL_GOING_LOW 6
+#define TMPL_CMD_RE_ARM_SENSOR_EVENTS_THRESHOLD_RQ_RE_ARM_ASSERTION_EVENT_FOR_LOWER_CRITICAL_GOING_HIGH 7
+#define TMPL_CMD_RE_ARM_SENSOR_EVENTS_THRESHOLD_RQ_RE_ARM_ASSERTION_EVENT_FOR_LOWER_NON_RECOVERABLE_GOING_LOW 8
+#define TMPL_CMD_RE_ARM_SENSOR_EVENTS_THRESHOLD_RQ_RE_ARM_ASSERTION_EVENT_FOR_LOWER_NON_RECOVERABLE_GOING_HIGH 9
+#define TMPL_CMD_RE_ARM_SENSOR_EVENTS_THRESHOLD_RQ_RE_ARM_ASSERTION_EVENT_FOR_UPPER_NON_CRITICAL_GOING_LOW 10
+#define TMPL_CMD_RE_ARM_SENSOR_EVENTS_THRESHOLD_RQ_RE_ARM_ASSERTION_EVENT_FOR_UPPER_NON_CRITICAL_GOING_HIGH 11
+#define TMPL_CMD_RE_ARM_SENSOR_EVENTS_THRESHOLD_RQ_RE_ARM_ASSERTION_EVENT_FOR_UPPER_CRITICAL_GOING_LOW 12
+#define TMPL_CMD_RE_ARM_SENSOR_EVENTS_THRESHOLD_RQ_RE_ARM_ASSERTION_EVENT_FOR_UPPER_CRITICAL_GOING_HIGH 13
+#define TMPL_CMD_RE_ARM_SENSOR_EVENTS_THRESHOLD_RQ_RE_ARM_ASSERTION_EVENT_FOR_UPPER_NON_RECOVERABLE_GOING_LOW 14
+#define TMPL_CMD_RE_ARM_SENSOR_EVENTS_THRESHOLD_RQ_RE_ARM_ASSERTION_EVENT_FOR_UPPER_NON_RECOVERABLE_GOING_HIGH 15
+#define TMPL_CMD_RE_ARM_SENSOR_EVENTS_THRESHOLD_RQ_RESERVED2 16
+#define TMPL_CMD_RE_ARM_SENSOR_EVENTS_THRESHOLD_RQ_RE_ARM_DEASSERTION_EVENT_FOR_LOWER_NON_CRITICAL_GOING_LOW 17
+#define TMPL_CMD_RE_ARM_SENSOR_EVENTS_THRESHOLD_RQ_RE_ARM_DEASSERTION_EVENT_FOR_LOWER_NON_CRITICAL_GOING_HIGH 18
+#define TMPL_CMD_RE_ARM_SENSOR_EVENTS_THRESHOLD_RQ_RE_ARM_DEASSERTION_EVENT_FOR_LOWER_CRITICAL_GOING_LOW 19
+#define TMPL_CMD_RE_ARM_SENSOR_EVENTS_THRESHOLD_RQ_RE_ARM_DEASSERTION_EVENT_FOR_LOWER_CRITICAL_GOING_HIGH 20
+#define TMPL_CMD_RE_ARM_SENSOR_EVENTS_THRESHOLD_RQ_RE_ARM_DEASSERTION_EVENT_FOR_LOWER_NON_RECOVERABLE_GOING_LOW 21
+#define TMPL_CMD_RE_ARM_SENSOR_EVENTS_THRESHOLD_RQ_RE_ARM_DEASSERTION_EVENT_FOR_LOWER_NON_RECOVERABLE_GOING_HIGH 22
+#define TMPL_CMD_RE_ARM_SENSOR_EVENTS_THRESHOLD_RQ_RE_ARM_DEASSERTION_EVENT_FOR_UPPER_NON_CRITICAL_GOING_LOW 23
+#define TMPL_CMD_RE_ARM_SENSOR_EVENTS_THRESHOLD_RQ_RE_ARM_DEASSERTION_EVENT_FOR_UPPER_NON_CRITICAL_GOING_HIGH 24
+#define TMPL_CMD_RE_ARM_SENSOR_EVENTS_THRESHOLD_RQ_RE_ARM_DEASSERTION_EVENT_FOR_UPPER_CRITICAL_GOING_LOW 25
+#define TMPL_CMD_RE_ARM_SENSOR_EVENTS_THRESHOLD_RQ_RE_ARM_DEASSERTION_EVENT_FOR_UPPER_CRITICAL_GOING_HIGH 26
+#define TMPL_CMD_RE_ARM_SENSOR_EVENTS_THRESHOLD_RQ_RE_ARM_DEASSERTION_EVENT_FOR_UPPER_NON_RECOVERABLE_GOING_LOW 27
+#define TMPL_CMD_RE_ARM_SENSOR_EVENTS_THRESHOLD_RQ_RE_ARM_DEASSERTION_EVENT_FOR_UPPER_NON_RECOVERABLE_GOING_HIGH 28
+#define TMPL_CMD_RE_ARM_SENSOR_EVENTS_THRESHOLD_RQ_RESERVED3 29
+
+/* tmpl_cmd_re_arm_sensor_events_discrete_rq */
+#define TMPL_CMD_RE_ARM_SENSOR_EVENTS_DISCRETE_RQ_CMD 0
+#define TMPL_CMD_RE_ARM_SENSOR_EVENTS_DISCRETE_RQ_SENSOR_NUMBER 1
+#define TMPL_CMD_RE_ARM_SENSOR_EVENTS_DISCRETE_RQ_RESERVED1 2
+#define TMPL_CMD_RE_ARM_SENSOR_EVENTS_DISCRETE_RQ_RE_ARM_ALL_EVENT_STATUS_FROM_THIS_SENSOR 3
+#define TMPL_CMD_RE_ARM_SENSOR_EVENTS_DISCRETE_RQ_RE_ARM_ASSERTION_EVENT_FOR_STATE_BIT_0 4
+#define TMPL_CMD_RE_ARM_SENSOR_EVENTS_DISCRETE_RQ_RE_ARM_ASSERTION_EVENT_FOR_STATE_BIT_1 5
+#define TMPL_CMD_RE_ARM_SENSOR_EVENTS_DISCRETE_RQ_RE_ARM_ASSERTION_EVENT_FOR_STATE_BIT_2 6
+#define TMPL_CMD_RE_ARM_SENSOR_EVENTS_DISCRETE_RQ_RE_ARM_ASSERTION_EVENT_FOR_STATE_BIT_3 7
+#define TMPL_CMD_RE_ARM_SENSOR_EVENTS_DISCRETE_RQ_RE_ARM_ASSERTION_EVENT_FOR_STATE_BIT_4 8
+#define TMPL_CMD_RE_ARM_SENSOR_EVENTS_DISCRETE_RQ_RE_ARM_ASSERTION_EVENT_FOR_STATE_BIT_5 9
+#define TMPL_CMD_RE_ARM_SENSOR_EVENTS_DISCRETE_RQ_RE_ARM_ASSERTION_EVENT_FOR_STATE_BIT_6 10
+#define TMPL_CMD_RE_ARM_SENSOR_EVENTS_DISCRETE_RQ_RE_ARM_ASSERTION_EVENT_FOR_STATE_BIT_7 11
+#define TMPL_CMD_RE_ARM_SENSOR_EVENTS_DISCRETE_RQ_RE_ARM_ASSERTION_EVENT_FOR_STATE_BIT_8 12
+#define TMPL_CMD_RE_ARM_SENSOR_EVENTS_DISCRETE_RQ_RE_ARM_ASSERTION_EVENT_FOR_STATE_BIT_9 13
+#define TMPL_CMD_RE_ARM_SENSOR_EVENTS_DISCRETE_RQ_RE_ARM_ASSERTION_EVENT_FOR_STATE_BIT_10 14
+#define TMPL_CMD_RE_ARM_SENSOR_EVENTS_DISCRETE_RQ_RE_ARM_ASSERTION_EVENT_FOR_STATE_BIT_11 15
+#define TMPL_CMD_RE_ARM_SENSOR_EVENTS_DISCRETE_RQ_RE_ARM_ASSERTION_EVENT_FOR_STATE_BIT_12 16
+#define TMPL_CMD_RE_ARM_SENSOR_EVENTS_DISCRETE_RQ_RE_ARM_ASSERTION_EVENT_FOR_STATE_BIT_13 17
+#define TMPL_CMD_RE_ARM_SENSOR_EVENTS_DISCRETE_RQ_RE_ARM_ASSERTION_EVENT_FOR_STATE_BIT_14 18
+#define TMPL_CMD_RE_ARM_SENSOR_EVENTS_DISCRETE_RQ_RESERVED2 19
+#define TMPL_CMD_RE_ARM_SENSOR_EVENTS_DISCRETE_RQ_RE_ARM_DEASSERTION_EVENT_FOR_STATE_BIT_0 20
+#define TMPL_CMD_RE_ARM_SENSOR_EVENTS_DISCRETE_RQ_RE_ARM_DEASSERTION_EVENT_FOR_STATE_BIT_1 21
+#define TMPL_CMD_RE_ARM_SENSOR_EVENTS_DISCRETE_RQ_RE_ARM_DEASSERTION_EVENT_FOR_STATE_BIT_2 22
+#define TMPL_CMD_RE_ARM_SENSOR_EVENTS_DISCRETE_RQ_RE_ARM_DEASSERTION_EVENT_FOR_STATE_BIT_3 23
+#define TMPL_CMD_RE_ARM_SENSOR_EVENTS_DISCRETE_RQ_RE_ARM_DEASSERTION_EVENT_FOR_STATE_BIT_4 24
+#define TMPL_CMD_RE_ARM_SENSOR_EVENTS_DISCRETE_RQ_RE_ARM_DEASSERTION_EVENT_FOR_STATE_BIT_5 25
+#define TMPL_CMD_RE_ARM_SENSOR_EVENTS_DISCRETE_RQ_RE_ARM_DEASSERTION_EVENT_FOR_STATE_BIT_6 26
+#define TMPL_CMD_RE_ARM_SENSOR_EVENTS_DISCRETE_RQ_RE_ARM_DEASSERTION_EVENT_FOR_STATE_BIT_7 27
+#define TMPL_CMD_RE_ARM_SENSOR_EVENTS_DISCRETE_RQ_RE_ARM_DEASSERTION_EVENT_FOR_STATE_BIT_8 28
+#define TMPL_CMD_RE_ARM_SENSOR_EVENTS_DISCRETE_RQ_RE_ARM_DEASSERTION_EVENT_FOR_STATE_BIT_9 29
+#define TMPL_CMD_RE_ARM_SENSOR_EVENTS_DISCRETE_RQ_RE_ARM_DEASSERTION_EVENT_FOR_STATE_BIT_10 30
+#define TMPL_CMD_RE_ARM_SENSOR_EVENTS_DISCRETE_RQ_RE_ARM_DEASSERTION_EVENT_FOR_STATE_BIT_11 31
+#define TMPL_CMD_RE_ARM_SENSOR_EVENTS_DISCRETE_RQ_RE_ARM_DEASSERTION_EVENT_FOR_STATE_BIT_12 32
+#define TMPL_CMD_RE_ARM_SENSOR_EVENTS_DISCRETE_RQ_RE_ARM_DEASSERTION_EVENT_FOR_STATE_BIT_13 33
+#define TMPL_CMD_RE_ARM_SENSOR_EVENTS_DISCRETE_RQ_RE_ARM_DEASSERTION_EVENT_FOR_STATE_BIT_14 34
+#define TMPL_CMD_RE_ARM_SENSOR_EVENTS_DISCRETE_RQ_RESERVED3 35
+
+/* tmpl_cmd_re_arm_sensor_events_rs */
+#define TMPL_CMD_RE_ARM_SENSOR_EVENTS_RS_CMD 0
+#define TMPL_CMD_RE_ARM_SENSOR_EVENTS_RS_COMP_CODE 1
+
+/* tmpl_cmd_get_sensor_event_status_rq */
+#define TMPL_CMD_GET_SENSOR_EVENT_STATUS_RQ_CMD 0
+#define TMPL_CMD_GET_SENSOR_EVENT_STATUS_RQ_SENSOR_NUMBER 1
+
+/* tmpl_cmd_get_sensor_event_status_rs */
+#define TMPL_CMD_GET_SENSOR_EVENT_STATUS_RS_CMD 0
+#define TMPL_CMD_GET_SENSOR_EVENT_STATUS_RS_COMP_CODE 1
+#define TMPL_CMD_GET_SENSOR_EVENT_STATUS_RS_RESERVED1 2
+#define TMPL_CMD_GET_SENSOR_EVENT_STATUS_RS_READING_STATE 3
+#define TMPL_CMD_GET_SENSOR_EVENT_STATUS_RS_SENSOR_SCANNING 4
+#define TMPL_CMD_GET_SENSOR_EVENT_STATUS_RS_ALL_EVENT_MESSAGES 5
+#define TMPL_CMD_GET_SENSOR_EVENT_STATUS_RS_ASSERTION_EVENT 6
+#define TMPL_CMD_GET_SENSOR_EVENT_STATUS_RS_DEASSERTION_EVENT 7
+
+/* tmpl_cmd_get_sensor_event_status_threshold_rs */
+#define TMPL_CMD_GET_SENSOR_EVENT_STATUS_THRESHOLD_RS_CMD 0
+#define TMPL_CMD_GET_SENSOR_EVENT_STATUS_THRESHOLD_RS_COMP_CODE 1
+#define TMPL_CMD_GET_SENSOR_EVENT_STATUS_THRESHOLD_RS_RESERVED1 2
+#define TMPL_CMD_GET_SENSOR_EVENT_STATUS_THRESHOLD_RS_READING_STATE 3
+#define TMPL_CMD_GET_SENSOR_EVENT_STATUS_THRESHOLD_RS_SENSOR_SCANNING 4
+#define TMPL_CMD_GET_SENSOR_EVENT_STATUS_THRESHOLD_RS_ALL_EVENT_MESSAGES 5
+#define TMPL_CMD_GET_SENSOR_EVENT_STATUS_THRESHOLD_RS_ASSERTION_EVENT_CONDITION_FOR_LOWER_NON_CRITICAL_GOING_LOW 6
+#define TMPL_CMD_GET_SENSOR_EVENT_STATUS_THRESHOLD_RS_ASSERTION_EVENT_CONDITION_FOR_LOWER_NON_CRITICAL_GOING_HIGH 7
+#define TMPL_CMD_GET_SENSOR_EVENT_STATUS_THRESHOLD_RS_ASSERTION_EVENT_CONDITION_FOR_LOWER_CRITICAL_GOING_LOW 8
+#define TMPL_CMD_GET_SENSOR_EVENT_STATUS_THRESHOLD_RS_ASSERTION_EVENT_CONDITION_FOR_LOWER_CRITICAL_GOING_HIGH 9
+#define TMPL_CMD_GET_SENSOR_EVENT_STATUS_THRESHOLD_RS_ASSERTION_EVENT_CONDITION_FOR_LOWER_NON_RECOVERABLE_GOING_LOW 10
+#define TMPL_CMD_GET_SENSOR_EVENT_STATUS_THRESHOLD_RS_ASSERTION_EVENT_CONDITION_FOR_LOWER_NON_RECOVERABLE_GOING_HIGH 11
+#define TMPL_CMD_GET_SENSOR_EVENT_STATUS_THRESHOLD_RS_ASSERTION_EVENT_CONDITION_FOR_UPPER_NON_CRITICAL_GOING_LOW 12
+#define TMPL_CMD_GET_SENSOR_EVENT_STATUS_THRESHOLD_RS_ASSERTION_EVENT_CONDITION_FOR_UPPER_NON_CRITICAL_GOING_HIGH 13
+#define TMPL_CMD_GET_SENSOR_EVENT_STATUS_THRESHOLD_RS_ASSERTION_EVENT_CONDITION_FOR_UPPER_CRITICAL_GOING_LOW 14
+#define TMPL_CMD_GET_SENSOR_EVENT_STATUS_THRESHOLD_RS_ASSERTION_EVENT_CONDITION_FOR_UPPER_CRITICAL_GOING_HIGH 15
+#define TMPL_CMD_GET_SENSOR_EVENT_STATUS_THRESHOLD_RS_ASSERTION_EVENT_CONDITION_FOR_UPPER_NON_RECOVERABLE_GOING_LOW 16
+#define TMPL_CMD_GET_SENSOR_EVENT_STATUS_THRESHOLD_RS_ASSERTION_EVENT_CONDITION_FOR_UPPER_NON_RECOVERABLE_GOING_HIGH 17
+#define TMPL_CMD_GET_SENSOR_EVENT_STATUS_THRESHOLD_RS_RESERVED2 18
+#define TMPL_CMD_GET_SENSOR_EVENT_STATUS_THRESHOLD_RS_DEASSERTION_EVENT_CONDITION_FOR_LOWER_NON_CRITICAL_GOING_LOW 19
+#define TMPL_CMD_GET_SENSOR_EVENT_STATUS_THRESHOLD_RS_DEASSERTION_EVENT_CONDITION_FOR_LOWER_NON_CRITICAL_GOING_HIGH 20
+#define TMPL_CMD_GET_SENSOR_EVENT_STATUS_THRESHOLD_RS_DEASSERTION_EVENT_CONDITION_FOR_LOWER_CRITICAL_GOING_LOW 21
+#define TMPL_CMD_GET_SENSOR_EVENT_STATUS_THRESHOLD_RS_DEASSERTION_EVENT_CONDITION_FOR_LOWER_CRITICAL_GOING_HIGH 22
+#define TMPL_CMD_GET_SENSOR_EVENT_STATUS_THRESHOLD_RS_DEASSERTION_EVENT_CONDITION_FOR_LOWER_NON_RECOVERABLE_GOING_LOW 23
+#define TMPL_CMD_GET_SENSOR_EVENT_STATUS_THRESHOLD_RS_DEASSERTION_EVENT_CONDITION_FOR_LOWER_NON_RECOVERABLE_GOING_HIGH 24
+#define TMPL_CMD_GET_SENSOR_EVENT_STATUS_THRESHOLD_RS_DEASSERTION_EVENT_CONDITION_FOR_UPPER_NON_CRITICAL_GOING_LOW 25
+#define TMPL_CMD_GET_SENSOR_EVENT_STATUS_THRESHOLD_RS_DEASSERTION_EVENT_CONDITION_FOR_UPPER_NON_CRITICAL_GOING_HIGH 26
+#define TMPL_CMD_GET_SENSOR_EVENT_STATUS_THRESHOLD_RS_DEASSERTION_EVENT_CONDITION_FOR_UPPER_CRITICAL_GOING_LOW 27
+#define TMPL_CMD_GET_SENSOR_EVENT_STATUS_THRESHOLD_RS_DEASSERTION_EVENT_CONDITION_FOR_UPPER_CRITICAL_GOING_HIGH 28
+#define TMPL_CMD_GET_SENSOR_EVENT_STATUS_THRESHOLD_RS_DEASSERTION_EVENT_CONDITION_FOR_UPPER_NON_RECOVERABLE_GOING_LOW 29
+#define TMPL_CMD_GET_SENSOR_EVENT_STATUS_THRESHOLD_RS_DEASSERTION_EVENT_CONDITION_FOR_UPPER_NON_RECOVERABLE_GOING_HIGH 30
+#define TMPL_CMD_GET_SENSOR_EVENT_STATUS_THRESHOLD_RS_RESERVED3 31
+
+/* tmpl_cmd_get_sensor_event_status_discrete_rs */
+#define TMPL_CMD_GET_SENSOR_EVENT_STATUS_DISCRETE_RS_CMD 0
+#define TMPL_CMD_GET_SENSOR_EVENT_STATUS_DISCRETE_RS_COMP_CODE 1
+#define TMPL_CMD_GET_SENSOR_EVENT_STATUS_DISCRETE_RS_RESERVED1 2
+#define TMPL_CMD_GET_SENSOR_EVENT_STATUS_DISCRETE_RS_READING_STATE 3
+#define TMPL_CMD_GET_SENSOR_EVENT_STATUS_DISCRETE_RS_SENSOR_SCANNING 4
+#define TMPL_CMD_GET_SENSOR_EVENT_STATUS_DISCRETE_RS_ALL_EVENT_MESSAGES 5
+#define TMPL_CMD_GET_SENSOR_EVENT_STATUS_DISCRETE_RS_STATE_0_ASSERTION_EVENT 6
+#define TMPL_CMD_GET_SENSOR_EVENT_STATUS_DISCRETE_RS_STATE_1_ASSERTION_EVENT 7
+#define TMPL_CMD_GET_SENSOR_EVENT_STATUS_DISCRETE_RS_STATE_2_ASSERTION_EVENT 8
+#define TMPL_CMD_GET_SENSOR_EVENT_STATUS_DISCRETE_RS_STATE_3_ASSERTION_EVENT 9
+#define TMPL_CMD_GET_SENSOR_EVENT_STATUS_DISCRETE_RS_STATE_4_ASSERTION_EVENT 10
+#define TMPL_CMD_GET_SENSOR_EVENT_STATUS_DISCRETE_RS_STATE_5_ASSERTION_EVENT 11
+#define TMPL_CMD_GET_SENSOR_EVENT_STATUS_DISCRETE_RS_STATE_6_ASSERTION_EVENT 12
+#define TMPL_CMD_GET_SENSOR_EVENT_STATUS_DISCRETE_RS_STATE_7_ASSERTION_EVENT 13
+#define TMPL_CMD_GET_SENSOR_EVENT_STATUS_DISCRETE_RS_STATE_8_ASSERTION_EVENT 14
+#define TMPL_CMD_GET_SENSOR_EVENT_STATUS_DISCRETE_RS_STATE_9_ASSERTION_EVENT 15
+#define TMPL_CMD_GET_SENSOR_EVENT_STATUS_DISCRETE_RS_STATE_10_ASSERTION_EVENT 16
+#define TMPL_CMD_GET_SENSOR_EVENT_STATUS_DISCRETE_RS_STATE_11_ASSERTION_EVENT 17
+#define TMPL_CMD_GET_SENSOR_EVENT_STATUS_DISCRETE_RS_STATE_12_ASSERTION_EVENT 18
+#define TMPL_CMD_GET_SENSOR_EVENT_STATUS_DISCRETE_RS_STATE_13_ASSERTION_EVENT 19
+#define TMPL_CMD_GET_SENSOR_EVENT_STATUS_DISCRETE_RS_STATE_14_ASSERTION_EVENT 20
+#define TMPL_CMD_GET_SENSOR_EVENT_STATUS_DISCRETE_RS_RESERVED2 21
+#define TMPL_CMD_GET_SENSOR_EVENT_STATUS_DISCRETE_RS_STATE_0_DEASSERTION_EVENT 22
+#define TMPL_CMD_GET_SENSOR_EVENT_STATUS_DISCRETE_RS_STATE_1_DEASSERTION_EVENT 23
+#define TMPL_CMD_GET_SENSOR_EVENT_STATUS_DISCRETE_RS_STATE_2_DEASSERTION_EVENT 24
+#define TMPL_CMD_GET_SENSOR_EVENT_STATUS_DISCRETE_RS_STATE_3_DEASSERTION_EVENT 25
+#define TMPL_CMD_GET_SENSOR_EVENT_STATUS_DISCRETE_RS_STATE_4_DEASSERTION_EVENT 26
+#define TMPL_CMD_GET_SENSOR_EVENT_STATUS_DISCRETE_RS_STATE_5_DEASSERTION_EVENT 27
+#define TMPL_CMD_GET_SENSOR_EVENT_STATUS_DISCRETE_RS_STATE_6_DEASSERTION_EVENT 28
+#define TMPL_CMD_GET_SENSOR_EVENT_STATUS_DISCRETE_RS_STATE_7_DEASSERTION_EVENT 29
+#define TMPL_CMD_GET_SENSOR_EVENT_STATUS_DISCRETE_RS_STATE_8_DEASSERTION_EVENT 30
+#define TMPL_CMD_GET_SENSOR_EVENT_STATUS_DISCRETE_RS_STATE_9_DEASSERTION_EVENT 31
+#define TMPL_CMD_GET_SENSOR_EVENT_STATUS_DISCRETE_RS_STATE_10_DEASSERTION_EVENT 32
+#define TMPL_CMD_GET_SENSOR_EVENT_STATUS_DISCRETE_RS_STATE_11_DEASSERTION_EVENT 33
+#define TMPL_CMD_GET_SENSOR_EVENT_STATUS_DISCRETE_RS_STATE_12_DEASSERTION_EVENT 34
+#define TMPL_CMD_GET_SENSOR_EVENT_STATUS_DISCRETE_RS_STATE_13_DEASSERTION_EVENT 35
+#define TMPL_CMD_GET_SENSOR_EVENT_STATUS_DISCRETE_RS_STATE_14_DEASSERTION_EVENT 36
+#define TMPL_CMD_GET_SENSOR_EVENT_STATUS_DISCRETE_RS_RESERVED3 37
+
+/* tmpl_cmd_get_sensor_reading_rq */
+#define TMPL_CMD_GET_SENSOR_READING_RQ_CMD 0
+#define TMPL_CMD_GET_SENSOR_READING_RQ_SENSOR_NUMBER 1
+
+/* tmpl_cmd_get_sensor_reading_rs */
+#define TMPL_CMD_GET_SENSOR_READING_RS_CMD 0
+#define TMPL_CMD_GET_SENSOR_READING_RS_COMP_CODE 1
+#define TMPL_CMD_GET_SENSOR_READING_RS_SENSOR_READING 2
+#define TMPL_CMD_GET_SENSOR_READING_RS_RESERVED1 3
+#define TMPL_CMD_GET_SENSOR_READING_RS_READING_STATE 4
+#define TMPL_CMD_GET_SENSOR_READING_RS_SENSOR_SCANNING 5
+#define TMPL_CMD_GET_SENSOR_READING_RS_ALL_EVENT_MESSAGES 6
+#define TMPL_CMD_GET_SENSOR_READING_RS_SENSOR_EVENT_BITMASK1 7
+#define TMPL_CMD_GET_SENSOR_READING_RS_SENSOR_EVENT_BITMASK2 8
+#define TMPL_CMD_GET_SENSOR_READING_RS_RESERVED2 9
+
+/* tmpl_cmd_get_sensor_reading_threshold_rs */
+#define TMPL_CMD_GET_SENSOR_READING_THRESHOLD_RS_CMD 0
+#define TMPL_CMD_GET_SENSOR_READING_THRESHOLD_RS_COMP_CODE 1
+#define TMPL_CMD_GET_SENSOR_READING_THRESHOLD_RS_SENSOR_READING 2
+#define TMPL_CMD_GET_SENSOR_READING_THRESHOLD_RS_RESERVED1 3
+#define TMPL_CMD_GET_SENSOR_READING_THRESHOLD_RS_READING_STATE 4
+#define TMPL_CMD_GET_SENSOR_READING_THRESHOLD_RS_SENSOR_SCANNING 5
+#define TMPL_CMD_GET_SENSOR_READING_THRESHOLD_RS_ALL_EVENT_MESSAGES 6
+#define TMPL_CMD_GET_SENSOR_READING_THRESHOLD_RS_AT_OR_BELOW_LOWER_NON_CRITICAL_THRESHOLD 7
+#define TMPL_CMD_GET_SENSOR_READING_THRESHOLD_RS_AT_OR_BELOW_LOWER_CRITICAL_THRESHOLD 8
+#define TMPL_CMD_GET_SENSOR_READING_THRESHOLD_RS_AT_OR_BELOW_LOWER_NON_RECOVERABLE_THRESHOLD 9
+#define TMPL_CMD_GET_SENSOR_READING_THRESHOLD_RS_AT_OR_ABOVE_UPPER_NON_CRITICAL_THRESHOLD 10
+#define TMPL_CMD_GET_SENSOR_READING_THRESHOLD_RS_AT_OR_ABOVE_UPPER_CRITICAL_THRESHOLD 11
+#define TMPL_CMD_GET_SENSOR_READING_THRESHOLD_RS_AT_OR_ABOVE_UPPER_NON_RECOVERABLE_THRESHOLD 12
+#define TMPL_CMD_GET_SENSOR_READING_THRESHOLD_RS_RESERVED2 13
+#define TMPL_CMD_GET_SENSOR_READING_THRESHOLD_RS_RESERVED3 14
+
+/* tmpl_cmd_get_sensor_reading_discrete_rs */
+#define TMPL_CMD_GET_SENSOR_READING_DISCRETE_RS_CMD 0
+#define TMPL_CMD_GET_SENSOR_READING_DISCRETE_RS_COMP_CODE 1
+#define TMPL_CMD_GET_SENSOR_READING_DISCRETE_RS_SENSOR_READING 2
+#define TMPL_CMD_GET_SENSOR_READING_DISCRETE_RS_RESERVED1 3
+#define TMPL_CMD_GET_SENSOR_READING_DISCRETE_RS_READING_STATE 4
+#define TMPL_CMD_GET_SENSOR_READING_DISCRETE_RS_SENSOR_SCANNING 5
+#define TMPL_CMD_GET_SENSOR_READING_DISCRETE_RS_ALL_EVENT_MESSAGES 6
+#define TMPL_CMD_GET_SENSOR_READING_DISCRETE_RS_STATE_0_ASSERTED 7
+#define TMPL_CMD_GET_SENSOR_READING_DISCRETE_RS_STATE_1_ASSERTED 8
+#define TMPL_CMD_GET_SENSOR_READING_DISCRETE_RS_STATE_2_ASSERTED 9
+#define TMPL_CMD_GET_SENSOR_READING_DISCRETE_RS_STATE_3_ASSERTED 10
+#define TMPL_CMD_GET_SENSOR_READING_DISCRETE_RS_STATE_4_ASSERTED 11
+#define TMPL_CMD_GET_SENSOR_READING_DISCRETE_RS_STATE_5_ASSERTED 12
+#define TMPL_CMD_GET_SENSOR_READING_DISCRETE_RS_STATE_6_ASSERTED 13
+#define TMPL_CMD_GET_SENSOR_READING_DISCRETE_RS_STATE_7_ASSERTED 14
+#define TMPL_CMD_GET_SENSOR_READING_DISCRETE_RS_STATE_8_ASSERTED 15
+#define TMPL_CMD_GET_SENSOR_READING_DISCRETE_RS_STATE_9_ASSERTED 16
+#define TMPL_CMD_GET_SENSOR_READING_DISCRETE_RS_STATE_10_ASSERTED 17
+#define TMPL_CMD_GET_SENSOR_READING_DISCRETE_RS_STATE_11_ASSERTED 18
+#define TMPL_CMD_GET_SENSOR_READING_DISCRETE_RS_STATE_12_ASSERTED 19
+#define TMPL_CMD_GET_SENSOR_READING_DISCRETE_RS_STATE_13_ASSERTED 20
+#define TMPL_CMD_GET_SENSOR_READING_DISCRETE_RS_STATE_14_ASSERTED 21
+#define TMPL_CMD_GET_SENSOR_READING_DISCRETE_RS_RESERVED2 22
+
+/* tmpl_cmd_set_sensor_type_rq */
+#define TMPL_CMD_SET_SENSOR_TYPE_RQ_CMD 0
+#define TMPL_CMD_SET_SENSOR_TYPE_RQ_SENSOR_NUMBER 1
+#define TMPL_CMD_SET_SENSOR_TYPE_RQ_SENSOR_TYPE 2
+#define TMPL_CMD_SET_SENSOR_TYPE_RQ_EVENT_READING_TYPE_CODE 3
+#define TMPL_CMD_SET_SENSOR_TYPE_RQ_RESERVED 4
+
+/* tmpl_cmd_set_sensor_type_rs */
+#define TMPL_CMD_SET_SENSOR_TYPE_RS_CMD 0
+#define TMPL_CMD_SET_SENSOR_TYPE_RS_COMP_CODE 1
+
+/* tmpl_cmd_get_sensor_type_rq */
+#define TMPL_CMD_GET_SENSOR_TYPE_RQ_CMD 0
+#define TMPL_CMD_GET_SENSOR_TYPE_RQ_SENSOR_NUMBER 1
+
+/* tmpl_cmd_get_sensor_type_rs */
+#define TMPL_CMD_GET_SENSOR_TYPE_RS_CMD 0
+#define TMPL_CMD_GET_SENSOR_TYPE_RS_COMP_CODE 1
+#define TMPL_CMD_GET_SENSOR_TYPE_RS_SENSOR_TYPE 2
+#define TMPL_CMD_GET_SENSOR_TYPE_RS_EVENT_READING_TYPE_CODE 3
+#define TMPL_CMD_GET_SENSOR_TYPE_RS_RESERVED 4
+
+/* tmpl_cmd_set_sensor_reading_and_event_status_rq */
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_RQ_CMD 0
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_RQ_SENSOR_NUMBER 1
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_RQ_SENSOR_READING_OPERATION 2
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_RQ_DEASSERTION_BITS_OPERATION 3
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_RQ_ASSERTION_BITS_OPERATION 4
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_RQ_EVENT_DATA_BYTES_OPERATION 5
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_RQ_SENSOR_READING 6
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_RQ_ASSERTION_EVENT_BITMASK1 7
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_RQ_ASSERTION_EVENT_BITMASK2 8
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_RQ_DEASSERTION_EVENT_BITMASK1 9
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_RQ_DEASSERTION_EVENT_BITMASK2 10
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_RQ_EVENT_DATA1 11
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_RQ_EVENT_DATA2 12
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_RQ_EVENT_DATA3 13
+
+/* tmpl_cmd_set_sensor_reading_and_event_status_threshold_rq */
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_THRESHOLD_RQ_CMD 0
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_THRESHOLD_RQ_SENSOR_NUMBER 1
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_THRESHOLD_RQ_SENSOR_READING_OPERATION 2
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_THRESHOLD_RQ_DEASSERTION_BITS_OPERATION 3
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_THRESHOLD_RQ_ASSERTION_BITS_OPERATION 4
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_THRESHOLD_RQ_EVENT_DATA_BYTES_OPERATION 5
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_THRESHOLD_RQ_SENSOR_READING 6
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_THRESHOLD_RQ_ASSERTION_EVENT_LOWER_NON_CRITICAL_GOING_LOW_OCCURRED 7
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_THRESHOLD_RQ_ASSERTION_EVENT_LOWER_NON_CRITICAL_GOING_HIGH_OCCURRED 8
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_THRESHOLD_RQ_ASSERTION_EVENT_LOWER_CRITICAL_GOING_LOW_OCCURRED 9
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_THRESHOLD_RQ_ASSERTION_EVENT_LOWER_CRITICAL_GOING_HIGH_OCCURRED 10
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_THRESHOLD_RQ_ASSERTION_EVENT_LOWER_NON_RECOVERABLE_GOING_LOW_OCCURRED 11
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_THRESHOLD_RQ_ASSERTION_EVENT_LOWER_NON_RECOVERABLE_GOING_HIGH_OCCURRED 12
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_THRESHOLD_RQ_ASSERTION_EVENT_UPPER_NON_CRITICAL_GOING_LOW_OCCURRED 13
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_THRESHOLD_RQ_ASSERTION_EVENT_UPPER_NON_CRITICAL_GOING_HIGH_OCCURRED 14
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_THRESHOLD_RQ_ASSERTION_EVENT_UPPER_CRITICAL_GOING_LOW_OCCURRED 15
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_THRESHOLD_RQ_ASSERTION_EVENT_UPPER_CRITICAL_GOING_HIGH_OCCURRED 16
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_THRESHOLD_RQ_ASSERTION_EVENT_UPPER_NON_RECOVERABLE_GOING_LOW_OCCURRED 17
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_THRESHOLD_RQ_ASSERTION_EVENT_UPPER_NON_RECOVERABLE_GOING_HIGH_OCCURRED 18
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_THRESHOLD_RQ_RESERVED1 19
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_THRESHOLD_RQ_DEASSERTION_EVENT_LOWER_NON_CRITICAL_GOING_LOW_OCCURRED 20
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_THRESHOLD_RQ_DEASSERTION_EVENT_LOWER_NON_CRITICAL_GOING_HIGH_OCCURRED 21
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_THRESHOLD_RQ_DEASSERTION_EVENT_LOWER_CRITICAL_GOING_LOW_OCCURRED 22
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_THRESHOLD_RQ_DEASSERTION_EVENT_LOWER_CRITICAL_GOING_HIGH_OCCURRED 23
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_THRESHOLD_RQ_DEASSERTION_EVENT_LOWER_NON_RECOVERABLE_GOING_LOW_OCCURRED 24
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_THRESHOLD_RQ_DEASSERTION_EVENT_LOWER_NON_RECOVERABLE_GOING_HIGH_OCCURRED 25
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_THRESHOLD_RQ_DEASSERTION_EVENT_UPPER_NON_CRITICAL_GOING_LOW_OCCURRED 26
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_THRESHOLD_RQ_DEASSERTION_EVENT_UPPER_NON_CRITICAL_GOING_HIGH_OCCURRED 27
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_THRESHOLD_RQ_DEASSERTION_EVENT_UPPER_CRITICAL_GOING_LOW_OCCURRED 28
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_THRESHOLD_RQ_DEASSERTION_EVENT_UPPER_CRITICAL_GOING_HIGH_OCCURRED 29
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_THRESHOLD_RQ_DEASSERTION_EVENT_UPPER_NON_RECOVERABLE_GOING_LOW_OCCURRED 30
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_THRESHOLD_RQ_DEASSERTION_EVENT_UPPER_NON_RECOVERABLE_GOING_HIGH_OCCURRED 31
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_THRESHOLD_RQ_RESERVED2 32
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_THRESHOLD_RQ_EVENT_DATA1 33
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_THRESHOLD_RQ_EVENT_DATA2 34
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_THRESHOLD_RQ_EVENT_DATA3 35
+
+/* tmpl_cmd_set_sensor_reading_and_event_status_discrete_rq */
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_DISCRETE_RQ_CMD 0
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_DISCRETE_RQ_SENSOR_NUMBER 1
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_DISCRETE_RQ_SENSOR_READING_OPERATION 2
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_DISCRETE_RQ_DEASSERTION_BITS_OPERATION 3
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_DISCRETE_RQ_ASSERTION_BITS_OPERATION 4
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_DISCRETE_RQ_EVENT_DATA_BYTES_OPERATION 5
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_DISCRETE_RQ_SENSOR_READING 6
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_DISCRETE_RQ_STATE_0_ASSERTION_EVENT_OCCURRED 7
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_DISCRETE_RQ_STATE_1_ASSERTION_EVENT_OCCURRED 8
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_DISCRETE_RQ_STATE_2_ASSERTION_EVENT_OCCURRED 9
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_DISCRETE_RQ_STATE_3_ASSERTION_EVENT_OCCURRED 10
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_DISCRETE_RQ_STATE_4_ASSERTION_EVENT_OCCURRED 11
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_DISCRETE_RQ_STATE_5_ASSERTION_EVENT_OCCURRED 12
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_DISCRETE_RQ_STATE_6_ASSERTION_EVENT_OCCURRED 13
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_DISCRETE_RQ_STATE_7_ASSERTION_EVENT_OCCURRED 14
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_DISCRETE_RQ_STATE_8_ASSERTION_EVENT_OCCURRED 15
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_DISCRETE_RQ_STATE_9_ASSERTION_EVENT_OCCURRED 16
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_DISCRETE_RQ_STATE_10_ASSERTION_EVENT_OCCURRED 17
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_DISCRETE_RQ_STATE_11_ASSERTION_EVENT_OCCURRED 18
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_DISCRETE_RQ_STATE_12_ASSERTION_EVENT_OCCURRED 19
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_DISCRETE_RQ_STATE_13_ASSERTION_EVENT_OCCURRED 20
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_DISCRETE_RQ_STATE_14_ASSERTION_EVENT_OCCURRED 21
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_DISCRETE_RQ_RESERVED1 22
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_DISCRETE_RQ_STATE_0_DEASSERTION_EVENT_OCCURRED 23
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_DISCRETE_RQ_STATE_1_DEASSERTION_EVENT_OCCURRED 24
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_DISCRETE_RQ_STATE_2_DEASSERTION_EVENT_OCCURRED 25
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_DISCRETE_RQ_STATE_3_DEASSERTION_EVENT_OCCURRED 26
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_DISCRETE_RQ_STATE_4_DEASSERTION_EVENT_OCCURRED 27
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_DISCRETE_RQ_STATE_5_DEASSERTION_EVENT_OCCURRED 28
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_DISCRETE_RQ_STATE_6_DEASSERTION_EVENT_OCCURRED 29
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_DISCRETE_RQ_STATE_7_DEASSERTION_EVENT_OCCURRED 30
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_DISCRETE_RQ_STATE_8_DEASSERTION_EVENT_OCCURRED 31
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_DISCRETE_RQ_STATE_9_DEASSERTION_EVENT_OCCURRED 32
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_DISCRETE_RQ_STATE_10_DEASSERTION_EVENT_OCCURRED 33
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_DISCRETE_RQ_STATE_11_DEASSERTION_EVENT_OCCURRED 34
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_DISCRETE_RQ_STATE_12_DEASSERTION_EVENT_OCCURRED 35
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_DISCRETE_RQ_STATE_13_DEASSERTION_EVENT_OCCURRED 36
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_DISCRETE_RQ_STATE_14_DEASSERTION_EVENT_OCCURRED 37
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_DISCRETE_RQ_EVENT_DATA1 39
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_DISCRETE_RQ_EVENT_DATA2 40
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_DISCRETE_RQ_EVENT_DATA3 41
+
+/* tmpl_cmd_set_sensor_reading_and_event_status_event_fields_rq */
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_EVENT_FIELDS_RQ_CMD 0
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_EVENT_FIELDS_RQ_SENSOR_NUMBER 1
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_EVENT_FIELDS_RQ_SENSOR_READING_OPERATION 2
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_EVENT_FIELDS_RQ_DEASSERTION_BITS_OPERATION 3
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_EVENT_FIELDS_RQ_ASSERTION_BITS_OPERATION 4
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_EVENT_FIELDS_RQ_EVENT_DATA_BYTES_OPERATION 5
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_EVENT_FIELDS_RQ_SENSOR_READING 6
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_EVENT_FIELDS_RQ_ASSERTION_EVENT_BITMASK1 7
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_EVENT_FIELDS_RQ_ASSERTION_EVENT_BITMASK2 8
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_EVENT_FIELDS_RQ_DEASSERTION_EVENT_BITMASK1 9
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_EVENT_FIELDS_RQ_DEASSERTION_EVENT_BITMASK2 10
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_EVENT_FIELDS_RQ_OFFSET_FROM_EVENT_READING_TYPE_CODE 11
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_EVENT_FIELDS_RQ_EVENT_DATA3_FLAG 12
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_EVENT_FIELDS_RQ_EVENT_DATA2_FLAG 13
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_EVENT_FIELDS_RQ_EVENT_DATA2 14
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_EVENT_FIELDS_RQ_EVENT_DATA3 15
+
+/* tmpl_cmd_set_sensor_reading_and_event_status_threshold_event_fields_rq */
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_THRESHOLD_EVENT_FIELDS_RQ_CMD 0
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_THRESHOLD_EVENT_FIELDS_RQ_SENSOR_NUMBER 1
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_THRESHOLD_EVENT_FIELDS_RQ_SENSOR_READING_OPERATION 2
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_THRESHOLD_EVENT_FIELDS_RQ_DEASSERTION_BITS_OPERATION 3
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_THRESHOLD_EVENT_FIELDS_RQ_ASSERTION_BITS_OPERATION 4
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_THRESHOLD_EVENT_FIELDS_RQ_EVENT_DATA_BYTES_OPERATION 5
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_THRESHOLD_EVENT_FIELDS_RQ_SENSOR_READING 6
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_THRESHOLD_EVENT_FIELDS_RQ_ASSERTION_EVENT_LOWER_NON_CRITICAL_GOING_LOW_OCCURRED 7
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_THRESHOLD_EVENT_FIELDS_RQ_ASSERTION_EVENT_LOWER_NON_CRITICAL_GOING_HIGH_OCCURRED 8
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_THRESHOLD_EVENT_FIELDS_RQ_ASSERTION_EVENT_LOWER_CRITICAL_GOING_LOW_OCCURRED 9
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_THRESHOLD_EVENT_FIELDS_RQ_ASSERTION_EVENT_LOWER_CRITICAL_GOING_HIGH_OCCURRED 10
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_THRESHOLD_EVENT_FIELDS_RQ_ASSERTION_EVENT_LOWER_NON_RECOVERABLE_GOING_LOW_OCCURRED 11
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_THRESHOLD_EVENT_FIELDS_RQ_ASSERTION_EVENT_LOWER_NON_RECOVERABLE_GOING_HIGH_OCCURRED 12
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_THRESHOLD_EVENT_FIELDS_RQ_ASSERTION_EVENT_UPPER_NON_CRITICAL_GOING_LOW_OCCURRED 13
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_THRESHOLD_EVENT_FIELDS_RQ_ASSERTION_EVENT_UPPER_NON_CRITICAL_GOING_HIGH_OCCURRED 14
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_THRESHOLD_EVENT_FIELDS_RQ_ASSERTION_EVENT_UPPER_CRITICAL_GOING_LOW_OCCURRED 15
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_THRESHOLD_EVENT_FIELDS_RQ_ASSERTION_EVENT_UPPER_CRITICAL_GOING_HIGH_OCCURRED 16
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_THRESHOLD_EVENT_FIELDS_RQ_ASSERTION_EVENT_UPPER_NON_RECOVERABLE_GOING_LOW_OCCURRED 17
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_THRESHOLD_EVENT_FIELDS_RQ_ASSERTION_EVENT_UPPER_NON_RECOVERABLE_GOING_HIGH_OCCURRED 18
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_THRESHOLD_EVENT_FIELDS_RQ_RESERVED1 19
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_THRESHOLD_EVENT_FIELDS_RQ_DEASSERTION_EVENT_LOWER_NON_CRITICAL_GOING_LOW_OCCURRED 20
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_THRESHOLD_EVENT_FIELDS_RQ_DEASSERTION_EVENT_LOWER_NON_CRITICAL_GOING_HIGH_OCCURRED 21
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_THRESHOLD_EVENT_FIELDS_RQ_DEASSERTION_EVENT_LOWER_CRITICAL_GOING_LOW_OCCURRED 22
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_THRESHOLD_EVENT_FIELDS_RQ_DEASSERTION_EVENT_LOWER_CRITICAL_GOING_HIGH_OCCURRED 23
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_THRESHOLD_EVENT_FIELDS_RQ_DEASSERTION_EVENT_LOWER_NON_RECOVERABLE_GOING_LOW_OCCURRED 24
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_THRESHOLD_EVENT_FIELDS_RQ_DEASSERTION_EVENT_LOWER_NON_RECOVERABLE_GOING_HIGH_OCCURRED 25
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_THRESHOLD_EVENT_FIELDS_RQ_DEASSERTION_EVENT_UPPER_NON_CRITICAL_GOING_LOW_OCCURRED 26
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_THRESHOLD_EVENT_FIELDS_RQ_DEASSERTION_EVENT_UPPER_NON_CRITICAL_GOING_HIGH_OCCURRED 27
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_THRESHOLD_EVENT_FIELDS_RQ_DEASSERTION_EVENT_UPPER_CRITICAL_GOING_LOW_OCCURRED 28
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_THRESHOLD_EVENT_FIELDS_RQ_DEASSERTION_EVENT_UPPER_CRITICAL_GOING_HIGH_OCCURRED 29
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_THRESHOLD_EVENT_FIELDS_RQ_DEASSERTION_EVENT_UPPER_NON_RECOVERABLE_GOING_LOW_OCCURRED 30
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_THRESHOLD_EVENT_FIELDS_RQ_DEASSERTION_EVENT_UPPER_NON_RECOVERABLE_GOING_HIGH_OCCURRED 31
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_THRESHOLD_EVENT_FIELDS_RQ_RESERVED2 32
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_THRESHOLD_EVENT_FIELDS_RQ_OFFSET_FROM_EVENT_READING_TYPE_CODE 33
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_THRESHOLD_EVENT_FIELDS_RQ_EVENT_DATA3_FLAG 34
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_THRESHOLD_EVENT_FIELDS_RQ_EVENT_DATA2_FLAG 35
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_THRESHOLD_EVENT_FIELDS_RQ_EVENT_DATA2 36
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_THRESHOLD_EVENT_FIELDS_RQ_EVENT_DATA3 37
+
+/* tmpl_cmd_set_sensor_reading_and_event_status_discrete_event_fields_rq */
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_DISCRETE_EVENT_FIELDS_RQ_CMD 0
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_DISCRETE_EVENT_FIELDS_RQ_SENSOR_NUMBER 1
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_DISCRETE_EVENT_FIELDS_RQ_SENSOR_READING_OPERATION 2
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_DISCRETE_EVENT_FIELDS_RQ_DEASSERTION_BITS_OPERATION 3
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_DISCRETE_EVENT_FIELDS_RQ_ASSERTION_BITS_OPERATION 4
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_DISCRETE_EVENT_FIELDS_RQ_EVENT_DATA_BYTES_OPERATION 5
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_DISCRETE_EVENT_FIELDS_RQ_SENSOR_READING 6
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_DISCRETE_EVENT_FIELDS_RQ_STATE_0_ASSERTION_EVENT_OCCURRED 7
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_DISCRETE_EVENT_FIELDS_RQ_STATE_1_ASSERTION_EVENT_OCCURRED 8
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_DISCRETE_EVENT_FIELDS_RQ_STATE_2_ASSERTION_EVENT_OCCURRED 9
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_DISCRETE_EVENT_FIELDS_RQ_STATE_3_ASSERTION_EVENT_OCCURRED 10
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_DISCRETE_EVENT_FIELDS_RQ_STATE_4_ASSERTION_EVENT_OCCURRED 11
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_DISCRETE_EVENT_FIELDS_RQ_STATE_5_ASSERTION_EVENT_OCCURRED 12
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_DISCRETE_EVENT_FIELDS_RQ_STATE_6_ASSERTION_EVENT_OCCURRED 13
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_DISCRETE_EVENT_FIELDS_RQ_STATE_7_ASSERTION_EVENT_OCCURRED 14
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_DISCRETE_EVENT_FIELDS_RQ_STATE_8_ASSERTION_EVENT_OCCURRED 15
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_DISCRETE_EVENT_FIELDS_RQ_STATE_9_ASSERTION_EVENT_OCCURRED 16
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_DISCRETE_EVENT_FIELDS_RQ_STATE_10_ASSERTION_EVENT_OCCURRED 17
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_DISCRETE_EVENT_FIELDS_RQ_STATE_11_ASSERTION_EVENT_OCCURRED 18
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_DISCRETE_EVENT_FIELDS_RQ_STATE_12_ASSERTION_EVENT_OCCURRED 19
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_DISCRETE_EVENT_FIELDS_RQ_STATE_13_ASSERTION_EVENT_OCCURRED 20
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_DISCRETE_EVENT_FIELDS_RQ_STATE_14_ASSERTION_EVENT_OCCURRED 21
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_DISCRETE_EVENT_FIELDS_RQ_RESERVED1 22
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_DISCRETE_EVENT_FIELDS_RQ_STATE_0_DEASSERTION_EVENT_OCCURRED 23
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_DISCRETE_EVENT_FIELDS_RQ_STATE_1_DEASSERTION_EVENT_OCCURRED 24
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_DISCRETE_EVENT_FIELDS_RQ_STATE_2_DEASSERTION_EVENT_OCCURRED 25
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_DISCRETE_EVENT_FIELDS_RQ_STATE_3_DEASSERTION_EVENT_OCCURRED 26
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_DISCRETE_EVENT_FIELDS_RQ_STATE_4_DEASSERTION_EVENT_OCCURRED 27
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_DISCRETE_EVENT_FIELDS_RQ_STATE_5_DEASSERTION_EVENT_OCCURRED 28
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_DISCRETE_EVENT_FIELDS_RQ_STATE_6_DEASSERTION_EVENT_OCCURRED 29
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_DISCRETE_EVENT_FIELDS_RQ_STATE_7_DEASSERTION_EVENT_OCCURRED 30
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_DISCRETE_EVENT_FIELDS_RQ_STATE_8_DEASSERTION_EVENT_OCCURRED 31
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_DISCRETE_EVENT_FIELDS_RQ_STATE_9_DEASSERTION_EVENT_OCCURRED 32
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_DISCRETE_EVENT_FIELDS_RQ_STATE_10_DEASSERTION_EVENT_OCCURRED 33
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_DISCRETE_EVENT_FIELDS_RQ_STATE_11_DEASSERTION_EVENT_OCCURRED 34
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_DISCRETE_EVENT_FIELDS_RQ_STATE_12_DEASSERTION_EVENT_OCCURRED 35
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_DISCRETE_EVENT_FIELDS_RQ_STATE_13_DEASSERTION_EVENT_OCCURRED 36
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_DISCRETE_EVENT_FIELDS_RQ_STATE_14_DEASSERTION_EVENT_OCCURRED 37
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_DISCRETE_EVENT_FIELDS_RQ_OFFSET_FROM_EVENT_READING_TYPE_CODE 39
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_DISCRETE_EVENT_FIELDS_RQ_EVENT_DATA3_FLAG 40
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_DISCRETE_EVENT_FIELDS_RQ_EVENT_DATA2_FLAG 41
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_DISCRETE_EVENT_FIELDS_RQ_EVENT_DATA2 42
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_DISCRETE_EVENT_FIELDS_RQ_EVENT_DATA3 43
+
+/* tmpl_cmd_set_sensor_reading_and_event_status_rs */
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_RS_CMD 0
+#define TMPL_CMD_SET_SENSOR_READING_AND_EVENT_STATUS_RS_COMP_CODE 1
+
+/* tmpl_cmd_set_serial_modem_configuration_rq */
+#define TMPL_CMD_SET_SERIAL_MODEM_CONFIGURATION_RQ_CMD 0
+#define TMPL_CMD_SET_SERIAL_MODEM_CONFIGURATION_RQ_CHANNEL_NUMBER 1
+#define TMPL_CMD_SET_SERIAL_MODEM_CONFIGURATION_RQ_RESERVED 2
+#define TMPL_CMD_SET_SERIAL_MODEM_CONFIGURATION_RQ_PARAMETER_SELECTOR 3
+#define TMPL_CMD_SET_SERIAL_MODEM_CONFIGURATION_RQ_CONFIGURATION_PARAMETER_DATA 4
+
+/* tmpl_cmd_set_serial_modem_configuration_rs */
+#define TMPL_CMD_SET_SERIAL_MODEM_CONFIGURATION_RS_CMD 0
+#define TMPL_CMD_SET_SERIAL_MODEM_CONFIGURATION_RS_COMP_CODE 1
+
+/* tmpl_cmd_set_serial_modem_configuration_set_in_progress_rq */
+#define TMPL_CMD_SET_SERIAL_MODEM_CONFIGURATION_SET_IN_PROGRESS_RQ_CMD 0
+#define TMPL_CMD_SET_SERIAL_MODEM_CONFIGURATION_SET_IN_PROGRESS_RQ_CHANNEL_NUMBER 1
+#define TMPL_CMD_SET_SERIAL_MODEM_CONFIGURATION_SET_IN_PROGRESS_RQ_RESERVED1 2
+#define TMPL_CMD_SET_SERIAL_MODEM_CONFIGURATION_SET_IN_PROGRESS_RQ_PARAMETER_SELECTOR 3
+#define TMPL_CMD_SET_SERIAL_MODEM_CONFIGURATION_SET_IN_PROGRESS_RQ_STATE 4
+#define TMPL_CMD_SET_SERIAL_MODEM_CONFIGURATION_SET_IN_PROGRESS_RQ_RESERVED2 5
+
+/* tmpl_cmd_set_serial_modem_configuration_connection_mode_rq */
+#define TMPL_CMD_SET_SERIAL_MODEM_CONFIGURATION_CONNECTION_MODE_RQ_CMD 0
+#define TMPL_CMD_SET_SERIAL_MODEM_CONFIGURATION_CONNECTION_MODE_RQ_CHANNEL_NUMBER 1
+#define TMPL_CMD_SET_SERIAL_MODEM_CONFIGURATION_CONNECTION_MODE_RQ_RESERVED1 2
+#define TMPL_CMD_SET_SERIAL_MODEM_CONFIGURATION_CONNECTION_MODE_RQ_PARAMETER_SELECTOR 3
+#define TMPL_CMD_SET_SERIAL_MODEM_CONFIGURATION_CONNECTION_MODE_RQ_BASIC_MODE 4
+#define TMPL_CMD_SET_SERIAL_MODEM_CONFIGURATION_CONNECTION_MODE_RQ_PPP_MODE 5
+#define TMPL_CMD_SET_SERIAL_MODEM_CONFIGURATION_CONNECTION_MODE_RQ_TERMINAL_MODE 6
+#define TMPL_CMD_SET_SERIAL_MODEM_CONFIGURATION_CONNECTION_MODE_RQ_RESERVED2 7
+#define TMPL_CMD_SET_SERIAL_MODEM_CONFIGURATION_CONNECTION_MODE_RQ_CONNECT_MODE 8
+
+/* tmpl_cmd_set_serial_modem_configuration_ipmi_messaging_comm_settings_rq */
+#define TMPL_CMD_SET_SERIAL_MODEM_CONFIGURATION_IPMI_MESSAGING_COMM_SETTINGS_RQ_CMD 0
+#define TMPL_CMD_SET_SERIAL_MODEM_CONFIGURATION_IPMI_MESSAGING_COMM_SETTINGS_RQ_CHANNEL_NUMBER 1
+#define TMPL_CMD_SET_SERIAL_MODEM_CONFIGURATION_IPMI_MESSAGING_COMM_SETTINGS_RQ_RESERVED1 2
+#define TMPL_CMD_SET_SERIAL_MODEM_CONFIGURATION_IPMI_MESSAGING_COMM_SETTINGS_RQ_PARAMETER_SELECTOR 3
+#define TMPL_CMD_SET_SERIAL_MODEM_CONFIGURATION_IPMI_MESSAGING_COMM_SETTINGS_RQ_RESERVED2 4
+#define TMPL_CMD_SET_SERIAL_MODEM_CONFIGURATION_IPMI_MESSAGING_COMM_SETTINGS_RQ_DTR_HANGUP 5
+#define TMPL_CMD_SET_SERIAL_MODEM_CONFIGURATION_IPMI_MESSAGING_COMM_SETTINGS_RQ_FLOW_CONTROL 6
+#define TMPL_CMD_SET_SERIAL_MODEM_CONFIGURATION_IPMI_MESSAGING_COMM_SETTINGS_RQ_BIT_RATE 7
+#define TMPL_CMD_SET_SERIAL_MODEM_CONFIGURATION_IPMI_MESSAGING_COMM_SETTINGS_RQ_RESERVED3 8
+
+/* tmpl_cmd_set_serial_modem_configuration_page_blackout_interval_rq */
+#define TMPL_CMD_SET_SERIAL_MODEM_CONFIGURATION_PAGE_BLACKOUT_INTERVAL_RQ_CMD 0
+#define TMPL_CMD_SET_SERIAL_MODEM_CONFIGURATION_PAGE_BLACKOUT_INTERVAL_RQ_CHANNEL_NUMBER 1
+#define TMPL_CMD_SET_SERIAL_MODEM_CONFIGURATION_PAGE_BLACKOUT_INTERVAL_RQ_RESERVED 2
+#define TMPL_CMD_SET_SERIAL_MODEM_CONFIGURATION_PAGE_BLACKOUT_INTERVAL_RQ_PARAMETER_SELECTOR 3
+#define TMPL_CMD_SET_SERIAL_MODEM_CONFIGURATION_PAGE_BLACKOUT_INTERVAL_RQ_PAGE_BLACKOUT_INTERVAL 4
+
+/* tmpl_cmd_set_serial_modem_configuration_call_retry_interval_rq */
+#define TMPL_CMD_SET_SERIAL_MODEM_CONFIGURATION_CALL_RETRY_INTERVAL_RQ_CMD 0
+#define TMPL_CMD_SET_SERIAL_MODEM_CONFIGURATION_CALL_RETRY_INTERVAL_RQ_CHANNEL_NUMBER 1
+#define TMPL_CMD_SET_SERIAL_MODEM_CONFIGURATION_CALL_RETRY_INTERVAL_RQ_RESERVED 2
+#define TMPL_CMD_SET_SERIAL_MODEM_CONFIGURATION_CALL_RETRY_INTERVAL_RQ_PARAMETER_SELECTOR 3
+#define TMPL_CMD_SET_SERIAL_MODEM_CONFIGURATION_CALL_RETRY_INTERVAL_RQ_CALL_RETRY_INTERVAL 4
+
+/* tmpl_cmd_get_serial_modem_configuration_rq */
+#define TMPL_CMD_GET_SERIAL_MODEM_CONFIGURATION_RQ_CMD 0
+#define TMPL_CMD_GET_SERIAL_MODEM_CONFIGURATION_RQ_CHANNEL_NUMBER 1
+#define TMPL_CMD_GET_SERIAL_MODEM_CONFIGURATION_RQ_RESERVED 2
+#define TMPL_CMD_GET_SERIAL_MODEM_CONFIGURATION_RQ_GET_PARAMETER 3
+#define TMPL_CMD_GET_SERIAL_MODEM_CONFIGURATION_RQ_PARAMETER_SELECTOR 4
+#define TMPL_CMD_GET_SERIAL_MODEM_CONFIGURATION_RQ_SET_SELECTOR 5
+#define TMPL_CMD_GET_SERIAL_MODEM_CONFIGURATION_RQ_BLOCK_SELECTOR 6
+
+/* tmpl_cmd_get_serial_modem_configuration_rs */
+#define TMPL_CMD_GET_SERIAL_MODEM_CONFIGURATION_RS_CMD 0
+#define TMPL_CMD_GET_SERIAL_MODEM_CONFIGURATION_RS_COMP_CODE 1
+#define TMPL_CMD_GET_SERIAL_MODEM_CONFIGURATION_RS_PRESENT_REVISION 2
+#define TMPL_CMD_GET_SERIAL_MODEM_CONFIGURATION_RS_OLDEST_REVISION_PARAMETER 3
+#define TMPL_CMD_GET_SERIAL_MODEM_CONFIGURATION_RS_CONFIGURATION_PARAMETER_DATA 4
+
+/* tmpl_cmd_get_serial_modem_configuration_set_in_progress_rs */
+#define TMPL_CMD_GET_SERIAL_MODEM_CONFIGURATION_SET_IN_PROGRESS_RS_CMD 0
+#define TMPL_CMD_GET_SERIAL_MODEM_CONFIGURATION_SET_IN_PROGRESS_RS_COMP_CODE 1
+#define TMPL_CMD_GET_SERIAL_MODEM_CONFIGURATION_SET_IN_PROGRESS_RS_PRESENT_REVISION 2
+#define TMPL_CMD_GET_SERIAL_MODEM_CONFIGURATION_SET_IN_PROGRESS_RS_OLDEST_REVISION_PARAMETER 3
+#define TMPL_CMD_GET_SERIAL_MODEM_CONFIGURATION_SET_IN_PROGRESS_RS_STATE 4
+#define TMPL_CMD_GET_SERIAL_MODEM_CONFIGURATION_SET_IN_PROGRESS_RS_RESERVED 5
+
+/* tmpl_cmd_get_serial_modem_configuration_connection_mode_rs */
+#define TMPL_CMD_GET_SERIAL_MODEM_CONFIGURATION_CONNECTION_MODE_RS_CMD 0
+#define TMPL_CMD_GET_SERIAL_MODEM_CONFIGURATION_CONNECTION_MODE_RS_COMP_CODE 1
+#define TMPL_CMD_GET_SERIAL_MODEM_CONFIGURATION_CONNECTION_MODE_RS_PRESENT_REVISION 2
+#define TMPL_CMD_GET_SERIAL_MODEM_CONFIGURATION_CONNECTION_MODE_RS_OLDEST_REVISION_PARAMETER 3
+#define TMPL_CMD_GET_SERIAL_MODEM_CONFIGURATION_CONNECTION_MODE_RS_BASIC_MODE 4
+#define TMPL_CMD_GET_SERIAL_MODEM_CONFIGURATION_CONNECTION_MODE_RS_PPP_MODE 5
+#define TMPL_CMD_GET_SERIAL_MODEM_CONFIGURATION_CONNECTION_MODE_RS_TERMINAL_MODE 6
+#define TMPL_CMD_GET_SERIAL_MODEM_CONFIGURATION_CONNECTION_MODE_RS_RESERVED 7
+#define TMPL_CMD_GET_SERIAL_MODEM_CONFIGURATION_CONNECTION_MODE_RS_CONNECT_MODE 8
+
+/* tmpl_cmd_get_serial_modem_configuration_ipmi_messaging_comm_settings_rs */
+#define TMPL_CMD_GET_SERIAL_MODEM_CONFIGURATION_IPMI_MESSAGING_COMM_SETTINGS_RS_CMD 0
+#define TMPL_CMD_GET_SERIAL_MODEM_CONFIGURATION_IPMI_MESSAGING_COMM_SETTINGS_RS_COMP_CODE 1
+#define TMPL_CMD_GET_SERIAL_MODEM_CONFIGURATION_IPMI_MESSAGING_COMM_SETTINGS_RS_PRESENT_REVISION 2
+#define TMPL_CMD_GET_SERIAL_MODEM_CONFIGURATION_IPMI_MESSAGING_COMM_SETTINGS_RS_OLDEST_REVISION_PARAMETER 3
+#define TMPL_CMD_GET_SERIAL_MODEM_CONFIGURATION_IPMI_MESSAGING_COMM_SETTINGS_RS_RESERVED1 4
+#define TMPL_CMD_GET_SERIAL_MODEM_CONFIGURATION_IPMI_MESSAGING_COMM_SETTINGS_RS_DTR_HANGUP 5
+#define TMPL_CMD_GET_SERIAL_MODEM_CONFIGURATION_IPMI_MESSAGING_COMM_SETTINGS_RS_FLOW_CONTROL 6
+#define TMPL_CMD_GET_SERIAL_MODEM_CONFIGURATION_IPMI_MESSAGING_COMM_SETTINGS_RS_BIT_RATE 7
+#define TMPL_CMD_GET_SERIAL_MODEM_CONFIGURATION_IPMI_MESSAGING_COMM_SETTINGS_RS_RESERVED2 8
+
+/* tmpl_cmd_get_serial_modem_configuration_page_blackout_interval_rs */
+#define TMPL_CMD_GET_SERIAL_MODEM_CONFIGURATION_PAGE_BLACKOUT_INTERVAL_RS_CMD 0
+#define TMPL_CMD_GET_SERIAL_MODEM_CONFIGURATION_PAGE_BLACKOUT_INTERVAL_RS_COMP_CODE 1
+#define TMPL_CMD_GET_SERIAL_MODEM_CONFIGURATION_PAGE_BLACKOUT_INTERVAL_RS_PRESENT_REVISION 2
+#define TMPL_CMD_GET_SERIAL_MODEM_CONFIGURATION_PAGE_BLACKOUT_INTERVAL_RS_OLDEST_REVISION_PARAMETER 3
+#define TMPL_CMD_GET_SERIAL_MODEM_CONFIGURATION_PAGE_BLACKOUT_INTERVAL_RS_PAGE_BLACKOUT_INTERVAL 4
+
+/* tmpl_cmd_get_serial_modem_configuration_call_retry_interval_rs */
+#define TMPL_CMD_GET_SERIAL_MODEM_CONFIGURATION_CALL_RETRY_INTERVAL_RS_CMD 0
+#define TMPL_CMD_GET_SERIAL_MODEM_CONFIGURATION_CALL_RETRY_INTERVAL_RS_COMP_CODE 1
+#define TMPL_CMD_GET_SERIAL_MODEM_CONFIGURATION_CALL_RETRY_INTERVAL_RS_PRESENT_REVISION 2
+#define TMPL_CMD_GET_SERIAL_MODEM_CONFIGURATION_CALL_RETRY_INTERVAL_RS_OLDEST_REVISION_PARAMETER 3
+#define TMPL_CMD_GET_SERIAL_MODEM_CONFIGURATION_CALL_RETRY_INTERVAL_RS_CALL_RETRY_INTERVAL 4
+
+/* tmpl_cmd_set_sol_configuration_parameters_rq */
+#define TMPL_CMD_SET_SOL_CONFIGURATION_PARAMETERS_RQ_CMD 0
+#define TMPL_CMD_SET_SOL_CONFIGURATION_PARAMETERS_RQ_CHANNEL_NUMBER 1
+#define TMPL_CMD_SET_SOL_CONFIGURATION_PARAMETERS_RQ_RESERVED 2
+#define TMPL_CMD_SET_SOL_CONFIGURATION_PARAMETERS_RQ_PARAMETER_SELECTOR 3
+#define TMPL_CMD_SET_SOL_CONFIGURATION_PARAMETERS_RQ_CONFIGURATION_PARAMETER_DATA 4
+
+/* tmpl_cmd_set_sol_configuration_parameters_rs */
+#define TMPL_CMD_SET_SOL_CONFIGURATION_PARAMETERS_RS_CMD 0
+#define TMPL_CMD_SET_SOL_CONFIGURATION_PARAMETERS_RS_COMP_CODE 1
+
+/* tmpl_cmd_set_sol_configuration_parameters_set_in_progress_rq */
+#define TMPL_CMD_SET_SOL_CONFIGURATION_PARAMETERS_SET_IN_PROGRESS_RQ_CMD 0
+#define TMPL_CMD_SET_SOL_CONFIGURATION_PARAMETERS_SET_IN_PROGRESS_RQ_CHANNEL_NUMBER 1
+#define TMPL_CMD_SET_SOL_CONFIGURATION_PARAMETERS_SET_IN_PROGRESS_RQ_RESERVED1 2
+#define TMPL_CMD_SET_SOL_CONFIGURATION_PARAMETERS_SET_IN_PROGRESS_RQ_PARAMETER_SELECTOR 3
+#define TMPL_CMD_SET_SOL_CONFIGURATION_PARAMETERS_SET_IN_PROGRESS_RQ_STATE 4
+#define TMPL_CMD_SET_SOL_CONFIGURATION_PARAMETERS_SET_IN_PROGRESS_RQ_RESERVED2 5
+
+/* tmpl_cmd_set_sol_configuration_parameters_sol_enable_rq */
+#define TMPL_CMD_SET_SOL_CONFIGURATION_PARAMETERS_SOL_ENABLE_RQ_CMD 0
+#define TMPL_CMD_SET_SOL_CONFIGURATION_PARAMETERS_SOL_ENABLE_RQ_CHANNEL_NUMBER 1
+#define TMPL_CMD_SET_SOL_CONFIGURATION_PARAMETERS_SOL_ENABLE_RQ_RESERVED1 2
+#define TMPL_CMD_SET_SOL_CONFIGURATION_PARAMETERS_SOL_ENABLE_RQ_PARAMETER_SELECTOR 3
+#define TMPL_CMD_SET_SOL_CONFIGURATION_PARAMETERS_SOL_ENABLE_RQ_SOL_ENABLE 4
+#define TMPL_CMD_SET_SOL_CONFIGURATION_PARAMETERS_SOL_ENABLE_RQ_RESERVED2 5
+
+/* tmpl_cmd_set_sol_configuration_parameters_sol_authentication_rq */
+#define TMPL_CMD_SET_SOL_CONFIGURATION_PARAMETERS_SOL_AUTHENTICATION_RQ_CMD 0
+#define TMPL_CMD_SET_SOL_CONFIGURATION_PARAMETERS_SOL_AUTHENTICATION_RQ_CHANNEL_NUMBER 1
+#define TMPL_CMD_SET_SOL_CONFIGURATION_PARAMETERS_SOL_AUTHENTICATION_RQ_RESERVED1 2
+#define TMPL_CMD_SET_SOL_CONFIGURATION_PARAMETERS_SOL_AUTHENTICATION_RQ_PARAMETER_SELECTOR 3
+#define TMPL_CMD_SET_SOL_CONFIGURATION_PARAMETERS_SOL_AUTHENTICATION_RQ_SOL_PRIVILEGE_LEVEL 4
+#define TMPL_CMD_SET_SOL_CONFIGURATION_PARAMETERS_SOL_AUTHENTICATION_RQ_RESERVED2 5
+#define TMPL_CMD_SET_SOL_CONFIGURATION_PARAMETERS_SOL_AUTHENTICATION_RQ_FORCE_SOL_PAYLOAD_AUTHENTICATION 6
+#define TMPL_CMD_SET_SOL_CONFIGURATION_PARAMETERS_SOL_AUTHENTICATION_RQ_FORCE_SOL_PAYLOAD_ENCRYPTION 7
+
+/* tmpl_cmd_set_sol_configuration_parameters_character_accumulate_interval_and_send_threshold_rq */
+#define TMPL_CMD_SET_SOL_CONFIGURATION_PARAMETERS_CHARACTER_ACCUMULATE_INTERVAL_AND_SEND_THRESHOLD_RQ_CMD 0
+#define TMPL_CMD_SET_SOL_CONFIGURATION_PARAMETERS_CHARACTER_ACCUMULATE_INTERVAL_AND_SEND_THRESHOLD_RQ_CHANNEL_NUMBER 1
+#define TMPL_CMD_SET_SOL_CONFIGURATION_PARAMETERS_CHARACTER_ACCUMULATE_INTERVAL_AND_SEND_THRESHOLD_RQ_RESERVED1 2
+#define TMPL_CMD_SET_SOL_CONFIGURATION_PARAMETERS_CHARACTER_ACCUMULATE_INTERVAL_AND_SEND_THRESHOLD_RQ_PARAMETER_SELECTOR 3
+#define TMPL_CMD_SET_SOL_CONFIGURATION_PARAMETERS_CHARACTER_ACCUMULATE_INTERVAL_AND_SEND_THRESHOLD_RQ_CHARACTER_ACCUMULATE_INTERVAL 4
+#define TMPL_CMD_SET_SOL_CONFIGURATION_PARAMETERS_CHARACTER_ACCUMULATE_INTERVAL_AND_SEND_THRESHOLD_RQ_CHARACTER_SEND_THRESHOLD 5
+
+/* tmpl_cmd_set_sol_configuration_parameters_sol_retry_rq */
+#define TMPL_CMD_SET_SOL_CONFIGURATION_PARAMETERS_SOL_RETRY_RQ_CMD 0
+#define TMPL_CMD_SET_SOL_CONFIGURATION_PARAMETERS_SOL_RETRY_RQ_CHANNEL_NUMBER 1
+#define TMPL_CMD_SET_SOL_CONFIGURATION_PARAMETERS_SOL_RETRY_RQ_RESERVED1 2
+#define TMPL_CMD_SET_SOL_CONFIGURATION_PARAMETERS_SOL_RETRY_RQ_PARAMETER_SELECTOR 3
+#define TMPL_CMD_SET_SOL_CONFIGURATION_PARAMETERS_SOL_RETRY_RQ_RETRY_COUNT 4
+#define TMPL_CMD_SET_SOL_CONFIGURATION_PARAMETERS_SOL_RETRY_RQ_RESERVED2 5
+#define TMPL_CMD_SET_SOL_CONFIGURATION_PARAMETERS_SOL_RETRY_RQ_RETRY_INTERVAL 6
+
+/* tmpl_cmd_set_sol_configuration_parameters_sol_non_volatile_bit_rate_rq */
+#define TMPL_CMD_SET_SOL_CONFIGURATION_PARAMETERS_SOL_NON_VOLATILE_BIT_RATE_RQ_CMD 0
+#define TMPL_CMD_SET_SOL_CONFIGURATION_PARAMETERS_SOL_NON_VOLATILE_BIT_RATE_RQ_CHANNEL_NUMBER 1
+#define TMPL_CMD_SET_SOL_CONFIGURATION_PARAMETERS_SOL_NON_VOLATILE_BIT_RATE_RQ_RESERVED1 2
+#define TMPL_CMD_SET_SOL_CONFIGURATION_PARAMETERS_SOL_NON_VOLATILE_BIT_RATE_RQ_PARAMETER_SELECTOR 3
+#define TMPL_CMD_SET_SOL_CONFIGURATION_PARAMETERS_SOL_NON_VOLATILE_BIT_RATE_RQ_BIT_RATE 4
+#define TMPL_CMD_SET_SOL_CONFIGURATION_PARAMETERS_SOL_NON_VOLATILE_BIT_RATE_RQ_RESERVED2 5
+
+/* tmpl_cmd_set_sol_configuration_parameters_sol_volatile_bit_rate_rq */
+#define TMPL_CMD_SET_SOL_CONFIGURATION_PARAMETERS_SOL_VOLATILE_BIT_RATE_RQ_CMD 0
+#define TMPL_CMD_SET_SOL_CONFIGURATION_PARAMETERS_SOL_VOLATILE_BIT_RATE_RQ_CHANNEL_NUMBER 1
+#define TMPL_CMD_SET_SOL_CONFIGURATION_PARAMETERS_SOL_VOLATILE_BIT_RATE_RQ_RESERVED1 2
+#define TMPL_CMD_SET_SOL_CONFIGURATION_PARAMETERS_SOL_VOLATILE_BIT_RATE_RQ_PARAMETER_SELECTOR 3
+#define TMPL_CMD_SET_SOL_CONFIGURATION_PARAMETERS_SOL_VOLATILE_BIT_RATE_RQ_BIT_RATE 4
+#define TMPL_CMD_SET_SOL_CONFIGURATION_PARAMETERS_SOL_VOLATILE_BIT_RATE_RQ_RESERVED2 5
+
+/* tmpl_cmd_set_sol_configuration_parameters_sol_payload_port_number_rq */
+#define TMPL_CMD_SET_SOL_CONFIGURATION_PARAMETERS_SOL_PAYLOAD_PORT_NUMBER_RQ_CMD 0
+#define TMPL_CMD_SET_SOL_CONFIGURATION_PARAMETERS_SOL_PAYLOAD_PORT_NUMBER_RQ_CHANNEL_NUMBER 1
+#define TMPL_CMD_SET_SOL_CONFIGURATION_PARAMETERS_SOL_PAYLOAD_PORT_NUMBER_RQ_RESERVED1 2
+#define TMPL_CMD_SET_SOL_CONFIGURATION_PARAMETERS_SOL_PAYLOAD_PORT_NUMBER_RQ_PARAMETER_SELECTOR 3
+#define TMPL_CMD_SET_SOL_CONFIGURATION_PARAMETERS_SOL_PAYLOAD_PORT_NUMBER_RQ_PORT_NUMBER 4
+
+/* tmpl_cmd_get_sol_configuration_parameters_rq */
+#define TMPL_CMD_GET_SOL_CONFIGURATION_PARAMETERS_RQ_CMD 0
+#define TMPL_CMD_GET_SOL_CONFIGURATION_PARAMETERS_RQ_CHANNEL_NUMBER 1
+#define TMPL_CMD_GET_SOL_CONFIGURATION_PARAMETERS_RQ_RESERVED 2
+#define TMPL_CMD_GET_SOL_CONFIGURATION_PARAMETERS_RQ_GET_PARAMETER 3
+#define TMPL_CMD_GET_SOL_CONFIGURATION_PARAMETERS_RQ_PARAMETER_SELECTOR 4
+#define TMPL_CMD_GET_SOL_CONFIGURATION_PARAMETERS_RQ_SET_SELECTOR 5
+#define TMPL_CMD_GET_SOL_CONFIGURATION_PARAMETERS_RQ_BLOCK_SELECTOR 6
+
+/* tmpl_cmd_get_sol_configuration_parameters_rs */
+#define TMPL_CMD_GET_SOL_CONFIGURATION_PARAMETERS_RS_CMD 0
+#define TMPL_CMD_GET_SOL_CONFIGURATION_PARAMETERS_RS_COMP_CODE 1
+#define TMPL_CMD_GET_SOL_CONFIGURATION_PARAMETERS_RS_PRESENT_REVISION 2
+#define TMPL_CMD_GET_SOL_CONFIGURATION_PARAMETERS_RS_OLDEST_REVISION_PARAMETER 3
+#define TMPL_CMD_GET_SOL_CONFIGURATION_PARAMETERS_RS_CONFIGURATION_PARAMETER_DATA 4
+
+/* tmpl_cmd_get_sol_configuration_parameters_set_in_progress_rs */
+#define TMPL_CMD_GET_SOL_CONFIGURATION_PARAMETERS_SET_IN_PROGRESS_RS_CMD 0
+#define TMPL_CMD_GET_SOL_CONFIGURATION_PARAMETERS_SET_IN_PROGRESS_RS_COMP_CODE 1
+#define TMPL_CMD_GET_SOL_CONFIGURATION_PARAMETERS_SET_IN_PROGRESS_RS_PRESENT_REVISION 2
+#define TMPL_CMD_GET_SOL_CONFIGURATION_PARAMETERS_SET_IN_PROGRESS_RS_OLDEST_REVISION_PARAMETER 3
+#define TMPL_CMD_GET_SOL_CONFIGURATION_PARAMETERS_SET_IN_PROGRESS_RS_STATE 4
+#define TMPL_CMD_GET_SOL_CONFIGURATION_PARAMETERS_SET_IN_PROGRESS_RS_RESERVED 5
+
+/* tmpl_cmd_get_sol_configuration_parameters_sol_enable_rs */
+#define TMPL_CMD_GET_SOL_CONFIGURATION_PARAMETERS_SOL_ENABLE_RS_CMD 0
+#define TMPL_CMD_GET_SOL_CONFIGURATION_PARAMETERS_SOL_ENABLE_RS_COMP_CODE 1
+#define TMPL_CMD_GET_SOL_CONFIGURATION_PARAMETERS_SOL_ENABLE_RS_PRESENT_REVISION 2
+#define TMPL_CMD_GET_SOL_CONFIGURATION_PARAMETERS_SOL_ENABLE_RS_OLDEST_REVISION_PARAMETER 3
+#define TMPL_CMD_GET_SOL_CONFIGURATION_PARAMETERS_SOL_ENABLE_RS_SOL_ENABLE 4
+#define TMPL_CMD_GET_SOL_CONFIGURATION_PARAMETERS_SOL_ENABLE_RS_RESERVED 5
+
+/* tmpl_cmd_get_sol_configuration_parameters_sol_authentication_rs */
+#define TMPL_CMD_GET_SOL_CONFIGURATION_PARAMETERS_SOL_AUTHENTICATION_RS_CMD 0
+#define TMPL_CMD_GET_SOL_CONFIGURATION_PARAMETERS_SOL_AUTHENTICATION_RS_COMP_CODE 1
+#define TMPL_CMD_GET_SOL_CONFIGURATION_PARAMETERS_SOL_AUTHENTICATION_RS_PRESENT_REVISION 2
+#define TMPL_CMD_GET_SOL_CONFIGURATION_PARAMETERS_SOL_AUTHENTICATION_RS_OLDEST_REVISION_PARAMETER 3
+#define TMPL_CMD_GET_SOL_CONFIGURATION_PARAMETERS_SOL_AUTHENTICATION_RS_SOL_PRIVILEGE_LEVEL 4
+#define TMPL_CMD_GET_SOL_CONFIGURATION_PARAMETERS_SOL_AUTHENTICATION_RS_RESERVED 5
+#define TMPL_CMD_GET_SOL_CONFIGURATION_PARAMETERS_SOL_AUTHENTICATION_RS_FORCE_SOL_PAYLOAD_AUTHENTICATION 6
+#define TMPL_CMD_GET_SOL_CONFIGURATION_PARAMETERS_SOL_AUTHENTICATION_RS_FORCE_SOL_PAYLOAD_ENCRYPTION 7
+
+/* tmpl_cmd_get_sol_configuration_parameters_character_accumulate_interval_and_send_threshold_rs */
+#define TMPL_CMD_GET_SOL_CONFIGURATION_PARAMETERS_CHARACTER_ACCUMULATE_INTERVAL_AND_SEND_THRESHOLD_RS_CMD 0
+#define TMPL_CMD_GET_SOL_CONFIGURATION_PARAMETERS_CHARACTER_ACCUMULATE_INTERVAL_AND_SEND_THRESHOLD_RS_COMP_CODE 1
+#define TMPL_CMD_GET_SOL_CONFIGURATION_PARAMETERS_CHARACTER_ACCUMULATE_INTERVAL_AND_SEND_THRESHOLD_RS_PRESENT_REVISION 2
+#define TMPL_CMD_GET_SOL_CONFIGURATION_PARAMETERS_CHARACTER_ACCUMULATE_INTERVAL_AND_SEND_THRESHOLD_RS_OLDEST_REVISION_PARAMETER 3
+#define TMPL_CMD_GET_SOL_CONFIGURATION_PARAMETERS_CHARACTER_ACCUMULATE_INTERVAL_AND_SEND_THRESHOLD_RS_CHARACTER_ACCUMULATE_INTERVAL 4
+#define TMPL_CMD_GET_SOL_CONFIGURATION_PARAMETERS_CHARACTER_ACCUMULATE_INTERVAL_AND_SEND_THRESHOLD_RS_CHARACTER_SEND_THRESHOLD 5
+
+/* tmpl_cmd_get_sol_configuration_parameters_sol_retry_rs */
+#define TMPL_CMD_GET_SOL_CONFIGURATION_PARAMETERS_SOL_RETRY_RS_CMD 0
+#define TMPL_CMD_GET_SOL_CONFIGURATION_PARAMETERS_SOL_RETRY_RS_COMP_CODE 1
+#define TMPL_CMD_GET_SOL_CONFIGURATION_PARAMETERS_SOL_RETRY_RS_PRESENT_REVISION 2
+#define TMPL_CMD_GET_SOL_CONFIGURATION_PARAMETERS_SOL_RETRY_RS_OLDEST_REVISION_PARAMETER 3
+#define TMPL_CMD_GET_SOL_CONFIGURATION_PARAMETERS_SOL_RETRY_RS_RETRY_COUNT 4
+#define TMPL_CMD_GET_SOL_CONFIGURATION_PARAMETERS_SOL_RETRY_RS_RESERVED 5
+#define TMPL_CMD_GET_SOL_CONFIGURATION_PARAMETERS_SOL_RETRY_RS_RETRY_INTERVAL 6
+
+/* tmpl_cmd_get_sol_configuration_parameters_sol_non_volatile_bit_rate_rs */
+#define TMPL_CMD_GET_SOL_CONFIGURATION_PARAMETERS_SOL_NON_VOLATILE_BIT_RATE_RS_CMD 0
+#define TMPL_CMD_GET_SOL_CONFIGURATION_PARAMETERS_SOL_NON_VOLATILE_BIT_RATE_RS_COMP_CODE 1
+#define TMPL_CMD_GET_SOL_CONFIGURATION_PARAMETERS_SOL_NON_VOLATILE_BIT_RATE_RS_PRESENT_REVISION 2
+#define TMPL_CMD_GET_SOL_CONFIGURATION_PARAMETERS_SOL_NON_VOLATILE_BIT_RATE_RS_OLDEST_REVISION_PARAMETER 3
+#define TMPL_CMD_GET_SOL_CONFIGURATION_PARAMETERS_SOL_NON_VOLATILE_BIT_RATE_RS_BIT_RATE 4
+#define TMPL_CMD_GET_SOL_CONFIGURATION_PARAMETERS_SOL_NON_VOLATILE_BIT_RATE_RS_RESERVED 5
+
+/* tmpl_cmd_get_sol_configuration_parameters_sol_volatile_bit_rate_rs */
+#define TMPL_CMD_GET_SOL_CONFIGURATION_PARAMETERS_SOL_VOLATILE_BIT_RATE_RS_CMD 0
+#define TMPL_CMD_GET_SOL_CONFIGURATION_PARAMETERS_SOL_VOLATILE_BIT_RATE_RS_COMP_CODE 1
+#define TMPL_CMD_GET_SOL_CONFIGURATION_PARAMETERS_SOL_VOLATILE_BIT_RATE_RS_PRESENT_REVISION 2
+#define TMPL_CMD_GET_SOL_CONFIGURATION_PARAMETERS_SOL_VOLATILE_BIT_RATE_RS_OLDEST_REVISION_PARAMETER 3
+#define TMPL_CMD_GET_SOL_CONFIGURATION_PARAMETERS_SOL_VOLATILE_BIT_RATE_RS_BIT_RATE 4
+#define TMPL_CMD_GET_SOL_CONFIGURATION_PARAMETERS_SOL_VOLATILE_BIT_RATE_RS_RESERVED 5
+
+/* tmpl_cmd_get_sol_configuration_parameters_sol_payload_channel_rs */
+#define TMPL_CMD_GET_SOL_CONFIGURATION_PARAMETERS_SOL_PAYLOAD_CHANNEL_RS_CMD 0
+#define TMPL_CMD_GET_SOL_CONFIGURATION_PARAMETERS_SOL_PAYLOAD_CHANNEL_RS_COMP_CODE 1
+#define TMPL_CMD_GET_SOL_CONFIGURATION_PARAMETERS_SOL_PAYLOAD_CHANNEL_RS_PRESENT_REVISION 2
+#define TMPL_CMD_GET_SOL_CONFIGURATION_PARAMETERS_SOL_PAYLOAD_CHANNEL_RS_OLDEST_REVISION_PARAMETER 3
+#define TMPL_CMD_GET_SOL_CONFIGURATION_PARAMETERS_SOL_PAYLOAD_CHANNEL_RS_PAYLOAD_CHANNEL 4
+
+/* tmpl_cmd_get_sol_configuration_parameters_sol_payload_port_number_rs */
+#define TMPL_CMD_GET_SOL_CONFIGURATION_PARAMETERS_SOL_PAYLOAD_PORT_NUMBER_RS_CMD 0
+#define TMPL_CMD_GET_SOL_CONFIGURATION_PARAMETERS_SOL_PAYLOAD_PORT_NUMBER_RS_COMP_CODE 1
+#define TMPL_CMD_GET_SOL_CONFIGURATION_PARAMETERS_SOL_PAYLOAD_PORT_NUMBER_RS_PRESENT_REVISION 2
+#define TMPL_CMD_GET_SOL_CONFIGURATION_PARAMETERS_SOL_PAYLOAD_PORT_NUMBER_RS_OLDEST_REVISION_PARAMETER 3
+#define TMPL_CMD_GET_SOL_CONFIGURATION_PARAMETERS_SOL_PAYLOAD_PORT_NUMBER_RS_PORT_NUMBER 4
+
+/* tmpl_cmd_asf_presence_ping */
+#define TMPL_CMD_ASF_PRESENCE_PING_IANA_ENTERPRISE_NUMBER 0
+#define TMPL_CMD_ASF_PRESENCE_PING_MESSAGE_TYPE 1
+#define TMPL_CMD_ASF_PRESENCE_PING_MESSAGE_TAG 2
+#define TMPL_CMD_ASF_PRESENCE_PING_RESERVED 3
+#define TMPL_CMD_ASF_PRESENCE_PING_DATA_LENGTH 4
+
+/* tmpl_cmd_asf_presence_pong */
+#define TMPL_CMD_ASF_PRESENCE_PONG_IANA_ENTERPRISE_NUMBER 0
+#define TMPL_CMD_ASF_PRESENCE_PONG_MESSAGE_TYPE 1
+#define TMPL_CMD_ASF_PRESENCE_PONG_MESSAGE_TAG 2
+#define TMPL_CMD_ASF_PRESENCE_PONG_RESERVED1 3
+#define TMPL_CMD_ASF_PRESENCE_PONG_DATA_LENGTH 4
+#define TMPL_CMD_ASF_PRESENCE_PONG_OEM_IANA_ENTERPRISE_NUMBER 5
+#define TMPL_CMD_ASF_PRESENCE_PONG_OEM_DEFINED 6
+#define TMPL_CMD_ASF_PRESENCE_PONG_SUPPORTED_ENTITIES_VERSION 7
+#define TMPL_CMD_ASF_PRESENCE_PONG_SUPPORTED_ENTITIES_RESERVED 8
+#define TMPL_CMD_ASF_PRESENCE_PONG_SUPPORTED_ENTITIES_IPMI_SUPPORTED 9
+#define TMPL_CMD_ASF_PRESENCE_PONG_SUPPORTED_INTERACTIONS_RESERVED 10
+#define TMPL_CMD_ASF_PRESENCE_PONG_SUPPORTED_INTERACTIONS_SECURITY_EXTENSIONS 11
+#define TMPL_CMD_ASF_PRESENCE_PONG_RESERVED2 12
+
+/* tmpl_ipmb_msg_hdr_rq */
+#define TMPL_IPMB_MSG_HDR_RQ_RS_ADDR 0
+#define TMPL_IPMB_MSG_HDR_RQ_RS_LUN 1
+#define TMPL_IPMB_MSG_HDR_RQ_NET_FN 2
+#define TMPL_IPMB_MSG_HDR_RQ_CHECKSUM1 3
+#define TMPL_IPMB_MSG_HDR_RQ_RQ_ADDR 4
+#define TMPL_IPMB_MSG_HDR_RQ_RQ_LUN 5
+#define TMPL_IPMB_MSG_HDR_RQ_RQ_SEQ 6
+
+/* tmpl_ipmb_msg_hdr_rs */
+#define TMPL_IPMB_MSG_HDR_RS_RQ_LUN 0
+#define TMPL_IPMB_MSG_HDR_RS_NET_FN 1
+#define TMPL_IPMB_MSG_HDR_RS_CHECKSUM1 2
+#define TMPL_IPMB_MSG_HDR_RS_RS_ADDR 3
+#define TMPL_IPMB_MSG_HDR_RS_RS_LUN 4
+#define TMPL_IPMB_MSG_HDR_RS_RQ_SEQ 5
+
+/* tmpl_ipmb_msg_trlr */
+#define TMPL_IPMB_MSG_TRLR_CHECKSUM2 0
+
+/* tmpl_ipmb_msg */
+#define TMPL_IPMB_MSG_DATA 0
+
+/* tmpl_hdr_kcs */
+#define TMPL_HDR_KCS_LUN 0
+#define TMPL_HDR_KCS_NET_FN 1
+
+/* tmpl_lan_session_hdr */
+#define TMPL_LAN_SESSION_HDR_AUTHENTICATION_TYPE 0
+#define TMPL_LAN_SESSION_HDR_SESSION_SEQUENCE_NUMBER 1
+#define TMPL_LAN_SESSION_HDR_SESSION_ID 2
+#define TMPL_LAN_SESSION_HDR_AUTHENTICATION_CODE 3
+#define TMPL_LAN_SESSION_HDR_IPMI_MSG_LEN 4
+
+/* tmpl_lan_msg_hdr_rq */
+#define TMPL_LAN_MSG_HDR_RQ_RS_ADDR 0
+#define TMPL_LAN_MSG_HDR_RQ_RS_LUN 1
+#define TMPL_LAN_MSG_HDR_RQ_NET_FN 2
+#define TMPL_LAN_MSG_HDR_RQ_CHECKSUM1 3
+#define TMPL_LAN_MSG_HDR_RQ_RQ_ADDR 4
+#define TMPL_LAN_MSG_HDR_RQ_RQ_LUN 5
+#define TMPL_LAN_MSG_HDR_RQ_RQ_SEQ 6
+
+/* tmpl_lan_msg_hdr_rs */
+#define TMPL_LAN_MSG_HDR_RS_RQ_ADDR 0
+#define TMPL_LAN_MSG_HDR_RS_RQ_LUN 1
+#define TMPL_LAN_MSG_HDR_RS_NET_FN 2
+#define TMPL_LAN_MSG_HDR_RS_CHECKSUM1 3
+#define TMPL_LAN_MSG_HDR_RS_RS_ADDR 4
+#define TMPL_LAN_MSG_HDR_RS_RS_LUN 5
+#define TMPL_LAN_MSG_HDR_RS_RQ_SEQ 6
+
+/* tmpl_lan_msg_trlr */
+#define TMPL_LAN_MSG_TRLR_CHECKSUM2 0
+
+/* tmpl_rmcpplus_session_hdr */
+#define TMPL_RMCPPLUS_SESSION_HDR_AUTHENTICATION_TYPE 0
+#define TMPL_RMCPPLUS_SESSION_HDR_RESERVED1 1
+#define TMPL_RMCPPLUS_SESSION_HDR_PAYLOAD_TYPE 2
+#define TMPL_RMCPPLUS_SESSION_HDR_PAYLOAD_TYPE_AUTHENTICATED 3
+#define TMPL_RMCPPLUS_SESSION_HDR_PAYLOAD_TYPE_ENCRYPTED 4
+#define TMPL_RMCPPLUS_SESSION_HDR_OEM_IANA 5
+#define TMPL_RMCPPLUS_SESSION_HDR_RESERVED2 6
+#define TMPL_RMCPPLUS_SESSION_HDR_OEM_PAYLOAD_ID 7
+#define TMPL_RMCPPLUS_SESSION_HDR_SESSION_ID 8
+#define TMPL_RMCPPLUS_SESSION_HDR_SESSION_SEQUENCE_NUMBER 9
+#define TMPL_RMCPPLUS_SESSION_HDR_IPMI_PAYLOAD_LEN 10
+
+/* tmpl_rmcpplus_session_trlr */
+#define TMPL_RMCPPLUS_SESSION_TRLR_INTEGRITY_PAD 0
+#define TMPL_RMCPPLUS_SESSION_TRLR_PAD_LENGTH 1
+#define TMPL_RMCPPLUS_SESSION_TRLR_NEXT_HEADER 2
+#define TMPL_RMCPPLUS_SESSION_TRLR_AUTHENTICATION_CODE 3
+
+/* tmpl_rmcpplus_payload */
+#define TMPL_RMCPPLUS_PAYLOAD_CONFIDENTIALITY_HEADER 0
+#define TMPL_RMCPPLUS_PAYLOAD_PAYLOAD_DATA 1
+#define TMPL_RMCPPLUS_PAYLOAD_CONFIDENTIALITY_TRAILER 2
+
+/* tmpl_rmcpplus_open_session_request */
+#define TMPL_RMCPPLUS_OPEN_SESSION_REQUEST_MESSAGE_TAG 0
+#define TMPL_RMCPPLUS_OPEN_SESSION_REQUEST_REQUESTED_MAXIMUM_PRIVILEGE_LEVEL 1
+#define TMPL_RMCPPLUS_OPEN_SESSION_REQUEST_RESERVED1 2
+#define TMPL_RMCPPLUS_OPEN_SESSION_REQUEST_RESERVED2 3
+#define TMPL_RMCPPLUS_OPEN_SESSION_REQUEST_REMOTE_CONSOLE_SESSION_ID 4
+#define TMPL_RMCPPLUS_OPEN_SESSION_REQUEST_AUTHENTICATION_PAYLOAD_PAYLOAD_TYPE 5
+#define TMPL_RMCPPLUS_OPEN_SESSION_REQUEST_RESERVED3 6
+#define TMPL_RMCPPLUS_OPEN_SESSION_REQUEST_AUTHENTICATION_PAYLOAD_PAYLOAD_LENGTH 7
+#define TMPL_RMCPPLUS_OPEN_SESSION_REQUEST_AUTHENTICATION_PAYLOAD_AUTHENTICATION_ALGORITHM 8
+#define TMPL_RMCPPLUS_OPEN_SESSION_REQUEST_RESERVED4 9
+#define TMPL_RMCPPLUS_OPEN_SESSION_REQUEST_RESERVED5 10
+#define TMPL_RMCPPLUS_OPEN_SESSION_REQUEST_INTEGRITY_PAYLOAD_PAYLOAD_TYPE 11
+#define TMPL_RMCPPLUS_OPEN_SESSION_REQUEST_RESERVED6 12
+#define TMPL_RMCPPLUS_OPEN_SESSION_REQUEST_INTEGRITY_PAYLOAD_PAYLOAD_LENGTH 13
+#define TMPL_RMCPPLUS_OPEN_SESSION_REQUEST_INTEGRITY_PAYLOAD_INTEGRITY_ALGORITHM 14
+#define TMPL_RMCPPLUS_OPEN_SESSION_REQUEST_RESERVED7 15
+#define TMPL_RMCPPLUS_OPEN_SESSION_REQUEST_RESERVED8 16
+#define TMPL_RMCPPLUS_OPEN_SESSION_REQUEST_CONFIDENTIALITY_PAYLOAD_PAYLOAD_TYPE 17
+#define TMPL_RMCPPLUS_OPEN_SESSION_REQUEST_RESERVED9 18
+#define TMPL_RMCPPLUS_OPEN_SESSION_REQUEST_CONFIDENTIALITY_PAYLOAD_PAYLOAD_LENGTH 19
+#define TMPL_RMCPPLUS_OPEN_SESSION_REQUEST_CONFIDENTIALITY_PAYLOAD_CONFIDENTIALITY_ALGORITHM 20
+#define TMPL_RMCPPLUS_OPEN_SESSION_REQUEST_RESERVED10 21
+#define TMPL_RMCPPLUS_OPEN_SESSION_REQUEST_RESERVED11 22
+
+/* tmpl_rmcpplus_open_session_response */
+#define TMPL_RMCPPLUS_OPEN_SESSION_RESPONSE_MESSAGE_TAG 0
+#define TMPL_RMCPPLUS_OPEN_SESSION_RESPONSE_RMCPPLUS_STATUS_CODE 1
+#define TMPL_RMCPPLUS_OPEN_SESSION_RESPONSE_MAXIMUM_PRIVILEGE_LEVEL 2
+#define TMPL_RMCPPLUS_OPEN_SESSION_RESPONSE_RESERVED1 3
+#define TMPL_RMCPPLUS_OPEN_SESSION_RESPONSE_RESERVED2 4
+#define TMPL_RMCPPLUS_OPEN_SESSION_RESPONSE_REMOTE_CONSOLE_SESSION_ID 5
+#define TMPL_RMCPPLUS_OPEN_SESSION_RESPONSE_MANAGED_SYSTEM_SESSION_ID 6
+#define TMPL_RMCPPLUS_OPEN_SESSION_RESPONSE_AUTHENTICATION_PAYLOAD_PAYLOAD_TYPE 7
+#define TMPL_RMCPPLUS_OPEN_SESSION_RESPONSE_RESERVED3 8
+#define TMPL_RMCPPLUS_OPEN_SESSION_RESPONSE_AUTHENTICATION_PAYLOAD_PAYLOAD_LENGTH 9
+#define TMPL_RMCPPLUS_OPEN_SESSION_RESPONSE_AUTHENTICATION_PAYLOAD_AUTHENTICATION_ALGORITHM 10
+#define TMPL_RMCPPLUS_OPEN_SESSION_RESPONSE_RESERVED4 11
+#define TMPL_RMCPPLUS_OPEN_SESSION_RESPONSE_RESERVED5 12
+#define TMPL_RMCPPLUS_OPEN_SESSION_RESPONSE_INTEGRITY_PAYLOAD_PAYLOAD_TYPE 13
+#define TMPL_RMCPPLUS_OPEN_SESSION_RESPONSE_RESERVED6 14
+#define TMPL_RMCPPLUS_OPEN_SESSION_RESPONSE_INTEGRITY_PAYLOAD_PAYLOAD_LENGTH 15
+#define TMPL_RMCPPLUS_OPEN_SESSION_RESPONSE_INTEGRITY_PAYLOAD_INTEGRITY_ALGORITHM 16
+#define TMPL_RMCPPLUS_OPEN_SESSION_RESPONSE_RESERVED7 17
+#define TMPL_RMCPPLUS_OPEN_SESSION_RESPONSE_RESERVED8 18
+#define TMPL_RMCPPLUS_OPEN_SESSION_RESPONSE_CONFIDENTIALITY_PAYLOAD_PAYLOAD_TYPE 19
+#define TMPL_RMCPPLUS_OPEN_SESSION_RESPONSE_RESERVED9 20
+#define TMPL_RMCPPLUS_OPEN_SESSION_RESPONSE_CONFIDENTIALITY_PAYLOAD_PAYLOAD_LENGTH 21
+#define TMPL_RMCPPLUS_OPEN_SESSION_RESPONSE_CONFIDENTIALITY_PAYLOAD_CONFIDENTIALITY_ALGORITHM 22
+#define TMPL_RMCPPLUS_OPEN_SESSION_RESPONSE_RESERVED10 23
+#define TMPL_RMCPPLUS_OPEN_SESSION_RESPONSE_RESERVED11 24
+
+/* tmpl_rmcpplus_rakp_message_1 */
+#define TMPL_RMCPPLUS_RAKP_MESSAGE_1_MESSAGE_TAG 0
+#define TMPL_RMCPPLUS_RAKP_MESSAGE_1_RESERVED1 1
+#define TMPL_RMCPPLUS_RAKP_MESSAGE_1_MANAGED_SYSTEM_SESSION_ID 2
+#define TMPL_RMCPPLUS_RAKP_MESSAGE_1_REMOTE_CONSOLE_RANDOM_NUMBER 3
+#define TMPL_RMCPPLUS_RAKP_MESSAGE_1_REQUESTED_MAXIMUM_PRIVILEGE_LEVEL 4
+#define TMPL_RMCPPLUS_RAKP_MESSAGE_1_NAME_ONLY_LOOKUP 5
+#define TMPL_RMCPPLUS_RAKP_MESSAGE_1_RESERVED2 6
+#define TMPL_RMCPPLUS_RAKP_MESSAGE_1_RESERVED3 7
+#define TMPL_RMCPPLUS_RAKP_MESSAGE_1_USER_NAME_LENGTH 8
+#define TMPL_RMCPPLUS_RAKP_MESSAGE_1_USER_NAME 9
+
+/* tmpl_rmcpplus_rakp_message_2 */
+#define TMPL_RMCPPLUS_RAKP_MESSAGE_2_MESSAGE_TAG 0
+#define TMPL_RMCPPLUS_RAKP_MESSAGE_2_RMCPPLUS_STATUS_CODE 1
+#define TMPL_RMCPPLUS_RAKP_MESSAGE_2_RESERVED1 2
+#define TMPL_RMCPPLUS_RAKP_MESSAGE_2_REMOTE_CONSOLE_SESSION_ID 3
+#define TMPL_RMCPPLUS_RAKP_MESSAGE_2_MANAGED_SYSTEM_RANDOM_NUMBER 4
+#define TMPL_RMCPPLUS_RAKP_MESSAGE_2_MANAGED_SYSTEM_GUID 5
+#define TMPL_RMCPPLUS_RAKP_MESSAGE_2_KEY_EXCHANGE_AUTHENTICATION_CODE 6
+
+/* tmpl_rmcpplus_rakp_message_3 */
+#define TMPL_RMCPPLUS_RAKP_MESSAGE_3_MESSAGE_TAG 0
+#define TMPL_RMCPPLUS_RAKP_MESSAGE_3_RMCPPLUS_STATUS_CODE 1
+#define TMPL_RMCPPLUS_RAKP_MESSAGE_3_RESERVED1 2
+#define TMPL_RMCPPLUS_RAKP_MESSAGE_3_MANAGED_SYSTEM_SESSION_ID 3
+#define TMPL_RMCPPLUS_RAKP_MESSAGE_3_KEY_EXCHANGE_AUTHENTICATION_CODE 4
+
+/* tmpl_rmcpplus_rakp_message_4 */
+#define TMPL_RMCPPLUS_RAKP_MESSAGE_4_MESSAGE_TAG 0
+#define TMPL_RMCPPLUS_RAKP_MESSAGE_4_RMCPPLUS_STATUS_CODE 1
+#define TMPL_RMCPPLUS_RAKP_MESSAGE_4_RESERVED1 2
+#define TMPL_RMCPPLUS_RAKP_MESSAGE_4_REMOTE_CONSOLE_SESSION_ID 3
+#define TMPL_RMCPPLUS_RAKP_MESSAGE_4_INTEGRITY_CHECK_VALUE 4
+
+/* tmpl_rmcp_hdr */
+#define TMPL_RMCP_HDR_VERSION 0
+#define TMPL_RMCP_HDR_RESERVED 1
+#define TMPL_RMCP_HDR_SEQUENCE_NUMBER 2
+#define TMPL_RMCP_HDR_MESSAGE_CLASS_CLASS 3
+#define TMPL_RMCP_HDR_MESSAGE_CLASS_RESERVED 4
+#define TMPL_RMCP_HDR_MESSAGE_CLASS_ACK 5
+
+/* tmpl_cipher_suite_record_header */
+#define TMPL_CIPHER_SUITE_RECORD_HEADER_RECORD_FORMAT 0
+#define TMPL_CIPHER_SUITE_RECORD_HEADER_TAG_BITS 1
+
+/* tmpl_cipher_suite_record */
+#define TMPL_CIPHER_SUITE_RECORD_RECORD_FORMAT 0
+#define TMPL_CIPHER_SUITE_RECORD_TAG_BITS 1
+#define TMPL_CIPHER_SUITE_RECORD_CIPHER_SUITE_ID 2
+#define TMPL_CIPHER_SUITE_RECORD_AUTHENTICATION_ALGORITHM 3
+#define TMPL_CIPHER_SUITE_RECORD_AUTHENTICATION_ALGORITHM_TAG_BITS 4
+#define TMPL_CIPHER_SUITE_RECORD_INTEGRITY_ALGORITHM 5
+#define TMPL_CIPHER_SUITE_RECORD_INTEGRITY_ALGORITHM_TAG_BITS 6
+#define TMPL_CIPHER_SUITE_RECORD_CONFIDENTIALITY_ALGORITHM 7
+#define TMPL_CIPHER_SUITE_RECORD_CONFIDENTIALITY_ALGORITHM_TAG_BITS 8
+
+/* tmpl_oem_cipher_suite_record */
+#define TMPL_OEM_CIPHER_SUITE_RECORD_RECORD_FORMAT 0
+#define TMPL_OEM_CIPHER_SUITE_RECORD_TAG_BITS 1
+#define TMPL_OEM_CIPHER_SUITE_RECORD_OEM_CIPHER_SUITE_ID 2
+#define TMPL_OEM_CIPHER_SUITE_RECORD_OEM_IANA 3
+#define TMPL_OEM_CIPHER_SUITE_RECORD_AUTHENTICATION_ALGORITHM 4
+#define TMPL_OEM_CIPHER_SUITE_RECORD_AUTHENTICATION_ALGORITHM_TAG_BITS 5
+#define TMPL_OEM_CIPHER_SUITE_RECORD_INTEGRITY_ALGORITHM 6
+#define TMPL_OEM_CIPHER_SUITE_RECORD_INTEGRITY_ALGORITHM_TAG_BITS 7
+#define TMPL_OEM_CIPHER_SUITE_RECORD_CONFIDENTIALITY_ALGORITHM 8
+#define TMPL_OEM_CIPHER_SUITE_RECORD_CONFIDENTIALITY_ALGORITHM_TAG_BITS 9
+
+/* tmpl_fru_dimm_spd_ddr_header */
+#define TMPL_FRU_DIMM_SPD_DDR_HEADER_SPD_BYTES_USED 0
+#define TMPL_FRU_DIMM_SPD_DDR_HEADER_SPD_BYTES_TOTAL 1
+#define TMPL_FRU_DIMM_SPD_DDR_HEADER_CRC_COVERAGE 2
+#define TMPL_FRU_DIMM_SPD_DDR_HEADER_ADDITIONS_LEVEL 3
+#define TMPL_FRU_DIMM_SPD_DDR_HEADER_ENCODING_LEVEL 4
+#define TMPL_FRU_DIMM_SPD_DDR_HEADER_DRAM_DEVICE_TYPE 5
+#define TMPL_FRU_DIMM_SPD_DDR_HEADER_MODULE_TYPE 6
+#define TMPL_FRU_DIMM_SPD_DDR_HEADER_RESERVED 7
+
+/* tmpl_fru_dimm_spd_ddr3_record */
+#define TMPL_FRU_DIMM_SPD_DDR3_RECORD_SPD_BYTES_USED 0
+#define TMPL_FRU_DIMM_SPD_DDR3_RECORD_SPD_BYTES_TOTAL 1
+#define TMPL_FRU_DIMM_SPD_DDR3_RECORD_CRC_COVERAGE 2
+#define TMPL_FRU_DIMM_SPD_DDR3_RECORD_ADDITIONS_LEVEL 3
+#define TMPL_FRU_DIMM_SPD_DDR3_RECORD_ENCODING_LEVEL 4
+#define TMPL_FRU_DIMM_SPD_DDR3_RECORD_DRAM_DEVICE_TYPE 5
+#define TMPL_FRU_DIMM_SPD_DDR3_RECORD_MODULE_TYPE 6
+#define TMPL_FRU_DIMM_SPD_DDR3_RECORD_RESERVED1 7
+#define TMPL_FRU_DIMM_SPD_DDR3_RECORD_TOTAL_SDRAM_CAPACITY 8
+#define TMPL_FRU_DIMM_SPD_DDR3_RECORD_BANK_ADDRESS_BITS 9
+#define TMPL_FRU_DIMM_SPD_DDR3_RECORD_RESERVED2 10
+#define TMPL_FRU_DIMM_SPD_DDR3_RECORD_COLUMN_ADDRESS_BITS 11
+#define TMPL_FRU_DIMM_SPD_DDR3_RECORD_ROW_ADDRESS_BITS 12
+#define TMPL_FRU_DIMM_SPD_DDR3_RECORD_RESERVED3 13
+#define TMPL_FRU_DIMM_SPD_DDR3_RECORD_MODULE_MINIMUM_NOMINAL_VOLTAGE_1_5 14
+#define TMPL_FRU_DIMM_SPD_DDR3_RECORD_MODULE_MINIMUM_NOMINAL_VOLTAGE_1_35 15
+#define TMPL_FRU_DIMM_SPD_DDR3_RECORD_MODULE_MINIMUM_NOMINAL_VOLTAGE_1_25 16
+#define TMPL_FRU_DIMM_SPD_DDR3_RECORD_RESERVED4 17
+#define TMPL_FRU_DIMM_SPD_DDR3_RECORD_SDRAM_DEVICE_WIDTH 18
+#define TMPL_FRU_DIMM_SPD_DDR3_RECORD_NUMBER_OF_RANKS 19
+#define TMPL_FRU_DIMM_SPD_DDR3_RECORD_RESERVED5 20
+#define TMPL_FRU_DIMM_SPD_DDR3_RECORD_PRIMARY_BUS_WIDTH 21
+#define TMPL_FRU_DIMM_SPD_DDR3_RECORD_BUS_WIDTH_EXTENSION 22
+#define TMPL_FRU_DIMM_SPD_DDR3_RECORD_RESERVE6 23
+#define TMPL_FRU_DIMM_SPD_DDR3_RECORD_FINE_TIMEBASE_DIVISOR 24
+#define TMPL_FRU_DIMM_SPD_DDR3_RECORD_FINE_TIMEBASE_DIVIDEND 25
+#define TMPL_FRU_DIMM_SPD_DDR3_RECORD_MEDIUM_TIMEBASE_DIVIDEND 26
+#define TMPL_FRU_DIMM_SPD_DDR3_RECORD_MEDIUM_TIMEBASE_DIVISOR 27
+#define TMPL_FRU_DIMM_SPD_DDR3_RECORD_MINIMUM_SDRAM_CYCLE_TIME 28
+#define TMPL_FRU_DIMM_SPD_DDR3_RECORD_RESERVED7 29
+#define TMPL_FRU_DIMM_SPD_DDR3_RECORD_CAS_LATENCIES_SUPPORTED 30
+#define TMPL_FRU_DIMM_SPD_DDR3_RECORD_MINIMUM_SDRAM_CAS_LATENCY_TIME 31
+#define TMPL_FRU_DIMM_SPD_DDR3_RECORD_MINIMUM_WRITE_RECOVERY_TIME 32
+#define TMPL_FRU_DIMM_SPD_DDR3_RECORD_MINIMUM_RAS_TO_CAS_DELAY 33
+#define TMPL_FRU_DIMM_SPD_DDR3_RECORD_MINIMUM_ROW_ACTIVE_TO_ROW_ACTIVE_DELAY 34
+#define TMPL_FRU_DIMM_SPD_DDR3_RECORD_MINIMUM_ROW_PRECHARGE_TIME 35
+#define TMPL_FRU_DIMM_SPD_DDR3_RECORD_T_RAS_MSN 36
+#define TMPL_FRU_DIMM_SPD_DDR3_RECORD_T_RC_MSN 37
+#define TMPL_FRU_DIMM_SPD_DDR3_RECORD_MINIMUM_ACTIVE_TO_PRECHARGE_TIME 38
+#define TMPL_FRU_DIMM_SPD_DDR3_RECORD_MINIMUM_ACTIVE_TO_ACTIVE_REFRESH_TIME 39
+#define TMPL_FRU_DIMM_SPD_DDR3_RECORD_MINIMUM_REFRESH_RECOVERY_DELAY_TIME 40
+#define TMPL_FRU_DIMM_SPD_DDR3_RECORD_INTERNAL_WRITE_TO_READ_DELAY_TIME 41
+#define TMPL_FRU_DIMM_SPD_DDR3_RECORD_INTERNAL_READ_TO_PRECHARGE_DELAY_TIME 42
+#define TMPL_FRU_DIMM_SPD_DDR3_RECORD_T_FAW_MSN 43
+#define TMPL_FRU_DIMM_SPD_DDR3_RECORD_RESERVED8 44
+#define TMPL_FRU_DIMM_SPD_DDR3_RECORD_MINIMUM_FOUR_ACTIVE_WINDOW_DELAY_TIME 45
+#define TMPL_FRU_DIMM_SPD_DDR3_RECORD_RZQ_6_SUPPORTED 46
+#define TMPL_FRU_DIMM_SPD_DDR3_RECORD_RZQ_7_SUPPORTED 47
+#define TMPL_FRU_DIMM_SPD_DDR3_RECORD_RESERVED9 48
+#define TMPL_FRU_DIMM_SPD_DDR3_RECORD_DLL_OFF_MODE_SUPPORTED 49
+#define TMPL_FRU_DIMM_SPD_DDR3_RECORD_EXTENDED_TEMPERATURE_RANGE 50
+#define TMPL_FRU_DIMM_SPD_DDR3_RECORD_EXTENDED_TEMPERATURE_REFRESH_RATE 51
+#define TMPL_FRU_DIMM_SPD_DDR3_RECORD_AUTO_SELF_REFRESH 52
+#define TMPL_FRU_DIMM_SPD_DDR3_RECORD_ON_DIE_THERMAL_SENSOR_READOUT 53
+#define TMPL_FRU_DIMM_SPD_DDR3_RECORD_RESERVED10 54
+#define TMPL_FRU_DIMM_SPD_DDR3_RECORD_PARTIAL_ARRAY_SELF_REFRESH 55
+#define TMPL_FRU_DIMM_SPD_DDR3_RECORD_THERMAL_SENSOR_ACCURACY 56
+#define TMPL_FRU_DIMM_SPD_DDR3_RECORD_THERMAL_SENSOR_INCORPORATED 57
+#define TMPL_FRU_DIMM_SPD_DDR3_RECORD_SIGNAL_LOADING 58
+#define TMPL_FRU_DIMM_SPD_DDR3_RECORD_RESERVED11 59
+#define TMPL_FRU_DIMM_SPD_DDR3_RECORD_DIE_COUNT 60
+#define TMPL_FRU_DIMM_SPD_DDR3_RECORD_SDRAM_DEVICE_TYPE 61
+#define TMPL_FRU_DIMM_SPD_DDR3_RECORD_FINE_OFFSET_FOR_SDRAM_MINIMUM_CYCLE_TIME 62
+#define TMPL_FRU_DIMM_SPD_DDR3_RECORD_FINE_OFFSET_FOR_MINIMUM_CAS_LATENCY_TIME 63
+#define TMPL_FRU_DIMM_SPD_DDR3_RECORD_FINE_OFFSET_FOR_MINIMUM_RAS_TO_CAS_DELAY_TIME 64
+#define TMPL_FRU_DIMM_SPD_DDR3_RECORD_MINIMUM_ROW_PRECHARGE_DELAY_TIME 65
+#define TMPL_FRU_DIMM_SPD_DDR3_RECORD_FINE_OFFSET_FOR_MINIMUM_ACTIVE_TO_ACTIVE_REFRESH_DELAY_TIME 66
+#define TMPL_FRU_DIMM_SPD_DDR3_RECORD_RESERVED12 67
+#define TMPL_FRU_DIMM_SPD_DDR3_RECORD_MODULE_SPECIFIC_SECTION 68
+#define TMPL_FRU_DIMM_SPD_DDR3_RECORD_NUMBER_OF_CONTINUATION_CODES_MODULE_MANUFACTURER 69
+#define TMPL_FRU_DIMM_SPD_DDR3_RECORD_ODD_PARITY_BYTE_MODULE_MANUFACTURER 70
+#define TMPL_FRU_DIMM_SPD_DDR3_RECORD_LAST_NON_ZERO_MODULE_MANUFACTURER 71
+#define TMPL_FRU_DIMM_SPD_DDR3_RECORD_MODULE_MANUFACTURING_LOCATION 72
+#define TMPL_FRU_DIMM_SPD_DDR3_RECORD_MODULE_MANUFACTURING_DATE_YEAR 73
+#define TMPL_FRU_DIMM_SPD_DDR3_RECORD_MODULE_MANUFACTURING_DATE_WEEK 74
+#define TMPL_FRU_DIMM_SPD_DDR3_RECORD_MODULE_SERIAL_NUMBER 75
+#define TMPL_FRU_DIMM_SPD_DDR3_RECORD_CRC 76
+#define TMPL_FRU_DIMM_SPD_DDR3_RECORD_MODULE_PART_NUMBER 77
+#define TMPL_FRU_DIMM_SPD_DDR3_RECORD_MODULE_REVISION_CODE 78
+#define TMPL_FRU_DIMM_SPD_DDR3_RECORD_NUMBER_OF_CONTINUATION_CODES_DRAM_MANUFACTURER 79
+#define TMPL_FRU_DIMM_SPD_DDR3_RECORD_ODD_PARITY_BYTE_DRAM_MANUFACTURER 80
+#define TMPL_FRU_DIMM_SPD_DDR3_RECORD_LAST_NON_ZERO_DRAM_MANUFACTURER 81
+#define TMPL_FRU_DIMM_SPD_DDR3_RECORD_MANUFACTURER_SPECIFIC_DATA 82
+#define TMPL_FRU_DIMM_SPD_DDR3_RECORD_OPEN_FOR_CUSTOMER_USE 83
+
+/* tmpl_fru_dimm_spd_ddr4_record */
+#define TMPL_FRU_DIMM_SPD_DDR4_RECORD_SPD_BYTES_USED 0
+#define TMPL_FRU_DIMM_SPD_DDR4_RECORD_SPD_BYTES_TOTAL 1
+#define TMPL_FRU_DIMM_SPD_DDR4_RECORD_RESERVED1 2
+#define TMPL_FRU_DIMM_SPD_DDR4_RECORD_ADDITIONS_LEVEL 3
+#define TMPL_FRU_DIMM_SPD_DDR4_RECORD_ENCODING_LEVEL 4
+#define TMPL_FRU_DIMM_SPD_DDR4_RECORD_DRAM_DEVICE_TYPE 5
+#define TMPL_FRU_DIMM_SPD_DDR4_RECORD_MODULE_TYPE 6
+#define TMPL_FRU_DIMM_SPD_DDR4_RECORD_RESERVED2 7
+#define TMPL_FRU_DIMM_SPD_DDR4_RECORD_TOTAL_SDRAM_CAPACITY 8
+#define TMPL_FRU_DIMM_SPD_DDR4_RECORD_BANK_ADDRESS_BITS 9
+#define TMPL_FRU_DIMM_SPD_DDR4_RECORD_BANK_GROUP_BITS 10
+#define TMPL_FRU_DIMM_SPD_DDR4_RECORD_COLUMN_ADDRESS_BITS 11
+#define TMPL_FRU_DIMM_SPD_DDR4_RECORD_ROW_ADDRESS_BITS 12
+#define TMPL_FRU_DIMM_SPD_DDR4_RECORD_RESERVED3 13
+#define TMPL_FRU_DIMM_SPD_DDR4_RECORD_SIGNAL_LOADING 14
+#define TMPL_FRU_DIMM_SPD_DDR4_RECORD_RESERVED4 15
+#define TMPL_FRU_DIMM_SPD_DDR4_RECORD_DIE_COUNT 16
+#define TMPL_FRU_DIMM_SPD_DDR4_RECORD_SDRAM_PACKAGE_TYPE 17
+#define TMPL_FRU_DIMM_SPD_DDR4_RECORD_MAXIMUM_ACTIVATE_COUNT 18
+#define TMPL_FRU_DIMM_SPD_DDR4_RECORD_MAXIMUM_ACTIVATE_WINDOW 19
+#define TMPL_FRU_DIMM_SPD_DDR4_RECORD_RESERVED5 20
+#define TMPL_FRU_DIMM_SPD_DDR4_RECORD_RESERVED6 21
+#define TMPL_FRU_DIMM_SPD_DDR4_RECORD_RESERVED7 22
+#define TMPL_FRU_DIMM_SPD_DDR4_RECORD_POST_PACKAGE_REPAIR 23
+#define TMPL_FRU_DIMM_SPD_DDR4_RECORD_RESERVED8 24
+#define TMPL_FRU_DIMM_SPD_DDR4_RECORD_MODULE_NOMINAL_VOLTAGE_DRAM_VDD_1_2_OPERABLE 25
+#define TMPL_FRU_DIMM_SPD_DDR4_RECORD_MODULE_NOMINAL_VOLTAGE_DRAM_VDD_1_2_ENDURANT 26
+#define TMPL_FRU_DIMM_SPD_DDR4_RECORD_MODULE_NOMINAL_VOLTAGE_DRAM_VDD_TBD1_OPERABLE 27
+#define TMPL_FRU_DIMM_SPD_DDR4_RECORD_MODULE_NOMINAL_VOLTAGE_DRAM_VDD_TBD1_ENDURANT 28
+#define TMPL_FRU_DIMM_SPD_DDR4_RECORD_MODULE_NOMINAL_VOLTAGE_DRAM_VDD_TBD2_OPERABLE 29
+#define TMPL_FRU_DIMM_SPD_DDR4_RECORD_MODULE_NOMINAL_VOLTAGE_DRAM_VDD_TBD2_ENDURANT 30
+#define TMPL_FRU_DIMM_SPD_DDR4_RECORD_RESERVED9 31
+#define TMPL_FRU_DIMM_SPD_DDR4_RECORD_SDRAM_DEVICE_WIDTH 32
+#define TMPL_FRU_DIMM_SPD_DDR4_RECORD_NUMBER_OF_PACKAGE_RANKS_PER_DIMM 33
+#define TMPL_FRU_DIMM_SPD_DDR4_RECORD_RESERVED10 34
+#define TMPL_FRU_DIMM_SPD_DDR4_RECORD_PRIMARY_BUS_WIDTH 35
+#define TMPL_FRU_DIMM_SPD_DDR4_RECORD_BUS_WIDTH_EXTENSION 36
+#define TMPL_FRU_DIMM_SPD_DDR4_RECORD_RESERVE11 37
+#define TMPL_FRU_DIMM_SPD_DDR4_RECORD_RESERVED12 38
+#define TMPL_FRU_DIMM_SPD_DDR4_RECORD_THERMAL_SENSOR 39
+#define TMPL_FRU_DIMM_SPD_DDR4_RECORD_EXTENDED_BASE_MODULE_TYPE 40
+#define TMPL_FRU_DIMM_SPD_DDR4_RECORD_RESERVED13 41
+#define TMPL_FRU_DIMM_SPD_DDR4_RECORD_RESERVED14 42
+#define TMPL_FRU_DIMM_SPD_DDR4_RECORD_FINE_TIMEBASE 43
+#define TMPL_FRU_DIMM_SPD_DDR4_RECORD_MEDIUM_TIMEBASE 44
+#define TMPL_FRU_DIMM_SPD_DDR4_RECORD_RESERVED15 45
+#define TMPL_FRU_DIMM_SPD_DDR4_RECORD_MINIMUM_SDRAM_CYCLE_TIME 46
+#define TMPL_FRU_DIMM_SPD_DDR4_RECORD_MAXIMUM_SDRAM_CYCLE_TIME 47
+#define TMPL_FRU_DIMM_SPD_DDR4_RECORD_CAS_LATENCIES_SUPPORTED 48
+#define TMPL_FRU_DIMM_SPD_DDR4_RECORD_MINIMUM_SDRAM_CAS_LATENCY_TIME 49
+#define TMPL_FRU_DIMM_SPD_DDR4_RECORD_MINIMUM_SDRAM_RAS_TO_CAS_DELAY_TIME 50
+#define TMPL_FRU_DIMM_SPD_DDR4_RECORD_MINIMUM_ROW_PRECHARGE_TIME 51
+#define TMPL_FRU_DIMM_SPD_DDR4_RECORD_T_RAS_MIN_MSN 52
+#define TMPL_FRU_DIMM_SPD_DDR4_RECORD_T_RC_MIN_MSN 53
+#define TMPL_FRU_DIMM_SPD_DDR4_RECORD_MINIMUM_ACTIVE_TO_PRECHARGE_TIME 54
+#define TMPL_FRU_DIMM_SPD_DDR4_RECORD_MINIMUM_ACTIVE_TO_ACTIVE_REFRESH_TIME 55
+#define TMPL_FRU_DIMM_SPD_DDR4_RECORD_MINIMUM_REFRESH_RECOVERY_DELAY_TIME 56
+#define TMPL_FRU_DIMM_SPD_DDR4_RECORD_MINIMUM_REFRESH_RECOVERY_DELAY_TIME1 57
+#define TMPL_FRU_DIMM_SPD_DDR4_RECORD_MINIMUM_REFRSH_RECOVERY_DELAY_TIME4 58
+#define TMPL_FRU_DIMM_SPD_DDR4_RECORD_TFAW_MSN 59
+#define TMPL_FRU_DIMM_SPD_DDR4_RECORD_RESERVED16 60
+#define TMPL_FRU_DIMM_SPD_DDR4_RECORD_MINIMUM_FOUR_ACTIVATE_WINDOW_DELAY_TIME 61
+#define TMPL_FRU_DIMM_SPD_DDR4_RECORD_MINIMUM_ACTIVE_TO_ACTIVE_REFRESH_TIME_DIFFERENT_BANK_GROUP 62
+#define TMPL_FRU_DIMM_SPD_DDR4_RECORD_MINIMUM_ACTIVE_TO_ACTIVE_REFRESH_TIME_SAME_BANK_GROUP 63
+#define TMPL_FRU_DIMM_SPD_DDR4_RECORD_MINIMUM_CAS_TO_CAS_TIME_SAME_BANK_GROUP 64
+#define TMPL_FRU_DIMM_SPD_DDR4_RECORD_RESERVED17 65
+#define TMPL_FRU_DIMM_SPD_DDR4_RECORD_CONNECTOR_TO_SDRAM_BIT_MAPPING 66
+#define TMPL_FRU_DIMM_SPD_DDR4_RECORD_RESERVED18 67
+#define TMPL_FRU_DIMM_SPD_DDR4_RECORD_FINE_OFFSET_FOR_MINIMUM_CAS_TO_CAS_DELAY_TIME 68
+#define TMPL_FRU_DIMM_SPD_DDR4_RECORD_FINE_OFFSET_FOR_MINIMUM_ACTIVATE_TO_ACTIVATE_DELAY_TIME_SAME_BANK_GROUP 69
+#define TMPL_FRU_DIMM_SPD_DDR4_RECORD_FINE_OFFSET_FOR_MINIMUM_ACTIVATE_TO_ACTIVATE_DELAY_TIME_DIFFERENT_BANK_GROUP 70
+#define TMPL_FRU_DIMM_SPD_DDR4_RECORD_FINE_OFFSET_FOR_MINIMUM_ACTIVATE_TO_ACTIVATE_REFRESH_TIME 71
+#define TMPL_FRU_DIMM_SPD_DDR4_RECORD_FINE_OFFSET_FOR_MINIMUM_ROW_PRECHARGE_DELAY_TIME 72
+#define TMPL_FRU_DIMM_SPD_DDR4_RECORD_FINE_OFFSET_FOR_MINIMUM_RAS_TO_CAS_DELAY_TIME 73
+#define TMPL_FRU_DIMM_SPD_DDR4_RECORD_FINE_OFFSET_FOR_MINIMUM_CAS_LATENCY_TIME 74
+#define TMPL_FRU_DIMM_SPD_DDR4_RECORD_FINE_OFFSET_FOR_SDRAM_MAXIMUM_CYCLE_TIME 75
+#define TMPL_FRU_DIMM_SPD_DDR4_RECORD_FINE_OFFSET_FOR_SDRAM_MINIMUM_CYCLE_TIME 76
+#define TMPL_FRU_DIMM_SPD_DDR4_RECORD_CRC 77
+#define TMPL_FRU_DIMM_SPD_DDR4_RECORD_MODULE_SPECIFIC_SECTIONS 78
+#define TMPL_FRU_DIMM_SPD_DDR4_RECORD_RESERVED19 79
+#define TMPL_FRU_DIMM_SPD_DDR4_RECORD_NUMBER_OF_CONTINUATION_CODES_MODULE_MANUFACTURER 80
+#define TMPL_FRU_DIMM_SPD_DDR4_RECORD_ODD_PARITY_BYTE_MODULE_MANUFACTURER 81
+#define TMPL_FRU_DIMM_SPD_DDR4_RECORD_LAST_NON_ZERO_MODULE_MANUFACTURER 82
+#define TMPL_FRU_DIMM_SPD_DDR4_RECORD_MODULE_MANUFACTURING_LOCATION 83
+#define TMPL_FRU_DIMM_SPD_DDR4_RECORD_MODULE_MANUFACTURING_DATE_YEAR 84
+#define TMPL_FRU_DIMM_SPD_DDR4_RECORD_MODULE_MANUFACTURING_DATE_WEEK 85
+#define TMPL_FRU_DIMM_SPD_DDR4_RECORD_MODULE_SERIAL_NUMBER 86
+#define TMPL_FRU_DIMM_SPD_DDR4_RECORD_MODULE_PART_NUMBER 87
+#define TMPL_FRU_DIMM_SPD_DDR4_RECORD_MODULE_REVISION_CODE 88
+#define TMPL_FRU_DIMM_SPD_DDR4_RECORD_NUMBER_OF_CONTINUATION_CODES_DRAM_MANUFACTURER 89
+#define TMPL_FRU_DIMM_SPD_DDR4_RECORD_ODD_PARITY_BYTE_DRAM_MANUFACTURER 90
+#define TMPL_FRU_DIMM_SPD_DDR4_RECORD_LAST_NON_ZERO_DRAM_MANUFACTURER 91
+#define TMPL_FRU_DIMM_SPD_DDR4_RECORD_DRAM_STEPPING 92
+#define TMPL_FRU_DIMM_SPD_DDR4_RECORD_MODULE_MANUFACTURER_SPECIFIC_DATA 93
+#define TMPL_FRU_DIMM_SPD_DDR4_RECORD_RESERVED20 94
+#define TMPL_FRU_DIMM_SPD_DDR4_RECORD_END_USER_PROGRAMMABLE 95
+
+/* tmpl_fru_dimm_spd_ddr4_module_specific_unbuffered_memory_module */
+#define TMPL_FRU_DIMM_SPD_DDR4_MODULE_SPECIFIC_UNBUFFERED_MEMORY_MODULE_MODULE_NOMINAL_HEIGHT 0
+#define TMPL_FRU_DIMM_SPD_DDR4_MODULE_SPECIFIC_UNBUFFERED_MEMORY_MODULE_RAW_CARD_EXTENSION 1
+#define TMPL_FRU_DIMM_SPD_DDR4_MODULE_SPECIFIC_UNBUFFERED_MEMORY_MODULE_MODULE_MAXIMUM_THICKNESS_FRONT 2
+#define TMPL_FRU_DIMM_SPD_DDR4_MODULE_SPECIFIC_UNBUFFERED_MEMORY_MODULE_MODULE_MAXIMUM_THICKNESS_BACK 3
+#define TMPL_FRU_DIMM_SPD_DDR4_MODULE_SPECIFIC_UNBUFFERED_MEMORY_MODULE_REFERENCE_RAW_CARD 4
+#define TMPL_FRU_DIMM_SPD_DDR4_MODULE_SPECIFIC_UNBUFFERED_MEMORY_MODULE_REFERENCE_RAW_CARD_REVISION 5
+#define TMPL_FRU_DIMM_SPD_DDR4_MODULE_SPECIFIC_UNBUFFERED_MEMORY_MODULE_REFERENCE_RAW_CARD_EXTENSION 6
+#define TMPL_FRU_DIMM_SPD_DDR4_MODULE_SPECIFIC_UNBUFFERED_MEMORY_MODULE_RANK_1_MAPPING 7
+#define TMPL_FRU_DIMM_SPD_DDR4_MODULE_SPECIFIC_UNBUFFERED_MEMORY_MODULE_RESERVED1 8
+#define TMPL_FRU_DIMM_SPD_DDR4_MODULE_SPECIFIC_UNBUFFERED_MEMORY_MODULE_RESERVED2 9
+#define TMPL_FRU_DIMM_SPD_DDR4_MODULE_SPECIFIC_UNBUFFERED_MEMORY_MODULE_CRC 10
+
+/* tmpl_fru_dimm_spd_ddr4_module_specific_registered_memory_module */
+#define TMPL_FRU_DIMM_SPD_DDR4_MODULE_SPECIFIC_REGISTERED_MEMORY_MODULE_MODULE_NOMINAL_HEIGHT 0
+#define TMPL_FRU_DIMM_SPD_DDR4_MODULE_SPECIFIC_REGISTERED_MEMORY_MODULE_RAW_CARD_EXTENSION 1
+#define TMPL_FRU_DIMM_SPD_DDR4_MODULE_SPECIFIC_REGISTERED_MEMORY_MODULE_MODULE_MAXIMUM_THICKNESS_FRONT 2
+#define TMPL_FRU_DIMM_SPD_DDR4_MODULE_SPECIFIC_REGISTERED_MEMORY_MODULE_MODULE_MAXIMUM_THICKNESS_BACK 3
+#define TMPL_FRU_DIMM_SPD_DDR4_MODULE_SPECIFIC_REGISTERED_MEMORY_MODULE_REFERENCE_RAW_CARD 4
+#define TMPL_FRU_DIMM_SPD_DDR4_MODULE_SPECIFIC_REGISTERED_MEMORY_MODULE_REFERENCE_RAW_CARD_REVISION 5
+#define TMPL_FRU_DIMM_SPD_DDR4_MODULE_SPECIFIC_REGISTERED_MEMORY_MODULE_REFERENCE_RAW_CARD_EXTENSION 6
+#define TMPL_FRU_DIMM_SPD_DDR4_MODULE_SPECIFIC_REGISTERED_MEMORY_MODULE_NUMBER_OF_REGISTERS_USED_ON_RDIMM 7
+#define TMPL_FRU_DIMM_SPD_DDR4_MODULE_SPECIFIC_REGISTERED_MEMORY_MODULE_NUMBER_OF_ROWS_OF_DRAMS_ON_RDIMM 8
+#define TMPL_FRU_DIMM_SPD_DDR4_MODULE_SPECIFIC_REGISTERED_MEMORY_MODULE_RESERVED1 9
+#define TMPL_FRU_DIMM_SPD_DDR4_MODULE_SPECIFIC_REGISTERED_MEMORY_MODULE_HEAT_SPREADER_THERMAL_CHARACTERISTICS 10
+#define TMPL_FRU_DIMM_SPD_DDR4_MODULE_SPECIFIC_REGISTERED_MEMORY_MODULE_HEAT_SPREADER_SOLUTION 11
+#define TMPL_FRU_DIMM_SPD_DDR4_MODULE_SPECIFIC_REGISTERED_MEMORY_MODULE_NUMBER_OF_CONTINUATION_CODES_REGISTER_MANUFACTURER 12
+#define TMPL_FRU_DIMM_SPD_DDR4_MODULE_SPECIFIC_REGISTERED_MEMORY_MODULE_ODD_PARITY_BYTE_REGISTER_MANUFACTURER 13
+#define TMPL_FRU_DIMM_SPD_DDR4_MODULE_SPECIFIC_REGISTERED_MEMORY_MODULE_LAST_NON_ZERO_REGISTER_MANUFACTURER 14
+#define TMPL_FRU_DIMM_SPD_DDR4_MODULE_SPECIFIC_REGISTERED_MEMORY_MODULE_REGISTER_REVISION_NUMBER 15
+#define TMPL_FRU_DIMM_SPD_DDR4_MODULE_SPECIFIC_REGISTERED_MEMORY_MODULE_RANK_1_MAPPING 16
+#define TMPL_FRU_DIMM_SPD_DDR4_MODULE_SPECIFIC_REGISTERED_MEMORY_MODULE_RESERVED2 17
+#define TMPL_FRU_DIMM_SPD_DDR4_MODULE_SPECIFIC_REGISTERED_MEMORY_MODULE_CKE 18
+#define TMPL_FRU_DIMM_SPD_DDR4_MODULE_SPECIFIC_REGISTERED_MEMORY_MODULE_ODT 19
+#define TMPL_FRU_DIMM_SPD_DDR4_MODULE_SPECIFIC_REGISTERED_MEMORY_MODULE_COMMAND_ADDRESS 20
+#define TMPL_FRU_DIMM_SPD_DDR4_MODULE_SPECIFIC_REGISTERED_MEMORY_MODULE_CHIP_SELECT 21
+#define TMPL_FRU_DIMM_SPD_DDR4_MODULE_SPECIFIC_REGISTERED_MEMORY_MODULE_Y0_Y2 22
+#define TMPL_FRU_DIMM_SPD_DDR4_MODULE_SPECIFIC_REGISTERED_MEMORY_MODULE_Y1_Y3 23
+#define TMPL_FRU_DIMM_SPD_DDR4_MODULE_SPECIFIC_REGISTERED_MEMORY_MODULE_RESERVED3 24
+#define TMPL_FRU_DIMM_SPD_DDR4_MODULE_SPECIFIC_REGISTERED_MEMORY_MODULE_RESERVED4 25
+#define TMPL_FRU_DIMM_SPD_DDR4_MODULE_SPECIFIC_REGISTERED_MEMORY_MODULE_CRC 26
+
+/* tmpl_fru_dimm_spd_ddr4_module_specific_load_reduction_memory_module */
+#define TMPL_FRU_DIMM_SPD_DDR4_MODULE_SPECIFIC_LOAD_REDUCTION_MEMORY_MODULE_MODULE_NOMINAL_HEIGHT 0
+#define TMPL_FRU_DIMM_SPD_DDR4_MODULE_SPECIFIC_LOAD_REDUCTION_MEMORY_MODULE_RAW_CARD_EXTENSION 1
+#define TMPL_FRU_DIMM_SPD_DDR4_MODULE_SPECIFIC_LOAD_REDUCTION_MEMORY_MODULE_MODULE_MAXIMUM_THICKNESS_FRONT 2
+#define TMPL_FRU_DIMM_SPD_DDR4_MODULE_SPECIFIC_LOAD_REDUCTION_MEMORY_MODULE_MODULE_MAXIMUM_THICKNESS_BACK 3
+#define TMPL_FRU_DIMM_SPD_DDR4_MODULE_SPECIFIC_LOAD_REDUCTION_MEMORY_MODULE_REFERENCE_RAW_CARD 4
+#define TMPL_FRU_DIMM_SPD_DDR4_MODULE_SPECIFIC_LOAD_REDUCTION_MEMORY_MODULE_REFERENCE_RAW_CARD_REVISION 5
+#define TMPL_FRU_DIMM_SPD_DDR4_MODULE_SPECIFIC_LOAD_REDUCTION_MEMORY_MODULE_REFERENCE_RAW_CARD_EXTENSION 6
+#define TMPL_FRU_DIMM_SPD_DDR4_MODULE_SPECIFIC_LOAD_REDUCTION_MEMORY_MODULE_NUMBER_OF_REGISTERS_USED_ON_LRDIMM 7
+#define TMPL_FRU_DIMM_SPD_DDR4_MODULE_SPECIFIC_LOAD_REDUCTION_MEMORY_MODULE_NUMBER_OF_ROWS_OF_DRAMS_ON_LRDIMM 8
+#define TMPL_FRU_DIMM_SPD_DDR4_MODULE_SPECIFIC_LOAD_REDUCTION_MEMORY_MODULE_RESERVED1 9
+#define TMPL_FRU_DIMM_SPD_DDR4_MODULE_SPECIFIC_LOAD_REDUCTION_MEMORY_MODULE_HEAT_SPREADER_THERMAL_CHARACTERISTICS 10
+#define TMPL_FRU_DIMM_SPD_DDR4_MODULE_SPECIFIC_LOAD_REDUCTION_MEMORY_MODULE_HEAT_SPREADER_SOLUTION 11
+#define TMPL_FRU_DIMM_SPD_DDR4_MODULE_SPECIFIC_LOAD_REDUCTION_MEMORY_MODULE_NUMBER_OF_CONTINUATION_CODES_MEMORY_BUFFER_MANUFACTURER 12
+#define TMPL_FRU_DIMM_SPD_DDR4_MODULE_SPECIFIC_LOAD_REDUCTION_MEMORY_MODULE_ODD_PARITY_BYTE_MEMORY_BUFFER_MANUFACTURER 13
+#define TMPL_FRU_DIMM_SPD_DDR4_MODULE_SPECIFIC_LOAD_REDUCTION_MEMORY_MODULE_LAST_NON_ZERO_MEMORY_BUFFER_MANUFACTURER 14
+#define TMPL_FRU_DIMM_SPD_DDR4_MODULE_SPECIFIC_LOAD_REDUCTION_MEMORY_MODULE_REGISTER_REVISION_NUMBER 15
+#define TMPL_FRU_DIMM_SPD_DDR4_MODULE_SPECIFIC_LOAD_REDUCTION_MEMORY_MODULE_ODD_RANK_MAPPING 16
+#define TMPL_FRU_DIMM_SPD_DDR4_MODULE_SPECIFIC_LOAD_REDUCTION_MEMORY_MODULE_RESERVED2 17
+#define TMPL_FRU_DIMM_SPD_DDR4_MODULE_SPECIFIC_LOAD_REDUCTION_MEMORY_MODULE_CKE 18
+#define TMPL_FRU_DIMM_SPD_DDR4_MODULE_SPECIFIC_LOAD_REDUCTION_MEMORY_MODULE_ODT 19
+#define TMPL_FRU_DIMM_SPD_DDR4_MODULE_SPECIFIC_LOAD_REDUCTION_MEMORY_MODULE_COMMAND_ADDRESS 20
+#define TMPL_FRU_DIMM_SPD_DDR4_MODULE_SPECIFIC_LOAD_REDUCTION_MEMORY_MODULE_CHIP_SELECT 21
+#define TMPL_FRU_DIMM_SPD_DDR4_MODULE_SPECIFIC_LOAD_REDUCTION_MEMORY_MODULE_Y0_Y2 22
+#define TMPL_FRU_DIMM_SPD_DDR4_MODULE_SPECIFIC_LOAD_REDUCTION_MEMORY_MODULE_Y1_Y3 23
+#define TMPL_FRU_DIMM_SPD_DDR4_MODULE_SPECIFIC_LOAD_REDUCTION_MEMORY_MODULE_RESERVED3 24
+#define TMPL_FRU_DIMM_SPD_DDR4_MODULE_SPECIFIC_LOAD_REDUCTION_MEMORY_MODULE_DRIVE_BUFFER_REVISION_NUMBER 25
+#define TMPL_FRU_DIMM_SPD_DDR4_MODULE_SPECIFIC_LOAD_REDUCTION_MEMORY_MODULE_DRAM_VREFQ_FOR_PACKAGE_RANK0_DRAMS 26
+#define TMPL_FRU_DIMM_SPD_DDR4_MODULE_SPECIFIC_LOAD_REDUCTION_MEMORY_MODULE_RESERVED4 27
+#define TMPL_FRU_DIMM_SPD_DDR4_MODULE_SPECIFIC_LOAD_REDUCTION_MEMORY_MODULE_DRAM_VREFQ_FOR_PACKAGE_RANK1_DRAMS 28
+#define TMPL_FRU_DIMM_SPD_DDR4_MODULE_SPECIFIC_LOAD_REDUCTION_MEMORY_MODULE_RESERVED5 29
+#define TMPL_FRU_DIMM_SPD_DDR4_MODULE_SPECIFIC_LOAD_REDUCTION_MEMORY_MODULE_DRAM_VREFQ_FOR_PACKAGE_RANK2_DRAMS 30
+#define TMPL_FRU_DIMM_SPD_DDR4_MODULE_SPECIFIC_LOAD_REDUCTION_MEMORY_MODULE_RESERVED6 31
+#define TMPL_FRU_DIMM_SPD_DDR4_MODULE_SPECIFIC_LOAD_REDUCTION_MEMORY_MODULE_DRAM_VREFQ_FOR_PACKAGE_RANK3_DRAMS 32
+#define TMPL_FRU_DIMM_SPD_DDR4_MODULE_SPECIFIC_LOAD_REDUCTION_MEMORY_MODULE_RESERVED7 33
+#define TMPL_FRU_DIMM_SPD_DDR4_MODULE_SPECIFIC_LOAD_REDUCTION_MEMORY_MODULE_DATA_BUFFER_VREFQ_FOR_DRAM 34
+#define TMPL_FRU_DIMM_SPD_DDR4_MODULE_SPECIFIC_LOAD_REDUCTION_MEMORY_MODULE_DRAM_INTERFACE_MDQ_READ_TERMINATION_STRENGTH_LT_1866 35
+#define TMPL_FRU_DIMM_SPD_DDR4_MODULE_SPECIFIC_LOAD_REDUCTION_MEMORY_MODULE_RESERVED8 36
+#define TMPL_FRU_DIMM_SPD_DDR4_MODULE_SPECIFIC_LOAD_REDUCTION_MEMORY_MODULE_DRAM_INTERFACE_MDQ_DRIVE_STRENGTH_LT_1866 37
+#define TMPL_FRU_DIMM_SPD_DDR4_MODULE_SPECIFIC_LOAD_REDUCTION_MEMORY_MODULE_RESERVED9 38
+#define TMPL_FRU_DIMM_SPD_DDR4_MODULE_SPECIFIC_LOAD_REDUCTION_MEMORY_MODULE_DRAM_INTERFACE_MDQ_READ_TERMINATION_STRENGTH_LT_2400 39
+#define TMPL_FRU_DIMM_SPD_DDR4_MODULE_SPECIFIC_LOAD_REDUCTION_MEMORY_MODULE_RESERVED10 40
+#define TMPL_FRU_DIMM_SPD_DDR4_MODULE_SPECIFIC_LOAD_REDUCTION_MEMORY_MODULE_DRAM_INTERFACE_MDQ_DRIVE_STRENGTH_LT_2400 41
+#define TMPL_FRU_DIMM_SPD_DDR4_MODULE_SPECIFIC_LOAD_REDUCTION_MEMORY_MODULE_RESERVED11 42
+#define TMPL_FRU_DIMM_SPD_DDR4_MODULE_SPECIFIC_LOAD_REDUCTION_MEMORY_MODULE_DRAM_INTERFACE_MDQ_READ_TERMINATION_STRENGTH_LT_3200 43
+#define TMPL_FRU_DIMM_SPD_DDR4_MODULE_SPECIFIC_LOAD_REDUCTION_MEMORY_MODULE_RESERVED12 44
+#define TMPL_FRU_DIMM_SPD_DDR4_MODULE_SPECIFIC_LOAD_REDUCTION_MEMORY_MODULE_DRAM_INTERFACE_MDQ_DRIVE_STRENGTH_LT_3200 45
+#define TMPL_FRU_DIMM_SPD_DDR4_MODULE_SPECIFIC_LOAD_REDUCTION_MEMORY_MODULE_RESERVED13 46
+#define TMPL_FRU_DIMM_SPD_DDR4_MODULE_SPECIFIC_LOAD_REDUCTION_MEMORY_MODULE_DRAM_DRIVE_STRENGTH_LT_1866 47
+#define TMPL_FRU_DIMM_SPD_DDR4_MODULE_SPECIFIC_LOAD_REDUCTION_MEMORY_MODULE_DRAM_DRIVE_STRENGTH_LT_2400 48
+#define TMPL_FRU_DIMM_SPD_DDR4_MODULE_SPECIFIC_LOAD_REDUCTION_MEMORY_MODULE_DRAM_DRIVE_STRENGTH_LT_3200 49
+#define TMPL_FRU_DIMM_SPD_DDR4_MODULE_SPECIFIC_LOAD_REDUCTION_MEMORY_MODULE_RESERVED14 50
+#define TMPL_FRU_DIMM_SPD_DDR4_MODULE_SPECIFIC_LOAD_REDUCTION_MEMORY_MODULE_DRAM_ODT_STRENGTH_RTT_NOM_LT_1866 51
+#define TMPL_FRU_DIMM_SPD_DDR4_MODULE_SPECIFIC_LOAD_REDUCTION_MEMORY_MODULE_DRAM_ODT_STRENGTH_RTT_WR_LT_1866 52
+#define TMPL_FRU_DIMM_SPD_DDR4_MODULE_SPECIFIC_LOAD_REDUCTION_MEMORY_MODULE_RESERVED15 53
+#define TMPL_FRU_DIMM_SPD_DDR4_MODULE_SPECIFIC_LOAD_REDUCTION_MEMORY_MODULE_DRAM_ODT_STRENGTH_RTT_NOM_LT_2400 54
+#define TMPL_FRU_DIMM_SPD_DDR4_MODULE_SPECIFIC_LOAD_REDUCTION_MEMORY_MODULE_DRAM_ODT_STRENGTH_RTT_WR_LT_2400 55
+#define TMPL_FRU_DIMM_SPD_DDR4_MODULE_SPECIFIC_LOAD_REDUCTION_MEMORY_MODULE_RESERVED16 56
+#define TMPL_FRU_DIMM_SPD_DDR4_MODULE_SPECIFIC_LOAD_REDUCTION_MEMORY_MODULE_DRAM_ODT_STRENGTH_RTT_NOM_LT_3200 57
+#define TMPL_FRU_DIMM_SPD_DDR4_MODULE_SPECIFIC_LOAD_REDUCTION_MEMORY_MODULE_DRAM_ODT_STRENGTH_RTT_WR_LT_3200 58
+#define TMPL_FRU_DIMM_SPD_DDR4_MODULE_SPECIFIC_LOAD_REDUCTION_MEMORY_MODULE_RESERVED17 59
+#define TMPL_FRU_DIMM_SPD_DDR4_MODULE_SPECIFIC_LOAD_REDUCTION_MEMORY_MODULE_DRAM_ODT_STRENGTH_RTT_PARK_RANKS_0_1_LT_1866 60
+#define TMPL_FRU_DIMM_SPD_DDR4_MODULE_SPECIFIC_LOAD_REDUCTION_MEMORY_MODULE_DRAM_ODT_STRENGTH_RTT_PARK_RANKS_2_3_LT_1866 61
+#define TMPL_FRU_DIMM_SPD_DDR4_MODULE_SPECIFIC_LOAD_REDUCTION_MEMORY_MODULE_RESERVED18 62
+#define TMPL_FRU_DIMM_SPD_DDR4_MODULE_SPECIFIC_LOAD_REDUCTION_MEMORY_MODULE_DRAM_ODT_STRENGTH_RTT_PARK_RANKS_0_1_LT_2400 63
+#define TMPL_FRU_DIMM_SPD_DDR4_MODULE_SPECIFIC_LOAD_REDUCTION_MEMORY_MODULE_DRAM_ODT_STRENGTH_RTT_PARK_RANKS_2_3_LT_2400 64
+#define TMPL_FRU_DIMM_SPD_DDR4_MODULE_SPECIFIC_LOAD_REDUCTION_MEMORY_MODULE_RESERVED19 65
+#define TMPL_FRU_DIMM_SPD_DDR4_MODULE_SPECIFIC_LOAD_REDUCTION_MEMORY_MODULE_DRAM_ODT_STRENGTH_RTT_PARK_RANKS_0_1_LT_3200 66
+#define TMPL_FRU_DIMM_SPD_DDR4_MODULE_SPECIFIC_LOAD_REDUCTION_MEMORY_MODULE_DRAM_ODT_STRENGTH_RTT_PARK_RANKS_2_3_LT_3200 67
+#define TMPL_FRU_DIMM_SPD_DDR4_MODULE_SPECIFIC_LOAD_REDUCTION_MEMORY_MODULE_RESERVED20 68
+#define TMPL_FRU_DIMM_SPD_DDR4_MODULE_SPECIFIC_LOAD_REDUCTION_MEMORY_MODULE_CRC 70
+
+/* tmpl_fru_common_header */
+#define TMPL_FRU_COMMON_HEADER_FORMAT_VERSION 0
+#define TMPL_FRU_COMMON_HEADER_RESERVED 1
+#define TMPL_FRU_COMMON_HEADER_INTERNAL_USE_AREA_STARTING_OFFSET 2
+#define TMPL_FRU_COMMON_HEADER_CHASSIS_INFO_AREA_STARTING_OFFSET 3
+#define TMPL_FRU_COMMON_HEADER_BOARD_INFO_AREA_STARTING_OFFSET 4
+#define TMPL_FRU_COMMON_HEADER_PRODUCT_INFO_AREA_STARTING_OFFSET 5
+#define TMPL_FRU_COMMON_HEADER_MULTIRECORD_AREA_STARTING_OFFSET 6
+#define TMPL_FRU_COMMON_HEADER_PAD 7
+#define TMPL_FRU_COMMON_HEADER_CHECKSUM 8
+
+/* tmpl_fru_info_area_header */
+#define TMPL_FRU_INFO_AREA_HEADER_FORMAT_VERSION 0
+#define TMPL_FRU_INFO_AREA_HEADER_RESERVED 1
+#define TMPL_FRU_INFO_AREA_HEADER_INFO_AREA_LENGTH 2
+
+/* tmpl_fru_multirecord_area_header */
+#define TMPL_FRU_MULTIRECORD_AREA_HEADER_RECORD_TYPE_ID 0
+#define TMPL_FRU_MULTIRECORD_AREA_HEADER_RECORD_FORMAT_VERSION 1
+#define TMPL_FRU_MULTIRECORD_AREA_HEADER_RESERVED 2
+#define TMPL_FRU_MULTIRECORD_AREA_HEADER_END_OF_LIST 3
+#define TMPL_FRU_MULTIRECORD_AREA_HEADER_RECORD_LENGTH 4
+#define TMPL_FRU_MULTIRECORD_AREA_HEADER_RECORD_CHECKSUM 5
+#define TMPL_FRU_MULTIRECORD_AREA_HEADER_HEADER_CHECKSUM 6
+
+/* tmpl_fru_power_supply_information */
+#define TMPL_FRU_POWER_SUPPLY_INFORMATION_OVERALL_CAPACITY 0
+#define TMPL_FRU_POWER_SUPPLY_INFORMATION_RESERVED1 1
+#define TMPL_FRU_POWER_SUPPLY_INFORMATION_PEAK_VA 2
+#define TMPL_FRU_POWER_SUPPLY_INFORMATION_INRUSH_CURRENT 3
+#define TMPL_FRU_POWER_SUPPLY_INFORMATION_INRUSH_INTERVAL 4
+#define TMPL_FRU_POWER_SUPPLY_INFORMATION_LOW_END_INPUT_VOLTAGE_RANGE_1 5
+#define TMPL_FRU_POWER_SUPPLY_INFORMATION_HIGH_END_INPUT_VOLTAGE_RANGE_1 6
+#define TMPL_FRU_POWER_SUPPLY_INFORMATION_LOW_END_INPUT_VOLTAGE_RANGE_2 7
+#define TMPL_FRU_POWER_SUPPLY_INFORMATION_HIGH_END_INPUT_VOLTAGE_RANGE_2 8
+#define TMPL_FRU_POWER_SUPPLY_INFORMATION_LOW_END_INPUT_FREQUENCY_RANGE 9
+#define TMPL_FRU_POWER_SUPPLY_INFORMATION_HIGH_END_INPUT_FREQUENCY_RANGE 10
+#define TMPL_FRU_POWER_SUPPLY_INFORMATION_AC_DROPOUT_TOLERANCE 11
+#define TMPL_FRU_POWER_SUPPLY_INFORMATION_PREDICTIVE_FAIL_SUPPORT 12
+#define TMPL_FRU_POWER_SUPPLY_INFORMATION_POWER_FACTOR_CORRECTION 13
+#define TMPL_FRU_POWER_SUPPLY_INFORMATION_AUTOSWITCH 14
+#define TMPL_FRU_POWER_SUPPLY_INFORMATION_HOT_SWAP_SUPPORT 15
+#define TMPL_FRU_POWER_SUPPLY_INFORMATION_TACHOMETER_PULSES_PER_ROTATION_PREDICTIVE_FAIL_POLARITY 16
+#define TMPL_FRU_POWER_SUPPLY_INFORMATION_RESERVED2 17
+#define TMPL_FRU_POWER_SUPPLY_INFORMATION_PEAK_CAPACITY 18
+#define TMPL_FRU_POWER_SUPPLY_INFORMATION_HOLD_UP_TIME 19
+#define TMPL_FRU_POWER_SUPPLY_INFORMATION_VOLTAGE_2 20
+#define TMPL_FRU_POWER_SUPPLY_INFORMATION_VOLTAGE_1 21
+#define TMPL_FRU_POWER_SUPPLY_INFORMATION_TOTAL_COMBINED_WATTAGE 22
+#define TMPL_FRU_POWER_SUPPLY_INFORMATION_PREDICTIVE_FAIL_TACHOMETER_LOWER_THRESHOLD 23
+
+/* tmpl_fru_dc_output */
+#define TMPL_FRU_DC_OUTPUT_OUTPUT_NUMBER 0
+#define TMPL_FRU_DC_OUTPUT_RESERVED 1
+#define TMPL_FRU_DC_OUTPUT_STANDBY 2
+#define TMPL_FRU_DC_OUTPUT_NOMINAL_VOLTAGE 3
+#define TMPL_FRU_DC_OUTPUT_MAXIMUM_NEGATIVE_VOLTAGE_DEVIATION 4
+#define TMPL_FRU_DC_OUTPUT_MAXIMUM_POSITIVE_VOLTAGE_DEVIATION 5
+#define TMPL_FRU_DC_OUTPUT_RIPPLE_AND_NOISE_PK_PK 6
+#define TMPL_FRU_DC_OUTPUT_MINIMUM_CURRENT_DRAW 7
+#define TMPL_FRU_DC_OUTPUT_MAXIMUM_CURRENT_DRAW 8
+
+/* tmpl_fru_dc_load */
+#define TMPL_FRU_DC_LOAD_OUTPUT_NUMBER 0
+#define TMPL_FRU_DC_LOAD_RESERVED 1
+#define TMPL_FRU_DC_LOAD_NOMINAL_VOLTAGE 2
+#define TMPL_FRU_DC_LOAD_SPECD_MINIMUM_VOLTAGE 3
+#define TMPL_FRU_DC_LOAD_SPECD_MAXIMUM_VOLTAGE 4
+#define TMPL_FRU_DC_LOAD_SPECD_RIPPLE_AND_NOISE_PK_PK 5
+#define TMPL_FRU_DC_LOAD_MINIMUM_CURRENT_LOAD 6
+#define TMPL_FRU_DC_LOAD_MAXIMUM_CURRENT_LOAD 7
+
+/* tmpl_fru_management_access_record */
+#define TMPL_FRU_MANAGEMENT_ACCESS_RECORD_SUB_RECORD_TYPE 0
+#define TMPL_FRU_MANAGEMENT_ACCESS_RECORD_RECORD 1
+
+/* tmpl_fru_base_compatibility_record */
+#define TMPL_FRU_BASE_COMPATIBILITY_RECORD_MANUFACTURER_ID 0
+#define TMPL_FRU_BASE_COMPATIBILITY_RECORD_ENTITY_ID_CODE 1
+#define TMPL_FRU_BASE_COMPATIBILITY_RECORD_COMPATIBILITY_BASE 2
+#define TMPL_FRU_BASE_COMPATIBILITY_RECORD_COMPATIBILITY_CODE_START_VALUE 3
+#define TMPL_FRU_BASE_COMPATIBILITY_RECORD_RESERVED 4
+#define TMPL_FRU_BASE_COMPATIBILITY_RECORD_CODE_RANGE_MASK 5
+
+/* tmpl_fru_extended_compatibility_record */
+#define TMPL_FRU_EXTENDED_COMPATIBILITY_RECORD_MANUFACTURER_ID 0
+#define TMPL_FRU_EXTENDED_COMPATIBILITY_RECORD_ENTITY_ID_CODE 1
+#define TMPL_FRU_EXTENDED_COMPATIBILITY_RECORD_COMPATIBILITY_BASE 2
+#define TMPL_FRU_EXTENDED_COMPATIBILITY_RECORD_COMPATIBILITY_CODE_START_VALUE 3
+#define TMPL_FRU_EXTENDED_COMPATIBILITY_RECORD_RESERVED 4
+#define TMPL_FRU_EXTENDED_COMPATIBILITY_RECORD_CODE_RANGE_MASK 5
+
+/* tmpl_fru_extended_dc_output */
+#define TMPL_FRU_EXTENDED_DC_OUTPUT_OUTPUT_NUMBER 0
+#define TMPL_FRU_EXTENDED_DC_OUTPUT_CURRENT_UNITS 1
+#define TMPL_FRU_EXTENDED_DC_OUTPUT_RESERVED 2
+#define TMPL_FRU_EXTENDED_DC_OUTPUT_STANDBY 3
+#define TMPL_FRU_EXTENDED_DC_OUTPUT_NOMINAL_VOLTAGE 4
+#define TMPL_FRU_EXTENDED_DC_OUTPUT_MAXIMUM_NEGATIVE_VOLTAGE_DEVIATION 5
+#define TMPL_FRU_EXTENDED_DC_OUTPUT_MAXIMUM_POSITIVE_VOLTAGE_DEVIATION 6
+#define TMPL_FRU_EXTENDED_DC_OUTPUT_RIPPLE_AND_NOISE_PK_PK 7
+#define TMPL_FRU_EXTENDED_DC_OUTPUT_MINIMUM_CURRENT_DRAW 8
+#define TMPL_FRU_EXTENDED_DC_OUTPUT_MAXIMUM_CURRENT_DRAW 9
+
+/* tmpl_fru_extended_dc_load */
+#define TMPL_FRU_EXTENDED_DC_LOAD_OUTPUT_NUMBER 0
+#define TMPL_FRU_EXTENDED_DC_LOAD_CURRENT_UNITS 1
+#define TMPL_FRU_EXTENDED_DC_LOAD_RESERVED 2
+#define TMPL_FRU_EXTENDED_DC_LOAD_NOMINAL_VOLTAGE 3
+#define TMPL_FRU_EXTENDED_DC_LOAD_SPECD_MINIMUM_VOLTAGE 4
+#define TMPL_FRU_EXTENDED_DC_LOAD_SPECD_MAXIMUM_VOLTAGE 5
+#define TMPL_FRU_EXTENDED_DC_LOAD_SPECD_RIPPLE_AND_NOISE_PK_PK 6
+#define TMPL_FRU_EXTENDED_DC_LOAD_MINIMUM_CURRENT_LOAD 7
+#define TMPL_FRU_EXTENDED_DC_LOAD_MAXIMUM_CURRENT_LOAD 8
+
+/* tmpl_fru_oem_record */
+#define TMPL_FRU_OEM_RECORD_MANUFACTURER_ID 0
+#define TMPL_FRU_OEM_RECORD_OEM_DATA 1
+
+/* tmpl_sdr_oem_intel_node_manager_record */
+#define TMPL_SDR_OEM_INTEL_NODE_MANAGER_RECORD_RECORD_ID 0
+#define TMPL_SDR_OEM_INTEL_NODE_MANAGER_RECORD_SDR_VERSION_MAJOR 1
+#define TMPL_SDR_OEM_INTEL_NODE_MANAGER_RECORD_SDR_VERSION_MINOR 2
+#define TMPL_SDR_OEM_INTEL_NODE_MANAGER_RECORD_RECORD_TYPE 3
+#define TMPL_SDR_OEM_INTEL_NODE_MANAGER_RECORD_RECORD_LENGTH 4
+#define TMPL_SDR_OEM_INTEL_NODE_MANAGER_RECORD_MANUFACTURER_ID 5
+#define TMPL_SDR_OEM_INTEL_NODE_MANAGER_RECORD_RECORD_SUBTYPE 6
+#define TMPL_SDR_OEM_INTEL_NODE_MANAGER_RECORD_VERSION_NUMBER 7
+#define TMPL_SDR_OEM_INTEL_NODE_MANAGER_RECORD_RESERVED1 8
+#define TMPL_SDR_OEM_INTEL_NODE_MANAGER_RECORD_NM_DEVICE_SLAVE_ADDRESS 9
+#define TMPL_SDR_OEM_INTEL_NODE_MANAGER_RECORD_SENSOR_OWNER_LUN 10
+#define TMPL_SDR_OEM_INTEL_NODE_MANAGER_RECORD_RESERVED2 11
+#define TMPL_SDR_OEM_INTEL_NODE_MANAGER_RECORD_CHANNEL_NUMBER 12
+#define TMPL_SDR_OEM_INTEL_NODE_MANAGER_RECORD_NM_HEALTH_EVENT_SENSOR_NUMBER 13
+#define TMPL_SDR_OEM_INTEL_NODE_MANAGER_RECORD_NM_EXCEPTION_EVENT_SENSOR_NUMBER 14
+#define TMPL_SDR_OEM_INTEL_NODE_MANAGER_RECORD_NM_OPERATIONAL_CAPABILITIES_SENSOR_NUMBER 15
+#define TMPL_SDR_OEM_INTEL_NODE_MANAGER_RECORD_NM_ALERT_THRESHOLD_EXCEEDED_SENSOR_NUMBER 16
+
+/* tmpl_sdr_record_header */
+#define TMPL_SDR_RECORD_HEADER_RECORD_ID 0
+#define TMPL_SDR_RECORD_HEADER_SDR_VERSION_MAJOR 1
+#define TMPL_SDR_RECORD_HEADER_SDR_VERSION_MINOR 2
+#define TMPL_SDR_RECORD_HEADER_RECORD_TYPE 3
+#define TMPL_SDR_RECORD_HEADER_RECORD_LENGTH 4
+
+/* tmpl_sdr_full_sensor_record */
+#define TMPL_SDR_FULL_SENSOR_RECORD_RECORD_ID 0
+#define TMPL_SDR_FULL_SENSOR_RECORD_SDR_VERSION_MAJOR 1
+#define TMPL_SDR_FULL_SENSOR_RECORD_SDR_VERSION_MINOR 2
+#define TMPL_SDR_FULL_SENSOR_RECORD_RECORD_TYPE 3
+#define TMPL_SDR_FULL_SENSOR_RECORD_RECORD_LENGTH 4
+#define TMPL_SDR_FULL_SENSOR_RECORD_SENSOR_OWNER_ID_TYPE 5
+#define TMPL_SDR_FULL_SENSOR_RECORD_SENSOR_OWNER_ID 6
+#define TMPL_SDR_FULL_SENSOR_RECORD_SENSOR_OWNER_LUN 7
+#define TMPL_SDR_FULL_SENSOR_RECORD_SENSOR_OWNER_LUN_RESERVED 8
+#define TMPL_SDR_FULL_SENSOR_RECORD_CHANNEL_NUMBER 9
+#define TMPL_SDR_FULL_SENSOR_RECORD_SENSOR_NUMBER 10
+#define TMPL_SDR_FULL_SENSOR_RECORD_ENTITY_ID 11
+#define TMPL_SDR_FULL_SENSOR_RECORD_ENTITY_INSTANCE 12
+#define TMPL_SDR_FULL_SENSOR_RECORD_ENTITY_INSTANCE_TYPE 13
+#define TMPL_SDR_FULL_SENSOR_RECORD_SENSOR_INITIALIZATION_SENSOR_SCANNING 14
+#define TMPL_SDR_FULL_SENSOR_RECORD_SENSOR_INITIALIZATION_EVENT_GENERATION 15
+#define TMPL_SDR_FULL_SENSOR_RECORD_SENSOR_INITIALIZATION_INIT_SENSOR_TYPE 16
+#define TMPL_SDR_FULL_SENSOR_RECORD_SENSOR_INITIALIZATION_INIT_HYSTERESIS 17
+#define TMPL_SDR_FULL_SENSOR_RECORD_SENSOR_INITIALIZATION_INIT_THRESHOLDS 18
+#define TMPL_SDR_FULL_SENSOR_RECORD_SENSOR_INITIALIZATION_INIT_EVENTS 19
+#define TMPL_SDR_FULL_SENSOR_RECORD_SENSOR_INITIALIZATION_INIT_SCANNING 20
+#define TMPL_SDR_FULL_SENSOR_RECORD_SENSOR_INITIALIZATION_SETTABLE_SENSOR 21
+#define TMPL_SDR_FULL_SENSOR_RECORD_SENSOR_CAPABILITIES_EVENT_MESSAGE_CONTROL_SUPPORT 22
+#define TMPL_SDR_FULL_SENSOR_RECORD_SENSOR_CAPABILITIES_THRESHOLD_ACCESS_SUPPORT 23
+#define TMPL_SDR_FULL_SENSOR_RECORD_SENSOR_CAPABILITIES_HYSTERESIS_SUPPORT 24
+#define TMPL_SDR_FULL_SENSOR_RECORD_SENSOR_CAPABILITIES_AUTO_RE_ARM_SUPPORT 25
+#define TMPL_SDR_FULL_SENSOR_RECORD_SENSOR_CAPABILITIES_ENTITY_IGNORE_SUPPORT 26
+#define TMPL_SDR_FULL_SENSOR_RECORD_SENSOR_TYPE 27
+#define TMPL_SDR_FULL_SENSOR_RECORD_EVENT_READING_TYPE_CODE 28
+#define TMPL_SDR_FULL_SENSOR_RECORD_ASSERTION_EVENT_LOWER_THRESHOLD_READING_MASK 29
+#define TMPL_SDR_FULL_SENSOR_RECORD_DEASSERTION_EVENT_UPPER_THRESHOLD_READING_MASK 30
+#define TMPL_SDR_FULL_SENSOR_RECORD_DISCRETE_READING_SETTABLE_THRESHOLD_READABLE_THRESHOLD_MASK 31
+#define TMPL_SDR_FULL_SENSOR_RECORD_SENSOR_UNIT1_PERCENTAGE 32
+#define TMPL_SDR_FULL_SENSOR_RECORD_SENSOR_UNIT1_MODIFIER_UNIT 33
+#define TMPL_SDR_FULL_SENSOR_RECORD_SENSOR_UNIT1_RATE_UNIT 34
+#define TMPL_SDR_FULL_SENSOR_RECORD_SENSOR_UNIT1_ANALOG_DATA_FORMAT 35
+#define TMPL_SDR_FULL_SENSOR_RECORD_SENSOR_UNIT2_BASE_UNIT 36
+#define TMPL_SDR_FULL_SENSOR_RECORD_SENSOR_UNIT3_MODIFIER_UNIT 37
+#define TMPL_SDR_FULL_SENSOR_RECORD_LINEARIZATION 38
+#define TMPL_SDR_FULL_SENSOR_RECORD_LINEARIZATION_RESERVED 39
+#define TMPL_SDR_FULL_SENSOR_RECORD_M_LS 40
+#define TMPL_SDR_FULL_SENSOR_RECORD_TOLERANCE 41
+#define TMPL_SDR_FULL_SENSOR_RECORD_M_MS 42
+#define TMPL_SDR_FULL_SENSOR_RECORD_B_LS 43
+#define TMPL_SDR_FULL_SENSOR_RECORD_ACCURACY_LS 44
+#define TMPL_SDR_FULL_SENSOR_RECORD_B_MS 45
+#define TMPL_SDR_FULL_SENSOR_RECORD_SENSOR_DIRECTION 46
+#define TMPL_SDR_FULL_SENSOR_RECORD_ACCURACY_EXP 47
+#define TMPL_SDR_FULL_SENSOR_RECORD_ACCURACY_MS 48
+#define TMPL_SDR_FULL_SENSOR_RECORD_B_EXPONENT 49
+#define TMPL_SDR_FULL_SENSOR_RECORD_R_EXPONENT 50
+#define TMPL_SDR_FULL_SENSOR_RECORD_ANALOG_CHARACTERISTICS_FLAG_NOMINAL_READING 51
+#define TMPL_SDR_FULL_SENSOR_RECORD_ANALOG_CHARACTERISTICS_FLAG_NORMAL_MAX 52
+#define TMPL_SDR_FULL_SENSOR_RECORD_ANALOG_CHARACTERISTICS_FLAG_NORMAL_MIN 53
+#define TMPL_SDR_FULL_SENSOR_RECORD_ANALOG_CHARACTERISTICS_FLAG_RESERVED 54
+#define TMPL_SDR_FULL_SENSOR_RECORD_NOMINAL_READING 55
+#define TMPL_SDR_FULL_SENSOR_RECORD_NORMAL_MAXIMUM 56
+#define TMPL_SDR_FULL_SENSOR_RECORD_NORMAL_MINIMUM 57
+#define TMPL_SDR_FULL_SENSOR_RECORD_SENSOR_MAXIMUM_READING 58
+#define TMPL_SDR_FULL_SENSOR_RECORD_SENSOR_MINIMUM_READING 59
+#define TMPL_SDR_FULL_SENSOR_RECORD_UPPER_NON_RECOVERABLE_THRESHOLD 60
+#define TMPL_SDR_FULL_SENSOR_RECORD_UPPER_CRITICAL_THRESHOLD 61
+#define TMPL_SDR_FULL_SENSOR_RECORD_UPPER_NON_CRITICAL_THRESHOLD 62
+#define TMPL_SDR_FULL_SENSOR_RECORD_LOWER_NON_RECOVERABLE_THRESHOLD 63
+#define TMPL_SDR_FULL_SENSOR_RECORD_LOWER_CRITICAL_THRESHOLD 64
+#define TMPL_SDR_FULL_SENSOR_RECORD_LOWER_NON_CRITICAL_THRESHOLD 65
+#define TMPL_SDR_FULL_SENSOR_RECORD_POSITIVE_GOING_THRESHOLD_HYSTERESIS 66
+#define TMPL_SDR_FULL_SENSOR_RECORD_NEGATIVE_GOING_THRESHOLD_HYSTERESIS 67
+#define TMPL_SDR_FULL_SENSOR_RECORD_RESERVED 68
+#define TMPL_SDR_FULL_SENSOR_RECORD_OEM 69
+#define TMPL_SDR_FULL_SENSOR_RECORD_ID_STRING_TYPE_LENGTH_CODE 70
+#define TMPL_SDR_FULL_SENSOR_RECORD_ID_STRING 71
+
+/* tmpl_sdr_full_sensor_record_non_threshold_based_sensors */
+#define TMPL_SDR_FULL_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_RECORD_ID 0
+#define TMPL_SDR_FULL_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_SDR_VERSION_MAJOR 1
+#define TMPL_SDR_FULL_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_SDR_VERSION_MINOR 2
+#define TMPL_SDR_FULL_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_RECORD_TYPE 3
+#define TMPL_SDR_FULL_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_RECORD_LENGTH 4
+#define TMPL_SDR_FULL_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_SENSOR_OWNER_ID_TYPE 5
+#define TMPL_SDR_FULL_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_SENSOR_OWNER_ID 6
+#define TMPL_SDR_FULL_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_SENSOR_OWNER_LUN 7
+#define TMPL_SDR_FULL_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_SENSOR_OWNER_LUN_RESERVED 8
+#define TMPL_SDR_FULL_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_CHANNEL_NUMBER 9
+#define TMPL_SDR_FULL_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_SENSOR_NUMBER 10
+#define TMPL_SDR_FULL_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_ENTITY_ID 11
+#define TMPL_SDR_FULL_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_ENTITY_INSTANCE 12
+#define TMPL_SDR_FULL_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_ENTITY_INSTANCE_TYPE 13
+#define TMPL_SDR_FULL_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_SENSOR_INITIALIZATION_SENSOR_SCANNING 14
+#define TMPL_SDR_FULL_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_SENSOR_INITIALIZATION_EVENT_GENERATION 15
+#define TMPL_SDR_FULL_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_SENSOR_INITIALIZATION_INIT_SENSOR_TYPE 16
+#define TMPL_SDR_FULL_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_SENSOR_INITIALIZATION_INIT_HYSTERESIS 17
+#define TMPL_SDR_FULL_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_SENSOR_INITIALIZATION_INIT_THRESHOLDS 18
+#define TMPL_SDR_FULL_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_SENSOR_INITIALIZATION_INIT_EVENTS 19
+#define TMPL_SDR_FULL_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_SENSOR_INITIALIZATION_INIT_SCANNING 20
+#define TMPL_SDR_FULL_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_SENSOR_INITIALIZATION_RESERVED 21
+#define TMPL_SDR_FULL_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_SENSOR_CAPABILITIES_EVENT_MESSAGE_CONTROL_SUPPORT 22
+#define TMPL_SDR_FULL_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_SENSOR_CAPABILITIES_THRESHOLD_ACCESS_SUPPORT 23
+#define TMPL_SDR_FULL_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_SENSOR_CAPABILITIES_HYSTERESIS_SUPPORT 24
+#define TMPL_SDR_FULL_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_SENSOR_CAPABILITIES_AUTO_RE_ARM_SUPPORT 25
+#define TMPL_SDR_FULL_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_SENSOR_CAPABILITIES_ENTITY_IGNORE_SUPPORT 26
+#define TMPL_SDR_FULL_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_SENSOR_TYPE 27
+#define TMPL_SDR_FULL_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_EVENT_READING_TYPE_CODE 28
+#define TMPL_SDR_FULL_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_ASSERTION_EVENT_MASK_EVENT_OFFSET_0 29
+#define TMPL_SDR_FULL_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_ASSERTION_EVENT_MASK_EVENT_OFFSET_1 30
+#define TMPL_SDR_FULL_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_ASSERTION_EVENT_MASK_EVENT_OFFSET_2 31
+#define TMPL_SDR_FULL_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_ASSERTION_EVENT_MASK_EVENT_OFFSET_3 32
+#define TMPL_SDR_FULL_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_ASSERTION_EVENT_MASK_EVENT_OFFSET_4 33
+#define TMPL_SDR_FULL_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_ASSERTION_EVENT_MASK_EVENT_OFFSET_5 34
+#define TMPL_SDR_FULL_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_ASSERTION_EVENT_MASK_EVENT_OFFSET_6 35
+#define TMPL_SDR_FULL_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_ASSERTION_EVENT_MASK_EVENT_OFFSET_7 36
+#define TMPL_SDR_FULL_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_ASSERTION_EVENT_MASK_EVENT_OFFSET_8 37
+#define TMPL_SDR_FULL_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_ASSERTION_EVENT_MASK_EVENT_OFFSET_9 38
+#define TMPL_SDR_FULL_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_ASSERTION_EVENT_MASK_EVENT_OFFSET_10 39
+#define TMPL_SDR_FULL_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_ASSERTION_EVENT_MASK_EVENT_OFFSET_11 40
+#define TMPL_SDR_FULL_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_ASSERTION_EVENT_MASK_EVENT_OFFSET_12 41
+#define TMPL_SDR_FULL_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_ASSERTION_EVENT_MASK_EVENT_OFFSET_13 42
+#define TMPL_SDR_FULL_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_ASSERTION_EVENT_MASK_EVENT_OFFSET_14 43
+#define TMPL_SDR_FULL_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_ASSERTION_EVENT_MASK_RESERVED 44
+#define TMPL_SDR_FULL_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_DEASSERTION_EVENT_MASK_EVENT_OFFSET_0 45
+#define TMPL_SDR_FULL_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_DEASSERTION_EVENT_MASK_EVENT_OFFSET_1 46
+#define TMPL_SDR_FULL_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_DEASSERTION_EVENT_MASK_EVENT_OFFSET_2 47
+#define TMPL_SDR_FULL_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_DEASSERTION_EVENT_MASK_EVENT_OFFSET_3 48
+#define TMPL_SDR_FULL_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_DEASSERTION_EVENT_MASK_EVENT_OFFSET_4 49
+#define TMPL_SDR_FULL_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_DEASSERTION_EVENT_MASK_EVENT_OFFSET_5 50
+#define TMPL_SDR_FULL_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_DEASSERTION_EVENT_MASK_EVENT_OFFSET_6 51
+#define TMPL_SDR_FULL_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_DEASSERTION_EVENT_MASK_EVENT_OFFSET_7 52
+#define TMPL_SDR_FULL_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_DEASSERTION_EVENT_MASK_EVENT_OFFSET_8 53
+#define TMPL_SDR_FULL_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_DEASSERTION_EVENT_MASK_EVENT_OFFSET_9 54
+#define TMPL_SDR_FULL_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_DEASSERTION_EVENT_MASK_EVENT_OFFSET_10 55
+#define TMPL_SDR_FULL_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_DEASSERTION_EVENT_MASK_EVENT_OFFSET_11 56
+#define TMPL_SDR_FULL_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_DEASSERTION_EVENT_MASK_EVENT_OFFSET_12 57
+#define TMPL_SDR_FULL_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_DEASSERTION_EVENT_MASK_EVENT_OFFSET_13 58
+#define TMPL_SDR_FULL_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_DEASSERTION_EVENT_MASK_EVENT_OFFSET_14 59
+#define TMPL_SDR_FULL_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_DEASSERTION_EVENT_MASK_RESERVED 60
+#define TMPL_SDR_FULL_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_DISCRETE_READING_MASK_STATE_BIT_0 61
+#define TMPL_SDR_FULL_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_DISCRETE_READING_MASK_STATE_BIT_1 62
+#define TMPL_SDR_FULL_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_DISCRETE_READING_MASK_STATE_BIT_2 63
+#define TMPL_SDR_FULL_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_DISCRETE_READING_MASK_STATE_BIT_3 64
+#define TMPL_SDR_FULL_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_DISCRETE_READING_MASK_STATE_BIT_4 65
+#define TMPL_SDR_FULL_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_DISCRETE_READING_MASK_STATE_BIT_5 66
+#define TMPL_SDR_FULL_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_DISCRETE_READING_MASK_STATE_BIT_6 67
+#define TMPL_SDR_FULL_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_DISCRETE_READING_MASK_STATE_BIT_7 68
+#define TMPL_SDR_FULL_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_DISCRETE_READING_MASK_STATE_BIT_8 69
+#define TMPL_SDR_FULL_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_DISCRETE_READING_MASK_STATE_BIT_9 70
+#define TMPL_SDR_FULL_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_DISCRETE_READING_MASK_STATE_BIT_10 71
+#define TMPL_SDR_FULL_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_DISCRETE_READING_MASK_STATE_BIT_11 72
+#define TMPL_SDR_FULL_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_DISCRETE_READING_MASK_STATE_BIT_12 73
+#define TMPL_SDR_FULL_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_DISCRETE_READING_MASK_STATE_BIT_13 74
+#define TMPL_SDR_FULL_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_DISCRETE_READING_MASK_STATE_BIT_14 75
+#define TMPL_SDR_FULL_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_DISCRETE_READING_MASK_RESERVED 76
+#define TMPL_SDR_FULL_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_SENSOR_UNIT1_PERCENTAGE 77
+#define TMPL_SDR_FULL_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_SENSOR_UNIT1_MODIFIER_UNIT 78
+#define TMPL_SDR_FULL_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_SENSOR_UNIT1_RATE_UNIT 79
+#define TMPL_SDR_FULL_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_SENSOR_UNIT1_ANALOG_DATA_FORMAT 80
+#define TMPL_SDR_FULL_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_SENSOR_UNIT2_BASE_UNIT 81
+#define TMPL_SDR_FULL_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_SENSOR_UNIT3_MODIFIER_UNIT 82
+#define TMPL_SDR_FULL_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_LINEARIZATION 83
+#define TMPL_SDR_FULL_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_LINEARIZATION_RESERVED 84
+#define TMPL_SDR_FULL_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_M_LS 85
+#define TMPL_SDR_FULL_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_TOLERANCE 86
+#define TMPL_SDR_FULL_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_M_MS 87
+#define TMPL_SDR_FULL_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_B_LS 88
+#define TMPL_SDR_FULL_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_ACCURACY_LS 89
+#define TMPL_SDR_FULL_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_B_MS 90
+#define TMPL_SDR_FULL_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_SENSOR_DIRECTION 91
+#define TMPL_SDR_FULL_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_ACCURACY_EXP 92
+#define TMPL_SDR_FULL_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_ACCURACY_MS 93
+#define TMPL_SDR_FULL_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_B_EXPONENT 94
+#define TMPL_SDR_FULL_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_R_EXPONENT 95
+#define TMPL_SDR_FULL_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_ANALOG_CHARACTERISTICS_FLAG_NOMINAL_READING 96
+#define TMPL_SDR_FULL_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_ANALOG_CHARACTERISTICS_FLAG_NORMAL_MAX 97
+#define TMPL_SDR_FULL_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_ANALOG_CHARACTERISTICS_FLAG_NORMAL_MIN 98
+#define TMPL_SDR_FULL_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_ANALOG_CHARACTERISTICS_FLAG_RESERVED 99
+#define TMPL_SDR_FULL_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_NOMINAL_READING 100
+#define TMPL_SDR_FULL_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_NORMAL_MAXIMUM 101
+#define TMPL_SDR_FULL_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_NORMAL_MINIMUM 102
+#define TMPL_SDR_FULL_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_SENSOR_MAXIMUM_READING 103
+#define TMPL_SDR_FULL_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_SENSOR_MINIMUM_READING 104
+#define TMPL_SDR_FULL_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_UPPER_NON_RECOVERABLE_THRESHOLD 105
+#define TMPL_SDR_FULL_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_UPPER_CRITICAL_THRESHOLD 106
+#define TMPL_SDR_FULL_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_UPPER_NON_CRITICAL_THRESHOLD 107
+#define TMPL_SDR_FULL_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_LOWER_NON_RECOVERABLE_THRESHOLD 108
+#define TMPL_SDR_FULL_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_LOWER_CRITICAL_THRESHOLD 109
+#define TMPL_SDR_FULL_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_LOWER_NON_CRITICAL_THRESHOLD 110
+#define TMPL_SDR_FULL_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_POSITIVE_GOING_THRESHOLD_HYSTERESIS 111
+#define TMPL_SDR_FULL_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_NEGATIVE_GOING_THRESHOLD_HYSTERESIS 112
+#define TMPL_SDR_FULL_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_RESERVED 113
+#define TMPL_SDR_FULL_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_OEM 114
+#define TMPL_SDR_FULL_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_ID_STRING_TYPE_LENGTH_CODE 115
+#define TMPL_SDR_FULL_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_ID_STRING 116
+
+/* tmpl_sdr_full_sensor_record_threshold_based_sensors */
+#define TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_RECORD_ID 0
+#define TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_SDR_VERSION_MAJOR 1
+#define TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_SDR_VERSION_MINOR 2
+#define TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_RECORD_TYPE 3
+#define TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_RECORD_LENGTH 4
+#define TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_SENSOR_OWNER_ID_TYPE 5
+#define TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_SENSOR_OWNER_ID 6
+#define TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_SENSOR_OWNER_LUN 7
+#define TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_SENSOR_OWNER_LUN_RESERVED 8
+#define TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_CHANNEL_NUMBER 9
+#define TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_SENSOR_NUMBER 10
+#define TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_ENTITY_ID 11
+#define TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_ENTITY_INSTANCE 12
+#define TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_ENTITY_INSTANCE_TYPE 13
+#define TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_SENSOR_INITIALIZATION_SENSOR_SCANNING 14
+#define TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_SENSOR_INITIALIZATION_EVENT_GENERATION 15
+#define TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_SENSOR_INITIALIZATION_INIT_SENSOR_TYPE 16
+#define TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_SENSOR_INITIALIZATION_INIT_HYSTERESIS 17
+#define TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_SENSOR_INITIALIZATION_INIT_THRESHOLDS 18
+#define TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_SENSOR_INITIALIZATION_INIT_EVENTS 19
+#define TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_SENSOR_INITIALIZATION_INIT_SCANNING 20
+#define TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_SENSOR_INITIALIZATION_RESERVED 21
+#define TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_SENSOR_CAPABILITIES_EVENT_MESSAGE_CONTROL_SUPPORT 22
+#define TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_SENSOR_CAPABILITIES_THRESHOLD_ACCESS_SUPPORT 23
+#define TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_SENSOR_CAPABILITIES_HYSTERESIS_SUPPORT 24
+#define TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_SENSOR_CAPABILITIES_AUTO_RE_ARM_SUPPORT 25
+#define TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_SENSOR_CAPABILITIES_ENTITY_IGNORE_SUPPORT 26
+#define TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_SENSOR_TYPE 27
+#define TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_EVENT_READING_TYPE_CODE 28
+#define TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_THRESHOLD_ASSERTION_EVENT_MASK_LOWER_NON_CRITICAL_GOING_LOW_SUPPORTED 29
+#define TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_THRESHOLD_ASSERTION_EVENT_MASK_LOWER_NON_CRITICAL_GOING_HIGH_SUPPORTED 30
+#define TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_THRESHOLD_ASSERTION_EVENT_MASK_LOWER_CRITICAL_GOING_LOW_SUPPORTED 31
+#define TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_THRESHOLD_ASSERTION_EVENT_MASK_LOWER_CRITICAL_GOING_HIGH_SUPPORTED 32
+#define TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_THRESHOLD_ASSERTION_EVENT_MASK_LOWER_NON_RECOVERABLE_GOING_LOW_SUPPORTED 33
+#define TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_THRESHOLD_ASSERTION_EVENT_MASK_LOWER_NON_RECOVERABLE_GOING_HIGH_SUPPORTED 34
+#define TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_THRESHOLD_ASSERTION_EVENT_MASK_UPPER_NON_CRITICAL_GOING_LOW_SUPPORTED 35
+#define TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_THRESHOLD_ASSERTION_EVENT_MASK_UPPER_NON_CRITICAL_GOING_HIGH_SUPPORTED 36
+#define TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_THRESHOLD_ASSERTION_EVENT_MASK_UPPER_CRITICAL_GOING_LOW_SUPPORTED 37
+#define TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_THRESHOLD_ASSERTION_EVENT_MASK_UPPER_CRITICAL_GOING_HIGH_SUPPORTED 38
+#define TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_THRESHOLD_ASSERTION_EVENT_MASK_UPPER_NON_RECOVERABLE_GOING_LOW_SUPPORTED 39
+#define TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_THRESHOLD_ASSERTION_EVENT_MASK_UPPER_NON_RECOVERABLE_GOING_HIGH_SUPPORTED 40
+#define TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_LOWER_THRESHOLD_READING_MASK_LOWER_NON_CRITICAL_THRESHOLD_IS_COMPARISON 41
+#define TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_LOWER_THRESHOLD_READING_MASK_LOWER_CRITICAL_THRESHOLD_IS_COMPARISON 42
+#define TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_LOWER_THRESHOLD_READING_MASK_LOWER_NON_RECOVERABLE_IS_COMPARISON 43
+#define TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_LOWER_THRESHOLD_READING_MASK_RESERVED 44
+#define TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_THRESHOLD_DEASSERTION_EVENT_MASK_LOWER_NON_CRITICAL_GOING_LOW_SUPPORTED 45
+#define TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_THRESHOLD_DEASSERTION_EVENT_MASK_LOWER_NON_CRITICAL_GOING_HIGH_SUPPORTED 46
+#define TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_THRESHOLD_DEASSERTION_EVENT_MASK_LOWER_CRITICAL_GOING_LOW_SUPPORTED 47
+#define TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_THRESHOLD_DEASSERTION_EVENT_MASK_LOWER_CRITICAL_GOING_HIGH_SUPPORTED 48
+#define TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_THRESHOLD_DEASSERTION_EVENT_MASK_LOWER_NON_RECOVERABLE_GOING_LOW_SUPPORTED 49
+#define TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_THRESHOLD_DEASSERTION_EVENT_MASK_LOWER_NON_RECOVERABLE_GOING_HIGH_SUPPORTED 50
+#define TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_THRESHOLD_DEASSERTION_EVENT_MASK_UPPER_NON_CRITICAL_GOING_LOW_SUPPORTED 51
+#define TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_THRESHOLD_DEASSERTION_EVENT_MASK_UPPER_NON_CRITICAL_GOING_HIGH_SUPPORTED 52
+#define TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_THRESHOLD_DEASSERTION_EVENT_MASK_UPPER_CRITICAL_GOING_LOW_SUPPORTED 53
+#define TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_THRESHOLD_DEASSERTION_EVENT_MASK_UPPER_CRITICAL_GOING_HIGH_SUPPORTED 54
+#define TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_THRESHOLD_DEASSERTION_EVENT_MASK_UPPER_NON_RECOVERABLE_GOING_LOW_SUPPORTED 55
+#define TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_THRESHOLD_DEASSERTION_EVENT_MASK_UPPER_NON_RECOVERABLE_GOING_HIGH_SUPPORTED 56
+#define TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_UPPER_THRESHOLD_READING_MASK_UPPER_NON_CRITICAL_THRESHOLD_IS_COMPARISON 57
+#define TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_UPPER_THRESHOLD_READING_MASK_UPPER_CRITICAL_THRESHOLD_IS_COMPARISON 58
+#define TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_UPPER_THRESHOLD_READING_MASK_UPPER_NON_RECOVERABLE_IS_COMPARISON 59
+#define TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_UPPER_THRESHOLD_READING_MASK_RESERVED 60
+#define TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_READABLE_THRESHOLD_MASK_LOWER_NON_CRITICAL_THRESHOLD_IS_READABLE 61
+#define TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_READABLE_THRESHOLD_MASK_LOWER_CRITICAL_THRESHOLD_IS_READABLE 62
+#define TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_READABLE_THRESHOLD_MASK_LOWER_NON_RECOVERABLE_THRESHOLD_IS_READABLE 63
+#define TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_READABLE_THRESHOLD_MASK_UPPER_NON_CRITICAL_THRESHOLD_IS_READABLE 64
+#define TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_READABLE_THRESHOLD_MASK_UPPER_CRITICAL_THRESHOLD_IS_READABLE 65
+#define TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_READABLE_THRESHOLD_MASK_UPPER_NON_RECOVERABLE_THRESHOLD_IS_READABLE 66
+#define TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_READABLE_THRESHOLD_MASK_RESERVED1 67
+#define TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_READABLE_THRESHOLD_MASK_RESERVED2 68
+#define TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_SETTABLE_THRESHOLD_MASK_LOWER_NON_CRITICAL_THRESHOLD_IS_SETTABLE 69
+#define TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_SETTABLE_THRESHOLD_MASK_LOWER_CRITICAL_THRESHOLD_IS_SETTABLE 70
+#define TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_SETTABLE_THRESHOLD_MASK_LOWER_NON_RECOVERABLE_THRESHOLD_IS_SETTABLE 71
+#define TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_SETTABLE_THRESHOLD_MASK_UPPER_NON_CRITICAL_THRESHOLD_IS_SETTABLE 72
+#define TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_SETTABLE_THRESHOLD_MASK_UPPER_CRITICAL_THRESHOLD_IS_SETTABLE 73
+#define TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_SETTABLE_THRESHOLD_MASK_UPPER_NON_RECOVERABLE_THRESHOLD_IS_SETTABLE 74
+#define TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_SETTABLE_THRESHOLD_MASK_RESERVED1 75
+#define TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_SETTABLE_THRESHOLD_MASK_RESERVED2 76
+#define TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_SENSOR_UNIT1_PERCENTAGE 77
+#define TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_SENSOR_UNIT1_MODIFIER_UNIT 78
+#define TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_SENSOR_UNIT1_RATE_UNIT 79
+#define TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_SENSOR_UNIT1_ANALOG_DATA_FORMAT 80
+#define TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_SENSOR_UNIT2_BASE_UNIT 81
+#define TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_SENSOR_UNIT3_MODIFIER_UNIT 82
+#define TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_LINEARIZATION 83
+#define TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_LINEARIZATION_RESERVED 84
+#define TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_M_LS 85
+#define TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_TOLERANCE 86
+#define TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_M_MS 87
+#define TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_B_LS 88
+#define TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_ACCURACY_LS 89
+#define TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_B_MS 90
+#define TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_SENSOR_DIRECTION 91
+#define TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_ACCURACY_EXP 92
+#define TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_ACCURACY_MS 93
+#define TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_B_EXPONENT 94
+#define TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_R_EXPONENT 95
+#define TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_ANALOG_CHARACTERISTICS_FLAG_NOMINAL_READING 96
+#define TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_ANALOG_CHARACTERISTICS_FLAG_NORMAL_MAX 97
+#define TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_ANALOG_CHARACTERISTICS_FLAG_NORMAL_MIN 98
+#define TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_ANALOG_CHARACTERISTICS_FLAG_RESERVED 99
+#define TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_NOMINAL_READING 100
+#define TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_NORMAL_MAXIMUM 101
+#define TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_NORMAL_MINIMUM 102
+#define TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_SENSOR_MAXIMUM_READING 103
+#define TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_SENSOR_MINIMUM_READING 104
+#define TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_UPPER_NON_RECOVERABLE_THRESHOLD 105
+#define TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_UPPER_CRITICAL_THRESHOLD 106
+#define TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_UPPER_NON_CRITICAL_THRESHOLD 107
+#define TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_LOWER_NON_RECOVERABLE_THRESHOLD 108
+#define TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_LOWER_CRITICAL_THRESHOLD 109
+#define TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_LOWER_NON_CRITICAL_THRESHOLD 110
+#define TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_POSITIVE_GOING_THRESHOLD_HYSTERESIS 111
+#define TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_NEGATIVE_GOING_THRESHOLD_HYSTERESIS 112
+#define TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_RESERVED 113
+#define TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_OEM 114
+#define TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_ID_STRING_TYPE_LENGTH_CODE 115
+#define TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_ID_STRING 116
+
+/* tmpl_sdr_compact_sensor_record */
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_RECORD_ID 0
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_SDR_VERSION_MAJOR 1
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_SDR_VERSION_MINOR 2
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_RECORD_TYPE 3
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_RECORD_LENGTH 4
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_SENSOR_OWNER_ID_TYPE 5
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_SENSOR_OWNER_ID 6
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_SENSOR_OWNER_LUN 7
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_SENSOR_OWNER_LUN_RESERVED 8
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_CHANNEL_NUMBER 9
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_SENSOR_NUMBER 10
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_ENTITY_ID 11
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_ENTITY_INSTANCE 12
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_ENTITY_INSTANCE_TYPE 13
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_SENSOR_INITIALIZATION_SENSOR_SCANNING 14
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_SENSOR_INITIALIZATION_EVENT_GENERATION 15
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_SENSOR_INITIALIZATION_INIT_SENSOR_TYPE 16
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_SENSOR_INITIALIZATION_INIT_HYSTERESIS 17
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_SENSOR_INITIALIZATION_INIT_THRESHOLDS 18
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_SENSOR_INITIALIZATION_INIT_EVENTS 19
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_SENSOR_INITIALIZATION_INIT_SCANNING 20
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_SENSOR_INITIALIZATION_RESERVED 21
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_SENSOR_CAPABILITIES_EVENT_MESSAGE_CONTROL_SUPPORT 22
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_SENSOR_CAPABILITIES_THRESHOLD_ACCESS_SUPPORT 23
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_SENSOR_CAPABILITIES_HYSTERESIS_SUPPORT 24
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_SENSOR_CAPABILITIES_AUTO_RE_ARM_SUPPORT 25
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_SENSOR_CAPABILITIES_ENTITY_IGNORE_SUPPORT 26
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_SENSOR_TYPE 27
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_EVENT_READING_TYPE_CODE 28
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_ASSERTION_EVENT_LOWER_THRESHOLD_READING_MASK 29
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_DEASSERTION_EVENT_UPPER_THRESHOLD_READING_MASK 30
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_DISCRETE_READING_SETTABLE_THRESHOLD_READABLE_THRESHOLD_MASK 31
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_SENSOR_UNIT1_PERCENTAGE 32
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_SENSOR_UNIT1_MODIFIER_UNIT 33
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_SENSOR_UNIT1_RATE_UNIT 34
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_SENSOR_UNIT1_ANALOG_DATA_FORMAT 35
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_SENSOR_UNIT2_BASE_UNIT 36
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_SENSOR_UNIT3_MODIFIER_UNIT 37
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_SHARE_COUNT 38
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_ID_STRING_INSTANCE_MODIFIER_TYPE 39
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_SENSOR_DIRECTION 40
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_ID_STRING_INSTANCE_MODIFIER_OFFSET 41
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_ENTITY_INSTANCE_SHARING 42
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_POSITIVE_GOING_THRESHOLD_HYSTERESIS 43
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_NEGATIVE_GOING_THRESHOLD_HYSTERESIS 44
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_RESERVED 45
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_OEM 46
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_ID_STRING_TYPE_LENGTH_CODE 47
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_ID_STRING 48
+
+/* tmpl_sdr_compact_sensor_record_non_threshold_based_sensors */
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_RECORD_ID 0
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_SDR_VERSION_MAJOR 1
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_SDR_VERSION_MINOR 2
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_RECORD_TYPE 3
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_RECORD_LENGTH 4
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_SENSOR_OWNER_ID_TYPE 5
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_SENSOR_OWNER_ID 6
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_SENSOR_OWNER_LUN 7
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_SENSOR_OWNER_LUN_RESERVED 8
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_CHANNEL_NUMBER 9
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_SENSOR_NUMBER 10
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_ENTITY_ID 11
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_ENTITY_INSTANCE 12
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_ENTITY_INSTANCE_TYPE 13
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_SENSOR_INITIALIZATION_SENSOR_SCANNING 14
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_SENSOR_INITIALIZATION_EVENT_GENERATION 15
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_SENSOR_INITIALIZATION_INIT_SENSOR_TYPE 16
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_SENSOR_INITIALIZATION_INIT_HYSTERESIS 17
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_SENSOR_INITIALIZATION_INIT_THRESHOLDS 18
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_SENSOR_INITIALIZATION_INIT_EVENTS 19
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_SENSOR_INITIALIZATION_INIT_SCANNING 20
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_SENSOR_INITIALIZATION_RESERVED 21
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_SENSOR_CAPABILITIES_EVENT_MESSAGE_CONTROL_SUPPORT 22
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_SENSOR_CAPABILITIES_THRESHOLD_ACCESS_SUPPORT 23
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_SENSOR_CAPABILITIES_HYSTERESIS_SUPPORT 24
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_SENSOR_CAPABILITIES_AUTO_RE_ARM_SUPPORT 25
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_SENSOR_CAPABILITIES_ENTITY_IGNORE_SUPPORT 26
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_SENSOR_TYPE 27
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_EVENT_READING_TYPE_CODE 28
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_ASSERTION_EVENT_MASK_EVENT_OFFSET_0 29
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_ASSERTION_EVENT_MASK_EVENT_OFFSET_1 30
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_ASSERTION_EVENT_MASK_EVENT_OFFSET_2 31
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_ASSERTION_EVENT_MASK_EVENT_OFFSET_3 32
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_ASSERTION_EVENT_MASK_EVENT_OFFSET_4 33
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_ASSERTION_EVENT_MASK_EVENT_OFFSET_5 34
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_ASSERTION_EVENT_MASK_EVENT_OFFSET_6 35
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_ASSERTION_EVENT_MASK_EVENT_OFFSET_7 36
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_ASSERTION_EVENT_MASK_EVENT_OFFSET_8 37
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_ASSERTION_EVENT_MASK_EVENT_OFFSET_9 38
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_ASSERTION_EVENT_MASK_EVENT_OFFSET_10 39
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_ASSERTION_EVENT_MASK_EVENT_OFFSET_11 40
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_ASSERTION_EVENT_MASK_EVENT_OFFSET_12 41
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_ASSERTION_EVENT_MASK_EVENT_OFFSET_13 42
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_ASSERTION_EVENT_MASK_EVENT_OFFSET_14 43
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_ASSERTION_EVENT_MASK_RESERVED 44
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_DEASSERTION_EVENT_MASK_EVENT_OFFSET_0 45
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_DEASSERTION_EVENT_MASK_EVENT_OFFSET_1 46
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_DEASSERTION_EVENT_MASK_EVENT_OFFSET_2 47
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_DEASSERTION_EVENT_MASK_EVENT_OFFSET_3 48
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_DEASSERTION_EVENT_MASK_EVENT_OFFSET_4 49
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_DEASSERTION_EVENT_MASK_EVENT_OFFSET_5 50
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_DEASSERTION_EVENT_MASK_EVENT_OFFSET_6 51
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_DEASSERTION_EVENT_MASK_EVENT_OFFSET_7 52
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_DEASSERTION_EVENT_MASK_EVENT_OFFSET_8 53
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_DEASSERTION_EVENT_MASK_EVENT_OFFSET_9 54
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_DEASSERTION_EVENT_MASK_EVENT_OFFSET_10 55
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_DEASSERTION_EVENT_MASK_EVENT_OFFSET_11 56
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_DEASSERTION_EVENT_MASK_EVENT_OFFSET_12 57
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_DEASSERTION_EVENT_MASK_EVENT_OFFSET_13 58
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_DEASSERTION_EVENT_MASK_EVENT_OFFSET_14 59
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_DEASSERTION_EVENT_MASK_RESERVED 60
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_DISCRETE_READING_MASK_STATE_BIT_0 61
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_DISCRETE_READING_MASK_STATE_BIT_1 62
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_DISCRETE_READING_MASK_STATE_BIT_2 63
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_DISCRETE_READING_MASK_STATE_BIT_3 64
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_DISCRETE_READING_MASK_STATE_BIT_4 65
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_DISCRETE_READING_MASK_STATE_BIT_5 66
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_DISCRETE_READING_MASK_STATE_BIT_6 67
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_DISCRETE_READING_MASK_STATE_BIT_7 68
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_DISCRETE_READING_MASK_STATE_BIT_8 69
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_DISCRETE_READING_MASK_STATE_BIT_9 70
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_DISCRETE_READING_MASK_STATE_BIT_10 71
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_DISCRETE_READING_MASK_STATE_BIT_11 72
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_DISCRETE_READING_MASK_STATE_BIT_12 73
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_DISCRETE_READING_MASK_STATE_BIT_13 74
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_DISCRETE_READING_MASK_STATE_BIT_14 75
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_DISCRETE_READING_MASK_RESERVED 76
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_SENSOR_UNIT1_PERCENTAGE 77
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_SENSOR_UNIT1_MODIFIER_UNIT 78
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_SENSOR_UNIT1_RATE_UNIT 79
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_SENSOR_UNIT1_ANALOG_DATA_FORMAT 80
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_SENSOR_UNIT2_BASE_UNIT 81
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_SENSOR_UNIT3_MODIFIER_UNIT 82
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_SHARE_COUNT 83
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_ID_STRING_INSTANCE_MODIFIER_TYPE 84
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_SENSOR_DIRECTION 85
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_ID_STRING_INSTANCE_MODIFIER_OFFSET 86
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_ENTITY_INSTANCE_SHARING 87
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_POSITIVE_GOING_THRESHOLD_HYSTERESIS 88
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_NEGATIVE_GOING_THRESHOLD_HYSTERESIS 89
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_RESERVED 90
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_OEM 91
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_ID_STRING_TYPE_LENGTH_CODE 92
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_NON_THRESHOLD_BASED_SENSORS_ID_STRING 93
+
+/* tmpl_sdr_compact_sensor_record_threshold_based_sensors */
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_RECORD_ID 0
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_SDR_VERSION_MAJOR 1
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_SDR_VERSION_MINOR 2
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_RECORD_TYPE 3
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_RECORD_LENGTH 4
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_SENSOR_OWNER_ID_TYPE 5
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_SENSOR_OWNER_ID 6
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_SENSOR_OWNER_LUN 7
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_SENSOR_OWNER_LUN_RESERVED 8
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_CHANNEL_NUMBER 9
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_SENSOR_NUMBER 10
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_ENTITY_ID 11
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_ENTITY_INSTANCE 12
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_ENTITY_INSTANCE_TYPE 13
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_SENSOR_INITIALIZATION_SENSOR_SCANNING 14
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_SENSOR_INITIALIZATION_EVENT_GENERATION 15
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_SENSOR_INITIALIZATION_INIT_SENSOR_TYPE 16
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_SENSOR_INITIALIZATION_INIT_HYSTERESIS 17
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_SENSOR_INITIALIZATION_INIT_THRESHOLDS 18
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_SENSOR_INITIALIZATION_INIT_EVENTS 19
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_SENSOR_INITIALIZATION_INIT_SCANNING 20
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_SENSOR_INITIALIZATION_RESERVED 21
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_SENSOR_CAPABILITIES_EVENT_MESSAGE_CONTROL_SUPPORT 22
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_SENSOR_CAPABILITIES_THRESHOLD_ACCESS_SUPPORT 23
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_SENSOR_CAPABILITIES_HYSTERESIS_SUPPORT 24
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_SENSOR_CAPABILITIES_AUTO_RE_ARM_SUPPORT 25
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_SENSOR_CAPABILITIES_ENTITY_IGNORE_SUPPORT 26
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_SENSOR_TYPE 27
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_EVENT_READING_TYPE_CODE 28
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_THRESHOLD_ASSERTION_EVENT_MASK_LOWER_NON_CRITICAL_GOING_LOW_SUPPORTED 29
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_THRESHOLD_ASSERTION_EVENT_MASK_LOWER_NON_CRITICAL_GOING_HIGH_SUPPORTED 30
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_THRESHOLD_ASSERTION_EVENT_MASK_LOWER_CRITICAL_GOING_LOW_SUPPORTED 31
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_THRESHOLD_ASSERTION_EVENT_MASK_LOWER_CRITICAL_GOING_HIGH_SUPPORTED 32
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_THRESHOLD_ASSERTION_EVENT_MASK_LOWER_NON_RECOVERABLE_GOING_LOW_SUPPORTED 33
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_THRESHOLD_ASSERTION_EVENT_MASK_LOWER_NON_RECOVERABLE_GOING_HIGH_SUPPORTED 34
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_THRESHOLD_ASSERTION_EVENT_MASK_UPPER_NON_CRITICAL_GOING_LOW_SUPPORTED 35
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_THRESHOLD_ASSERTION_EVENT_MASK_UPPER_NON_CRITICAL_GOING_HIGH_SUPPORTED 36
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_THRESHOLD_ASSERTION_EVENT_MASK_UPPER_CRITICAL_GOING_LOW_SUPPORTED 37
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_THRESHOLD_ASSERTION_EVENT_MASK_UPPER_CRITICAL_GOING_HIGH_SUPPORTED 38
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_THRESHOLD_ASSERTION_EVENT_MASK_UPPER_NON_RECOVERABLE_GOING_LOW_SUPPORTED 39
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_THRESHOLD_ASSERTION_EVENT_MASK_UPPER_NON_RECOVERABLE_GOING_HIGH_SUPPORTED 40
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_LOWER_THRESHOLD_READING_MASK_LOWER_NON_CRITICAL_THRESHOLD_IS_COMPARISON 41
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_LOWER_THRESHOLD_READING_MASK_LOWER_CRITICAL_THRESHOLD_IS_COMPARISON 42
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_LOWER_THRESHOLD_READING_MASK_LOWER_NON_RECOVERABLE_IS_COMPARISON 43
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_LOWER_THRESHOLD_READING_MASK_RESERVED 44
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_THRESHOLD_DEASSERTION_EVENT_MASK_LOWER_NON_CRITICAL_GOING_LOW_SUPPORTED 45
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_THRESHOLD_DEASSERTION_EVENT_MASK_LOWER_NON_CRITICAL_GOING_HIGH_SUPPORTED 46
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_THRESHOLD_DEASSERTION_EVENT_MASK_LOWER_CRITICAL_GOING_LOW_SUPPORTED 47
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_THRESHOLD_DEASSERTION_EVENT_MASK_LOWER_CRITICAL_GOING_HIGH_SUPPORTED 48
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_THRESHOLD_DEASSERTION_EVENT_MASK_LOWER_NON_RECOVERABLE_GOING_LOW_SUPPORTED 49
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_THRESHOLD_DEASSERTION_EVENT_MASK_LOWER_NON_RECOVERABLE_GOING_HIGH_SUPPORTED 50
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_THRESHOLD_DEASSERTION_EVENT_MASK_UPPER_NON_CRITICAL_GOING_LOW_SUPPORTED 51
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_THRESHOLD_DEASSERTION_EVENT_MASK_UPPER_NON_CRITICAL_GOING_HIGH_SUPPORTED 52
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_THRESHOLD_DEASSERTION_EVENT_MASK_UPPER_CRITICAL_GOING_LOW_SUPPORTED 53
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_THRESHOLD_DEASSERTION_EVENT_MASK_UPPER_CRITICAL_GOING_HIGH_SUPPORTED 54
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_THRESHOLD_DEASSERTION_EVENT_MASK_UPPER_NON_RECOVERABLE_GOING_LOW_SUPPORTED 55
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_THRESHOLD_DEASSERTION_EVENT_MASK_UPPER_NON_RECOVERABLE_GOING_HIGH_SUPPORTED 56
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_UPPER_THRESHOLD_READING_MASK_UPPER_NON_CRITICAL_THRESHOLD_IS_COMPARISON 57
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_UPPER_THRESHOLD_READING_MASK_UPPER_CRITICAL_THRESHOLD_IS_COMPARISON 58
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_UPPER_THRESHOLD_READING_MASK_UPPER_NON_RECOVERABLE_IS_COMPARISON 59
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_UPPER_THRESHOLD_READING_MASK_RESERVED 60
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_READABLE_THRESHOLD_MASK_LOWER_NON_CRITICAL_THRESHOLD_IS_READABLE 61
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_READABLE_THRESHOLD_MASK_LOWER_CRITICAL_THRESHOLD_IS_READABLE 62
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_READABLE_THRESHOLD_MASK_LOWER_NON_RECOVERABLE_THRESHOLD_IS_READABLE 63
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_READABLE_THRESHOLD_MASK_UPPER_NON_CRITICAL_THRESHOLD_IS_READABLE 64
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_READABLE_THRESHOLD_MASK_UPPER_CRITICAL_THRESHOLD_IS_READABLE 65
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_READABLE_THRESHOLD_MASK_UPPER_NON_RECOVERABLE_THRESHOLD_IS_READABLE 66
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_READABLE_THRESHOLD_MASK_RESERVED1 67
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_READABLE_THRESHOLD_MASK_RESERVED2 68
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_SETTABLE_THRESHOLD_MASK_LOWER_NON_CRITICAL_THRESHOLD_IS_SETTABLE 69
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_SETTABLE_THRESHOLD_MASK_LOWER_CRITICAL_THRESHOLD_IS_SETTABLE 70
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_SETTABLE_THRESHOLD_MASK_LOWER_NON_RECOVERABLE_THRESHOLD_IS_SETTABLE 71
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_SETTABLE_THRESHOLD_MASK_UPPER_NON_CRITICAL_THRESHOLD_IS_SETTABLE 72
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_SETTABLE_THRESHOLD_MASK_UPPER_CRITICAL_THRESHOLD_IS_SETTABLE 73
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_SETTABLE_THRESHOLD_MASK_UPPER_NON_RECOVERABLE_THRESHOLD_IS_SETTABLE 74
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_SETTABLE_THRESHOLD_MASK_RESERVED1 75
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_SETTABLE_THRESHOLD_MASK_RESERVED2 76
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_SENSOR_UNIT1_PERCENTAGE 77
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_SENSOR_UNIT1_MODIFIER_UNIT 78
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_SENSOR_UNIT1_RATE_UNIT 79
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_SENSOR_UNIT1_ANALOG_DATA_FORMAT 80
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_SENSOR_UNIT2_BASE_UNIT 81
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_SENSOR_UNIT3_MODIFIER_UNIT 82
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_SHARE_COUNT 83
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_ID_STRING_INSTANCE_MODIFIER_TYPE 84
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_SENSOR_DIRECTION 85
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_ID_STRING_INSTANCE_MODIFIER_OFFSET 86
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_ENTITY_INSTANCE_SHARING 87
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_POSITIVE_GOING_THRESHOLD_HYSTERESIS 88
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_NEGATIVE_GOING_THRESHOLD_HYSTERESIS 89
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_RESERVED 90
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_OEM 91
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_ID_STRING_TYPE_LENGTH_CODE 92
+#define TMPL_SDR_COMPACT_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_ID_STRING 93
+
+/* tmpl_sdr_event_only_record */
+#define TMPL_SDR_EVENT_ONLY_RECORD_RECORD_ID 0
+#define TMPL_SDR_EVENT_ONLY_RECORD_SDR_VERSION_MAJOR 1
+#define TMPL_SDR_EVENT_ONLY_RECORD_SDR_VERSION_MINOR 2
+#define TMPL_SDR_EVENT_ONLY_RECORD_RECORD_TYPE 3
+#define TMPL_SDR_EVENT_ONLY_RECORD_RECORD_LENGTH 4
+#define TMPL_SDR_EVENT_ONLY_RECORD_SENSOR_OWNER_ID_TYPE 5
+#define TMPL_SDR_EVENT_ONLY_RECORD_SENSOR_OWNER_ID 6
+#define TMPL_SDR_EVENT_ONLY_RECORD_SENSOR_OWNER_LUN 7
+#define TMPL_SDR_EVENT_ONLY_RECORD_FRU_INVENTORY_DEVICE_OWNER_LUN 8
+#define TMPL_SDR_EVENT_ONLY_RECORD_CHANNEL_NUMBER 9
+#define TMPL_SDR_EVENT_ONLY_RECORD_SENSOR_NUMBER 10
+#define TMPL_SDR_EVENT_ONLY_RECORD_ENTITY_ID 11
+#define TMPL_SDR_EVENT_ONLY_RECORD_ENTITY_INSTANCE 12
+#define TMPL_SDR_EVENT_ONLY_RECORD_ENTITY_INSTANCE_TYPE 13
+#define TMPL_SDR_EVENT_ONLY_RECORD_SENSOR_TYPE 14
+#define TMPL_SDR_EVENT_ONLY_RECORD_EVENT_READING_TYPE_CODE 15
+#define TMPL_SDR_EVENT_ONLY_RECORD_SHARE_COUNT 16
+#define TMPL_SDR_EVENT_ONLY_RECORD_ID_STRING_INSTANCE_MODIFIER_TYPE 17
+#define TMPL_SDR_EVENT_ONLY_RECORD_SENSOR_DIRECTION 18
+#define TMPL_SDR_EVENT_ONLY_RECORD_ID_STRING_INSTANCE_MODIFIER_OFFSET 19
+#define TMPL_SDR_EVENT_ONLY_RECORD_ENTITY_INSTANCE_SHARING 20
+#define TMPL_SDR_EVENT_ONLY_RECORD_RESERVED 21
+#define TMPL_SDR_EVENT_ONLY_RECORD_OEM 22
+#define TMPL_SDR_EVENT_ONLY_RECORD_ID_STRING_TYPE_LENGTH_CODE 23
+#define TMPL_SDR_EVENT_ONLY_RECORD_ID_STRING 24
+
+/* tmpl_sdr_entity_association_record */
+#define TMPL_SDR_ENTITY_ASSOCIATION_RECORD_RECORD_ID 0
+#define TMPL_SDR_ENTITY_ASSOCIATION_RECORD_SDR_VERSION_MAJOR 1
+#define TMPL_SDR_ENTITY_ASSOCIATION_RECORD_SDR_VERSION_MINOR 2
+#define TMPL_SDR_ENTITY_ASSOCIATION_RECORD_RECORD_TYPE 3
+#define TMPL_SDR_ENTITY_ASSOCIATION_RECORD_RECORD_LENGTH 4
+#define TMPL_SDR_ENTITY_ASSOCIATION_RECORD_CONTAINER_ENTITY_ID 5
+#define TMPL_SDR_ENTITY_ASSOCIATION_RECORD_CONTAINER_ENTITY_INSTANCE 6
+#define TMPL_SDR_ENTITY_ASSOCIATION_RECORD_FLAGS_RESERVED 7
+#define TMPL_SDR_ENTITY_ASSOCIATION_RECORD_FLAGS_SENSOR_PRESENCE 8
+#define TMPL_SDR_ENTITY_ASSOCIATION_RECORD_FLAGS_RECORD_LINK 9
+#define TMPL_SDR_ENTITY_ASSOCIATION_RECORD_FLAGS_CONTAINED_ENTITIES 10
+#define TMPL_SDR_ENTITY_ASSOCIATION_RECORD_ENTITY_ID_CONTAINED_ENTITY_RANGE_1 11
+#define TMPL_SDR_ENTITY_ASSOCIATION_RECORD_INSTANCE_ID_CONTAINED_ENTITY_RANGE_1 12
+#define TMPL_SDR_ENTITY_ASSOCIATION_RECORD_ENTITY_ID_CONTAINED_ENTITY_RANGE_2 13
+#define TMPL_SDR_ENTITY_ASSOCIATION_RECORD_INSTANCE_ID_CONTAINED_ENTITY_RANGE_2 14
+#define TMPL_SDR_ENTITY_ASSOCIATION_RECORD_ENTITY_ID_CONTAINED_ENTITY_RANGE_3 15
+#define TMPL_SDR_ENTITY_ASSOCIATION_RECORD_INSTANCE_ID_CONTAINED_ENTITY_RANGE_3 16
+#define TMPL_SDR_ENTITY_ASSOCIATION_RECORD_ENTITY_ID_CONTAINED_ENTITY_RANGE_4 17
+#define TMPL_SDR_ENTITY_ASSOCIATION_RECORD_INSTANCE_ID_CONTAINED_ENTITY_RANGE_4 18
+
+/* tmpl_sdr_device_relative_entity_association_record */
+#define TMPL_SDR_DEVICE_RELATIVE_ENTITY_ASSOCIATION_RECORD_RECORD_ID 0
+#define TMPL_SDR_DEVICE_RELATIVE_ENTITY_ASSOCIATION_RECORD_SDR_VERSION_MAJOR 1
+#define TMPL_SDR_DEVICE_RELATIVE_ENTITY_ASSOCIATION_RECORD_SDR_VERSION_MINOR 2
+#define TMPL_SDR_DEVICE_RELATIVE_ENTITY_ASSOCIATION_RECORD_RECORD_TYPE 3
+#define TMPL_SDR_DEVICE_RELATIVE_ENTITY_ASSOCIATION_RECORD_RECORD_LENGTH 4
+#define TMPL_SDR_DEVICE_RELATIVE_ENTITY_ASSOCIATION_RECORD_CONTAINER_ENTITY_ID 5
+#define TMPL_SDR_DEVICE_RELATIVE_ENTITY_ASSOCIATION_RECORD_CONTAINER_ENTITY_INSTANCE 6
+#define TMPL_SDR_DEVICE_RELATIVE_ENTITY_ASSOCIATION_RECORD_CONTAINER_ENTITY_DEVICE_ADDRESS_RESERVED 7
+#define TMPL_SDR_DEVICE_RELATIVE_ENTITY_ASSOCIATION_RECORD_CONTAINER_ENTITY_DEVICE_ADDRESS 8
+#define TMPL_SDR_DEVICE_RELATIVE_ENTITY_ASSOCIATION_RECORD_CONTAINER_ENTITY_DEVICE_CHANNEL_RESERVED 9
+#define TMPL_SDR_DEVICE_RELATIVE_ENTITY_ASSOCIATION_RECORD_CONTAINER_ENTITY_DEVICE_CHANNEL 10
+#define TMPL_SDR_DEVICE_RELATIVE_ENTITY_ASSOCIATION_RECORD_FLAGS_RESERVED 11
+#define TMPL_SDR_DEVICE_RELATIVE_ENTITY_ASSOCIATION_RECORD_FLAGS_SENSOR_PRESENCE 12
+#define TMPL_SDR_DEVICE_RELATIVE_ENTITY_ASSOCIATION_RECORD_FLAGS_RECORD_LINK 13
+#define TMPL_SDR_DEVICE_RELATIVE_ENTITY_ASSOCIATION_RECORD_FLAGS_CONTAINED_ENTITIES 14
+#define TMPL_SDR_DEVICE_RELATIVE_ENTITY_ASSOCIATION_RECORD_CONTAINED_ENTITY_1_DEVICE_ADDRESS_RESERVED 15
+#define TMPL_SDR_DEVICE_RELATIVE_ENTITY_ASSOCIATION_RECORD_CONTAINED_ENTITY_1_DEVICE_ADDRESS 16
+#define TMPL_SDR_DEVICE_RELATIVE_ENTITY_ASSOCIATION_RECORD_CONTAINED_ENTITY_1_DEVICE_CHANNEL_RESERVED 17
+#define TMPL_SDR_DEVICE_RELATIVE_ENTITY_ASSOCIATION_RECORD_CONTAINED_ENTITY_1_DEVICE_CHANNEL 18
+#define TMPL_SDR_DEVICE_RELATIVE_ENTITY_ASSOCIATION_RECORD_ENTITY_ID_CONTAINED_ENTITY_RANGE_1 19
+#define TMPL_SDR_DEVICE_RELATIVE_ENTITY_ASSOCIATION_RECORD_ENTITY_INSTANCE_CONTAINED_ENTITY_RANGE_1 20
+#define TMPL_SDR_DEVICE_RELATIVE_ENTITY_ASSOCIATION_RECORD_CONTAINED_ENTITY_2_DEVICE_ADDRESS_RESERVED 21
+#define TMPL_SDR_DEVICE_RELATIVE_ENTITY_ASSOCIATION_RECORD_CONTAINED_ENTITY_2_DEVICE_ADDRESS 22
+#define TMPL_SDR_DEVICE_RELATIVE_ENTITY_ASSOCIATION_RECORD_CONTAINED_ENTITY_2_DEVICE_CHANNEL_RESERVED 23
+#define TMPL_SDR_DEVICE_RELATIVE_ENTITY_ASSOCIATION_RECORD_CONTAINED_ENTITY_2_DEVICE_CHANNEL 24
+#define TMPL_SDR_DEVICE_RELATIVE_ENTITY_ASSOCIATION_RECORD_ENTITY_ID_CONTAINED_ENTITY_RANGE_2 25
+#define TMPL_SDR_DEVICE_RELATIVE_ENTITY_ASSOCIATION_RECORD_ENTITY_INSTANCE_CONTAINED_ENTITY_RANGE_2 26
+#define TMPL_SDR_DEVICE_RELATIVE_ENTITY_ASSOCIATION_RECORD_CONTAINED_ENTITY_3_DEVICE_ADDRESS_RESERVED 27
+#define TMPL_SDR_DEVICE_RELATIVE_ENTITY_ASSOCIATION_RECORD_CONTAINED_ENTITY_3_DEVICE_ADDRESS 28
+#define TMPL_SDR_DEVICE_RELATIVE_ENTITY_ASSOCIATION_RECORD_CONTAINED_ENTITY_3_DEVICE_CHANNEL_RESERVED 29
+#define TMPL_SDR_DEVICE_RELATIVE_ENTITY_ASSOCIATION_RECORD_CONTAINED_ENTITY_3_DEVICE_CHANNEL 30
+#define TMPL_SDR_DEVICE_RELATIVE_ENTITY_ASSOCIATION_RECORD_ENTITY_ID_CONTAINED_ENTITY_RANGE_3 31
+#define TMPL_SDR_DEVICE_RELATIVE_ENTITY_ASSOCIATION_RECORD_ENTITY_INSTANCE_CONTAINED_ENTITY_RANGE_3 32
+#define TMPL_SDR_DEVICE_RELATIVE_ENTITY_ASSOCIATION_RECORD_CONTAINED_ENTITY_4_DEVICE_ADDRESS_RESERVED 33
+#define TMPL_SDR_DEVICE_RELATIVE_ENTITY_ASSOCIATION_RECORD_CONTAINED_ENTITY_4_DEVICE_ADDRESS 34
+#define TMPL_SDR_DEVICE_RELATIVE_ENTITY_ASSOCIATION_RECORD_CONTAINED_ENTITY_4_DEVICE_CHANNEL_RESERVED 35
+#define TMPL_SDR_DEVICE_RELATIVE_ENTITY_ASSOCIATION_RECORD_CONTAINED_ENTITY_4_DEVICE_CHANNEL 36
+#define TMPL_SDR_DEVICE_RELATIVE_ENTITY_ASSOCIATION_RECORD_ENTITY_ID_CONTAINED_ENTITY_RANGE_4 37
+#define TMPL_SDR_DEVICE_RELATIVE_ENTITY_ASSOCIATION_RECORD_ENTITY_INSTANCE_CONTAINED_ENTITY_RANGE_4 38
+#define TMPL_SDR_DEVICE_RELATIVE_ENTITY_ASSOCIATION_RECORD_RESERVED 39
+
+/* tmpl_sdr_generic_device_locator_record */
+#define TMPL_SDR_GENERIC_DEVICE_LOCATOR_RECORD_RECORD_ID 0
+#define TMPL_SDR_GENERIC_DEVICE_LOCATOR_RECORD_SDR_VERSION_MAJOR 1
+#define TMPL_SDR_GENERIC_DEVICE_LOCATOR_RECORD_SDR_VERSION_MINOR 2
+#define TMPL_SDR_GENERIC_DEVICE_LOCATOR_RECORD_RECORD_TYPE 3
+#define TMPL_SDR_GENERIC_DEVICE_LOCATOR_RECORD_RECORD_LENGTH 4
+#define TMPL_SDR_GENERIC_DEVICE_LOCATOR_RECORD_DEVICE_ACCESS_ADDRESS_RESERVED 5
+#define TMPL_SDR_GENERIC_DEVICE_LOCATOR_RECORD_DEVICE_ACCESS_ADDRESS 6
+#define TMPL_SDR_GENERIC_DEVICE_LOCATOR_RECORD_CHANNEL_NUMBER_MS 7
+#define TMPL_SDR_GENERIC_DEVICE_LOCATOR_RECORD_DEVICE_SLAVE_ADDRESS 8
+#define TMPL_SDR_GENERIC_DEVICE_LOCATOR_RECORD_PRIVATE_BUS_ID 9
+#define TMPL_SDR_GENERIC_DEVICE_LOCATOR_RECORD_LUN_FOR_MASTER_WRITE_READ_COMMAND 10
+#define TMPL_SDR_GENERIC_DEVICE_LOCATOR_RECORD_CHANNEL_NUMBER_LS 11
+#define TMPL_SDR_GENERIC_DEVICE_LOCATOR_RECORD_ADDRESS_SPAN 12
+#define TMPL_SDR_GENERIC_DEVICE_LOCATOR_RECORD_ADDRESS_SPAN_RESERVED 13
+#define TMPL_SDR_GENERIC_DEVICE_LOCATOR_RECORD_RESERVED 14
+#define TMPL_SDR_GENERIC_DEVICE_LOCATOR_RECORD_DEVICE_TYPE 15
+#define TMPL_SDR_GENERIC_DEVICE_LOCATOR_RECORD_DEVICE_TYPE_MODIFIER 16
+#define TMPL_SDR_GENERIC_DEVICE_LOCATOR_RECORD_ENTITY_ID 17
+#define TMPL_SDR_GENERIC_DEVICE_LOCATOR_RECORD_ENTITY_INSTANCE 18
+#define TMPL_SDR_GENERIC_DEVICE_LOCATOR_RECORD_ENTITY_INSTANCE_TYPE 19
+#define TMPL_SDR_GENERIC_DEVICE_LOCATOR_RECORD_OEM 20
+#define TMPL_SDR_GENERIC_DEVICE_LOCATOR_RECORD_DEVICE_ID_STRING_TYPE_LENGTH 21
+#define TMPL_SDR_GENERIC_DEVICE_LOCATOR_RECORD_DEVICE_ID_STRING 22
+
+/* tmpl_sdr_fru_device_locator_record */
+#define TMPL_SDR_FRU_DEVICE_LOCATOR_RECORD_RECORD_ID 0
+#define TMPL_SDR_FRU_DEVICE_LOCATOR_RECORD_SDR_VERSION_MAJOR 1
+#define TMPL_SDR_FRU_DEVICE_LOCATOR_RECORD_SDR_VERSION_MINOR 2
+#define TMPL_SDR_FRU_DEVICE_LOCATOR_RECORD_RECORD_TYPE 3
+#define TMPL_SDR_FRU_DEVICE_LOCATOR_RECORD_RECORD_LENGTH 4
+#define TMPL_SDR_FRU_DEVICE_LOCATOR_RECORD_DEVICE_ACCESS_ADDRESS_RESERVED 5
+#define TMPL_SDR_FRU_DEVICE_LOCATOR_RECORD_DEVICE_ACCESS_ADDRESS 6
+#define TMPL_SDR_FRU_DEVICE_LOCATOR_RECORD_LOGICAL_FRU_DEVICE_DEVICE_SLAVE_ADDRESS 7
+#define TMPL_SDR_FRU_DEVICE_LOCATOR_RECORD_PRIVATE_BUS_ID 8
+#define TMPL_SDR_FRU_DEVICE_LOCATOR_RECORD_LUN_FOR_MASTER_WRITE_READ_FRU_COMMAND 9
+#define TMPL_SDR_FRU_DEVICE_LOCATOR_RECORD_LOGICAL_PHYSICAL_ACCESS_LUN_BUS_ID_RESERVED 10
+#define TMPL_SDR_FRU_DEVICE_LOCATOR_RECORD_LOGICAL_PHYSICAL_FRU_DEVICE 11
+#define TMPL_SDR_FRU_DEVICE_LOCATOR_RECORD_CHANNEL_NUMBER_RESERVED 12
+#define TMPL_SDR_FRU_DEVICE_LOCATOR_RECORD_CHANNEL_NUMBER 13
+#define TMPL_SDR_FRU_DEVICE_LOCATOR_RECORD_RESERVED 14
+#define TMPL_SDR_FRU_DEVICE_LOCATOR_RECORD_DEVICE_TYPE 15
+#define TMPL_SDR_FRU_DEVICE_LOCATOR_RECORD_DEVICE_TYPE_MODIFIER 16
+#define TMPL_SDR_FRU_DEVICE_LOCATOR_RECORD_FRU_ENTITY_ID 17
+#define TMPL_SDR_FRU_DEVICE_LOCATOR_RECORD_FRU_ENTITY_INSTANCE 18
+#define TMPL_SDR_FRU_DEVICE_LOCATOR_RECORD_OEM 19
+#define TMPL_SDR_FRU_DEVICE_LOCATOR_RECORD_DEVICE_ID_STRING_TYPE_LENGTH 20
+#define TMPL_SDR_FRU_DEVICE_LOCATOR_RECORD_DEVICE_ID_STRING 21
+
+/* tmpl_sdr_fru_device_locator_record_non_intelligent */
+#define TMPL_SDR_FRU_DEVICE_LOCATOR_RECORD_NON_INTELLIGENT_RECORD_ID 0
+#define TMPL_SDR_FRU_DEVICE_LOCATOR_RECORD_NON_INTELLIGENT_SDR_VERSION_MAJOR 1
+#define TMPL_SDR_FRU_DEVICE_LOCATOR_RECORD_NON_INTELLIGENT_SDR_VERSION_MINOR 2
+#define TMPL_SDR_FRU_DEVICE_LOCATOR_RECORD_NON_INTELLIGENT_RECORD_TYPE 3
+#define TMPL_SDR_FRU_DEVICE_LOCATOR_RECORD_NON_INTELLIGENT_RECORD_LENGTH 4
+#define TMPL_SDR_FRU_DEVICE_LOCATOR_RECORD_NON_INTELLIGENT_DEVICE_ACCESS_ADDRESS_RESERVED 5
+#define TMPL_SDR_FRU_DEVICE_LOCATOR_RECORD_NON_INTELLIGENT_DEVICE_ACCESS_ADDRESS 6
+#define TMPL_SDR_FRU_DEVICE_LOCATOR_RECORD_NON_INTELLIGENT_NON_INTELLIGENT_FRU_DEVICE_RESERVED 7
+#define TMPL_SDR_FRU_DEVICE_LOCATOR_RECORD_NON_INTELLIGENT_NON_INTELLIGENT_FRU_DEVICE_SLAVE_ADDRESS 8
+#define TMPL_SDR_FRU_DEVICE_LOCATOR_RECORD_NON_INTELLIGENT_PRIVATE_BUS_ID 9
+#define TMPL_SDR_FRU_DEVICE_LOCATOR_RECORD_NON_INTELLIGENT_LUN_FOR_MASTER_WRITE_READ_FRU_COMMAND 10
+#define TMPL_SDR_FRU_DEVICE_LOCATOR_RECORD_NON_INTELLIGENT_LOGICAL_PHYSICAL_ACCESS_LUN_BUS_ID_RESERVED 11
+#define TMPL_SDR_FRU_DEVICE_LOCATOR_RECORD_NON_INTELLIGENT_LOGICAL_PHYSICAL_FRU_DEVICE 12
+#define TMPL_SDR_FRU_DEVICE_LOCATOR_RECORD_NON_INTELLIGENT_CHANNEL_NUMBER_RESERVED 13
+#define TMPL_SDR_FRU_DEVICE_LOCATOR_RECORD_NON_INTELLIGENT_CHANNEL_NUMBER 14
+#define TMPL_SDR_FRU_DEVICE_LOCATOR_RECORD_NON_INTELLIGENT_RESERVED 15
+#define TMPL_SDR_FRU_DEVICE_LOCATOR_RECORD_NON_INTELLIGENT_DEVICE_TYPE 16
+#define TMPL_SDR_FRU_DEVICE_LOCATOR_RECORD_NON_INTELLIGENT_DEVICE_TYPE_MODIFIER 17
+#define TMPL_SDR_FRU_DEVICE_LOCATOR_RECORD_NON_INTELLIGENT_FRU_ENTITY_ID 18
+#define TMPL_SDR_FRU_DEVICE_LOCATOR_RECORD_NON_INTELLIGENT_FRU_ENTITY_INSTANCE 19
+#define TMPL_SDR_FRU_DEVICE_LOCATOR_RECORD_NON_INTELLIGENT_OEM 20
+#define TMPL_SDR_FRU_DEVICE_LOCATOR_RECORD_NON_INTELLIGENT_DEVICE_ID_STRING_TYPE_LENGTH 21
+#define TMPL_SDR_FRU_DEVICE_LOCATOR_RECORD_NON_INTELLIGENT_DEVICE_ID_STRING 22
+
+/* tmpl_sdr_management_controller_device_locator_record */
+#define TMPL_SDR_MANAGEMENT_CONTROLLER_DEVICE_LOCATOR_RECORD_RECORD_ID 0
+#define TMPL_SDR_MANAGEMENT_CONTROLLER_DEVICE_LOCATOR_RECORD_SDR_VERSION_MAJOR 1
+#define TMPL_SDR_MANAGEMENT_CONTROLLER_DEVICE_LOCATOR_RECORD_SDR_VERSION_MINOR 2
+#define TMPL_SDR_MANAGEMENT_CONTROLLER_DEVICE_LOCATOR_RECORD_RECORD_TYPE 3
+#define TMPL_SDR_MANAGEMENT_CONTROLLER_DEVICE_LOCATOR_RECORD_RECORD_LENGTH 4
+#define TMPL_SDR_MANAGEMENT_CONTROLLER_DEVICE_LOCATOR_RECORD_DEVICE_SLAVE_ADDRESS_RESERVED 5
+#define TMPL_SDR_MANAGEMENT_CONTROLLER_DEVICE_LOCATOR_RECORD_DEVICE_SLAVE_ADDRESS 6
+#define TMPL_SDR_MANAGEMENT_CONTROLLER_DEVICE_LOCATOR_RECORD_CHANNEL_NUMBER 7
+#define TMPL_SDR_MANAGEMENT_CONTROLLER_DEVICE_LOCATOR_RECORD_CHANNEL_NUMBER_RESERVED 8
+#define TMPL_SDR_MANAGEMENT_CONTROLLER_DEVICE_LOCATOR_RECORD_GLOBAL_INITIALIZATION_EVENT_MESSAGE_GENERATION 9
+#define TMPL_SDR_MANAGEMENT_CONTROLLER_DEVICE_LOCATOR_RECORD_GLOBAL_INITIALIZATION_LOG_INITIALIZATION_AGENT_ERRORS 10
+#define TMPL_SDR_MANAGEMENT_CONTROLLER_DEVICE_LOCATOR_RECORD_GLOBAL_INITIALIZATION_CONTROLLER_LOGS_INITIALIZATION_AGENT_ERRORS 11
+#define TMPL_SDR_MANAGEMENT_CONTROLLER_DEVICE_LOCATOR_RECORD_POWER_STATE_NOTIFICATION_RESERVED 12
+#define TMPL_SDR_MANAGEMENT_CONTROLLER_DEVICE_LOCATOR_RECORD_POWER_STATE_NOTIFICATION_CONTROLLER 13
+#define TMPL_SDR_MANAGEMENT_CONTROLLER_DEVICE_LOCATOR_RECORD_POWER_STATE_NOTIFICATION_ACPI_DEVICE_POWER_STATE_NOTIFICATION 14
+#define TMPL_SDR_MANAGEMENT_CONTROLLER_DEVICE_LOCATOR_RECORD_POWER_STATE_NOTIFICATION_ACPI_SYSTEM_POWER_STATE_NOTIFICATION 15
+#define TMPL_SDR_MANAGEMENT_CONTROLLER_DEVICE_LOCATOR_RECORD_DEVICE_CAPABILITIES_SENSOR_DEVICE 16
+#define TMPL_SDR_MANAGEMENT_CONTROLLER_DEVICE_LOCATOR_RECORD_DEVICE_CAPABILITIES_SDR_REPOSITORY_DEVICE 17
+#define TMPL_SDR_MANAGEMENT_CONTROLLER_DEVICE_LOCATOR_RECORD_DEVICE_CAPABILITIES_SEL_DEVICE 18
+#define TMPL_SDR_MANAGEMENT_CONTROLLER_DEVICE_LOCATOR_RECORD_DEVICE_CAPABILITIES_FRU_INVENTORY_DEVICE 19
+#define TMPL_SDR_MANAGEMENT_CONTROLLER_DEVICE_LOCATOR_RECORD_DEVICE_CAPABILITIES_IPMB_EVENT_RECEIVER 20
+#define TMPL_SDR_MANAGEMENT_CONTROLLER_DEVICE_LOCATOR_RECORD_DEVICE_CAPABILITIES_IPMB_EVENT_GENERATOR 21
+#define TMPL_SDR_MANAGEMENT_CONTROLLER_DEVICE_LOCATOR_RECORD_DEVICE_CAPABILITIES_BRIDGE 22
+#define TMPL_SDR_MANAGEMENT_CONTROLLER_DEVICE_LOCATOR_RECORD_DEVICE_CAPABILITIES_CHASSIS_DEVICE 23
+#define TMPL_SDR_MANAGEMENT_CONTROLLER_DEVICE_LOCATOR_RECORD_RESERVED 24
+#define TMPL_SDR_MANAGEMENT_CONTROLLER_DEVICE_LOCATOR_RECORD_ENTITY_ID 25
+#define TMPL_SDR_MANAGEMENT_CONTROLLER_DEVICE_LOCATOR_RECORD_ENTITY_INSTANCE 26
+#define TMPL_SDR_MANAGEMENT_CONTROLLER_DEVICE_LOCATOR_RECORD_ENTITY_INSTANCE_TYPE 27
+#define TMPL_SDR_MANAGEMENT_CONTROLLER_DEVICE_LOCATOR_RECORD_OEM 28
+#define TMPL_SDR_MANAGEMENT_CONTROLLER_DEVICE_LOCATOR_RECORD_DEVICE_ID_STRING_TYPE_LENGTH 29
+#define TMPL_SDR_MANAGEMENT_CONTROLLER_DEVICE_LOCATOR_RECORD_DEVICE_ID_STRING 30
+
+/* tmpl_sdr_management_controller_confirmation_record */
+#define TMPL_SDR_MANAGEMENT_CONTROLLER_CONFIRMATION_RECORD_RECORD_ID 0
+#define TMPL_SDR_MANAGEMENT_CONTROLLER_CONFIRMATION_RECORD_SDR_VERSION_MAJOR 1
+#define TMPL_SDR_MANAGEMENT_CONTROLLER_CONFIRMATION_RECORD_SDR_VERSION_MINOR 2
+#define TMPL_SDR_MANAGEMENT_CONTROLLER_CONFIRMATION_RECORD_RECORD_TYPE 3
+#define TMPL_SDR_MANAGEMENT_CONTROLLER_CONFIRMATION_RECORD_RECORD_LENGTH 4
+#define TMPL_SDR_MANAGEMENT_CONTROLLER_CONFIRMATION_RECORD_DEVICE_SLAVE_ADDRESS_RESERVED 5
+#define TMPL_SDR_MANAGEMENT_CONTROLLER_CONFIRMATION_RECORD_DEVICE_SLAVE_ADDRESS 6
+#define TMPL_SDR_MANAGEMENT_CONTROLLER_CONFIRMATION_RECORD_DEVICE_ID 7
+#define TMPL_SDR_MANAGEMENT_CONTROLLER_CONFIRMATION_RECORD_DEVICE_REVISION 8
+#define TMPL_SDR_MANAGEMENT_CONTROLLER_CONFIRMATION_RECORD_CHANNEL_NUMBER 9
+#define TMPL_SDR_MANAGEMENT_CONTROLLER_CONFIRMATION_RECORD_MAJOR_FIRMWARE_REVISION 10
+#define TMPL_SDR_MANAGEMENT_CONTROLLER_CONFIRMATION_RECORD_MAJOR_FIRMWARE_REVISION_RESERVED 11
+#define TMPL_SDR_MANAGEMENT_CONTROLLER_CONFIRMATION_RECORD_MINOR_FIRMWARE_REVISION 12
+#define TMPL_SDR_MANAGEMENT_CONTROLLER_CONFIRMATION_RECORD_IPMI_VERSION 13
+#define TMPL_SDR_MANAGEMENT_CONTROLLER_CONFIRMATION_RECORD_MANUFACTURER_ID 14
+#define TMPL_SDR_MANAGEMENT_CONTROLLER_CONFIRMATION_RECORD_PRODUCT_ID 15
+#define TMPL_SDR_MANAGEMENT_CONTROLLER_CONFIRMATION_RECORD_DEVICE_GUID 16
+
+/* tmpl_sdr_bmc_message_channel_info_record */
+#define TMPL_SDR_BMC_MESSAGE_CHANNEL_INFO_RECORD_RECORD_ID 0
+#define TMPL_SDR_BMC_MESSAGE_CHANNEL_INFO_RECORD_SDR_VERSION_MAJOR 1
+#define TMPL_SDR_BMC_MESSAGE_CHANNEL_INFO_RECORD_SDR_VERSION_MINOR 2
+#define TMPL_SDR_BMC_MESSAGE_CHANNEL_INFO_RECORD_RECORD_TYPE 3
+#define TMPL_SDR_BMC_MESSAGE_CHANNEL_INFO_RECORD_RECORD_LENGTH 4
+#define TMPL_SDR_BMC_MESSAGE_CHANNEL_INFO_RECORD_CHANNEL_0_PROTOCOL 5
+#define TMPL_SDR_BMC_MESSAGE_CHANNEL_INFO_RECORD_CHANNEL_0_MESSAGE_RECEIVE_LUN 6
+#define TMPL_SDR_BMC_MESSAGE_CHANNEL_INFO_RECORD_CHANNEL_0_TRANSMIT_SUPPORTED 7
+#define TMPL_SDR_BMC_MESSAGE_CHANNEL_INFO_RECORD_CHANNEL_1_PROTOCOL 8
+#define TMPL_SDR_BMC_MESSAGE_CHANNEL_INFO_RECORD_CHANNEL_1_MESSAGE_RECEIVE_LUN 9
+#define TMPL_SDR_BMC_MESSAGE_CHANNEL_INFO_RECORD_CHANNEL_1_TRANSMIT_SUPPORTED 10
+#define TMPL_SDR_BMC_MESSAGE_CHANNEL_INFO_RECORD_CHANNEL_2_PROTOCOL 11
+#define TMPL_SDR_BMC_MESSAGE_CHANNEL_INFO_RECORD_CHANNEL_2_MESSAGE_RECEIVE_LUN 12
+#define TMPL_SDR_BMC_MESSAGE_CHANNEL_INFO_RECORD_CHANNEL_2_TRANSMIT_SUPPORTED 13
+#define TMPL_SDR_BMC_MESSAGE_CHANNEL_INFO_RECORD_CHANNEL_3_PROTOCOL 14
+#define TMPL_SDR_BMC_MESSAGE_CHANNEL_INFO_RECORD_CHANNEL_3_MESSAGE_RECEIVE_LUN 15
+#define TMPL_SDR_BMC_MESSAGE_CHANNEL_INFO_RECORD_CHANNEL_3_TRANSMIT_SUPPORTED 16
+#define TMPL_SDR_BMC_MESSAGE_CHANNEL_INFO_RECORD_CHANNEL_4_PROTOCOL 17
+#define TMPL_SDR_BMC_MESSAGE_CHANNEL_INFO_RECORD_CHANNEL_4_MESSAGE_RECEIVE_LUN 18
+#define TMPL_SDR_BMC_MESSAGE_CHANNEL_INFO_RECORD_CHANNEL_4_TRANSMIT_SUPPORTED 19
+#define TMPL_SDR_BMC_MESSAGE_CHANNEL_INFO_RECORD_CHANNEL_5_PROTOCOL 20
+#define TMPL_SDR_BMC_MESSAGE_CHANNEL_INFO_RECORD_CHANNEL_5_MESSAGE_RECEIVE_LUN 21
+#define TMPL_SDR_BMC_MESSAGE_CHANNEL_INFO_RECORD_CHANNEL_5_TRANSMIT_SUPPORTED 22
+#define TMPL_SDR_BMC_MESSAGE_CHANNEL_INFO_RECORD_CHANNEL_6_PROTOCOL 23
+#define TMPL_SDR_BMC_MESSAGE_CHANNEL_INFO_RECORD_CHANNEL_6_MESSAGE_RECEIVE_LUN 24
+#define TMPL_SDR_BMC_MESSAGE_CHANNEL_INFO_RECORD_CHANNEL_6_TRANSMIT_SUPPORTED 25
+#define TMPL_SDR_BMC_MESSAGE_CHANNEL_INFO_RECORD_CHANNEL_7_PROTOCOL 26
+#define TMPL_SDR_BMC_MESSAGE_CHANNEL_INFO_RECORD_CHANNEL_7_MESSAGE_RECEIVE_LUN 27
+#define TMPL_SDR_BMC_MESSAGE_CHANNEL_INFO_RECORD_CHANNEL_7_TRANSMIT_SUPPORTED 28
+
+/* tmpl_sdr_oem_record */
+#define TMPL_SDR_OEM_RECORD_RECORD_ID 0
+#define TMPL_SDR_OEM_RECORD_SDR_VERSION_MAJOR 1
+#define TMPL_SDR_OEM_RECORD_SDR_VERSION_MINOR 2
+#define TMPL_SDR_OEM_RECORD_RECORD_TYPE 3
+#define TMPL_SDR_OEM_RECORD_RECORD_LENGTH 4
+#define TMPL_SDR_OEM_RECORD_MANUFACTURER_ID 5
+#define TMPL_SDR_OEM_RECORD_OEM_DATA 6
+
+/* tmpl_sel_record_header */
+#define TMPL_SEL_RECORD_HEADER_RECORD_ID 0
+#define TMPL_SEL_RECORD_HEADER_RECORD_TYPE 1
+
+/* tmpl_sel_system_event_record */
+#define TMPL_SEL_SYSTEM_EVENT_RECORD_RECORD_ID 0
+#define TMPL_SEL_SYSTEM_EVENT_RECORD_RECORD_TYPE 1
+#define TMPL_SEL_SYSTEM_EVENT_RECORD_TIMESTAMP 2
+#define TMPL_SEL_SYSTEM_EVENT_RECORD_GENERATOR_ID_ID_TYPE 3
+#define TMPL_SEL_SYSTEM_EVENT_RECORD_GENERATOR_ID_ID 4
+#define TMPL_SEL_SYSTEM_EVENT_RECORD_IPMB_DEVICE_LUN 5
+#define TMPL_SEL_SYSTEM_EVENT_RECORD_RESERVED 6
+#define TMPL_SEL_SYSTEM_EVENT_RECORD_CHANNEL_NUMBER 7
+#define TMPL_SEL_SYSTEM_EVENT_RECORD_EVENT_MESSAGE_FORMAT_VERSION 8
+#define TMPL_SEL_SYSTEM_EVENT_RECORD_SENSOR_TYPE 9
+#define TMPL_SEL_SYSTEM_EVENT_RECORD_SENSOR_NUMBER 10
+#define TMPL_SEL_SYSTEM_EVENT_RECORD_EVENT_TYPE_CODE 11
+#define TMPL_SEL_SYSTEM_EVENT_RECORD_EVENT_DIR 12
+#define TMPL_SEL_SYSTEM_EVENT_RECORD_EVENT_DATA1 13
+#define TMPL_SEL_SYSTEM_EVENT_RECORD_EVENT_DATA2 14
+#define TMPL_SEL_SYSTEM_EVENT_RECORD_EVENT_DATA3 15
+
+/* tmpl_sel_system_event_record_event_fields */
+#define TMPL_SEL_SYSTEM_EVENT_RECORD_EVENT_FIELDS_RECORD_ID 0
+#define TMPL_SEL_SYSTEM_EVENT_RECORD_EVENT_FIELDS_RECORD_TYPE 1
+#define TMPL_SEL_SYSTEM_EVENT_RECORD_EVENT_FIELDS_TIMESTAMP 2
+#define TMPL_SEL_SYSTEM_EVENT_RECORD_EVENT_FIELDS_GENERATOR_ID_ID_TYPE 3
+#define TMPL_SEL_SYSTEM_EVENT_RECORD_EVENT_FIELDS_GENERATOR_ID_ID 4
+#define TMPL_SEL_SYSTEM_EVENT_RECORD_EVENT_FIELDS_IPMB_DEVICE_LUN 5
+#define TMPL_SEL_SYSTEM_EVENT_RECORD_EVENT_FIELDS_RESERVED 6
+#define TMPL_SEL_SYSTEM_EVENT_RECORD_EVENT_FIELDS_CHANNEL_NUMBER 7
+#define TMPL_SEL_SYSTEM_EVENT_RECORD_EVENT_FIELDS_EVENT_MESSAGE_FORMAT_VERSION 8
+#define TMPL_SEL_SYSTEM_EVENT_RECORD_EVENT_FIELDS_SENSOR_TYPE 9
+#define TMPL_SEL_SYSTEM_EVENT_RECORD_EVENT_FIELDS_SENSOR_NUMBER 10
+#define TMPL_SEL_SYSTEM_EVENT_RECORD_EVENT_FIELDS_EVENT_TYPE_CODE 11
+#define TMPL_SEL_SYSTEM_EVENT_RECORD_EVENT_FIELDS_EVENT_DIR 12
+#define TMPL_SEL_SYSTEM_EVENT_RECORD_EVENT_FIELDS_OFFSET_FROM_EVENT_READING_TYPE_CODE 13
+#define TMPL_SEL_SYSTEM_EVENT_RECORD_EVENT_FIELDS_EVENT_DATA3_FLAG 14
+#define TMPL_SEL_SYSTEM_EVENT_RECORD_EVENT_FIELDS_EVENT_DATA2_FLAG 15
+#define TMPL_SEL_SYSTEM_EVENT_RECORD_EVENT_FIELDS_EVENT_DATA2 16
+#define TMPL_SEL_SYSTEM_EVENT_RECORD_EVENT_FIELDS_EVENT_DATA3 17
+
+/* tmpl_sel_system_event_record_discrete_previous_state_severity */
+#define TMPL_SEL_SYSTEM_EVENT_RECORD_DISCRETE_PREVIOUS_STATE_SEVERITY_RECORD_ID 0
+#define TMPL_SEL_SYSTEM_EVENT_RECORD_DISCRETE_PREVIOUS_STATE_SEVERITY_RECORD_TYPE 1
+#define TMPL_SEL_SYSTEM_EVENT_RECORD_DISCRETE_PREVIOUS_STATE_SEVERITY_TIMESTAMP 2
+#define TMPL_SEL_SYSTEM_EVENT_RECORD_DISCRETE_PREVIOUS_STATE_SEVERITY_GENERATOR_ID_ID_TYPE 3
+#define TMPL_SEL_SYSTEM_EVENT_RECORD_DISCRETE_PREVIOUS_STATE_SEVERITY_GENERATOR_ID_ID 4
+#define TMPL_SEL_SYSTEM_EVENT_RECORD_DISCRETE_PREVIOUS_STATE_SEVERITY_IPMB_DEVICE_LUN 5
+#define TMPL_SEL_SYSTEM_EVENT_RECORD_DISCRETE_PREVIOUS_STATE_SEVERITY_RESERVED 6
+#define TMPL_SEL_SYSTEM_EVENT_RECORD_DISCRETE_PREVIOUS_STATE_SEVERITY_CHANNEL_NUMBER 7
+#define TMPL_SEL_SYSTEM_EVENT_RECORD_DISCRETE_PREVIOUS_STATE_SEVERITY_EVENT_MESSAGE_FORMAT_VERSION 8
+#define TMPL_SEL_SYSTEM_EVENT_RECORD_DISCRETE_PREVIOUS_STATE_SEVERITY_SENSOR_TYPE 9
+#define TMPL_SEL_SYSTEM_EVENT_RECORD_DISCRETE_PREVIOUS_STATE_SEVERITY_SENSOR_NUMBER 10
+#define TMPL_SEL_SYSTEM_EVENT_RECORD_DISCRETE_PREVIOUS_STATE_SEVERITY_EVENT_TYPE_CODE 11
+#define TMPL_SEL_SYSTEM_EVENT_RECORD_DISCRETE_PREVIOUS_STATE_SEVERITY_EVENT_DIR 12
+#define TMPL_SEL_SYSTEM_EVENT_RECORD_DISCRETE_PREVIOUS_STATE_SEVERITY_OFFSET_FROM_EVENT_READING_TYPE_CODE 13
+#define TMPL_SEL_SYSTEM_EVENT_RECORD_DISCRETE_PREVIOUS_STATE_SEVERITY_EVENT_DATA3_FLAG 14
+#define TMPL_SEL_SYSTEM_EVENT_RECORD_DISCRETE_PREVIOUS_STATE_SEVERITY_EVENT_DATA2_FLAG 15
+#define TMPL_SEL_SYSTEM_EVENT_RECORD_DISCRETE_PREVIOUS_STATE_SEVERITY_PREVIOUS_OFFSET_FROM_EVENT_READING_TYPE_CODE 16
+#define TMPL_SEL_SYSTEM_EVENT_RECORD_DISCRETE_PREVIOUS_STATE_SEVERITY_OFFSET_FROM_SEVERITY_EVENT_READING_TYPE_CODE 17
+#define TMPL_SEL_SYSTEM_EVENT_RECORD_DISCRETE_PREVIOUS_STATE_SEVERITY_EVENT_DATA3 18
+
+/* tmpl_sel_timestamped_oem_record */
+#define TMPL_SEL_TIMESTAMPED_OEM_RECORD_RECORD_ID 0
+#define TMPL_SEL_TIMESTAMPED_OEM_RECORD_RECORD_TYPE 1
+#define TMPL_SEL_TIMESTAMPED_OEM_RECORD_TIMESTAMP 2
+#define TMPL_SEL_TIMESTAMPED_OEM_RECORD_MANUFACTURER_ID 3
+#define TMPL_SEL_TIMESTAMPED_OEM_RECORD_OEM_DEFINED 4
+
+/* tmpl_sel_non_timestamped_oem_record */
+#define TMPL_SEL_NON_TIMESTAMPED_OEM_RECORD_RECORD_ID 0
+#define TMPL_SEL_NON_TIMESTAMPED_OEM_RECORD_RECORD_TYPE 1
+#define TMPL_SEL_NON_TIMESTAMPED_OEM_RECORD_OEM_DEFINED 2
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* FIID_FIELD_INDEX_H */
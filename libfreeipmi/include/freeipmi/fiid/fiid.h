@@ -56,7 +56,8 @@ enum fiid_err
     FIID_ERR_NOT_IDENTICAL                   = 22,
     FIID_ERR_OUT_OF_MEMORY                   = 23,
     FIID_ERR_INTERNAL_ERROR                  = 24,
-    FIID_ERR_ERRNUMRANGE                     = 25
+    FIID_ERR_OBJ_READ_ONLY                   = 25,
+    FIID_ERR_ERRNUMRANGE                     = 26
   };
 
 typedef enum fiid_err fiid_err_t;
@@ -171,6 +172,8 @@ typedef struct fiid_obj *fiid_obj_t;
 
 typedef struct fiid_iterator *fiid_iterator_t;
 
+typedef struct fiid_arena *fiid_arena_t;
+
 /*****************************
 * FIID Template API         *
 *****************************/
@@ -345,6 +348,42 @@ fiid_obj_t fiid_obj_create (fiid_template_t tmpl);
  */
 void fiid_obj_destroy (fiid_obj_t obj);
 
+/*
+ * fiid_obj_create_in
+ *
+ * Identical to fiid_obj_create() except the object is allocated
+ * within the specified arena.  The object may be passed to
+ * fiid_obj_destroy(), but its memory is not released until the
+ * arena is reset or destroyed.  Returns NULL on error.
+ */
+fiid_obj_t fiid_obj_create_in (fiid_arena_t arena, fiid_template_t tmpl);
+
+/*
+ * fiid_obj_view_create
+ *
+ * Return a read-only fiid object based on the specified template
+ * that reads its fields directly from the specified data buffer.
+ * Fields are set identically to fiid_obj_create() followed by
+ * fiid_obj_set_all(), but the data is not copied.  The buffer must
+ * not be modified or freed while the object exists.  Any attempt to
+ * set or clear fields of the object fails with
+ * FIID_ERR_OBJ_READ_ONLY.  Returns NULL on error.
+ */
+fiid_obj_t fiid_obj_view_create (fiid_template_t tmpl,
+                                 const void *data,
+                                 unsigned int data_len);
+
+/*
+ * fiid_obj_view_create_in
+ *
+ * Identical to fiid_obj_view_create() except the object is allocated
+ * within the specified arena.
+ */
+fiid_obj_t fiid_obj_view_create_in (fiid_arena_t arena,
+                                    fiid_template_t tmpl,
+                                    const void *data,
+                                    unsigned int data_len);
+
 /*
  * fiid_obj_dup
  *
@@ -575,6 +614,22 @@ int fiid_obj_get (fiid_obj_t obj, const char *field, uint64_t *val);
  */
 int FIID_OBJ_GET (fiid_obj_t obj, const char *field, uint64_t *val);
 
+/*
+ * fiid_obj_set_idx
+ * fiid_obj_get_idx
+ * FIID_OBJ_GET_IDX
+ *
+ * Identical to fiid_obj_set(), fiid_obj_get() and FIID_OBJ_GET()
+ * except the field is specified by its index in the template instead
+ * of its name, avoiding the field name lookup.  Field indexes are
+ * defined in fiid-field-index.h.
+ */
+int fiid_obj_set_idx (fiid_obj_t obj, unsigned int index, uint64_t val);
+
+int fiid_obj_get_idx (fiid_obj_t obj, unsigned int index, uint64_t *val);
+
+int FIID_OBJ_GET_IDX (fiid_obj_t obj, unsigned int index, uint64_t *val);
+
 /*
  * fiid_obj_set_data
  *
@@ -652,6 +707,36 @@ int fiid_obj_get_block (fiid_obj_t obj,
                         void *data,
                         unsigned int data_len);
 
+/*****************************
+* FIID Arena API            *
+*****************************/
+
+/*
+ * fiid_arena_create
+ *
+ * Create an arena for allocating fiid objects via
+ * fiid_obj_create_in().  The size hint is the initial number of
+ * bytes to reserve, 0 for a default.  Arenas are not thread safe.
+ * Returns NULL on error.
+ */
+fiid_arena_t fiid_arena_create (unsigned int size_hint);
+
+/*
+ * fiid_arena_reset
+ *
+ * Release all objects allocated within the arena.  Objects allocated
+ * within the arena are no longer valid after this call.  Returns 0
+ * on success, -1 on error.
+ */
+int fiid_arena_reset (fiid_arena_t arena);
+
+/*
+ * fiid_arena_destroy
+ *
+ * Release all objects allocated within the arena and free the arena.
+ */
+void fiid_arena_destroy (fiid_arena_t arena);
+
 /*****************************
 * FIID Iterator API         *
 *****************************/
@@ -279,7 +279,12 @@ int fill_rmcpplus_rakp_message_3 (uint8_t message_tag,
                                   unsigned int key_exchange_authentication_code_len,
                                   fiid_obj_t obj_cmd_rq);
 
-/* returns length written to pkt on success, -1 on error */
+/* returns length written to pkt on success, -1 on error
+ *
+ * The integrity pad, pad length and authentication code are
+ * calculated into pkt only.  obj_rmcpplus_session_trlr is not
+ * modified, only its next header field is read.
+ */
 int assemble_ipmi_rmcpplus_pkt (uint8_t authentication_algorithm,
                                 uint8_t integrity_algorithm,
                                 uint8_t confidentiality_algorithm,
@@ -317,6 +322,36 @@ int unassemble_ipmi_rmcpplus_pkt (uint8_t authentication_algorithm,
                                   fiid_obj_t obj_rmcpplus_session_trlr,
                                   unsigned int flags);
 
+/* returns length of the lan message on success, 0 if the packet is
+ * not a valid IPMI payload of the session, -1 on error
+ *
+ * Decodes an IPMI payload packet of an established session in place,
+ * without intermediate fiid objects.  The session header is parsed
+ * directly from pkt and an authenticated payload's authentication
+ * code is verified against the packet bytes.  *lan_msg is set to the
+ * lan message header, command data and lan message trailer, within
+ * pkt, or within lan_msg_buf if the payload is encrypted.
+ * lan_msg_buf is only required for confidentiality algorithm
+ * AES_CBC_128, a buffer of pkt_len bytes is always sufficient.
+ * session_id, session_sequence_number and the lan message are left
+ * for the caller to check.
+ */
+int unassemble_ipmi_rmcpplus_session_pkt (uint8_t integrity_algorithm,
+                                          uint8_t confidentiality_algorithm,
+                                          const void *integrity_key,
+                                          unsigned int integrity_key_len,
+                                          const void *authentication_code_data,
+                                          unsigned int authentication_code_data_len,
+                                          const void *confidentiality_key,
+                                          unsigned int confidentiality_key_len,
+                                          const void *pkt,
+                                          unsigned int pkt_len,
+                                          uint32_t *session_id,
+                                          uint32_t *session_sequence_number,
+                                          void *lan_msg_buf,
+                                          unsigned int lan_msg_buf_len,
+                                          const void **lan_msg);
+
 /* returns length sent on success, -1 on error */
 /* A few extra error checks, but nearly identical to system sendto() */
 ssize_t ipmi_rmcpplus_sendto (int s,
@@ -91,11 +91,19 @@ extern "C" {
  * ASSUME_MAX_SDR_RECORD_COUNT - If motherboard does not implement SDR
  * record reading properly, this workaround will allow code to not
  * fail out.
+ *
+ * PIPELINE - On outofband sessions, keep several Get SDR requests in
+ * flight, reading the next record while the current one is read.  Up
+ * to the context's asynchronous window of requests are outstanding,
+ * or 4 if the window is 1.  The partial read size that works is
+ * learned and kept in the SDR context.  Other interfaces read one
+ * request at a time.
  */
 #define IPMI_SDR_CACHE_CREATE_FLAGS_DEFAULT                     0x00
 #define IPMI_SDR_CACHE_CREATE_FLAGS_OVERWRITE                   0x01
 #define IPMI_SDR_CACHE_CREATE_FLAGS_DUPLICATE_RECORD_ID         0x02
 #define IPMI_SDR_CACHE_CREATE_FLAGS_ASSUME_MAX_SDR_RECORD_COUNT 0x04
+#define IPMI_SDR_CACHE_CREATE_FLAGS_PIPELINE                    0x08
 
 #define IPMI_SDR_SENSOR_NAME_FLAGS_DEFAULT                       0x00000000
 #define IPMI_SDR_SENSOR_NAME_FLAGS_IGNORE_SHARED_SENSORS         0x00000001
@@ -64,6 +64,13 @@ int ipmi_lan_check_checksum (fiid_obj_t obj_lan_msg_hdr,
 /* returns 1 on pass, 0 on fail, -1 on error */
 int ipmi_lan_check_packet_checksum (const void *pkt, unsigned int pkt_len);
 
+/* returns 1 on pass, 0 on fail, -1 on error
+ *
+ * Checks both checksums of a bare lan message, i.e. the lan message
+ * header, command data and lan message trailer of a response.
+ */
+int ipmi_lan_check_msg_checksum (const void *lan_msg, unsigned int lan_msg_len);
+
 #ifdef __cplusplus
 }
 #endif
@@ -85,6 +85,17 @@ int ipmi_calculate_rmcpplus_session_keys (uint8_t authentication_algorithm,
                                           void **confidentiality_key,
                                           unsigned int *confidentiality_key_len);
 
+/* Release any crypt state cached against a session's keys.  Callers
+ * that assemble/unassemble RMCP+ packets themselves should call this
+ * with the keys returned from ipmi_calculate_rmcpplus_session_keys()
+ * when the session is torn down.  NULL or zero length keys are
+ * ignored.
+ */
+void ipmi_flush_rmcpplus_session_keys (const void *integrity_key,
+                                       unsigned int integrity_key_len,
+                                       const void *confidentiality_key,
+                                       unsigned int confidentiality_key_len);
+
 /* return length of data written into buffer on success, -1 on error */
 int ipmi_calculate_rakp_3_key_exchange_authentication_code (uint8_t authentication_algorithm,
                                                             const void *k_uid,
@@ -272,7 +272,6 @@ assemble_ipmi_lan_pkt (fiid_obj_t obj_rmcp_hdr,
   unsigned int msg_data_count = 0;
   unsigned int checksum_data_count = 0;
   uint8_t ipmi_msg_len;
-  fiid_obj_t obj_lan_msg_trlr = NULL;
   uint8_t pwbuf[IPMI_1_5_MAX_PASSWORD_LENGTH];
   uint8_t checksum;
   int len, rv = -1;
@@ -433,25 +432,25 @@ assemble_ipmi_lan_pkt (fiid_obj_t obj_rmcp_hdr,
   msg_data_count += len;
   checksum_data_count += len;
 
-  if (!(obj_lan_msg_trlr = fiid_obj_create (tmpl_lan_msg_trlr)))
+  /* checksum2 is written in place, no trailer object is needed */
+  if ((len = fiid_template_len_bytes (tmpl_lan_msg_trlr)) < 0)
     {
       ERRNO_TRACE (errno);
       goto cleanup;
     }
-
-  checksum = ipmi_checksum (checksum_data_ptr, checksum_data_count);
-
-  if (fiid_obj_set_all (obj_lan_msg_trlr, &checksum, sizeof (checksum)) < 0)
+  if (len != sizeof (checksum))
     {
-      FIID_OBJECT_ERROR_TO_ERRNO (obj_lan_msg_trlr);
+      SET_ERRNO (EINVAL);
       goto cleanup;
     }
-
-  if ((len = fiid_obj_get_all (obj_lan_msg_trlr, pkt + indx, pkt_len - indx)) < 0)
+  if (pkt_len - indx < len)
     {
-      FIID_OBJECT_ERROR_TO_ERRNO (obj_lan_msg_trlr);
+      SET_ERRNO (EMSGSIZE);
       goto cleanup;
     }
+
+  checksum = ipmi_checksum (checksum_data_ptr, checksum_data_count);
+  memcpy (pkt + indx, &checksum, sizeof (checksum));
   indx += len;
   msg_data_count += len;
 
@@ -585,7 +584,6 @@ assemble_ipmi_lan_pkt (fiid_obj_t obj_rmcp_hdr,
       if (authentication_type == IPMI_AUTHENTICATION_TYPE_STRAIGHT_PASSWORD_KEY)
         secure_memset (pkt, '\0', pkt_len);
     }
-  fiid_obj_destroy (obj_lan_msg_trlr);
   /* secure_memset because can contain password */
   secure_memset (pwbuf, '\0', IPMI_1_5_MAX_PASSWORD_LENGTH);
   return (rv);
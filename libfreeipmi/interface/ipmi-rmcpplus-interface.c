@@ -560,6 +560,9 @@ fill_rmcpplus_rakp_message_3 (uint8_t message_tag,
   return (0);
 }
 
+/* Construct the payload directly into payload_buf, which normally
+ * points into the packet being assembled.
+ */
 static int
 _construct_payload_buf (uint8_t payload_type,
                         fiid_obj_t obj_lan_msg_hdr,
@@ -570,11 +573,10 @@ _construct_payload_buf (uint8_t payload_type,
   int obj_lan_msg_hdr_len = 0;
   int obj_cmd_len = 0;
   int obj_lan_msg_trlr_len = 0;
-  int checksum_start_offset, len, rv = -1;
+  int checksum_start_offset, len;
   unsigned int payload_len;
   uint8_t checksum;
   unsigned int indx = 0;
-  fiid_obj_t obj_lan_msg_trlr = NULL;
 
   assert ((payload_type == IPMI_PAYLOAD_TYPE_IPMI
            || payload_type == IPMI_PAYLOAD_TYPE_SOL)
@@ -586,27 +588,29 @@ _construct_payload_buf (uint8_t payload_type,
           && !(payload_type == IPMI_PAYLOAD_TYPE_SOL
                && !(fiid_obj_template_compare (obj_cmd, tmpl_sol_payload_data) == 1
                     || fiid_obj_template_compare (obj_cmd, tmpl_sol_payload_data_remote_console_to_bmc) == 1))
-          && payload_buf
-          && payload_buf_len);
+          && payload_buf);
 
   if (payload_type == IPMI_PAYLOAD_TYPE_IPMI)
     {
       if ((obj_lan_msg_hdr_len = fiid_obj_len_bytes (obj_lan_msg_hdr)) < 0)
         {
           FIID_OBJECT_ERROR_TO_ERRNO (obj_lan_msg_hdr);
-          goto cleanup;
+          return (-1);
         }
       if ((obj_lan_msg_trlr_len = fiid_template_len_bytes (tmpl_lan_msg_trlr)) < 0)
         {
           ERRNO_TRACE (errno);
-          goto cleanup;
+          return (-1);
         }
+
+      /* lan_msg_trlr is only the checksum */
+      assert (obj_lan_msg_trlr_len == sizeof (checksum));
     }
 
   if ((obj_cmd_len = fiid_obj_len_bytes (obj_cmd)) < 0)
     {
       FIID_OBJECT_ERROR_TO_ERRNO (obj_cmd);
-      goto cleanup;
+      return (-1);
     }
 
   payload_len = obj_lan_msg_hdr_len + obj_cmd_len + obj_lan_msg_trlr_len;
@@ -614,13 +618,13 @@ _construct_payload_buf (uint8_t payload_type,
   if (payload_len > IPMI_MAX_PAYLOAD_LENGTH)
     {
       SET_ERRNO (EINVAL);
-      goto cleanup;
+      return (-1);
     }
 
   if (payload_len > payload_buf_len)
     {
       SET_ERRNO (ENOSPC);
-      goto cleanup;
+      return (-1);
     }
 
   if (payload_type == IPMI_PAYLOAD_TYPE_IPMI)
@@ -630,7 +634,7 @@ _construct_payload_buf (uint8_t payload_type,
                                    payload_buf_len - indx)) < 0)
         {
           FIID_OBJECT_ERROR_TO_ERRNO (obj_lan_msg_hdr);
-          goto cleanup;
+          return (-1);
         }
       indx += len;
     }
@@ -640,55 +644,34 @@ _construct_payload_buf (uint8_t payload_type,
                                payload_buf_len - indx)) < 0)
     {
       FIID_OBJECT_ERROR_TO_ERRNO (obj_cmd);
-      goto cleanup;
+      return (-1);
     }
   indx += len;
 
   if (payload_type == IPMI_PAYLOAD_TYPE_IPMI)
     {
-      if (!(obj_lan_msg_trlr = fiid_obj_create (tmpl_lan_msg_trlr)))
-        {
-          ERRNO_TRACE (errno);
-          goto cleanup;
-        }
-
       if ((checksum_start_offset = fiid_template_field_end_bytes (tmpl_lan_msg_hdr_rq,
                                                                   "checksum1")) < 0)
         {
           ERRNO_TRACE (errno);
-          goto cleanup;
+          return (-1);
         }
       checksum = ipmi_checksum (payload_buf + checksum_start_offset, indx - checksum_start_offset);
 
-      if (fiid_obj_set_all (obj_lan_msg_trlr, &checksum, sizeof (checksum)) < 0)
-        {
-          FIID_OBJECT_ERROR_TO_ERRNO (obj_lan_msg_trlr);
-          goto cleanup;
-        }
-
-      if ((len = fiid_obj_get_all (obj_lan_msg_trlr,
-                                   payload_buf + indx,
-                                   payload_buf_len - indx)) < 0)
-        {
-          FIID_OBJECT_ERROR_TO_ERRNO (obj_lan_msg_trlr);
-          goto cleanup;
-        }
-      indx += len;
+      memcpy (payload_buf + indx, &checksum, sizeof (checksum));
+      indx += sizeof (checksum);
     }
 
-  rv = indx;
- cleanup:
-  fiid_obj_destroy (obj_lan_msg_trlr);
-  return (rv);
+  return (indx);
 }
 
 static int
 _construct_payload_confidentiality_none (uint8_t payload_type,
                                          fiid_obj_t obj_lan_msg_hdr,
                                          fiid_obj_t obj_cmd,
-                                         fiid_obj_t obj_rmcpplus_payload)
+                                         void *payload_buf,
+                                         unsigned int payload_buf_len)
 {
-  uint8_t payload_buf[IPMI_MAX_PAYLOAD_LENGTH];
   int payload_len;
 
   assert ((payload_type == IPMI_PAYLOAD_TYPE_IPMI
@@ -699,31 +682,25 @@ _construct_payload_confidentiality_none (uint8_t payload_type,
           && !(payload_type == IPMI_PAYLOAD_TYPE_SOL
                && !(fiid_obj_template_compare (obj_cmd, tmpl_sol_payload_data) == 1
                     || fiid_obj_template_compare (obj_cmd, tmpl_sol_payload_data_remote_console_to_bmc) == 1))
-          && fiid_obj_valid (obj_rmcpplus_payload)
-          && fiid_obj_template_compare (obj_rmcpplus_payload, tmpl_rmcpplus_payload) == 1);
+          && payload_buf);
 
   if ((payload_len = _construct_payload_buf (payload_type,
                                              obj_lan_msg_hdr,
                                              obj_cmd,
                                              payload_buf,
-                                             IPMI_MAX_PAYLOAD_LENGTH)) < 0)
+                                             payload_buf_len)) < 0)
     {
       ERRNO_TRACE (errno);
       return (-1);
     }
 
-  if (fiid_obj_set_data (obj_rmcpplus_payload,
-                         "payload_data",
-                         payload_buf,
-                         payload_len) < 0)
-    {
-      FIID_OBJECT_ERROR_TO_ERRNO (obj_rmcpplus_payload);
-      return (-1);
-    }
-
   return (payload_len);
 }
 
+/* Lays out confidentiality header (the IV), payload data and
+ * confidentiality trailer in payload_buf and encrypts the latter two
+ * in place.
+ */
 static int
 _construct_payload_confidentiality_aes_cbc_128 (uint8_t payload_type,
                                                 uint8_t payload_encrypted,
@@ -731,11 +708,12 @@ _construct_payload_confidentiality_aes_cbc_128 (uint8_t payload_type,
                                                 fiid_obj_t obj_cmd,
                                                 const void *confidentiality_key,
                                                 unsigned int confidentiality_key_len,
-                                                fiid_obj_t obj_rmcpplus_payload)
+                                                void *payload_buf,
+                                                unsigned int payload_buf_len)
 {
-  uint8_t iv[IPMI_CRYPT_AES_CBC_128_IV_LENGTH];
+  uint8_t *iv;
+  uint8_t *payload_data;
   int iv_len;
-  uint8_t payload_buf[IPMI_MAX_PAYLOAD_LENGTH];
   uint8_t pad_len, pad_tmp;
   int payload_len, cipher_keylen, cipher_blocklen, encrypt_len;
 
@@ -753,8 +731,7 @@ _construct_payload_confidentiality_aes_cbc_128 (uint8_t payload_type,
           && fiid_obj_packet_valid (obj_cmd) == 1
           && confidentiality_key
           && confidentiality_key_len
-          && fiid_obj_valid (obj_rmcpplus_payload)
-          && fiid_obj_template_compare (obj_rmcpplus_payload, tmpl_rmcpplus_payload) == 1);
+          && payload_buf);
 
   if ((cipher_keylen = crypt_cipher_key_len (IPMI_CRYPT_CIPHER_AES)) < 0)
     {
@@ -780,6 +757,15 @@ _construct_payload_confidentiality_aes_cbc_128 (uint8_t payload_type,
 
   assert (cipher_blocklen == IPMI_CRYPT_AES_CBC_128_BLOCK_LENGTH);
 
+  if (payload_buf_len < IPMI_CRYPT_AES_CBC_128_IV_LENGTH)
+    {
+      SET_ERRNO (ENOSPC);
+      return (-1);
+    }
+
+  iv = payload_buf;
+  payload_data = payload_buf + IPMI_CRYPT_AES_CBC_128_IV_LENGTH;
+
   if ((iv_len = ipmi_get_random (iv, IPMI_CRYPT_AES_CBC_128_IV_LENGTH)) < 0)
     {
       ERRNO_TRACE (errno);
@@ -795,8 +781,8 @@ _construct_payload_confidentiality_aes_cbc_128 (uint8_t payload_type,
   if ((payload_len = _construct_payload_buf (payload_type,
                                              obj_lan_msg_hdr,
                                              obj_cmd,
-                                             payload_buf,
-                                             IPMI_MAX_PAYLOAD_LENGTH)) < 0)
+                                             payload_data,
+                                             payload_buf_len - iv_len)) < 0)
     {
       ERRNO_TRACE (errno);
       return (-1);
@@ -811,7 +797,8 @@ _construct_payload_confidentiality_aes_cbc_128 (uint8_t payload_type,
   else
     pad_len = 0;
 
-  if ((payload_len + pad_len + 1) > IPMI_MAX_PAYLOAD_LENGTH)
+  if ((payload_len + pad_len + 1) > IPMI_MAX_PAYLOAD_LENGTH
+      || (iv_len + payload_len + pad_len + 1) > payload_buf_len)
     {
       SET_ERRNO (ENOSPC);
       return (-1);
@@ -821,9 +808,9 @@ _construct_payload_confidentiality_aes_cbc_128 (uint8_t payload_type,
     {
       unsigned int i;
       for (i = 0; i < pad_len; i++)
-        payload_buf[payload_len + i] = i + 1;
+        payload_data[payload_len + i] = i + 1;
     }
-  payload_buf[payload_len + pad_len] = pad_len;
+  payload_data[payload_len + pad_len] = pad_len;
 
   /* +1 for pad length field */
   if ((encrypt_len = crypt_cipher_encrypt (IPMI_CRYPT_CIPHER_AES,
@@ -832,7 +819,7 @@ _construct_payload_confidentiality_aes_cbc_128 (uint8_t payload_type,
                                            confidentiality_key_len,
                                            iv,
                                            iv_len,
-                                           payload_buf,
+                                           payload_data,
                                            payload_len + pad_len + 1)) < 0)
     {
       ERRNO_TRACE (errno);
@@ -845,42 +832,15 @@ _construct_payload_confidentiality_aes_cbc_128 (uint8_t payload_type,
       return (-1);
     }
 
-  if (fiid_obj_set_data (obj_rmcpplus_payload,
-                         "confidentiality_header",
-                         iv,
-                         IPMI_CRYPT_AES_CBC_128_IV_LENGTH) < 0)
-    {
-      FIID_OBJECT_ERROR_TO_ERRNO (obj_rmcpplus_payload);
-      return (-1);
-    }
-
-  if (fiid_obj_set_data (obj_rmcpplus_payload,
-                         "payload_data",
-                         payload_buf,
-                         payload_len) < 0)
-    {
-      FIID_OBJECT_ERROR_TO_ERRNO (obj_rmcpplus_payload);
-      return (-1);
-    }
-
-  if (fiid_obj_set_data (obj_rmcpplus_payload,
-                         "confidentiality_trailer",
-                         payload_buf + payload_len,
-                         pad_len + 1) < 0)
-    {
-      FIID_OBJECT_ERROR_TO_ERRNO (obj_rmcpplus_payload);
-      return (-1);
-    }
-
   return (iv_len + payload_len + pad_len + 1);
 }
 
 static int
 _construct_payload_rakp (uint8_t payload_type,
                          fiid_obj_t obj_cmd,
-                         fiid_obj_t obj_rmcpplus_payload)
+                         void *payload_buf,
+                         unsigned int payload_buf_len)
 {
-  uint8_t obj_cmd_buf[IPMI_MAX_PAYLOAD_LENGTH];
   int obj_cmd_len = 0;
 
   assert ((payload_type == IPMI_PAYLOAD_TYPE_RMCPPLUS_OPEN_SESSION_REQUEST
@@ -893,30 +853,33 @@ _construct_payload_rakp (uint8_t payload_type,
                && fiid_obj_template_compare (obj_cmd, tmpl_rmcpplus_rakp_message_1) < 0)
           && !(payload_type == IPMI_PAYLOAD_TYPE_RAKP_MESSAGE_3
                && fiid_obj_template_compare (obj_cmd, tmpl_rmcpplus_rakp_message_3) < 0)
-          && fiid_obj_valid (obj_rmcpplus_payload)
-          && fiid_obj_template_compare (obj_rmcpplus_payload, tmpl_rmcpplus_payload) == 1
-          && fiid_obj_packet_valid (obj_cmd) == 1);
+          && fiid_obj_packet_valid (obj_cmd) == 1
+          && payload_buf);
 
-  if ((obj_cmd_len = fiid_obj_get_all (obj_cmd,
-                                       obj_cmd_buf,
-                                       IPMI_MAX_PAYLOAD_LENGTH)) < 0)
+  if ((obj_cmd_len = fiid_obj_len_bytes (obj_cmd)) < 0)
     {
       FIID_OBJECT_ERROR_TO_ERRNO (obj_cmd);
       return (-1);
     }
 
-  if (fiid_obj_set_data (obj_rmcpplus_payload,
-                         "payload_data",
-                         obj_cmd_buf,
-                         obj_cmd_len) < 0)
+  if (obj_cmd_len > payload_buf_len)
     {
-      FIID_OBJECT_ERROR_TO_ERRNO (obj_rmcpplus_payload);
+      SET_ERRNO (ENOSPC);
+      return (-1);
+    }
+
+  if ((obj_cmd_len = fiid_obj_get_all (obj_cmd,
+                                       payload_buf,
+                                       payload_buf_len)) < 0)
+    {
+      FIID_OBJECT_ERROR_TO_ERRNO (obj_cmd);
       return (-1);
     }
 
   return (obj_cmd_len);
 }
 
+/* returns length of payload written to payload_buf */
 static int
 _construct_payload (uint8_t payload_type,
                     uint8_t payload_encrypted,
@@ -926,7 +889,8 @@ _construct_payload (uint8_t payload_type,
                     fiid_obj_t obj_cmd,
                     const void *confidentiality_key,
                     unsigned int confidentiality_key_len,
-                    fiid_obj_t obj_rmcpplus_payload)
+                    void *payload_buf,
+                    unsigned int payload_buf_len)
 {
   assert ((payload_type == IPMI_PAYLOAD_TYPE_IPMI
            || payload_type == IPMI_PAYLOAD_TYPE_SOL
@@ -938,9 +902,7 @@ _construct_payload (uint8_t payload_type,
           && !(payload_type == IPMI_PAYLOAD_TYPE_IPMI
                && !fiid_obj_valid (obj_lan_msg_hdr))
           && fiid_obj_valid (obj_cmd)
-          && fiid_obj_valid (obj_rmcpplus_payload)
-          && fiid_obj_template_compare (obj_lan_msg_hdr, tmpl_lan_msg_hdr_rq) == 1
-          && fiid_obj_template_compare (obj_rmcpplus_payload, tmpl_rmcpplus_payload) == 1);
+          && payload_buf);
 
   if (payload_type == IPMI_PAYLOAD_TYPE_IPMI
       || payload_type == IPMI_PAYLOAD_TYPE_SOL)
@@ -950,7 +912,8 @@ _construct_payload (uint8_t payload_type,
         return (_construct_payload_confidentiality_none (payload_type,
                                                          obj_lan_msg_hdr,
                                                          obj_cmd,
-                                                         obj_rmcpplus_payload));
+                                                         payload_buf,
+                                                         payload_buf_len));
       else /* IPMI_CONFIDENTIALITY_ALGORITHM_AES_CBC_128 */
         return (_construct_payload_confidentiality_aes_cbc_128 (payload_type,
                                                                 payload_encrypted,
@@ -958,29 +921,37 @@ _construct_payload (uint8_t payload_type,
                                                                 obj_cmd,
                                                                 confidentiality_key,
                                                                 confidentiality_key_len,
-                                                                obj_rmcpplus_payload));
+                                                                payload_buf,
+                                                                payload_buf_len));
     }
   else
     return (_construct_payload_rakp (payload_type,
                                      obj_cmd,
-                                     obj_rmcpplus_payload));
+                                     payload_buf,
+                                     payload_buf_len));
 }
 
+/* Writes integrity pad, pad length and next header into trlr_buf,
+ * returns length written.  The pad fields are not stored in
+ * obj_rmcpplus_session_trlr, the caller's object is only read.
+ */
 static int
 _construct_session_trlr_pad (uint8_t integrity_algorithm,
                              unsigned int ipmi_msg_len,
-                             fiid_obj_t obj_rmcpplus_session_trlr)
+                             fiid_obj_t obj_rmcpplus_session_trlr,
+                             void *trlr_buf,
+                             unsigned int trlr_buf_len)
 {
-  int pad_length_field_len, next_header_field_len;
+  int pad_length_field_len, next_header_field_len, ret;
   unsigned int pad_length = 0;
-  uint8_t pad_bytes[IPMI_INTEGRITY_PAD_MULTIPLE] = { IPMI_INTEGRITY_PAD_DATA,
-                                                     IPMI_INTEGRITY_PAD_DATA,
-                                                     IPMI_INTEGRITY_PAD_DATA,
-                                                     IPMI_INTEGRITY_PAD_DATA};
+  uint8_t *trlr_data = trlr_buf;
+  uint8_t next_header;
+  uint64_t val;
 
   assert (IPMI_INTEGRITY_ALGORITHM_SUPPORTED (integrity_algorithm)
           && fiid_obj_valid (obj_rmcpplus_session_trlr)
-          && fiid_obj_template_compare (obj_rmcpplus_session_trlr, tmpl_rmcpplus_session_trlr) == 1);
+          && fiid_obj_template_compare (obj_rmcpplus_session_trlr, tmpl_rmcpplus_session_trlr) == 1
+          && trlr_buf);
 
   if ((pad_length_field_len = fiid_template_field_len_bytes (tmpl_rmcpplus_session_trlr,
                                                              "pad_length")) < 0)
@@ -995,33 +966,35 @@ _construct_session_trlr_pad (uint8_t integrity_algorithm,
       return (-1);
     }
 
+  assert (pad_length_field_len == 1 && next_header_field_len == 1);
+
+  /* next header is normally set by fill_rmcpplus_session_trlr() */
+  if ((ret = FIID_OBJ_GET (obj_rmcpplus_session_trlr,
+                           "next_header",
+                           &val)) < 0)
+    {
+      FIID_OBJECT_ERROR_TO_ERRNO (obj_rmcpplus_session_trlr);
+      return (-1);
+    }
+  next_header = ret ? val : IPMI_NEXT_HEADER;
+
   ipmi_msg_len += pad_length_field_len;
   ipmi_msg_len += next_header_field_len;
 
   if (ipmi_msg_len % IPMI_INTEGRITY_PAD_MULTIPLE)
     pad_length = IPMI_INTEGRITY_PAD_MULTIPLE - (ipmi_msg_len % IPMI_INTEGRITY_PAD_MULTIPLE);
 
-  if (pad_length)
-    {
-      if (fiid_obj_set_data (obj_rmcpplus_session_trlr,
-                             "integrity_pad",
-                             pad_bytes,
-                             pad_length) < 0)
-        {
-          FIID_OBJECT_ERROR_TO_ERRNO (obj_rmcpplus_session_trlr);
-          return (-1);
-        }
-    }
-
-  if (fiid_obj_set (obj_rmcpplus_session_trlr,
-                    "pad_length",
-                    pad_length) < 0)
+  if ((pad_length + pad_length_field_len + next_header_field_len) > trlr_buf_len)
     {
-      FIID_OBJECT_ERROR_TO_ERRNO (obj_rmcpplus_session_trlr);
+      SET_ERRNO (ENOSPC);
       return (-1);
     }
 
-  return (0);
+  memset (trlr_data, IPMI_INTEGRITY_PAD_DATA, pad_length);
+  trlr_data[pad_length] = pad_length;
+  trlr_data[pad_length + 1] = next_header;
+
+  return (pad_length + pad_length_field_len + next_header_field_len);
 }
 
 static int
@@ -1049,21 +1022,24 @@ _calculate_authentication_code_len (uint8_t integrity_algorithm)
   return (authentication_code_len);
 }
 
+/* calculate the session trailer authentication code over pkt_data,
+ * the data is hashed where it lies except for MD5_128
+ */
 static int
-_construct_session_trlr_authentication_code (uint8_t integrity_algorithm,
+_calculate_session_trlr_authentication_code (uint8_t integrity_algorithm,
                                              const void *integrity_key,
                                              unsigned int integrity_key_len,
                                              const void *authentication_code_data,
                                              unsigned int authentication_code_data_len,
-                                             fiid_obj_t obj_rmcpplus_session_trlr,
-                                             void *pkt_data,
+                                             const void *pkt_data,
                                              unsigned int pkt_data_len,
                                              void *authentication_code_buf,
                                              unsigned int authentication_code_buf_len)
 {
-  int crypt_digest_len, authentication_code_len, integrity_digest_len, len, rv = -1;
+  int crypt_digest_len, integrity_digest_len, rv = -1;
   unsigned int hash_algorithm, hash_flags, expected_digest_len, copy_digest_len, hash_data_len;
   uint8_t hash_data[IPMI_MAX_PAYLOAD_LENGTH];
+  const void *hash_data_ptr;
   uint8_t integrity_digest[IPMI_MAX_INTEGRITY_DATA_LENGTH];
   uint8_t pwbuf[IPMI_2_0_MAX_PASSWORD_LENGTH];
 
@@ -1074,59 +1050,24 @@ _construct_session_trlr_authentication_code (uint8_t integrity_algorithm,
           && !(integrity_algorithm == IPMI_INTEGRITY_ALGORITHM_MD5_128
                && authentication_code_data
                && authentication_code_data_len > IPMI_2_0_MAX_PASSWORD_LENGTH)
-          && fiid_obj_valid (obj_rmcpplus_session_trlr)
           && pkt_data
           && pkt_data_len
           && authentication_code_buf
           && authentication_code_buf_len);
 
-  if (FIID_OBJ_TEMPLATE_COMPARE (obj_rmcpplus_session_trlr, tmpl_rmcpplus_session_trlr) < 0)
-    {
-      ERRNO_TRACE (errno);
-      return (-1);
-    }
-
-  /* Check if the user provided an authentication code, if so, use it */
-
-  if ((len = fiid_obj_field_len_bytes (obj_rmcpplus_session_trlr,
-                                       "authentication_code")) < 0)
-    {
-      FIID_OBJECT_ERROR_TO_ERRNO (obj_rmcpplus_session_trlr);
-      return (-1);
-    }
-
-  if (len)
-    {
-      if ((len = fiid_obj_get_data (obj_rmcpplus_session_trlr,
-                                    "authentication_code",
-                                    authentication_code_buf,
-                                    authentication_code_buf_len)) < 0)
-        {
-          FIID_OBJECT_ERROR_TO_ERRNO (obj_rmcpplus_session_trlr);
-          return (-1);
-        }
-      return (len);
-    }
-
-  if ((authentication_code_len = _calculate_authentication_code_len (integrity_algorithm)) < 0)
-    {
-      ERRNO_TRACE (errno);
-      goto cleanup;
-    }
-
   /* Note: Integrity Key for HMAC_SHA1_96 and HMAC_MD5_128 is K1 */
 
   if (integrity_algorithm == IPMI_INTEGRITY_ALGORITHM_HMAC_SHA1_96)
     {
       hash_algorithm = IPMI_CRYPT_HASH_SHA1;
-      hash_flags = IPMI_CRYPT_HASH_FLAGS_HMAC;
+      hash_flags = IPMI_CRYPT_HASH_FLAGS_HMAC | IPMI_CRYPT_HASH_FLAGS_CACHE;
       expected_digest_len = IPMI_HMAC_SHA1_DIGEST_LENGTH;
       copy_digest_len = IPMI_HMAC_SHA1_96_AUTHENTICATION_CODE_LENGTH;
     }
   else if (integrity_algorithm == IPMI_INTEGRITY_ALGORITHM_HMAC_MD5_128)
     {
       hash_algorithm = IPMI_CRYPT_HASH_MD5;
-      hash_flags = IPMI_CRYPT_HASH_FLAGS_HMAC;
+      hash_flags = IPMI_CRYPT_HASH_FLAGS_HMAC | IPMI_CRYPT_HASH_FLAGS_CACHE;
       expected_digest_len = IPMI_HMAC_MD5_DIGEST_LENGTH;
       copy_digest_len = IPMI_HMAC_MD5_128_AUTHENTICATION_CODE_LENGTH;
     }
@@ -1140,7 +1081,7 @@ _construct_session_trlr_authentication_code (uint8_t integrity_algorithm,
   else /* IPMI_INTEGRITY_ALGORITHM_HMAC_SHA256_128 */
     {
       hash_algorithm = IPMI_CRYPT_HASH_SHA256;
-      hash_flags = IPMI_CRYPT_HASH_FLAGS_HMAC;
+      hash_flags = IPMI_CRYPT_HASH_FLAGS_HMAC | IPMI_CRYPT_HASH_FLAGS_CACHE;
       expected_digest_len = IPMI_HMAC_SHA256_DIGEST_LENGTH;
       copy_digest_len = IPMI_HMAC_SHA256_128_AUTHENTICATION_CODE_LENGTH;
     }
@@ -1153,10 +1094,19 @@ _construct_session_trlr_authentication_code (uint8_t integrity_algorithm,
 
   assert (crypt_digest_len == expected_digest_len);
 
-  hash_data_len = 0;
-
+  /* The HMACs are computed over the packet data where it lies, only
+   * MD5_128 needs the password wrapped around it.
+   */
   if (integrity_algorithm == IPMI_INTEGRITY_ALGORITHM_MD5_128)
     {
+      if ((IPMI_2_0_MAX_PASSWORD_LENGTH * 2 + pkt_data_len) > IPMI_MAX_PAYLOAD_LENGTH)
+        {
+          SET_ERRNO (EINVAL);
+          goto cleanup;
+        }
+
+      hash_data_len = 0;
+
       /* achu: Password must be zero padded */
       memset (pwbuf, '\0', IPMI_2_0_MAX_PASSWORD_LENGTH);
 
@@ -1167,24 +1117,28 @@ _construct_session_trlr_authentication_code (uint8_t integrity_algorithm,
               pwbuf,
               IPMI_2_0_MAX_PASSWORD_LENGTH);
       hash_data_len += IPMI_2_0_MAX_PASSWORD_LENGTH;
-    }
 
-  memcpy (hash_data + hash_data_len, pkt_data, pkt_data_len);
-  hash_data_len += pkt_data_len;
+      memcpy (hash_data + hash_data_len, pkt_data, pkt_data_len);
+      hash_data_len += pkt_data_len;
 
-  if (integrity_algorithm == IPMI_INTEGRITY_ALGORITHM_MD5_128)
-    {
       memcpy (hash_data + hash_data_len,
               pwbuf,
               IPMI_2_0_MAX_PASSWORD_LENGTH);
       hash_data_len += IPMI_2_0_MAX_PASSWORD_LENGTH;
+
+      hash_data_ptr = hash_data;
+    }
+  else
+    {
+      hash_data_ptr = pkt_data;
+      hash_data_len = pkt_data_len;
     }
 
   if ((integrity_digest_len = crypt_hash (hash_algorithm,
                                           hash_flags,
                                           integrity_key,
                                           integrity_key_len,
-                                          hash_data,
+                                          hash_data_ptr,
                                           hash_data_len,
                                           integrity_digest,
                                           IPMI_MAX_INTEGRITY_DATA_LENGTH)) < 0)
@@ -1199,7 +1153,7 @@ _construct_session_trlr_authentication_code (uint8_t integrity_algorithm,
       goto cleanup;
     }
 
-  if (integrity_digest_len > authentication_code_buf_len)
+  if (copy_digest_len > authentication_code_buf_len)
     {
       SET_ERRNO (ENOSPC);
       goto cleanup;
@@ -1214,6 +1168,72 @@ _construct_session_trlr_authentication_code (uint8_t integrity_algorithm,
   return (rv);
 }
 
+static int
+_construct_session_trlr_authentication_code (uint8_t integrity_algorithm,
+                                             const void *integrity_key,
+                                             unsigned int integrity_key_len,
+                                             const void *authentication_code_data,
+                                             unsigned int authentication_code_data_len,
+                                             fiid_obj_t obj_rmcpplus_session_trlr,
+                                             void *pkt_data,
+                                             unsigned int pkt_data_len,
+                                             void *authentication_code_buf,
+                                             unsigned int authentication_code_buf_len)
+{
+  int len;
+
+  assert ((integrity_algorithm == IPMI_INTEGRITY_ALGORITHM_HMAC_SHA1_96
+           || integrity_algorithm == IPMI_INTEGRITY_ALGORITHM_HMAC_MD5_128
+           || integrity_algorithm == IPMI_INTEGRITY_ALGORITHM_MD5_128
+           || integrity_algorithm == IPMI_INTEGRITY_ALGORITHM_HMAC_SHA256_128)
+          && !(integrity_algorithm == IPMI_INTEGRITY_ALGORITHM_MD5_128
+               && authentication_code_data
+               && authentication_code_data_len > IPMI_2_0_MAX_PASSWORD_LENGTH)
+          && fiid_obj_valid (obj_rmcpplus_session_trlr)
+          && pkt_data
+          && pkt_data_len
+          && authentication_code_buf
+          && authentication_code_buf_len);
+
+  if (FIID_OBJ_TEMPLATE_COMPARE (obj_rmcpplus_session_trlr, tmpl_rmcpplus_session_trlr) < 0)
+    {
+      ERRNO_TRACE (errno);
+      return (-1);
+    }
+
+  /* Check if the user provided an authentication code, if so, use it */
+
+  if ((len = fiid_obj_field_len_bytes (obj_rmcpplus_session_trlr,
+                                       "authentication_code")) < 0)
+    {
+      FIID_OBJECT_ERROR_TO_ERRNO (obj_rmcpplus_session_trlr);
+      return (-1);
+    }
+
+  if (len)
+    {
+      if ((len = fiid_obj_get_data (obj_rmcpplus_session_trlr,
+                                    "authentication_code",
+                                    authentication_code_buf,
+                                    authentication_code_buf_len)) < 0)
+        {
+          FIID_OBJECT_ERROR_TO_ERRNO (obj_rmcpplus_session_trlr);
+          return (-1);
+        }
+      return (len);
+    }
+
+  return (_calculate_session_trlr_authentication_code (integrity_algorithm,
+                                                       integrity_key,
+                                                       integrity_key_len,
+                                                       authentication_code_data,
+                                                       authentication_code_data_len,
+                                                       pkt_data,
+                                                       pkt_data_len,
+                                                       authentication_code_buf,
+                                                       authentication_code_buf_len));
+}
+
 int
 assemble_ipmi_rmcpplus_pkt (uint8_t authentication_algorithm,
                             uint8_t integrity_algorithm,
@@ -1234,13 +1254,11 @@ assemble_ipmi_rmcpplus_pkt (uint8_t authentication_algorithm,
                             unsigned int flags)
 {
   unsigned int indx = 0;
-  int obj_rmcp_hdr_len, obj_len, oem_iana_len, oem_payload_id_len, payload_len, len, rv = -1;
+  int obj_rmcp_hdr_len, oem_iana_len, oem_payload_id_len, payload_len_field_len, payload_len, len;
   uint8_t payload_type, payload_authenticated, payload_encrypted;
   uint32_t session_id, session_sequence_number;
+  uint8_t *pkt_data;
   uint64_t val;
-  fiid_obj_t obj_rmcpplus_payload = NULL;
-  fiid_obj_t obj_session_hdr_temp = NULL;
-  fiid_obj_t obj_rmcpplus_session_trlr_temp = NULL;
   unsigned int flags_mask = 0;
 
   /* achu: obj_lan_msg_hdr only needed for payload type IPMI
@@ -1520,12 +1538,22 @@ assemble_ipmi_rmcpplus_pkt (uint8_t authentication_algorithm,
   indx += len;
 
   /*
-   * Construct/Encrypt Payload and copy into packet
+   * Construct/Encrypt Payload directly into packet, after the IPMI
+   * Payload Length, which is filled in once the length is known.
    */
-  if (!(obj_rmcpplus_payload = fiid_obj_create (tmpl_rmcpplus_payload)))
+  if ((payload_len_field_len = fiid_template_field_len_bytes (tmpl_rmcpplus_session_hdr,
+                                                              "ipmi_payload_len")) < 0)
     {
       ERRNO_TRACE (errno);
-      goto cleanup;
+      return (-1);
+    }
+
+  assert (payload_len_field_len == 2);
+
+  if (payload_len_field_len > (pkt_len - indx))
+    {
+      SET_ERRNO (ENOSPC);
+      return (-1);
     }
 
   if ((payload_len = _construct_payload (payload_type,
@@ -1536,116 +1564,37 @@ assemble_ipmi_rmcpplus_pkt (uint8_t authentication_algorithm,
                                          obj_cmd,
                                          confidentiality_key,
                                          confidentiality_key_len,
-                                         obj_rmcpplus_payload)) < 0)
+                                         pkt + indx + payload_len_field_len,
+                                         pkt_len - indx - payload_len_field_len)) < 0)
     {
       ERRNO_TRACE (errno);
-      goto cleanup;
-    }
-
-  /*
-   * Copy IPMI Payload Length into packet
-   */
-
-  if (!(obj_session_hdr_temp = fiid_obj_create (tmpl_rmcpplus_session_hdr)))
-    {
-      ERRNO_TRACE (errno);
-      goto cleanup;
-    }
-
-  if (fiid_obj_set (obj_session_hdr_temp,
-                    "ipmi_payload_len",
-                    payload_len) < 0)
-    {
-      FIID_OBJECT_ERROR_TO_ERRNO (obj_session_hdr_temp);
-      goto cleanup;
-    }
-
-  if ((obj_len = fiid_obj_len_bytes (obj_session_hdr_temp)) < 0)
-    {
-      FIID_OBJECT_ERROR_TO_ERRNO (obj_session_hdr_temp);
-      goto cleanup;
-    }
-
-  if (obj_len > (pkt_len - indx))
-    {
-      SET_ERRNO (ENOSPC);
-      goto cleanup;
-    }
-
-  if ((obj_len = fiid_obj_get_all (obj_session_hdr_temp,
-                                   pkt + indx,
-                                   pkt_len - indx)) < 0)
-    {
-      FIID_OBJECT_ERROR_TO_ERRNO (obj_session_hdr_temp);
-      goto cleanup;
-    }
-  indx += obj_len;
-
-  /*
-   * Copy IPMI Payload into packet
-   */
-
-  if ((obj_len = fiid_obj_len_bytes (obj_rmcpplus_payload)) < 0)
-    {
-      FIID_OBJECT_ERROR_TO_ERRNO (obj_rmcpplus_payload);
-      goto cleanup;
+      return (-1);
     }
 
-  if (obj_len > (pkt_len - indx))
+  if (payload_len > USHRT_MAX)
     {
-      SET_ERRNO (ENOSPC);
-      goto cleanup;
+      SET_ERRNO (EINVAL);
+      return (-1);
     }
 
-  if ((obj_len = fiid_obj_get_all (obj_rmcpplus_payload,
-                                   pkt + indx,
-                                   pkt_len - indx)) < 0)
-    {
-      FIID_OBJECT_ERROR_TO_ERRNO (obj_rmcpplus_payload);
-      goto cleanup;
-    }
-  indx += obj_len;
+  /* ipmi_payload_len is little endian on the wire */
+  pkt_data = pkt;
+  pkt_data[indx] = payload_len & 0xFF;
+  pkt_data[indx + 1] = (payload_len & 0xFF00) >> 8;
+  indx += payload_len_field_len + payload_len;
 
   if (session_id && payload_authenticated == IPMI_PAYLOAD_FLAG_AUTHENTICATED)
     {
-      uint8_t authentication_code_buf[IPMI_MAX_PAYLOAD_LENGTH];
       int authentication_code_len;
 
-      if (!(obj_rmcpplus_session_trlr_temp = fiid_obj_dup (obj_rmcpplus_session_trlr)))
-        {
-          FIID_OBJECT_ERROR_TO_ERRNO (obj_rmcpplus_session_trlr);
-          goto cleanup;
-        }
-
-      if (_construct_session_trlr_pad (integrity_algorithm,
-                                       (indx - obj_rmcp_hdr_len),
-                                       obj_rmcpplus_session_trlr_temp) < 0)
+      if ((len = _construct_session_trlr_pad (integrity_algorithm,
+                                              (indx - obj_rmcp_hdr_len),
+                                              obj_rmcpplus_session_trlr,
+                                              pkt + indx,
+                                              pkt_len - indx)) < 0)
         {
           ERRNO_TRACE (errno);
-          goto cleanup;
-        }
-
-      if ((len = fiid_obj_block_len_bytes (obj_rmcpplus_session_trlr_temp,
-                                           "integrity_pad",
-                                           "next_header")) < 0)
-        {
-          FIID_OBJECT_ERROR_TO_ERRNO (obj_rmcpplus_session_trlr_temp);
-          goto cleanup;
-        }
-      if (len > (pkt_len - indx))
-        {
-          SET_ERRNO (ENOSPC);
-          goto cleanup;
-        }
-
-      if ((len = fiid_obj_get_block (obj_rmcpplus_session_trlr_temp,
-                                     "integrity_pad",
-                                     "next_header",
-                                     pkt + indx,
-                                     pkt_len - indx)) < 0)
-        {
-          FIID_OBJECT_ERROR_TO_ERRNO (obj_rmcpplus_session_trlr_temp);
-          goto cleanup;
+          return (-1);
         }
       indx += len;
 
@@ -1658,40 +1607,25 @@ assemble_ipmi_rmcpplus_pkt (uint8_t authentication_algorithm,
                                                                                   integrity_key_len,
                                                                                   authentication_code_data,
                                                                                   authentication_code_data_len,
-                                                                                  obj_rmcpplus_session_trlr_temp,
+                                                                                  obj_rmcpplus_session_trlr,
                                                                                   pkt + obj_rmcp_hdr_len,
                                                                                   indx - obj_rmcp_hdr_len,
-                                                                                  authentication_code_buf,
-                                                                                  IPMI_MAX_PAYLOAD_LENGTH)) < 0)
+                                                                                  pkt + indx,
+                                                                                  pkt_len - indx)) < 0)
         {
           ERRNO_TRACE (errno);
-          goto cleanup;
-        }
-
-      if (authentication_code_len)
-        {
-          if (authentication_code_len > (pkt_len - indx))
-            {
-              SET_ERRNO (ENOSPC);
-              goto cleanup;
-            }
-          memcpy (pkt + indx, authentication_code_buf, authentication_code_len);
-          indx += authentication_code_len;
+          return (-1);
         }
+      indx += authentication_code_len;
     }
 
   if (indx > INT_MAX)
     {
       SET_ERRNO (EMSGSIZE);
-      goto cleanup;
+      return (-1);
     }
 
-  rv = indx;
- cleanup:
-  fiid_obj_destroy (obj_rmcpplus_payload);
-  fiid_obj_destroy (obj_session_hdr_temp);
-  fiid_obj_destroy (obj_rmcpplus_session_trlr_temp);
-  return (rv);
+  return (indx);
 }
 
 /* return 1 on full parse, 0 if not, -1 on error */
@@ -2508,18 +2442,10 @@ unassemble_ipmi_rmcpplus_pkt (uint8_t authentication_algorithm,
     {
       int pad_length_field_len, next_header_field_len;
       unsigned int authentication_code_len;
+      const uint8_t *trlr_data;
       uint8_t pad_length;
 
-      if (integrity_algorithm == IPMI_INTEGRITY_ALGORITHM_NONE)
-        authentication_code_len = 0;
-      else if (integrity_algorithm == IPMI_INTEGRITY_ALGORITHM_HMAC_SHA1_96)
-        authentication_code_len = IPMI_HMAC_SHA1_96_AUTHENTICATION_CODE_LENGTH;
-      else if (integrity_algorithm == IPMI_INTEGRITY_ALGORITHM_HMAC_MD5_128)
-        authentication_code_len = IPMI_HMAC_MD5_128_AUTHENTICATION_CODE_LENGTH;
-      else if (integrity_algorithm == IPMI_INTEGRITY_ALGORITHM_MD5_128)
-        authentication_code_len = IPMI_MD5_128_AUTHENTICATION_CODE_LENGTH;
-      else /* IPMI_INTEGRITY_ALGORITHM_HMAC_SHA256_128 */
-        authentication_code_len = IPMI_HMAC_SHA256_128_AUTHENTICATION_CODE_LENGTH;
+      authentication_code_len = _calculate_authentication_code_len (integrity_algorithm);
 
       if ((pad_length_field_len = fiid_template_field_len_bytes (tmpl_rmcpplus_session_trlr, "pad_length")) < 0)
         {
@@ -2561,24 +2487,20 @@ unassemble_ipmi_rmcpplus_pkt (uint8_t authentication_algorithm,
           return (-1);
         }
 
+      /* pad_length is a single byte, read it straight off the wire */
+      assert (pad_length_field_len == 1);
+      trlr_data = pkt + indx + ((pkt_len - indx) - authentication_code_len - next_header_field_len - pad_length_field_len);
+      pad_length = trlr_data[0];
+
       if (fiid_obj_set_data (obj_rmcpplus_session_trlr,
                              "pad_length",
-                             pkt + indx + ((pkt_len - indx) - authentication_code_len - next_header_field_len - pad_length_field_len),
+                             trlr_data,
                              pad_length_field_len) < 0)
         {
           FIID_OBJECT_ERROR_TO_ERRNO (obj_rmcpplus_session_trlr);
           return (-1);
         }
 
-      if (FIID_OBJ_GET (obj_rmcpplus_session_trlr,
-                        "pad_length",
-                        &val) < 0)
-        {
-          FIID_OBJECT_ERROR_TO_ERRNO (obj_rmcpplus_session_trlr);
-          return (-1);
-        }
-      pad_length = val;
-
       if (pad_length > IPMI_INTEGRITY_PAD_MULTIPLE)
         {
           /* cannot parse packet */
@@ -2628,6 +2550,268 @@ unassemble_ipmi_rmcpplus_pkt (uint8_t authentication_algorithm,
   return (0);
 }
 
+int
+unassemble_ipmi_rmcpplus_session_pkt (uint8_t integrity_algorithm,
+                                      uint8_t confidentiality_algorithm,
+                                      const void *integrity_key,
+                                      unsigned int integrity_key_len,
+                                      const void *authentication_code_data,
+                                      unsigned int authentication_code_data_len,
+                                      const void *confidentiality_key,
+                                      unsigned int confidentiality_key_len,
+                                      const void *pkt,
+                                      unsigned int pkt_len,
+                                      uint32_t *session_id,
+                                      uint32_t *session_sequence_number,
+                                      void *lan_msg_buf,
+                                      unsigned int lan_msg_buf_len,
+                                      const void **lan_msg)
+{
+  uint8_t authentication_code[IPMI_MAX_INTEGRITY_DATA_LENGTH];
+  const uint8_t *p = pkt;
+  uint8_t *payload_buf = lan_msg_buf;
+  int rmcp_hdr_len, payload_hdr_len, session_hdr_len, lan_msg_hdr_len, lan_msg_trlr_len, len;
+  unsigned int indx, authentication_code_len, lan_msg_len;
+  uint8_t payload_type, payload_authenticated, payload_encrypted, pad_length;
+  uint16_t ipmi_payload_len;
+
+  if (!IPMI_INTEGRITY_ALGORITHM_SUPPORTED (integrity_algorithm)
+      || !IPMI_CONFIDENTIALITY_ALGORITHM_SUPPORTED (confidentiality_algorithm)
+      || (integrity_algorithm == IPMI_INTEGRITY_ALGORITHM_MD5_128
+          && authentication_code_data
+          && authentication_code_data_len > IPMI_2_0_MAX_PASSWORD_LENGTH)
+      || (confidentiality_algorithm == IPMI_CONFIDENTIALITY_ALGORITHM_AES_CBC_128
+          && (!confidentiality_key
+              || confidentiality_key_len < IPMI_CRYPT_AES_CBC_128_KEY_LENGTH
+              || !lan_msg_buf
+              || !lan_msg_buf_len))
+      || !pkt
+      || !session_id
+      || !session_sequence_number
+      || !lan_msg)
+    {
+      SET_ERRNO (EINVAL);
+      return (-1);
+    }
+
+  if ((rmcp_hdr_len = fiid_template_len_bytes (tmpl_rmcp_hdr)) < 0)
+    {
+      ERRNO_TRACE (errno);
+      return (-1);
+    }
+
+  if ((payload_hdr_len = fiid_template_block_len_bytes (tmpl_rmcpplus_session_hdr,
+                                                        "authentication_type",
+                                                        "payload_type.encrypted")) < 0)
+    {
+      ERRNO_TRACE (errno);
+      return (-1);
+    }
+
+  if ((session_hdr_len = fiid_template_block_len_bytes (tmpl_rmcpplus_session_hdr,
+                                                        "session_id",
+                                                        "ipmi_payload_len")) < 0)
+    {
+      ERRNO_TRACE (errno);
+      return (-1);
+    }
+
+  if ((lan_msg_hdr_len = fiid_template_len_bytes (tmpl_lan_msg_hdr_rs)) < 0)
+    {
+      ERRNO_TRACE (errno);
+      return (-1);
+    }
+
+  if ((lan_msg_trlr_len = fiid_template_len_bytes (tmpl_lan_msg_trlr)) < 0)
+    {
+      ERRNO_TRACE (errno);
+      return (-1);
+    }
+
+  indx = rmcp_hdr_len + payload_hdr_len + session_hdr_len;
+
+  if (pkt_len <= indx)
+    {
+      /* cannot parse packet */
+      ERR_TRACE ("malformed packet", EINVAL);
+      return (0);
+    }
+
+  /* payload type is the low 6 bits of the byte after the
+   * authentication type, the authenticated and encrypted flags the
+   * high 2 bits.  Multi-byte fields are little endian.
+   */
+  payload_type = p[rmcp_hdr_len + 1] & 0x3F;
+  payload_authenticated = (p[rmcp_hdr_len + 1] >> 6) & 0x1;
+  payload_encrypted = (p[rmcp_hdr_len + 1] >> 7) & 0x1;
+
+  if (payload_type != IPMI_PAYLOAD_TYPE_IPMI)
+    return (0);
+
+  p += rmcp_hdr_len + payload_hdr_len;
+  *session_id = p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+  *session_sequence_number = p[4] | (p[5] << 8) | (p[6] << 16) | ((uint32_t)p[7] << 24);
+  ipmi_payload_len = p[8] | (p[9] << 8);
+  p = pkt;
+
+  if ((payload_authenticated == IPMI_PAYLOAD_FLAG_UNAUTHENTICATED
+       && integrity_algorithm != IPMI_INTEGRITY_ALGORITHM_NONE)
+      || (payload_authenticated == IPMI_PAYLOAD_FLAG_AUTHENTICATED
+          && integrity_algorithm == IPMI_INTEGRITY_ALGORITHM_NONE)
+      || (payload_encrypted == IPMI_PAYLOAD_FLAG_UNENCRYPTED
+          && confidentiality_algorithm != IPMI_CONFIDENTIALITY_ALGORITHM_NONE)
+      || (payload_encrypted == IPMI_PAYLOAD_FLAG_ENCRYPTED
+          && confidentiality_algorithm == IPMI_CONFIDENTIALITY_ALGORITHM_NONE)
+      || !ipmi_payload_len)
+    {
+      /* cannot parse packet */
+      ERR_TRACE ("malformed packet", EINVAL);
+      return (0);
+    }
+
+  if ((pkt_len - indx) < ipmi_payload_len)
+    {
+      ERR_TRACE ("shorten ipmi_payload_len", EINVAL);
+      ipmi_payload_len = pkt_len - indx;
+    }
+
+  if (payload_authenticated == IPMI_PAYLOAD_FLAG_AUTHENTICATED)
+    {
+      int pad_length_field_len, next_header_field_len;
+
+      authentication_code_len = _calculate_authentication_code_len (integrity_algorithm);
+
+      if ((pad_length_field_len = fiid_template_field_len_bytes (tmpl_rmcpplus_session_trlr, "pad_length")) < 0)
+        {
+          ERRNO_TRACE (errno);
+          return (-1);
+        }
+      if ((next_header_field_len = fiid_template_field_len_bytes (tmpl_rmcpplus_session_trlr, "next_header")) < 0)
+        {
+          ERRNO_TRACE (errno);
+          return (-1);
+        }
+
+      /* achu: There needs to be atleast the next_header and pad_length fields */
+      if ((pkt_len - indx - ipmi_payload_len) < (authentication_code_len + pad_length_field_len + next_header_field_len))
+        {
+          /* cannot parse packet */
+          ERR_TRACE ("malformed packet", EINVAL);
+          return (0);
+        }
+
+      /* pad_length is a single byte, read it straight off the wire */
+      assert (pad_length_field_len == 1);
+      pad_length = p[pkt_len - authentication_code_len - next_header_field_len - pad_length_field_len];
+
+      if (pad_length > IPMI_INTEGRITY_PAD_MULTIPLE)
+        {
+          /* cannot parse packet */
+          ERR_TRACE ("malformed packet", EINVAL);
+          return (0);
+        }
+
+      /* The authentication code covers everything after the RMCP
+       * header up to itself, check it where it lies on the wire.
+       */
+      if ((len = _calculate_session_trlr_authentication_code (integrity_algorithm,
+                                                              integrity_key,
+                                                              integrity_key_len,
+                                                              authentication_code_data,
+                                                              authentication_code_data_len,
+                                                              p + rmcp_hdr_len,
+                                                              pkt_len - rmcp_hdr_len - authentication_code_len,
+                                                              authentication_code,
+                                                              IPMI_MAX_INTEGRITY_DATA_LENGTH)) < 0)
+        {
+          ERRNO_TRACE (errno);
+          return (-1);
+        }
+
+      if (len != authentication_code_len
+          || memcmp (authentication_code,
+                     p + pkt_len - authentication_code_len,
+                     authentication_code_len))
+        return (0);
+    }
+
+  if (payload_encrypted == IPMI_PAYLOAD_FLAG_ENCRYPTED)
+    {
+      unsigned int payload_data_len;
+      int decrypt_len;
+
+      /* Note: Confidentiality Key for AES_CBS_128 is K2, the
+       * confidentiality header is the IV
+       */
+      if (ipmi_payload_len <= IPMI_CRYPT_AES_CBC_128_BLOCK_LENGTH)
+        {
+          /* cannot parse packet */
+          ERR_TRACE ("malformed packet", EINVAL);
+          return (0);
+        }
+
+      payload_data_len = ipmi_payload_len - IPMI_CRYPT_AES_CBC_128_BLOCK_LENGTH;
+
+      if (payload_data_len > lan_msg_buf_len)
+        {
+          /* cannot parse packet */
+          ERR_TRACE ("malformed packet", EINVAL);
+          return (0);
+        }
+
+      memcpy (payload_buf, p + indx + IPMI_CRYPT_AES_CBC_128_BLOCK_LENGTH, payload_data_len);
+
+      if ((decrypt_len = crypt_cipher_decrypt (IPMI_CRYPT_CIPHER_AES,
+                                               IPMI_CRYPT_CIPHER_MODE_CBC,
+                                               confidentiality_key,
+                                               IPMI_CRYPT_AES_CBC_128_KEY_LENGTH,
+                                               p + indx,
+                                               IPMI_CRYPT_AES_CBC_128_BLOCK_LENGTH,
+                                               payload_buf,
+                                               payload_data_len)) < 0)
+        {
+          ERRNO_TRACE (errno);
+          return (-1);
+        }
+
+      if (decrypt_len != payload_data_len)
+        {
+          SET_ERRNO (EINVAL);
+          return (-1);
+        }
+
+      /* achu: User is responsible for checking if padding is not corrupt  */
+      pad_length = payload_buf[payload_data_len - 1];
+      if (pad_length > IPMI_CRYPT_AES_CBC_128_BLOCK_LENGTH
+          || (pad_length + 1) >= payload_data_len)
+        {
+          /* cannot parse packet */
+          ERR_TRACE ("malformed packet", EINVAL);
+          return (0);
+        }
+
+      *lan_msg = payload_buf;
+      lan_msg_len = payload_data_len - pad_length - 1;
+    }
+  else
+    {
+      *lan_msg = p + indx;
+      lan_msg_len = ipmi_payload_len;
+    }
+
+  /* achu: Whatever is in between the header and the trailer is the
+   * command data, there must be some
+   */
+  if (lan_msg_len <= (lan_msg_hdr_len + lan_msg_trlr_len))
+    {
+      /* cannot parse packet */
+      ERR_TRACE ("malformed packet", EINVAL);
+      return (0);
+    }
+
+  return (lan_msg_len);
+}
+
 ssize_t
 ipmi_rmcpplus_sendto (int s,
                       const void *buf,
@@ -39,12 +39,50 @@ GCRY_THREAD_OPTION_PTHREAD_IMPL;
 #include "ipmi-trace.h"
 
 #include "freeipmi-portability.h"
+#include "hash.h"
+#include "secure.h"
 
 static int crypt_initialized = 0;
 
 #ifdef WITH_ENCRYPTION
 static pthread_mutex_t gcrypt_thread_initialized_mutex = PTHREAD_MUTEX_INITIALIZER;
 static int gcrypt_thread_initialized = 0;
+
+/* Keyed gcrypt handles are cached so that a key (e.g. the K1/K2 of
+ * an RMCP+ session) is only scheduled once, not on every packet.
+ * The cache is direct mapped on algorithm and key.  A handle is
+ * checked out of the cache for the duration of a single operation,
+ * so concurrent users of the same key simply fall back to a private
+ * handle.  Hash handles are only cached if the caller asks for it
+ * (IPMI_CRYPT_HASH_FLAGS_CACHE), so passwords are never held here.
+ * Session keys are wiped w/ crypt_handle_cache_flush().
+ */
+#define IPMI_CRYPT_HANDLE_CACHE_LEN        256
+#define IPMI_CRYPT_HANDLE_CACHE_KEY_LENGTH 64
+
+struct crypt_hash_handle
+{
+  gcry_md_hd_t h;
+  int gcry_md_algorithm;
+  int gcry_md_flags;
+  uint8_t key[IPMI_CRYPT_HANDLE_CACHE_KEY_LENGTH];
+  unsigned int key_len;
+  int in_use;
+};
+
+struct crypt_cipher_handle
+{
+  gcry_cipher_hd_t h;
+  int gcry_cipher_algorithm;
+  int gcry_cipher_mode;
+  uint8_t key[IPMI_CRYPT_HANDLE_CACHE_KEY_LENGTH];
+  unsigned int key_len;
+  int in_use;
+};
+
+static pthread_mutex_t crypt_handle_cache_mutex = PTHREAD_MUTEX_INITIALIZER;
+static struct crypt_hash_handle crypt_hash_handle_cache[IPMI_CRYPT_HANDLE_CACHE_LEN];
+static struct crypt_cipher_handle crypt_cipher_handle_cache[IPMI_CRYPT_HANDLE_CACHE_LEN];
 #endif /* !WITH_ENCRYPTION */
 
 #ifdef WITH_ENCRYPTION
@@ -59,6 +97,317 @@ _gpg_error_to_errno (gcry_error_t e)
 }
 #endif /* !WITH_ENCRYPTION */
 
+#ifdef WITH_ENCRYPTION
+/* FNV-1a over the algorithm, mode/flags and key */
+static unsigned int
+_crypt_handle_cache_index (int algorithm,
+                           int flags,
+                           const void *key,
+                           unsigned int key_len)
+{
+  uint8_t buf[2];
+  unsigned int hash;
+
+  buf[0] = algorithm;
+  buf[1] = flags;
+  hash = hash_key_bytes (buf, sizeof (buf), HASH_KEY_BYTES_INIT);
+  hash = hash_key_bytes (key, key_len, hash);
+
+  return (hash % IPMI_CRYPT_HANDLE_CACHE_LEN);
+}
+
+/* Returns a keyed and reset hash handle.  *cached is set if the
+ * handle was checked out of the cache.
+ */
+static int
+_crypt_hash_handle_get (int gcry_md_algorithm,
+                        int gcry_md_flags,
+                        const void *key,
+                        unsigned int key_len,
+                        struct crypt_hash_handle *c,
+                        gcry_md_hd_t *h,
+                        int *cached)
+{
+  gcry_error_t e;
+  int perr;
+
+  *h = NULL;
+  *cached = 0;
+
+  if (c && key_len <= IPMI_CRYPT_HANDLE_CACHE_KEY_LENGTH)
+    {
+      if ((perr = pthread_mutex_lock (&crypt_handle_cache_mutex)))
+        {
+          SET_ERRNO (perr);
+          return (-1);
+        }
+
+      if (c->h
+          && !c->in_use
+          && c->gcry_md_algorithm == gcry_md_algorithm
+          && c->gcry_md_flags == gcry_md_flags
+          && c->key_len == key_len
+          && (!key_len || !memcmp (c->key, key, key_len)))
+        {
+          c->in_use++;
+          *h = c->h;
+          *cached = 1;
+        }
+
+      if ((perr = pthread_mutex_unlock (&crypt_handle_cache_mutex)))
+        {
+          SET_ERRNO (perr);
+          return (-1);
+        }
+
+      if (*cached)
+        return (0);
+    }
+
+  if ((e = gcry_md_open (h, gcry_md_algorithm, gcry_md_flags)) != GPG_ERR_NO_ERROR)
+    {
+      ERR_GCRYPT_TRACE (e);
+      SET_ERRNO (_gpg_error_to_errno (e));
+      return (-1);
+    }
+
+  if (!*h)
+    {
+      SET_ERRNO (EINVAL);
+      return (-1);
+    }
+
+  /* achu: Technically any key length can be supplied.  We'll assume
+   * callers have checked if the key is of a length they care about.
+   */
+  /* SPEC: There is no indication that if a NULL password/key is used,
+   * that a zero padded password of some length should be the key.
+   */
+  if (key_len)
+    {
+      if ((e = gcry_md_setkey (*h, key, key_len)) != GPG_ERR_NO_ERROR)
+        {
+          ERR_GCRYPT_TRACE (e);
+          SET_ERRNO (_gpg_error_to_errno (e));
+          gcry_md_close (*h);
+          *h = NULL;
+          return (-1);
+        }
+    }
+
+  return (0);
+}
+
+/* Returns a handle to the cache, or closes it if it cannot be cached
+ * or an error left it in an unknown state.  A checked out handle that
+ * was flushed while in use is closed here.
+ */
+static void
+_crypt_hash_handle_put (int gcry_md_algorithm,
+                        int gcry_md_flags,
+                        const void *key,
+                        unsigned int key_len,
+                        struct crypt_hash_handle *c,
+                        gcry_md_hd_t h,
+                        int cached,
+                        int error)
+{
+  gcry_md_hd_t old = NULL;
+
+  if (!h)
+    return;
+
+  if (!c)
+    {
+      gcry_md_close (h);
+      return;
+    }
+
+  /* the HMAC key survives a reset */
+  if (!error)
+    gcry_md_reset (h);
+
+  if (pthread_mutex_lock (&crypt_handle_cache_mutex))
+    {
+      if (!cached)
+        gcry_md_close (h);
+      return;
+    }
+
+  if (cached)
+    {
+      if (c->h != h)
+        old = h;
+      else
+        {
+          if (error)
+            {
+              c->h = NULL;
+              secure_memset (c->key, '\0', IPMI_CRYPT_HANDLE_CACHE_KEY_LENGTH);
+              c->key_len = 0;
+              old = h;
+            }
+          c->in_use = 0;
+        }
+    }
+  else if (!error
+           && key_len <= IPMI_CRYPT_HANDLE_CACHE_KEY_LENGTH
+           && !c->in_use)
+    {
+      old = c->h;
+      c->h = h;
+      c->gcry_md_algorithm = gcry_md_algorithm;
+      c->gcry_md_flags = gcry_md_flags;
+      secure_memset (c->key, '\0', IPMI_CRYPT_HANDLE_CACHE_KEY_LENGTH);
+      if (key_len)
+        memcpy (c->key, key, key_len);
+      c->key_len = key_len;
+    }
+  else
+    old = h;
+
+  pthread_mutex_unlock (&crypt_handle_cache_mutex);
+
+  if (old)
+    gcry_md_close (old);
+}
+
+/* Returns a keyed cipher handle.  *cached is set if the handle was
+ * checked out of the cache.  The caller must set the IV.
+ */
+static int
+_crypt_cipher_handle_get (int gcry_cipher_algorithm,
+                          int gcry_cipher_mode,
+                          const void *key,
+                          unsigned int key_len,
+                          struct crypt_cipher_handle *c,
+                          gcry_cipher_hd_t *h,
+                          int *cached)
+{
+  gcry_error_t e;
+  int perr;
+
+  *h = NULL;
+  *cached = 0;
+
+  if (key_len <= IPMI_CRYPT_HANDLE_CACHE_KEY_LENGTH)
+    {
+      if ((perr = pthread_mutex_lock (&crypt_handle_cache_mutex)))
+        {
+          SET_ERRNO (perr);
+          return (-1);
+        }
+
+      if (c->h
+          && !c->in_use
+          && c->gcry_cipher_algorithm == gcry_cipher_algorithm
+          && c->gcry_cipher_mode == gcry_cipher_mode
+          && c->key_len == key_len
+          && (!key_len || !memcmp (c->key, key, key_len)))
+        {
+          c->in_use++;
+          *h = c->h;
+          *cached = 1;
+        }
+
+      if ((perr = pthread_mutex_unlock (&crypt_handle_cache_mutex)))
+        {
+          SET_ERRNO (perr);
+          return (-1);
+        }
+
+      if (*cached)
+        return (0);
+    }
+
+  if ((e = gcry_cipher_open (h,
+                             gcry_cipher_algorithm,
+                             gcry_cipher_mode,
+                             0)) != GPG_ERR_NO_ERROR)
+    {
+      ERR_GCRYPT_TRACE (e);
+      SET_ERRNO (_gpg_error_to_errno (e));
+      return (-1);
+    }
+
+  if (key_len)
+    {
+      if ((e = gcry_cipher_setkey (*h,
+                                   (void *)key,
+                                   key_len)) != GPG_ERR_NO_ERROR)
+        {
+          ERR_GCRYPT_TRACE (e);
+          SET_ERRNO (_gpg_error_to_errno (e));
+          gcry_cipher_close (*h);
+          *h = NULL;
+          return (-1);
+        }
+    }
+
+  return (0);
+}
+
+static void
+_crypt_cipher_handle_put (int gcry_cipher_algorithm,
+                          int gcry_cipher_mode,
+                          const void *key,
+                          unsigned int key_len,
+                          struct crypt_cipher_handle *c,
+                          gcry_cipher_hd_t h,
+                          int cached,
+                          int error)
+{
+  gcry_cipher_hd_t old = NULL;
+
+  if (!h)
+    return;
+
+  if (pthread_mutex_lock (&crypt_handle_cache_mutex))
+    {
+      if (!cached)
+        gcry_cipher_close (h);
+      return;
+    }
+
+  if (cached)
+    {
+      if (c->h != h)
+        old = h;
+      else
+        {
+          if (error)
+            {
+              c->h = NULL;
+              secure_memset (c->key, '\0', IPMI_CRYPT_HANDLE_CACHE_KEY_LENGTH);
+              c->key_len = 0;
+              old = h;
+            }
+          c->in_use = 0;
+        }
+    }
+  else if (!error
+           && key_len <= IPMI_CRYPT_HANDLE_CACHE_KEY_LENGTH
+           && !c->in_use)
+    {
+      old = c->h;
+      c->h = h;
+      c->gcry_cipher_algorithm = gcry_cipher_algorithm;
+      c->gcry_cipher_mode = gcry_cipher_mode;
+      secure_memset (c->key, '\0', IPMI_CRYPT_HANDLE_CACHE_KEY_LENGTH);
+      if (key_len)
+        memcpy (c->key, key, key_len);
+      c->key_len = key_len;
+    }
+  else
+    old = h;
+
+  pthread_mutex_unlock (&crypt_handle_cache_mutex);
+
+  if (old)
+    gcry_cipher_close (old);
+}
+#endif /* !WITH_ENCRYPTION */
+
 int
 crypt_init (void)
 {
@@ -144,9 +493,12 @@ crypt_hash (unsigned int hash_algorithm,
 {
 #ifdef WITH_ENCRYPTION
   gcry_md_hd_t h = NULL;
-  gcry_error_t e;
   int gcry_md_algorithm, gcry_md_flags = 0;
   unsigned int gcry_md_digest_len;
+  const void *hash_key = NULL;
+  unsigned int hash_key_len = 0;
+  struct crypt_hash_handle *c = NULL;
+  int cached = 0;
   void *digestPtr;
   int rv = -1;
 
@@ -181,33 +533,28 @@ crypt_hash (unsigned int hash_algorithm,
       return (-1);
     }
 
-  if ((e = gcry_md_open (&h, gcry_md_algorithm, gcry_md_flags)) != GPG_ERR_NO_ERROR)
+  if ((hash_flags & IPMI_CRYPT_HASH_FLAGS_HMAC) && key && key_len)
     {
-      ERR_GCRYPT_TRACE (e);
-      SET_ERRNO (_gpg_error_to_errno (e));
-      return (-1);
+      hash_key = key;
+      hash_key_len = key_len;
     }
 
-  if (!h)
-    {
-      SET_ERRNO (EINVAL);
-      return (-1);
-    }
+  if ((hash_flags & IPMI_CRYPT_HASH_FLAGS_CACHE) && hash_key)
+    c = &crypt_hash_handle_cache[_crypt_handle_cache_index (gcry_md_algorithm,
+                                                            gcry_md_flags,
+                                                            hash_key,
+                                                            hash_key_len)];
 
-  /* achu: Technically any key length can be supplied.  We'll assume
-   * callers have checked if the key is of a length they care about.
-   */
-  /* SPEC: There is no indication that if a NULL password/key is used,
-   * that a zero padded password of some length should be the key.
-   */
-  if ((hash_flags & IPMI_CRYPT_HASH_FLAGS_HMAC) && key && key_len)
+  if (_crypt_hash_handle_get (gcry_md_algorithm,
+                              gcry_md_flags,
+                              hash_key,
+                              hash_key_len,
+                              c,
+                              &h,
+                              &cached) < 0)
     {
-      if ((e = gcry_md_setkey (h, key, key_len)) != GPG_ERR_NO_ERROR)
-        {
-          ERR_GCRYPT_TRACE (e);
-          SET_ERRNO (_gpg_error_to_errno (e));
-          goto cleanup;
-        }
+      ERRNO_TRACE (errno);
+      return (-1);
     }
 
   if (hash_data && hash_data_len)
@@ -230,8 +577,14 @@ crypt_hash (unsigned int hash_algorithm,
   memcpy (digest, digestPtr, gcry_md_digest_len);
   rv = gcry_md_digest_len;
  cleanup:
-  if (h)
-    gcry_md_close (h);
+  _crypt_hash_handle_put (gcry_md_algorithm,
+                          gcry_md_flags,
+                          hash_key,
+                          hash_key_len,
+                          c,
+                          h,
+                          cached,
+                          rv < 0);
   return (rv);
 #else /* !WITH_ENCRYPTION */
   SET_ERRNO (EPERM);
@@ -288,6 +641,8 @@ _cipher_crypt (unsigned int cipher_algorithm,
   int expected_cipher_key_len, expected_cipher_block_len;
   gcry_cipher_hd_t h = NULL;
   gcry_error_t e;
+  struct crypt_cipher_handle *c;
+  int cached = 0;
   int rv = -1;
 
   if (cipher_algorithm != IPMI_CRYPT_CIPHER_AES
@@ -353,26 +708,24 @@ _cipher_crypt (unsigned int cipher_algorithm,
       return (-1);
     }
 
-  if ((e = gcry_cipher_open (&h,
-                             gcry_cipher_algorithm,
-                             gcry_cipher_mode,
-                             0) != GPG_ERR_NO_ERROR))
-    {
-      ERR_GCRYPT_TRACE (e);
-      SET_ERRNO (_gpg_error_to_errno (e));
-      return (-1);
-    }
+  if (!key)
+    key_len = 0;
 
-  if (key && key_len)
+  c = &crypt_cipher_handle_cache[_crypt_handle_cache_index (gcry_cipher_algorithm,
+                                                            gcry_cipher_mode,
+                                                            key,
+                                                            key_len)];
+
+  if (_crypt_cipher_handle_get (gcry_cipher_algorithm,
+                                gcry_cipher_mode,
+                                key,
+                                key_len,
+                                c,
+                                &h,
+                                &cached) < 0)
     {
-      if ((e = gcry_cipher_setkey (h,
-                                   (void *)key,
-                                   key_len)) != GPG_ERR_NO_ERROR)
-        {
-          ERR_GCRYPT_TRACE (e);
-          SET_ERRNO (_gpg_error_to_errno (e));
-          goto cleanup;
-        }
+      ERRNO_TRACE (errno);
+      return (-1);
     }
 
   if (iv && iv_len)
@@ -420,8 +773,14 @@ _cipher_crypt (unsigned int cipher_algorithm,
 
   rv = data_len;
  cleanup:
-  if (h)
-    gcry_cipher_close (h);
+  _crypt_cipher_handle_put (gcry_cipher_algorithm,
+                            gcry_cipher_mode,
+                            key,
+                            key_len,
+                            c,
+                            h,
+                            cached,
+                            rv < 0);
   return (rv);
 }
 #endif /* !WITH_ENCRYPTION */
@@ -547,3 +906,74 @@ crypt_cipher_block_len (unsigned int cipher_algorithm)
   return (-1);
 #endif /* !WITH_ENCRYPTION */
 }
+
+#ifdef WITH_ENCRYPTION
+static int
+_crypt_handle_cache_key_match (const uint8_t *cache_key,
+                               unsigned int cache_key_len,
+                               const void *key,
+                               unsigned int key_len)
+{
+  if (!key)
+    return (1);
+
+  return (cache_key_len
+          && cache_key_len <= key_len
+          && !memcmp (cache_key, key, cache_key_len));
+}
+#endif /* !WITH_ENCRYPTION */
+
+void
+crypt_handle_cache_flush (const void *key, unsigned int key_len)
+{
+#ifdef WITH_ENCRYPTION
+  gcry_md_hd_t md_close[IPMI_CRYPT_HANDLE_CACHE_LEN];
+  gcry_cipher_hd_t cipher_close[IPMI_CRYPT_HANDLE_CACHE_LEN];
+  unsigned int md_close_len = 0;
+  unsigned int cipher_close_len = 0;
+  unsigned int i;
+
+  if (key && !key_len)
+    return;
+
+  if (pthread_mutex_lock (&crypt_handle_cache_mutex))
+    return;
+
+  /* handles checked out are closed by their user on return */
+  for (i = 0; i < IPMI_CRYPT_HANDLE_CACHE_LEN; i++)
+    {
+      struct crypt_hash_handle *hc = &crypt_hash_handle_cache[i];
+      struct crypt_cipher_handle *cc = &crypt_cipher_handle_cache[i];
+
+      if (hc->h
+          && _crypt_handle_cache_key_match (hc->key, hc->key_len, key, key_len))
+        {
+          if (!hc->in_use)
+            md_close[md_close_len++] = hc->h;
+          hc->h = NULL;
+          hc->in_use = 0;
+          secure_memset (hc->key, '\0', IPMI_CRYPT_HANDLE_CACHE_KEY_LENGTH);
+          hc->key_len = 0;
+        }
+
+      if (cc->h
+          && _crypt_handle_cache_key_match (cc->key, cc->key_len, key, key_len))
+        {
+          if (!cc->in_use)
+            cipher_close[cipher_close_len++] = cc->h;
+          cc->h = NULL;
+          cc->in_use = 0;
+          secure_memset (cc->key, '\0', IPMI_CRYPT_HANDLE_CACHE_KEY_LENGTH);
+          cc->key_len = 0;
+        }
+    }
+
+  pthread_mutex_unlock (&crypt_handle_cache_mutex);
+
+  /* gcrypt wipes the key schedule on close */
+  for (i = 0; i < md_close_len; i++)
+    gcry_md_close (md_close[i]);
+  for (i = 0; i < cipher_close_len; i++)
+    gcry_cipher_close (cipher_close[i]);
+#endif /* !WITH_ENCRYPTION */
+}
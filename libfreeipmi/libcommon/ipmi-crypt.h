@@ -31,6 +31,11 @@
     || (__hash_algorithm) == IPMI_CRYPT_HASH_SHA256) ? 1 : 0)
 
 #define IPMI_CRYPT_HASH_FLAGS_HMAC       0x01
+/* The keyed HMAC handle may be cached across calls.  Only for
+ * session keys used on every packet (i.e. K1), never for passwords,
+ * Kuid, or Kg.
+ */
+#define IPMI_CRYPT_HASH_FLAGS_CACHE      0x02
 
 #define IPMI_CRYPT_CIPHER_AES            0x00
 
@@ -101,4 +106,13 @@ int crypt_cipher_key_len (unsigned int cipher_algorithm);
 
 int crypt_cipher_block_len (unsigned int cipher_algorithm);
 
+/* crypt_handle_cache_flush
+ *
+ * Wipe and close cached handles keyed with key (or a prefix of it,
+ * as cipher keys may be truncated).  If key is NULL, all cached
+ * handles are flushed.  Should be called when a session's keys are
+ * no longer needed.
+ */
+void crypt_handle_cache_flush (const void *key, unsigned int key_len);
+
 #endif /* IPMI_CRYPT_H */
@@ -41,16 +41,20 @@
 #if HAVE_UNISTD_H
 #include <unistd.h>
 #endif /* HAVE_UNISTD_H */
+#include <sys/poll.h>
 #include <assert.h>
 #include <errno.h>
 
 #include "freeipmi/sdr/ipmi-sdr.h"
+#include "freeipmi/api/ipmi-api.h"
 #include "freeipmi/api/ipmi-sdr-repository-cmds-api.h"
 #include "freeipmi/cmds/ipmi-sdr-repository-cmds.h"
 #include "freeipmi/fiid/fiid.h"
 #include "freeipmi/debug/ipmi-debug.h"
 #include "freeipmi/record-format/ipmi-sdr-record-format.h"
 #include "freeipmi/spec/ipmi-comp-code-spec.h"
+#include "freeipmi/spec/ipmi-ipmb-lun-spec.h"
+#include "freeipmi/spec/ipmi-netfn-spec.h"
 #include "freeipmi/util/ipmi-util.h"
 
 #include "ipmi-sdr-common.h"
@@ -73,6 +77,88 @@
 #define IPMI_SDR_CACHE_BYTES_TO_READ_START      16
 #define IPMI_SDR_CACHE_BYTES_TO_READ_DECREMENT  4
 
+/* Pipelined download, see _sdr_cache_pipeline_get_records() */
+#define IPMI_SDR_CACHE_PIPELINE_WINDOW_DEFAULT       4
+#define IPMI_SDR_CACHE_PIPELINE_RECORDS              8
+#define IPMI_SDR_CACHE_PIPELINE_BYTES_TO_READ_START  32
+
+#define SDR_CACHE_PIPELINE_RECORD_UNUSED 0
+#define SDR_CACHE_PIPELINE_RECORD_HEADER 1
+#define SDR_CACHE_PIPELINE_RECORD_BODY   2
+#define SDR_CACHE_PIPELINE_RECORD_DONE   3
+
+#define SDR_CACHE_PIPELINE_RQ_FREE    0
+#define SDR_CACHE_PIPELINE_RQ_PENDING 1
+#define SDR_CACHE_PIPELINE_RQ_DONE    2
+
+/* where and how records read from the SDR are written */
+struct sdr_cache_record_store
+{
+  int fd;
+  unsigned int total_bytes_written;
+  uint16_t *record_ids;
+  unsigned int record_ids_count;
+  struct ipmi_sdr_cache_descriptor *descriptors;
+  unsigned int record_count_written;
+  uint8_t trailer_checksum;
+  Ipmi_Sdr_Cache_Create_Callback create_callback;
+  void *create_callback_data;
+};
+
+struct sdr_cache_pipeline_record
+{
+  int state;
+  uint16_t record_id;
+  uint16_t next_record_id;
+  uint8_t record_buf[IPMI_SDR_MAX_RECORD_LENGTH];
+  unsigned int record_length;
+  unsigned int bytes_received;
+  /* bytes read or being read */
+  uint8_t requested[IPMI_SDR_MAX_RECORD_LENGTH];
+  unsigned int rq_count;
+  int dropped;
+};
+
+struct sdr_cache_pipeline;
+
+struct sdr_cache_pipeline_rq
+{
+  struct sdr_cache_pipeline *pipeline;
+  int state;
+  unsigned int slot;
+  unsigned int offset_into_record;
+  unsigned int bytes_to_read;
+  fiid_obj_t obj_cmd_rq;
+  fiid_obj_t obj_cmd_rs;
+  int rv;
+  int errnum;
+};
+
+struct sdr_cache_pipeline
+{
+  ipmi_sdr_ctx_t ctx;
+  ipmi_ctx_t ipmi_ctx;
+  int cache_create_flags;
+  struct sdr_cache_record_store *store;
+  uint16_t reservation_id;
+  unsigned int reservation_id_retry_count;
+  int restart;
+
+  /* records in SDR order, oldest at records_head */
+  struct sdr_cache_pipeline_record records[IPMI_SDR_CACHE_PIPELINE_RECORDS];
+  unsigned int records_head;
+  unsigned int records_count;
+  unsigned int records_started;
+  unsigned int records_dropped;
+  uint16_t next_record_id;
+  int next_record_id_ready;
+
+  struct sdr_cache_pipeline_rq rqs[IPMI_ASYNC_WINDOW_MAX];
+  unsigned int window;
+  unsigned int rq_count;
+  unsigned int submitted;
+};
+
 static int
 _sdr_cache_header_write (ipmi_sdr_ctx_t ctx,
                          ipmi_ctx_t ipmi_ctx,
@@ -119,10 +205,10 @@ _sdr_cache_header_write (ipmi_sdr_ctx_t ctx,
   memcpy(&header_checksum_buf[header_checksum_buf_len], sdr_cache_magic_buf, 4);
   header_checksum_buf_len += 4;
 
-  sdr_cache_version_buf[0] = IPMI_SDR_CACHE_FILE_VERSION_1_2_0;
-  sdr_cache_version_buf[1] = IPMI_SDR_CACHE_FILE_VERSION_1_2_1;
-  sdr_cache_version_buf[2] = IPMI_SDR_CACHE_FILE_VERSION_1_2_2;
-  sdr_cache_version_buf[3] = IPMI_SDR_CACHE_FILE_VERSION_1_2_3;
+  sdr_cache_version_buf[0] = IPMI_SDR_CACHE_FILE_VERSION_2_0_0;
+  sdr_cache_version_buf[1] = IPMI_SDR_CACHE_FILE_VERSION_2_0_1;
+  sdr_cache_version_buf[2] = IPMI_SDR_CACHE_FILE_VERSION_2_0_2;
+  sdr_cache_version_buf[3] = IPMI_SDR_CACHE_FILE_VERSION_2_0_3;
 
   if ((n = fd_write_n (fd, sdr_cache_version_buf, 4)) < 0)
     {
@@ -237,9 +323,15 @@ _sdr_cache_trailer_write (ipmi_sdr_ctx_t ctx,
                           ipmi_ctx_t ipmi_ctx,
                           int fd,
                           unsigned int total_bytes_written,
+                          unsigned int records_end_offset,
+                          unsigned int descriptors_offset,
+                          uint16_t descriptors_count,
                           uint8_t trailer_checksum)
 {
+  uint8_t descriptors_buf[16];
   char total_bytes_written_buf[4];
+  uint32_t descriptor_byte_order = IPMI_SDR_CACHE_DESCRIPTOR_BYTE_ORDER;
+  uint16_t descriptor_len = sizeof (struct ipmi_sdr_cache_descriptor);
   ssize_t n;
 
   assert (ctx);
@@ -247,6 +339,35 @@ _sdr_cache_trailer_write (ipmi_sdr_ctx_t ctx,
   assert (ipmi_ctx);
   assert (fd);
 
+  descriptors_buf[0] = (records_end_offset & 0x000000FF);
+  descriptors_buf[1] = (records_end_offset & 0x0000FF00) >> 8;
+  descriptors_buf[2] = (records_end_offset & 0x00FF0000) >> 16;
+  descriptors_buf[3] = (records_end_offset & 0xFF000000) >> 24;
+  descriptors_buf[4] = (descriptors_offset & 0x000000FF);
+  descriptors_buf[5] = (descriptors_offset & 0x0000FF00) >> 8;
+  descriptors_buf[6] = (descriptors_offset & 0x00FF0000) >> 16;
+  descriptors_buf[7] = (descriptors_offset & 0xFF000000) >> 24;
+  descriptors_buf[8] = (descriptors_count & 0x00FF);
+  descriptors_buf[9] = (descriptors_count & 0xFF00) >> 8;
+  descriptors_buf[10] = (descriptor_len & 0x00FF);
+  descriptors_buf[11] = (descriptor_len & 0xFF00) >> 8;
+  /* byte order marker is stored in host order */
+  memcpy (&descriptors_buf[12], &descriptor_byte_order, 4);
+
+  if ((n = fd_write_n (fd, descriptors_buf, 16)) < 0)
+    {
+      SDR_ERRNO_TO_SDR_ERRNUM (ctx, errno);
+      return (-1);
+    }
+  if (n != 16)
+    {
+      SDR_SET_ERRNUM (ctx, IPMI_SDR_ERR_SYSTEM_ERROR);
+      return (-1);
+    }
+  total_bytes_written += 16;
+
+  trailer_checksum = ipmi_checksum_incremental (descriptors_buf, 16, trailer_checksum);
+
   /* + 4 for this value, + 1 for checksum at end */
   total_bytes_written += 4;
   total_bytes_written += 1;
@@ -283,6 +404,201 @@ _sdr_cache_trailer_write (ipmi_sdr_ctx_t ctx,
   return (0);
 }
 
+/* The descriptor holds whatever the parse functions return for the
+ * record, fields that fail to parse have no flag set and are parsed
+ * from the raw record by readers.
+ */
+static void
+_sdr_cache_descriptor_fill (ipmi_sdr_ctx_t ctx,
+                            struct ipmi_sdr_cache_descriptor *descriptor,
+                            const uint8_t *buf,
+                            unsigned int buflen)
+{
+  int len;
+
+  assert (ctx);
+  assert (ctx->magic == IPMI_SDR_CTX_MAGIC);
+  assert (descriptor);
+  assert (buf);
+  assert (buflen >= IPMI_SDR_RECORD_HEADER_LENGTH);
+
+  memset (descriptor, '\0', sizeof (struct ipmi_sdr_cache_descriptor));
+
+  /* parse exactly what readers see in the cache, see the record
+   * length workaround in _sdr_cache_record_write()
+   */
+  if ((((uint8_t)buf[IPMI_SDR_RECORD_LENGTH_INDEX]) + IPMI_SDR_RECORD_HEADER_LENGTH) < buflen)
+    buflen = ((uint8_t)buf[IPMI_SDR_RECORD_LENGTH_INDEX]) + IPMI_SDR_RECORD_HEADER_LENGTH;
+
+  /* Record ID stored little endian */
+  descriptor->record_id = ((uint16_t)buf[IPMI_SDR_RECORD_ID_INDEX_LS] & 0xFF);
+  descriptor->record_id |= ((uint16_t)buf[IPMI_SDR_RECORD_ID_INDEX_MS] & 0xFF) << 8;
+  descriptor->record_type = buf[IPMI_SDR_RECORD_TYPE_INDEX];
+
+  if (!ipmi_sdr_parse_sensor_owner_id (ctx,
+                                       buf,
+                                       buflen,
+                                       &descriptor->sensor_owner_id_type,
+                                       &descriptor->sensor_owner_id))
+    descriptor->flags |= IPMI_SDR_CACHE_DESCRIPTOR_SENSOR_OWNER_ID;
+
+  if (!ipmi_sdr_parse_sensor_owner_lun (ctx,
+                                        buf,
+                                        buflen,
+                                        &descriptor->sensor_owner_lun,
+                                        &descriptor->channel_number))
+    descriptor->flags |= IPMI_SDR_CACHE_DESCRIPTOR_SENSOR_OWNER_LUN;
+
+  if (!ipmi_sdr_parse_sensor_number (ctx,
+                                     buf,
+                                     buflen,
+                                     &descriptor->sensor_number))
+    descriptor->flags |= IPMI_SDR_CACHE_DESCRIPTOR_SENSOR_NUMBER;
+
+  if (!ipmi_sdr_parse_entity_id_instance_type (ctx,
+                                               buf,
+                                               buflen,
+                                               &descriptor->entity_id,
+                                               &descriptor->entity_instance,
+                                               &descriptor->entity_instance_type))
+    descriptor->flags |= IPMI_SDR_CACHE_DESCRIPTOR_ENTITY_ID_INSTANCE_TYPE;
+
+  if (!ipmi_sdr_parse_sensor_type (ctx,
+                                   buf,
+                                   buflen,
+                                   &descriptor->sensor_type))
+    descriptor->flags |= IPMI_SDR_CACHE_DESCRIPTOR_SENSOR_TYPE;
+
+  if (!ipmi_sdr_parse_event_reading_type_code (ctx,
+                                               buf,
+                                               buflen,
+                                               &descriptor->event_reading_type_code))
+    descriptor->flags |= IPMI_SDR_CACHE_DESCRIPTOR_EVENT_READING_TYPE_CODE;
+
+  if ((len = ipmi_sdr_parse_id_string (ctx,
+                                       buf,
+                                       buflen,
+                                       descriptor->id_string,
+                                       IPMI_SDR_MAX_ID_STRING_LENGTH)) >= 0)
+    {
+      descriptor->id_string_len = len;
+      descriptor->flags |= IPMI_SDR_CACHE_DESCRIPTOR_ID_STRING;
+    }
+
+  if (!ipmi_sdr_parse_sensor_units (ctx,
+                                    buf,
+                                    buflen,
+                                    &descriptor->sensor_units_percentage,
+                                    &descriptor->sensor_units_modifier,
+                                    &descriptor->sensor_units_rate,
+                                    &descriptor->sensor_base_unit_type,
+                                    &descriptor->sensor_modifier_unit_type))
+    descriptor->flags |= IPMI_SDR_CACHE_DESCRIPTOR_SENSOR_UNITS;
+
+  if (!ipmi_sdr_parse_sensor_decoding_data (ctx,
+                                            buf,
+                                            buflen,
+                                            &descriptor->r_exponent,
+                                            &descriptor->b_exponent,
+                                            &descriptor->m,
+                                            &descriptor->b,
+                                            &descriptor->linearization,
+                                            &descriptor->analog_data_format))
+    descriptor->flags |= IPMI_SDR_CACHE_DESCRIPTOR_SENSOR_DECODING_DATA;
+
+  if (!ipmi_sdr_parse_thresholds_raw (ctx,
+                                      buf,
+                                      buflen,
+                                      &descriptor->lower_non_critical_threshold,
+                                      &descriptor->lower_critical_threshold,
+                                      &descriptor->lower_non_recoverable_threshold,
+                                      &descriptor->upper_non_critical_threshold,
+                                      &descriptor->upper_critical_threshold,
+                                      &descriptor->upper_non_recoverable_threshold))
+    descriptor->flags |= IPMI_SDR_CACHE_DESCRIPTOR_THRESHOLDS_RAW;
+
+  if (!ipmi_sdr_parse_hysteresis (ctx,
+                                  buf,
+                                  buflen,
+                                  &descriptor->positive_going_threshold_hysteresis,
+                                  &descriptor->negative_going_threshold_hysteresis))
+    descriptor->flags |= IPMI_SDR_CACHE_DESCRIPTOR_HYSTERESIS;
+
+  if (!ipmi_sdr_parse_sensor_record_sharing (ctx,
+                                             buf,
+                                             buflen,
+                                             &descriptor->share_count,
+                                             &descriptor->id_string_instance_modifier_type,
+                                             &descriptor->id_string_instance_modifier_offset,
+                                             &descriptor->entity_instance_sharing))
+    descriptor->flags |= IPMI_SDR_CACHE_DESCRIPTOR_SENSOR_RECORD_SHARING;
+}
+
+static int
+_sdr_cache_descriptors_write (ipmi_sdr_ctx_t ctx,
+                              int fd,
+                              unsigned int *total_bytes_written,
+                              struct ipmi_sdr_cache_descriptor *descriptors,
+                              unsigned int descriptors_count,
+                              unsigned int *descriptors_offset,
+                              uint8_t *trailer_checksum)
+{
+  uint8_t pad_buf[IPMI_SDR_CACHE_DESCRIPTOR_ALIGNMENT];
+  unsigned int pad_len;
+  unsigned int descriptors_len;
+  ssize_t n;
+
+  assert (ctx);
+  assert (ctx->magic == IPMI_SDR_CTX_MAGIC);
+  assert (fd);
+  assert (total_bytes_written);
+  assert (descriptors);
+  assert (descriptors_offset);
+  assert (trailer_checksum);
+
+  pad_len = (IPMI_SDR_CACHE_DESCRIPTOR_ALIGNMENT
+             - ((*total_bytes_written) % IPMI_SDR_CACHE_DESCRIPTOR_ALIGNMENT)) % IPMI_SDR_CACHE_DESCRIPTOR_ALIGNMENT;
+
+  if (pad_len)
+    {
+      memset (pad_buf, '\0', IPMI_SDR_CACHE_DESCRIPTOR_ALIGNMENT);
+
+      if ((n = fd_write_n (fd, pad_buf, pad_len)) < 0)
+        {
+          SDR_ERRNO_TO_SDR_ERRNUM (ctx, errno);
+          return (-1);
+        }
+      if (n != pad_len)
+        {
+          SDR_SET_ERRNUM (ctx, IPMI_SDR_ERR_SYSTEM_ERROR);
+          return (-1);
+        }
+      (*total_bytes_written) += pad_len;
+
+      (*trailer_checksum) = ipmi_checksum_incremental (pad_buf, pad_len, (*trailer_checksum));
+    }
+
+  (*descriptors_offset) = (*total_bytes_written);
+
+  descriptors_len = descriptors_count * sizeof (struct ipmi_sdr_cache_descriptor);
+
+  if ((n = fd_write_n (fd, descriptors, descriptors_len)) < 0)
+    {
+      SDR_ERRNO_TO_SDR_ERRNUM (ctx, errno);
+      return (-1);
+    }
+  if (n != descriptors_len)
+    {
+      SDR_SET_ERRNUM (ctx, IPMI_SDR_ERR_SYSTEM_ERROR);
+      return (-1);
+    }
+  (*total_bytes_written) += descriptors_len;
+
+  (*trailer_checksum) = ipmi_checksum_incremental ((uint8_t *)descriptors, descriptors_len, (*trailer_checksum));
+
+  return (0);
+}
+
 static int
 _sdr_cache_reservation_id (ipmi_sdr_ctx_t ctx,
                            ipmi_ctx_t ipmi_ctx,
@@ -771,6 +1087,858 @@ _sdr_cache_record_write (ipmi_sdr_ctx_t ctx,
 
 }
 
+/* debug dump, write, and describe a record read from the SDR */
+static int
+_sdr_cache_record_store (ipmi_sdr_ctx_t ctx,
+                         struct sdr_cache_record_store *store,
+                         uint16_t record_id,
+                         uint8_t *record_buf,
+                         unsigned int record_len)
+{
+  assert (ctx);
+  assert (ctx->magic == IPMI_SDR_CTX_MAGIC);
+  assert (store);
+  assert (store->descriptors);
+  assert (store->record_count_written < ctx->record_count);
+  assert (record_buf);
+  assert (record_len);
+
+  if (ctx->flags & IPMI_SDR_FLAGS_DEBUG_DUMP)
+    {
+      const char *record_str;
+
+      if ((record_str = sdr_record_type_str (ctx,
+                                             record_buf,
+                                             record_len)))
+        {
+          char hdrbuf[IPMI_SDR_CACHE_DEBUG_BUFLEN + 1];
+
+          memset (hdrbuf, '\0', IPMI_SDR_CACHE_DEBUG_BUFLEN + 1);
+
+          debug_hdr_str (DEBUG_UTIL_TYPE_NONE,
+                         DEBUG_UTIL_DIRECTION_NONE,
+                         DEBUG_UTIL_FLAGS_DEFAULT,
+                         record_str,
+                         hdrbuf,
+                         IPMI_SDR_CACHE_DEBUG_BUFLEN);
+
+          ipmi_dump_sdr_record (STDERR_FILENO,
+                                ctx->debug_prefix,
+                                hdrbuf,
+                                NULL,
+                                record_buf,
+                                record_len);
+        }
+    }
+
+  if (_sdr_cache_record_write (ctx,
+                               store->fd,
+                               &store->total_bytes_written,
+                               store->record_ids,
+                               &store->record_ids_count,
+                               record_buf,
+                               record_len,
+                               &store->trailer_checksum) < 0)
+    return (-1);
+
+  _sdr_cache_descriptor_fill (ctx,
+                              &store->descriptors[store->record_count_written],
+                              record_buf,
+                              record_len);
+
+  store->record_count_written++;
+
+  if (store->create_callback)
+    (*store->create_callback)(ctx->sdr_version,
+                              ctx->record_count,
+                              ctx->most_recent_addition_timestamp,
+                              ctx->most_recent_erase_timestamp,
+                              record_id,
+                              store->create_callback_data);
+
+  return (0);
+}
+
+/*
+ * Pipelined SDR download
+ *
+ * Records form a list, the id of the next record is only known once
+ * the header of the current one has been read.  Instead of reading
+ * one record at a time, the header read of the next record is issued
+ * as soon as the current header arrives and the body of the current
+ * record is read in partial reads issued at the same time, all under
+ * one reservation, with up to the context's asynchronous window of
+ * Get SDR requests in flight.  Records complete out of order and are
+ * stored in SDR order.
+ *
+ * The partial read size that works is learned and kept in the SDR
+ * context for later cache creations.  Until an entire record read
+ * fails, records are read whole as in the serial download.
+ *
+ * When the reservation is cancelled, requests in flight are drained,
+ * a new reservation is made and the cancelled reads are issued again.
+ */
+
+static void
+_sdr_cache_pipeline_callback (ipmi_ctx_t ipmi_ctx,
+                              int rv,
+                              void *callback_data)
+{
+  struct sdr_cache_pipeline_rq *rq;
+
+  assert (ipmi_ctx);
+  assert (callback_data);
+
+  rq = (struct sdr_cache_pipeline_rq *)callback_data;
+
+  assert (rq->state == SDR_CACHE_PIPELINE_RQ_PENDING);
+
+  rq->state = SDR_CACHE_PIPELINE_RQ_DONE;
+  rq->rv = rv;
+  rq->errnum = (rv < 0) ? ipmi_ctx_errnum (ipmi_ctx) : IPMI_ERR_SUCCESS;
+  rq->pipeline->rq_count--;
+}
+
+/* returns 1 if the interface cannot pipeline, 0 on success, -1 on error */
+static int
+_sdr_cache_pipeline_submit (struct sdr_cache_pipeline *pipeline,
+                            unsigned int slot,
+                            unsigned int offset_into_record,
+                            unsigned int bytes_to_read)
+{
+  struct sdr_cache_pipeline_rq *rq = NULL;
+  struct sdr_cache_pipeline_record *record;
+  unsigned int i;
+
+  assert (pipeline);
+  assert (slot < IPMI_SDR_CACHE_PIPELINE_RECORDS);
+  assert (bytes_to_read);
+  assert (pipeline->rq_count < pipeline->window);
+
+  record = &(pipeline->records[slot]);
+
+  for (i = 0; i < IPMI_ASYNC_WINDOW_MAX; i++)
+    {
+      if (pipeline->rqs[i].state == SDR_CACHE_PIPELINE_RQ_FREE)
+        {
+          rq = &(pipeline->rqs[i]);
+          break;
+        }
+    }
+  assert (rq);
+
+  if (fiid_obj_clear (rq->obj_cmd_rq) < 0)
+    {
+      SDR_FIID_OBJECT_ERROR_TO_SDR_ERRNUM (pipeline->ctx, rq->obj_cmd_rq);
+      return (-1);
+    }
+
+  if (fiid_obj_clear (rq->obj_cmd_rs) < 0)
+    {
+      SDR_FIID_OBJECT_ERROR_TO_SDR_ERRNUM (pipeline->ctx, rq->obj_cmd_rs);
+      return (-1);
+    }
+
+  if (fill_cmd_get_sdr (pipeline->reservation_id,
+                        record->record_id,
+                        offset_into_record,
+                        bytes_to_read,
+                        rq->obj_cmd_rq) < 0)
+    {
+      SDR_ERRNO_TO_SDR_ERRNUM (pipeline->ctx, errno);
+      return (-1);
+    }
+
+  rq->state = SDR_CACHE_PIPELINE_RQ_PENDING;
+  if (ipmi_cmd_async (pipeline->ipmi_ctx,
+                      IPMI_BMC_IPMB_LUN_BMC,
+                      IPMI_NET_FN_STORAGE_RQ,
+                      rq->obj_cmd_rq,
+                      rq->obj_cmd_rs,
+                      _sdr_cache_pipeline_callback,
+                      rq) < 0)
+    {
+      rq->state = SDR_CACHE_PIPELINE_RQ_FREE;
+
+      /* inband, or bridged, nothing sent yet */
+      if (ipmi_ctx_errnum (pipeline->ipmi_ctx) == IPMI_ERR_COMMAND_INVALID_FOR_SELECTED_INTERFACE
+          && !pipeline->submitted)
+        return (1);
+
+      SDR_SET_ERRNUM (pipeline->ctx, IPMI_SDR_ERR_IPMI_ERROR);
+      return (-1);
+    }
+
+  rq->slot = slot;
+  rq->offset_into_record = offset_into_record;
+  rq->bytes_to_read = bytes_to_read;
+  pipeline->rq_count++;
+  pipeline->submitted++;
+  record->rq_count++;
+  return (0);
+}
+
+/* start the next record in the list if there is room for it */
+static int
+_sdr_cache_pipeline_start_record (struct sdr_cache_pipeline *pipeline)
+{
+  struct sdr_cache_pipeline_record *record;
+  unsigned int slot;
+
+  assert (pipeline);
+
+  if (!pipeline->next_record_id_ready
+      || pipeline->next_record_id == IPMI_SDR_RECORD_ID_LAST
+      || pipeline->records_count == IPMI_SDR_CACHE_PIPELINE_RECORDS)
+    return (0);
+
+  if ((pipeline->records_started - pipeline->records_dropped) >= pipeline->ctx->record_count)
+    {
+      /* See IPMI Workaround for unspecified Inspur motherboard in
+       * ipmi_sdr_cache_create()
+       */
+      if (pipeline->cache_create_flags & IPMI_SDR_CACHE_CREATE_FLAGS_ASSUME_MAX_SDR_RECORD_COUNT)
+        {
+          pipeline->next_record_id_ready = 0;
+          return (0);
+        }
+
+      SDR_SET_ERRNUM (pipeline->ctx, IPMI_SDR_ERR_CACHE_CREATE_INVALID_RECORD_COUNT);
+      return (-1);
+    }
+
+  slot = (pipeline->records_head + pipeline->records_count) % IPMI_SDR_CACHE_PIPELINE_RECORDS;
+  record = &(pipeline->records[slot]);
+
+  memset (record, '\0', sizeof (struct sdr_cache_pipeline_record));
+  record->state = SDR_CACHE_PIPELINE_RECORD_HEADER;
+  record->record_id = pipeline->next_record_id;
+
+  pipeline->records_count++;
+  pipeline->records_started++;
+  pipeline->next_record_id_ready = 0;
+  return (0);
+}
+
+/* first range of a record not yet read or being read, returns 1 if
+ * found, 0 if not
+ */
+static int
+_sdr_cache_pipeline_next_range (struct sdr_cache_pipeline_record *record,
+                                unsigned int bytes_to_read_max,
+                                unsigned int *offset_into_record,
+                                unsigned int *bytes_to_read)
+{
+  unsigned int offset;
+  unsigned int len = 0;
+
+  assert (record);
+  assert (bytes_to_read_max);
+  assert (offset_into_record);
+  assert (bytes_to_read);
+
+  for (offset = 0; offset < record->record_length; offset++)
+    {
+      if (!record->requested[offset])
+        break;
+    }
+
+  if (offset == record->record_length)
+    return (0);
+
+  while ((offset + len) < record->record_length
+         && !record->requested[offset + len]
+         && len < bytes_to_read_max)
+    len++;
+
+  (*offset_into_record) = offset;
+  (*bytes_to_read) = len;
+  return (1);
+}
+
+/* bytes to be read again */
+static void
+_sdr_cache_pipeline_unrequest (struct sdr_cache_pipeline_record *record,
+                               unsigned int offset_into_record,
+                               unsigned int bytes_to_read)
+{
+  assert (record);
+  assert ((offset_into_record + bytes_to_read) <= record->record_length);
+
+  memset (record->requested + offset_into_record, 0, bytes_to_read);
+}
+
+/* returns 1 if the interface cannot pipeline, 0 on success, -1 on error */
+static int
+_sdr_cache_pipeline_issue (struct sdr_cache_pipeline *pipeline)
+{
+  unsigned int i;
+  int ret;
+
+  assert (pipeline);
+
+  while (pipeline->rq_count < pipeline->window)
+    {
+      struct sdr_cache_pipeline_record *record = NULL;
+      unsigned int slot = 0;
+      unsigned int offset_into_record;
+      unsigned int bytes_to_read;
+
+      if (_sdr_cache_pipeline_start_record (pipeline) < 0)
+        return (-1);
+
+      /* header reads first, they lead to the next record */
+      for (i = 0; i < pipeline->records_count; i++)
+        {
+          slot = (pipeline->records_head + i) % IPMI_SDR_CACHE_PIPELINE_RECORDS;
+          if (pipeline->records[slot].state == SDR_CACHE_PIPELINE_RECORD_HEADER
+              && !pipeline->records[slot].rq_count)
+            {
+              record = &(pipeline->records[slot]);
+              break;
+            }
+        }
+
+      if (record)
+        {
+          if (!pipeline->ctx->bytes_to_read)
+            bytes_to_read = IPMI_SDR_READ_ENTIRE_RECORD_BYTES_TO_READ;
+          else
+            bytes_to_read = IPMI_SDR_RECORD_HEADER_LENGTH;
+
+          if ((ret = _sdr_cache_pipeline_submit (pipeline,
+                                                 slot,
+                                                 0,
+                                                 bytes_to_read)))
+            return (ret);
+          continue;
+        }
+
+      /* then body reads of the oldest records, records only need
+       * them once partial reads are used
+       */
+
+      for (i = 0; i < pipeline->records_count; i++)
+        {
+          slot = (pipeline->records_head + i) % IPMI_SDR_CACHE_PIPELINE_RECORDS;
+          if (pipeline->records[slot].state == SDR_CACHE_PIPELINE_RECORD_BODY
+              && _sdr_cache_pipeline_next_range (&(pipeline->records[slot]),
+                                                 pipeline->ctx->bytes_to_read,
+                                                 &offset_into_record,
+                                                 &bytes_to_read))
+            {
+              record = &(pipeline->records[slot]);
+              break;
+            }
+        }
+
+      if (!record)
+        break;
+
+      if ((ret = _sdr_cache_pipeline_submit (pipeline,
+                                             slot,
+                                             offset_into_record,
+                                             bytes_to_read)))
+        return (ret);
+
+      memset (record->requested + offset_into_record, 1, bytes_to_read);
+    }
+
+  return (0);
+}
+
+/* switch from entire record reads to partial reads */
+static void
+_sdr_cache_pipeline_partial_reads (struct sdr_cache_pipeline *pipeline)
+{
+  assert (pipeline);
+
+  if (!pipeline->ctx->bytes_to_read)
+    pipeline->ctx->bytes_to_read = IPMI_SDR_CACHE_PIPELINE_BYTES_TO_READ_START;
+}
+
+static int
+_sdr_cache_pipeline_header (struct sdr_cache_pipeline *pipeline,
+                            struct sdr_cache_pipeline_rq *rq,
+                            struct sdr_cache_pipeline_record *record,
+                            uint8_t comp_code)
+{
+  uint8_t record_buf[IPMI_SDR_MAX_RECORD_LENGTH];
+  int record_buf_len;
+  uint64_t val;
+
+  assert (pipeline);
+  assert (rq);
+  assert (record);
+  assert (record->state == SDR_CACHE_PIPELINE_RECORD_HEADER);
+
+  if (rq->rv < 0 || comp_code != IPMI_COMP_CODE_COMMAND_SUCCESS)
+    {
+      /* As in the serial download, any failure of an entire record
+       * read falls back to partial reads.
+       */
+      if (rq->bytes_to_read == IPMI_SDR_READ_ENTIRE_RECORD_BYTES_TO_READ)
+        {
+          _sdr_cache_pipeline_partial_reads (pipeline);
+          return (0);
+        }
+
+      SDR_SET_ERRNUM (pipeline->ctx, IPMI_SDR_ERR_IPMI_ERROR);
+      return (-1);
+    }
+
+  if ((record_buf_len = fiid_obj_get_data (rq->obj_cmd_rs,
+                                           "record_data",
+                                           record_buf,
+                                           IPMI_SDR_MAX_RECORD_LENGTH)) < 0)
+    {
+      SDR_FIID_OBJECT_ERROR_TO_SDR_ERRNUM (pipeline->ctx, rq->obj_cmd_rs);
+      return (-1);
+    }
+
+  if (record_buf_len < IPMI_SDR_RECORD_HEADER_LENGTH)
+    {
+      /* Assume this is an "IPMI Error", fall through to partial reads */
+      if (rq->bytes_to_read == IPMI_SDR_READ_ENTIRE_RECORD_BYTES_TO_READ)
+        {
+          _sdr_cache_pipeline_partial_reads (pipeline);
+          return (0);
+        }
+
+      SDR_SET_ERRNUM (pipeline->ctx, IPMI_SDR_ERR_IPMI_ERROR);
+      return (-1);
+    }
+
+  if (FIID_OBJ_GET (rq->obj_cmd_rs,
+                    "next_record_id",
+                    &val) < 0)
+    {
+      SDR_FIID_OBJECT_ERROR_TO_SDR_ERRNUM (pipeline->ctx, rq->obj_cmd_rs);
+      return (-1);
+    }
+  record->next_record_id = val;
+
+  record->record_length = ((uint8_t)record_buf[IPMI_SDR_RECORD_LENGTH_INDEX]) + IPMI_SDR_RECORD_HEADER_LENGTH;
+
+  /* See IPMI Workarounds for HP Proliant DL585G7 in
+   * _sdr_cache_record_write() and Xyratex HB-F8-SRAY in
+   * _sdr_cache_get_record(), excess bytes are ignored and the
+   * rest of a short record is read with partial reads.
+   */
+  if ((unsigned int)record_buf_len > record->record_length)
+    record_buf_len = record->record_length;
+
+  if ((unsigned int)record_buf_len < record->record_length)
+    _sdr_cache_pipeline_partial_reads (pipeline);
+
+  memcpy (record->record_buf, record_buf, record_buf_len);
+  memset (record->requested, 1, record_buf_len);
+  record->bytes_received = record_buf_len;
+
+  if (record->bytes_received == record->record_length)
+    record->state = SDR_CACHE_PIPELINE_RECORD_DONE;
+  else
+    record->state = SDR_CACHE_PIPELINE_RECORD_BODY;
+
+  /* the next record is only started once this header is read, so
+   * this is the newest record
+   */
+  assert (record == &(pipeline->records[(pipeline->records_head + pipeline->records_count - 1) % IPMI_SDR_CACHE_PIPELINE_RECORDS]));
+
+  pipeline->next_record_id = record->next_record_id;
+  pipeline->next_record_id_ready = 1;
+
+  return (0);
+}
+
+static int
+_sdr_cache_pipeline_body (struct sdr_cache_pipeline *pipeline,
+                          struct sdr_cache_pipeline_rq *rq,
+                          struct sdr_cache_pipeline_record *record,
+                          uint8_t comp_code)
+{
+  uint8_t record_buf[IPMI_SDR_MAX_RECORD_LENGTH];
+  int record_data_len;
+
+  assert (pipeline);
+  assert (rq);
+  assert (record);
+  assert (record->state == SDR_CACHE_PIPELINE_RECORD_BODY);
+
+  if (rq->rv < 0)
+    {
+      SDR_SET_ERRNUM (pipeline->ctx, IPMI_SDR_ERR_IPMI_ERROR);
+      return (-1);
+    }
+
+  if (comp_code != IPMI_COMP_CODE_COMMAND_SUCCESS)
+    {
+      /* See IPMI Workaround for Dell Poweredge FC830 in
+       * _sdr_cache_get_record(), the last record is dropped.
+       */
+      if (comp_code == IPMI_COMP_CODE_COMMAND_TIMEOUT
+          && record->next_record_id == IPMI_SDR_RECORD_ID_LAST)
+        {
+          record->state = SDR_CACHE_PIPELINE_RECORD_DONE;
+          record->dropped = 1;
+          pipeline->records_dropped++;
+          return (0);
+        }
+
+      if ((comp_code == IPMI_COMP_CODE_CANNOT_RETURN_REQUESTED_NUMBER_OF_BYTES
+           || comp_code == IPMI_COMP_CODE_UNSPECIFIED_ERROR)
+          && rq->bytes_to_read > IPMI_SDR_RECORD_HEADER_LENGTH)
+        {
+          /* learn the size, unless other reads already lowered it */
+          if (rq->bytes_to_read <= pipeline->ctx->bytes_to_read)
+            {
+              pipeline->ctx->bytes_to_read = rq->bytes_to_read - IPMI_SDR_CACHE_BYTES_TO_READ_DECREMENT;
+              if (pipeline->ctx->bytes_to_read < IPMI_SDR_RECORD_HEADER_LENGTH)
+                pipeline->ctx->bytes_to_read = IPMI_SDR_RECORD_HEADER_LENGTH;
+            }
+
+          _sdr_cache_pipeline_unrequest (record,
+                                         rq->offset_into_record,
+                                         rq->bytes_to_read);
+          return (0);
+        }
+
+      SDR_SET_ERRNUM (pipeline->ctx, IPMI_SDR_ERR_IPMI_ERROR);
+      return (-1);
+    }
+
+  if ((record_data_len = fiid_obj_get_data (rq->obj_cmd_rs,
+                                            "record_data",
+                                            record_buf,
+                                            IPMI_SDR_MAX_RECORD_LENGTH)) < 0)
+    {
+      SDR_FIID_OBJECT_ERROR_TO_SDR_ERRNUM (pipeline->ctx, rq->obj_cmd_rs);
+      return (-1);
+    }
+
+  /* excess bytes are ignored, see _sdr_cache_pipeline_header() */
+  if ((unsigned int)record_data_len > rq->bytes_to_read)
+    record_data_len = rq->bytes_to_read;
+
+  /* a read returning nothing would be retried forever */
+  if (!record_data_len)
+    {
+      SDR_SET_ERRNUM (pipeline->ctx, IPMI_SDR_ERR_IPMI_ERROR);
+      return (-1);
+    }
+
+  memcpy (record->record_buf + rq->offset_into_record, record_buf, record_data_len);
+
+  if ((unsigned int)record_data_len < rq->bytes_to_read)
+    _sdr_cache_pipeline_unrequest (record,
+                                   rq->offset_into_record + record_data_len,
+                                   rq->bytes_to_read - record_data_len);
+
+  record->bytes_received += record_data_len;
+  if (record->bytes_received == record->record_length)
+    record->state = SDR_CACHE_PIPELINE_RECORD_DONE;
+
+  return (0);
+}
+
+/* handle completed requests */
+static int
+_sdr_cache_pipeline_complete (struct sdr_cache_pipeline *pipeline)
+{
+  unsigned int i;
+
+  assert (pipeline);
+
+  for (i = 0; i < IPMI_ASYNC_WINDOW_MAX; i++)
+    {
+      struct sdr_cache_pipeline_rq *rq = &(pipeline->rqs[i]);
+      struct sdr_cache_pipeline_record *record;
+      uint8_t comp_code = IPMI_COMP_CODE_COMMAND_SUCCESS;
+      uint64_t val;
+
+      if (rq->state != SDR_CACHE_PIPELINE_RQ_DONE)
+        continue;
+
+      rq->state = SDR_CACHE_PIPELINE_RQ_FREE;
+
+      record = &(pipeline->records[rq->slot]);
+      assert (record->rq_count);
+      record->rq_count--;
+
+      if (!rq->rv)
+        {
+          if (FIID_OBJ_GET (rq->obj_cmd_rs,
+                            "comp_code",
+                            &val) < 0)
+            {
+              SDR_FIID_OBJECT_ERROR_TO_SDR_ERRNUM (pipeline->ctx, rq->obj_cmd_rs);
+              return (-1);
+            }
+          comp_code = val;
+
+          if (comp_code == IPMI_COMP_CODE_COMMAND_SUCCESS)
+            pipeline->reservation_id_retry_count = 0;
+
+          /* read again under the new reservation */
+          if (comp_code == IPMI_COMP_CODE_RESERVATION_CANCELLED)
+            {
+              pipeline->restart = 1;
+
+              if (record->state == SDR_CACHE_PIPELINE_RECORD_BODY)
+                _sdr_cache_pipeline_unrequest (record,
+                                               rq->offset_into_record,
+                                               rq->bytes_to_read);
+              continue;
+            }
+        }
+
+      if (record->state == SDR_CACHE_PIPELINE_RECORD_HEADER)
+        {
+          if (_sdr_cache_pipeline_header (pipeline, rq, record, comp_code) < 0)
+            return (-1);
+        }
+      else if (record->state == SDR_CACHE_PIPELINE_RECORD_BODY)
+        {
+          if (_sdr_cache_pipeline_body (pipeline, rq, record, comp_code) < 0)
+            return (-1);
+        }
+    }
+
+  return (0);
+}
+
+/* store complete records in SDR order */
+static int
+_sdr_cache_pipeline_store (struct sdr_cache_pipeline *pipeline)
+{
+  assert (pipeline);
+
+  while (pipeline->records_count)
+    {
+      struct sdr_cache_pipeline_record *record;
+
+      record = &(pipeline->records[pipeline->records_head]);
+
+      if (record->state != SDR_CACHE_PIPELINE_RECORD_DONE
+          || record->rq_count)
+        break;
+
+      if (!record->dropped)
+        {
+          if (_sdr_cache_record_store (pipeline->ctx,
+                                       pipeline->store,
+                                       record->record_id,
+                                       record->record_buf,
+                                       record->record_length) < 0)
+            return (-1);
+        }
+
+      record->state = SDR_CACHE_PIPELINE_RECORD_UNUSED;
+      pipeline->records_head = (pipeline->records_head + 1) % IPMI_SDR_CACHE_PIPELINE_RECORDS;
+      pipeline->records_count--;
+    }
+
+  return (0);
+}
+
+/* Reads cancelled with the reservation are issued again under a new
+ * one, as the serial download does, data already read is kept.
+ */
+static int
+_sdr_cache_pipeline_restart (struct sdr_cache_pipeline *pipeline)
+{
+  assert (pipeline);
+  assert (pipeline->restart);
+  assert (!pipeline->rq_count);
+
+  if (pipeline->reservation_id_retry_count >= IPMI_SDR_CACHE_MAX_RESERVATION_ID_RETRY)
+    {
+      SDR_SET_ERRNUM (pipeline->ctx, IPMI_SDR_ERR_IPMI_ERROR);
+      return (-1);
+    }
+
+  if (_sdr_cache_reservation_id (pipeline->ctx,
+                                 pipeline->ipmi_ctx,
+                                 &pipeline->reservation_id) < 0)
+    return (-1);
+  pipeline->reservation_id_retry_count++;
+
+  pipeline->restart = 0;
+  return (0);
+}
+
+static int
+_sdr_cache_pipeline_wait (struct sdr_cache_pipeline *pipeline)
+{
+  struct pollfd pfd;
+  int timeout;
+  int n;
+
+  assert (pipeline);
+  assert (pipeline->rq_count);
+
+  if (ipmi_ctx_async_timeout (pipeline->ipmi_ctx, &timeout) < 0)
+    {
+      SDR_SET_ERRNUM (pipeline->ctx, IPMI_SDR_ERR_IPMI_ERROR);
+      return (-1);
+    }
+
+  if ((pfd.fd = ipmi_ctx_get_fd (pipeline->ipmi_ctx)) < 0)
+    {
+      SDR_SET_ERRNUM (pipeline->ctx, IPMI_SDR_ERR_IPMI_ERROR);
+      return (-1);
+    }
+  pfd.events = POLLIN;
+  pfd.revents = 0;
+
+  if ((n = poll (&pfd, 1, timeout)) < 0)
+    {
+      if (errno == EINTR)
+        return (0);
+      SDR_ERRNO_TO_SDR_ERRNUM (pipeline->ctx, errno);
+      return (-1);
+    }
+
+  if (ipmi_ctx_async_process (pipeline->ipmi_ctx, n ? pfd.revents : 0) < 0)
+    {
+      SDR_SET_ERRNUM (pipeline->ctx, IPMI_SDR_ERR_IPMI_ERROR);
+      return (-1);
+    }
+
+  return (0);
+}
+
+/* returns 1 if the interface cannot pipeline, in which case nothing
+ * has been read, 0 on success, -1 on error
+ */
+static int
+_sdr_cache_pipeline_get_records (ipmi_sdr_ctx_t ctx,
+                                 ipmi_ctx_t ipmi_ctx,
+                                 int cache_create_flags,
+                                 struct sdr_cache_record_store *store,
+                                 uint16_t *reservation_id,
+                                 uint16_t *next_record_id)
+{
+  struct sdr_cache_pipeline pipeline;
+  unsigned int window_orig = 0;
+  int window_set = 0;
+  unsigned int i;
+  int ret;
+  int rv = -1;
+
+  assert (ctx);
+  assert (ctx->magic == IPMI_SDR_CTX_MAGIC);
+  assert (ipmi_ctx);
+  assert (store);
+  assert (reservation_id);
+  assert (next_record_id);
+
+  memset (&pipeline, '\0', sizeof (struct sdr_cache_pipeline));
+  pipeline.ctx = ctx;
+  pipeline.ipmi_ctx = ipmi_ctx;
+  pipeline.cache_create_flags = cache_create_flags;
+  pipeline.store = store;
+  pipeline.reservation_id = *reservation_id;
+  pipeline.next_record_id = *next_record_id;
+  pipeline.next_record_id_ready = 1;
+
+  for (i = 0; i < IPMI_ASYNC_WINDOW_MAX; i++)
+    {
+      pipeline.rqs[i].pipeline = &pipeline;
+
+      if (!(pipeline.rqs[i].obj_cmd_rq = fiid_obj_create (tmpl_cmd_get_sdr_rq)))
+        {
+          SDR_ERRNO_TO_SDR_ERRNUM (ctx, errno);
+          goto cleanup;
+        }
+
+      if (!(pipeline.rqs[i].obj_cmd_rs = fiid_obj_create (tmpl_cmd_get_sdr_rs)))
+        {
+          SDR_ERRNO_TO_SDR_ERRNUM (ctx, errno);
+          goto cleanup;
+        }
+    }
+
+  /* a window configured by the caller is used as is */
+  if (ipmi_ctx_get_async_window (ipmi_ctx, &window_orig) < 0)
+    {
+      SDR_SET_ERRNUM (ctx, IPMI_SDR_ERR_IPMI_ERROR);
+      goto cleanup;
+    }
+
+  if (window_orig > 1)
+    pipeline.window = window_orig;
+  else
+    {
+      pipeline.window = IPMI_SDR_CACHE_PIPELINE_WINDOW_DEFAULT;
+
+      if (ipmi_ctx_set_async_window (ipmi_ctx, pipeline.window) < 0)
+        {
+          SDR_SET_ERRNUM (ctx, IPMI_SDR_ERR_IPMI_ERROR);
+          goto cleanup;
+        }
+      window_set = 1;
+    }
+
+  while (1)
+    {
+      if (_sdr_cache_pipeline_complete (&pipeline) < 0)
+        goto cleanup;
+
+      if (_sdr_cache_pipeline_store (&pipeline) < 0)
+        goto cleanup;
+
+      if (pipeline.restart)
+        {
+          if (pipeline.rq_count)
+            {
+              if (_sdr_cache_pipeline_wait (&pipeline) < 0)
+                goto cleanup;
+              continue;
+            }
+
+          if (_sdr_cache_pipeline_restart (&pipeline) < 0)
+            goto cleanup;
+        }
+
+      if ((ret = _sdr_cache_pipeline_issue (&pipeline)))
+        {
+          if (ret > 0)
+            rv = 1;
+          goto cleanup;
+        }
+
+      if (!pipeline.rq_count)
+        {
+          /* every record is stored and the list has ended */
+          if (!pipeline.records_count)
+            break;
+
+          SDR_SET_ERRNUM (ctx, IPMI_SDR_ERR_INTERNAL_ERROR);
+          goto cleanup;
+        }
+
+      if (_sdr_cache_pipeline_wait (&pipeline) < 0)
+        goto cleanup;
+    }
+
+  *reservation_id = pipeline.reservation_id;
+  *next_record_id = pipeline.next_record_id;
+  rv = 0;
+ cleanup:
+  /* requests still in flight must complete before their objects go */
+  if (pipeline.rq_count)
+    ipmi_ctx_async_wait (ipmi_ctx);
+  if (window_set)
+    ipmi_ctx_set_async_window (ipmi_ctx, window_orig);
+  for (i = 0; i < IPMI_ASYNC_WINDOW_MAX; i++)
+    {
+      fiid_obj_destroy (pipeline.rqs[i].obj_cmd_rq);
+      fiid_obj_destroy (pipeline.rqs[i].obj_cmd_rs);
+    }
+  return (rv);
+}
+
 int
 ipmi_sdr_cache_create (ipmi_sdr_ctx_t ctx,
                        ipmi_ctx_t ipmi_ctx,
@@ -783,15 +1951,14 @@ ipmi_sdr_cache_create (ipmi_sdr_ctx_t ctx,
   uint8_t sdr_version;
   uint16_t record_count, reservation_id, record_id, next_record_id;
   uint32_t most_recent_addition_timestamp, most_recent_erase_timestamp;
-  unsigned int record_count_written = 0;
-  unsigned int total_bytes_written = 0;
-  uint16_t *record_ids = NULL;
-  unsigned int record_ids_count = 0;
+  struct sdr_cache_record_store store;
+  unsigned int records_end_offset;
+  unsigned int descriptors_offset;
   unsigned int cache_create_flags_mask = (IPMI_SDR_CACHE_CREATE_FLAGS_OVERWRITE
                                           | IPMI_SDR_CACHE_CREATE_FLAGS_DUPLICATE_RECORD_ID
-                                          | IPMI_SDR_CACHE_CREATE_FLAGS_ASSUME_MAX_SDR_RECORD_COUNT);
-  uint8_t trailer_checksum = 0;
-  int fd = -1;
+                                          | IPMI_SDR_CACHE_CREATE_FLAGS_ASSUME_MAX_SDR_RECORD_COUNT
+                                          | IPMI_SDR_CACHE_CREATE_FLAGS_PIPELINE);
+  int ret;
   int rv = -1;
 
   if (!ctx || ctx->magic != IPMI_SDR_CTX_MAGIC)
@@ -819,6 +1986,11 @@ ipmi_sdr_cache_create (ipmi_sdr_ctx_t ctx,
       return (-1);
     }
 
+  memset (&store, '\0', sizeof (struct sdr_cache_record_store));
+  store.fd = -1;
+  store.create_callback = create_callback;
+  store.create_callback_data = create_callback_data;
+
   ctx->operation = IPMI_SDR_OPERATION_CREATE_CACHE;
 
   if (cache_create_flags & IPMI_SDR_CACHE_CREATE_FLAGS_OVERWRITE)
@@ -826,7 +1998,7 @@ ipmi_sdr_cache_create (ipmi_sdr_ctx_t ctx,
   else
     open_flags = O_CREAT | O_EXCL | O_WRONLY;
 
-  if ((fd = open (filename, open_flags, 0644)) < 0)
+  if ((store.fd = open (filename, open_flags, 0644)) < 0)
     {
       if (!(cache_create_flags & IPMI_SDR_CACHE_CREATE_FLAGS_OVERWRITE)
           && errno == EEXIST)
@@ -865,8 +2037,8 @@ ipmi_sdr_cache_create (ipmi_sdr_ctx_t ctx,
 
   if (_sdr_cache_header_write (ctx,
                                ipmi_ctx,
-                               fd,
-                               &total_bytes_written,
+                               store.fd,
+                               &store.total_bytes_written,
                                sdr_version,
                                record_count,
                                most_recent_addition_timestamp,
@@ -881,12 +2053,18 @@ ipmi_sdr_cache_create (ipmi_sdr_ctx_t ctx,
 
   if (cache_create_flags & IPMI_SDR_CACHE_CREATE_FLAGS_DUPLICATE_RECORD_ID)
     {
-      if (!(record_ids = (uint16_t *)malloc (ctx->record_count * sizeof (uint16_t))))
+      if (!(store.record_ids = (uint16_t *)malloc (ctx->record_count * sizeof (uint16_t))))
         {
           SDR_SET_ERRNUM (ctx, IPMI_SDR_ERR_OUT_OF_MEMORY);
           goto cleanup;
         }
-      record_ids_count = 0;
+      store.record_ids_count = 0;
+    }
+
+  if (!(store.descriptors = (struct ipmi_sdr_cache_descriptor *)malloc (ctx->record_count * sizeof (struct ipmi_sdr_cache_descriptor))))
+    {
+      SDR_SET_ERRNUM (ctx, IPMI_SDR_ERR_OUT_OF_MEMORY);
+      goto cleanup;
     }
 
   if (_sdr_cache_reservation_id (ctx,
@@ -895,12 +2073,29 @@ ipmi_sdr_cache_create (ipmi_sdr_ctx_t ctx,
     goto cleanup;
 
   next_record_id = IPMI_SDR_RECORD_ID_FIRST;
-  while (next_record_id != IPMI_SDR_RECORD_ID_LAST)
+
+  if (cache_create_flags & IPMI_SDR_CACHE_CREATE_FLAGS_PIPELINE)
+    {
+      if ((ret = _sdr_cache_pipeline_get_records (ctx,
+                                                  ipmi_ctx,
+                                                  cache_create_flags,
+                                                  &store,
+                                                  &reservation_id,
+                                                  &next_record_id)) < 0)
+        goto cleanup;
+
+      /* interface cannot pipeline, nothing was read, read serially */
+      if (ret > 0)
+        cache_create_flags &= ~IPMI_SDR_CACHE_CREATE_FLAGS_PIPELINE;
+    }
+
+  while (!(cache_create_flags & IPMI_SDR_CACHE_CREATE_FLAGS_PIPELINE)
+         && next_record_id != IPMI_SDR_RECORD_ID_LAST)
     {
       uint8_t record_buf[IPMI_SDR_MAX_RECORD_LENGTH];
       int record_len;
 
-      if (record_count_written >= ctx->record_count)
+      if (store.record_count_written >= ctx->record_count)
         {
           /* IPMI Workaround
            *
@@ -932,57 +2127,16 @@ ipmi_sdr_cache_create (ipmi_sdr_ctx_t ctx,
 
       if (record_len)
         {
-          if (ctx->flags & IPMI_SDR_FLAGS_DEBUG_DUMP)
-            {
-              const char *record_str;
-
-              if ((record_str = sdr_record_type_str (ctx,
-                                                     record_buf,
-                                                     record_len)))
-                {
-                  char hdrbuf[IPMI_SDR_CACHE_DEBUG_BUFLEN + 1];
-
-                  memset (hdrbuf, '\0', IPMI_SDR_CACHE_DEBUG_BUFLEN + 1);
-
-                  debug_hdr_str (DEBUG_UTIL_TYPE_NONE,
-                                 DEBUG_UTIL_DIRECTION_NONE,
-                                 DEBUG_UTIL_FLAGS_DEFAULT,
-                                 record_str,
-                                 hdrbuf,
-                                 IPMI_SDR_CACHE_DEBUG_BUFLEN);
-
-                  ipmi_dump_sdr_record (STDERR_FILENO,
-                                        ctx->debug_prefix,
-                                        hdrbuf,
-                                        NULL,
-                                        record_buf,
-                                        record_len);
-                }
-            }
-
-          if (_sdr_cache_record_write (ctx,
-                                       fd,
-                                       &total_bytes_written,
-                                       record_ids,
-                                       &record_ids_count,
+          if (_sdr_cache_record_store (ctx,
+                                       &store,
+                                       record_id,
                                        record_buf,
-                                       record_len,
-                                       &trailer_checksum) < 0)
+                                       record_len) < 0)
             goto cleanup;
-
-          record_count_written++;
-
-          if (create_callback)
-            (*create_callback)(ctx->sdr_version,
-                               ctx->record_count,
-                               ctx->most_recent_addition_timestamp,
-                               ctx->most_recent_erase_timestamp,
-                               record_id,
-                               create_callback_data);
         }
     }
 
-  if (record_count_written != ctx->record_count)
+  if (store.record_count_written != ctx->record_count)
     {
       /*
        * IPMI Workaround (achu)
@@ -1001,18 +2155,18 @@ ipmi_sdr_cache_create (ipmi_sdr_ctx_t ctx,
        * as a consequence of that workaround
        */
       if (next_record_id == IPMI_SDR_RECORD_ID_LAST
-          && record_count_written)
+          && store.record_count_written)
         {
           unsigned int total_bytes_written_temp = 0;
 
-          ctx->record_count = record_count_written;
+          ctx->record_count = store.record_count_written;
 
           /* need to seek back to the beginning of the file and
            * re-write the header info with the correct number of
            * records
            */
 
-          if (lseek (fd, 0, SEEK_SET) < 0)
+          if (lseek (store.fd, 0, SEEK_SET) < 0)
             {
               SDR_SET_ERRNUM (ctx, IPMI_SDR_ERR_SYSTEM_ERROR);
               goto cleanup;
@@ -1020,7 +2174,7 @@ ipmi_sdr_cache_create (ipmi_sdr_ctx_t ctx,
 
           if (_sdr_cache_header_write (ctx,
                                        ipmi_ctx,
-                                       fd,
+                                       store.fd,
                                        &total_bytes_written_temp,
                                        ctx->sdr_version,
                                        ctx->record_count,
@@ -1031,7 +2185,7 @@ ipmi_sdr_cache_create (ipmi_sdr_ctx_t ctx,
           /* need to seek back to the end of the file to write the
            * trailer below
            */
-          if (lseek (fd, 0, SEEK_END) < 0)
+          if (lseek (store.fd, 0, SEEK_END) < 0)
             {
               SDR_SET_ERRNUM (ctx, IPMI_SDR_ERR_SYSTEM_ERROR);
               goto cleanup;
@@ -1044,39 +2198,54 @@ ipmi_sdr_cache_create (ipmi_sdr_ctx_t ctx,
         }
     }
 
+  records_end_offset = store.total_bytes_written;
+
+  if (_sdr_cache_descriptors_write (ctx,
+                                    store.fd,
+                                    &store.total_bytes_written,
+                                    store.descriptors,
+                                    store.record_count_written,
+                                    &descriptors_offset,
+                                    &store.trailer_checksum) < 0)
+    goto cleanup;
+
   if (_sdr_cache_trailer_write (ctx,
                                 ipmi_ctx,
-                                fd,
-                                total_bytes_written,
-                                trailer_checksum) < 0)
+                                store.fd,
+                                store.total_bytes_written,
+                                records_end_offset,
+                                descriptors_offset,
+                                store.record_count_written,
+                                store.trailer_checksum) < 0)
             goto cleanup;
 
-  if (fsync (fd) < 0)
+  if (fsync (store.fd) < 0)
     {
       SDR_ERRNO_TO_SDR_ERRNUM (ctx, errno);
       goto cleanup;
     }
 
-  if (close (fd) < 0)
+  if (close (store.fd) < 0)
     {
       SDR_ERRNO_TO_SDR_ERRNUM (ctx, errno);
       goto cleanup;
     }
-  fd = -1;
+  store.fd = -1;
 
   rv = 0;
   ctx->errnum = IPMI_SDR_ERR_SUCCESS;
  cleanup:
   ctx->operation = IPMI_SDR_OPERATION_UNINITIALIZED;
-  if (fd >= 0)
+  if (store.fd >= 0)
     {
       /* If the cache create never completed, try to remove the file */
       /* ignore potential error, cleanup path */
       unlink (filename);
       /* ignore potential error, cleanup path */
-      close (fd);
+      close (store.fd);
     }
-  free (record_ids);
+  free (store.record_ids);
+  free (store.descriptors);
   sdr_init_ctx (ctx);
   return (rv);
 }
@@ -0,0 +1,326 @@
+/*
+ * Copyright (C) 2003-2015 FreeIPMI Core Team
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif /* HAVE_CONFIG_H */
+
+#include <stdio.h>
+#include <stdlib.h>
+#if STDC_HEADERS
+#include <string.h>
+#endif /* STDC_HEADERS */
+#include <limits.h>
+#include <assert.h>
+#include <errno.h>
+
+#include "freeipmi/sdr/ipmi-sdr.h"
+#include "freeipmi/record-format/ipmi-sdr-record-format.h"
+
+#include "ipmi-sdr-cache-index.h"
+#include "ipmi-sdr-defs.h"
+#include "ipmi-sdr-trace.h"
+#include "ipmi-sdr-util.h"
+
+#include "freeipmi-portability.h"
+
+#define IPMI_SDR_CACHE_INDEX_SIZE_MIN 16
+
+#define IPMI_SDR_SENSOR_KEY(__sensor_owner_id, __sensor_number) \
+  ((((uint16_t)(__sensor_owner_id)) << 8) | ((uint16_t)(__sensor_number)))
+
+/* smallest power of 2 at least twice the count, keeps probe chains short */
+static unsigned int
+_index_size (unsigned int count)
+{
+  unsigned int size = IPMI_SDR_CACHE_INDEX_SIZE_MIN;
+
+  while (size < (count * 2))
+    size <<= 1;
+
+  return (size);
+}
+
+static unsigned int
+_index_hash (uint16_t key, unsigned int size)
+{
+  uint32_t h;
+
+  h = (uint32_t)key * 2654435761U;
+  h ^= h >> 16;
+  return (h & (size - 1));
+}
+
+/* first record inserted for a key wins, matching the file order the
+ * linear scans use
+ */
+static void
+_index_insert (struct ipmi_sdr_index_entry *index,
+               unsigned int size,
+               uint16_t key,
+               unsigned int position)
+{
+  unsigned int i;
+
+  assert (index);
+  assert (size);
+
+  i = _index_hash (key, size);
+  while (index[i].position)
+    {
+      if (index[i].key == key)
+        return;
+      i = (i + 1) & (size - 1);
+    }
+
+  index[i].key = key;
+  index[i].position = position + 1;
+}
+
+static int
+_index_lookup (struct ipmi_sdr_index_entry *index,
+               unsigned int size,
+               uint16_t key,
+               unsigned int *position)
+{
+  unsigned int i;
+
+  assert (position);
+
+  if (!index)
+    return (0);
+
+  i = _index_hash (key, size);
+  while (index[i].position)
+    {
+      if (index[i].key == key)
+        {
+          *position = index[i].position - 1;
+          return (1);
+        }
+      i = (i + 1) & (size - 1);
+    }
+
+  return (0);
+}
+
+static int
+_is_sensor_record (uint8_t record_type)
+{
+  return (record_type == IPMI_SDR_FORMAT_FULL_SENSOR_RECORD
+          || record_type == IPMI_SDR_FORMAT_COMPACT_SENSOR_RECORD
+          || record_type == IPMI_SDR_FORMAT_EVENT_ONLY_RECORD);
+}
+
+static uint8_t
+_share_count (const uint8_t *ptr)
+{
+  uint8_t record_type;
+  uint8_t share_count = 0;
+
+  assert (ptr);
+
+  record_type = ptr[IPMI_SDR_RECORD_TYPE_INDEX];
+
+  if (record_type == IPMI_SDR_FORMAT_COMPACT_SENSOR_RECORD)
+    {
+      share_count = ptr[IPMI_SDR_RECORD_COMPACT_SHARE_COUNT];
+      share_count &= IPMI_SDR_RECORD_COMPACT_SHARE_COUNT_BITMASK;
+      share_count >>= IPMI_SDR_RECORD_COMPACT_SHARE_COUNT_SHIFT;
+    }
+  else if (record_type == IPMI_SDR_FORMAT_EVENT_ONLY_RECORD)
+    {
+      share_count = ptr[IPMI_SDR_RECORD_EVENT_SHARE_COUNT];
+      share_count &= IPMI_SDR_RECORD_EVENT_SHARE_COUNT_BITMASK;
+      share_count >>= IPMI_SDR_RECORD_EVENT_SHARE_COUNT_SHIFT;
+    }
+
+  return (share_count);
+}
+
+/* same walk as ipmi_sdr_cache_next(), the last record is the one
+ * whose end reaches records_end_offset
+ */
+static off_t
+_next_offset (ipmi_sdr_ctx_t ctx, off_t offset)
+{
+  unsigned int record_length;
+
+  assert (ctx);
+
+  record_length = (uint8_t)((ctx->sdr_cache + offset)[IPMI_SDR_RECORD_LENGTH_INDEX]);
+
+  if ((offset + record_length + IPMI_SDR_RECORD_HEADER_LENGTH) >= ctx->records_end_offset)
+    return (ctx->records_end_offset);
+
+  return (offset + IPMI_SDR_RECORD_HEADER_LENGTH + record_length);
+}
+
+int
+sdr_cache_index_build (ipmi_sdr_ctx_t ctx)
+{
+  unsigned int record_offsets_count = 0;
+  unsigned int sensor_keys_count = 0;
+  unsigned int i;
+  off_t offset;
+
+  assert (ctx);
+  assert (ctx->magic == IPMI_SDR_CTX_MAGIC);
+  assert (ctx->sdr_cache);
+  assert (!ctx->record_offsets);
+
+  offset = ctx->records_start_offset;
+  while (offset < ctx->records_end_offset)
+    {
+      uint8_t *ptr = ctx->sdr_cache + offset;
+
+      if (_is_sensor_record (ptr[IPMI_SDR_RECORD_TYPE_INDEX]))
+        {
+          uint8_t share_count = _share_count (ptr);
+
+          sensor_keys_count += share_count > 1 ? share_count : 1;
+        }
+
+      record_offsets_count++;
+      offset = _next_offset (ctx, offset);
+    }
+
+  if (!record_offsets_count)
+    return (0);
+
+  if (!(ctx->record_offsets = (off_t *)malloc (sizeof (off_t) * record_offsets_count)))
+    goto oom;
+
+  ctx->record_id_index_size = _index_size (record_offsets_count);
+  if (!(ctx->record_id_index = (struct ipmi_sdr_index_entry *)calloc (ctx->record_id_index_size,
+                                                                      sizeof (struct ipmi_sdr_index_entry))))
+    goto oom;
+
+  if (sensor_keys_count)
+    {
+      ctx->sensor_index_size = _index_size (sensor_keys_count);
+      if (!(ctx->sensor_index = (struct ipmi_sdr_index_entry *)calloc (ctx->sensor_index_size,
+                                                                       sizeof (struct ipmi_sdr_index_entry))))
+        goto oom;
+    }
+
+  offset = ctx->records_start_offset;
+  for (i = 0; i < record_offsets_count; i++)
+    {
+      uint8_t *ptr = ctx->sdr_cache + offset;
+      uint16_t record_id;
+
+      ctx->record_offsets[i] = offset;
+
+      /* Record ID stored little-endian */
+      record_id = (uint16_t)ptr[IPMI_SDR_RECORD_ID_INDEX_LS] & 0xFF;
+      record_id |= ((uint16_t)ptr[IPMI_SDR_RECORD_ID_INDEX_MS] & 0xFF) << 8;
+
+      _index_insert (ctx->record_id_index,
+                     ctx->record_id_index_size,
+                     record_id,
+                     i);
+
+      if (_is_sensor_record (ptr[IPMI_SDR_RECORD_TYPE_INDEX]))
+        {
+          uint8_t sensor_owner_id = ptr[IPMI_SDR_RECORD_SENSOR_OWNER_ID_INDEX];
+          unsigned int sensor_number = ptr[IPMI_SDR_RECORD_SENSOR_NUMBER_INDEX];
+          unsigned int sensor_number_last = sensor_number;
+          uint8_t share_count = _share_count (ptr);
+
+          /* IPMI spec gives the following example:
+           *
+           * "If the starting sensor number was 10, and the share
+           * count was 3, then sensors 10, 11, and 12 would share
+           * the record"
+           */
+          if (share_count > 1)
+            sensor_number_last += share_count - 1;
+
+          /* sensor numbers are 8 bits, shared ranges past 255 can
+           * never be searched for
+           */
+          if (sensor_number_last > UCHAR_MAX)
+            sensor_number_last = UCHAR_MAX;
+
+          for (; sensor_number <= sensor_number_last; sensor_number++)
+            _index_insert (ctx->sensor_index,
+                           ctx->sensor_index_size,
+                           IPMI_SDR_SENSOR_KEY (sensor_owner_id, sensor_number),
+                           i);
+        }
+
+      offset = _next_offset (ctx, offset);
+    }
+
+  ctx->record_offsets_count = record_offsets_count;
+  return (0);
+
+ oom:
+  SDR_SET_ERRNUM (ctx, IPMI_SDR_ERR_OUT_OF_MEMORY);
+  sdr_cache_index_destroy (ctx);
+  return (-1);
+}
+
+void
+sdr_cache_index_destroy (ipmi_sdr_ctx_t ctx)
+{
+  assert (ctx);
+  assert (ctx->magic == IPMI_SDR_CTX_MAGIC);
+
+  free (ctx->record_offsets);
+  ctx->record_offsets = NULL;
+  ctx->record_offsets_count = 0;
+  free (ctx->record_id_index);
+  ctx->record_id_index = NULL;
+  ctx->record_id_index_size = 0;
+  free (ctx->sensor_index);
+  ctx->sensor_index = NULL;
+  ctx->sensor_index_size = 0;
+}
+
+int
+sdr_cache_index_record_id (ipmi_sdr_ctx_t ctx,
+                           uint16_t record_id,
+                           unsigned int *position)
+{
+  assert (ctx);
+  assert (ctx->magic == IPMI_SDR_CTX_MAGIC);
+  assert (position);
+
+  return (_index_lookup (ctx->record_id_index,
+                         ctx->record_id_index_size,
+                         record_id,
+                         position));
+}
+
+int
+sdr_cache_index_sensor (ipmi_sdr_ctx_t ctx,
+                        uint8_t sensor_number,
+                        uint8_t sensor_owner_id,
+                        unsigned int *position)
+{
+  assert (ctx);
+  assert (ctx->magic == IPMI_SDR_CTX_MAGIC);
+  assert (position);
+
+  return (_index_lookup (ctx->sensor_index,
+                         ctx->sensor_index_size,
+                         IPMI_SDR_SENSOR_KEY (sensor_owner_id, sensor_number),
+                         position));
+}
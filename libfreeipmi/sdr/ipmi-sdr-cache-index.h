@@ -0,0 +1,52 @@
+/*
+ * Copyright (C) 2003-2015 FreeIPMI Core Team
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef IPMI_SDR_CACHE_INDEX_H
+#define IPMI_SDR_CACHE_INDEX_H
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif /* HAVE_CONFIG_H */
+
+#include <stdint.h>
+#include <sys/types.h>
+
+#include "freeipmi/sdr/ipmi-sdr.h"
+
+#include "ipmi-sdr-defs.h"
+
+/* Build the record position, record id, and sensor lookup tables
+ * for the mapped cache.  Lookups return the same record a linear scan
+ * over the cache in file order would.
+ */
+int sdr_cache_index_build (ipmi_sdr_ctx_t ctx);
+
+void sdr_cache_index_destroy (ipmi_sdr_ctx_t ctx);
+
+/* returns 1 if found, 0 if not */
+int sdr_cache_index_record_id (ipmi_sdr_ctx_t ctx,
+                               uint16_t record_id,
+                               unsigned int *position);
+
+/* returns 1 if found, 0 if not */
+int sdr_cache_index_sensor (ipmi_sdr_ctx_t ctx,
+                            uint8_t sensor_number,
+                            uint8_t sensor_owner_id,
+                            unsigned int *position);
+
+#endif /* IPMI_SDR_CACHE_INDEX_H */
@@ -50,6 +50,7 @@
 #include "freeipmi/record-format/ipmi-sdr-record-format.h"
 #include "freeipmi/util/ipmi-util.h"
 
+#include "ipmi-sdr-cache-index.h"
 #include "ipmi-sdr-common.h"
 #include "ipmi-sdr-defs.h"
 #include "ipmi-sdr-trace.h"
@@ -57,16 +58,98 @@
 
 #include "freeipmi-portability.h"
 
+/* Positions beyond the last record select the last record, like
+ * walking the cache with ipmi_sdr_cache_next().
+ */
 static void
-_sdr_set_current_offset (ipmi_sdr_ctx_t ctx, off_t new_offset)
+_sdr_set_current_position (ipmi_sdr_ctx_t ctx, unsigned int new_position)
 {
   assert (ctx);
   assert (ctx->magic == IPMI_SDR_CTX_MAGIC);
 
-  ctx->current_offset.offset = new_offset;
+  if (ctx->record_offsets_count)
+    {
+      if (new_position >= ctx->record_offsets_count)
+        new_position = ctx->record_offsets_count - 1;
+      ctx->current_offset.offset = ctx->record_offsets[new_position];
+    }
+  else
+    {
+      new_position = 0;
+      ctx->current_offset.offset = ctx->records_start_offset;
+    }
+  ctx->current_offset.position = new_position;
   ctx->current_offset.offset_dumped = 0;
 }
 
+static uint32_t
+_sdr_cache_get_uint32 (const uint8_t *buf)
+{
+  uint32_t val;
+
+  assert (buf);
+
+  val = ((uint32_t)buf[0] & 0xFF);
+  val |= ((uint32_t)buf[1] & 0xFF) << 8;
+  val |= ((uint32_t)buf[2] & 0xFF) << 16;
+  val |= ((uint32_t)buf[3] & 0xFF) << 24;
+  return (val);
+}
+
+/* Reads the version 2.0 trailer, the trailer checksum has already
+ * been verified.  Descriptors written with a different byte order or
+ * layout are ignored, the raw records are still used.
+ */
+static int
+_sdr_cache_descriptors_read (ipmi_sdr_ctx_t ctx, unsigned int trailer_bytes_len)
+{
+  const uint8_t *trailer;
+  uint32_t records_end_offset;
+  uint32_t descriptors_offset;
+  uint16_t descriptors_count;
+  uint16_t descriptor_len;
+  uint32_t descriptor_byte_order;
+  off_t trailer_offset;
+
+  assert (ctx);
+  assert (ctx->magic == IPMI_SDR_CTX_MAGIC);
+  assert (ctx->sdr_cache);
+  assert (ctx->file_size >= trailer_bytes_len);
+
+  trailer_offset = ctx->file_size - trailer_bytes_len;
+  trailer = ctx->sdr_cache + trailer_offset;
+
+  records_end_offset = _sdr_cache_get_uint32 (trailer);
+  descriptors_offset = _sdr_cache_get_uint32 (trailer + 4);
+  descriptors_count = ((uint16_t)trailer[8] & 0xFF);
+  descriptors_count |= ((uint16_t)trailer[9] & 0xFF) << 8;
+  descriptor_len = ((uint16_t)trailer[10] & 0xFF);
+  descriptor_len |= ((uint16_t)trailer[11] & 0xFF) << 8;
+  memcpy (&descriptor_byte_order, trailer + 12, 4);
+
+  if (records_end_offset < ctx->records_start_offset
+      || records_end_offset > descriptors_offset
+      || descriptors_offset > trailer_offset
+      || ((off_t)descriptors_count * descriptor_len) > (trailer_offset - descriptors_offset))
+    {
+      SDR_SET_ERRNUM (ctx, IPMI_SDR_ERR_CACHE_INVALID);
+      return (-1);
+    }
+
+  ctx->records_end_offset = records_end_offset;
+
+  if (descriptors_count
+      && descriptor_len == sizeof (struct ipmi_sdr_cache_descriptor)
+      && descriptor_byte_order == IPMI_SDR_CACHE_DESCRIPTOR_BYTE_ORDER
+      && !(descriptors_offset % IPMI_SDR_CACHE_DESCRIPTOR_ALIGNMENT))
+    {
+      ctx->descriptors = (const struct ipmi_sdr_cache_descriptor *)(ctx->sdr_cache + descriptors_offset);
+      ctx->descriptors_count = descriptors_count;
+    }
+
+  return (0);
+}
+
 int
 ipmi_sdr_cache_open (ipmi_sdr_ctx_t ctx,
                      ipmi_ctx_t ipmi_ctx,
@@ -82,6 +165,7 @@ ipmi_sdr_cache_open (ipmi_sdr_ctx_t ctx,
   char most_recent_addition_timestamp_buf[4];
   char most_recent_erase_timestamp_buf[4];
   struct stat stat_buf;
+  int version_1_2, version_2_0;
 
   if (!ctx || ctx->magic != IPMI_SDR_CTX_MAGIC)
     {
@@ -164,14 +248,22 @@ ipmi_sdr_cache_open (ipmi_sdr_ctx_t ctx,
       goto cleanup;
     }
 
+  version_1_2 = ((uint8_t)sdr_cache_version_buf[0] == IPMI_SDR_CACHE_FILE_VERSION_1_2_0
+                 && (uint8_t)sdr_cache_version_buf[1] == IPMI_SDR_CACHE_FILE_VERSION_1_2_1
+                 && (uint8_t)sdr_cache_version_buf[2] == IPMI_SDR_CACHE_FILE_VERSION_1_2_2
+                 && (uint8_t)sdr_cache_version_buf[3] == IPMI_SDR_CACHE_FILE_VERSION_1_2_3);
+
+  version_2_0 = ((uint8_t)sdr_cache_version_buf[0] == IPMI_SDR_CACHE_FILE_VERSION_2_0_0
+                 && (uint8_t)sdr_cache_version_buf[1] == IPMI_SDR_CACHE_FILE_VERSION_2_0_1
+                 && (uint8_t)sdr_cache_version_buf[2] == IPMI_SDR_CACHE_FILE_VERSION_2_0_2
+                 && (uint8_t)sdr_cache_version_buf[3] == IPMI_SDR_CACHE_FILE_VERSION_2_0_3);
+
   if (((uint8_t)sdr_cache_version_buf[0] != IPMI_SDR_CACHE_FILE_VERSION_1_0
        || (uint8_t)sdr_cache_version_buf[1] != IPMI_SDR_CACHE_FILE_VERSION_1_1
        || (uint8_t)sdr_cache_version_buf[2] != IPMI_SDR_CACHE_FILE_VERSION_1_2
        || (uint8_t)sdr_cache_version_buf[3] != IPMI_SDR_CACHE_FILE_VERSION_1_3)
-      && ((uint8_t)sdr_cache_version_buf[0] != IPMI_SDR_CACHE_FILE_VERSION_1_2_0
-          || (uint8_t)sdr_cache_version_buf[1] != IPMI_SDR_CACHE_FILE_VERSION_1_2_1
-          || (uint8_t)sdr_cache_version_buf[2] != IPMI_SDR_CACHE_FILE_VERSION_1_2_2
-          || (uint8_t)sdr_cache_version_buf[3] != IPMI_SDR_CACHE_FILE_VERSION_1_2_3))
+      && !version_1_2
+      && !version_2_0)
     {
       SDR_SET_ERRNUM (ctx, IPMI_SDR_ERR_CACHE_INVALID);
       goto cleanup;
@@ -208,10 +300,7 @@ ipmi_sdr_cache_open (ipmi_sdr_ctx_t ctx,
         }
     }
 
-  if ((uint8_t)sdr_cache_version_buf[0] == IPMI_SDR_CACHE_FILE_VERSION_1_2_0
-      && (uint8_t)sdr_cache_version_buf[1] == IPMI_SDR_CACHE_FILE_VERSION_1_2_1
-      && (uint8_t)sdr_cache_version_buf[2] == IPMI_SDR_CACHE_FILE_VERSION_1_2_2
-      && (uint8_t)sdr_cache_version_buf[3] == IPMI_SDR_CACHE_FILE_VERSION_1_2_3)
+  if (version_1_2 || version_2_0)
     {
       uint8_t header_checksum_buf[512];
       unsigned int header_checksum_buf_len = 0;
@@ -230,7 +319,10 @@ ipmi_sdr_cache_open (ipmi_sdr_ctx_t ctx,
        */
 
       header_bytes_len = 4 + 4 + 1 + 2 + 4 + 4 + 1;
-      trailer_bytes_len = 4 + 1;
+      if (version_2_0)
+        trailer_bytes_len = IPMI_SDR_CACHE_FILE_VERSION_2_0_TRAILER_LENGTH;
+      else
+        trailer_bytes_len = 4 + 1;
 
       if (ctx->file_size < (header_bytes_len + trailer_bytes_len))
         {
@@ -287,7 +379,13 @@ ipmi_sdr_cache_open (ipmi_sdr_ctx_t ctx,
           goto cleanup;
         }
 
-      ctx->records_end_offset = ctx->file_size - trailer_bytes_len;
+      if (version_2_0)
+        {
+          if (_sdr_cache_descriptors_read (ctx, trailer_bytes_len) < 0)
+            goto cleanup;
+        }
+      else
+        ctx->records_end_offset = ctx->file_size - trailer_bytes_len;
     }
   else /* (uint8_t)sdr_cache_version_buf[0] == IPMI_SDR_CACHE_FILE_VERSION_1_0
           && (uint8_t)sdr_cache_version_buf[1] == IPMI_SDR_CACHE_FILE_VERSION_1_1
@@ -295,7 +393,18 @@ ipmi_sdr_cache_open (ipmi_sdr_ctx_t ctx,
           && (uint8_t)sdr_cache_version_buf[3] == IPMI_SDR_CACHE_FILE_VERSION_1_3 */
     ctx->records_end_offset = ctx->file_size;
 
-  _sdr_set_current_offset (ctx, ctx->records_start_offset);
+  if (sdr_cache_index_build (ctx) < 0)
+    goto cleanup;
+
+  /* paranoia, descriptor table does not match the records */
+  if (ctx->descriptors
+      && ctx->descriptors_count != ctx->record_offsets_count)
+    {
+      ctx->descriptors = NULL;
+      ctx->descriptors_count = 0;
+    }
+
+  _sdr_set_current_position (ctx, 0);
   ctx->operation = IPMI_SDR_OPERATION_READ_CACHE;
   ctx->errnum = IPMI_SDR_ERR_SUCCESS;
   return (0);
@@ -307,6 +416,7 @@ ipmi_sdr_cache_open (ipmi_sdr_ctx_t ctx,
   /* ignore potential error, cleanup path */
   if (ctx->sdr_cache)
     munmap ((void *)ctx->sdr_cache, ctx->file_size);
+  sdr_cache_index_destroy (ctx);
   sdr_init_ctx (ctx);
   return (-1);
 }
@@ -430,7 +540,7 @@ ipmi_sdr_cache_first (ipmi_sdr_ctx_t ctx)
       return (-1);
     }
 
-  _sdr_set_current_offset (ctx, ctx->records_start_offset);
+  _sdr_set_current_position (ctx, 0);
 
   ctx->errnum = IPMI_SDR_ERR_SUCCESS;
   return (0);
@@ -439,8 +549,6 @@ ipmi_sdr_cache_first (ipmi_sdr_ctx_t ctx)
 int
 ipmi_sdr_cache_next (ipmi_sdr_ctx_t ctx)
 {
-  unsigned int record_length;
-
   if (!ctx || ctx->magic != IPMI_SDR_CTX_MAGIC)
     {
       ERR_TRACE (ipmi_sdr_ctx_errormsg (ctx), ipmi_sdr_ctx_errnum (ctx));
@@ -453,12 +561,10 @@ ipmi_sdr_cache_next (ipmi_sdr_ctx_t ctx)
       return (-1);
     }
 
-  record_length = (uint8_t)((ctx->sdr_cache + ctx->current_offset.offset)[IPMI_SDR_RECORD_LENGTH_INDEX]);
-
-  if ((ctx->current_offset.offset + record_length + IPMI_SDR_RECORD_HEADER_LENGTH) >= ctx->records_end_offset)
+  if ((ctx->current_offset.position + 1) >= ctx->record_offsets_count)
     return (0);
 
-  _sdr_set_current_offset (ctx, ctx->current_offset.offset + IPMI_SDR_RECORD_HEADER_LENGTH + record_length);
+  _sdr_set_current_position (ctx, ctx->current_offset.position + 1);
 
   ctx->errnum = IPMI_SDR_ERR_SUCCESS;
   return (1);
@@ -467,9 +573,6 @@ ipmi_sdr_cache_next (ipmi_sdr_ctx_t ctx)
 int
 ipmi_sdr_cache_seek (ipmi_sdr_ctx_t ctx, unsigned int index)
 {
-  off_t offset;
-  unsigned int i;
-
   if (!ctx || ctx->magic != IPMI_SDR_CTX_MAGIC)
     {
       ERR_TRACE (ipmi_sdr_ctx_errormsg (ctx), ipmi_sdr_ctx_errnum (ctx));
@@ -488,21 +591,7 @@ ipmi_sdr_cache_seek (ipmi_sdr_ctx_t ctx, unsigned int index)
       return (-1);
     }
 
-  offset = ctx->records_start_offset;
-  for (i = 0; i < index; i++)
-    {
-      unsigned int record_length;
-
-      record_length = (uint8_t)((ctx->sdr_cache + offset)[IPMI_SDR_RECORD_LENGTH_INDEX]);
-
-      if ((offset + record_length + IPMI_SDR_RECORD_HEADER_LENGTH) >= ctx->records_end_offset)
-        break;
-
-      offset += IPMI_SDR_RECORD_HEADER_LENGTH;
-      offset += record_length;
-    }
-
-  _sdr_set_current_offset (ctx, offset);
+  _sdr_set_current_position (ctx, index);
 
   ctx->errnum = IPMI_SDR_ERR_SUCCESS;
   return (0);
@@ -511,8 +600,7 @@ ipmi_sdr_cache_seek (ipmi_sdr_ctx_t ctx, unsigned int index)
 int
 ipmi_sdr_cache_search_record_id (ipmi_sdr_ctx_t ctx, uint16_t record_id)
 {
-  off_t offset;
-  int found = 0;
+  unsigned int position;
 
   if (!ctx || ctx->magic != IPMI_SDR_CTX_MAGIC)
     {
@@ -526,39 +614,14 @@ ipmi_sdr_cache_search_record_id (ipmi_sdr_ctx_t ctx, uint16_t record_id)
       return (-1);
     }
 
-  offset = ctx->records_start_offset;
-  while (offset < ctx->records_end_offset)
-    {
-      uint8_t *ptr = ctx->sdr_cache + offset;
-      uint16_t record_id_current;
-      unsigned int record_length;
-
-      /* Record ID stored little-endian */
-      record_id_current = (uint16_t)ptr[IPMI_SDR_RECORD_ID_INDEX_LS] & 0xFF;
-      record_id_current |= ((uint16_t)ptr[IPMI_SDR_RECORD_ID_INDEX_MS] & 0xFF) << 8;
-
-      if (record_id == record_id_current)
-        {
-          found++;
-          _sdr_set_current_offset (ctx, offset);
-          break;
-        }
-
-      record_length = (uint8_t)((ctx->sdr_cache + offset)[IPMI_SDR_RECORD_LENGTH_INDEX]);
-
-      if ((offset + record_length + IPMI_SDR_RECORD_HEADER_LENGTH) >= ctx->records_end_offset)
-        break;
-
-      offset += IPMI_SDR_RECORD_HEADER_LENGTH;
-      offset += record_length;
-    }
-
-  if (!found)
+  if (!sdr_cache_index_record_id (ctx, record_id, &position))
     {
       SDR_SET_ERRNUM (ctx, IPMI_SDR_ERR_NOT_FOUND);
       return (-1);
     }
 
+  _sdr_set_current_position (ctx, position);
+
   ctx->errnum = IPMI_SDR_ERR_SUCCESS;
   return (0);
 }
@@ -566,8 +629,7 @@ ipmi_sdr_cache_search_record_id (ipmi_sdr_ctx_t ctx, uint16_t record_id)
 int
 ipmi_sdr_cache_search_sensor (ipmi_sdr_ctx_t ctx, uint8_t sensor_number, uint8_t sensor_owner_id)
 {
-  off_t offset;
-  int found = 0;
+  unsigned int position;
 
   if (!ctx || ctx->magic != IPMI_SDR_CTX_MAGIC)
     {
@@ -581,87 +643,14 @@ ipmi_sdr_cache_search_sensor (ipmi_sdr_ctx_t ctx, uint8_t sensor_number, uint8_t
       return (-1);
     }
 
-  offset = ctx->records_start_offset;
-  while (offset < ctx->records_end_offset)
-    {
-      uint8_t *ptr = ctx->sdr_cache + offset;
-      uint8_t record_type_current;
-      unsigned int record_length;
-
-      record_type_current = ptr[IPMI_SDR_RECORD_TYPE_INDEX];
-
-      if (record_type_current == IPMI_SDR_FORMAT_FULL_SENSOR_RECORD
-          || record_type_current == IPMI_SDR_FORMAT_COMPACT_SENSOR_RECORD
-          || record_type_current == IPMI_SDR_FORMAT_EVENT_ONLY_RECORD)
-        {
-          uint8_t sensor_number_current;
-          uint8_t sensor_owner_id_current;
-
-          sensor_owner_id_current = ptr[IPMI_SDR_RECORD_SENSOR_OWNER_ID_INDEX];
-          sensor_number_current = ptr[IPMI_SDR_RECORD_SENSOR_NUMBER_INDEX];
-
-          if (sensor_owner_id_current == sensor_owner_id
-              && sensor_number_current == sensor_number)
-            {
-              found++;
-              _sdr_set_current_offset (ctx, offset);
-              break;
-            }
-
-          /* Compact sensor records can do record sharing, so check
-           * for this case if the sensor_owner_id matches up.
-           */
-          if (sensor_owner_id_current == sensor_owner_id
-              && (record_type_current == IPMI_SDR_FORMAT_COMPACT_SENSOR_RECORD
-                  || record_type_current == IPMI_SDR_FORMAT_EVENT_ONLY_RECORD))
-            {
-              uint8_t share_count;
-
-              if (record_type_current == IPMI_SDR_FORMAT_COMPACT_SENSOR_RECORD)
-                {
-                  share_count = ptr[IPMI_SDR_RECORD_COMPACT_SHARE_COUNT];
-                  share_count &= IPMI_SDR_RECORD_COMPACT_SHARE_COUNT_BITMASK;
-                  share_count >>= IPMI_SDR_RECORD_COMPACT_SHARE_COUNT_SHIFT;
-                }
-              else
-                {
-                  share_count = ptr[IPMI_SDR_RECORD_EVENT_SHARE_COUNT];
-                  share_count &= IPMI_SDR_RECORD_EVENT_SHARE_COUNT_BITMASK;
-                  share_count >>= IPMI_SDR_RECORD_EVENT_SHARE_COUNT_SHIFT;
-                }
-
-              /* IPMI spec gives the following example:
-               *
-               * "If the starting sensor number was 10, and the share
-               * count was 3, then sensors 10, 11, and 12 would share
-               * the record"
-               */
-              if (share_count > 1
-                  && (sensor_number > sensor_number_current
-                      && sensor_number <= (sensor_number_current + (share_count - 1))))
-                {
-                  found++;
-                  _sdr_set_current_offset (ctx, offset);
-                  break;
-                }
-            }
-        }
-
-      record_length = (uint8_t)((ctx->sdr_cache + offset)[IPMI_SDR_RECORD_LENGTH_INDEX]);
-
-      if ((offset + record_length + IPMI_SDR_RECORD_HEADER_LENGTH) >= ctx->records_end_offset)
-        break;
-
-      offset += IPMI_SDR_RECORD_HEADER_LENGTH;
-      offset += record_length;
-    }
-
-  if (!found)
+  if (!sdr_cache_index_sensor (ctx, sensor_number, sensor_owner_id, &position))
     {
       SDR_SET_ERRNUM (ctx, IPMI_SDR_ERR_NOT_FOUND);
       return (-1);
     }
 
+  _sdr_set_current_position (ctx, position);
+
   ctx->errnum = IPMI_SDR_ERR_SUCCESS;
   return (0);
 }
@@ -876,6 +865,7 @@ ipmi_sdr_cache_close (ipmi_sdr_ctx_t ctx)
   /* ignore potential error, cleanup path */
   if (ctx->sdr_cache)
     munmap ((void *)ctx->sdr_cache, ctx->file_size);
+  sdr_cache_index_destroy (ctx);
   sdr_init_ctx (ctx);
 
   ctx->operation = IPMI_SDR_OPERATION_UNINITIALIZED;
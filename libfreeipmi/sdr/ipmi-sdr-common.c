@@ -71,9 +71,19 @@ sdr_init_ctx (ipmi_sdr_ctx_t ctx)
   ctx->records_end_offset = 0;
   ctx->sdr_cache = NULL;
   ctx->current_offset.offset = 0;
+  ctx->current_offset.position = 0;
   ctx->current_offset.offset_dumped = 0;
   ctx->callback_lock = 0;
 
+  ctx->record_offsets = NULL;
+  ctx->record_offsets_count = 0;
+  ctx->record_id_index = NULL;
+  ctx->record_id_index_size = 0;
+  ctx->sensor_index = NULL;
+  ctx->sensor_index_size = 0;
+  ctx->descriptors = NULL;
+  ctx->descriptors_count = 0;
+
   ctx->stats_compiled = 0;
   memset (ctx->entity_counts,
           '\0',
@@ -193,20 +203,14 @@ sdr_record_type_str (ipmi_sdr_ctx_t ctx,
   if (sdr_record_len < sdr_record_header_len)
     goto cleanup;
 
-  if (!(obj_sdr_record_header = fiid_obj_create (tmpl_sdr_record_header)))
+  if (!(obj_sdr_record_header = fiid_obj_view_create (tmpl_sdr_record_header,
+                                                      sdr_record,
+                                                      sdr_record_header_len)))
     {
       SDR_ERRNO_TO_SDR_ERRNUM (ctx, errno);
       goto cleanup;
     }
 
-  if (fiid_obj_set_all (obj_sdr_record_header,
-                        sdr_record,
-                        sdr_record_header_len) < 0)
-    {
-      SDR_FIID_OBJECT_ERROR_TO_SDR_ERRNUM (ctx, obj_sdr_record_header);
-      goto cleanup;
-    }
-
   if (FIID_OBJ_GET (obj_sdr_record_header,
                     "record_type",
                     &val) < 0)
@@ -303,3 +307,61 @@ sdr_check_read_status (ipmi_sdr_ctx_t ctx)
       ctx->current_offset.offset_dumped = 1;
     }
 }
+
+int
+sdr_cache_record_get (ipmi_sdr_ctx_t ctx,
+                      const void **sdr_record,
+                      unsigned int *sdr_record_len)
+{
+  unsigned int record_length;
+
+  assert (ctx);
+  assert (ctx->magic == IPMI_SDR_CTX_MAGIC);
+  assert (sdr_record);
+  assert (sdr_record_len);
+
+  if (ctx->operation != IPMI_SDR_OPERATION_READ_CACHE)
+    {
+      SDR_SET_ERRNUM (ctx, IPMI_SDR_ERR_CACHE_READ_INITIALIZATION);
+      return (-1);
+    }
+
+  record_length = (uint8_t)((ctx->sdr_cache + ctx->current_offset.offset)[IPMI_SDR_RECORD_LENGTH_INDEX]);
+
+  sdr_check_read_status (ctx);
+
+  (*sdr_record) = ctx->sdr_cache + ctx->current_offset.offset;
+  (*sdr_record_len) = record_length + IPMI_SDR_RECORD_HEADER_LENGTH;
+  ctx->errnum = IPMI_SDR_ERR_SUCCESS;
+  return (0);
+}
+
+const struct ipmi_sdr_cache_descriptor *
+sdr_cache_descriptor_get (ipmi_sdr_ctx_t ctx)
+{
+  const struct ipmi_sdr_cache_descriptor *descriptor;
+  const uint8_t *ptr;
+  uint16_t record_id;
+
+  assert (ctx);
+  assert (ctx->magic == IPMI_SDR_CTX_MAGIC);
+
+  if (ctx->operation != IPMI_SDR_OPERATION_READ_CACHE
+      || !ctx->descriptors
+      || ctx->current_offset.position >= ctx->descriptors_count)
+    return (NULL);
+
+  descriptor = &ctx->descriptors[ctx->current_offset.position];
+  ptr = ctx->sdr_cache + ctx->current_offset.offset;
+
+  /* Record ID stored little-endian */
+  record_id = (uint16_t)ptr[IPMI_SDR_RECORD_ID_INDEX_LS] & 0xFF;
+  record_id |= ((uint16_t)ptr[IPMI_SDR_RECORD_ID_INDEX_MS] & 0xFF) << 8;
+
+  /* paranoia, descriptor table does not match the records */
+  if (descriptor->record_id != record_id
+      || descriptor->record_type != ptr[IPMI_SDR_RECORD_TYPE_INDEX])
+    return (NULL);
+
+  return (descriptor);
+}
@@ -50,4 +50,16 @@ const char *sdr_record_type_str (ipmi_sdr_ctx_t ctx,
 
 void sdr_check_read_status (ipmi_sdr_ctx_t ctx);
 
+/* Returns pointer to the current record within the mapped cache, the
+ * record is valid until the cache is closed.
+ */
+int sdr_cache_record_get (ipmi_sdr_ctx_t ctx,
+                          const void **sdr_record,
+                          unsigned int *sdr_record_len);
+
+/* Returns the descriptor of the current record if the cache has
+ * descriptors, NULL otherwise.
+ */
+const struct ipmi_sdr_cache_descriptor *sdr_cache_descriptor_get (ipmi_sdr_ctx_t ctx);
+
 #endif /* IPMI_SDR_COMMON_H */
@@ -39,6 +39,7 @@
 #endif /* HAVE_UNISTD_H */
 
 #include "freeipmi/sdr/ipmi-sdr.h"
+#include "freeipmi/record-format/ipmi-sdr-record-format.h"
 
 #include "list.h"
 
@@ -118,14 +119,120 @@
 #define IPMI_SDR_CACHE_FILE_VERSION_1_2_2 0x00
 #define IPMI_SDR_CACHE_FILE_VERSION_1_2_3 0x02
 
+/* Cache Version 2.0 format
+ *
+ * magic bytes (4 bytes)
+ * version bytes (4)
+ * sdr version (1)
+ * record count (2)
+ * most recent addition timestamp (4)
+ * most recent erase timestamp (4)
+ * header checksum (1) [all bytes above]
+ * records (variable)
+ * padding (variable) [descriptors start aligned to IPMI_SDR_CACHE_DESCRIPTOR_ALIGNMENT]
+ * descriptors (variable) [one per record, in record order]
+ * records end offset (4)
+ * descriptors offset (4)
+ * descriptors count (2)
+ * descriptor length (2)
+ * descriptor byte order (4) [IPMI_SDR_CACHE_DESCRIPTOR_BYTE_ORDER in host order]
+ * total bytes of file (4)
+ * trailer checksum (1) [records through total bytes of file]
+ *
+ * Descriptors are stored in host byte order.  A reader whose byte
+ * order or descriptor layout differs ignores them and parses the raw
+ * records, so the file remains usable.
+ */
+
+#define IPMI_SDR_CACHE_FILE_VERSION_2_0_0 0x00
+#define IPMI_SDR_CACHE_FILE_VERSION_2_0_1 0x02
+#define IPMI_SDR_CACHE_FILE_VERSION_2_0_2 0x00
+#define IPMI_SDR_CACHE_FILE_VERSION_2_0_3 0x00
+
+#define IPMI_SDR_CACHE_FILE_VERSION_2_0_TRAILER_LENGTH 21
+
+#define IPMI_SDR_CACHE_DESCRIPTOR_ALIGNMENT  64
+#define IPMI_SDR_CACHE_DESCRIPTOR_BYTE_ORDER 0x01020304
+
+/* Descriptor flags, set if the parse of the fields succeeded when the
+ * cache was created.  Parsing fields without their flag set falls
+ * back to the raw record.
+ */
+#define IPMI_SDR_CACHE_DESCRIPTOR_SENSOR_OWNER_ID          0x0001
+#define IPMI_SDR_CACHE_DESCRIPTOR_SENSOR_OWNER_LUN         0x0002
+#define IPMI_SDR_CACHE_DESCRIPTOR_SENSOR_NUMBER            0x0004
+#define IPMI_SDR_CACHE_DESCRIPTOR_ENTITY_ID_INSTANCE_TYPE  0x0008
+#define IPMI_SDR_CACHE_DESCRIPTOR_SENSOR_TYPE              0x0010
+#define IPMI_SDR_CACHE_DESCRIPTOR_EVENT_READING_TYPE_CODE  0x0020
+#define IPMI_SDR_CACHE_DESCRIPTOR_ID_STRING                0x0040
+#define IPMI_SDR_CACHE_DESCRIPTOR_SENSOR_UNITS             0x0080
+#define IPMI_SDR_CACHE_DESCRIPTOR_SENSOR_DECODING_DATA     0x0100
+#define IPMI_SDR_CACHE_DESCRIPTOR_THRESHOLDS_RAW           0x0200
+#define IPMI_SDR_CACHE_DESCRIPTOR_HYSTERESIS               0x0400
+#define IPMI_SDR_CACHE_DESCRIPTOR_SENSOR_RECORD_SHARING    0x0800
+
 #define IPMI_MAX_ENTITY_IDS          256
 #define IPMI_MAX_ENTITY_ID_INSTANCES 256
 
 struct ipmi_sdr_offset {
   off_t offset;
+  unsigned int position;
   int offset_dumped;
 };
 
+/* Fields as returned by the ipmi_sdr_parse functions, laid out to be
+ * exactly IPMI_SDR_CACHE_DESCRIPTOR_ALIGNMENT bytes.
+ */
+struct ipmi_sdr_cache_descriptor {
+  uint16_t record_id;
+  uint16_t flags;
+  uint8_t record_type;
+  uint8_t sensor_owner_id_type;
+  uint8_t sensor_owner_id;
+  uint8_t sensor_owner_lun;
+  uint8_t channel_number;
+  uint8_t sensor_number;
+  uint8_t entity_id;
+  uint8_t entity_instance;
+  uint8_t entity_instance_type;
+  uint8_t sensor_type;
+  uint8_t event_reading_type_code;
+  uint8_t sensor_units_percentage;
+  uint8_t sensor_units_modifier;
+  uint8_t sensor_units_rate;
+  uint8_t sensor_base_unit_type;
+  uint8_t sensor_modifier_unit_type;
+  int8_t r_exponent;
+  int8_t b_exponent;
+  uint8_t linearization;
+  uint8_t analog_data_format;
+  int16_t m;
+  int16_t b;
+  uint8_t lower_non_critical_threshold;
+  uint8_t lower_critical_threshold;
+  uint8_t lower_non_recoverable_threshold;
+  uint8_t upper_non_critical_threshold;
+  uint8_t upper_critical_threshold;
+  uint8_t upper_non_recoverable_threshold;
+  uint8_t positive_going_threshold_hysteresis;
+  uint8_t negative_going_threshold_hysteresis;
+  uint8_t share_count;
+  uint8_t id_string_instance_modifier_type;
+  uint8_t id_string_instance_modifier_offset;
+  uint8_t entity_instance_sharing;
+  uint8_t id_string_len;
+  char id_string[IPMI_SDR_MAX_ID_STRING_LENGTH];
+  uint8_t reserved[7];
+};
+
+/* Open addressed hash slot for the cache index, position is the
+ * record position + 1, 0 marks an empty slot.
+ */
+struct ipmi_sdr_index_entry {
+  uint16_t key;
+  unsigned int position;
+};
+
 struct ipmi_sdr_entity_count {
   uint8_t entity_instances[IPMI_MAX_ENTITY_ID_INSTANCES];
   unsigned int entity_instances_count;
@@ -152,6 +259,23 @@ struct ipmi_sdr_ctx {
   struct ipmi_sdr_offset current_offset;
   int callback_lock;
 
+  /* Cache Index Vars - built on open */
+  off_t *record_offsets;
+  unsigned int record_offsets_count;
+  struct ipmi_sdr_index_entry *record_id_index;
+  unsigned int record_id_index_size;
+  struct ipmi_sdr_index_entry *sensor_index;
+  unsigned int sensor_index_size;
+
+  /* v2.0 cache descriptors, within the mapped cache */
+  const struct ipmi_sdr_cache_descriptor *descriptors;
+  unsigned int descriptors_count;
+
+  /* Cache Creation Vars - kept across creations, 0 until partial
+   * reads are needed by a pipelined download
+   */
+  unsigned int bytes_to_read;
+
   /* for saving/reset */
   List saved_offsets;
 
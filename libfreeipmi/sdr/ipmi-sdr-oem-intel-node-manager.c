@@ -63,11 +63,9 @@ ipmi_sdr_oem_parse_intel_node_manager (ipmi_sdr_ctx_t ctx,
                                        uint8_t *nm_operational_capabilities_sensor_number,
                                        uint8_t *nm_alert_threshold_exceeded_sensor_number)
 {
-  uint8_t sdr_record_buf[IPMI_SDR_MAX_RECORD_LENGTH];
-  int sdr_record_buf_len;
   fiid_obj_t obj_oem_record = NULL;
   int expected_record_len;
-  void *sdr_record_to_use;
+  const void *sdr_record_to_use;
   unsigned int sdr_record_len_to_use;
   uint64_t val;
   int rv = -1;
@@ -84,15 +82,13 @@ ipmi_sdr_oem_parse_intel_node_manager (ipmi_sdr_ctx_t ctx,
           && !sdr_record
           && !sdr_record_len)
         {
-          if ((sdr_record_buf_len = ipmi_sdr_cache_record_read (ctx,
-                                                                sdr_record_buf,
-                                                                IPMI_SDR_MAX_RECORD_LENGTH)) < 0)
+          if (sdr_cache_record_get (ctx,
+                                    &sdr_record_to_use,
+                                    &sdr_record_len_to_use) < 0)
             {
               SDR_SET_INTERNAL_ERRNUM (ctx);
               return (-1);
             }
-          sdr_record_to_use = sdr_record_buf;
-          sdr_record_len_to_use = sdr_record_buf_len;
         }
       else
         {
@@ -102,7 +98,7 @@ ipmi_sdr_oem_parse_intel_node_manager (ipmi_sdr_ctx_t ctx,
     }
   else
     {
-      sdr_record_to_use = (void *)sdr_record;
+      sdr_record_to_use = sdr_record;
       sdr_record_len_to_use = sdr_record_len;
     }
 
@@ -118,20 +114,14 @@ ipmi_sdr_oem_parse_intel_node_manager (ipmi_sdr_ctx_t ctx,
       goto cleanup;
     }
 
-  if (!(obj_oem_record = fiid_obj_create (tmpl_sdr_oem_intel_node_manager_record)))
+  if (!(obj_oem_record = fiid_obj_view_create (tmpl_sdr_oem_intel_node_manager_record,
+                                               sdr_record_to_use,
+                                               expected_record_len)))
     {
       SDR_ERRNO_TO_SDR_ERRNUM (ctx, errno);
       goto cleanup;
     }
 
-  if (fiid_obj_set_all (obj_oem_record,
-                        sdr_record_to_use,
-                        expected_record_len) < 0)
-    {
-      SDR_FIID_OBJECT_ERROR_TO_SDR_ERRNUM (ctx, obj_oem_record);
-      goto cleanup;
-    }
-
   /* achu: Node Manager documentation states that OEM ID in the
    * SDR record should be Intel's, but I've seen motherboards w/o
    * it, so don't bother checking.
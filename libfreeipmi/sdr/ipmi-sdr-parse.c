@@ -34,6 +34,7 @@
 #include "freeipmi/sdr/ipmi-sdr.h"
 
 #include "freeipmi/fiid/fiid.h"
+#include "freeipmi/fiid/fiid-field-index.h"
 #include "freeipmi/record-format/ipmi-sdr-record-format.h"
 #include "freeipmi/spec/ipmi-sensor-units-spec.h"
 #include "freeipmi/spec/ipmi-event-reading-type-code-spec.h"
@@ -60,6 +61,42 @@
 #define IPMI_SDR_PARSE_RECORD_TYPE_BMC_MESSAGE_CHANNEL_INFO_RECORD             0x0200
 #define IPMI_SDR_PARSE_RECORD_TYPE_OEM_RECORD                                  0x0400
 
+/* Fields at identical positions in the full, compact and event only
+ * sensor record templates.
+ */
+#define IPMI_SDR_PARSE_SENSOR_RECORD_SENSOR_OWNER_ID_TYPE TMPL_SDR_FULL_SENSOR_RECORD_SENSOR_OWNER_ID_TYPE
+#define IPMI_SDR_PARSE_SENSOR_RECORD_SENSOR_OWNER_ID      TMPL_SDR_FULL_SENSOR_RECORD_SENSOR_OWNER_ID
+#define IPMI_SDR_PARSE_SENSOR_RECORD_SENSOR_OWNER_LUN     TMPL_SDR_FULL_SENSOR_RECORD_SENSOR_OWNER_LUN
+#define IPMI_SDR_PARSE_SENSOR_RECORD_CHANNEL_NUMBER       TMPL_SDR_FULL_SENSOR_RECORD_CHANNEL_NUMBER
+#define IPMI_SDR_PARSE_SENSOR_RECORD_SENSOR_NUMBER        TMPL_SDR_FULL_SENSOR_RECORD_SENSOR_NUMBER
+
+/* Returns the descriptor of the current cache record, if the caller
+ * is parsing the current record of a cache holding descriptors with
+ * all the given fields.
+ */
+static const struct ipmi_sdr_cache_descriptor *
+_sdr_cache_descriptor (ipmi_sdr_ctx_t ctx,
+                       const void *sdr_record,
+                       unsigned int sdr_record_len,
+                       uint16_t descriptor_flags)
+{
+  const struct ipmi_sdr_cache_descriptor *descriptor;
+
+  if (!ctx
+      || ctx->magic != IPMI_SDR_CTX_MAGIC
+      || ctx->operation != IPMI_SDR_OPERATION_READ_CACHE
+      || sdr_record
+      || sdr_record_len)
+    return (NULL);
+
+  if (!(descriptor = sdr_cache_descriptor_get (ctx))
+      || (descriptor->flags & descriptor_flags) != descriptor_flags)
+    return (NULL);
+
+  sdr_check_read_status (ctx);
+  return (descriptor);
+}
+
 int
 ipmi_sdr_parse_record_id_and_type (ipmi_sdr_ctx_t ctx,
                                    const void *sdr_record,
@@ -67,15 +104,27 @@ ipmi_sdr_parse_record_id_and_type (ipmi_sdr_ctx_t ctx,
                                    uint16_t *record_id,
                                    uint8_t *record_type)
 {
-  uint8_t sdr_record_buf[IPMI_SDR_MAX_RECORD_LENGTH];
-  int sdr_record_buf_len;
+  const struct ipmi_sdr_cache_descriptor *descriptor;
   fiid_obj_t obj_sdr_record_header = NULL;
   int sdr_record_header_len;
-  void *sdr_record_to_use;
+  const void *sdr_record_to_use;
   unsigned int sdr_record_len_to_use;
   uint64_t val;
   int rv = -1;
 
+  if ((descriptor = _sdr_cache_descriptor (ctx,
+                                           sdr_record,
+                                           sdr_record_len,
+                                           0)))
+    {
+      if (record_id)
+        *record_id = descriptor->record_id;
+      if (record_type)
+        *record_type = descriptor->record_type;
+      ctx->errnum = IPMI_SDR_ERR_SUCCESS;
+      return (0);
+    }
+
   if (!ctx || ctx->magic != IPMI_SDR_CTX_MAGIC)
     {
       ERR_TRACE (ipmi_sdr_ctx_errormsg (ctx), ipmi_sdr_ctx_errnum (ctx));
@@ -88,15 +137,13 @@ ipmi_sdr_parse_record_id_and_type (ipmi_sdr_ctx_t ctx,
           && !sdr_record
           && !sdr_record_len)
         {
-          if ((sdr_record_buf_len = ipmi_sdr_cache_record_read (ctx,
-                                                                sdr_record_buf,
-                                                                IPMI_SDR_MAX_RECORD_LENGTH)) < 0)
+          if (sdr_cache_record_get (ctx,
+                                    &sdr_record_to_use,
+                                    &sdr_record_len_to_use) < 0)
             {
               SDR_SET_INTERNAL_ERRNUM (ctx);
               return (-1);
             }
-          sdr_record_to_use = sdr_record_buf;
-          sdr_record_len_to_use = sdr_record_buf_len;
         }
       else
         {
@@ -106,7 +153,7 @@ ipmi_sdr_parse_record_id_and_type (ipmi_sdr_ctx_t ctx,
     }
   else
     {
-      sdr_record_to_use = (void *)sdr_record;
+      sdr_record_to_use = sdr_record;
       sdr_record_len_to_use = sdr_record_len;
     }
 
@@ -122,25 +169,19 @@ ipmi_sdr_parse_record_id_and_type (ipmi_sdr_ctx_t ctx,
       goto cleanup;
     }
 
-  if (!(obj_sdr_record_header = fiid_obj_create (tmpl_sdr_record_header)))
+  if (!(obj_sdr_record_header = fiid_obj_view_create (tmpl_sdr_record_header,
+                                                      sdr_record_to_use,
+                                                      sdr_record_header_len)))
     {
       SDR_ERRNO_TO_SDR_ERRNUM (ctx, errno);
       goto cleanup;
     }
 
-  if (fiid_obj_set_all (obj_sdr_record_header,
-                        sdr_record_to_use,
-                        sdr_record_header_len) < 0)
-    {
-      SDR_FIID_OBJECT_ERROR_TO_SDR_ERRNUM (ctx, obj_sdr_record_header);
-      goto cleanup;
-    }
-
   if (record_id)
     {
-      if (FIID_OBJ_GET (obj_sdr_record_header,
-                        "record_id",
-                        &val) < 0)
+      if (FIID_OBJ_GET_IDX (obj_sdr_record_header,
+                            TMPL_SDR_RECORD_HEADER_RECORD_ID,
+                            &val) < 0)
         {
           SDR_FIID_OBJECT_ERROR_TO_SDR_ERRNUM (ctx, obj_sdr_record_header);
           goto cleanup;
@@ -150,9 +191,9 @@ ipmi_sdr_parse_record_id_and_type (ipmi_sdr_ctx_t ctx,
 
   if (record_type)
     {
-      if (FIID_OBJ_GET (obj_sdr_record_header,
-                        "record_type",
-                        &val) < 0)
+      if (FIID_OBJ_GET_IDX (obj_sdr_record_header,
+                            TMPL_SDR_RECORD_HEADER_RECORD_TYPE,
+                            &val) < 0)
         {
           SDR_FIID_OBJECT_ERROR_TO_SDR_ERRNUM (ctx, obj_sdr_record_header);
           goto cleanup;
@@ -175,14 +216,23 @@ _sdr_record_get_common (ipmi_sdr_ctx_t ctx,
                         unsigned int sdr_record_len,
                         uint32_t acceptable_record_types)
 {
-  uint8_t sdr_record_buf[IPMI_SDR_MAX_RECORD_LENGTH];
-  int sdr_record_buf_len;
-  void *sdr_record_to_use;
+  const void *sdr_record_to_use;
   unsigned int sdr_record_len_to_use;
   fiid_obj_t obj_sdr_record = NULL;
+  fiid_field_t *tmpl_sdr_record = NULL;
   uint8_t record_type;
 
   assert (acceptable_record_types);
+  assert (IPMI_SDR_PARSE_SENSOR_RECORD_SENSOR_OWNER_ID_TYPE == TMPL_SDR_COMPACT_SENSOR_RECORD_SENSOR_OWNER_ID_TYPE
+          && IPMI_SDR_PARSE_SENSOR_RECORD_SENSOR_OWNER_ID_TYPE == TMPL_SDR_EVENT_ONLY_RECORD_SENSOR_OWNER_ID_TYPE);
+  assert (IPMI_SDR_PARSE_SENSOR_RECORD_SENSOR_OWNER_ID == TMPL_SDR_COMPACT_SENSOR_RECORD_SENSOR_OWNER_ID
+          && IPMI_SDR_PARSE_SENSOR_RECORD_SENSOR_OWNER_ID == TMPL_SDR_EVENT_ONLY_RECORD_SENSOR_OWNER_ID);
+  assert (IPMI_SDR_PARSE_SENSOR_RECORD_SENSOR_OWNER_LUN == TMPL_SDR_COMPACT_SENSOR_RECORD_SENSOR_OWNER_LUN
+          && IPMI_SDR_PARSE_SENSOR_RECORD_SENSOR_OWNER_LUN == TMPL_SDR_EVENT_ONLY_RECORD_SENSOR_OWNER_LUN);
+  assert (IPMI_SDR_PARSE_SENSOR_RECORD_CHANNEL_NUMBER == TMPL_SDR_COMPACT_SENSOR_RECORD_CHANNEL_NUMBER
+          && IPMI_SDR_PARSE_SENSOR_RECORD_CHANNEL_NUMBER == TMPL_SDR_EVENT_ONLY_RECORD_CHANNEL_NUMBER);
+  assert (IPMI_SDR_PARSE_SENSOR_RECORD_SENSOR_NUMBER == TMPL_SDR_COMPACT_SENSOR_RECORD_SENSOR_NUMBER
+          && IPMI_SDR_PARSE_SENSOR_RECORD_SENSOR_NUMBER == TMPL_SDR_EVENT_ONLY_RECORD_SENSOR_NUMBER);
 
   if (!ctx || ctx->magic != IPMI_SDR_CTX_MAGIC)
     {
@@ -196,15 +246,13 @@ _sdr_record_get_common (ipmi_sdr_ctx_t ctx,
           && !sdr_record
           && !sdr_record_len)
         {
-          if ((sdr_record_buf_len = ipmi_sdr_cache_record_read (ctx,
-                                                                sdr_record_buf,
-                                                                IPMI_SDR_MAX_RECORD_LENGTH)) < 0)
+          if (sdr_cache_record_get (ctx,
+                                    &sdr_record_to_use,
+                                    &sdr_record_len_to_use) < 0)
             {
               SDR_SET_INTERNAL_ERRNUM (ctx);
               goto cleanup;
             }
-          sdr_record_to_use = sdr_record_buf;
-          sdr_record_len_to_use = sdr_record_buf_len;
         }
       else
         {
@@ -214,7 +262,7 @@ _sdr_record_get_common (ipmi_sdr_ctx_t ctx,
     }
   else
     {
-      sdr_record_to_use = (void *)sdr_record;
+      sdr_record_to_use = sdr_record;
       sdr_record_len_to_use = sdr_record_len;
     }
 
@@ -258,99 +306,37 @@ _sdr_record_get_common (ipmi_sdr_ctx_t ctx,
     }
 
   if (record_type == IPMI_SDR_FORMAT_FULL_SENSOR_RECORD)
-    {
-      if (!(obj_sdr_record = fiid_obj_create (tmpl_sdr_full_sensor_record)))
-        {
-          SDR_ERRNO_TO_SDR_ERRNUM (ctx, errno);
-          goto cleanup;
-        }
-    }
+    tmpl_sdr_record = tmpl_sdr_full_sensor_record;
   else if (record_type == IPMI_SDR_FORMAT_COMPACT_SENSOR_RECORD)
-    {
-      if (!(obj_sdr_record = fiid_obj_create (tmpl_sdr_compact_sensor_record)))
-        {
-          SDR_ERRNO_TO_SDR_ERRNUM (ctx, errno);
-          goto cleanup;
-        }
-    }
+    tmpl_sdr_record = tmpl_sdr_compact_sensor_record;
   else if (record_type == IPMI_SDR_FORMAT_EVENT_ONLY_RECORD)
-    {
-      if (!(obj_sdr_record = fiid_obj_create (tmpl_sdr_event_only_record)))
-        {
-          SDR_ERRNO_TO_SDR_ERRNUM (ctx, errno);
-          goto cleanup;
-        }
-    }
+    tmpl_sdr_record = tmpl_sdr_event_only_record;
   else if (record_type == IPMI_SDR_FORMAT_ENTITY_ASSOCIATION_RECORD)
-    {
-      if (!(obj_sdr_record = fiid_obj_create (tmpl_sdr_entity_association_record)))
-        {
-          SDR_ERRNO_TO_SDR_ERRNUM (ctx, errno);
-          goto cleanup;
-        }
-    }
+    tmpl_sdr_record = tmpl_sdr_entity_association_record;
   else if (record_type == IPMI_SDR_FORMAT_DEVICE_RELATIVE_ENTITY_ASSOCIATION_RECORD)
-    {
-      if (!(obj_sdr_record = fiid_obj_create (tmpl_sdr_device_relative_entity_association_record)))
-        {
-          SDR_ERRNO_TO_SDR_ERRNUM (ctx, errno);
-          goto cleanup;
-        }
-    }
+    tmpl_sdr_record = tmpl_sdr_device_relative_entity_association_record;
   else if (record_type == IPMI_SDR_FORMAT_GENERIC_DEVICE_LOCATOR_RECORD)
-    {
-      if (!(obj_sdr_record = fiid_obj_create (tmpl_sdr_generic_device_locator_record)))
-        {
-          SDR_ERRNO_TO_SDR_ERRNUM (ctx, errno);
-          goto cleanup;
-        }
-    }
+    tmpl_sdr_record = tmpl_sdr_generic_device_locator_record;
   else if (record_type == IPMI_SDR_FORMAT_FRU_DEVICE_LOCATOR_RECORD)
-    {
-      if (!(obj_sdr_record = fiid_obj_create (tmpl_sdr_fru_device_locator_record)))
-        {
-          SDR_ERRNO_TO_SDR_ERRNUM (ctx, errno);
-          goto cleanup;
-        }
-    }
+    tmpl_sdr_record = tmpl_sdr_fru_device_locator_record;
   else if (record_type == IPMI_SDR_FORMAT_MANAGEMENT_CONTROLLER_DEVICE_LOCATOR_RECORD)
-    {
-      if (!(obj_sdr_record = fiid_obj_create (tmpl_sdr_management_controller_device_locator_record)))
-        {
-          SDR_ERRNO_TO_SDR_ERRNUM (ctx, errno);
-          goto cleanup;
-        }
-    }
+    tmpl_sdr_record = tmpl_sdr_management_controller_device_locator_record;
   else if (record_type == IPMI_SDR_FORMAT_MANAGEMENT_CONTROLLER_CONFIRMATION_RECORD)
-    {
-      if (!(obj_sdr_record = fiid_obj_create (tmpl_sdr_management_controller_confirmation_record)))
-        {
-          SDR_ERRNO_TO_SDR_ERRNUM (ctx, errno);
-          goto cleanup;
-        }
-    }
+    tmpl_sdr_record = tmpl_sdr_management_controller_confirmation_record;
   else if (record_type == IPMI_SDR_FORMAT_BMC_MESSAGE_CHANNEL_INFO_RECORD)
-    {
-      if (!(obj_sdr_record = fiid_obj_create (tmpl_sdr_bmc_message_channel_info_record)))
-        {
-          SDR_ERRNO_TO_SDR_ERRNUM (ctx, errno);
-          goto cleanup;
-        }
-    }
+    tmpl_sdr_record = tmpl_sdr_bmc_message_channel_info_record;
   else if (record_type == IPMI_SDR_FORMAT_OEM_RECORD)
-    {
-      if (!(obj_sdr_record = fiid_obj_create (tmpl_sdr_oem_record)))
-        {
-          SDR_ERRNO_TO_SDR_ERRNUM (ctx, errno);
-          goto cleanup;
-        }
-    }
+    tmpl_sdr_record = tmpl_sdr_oem_record;
 
-  if (fiid_obj_set_all (obj_sdr_record,
-                        sdr_record_to_use,
-                        sdr_record_len_to_use) < 0)
+
+  /* The record is not copied, the object is only used until the
+   * caller returns.
+   */
+  if (!(obj_sdr_record = fiid_obj_view_create (tmpl_sdr_record,
+                                               sdr_record_to_use,
+                                               sdr_record_len_to_use)))
     {
-      SDR_FIID_OBJECT_ERROR_TO_SDR_ERRNUM (ctx, obj_sdr_record);
+      SDR_ERRNO_TO_SDR_ERRNUM (ctx, errno);
       goto cleanup;
     }
 
@@ -363,6 +349,45 @@ _sdr_record_get_common (ipmi_sdr_ctx_t ctx,
   return (NULL);
 }
 
+/* Returns index of a field within the full, compact or event only
+ * sensor record template the object was created from.
+ */
+static int
+_sdr_sensor_record_field_index (ipmi_sdr_ctx_t ctx,
+                                fiid_obj_t obj_sdr_record,
+                                unsigned int full_sensor_record_index,
+                                unsigned int compact_sensor_record_index,
+                                unsigned int event_only_record_index,
+                                unsigned int *index)
+{
+  uint64_t val;
+
+  assert (ctx);
+  assert (ctx->magic == IPMI_SDR_CTX_MAGIC);
+  assert (fiid_obj_valid (obj_sdr_record));
+  assert (index);
+
+  if (FIID_OBJ_GET_IDX (obj_sdr_record,
+                        TMPL_SDR_RECORD_HEADER_RECORD_TYPE,
+                        &val) < 0)
+    {
+      SDR_FIID_OBJECT_ERROR_TO_SDR_ERRNUM (ctx, obj_sdr_record);
+      return (-1);
+    }
+
+  if (val == IPMI_SDR_FORMAT_FULL_SENSOR_RECORD)
+    *index = full_sensor_record_index;
+  else if (val == IPMI_SDR_FORMAT_COMPACT_SENSOR_RECORD)
+    *index = compact_sensor_record_index;
+  else
+    {
+      assert (val == IPMI_SDR_FORMAT_EVENT_ONLY_RECORD);
+      *index = event_only_record_index;
+    }
+
+  return (0);
+}
+
 int
 ipmi_sdr_parse_sensor_owner_id (ipmi_sdr_ctx_t ctx,
                                 const void *sdr_record,
@@ -370,11 +395,25 @@ ipmi_sdr_parse_sensor_owner_id (ipmi_sdr_ctx_t ctx,
                                 uint8_t *sensor_owner_id_type,
                                 uint8_t *sensor_owner_id)
 {
+  const struct ipmi_sdr_cache_descriptor *descriptor;
   fiid_obj_t obj_sdr_record = NULL;
   uint32_t acceptable_record_types;
   uint64_t val;
   int rv = -1;
 
+  if ((descriptor = _sdr_cache_descriptor (ctx,
+                                           sdr_record,
+                                           sdr_record_len,
+                                           IPMI_SDR_CACHE_DESCRIPTOR_SENSOR_OWNER_ID)))
+    {
+      if (sensor_owner_id_type)
+        *sensor_owner_id_type = descriptor->sensor_owner_id_type;
+      if (sensor_owner_id)
+        *sensor_owner_id = descriptor->sensor_owner_id;
+      ctx->errnum = IPMI_SDR_ERR_SUCCESS;
+      return (0);
+    }
+
   acceptable_record_types = IPMI_SDR_PARSE_RECORD_TYPE_FULL_SENSOR_RECORD;
   acceptable_record_types |= IPMI_SDR_PARSE_RECORD_TYPE_COMPACT_SENSOR_RECORD;
   acceptable_record_types |= IPMI_SDR_PARSE_RECORD_TYPE_EVENT_ONLY_RECORD;
@@ -387,9 +426,9 @@ ipmi_sdr_parse_sensor_owner_id (ipmi_sdr_ctx_t ctx,
 
   if (sensor_owner_id_type)
     {
-      if (FIID_OBJ_GET (obj_sdr_record,
-                        "sensor_owner_id.type",
-                        &val) < 0)
+      if (FIID_OBJ_GET_IDX (obj_sdr_record,
+                            IPMI_SDR_PARSE_SENSOR_RECORD_SENSOR_OWNER_ID_TYPE,
+                            &val) < 0)
         {
           SDR_FIID_OBJECT_ERROR_TO_SDR_ERRNUM (ctx, obj_sdr_record);
           goto cleanup;
@@ -399,9 +438,9 @@ ipmi_sdr_parse_sensor_owner_id (ipmi_sdr_ctx_t ctx,
 
   if (sensor_owner_id)
     {
-      if (FIID_OBJ_GET (obj_sdr_record,
-                        "sensor_owner_id",
-                        &val) < 0)
+      if (FIID_OBJ_GET_IDX (obj_sdr_record,
+                            IPMI_SDR_PARSE_SENSOR_RECORD_SENSOR_OWNER_ID,
+                            &val) < 0)
         {
           SDR_FIID_OBJECT_ERROR_TO_SDR_ERRNUM (ctx, obj_sdr_record);
           goto cleanup;
@@ -423,11 +462,25 @@ ipmi_sdr_parse_sensor_owner_lun (ipmi_sdr_ctx_t ctx,
                                  uint8_t *sensor_owner_lun,
                                  uint8_t *channel_number)
 {
+  const struct ipmi_sdr_cache_descriptor *descriptor;
   fiid_obj_t obj_sdr_record = NULL;
   uint32_t acceptable_record_types;
   uint64_t val;
   int rv = -1;
 
+  if ((descriptor = _sdr_cache_descriptor (ctx,
+                                           sdr_record,
+                                           sdr_record_len,
+                                           IPMI_SDR_CACHE_DESCRIPTOR_SENSOR_OWNER_LUN)))
+    {
+      if (sensor_owner_lun)
+        *sensor_owner_lun = descriptor->sensor_owner_lun;
+      if (channel_number)
+        *channel_number = descriptor->channel_number;
+      ctx->errnum = IPMI_SDR_ERR_SUCCESS;
+      return (0);
+    }
+
   acceptable_record_types = IPMI_SDR_PARSE_RECORD_TYPE_FULL_SENSOR_RECORD;
   acceptable_record_types |= IPMI_SDR_PARSE_RECORD_TYPE_COMPACT_SENSOR_RECORD;
   acceptable_record_types |= IPMI_SDR_PARSE_RECORD_TYPE_EVENT_ONLY_RECORD;
@@ -440,9 +493,9 @@ ipmi_sdr_parse_sensor_owner_lun (ipmi_sdr_ctx_t ctx,
 
   if (sensor_owner_lun)
     {
-      if (FIID_OBJ_GET (obj_sdr_record,
-                        "sensor_owner_lun",
-                        &val) < 0)
+      if (FIID_OBJ_GET_IDX (obj_sdr_record,
+                            IPMI_SDR_PARSE_SENSOR_RECORD_SENSOR_OWNER_LUN,
+                            &val) < 0)
         {
           SDR_FIID_OBJECT_ERROR_TO_SDR_ERRNUM (ctx, obj_sdr_record);
           goto cleanup;
@@ -452,9 +505,9 @@ ipmi_sdr_parse_sensor_owner_lun (ipmi_sdr_ctx_t ctx,
 
   if (channel_number)
     {
-      if (FIID_OBJ_GET (obj_sdr_record,
-                        "channel_number",
-                        &val) < 0)
+      if (FIID_OBJ_GET_IDX (obj_sdr_record,
+                            IPMI_SDR_PARSE_SENSOR_RECORD_CHANNEL_NUMBER,
+                            &val) < 0)
         {
           SDR_FIID_OBJECT_ERROR_TO_SDR_ERRNUM (ctx, obj_sdr_record);
           goto cleanup;
@@ -475,11 +528,23 @@ ipmi_sdr_parse_sensor_number (ipmi_sdr_ctx_t ctx,
                               unsigned int sdr_record_len,
                               uint8_t *sensor_number)
 {
+  const struct ipmi_sdr_cache_descriptor *descriptor;
   fiid_obj_t obj_sdr_record = NULL;
   uint32_t acceptable_record_types;
   uint64_t val;
   int rv = -1;
 
+  if ((descriptor = _sdr_cache_descriptor (ctx,
+                                           sdr_record,
+                                           sdr_record_len,
+                                           IPMI_SDR_CACHE_DESCRIPTOR_SENSOR_NUMBER)))
+    {
+      if (sensor_number)
+        *sensor_number = descriptor->sensor_number;
+      ctx->errnum = IPMI_SDR_ERR_SUCCESS;
+      return (0);
+    }
+
   acceptable_record_types = IPMI_SDR_PARSE_RECORD_TYPE_FULL_SENSOR_RECORD;
   acceptable_record_types |= IPMI_SDR_PARSE_RECORD_TYPE_COMPACT_SENSOR_RECORD;
   acceptable_record_types |= IPMI_SDR_PARSE_RECORD_TYPE_EVENT_ONLY_RECORD;
@@ -492,9 +557,9 @@ ipmi_sdr_parse_sensor_number (ipmi_sdr_ctx_t ctx,
 
   if (sensor_number)
     {
-      if (FIID_OBJ_GET (obj_sdr_record,
-                        "sensor_number",
-                        &val) < 0)
+      if (FIID_OBJ_GET_IDX (obj_sdr_record,
+                            IPMI_SDR_PARSE_SENSOR_RECORD_SENSOR_NUMBER,
+                            &val) < 0)
         {
           SDR_FIID_OBJECT_ERROR_TO_SDR_ERRNUM (ctx, obj_sdr_record);
           goto cleanup;
@@ -517,11 +582,27 @@ ipmi_sdr_parse_entity_id_instance_type (ipmi_sdr_ctx_t ctx,
                                         uint8_t *entity_instance,
                                         uint8_t *entity_instance_type)
 {
+  const struct ipmi_sdr_cache_descriptor *descriptor;
   fiid_obj_t obj_sdr_record = NULL;
   uint32_t acceptable_record_types;
   uint64_t val;
   int rv = -1;
 
+  if ((descriptor = _sdr_cache_descriptor (ctx,
+                                           sdr_record,
+                                           sdr_record_len,
+                                           IPMI_SDR_CACHE_DESCRIPTOR_ENTITY_ID_INSTANCE_TYPE)))
+    {
+      if (entity_id)
+        *entity_id = descriptor->entity_id;
+      if (entity_instance)
+        *entity_instance = descriptor->entity_instance;
+      if (entity_instance_type)
+        *entity_instance_type = descriptor->entity_instance_type;
+      ctx->errnum = IPMI_SDR_ERR_SUCCESS;
+      return (0);
+    }
+
   acceptable_record_types = IPMI_SDR_PARSE_RECORD_TYPE_FULL_SENSOR_RECORD;
   acceptable_record_types |= IPMI_SDR_PARSE_RECORD_TYPE_COMPACT_SENSOR_RECORD;
   acceptable_record_types |= IPMI_SDR_PARSE_RECORD_TYPE_EVENT_ONLY_RECORD;
@@ -581,11 +662,24 @@ ipmi_sdr_parse_sensor_type (ipmi_sdr_ctx_t ctx,
                             unsigned int sdr_record_len,
                             uint8_t *sensor_type)
 {
+  const struct ipmi_sdr_cache_descriptor *descriptor;
   fiid_obj_t obj_sdr_record = NULL;
   uint32_t acceptable_record_types;
+  unsigned int index;
   uint64_t val;
   int rv = -1;
 
+  if ((descriptor = _sdr_cache_descriptor (ctx,
+                                           sdr_record,
+                                           sdr_record_len,
+                                           IPMI_SDR_CACHE_DESCRIPTOR_SENSOR_TYPE)))
+    {
+      if (sensor_type)
+        *sensor_type = descriptor->sensor_type;
+      ctx->errnum = IPMI_SDR_ERR_SUCCESS;
+      return (0);
+    }
+
   acceptable_record_types = IPMI_SDR_PARSE_RECORD_TYPE_FULL_SENSOR_RECORD;
   acceptable_record_types |= IPMI_SDR_PARSE_RECORD_TYPE_COMPACT_SENSOR_RECORD;
   acceptable_record_types |= IPMI_SDR_PARSE_RECORD_TYPE_EVENT_ONLY_RECORD;
@@ -598,9 +692,17 @@ ipmi_sdr_parse_sensor_type (ipmi_sdr_ctx_t ctx,
 
   if (sensor_type)
     {
-      if (FIID_OBJ_GET (obj_sdr_record,
-                        "sensor_type",
-                        &val) < 0)
+      if (_sdr_sensor_record_field_index (ctx,
+                                          obj_sdr_record,
+                                          TMPL_SDR_FULL_SENSOR_RECORD_SENSOR_TYPE,
+                                          TMPL_SDR_COMPACT_SENSOR_RECORD_SENSOR_TYPE,
+                                          TMPL_SDR_EVENT_ONLY_RECORD_SENSOR_TYPE,
+                                          &index) < 0)
+        goto cleanup;
+
+      if (FIID_OBJ_GET_IDX (obj_sdr_record,
+                            index,
+                            &val) < 0)
         {
           SDR_FIID_OBJECT_ERROR_TO_SDR_ERRNUM (ctx, obj_sdr_record);
           goto cleanup;
@@ -621,11 +723,24 @@ ipmi_sdr_parse_event_reading_type_code (ipmi_sdr_ctx_t ctx,
                                         unsigned int sdr_record_len,
                                         uint8_t *event_reading_type_code)
 {
+  const struct ipmi_sdr_cache_descriptor *descriptor;
   fiid_obj_t obj_sdr_record = NULL;
   uint32_t acceptable_record_types;
+  unsigned int index;
   uint64_t val;
   int rv = -1;
 
+  if ((descriptor = _sdr_cache_descriptor (ctx,
+                                           sdr_record,
+                                           sdr_record_len,
+                                           IPMI_SDR_CACHE_DESCRIPTOR_EVENT_READING_TYPE_CODE)))
+    {
+      if (event_reading_type_code)
+        *event_reading_type_code = descriptor->event_reading_type_code;
+      ctx->errnum = IPMI_SDR_ERR_SUCCESS;
+      return (0);
+    }
+
   acceptable_record_types = IPMI_SDR_PARSE_RECORD_TYPE_FULL_SENSOR_RECORD;
   acceptable_record_types |= IPMI_SDR_PARSE_RECORD_TYPE_COMPACT_SENSOR_RECORD;
   acceptable_record_types |= IPMI_SDR_PARSE_RECORD_TYPE_EVENT_ONLY_RECORD;
@@ -638,9 +753,17 @@ ipmi_sdr_parse_event_reading_type_code (ipmi_sdr_ctx_t ctx,
 
   if (event_reading_type_code)
     {
-      if (FIID_OBJ_GET (obj_sdr_record,
-                        "event_reading_type_code",
-                        &val) < 0)
+      if (_sdr_sensor_record_field_index (ctx,
+                                          obj_sdr_record,
+                                          TMPL_SDR_FULL_SENSOR_RECORD_EVENT_READING_TYPE_CODE,
+                                          TMPL_SDR_COMPACT_SENSOR_RECORD_EVENT_READING_TYPE_CODE,
+                                          TMPL_SDR_EVENT_ONLY_RECORD_EVENT_READING_TYPE_CODE,
+                                          &index) < 0)
+        goto cleanup;
+
+      if (FIID_OBJ_GET_IDX (obj_sdr_record,
+                            index,
+                            &val) < 0)
         {
           SDR_FIID_OBJECT_ERROR_TO_SDR_ERRNUM (ctx, obj_sdr_record);
           goto cleanup;
@@ -662,11 +785,30 @@ ipmi_sdr_parse_id_string (ipmi_sdr_ctx_t ctx,
                           char *id_string,
                           unsigned int id_string_len)
 {
+  const struct ipmi_sdr_cache_descriptor *descriptor;
   fiid_obj_t obj_sdr_record = NULL;
   uint32_t acceptable_record_types;
   int len = 0;
   int rv = -1;
 
+  /* a buffer too small is an overflow error, left to the raw parse */
+  if ((descriptor = _sdr_cache_descriptor (ctx,
+                                           sdr_record,
+                                           sdr_record_len,
+                                           IPMI_SDR_CACHE_DESCRIPTOR_ID_STRING))
+      && (!id_string
+          || !id_string_len
+          || id_string_len >= descriptor->id_string_len))
+    {
+      if (id_string && id_string_len)
+        {
+          memcpy (id_string, descriptor->id_string, descriptor->id_string_len);
+          len = descriptor->id_string_len;
+        }
+      ctx->errnum = IPMI_SDR_ERR_SUCCESS;
+      return (len);
+    }
+
   acceptable_record_types = IPMI_SDR_PARSE_RECORD_TYPE_FULL_SENSOR_RECORD;
   acceptable_record_types |= IPMI_SDR_PARSE_RECORD_TYPE_COMPACT_SENSOR_RECORD;
   acceptable_record_types |= IPMI_SDR_PARSE_RECORD_TYPE_EVENT_ONLY_RECORD;
@@ -706,11 +848,31 @@ ipmi_sdr_parse_sensor_units (ipmi_sdr_ctx_t ctx,
                              uint8_t *sensor_base_unit_type,
                              uint8_t *sensor_modifier_unit_type)
 {
+  const struct ipmi_sdr_cache_descriptor *descriptor;
   fiid_obj_t obj_sdr_record = NULL;
   uint32_t acceptable_record_types;
   uint64_t val;
   int rv = -1;
 
+  if ((descriptor = _sdr_cache_descriptor (ctx,
+                                           sdr_record,
+                                           sdr_record_len,
+                                           IPMI_SDR_CACHE_DESCRIPTOR_SENSOR_UNITS)))
+    {
+      if (sensor_units_percentage)
+        *sensor_units_percentage = descriptor->sensor_units_percentage;
+      if (sensor_units_modifier)
+        *sensor_units_modifier = descriptor->sensor_units_modifier;
+      if (sensor_units_rate)
+        *sensor_units_rate = descriptor->sensor_units_rate;
+      if (sensor_base_unit_type)
+        *sensor_base_unit_type = descriptor->sensor_base_unit_type;
+      if (sensor_modifier_unit_type)
+        *sensor_modifier_unit_type = descriptor->sensor_modifier_unit_type;
+      ctx->errnum = IPMI_SDR_ERR_SUCCESS;
+      return (0);
+    }
+
   acceptable_record_types = IPMI_SDR_PARSE_RECORD_TYPE_FULL_SENSOR_RECORD;
   acceptable_record_types |= IPMI_SDR_PARSE_RECORD_TYPE_COMPACT_SENSOR_RECORD;
 
@@ -1521,9 +1683,9 @@ ipmi_sdr_parse_threshold_assertion_supported (ipmi_sdr_ctx_t ctx,
 
   if (lower_non_critical_going_low)
     {
-      if (FIID_OBJ_GET (obj_sdr_record_threshold,
-                        "threshold_assertion_event_mask.lower_non_critical_going_low_supported",
-                        &val) < 0)
+      if (FIID_OBJ_GET_IDX (obj_sdr_record_threshold,
+                            TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_THRESHOLD_ASSERTION_EVENT_MASK_LOWER_NON_CRITICAL_GOING_LOW_SUPPORTED,
+                            &val) < 0)
         {
           SDR_FIID_OBJECT_ERROR_TO_SDR_ERRNUM (ctx, obj_sdr_record_threshold);
           goto cleanup;
@@ -1533,9 +1695,9 @@ ipmi_sdr_parse_threshold_assertion_supported (ipmi_sdr_ctx_t ctx,
 
   if (lower_non_critical_going_high)
     {
-      if (FIID_OBJ_GET (obj_sdr_record_threshold,
-                        "threshold_assertion_event_mask.lower_non_critical_going_high_supported",
-                        &val) < 0)
+      if (FIID_OBJ_GET_IDX (obj_sdr_record_threshold,
+                            TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_THRESHOLD_ASSERTION_EVENT_MASK_LOWER_NON_CRITICAL_GOING_HIGH_SUPPORTED,
+                            &val) < 0)
         {
           SDR_FIID_OBJECT_ERROR_TO_SDR_ERRNUM (ctx, obj_sdr_record_threshold);
           goto cleanup;
@@ -1545,9 +1707,9 @@ ipmi_sdr_parse_threshold_assertion_supported (ipmi_sdr_ctx_t ctx,
 
   if (lower_critical_going_low)
     {
-      if (FIID_OBJ_GET (obj_sdr_record_threshold,
-                        "threshold_assertion_event_mask.lower_critical_going_low_supported",
-                        &val) < 0)
+      if (FIID_OBJ_GET_IDX (obj_sdr_record_threshold,
+                            TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_THRESHOLD_ASSERTION_EVENT_MASK_LOWER_CRITICAL_GOING_LOW_SUPPORTED,
+                            &val) < 0)
         {
           SDR_FIID_OBJECT_ERROR_TO_SDR_ERRNUM (ctx, obj_sdr_record_threshold);
           goto cleanup;
@@ -1557,9 +1719,9 @@ ipmi_sdr_parse_threshold_assertion_supported (ipmi_sdr_ctx_t ctx,
 
   if (lower_critical_going_high)
     {
-      if (FIID_OBJ_GET (obj_sdr_record_threshold,
-                        "threshold_assertion_event_mask.lower_critical_going_high_supported",
-                        &val) < 0)
+      if (FIID_OBJ_GET_IDX (obj_sdr_record_threshold,
+                            TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_THRESHOLD_ASSERTION_EVENT_MASK_LOWER_CRITICAL_GOING_HIGH_SUPPORTED,
+                            &val) < 0)
         {
           SDR_FIID_OBJECT_ERROR_TO_SDR_ERRNUM (ctx, obj_sdr_record_threshold);
           goto cleanup;
@@ -1569,9 +1731,9 @@ ipmi_sdr_parse_threshold_assertion_supported (ipmi_sdr_ctx_t ctx,
 
   if (lower_non_recoverable_going_low)
     {
-      if (FIID_OBJ_GET (obj_sdr_record_threshold,
-                        "threshold_assertion_event_mask.lower_non_recoverable_going_low_supported",
-                        &val) < 0)
+      if (FIID_OBJ_GET_IDX (obj_sdr_record_threshold,
+                            TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_THRESHOLD_ASSERTION_EVENT_MASK_LOWER_NON_RECOVERABLE_GOING_LOW_SUPPORTED,
+                            &val) < 0)
         {
           SDR_FIID_OBJECT_ERROR_TO_SDR_ERRNUM (ctx, obj_sdr_record_threshold);
           goto cleanup;
@@ -1581,9 +1743,9 @@ ipmi_sdr_parse_threshold_assertion_supported (ipmi_sdr_ctx_t ctx,
 
   if (lower_non_recoverable_going_high)
     {
-      if (FIID_OBJ_GET (obj_sdr_record_threshold,
-                        "threshold_assertion_event_mask.lower_non_recoverable_going_high_supported",
-                        &val) < 0)
+      if (FIID_OBJ_GET_IDX (obj_sdr_record_threshold,
+                            TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_THRESHOLD_ASSERTION_EVENT_MASK_LOWER_NON_RECOVERABLE_GOING_HIGH_SUPPORTED,
+                            &val) < 0)
         {
           SDR_FIID_OBJECT_ERROR_TO_SDR_ERRNUM (ctx, obj_sdr_record_threshold);
           goto cleanup;
@@ -1593,9 +1755,9 @@ ipmi_sdr_parse_threshold_assertion_supported (ipmi_sdr_ctx_t ctx,
 
   if (upper_non_critical_going_low)
     {
-      if (FIID_OBJ_GET (obj_sdr_record_threshold,
-                        "threshold_assertion_event_mask.upper_non_critical_going_low_supported",
-                        &val) < 0)
+      if (FIID_OBJ_GET_IDX (obj_sdr_record_threshold,
+                            TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_THRESHOLD_ASSERTION_EVENT_MASK_UPPER_NON_CRITICAL_GOING_LOW_SUPPORTED,
+                            &val) < 0)
         {
           SDR_FIID_OBJECT_ERROR_TO_SDR_ERRNUM (ctx, obj_sdr_record_threshold);
           goto cleanup;
@@ -1605,9 +1767,9 @@ ipmi_sdr_parse_threshold_assertion_supported (ipmi_sdr_ctx_t ctx,
 
   if (upper_non_critical_going_high)
     {
-      if (FIID_OBJ_GET (obj_sdr_record_threshold,
-                        "threshold_assertion_event_mask.upper_non_critical_going_high_supported",
-                        &val) < 0)
+      if (FIID_OBJ_GET_IDX (obj_sdr_record_threshold,
+                            TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_THRESHOLD_ASSERTION_EVENT_MASK_UPPER_NON_CRITICAL_GOING_HIGH_SUPPORTED,
+                            &val) < 0)
         {
           SDR_FIID_OBJECT_ERROR_TO_SDR_ERRNUM (ctx, obj_sdr_record_threshold);
           goto cleanup;
@@ -1617,9 +1779,9 @@ ipmi_sdr_parse_threshold_assertion_supported (ipmi_sdr_ctx_t ctx,
 
   if (upper_critical_going_low)
     {
-      if (FIID_OBJ_GET (obj_sdr_record_threshold,
-                        "threshold_assertion_event_mask.upper_critical_going_low_supported",
-                        &val) < 0)
+      if (FIID_OBJ_GET_IDX (obj_sdr_record_threshold,
+                            TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_THRESHOLD_ASSERTION_EVENT_MASK_UPPER_CRITICAL_GOING_LOW_SUPPORTED,
+                            &val) < 0)
         {
           SDR_FIID_OBJECT_ERROR_TO_SDR_ERRNUM (ctx, obj_sdr_record_threshold);
           goto cleanup;
@@ -1629,9 +1791,9 @@ ipmi_sdr_parse_threshold_assertion_supported (ipmi_sdr_ctx_t ctx,
 
   if (upper_critical_going_high)
     {
-      if (FIID_OBJ_GET (obj_sdr_record_threshold,
-                        "threshold_assertion_event_mask.upper_critical_going_high_supported",
-                        &val) < 0)
+      if (FIID_OBJ_GET_IDX (obj_sdr_record_threshold,
+                            TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_THRESHOLD_ASSERTION_EVENT_MASK_UPPER_CRITICAL_GOING_HIGH_SUPPORTED,
+                            &val) < 0)
         {
           SDR_FIID_OBJECT_ERROR_TO_SDR_ERRNUM (ctx, obj_sdr_record_threshold);
           goto cleanup;
@@ -1641,9 +1803,9 @@ ipmi_sdr_parse_threshold_assertion_supported (ipmi_sdr_ctx_t ctx,
 
   if (upper_non_recoverable_going_low)
     {
-      if (FIID_OBJ_GET (obj_sdr_record_threshold,
-                        "threshold_assertion_event_mask.upper_non_recoverable_going_low_supported",
-                        &val) < 0)
+      if (FIID_OBJ_GET_IDX (obj_sdr_record_threshold,
+                            TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_THRESHOLD_ASSERTION_EVENT_MASK_UPPER_NON_RECOVERABLE_GOING_LOW_SUPPORTED,
+                            &val) < 0)
         {
           SDR_FIID_OBJECT_ERROR_TO_SDR_ERRNUM (ctx, obj_sdr_record_threshold);
           goto cleanup;
@@ -1653,9 +1815,9 @@ ipmi_sdr_parse_threshold_assertion_supported (ipmi_sdr_ctx_t ctx,
 
   if (upper_non_recoverable_going_high)
     {
-      if (FIID_OBJ_GET (obj_sdr_record_threshold,
-                        "threshold_assertion_event_mask.upper_non_recoverable_going_high_supported",
-                        &val) < 0)
+      if (FIID_OBJ_GET_IDX (obj_sdr_record_threshold,
+                            TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_THRESHOLD_ASSERTION_EVENT_MASK_UPPER_NON_RECOVERABLE_GOING_HIGH_SUPPORTED,
+                            &val) < 0)
         {
           SDR_FIID_OBJECT_ERROR_TO_SDR_ERRNUM (ctx, obj_sdr_record_threshold);
           goto cleanup;
@@ -1742,9 +1904,9 @@ ipmi_sdr_parse_threshold_deassertion_supported (ipmi_sdr_ctx_t ctx,
 
   if (lower_non_critical_going_low)
     {
-      if (FIID_OBJ_GET (obj_sdr_record_threshold,
-                        "threshold_deassertion_event_mask.lower_non_critical_going_low_supported",
-                        &val) < 0)
+      if (FIID_OBJ_GET_IDX (obj_sdr_record_threshold,
+                            TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_THRESHOLD_DEASSERTION_EVENT_MASK_LOWER_NON_CRITICAL_GOING_LOW_SUPPORTED,
+                            &val) < 0)
         {
           SDR_FIID_OBJECT_ERROR_TO_SDR_ERRNUM (ctx, obj_sdr_record_threshold);
           goto cleanup;
@@ -1754,9 +1916,9 @@ ipmi_sdr_parse_threshold_deassertion_supported (ipmi_sdr_ctx_t ctx,
 
   if (lower_non_critical_going_high)
     {
-      if (FIID_OBJ_GET (obj_sdr_record_threshold,
-                        "threshold_deassertion_event_mask.lower_non_critical_going_high_supported",
-                        &val) < 0)
+      if (FIID_OBJ_GET_IDX (obj_sdr_record_threshold,
+                            TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_THRESHOLD_DEASSERTION_EVENT_MASK_LOWER_NON_CRITICAL_GOING_HIGH_SUPPORTED,
+                            &val) < 0)
         {
           SDR_FIID_OBJECT_ERROR_TO_SDR_ERRNUM (ctx, obj_sdr_record_threshold);
           goto cleanup;
@@ -1766,9 +1928,9 @@ ipmi_sdr_parse_threshold_deassertion_supported (ipmi_sdr_ctx_t ctx,
 
   if (lower_critical_going_low)
     {
-      if (FIID_OBJ_GET (obj_sdr_record_threshold,
-                        "threshold_deassertion_event_mask.lower_critical_going_low_supported",
-                        &val) < 0)
+      if (FIID_OBJ_GET_IDX (obj_sdr_record_threshold,
+                            TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_THRESHOLD_DEASSERTION_EVENT_MASK_LOWER_CRITICAL_GOING_LOW_SUPPORTED,
+                            &val) < 0)
         {
           SDR_FIID_OBJECT_ERROR_TO_SDR_ERRNUM (ctx, obj_sdr_record_threshold);
           goto cleanup;
@@ -1778,9 +1940,9 @@ ipmi_sdr_parse_threshold_deassertion_supported (ipmi_sdr_ctx_t ctx,
 
   if (lower_critical_going_high)
     {
-      if (FIID_OBJ_GET (obj_sdr_record_threshold,
-                        "threshold_deassertion_event_mask.lower_critical_going_high_supported",
-                        &val) < 0)
+      if (FIID_OBJ_GET_IDX (obj_sdr_record_threshold,
+                            TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_THRESHOLD_DEASSERTION_EVENT_MASK_LOWER_CRITICAL_GOING_HIGH_SUPPORTED,
+                            &val) < 0)
         {
           SDR_FIID_OBJECT_ERROR_TO_SDR_ERRNUM (ctx, obj_sdr_record_threshold);
           goto cleanup;
@@ -1790,9 +1952,9 @@ ipmi_sdr_parse_threshold_deassertion_supported (ipmi_sdr_ctx_t ctx,
 
   if (lower_non_recoverable_going_low)
     {
-      if (FIID_OBJ_GET (obj_sdr_record_threshold,
-                        "threshold_deassertion_event_mask.lower_non_recoverable_going_low_supported",
-                        &val) < 0)
+      if (FIID_OBJ_GET_IDX (obj_sdr_record_threshold,
+                            TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_THRESHOLD_DEASSERTION_EVENT_MASK_LOWER_NON_RECOVERABLE_GOING_LOW_SUPPORTED,
+                            &val) < 0)
         {
           SDR_FIID_OBJECT_ERROR_TO_SDR_ERRNUM (ctx, obj_sdr_record_threshold);
           goto cleanup;
@@ -1802,9 +1964,9 @@ ipmi_sdr_parse_threshold_deassertion_supported (ipmi_sdr_ctx_t ctx,
 
   if (lower_non_recoverable_going_high)
     {
-      if (FIID_OBJ_GET (obj_sdr_record_threshold,
-                        "threshold_deassertion_event_mask.lower_non_recoverable_going_high_supported",
-                        &val) < 0)
+      if (FIID_OBJ_GET_IDX (obj_sdr_record_threshold,
+                            TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_THRESHOLD_DEASSERTION_EVENT_MASK_LOWER_NON_RECOVERABLE_GOING_HIGH_SUPPORTED,
+                            &val) < 0)
         {
           SDR_FIID_OBJECT_ERROR_TO_SDR_ERRNUM (ctx, obj_sdr_record_threshold);
           goto cleanup;
@@ -1814,9 +1976,9 @@ ipmi_sdr_parse_threshold_deassertion_supported (ipmi_sdr_ctx_t ctx,
 
   if (upper_non_critical_going_low)
     {
-      if (FIID_OBJ_GET (obj_sdr_record_threshold,
-                        "threshold_deassertion_event_mask.upper_non_critical_going_low_supported",
-                        &val) < 0)
+      if (FIID_OBJ_GET_IDX (obj_sdr_record_threshold,
+                            TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_THRESHOLD_DEASSERTION_EVENT_MASK_UPPER_NON_CRITICAL_GOING_LOW_SUPPORTED,
+                            &val) < 0)
         {
           SDR_FIID_OBJECT_ERROR_TO_SDR_ERRNUM (ctx, obj_sdr_record_threshold);
           goto cleanup;
@@ -1826,9 +1988,9 @@ ipmi_sdr_parse_threshold_deassertion_supported (ipmi_sdr_ctx_t ctx,
 
   if (upper_non_critical_going_high)
     {
-      if (FIID_OBJ_GET (obj_sdr_record_threshold,
-                        "threshold_deassertion_event_mask.upper_non_critical_going_high_supported",
-                        &val) < 0)
+      if (FIID_OBJ_GET_IDX (obj_sdr_record_threshold,
+                            TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_THRESHOLD_DEASSERTION_EVENT_MASK_UPPER_NON_CRITICAL_GOING_HIGH_SUPPORTED,
+                            &val) < 0)
         {
           SDR_FIID_OBJECT_ERROR_TO_SDR_ERRNUM (ctx, obj_sdr_record_threshold);
           goto cleanup;
@@ -1838,9 +2000,9 @@ ipmi_sdr_parse_threshold_deassertion_supported (ipmi_sdr_ctx_t ctx,
 
   if (upper_critical_going_low)
     {
-      if (FIID_OBJ_GET (obj_sdr_record_threshold,
-                        "threshold_deassertion_event_mask.upper_critical_going_low_supported",
-                        &val) < 0)
+      if (FIID_OBJ_GET_IDX (obj_sdr_record_threshold,
+                            TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_THRESHOLD_DEASSERTION_EVENT_MASK_UPPER_CRITICAL_GOING_LOW_SUPPORTED,
+                            &val) < 0)
         {
           SDR_FIID_OBJECT_ERROR_TO_SDR_ERRNUM (ctx, obj_sdr_record_threshold);
           goto cleanup;
@@ -1850,9 +2012,9 @@ ipmi_sdr_parse_threshold_deassertion_supported (ipmi_sdr_ctx_t ctx,
 
   if (upper_critical_going_high)
     {
-      if (FIID_OBJ_GET (obj_sdr_record_threshold,
-                        "threshold_deassertion_event_mask.upper_critical_going_high_supported",
-                        &val) < 0)
+      if (FIID_OBJ_GET_IDX (obj_sdr_record_threshold,
+                            TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_THRESHOLD_DEASSERTION_EVENT_MASK_UPPER_CRITICAL_GOING_HIGH_SUPPORTED,
+                            &val) < 0)
         {
           SDR_FIID_OBJECT_ERROR_TO_SDR_ERRNUM (ctx, obj_sdr_record_threshold);
           goto cleanup;
@@ -1862,9 +2024,9 @@ ipmi_sdr_parse_threshold_deassertion_supported (ipmi_sdr_ctx_t ctx,
 
   if (upper_non_recoverable_going_low)
     {
-      if (FIID_OBJ_GET (obj_sdr_record_threshold,
-                        "threshold_deassertion_event_mask.upper_non_recoverable_going_low_supported",
-                        &val) < 0)
+      if (FIID_OBJ_GET_IDX (obj_sdr_record_threshold,
+                            TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_THRESHOLD_DEASSERTION_EVENT_MASK_UPPER_NON_RECOVERABLE_GOING_LOW_SUPPORTED,
+                            &val) < 0)
         {
           SDR_FIID_OBJECT_ERROR_TO_SDR_ERRNUM (ctx, obj_sdr_record_threshold);
           goto cleanup;
@@ -1874,9 +2036,9 @@ ipmi_sdr_parse_threshold_deassertion_supported (ipmi_sdr_ctx_t ctx,
 
   if (upper_non_recoverable_going_high)
     {
-      if (FIID_OBJ_GET (obj_sdr_record_threshold,
-                        "threshold_deassertion_event_mask.upper_non_recoverable_going_high_supported",
-                        &val) < 0)
+      if (FIID_OBJ_GET_IDX (obj_sdr_record_threshold,
+                            TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_THRESHOLD_DEASSERTION_EVENT_MASK_UPPER_NON_RECOVERABLE_GOING_HIGH_SUPPORTED,
+                            &val) < 0)
         {
           SDR_FIID_OBJECT_ERROR_TO_SDR_ERRNUM (ctx, obj_sdr_record_threshold);
           goto cleanup;
@@ -1957,9 +2119,9 @@ ipmi_sdr_parse_threshold_readable (ipmi_sdr_ctx_t ctx,
 
   if (lower_non_critical_threshold)
     {
-      if (FIID_OBJ_GET (obj_sdr_record_threshold,
-                        "readable_threshold_mask.lower_non_critical_threshold_is_readable",
-                        &val) < 0)
+      if (FIID_OBJ_GET_IDX (obj_sdr_record_threshold,
+                            TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_READABLE_THRESHOLD_MASK_LOWER_NON_CRITICAL_THRESHOLD_IS_READABLE,
+                            &val) < 0)
         {
           SDR_FIID_OBJECT_ERROR_TO_SDR_ERRNUM (ctx, obj_sdr_record_threshold);
           goto cleanup;
@@ -1969,9 +2131,9 @@ ipmi_sdr_parse_threshold_readable (ipmi_sdr_ctx_t ctx,
 
   if (lower_critical_threshold)
     {
-      if (FIID_OBJ_GET (obj_sdr_record_threshold,
-                        "readable_threshold_mask.lower_critical_threshold_is_readable",
-                        &val) < 0)
+      if (FIID_OBJ_GET_IDX (obj_sdr_record_threshold,
+                            TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_READABLE_THRESHOLD_MASK_LOWER_CRITICAL_THRESHOLD_IS_READABLE,
+                            &val) < 0)
         {
           SDR_FIID_OBJECT_ERROR_TO_SDR_ERRNUM (ctx, obj_sdr_record_threshold);
           goto cleanup;
@@ -1981,9 +2143,9 @@ ipmi_sdr_parse_threshold_readable (ipmi_sdr_ctx_t ctx,
 
   if (lower_non_recoverable_threshold)
     {
-      if (FIID_OBJ_GET (obj_sdr_record_threshold,
-                        "readable_threshold_mask.lower_non_recoverable_threshold_is_readable",
-                        &val) < 0)
+      if (FIID_OBJ_GET_IDX (obj_sdr_record_threshold,
+                            TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_READABLE_THRESHOLD_MASK_LOWER_NON_RECOVERABLE_THRESHOLD_IS_READABLE,
+                            &val) < 0)
         {
           SDR_FIID_OBJECT_ERROR_TO_SDR_ERRNUM (ctx, obj_sdr_record_threshold);
           goto cleanup;
@@ -1993,9 +2155,9 @@ ipmi_sdr_parse_threshold_readable (ipmi_sdr_ctx_t ctx,
 
   if (upper_non_critical_threshold)
     {
-      if (FIID_OBJ_GET (obj_sdr_record_threshold,
-                        "readable_threshold_mask.upper_non_critical_threshold_is_readable",
-                        &val) < 0)
+      if (FIID_OBJ_GET_IDX (obj_sdr_record_threshold,
+                            TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_READABLE_THRESHOLD_MASK_UPPER_NON_CRITICAL_THRESHOLD_IS_READABLE,
+                            &val) < 0)
         {
           SDR_FIID_OBJECT_ERROR_TO_SDR_ERRNUM (ctx, obj_sdr_record_threshold);
           goto cleanup;
@@ -2005,9 +2167,9 @@ ipmi_sdr_parse_threshold_readable (ipmi_sdr_ctx_t ctx,
 
   if (upper_critical_threshold)
     {
-      if (FIID_OBJ_GET (obj_sdr_record_threshold,
-                        "readable_threshold_mask.upper_critical_threshold_is_readable",
-                        &val) < 0)
+      if (FIID_OBJ_GET_IDX (obj_sdr_record_threshold,
+                            TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_READABLE_THRESHOLD_MASK_UPPER_CRITICAL_THRESHOLD_IS_READABLE,
+                            &val) < 0)
         {
           SDR_FIID_OBJECT_ERROR_TO_SDR_ERRNUM (ctx, obj_sdr_record_threshold);
           goto cleanup;
@@ -2017,9 +2179,9 @@ ipmi_sdr_parse_threshold_readable (ipmi_sdr_ctx_t ctx,
 
   if (upper_non_recoverable_threshold)
     {
-      if (FIID_OBJ_GET (obj_sdr_record_threshold,
-                        "readable_threshold_mask.upper_non_recoverable_threshold_is_readable",
-                        &val) < 0)
+      if (FIID_OBJ_GET_IDX (obj_sdr_record_threshold,
+                            TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_READABLE_THRESHOLD_MASK_UPPER_NON_RECOVERABLE_THRESHOLD_IS_READABLE,
+                            &val) < 0)
         {
           SDR_FIID_OBJECT_ERROR_TO_SDR_ERRNUM (ctx, obj_sdr_record_threshold);
           goto cleanup;
@@ -2100,9 +2262,9 @@ ipmi_sdr_parse_threshold_settable (ipmi_sdr_ctx_t ctx,
 
   if (lower_non_critical_threshold)
     {
-      if (FIID_OBJ_GET (obj_sdr_record_threshold,
-                        "settable_threshold_mask.lower_non_critical_threshold_is_settable",
-                        &val) < 0)
+      if (FIID_OBJ_GET_IDX (obj_sdr_record_threshold,
+                            TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_SETTABLE_THRESHOLD_MASK_LOWER_NON_CRITICAL_THRESHOLD_IS_SETTABLE,
+                            &val) < 0)
         {
           SDR_FIID_OBJECT_ERROR_TO_SDR_ERRNUM (ctx, obj_sdr_record_threshold);
           goto cleanup;
@@ -2112,9 +2274,9 @@ ipmi_sdr_parse_threshold_settable (ipmi_sdr_ctx_t ctx,
 
   if (lower_critical_threshold)
     {
-      if (FIID_OBJ_GET (obj_sdr_record_threshold,
-                        "settable_threshold_mask.lower_critical_threshold_is_settable",
-                        &val) < 0)
+      if (FIID_OBJ_GET_IDX (obj_sdr_record_threshold,
+                            TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_SETTABLE_THRESHOLD_MASK_LOWER_CRITICAL_THRESHOLD_IS_SETTABLE,
+                            &val) < 0)
         {
           SDR_FIID_OBJECT_ERROR_TO_SDR_ERRNUM (ctx, obj_sdr_record_threshold);
           goto cleanup;
@@ -2124,9 +2286,9 @@ ipmi_sdr_parse_threshold_settable (ipmi_sdr_ctx_t ctx,
 
   if (lower_non_recoverable_threshold)
     {
-      if (FIID_OBJ_GET (obj_sdr_record_threshold,
-                        "settable_threshold_mask.lower_non_recoverable_threshold_is_settable",
-                        &val) < 0)
+      if (FIID_OBJ_GET_IDX (obj_sdr_record_threshold,
+                            TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_SETTABLE_THRESHOLD_MASK_LOWER_NON_RECOVERABLE_THRESHOLD_IS_SETTABLE,
+                            &val) < 0)
         {
           SDR_FIID_OBJECT_ERROR_TO_SDR_ERRNUM (ctx, obj_sdr_record_threshold);
           goto cleanup;
@@ -2136,9 +2298,9 @@ ipmi_sdr_parse_threshold_settable (ipmi_sdr_ctx_t ctx,
 
   if (upper_non_critical_threshold)
     {
-      if (FIID_OBJ_GET (obj_sdr_record_threshold,
-                        "settable_threshold_mask.upper_non_critical_threshold_is_settable",
-                        &val) < 0)
+      if (FIID_OBJ_GET_IDX (obj_sdr_record_threshold,
+                            TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_SETTABLE_THRESHOLD_MASK_UPPER_NON_CRITICAL_THRESHOLD_IS_SETTABLE,
+                            &val) < 0)
         {
           SDR_FIID_OBJECT_ERROR_TO_SDR_ERRNUM (ctx, obj_sdr_record_threshold);
           goto cleanup;
@@ -2148,9 +2310,9 @@ ipmi_sdr_parse_threshold_settable (ipmi_sdr_ctx_t ctx,
 
   if (upper_critical_threshold)
     {
-      if (FIID_OBJ_GET (obj_sdr_record_threshold,
-                        "settable_threshold_mask.upper_critical_threshold_is_settable",
-                        &val) < 0)
+      if (FIID_OBJ_GET_IDX (obj_sdr_record_threshold,
+                            TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_SETTABLE_THRESHOLD_MASK_UPPER_CRITICAL_THRESHOLD_IS_SETTABLE,
+                            &val) < 0)
         {
           SDR_FIID_OBJECT_ERROR_TO_SDR_ERRNUM (ctx, obj_sdr_record_threshold);
           goto cleanup;
@@ -2160,9 +2322,9 @@ ipmi_sdr_parse_threshold_settable (ipmi_sdr_ctx_t ctx,
 
   if (upper_non_recoverable_threshold)
     {
-      if (FIID_OBJ_GET (obj_sdr_record_threshold,
-                        "settable_threshold_mask.upper_non_recoverable_threshold_is_settable",
-                        &val) < 0)
+      if (FIID_OBJ_GET_IDX (obj_sdr_record_threshold,
+                            TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_SETTABLE_THRESHOLD_MASK_UPPER_NON_RECOVERABLE_THRESHOLD_IS_SETTABLE,
+                            &val) < 0)
         {
           SDR_FIID_OBJECT_ERROR_TO_SDR_ERRNUM (ctx, obj_sdr_record_threshold);
           goto cleanup;
@@ -2189,11 +2351,33 @@ ipmi_sdr_parse_sensor_decoding_data (ipmi_sdr_ctx_t ctx,
                                      uint8_t *linearization,
                                      uint8_t *analog_data_format)
 {
+  const struct ipmi_sdr_cache_descriptor *descriptor;
   fiid_obj_t obj_sdr_record = NULL;
   uint32_t acceptable_record_types;
   uint64_t val, val1, val2;
   int rv = -1;
 
+  if ((descriptor = _sdr_cache_descriptor (ctx,
+                                           sdr_record,
+                                           sdr_record_len,
+                                           IPMI_SDR_CACHE_DESCRIPTOR_SENSOR_DECODING_DATA)))
+    {
+      if (r_exponent)
+        *r_exponent = descriptor->r_exponent;
+      if (b_exponent)
+        *b_exponent = descriptor->b_exponent;
+      if (m)
+        *m = descriptor->m;
+      if (b)
+        *b = descriptor->b;
+      if (linearization)
+        *linearization = descriptor->linearization;
+      if (analog_data_format)
+        *analog_data_format = descriptor->analog_data_format;
+      ctx->errnum = IPMI_SDR_ERR_SUCCESS;
+      return (0);
+    }
+
   acceptable_record_types = IPMI_SDR_PARSE_RECORD_TYPE_FULL_SENSOR_RECORD;
 
   if (!(obj_sdr_record = _sdr_record_get_common (ctx,
@@ -2204,9 +2388,9 @@ ipmi_sdr_parse_sensor_decoding_data (ipmi_sdr_ctx_t ctx,
 
   if (r_exponent)
     {
-      if (FIID_OBJ_GET (obj_sdr_record,
-                        "r_exponent",
-                        &val) < 0)
+      if (FIID_OBJ_GET_IDX (obj_sdr_record,
+                            TMPL_SDR_FULL_SENSOR_RECORD_R_EXPONENT,
+                            &val) < 0)
         {
           SDR_FIID_OBJECT_ERROR_TO_SDR_ERRNUM (ctx, obj_sdr_record);
           goto cleanup;
@@ -2218,9 +2402,9 @@ ipmi_sdr_parse_sensor_decoding_data (ipmi_sdr_ctx_t ctx,
 
   if (b_exponent)
     {
-      if (FIID_OBJ_GET (obj_sdr_record,
-                        "b_exponent",
-                        &val) < 0)
+      if (FIID_OBJ_GET_IDX (obj_sdr_record,
+                            TMPL_SDR_FULL_SENSOR_RECORD_B_EXPONENT,
+                            &val) < 0)
         {
           SDR_FIID_OBJECT_ERROR_TO_SDR_ERRNUM (ctx, obj_sdr_record);
           goto cleanup;
@@ -2232,16 +2416,16 @@ ipmi_sdr_parse_sensor_decoding_data (ipmi_sdr_ctx_t ctx,
 
   if (m)
     {
-      if (FIID_OBJ_GET (obj_sdr_record,
-                        "m_ls",
-                        &val1) < 0)
+      if (FIID_OBJ_GET_IDX (obj_sdr_record,
+                            TMPL_SDR_FULL_SENSOR_RECORD_M_LS,
+                            &val1) < 0)
         {
           SDR_FIID_OBJECT_ERROR_TO_SDR_ERRNUM (ctx, obj_sdr_record);
           goto cleanup;
         }
-      if (FIID_OBJ_GET (obj_sdr_record,
-                        "m_ms",
-                        &val2) < 0)
+      if (FIID_OBJ_GET_IDX (obj_sdr_record,
+                            TMPL_SDR_FULL_SENSOR_RECORD_M_MS,
+                            &val2) < 0)
         {
           SDR_FIID_OBJECT_ERROR_TO_SDR_ERRNUM (ctx, obj_sdr_record);
           goto cleanup;
@@ -2254,16 +2438,16 @@ ipmi_sdr_parse_sensor_decoding_data (ipmi_sdr_ctx_t ctx,
 
   if (b)
     {
-      if (FIID_OBJ_GET (obj_sdr_record,
-                        "b_ls",
-                        &val1) < 0)
+      if (FIID_OBJ_GET_IDX (obj_sdr_record,
+                            TMPL_SDR_FULL_SENSOR_RECORD_B_LS,
+                            &val1) < 0)
         {
           SDR_FIID_OBJECT_ERROR_TO_SDR_ERRNUM (ctx, obj_sdr_record);
           goto cleanup;
         }
-      if (FIID_OBJ_GET (obj_sdr_record,
-                        "b_ms",
-                        &val2) < 0)
+      if (FIID_OBJ_GET_IDX (obj_sdr_record,
+                            TMPL_SDR_FULL_SENSOR_RECORD_B_MS,
+                            &val2) < 0)
         {
           SDR_FIID_OBJECT_ERROR_TO_SDR_ERRNUM (ctx, obj_sdr_record);
           goto cleanup;
@@ -2276,9 +2460,9 @@ ipmi_sdr_parse_sensor_decoding_data (ipmi_sdr_ctx_t ctx,
 
   if (linearization)
     {
-      if (FIID_OBJ_GET (obj_sdr_record,
-                        "linearization",
-                        &val) < 0)
+      if (FIID_OBJ_GET_IDX (obj_sdr_record,
+                            TMPL_SDR_FULL_SENSOR_RECORD_LINEARIZATION,
+                            &val) < 0)
         {
           SDR_FIID_OBJECT_ERROR_TO_SDR_ERRNUM (ctx, obj_sdr_record);
           goto cleanup;
@@ -2288,9 +2472,9 @@ ipmi_sdr_parse_sensor_decoding_data (ipmi_sdr_ctx_t ctx,
 
   if (analog_data_format)
     {
-      if (FIID_OBJ_GET (obj_sdr_record,
-                        "sensor_unit1.analog_data_format",
-                        &val) < 0)
+      if (FIID_OBJ_GET_IDX (obj_sdr_record,
+                            TMPL_SDR_FULL_SENSOR_RECORD_SENSOR_UNIT1_ANALOG_DATA_FORMAT,
+                            &val) < 0)
         {
           SDR_FIID_OBJECT_ERROR_TO_SDR_ERRNUM (ctx, obj_sdr_record);
           goto cleanup;
@@ -2373,9 +2557,9 @@ ipmi_sdr_parse_sensor_reading_ranges_specified (ipmi_sdr_ctx_t ctx,
 
   if (nominal_reading_specified)
     {
-      if (FIID_OBJ_GET (obj_sdr_record,
-                        "analog_characteristics_flag.nominal_reading",
-                        &val) < 0)
+      if (FIID_OBJ_GET_IDX (obj_sdr_record,
+                            TMPL_SDR_FULL_SENSOR_RECORD_ANALOG_CHARACTERISTICS_FLAG_NOMINAL_READING,
+                            &val) < 0)
         {
           SDR_FIID_OBJECT_ERROR_TO_SDR_ERRNUM (ctx, obj_sdr_record);
           goto cleanup;
@@ -2385,9 +2569,9 @@ ipmi_sdr_parse_sensor_reading_ranges_specified (ipmi_sdr_ctx_t ctx,
 
   if (normal_maximum_specified)
     {
-      if (FIID_OBJ_GET (obj_sdr_record,
-                        "analog_characteristics_flag.normal_max",
-                        &val) < 0)
+      if (FIID_OBJ_GET_IDX (obj_sdr_record,
+                            TMPL_SDR_FULL_SENSOR_RECORD_ANALOG_CHARACTERISTICS_FLAG_NORMAL_MAX,
+                            &val) < 0)
         {
           SDR_FIID_OBJECT_ERROR_TO_SDR_ERRNUM (ctx, obj_sdr_record);
           goto cleanup;
@@ -2397,9 +2581,9 @@ ipmi_sdr_parse_sensor_reading_ranges_specified (ipmi_sdr_ctx_t ctx,
 
   if (normal_minimum_specified)
     {
-      if (FIID_OBJ_GET (obj_sdr_record,
-                        "analog_characteristics_flag.normal_min",
-                        &val) < 0)
+      if (FIID_OBJ_GET_IDX (obj_sdr_record,
+                            TMPL_SDR_FULL_SENSOR_RECORD_ANALOG_CHARACTERISTICS_FLAG_NORMAL_MIN,
+                            &val) < 0)
         {
           SDR_FIID_OBJECT_ERROR_TO_SDR_ERRNUM (ctx, obj_sdr_record);
           goto cleanup;
@@ -2481,9 +2665,9 @@ ipmi_sdr_parse_sensor_reading_ranges (ipmi_sdr_ctx_t ctx,
 
   if (nominal_reading)
     {
-      if (FIID_OBJ_GET (obj_sdr_record,
-                        "nominal_reading",
-                        &val) < 0)
+      if (FIID_OBJ_GET_IDX (obj_sdr_record,
+                            TMPL_SDR_FULL_SENSOR_RECORD_NOMINAL_READING,
+                            &val) < 0)
         {
           SDR_FIID_OBJECT_ERROR_TO_SDR_ERRNUM (ctx, obj_sdr_record);
           goto cleanup;
@@ -2503,9 +2687,9 @@ ipmi_sdr_parse_sensor_reading_ranges (ipmi_sdr_ctx_t ctx,
     }
   if (normal_maximum)
     {
-      if (FIID_OBJ_GET (obj_sdr_record,
-                        "normal_maximum",
-                        &val) < 0)
+      if (FIID_OBJ_GET_IDX (obj_sdr_record,
+                            TMPL_SDR_FULL_SENSOR_RECORD_NORMAL_MAXIMUM,
+                            &val) < 0)
         {
           SDR_FIID_OBJECT_ERROR_TO_SDR_ERRNUM (ctx, obj_sdr_record);
           goto cleanup;
@@ -2525,9 +2709,9 @@ ipmi_sdr_parse_sensor_reading_ranges (ipmi_sdr_ctx_t ctx,
     }
   if (normal_minimum)
     {
-      if (FIID_OBJ_GET (obj_sdr_record,
-                        "normal_minimum",
-                        &val) < 0)
+      if (FIID_OBJ_GET_IDX (obj_sdr_record,
+                            TMPL_SDR_FULL_SENSOR_RECORD_NORMAL_MINIMUM,
+                            &val) < 0)
         {
           SDR_FIID_OBJECT_ERROR_TO_SDR_ERRNUM (ctx, obj_sdr_record);
           goto cleanup;
@@ -2547,9 +2731,9 @@ ipmi_sdr_parse_sensor_reading_ranges (ipmi_sdr_ctx_t ctx,
     }
   if (sensor_maximum_reading)
     {
-      if (FIID_OBJ_GET (obj_sdr_record,
-                        "sensor_maximum_reading",
-                        &val) < 0)
+      if (FIID_OBJ_GET_IDX (obj_sdr_record,
+                            TMPL_SDR_FULL_SENSOR_RECORD_SENSOR_MAXIMUM_READING,
+                            &val) < 0)
         {
           SDR_FIID_OBJECT_ERROR_TO_SDR_ERRNUM (ctx, obj_sdr_record);
           goto cleanup;
@@ -2569,9 +2753,9 @@ ipmi_sdr_parse_sensor_reading_ranges (ipmi_sdr_ctx_t ctx,
     }
   if (sensor_minimum_reading)
     {
-      if (FIID_OBJ_GET (obj_sdr_record,
-                        "sensor_minimum_reading",
-                        &val) < 0)
+      if (FIID_OBJ_GET_IDX (obj_sdr_record,
+                            TMPL_SDR_FULL_SENSOR_RECORD_SENSOR_MINIMUM_READING,
+                            &val) < 0)
         {
           SDR_FIID_OBJECT_ERROR_TO_SDR_ERRNUM (ctx, obj_sdr_record);
           goto cleanup;
@@ -2616,6 +2800,92 @@ ipmi_sdr_parse_sensor_reading_ranges (ipmi_sdr_ctx_t ctx,
   return (rv);
 }
 
+static int
+_sdr_parse_thresholds_descriptor (ipmi_sdr_ctx_t ctx,
+                                  const struct ipmi_sdr_cache_descriptor *descriptor,
+                                  double **lower_non_critical_threshold,
+                                  double **lower_critical_threshold,
+                                  double **lower_non_recoverable_threshold,
+                                  double **upper_non_critical_threshold,
+                                  double **upper_critical_threshold,
+                                  double **upper_non_recoverable_threshold)
+{
+  double **thresholds[6];
+  uint8_t thresholds_raw[6];
+  double *tmp_thresholds[6] = { NULL, NULL, NULL, NULL, NULL, NULL };
+  unsigned int i;
+  int rv = -1;
+
+  assert (ctx);
+  assert (ctx->magic == IPMI_SDR_CTX_MAGIC);
+  assert (descriptor);
+
+  thresholds[0] = lower_non_critical_threshold;
+  thresholds[1] = lower_critical_threshold;
+  thresholds[2] = lower_non_recoverable_threshold;
+  thresholds[3] = upper_non_critical_threshold;
+  thresholds[4] = upper_critical_threshold;
+  thresholds[5] = upper_non_recoverable_threshold;
+
+  thresholds_raw[0] = descriptor->lower_non_critical_threshold;
+  thresholds_raw[1] = descriptor->lower_critical_threshold;
+  thresholds_raw[2] = descriptor->lower_non_recoverable_threshold;
+  thresholds_raw[3] = descriptor->upper_non_critical_threshold;
+  thresholds_raw[4] = descriptor->upper_critical_threshold;
+  thresholds_raw[5] = descriptor->upper_non_recoverable_threshold;
+
+  for (i = 0; i < 6; i++)
+    {
+      if (thresholds[i])
+        *thresholds[i] = NULL;
+    }
+
+  if (!IPMI_SDR_ANALOG_DATA_FORMAT_VALID (descriptor->analog_data_format))
+    {
+      SDR_SET_ERRNUM (ctx, IPMI_SDR_ERR_PARSE_CANNOT_PARSE_OR_CALCULATE);
+      goto cleanup;
+    }
+
+  if (!IPMI_SDR_LINEARIZATION_IS_LINEAR (descriptor->linearization))
+    {
+      SDR_SET_ERRNUM (ctx, IPMI_SDR_ERR_PARSE_CANNOT_PARSE_OR_CALCULATE);
+      goto cleanup;
+    }
+
+  for (i = 0; i < 6; i++)
+    {
+      if (!thresholds[i])
+        continue;
+
+      if (_sensor_decode_value (ctx,
+                                descriptor->r_exponent,
+                                descriptor->b_exponent,
+                                descriptor->m,
+                                descriptor->b,
+                                descriptor->linearization,
+                                descriptor->analog_data_format,
+                                thresholds_raw[i],
+                                &tmp_thresholds[i]) < 0)
+        goto cleanup;
+    }
+
+  for (i = 0; i < 6; i++)
+    {
+      if (thresholds[i])
+        {
+          *thresholds[i] = tmp_thresholds[i];
+          tmp_thresholds[i] = NULL;
+        }
+    }
+
+  rv = 0;
+  ctx->errnum = IPMI_SDR_ERR_SUCCESS;
+ cleanup:
+  for (i = 0; i < 6; i++)
+    free (tmp_thresholds[i]);
+  return (rv);
+}
+
 int
 ipmi_sdr_parse_thresholds (ipmi_sdr_ctx_t ctx,
                            const void *sdr_record,
@@ -2638,9 +2908,26 @@ ipmi_sdr_parse_thresholds (ipmi_sdr_ctx_t ctx,
   double *tmp_upper_non_critical_threshold = NULL;
   double *tmp_upper_critical_threshold = NULL;
   double *tmp_upper_non_recoverable_threshold = NULL;
+  const struct ipmi_sdr_cache_descriptor *descriptor;
   uint64_t val;
   int rv = -1;
 
+  /* threshold based sensors only, other full records keep parsing
+   * their threshold bytes from the raw record
+   */
+  if ((descriptor = _sdr_cache_descriptor (ctx,
+                                           sdr_record,
+                                           sdr_record_len,
+                                           IPMI_SDR_CACHE_DESCRIPTOR_SENSOR_DECODING_DATA | IPMI_SDR_CACHE_DESCRIPTOR_THRESHOLDS_RAW)))
+    return (_sdr_parse_thresholds_descriptor (ctx,
+                                              descriptor,
+                                              lower_non_critical_threshold,
+                                              lower_critical_threshold,
+                                              lower_non_recoverable_threshold,
+                                              upper_non_critical_threshold,
+                                              upper_critical_threshold,
+                                              upper_non_recoverable_threshold));
+
   acceptable_record_types = IPMI_SDR_PARSE_RECORD_TYPE_FULL_SENSOR_RECORD;
 
   if (!(obj_sdr_record = _sdr_record_get_common (ctx,
@@ -2687,9 +2974,9 @@ ipmi_sdr_parse_thresholds (ipmi_sdr_ctx_t ctx,
 
   if (lower_non_critical_threshold)
     {
-      if (FIID_OBJ_GET (obj_sdr_record,
-                        "lower_non_critical_threshold",
-                        &val) < 0)
+      if (FIID_OBJ_GET_IDX (obj_sdr_record,
+                            TMPL_SDR_FULL_SENSOR_RECORD_LOWER_NON_CRITICAL_THRESHOLD,
+                            &val) < 0)
         {
           SDR_FIID_OBJECT_ERROR_TO_SDR_ERRNUM (ctx, obj_sdr_record);
           goto cleanup;
@@ -2709,9 +2996,9 @@ ipmi_sdr_parse_thresholds (ipmi_sdr_ctx_t ctx,
     }
   if (lower_critical_threshold)
     {
-      if (FIID_OBJ_GET (obj_sdr_record,
-                        "lower_critical_threshold",
-                        &val) < 0)
+      if (FIID_OBJ_GET_IDX (obj_sdr_record,
+                            TMPL_SDR_FULL_SENSOR_RECORD_LOWER_CRITICAL_THRESHOLD,
+                            &val) < 0)
         {
           SDR_FIID_OBJECT_ERROR_TO_SDR_ERRNUM (ctx, obj_sdr_record);
           goto cleanup;
@@ -2731,9 +3018,9 @@ ipmi_sdr_parse_thresholds (ipmi_sdr_ctx_t ctx,
     }
   if (lower_non_recoverable_threshold)
     {
-      if (FIID_OBJ_GET (obj_sdr_record,
-                        "lower_non_recoverable_threshold",
-                        &val) < 0)
+      if (FIID_OBJ_GET_IDX (obj_sdr_record,
+                            TMPL_SDR_FULL_SENSOR_RECORD_LOWER_NON_RECOVERABLE_THRESHOLD,
+                            &val) < 0)
         {
           SDR_FIID_OBJECT_ERROR_TO_SDR_ERRNUM (ctx, obj_sdr_record);
           goto cleanup;
@@ -2753,9 +3040,9 @@ ipmi_sdr_parse_thresholds (ipmi_sdr_ctx_t ctx,
     }
   if (upper_non_critical_threshold)
     {
-      if (FIID_OBJ_GET (obj_sdr_record,
-                        "upper_non_critical_threshold",
-                        &val) < 0)
+      if (FIID_OBJ_GET_IDX (obj_sdr_record,
+                            TMPL_SDR_FULL_SENSOR_RECORD_UPPER_NON_CRITICAL_THRESHOLD,
+                            &val) < 0)
         {
           SDR_FIID_OBJECT_ERROR_TO_SDR_ERRNUM (ctx, obj_sdr_record);
           goto cleanup;
@@ -2775,9 +3062,9 @@ ipmi_sdr_parse_thresholds (ipmi_sdr_ctx_t ctx,
     }
   if (upper_critical_threshold)
     {
-      if (FIID_OBJ_GET (obj_sdr_record,
-                        "upper_critical_threshold",
-                        &val) < 0)
+      if (FIID_OBJ_GET_IDX (obj_sdr_record,
+                            TMPL_SDR_FULL_SENSOR_RECORD_UPPER_CRITICAL_THRESHOLD,
+                            &val) < 0)
         {
           SDR_FIID_OBJECT_ERROR_TO_SDR_ERRNUM (ctx, obj_sdr_record);
           goto cleanup;
@@ -2797,9 +3084,9 @@ ipmi_sdr_parse_thresholds (ipmi_sdr_ctx_t ctx,
     }
   if (upper_non_recoverable_threshold)
     {
-      if (FIID_OBJ_GET (obj_sdr_record,
-                        "upper_non_recoverable_threshold",
-                        &val) < 0)
+      if (FIID_OBJ_GET_IDX (obj_sdr_record,
+                            TMPL_SDR_FULL_SENSOR_RECORD_UPPER_NON_RECOVERABLE_THRESHOLD,
+                            &val) < 0)
         {
           SDR_FIID_OBJECT_ERROR_TO_SDR_ERRNUM (ctx, obj_sdr_record);
           goto cleanup;
@@ -2858,6 +3145,7 @@ ipmi_sdr_parse_thresholds_raw (ipmi_sdr_ctx_t ctx,
                                uint8_t *upper_critical_threshold,
                                uint8_t *upper_non_recoverable_threshold)
 {
+  const struct ipmi_sdr_cache_descriptor *descriptor;
   fiid_obj_t obj_sdr_record = NULL;
   fiid_obj_t obj_sdr_record_threshold = NULL;
   uint32_t acceptable_record_types;
@@ -2865,6 +3153,27 @@ ipmi_sdr_parse_thresholds_raw (ipmi_sdr_ctx_t ctx,
   uint64_t val;
   int rv = -1;
 
+  if ((descriptor = _sdr_cache_descriptor (ctx,
+                                           sdr_record,
+                                           sdr_record_len,
+                                           IPMI_SDR_CACHE_DESCRIPTOR_THRESHOLDS_RAW)))
+    {
+      if (lower_non_critical_threshold)
+        *lower_non_critical_threshold = descriptor->lower_non_critical_threshold;
+      if (lower_critical_threshold)
+        *lower_critical_threshold = descriptor->lower_critical_threshold;
+      if (lower_non_recoverable_threshold)
+        *lower_non_recoverable_threshold = descriptor->lower_non_recoverable_threshold;
+      if (upper_non_critical_threshold)
+        *upper_non_critical_threshold = descriptor->upper_non_critical_threshold;
+      if (upper_critical_threshold)
+        *upper_critical_threshold = descriptor->upper_critical_threshold;
+      if (upper_non_recoverable_threshold)
+        *upper_non_recoverable_threshold = descriptor->upper_non_recoverable_threshold;
+      ctx->errnum = IPMI_SDR_ERR_SUCCESS;
+      return (0);
+    }
+
   acceptable_record_types = IPMI_SDR_PARSE_RECORD_TYPE_FULL_SENSOR_RECORD;
 
   if (!(obj_sdr_record = _sdr_record_get_common (ctx,
@@ -2898,9 +3207,9 @@ ipmi_sdr_parse_thresholds_raw (ipmi_sdr_ctx_t ctx,
 
   if (lower_non_critical_threshold)
     {
-      if (FIID_OBJ_GET (obj_sdr_record_threshold,
-                        "lower_non_critical_threshold",
-                        &val) < 0)
+      if (FIID_OBJ_GET_IDX (obj_sdr_record_threshold,
+                            TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_LOWER_NON_CRITICAL_THRESHOLD,
+                            &val) < 0)
         {
           SDR_FIID_OBJECT_ERROR_TO_SDR_ERRNUM (ctx, obj_sdr_record_threshold);
           goto cleanup;
@@ -2910,9 +3219,9 @@ ipmi_sdr_parse_thresholds_raw (ipmi_sdr_ctx_t ctx,
 
   if (lower_critical_threshold)
     {
-      if (FIID_OBJ_GET (obj_sdr_record_threshold,
-                        "lower_critical_threshold",
-                        &val) < 0)
+      if (FIID_OBJ_GET_IDX (obj_sdr_record_threshold,
+                            TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_LOWER_CRITICAL_THRESHOLD,
+                            &val) < 0)
         {
           SDR_FIID_OBJECT_ERROR_TO_SDR_ERRNUM (ctx, obj_sdr_record_threshold);
           goto cleanup;
@@ -2922,9 +3231,9 @@ ipmi_sdr_parse_thresholds_raw (ipmi_sdr_ctx_t ctx,
 
   if (lower_non_recoverable_threshold)
     {
-      if (FIID_OBJ_GET (obj_sdr_record_threshold,
-                        "lower_non_recoverable_threshold",
-                        &val) < 0)
+      if (FIID_OBJ_GET_IDX (obj_sdr_record_threshold,
+                            TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_LOWER_NON_RECOVERABLE_THRESHOLD,
+                            &val) < 0)
         {
           SDR_FIID_OBJECT_ERROR_TO_SDR_ERRNUM (ctx, obj_sdr_record_threshold);
           goto cleanup;
@@ -2934,9 +3243,9 @@ ipmi_sdr_parse_thresholds_raw (ipmi_sdr_ctx_t ctx,
 
   if (upper_non_critical_threshold)
     {
-      if (FIID_OBJ_GET (obj_sdr_record_threshold,
-                        "upper_non_critical_threshold",
-                        &val) < 0)
+      if (FIID_OBJ_GET_IDX (obj_sdr_record_threshold,
+                            TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_UPPER_NON_CRITICAL_THRESHOLD,
+                            &val) < 0)
         {
           SDR_FIID_OBJECT_ERROR_TO_SDR_ERRNUM (ctx, obj_sdr_record_threshold);
           goto cleanup;
@@ -2946,9 +3255,9 @@ ipmi_sdr_parse_thresholds_raw (ipmi_sdr_ctx_t ctx,
 
   if (upper_critical_threshold)
     {
-      if (FIID_OBJ_GET (obj_sdr_record_threshold,
-                        "upper_critical_threshold",
-                        &val) < 0)
+      if (FIID_OBJ_GET_IDX (obj_sdr_record_threshold,
+                            TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_UPPER_CRITICAL_THRESHOLD,
+                            &val) < 0)
         {
           SDR_FIID_OBJECT_ERROR_TO_SDR_ERRNUM (ctx, obj_sdr_record_threshold);
           goto cleanup;
@@ -2958,9 +3267,9 @@ ipmi_sdr_parse_thresholds_raw (ipmi_sdr_ctx_t ctx,
 
   if (upper_non_recoverable_threshold)
     {
-      if (FIID_OBJ_GET (obj_sdr_record_threshold,
-                        "upper_non_recoverable_threshold",
-                        &val) < 0)
+      if (FIID_OBJ_GET_IDX (obj_sdr_record_threshold,
+                            TMPL_SDR_FULL_SENSOR_RECORD_THRESHOLD_BASED_SENSORS_UPPER_NON_RECOVERABLE_THRESHOLD,
+                            &val) < 0)
         {
           SDR_FIID_OBJECT_ERROR_TO_SDR_ERRNUM (ctx, obj_sdr_record_threshold);
           goto cleanup;
@@ -3023,9 +3332,9 @@ ipmi_sdr_parse_tolerance (ipmi_sdr_ctx_t ctx,
     {
       double reading;
 
-      if (FIID_OBJ_GET (obj_sdr_record,
-                        "tolerance",
-                        &val) < 0)
+      if (FIID_OBJ_GET_IDX (obj_sdr_record,
+                            TMPL_SDR_FULL_SENSOR_RECORD_TOLERANCE,
+                            &val) < 0)
         {
           SDR_FIID_OBJECT_ERROR_TO_SDR_ERRNUM (ctx, obj_sdr_record);
           goto cleanup;
@@ -3091,18 +3400,18 @@ ipmi_sdr_parse_accuracy (ipmi_sdr_ctx_t ctx,
     {
       double reading;
 
-      if (FIID_OBJ_GET (obj_sdr_record,
-                        "accuracy_ls",
-                        &val) < 0)
+      if (FIID_OBJ_GET_IDX (obj_sdr_record,
+                            TMPL_SDR_FULL_SENSOR_RECORD_ACCURACY_LS,
+                            &val) < 0)
         {
           SDR_FIID_OBJECT_ERROR_TO_SDR_ERRNUM (ctx, obj_sdr_record);
           goto cleanup;
         }
       accuracy_ls = val;
 
-      if (FIID_OBJ_GET (obj_sdr_record,
-                        "accuracy_ms",
-                        &val) < 0)
+      if (FIID_OBJ_GET_IDX (obj_sdr_record,
+                            TMPL_SDR_FULL_SENSOR_RECORD_ACCURACY_MS,
+                            &val) < 0)
         {
           SDR_FIID_OBJECT_ERROR_TO_SDR_ERRNUM (ctx, obj_sdr_record);
           goto cleanup;
@@ -3112,9 +3421,9 @@ ipmi_sdr_parse_accuracy (ipmi_sdr_ctx_t ctx,
       /* accuracy is unsigned, no need to sign extend */
       accuracy_raw = accuracy_ls | (((uint16_t)accuracy_ms) << 6);
 
-      if (FIID_OBJ_GET (obj_sdr_record,
-                        "accuracy_exp",
-                        &val) < 0)
+      if (FIID_OBJ_GET_IDX (obj_sdr_record,
+                            TMPL_SDR_FULL_SENSOR_RECORD_ACCURACY_EXP,
+                            &val) < 0)
         {
           SDR_FIID_OBJECT_ERROR_TO_SDR_ERRNUM (ctx, obj_sdr_record);
           goto cleanup;
@@ -3156,11 +3465,25 @@ ipmi_sdr_parse_hysteresis (ipmi_sdr_ctx_t ctx,
                            uint8_t *positive_going_threshold_hysteresis,
                            uint8_t *negative_going_threshold_hysteresis)
 {
+  const struct ipmi_sdr_cache_descriptor *descriptor;
   fiid_obj_t obj_sdr_record = NULL;
   uint32_t acceptable_record_types;
   uint64_t val;
   int rv = -1;
 
+  if ((descriptor = _sdr_cache_descriptor (ctx,
+                                           sdr_record,
+                                           sdr_record_len,
+                                           IPMI_SDR_CACHE_DESCRIPTOR_HYSTERESIS)))
+    {
+      if (positive_going_threshold_hysteresis)
+        *positive_going_threshold_hysteresis = descriptor->positive_going_threshold_hysteresis;
+      if (negative_going_threshold_hysteresis)
+        *negative_going_threshold_hysteresis = descriptor->negative_going_threshold_hysteresis;
+      ctx->errnum = IPMI_SDR_ERR_SUCCESS;
+      return (0);
+    }
+
   acceptable_record_types = IPMI_SDR_PARSE_RECORD_TYPE_FULL_SENSOR_RECORD;
   acceptable_record_types |= IPMI_SDR_PARSE_RECORD_TYPE_COMPACT_SENSOR_RECORD;
 
@@ -3208,11 +3531,29 @@ ipmi_sdr_parse_sensor_record_sharing (ipmi_sdr_ctx_t ctx,
                                       uint8_t *id_string_instance_modifier_offset,
                                       uint8_t *entity_instance_sharing)
 {
+  const struct ipmi_sdr_cache_descriptor *descriptor;
   fiid_obj_t obj_sdr_record = NULL;
   uint32_t acceptable_record_types;
   uint64_t val;
   int rv = -1;
 
+  if ((descriptor = _sdr_cache_descriptor (ctx,
+                                           sdr_record,
+                                           sdr_record_len,
+                                           IPMI_SDR_CACHE_DESCRIPTOR_SENSOR_RECORD_SHARING)))
+    {
+      if (share_count)
+        *share_count = descriptor->share_count;
+      if (id_string_instance_modifier_type)
+        *id_string_instance_modifier_type = descriptor->id_string_instance_modifier_type;
+      if (id_string_instance_modifier_offset)
+        *id_string_instance_modifier_offset = descriptor->id_string_instance_modifier_offset;
+      if (entity_instance_sharing)
+        *entity_instance_sharing = descriptor->entity_instance_sharing;
+      ctx->errnum = IPMI_SDR_ERR_SUCCESS;
+      return (0);
+    }
+
   acceptable_record_types = IPMI_SDR_PARSE_RECORD_TYPE_COMPACT_SENSOR_RECORD;
   acceptable_record_types |= IPMI_SDR_PARSE_RECORD_TYPE_EVENT_ONLY_RECORD;
 
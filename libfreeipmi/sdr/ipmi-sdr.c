@@ -42,6 +42,7 @@
 
 #include "freeipmi/sdr/ipmi-sdr.h"
 
+#include "ipmi-sdr-cache-index.h"
 #include "ipmi-sdr-common.h"
 #include "ipmi-sdr-defs.h"
 #include "ipmi-sdr-trace.h"
@@ -135,6 +136,7 @@ ipmi_sdr_ctx_destroy (ipmi_sdr_ctx_t ctx)
   /* ignore potential error, void return func */
   if (ctx->sdr_cache)
     munmap (ctx->sdr_cache, ctx->file_size);
+  sdr_cache_index_destroy (ctx);
 
   list_destroy (ctx->saved_offsets);
 
@@ -33,6 +33,7 @@
 #include "freeipmi/api/ipmi-sel-cmds-api.h"
 #include "freeipmi/cmds/ipmi-sel-cmds.h"
 #include "freeipmi/fiid/fiid.h"
+#include "freeipmi/fiid/fiid-field-index.h"
 #include "freeipmi/record-format/ipmi-sel-record-format.h"
 #include "freeipmi/spec/ipmi-comp-code-spec.h"
 #include "freeipmi/util/ipmi-sensor-and-event-code-tables-util.h"
@@ -104,9 +105,9 @@ sel_get_reservation_id (ipmi_sel_ctx_t ctx,
       goto cleanup;
     }
 
-  if (FIID_OBJ_GET (obj_cmd_rs,
-                    "reservation_id",
-                    &val) < 0)
+  if (FIID_OBJ_GET_IDX (obj_cmd_rs,
+                        TMPL_CMD_RESERVE_SEL_RS_RESERVATION_ID,
+                        &val) < 0)
     {
       SEL_FIID_OBJECT_ERROR_TO_SEL_ERRNUM (ctx, obj_cmd_rs);
       goto cleanup;
@@ -140,25 +141,19 @@ sel_get_record_header_info (ipmi_sel_ctx_t ctx,
       goto cleanup;
     }
 
-  if (!(obj_sel_record_header = fiid_obj_create (tmpl_sel_record_header)))
+  if (!(obj_sel_record_header = fiid_obj_view_create (tmpl_sel_record_header,
+                                                      sel_entry->sel_event_record,
+                                                      sel_entry->sel_event_record_len)))
     {
       SEL_ERRNO_TO_SEL_ERRNUM (ctx, errno);
       goto cleanup;
     }
 
-  if (fiid_obj_set_all (obj_sel_record_header,
-                        sel_entry->sel_event_record,
-                        sel_entry->sel_event_record_len) < 0)
-    {
-      SEL_FIID_OBJECT_ERROR_TO_SEL_ERRNUM (ctx, obj_sel_record_header);
-      goto cleanup;
-    }
-
   if (record_id)
     {
-      if (FIID_OBJ_GET (obj_sel_record_header,
-                        "record_id",
-                        &val) < 0)
+      if (FIID_OBJ_GET_IDX (obj_sel_record_header,
+                            TMPL_SEL_RECORD_HEADER_RECORD_ID,
+                            &val) < 0)
         {
           SEL_FIID_OBJECT_ERROR_TO_SEL_ERRNUM (ctx, obj_sel_record_header);
           goto cleanup;
@@ -168,9 +163,9 @@ sel_get_record_header_info (ipmi_sel_ctx_t ctx,
 
   if (record_type)
     {
-      if (FIID_OBJ_GET (obj_sel_record_header,
-                        "record_type",
-                        &val) < 0)
+      if (FIID_OBJ_GET_IDX (obj_sel_record_header,
+                            TMPL_SEL_RECORD_HEADER_RECORD_TYPE,
+                            &val) < 0)
         {
           SEL_FIID_OBJECT_ERROR_TO_SEL_ERRNUM (ctx, obj_sel_record_header);
           goto cleanup;
@@ -194,6 +189,7 @@ sel_get_timestamp (ipmi_sel_ctx_t ctx,
                    uint32_t *timestamp)
 {
   fiid_obj_t obj_sel_record = NULL;
+  fiid_field_t *tmpl_sel_record;
   uint8_t record_type;
   int record_type_class;
   uint64_t val;
@@ -202,6 +198,8 @@ sel_get_timestamp (ipmi_sel_ctx_t ctx,
   assert (ctx);
   assert (ctx->magic == IPMI_SEL_CTX_MAGIC);
   assert (sel_entry);
+  /* timestamp is at the same position in both record templates */
+  assert (TMPL_SEL_SYSTEM_EVENT_RECORD_TIMESTAMP == TMPL_SEL_TIMESTAMPED_OEM_RECORD_TIMESTAMP);
 
   if (sel_entry->sel_event_record_len < IPMI_SEL_RECORD_LENGTH)
     {
@@ -225,35 +223,23 @@ sel_get_timestamp (ipmi_sel_ctx_t ctx,
     }
 
   if (record_type_class == IPMI_SEL_RECORD_TYPE_CLASS_SYSTEM_EVENT_RECORD)
-    {
-      if (!(obj_sel_record = fiid_obj_create (tmpl_sel_system_event_record)))
-        {
-          SEL_ERRNO_TO_SEL_ERRNUM (ctx, errno);
-          goto cleanup;
-        }
-    }
+    tmpl_sel_record = tmpl_sel_system_event_record;
   else
-    {
-      if (!(obj_sel_record = fiid_obj_create (tmpl_sel_timestamped_oem_record)))
-        {
-          SEL_ERRNO_TO_SEL_ERRNUM (ctx, errno);
-          goto cleanup;
-        }
-    }
+    tmpl_sel_record = tmpl_sel_timestamped_oem_record;
 
-  if (fiid_obj_set_all (obj_sel_record,
-                        sel_entry->sel_event_record,
-                        sel_entry->sel_event_record_len) < 0)
+  if (!(obj_sel_record = fiid_obj_view_create (tmpl_sel_record,
+                                               sel_entry->sel_event_record,
+                                               sel_entry->sel_event_record_len)))
     {
-      SEL_FIID_OBJECT_ERROR_TO_SEL_ERRNUM (ctx, obj_sel_record);
+      SEL_ERRNO_TO_SEL_ERRNUM (ctx, errno);
       goto cleanup;
     }
 
   if (timestamp)
     {
-      if (FIID_OBJ_GET (obj_sel_record,
-                        "timestamp",
-                        &val) < 0)
+      if (FIID_OBJ_GET_IDX (obj_sel_record,
+                            TMPL_SEL_SYSTEM_EVENT_RECORD_TIMESTAMP,
+                            &val) < 0)
         {
           SEL_FIID_OBJECT_ERROR_TO_SEL_ERRNUM (ctx, obj_sel_record);
           goto cleanup;
@@ -302,25 +288,19 @@ sel_get_manufacturer_id (ipmi_sel_ctx_t ctx,
       goto cleanup;
     }
 
-  if (!(obj_sel_record = fiid_obj_create (tmpl_sel_timestamped_oem_record)))
+  if (!(obj_sel_record = fiid_obj_view_create (tmpl_sel_timestamped_oem_record,
+                                               sel_entry->sel_event_record,
+                                               sel_entry->sel_event_record_len)))
     {
       SEL_ERRNO_TO_SEL_ERRNUM (ctx, errno);
       goto cleanup;
     }
 
-  if (fiid_obj_set_all (obj_sel_record,
-                        sel_entry->sel_event_record,
-                        sel_entry->sel_event_record_len) < 0)
-    {
-      SEL_FIID_OBJECT_ERROR_TO_SEL_ERRNUM (ctx, obj_sel_record);
-      goto cleanup;
-    }
-
   if (manufacturer_id)
     {
-      if (FIID_OBJ_GET (obj_sel_record,
-                        "manufacturer_id",
-                        &val) < 0)
+      if (FIID_OBJ_GET_IDX (obj_sel_record,
+                            TMPL_SEL_TIMESTAMPED_OEM_RECORD_MANUFACTURER_ID,
+                            &val) < 0)
         {
           SEL_FIID_OBJECT_ERROR_TO_SEL_ERRNUM (ctx, obj_sel_record);
           goto cleanup;
@@ -341,6 +321,7 @@ sel_get_oem (ipmi_sel_ctx_t ctx,
              unsigned int buflen)
 {
   fiid_obj_t obj_sel_record = NULL;
+  fiid_field_t *tmpl_sel_record;
   uint8_t record_type;
   int record_type_class;
   int len;
@@ -374,27 +355,15 @@ sel_get_oem (ipmi_sel_ctx_t ctx,
     }
 
   if (record_type_class == IPMI_SEL_RECORD_TYPE_CLASS_TIMESTAMPED_OEM_RECORD)
-    {
-      if (!(obj_sel_record = fiid_obj_create (tmpl_sel_timestamped_oem_record)))
-        {
-          SEL_ERRNO_TO_SEL_ERRNUM (ctx, errno);
-          goto cleanup;
-        }
-    }
+    tmpl_sel_record = tmpl_sel_timestamped_oem_record;
   else
-    {
-      if (!(obj_sel_record = fiid_obj_create (tmpl_sel_non_timestamped_oem_record)))
-        {
-          SEL_ERRNO_TO_SEL_ERRNUM (ctx, errno);
-          goto cleanup;
-        }
-    }
+    tmpl_sel_record = tmpl_sel_non_timestamped_oem_record;
 
-  if (fiid_obj_set_all (obj_sel_record,
-                        sel_entry->sel_event_record,
-                        sel_entry->sel_event_record_len) < 0)
+  if (!(obj_sel_record = fiid_obj_view_create (tmpl_sel_record,
+                                               sel_entry->sel_event_record,
+                                               sel_entry->sel_event_record_len)))
     {
-      SEL_FIID_OBJECT_ERROR_TO_SEL_ERRNUM (ctx, obj_sel_record);
+      SEL_ERRNO_TO_SEL_ERRNUM (ctx, errno);
       goto cleanup;
     }
 
@@ -452,55 +421,43 @@ sel_get_system_event_record (ipmi_sel_ctx_t ctx,
       goto cleanup;
     }
 
-  if (!(obj_sel_system_event_record = fiid_obj_create (tmpl_sel_system_event_record)))
+  if (!(obj_sel_system_event_record = fiid_obj_view_create (tmpl_sel_system_event_record,
+                                                            sel_entry->sel_event_record,
+                                                            sel_entry->sel_event_record_len)))
     {
       SEL_ERRNO_TO_SEL_ERRNUM (ctx, errno);
       goto cleanup;
     }
 
-  if (!(obj_sel_system_event_record_event_fields = fiid_obj_create (tmpl_sel_system_event_record_event_fields)))
+  if (!(obj_sel_system_event_record_event_fields = fiid_obj_view_create (tmpl_sel_system_event_record_event_fields,
+                                                                         sel_entry->sel_event_record,
+                                                                         sel_entry->sel_event_record_len)))
     {
       SEL_ERRNO_TO_SEL_ERRNUM (ctx, errno);
       goto cleanup;
     }
 
-  if (fiid_obj_set_all (obj_sel_system_event_record,
-                        sel_entry->sel_event_record,
-                        sel_entry->sel_event_record_len) < 0)
-    {
-      SEL_FIID_OBJECT_ERROR_TO_SEL_ERRNUM (ctx, obj_sel_system_event_record);
-      goto cleanup;
-    }
-
-  if (fiid_obj_set_all (obj_sel_system_event_record_event_fields,
-                        sel_entry->sel_event_record,
-                        sel_entry->sel_event_record_len) < 0)
-    {
-      SEL_FIID_OBJECT_ERROR_TO_SEL_ERRNUM (ctx, obj_sel_system_event_record_event_fields);
-      goto cleanup;
-    }
-
-  if (FIID_OBJ_GET (obj_sel_system_event_record,
-                    "timestamp",
-                    &val) < 0)
+  if (FIID_OBJ_GET_IDX (obj_sel_system_event_record,
+                        TMPL_SEL_SYSTEM_EVENT_RECORD_TIMESTAMP,
+                        &val) < 0)
     {
       SEL_FIID_OBJECT_ERROR_TO_SEL_ERRNUM (ctx, obj_sel_system_event_record);
       goto cleanup;
     }
   system_event_record_data->timestamp = val;
 
-  if (FIID_OBJ_GET (obj_sel_system_event_record,
-                    "generator_id.id_type",
-                    &val) < 0)
+  if (FIID_OBJ_GET_IDX (obj_sel_system_event_record,
+                        TMPL_SEL_SYSTEM_EVENT_RECORD_GENERATOR_ID_ID_TYPE,
+                        &val) < 0)
     {
       SEL_FIID_OBJECT_ERROR_TO_SEL_ERRNUM (ctx, obj_sel_system_event_record);
       goto cleanup;
     }
   generator_id_type = val;
 
-  if (FIID_OBJ_GET (obj_sel_system_event_record,
-                    "generator_id.id",
-                    &val) < 0)
+  if (FIID_OBJ_GET_IDX (obj_sel_system_event_record,
+                        TMPL_SEL_SYSTEM_EVENT_RECORD_GENERATOR_ID_ID,
+                        &val) < 0)
     {
       SEL_FIID_OBJECT_ERROR_TO_SEL_ERRNUM (ctx, obj_sel_system_event_record);
       goto cleanup;
@@ -509,117 +466,117 @@ sel_get_system_event_record (ipmi_sel_ctx_t ctx,
 
   system_event_record_data->generator_id = ((generator_id_address << 1) | generator_id_type);
 
-  if (FIID_OBJ_GET (obj_sel_system_event_record,
-                    "ipmb_device_lun",
-                    &val) < 0)
+  if (FIID_OBJ_GET_IDX (obj_sel_system_event_record,
+                        TMPL_SEL_SYSTEM_EVENT_RECORD_IPMB_DEVICE_LUN,
+                        &val) < 0)
     {
       SEL_FIID_OBJECT_ERROR_TO_SEL_ERRNUM (ctx, obj_sel_system_event_record);
       goto cleanup;
     }
   system_event_record_data->ipmb_device_lun = val;
 
-  if (FIID_OBJ_GET (obj_sel_system_event_record,
-                    "channel_number",
-                    &val) < 0)
+  if (FIID_OBJ_GET_IDX (obj_sel_system_event_record,
+                        TMPL_SEL_SYSTEM_EVENT_RECORD_CHANNEL_NUMBER,
+                        &val) < 0)
     {
       SEL_FIID_OBJECT_ERROR_TO_SEL_ERRNUM (ctx, obj_sel_system_event_record);
       goto cleanup;
     }
   system_event_record_data->channel_number = val;
 
-  if (FIID_OBJ_GET (obj_sel_system_event_record,
-                    "event_message_format_version",
-                    &val) < 0)
+  if (FIID_OBJ_GET_IDX (obj_sel_system_event_record,
+                        TMPL_SEL_SYSTEM_EVENT_RECORD_EVENT_MESSAGE_FORMAT_VERSION,
+                        &val) < 0)
     {
       SEL_FIID_OBJECT_ERROR_TO_SEL_ERRNUM (ctx, obj_sel_system_event_record);
       goto cleanup;
     }
   system_event_record_data->event_message_format_version = val;
 
-  if (FIID_OBJ_GET (obj_sel_system_event_record,
-                    "sensor_type",
-                    &val) < 0)
+  if (FIID_OBJ_GET_IDX (obj_sel_system_event_record,
+                        TMPL_SEL_SYSTEM_EVENT_RECORD_SENSOR_TYPE,
+                        &val) < 0)
     {
       SEL_FIID_OBJECT_ERROR_TO_SEL_ERRNUM (ctx, obj_sel_system_event_record);
       goto cleanup;
     }
   system_event_record_data->sensor_type = val;
 
-  if (FIID_OBJ_GET (obj_sel_system_event_record,
-                    "sensor_number",
-                    &val) < 0)
+  if (FIID_OBJ_GET_IDX (obj_sel_system_event_record,
+                        TMPL_SEL_SYSTEM_EVENT_RECORD_SENSOR_NUMBER,
+                        &val) < 0)
     {
       SEL_FIID_OBJECT_ERROR_TO_SEL_ERRNUM (ctx, obj_sel_system_event_record);
       goto cleanup;
     }
   system_event_record_data->sensor_number = val;
 
-  if (FIID_OBJ_GET (obj_sel_system_event_record,
-                    "event_type_code",
-                    &val) < 0)
+  if (FIID_OBJ_GET_IDX (obj_sel_system_event_record,
+                        TMPL_SEL_SYSTEM_EVENT_RECORD_EVENT_TYPE_CODE,
+                        &val) < 0)
     {
       SEL_FIID_OBJECT_ERROR_TO_SEL_ERRNUM (ctx, obj_sel_system_event_record);
       goto cleanup;
     }
   system_event_record_data->event_type_code = val;
 
-  if (FIID_OBJ_GET (obj_sel_system_event_record,
-                    "event_dir",
-                    &val) < 0)
+  if (FIID_OBJ_GET_IDX (obj_sel_system_event_record,
+                        TMPL_SEL_SYSTEM_EVENT_RECORD_EVENT_DIR,
+                        &val) < 0)
     {
       SEL_FIID_OBJECT_ERROR_TO_SEL_ERRNUM (ctx, obj_sel_system_event_record);
       goto cleanup;
     }
   system_event_record_data->event_direction = val;
 
-  if (FIID_OBJ_GET (obj_sel_system_event_record,
-                    "event_data1",
-                    &val) < 0)
+  if (FIID_OBJ_GET_IDX (obj_sel_system_event_record,
+                        TMPL_SEL_SYSTEM_EVENT_RECORD_EVENT_DATA1,
+                        &val) < 0)
     {
       SEL_FIID_OBJECT_ERROR_TO_SEL_ERRNUM (ctx, obj_sel_system_event_record);
       goto cleanup;
     }
   system_event_record_data->event_data1 = val;
 
-  if (FIID_OBJ_GET (obj_sel_system_event_record,
-                    "event_data2",
-                    &val) < 0)
+  if (FIID_OBJ_GET_IDX (obj_sel_system_event_record,
+                        TMPL_SEL_SYSTEM_EVENT_RECORD_EVENT_DATA2,
+                        &val) < 0)
     {
       SEL_FIID_OBJECT_ERROR_TO_SEL_ERRNUM (ctx, obj_sel_system_event_record);
       goto cleanup;
     }
   system_event_record_data->event_data2 = val;
 
-  if (FIID_OBJ_GET (obj_sel_system_event_record,
-                    "event_data3",
-                    &val) < 0)
+  if (FIID_OBJ_GET_IDX (obj_sel_system_event_record,
+                        TMPL_SEL_SYSTEM_EVENT_RECORD_EVENT_DATA3,
+                        &val) < 0)
     {
       SEL_FIID_OBJECT_ERROR_TO_SEL_ERRNUM (ctx, obj_sel_system_event_record);
       goto cleanup;
     }
   system_event_record_data->event_data3 = val;
 
-  if (FIID_OBJ_GET (obj_sel_system_event_record_event_fields,
-                    "offset_from_event_reading_type_code",
-                    &val) < 0)
+  if (FIID_OBJ_GET_IDX (obj_sel_system_event_record_event_fields,
+                        TMPL_SEL_SYSTEM_EVENT_RECORD_EVENT_FIELDS_OFFSET_FROM_EVENT_READING_TYPE_CODE,
+                        &val) < 0)
     {
       SEL_FIID_OBJECT_ERROR_TO_SEL_ERRNUM (ctx, obj_sel_system_event_record_event_fields);
       goto cleanup;
     }
   system_event_record_data->offset_from_event_reading_type_code = val;
 
-  if (FIID_OBJ_GET (obj_sel_system_event_record_event_fields,
-                    "event_data2_flag",
-                    &val) < 0)
+  if (FIID_OBJ_GET_IDX (obj_sel_system_event_record_event_fields,
+                        TMPL_SEL_SYSTEM_EVENT_RECORD_EVENT_FIELDS_EVENT_DATA2_FLAG,
+                        &val) < 0)
     {
       SEL_FIID_OBJECT_ERROR_TO_SEL_ERRNUM (ctx, obj_sel_system_event_record_event_fields);
       goto cleanup;
     }
   system_event_record_data->event_data2_flag = val;
 
-  if (FIID_OBJ_GET (obj_sel_system_event_record_event_fields,
-                    "event_data3_flag",
-                    &val) < 0)
+  if (FIID_OBJ_GET_IDX (obj_sel_system_event_record_event_fields,
+                        TMPL_SEL_SYSTEM_EVENT_RECORD_EVENT_FIELDS_EVENT_DATA3_FLAG,
+                        &val) < 0)
     {
       SEL_FIID_OBJECT_ERROR_TO_SEL_ERRNUM (ctx, obj_sel_system_event_record_event_fields);
       goto cleanup;
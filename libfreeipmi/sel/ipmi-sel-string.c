@@ -32,6 +32,7 @@
 #include "freeipmi/sel/ipmi-sel.h"
 
 #include "freeipmi/cmds/ipmi-sel-cmds.h"
+#include "freeipmi/fiid/fiid-field-index.h"
 #include "freeipmi/interpret/ipmi-interpret.h"
 #include "freeipmi/record-format/ipmi-sdr-record-format.h"
 #include "freeipmi/record-format/ipmi-sel-record-format.h"
@@ -636,32 +637,26 @@ _get_previous_state_or_severity (ipmi_sel_ctx_t ctx,
   assert (previous_offset_from_event_reading_type_code);
   assert (offset_from_severity_event_reading_type_code);
 
-  if (!(obj_sel_system_event_record = fiid_obj_create (tmpl_sel_system_event_record_discrete_previous_state_severity)))
+  if (!(obj_sel_system_event_record = fiid_obj_view_create (tmpl_sel_system_event_record_discrete_previous_state_severity,
+                                                            sel_entry->sel_event_record,
+                                                            sel_entry->sel_event_record_len)))
     {
       SEL_ERRNO_TO_SEL_ERRNUM (ctx, errno);
       goto cleanup;
     }
 
-  if (fiid_obj_set_all (obj_sel_system_event_record,
-                        sel_entry->sel_event_record,
-                        sel_entry->sel_event_record_len) < 0)
-    {
-      SEL_FIID_OBJECT_ERROR_TO_SEL_ERRNUM (ctx, obj_sel_system_event_record);
-      goto cleanup;
-    }
-
-  if (FIID_OBJ_GET (obj_sel_system_event_record,
-                    "previous_offset_from_event_reading_type_code",
-                    &val) < 0)
+  if (FIID_OBJ_GET_IDX (obj_sel_system_event_record,
+                        TMPL_SEL_SYSTEM_EVENT_RECORD_DISCRETE_PREVIOUS_STATE_SEVERITY_PREVIOUS_OFFSET_FROM_EVENT_READING_TYPE_CODE,
+                        &val) < 0)
     {
       SEL_FIID_OBJECT_ERROR_TO_SEL_ERRNUM (ctx, obj_sel_system_event_record);
       goto cleanup;
     }
   *previous_offset_from_event_reading_type_code = val;
 
-  if (FIID_OBJ_GET (obj_sel_system_event_record,
-                    "offset_from_severity_event_reading_type_code",
-                    &val) < 0)
+  if (FIID_OBJ_GET_IDX (obj_sel_system_event_record,
+                        TMPL_SEL_SYSTEM_EVENT_RECORD_DISCRETE_PREVIOUS_STATE_SEVERITY_OFFSET_FROM_SEVERITY_EVENT_READING_TYPE_CODE,
+                        &val) < 0)
     {
       SEL_FIID_OBJECT_ERROR_TO_SEL_ERRNUM (ctx, obj_sel_system_event_record);
       goto cleanup;
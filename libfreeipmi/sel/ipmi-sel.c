@@ -37,6 +37,7 @@
 #include "freeipmi/cmds/ipmi-sel-cmds.h"
 #include "freeipmi/debug/ipmi-debug.h"
 #include "freeipmi/fiid/fiid.h"
+#include "freeipmi/fiid/fiid-field-index.h"
 #include "freeipmi/interpret/ipmi-interpret.h"
 #include "freeipmi/record-format/ipmi-sel-record-format.h"
 #include "freeipmi/sdr/ipmi-sdr.h"
@@ -1084,7 +1085,7 @@ ipmi_sel_parse (ipmi_sel_ctx_t ctx,
       if (!parsed_atleast_one_entry)
         parsed_atleast_one_entry++;
 
-      if (FIID_OBJ_GET (obj_cmd_rs, "next_record_id", &val) < 0)
+      if (FIID_OBJ_GET_IDX (obj_cmd_rs, TMPL_CMD_GET_SEL_ENTRY_RS_NEXT_RECORD_ID, &val) < 0)
         {
           SEL_FIID_OBJECT_ERROR_TO_SEL_ERRNUM (ctx, obj_cmd_rs);
           goto cleanup;
@@ -37,6 +37,7 @@
 #include "freeipmi/cmds/ipmi-sensor-cmds.h"
 #include "freeipmi/debug/ipmi-debug.h"
 #include "freeipmi/fiid/fiid.h"
+#include "freeipmi/fiid/fiid-field-index.h"
 #include "freeipmi/record-format/ipmi-sdr-record-format.h"
 #include "freeipmi/spec/ipmi-channel-spec.h"
 #include "freeipmi/spec/ipmi-comp-code-spec.h"
@@ -268,9 +269,9 @@ _sensor_reading_corner_case_checks (ipmi_sensor_read_ctx_t ctx,
        * could mean anything.
        */
 
-      if ((flag = fiid_obj_get (obj_cmd_rs,
-                                "reading_state",
-                                &val)) < 0)
+      if ((flag = fiid_obj_get_idx (obj_cmd_rs,
+                                    TMPL_CMD_GET_SENSOR_READING_RS_READING_STATE,
+                                    &val)) < 0)
         {
           SENSOR_READ_FIID_OBJECT_ERROR_TO_SENSOR_READ_ERRNUM (ctx, obj_cmd_rs);
           return (-1);
@@ -284,9 +285,9 @@ _sensor_reading_corner_case_checks (ipmi_sensor_read_ctx_t ctx,
 
       if (!(ctx->flags & IPMI_SENSOR_READ_FLAGS_IGNORE_SCANNING_DISABLED))
         {
-          if ((flag = fiid_obj_get (obj_cmd_rs,
-                                    "sensor_scanning",
-                                    &val)) < 0)
+          if ((flag = fiid_obj_get_idx (obj_cmd_rs,
+                                        TMPL_CMD_GET_SENSOR_READING_RS_SENSOR_SCANNING,
+                                        &val)) < 0)
             {
               SENSOR_READ_FIID_OBJECT_ERROR_TO_SENSOR_READ_ERRNUM (ctx, obj_cmd_rs);
               return (-1);
@@ -608,9 +609,9 @@ ipmi_sensor_read (ipmi_sensor_read_ctx_t ctx,
       goto cleanup;
     }
 
-  if (FIID_OBJ_GET (obj_cmd_rs,
-                    "reading_state",
-                    &val) < 0)
+  if (FIID_OBJ_GET_IDX (obj_cmd_rs,
+                        TMPL_CMD_GET_SENSOR_READING_RS_READING_STATE,
+                        &val) < 0)
     {
       SENSOR_READ_FIID_OBJECT_ERROR_TO_SENSOR_READ_ERRNUM (ctx, obj_cmd_rs);
       goto cleanup;
@@ -634,9 +635,9 @@ ipmi_sensor_read (ipmi_sensor_read_ctx_t ctx,
    */
   if (!(ctx->flags & IPMI_SENSOR_READ_FLAGS_IGNORE_SCANNING_DISABLED))
     {
-      if (FIID_OBJ_GET (obj_cmd_rs,
-                        "sensor_scanning",
-                        &val) < 0)
+      if (FIID_OBJ_GET_IDX (obj_cmd_rs,
+                            TMPL_CMD_GET_SENSOR_READING_RS_SENSOR_SCANNING,
+                            &val) < 0)
         {
           SENSOR_READ_FIID_OBJECT_ERROR_TO_SENSOR_READ_ERRNUM (ctx, obj_cmd_rs);
           goto cleanup;
@@ -662,18 +663,18 @@ ipmi_sensor_read (ipmi_sensor_read_ctx_t ctx,
    * isn't set, we want to know and not error out.
    */
 
-  if ((sensor_event_bitmask1_flag = fiid_obj_get (obj_cmd_rs,
-                                                  "sensor_event_bitmask1",
-                                                  &val)) < 0)
+  if ((sensor_event_bitmask1_flag = fiid_obj_get_idx (obj_cmd_rs,
+                                                      TMPL_CMD_GET_SENSOR_READING_RS_SENSOR_EVENT_BITMASK1,
+                                                      &val)) < 0)
     {
       SENSOR_READ_FIID_OBJECT_ERROR_TO_SENSOR_READ_ERRNUM (ctx, obj_cmd_rs);
       goto cleanup;
     }
   sensor_event_bitmask1 = val;
 
-  if ((sensor_event_bitmask2_flag = fiid_obj_get (obj_cmd_rs,
-                                                  "sensor_event_bitmask2",
-                                                  &val)) < 0)
+  if ((sensor_event_bitmask2_flag = fiid_obj_get_idx (obj_cmd_rs,
+                                                      TMPL_CMD_GET_SENSOR_READING_RS_SENSOR_EVENT_BITMASK2,
+                                                      &val)) < 0)
     {
       SENSOR_READ_FIID_OBJECT_ERROR_TO_SENSOR_READ_ERRNUM (ctx, obj_cmd_rs);
       goto cleanup;
@@ -705,9 +706,9 @@ ipmi_sensor_read (ipmi_sensor_read_ctx_t ctx,
       goto cleanup;
     }
 
-  if (FIID_OBJ_GET (obj_cmd_rs,
-                    "sensor_reading",
-                    &val) < 0)
+  if (FIID_OBJ_GET_IDX (obj_cmd_rs,
+                        TMPL_CMD_GET_SENSOR_READING_RS_SENSOR_READING,
+                        &val) < 0)
     {
       SENSOR_READ_FIID_OBJECT_ERROR_TO_SENSOR_READ_ERRNUM (ctx, obj_cmd_rs);
       goto cleanup;
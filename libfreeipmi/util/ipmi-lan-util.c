@@ -777,3 +777,50 @@ ipmi_lan_check_packet_checksum (const void *pkt, unsigned int pkt_len)
   return (1);
 }
 
+int
+ipmi_lan_check_msg_checksum (const void *lan_msg, unsigned int lan_msg_len)
+{
+  int checksum1_block_len;
+  unsigned int checksum2_block_index, checksum2_block_len;
+  uint8_t checksum1_recv, checksum1_calc, checksum2_recv, checksum2_calc;
+
+  if (!lan_msg
+      || !lan_msg_len)
+    {
+      SET_ERRNO (EINVAL);
+      return (-1);
+    }
+
+  if ((checksum1_block_len = fiid_template_block_len_bytes (tmpl_lan_msg_hdr_rs,
+                                                            "rq_addr",
+                                                            "net_fn")) < 0)
+    {
+      ERRNO_TRACE (errno);
+      return (-1);
+    }
+
+  if (lan_msg_len < (checksum1_block_len + 1))
+    return (0);
+
+  checksum1_calc = ipmi_checksum (lan_msg, checksum1_block_len);
+  checksum1_recv = ((uint8_t *)lan_msg)[checksum1_block_len];
+
+  if (checksum1_calc != checksum1_recv)
+    return (0);
+
+  checksum2_block_index = checksum1_block_len + 1;
+
+  if (lan_msg_len <= (checksum2_block_index + 1))
+    return (0);
+
+  checksum2_block_len = lan_msg_len - checksum2_block_index - 1;
+
+  checksum2_calc = ipmi_checksum (lan_msg + checksum2_block_index, checksum2_block_len);
+  checksum2_recv = ((uint8_t *)lan_msg)[checksum2_block_index + checksum2_block_len];
+
+  if (checksum2_calc != checksum2_recv)
+    return (0);
+
+  return (1);
+}
+
@@ -666,6 +666,19 @@ ipmi_calculate_rmcpplus_session_keys (uint8_t authentication_algorithm,
   return (rv);
 }
 
+void
+ipmi_flush_rmcpplus_session_keys (const void *integrity_key,
+                                  unsigned int integrity_key_len,
+                                  const void *confidentiality_key,
+                                  unsigned int confidentiality_key_len)
+{
+  if (integrity_key && integrity_key_len)
+    crypt_handle_cache_flush (integrity_key, integrity_key_len);
+
+  if (confidentiality_key && confidentiality_key_len)
+    crypt_handle_cache_flush (confidentiality_key, confidentiality_key_len);
+}
+
 int
 ipmi_calculate_rakp_3_key_exchange_authentication_code (uint8_t authentication_algorithm,
                                                         const void *k_uid,
@@ -1279,14 +1292,14 @@ ipmi_rmcpplus_check_packet_session_authentication_code (uint8_t integrity_algori
   if (integrity_algorithm == IPMI_INTEGRITY_ALGORITHM_HMAC_SHA1_96)
     {
       hash_algorithm = IPMI_CRYPT_HASH_SHA1;
-      hash_flags = IPMI_CRYPT_HASH_FLAGS_HMAC;
+      hash_flags = IPMI_CRYPT_HASH_FLAGS_HMAC | IPMI_CRYPT_HASH_FLAGS_CACHE;
       expected_digest_len = IPMI_HMAC_SHA1_DIGEST_LENGTH;
       compare_digest_len = IPMI_HMAC_SHA1_96_AUTHENTICATION_CODE_LENGTH;
     }
   else if (integrity_algorithm == IPMI_INTEGRITY_ALGORITHM_HMAC_MD5_128)
     {
       hash_algorithm = IPMI_CRYPT_HASH_MD5;
-      hash_flags = IPMI_CRYPT_HASH_FLAGS_HMAC;
+      hash_flags = IPMI_CRYPT_HASH_FLAGS_HMAC | IPMI_CRYPT_HASH_FLAGS_CACHE;
       expected_digest_len = IPMI_HMAC_MD5_DIGEST_LENGTH;
       compare_digest_len = IPMI_HMAC_MD5_128_AUTHENTICATION_CODE_LENGTH;
     }
@@ -1300,7 +1313,7 @@ ipmi_rmcpplus_check_packet_session_authentication_code (uint8_t integrity_algori
   else /* IPMI_INTEGRITY_ALGORITHM_HMAC_SHA256_128 */
     {
       hash_algorithm = IPMI_CRYPT_HASH_SHA256;
-      hash_flags = IPMI_CRYPT_HASH_FLAGS_HMAC;
+      hash_flags = IPMI_CRYPT_HASH_FLAGS_HMAC | IPMI_CRYPT_HASH_FLAGS_CACHE;
       expected_digest_len = IPMI_HMAC_SHA256_DIGEST_LENGTH;
       compare_digest_len = IPMI_HMAC_SHA256_128_AUTHENTICATION_CODE_LENGTH;
     }
@@ -1072,6 +1072,12 @@ __ipmiconsole_ctx_connection_cleanup (ipmiconsole_ctx_t c, int session_submitted
   if (c->connection.obj_close_session_rs)
     fiid_obj_destroy (c->connection.obj_close_session_rs);
 
+  /* Release crypt state cached against this session's keys */
+  ipmi_flush_rmcpplus_session_keys (c->session.integrity_key_ptr,
+                                    c->session.integrity_key_len,
+                                    c->session.confidentiality_key_ptr,
+                                    c->session.confidentiality_key_len);
+
   /* If the session was never submitted (i.e. error in API land), don't
    * move this around.
    */
@@ -1305,6 +1311,14 @@ ipmiconsole_ctx_session_setup (ipmiconsole_ctx_t c)
       goto cleanup;
     }
 
+  /* Keys from a previous attempt (i.e. we are starting over on a
+   * new port) are no longer needed.
+   */
+  ipmi_flush_rmcpplus_session_keys (c->session.integrity_key_ptr,
+                                    c->session.integrity_key_len,
+                                    c->session.confidentiality_key_ptr,
+                                    c->session.confidentiality_key_len);
+
   /* Keys and ptrs will be calculated during session setup.  We just
    * memet/clear here.
    */
@@ -82,7 +82,9 @@ _inband_init (ipmi_monitoring_ctx_t c,
            && (config->driver_type != IPMI_MONITORING_DRIVER_TYPE_KCS
                && config->driver_type != IPMI_MONITORING_DRIVER_TYPE_SSIF
                && config->driver_type != IPMI_MONITORING_DRIVER_TYPE_OPENIPMI
-               && config->driver_type != IPMI_MONITORING_DRIVER_TYPE_SUNBMC))
+               && config->driver_type != IPMI_MONITORING_DRIVER_TYPE_SUNBMC
+               && config->driver_type != IPMI_MONITORING_DRIVER_TYPE_MOCK
+               && config->driver_type != IPMI_MONITORING_DRIVER_TYPE_BROKER))
           || (config->workaround_flags & ~workaround_flags_mask)))
     {
       c->errnum = IPMI_MONITORING_ERR_PARAMETERS;
@@ -157,8 +159,12 @@ _inband_init (ipmi_monitoring_ctx_t c,
         driver_type = IPMI_DEVICE_SSIF;
       else if (config->driver_type == IPMI_MONITORING_DRIVER_TYPE_OPENIPMI)
         driver_type = IPMI_DEVICE_OPENIPMI;
-      else
+      else if (config->driver_type == IPMI_MONITORING_DRIVER_TYPE_SUNBMC)
         driver_type = IPMI_DEVICE_SUNBMC;
+      else if (config->driver_type == IPMI_MONITORING_DRIVER_TYPE_MOCK)
+        driver_type = IPMI_DEVICE_MOCK;
+      else
+        driver_type = IPMI_DEVICE_BROKER;
 
       if (ipmi_ctx_open_inband (c->ipmi_ctx,
                                 driver_type,